@@ -21,6 +21,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -101,6 +103,8 @@ bread(uint dev, uint blockno)
   b = bget(dev, blockno);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
+    if(myproc())
+      myproc()->nblkread++;
   }
   return b;
 }
@@ -113,6 +117,8 @@ bwrite(struct buf *b)
     panic("bwrite");
   b->flags |= B_DIRTY;
   iderw(b);
+  if(myproc())
+    myproc()->nblkwrite++;
 }
 
 // Release a locked buffer.
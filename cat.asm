@@ -0,0 +1,1780 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c6 04             	add    $0x4,%esi
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7e 68                	jle    91 <main+0x91>
+  29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	6a 00                	push   $0x0
+  35:	ff 36                	push   (%esi)
+  37:	e8 57 03 00 00       	call   393 <open>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	89 c3                	mov    %eax,%ebx
+  41:	85 c0                	test   %eax,%eax
+  43:	78 38                	js     7d <main+0x7d>
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+  while((n = splice(fd, 1, CHUNK)) > 0)
+  48:	83 ec 04             	sub    $0x4,%esp
+  4b:	68 00 10 00 00       	push   $0x1000
+  50:	6a 01                	push   $0x1
+  52:	53                   	push   %ebx
+  53:	e8 03 04 00 00       	call   45b <splice>
+  58:	83 c4 10             	add    $0x10,%esp
+  5b:	85 c0                	test   %eax,%eax
+  5d:	7f e9                	jg     48 <main+0x48>
+  if(n < 0){
+  5f:	75 3f                	jne    a0 <main+0xa0>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    close(fd);
+  61:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  64:	83 c7 01             	add    $0x1,%edi
+  67:	83 c6 04             	add    $0x4,%esi
+    close(fd);
+  6a:	53                   	push   %ebx
+  6b:	e8 0b 03 00 00       	call   37b <close>
+  for(i = 1; i < argc; i++){
+  70:	83 c4 10             	add    $0x10,%esp
+  73:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  76:	75 b8                	jne    30 <main+0x30>
+  }
+  exit();
+  78:	e8 d6 02 00 00       	call   353 <exit>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  7d:	52                   	push   %edx
+  7e:	ff 36                	push   (%esi)
+  80:	68 73 0b 00 00       	push   $0xb73
+  85:	6a 01                	push   $0x1
+  87:	e8 64 05 00 00       	call   5f0 <printf>
+      exit();
+  8c:	e8 c2 02 00 00       	call   353 <exit>
+    cat(0);
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	6a 00                	push   $0x0
+  96:	e8 25 00 00 00       	call   c0 <cat>
+    exit();
+  9b:	e8 b3 02 00 00       	call   353 <exit>
+    printf(1, "cat: splice error\n");
+  a0:	50                   	push   %eax
+  a1:	50                   	push   %eax
+  a2:	68 60 0b 00 00       	push   $0xb60
+  a7:	6a 01                	push   $0x1
+  a9:	e8 42 05 00 00       	call   5f0 <printf>
+    exit();
+  ae:	e8 a0 02 00 00       	call   353 <exit>
+  b3:	66 90                	xchg   %ax,%ax
+  b5:	66 90                	xchg   %ax,%ax
+  b7:	66 90                	xchg   %ax,%ax
+  b9:	66 90                	xchg   %ax,%ax
+  bb:	66 90                	xchg   %ax,%ax
+  bd:	66 90                	xchg   %ax,%ax
+  bf:	90                   	nop
+
+000000c0 <cat>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	53                   	push   %ebx
+  c4:	83 ec 04             	sub    $0x4,%esp
+  c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while((n = splice(fd, 1, CHUNK)) > 0)
+  ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	68 00 10 00 00       	push   $0x1000
+  d8:	6a 01                	push   $0x1
+  da:	53                   	push   %ebx
+  db:	e8 7b 03 00 00       	call   45b <splice>
+  e0:	83 c4 10             	add    $0x10,%esp
+  e3:	85 c0                	test   %eax,%eax
+  e5:	7f e9                	jg     d0 <cat+0x10>
+  if(n < 0){
+  e7:	75 05                	jne    ee <cat+0x2e>
+}
+  e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+    printf(1, "cat: splice error\n");
+  ee:	50                   	push   %eax
+  ef:	50                   	push   %eax
+  f0:	68 60 0b 00 00       	push   $0xb60
+  f5:	6a 01                	push   $0x1
+  f7:	e8 f4 04 00 00       	call   5f0 <printf>
+    exit();
+  fc:	e8 52 02 00 00       	call   353 <exit>
+ 101:	66 90                	xchg   %ax,%ax
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 1e 01 00 00       	call   36b <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 f1 00 00 00       	call   393 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 f4 00 00 00       	call   3ab <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 ba 00 00 00       	call   37b <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+
+0000034b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <exit>:
+SYSCALL(exit)
+ 353:	b8 02 00 00 00       	mov    $0x2,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <wait>:
+SYSCALL(wait)
+ 35b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <pipe>:
+SYSCALL(pipe)
+ 363:	b8 04 00 00 00       	mov    $0x4,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <read>:
+SYSCALL(read)
+ 36b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <write>:
+SYSCALL(write)
+ 373:	b8 10 00 00 00       	mov    $0x10,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <close>:
+SYSCALL(close)
+ 37b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <kill>:
+SYSCALL(kill)
+ 383:	b8 06 00 00 00       	mov    $0x6,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <exec>:
+SYSCALL(exec)
+ 38b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <open>:
+SYSCALL(open)
+ 393:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mknod>:
+SYSCALL(mknod)
+ 39b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <unlink>:
+SYSCALL(unlink)
+ 3a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <fstat>:
+SYSCALL(fstat)
+ 3ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <link>:
+SYSCALL(link)
+ 3b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mkdir>:
+SYSCALL(mkdir)
+ 3bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <chdir>:
+SYSCALL(chdir)
+ 3c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <dup>:
+SYSCALL(dup)
+ 3cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getpid>:
+SYSCALL(getpid)
+ 3d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <sbrk>:
+SYSCALL(sbrk)
+ 3db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <sleep>:
+SYSCALL(sleep)
+ 3e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <uptime>:
+SYSCALL(uptime)
+ 3eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 3f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 3fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 403:	b8 18 00 00 00       	mov    $0x18,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 40b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 413:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 41b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 423:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <setpriority>:
+SYSCALL(setpriority)
+ 42b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 433:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <getcpustats>:
+SYSCALL(getcpustats)
+ 43b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <setscheduler>:
+SYSCALL(setscheduler)
+ 443:	b8 20 00 00 00       	mov    $0x20,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 44b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getscheduler>:
+SYSCALL(getscheduler)
+ 453:	b8 22 00 00 00       	mov    $0x22,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <splice>:
+SYSCALL(splice)
+ 45b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <readv>:
+SYSCALL(readv)
+ 463:	b8 24 00 00 00       	mov    $0x24,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <writev>:
+SYSCALL(writev)
+ 46b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <pread>:
+SYSCALL(pread)
+ 473:	b8 26 00 00 00       	mov    $0x26,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <pwrite>:
+SYSCALL(pwrite)
+ 47b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getlogstat>:
+SYSCALL(getlogstat)
+ 483:	b8 28 00 00 00       	mov    $0x28,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mount>:
+SYSCALL(mount)
+ 48b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <umount>:
+SYSCALL(umount)
+ 493:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mmap>:
+SYSCALL(mmap)
+ 49b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <munmap>:
+SYSCALL(munmap)
+ 4a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <membench>:
+SYSCALL(membench)
+ 4ab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getlockstat>:
+SYSCALL(getlockstat)
+ 4b3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <lockbench>:
+SYSCALL(lockbench)
+ 4bb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <prof>:
+SYSCALL(prof)
+ 4c3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <tracectl>:
+SYSCALL(tracectl)
+ 4cb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <traceread>:
+SYSCALL(traceread)
+ 4d3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <getsysstat>:
+SYSCALL(getsysstat)
+ 4db:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 4e3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getschedwait>:
+SYSCALL(getschedwait)
+ 4eb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <mlfqread>:
+SYSCALL(mlfqread)
+ 4f3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <dllock>:
+SYSCALL(dllock)
+ 4fb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 503:	b8 38 00 00 00       	mov    $0x38,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 50b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <clone>:
+SYSCALL(clone)
+ 513:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <join>:
+SYSCALL(join)
+ 51b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <futex>:
+SYSCALL(futex)
+ 523:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <shmat>:
+SYSCALL(shmat)
+ 52b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <shmdt>:
+SYSCALL(shmdt)
+ 533:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <poll>:
+SYSCALL(poll)
+ 53b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+ 543:	66 90                	xchg   %ax,%ax
+ 545:	66 90                	xchg   %ax,%ax
+ 547:	66 90                	xchg   %ax,%ax
+ 549:	66 90                	xchg   %ax,%ax
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 e8 0b 00 00 	movzbl 0xbe8(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 a6 fd ff ff       	call   373 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 3c fd ff ff       	call   373 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 90 0b 00 00 	jmp    *0xb90(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 dd fc ff ff       	call   373 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 cb fc ff ff       	call   373 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 51 fc ff ff       	call   373 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 01 fc ff ff       	call   373 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb 88 0b 00 00       	mov    $0xb88,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a3:	a1 34 10 00 00       	mov    0x1034,%eax
+{
+ 7a8:	89 e5                	mov    %esp,%ebp
+ 7aa:	56                   	push   %esi
+ 7ab:	53                   	push   %ebx
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b4:	39 ca                	cmp    %ecx,%edx
+ 7b6:	73 30                	jae    7e8 <bigfree+0x48>
+ 7b8:	39 c1                	cmp    %eax,%ecx
+ 7ba:	72 04                	jb     7c0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7bc:	39 c2                	cmp    %eax,%edx
+ 7be:	72 f0                	jb     7b0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 7c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 7c6:	39 f0                	cmp    %esi,%eax
+ 7c8:	74 26                	je     7f0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7d2:	39 d9                	cmp    %ebx,%ecx
+ 7d4:	74 30                	je     806 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7d8:	5b                   	pop    %ebx
+  freep = p;
+ 7d9:	89 15 34 10 00 00    	mov    %edx,0x1034
+}
+ 7df:	5e                   	pop    %esi
+ 7e0:	5d                   	pop    %ebp
+ 7e1:	c3                   	ret
+ 7e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e8:	39 c1                	cmp    %eax,%ecx
+ 7ea:	72 d0                	jb     7bc <bigfree+0x1c>
+ 7ec:	eb c2                	jmp    7b0 <bigfree+0x10>
+ 7ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7f0:	03 58 04             	add    0x4(%eax),%ebx
+ 7f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f6:	8b 02                	mov    (%edx),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 802:	39 d9                	cmp    %ebx,%ecx
+ 804:	75 d0                	jne    7d6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 806:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 809:	89 15 34 10 00 00    	mov    %edx,0x1034
+    p->s.size += bp->s.size;
+ 80f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 812:	8b 09                	mov    (%ecx),%ecx
+ 814:	89 0a                	mov    %ecx,(%edx)
+}
+ 816:	5b                   	pop    %ebx
+ 817:	5e                   	pop    %esi
+ 818:	5d                   	pop    %ebp
+ 819:	c3                   	ret
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000820 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	89 c7                	mov    %eax,%edi
+ 826:	56                   	push   %esi
+ 827:	53                   	push   %ebx
+ 828:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 82b:	a1 34 10 00 00       	mov    0x1034,%eax
+ 830:	85 c0                	test   %eax,%eax
+ 832:	0f 84 88 00 00 00    	je     8c0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 838:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 83a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 83d:	39 f9                	cmp    %edi,%ecx
+ 83f:	73 5f                	jae    8a0 <bigalloc+0x80>
+  if(nu < 4096)
+ 841:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 846:	39 df                	cmp    %ebx,%edi
+ 848:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 84b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 852:	eb 0d                	jmp    861 <bigalloc+0x41>
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 858:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 85a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 85d:	39 f9                	cmp    %edi,%ecx
+ 85f:	73 3f                	jae    8a0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 861:	89 d0                	mov    %edx,%eax
+ 863:	39 15 34 10 00 00    	cmp    %edx,0x1034
+ 869:	75 ed                	jne    858 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 86b:	83 ec 0c             	sub    $0xc,%esp
+ 86e:	56                   	push   %esi
+ 86f:	e8 67 fb ff ff       	call   3db <sbrk>
+  if(p == (char*)-1)
+ 874:	83 c4 10             	add    $0x10,%esp
+ 877:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 87a:	74 11                	je     88d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 87c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 87f:	e8 1c ff ff ff       	call   7a0 <bigfree>
+  return freep;
+ 884:	a1 34 10 00 00       	mov    0x1034,%eax
+      if((p = morecore(nunits)) == 0)
+ 889:	85 c0                	test   %eax,%eax
+ 88b:	75 cb                	jne    858 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 88d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 890:	31 d2                	xor    %edx,%edx
+}
+ 892:	5b                   	pop    %ebx
+ 893:	89 d0                	mov    %edx,%eax
+ 895:	5e                   	pop    %esi
+ 896:	5f                   	pop    %edi
+ 897:	5d                   	pop    %ebp
+ 898:	c3                   	ret
+ 899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8a9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8ac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8af:	a3 34 10 00 00       	mov    %eax,0x1034
+}
+ 8b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b7:	89 d0                	mov    %edx,%eax
+ 8b9:	5b                   	pop    %ebx
+ 8ba:	5e                   	pop    %esi
+ 8bb:	5f                   	pop    %edi
+ 8bc:	5d                   	pop    %ebp
+ 8bd:	c3                   	ret
+ 8be:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 34 10 00 00 38 	movl   $0x1038,0x1034
+ 8c7:	10 00 00 
+    base.s.size = 0;
+ 8ca:	ba 38 10 00 00       	mov    $0x1038,%edx
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 38 10 00 00 38 	movl   $0x1038,0x1038
+ 8d6:	10 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 3c 10 00 00 00 	movl   $0x0,0x103c
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 59 ff ff ff       	jmp    841 <bigalloc+0x21>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 0a                	mov    (%edx),%ecx
+ 8f2:	89 08                	mov    %ecx,(%eax)
+ 8f4:	eb b9                	jmp    8af <bigalloc+0x8f>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <free>:
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	53                   	push   %ebx
+ 904:	83 ec 04             	sub    $0x4,%esp
+ 907:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 90a:	85 c9                	test   %ecx,%ecx
+ 90c:	74 58                	je     966 <free+0x66>
+  bp = (Header*)ap - 1;
+ 90e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 911:	ba 01 00 00 00       	mov    $0x1,%edx
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+ 920:	89 d0                	mov    %edx,%eax
+ 922:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+  while(xchg(&locked, 1) != 0)
+ 929:	85 c0                	test   %eax,%eax
+ 92b:	75 f3                	jne    920 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 92d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 930:	83 fa 40             	cmp    $0x40,%edx
+ 933:	77 3b                	ja     970 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 935:	83 fa 02             	cmp    $0x2,%edx
+ 938:	76 3f                	jbe    979 <free+0x79>
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 940:	83 c0 01             	add    $0x1,%eax
+ 943:	39 14 85 00 0c 00 00 	cmp    %edx,0xc00(,%eax,4)
+ 94a:	72 f4                	jb     940 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 94c:	8b 14 85 00 10 00 00 	mov    0x1000(,%eax,4),%edx
+    classfree[c] = bp;
+ 953:	89 1c 85 00 10 00 00 	mov    %ebx,0x1000(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 95a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 95d:	31 c0                	xor    %eax,%eax
+ 95f:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+}
+ 966:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 969:	c9                   	leave
+ 96a:	c3                   	ret
+ 96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+    bigfree(bp);
+ 970:	89 d8                	mov    %ebx,%eax
+ 972:	e8 29 fe ff ff       	call   7a0 <bigfree>
+ 977:	eb e4                	jmp    95d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 979:	31 c0                	xor    %eax,%eax
+ 97b:	eb cf                	jmp    94c <free+0x4c>
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 980:	55                   	push   %ebp
+ 981:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	57                   	push   %edi
+ 989:	56                   	push   %esi
+ 98a:	53                   	push   %ebx
+ 98b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 98e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 991:	8d 50 07             	lea    0x7(%eax),%edx
+ 994:	c1 ea 03             	shr    $0x3,%edx
+ 997:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9a0:	89 c8                	mov    %ecx,%eax
+ 9a2:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+ 9a9:	85 c0                	test   %eax,%eax
+ 9ab:	75 f3                	jne    9a0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 9ad:	89 c3                	mov    %eax,%ebx
+ 9af:	83 fa 40             	cmp    $0x40,%edx
+ 9b2:	77 4c                	ja     a00 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 9b4:	be 02 00 00 00       	mov    $0x2,%esi
+ 9b9:	83 fa 02             	cmp    $0x2,%edx
+ 9bc:	76 10                	jbe    9ce <malloc+0x4e>
+ 9be:	66 90                	xchg   %ax,%ax
+ 9c0:	83 c3 01             	add    $0x1,%ebx
+ 9c3:	8b 34 9d 00 0c 00 00 	mov    0xc00(,%ebx,4),%esi
+ 9ca:	39 d6                	cmp    %edx,%esi
+ 9cc:	72 f2                	jb     9c0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 9ce:	8b 14 9d 00 10 00 00 	mov    0x1000(,%ebx,4),%edx
+ 9d5:	85 d2                	test   %edx,%edx
+ 9d7:	74 47                	je     a20 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 9d9:	8b 3a                	mov    (%edx),%edi
+ 9db:	89 3c 9d 00 10 00 00 	mov    %edi,0x1000(,%ebx,4)
+ 9e2:	31 c0                	xor    %eax,%eax
+ 9e4:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 9eb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 9ee:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 9f1:	5b                   	pop    %ebx
+ 9f2:	5e                   	pop    %esi
+ 9f3:	5f                   	pop    %edi
+ 9f4:	5d                   	pop    %ebp
+ 9f5:	c3                   	ret
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ a00:	89 d0                	mov    %edx,%eax
+ a02:	e8 19 fe ff ff       	call   820 <bigalloc>
+ a07:	89 c2                	mov    %eax,%edx
+ a09:	89 d8                	mov    %ebx,%eax
+ a0b:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+  return p ? (void*)(p + 1) : 0;
+ a12:	85 d2                	test   %edx,%edx
+ a14:	75 d5                	jne    9eb <malloc+0x6b>
+ a16:	31 c0                	xor    %eax,%eax
+}
+ a18:	83 c4 1c             	add    $0x1c,%esp
+ a1b:	5b                   	pop    %ebx
+ a1c:	5e                   	pop    %esi
+ a1d:	5f                   	pop    %edi
+ a1e:	5d                   	pop    %ebp
+ a1f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ a20:	b8 00 02 00 00       	mov    $0x200,%eax
+ a25:	e8 f6 fd ff ff       	call   820 <bigalloc>
+ a2a:	85 c0                	test   %eax,%eax
+ a2c:	74 44                	je     a72 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a2e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ a35:	8b 14 9d 00 10 00 00 	mov    0x1000(,%ebx,4),%edx
+ a3c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ a3f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ a42:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ a48:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ a4b:	39 cf                	cmp    %ecx,%edi
+ a4d:	72 8a                	jb     9d9 <malloc+0x59>
+ a4f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ a52:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ a55:	8d 76 00             	lea    0x0(%esi),%esi
+ a58:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ a5a:	89 70 04             	mov    %esi,0x4(%eax)
+ a5d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a5f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ a61:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a63:	01 d8                	add    %ebx,%eax
+ a65:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ a68:	73 ee                	jae    a58 <malloc+0xd8>
+ a6a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ a6d:	e9 69 ff ff ff       	jmp    9db <malloc+0x5b>
+ a72:	f0 87 05 e0 0f 00 00 	lock xchg %eax,0xfe0
+  return p ? (void*)(p + 1) : 0;
+ a79:	31 c0                	xor    %eax,%eax
+ a7b:	eb 9b                	jmp    a18 <malloc+0x98>
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	56                   	push   %esi
+ a84:	53                   	push   %ebx
+ a85:	8b 45 08             	mov    0x8(%ebp),%eax
+ a88:	f7 65 0c             	mull   0xc(%ebp)
+ a8b:	70 33                	jo     ac0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ a8d:	83 ec 0c             	sub    $0xc,%esp
+ a90:	89 c3                	mov    %eax,%ebx
+ a92:	50                   	push   %eax
+ a93:	e8 e8 fe ff ff       	call   980 <malloc>
+ a98:	83 c4 10             	add    $0x10,%esp
+ a9b:	89 c6                	mov    %eax,%esi
+ a9d:	85 c0                	test   %eax,%eax
+ a9f:	74 1f                	je     ac0 <calloc+0x40>
+    memset(p, 0, n);
+ aa1:	83 ec 04             	sub    $0x4,%esp
+ aa4:	53                   	push   %ebx
+ aa5:	6a 00                	push   $0x0
+ aa7:	50                   	push   %eax
+ aa8:	e8 23 f7 ff ff       	call   1d0 <memset>
+ aad:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ab3:	89 f0                	mov    %esi,%eax
+ ab5:	5b                   	pop    %ebx
+ ab6:	5e                   	pop    %esi
+ ab7:	5d                   	pop    %ebp
+ ab8:	c3                   	ret
+ ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ ac3:	31 f6                	xor    %esi,%esi
+}
+ ac5:	89 f0                	mov    %esi,%eax
+ ac7:	5b                   	pop    %ebx
+ ac8:	5e                   	pop    %esi
+ ac9:	5d                   	pop    %ebp
+ aca:	c3                   	ret
+ acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+
+00000ad0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 0c             	sub    $0xc,%esp
+ ad9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ adf:	85 db                	test   %ebx,%ebx
+ ae1:	74 55                	je     b38 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ae3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ae6:	89 de                	mov    %ebx,%esi
+ ae8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ aef:	39 c7                	cmp    %eax,%edi
+ af1:	72 0d                	jb     b00 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ af3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ af6:	89 f0                	mov    %esi,%eax
+ af8:	5b                   	pop    %ebx
+ af9:	5e                   	pop    %esi
+ afa:	5f                   	pop    %edi
+ afb:	5d                   	pop    %ebp
+ afc:	c3                   	ret
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b00:	83 ec 0c             	sub    $0xc,%esp
+ b03:	50                   	push   %eax
+ b04:	e8 77 fe ff ff       	call   980 <malloc>
+ b09:	83 c4 10             	add    $0x10,%esp
+ b0c:	89 c6                	mov    %eax,%esi
+ b0e:	85 c0                	test   %eax,%eax
+ b10:	74 e1                	je     af3 <realloc+0x23>
+  memmove(p, ap, have);
+ b12:	83 ec 04             	sub    $0x4,%esp
+ b15:	57                   	push   %edi
+ b16:	53                   	push   %ebx
+ b17:	50                   	push   %eax
+ b18:	e8 03 f8 ff ff       	call   320 <memmove>
+  free(ap);
+ b1d:	89 1c 24             	mov    %ebx,(%esp)
+ b20:	e8 db fd ff ff       	call   900 <free>
+  return p;
+ b25:	83 c4 10             	add    $0x10,%esp
+}
+ b28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b2b:	89 f0                	mov    %esi,%eax
+ b2d:	5b                   	pop    %ebx
+ b2e:	5e                   	pop    %esi
+ b2f:	5f                   	pop    %edi
+ b30:	5d                   	pop    %ebp
+ b31:	c3                   	ret
+ b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b38:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b3e:	5b                   	pop    %ebx
+ b3f:	5e                   	pop    %esi
+ b40:	5f                   	pop    %edi
+ b41:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b42:	e9 39 fe ff ff       	jmp    980 <malloc>
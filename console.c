@@ -14,6 +14,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "x86.h"
+#include "poll.h"
 
 static void consputc(int);
 
@@ -184,6 +185,7 @@ struct {
   uint r;  // Read index
   uint w;  // Write index
   uint e;  // Edit index
+  struct waitq pollq;  // poll() calls waiting for a line
 } input;
 
 #define C(x)  ((x)-'@')  // Control-x
@@ -221,6 +223,7 @@ consoleintr(int (*getc)(void))
         if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
           input.w = input.e;
           wakeup(&input.r);
+          pollwakeup(&input.pollq);
         }
       }
       break;
@@ -270,6 +273,23 @@ consoleread(struct inode *ip, char *dst, int n)
   return target - n;
 }
 
+// Console input is ready once a whole line has been typed;
+// output is always ready.
+int
+consolepoll(struct inode *ip, struct pollent *e)
+{
+  int r;
+
+  acquire(&cons.lock);
+  if(e)
+    pollqueue(&input.pollq, &cons.lock, e);
+  r = POLLOUT;
+  if(input.r != input.w)
+    r |= POLLIN;
+  release(&cons.lock);
+  return r;
+}
+
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
@@ -292,6 +312,7 @@ consoleinit(void)
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
   cons.locking = 1;
 
   ioapicenable(IRQ_KBD, 0);
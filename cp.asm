@@ -0,0 +1,1756 @@
+
+_cp:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// Bytes to ask splice() for per call.
+#define CHUNK 8192
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  int fd0, fd1, n;
+
+  if(argc != 3){
+  14:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  17:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc != 3){
+  1a:	74 13                	je     2f <main+0x2f>
+    printf(2, "usage: cp src dst\n");
+  1c:	56                   	push   %esi
+  1d:	56                   	push   %esi
+  1e:	68 20 0b 00 00       	push   $0xb20
+  23:	6a 02                	push   $0x2
+  25:	e8 96 05 00 00       	call   5c0 <printf>
+    exit();
+  2a:	e8 f4 02 00 00       	call   323 <exit>
+  }
+  if((fd0 = open(argv[1], O_RDONLY)) < 0){
+  2f:	53                   	push   %ebx
+  30:	53                   	push   %ebx
+  31:	6a 00                	push   $0x0
+  33:	ff 76 04             	push   0x4(%esi)
+  36:	e8 28 03 00 00       	call   363 <open>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	89 c3                	mov    %eax,%ebx
+  40:	85 c0                	test   %eax,%eax
+  42:	78 67                	js     ab <main+0xab>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if((fd1 = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+  44:	52                   	push   %edx
+  45:	52                   	push   %edx
+  46:	68 01 02 00 00       	push   $0x201
+  4b:	ff 76 08             	push   0x8(%esi)
+  4e:	e8 10 03 00 00       	call   363 <open>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	89 c7                	mov    %eax,%edi
+  58:	85 c0                	test   %eax,%eax
+  5a:	78 32                	js     8e <main+0x8e>
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    exit();
+  }
+
+  // The copy happens entirely in the kernel, block by block
+  // from the buffer cache.
+  while((n = splice(fd0, fd1, CHUNK)) > 0)
+  60:	83 ec 04             	sub    $0x4,%esp
+  63:	68 00 20 00 00       	push   $0x2000
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+  6a:	e8 bc 03 00 00       	call   42b <splice>
+  6f:	83 c4 10             	add    $0x10,%esp
+  72:	85 c0                	test   %eax,%eax
+  74:	7f ea                	jg     60 <main+0x60>
+    ;
+  if(n < 0)
+  76:	75 48                	jne    c0 <main+0xc0>
+    printf(2, "cp: copy %s to %s failed\n", argv[1], argv[2]);
+
+  close(fd0);
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	53                   	push   %ebx
+  7c:	e8 ca 02 00 00       	call   34b <close>
+  close(fd1);
+  81:	89 3c 24             	mov    %edi,(%esp)
+  84:	e8 c2 02 00 00       	call   34b <close>
+  exit();
+  89:	e8 95 02 00 00       	call   323 <exit>
+    printf(2, "cp: cannot create %s\n", argv[2]);
+  8e:	50                   	push   %eax
+  8f:	ff 76 08             	push   0x8(%esi)
+  92:	68 47 0b 00 00       	push   $0xb47
+  97:	6a 02                	push   $0x2
+  99:	e8 22 05 00 00       	call   5c0 <printf>
+    close(fd0);
+  9e:	89 1c 24             	mov    %ebx,(%esp)
+  a1:	e8 a5 02 00 00       	call   34b <close>
+    exit();
+  a6:	e8 78 02 00 00       	call   323 <exit>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+  ab:	51                   	push   %ecx
+  ac:	ff 76 04             	push   0x4(%esi)
+  af:	68 33 0b 00 00       	push   $0xb33
+  b4:	6a 02                	push   $0x2
+  b6:	e8 05 05 00 00       	call   5c0 <printf>
+    exit();
+  bb:	e8 63 02 00 00       	call   323 <exit>
+    printf(2, "cp: copy %s to %s failed\n", argv[1], argv[2]);
+  c0:	ff 76 08             	push   0x8(%esi)
+  c3:	ff 76 04             	push   0x4(%esi)
+  c6:	68 5d 0b 00 00       	push   $0xb5d
+  cb:	6a 02                	push   $0x2
+  cd:	e8 ee 04 00 00       	call   5c0 <printf>
+  d2:	83 c4 10             	add    $0x10,%esp
+  d5:	eb a1                	jmp    78 <main+0x78>
+  d7:	66 90                	xchg   %ax,%ax
+  d9:	66 90                	xchg   %ax,%ax
+  db:	66 90                	xchg   %ax,%ax
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	75 12                	jne    1e3 <strchr+0x23>
+ 1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	84 d2                	test   %dl,%dl
+ 1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+ 1e3:	38 d1                	cmp    %dl,%cl
+ 1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1f0:	31 c0                	xor    %eax,%eax
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 209:	31 db                	xor    %ebx,%ebx
+{
+ 20b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 20e:	eb 27                	jmp    237 <gets+0x37>
+    cc = read(0, &c, 1);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	56                   	push   %esi
+ 216:	6a 00                	push   $0x0
+ 218:	e8 1e 01 00 00       	call   33b <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 1d                	jle    241 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22f:	3c 0a                	cmp    $0xa,%al
+ 231:	74 10                	je     243 <gets+0x43>
+ 233:	3c 0d                	cmp    $0xd,%al
+ 235:	74 0c                	je     243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 237:	89 df                	mov    %ebx,%edi
+ 239:	83 c3 01             	add    $0x1,%ebx
+ 23c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23f:	7c cf                	jl     210 <gets+0x10>
+ 241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 24a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24d:	5b                   	pop    %ebx
+ 24e:	5e                   	pop    %esi
+ 24f:	5f                   	pop    %edi
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+ 252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 f1 00 00 00       	call   363 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	ff 75 0c             	push   0xc(%ebp)
+ 27f:	89 c3                	mov    %eax,%ebx
+ 281:	50                   	push   %eax
+ 282:	e8 f4 00 00 00       	call   37b <fstat>
+  close(fd);
+ 287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 28c:	e8 ba 00 00 00       	call   34b <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	89 f0                	mov    %esi,%eax
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ed                	jmp    294 <stat+0x34>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c5:	77 1e                	ja     2e5 <atoi+0x35>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2d0:	83 c2 01             	add    $0x1,%edx
+ 2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2da:	0f be 02             	movsbl (%edx),%eax
+ 2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	89 c8                	mov    %ecx,%eax
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 31b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <exit>:
+SYSCALL(exit)
+ 323:	b8 02 00 00 00       	mov    $0x2,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <wait>:
+SYSCALL(wait)
+ 32b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <pipe>:
+SYSCALL(pipe)
+ 333:	b8 04 00 00 00       	mov    $0x4,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <read>:
+SYSCALL(read)
+ 33b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <write>:
+SYSCALL(write)
+ 343:	b8 10 00 00 00       	mov    $0x10,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <close>:
+SYSCALL(close)
+ 34b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <kill>:
+SYSCALL(kill)
+ 353:	b8 06 00 00 00       	mov    $0x6,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <exec>:
+SYSCALL(exec)
+ 35b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <open>:
+SYSCALL(open)
+ 363:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mknod>:
+SYSCALL(mknod)
+ 36b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <unlink>:
+SYSCALL(unlink)
+ 373:	b8 12 00 00 00       	mov    $0x12,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <fstat>:
+SYSCALL(fstat)
+ 37b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <link>:
+SYSCALL(link)
+ 383:	b8 13 00 00 00       	mov    $0x13,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mkdir>:
+SYSCALL(mkdir)
+ 38b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <chdir>:
+SYSCALL(chdir)
+ 393:	b8 09 00 00 00       	mov    $0x9,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <dup>:
+SYSCALL(dup)
+ 39b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getpid>:
+SYSCALL(getpid)
+ 3a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sbrk>:
+SYSCALL(sbrk)
+ 3ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <sleep>:
+SYSCALL(sleep)
+ 3b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <uptime>:
+SYSCALL(uptime)
+ 3bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 3c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 3cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 3d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mlfqstart>:
+SYSCALL(mlfqstart)
+ 3db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 3e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 3eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 3f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <setpriority>:
+SYSCALL(setpriority)
+ 3fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 403:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getcpustats>:
+SYSCALL(getcpustats)
+ 40b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <setscheduler>:
+SYSCALL(setscheduler)
+ 413:	b8 20 00 00 00       	mov    $0x20,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 41b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getscheduler>:
+SYSCALL(getscheduler)
+ 423:	b8 22 00 00 00       	mov    $0x22,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <splice>:
+SYSCALL(splice)
+ 42b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <readv>:
+SYSCALL(readv)
+ 433:	b8 24 00 00 00       	mov    $0x24,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <writev>:
+SYSCALL(writev)
+ 43b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pread>:
+SYSCALL(pread)
+ 443:	b8 26 00 00 00       	mov    $0x26,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <pwrite>:
+SYSCALL(pwrite)
+ 44b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getlogstat>:
+SYSCALL(getlogstat)
+ 453:	b8 28 00 00 00       	mov    $0x28,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mount>:
+SYSCALL(mount)
+ 45b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <umount>:
+SYSCALL(umount)
+ 463:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mmap>:
+SYSCALL(mmap)
+ 46b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <munmap>:
+SYSCALL(munmap)
+ 473:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <membench>:
+SYSCALL(membench)
+ 47b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getlockstat>:
+SYSCALL(getlockstat)
+ 483:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <lockbench>:
+SYSCALL(lockbench)
+ 48b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <prof>:
+SYSCALL(prof)
+ 493:	b8 30 00 00 00       	mov    $0x30,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <tracectl>:
+SYSCALL(tracectl)
+ 49b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <traceread>:
+SYSCALL(traceread)
+ 4a3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <getsysstat>:
+SYSCALL(getsysstat)
+ 4ab:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 4b3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getschedwait>:
+SYSCALL(getschedwait)
+ 4bb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <mlfqread>:
+SYSCALL(mlfqread)
+ 4c3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <dllock>:
+SYSCALL(dllock)
+ 4cb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 4d3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <deadlocklog>:
+SYSCALL(deadlocklog)
+ 4db:	b8 39 00 00 00       	mov    $0x39,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <clone>:
+SYSCALL(clone)
+ 4e3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <join>:
+SYSCALL(join)
+ 4eb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <futex>:
+SYSCALL(futex)
+ 4f3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <shmat>:
+SYSCALL(shmat)
+ 4fb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <shmdt>:
+SYSCALL(shmdt)
+ 503:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <poll>:
+SYSCALL(poll)
+ 50b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+ 513:	66 90                	xchg   %ax,%ax
+ 515:	66 90                	xchg   %ax,%ax
+ 517:	66 90                	xchg   %ax,%ax
+ 519:	66 90                	xchg   %ax,%ax
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 528:	89 d1                	mov    %edx,%ecx
+{
+ 52a:	83 ec 3c             	sub    $0x3c,%esp
+ 52d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 530:	85 d2                	test   %edx,%edx
+ 532:	0f 89 80 00 00 00    	jns    5b8 <printint+0x98>
+ 538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 53c:	74 7a                	je     5b8 <printint+0x98>
+    x = -xx;
+ 53e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 548:	31 f6                	xor    %esi,%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	31 d2                	xor    %edx,%edx
+ 554:	89 f7                	mov    %esi,%edi
+ 556:	f7 f3                	div    %ebx
+ 558:	8d 76 01             	lea    0x1(%esi),%esi
+ 55b:	0f b6 92 d8 0b 00 00 	movzbl 0xbd8(%edx),%edx
+ 562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 566:	89 ca                	mov    %ecx,%edx
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	39 da                	cmp    %ebx,%edx
+ 56c:	73 e2                	jae    550 <printint+0x30>
+  if(neg)
+ 56e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 571:	85 c0                	test   %eax,%eax
+ 573:	74 07                	je     57c <printint+0x5c>
+    buf[i++] = '-';
+ 575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 57a:	89 f7                	mov    %esi,%edi
+ 57c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 582:	01 df                	add    %ebx,%edi
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 594:	6a 01                	push   $0x1
+ 596:	50                   	push   %eax
+ 597:	56                   	push   %esi
+ 598:	e8 a6 fd ff ff       	call   343 <write>
+  while(--i >= 0)
+ 59d:	89 f8                	mov    %edi,%eax
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 ef 01             	sub    $0x1,%edi
+ 5a5:	39 d8                	cmp    %ebx,%eax
+ 5a7:	75 df                	jne    588 <printint+0x68>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+ 5ba:	eb 89                	jmp    545 <printint+0x25>
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	83 c6 01             	add    $0x1,%esi
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	74 67                	je     640 <printf+0x80>
+ 5d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5e1:	eb 34                	jmp    617 <printf+0x57>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5f0:	83 f8 25             	cmp    $0x25,%eax
+ 5f3:	74 18                	je     60d <printf+0x4d>
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fe:	6a 01                	push   $0x1
+ 600:	50                   	push   %eax
+ 601:	57                   	push   %edi
+ 602:	e8 3c fd ff ff       	call   343 <write>
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 60a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 60d:	0f b6 1e             	movzbl (%esi),%ebx
+ 610:	83 c6 01             	add    $0x1,%esi
+ 613:	84 db                	test   %bl,%bl
+ 615:	74 29                	je     640 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 61a:	85 d2                	test   %edx,%edx
+ 61c:	74 ca                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 61e:	83 fa 25             	cmp    $0x25,%edx
+ 621:	75 ea                	jne    60d <printf+0x4d>
+      if(c == 'd'){
+ 623:	83 f8 25             	cmp    $0x25,%eax
+ 626:	0f 84 24 01 00 00    	je     750 <printf+0x190>
+ 62c:	83 e8 63             	sub    $0x63,%eax
+ 62f:	83 f8 15             	cmp    $0x15,%eax
+ 632:	77 1c                	ja     650 <printf+0x90>
+ 634:	ff 24 85 80 0b 00 00 	jmp    *0xb80(,%eax,4)
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65a:	6a 01                	push   $0x1
+ 65c:	52                   	push   %edx
+ 65d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 660:	57                   	push   %edi
+ 661:	e8 dd fc ff ff       	call   343 <write>
+ 666:	83 c4 0c             	add    $0xc,%esp
+ 669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66c:	6a 01                	push   $0x1
+ 66e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 671:	52                   	push   %edx
+ 672:	57                   	push   %edi
+ 673:	e8 cb fc ff ff       	call   343 <write>
+        putc(fd, c);
+ 678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67b:	31 d2                	xor    %edx,%edx
+ 67d:	eb 8e                	jmp    60d <printf+0x4d>
+ 67f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 00                	push   $0x0
+ 68f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 694:	e8 87 fe ff ff       	call   520 <printint>
+        ap++;
+ 699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 67 ff ff ff       	jmp    60d <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6b5:	83 c0 04             	add    $0x4,%eax
+ 6b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6bb:	85 db                	test   %ebx,%ebx
+ 6bd:	0f 84 9d 00 00 00    	je     760 <printf+0x1a0>
+        while(*s != 0){
+ 6c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	0f 84 3d ff ff ff    	je     60d <printf+0x4d>
+ 6d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6d6:	89 de                	mov    %ebx,%esi
+ 6d8:	89 d3                	mov    %edx,%ebx
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	53                   	push   %ebx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 51 fc ff ff       	call   343 <write>
+        while(*s != 0){
+ 6f2:	0f b6 06             	movzbl (%esi),%eax
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	75 e4                	jne    6e0 <printf+0x120>
+      state = 0;
+ 6fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 07 ff ff ff       	jmp    60d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 01                	push   $0x1
+ 71f:	e9 6b ff ff ff       	jmp    68f <printf+0xcf>
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	52                   	push   %edx
+ 73c:	57                   	push   %edi
+ 73d:	e8 01 fc ff ff       	call   343 <write>
+        ap++;
+ 742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 748:	31 d2                	xor    %edx,%edx
+ 74a:	e9 be fe ff ff       	jmp    60d <printf+0x4d>
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 759:	6a 01                	push   $0x1
+ 75b:	e9 11 ff ff ff       	jmp    671 <printf+0xb1>
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 765:	bb 77 0b 00 00       	mov    $0xb77,%ebx
+ 76a:	e9 61 ff ff ff       	jmp    6d0 <printf+0x110>
+ 76f:	90                   	nop
+
+00000770 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 773:	a1 14 10 00 00       	mov    0x1014,%eax
+{
+ 778:	89 e5                	mov    %esp,%ebp
+ 77a:	56                   	push   %esi
+ 77b:	53                   	push   %ebx
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 780:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 782:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 784:	39 ca                	cmp    %ecx,%edx
+ 786:	73 30                	jae    7b8 <bigfree+0x48>
+ 788:	39 c1                	cmp    %eax,%ecx
+ 78a:	72 04                	jb     790 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78c:	39 c2                	cmp    %eax,%edx
+ 78e:	72 f0                	jb     780 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 790:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 793:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 796:	39 f0                	cmp    %esi,%eax
+ 798:	74 26                	je     7c0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 79a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 79c:	8b 42 04             	mov    0x4(%edx),%eax
+ 79f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7a2:	39 d9                	cmp    %ebx,%ecx
+ 7a4:	74 30                	je     7d6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7a6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7a8:	5b                   	pop    %ebx
+  freep = p;
+ 7a9:	89 15 14 10 00 00    	mov    %edx,0x1014
+}
+ 7af:	5e                   	pop    %esi
+ 7b0:	5d                   	pop    %ebp
+ 7b1:	c3                   	ret
+ 7b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b8:	39 c1                	cmp    %eax,%ecx
+ 7ba:	72 d0                	jb     78c <bigfree+0x1c>
+ 7bc:	eb c2                	jmp    780 <bigfree+0x10>
+ 7be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7c0:	03 58 04             	add    0x4(%eax),%ebx
+ 7c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7c6:	8b 02                	mov    (%edx),%eax
+ 7c8:	8b 00                	mov    (%eax),%eax
+ 7ca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7d2:	39 d9                	cmp    %ebx,%ecx
+ 7d4:	75 d0                	jne    7a6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 7d6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 7d9:	89 15 14 10 00 00    	mov    %edx,0x1014
+    p->s.size += bp->s.size;
+ 7df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7e2:	8b 09                	mov    (%ecx),%ecx
+ 7e4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7e6:	5b                   	pop    %ebx
+ 7e7:	5e                   	pop    %esi
+ 7e8:	5d                   	pop    %ebp
+ 7e9:	c3                   	ret
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007f0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	89 c7                	mov    %eax,%edi
+ 7f6:	56                   	push   %esi
+ 7f7:	53                   	push   %ebx
+ 7f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 7fb:	a1 14 10 00 00       	mov    0x1014,%eax
+ 800:	85 c0                	test   %eax,%eax
+ 802:	0f 84 88 00 00 00    	je     890 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 808:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 80a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 80d:	39 f9                	cmp    %edi,%ecx
+ 80f:	73 5f                	jae    870 <bigalloc+0x80>
+  if(nu < 4096)
+ 811:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 816:	39 df                	cmp    %ebx,%edi
+ 818:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 81b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 822:	eb 0d                	jmp    831 <bigalloc+0x41>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 828:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 82a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 82d:	39 f9                	cmp    %edi,%ecx
+ 82f:	73 3f                	jae    870 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 831:	89 d0                	mov    %edx,%eax
+ 833:	39 15 14 10 00 00    	cmp    %edx,0x1014
+ 839:	75 ed                	jne    828 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 83b:	83 ec 0c             	sub    $0xc,%esp
+ 83e:	56                   	push   %esi
+ 83f:	e8 67 fb ff ff       	call   3ab <sbrk>
+  if(p == (char*)-1)
+ 844:	83 c4 10             	add    $0x10,%esp
+ 847:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 84a:	74 11                	je     85d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 84c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 84f:	e8 1c ff ff ff       	call   770 <bigfree>
+  return freep;
+ 854:	a1 14 10 00 00       	mov    0x1014,%eax
+      if((p = morecore(nunits)) == 0)
+ 859:	85 c0                	test   %eax,%eax
+ 85b:	75 cb                	jne    828 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 85d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 860:	31 d2                	xor    %edx,%edx
+}
+ 862:	5b                   	pop    %ebx
+ 863:	89 d0                	mov    %edx,%eax
+ 865:	5e                   	pop    %esi
+ 866:	5f                   	pop    %edi
+ 867:	5d                   	pop    %ebp
+ 868:	c3                   	ret
+ 869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 870:	39 cf                	cmp    %ecx,%edi
+ 872:	74 4c                	je     8c0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 874:	29 f9                	sub    %edi,%ecx
+ 876:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 879:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 87c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 87f:	a3 14 10 00 00       	mov    %eax,0x1014
+}
+ 884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 887:	89 d0                	mov    %edx,%eax
+ 889:	5b                   	pop    %ebx
+ 88a:	5e                   	pop    %esi
+ 88b:	5f                   	pop    %edi
+ 88c:	5d                   	pop    %ebp
+ 88d:	c3                   	ret
+ 88e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 890:	c7 05 14 10 00 00 18 	movl   $0x1018,0x1014
+ 897:	10 00 00 
+    base.s.size = 0;
+ 89a:	ba 18 10 00 00       	mov    $0x1018,%edx
+    base.s.ptr = freep = prevp = &base;
+ 89f:	c7 05 18 10 00 00 18 	movl   $0x1018,0x1018
+ 8a6:	10 00 00 
+    base.s.size = 0;
+ 8a9:	c7 05 1c 10 00 00 00 	movl   $0x0,0x101c
+ 8b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8b3:	e9 59 ff ff ff       	jmp    811 <bigalloc+0x21>
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8c0:	8b 0a                	mov    (%edx),%ecx
+ 8c2:	89 08                	mov    %ecx,(%eax)
+ 8c4:	eb b9                	jmp    87f <bigalloc+0x8f>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <free>:
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	53                   	push   %ebx
+ 8d4:	83 ec 04             	sub    $0x4,%esp
+ 8d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 8da:	85 c9                	test   %ecx,%ecx
+ 8dc:	74 58                	je     936 <free+0x66>
+  bp = (Header*)ap - 1;
+ 8de:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8e1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 8f0:	89 d0                	mov    %edx,%eax
+ 8f2:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+  while(xchg(&locked, 1) != 0)
+ 8f9:	85 c0                	test   %eax,%eax
+ 8fb:	75 f3                	jne    8f0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 8fd:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 900:	83 fa 40             	cmp    $0x40,%edx
+ 903:	77 3b                	ja     940 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 905:	83 fa 02             	cmp    $0x2,%edx
+ 908:	76 3f                	jbe    949 <free+0x79>
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 910:	83 c0 01             	add    $0x1,%eax
+ 913:	39 14 85 00 0c 00 00 	cmp    %edx,0xc00(,%eax,4)
+ 91a:	72 f4                	jb     910 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 91c:	8b 14 85 e0 0f 00 00 	mov    0xfe0(,%eax,4),%edx
+    classfree[c] = bp;
+ 923:	89 1c 85 e0 0f 00 00 	mov    %ebx,0xfe0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 92a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 92d:	31 c0                	xor    %eax,%eax
+ 92f:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+}
+ 936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 939:	c9                   	leave
+ 93a:	c3                   	ret
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+    bigfree(bp);
+ 940:	89 d8                	mov    %ebx,%eax
+ 942:	e8 29 fe ff ff       	call   770 <bigfree>
+ 947:	eb e4                	jmp    92d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 949:	31 c0                	xor    %eax,%eax
+ 94b:	eb cf                	jmp    91c <free+0x4c>
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 956:	89 e5                	mov    %esp,%ebp
+ 958:	57                   	push   %edi
+ 959:	56                   	push   %esi
+ 95a:	53                   	push   %ebx
+ 95b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 95e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 961:	8d 50 07             	lea    0x7(%eax),%edx
+ 964:	c1 ea 03             	shr    $0x3,%edx
+ 967:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 970:	89 c8                	mov    %ecx,%eax
+ 972:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+ 979:	85 c0                	test   %eax,%eax
+ 97b:	75 f3                	jne    970 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 97d:	89 c3                	mov    %eax,%ebx
+ 97f:	83 fa 40             	cmp    $0x40,%edx
+ 982:	77 4c                	ja     9d0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 984:	be 02 00 00 00       	mov    $0x2,%esi
+ 989:	83 fa 02             	cmp    $0x2,%edx
+ 98c:	76 10                	jbe    99e <malloc+0x4e>
+ 98e:	66 90                	xchg   %ax,%ax
+ 990:	83 c3 01             	add    $0x1,%ebx
+ 993:	8b 34 9d 00 0c 00 00 	mov    0xc00(,%ebx,4),%esi
+ 99a:	39 d6                	cmp    %edx,%esi
+ 99c:	72 f2                	jb     990 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 99e:	8b 14 9d e0 0f 00 00 	mov    0xfe0(,%ebx,4),%edx
+ 9a5:	85 d2                	test   %edx,%edx
+ 9a7:	74 47                	je     9f0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 9a9:	8b 3a                	mov    (%edx),%edi
+ 9ab:	89 3c 9d e0 0f 00 00 	mov    %edi,0xfe0(,%ebx,4)
+ 9b2:	31 c0                	xor    %eax,%eax
+ 9b4:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 9bb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 9be:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 9c1:	5b                   	pop    %ebx
+ 9c2:	5e                   	pop    %esi
+ 9c3:	5f                   	pop    %edi
+ 9c4:	5d                   	pop    %ebp
+ 9c5:	c3                   	ret
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ 9d0:	89 d0                	mov    %edx,%eax
+ 9d2:	e8 19 fe ff ff       	call   7f0 <bigalloc>
+ 9d7:	89 c2                	mov    %eax,%edx
+ 9d9:	89 d8                	mov    %ebx,%eax
+ 9db:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+  return p ? (void*)(p + 1) : 0;
+ 9e2:	85 d2                	test   %edx,%edx
+ 9e4:	75 d5                	jne    9bb <malloc+0x6b>
+ 9e6:	31 c0                	xor    %eax,%eax
+}
+ 9e8:	83 c4 1c             	add    $0x1c,%esp
+ 9eb:	5b                   	pop    %ebx
+ 9ec:	5e                   	pop    %esi
+ 9ed:	5f                   	pop    %edi
+ 9ee:	5d                   	pop    %ebp
+ 9ef:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ 9f0:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9f5:	e8 f6 fd ff ff       	call   7f0 <bigalloc>
+ 9fa:	85 c0                	test   %eax,%eax
+ 9fc:	74 44                	je     a42 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 9fe:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ a05:	8b 14 9d e0 0f 00 00 	mov    0xfe0(,%ebx,4),%edx
+ a0c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ a0f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ a12:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ a18:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ a1b:	39 cf                	cmp    %ecx,%edi
+ a1d:	72 8a                	jb     9a9 <malloc+0x59>
+ a1f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ a22:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ a25:	8d 76 00             	lea    0x0(%esi),%esi
+ a28:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ a2a:	89 70 04             	mov    %esi,0x4(%eax)
+ a2d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a2f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ a31:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a33:	01 d8                	add    %ebx,%eax
+ a35:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ a38:	73 ee                	jae    a28 <malloc+0xd8>
+ a3a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ a3d:	e9 69 ff ff ff       	jmp    9ab <malloc+0x5b>
+ a42:	f0 87 05 c0 0f 00 00 	lock xchg %eax,0xfc0
+  return p ? (void*)(p + 1) : 0;
+ a49:	31 c0                	xor    %eax,%eax
+ a4b:	eb 9b                	jmp    9e8 <malloc+0x98>
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	56                   	push   %esi
+ a54:	53                   	push   %ebx
+ a55:	8b 45 08             	mov    0x8(%ebp),%eax
+ a58:	f7 65 0c             	mull   0xc(%ebp)
+ a5b:	70 33                	jo     a90 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ a5d:	83 ec 0c             	sub    $0xc,%esp
+ a60:	89 c3                	mov    %eax,%ebx
+ a62:	50                   	push   %eax
+ a63:	e8 e8 fe ff ff       	call   950 <malloc>
+ a68:	83 c4 10             	add    $0x10,%esp
+ a6b:	89 c6                	mov    %eax,%esi
+ a6d:	85 c0                	test   %eax,%eax
+ a6f:	74 1f                	je     a90 <calloc+0x40>
+    memset(p, 0, n);
+ a71:	83 ec 04             	sub    $0x4,%esp
+ a74:	53                   	push   %ebx
+ a75:	6a 00                	push   $0x0
+ a77:	50                   	push   %eax
+ a78:	e8 23 f7 ff ff       	call   1a0 <memset>
+ a7d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a83:	89 f0                	mov    %esi,%eax
+ a85:	5b                   	pop    %ebx
+ a86:	5e                   	pop    %esi
+ a87:	5d                   	pop    %ebp
+ a88:	c3                   	ret
+ a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a93:	31 f6                	xor    %esi,%esi
+}
+ a95:	89 f0                	mov    %esi,%eax
+ a97:	5b                   	pop    %ebx
+ a98:	5e                   	pop    %esi
+ a99:	5d                   	pop    %ebp
+ a9a:	c3                   	ret
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+
+00000aa0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 0c             	sub    $0xc,%esp
+ aa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ aac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ aaf:	85 db                	test   %ebx,%ebx
+ ab1:	74 55                	je     b08 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ab3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ab6:	89 de                	mov    %ebx,%esi
+ ab8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ abf:	39 c7                	cmp    %eax,%edi
+ ac1:	72 0d                	jb     ad0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ac3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ac6:	89 f0                	mov    %esi,%eax
+ ac8:	5b                   	pop    %ebx
+ ac9:	5e                   	pop    %esi
+ aca:	5f                   	pop    %edi
+ acb:	5d                   	pop    %ebp
+ acc:	c3                   	ret
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ad0:	83 ec 0c             	sub    $0xc,%esp
+ ad3:	50                   	push   %eax
+ ad4:	e8 77 fe ff ff       	call   950 <malloc>
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	89 c6                	mov    %eax,%esi
+ ade:	85 c0                	test   %eax,%eax
+ ae0:	74 e1                	je     ac3 <realloc+0x23>
+  memmove(p, ap, have);
+ ae2:	83 ec 04             	sub    $0x4,%esp
+ ae5:	57                   	push   %edi
+ ae6:	53                   	push   %ebx
+ ae7:	50                   	push   %eax
+ ae8:	e8 03 f8 ff ff       	call   2f0 <memmove>
+  free(ap);
+ aed:	89 1c 24             	mov    %ebx,(%esp)
+ af0:	e8 db fd ff ff       	call   8d0 <free>
+  return p;
+ af5:	83 c4 10             	add    $0x10,%esp
+}
+ af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afb:	89 f0                	mov    %esi,%eax
+ afd:	5b                   	pop    %ebx
+ afe:	5e                   	pop    %esi
+ aff:	5f                   	pop    %edi
+ b00:	5d                   	pop    %ebp
+ b01:	c3                   	ret
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b08:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b0e:	5b                   	pop    %ebx
+ b0f:	5e                   	pop    %esi
+ b10:	5f                   	pop    %edi
+ b11:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b12:	e9 39 fe ff ff       	jmp    950 <malloc>
@@ -0,0 +1,38 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Bytes to ask splice() for per call.
+#define CHUNK 8192
+
+int
+main(int argc, char *argv[])
+{
+  int fd0, fd1, n;
+
+  if(argc != 3){
+    printf(2, "usage: cp src dst\n");
+    exit();
+  }
+  if((fd0 = open(argv[1], O_RDONLY)) < 0){
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if((fd1 = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+    printf(2, "cp: cannot create %s\n", argv[2]);
+    close(fd0);
+    exit();
+  }
+
+  // The copy happens entirely in the kernel, block by block
+  // from the buffer cache.
+  while((n = splice(fd0, fd1, CHUNK)) > 0)
+    ;
+  if(n < 0)
+    printf(2, "cp: copy %s to %s failed\n", argv[1], argv[2]);
+
+  close(fd0);
+  close(fd1);
+  exit();
+}
@@ -1,3 +1,26 @@
+// Deadlock detection over sleep-locks.
+//
+// The wait-for graph has one node per process slot. Since a
+// process waits for at most one sleep-lock, and a sleep-lock has
+// at most one holder, each node has at most one out-edge:
+// p waits for p->waitlock->holder. acquiresleep and releasesleep
+// keep p->waitlock and lk->holder up to date as they go (see
+// wfgwait, wfghold and wfgrelease), so the graph is never rebuilt;
+// a scan just copies the edges out under wfg.lock.
+//
+// deadlockscan runs an iterative Tarjan strongly connected
+// components pass over the copy and reports every cycle, which
+// are the groups of processes that can never wake up.
+//
+// The watchdog is a kernel process that scans every wd.interval
+// ticks, logs each new cycle for deadlocklog(), and, if a victim
+// policy is set with watchdogctl(), kills one process of it.
+//
+// The dllock() system call lets user programs take a few test
+// sleep-locks, so that dltest can build real deadlocks. Waits
+// for them give up if the process is killed, and a process's
+// test locks are released when it exits.
+
 #include "types.h"
 #include "defs.h"
 #include "param.h"
@@ -7,6 +30,9 @@
 #include "spinlock.h"
 #include "proc.h"
 #include "sleeplock.h"
+#include "procinfo.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 // Globals defined in proc.c
 extern struct {
@@ -14,85 +40,366 @@ extern struct {
   struct proc proc[NPROC];
 } ptable;
 
-extern int wfg[NPROC][NPROC];
-extern int visited[NPROC];
-extern int recursion_stack[NPROC];
-extern int cycle[NPROC];
-extern int cycle_len;
+struct {
+  struct spinlock lock;   // protects p->waitlock and lk->holder
+
+  // Scratch space for deadlockscan, also under lock.
+  int next[NPROC];        // slot each slot waits for, or -1
+  int index[NPROC];       // Tarjan visit order, or -1
+  int low[NPROC];         // lowest index reachable
+  int onstack[NPROC];
+  int stack[NPROC];       // Tarjan's component stack
+  int call[NPROC];        // the DFS path, instead of recursion
+  int walked[NPROC];      // has the out-edge been followed?
+  struct deadlockinfo info;
+} wfg;
+
+struct {
+  struct sleeplock lk[NDLLOCK];
+} dltest;
+
+struct {
+  struct spinlock lock;
+  int policy;               // WD_REPORT, WD_YOUNGEST, ...
+  int interval;             // ticks between scans
+  uint head;                // next log entry to write
+  uint tail;                // next log entry to read
+  struct deadlogent log[NDEADLOG];
+
+  // Only the watchdog process uses these.
+  struct deadlockinfo info; // this scan's cycles
+  struct deadlockinfo last; // the previous scan's
+  int killed[NPROC];        // whether a victim of info's cycle i was killed
+  int lastkilled[NPROC];    // the same for last
+} wd;
 
-// Build the Wait-For Graph
 void
-build_wfg(void)
+deadlockinit(void)
 {
-  struct proc *p;
-  memset(wfg, 0, sizeof(wfg));
+  int i;
 
-  // Must hold ptable lock to safely read proc states
-  // This is a simplified, racy-read version
-  // A robust version would need to lock all sleeplocks
-  acquire(&ptable.lock);
-  
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    // We only care about processes that are sleeping on a channel
-    if(p->state != SLEEPING || p->waiting_on_chan == 0)
-      continue;
+  initlock(&wfg.lock, "wfg");
+  initlock(&wd.lock, "watchdog");
+  wd.interval = WD_INTERVAL;
+  for(i = 0; i < NDLLOCK; i++)
+    initsleeplock(&dltest.lk[i], "dltest");
+}
+
+// The current process is about to sleep waiting for lk;
+// intr says whether kill() can end the wait. Caller holds lk->lk.
+void
+wfgwait(struct sleeplock *lk, int intr)
+{
+  struct proc *p = myproc();
+
+  acquire(&wfg.lock);
+  p->waitlock = lk;
+  p->waitintr = intr;
+  release(&wfg.lock);
+}
 
-    // This process 'p' is a "waiter".
-    // We assume the channel is a sleeplock.
-    struct sleeplock *lk = (struct sleeplock*)p->waiting_on_chan;
+// The current process has acquired lk, or given up waiting
+// for it if lk is 0. Caller holds lk->lk.
+void
+wfghold(struct sleeplock *lk)
+{
+  struct proc *p = myproc();
 
-    // Racy read of the holder's PID
-    // Note: lk->pid is protected by lk->lk, which we do not hold.
-    // This is a tradeoff for a non-invasive detector.
-    int holder_pid = lk->pid; 
+  acquire(&wfg.lock);
+  p->waitlock = 0;
+  p->waitintr = 0;
+  if(lk)
+    lk->holder = p;
+  release(&wfg.lock);
+}
+
+// lk has been released. Caller holds lk->lk.
+void
+wfgrelease(struct sleeplock *lk)
+{
+  acquire(&wfg.lock);
+  lk->holder = 0;
+  release(&wfg.lock);
+}
 
-    if(holder_pid > 0 && holder_pid != p->pid) {
-      // Map PIDs to array indices with proper bounds checking
-      // PIDs start at 1, array indices start at 0
-      if (p->pid > 0 && p->pid < NPROC && holder_pid > 0 && holder_pid < NPROC)
-        wfg[p->pid][holder_pid] = 1; // p->pid waits for holder_pid
+// Record the cycle through slot s in wfg.info.
+static void
+addcycle(int s)
+{
+  struct deadlockinfo *di = &wfg.info;
+  int u, n;
+
+  n = 0;
+  u = s;
+  do {
+    di->pids_in_cycle[di->npids + n++] = ptable.proc[u].pid;
+    u = wfg.next[u];
+  } while(u != s);
+  di->cycle_len[di->found++] = n;
+  di->npids += n;
+}
+
+// Find every deadlock among processes waiting for sleep-locks.
+// If di is not 0, copy the cycles to it. Returns the number of
+// cycles found.
+int
+deadlockscan(struct deadlockinfo *di)
+{
+  struct sleeplock *lk;
+  int s, u, v, n, sp, top, found;
+
+  acquire(&wfg.lock);
+
+  // Copy out the edges.
+  for(s = 0; s < NPROC; s++){
+    wfg.next[s] = -1;
+    lk = ptable.proc[s].waitlock;
+    if(lk && lk->holder)
+      wfg.next[s] = lk->holder - ptable.proc;
+    wfg.index[s] = -1;
+    wfg.onstack[s] = 0;
+    wfg.walked[s] = 0;
+  }
+  memset(&wfg.info, 0, sizeof(wfg.info));
+
+  // Tarjan's algorithm, with an explicit DFS path.
+  n = 0;
+  top = 0;
+  for(s = 0; s < NPROC; s++){
+    if(wfg.index[s] >= 0 || wfg.next[s] < 0)
+      continue;
+    sp = 0;
+    wfg.call[sp++] = s;
+    wfg.index[s] = wfg.low[s] = n++;
+    wfg.stack[top++] = s;
+    wfg.onstack[s] = 1;
+    while(sp > 0){
+      u = wfg.call[sp-1];
+      v = wfg.next[u];
+      if(v >= 0 && !wfg.walked[u]){
+        wfg.walked[u] = 1;
+        if(wfg.index[v] < 0){
+          wfg.call[sp++] = v;
+          wfg.index[v] = wfg.low[v] = n++;
+          wfg.stack[top++] = v;
+          wfg.onstack[v] = 1;
+        } else if(wfg.onstack[v])
+          wfg.low[u] = min(wfg.low[u], wfg.index[v]);
+        continue;
+      }
+
+      // Done with u.
+      sp--;
+      if(sp > 0)
+        wfg.low[wfg.call[sp-1]] = min(wfg.low[wfg.call[sp-1]], wfg.low[u]);
+      if(wfg.low[u] == wfg.index[u]){
+        // u is the root of a component; pop it. It is a
+        // deadlock if it has more than one process, or if
+        // u waits for a lock it holds itself.
+        v = wfg.stack[top-1];
+        if(v != u || wfg.next[u] == u)
+          addcycle(u);
+        do {
+          v = wfg.stack[--top];
+          wfg.onstack[v] = 0;
+        } while(v != u);
+      }
     }
   }
-  
-  release(&ptable.lock);
+
+  found = wfg.info.found;
+  if(di)
+    *di = wfg.info;
+  release(&wfg.lock);
+  return found;
 }
 
-// DFS Cycle Check
+// Returns the number of deadlocked cycles of processes.
 int
-dfs_check_cycle(int u)
+detect_deadlock(void)
 {
-  // Bounds check
-  if(u < 0 || u >= NPROC)
+  return deadlockscan(0);
+}
+
+// Take (DL_LOCK) or release (DL_UNLOCK) test lock n.
+// Returns -1 if the process was killed while waiting,
+// or it releases a lock it does not hold.
+int
+dllock(int op, int n)
+{
+  struct sleeplock *lk;
+
+  if(n < 0 || n >= NDLLOCK)
+    return -1;
+  lk = &dltest.lk[n];
+  if(op == DL_LOCK)
+    return acquiresleepintr(lk);
+  if(op == DL_UNLOCK && holdingsleep(lk)){
+    releasesleep(lk);
     return 0;
-    
-  visited[u] = 1;
-  recursion_stack[u] = 1; // Mark as "gray"
-  
-  // Prevent cycle array overflow
-  if(cycle_len < NPROC)
-    cycle[cycle_len++] = u;
-
-  for(int v = 0; v < NPROC; v++) {
-    if(wfg[u][v]) { // If there is an edge u -> v
-      if(!visited[v]) {
-        if(dfs_check_cycle(v)) // Recurse
-          return 1;
-      } else if(recursion_stack[v]) {
-        // CYCLE DETECTED!
-        return 1;
+  }
+  return -1;
+}
+
+// Release the test locks held by p, which is exiting.
+void
+dlexit(struct proc *p)
+{
+  int i;
+
+  // Only p itself can make p the holder, so this
+  // unlocked check cannot miss one of its locks.
+  for(i = 0; i < NDLLOCK; i++)
+    if(dltest.lk[i].holder == p)
+      releasesleep(&dltest.lk[i]);
+}
+
+// Was the cycle pids[0..n-1] also found by the previous scan?
+// Cycles never share a process, so one pid identifies a cycle.
+static int
+seen(int *pids, int n)
+{
+  int i, j, k;
+
+  k = 0;
+  for(i = 0; i < wd.last.found; k += wd.last.cycle_len[i++]){
+    if(wd.last.cycle_len[i] != n)
+      continue;
+    for(j = 0; j < n; j++)
+      if(wd.last.pids_in_cycle[k + j] == pids[0])
+        return i;
+  }
+  return -1;
+}
+
+// Choose the process of the cycle pids[0..n-1] to kill under
+// policy. Only user processes in an interruptible wait are
+// candidates: kill() does not end an acquiresleep() wait, and
+// kernel threads never notice it. Returns its pid, or 0 if
+// there is none or policy kills none.
+static int
+victim(int *pids, int n, int policy)
+{
+  struct proc *p, *best;
+  int i;
+
+  if(policy == WD_REPORT)
+    return 0;
+  best = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED)
+      continue;
+    for(i = 0; i < n && pids[i] != p->pid; i++)
+      ;
+    if(i == n || p->pgdir == 0 || !p->waitintr)
+      continue;
+    if(best == 0 ||
+       (policy == WD_YOUNGEST && p->start_time > best->start_time) ||
+       (policy == WD_LOWPRI && p->priority > best->priority) ||
+       (policy == WD_LEASTCPU && p->cpu_ticks < best->cpu_ticks))
+      best = p;
+  }
+  i = best ? best->pid : 0;
+  release(&ptable.lock);
+  return i;
+}
+
+// Add a deadlock to the log, overwriting the oldest
+// entry if no one has read it.
+static void
+wdlog(int *pids, int n, int killed)
+{
+  struct deadlogent *e;
+  int i;
+
+  acquire(&wd.lock);
+  e = &wd.log[wd.head++ % NDEADLOG];
+  if(wd.head - wd.tail > NDEADLOG)
+    wd.tail = wd.head - NDEADLOG;
+  e->tick = ticks;
+  e->victim = killed;
+  e->len = n;
+  for(i = 0; i < NDLCYCLE; i++)
+    e->pids[i] = i < n ? pids[i] : 0;
+  release(&wd.lock);
+}
+
+// The body of the watchdog kernel thread. Never returns.
+void
+watchdog(void *arg)
+{
+  int i, j, k, n, policy, interval, v;
+  uint t0;
+
+  for(;;){
+    acquire(&wd.lock);
+    policy = wd.policy;
+    interval = wd.interval;
+    release(&wd.lock);
+
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < interval)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    deadlockscan(&wd.info);
+    k = 0;
+    for(i = 0; i < wd.info.found; k += wd.info.cycle_len[i++]){
+      n = wd.info.cycle_len[i];
+      // Log a cycle once, and kill at most one process of it;
+      // the victim may take a while to notice. A cycle with no
+      // process the kill can reach is tried again each scan,
+      // in case one of them starts an interruptible wait.
+      j = seen(&wd.info.pids_in_cycle[k], n);
+      if(j >= 0 && wd.lastkilled[j]){
+        wd.killed[i] = 1;
+        continue;
       }
+      v = victim(&wd.info.pids_in_cycle[k], n, policy);
+      if(v)
+        kill(v);
+      if(j < 0 || v)
+        wdlog(&wd.info.pids_in_cycle[k], n,
+              v || policy == WD_REPORT ? v : -1);
+      wd.killed[i] = v != 0;
     }
+    wd.last = wd.info;
+    memmove(wd.lastkilled, wd.killed, sizeof(wd.killed));
   }
-  
-  recursion_stack[u] = 0; // Mark as "black"
-  if(cycle_len > 0)
-    cycle_len--;
-  return 0;
 }
 
-// Legacy function for compatibility
-int detect_deadlock(void){
-    // TODO: Implement DFS-based cycle detection later
-    // Placeholder return
-    return 0;
+// Set the watchdog's victim policy and the ticks between its
+// scans; a policy or interval of -1 leaves that unchanged.
+// Returns the previous policy, or -1 for bad arguments.
+int
+watchdogctl(int policy, int interval)
+{
+  int old;
+
+  if(policy < -1 || policy >= NWDPOLICY || interval == 0 || interval < -1)
+    return -1;
+  acquire(&wd.lock);
+  old = wd.policy;
+  if(policy >= 0)
+    wd.policy = policy;
+  if(interval > 0)
+    wd.interval = interval;
+  release(&wd.lock);
+  return old;
+}
+
+// Move up to n logged deadlocks, oldest first, to dst.
+// Returns the number moved.
+int
+deadlocklog(struct deadlogent *dst, int n)
+{
+  int i;
+
+  acquire(&wd.lock);
+  for(i = 0; i < n && wd.tail != wd.head; i++)
+    dst[i] = wd.log[wd.tail++ % NDEADLOG];
+  release(&wd.lock);
+  return i;
 }
@@ -0,0 +1,2075 @@
+
+_deadlockinfo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, "No deadlocks logged.\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 28 02 00 00    	sub    $0x228,%esp
+  17:	8b 11                	mov    (%ecx),%edx
+  19:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct deadlockinfo info;
+  int i, j, k, policy, interval, old;
+
+  policy = interval = -1;
+  for(i = 1; i < argc; i++) {
+  1c:	83 fa 01             	cmp    $0x1,%edx
+  1f:	0f 8e 22 01 00 00    	jle    147 <main+0x147>
+  25:	8d 42 fe             	lea    -0x2(%edx),%eax
+  policy = interval = -1;
+  28:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  2d:	83 c6 04             	add    $0x4,%esi
+  for(i = 1; i < argc; i++) {
+  30:	bf 02 00 00 00       	mov    $0x2,%edi
+  35:	83 e0 fe             	and    $0xfffffffe,%eax
+  policy = interval = -1;
+  38:	89 8d cc fd ff ff    	mov    %ecx,-0x234(%ebp)
+  3e:	83 c0 04             	add    $0x4,%eax
+  41:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+  47:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+  4d:	c7 85 c8 fd ff ff ff 	movl   $0xffffffff,-0x238(%ebp)
+  54:	ff ff ff 
+  57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5e:	66 90                	xchg   %ax,%ax
+    if(strcmp(argv[i], "-l") == 0) {
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 8c 0f 00 00       	push   $0xf8c
+  68:	ff 36                	push   (%esi)
+  6a:	e8 01 04 00 00       	call   470 <strcmp>
+  6f:	83 c4 10             	add    $0x10,%esp
+  72:	85 c0                	test   %eax,%eax
+  74:	0f 84 b7 01 00 00    	je     231 <main+0x231>
+      printlog();
+      exit();
+    } else if(strcmp(argv[i], "-w") == 0 && i+1 < argc) {
+  7a:	83 ec 08             	sub    $0x8,%esp
+  7d:	68 8f 0f 00 00       	push   $0xf8f
+  82:	ff 36                	push   (%esi)
+  84:	e8 e7 03 00 00       	call   470 <strcmp>
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	89 c3                	mov    %eax,%ebx
+  8e:	85 c0                	test   %eax,%eax
+  90:	75 4e                	jne    e0 <main+0xe0>
+  92:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  98:	39 c7                	cmp    %eax,%edi
+  9a:	7c 1c                	jl     b8 <main+0xb8>
+      for(policy = 0; policy < NWDPOLICY; policy++)
+        if(strcmp(argv[i], policies[policy]) == 0)
+          break;
+      if(policy == NWDPOLICY)
+        usage();
+    } else if(strcmp(argv[i], "-t") == 0 && i+1 < argc) {
+  9c:	83 ec 08             	sub    $0x8,%esp
+  9f:	68 92 0f 00 00       	push   $0xf92
+  a4:	ff 36                	push   (%esi)
+  a6:	e8 c5 03 00 00       	call   470 <strcmp>
+  ab:	83 c4 10             	add    $0x10,%esp
+        usage();
+  ae:	e8 0d 02 00 00       	call   2c0 <usage>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+        if(strcmp(argv[i], policies[policy]) == 0)
+  b8:	83 ec 08             	sub    $0x8,%esp
+  bb:	ff 34 9d ac 14 00 00 	push   0x14ac(,%ebx,4)
+  c2:	ff 76 04             	push   0x4(%esi)
+  c5:	e8 a6 03 00 00       	call   470 <strcmp>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	85 c0                	test   %eax,%eax
+  cf:	0f 84 51 01 00 00    	je     226 <main+0x226>
+      for(policy = 0; policy < NWDPOLICY; policy++)
+  d5:	83 c3 01             	add    $0x1,%ebx
+  d8:	83 fb 04             	cmp    $0x4,%ebx
+  db:	75 db                	jne    b8 <main+0xb8>
+  dd:	eb cf                	jmp    ae <main+0xae>
+  df:	90                   	nop
+    } else if(strcmp(argv[i], "-t") == 0 && i+1 < argc) {
+  e0:	83 ec 08             	sub    $0x8,%esp
+  e3:	68 92 0f 00 00       	push   $0xf92
+  e8:	ff 36                	push   (%esi)
+  ea:	e8 81 03 00 00       	call   470 <strcmp>
+  ef:	83 c4 10             	add    $0x10,%esp
+  f2:	85 c0                	test   %eax,%eax
+  f4:	75 b8                	jne    ae <main+0xae>
+  f6:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  fc:	39 c7                	cmp    %eax,%edi
+  fe:	7d ae                	jge    ae <main+0xae>
+      if((interval = atoi(argv[++i])) <= 0)
+ 100:	83 ec 0c             	sub    $0xc,%esp
+ 103:	ff 76 04             	push   0x4(%esi)
+ 106:	e8 05 05 00 00       	call   610 <atoi>
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	89 85 cc fd ff ff    	mov    %eax,-0x234(%ebp)
+ 114:	85 c0                	test   %eax,%eax
+ 116:	7e 96                	jle    ae <main+0xae>
+  for(i = 1; i < argc; i++) {
+ 118:	8b 85 d0 fd ff ff    	mov    -0x230(%ebp),%eax
+ 11e:	83 c7 02             	add    $0x2,%edi
+ 121:	83 c6 08             	add    $0x8,%esi
+ 124:	39 c7                	cmp    %eax,%edi
+ 126:	0f 85 34 ff ff ff    	jne    60 <main+0x60>
+        usage();
+    } else {
+      usage();
+    }
+  }
+  if(policy >= 0 || interval > 0) {
+ 12c:	83 bd c8 fd ff ff 00 	cmpl   $0x0,-0x238(%ebp)
+ 133:	8b 8d cc fd ff ff    	mov    -0x234(%ebp),%ecx
+ 139:	0f 89 fc 00 00 00    	jns    23b <main+0x23b>
+ 13f:	85 c9                	test   %ecx,%ecx
+ 141:	0f 8f f4 00 00 00    	jg     23b <main+0x23b>
+    if(policy >= 0)
+      printf(1, "watchdog policy %s (was %s)\n", policies[policy], policies[old]);
+    exit();
+  }
+
+  if(getdeadlockinfo(&info) < 0) {
+ 147:	83 ec 0c             	sub    $0xc,%esp
+ 14a:	8d b5 e0 fd ff ff    	lea    -0x220(%ebp),%esi
+ 150:	56                   	push   %esi
+ 151:	e8 25 06 00 00       	call   77b <getdeadlockinfo>
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	85 c0                	test   %eax,%eax
+ 15b:	0f 88 42 01 00 00    	js     2a3 <main+0x2a3>
+    printf(2, "deadlockinfo: syscall failed\n");
+    exit();
+  }
+
+  if(info.found) {
+ 161:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+ 167:	85 c0                	test   %eax,%eax
+ 169:	0f 84 0e 01 00 00    	je     27d <main+0x27d>
+    printf(1, "--- DEADLOCK DETECTED: %d cycle(s) ---\n", info.found);
+ 16f:	53                   	push   %ebx
+    k = 0;
+ 170:	31 ff                	xor    %edi,%edi
+    for(i = 0; i < info.found; i++) {
+ 172:	31 db                	xor    %ebx,%ebx
+    printf(1, "--- DEADLOCK DETECTED: %d cycle(s) ---\n", info.found);
+ 174:	50                   	push   %eax
+ 175:	68 14 0f 00 00       	push   $0xf14
+ 17a:	6a 01                	push   $0x1
+ 17c:	e8 9f 07 00 00       	call   920 <printf>
+    k = 0;
+ 181:	89 bd d0 fd ff ff    	mov    %edi,-0x230(%ebp)
+    for(i = 0; i < info.found; i++) {
+ 187:	83 c4 10             	add    $0x10,%esp
+ 18a:	39 9d e0 fd ff ff    	cmp    %ebx,-0x220(%ebp)
+ 190:	0f 8e e2 00 00 00    	jle    278 <main+0x278>
+      printf(1, "Process cycle: ");
+ 196:	51                   	push   %ecx
+ 197:	51                   	push   %ecx
+ 198:	68 d0 0f 00 00       	push   $0xfd0
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 7c 07 00 00       	call   920 <printf>
+      for(j = 0; j < info.cycle_len[i]; j++)
+ 1a4:	83 c4 10             	add    $0x10,%esp
+ 1a7:	83 bc 9e 08 01 00 00 	cmpl   $0x0,0x108(%esi,%ebx,4)
+ 1ae:	00 
+ 1af:	7e 3f                	jle    1f0 <main+0x1f0>
+ 1b1:	8b 85 d0 fd ff ff    	mov    -0x230(%ebp),%eax
+ 1b7:	31 ff                	xor    %edi,%edi
+ 1b9:	8d 04 86             	lea    (%esi,%eax,4),%eax
+ 1bc:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+ 1c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printf(1, "%d -> ", info.pids_in_cycle[k + j]);
+ 1c8:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 1ce:	83 ec 04             	sub    $0x4,%esp
+ 1d1:	ff 74 b8 08          	push   0x8(%eax,%edi,4)
+      for(j = 0; j < info.cycle_len[i]; j++)
+ 1d5:	83 c7 01             	add    $0x1,%edi
+        printf(1, "%d -> ", info.pids_in_cycle[k + j]);
+ 1d8:	68 e0 0f 00 00       	push   $0xfe0
+ 1dd:	6a 01                	push   $0x1
+ 1df:	e8 3c 07 00 00       	call   920 <printf>
+      for(j = 0; j < info.cycle_len[i]; j++)
+ 1e4:	83 c4 10             	add    $0x10,%esp
+ 1e7:	39 bc 9e 08 01 00 00 	cmp    %edi,0x108(%esi,%ebx,4)
+ 1ee:	7f d8                	jg     1c8 <main+0x1c8>
+      printf(1, "%d\n", info.pids_in_cycle[k]);
+ 1f0:	52                   	push   %edx
+ 1f1:	8b bd d0 fd ff ff    	mov    -0x230(%ebp),%edi
+ 1f7:	ff b4 bd e8 fd ff ff 	push   -0x218(%ebp,%edi,4)
+ 1fe:	68 e7 0f 00 00       	push   $0xfe7
+ 203:	6a 01                	push   $0x1
+ 205:	e8 16 07 00 00       	call   920 <printf>
+      k += info.cycle_len[i];
+ 20a:	8b 94 9e 08 01 00 00 	mov    0x108(%esi,%ebx,4),%edx
+ 211:	89 f8                	mov    %edi,%eax
+    for(i = 0; i < info.found; i++) {
+ 213:	83 c3 01             	add    $0x1,%ebx
+ 216:	83 c4 10             	add    $0x10,%esp
+      k += info.cycle_len[i];
+ 219:	01 d0                	add    %edx,%eax
+ 21b:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+    for(i = 0; i < info.found; i++) {
+ 221:	e9 64 ff ff ff       	jmp    18a <main+0x18a>
+ 226:	89 9d c8 fd ff ff    	mov    %ebx,-0x238(%ebp)
+ 22c:	e9 e7 fe ff ff       	jmp    118 <main+0x118>
+      printlog();
+ 231:	e8 aa 00 00 00       	call   2e0 <printlog>
+      exit();
+ 236:	e8 48 04 00 00       	call   683 <exit>
+    if((old = watchdogctl(policy, interval)) < 0) {
+ 23b:	50                   	push   %eax
+ 23c:	50                   	push   %eax
+ 23d:	51                   	push   %ecx
+ 23e:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+ 244:	e8 ea 05 00 00       	call   833 <watchdogctl>
+ 249:	83 c4 10             	add    $0x10,%esp
+ 24c:	85 c0                	test   %eax,%eax
+ 24e:	78 40                	js     290 <main+0x290>
+    if(policy >= 0)
+ 250:	8b 95 c8 fd ff ff    	mov    -0x238(%ebp),%edx
+ 256:	83 fa ff             	cmp    $0xffffffff,%edx
+ 259:	74 1d                	je     278 <main+0x278>
+      printf(1, "watchdog policy %s (was %s)\n", policies[policy], policies[old]);
+ 25b:	ff 34 85 ac 14 00 00 	push   0x14ac(,%eax,4)
+ 262:	ff 34 95 ac 14 00 00 	push   0x14ac(,%edx,4)
+ 269:	68 95 0f 00 00       	push   $0xf95
+ 26e:	6a 01                	push   $0x1
+ 270:	e8 ab 06 00 00       	call   920 <printf>
+ 275:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 278:	e8 06 04 00 00       	call   683 <exit>
+    }
+  } else {
+    printf(1, "No deadlock detected.\n");
+ 27d:	50                   	push   %eax
+ 27e:	50                   	push   %eax
+ 27f:	68 eb 0f 00 00       	push   $0xfeb
+ 284:	6a 01                	push   $0x1
+ 286:	e8 95 06 00 00       	call   920 <printf>
+ 28b:	83 c4 10             	add    $0x10,%esp
+ 28e:	eb e8                	jmp    278 <main+0x278>
+      printf(2, "deadlockinfo: watchdogctl failed\n");
+ 290:	50                   	push   %eax
+ 291:	50                   	push   %eax
+ 292:	68 f0 0e 00 00       	push   $0xef0
+ 297:	6a 02                	push   $0x2
+ 299:	e8 82 06 00 00       	call   920 <printf>
+      exit();
+ 29e:	e8 e0 03 00 00       	call   683 <exit>
+    printf(2, "deadlockinfo: syscall failed\n");
+ 2a3:	50                   	push   %eax
+ 2a4:	50                   	push   %eax
+ 2a5:	68 b2 0f 00 00       	push   $0xfb2
+ 2aa:	6a 02                	push   $0x2
+ 2ac:	e8 6f 06 00 00       	call   920 <printf>
+    exit();
+ 2b1:	e8 cd 03 00 00       	call   683 <exit>
+ 2b6:	66 90                	xchg   %ax,%ax
+ 2b8:	66 90                	xchg   %ax,%ax
+ 2ba:	66 90                	xchg   %ax,%ax
+ 2bc:	66 90                	xchg   %ax,%ax
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <usage>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: deadlockinfo [-l] [-w report|youngest|lowpri|leastcpu] [-t ticks]\n");
+ 2c6:	68 80 0e 00 00       	push   $0xe80
+ 2cb:	6a 02                	push   $0x2
+ 2cd:	e8 4e 06 00 00       	call   920 <printf>
+  exit();
+ 2d2:	e8 ac 03 00 00       	call   683 <exit>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <printlog>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 1c             	sub    $0x1c,%esp
+  total = 0;
+ 2e9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while((n = deadlocklog(log, NLOG)) > 0) {
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	6a 10                	push   $0x10
+ 2f5:	68 c0 14 00 00       	push   $0x14c0
+ 2fa:	e8 3c 05 00 00       	call   83b <deadlocklog>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+ 302:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 305:	85 c0                	test   %eax,%eax
+ 307:	0f 8e df 00 00 00    	jle    3ec <printlog+0x10c>
+ 30d:	31 db                	xor    %ebx,%ebx
+    for(i = 0; i < n; i++) {
+ 30f:	31 f6                	xor    %esi,%esi
+ 311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "tick %d: cycle of %d:", log[i].tick, log[i].len);
+ 318:	ff b3 c8 14 00 00    	push   0x14c8(%ebx)
+ 31e:	ff b3 c0 14 00 00    	push   0x14c0(%ebx)
+ 324:	68 3c 0f 00 00       	push   $0xf3c
+ 329:	6a 01                	push   $0x1
+ 32b:	e8 f0 05 00 00       	call   920 <printf>
+      for(j = 0; j < log[i].len && j < NDLCYCLE; j++)
+ 330:	8b 93 c8 14 00 00    	mov    0x14c8(%ebx),%edx
+ 336:	83 c4 10             	add    $0x10,%esp
+ 339:	85 d2                	test   %edx,%edx
+ 33b:	7e 45                	jle    382 <printlog+0xa2>
+ 33d:	31 ff                	xor    %edi,%edi
+ 33f:	90                   	nop
+        printf(1, " %d", log[i].pids[j]);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	ff b4 bb cc 14 00 00 	push   0x14cc(%ebx,%edi,4)
+      for(j = 0; j < log[i].len && j < NDLCYCLE; j++)
+ 34a:	83 c7 01             	add    $0x1,%edi
+        printf(1, " %d", log[i].pids[j]);
+ 34d:	68 5f 0f 00 00       	push   $0xf5f
+ 352:	6a 01                	push   $0x1
+ 354:	e8 c7 05 00 00       	call   920 <printf>
+      for(j = 0; j < log[i].len && j < NDLCYCLE; j++)
+ 359:	8b 93 c8 14 00 00    	mov    0x14c8(%ebx),%edx
+ 35f:	83 c4 10             	add    $0x10,%esp
+ 362:	39 fa                	cmp    %edi,%edx
+ 364:	7e 05                	jle    36b <printlog+0x8b>
+ 366:	83 ff 08             	cmp    $0x8,%edi
+ 369:	75 d5                	jne    340 <printlog+0x60>
+      if(log[i].len > NDLCYCLE)
+ 36b:	83 fa 08             	cmp    $0x8,%edx
+ 36e:	7e 12                	jle    382 <printlog+0xa2>
+        printf(1, " ...");
+ 370:	83 ec 08             	sub    $0x8,%esp
+ 373:	68 52 0f 00 00       	push   $0xf52
+ 378:	6a 01                	push   $0x1
+ 37a:	e8 a1 05 00 00       	call   920 <printf>
+ 37f:	83 c4 10             	add    $0x10,%esp
+      if(log[i].victim > 0)
+ 382:	8b 83 c4 14 00 00    	mov    0x14c4(%ebx),%eax
+ 388:	85 c0                	test   %eax,%eax
+ 38a:	7f 34                	jg     3c0 <printlog+0xe0>
+      else if(log[i].victim < 0)
+ 38c:	75 4a                	jne    3d8 <printlog+0xf8>
+      printf(1, "\n");
+ 38e:	83 ec 08             	sub    $0x8,%esp
+    for(i = 0; i < n; i++) {
+ 391:	83 c6 01             	add    $0x1,%esi
+ 394:	83 c3 2c             	add    $0x2c,%ebx
+      printf(1, "\n");
+ 397:	68 b0 0f 00 00       	push   $0xfb0
+ 39c:	6a 01                	push   $0x1
+ 39e:	e8 7d 05 00 00       	call   920 <printf>
+    for(i = 0; i < n; i++) {
+ 3a3:	83 c4 10             	add    $0x10,%esp
+ 3a6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+ 3a9:	0f 85 69 ff ff ff    	jne    318 <printlog+0x38>
+    total += n;
+ 3af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3b2:	01 4d e0             	add    %ecx,-0x20(%ebp)
+ 3b5:	e9 36 ff ff ff       	jmp    2f0 <printlog+0x10>
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printf(1, ", killed %d", log[i].victim);
+ 3c0:	83 ec 04             	sub    $0x4,%esp
+ 3c3:	50                   	push   %eax
+ 3c4:	68 57 0f 00 00       	push   $0xf57
+ 3c9:	6a 01                	push   $0x1
+ 3cb:	e8 50 05 00 00       	call   920 <printf>
+ 3d0:	83 c4 10             	add    $0x10,%esp
+ 3d3:	eb b9                	jmp    38e <printlog+0xae>
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+        printf(1, ", cannot be broken");
+ 3d8:	83 ec 08             	sub    $0x8,%esp
+ 3db:	68 63 0f 00 00       	push   $0xf63
+ 3e0:	6a 01                	push   $0x1
+ 3e2:	e8 39 05 00 00       	call   920 <printf>
+ 3e7:	83 c4 10             	add    $0x10,%esp
+ 3ea:	eb a2                	jmp    38e <printlog+0xae>
+  if(n < 0)
+ 3ec:	75 29                	jne    417 <printlog+0x137>
+  else if(total == 0)
+ 3ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 3f1:	85 c0                	test   %eax,%eax
+ 3f3:	74 08                	je     3fd <printlog+0x11d>
+}
+ 3f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3f8:	5b                   	pop    %ebx
+ 3f9:	5e                   	pop    %esi
+ 3fa:	5f                   	pop    %edi
+ 3fb:	5d                   	pop    %ebp
+ 3fc:	c3                   	ret
+    printf(1, "No deadlocks logged.\n");
+ 3fd:	83 ec 08             	sub    $0x8,%esp
+ 400:	68 76 0f 00 00       	push   $0xf76
+ 405:	6a 01                	push   $0x1
+ 407:	e8 14 05 00 00       	call   920 <printf>
+ 40c:	83 c4 10             	add    $0x10,%esp
+}
+ 40f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 412:	5b                   	pop    %ebx
+ 413:	5e                   	pop    %esi
+ 414:	5f                   	pop    %edi
+ 415:	5d                   	pop    %ebp
+ 416:	c3                   	ret
+    printf(2, "deadlockinfo: deadlocklog failed\n");
+ 417:	83 ec 08             	sub    $0x8,%esp
+ 41a:	68 cc 0e 00 00       	push   $0xecc
+ 41f:	6a 02                	push   $0x2
+ 421:	e8 fa 04 00 00       	call   920 <printf>
+ 426:	83 c4 10             	add    $0x10,%esp
+}
+ 429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5f                   	pop    %edi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+ 431:	66 90                	xchg   %ax,%ax
+ 433:	66 90                	xchg   %ax,%ax
+ 435:	66 90                	xchg   %ax,%ax
+ 437:	66 90                	xchg   %ax,%ax
+ 439:	66 90                	xchg   %ax,%ax
+ 43b:	66 90                	xchg   %ax,%ax
+ 43d:	66 90                	xchg   %ax,%ax
+ 43f:	90                   	nop
+
+00000440 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 440:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 441:	31 c0                	xor    %eax,%eax
+{
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	53                   	push   %ebx
+ 446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 449:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 450:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 454:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 457:	83 c0 01             	add    $0x1,%eax
+ 45a:	84 d2                	test   %dl,%dl
+ 45c:	75 f2                	jne    450 <strcpy+0x10>
+    ;
+  return os;
+}
+ 45e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 461:	89 c8                	mov    %ecx,%eax
+ 463:	c9                   	leave
+ 464:	c3                   	ret
+ 465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+ 477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 47a:	0f b6 02             	movzbl (%edx),%eax
+ 47d:	84 c0                	test   %al,%al
+ 47f:	75 17                	jne    498 <strcmp+0x28>
+ 481:	eb 3a                	jmp    4bd <strcmp+0x4d>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 48c:	83 c2 01             	add    $0x1,%edx
+ 48f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 492:	84 c0                	test   %al,%al
+ 494:	74 1a                	je     4b0 <strcmp+0x40>
+    p++, q++;
+ 496:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 498:	0f b6 19             	movzbl (%ecx),%ebx
+ 49b:	38 c3                	cmp    %al,%bl
+ 49d:	74 e9                	je     488 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 49f:	29 d8                	sub    %ebx,%eax
+}
+ 4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a4:	c9                   	leave
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4b4:	31 c0                	xor    %eax,%eax
+ 4b6:	29 d8                	sub    %ebx,%eax
+}
+ 4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4c0:	31 c0                	xor    %eax,%eax
+ 4c2:	eb db                	jmp    49f <strcmp+0x2f>
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4d9:	74 15                	je     4f0 <strlen+0x20>
+ 4db:	31 c0                	xor    %eax,%eax
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4e0:	83 c0 01             	add    $0x1,%eax
+ 4e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4e7:	89 c1                	mov    %eax,%ecx
+ 4e9:	75 f5                	jne    4e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4eb:	89 c8                	mov    %ecx,%eax
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+ 4ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4f0:	31 c9                	xor    %ecx,%ecx
+}
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	89 c8                	mov    %ecx,%eax
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 507:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 50a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50d:	89 d7                	mov    %edx,%edi
+ 50f:	fc                   	cld
+ 510:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 512:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 515:	89 d0                	mov    %edx,%eax
+ 517:	c9                   	leave
+ 518:	c3                   	ret
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 52a:	0f b6 10             	movzbl (%eax),%edx
+ 52d:	84 d2                	test   %dl,%dl
+ 52f:	75 12                	jne    543 <strchr+0x23>
+ 531:	eb 1d                	jmp    550 <strchr+0x30>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 53c:	83 c0 01             	add    $0x1,%eax
+ 53f:	84 d2                	test   %dl,%dl
+ 541:	74 0d                	je     550 <strchr+0x30>
+    if(*s == c)
+ 543:	38 d1                	cmp    %dl,%cl
+ 545:	75 f1                	jne    538 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 547:	5d                   	pop    %ebp
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 550:	31 c0                	xor    %eax,%eax
+}
+ 552:	5d                   	pop    %ebp
+ 553:	c3                   	ret
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 565:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 568:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 569:	31 db                	xor    %ebx,%ebx
+{
+ 56b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 56e:	eb 27                	jmp    597 <gets+0x37>
+    cc = read(0, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	6a 01                	push   $0x1
+ 575:	56                   	push   %esi
+ 576:	6a 00                	push   $0x0
+ 578:	e8 1e 01 00 00       	call   69b <read>
+    if(cc < 1)
+ 57d:	83 c4 10             	add    $0x10,%esp
+ 580:	85 c0                	test   %eax,%eax
+ 582:	7e 1d                	jle    5a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 584:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 58f:	3c 0a                	cmp    $0xa,%al
+ 591:	74 10                	je     5a3 <gets+0x43>
+ 593:	3c 0d                	cmp    $0xd,%al
+ 595:	74 0c                	je     5a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 597:	89 df                	mov    %ebx,%edi
+ 599:	83 c3 01             	add    $0x1,%ebx
+ 59c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 59f:	7c cf                	jl     570 <gets+0x10>
+ 5a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ad:	5b                   	pop    %ebx
+ 5ae:	5e                   	pop    %esi
+ 5af:	5f                   	pop    %edi
+ 5b0:	5d                   	pop    %ebp
+ 5b1:	c3                   	ret
+ 5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	56                   	push   %esi
+ 5c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	6a 00                	push   $0x0
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 f1 00 00 00       	call   6c3 <open>
+  if(fd < 0)
+ 5d2:	83 c4 10             	add    $0x10,%esp
+ 5d5:	85 c0                	test   %eax,%eax
+ 5d7:	78 27                	js     600 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5d9:	83 ec 08             	sub    $0x8,%esp
+ 5dc:	ff 75 0c             	push   0xc(%ebp)
+ 5df:	89 c3                	mov    %eax,%ebx
+ 5e1:	50                   	push   %eax
+ 5e2:	e8 f4 00 00 00       	call   6db <fstat>
+  close(fd);
+ 5e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5ec:	e8 ba 00 00 00       	call   6ab <close>
+  return r;
+ 5f1:	83 c4 10             	add    $0x10,%esp
+}
+ 5f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5f7:	89 f0                	mov    %esi,%eax
+ 5f9:	5b                   	pop    %ebx
+ 5fa:	5e                   	pop    %esi
+ 5fb:	5d                   	pop    %ebp
+ 5fc:	c3                   	ret
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 600:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 605:	eb ed                	jmp    5f4 <stat+0x34>
+ 607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	53                   	push   %ebx
+ 614:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 617:	0f be 02             	movsbl (%edx),%eax
+ 61a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 61d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 625:	77 1e                	ja     645 <atoi+0x35>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 630:	83 c2 01             	add    $0x1,%edx
+ 633:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 636:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 63a:	0f be 02             	movsbl (%edx),%eax
+ 63d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 640:	80 fb 09             	cmp    $0x9,%bl
+ 643:	76 eb                	jbe    630 <atoi+0x20>
+  return n;
+}
+ 645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 648:	89 c8                	mov    %ecx,%eax
+ 64a:	c9                   	leave
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	8b 45 10             	mov    0x10(%ebp),%eax
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 65e:	85 c0                	test   %eax,%eax
+ 660:	7e 13                	jle    675 <memmove+0x25>
+ 662:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 664:	89 d7                	mov    %edx,%edi
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 670:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 671:	39 f8                	cmp    %edi,%eax
+ 673:	75 fb                	jne    670 <memmove+0x20>
+  return vdst;
+}
+ 675:	5e                   	pop    %esi
+ 676:	89 d0                	mov    %edx,%eax
+ 678:	5f                   	pop    %edi
+ 679:	5d                   	pop    %ebp
+ 67a:	c3                   	ret
+
+0000067b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 67b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <exit>:
+SYSCALL(exit)
+ 683:	b8 02 00 00 00       	mov    $0x2,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <pipe>:
+SYSCALL(pipe)
+ 693:	b8 04 00 00 00       	mov    $0x4,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <read>:
+SYSCALL(read)
+ 69b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <write>:
+SYSCALL(write)
+ 6a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <close>:
+SYSCALL(close)
+ 6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <kill>:
+SYSCALL(kill)
+ 6b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <exec>:
+SYSCALL(exec)
+ 6bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <open>:
+SYSCALL(open)
+ 6c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <unlink>:
+SYSCALL(unlink)
+ 6d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <fstat>:
+SYSCALL(fstat)
+ 6db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <link>:
+SYSCALL(link)
+ 6e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mkdir>:
+SYSCALL(mkdir)
+ 6eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chdir>:
+SYSCALL(chdir)
+ 6f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dup>:
+SYSCALL(dup)
+ 6fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getpid>:
+SYSCALL(getpid)
+ 703:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sbrk>:
+SYSCALL(sbrk)
+ 70b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+ 713:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <uptime>:
+SYSCALL(uptime)
+ 71b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 723:	b8 16 00 00 00       	mov    $0x16,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 72b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 733:	b8 18 00 00 00       	mov    $0x18,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 73b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 743:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 74b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 753:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <setpriority>:
+SYSCALL(setpriority)
+ 75b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 763:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <getcpustats>:
+SYSCALL(getcpustats)
+ 76b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <setscheduler>:
+SYSCALL(setscheduler)
+ 773:	b8 20 00 00 00       	mov    $0x20,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 77b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <getscheduler>:
+SYSCALL(getscheduler)
+ 783:	b8 22 00 00 00       	mov    $0x22,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <splice>:
+SYSCALL(splice)
+ 78b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <readv>:
+SYSCALL(readv)
+ 793:	b8 24 00 00 00       	mov    $0x24,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <writev>:
+SYSCALL(writev)
+ 79b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <pread>:
+SYSCALL(pread)
+ 7a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <pwrite>:
+SYSCALL(pwrite)
+ 7ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getlogstat>:
+SYSCALL(getlogstat)
+ 7b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <mount>:
+SYSCALL(mount)
+ 7bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <umount>:
+SYSCALL(umount)
+ 7c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mmap>:
+SYSCALL(mmap)
+ 7cb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <munmap>:
+SYSCALL(munmap)
+ 7d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <membench>:
+SYSCALL(membench)
+ 7db:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <getlockstat>:
+SYSCALL(getlockstat)
+ 7e3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <lockbench>:
+SYSCALL(lockbench)
+ 7eb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <prof>:
+SYSCALL(prof)
+ 7f3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <tracectl>:
+SYSCALL(tracectl)
+ 7fb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <traceread>:
+SYSCALL(traceread)
+ 803:	b8 32 00 00 00       	mov    $0x32,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <getsysstat>:
+SYSCALL(getsysstat)
+ 80b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 813:	b8 34 00 00 00       	mov    $0x34,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <getschedwait>:
+SYSCALL(getschedwait)
+ 81b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <mlfqread>:
+SYSCALL(mlfqread)
+ 823:	b8 36 00 00 00       	mov    $0x36,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <dllock>:
+SYSCALL(dllock)
+ 82b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 833:	b8 38 00 00 00       	mov    $0x38,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 83b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <clone>:
+SYSCALL(clone)
+ 843:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <join>:
+SYSCALL(join)
+ 84b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <futex>:
+SYSCALL(futex)
+ 853:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <shmat>:
+SYSCALL(shmat)
+ 85b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <shmdt>:
+SYSCALL(shmdt)
+ 863:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <poll>:
+SYSCALL(poll)
+ 86b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+ 873:	66 90                	xchg   %ax,%ax
+ 875:	66 90                	xchg   %ax,%ax
+ 877:	66 90                	xchg   %ax,%ax
+ 879:	66 90                	xchg   %ax,%ax
+ 87b:	66 90                	xchg   %ax,%ax
+ 87d:	66 90                	xchg   %ax,%ax
+ 87f:	90                   	nop
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 888:	89 d1                	mov    %edx,%ecx
+{
+ 88a:	83 ec 3c             	sub    $0x3c,%esp
+ 88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 890:	85 d2                	test   %edx,%edx
+ 892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+ 898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+ 89e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8b0:	89 c8                	mov    %ecx,%eax
+ 8b2:	31 d2                	xor    %edx,%edx
+ 8b4:	89 f7                	mov    %esi,%edi
+ 8b6:	f7 f3                	div    %ebx
+ 8b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8bb:	0f b6 92 84 10 00 00 	movzbl 0x1084(%edx),%edx
+ 8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8c6:	89 ca                	mov    %ecx,%edx
+ 8c8:	89 c1                	mov    %eax,%ecx
+ 8ca:	39 da                	cmp    %ebx,%edx
+ 8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+ 8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8d1:	85 c0                	test   %eax,%eax
+ 8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+ 8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8da:	89 f7                	mov    %esi,%edi
+ 8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e2:	01 df                	add    %ebx,%edi
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8f4:	6a 01                	push   $0x1
+ 8f6:	50                   	push   %eax
+ 8f7:	56                   	push   %esi
+ 8f8:	e8 a6 fd ff ff       	call   6a3 <write>
+  while(--i >= 0)
+ 8fd:	89 f8                	mov    %edi,%eax
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	83 ef 01             	sub    $0x1,%edi
+ 905:	39 d8                	cmp    %ebx,%eax
+ 907:	75 df                	jne    8e8 <printint+0x68>
+}
+ 909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 918:	31 c0                	xor    %eax,%eax
+ 91a:	eb 89                	jmp    8a5 <printint+0x25>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 92f:	0f b6 1e             	movzbl (%esi),%ebx
+ 932:	83 c6 01             	add    $0x1,%esi
+ 935:	84 db                	test   %bl,%bl
+ 937:	74 67                	je     9a0 <printf+0x80>
+ 939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 93c:	31 d2                	xor    %edx,%edx
+ 93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 941:	eb 34                	jmp    977 <printf+0x57>
+ 943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 947:	90                   	nop
+ 948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+ 955:	83 ec 04             	sub    $0x4,%esp
+ 958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95e:	6a 01                	push   $0x1
+ 960:	50                   	push   %eax
+ 961:	57                   	push   %edi
+ 962:	e8 3c fd ff ff       	call   6a3 <write>
+ 967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 96d:	0f b6 1e             	movzbl (%esi),%ebx
+ 970:	83 c6 01             	add    $0x1,%esi
+ 973:	84 db                	test   %bl,%bl
+ 975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 97a:	85 d2                	test   %edx,%edx
+ 97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 97e:	83 fa 25             	cmp    $0x25,%edx
+ 981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+ 983:	83 f8 25             	cmp    $0x25,%eax
+ 986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+ 98c:	83 e8 63             	sub    $0x63,%eax
+ 98f:	83 f8 15             	cmp    $0x15,%eax
+ 992:	77 1c                	ja     9b0 <printf+0x90>
+ 994:	ff 24 85 2c 10 00 00 	jmp    *0x102c(,%eax,4)
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	52                   	push   %edx
+ 9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9c0:	57                   	push   %edi
+ 9c1:	e8 dd fc ff ff       	call   6a3 <write>
+ 9c6:	83 c4 0c             	add    $0xc,%esp
+ 9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9cc:	6a 01                	push   $0x1
+ 9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9d1:	52                   	push   %edx
+ 9d2:	57                   	push   %edi
+ 9d3:	e8 cb fc ff ff       	call   6a3 <write>
+        putc(fd, c);
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9db:	31 d2                	xor    %edx,%edx
+ 9dd:	eb 8e                	jmp    96d <printf+0x4d>
+ 9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 00                	push   $0x0
+ 9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+ 9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a15:	83 c0 04             	add    $0x4,%eax
+ a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a1b:	85 db                	test   %ebx,%ebx
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+ a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a28:	84 c0                	test   %al,%al
+ a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+ a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	89 d3                	mov    %edx,%ebx
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	53                   	push   %ebx
+ a4c:	57                   	push   %edi
+ a4d:	e8 51 fc ff ff       	call   6a3 <write>
+        while(*s != 0){
+ a52:	0f b6 06             	movzbl (%esi),%eax
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+ a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	52                   	push   %edx
+ a9c:	57                   	push   %edi
+ a9d:	e8 01 fc ff ff       	call   6a3 <write>
+        ap++;
+ aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab9:	6a 01                	push   $0x1
+ abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+ ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ac5:	bb 22 10 00 00       	mov    $0x1022,%ebx
+ aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+ acf:	90                   	nop
+
+00000ad0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad3:	a1 d4 17 00 00       	mov    0x17d4,%eax
+{
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	56                   	push   %esi
+ adb:	53                   	push   %ebx
+ adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ae2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae4:	39 ca                	cmp    %ecx,%edx
+ ae6:	73 30                	jae    b18 <bigfree+0x48>
+ ae8:	39 c1                	cmp    %eax,%ecx
+ aea:	72 04                	jb     af0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aec:	39 c2                	cmp    %eax,%edx
+ aee:	72 f0                	jb     ae0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ af0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ af3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ af6:	39 f0                	cmp    %esi,%eax
+ af8:	74 26                	je     b20 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ afa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ afc:	8b 42 04             	mov    0x4(%edx),%eax
+ aff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b02:	39 d9                	cmp    %ebx,%ecx
+ b04:	74 30                	je     b36 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b06:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b08:	5b                   	pop    %ebx
+  freep = p;
+ b09:	89 15 d4 17 00 00    	mov    %edx,0x17d4
+}
+ b0f:	5e                   	pop    %esi
+ b10:	5d                   	pop    %ebp
+ b11:	c3                   	ret
+ b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b18:	39 c1                	cmp    %eax,%ecx
+ b1a:	72 d0                	jb     aec <bigfree+0x1c>
+ b1c:	eb c2                	jmp    ae0 <bigfree+0x10>
+ b1e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ b20:	03 58 04             	add    0x4(%eax),%ebx
+ b23:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b26:	8b 02                	mov    (%edx),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ b2c:	8b 42 04             	mov    0x4(%edx),%eax
+ b2f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b32:	39 d9                	cmp    %ebx,%ecx
+ b34:	75 d0                	jne    b06 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ b36:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ b39:	89 15 d4 17 00 00    	mov    %edx,0x17d4
+    p->s.size += bp->s.size;
+ b3f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b42:	8b 09                	mov    (%ecx),%ecx
+ b44:	89 0a                	mov    %ecx,(%edx)
+}
+ b46:	5b                   	pop    %ebx
+ b47:	5e                   	pop    %esi
+ b48:	5d                   	pop    %ebp
+ b49:	c3                   	ret
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b50 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	57                   	push   %edi
+ b54:	89 c7                	mov    %eax,%edi
+ b56:	56                   	push   %esi
+ b57:	53                   	push   %ebx
+ b58:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ b5b:	a1 d4 17 00 00       	mov    0x17d4,%eax
+ b60:	85 c0                	test   %eax,%eax
+ b62:	0f 84 88 00 00 00    	je     bf0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b68:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b6a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b6d:	39 f9                	cmp    %edi,%ecx
+ b6f:	73 5f                	jae    bd0 <bigalloc+0x80>
+  if(nu < 4096)
+ b71:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b76:	39 df                	cmp    %ebx,%edi
+ b78:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b7b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b82:	eb 0d                	jmp    b91 <bigalloc+0x41>
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b88:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b8a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b8d:	39 f9                	cmp    %edi,%ecx
+ b8f:	73 3f                	jae    bd0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b91:	89 d0                	mov    %edx,%eax
+ b93:	39 15 d4 17 00 00    	cmp    %edx,0x17d4
+ b99:	75 ed                	jne    b88 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b9b:	83 ec 0c             	sub    $0xc,%esp
+ b9e:	56                   	push   %esi
+ b9f:	e8 67 fb ff ff       	call   70b <sbrk>
+  if(p == (char*)-1)
+ ba4:	83 c4 10             	add    $0x10,%esp
+ ba7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ baa:	74 11                	je     bbd <bigalloc+0x6d>
+  hp->s.size = nu;
+ bac:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ baf:	e8 1c ff ff ff       	call   ad0 <bigfree>
+  return freep;
+ bb4:	a1 d4 17 00 00       	mov    0x17d4,%eax
+      if((p = morecore(nunits)) == 0)
+ bb9:	85 c0                	test   %eax,%eax
+ bbb:	75 cb                	jne    b88 <bigalloc+0x38>
+        return 0;
+  }
+}
+ bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bc0:	31 d2                	xor    %edx,%edx
+}
+ bc2:	5b                   	pop    %ebx
+ bc3:	89 d0                	mov    %edx,%eax
+ bc5:	5e                   	pop    %esi
+ bc6:	5f                   	pop    %edi
+ bc7:	5d                   	pop    %ebp
+ bc8:	c3                   	ret
+ bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ bd0:	39 cf                	cmp    %ecx,%edi
+ bd2:	74 4c                	je     c20 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ bd4:	29 f9                	sub    %edi,%ecx
+ bd6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ bd9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ bdc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ bdf:	a3 d4 17 00 00       	mov    %eax,0x17d4
+}
+ be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ be7:	89 d0                	mov    %edx,%eax
+ be9:	5b                   	pop    %ebx
+ bea:	5e                   	pop    %esi
+ beb:	5f                   	pop    %edi
+ bec:	5d                   	pop    %ebp
+ bed:	c3                   	ret
+ bee:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ bf0:	c7 05 d4 17 00 00 d8 	movl   $0x17d8,0x17d4
+ bf7:	17 00 00 
+    base.s.size = 0;
+ bfa:	ba d8 17 00 00       	mov    $0x17d8,%edx
+    base.s.ptr = freep = prevp = &base;
+ bff:	c7 05 d8 17 00 00 d8 	movl   $0x17d8,0x17d8
+ c06:	17 00 00 
+    base.s.size = 0;
+ c09:	c7 05 dc 17 00 00 00 	movl   $0x0,0x17dc
+ c10:	00 00 00 
+    if(p->s.size >= nunits){
+ c13:	e9 59 ff ff ff       	jmp    b71 <bigalloc+0x21>
+ c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c20:	8b 0a                	mov    (%edx),%ecx
+ c22:	89 08                	mov    %ecx,(%eax)
+ c24:	eb b9                	jmp    bdf <bigalloc+0x8f>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c30 <free>:
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	53                   	push   %ebx
+ c34:	83 ec 04             	sub    $0x4,%esp
+ c37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ c3a:	85 c9                	test   %ecx,%ecx
+ c3c:	74 58                	je     c96 <free+0x66>
+  bp = (Header*)ap - 1;
+ c3e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c41:	ba 01 00 00 00       	mov    $0x1,%edx
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+ c50:	89 d0                	mov    %edx,%eax
+ c52:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+  while(xchg(&locked, 1) != 0)
+ c59:	85 c0                	test   %eax,%eax
+ c5b:	75 f3                	jne    c50 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ c5d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ c60:	83 fa 40             	cmp    $0x40,%edx
+ c63:	77 3b                	ja     ca0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ c65:	83 fa 02             	cmp    $0x2,%edx
+ c68:	76 3f                	jbe    ca9 <free+0x79>
+ c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c70:	83 c0 01             	add    $0x1,%eax
+ c73:	39 14 85 a0 10 00 00 	cmp    %edx,0x10a0(,%eax,4)
+ c7a:	72 f4                	jb     c70 <free+0x40>
+    bp->s.ptr = classfree[c];
+ c7c:	8b 14 85 a0 17 00 00 	mov    0x17a0(,%eax,4),%edx
+    classfree[c] = bp;
+ c83:	89 1c 85 a0 17 00 00 	mov    %ebx,0x17a0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ c8a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ c8d:	31 c0                	xor    %eax,%eax
+ c8f:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+}
+ c96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c99:	c9                   	leave
+ c9a:	c3                   	ret
+ c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+    bigfree(bp);
+ ca0:	89 d8                	mov    %ebx,%eax
+ ca2:	e8 29 fe ff ff       	call   ad0 <bigfree>
+ ca7:	eb e4                	jmp    c8d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ ca9:	31 c0                	xor    %eax,%eax
+ cab:	eb cf                	jmp    c7c <free+0x4c>
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	57                   	push   %edi
+ cb9:	56                   	push   %esi
+ cba:	53                   	push   %ebx
+ cbb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cbe:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc1:	8d 50 07             	lea    0x7(%eax),%edx
+ cc4:	c1 ea 03             	shr    $0x3,%edx
+ cc7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ cd0:	89 c8                	mov    %ecx,%eax
+ cd2:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+ cd9:	85 c0                	test   %eax,%eax
+ cdb:	75 f3                	jne    cd0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ cdd:	89 c3                	mov    %eax,%ebx
+ cdf:	83 fa 40             	cmp    $0x40,%edx
+ ce2:	77 4c                	ja     d30 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ ce4:	be 02 00 00 00       	mov    $0x2,%esi
+ ce9:	83 fa 02             	cmp    $0x2,%edx
+ cec:	76 10                	jbe    cfe <malloc+0x4e>
+ cee:	66 90                	xchg   %ax,%ax
+ cf0:	83 c3 01             	add    $0x1,%ebx
+ cf3:	8b 34 9d a0 10 00 00 	mov    0x10a0(,%ebx,4),%esi
+ cfa:	39 d6                	cmp    %edx,%esi
+ cfc:	72 f2                	jb     cf0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ cfe:	8b 14 9d a0 17 00 00 	mov    0x17a0(,%ebx,4),%edx
+ d05:	85 d2                	test   %edx,%edx
+ d07:	74 47                	je     d50 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ d09:	8b 3a                	mov    (%edx),%edi
+ d0b:	89 3c 9d a0 17 00 00 	mov    %edi,0x17a0(,%ebx,4)
+ d12:	31 c0                	xor    %eax,%eax
+ d14:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ d1b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ d1e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ d21:	5b                   	pop    %ebx
+ d22:	5e                   	pop    %esi
+ d23:	5f                   	pop    %edi
+ d24:	5d                   	pop    %ebp
+ d25:	c3                   	ret
+ d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ d30:	89 d0                	mov    %edx,%eax
+ d32:	e8 19 fe ff ff       	call   b50 <bigalloc>
+ d37:	89 c2                	mov    %eax,%edx
+ d39:	89 d8                	mov    %ebx,%eax
+ d3b:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+  return p ? (void*)(p + 1) : 0;
+ d42:	85 d2                	test   %edx,%edx
+ d44:	75 d5                	jne    d1b <malloc+0x6b>
+ d46:	31 c0                	xor    %eax,%eax
+}
+ d48:	83 c4 1c             	add    $0x1c,%esp
+ d4b:	5b                   	pop    %ebx
+ d4c:	5e                   	pop    %esi
+ d4d:	5f                   	pop    %edi
+ d4e:	5d                   	pop    %ebp
+ d4f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ d50:	b8 00 02 00 00       	mov    $0x200,%eax
+ d55:	e8 f6 fd ff ff       	call   b50 <bigalloc>
+ d5a:	85 c0                	test   %eax,%eax
+ d5c:	74 44                	je     da2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d5e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ d65:	8b 14 9d a0 17 00 00 	mov    0x17a0(,%ebx,4),%edx
+ d6c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ d6f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ d72:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ d78:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ d7b:	39 cf                	cmp    %ecx,%edi
+ d7d:	72 8a                	jb     d09 <malloc+0x59>
+ d7f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ d82:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ d85:	8d 76 00             	lea    0x0(%esi),%esi
+ d88:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ d8a:	89 70 04             	mov    %esi,0x4(%eax)
+ d8d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d8f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ d91:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d93:	01 d8                	add    %ebx,%eax
+ d95:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ d98:	73 ee                	jae    d88 <malloc+0xd8>
+ d9a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ d9d:	e9 69 ff ff ff       	jmp    d0b <malloc+0x5b>
+ da2:	f0 87 05 80 17 00 00 	lock xchg %eax,0x1780
+  return p ? (void*)(p + 1) : 0;
+ da9:	31 c0                	xor    %eax,%eax
+ dab:	eb 9b                	jmp    d48 <malloc+0x98>
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000db0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ db0:	55                   	push   %ebp
+ db1:	89 e5                	mov    %esp,%ebp
+ db3:	56                   	push   %esi
+ db4:	53                   	push   %ebx
+ db5:	8b 45 08             	mov    0x8(%ebp),%eax
+ db8:	f7 65 0c             	mull   0xc(%ebp)
+ dbb:	70 33                	jo     df0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ dbd:	83 ec 0c             	sub    $0xc,%esp
+ dc0:	89 c3                	mov    %eax,%ebx
+ dc2:	50                   	push   %eax
+ dc3:	e8 e8 fe ff ff       	call   cb0 <malloc>
+ dc8:	83 c4 10             	add    $0x10,%esp
+ dcb:	89 c6                	mov    %eax,%esi
+ dcd:	85 c0                	test   %eax,%eax
+ dcf:	74 1f                	je     df0 <calloc+0x40>
+    memset(p, 0, n);
+ dd1:	83 ec 04             	sub    $0x4,%esp
+ dd4:	53                   	push   %ebx
+ dd5:	6a 00                	push   $0x0
+ dd7:	50                   	push   %eax
+ dd8:	e8 23 f7 ff ff       	call   500 <memset>
+ ddd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ de0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ de3:	89 f0                	mov    %esi,%eax
+ de5:	5b                   	pop    %ebx
+ de6:	5e                   	pop    %esi
+ de7:	5d                   	pop    %ebp
+ de8:	c3                   	ret
+ de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ df0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ df3:	31 f6                	xor    %esi,%esi
+}
+ df5:	89 f0                	mov    %esi,%eax
+ df7:	5b                   	pop    %ebx
+ df8:	5e                   	pop    %esi
+ df9:	5d                   	pop    %ebp
+ dfa:	c3                   	ret
+ dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+
+00000e00 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	57                   	push   %edi
+ e04:	56                   	push   %esi
+ e05:	53                   	push   %ebx
+ e06:	83 ec 0c             	sub    $0xc,%esp
+ e09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ e0f:	85 db                	test   %ebx,%ebx
+ e11:	74 55                	je     e68 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ e13:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ e16:	89 de                	mov    %ebx,%esi
+ e18:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ e1f:	39 c7                	cmp    %eax,%edi
+ e21:	72 0d                	jb     e30 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e26:	89 f0                	mov    %esi,%eax
+ e28:	5b                   	pop    %ebx
+ e29:	5e                   	pop    %esi
+ e2a:	5f                   	pop    %edi
+ e2b:	5d                   	pop    %ebp
+ e2c:	c3                   	ret
+ e2d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ e30:	83 ec 0c             	sub    $0xc,%esp
+ e33:	50                   	push   %eax
+ e34:	e8 77 fe ff ff       	call   cb0 <malloc>
+ e39:	83 c4 10             	add    $0x10,%esp
+ e3c:	89 c6                	mov    %eax,%esi
+ e3e:	85 c0                	test   %eax,%eax
+ e40:	74 e1                	je     e23 <realloc+0x23>
+  memmove(p, ap, have);
+ e42:	83 ec 04             	sub    $0x4,%esp
+ e45:	57                   	push   %edi
+ e46:	53                   	push   %ebx
+ e47:	50                   	push   %eax
+ e48:	e8 03 f8 ff ff       	call   650 <memmove>
+  free(ap);
+ e4d:	89 1c 24             	mov    %ebx,(%esp)
+ e50:	e8 db fd ff ff       	call   c30 <free>
+  return p;
+ e55:	83 c4 10             	add    $0x10,%esp
+}
+ e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e5b:	89 f0                	mov    %esi,%eax
+ e5d:	5b                   	pop    %ebx
+ e5e:	5e                   	pop    %esi
+ e5f:	5f                   	pop    %edi
+ e60:	5d                   	pop    %ebp
+ e61:	c3                   	ret
+ e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ e68:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ e6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e6e:	5b                   	pop    %ebx
+ e6f:	5e                   	pop    %esi
+ e70:	5f                   	pop    %edi
+ e71:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ e72:	e9 39 fe ff ff       	jmp    cb0 <malloc>
@@ -3,10 +3,86 @@
 #include "user.h"
 #include "procinfo.h"
 
+#define NLOG 16
+
+char *policies[NWDPOLICY] = {
+[WD_REPORT]    "report",
+[WD_YOUNGEST]  "youngest",
+[WD_LOWPRI]    "lowpri",
+[WD_LEASTCPU]  "leastcpu",
+};
+
+struct deadlogent log[NLOG];
+
+void
+usage(void)
+{
+  printf(2, "usage: deadlockinfo [-l] [-w report|youngest|lowpri|leastcpu] [-t ticks]\n");
+  exit();
+}
+
+// Print and consume the watchdog's log of deadlocks.
+void
+printlog(void)
+{
+  int i, j, n, total;
+
+  total = 0;
+  while((n = deadlocklog(log, NLOG)) > 0) {
+    for(i = 0; i < n; i++) {
+      printf(1, "tick %d: cycle of %d:", log[i].tick, log[i].len);
+      for(j = 0; j < log[i].len && j < NDLCYCLE; j++)
+        printf(1, " %d", log[i].pids[j]);
+      if(log[i].len > NDLCYCLE)
+        printf(1, " ...");
+      if(log[i].victim > 0)
+        printf(1, ", killed %d", log[i].victim);
+      else if(log[i].victim < 0)
+        printf(1, ", cannot be broken");
+      printf(1, "\n");
+    }
+    total += n;
+  }
+  if(n < 0)
+    printf(2, "deadlockinfo: deadlocklog failed\n");
+  else if(total == 0)
+    printf(1, "No deadlocks logged.\n");
+}
+
 int
 main(int argc, char *argv[])
 {
   struct deadlockinfo info;
+  int i, j, k, policy, interval, old;
+
+  policy = interval = -1;
+  for(i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "-l") == 0) {
+      printlog();
+      exit();
+    } else if(strcmp(argv[i], "-w") == 0 && i+1 < argc) {
+      i++;
+      for(policy = 0; policy < NWDPOLICY; policy++)
+        if(strcmp(argv[i], policies[policy]) == 0)
+          break;
+      if(policy == NWDPOLICY)
+        usage();
+    } else if(strcmp(argv[i], "-t") == 0 && i+1 < argc) {
+      if((interval = atoi(argv[++i])) <= 0)
+        usage();
+    } else {
+      usage();
+    }
+  }
+  if(policy >= 0 || interval > 0) {
+    if((old = watchdogctl(policy, interval)) < 0) {
+      printf(2, "deadlockinfo: watchdogctl failed\n");
+      exit();
+    }
+    if(policy >= 0)
+      printf(1, "watchdog policy %s (was %s)\n", policies[policy], policies[old]);
+    exit();
+  }
 
   if(getdeadlockinfo(&info) < 0) {
     printf(2, "deadlockinfo: syscall failed\n");
@@ -14,14 +90,15 @@ main(int argc, char *argv[])
   }
 
   if(info.found) {
-    printf(1, "--- DEADLOCK DETECTED ---\n");
-    printf(1, "Process cycle: ");
-    for(int i = 0; i < NPROC; i++) {
-      if(info.pids_in_cycle[i] == 0)
-        break;
-      printf(1, "%d -> ", info.pids_in_cycle[i]);
+    printf(1, "--- DEADLOCK DETECTED: %d cycle(s) ---\n", info.found);
+    k = 0;
+    for(i = 0; i < info.found; i++) {
+      printf(1, "Process cycle: ");
+      for(j = 0; j < info.cycle_len[i]; j++)
+        printf(1, "%d -> ", info.pids_in_cycle[k + j]);
+      printf(1, "%d\n", info.pids_in_cycle[k]);
+      k += info.cycle_len[i];
     }
-    printf(1, "...\n");
   } else {
     printf(1, "No deadlock detected.\n");
   }
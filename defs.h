@@ -1,14 +1,31 @@
 struct buf;
 struct context;
+struct deadlockinfo;
+struct deadlogent;
 struct file;
 struct inode;
+struct iovec;
+struct lockstat;
+struct mlfqrec;
+struct mlfqstat;
+struct logstat;
 struct pipe;
+struct pollent;
+struct pollfd;
 struct proc;
+struct profsample;
 struct rtcdate;
+struct rwlock;
+struct seqlock;
+struct shmseg;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceevent;
+struct waitstat;
+struct trapframe;
+struct waitq;
 
 // bio.c
 void            binit(void);
@@ -26,33 +43,53 @@ void            panic(char*) __attribute__((noreturn));
 int             exec(char*, char**);
 
 // file.c
+struct inode*   cwdget(void);
+struct inode*   cwdset(struct inode*);
+int             fdalloc(struct file*);
+void            fdcopy(struct proc*);
+struct file*    fdfree(int);
+struct file*    fdget(int);
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
+int             filepoll(struct file*, struct pollent*);
+int             filepread(struct file*, char*, int n, uint off);
+int             filepwrite(struct file*, char*, int n, uint off);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int);
+int             filesplice(struct file*, struct file*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
+struct buf*     ibread(struct inode*, uint);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
+int             ismountpoint(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
+int             mount(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
+int             umount(struct inode*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+int             futex(volatile uint*, int, int);
+void            futexinit(void);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -85,12 +122,30 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
+void            end_opn(int);
+void            logstat(struct logstat*);
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pcache.c
+void            pcacheinit(void);
+void            pcachedrop(uint, uint);
+void            pcachedup(char*);
+char*           pcacheget(struct inode*, uint);
+void            pcacheput(char*);
+void            pcachewrite(struct inode*, uint, char*, uint);
+
+// poll.c
+int             poll(struct pollfd*, int, int);
+void            pollinit(void);
+void            pollqueue(struct waitq*, struct spinlock*, struct pollent*);
+void            polltimer(void);
+void            pollwakeup(struct waitq*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -98,24 +153,35 @@ void            picinit(void);
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
+int             pipepoll(struct pipe*, struct pollent*);
+int             pipeput(struct pipe*, char*, int);
 int             piperead(struct pipe*, char*, int);
+int             pipereadv(struct pipe*, struct iovec*, int);
+int             pipewaitspace(struct pipe*);
 int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void(*)(void*, void*), void*, void*, void*);
 int             cpuid(void);
+int             execthreads(struct proc*);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+int             join(void**);
 int             kill(int);
+int             kthread_create(char*, void(*)(void*), void*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+int             procwaitstat(int, struct waitstat*);
 void            scheduler(void) __attribute__((noreturn));
+int             schedwaitstats(struct waitstat*, int, int);
 void            sched(void);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             threadcount(struct proc*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -129,12 +195,41 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockbench(int, int);
+int             lockstats(struct lockstat*, int, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// prof.c
+void            profinit(void);
+int             profctl(int, struct profsample*, int);
+void            proftick(struct trapframe*);
+
+// rwlock.c
+void            acquireread(struct rwlock*);
+void            acquirewrite(struct rwlock*);
+void            initrwlock(struct rwlock*, char*);
+void            releaseread(struct rwlock*);
+void            releasewrite(struct rwlock*);
+
+// seqlock.c
+void            acquireseq(struct seqlock*);
+void            initseqlock(struct seqlock*, char*);
+void            releaseseq(struct seqlock*);
+uint            seqbegin(struct seqlock*);
+int             seqretry(struct seqlock*, uint);
+
+// shm.c
+void            shmdup(struct shmseg*);
+struct shmseg*  shmget(int, uint);
+void            shminit(void);
+char*           shmpage(struct shmseg*, uint);
+void            shmput(struct shmseg*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
+int             acquiresleepintr(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
@@ -144,6 +239,7 @@ int             memcmp(const void*, const void*, uint);
 void*           memmove(void*, const void*, uint);
 void*           memset(void*, int, uint);
 char*           safestrcpy(char*, const char*, int);
+void            sseinit(void);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
@@ -151,7 +247,8 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
-int             argstr(int, char**);
+int             argptrw(int, char**, int);
+int             argstr(int, char*, int);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
@@ -160,15 +257,41 @@ void            syscall(void);
 void            timerinit(void);
 
 // deadlock.c
+int             deadlocklog(struct deadlogent*, int);
+int             deadlockscan(struct deadlockinfo*);
+void            deadlockinit(void);
 int             detect_deadlock(void);
-void            build_wfg(void);
-int             dfs_check_cycle(int);
+void            dlexit(struct proc*);
+int             dllock(int, int);
+void            wfghold(struct sleeplock*);
+void            wfgrelease(struct sleeplock*);
+void            wfgwait(struct sleeplock*, int);
+void            watchdog(void*);
+int             watchdogctl(int, int);
 
 // proc.c
-void            print_queues(void);
-void            record_mlfq_snapshot(void);
+void            mlfqlog(int, int, int);
+int             mlfqread(struct mlfqrec*, int, uint*, int);
+void            mlfqsnapshot(struct mlfqstat*);
 void            statsinit(void);
 
+// tmpfs.c
+uint            tmpalloc(short);
+void            tmpfsinit(void);
+int             tmpfsmount(void);
+void            tmpfsumount(void);
+void            tmpload(struct inode*);
+int             tmpread(struct inode*, char*, uint, uint);
+void            tmptrunc(struct inode*);
+void            tmpupdate(struct inode*);
+int             tmpwrite(struct inode*, char*, uint, uint);
+
+// trace.c
+void            ktrace(int, uint, uint);
+int             tracectl(int);
+void            traceinit(void);
+int             traceread(struct traceevent*, int);
+
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
@@ -194,7 +317,16 @@ pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
+void            addpages(struct proc*, int);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             mmap(struct file*, uint, uint, int, int);
+int             munmap(uint, uint);
+int             shmat(int, uint);
+int             shmdt(uint);
+int             uvmcheck(uint, uint, int);
+int             vmcopy(struct proc*, struct proc*);
+int             vmfault(uint, int);
+void            vmfree(struct proc*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
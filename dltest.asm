@@ -0,0 +1,2260 @@
+
+_dltest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 40             	sub    $0x40,%esp
+  int pids[6], i, n;
+  char c;
+
+  printf(1, "dltest starting\n");
+  14:	68 e5 0f 00 00       	push   $0xfe5
+  19:	6a 01                	push   $0x1
+  1b:	e8 40 0a 00 00       	call   a60 <printf>
+  if(pipe(ready) < 0 || pipe(go) < 0)
+  20:	c7 04 24 a8 15 00 00 	movl   $0x15a8,(%esp)
+  27:	e8 a7 07 00 00       	call   7d3 <pipe>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	78 14                	js     47 <main+0x47>
+  33:	83 ec 0c             	sub    $0xc,%esp
+  36:	68 a0 15 00 00       	push   $0x15a0
+  3b:	e8 93 07 00 00       	call   7d3 <pipe>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	79 0d                	jns    54 <main+0x54>
+    fail("pipe");
+  47:	83 ec 0c             	sub    $0xc,%esp
+  4a:	68 f6 0f 00 00       	push   $0xff6
+  4f:	e8 ac 03 00 00       	call   400 <fail>
+
+  if(detect_deadlock() != 0)
+  54:	e8 12 08 00 00       	call   86b <detect_deadlock>
+  59:	89 c7                	mov    %eax,%edi
+  5b:	85 c0                	test   %eax,%eax
+  5d:	0f 85 f3 00 00 00    	jne    156 <main+0x156>
+    fail("deadlock before test");
+
+  // Two processes waiting for each other, three processes in
+  // a ring, and one process waiting for a lock it holds.
+  pids[0] = locker(0, 1);
+  63:	50                   	push   %eax
+  64:	50                   	push   %eax
+  65:	6a 01                	push   $0x1
+  67:	6a 00                	push   $0x0
+  69:	e8 b2 03 00 00       	call   420 <locker>
+  6e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  pids[1] = locker(1, 0);
+  71:	58                   	pop    %eax
+  72:	5a                   	pop    %edx
+  73:	6a 00                	push   $0x0
+  75:	6a 01                	push   $0x1
+  77:	e8 a4 03 00 00       	call   420 <locker>
+  7c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  pids[2] = locker(2, 3);
+  7f:	59                   	pop    %ecx
+  80:	5b                   	pop    %ebx
+  81:	6a 03                	push   $0x3
+  83:	6a 02                	push   $0x2
+  85:	e8 96 03 00 00       	call   420 <locker>
+  8a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  pids[3] = locker(3, 4);
+  8d:	5e                   	pop    %esi
+  pids[4] = locker(4, 2);
+  pids[5] = locker(5, 5);
+  8e:	be 06 00 00 00       	mov    $0x6,%esi
+  pids[3] = locker(3, 4);
+  93:	58                   	pop    %eax
+  94:	6a 04                	push   $0x4
+  96:	6a 03                	push   $0x3
+  98:	e8 83 03 00 00       	call   420 <locker>
+  9d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  pids[4] = locker(4, 2);
+  a0:	58                   	pop    %eax
+  a1:	5a                   	pop    %edx
+  a2:	6a 02                	push   $0x2
+  a4:	6a 04                	push   $0x4
+  a6:	e8 75 03 00 00       	call   420 <locker>
+  ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  pids[5] = locker(5, 5);
+  ae:	59                   	pop    %ecx
+  af:	5b                   	pop    %ebx
+  b0:	6a 05                	push   $0x5
+  b2:	8d 5d cf             	lea    -0x31(%ebp),%ebx
+  b5:	6a 05                	push   $0x5
+  b7:	e8 64 03 00 00       	call   420 <locker>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < 6; i++)
+    if(read(ready[0], &c, 1) != 1)
+  c2:	50                   	push   %eax
+  c3:	6a 01                	push   $0x1
+  c5:	53                   	push   %ebx
+  c6:	ff 35 a8 15 00 00    	push   0x15a8
+  cc:	e8 0a 07 00 00       	call   7db <read>
+  d1:	83 c4 10             	add    $0x10,%esp
+  d4:	83 e8 01             	sub    $0x1,%eax
+  d7:	0f 85 93 00 00 00    	jne    170 <main+0x170>
+  for(i = 0; i < 6; i++)
+  dd:	83 ee 01             	sub    $0x1,%esi
+  e0:	75 e0                	jne    c2 <main+0xc2>
+  e2:	be 06 00 00 00       	mov    $0x6,%esi
+      fail("ready");
+  for(i = 0; i < 6; i++)
+    write(go[1], "g", 1);
+  e7:	50                   	push   %eax
+  e8:	6a 01                	push   $0x1
+  ea:	68 7c 10 00 00       	push   $0x107c
+  ef:	ff 35 a4 15 00 00    	push   0x15a4
+  f5:	e8 e9 06 00 00       	call   7e3 <write>
+  for(i = 0; i < 6; i++)
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	83 ee 01             	sub    $0x1,%esi
+ 100:	75 e5                	jne    e7 <main+0xe7>
+ 102:	be 64 00 00 00       	mov    $0x64,%esi
+ 107:	eb 19                	jmp    122 <main+0x122>
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+  // Wait for all of them to block.
+  for(i = 0; i < 100; i++){
+    if((n = detect_deadlock()) == 3)
+      break;
+    sleep(1);
+ 110:	83 ec 0c             	sub    $0xc,%esp
+ 113:	6a 01                	push   $0x1
+ 115:	e8 39 07 00 00       	call   853 <sleep>
+  for(i = 0; i < 100; i++){
+ 11a:	83 c4 10             	add    $0x10,%esp
+ 11d:	83 ee 01             	sub    $0x1,%esi
+ 120:	74 41                	je     163 <main+0x163>
+    if((n = detect_deadlock()) == 3)
+ 122:	e8 44 07 00 00       	call   86b <detect_deadlock>
+ 127:	83 f8 03             	cmp    $0x3,%eax
+ 12a:	75 e4                	jne    110 <main+0x110>
+  }
+  if(n != 3)
+    fail("detect_deadlock");
+  if(getdeadlockinfo(&info) < 0 || info.found != 3)
+ 12c:	83 ec 0c             	sub    $0xc,%esp
+ 12f:	68 80 18 00 00       	push   $0x1880
+ 134:	e8 82 07 00 00       	call   8bb <getdeadlockinfo>
+ 139:	83 c4 10             	add    $0x10,%esp
+ 13c:	85 c0                	test   %eax,%eax
+ 13e:	78 09                	js     149 <main+0x149>
+ 140:	83 3d 80 18 00 00 03 	cmpl   $0x3,0x1880
+ 147:	74 34                	je     17d <main+0x17d>
+    fail("getdeadlockinfo");
+ 149:	83 ec 0c             	sub    $0xc,%esp
+ 14c:	68 16 10 00 00       	push   $0x1016
+ 151:	e8 aa 02 00 00       	call   400 <fail>
+    fail("deadlock before test");
+ 156:	83 ec 0c             	sub    $0xc,%esp
+ 159:	68 fb 0f 00 00       	push   $0xffb
+ 15e:	e8 9d 02 00 00       	call   400 <fail>
+    fail("detect_deadlock");
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	68 c2 10 00 00       	push   $0x10c2
+ 16b:	e8 90 02 00 00       	call   400 <fail>
+      fail("ready");
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	68 10 10 00 00       	push   $0x1010
+ 178:	e8 83 02 00 00       	call   400 <fail>
+  if(!hascycle(pids, 2) || !hascycle(pids + 2, 3) || !hascycle(pids + 5, 1))
+ 17d:	8d 75 d0             	lea    -0x30(%ebp),%esi
+ 180:	51                   	push   %ecx
+ 181:	51                   	push   %ecx
+ 182:	6a 02                	push   $0x2
+ 184:	56                   	push   %esi
+ 185:	e8 26 03 00 00       	call   4b0 <hascycle>
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	85 c0                	test   %eax,%eax
+ 18f:	74 28                	je     1b9 <main+0x1b9>
+ 191:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 194:	52                   	push   %edx
+ 195:	52                   	push   %edx
+ 196:	6a 03                	push   $0x3
+ 198:	50                   	push   %eax
+ 199:	e8 12 03 00 00       	call   4b0 <hascycle>
+ 19e:	83 c4 10             	add    $0x10,%esp
+ 1a1:	85 c0                	test   %eax,%eax
+ 1a3:	74 14                	je     1b9 <main+0x1b9>
+ 1a5:	50                   	push   %eax
+ 1a6:	50                   	push   %eax
+ 1a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 1aa:	6a 01                	push   $0x1
+ 1ac:	50                   	push   %eax
+ 1ad:	e8 fe 02 00 00       	call   4b0 <hascycle>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+ 1b5:	85 c0                	test   %eax,%eax
+ 1b7:	75 0d                	jne    1c6 <main+0x1c6>
+    fail("cycle members");
+ 1b9:	83 ec 0c             	sub    $0xc,%esp
+ 1bc:	68 26 10 00 00       	push   $0x1026
+ 1c1:	e8 3a 02 00 00       	call   400 <fail>
+  printf(1, "found %d cycles\n", info.found);
+ 1c6:	50                   	push   %eax
+ 1c7:	6a 03                	push   $0x3
+ 1c9:	68 34 10 00 00       	push   $0x1034
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	e8 8b 08 00 00       	call   a60 <printf>
+ 1d5:	83 c4 10             	add    $0x10,%esp
+
+  // Killing the processes breaks the deadlocks.
+  for(i = 0; i < 6; i++)
+    kill(pids[i]);
+ 1d8:	83 ec 0c             	sub    $0xc,%esp
+ 1db:	ff 34 be             	push   (%esi,%edi,4)
+  for(i = 0; i < 6; i++)
+ 1de:	83 c7 01             	add    $0x1,%edi
+    kill(pids[i]);
+ 1e1:	e8 0d 06 00 00       	call   7f3 <kill>
+  for(i = 0; i < 6; i++)
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	83 ff 06             	cmp    $0x6,%edi
+ 1ec:	75 ea                	jne    1d8 <main+0x1d8>
+  for(i = 0; i < 6; i++)
+    wait();
+ 1ee:	e8 d8 05 00 00       	call   7cb <wait>
+  if(detect_deadlock() != 0)
+    fail("deadlock after kill");
+
+  // The locks were released when their holders exited.
+  for(i = 0; i < NDLLOCK; i++)
+ 1f3:	31 ff                	xor    %edi,%edi
+    wait();
+ 1f5:	e8 d1 05 00 00       	call   7cb <wait>
+ 1fa:	e8 cc 05 00 00       	call   7cb <wait>
+ 1ff:	e8 c7 05 00 00       	call   7cb <wait>
+ 204:	e8 c2 05 00 00       	call   7cb <wait>
+ 209:	e8 bd 05 00 00       	call   7cb <wait>
+  if(detect_deadlock() != 0)
+ 20e:	e8 58 06 00 00       	call   86b <detect_deadlock>
+ 213:	89 c6                	mov    %eax,%esi
+ 215:	85 c0                	test   %eax,%eax
+ 217:	0f 85 54 01 00 00    	jne    371 <main+0x371>
+    if(dllock(DL_LOCK, i) < 0 || dllock(DL_UNLOCK, i) < 0)
+ 21d:	50                   	push   %eax
+ 21e:	50                   	push   %eax
+ 21f:	57                   	push   %edi
+ 220:	6a 01                	push   $0x1
+ 222:	e8 44 07 00 00       	call   96b <dllock>
+ 227:	83 c4 10             	add    $0x10,%esp
+ 22a:	85 c0                	test   %eax,%eax
+ 22c:	0f 88 32 01 00 00    	js     364 <main+0x364>
+ 232:	50                   	push   %eax
+ 233:	50                   	push   %eax
+ 234:	57                   	push   %edi
+ 235:	6a 02                	push   $0x2
+ 237:	e8 2f 07 00 00       	call   96b <dllock>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	85 c0                	test   %eax,%eax
+ 241:	0f 88 1d 01 00 00    	js     364 <main+0x364>
+  for(i = 0; i < NDLLOCK; i++)
+ 247:	83 c7 01             	add    $0x1,%edi
+ 24a:	83 ff 08             	cmp    $0x8,%edi
+ 24d:	75 ce                	jne    21d <main+0x21d>
+      fail("lock after kill");
+  if(dllock(DL_UNLOCK, 0) >= 0)
+ 24f:	50                   	push   %eax
+ 250:	50                   	push   %eax
+ 251:	6a 00                	push   $0x0
+ 253:	6a 02                	push   $0x2
+ 255:	e8 11 07 00 00       	call   96b <dllock>
+ 25a:	83 c4 10             	add    $0x10,%esp
+ 25d:	85 c0                	test   %eax,%eax
+ 25f:	0f 89 26 01 00 00    	jns    38b <main+0x38b>
+    fail("unlock of a free lock");
+
+  // With a victim policy, the watchdog kills one of the two
+  // and the other then gets its lock and exits.
+  while(deadlocklog(log, 16) > 0)
+ 265:	57                   	push   %edi
+ 266:	57                   	push   %edi
+ 267:	6a 10                	push   $0x10
+ 269:	68 c0 15 00 00       	push   $0x15c0
+ 26e:	e8 08 07 00 00       	call   97b <deadlocklog>
+ 273:	83 c4 10             	add    $0x10,%esp
+ 276:	85 c0                	test   %eax,%eax
+ 278:	7f eb                	jg     265 <main+0x265>
+    ;
+  if(watchdogctl(WD_YOUNGEST, 5) < 0)
+ 27a:	51                   	push   %ecx
+ 27b:	51                   	push   %ecx
+ 27c:	6a 05                	push   $0x5
+ 27e:	6a 01                	push   $0x1
+ 280:	e8 ee 06 00 00       	call   973 <watchdogctl>
+ 285:	83 c4 10             	add    $0x10,%esp
+ 288:	85 c0                	test   %eax,%eax
+ 28a:	0f 88 ee 00 00 00    	js     37e <main+0x37e>
+    fail("watchdogctl");
+  pids[0] = locker(0, 1);
+ 290:	50                   	push   %eax
+ 291:	50                   	push   %eax
+ 292:	6a 01                	push   $0x1
+ 294:	6a 00                	push   $0x0
+ 296:	e8 85 01 00 00       	call   420 <locker>
+ 29b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 29e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  pids[1] = locker(1, 0);
+ 2a1:	58                   	pop    %eax
+ 2a2:	5a                   	pop    %edx
+ 2a3:	6a 00                	push   $0x0
+ 2a5:	6a 01                	push   $0x1
+ 2a7:	e8 74 01 00 00       	call   420 <locker>
+  for(i = 0; i < 2; i++)
+    if(read(ready[0], &c, 1) != 1)
+ 2ac:	83 c4 0c             	add    $0xc,%esp
+  pids[1] = locker(1, 0);
+ 2af:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 2b2:	89 c7                	mov    %eax,%edi
+    if(read(ready[0], &c, 1) != 1)
+ 2b4:	6a 01                	push   $0x1
+ 2b6:	53                   	push   %ebx
+ 2b7:	ff 35 a8 15 00 00    	push   0x15a8
+ 2bd:	e8 19 05 00 00       	call   7db <read>
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	83 e8 01             	sub    $0x1,%eax
+ 2c8:	0f 85 a2 fe ff ff    	jne    170 <main+0x170>
+ 2ce:	50                   	push   %eax
+ 2cf:	6a 01                	push   $0x1
+ 2d1:	53                   	push   %ebx
+ 2d2:	ff 35 a8 15 00 00    	push   0x15a8
+ 2d8:	e8 fe 04 00 00       	call   7db <read>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	83 e8 01             	sub    $0x1,%eax
+ 2e3:	0f 85 87 fe ff ff    	jne    170 <main+0x170>
+      fail("ready");
+  write(go[1], "gg", 2);
+ 2e9:	50                   	push   %eax
+ 2ea:	6a 02                	push   $0x2
+ 2ec:	68 7b 10 00 00       	push   $0x107b
+ 2f1:	ff 35 a4 15 00 00    	push   0x15a4
+ 2f7:	e8 e7 04 00 00       	call   7e3 <write>
+ 2fc:	83 c4 10             	add    $0x10,%esp
+ 2ff:	eb 1c                	jmp    31d <main+0x31d>
+  for(i = 0; i < 200; i++){
+    if(deadlocklog(log, 16) > 0)
+      break;
+    sleep(1);
+ 301:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 200; i++){
+ 304:	83 c6 01             	add    $0x1,%esi
+    sleep(1);
+ 307:	6a 01                	push   $0x1
+ 309:	e8 45 05 00 00       	call   853 <sleep>
+  for(i = 0; i < 200; i++){
+ 30e:	83 c4 10             	add    $0x10,%esp
+ 311:	81 fe c8 00 00 00    	cmp    $0xc8,%esi
+ 317:	0f 84 9b 00 00 00    	je     3b8 <main+0x3b8>
+    if(deadlocklog(log, 16) > 0)
+ 31d:	50                   	push   %eax
+ 31e:	50                   	push   %eax
+ 31f:	6a 10                	push   $0x10
+ 321:	68 c0 15 00 00       	push   $0x15c0
+ 326:	e8 50 06 00 00       	call   97b <deadlocklog>
+ 32b:	83 c4 10             	add    $0x10,%esp
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e cf                	jle    301 <main+0x301>
+  }
+  watchdogctl(WD_REPORT, WD_INTERVAL);
+ 332:	56                   	push   %esi
+ 333:	56                   	push   %esi
+ 334:	6a 64                	push   $0x64
+ 336:	6a 00                	push   $0x0
+ 338:	e8 36 06 00 00       	call   973 <watchdogctl>
+  if(i == 200)
+    fail("watchdog");
+  if(log[0].len != 2 || (log[0].victim != pids[0] && log[0].victim != pids[1]))
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	83 3d c8 15 00 00 02 	cmpl   $0x2,0x15c8
+ 347:	75 0e                	jne    357 <main+0x357>
+ 349:	a1 c4 15 00 00       	mov    0x15c4,%eax
+ 34e:	39 c7                	cmp    %eax,%edi
+ 350:	74 46                	je     398 <main+0x398>
+ 352:	39 45 c4             	cmp    %eax,-0x3c(%ebp)
+ 355:	74 41                	je     398 <main+0x398>
+    fail("watchdog log");
+ 357:	83 ec 0c             	sub    $0xc,%esp
+ 35a:	68 7e 10 00 00       	push   $0x107e
+ 35f:	e8 9c 00 00 00       	call   400 <fail>
+      fail("lock after kill");
+ 364:	83 ec 0c             	sub    $0xc,%esp
+ 367:	68 49 10 00 00       	push   $0x1049
+ 36c:	e8 8f 00 00 00       	call   400 <fail>
+    fail("deadlock after kill");
+ 371:	83 ec 0c             	sub    $0xc,%esp
+ 374:	68 45 10 00 00       	push   $0x1045
+ 379:	e8 82 00 00 00       	call   400 <fail>
+    fail("watchdogctl");
+ 37e:	83 ec 0c             	sub    $0xc,%esp
+ 381:	68 6f 10 00 00       	push   $0x106f
+ 386:	e8 75 00 00 00       	call   400 <fail>
+    fail("unlock of a free lock");
+ 38b:	83 ec 0c             	sub    $0xc,%esp
+ 38e:	68 59 10 00 00       	push   $0x1059
+ 393:	e8 68 00 00 00       	call   400 <fail>
+  wait();
+ 398:	e8 2e 04 00 00       	call   7cb <wait>
+  wait();
+ 39d:	e8 29 04 00 00       	call   7cb <wait>
+  if(detect_deadlock() != 0)
+ 3a2:	e8 c4 04 00 00       	call   86b <detect_deadlock>
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	74 24                	je     3cf <main+0x3cf>
+    fail("deadlock after watchdog");
+ 3ab:	83 ec 0c             	sub    $0xc,%esp
+ 3ae:	68 8b 10 00 00       	push   $0x108b
+ 3b3:	e8 48 00 00 00       	call   400 <fail>
+  watchdogctl(WD_REPORT, WD_INTERVAL);
+ 3b8:	50                   	push   %eax
+ 3b9:	50                   	push   %eax
+ 3ba:	6a 64                	push   $0x64
+ 3bc:	6a 00                	push   $0x0
+ 3be:	e8 b0 05 00 00       	call   973 <watchdogctl>
+    fail("watchdog");
+ 3c3:	c7 04 24 9a 10 00 00 	movl   $0x109a,(%esp)
+ 3ca:	e8 31 00 00 00       	call   400 <fail>
+  printf(1, "watchdog killed %d\n", log[0].victim);
+ 3cf:	52                   	push   %edx
+ 3d0:	ff 35 c4 15 00 00    	push   0x15c4
+ 3d6:	68 a3 10 00 00       	push   $0x10a3
+ 3db:	6a 01                	push   $0x1
+ 3dd:	e8 7e 06 00 00       	call   a60 <printf>
+
+  printf(1, "dltest ok\n");
+ 3e2:	59                   	pop    %ecx
+ 3e3:	5b                   	pop    %ebx
+ 3e4:	68 b7 10 00 00       	push   $0x10b7
+ 3e9:	6a 01                	push   $0x1
+ 3eb:	e8 70 06 00 00       	call   a60 <printf>
+  exit();
+ 3f0:	e8 ce 03 00 00       	call   7c3 <exit>
+ 3f5:	66 90                	xchg   %ax,%ax
+ 3f7:	66 90                	xchg   %ax,%ax
+ 3f9:	66 90                	xchg   %ax,%ax
+ 3fb:	66 90                	xchg   %ax,%ax
+ 3fd:	66 90                	xchg   %ax,%ax
+ 3ff:	90                   	nop
+
+00000400 <fail>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dltest: %s failed\n", msg);
+ 406:	ff 75 08             	push   0x8(%ebp)
+ 409:	68 c0 0f 00 00       	push   $0xfc0
+ 40e:	6a 01                	push   $0x1
+ 410:	e8 4b 06 00 00       	call   a60 <printf>
+  exit();
+ 415:	e8 a9 03 00 00       	call   7c3 <exit>
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <locker>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 18             	sub    $0x18,%esp
+  pid = fork();
+ 426:	e8 90 03 00 00       	call   7bb <fork>
+  if(pid < 0)
+ 42b:	85 c0                	test   %eax,%eax
+ 42d:	78 6e                	js     49d <locker+0x7d>
+  if(pid == 0){
+ 42f:	74 07                	je     438 <locker+0x18>
+}
+ 431:	c9                   	leave
+ 432:	c3                   	ret
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+    if(dllock(DL_LOCK, first) < 0)
+ 438:	83 ec 08             	sub    $0x8,%esp
+ 43b:	ff 75 08             	push   0x8(%ebp)
+ 43e:	6a 01                	push   $0x1
+ 440:	e8 26 05 00 00       	call   96b <dllock>
+ 445:	83 c4 10             	add    $0x10,%esp
+ 448:	85 c0                	test   %eax,%eax
+ 44a:	78 44                	js     490 <locker+0x70>
+    write(ready[1], "r", 1);
+ 44c:	83 ec 04             	sub    $0x4,%esp
+ 44f:	6a 01                	push   $0x1
+ 451:	68 e3 0f 00 00       	push   $0xfe3
+ 456:	ff 35 ac 15 00 00    	push   0x15ac
+ 45c:	e8 82 03 00 00       	call   7e3 <write>
+    read(go[0], &c, 1);
+ 461:	83 c4 0c             	add    $0xc,%esp
+ 464:	8d 45 f7             	lea    -0x9(%ebp),%eax
+ 467:	6a 01                	push   $0x1
+ 469:	50                   	push   %eax
+ 46a:	ff 35 a0 15 00 00    	push   0x15a0
+ 470:	e8 66 03 00 00       	call   7db <read>
+    dllock(DL_LOCK, second);  // returns only if killed
+ 475:	58                   	pop    %eax
+ 476:	5a                   	pop    %edx
+ 477:	ff 75 0c             	push   0xc(%ebp)
+ 47a:	6a 01                	push   $0x1
+ 47c:	e8 ea 04 00 00       	call   96b <dllock>
+    exit();
+ 481:	e8 3d 03 00 00       	call   7c3 <exit>
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+      fail("first lock");
+ 490:	83 ec 0c             	sub    $0xc,%esp
+ 493:	68 d8 0f 00 00       	push   $0xfd8
+ 498:	e8 63 ff ff ff       	call   400 <fail>
+    fail("fork");
+ 49d:	83 ec 0c             	sub    $0xc,%esp
+ 4a0:	68 d3 0f 00 00       	push   $0xfd3
+ 4a5:	e8 56 ff ff ff       	call   400 <fail>
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004b0 <hascycle>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 18             	sub    $0x18,%esp
+  for(i = 0; i < info.found; i++){
+ 4b9:	a1 80 18 00 00       	mov    0x1880,%eax
+ 4be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	0f 8e a1 00 00 00    	jle    56a <hascycle+0xba>
+ 4c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  off = 0;
+ 4cf:	31 ff                	xor    %edi,%edi
+  for(i = 0; i < info.found; i++){
+ 4d1:	89 fa                	mov    %edi,%edx
+ 4d3:	8d 04 b0             	lea    (%eax,%esi,4),%eax
+ 4d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 4d9:	31 c0                	xor    %eax,%eax
+ 4db:	eb 0f                	jmp    4ec <hascycle+0x3c>
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4e0:	8b 7d ec             	mov    -0x14(%ebp),%edi
+ 4e3:	83 c0 01             	add    $0x1,%eax
+    off += info.cycle_len[i];
+ 4e6:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < info.found; i++){
+ 4e8:	39 f8                	cmp    %edi,%eax
+ 4ea:	74 7e                	je     56a <hascycle+0xba>
+    if(info.cycle_len[i] == n){
+ 4ec:	8b 0c 85 88 19 00 00 	mov    0x1988(,%eax,4),%ecx
+ 4f3:	3b 4d 0c             	cmp    0xc(%ebp),%ecx
+ 4f6:	75 e8                	jne    4e0 <hascycle+0x30>
+      for(j = 0; j < n; j++)
+ 4f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4fb:	85 db                	test   %ebx,%ebx
+ 4fd:	7e 75                	jle    574 <hascycle+0xc4>
+ 4ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 502:	8d 34 95 80 18 00 00 	lea    0x1880(,%edx,4),%esi
+ 509:	8b 7d 08             	mov    0x8(%ebp),%edi
+      m = 0;
+ 50c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 50f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 512:	89 75 e8             	mov    %esi,-0x18(%ebp)
+ 515:	01 d3                	add    %edx,%ebx
+ 517:	31 f6                	xor    %esi,%esi
+ 519:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 51c:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+ 51f:	8d 1c 9d 80 18 00 00 	lea    0x1880(,%ebx,4),%ebx
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+          if(info.pids_in_cycle[off + k] == pids[j])
+ 530:	8b 17                	mov    (%edi),%edx
+ 532:	89 c8                	mov    %ecx,%eax
+ 534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 538:	3b 50 08             	cmp    0x8(%eax),%edx
+ 53b:	75 03                	jne    540 <hascycle+0x90>
+            m++;
+ 53d:	83 c6 01             	add    $0x1,%esi
+        for(k = 0; k < n; k++)
+ 540:	83 c0 04             	add    $0x4,%eax
+ 543:	39 c3                	cmp    %eax,%ebx
+ 545:	75 f1                	jne    538 <hascycle+0x88>
+      for(j = 0; j < n; j++)
+ 547:	83 c7 04             	add    $0x4,%edi
+ 54a:	39 7d f0             	cmp    %edi,-0x10(%ebp)
+ 54d:	75 e1                	jne    530 <hascycle+0x80>
+ 54f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 552:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 555:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      if(m == n)
+ 558:	39 75 0c             	cmp    %esi,0xc(%ebp)
+ 55b:	75 83                	jne    4e0 <hascycle+0x30>
+}
+ 55d:	83 c4 18             	add    $0x18,%esp
+        return 1;
+ 560:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 565:	5b                   	pop    %ebx
+ 566:	5e                   	pop    %esi
+ 567:	5f                   	pop    %edi
+ 568:	5d                   	pop    %ebp
+ 569:	c3                   	ret
+ 56a:	83 c4 18             	add    $0x18,%esp
+  return 0;
+ 56d:	31 c0                	xor    %eax,%eax
+}
+ 56f:	5b                   	pop    %ebx
+ 570:	5e                   	pop    %esi
+ 571:	5f                   	pop    %edi
+ 572:	5d                   	pop    %ebp
+ 573:	c3                   	ret
+      m = 0;
+ 574:	31 f6                	xor    %esi,%esi
+ 576:	eb e0                	jmp    558 <hascycle+0xa8>
+ 578:	66 90                	xchg   %ax,%ax
+ 57a:	66 90                	xchg   %ax,%ax
+ 57c:	66 90                	xchg   %ax,%ax
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 580:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 581:	31 c0                	xor    %eax,%eax
+{
+ 583:	89 e5                	mov    %esp,%ebp
+ 585:	53                   	push   %ebx
+ 586:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 589:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 590:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 594:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 597:	83 c0 01             	add    $0x1,%eax
+ 59a:	84 d2                	test   %dl,%dl
+ 59c:	75 f2                	jne    590 <strcpy+0x10>
+    ;
+  return os;
+}
+ 59e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a1:	89 c8                	mov    %ecx,%eax
+ 5a3:	c9                   	leave
+ 5a4:	c3                   	ret
+ 5a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	53                   	push   %ebx
+ 5b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 5ba:	0f b6 02             	movzbl (%edx),%eax
+ 5bd:	84 c0                	test   %al,%al
+ 5bf:	75 17                	jne    5d8 <strcmp+0x28>
+ 5c1:	eb 3a                	jmp    5fd <strcmp+0x4d>
+ 5c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5c7:	90                   	nop
+ 5c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5cc:	83 c2 01             	add    $0x1,%edx
+ 5cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5d2:	84 c0                	test   %al,%al
+ 5d4:	74 1a                	je     5f0 <strcmp+0x40>
+    p++, q++;
+ 5d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5db:	38 c3                	cmp    %al,%bl
+ 5dd:	74 e9                	je     5c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5df:	29 d8                	sub    %ebx,%eax
+}
+ 5e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5e4:	c9                   	leave
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5f4:	31 c0                	xor    %eax,%eax
+ 5f6:	29 d8                	sub    %ebx,%eax
+}
+ 5f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5fb:	c9                   	leave
+ 5fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 600:	31 c0                	xor    %eax,%eax
+ 602:	eb db                	jmp    5df <strcmp+0x2f>
+ 604:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+
+00000610 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 616:	80 3a 00             	cmpb   $0x0,(%edx)
+ 619:	74 15                	je     630 <strlen+0x20>
+ 61b:	31 c0                	xor    %eax,%eax
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+ 620:	83 c0 01             	add    $0x1,%eax
+ 623:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 627:	89 c1                	mov    %eax,%ecx
+ 629:	75 f5                	jne    620 <strlen+0x10>
+    ;
+  return n;
+}
+ 62b:	89 c8                	mov    %ecx,%eax
+ 62d:	5d                   	pop    %ebp
+ 62e:	c3                   	ret
+ 62f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 630:	31 c9                	xor    %ecx,%ecx
+}
+ 632:	5d                   	pop    %ebp
+ 633:	89 c8                	mov    %ecx,%eax
+ 635:	c3                   	ret
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000640 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 647:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 64a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64d:	89 d7                	mov    %edx,%edi
+ 64f:	fc                   	cld
+ 650:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 652:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 655:	89 d0                	mov    %edx,%eax
+ 657:	c9                   	leave
+ 658:	c3                   	ret
+ 659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	8b 45 08             	mov    0x8(%ebp),%eax
+ 666:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 66a:	0f b6 10             	movzbl (%eax),%edx
+ 66d:	84 d2                	test   %dl,%dl
+ 66f:	75 12                	jne    683 <strchr+0x23>
+ 671:	eb 1d                	jmp    690 <strchr+0x30>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 67c:	83 c0 01             	add    $0x1,%eax
+ 67f:	84 d2                	test   %dl,%dl
+ 681:	74 0d                	je     690 <strchr+0x30>
+    if(*s == c)
+ 683:	38 d1                	cmp    %dl,%cl
+ 685:	75 f1                	jne    678 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 687:	5d                   	pop    %ebp
+ 688:	c3                   	ret
+ 689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 690:	31 c0                	xor    %eax,%eax
+}
+ 692:	5d                   	pop    %ebp
+ 693:	c3                   	ret
+ 694:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+
+000006a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 6a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 6a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 6a9:	31 db                	xor    %ebx,%ebx
+{
+ 6ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 6ae:	eb 27                	jmp    6d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	6a 01                	push   $0x1
+ 6b5:	56                   	push   %esi
+ 6b6:	6a 00                	push   $0x0
+ 6b8:	e8 1e 01 00 00       	call   7db <read>
+    if(cc < 1)
+ 6bd:	83 c4 10             	add    $0x10,%esp
+ 6c0:	85 c0                	test   %eax,%eax
+ 6c2:	7e 1d                	jle    6e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 6c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6cf:	3c 0a                	cmp    $0xa,%al
+ 6d1:	74 10                	je     6e3 <gets+0x43>
+ 6d3:	3c 0d                	cmp    $0xd,%al
+ 6d5:	74 0c                	je     6e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 6d7:	89 df                	mov    %ebx,%edi
+ 6d9:	83 c3 01             	add    $0x1,%ebx
+ 6dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6df:	7c cf                	jl     6b0 <gets+0x10>
+ 6e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ed:	5b                   	pop    %ebx
+ 6ee:	5e                   	pop    %esi
+ 6ef:	5f                   	pop    %edi
+ 6f0:	5d                   	pop    %ebp
+ 6f1:	c3                   	ret
+ 6f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	56                   	push   %esi
+ 704:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 705:	83 ec 08             	sub    $0x8,%esp
+ 708:	6a 00                	push   $0x0
+ 70a:	ff 75 08             	push   0x8(%ebp)
+ 70d:	e8 f1 00 00 00       	call   803 <open>
+  if(fd < 0)
+ 712:	83 c4 10             	add    $0x10,%esp
+ 715:	85 c0                	test   %eax,%eax
+ 717:	78 27                	js     740 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 719:	83 ec 08             	sub    $0x8,%esp
+ 71c:	ff 75 0c             	push   0xc(%ebp)
+ 71f:	89 c3                	mov    %eax,%ebx
+ 721:	50                   	push   %eax
+ 722:	e8 f4 00 00 00       	call   81b <fstat>
+  close(fd);
+ 727:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 72a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 72c:	e8 ba 00 00 00       	call   7eb <close>
+  return r;
+ 731:	83 c4 10             	add    $0x10,%esp
+}
+ 734:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 737:	89 f0                	mov    %esi,%eax
+ 739:	5b                   	pop    %ebx
+ 73a:	5e                   	pop    %esi
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 740:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 745:	eb ed                	jmp    734 <stat+0x34>
+ 747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	53                   	push   %ebx
+ 754:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 757:	0f be 02             	movsbl (%edx),%eax
+ 75a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 75d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 760:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 765:	77 1e                	ja     785 <atoi+0x35>
+ 767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 770:	83 c2 01             	add    $0x1,%edx
+ 773:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 776:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 77a:	0f be 02             	movsbl (%edx),%eax
+ 77d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 780:	80 fb 09             	cmp    $0x9,%bl
+ 783:	76 eb                	jbe    770 <atoi+0x20>
+  return n;
+}
+ 785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 788:	89 c8                	mov    %ecx,%eax
+ 78a:	c9                   	leave
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	8b 45 10             	mov    0x10(%ebp),%eax
+ 798:	8b 55 08             	mov    0x8(%ebp),%edx
+ 79b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 79e:	85 c0                	test   %eax,%eax
+ 7a0:	7e 13                	jle    7b5 <memmove+0x25>
+ 7a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 7a4:	89 d7                	mov    %edx,%edi
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 7b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 7b1:	39 f8                	cmp    %edi,%eax
+ 7b3:	75 fb                	jne    7b0 <memmove+0x20>
+  return vdst;
+}
+ 7b5:	5e                   	pop    %esi
+ 7b6:	89 d0                	mov    %edx,%eax
+ 7b8:	5f                   	pop    %edi
+ 7b9:	5d                   	pop    %ebp
+ 7ba:	c3                   	ret
+
+000007bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <exit>:
+SYSCALL(exit)
+ 7c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <wait>:
+SYSCALL(wait)
+ 7cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <pipe>:
+SYSCALL(pipe)
+ 7d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <read>:
+SYSCALL(read)
+ 7db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <write>:
+SYSCALL(write)
+ 7e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <close>:
+SYSCALL(close)
+ 7eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <kill>:
+SYSCALL(kill)
+ 7f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <exec>:
+SYSCALL(exec)
+ 7fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <open>:
+SYSCALL(open)
+ 803:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <mknod>:
+SYSCALL(mknod)
+ 80b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <unlink>:
+SYSCALL(unlink)
+ 813:	b8 12 00 00 00       	mov    $0x12,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <fstat>:
+SYSCALL(fstat)
+ 81b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <link>:
+SYSCALL(link)
+ 823:	b8 13 00 00 00       	mov    $0x13,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <mkdir>:
+SYSCALL(mkdir)
+ 82b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <chdir>:
+SYSCALL(chdir)
+ 833:	b8 09 00 00 00       	mov    $0x9,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <dup>:
+SYSCALL(dup)
+ 83b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <getpid>:
+SYSCALL(getpid)
+ 843:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <sbrk>:
+SYSCALL(sbrk)
+ 84b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <sleep>:
+SYSCALL(sleep)
+ 853:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <uptime>:
+SYSCALL(uptime)
+ 85b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 863:	b8 16 00 00 00       	mov    $0x16,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 86b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 873:	b8 18 00 00 00       	mov    $0x18,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 87b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 883:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 88b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 893:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <setpriority>:
+SYSCALL(setpriority)
+ 89b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 8a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <getcpustats>:
+SYSCALL(getcpustats)
+ 8ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <setscheduler>:
+SYSCALL(setscheduler)
+ 8b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 8bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <getscheduler>:
+SYSCALL(getscheduler)
+ 8c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+000008cb <splice>:
+SYSCALL(splice)
+ 8cb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <readv>:
+SYSCALL(readv)
+ 8d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <writev>:
+SYSCALL(writev)
+ 8db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+000008e3 <pread>:
+SYSCALL(pread)
+ 8e3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+000008eb <pwrite>:
+SYSCALL(pwrite)
+ 8eb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+000008f3 <getlogstat>:
+SYSCALL(getlogstat)
+ 8f3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <mount>:
+SYSCALL(mount)
+ 8fb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <umount>:
+SYSCALL(umount)
+ 903:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+0000090b <mmap>:
+SYSCALL(mmap)
+ 90b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 910:	cd 40                	int    $0x40
+ 912:	c3                   	ret
+
+00000913 <munmap>:
+SYSCALL(munmap)
+ 913:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <membench>:
+SYSCALL(membench)
+ 91b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+00000923 <getlockstat>:
+SYSCALL(getlockstat)
+ 923:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <lockbench>:
+SYSCALL(lockbench)
+ 92b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <prof>:
+SYSCALL(prof)
+ 933:	b8 30 00 00 00       	mov    $0x30,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <tracectl>:
+SYSCALL(tracectl)
+ 93b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <traceread>:
+SYSCALL(traceread)
+ 943:	b8 32 00 00 00       	mov    $0x32,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <getsysstat>:
+SYSCALL(getsysstat)
+ 94b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 953:	b8 34 00 00 00       	mov    $0x34,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <getschedwait>:
+SYSCALL(getschedwait)
+ 95b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <mlfqread>:
+SYSCALL(mlfqread)
+ 963:	b8 36 00 00 00       	mov    $0x36,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <dllock>:
+SYSCALL(dllock)
+ 96b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 973:	b8 38 00 00 00       	mov    $0x38,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+0000097b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 97b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <clone>:
+SYSCALL(clone)
+ 983:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <join>:
+SYSCALL(join)
+ 98b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+00000993 <futex>:
+SYSCALL(futex)
+ 993:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+0000099b <shmat>:
+SYSCALL(shmat)
+ 99b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <shmdt>:
+SYSCALL(shmdt)
+ 9a3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <poll>:
+SYSCALL(poll)
+ 9ab:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+ 9b3:	66 90                	xchg   %ax,%ax
+ 9b5:	66 90                	xchg   %ax,%ax
+ 9b7:	66 90                	xchg   %ax,%ax
+ 9b9:	66 90                	xchg   %ax,%ax
+ 9bb:	66 90                	xchg   %ax,%ax
+ 9bd:	66 90                	xchg   %ax,%ax
+ 9bf:	90                   	nop
+
+000009c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9c8:	89 d1                	mov    %edx,%ecx
+{
+ 9ca:	83 ec 3c             	sub    $0x3c,%esp
+ 9cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9d0:	85 d2                	test   %edx,%edx
+ 9d2:	0f 89 80 00 00 00    	jns    a58 <printint+0x98>
+ 9d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9dc:	74 7a                	je     a58 <printint+0x98>
+    x = -xx;
+ 9de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9e8:	31 f6                	xor    %esi,%esi
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9f0:	89 c8                	mov    %ecx,%eax
+ 9f2:	31 d2                	xor    %edx,%edx
+ 9f4:	89 f7                	mov    %esi,%edi
+ 9f6:	f7 f3                	div    %ebx
+ 9f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9fb:	0f b6 92 34 11 00 00 	movzbl 0x1134(%edx),%edx
+ a02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a06:	89 ca                	mov    %ecx,%edx
+ a08:	89 c1                	mov    %eax,%ecx
+ a0a:	39 da                	cmp    %ebx,%edx
+ a0c:	73 e2                	jae    9f0 <printint+0x30>
+  if(neg)
+ a0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a11:	85 c0                	test   %eax,%eax
+ a13:	74 07                	je     a1c <printint+0x5c>
+    buf[i++] = '-';
+ a15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a1a:	89 f7                	mov    %esi,%edi
+ a1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a1f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a22:	01 df                	add    %ebx,%edi
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a28:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a31:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a34:	6a 01                	push   $0x1
+ a36:	50                   	push   %eax
+ a37:	56                   	push   %esi
+ a38:	e8 a6 fd ff ff       	call   7e3 <write>
+  while(--i >= 0)
+ a3d:	89 f8                	mov    %edi,%eax
+ a3f:	83 c4 10             	add    $0x10,%esp
+ a42:	83 ef 01             	sub    $0x1,%edi
+ a45:	39 d8                	cmp    %ebx,%eax
+ a47:	75 df                	jne    a28 <printint+0x68>
+}
+ a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4c:	5b                   	pop    %ebx
+ a4d:	5e                   	pop    %esi
+ a4e:	5f                   	pop    %edi
+ a4f:	5d                   	pop    %ebp
+ a50:	c3                   	ret
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a58:	31 c0                	xor    %eax,%eax
+ a5a:	eb 89                	jmp    9e5 <printint+0x25>
+ a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a6f:	0f b6 1e             	movzbl (%esi),%ebx
+ a72:	83 c6 01             	add    $0x1,%esi
+ a75:	84 db                	test   %bl,%bl
+ a77:	74 67                	je     ae0 <printf+0x80>
+ a79:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a7c:	31 d2                	xor    %edx,%edx
+ a7e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a81:	eb 34                	jmp    ab7 <printf+0x57>
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+ a88:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a8b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a90:	83 f8 25             	cmp    $0x25,%eax
+ a93:	74 18                	je     aad <printf+0x4d>
+  write(fd, &c, 1);
+ a95:	83 ec 04             	sub    $0x4,%esp
+ a98:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a9b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a9e:	6a 01                	push   $0x1
+ aa0:	50                   	push   %eax
+ aa1:	57                   	push   %edi
+ aa2:	e8 3c fd ff ff       	call   7e3 <write>
+ aa7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aaa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ aad:	0f b6 1e             	movzbl (%esi),%ebx
+ ab0:	83 c6 01             	add    $0x1,%esi
+ ab3:	84 db                	test   %bl,%bl
+ ab5:	74 29                	je     ae0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ab7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aba:	85 d2                	test   %edx,%edx
+ abc:	74 ca                	je     a88 <printf+0x28>
+      }
+    } else if(state == '%'){
+ abe:	83 fa 25             	cmp    $0x25,%edx
+ ac1:	75 ea                	jne    aad <printf+0x4d>
+      if(c == 'd'){
+ ac3:	83 f8 25             	cmp    $0x25,%eax
+ ac6:	0f 84 24 01 00 00    	je     bf0 <printf+0x190>
+ acc:	83 e8 63             	sub    $0x63,%eax
+ acf:	83 f8 15             	cmp    $0x15,%eax
+ ad2:	77 1c                	ja     af0 <printf+0x90>
+ ad4:	ff 24 85 dc 10 00 00 	jmp    *0x10dc(,%eax,4)
+ adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae3:	5b                   	pop    %ebx
+ ae4:	5e                   	pop    %esi
+ ae5:	5f                   	pop    %edi
+ ae6:	5d                   	pop    %ebp
+ ae7:	c3                   	ret
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+  write(fd, &c, 1);
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ afa:	6a 01                	push   $0x1
+ afc:	52                   	push   %edx
+ afd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b00:	57                   	push   %edi
+ b01:	e8 dd fc ff ff       	call   7e3 <write>
+ b06:	83 c4 0c             	add    $0xc,%esp
+ b09:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0c:	6a 01                	push   $0x1
+ b0e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b11:	52                   	push   %edx
+ b12:	57                   	push   %edi
+ b13:	e8 cb fc ff ff       	call   7e3 <write>
+        putc(fd, c);
+ b18:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b1b:	31 d2                	xor    %edx,%edx
+ b1d:	eb 8e                	jmp    aad <printf+0x4d>
+ b1f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b23:	83 ec 0c             	sub    $0xc,%esp
+ b26:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b2b:	8b 13                	mov    (%ebx),%edx
+ b2d:	6a 00                	push   $0x0
+ b2f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b31:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b34:	e8 87 fe ff ff       	call   9c0 <printint>
+        ap++;
+ b39:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b3f:	31 d2                	xor    %edx,%edx
+ b41:	e9 67 ff ff ff       	jmp    aad <printf+0x4d>
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b55:	83 c0 04             	add    $0x4,%eax
+ b58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b5b:	85 db                	test   %ebx,%ebx
+ b5d:	0f 84 9d 00 00 00    	je     c00 <printf+0x1a0>
+        while(*s != 0){
+ b63:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b66:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b68:	84 c0                	test   %al,%al
+ b6a:	0f 84 3d ff ff ff    	je     aad <printf+0x4d>
+ b70:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b73:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b76:	89 de                	mov    %ebx,%esi
+ b78:	89 d3                	mov    %edx,%ebx
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b80:	83 ec 04             	sub    $0x4,%esp
+ b83:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b86:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b89:	6a 01                	push   $0x1
+ b8b:	53                   	push   %ebx
+ b8c:	57                   	push   %edi
+ b8d:	e8 51 fc ff ff       	call   7e3 <write>
+        while(*s != 0){
+ b92:	0f b6 06             	movzbl (%esi),%eax
+ b95:	83 c4 10             	add    $0x10,%esp
+ b98:	84 c0                	test   %al,%al
+ b9a:	75 e4                	jne    b80 <printf+0x120>
+      state = 0;
+ b9c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b9f:	31 d2                	xor    %edx,%edx
+ ba1:	e9 07 ff ff ff       	jmp    aad <printf+0x4d>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bbb:	8b 13                	mov    (%ebx),%edx
+ bbd:	6a 01                	push   $0x1
+ bbf:	e9 6b ff ff ff       	jmp    b2f <printf+0xcf>
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bc8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bcb:	83 ec 04             	sub    $0x4,%esp
+ bce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bd1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bd3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bd6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bd9:	6a 01                	push   $0x1
+ bdb:	52                   	push   %edx
+ bdc:	57                   	push   %edi
+ bdd:	e8 01 fc ff ff       	call   7e3 <write>
+        ap++;
+ be2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ be5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ be8:	31 d2                	xor    %edx,%edx
+ bea:	e9 be fe ff ff       	jmp    aad <printf+0x4d>
+ bef:	90                   	nop
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bf6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bf9:	6a 01                	push   $0x1
+ bfb:	e9 11 ff ff ff       	jmp    b11 <printf+0xb1>
+ c00:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c05:	bb d2 10 00 00       	mov    $0x10d2,%ebx
+ c0a:	e9 61 ff ff ff       	jmp    b70 <printf+0x110>
+ c0f:	90                   	nop
+
+00000c10 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c13:	a1 f4 1a 00 00       	mov    0x1af4,%eax
+{
+ c18:	89 e5                	mov    %esp,%ebp
+ c1a:	56                   	push   %esi
+ c1b:	53                   	push   %ebx
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c20:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c22:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c24:	39 ca                	cmp    %ecx,%edx
+ c26:	73 30                	jae    c58 <bigfree+0x48>
+ c28:	39 c1                	cmp    %eax,%ecx
+ c2a:	72 04                	jb     c30 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c2c:	39 c2                	cmp    %eax,%edx
+ c2e:	72 f0                	jb     c20 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c30:	8b 59 04             	mov    0x4(%ecx),%ebx
+ c33:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ c36:	39 f0                	cmp    %esi,%eax
+ c38:	74 26                	je     c60 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c3a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c3c:	8b 42 04             	mov    0x4(%edx),%eax
+ c3f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ c42:	39 d9                	cmp    %ebx,%ecx
+ c44:	74 30                	je     c76 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c46:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c48:	5b                   	pop    %ebx
+  freep = p;
+ c49:	89 15 f4 1a 00 00    	mov    %edx,0x1af4
+}
+ c4f:	5e                   	pop    %esi
+ c50:	5d                   	pop    %ebp
+ c51:	c3                   	ret
+ c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c58:	39 c1                	cmp    %eax,%ecx
+ c5a:	72 d0                	jb     c2c <bigfree+0x1c>
+ c5c:	eb c2                	jmp    c20 <bigfree+0x10>
+ c5e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ c60:	03 58 04             	add    0x4(%eax),%ebx
+ c63:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c66:	8b 02                	mov    (%edx),%eax
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ c6c:	8b 42 04             	mov    0x4(%edx),%eax
+ c6f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ c72:	39 d9                	cmp    %ebx,%ecx
+ c74:	75 d0                	jne    c46 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ c76:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ c79:	89 15 f4 1a 00 00    	mov    %edx,0x1af4
+    p->s.size += bp->s.size;
+ c7f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c82:	8b 09                	mov    (%ecx),%ecx
+ c84:	89 0a                	mov    %ecx,(%edx)
+}
+ c86:	5b                   	pop    %ebx
+ c87:	5e                   	pop    %esi
+ c88:	5d                   	pop    %ebp
+ c89:	c3                   	ret
+ c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c90 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	89 c7                	mov    %eax,%edi
+ c96:	56                   	push   %esi
+ c97:	53                   	push   %ebx
+ c98:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ c9b:	a1 f4 1a 00 00       	mov    0x1af4,%eax
+ ca0:	85 c0                	test   %eax,%eax
+ ca2:	0f 84 88 00 00 00    	je     d30 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ caa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ cad:	39 f9                	cmp    %edi,%ecx
+ caf:	73 5f                	jae    d10 <bigalloc+0x80>
+  if(nu < 4096)
+ cb1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cb6:	39 df                	cmp    %ebx,%edi
+ cb8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cbb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cc2:	eb 0d                	jmp    cd1 <bigalloc+0x41>
+ cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ cca:	8b 4a 04             	mov    0x4(%edx),%ecx
+ ccd:	39 f9                	cmp    %edi,%ecx
+ ccf:	73 3f                	jae    d10 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ cd1:	89 d0                	mov    %edx,%eax
+ cd3:	39 15 f4 1a 00 00    	cmp    %edx,0x1af4
+ cd9:	75 ed                	jne    cc8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ cdb:	83 ec 0c             	sub    $0xc,%esp
+ cde:	56                   	push   %esi
+ cdf:	e8 67 fb ff ff       	call   84b <sbrk>
+  if(p == (char*)-1)
+ ce4:	83 c4 10             	add    $0x10,%esp
+ ce7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cea:	74 11                	je     cfd <bigalloc+0x6d>
+  hp->s.size = nu;
+ cec:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ cef:	e8 1c ff ff ff       	call   c10 <bigfree>
+  return freep;
+ cf4:	a1 f4 1a 00 00       	mov    0x1af4,%eax
+      if((p = morecore(nunits)) == 0)
+ cf9:	85 c0                	test   %eax,%eax
+ cfb:	75 cb                	jne    cc8 <bigalloc+0x38>
+        return 0;
+  }
+}
+ cfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d00:	31 d2                	xor    %edx,%edx
+}
+ d02:	5b                   	pop    %ebx
+ d03:	89 d0                	mov    %edx,%eax
+ d05:	5e                   	pop    %esi
+ d06:	5f                   	pop    %edi
+ d07:	5d                   	pop    %ebp
+ d08:	c3                   	ret
+ d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ d10:	39 cf                	cmp    %ecx,%edi
+ d12:	74 4c                	je     d60 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ d14:	29 f9                	sub    %edi,%ecx
+ d16:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ d19:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ d1c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ d1f:	a3 f4 1a 00 00       	mov    %eax,0x1af4
+}
+ d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d27:	89 d0                	mov    %edx,%eax
+ d29:	5b                   	pop    %ebx
+ d2a:	5e                   	pop    %esi
+ d2b:	5f                   	pop    %edi
+ d2c:	5d                   	pop    %ebp
+ d2d:	c3                   	ret
+ d2e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ d30:	c7 05 f4 1a 00 00 f8 	movl   $0x1af8,0x1af4
+ d37:	1a 00 00 
+    base.s.size = 0;
+ d3a:	ba f8 1a 00 00       	mov    $0x1af8,%edx
+    base.s.ptr = freep = prevp = &base;
+ d3f:	c7 05 f8 1a 00 00 f8 	movl   $0x1af8,0x1af8
+ d46:	1a 00 00 
+    base.s.size = 0;
+ d49:	c7 05 fc 1a 00 00 00 	movl   $0x0,0x1afc
+ d50:	00 00 00 
+    if(p->s.size >= nunits){
+ d53:	e9 59 ff ff ff       	jmp    cb1 <bigalloc+0x21>
+ d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d60:	8b 0a                	mov    (%edx),%ecx
+ d62:	89 08                	mov    %ecx,(%eax)
+ d64:	eb b9                	jmp    d1f <bigalloc+0x8f>
+ d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <free>:
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	53                   	push   %ebx
+ d74:	83 ec 04             	sub    $0x4,%esp
+ d77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ d7a:	85 c9                	test   %ecx,%ecx
+ d7c:	74 58                	je     dd6 <free+0x66>
+  bp = (Header*)ap - 1;
+ d7e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ d81:	ba 01 00 00 00       	mov    $0x1,%edx
+ d86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8d:	8d 76 00             	lea    0x0(%esi),%esi
+ d90:	89 d0                	mov    %edx,%eax
+ d92:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+  while(xchg(&locked, 1) != 0)
+ d99:	85 c0                	test   %eax,%eax
+ d9b:	75 f3                	jne    d90 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ d9d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ da0:	83 fa 40             	cmp    $0x40,%edx
+ da3:	77 3b                	ja     de0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ da5:	83 fa 02             	cmp    $0x2,%edx
+ da8:	76 3f                	jbe    de9 <free+0x79>
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ db0:	83 c0 01             	add    $0x1,%eax
+ db3:	39 14 85 60 11 00 00 	cmp    %edx,0x1160(,%eax,4)
+ dba:	72 f4                	jb     db0 <free+0x40>
+    bp->s.ptr = classfree[c];
+ dbc:	8b 14 85 c0 1a 00 00 	mov    0x1ac0(,%eax,4),%edx
+    classfree[c] = bp;
+ dc3:	89 1c 85 c0 1a 00 00 	mov    %ebx,0x1ac0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ dca:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ dcd:	31 c0                	xor    %eax,%eax
+ dcf:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+}
+ dd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ dd9:	c9                   	leave
+ dda:	c3                   	ret
+ ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ddf:	90                   	nop
+    bigfree(bp);
+ de0:	89 d8                	mov    %ebx,%eax
+ de2:	e8 29 fe ff ff       	call   c10 <bigfree>
+ de7:	eb e4                	jmp    dcd <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ de9:	31 c0                	xor    %eax,%eax
+ deb:	eb cf                	jmp    dbc <free+0x4c>
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ df0:	55                   	push   %ebp
+ df1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ df6:	89 e5                	mov    %esp,%ebp
+ df8:	57                   	push   %edi
+ df9:	56                   	push   %esi
+ dfa:	53                   	push   %ebx
+ dfb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+ e01:	8d 50 07             	lea    0x7(%eax),%edx
+ e04:	c1 ea 03             	shr    $0x3,%edx
+ e07:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ e10:	89 c8                	mov    %ecx,%eax
+ e12:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+ e19:	85 c0                	test   %eax,%eax
+ e1b:	75 f3                	jne    e10 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ e1d:	89 c3                	mov    %eax,%ebx
+ e1f:	83 fa 40             	cmp    $0x40,%edx
+ e22:	77 4c                	ja     e70 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ e24:	be 02 00 00 00       	mov    $0x2,%esi
+ e29:	83 fa 02             	cmp    $0x2,%edx
+ e2c:	76 10                	jbe    e3e <malloc+0x4e>
+ e2e:	66 90                	xchg   %ax,%ax
+ e30:	83 c3 01             	add    $0x1,%ebx
+ e33:	8b 34 9d 60 11 00 00 	mov    0x1160(,%ebx,4),%esi
+ e3a:	39 d6                	cmp    %edx,%esi
+ e3c:	72 f2                	jb     e30 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ e3e:	8b 14 9d c0 1a 00 00 	mov    0x1ac0(,%ebx,4),%edx
+ e45:	85 d2                	test   %edx,%edx
+ e47:	74 47                	je     e90 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ e49:	8b 3a                	mov    (%edx),%edi
+ e4b:	89 3c 9d c0 1a 00 00 	mov    %edi,0x1ac0(,%ebx,4)
+ e52:	31 c0                	xor    %eax,%eax
+ e54:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ e5b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ e5e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ e61:	5b                   	pop    %ebx
+ e62:	5e                   	pop    %esi
+ e63:	5f                   	pop    %edi
+ e64:	5d                   	pop    %ebp
+ e65:	c3                   	ret
+ e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ e70:	89 d0                	mov    %edx,%eax
+ e72:	e8 19 fe ff ff       	call   c90 <bigalloc>
+ e77:	89 c2                	mov    %eax,%edx
+ e79:	89 d8                	mov    %ebx,%eax
+ e7b:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+  return p ? (void*)(p + 1) : 0;
+ e82:	85 d2                	test   %edx,%edx
+ e84:	75 d5                	jne    e5b <malloc+0x6b>
+ e86:	31 c0                	xor    %eax,%eax
+}
+ e88:	83 c4 1c             	add    $0x1c,%esp
+ e8b:	5b                   	pop    %ebx
+ e8c:	5e                   	pop    %esi
+ e8d:	5f                   	pop    %edi
+ e8e:	5d                   	pop    %ebp
+ e8f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ e90:	b8 00 02 00 00       	mov    $0x200,%eax
+ e95:	e8 f6 fd ff ff       	call   c90 <bigalloc>
+ e9a:	85 c0                	test   %eax,%eax
+ e9c:	74 44                	je     ee2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e9e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ ea5:	8b 14 9d c0 1a 00 00 	mov    0x1ac0(,%ebx,4),%edx
+ eac:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ eaf:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ eb2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ eb8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ ebb:	39 cf                	cmp    %ecx,%edi
+ ebd:	72 8a                	jb     e49 <malloc+0x59>
+ ebf:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ ec2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ ec5:	8d 76 00             	lea    0x0(%esi),%esi
+ ec8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ eca:	89 70 04             	mov    %esi,0x4(%eax)
+ ecd:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ ecf:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ ed1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ ed3:	01 d8                	add    %ebx,%eax
+ ed5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ ed8:	73 ee                	jae    ec8 <malloc+0xd8>
+ eda:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ edd:	e9 69 ff ff ff       	jmp    e4b <malloc+0x5b>
+ ee2:	f0 87 05 a0 1a 00 00 	lock xchg %eax,0x1aa0
+  return p ? (void*)(p + 1) : 0;
+ ee9:	31 c0                	xor    %eax,%eax
+ eeb:	eb 9b                	jmp    e88 <malloc+0x98>
+ eed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ef0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ ef0:	55                   	push   %ebp
+ ef1:	89 e5                	mov    %esp,%ebp
+ ef3:	56                   	push   %esi
+ ef4:	53                   	push   %ebx
+ ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ef8:	f7 65 0c             	mull   0xc(%ebp)
+ efb:	70 33                	jo     f30 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ efd:	83 ec 0c             	sub    $0xc,%esp
+ f00:	89 c3                	mov    %eax,%ebx
+ f02:	50                   	push   %eax
+ f03:	e8 e8 fe ff ff       	call   df0 <malloc>
+ f08:	83 c4 10             	add    $0x10,%esp
+ f0b:	89 c6                	mov    %eax,%esi
+ f0d:	85 c0                	test   %eax,%eax
+ f0f:	74 1f                	je     f30 <calloc+0x40>
+    memset(p, 0, n);
+ f11:	83 ec 04             	sub    $0x4,%esp
+ f14:	53                   	push   %ebx
+ f15:	6a 00                	push   $0x0
+ f17:	50                   	push   %eax
+ f18:	e8 23 f7 ff ff       	call   640 <memset>
+ f1d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ f20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ f23:	89 f0                	mov    %esi,%eax
+ f25:	5b                   	pop    %ebx
+ f26:	5e                   	pop    %esi
+ f27:	5d                   	pop    %ebp
+ f28:	c3                   	ret
+ f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ f33:	31 f6                	xor    %esi,%esi
+}
+ f35:	89 f0                	mov    %esi,%eax
+ f37:	5b                   	pop    %ebx
+ f38:	5e                   	pop    %esi
+ f39:	5d                   	pop    %ebp
+ f3a:	c3                   	ret
+ f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ f3f:	90                   	nop
+
+00000f40 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ f40:	55                   	push   %ebp
+ f41:	89 e5                	mov    %esp,%ebp
+ f43:	57                   	push   %edi
+ f44:	56                   	push   %esi
+ f45:	53                   	push   %ebx
+ f46:	83 ec 0c             	sub    $0xc,%esp
+ f49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ f4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ f4f:	85 db                	test   %ebx,%ebx
+ f51:	74 55                	je     fa8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ f53:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ f56:	89 de                	mov    %ebx,%esi
+ f58:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ f5f:	39 c7                	cmp    %eax,%edi
+ f61:	72 0d                	jb     f70 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ f63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f66:	89 f0                	mov    %esi,%eax
+ f68:	5b                   	pop    %ebx
+ f69:	5e                   	pop    %esi
+ f6a:	5f                   	pop    %edi
+ f6b:	5d                   	pop    %ebp
+ f6c:	c3                   	ret
+ f6d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ f70:	83 ec 0c             	sub    $0xc,%esp
+ f73:	50                   	push   %eax
+ f74:	e8 77 fe ff ff       	call   df0 <malloc>
+ f79:	83 c4 10             	add    $0x10,%esp
+ f7c:	89 c6                	mov    %eax,%esi
+ f7e:	85 c0                	test   %eax,%eax
+ f80:	74 e1                	je     f63 <realloc+0x23>
+  memmove(p, ap, have);
+ f82:	83 ec 04             	sub    $0x4,%esp
+ f85:	57                   	push   %edi
+ f86:	53                   	push   %ebx
+ f87:	50                   	push   %eax
+ f88:	e8 03 f8 ff ff       	call   790 <memmove>
+  free(ap);
+ f8d:	89 1c 24             	mov    %ebx,(%esp)
+ f90:	e8 db fd ff ff       	call   d70 <free>
+  return p;
+ f95:	83 c4 10             	add    $0x10,%esp
+}
+ f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f9b:	89 f0                	mov    %esi,%eax
+ f9d:	5b                   	pop    %ebx
+ f9e:	5e                   	pop    %esi
+ f9f:	5f                   	pop    %edi
+ fa0:	5d                   	pop    %ebp
+ fa1:	c3                   	ret
+ fa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ fa8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ fae:	5b                   	pop    %ebx
+ faf:	5e                   	pop    %esi
+ fb0:	5f                   	pop    %edi
+ fb1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ fb2:	e9 39 fe ff ff       	jmp    df0 <malloc>
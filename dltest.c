@@ -1,10 +1,152 @@
+// Tests for deadlock detection. Builds real deadlocks out of
+// the kernel's test sleep-locks (dllock), checks that every
+// cycle is found at once, then kills the processes involved.
+// Finally checks that the watchdog breaks a deadlock itself.
+
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "procinfo.h"
+
+struct deadlockinfo info;
+struct deadlogent log[16];
+int ready[2], go[2];
+
+void
+fail(char *msg)
+{
+  printf(1, "dltest: %s failed\n", msg);
+  exit();
+}
+
+// Fork a process that takes lock first, reports that it has,
+// waits for the go-ahead, then tries to take lock second.
+int
+locker(int first, int second)
+{
+  int pid;
+  char c;
 
-int main(void){
-    printf(1, "Running deadlock detection (stub)...\n");
-    int result = detect_deadlock();
-    printf(1, "Deadlock detected: %s\n", result ? "YES" : "NO");
+  pid = fork();
+  if(pid < 0)
+    fail("fork");
+  if(pid == 0){
+    if(dllock(DL_LOCK, first) < 0)
+      fail("first lock");
+    write(ready[1], "r", 1);
+    read(go[0], &c, 1);
+    dllock(DL_LOCK, second);  // returns only if killed
     exit();
+  }
+  return pid;
+}
+
+// Does cycle i of info hold exactly the n pids in pids?
+int
+hascycle(int *pids, int n)
+{
+  int i, j, k, m, off;
+
+  off = 0;
+  for(i = 0; i < info.found; i++){
+    if(info.cycle_len[i] == n){
+      m = 0;
+      for(j = 0; j < n; j++)
+        for(k = 0; k < n; k++)
+          if(info.pids_in_cycle[off + k] == pids[j])
+            m++;
+      if(m == n)
+        return 1;
+    }
+    off += info.cycle_len[i];
+  }
+  return 0;
+}
+
+int
+main(void)
+{
+  int pids[6], i, n;
+  char c;
+
+  printf(1, "dltest starting\n");
+  if(pipe(ready) < 0 || pipe(go) < 0)
+    fail("pipe");
+
+  if(detect_deadlock() != 0)
+    fail("deadlock before test");
+
+  // Two processes waiting for each other, three processes in
+  // a ring, and one process waiting for a lock it holds.
+  pids[0] = locker(0, 1);
+  pids[1] = locker(1, 0);
+  pids[2] = locker(2, 3);
+  pids[3] = locker(3, 4);
+  pids[4] = locker(4, 2);
+  pids[5] = locker(5, 5);
+  for(i = 0; i < 6; i++)
+    if(read(ready[0], &c, 1) != 1)
+      fail("ready");
+  for(i = 0; i < 6; i++)
+    write(go[1], "g", 1);
+
+  // Wait for all of them to block.
+  for(i = 0; i < 100; i++){
+    if((n = detect_deadlock()) == 3)
+      break;
+    sleep(1);
+  }
+  if(n != 3)
+    fail("detect_deadlock");
+  if(getdeadlockinfo(&info) < 0 || info.found != 3)
+    fail("getdeadlockinfo");
+  if(!hascycle(pids, 2) || !hascycle(pids + 2, 3) || !hascycle(pids + 5, 1))
+    fail("cycle members");
+  printf(1, "found %d cycles\n", info.found);
+
+  // Killing the processes breaks the deadlocks.
+  for(i = 0; i < 6; i++)
+    kill(pids[i]);
+  for(i = 0; i < 6; i++)
+    wait();
+  if(detect_deadlock() != 0)
+    fail("deadlock after kill");
+
+  // The locks were released when their holders exited.
+  for(i = 0; i < NDLLOCK; i++)
+    if(dllock(DL_LOCK, i) < 0 || dllock(DL_UNLOCK, i) < 0)
+      fail("lock after kill");
+  if(dllock(DL_UNLOCK, 0) >= 0)
+    fail("unlock of a free lock");
+
+  // With a victim policy, the watchdog kills one of the two
+  // and the other then gets its lock and exits.
+  while(deadlocklog(log, 16) > 0)
+    ;
+  if(watchdogctl(WD_YOUNGEST, 5) < 0)
+    fail("watchdogctl");
+  pids[0] = locker(0, 1);
+  pids[1] = locker(1, 0);
+  for(i = 0; i < 2; i++)
+    if(read(ready[0], &c, 1) != 1)
+      fail("ready");
+  write(go[1], "gg", 2);
+  for(i = 0; i < 200; i++){
+    if(deadlocklog(log, 16) > 0)
+      break;
+    sleep(1);
+  }
+  watchdogctl(WD_REPORT, WD_INTERVAL);
+  if(i == 200)
+    fail("watchdog");
+  if(log[0].len != 2 || (log[0].victim != pids[0] && log[0].victim != pids[1]))
+    fail("watchdog log");
+  wait();
+  wait();
+  if(detect_deadlock() != 0)
+    fail("deadlock after watchdog");
+  printf(1, "watchdog killed %d\n", log[0].victim);
+
+  printf(1, "dltest ok\n");
+  exit();
 }
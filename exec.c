@@ -19,6 +19,10 @@ exec(char *path, char **argv)
   pde_t *pgdir, *oldpgdir;
   struct proc *curproc = myproc();
 
+  // The other threads would lose their address space.
+  if(threadcount(curproc) > 0)
+    return -1;
+
   begin_op();
 
   if((ip = namei(path)) == 0){
@@ -93,10 +97,15 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
+  // Commit to the user image, first freeing any threads
+  // that exited without being joined.
+  if(execthreads(curproc) < 0)
+    goto bad;
+  vmfree(curproc);
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
+  curproc->npages = PGROUNDUP(sz) / PGSIZE;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
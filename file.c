@@ -5,10 +5,18 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
 #include "fs.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "proc.h"
+#include "buf.h"
 #include "file.h"
+#include "uio.h"
+#include "poll.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 struct devsw devsw[NDEV];
 struct {
@@ -16,10 +24,116 @@ struct {
   struct file file[NFILE];
 } ftable;
 
+// Threads share their leader's descriptor table and cwd, as
+// they share its vmas[]; the leader outlives them (see exit()).
+// fdlock guards every process's table and cwd, so that one
+// thread's close() or chdir() cannot free what another is
+// just taking a reference to. It is taken before ftable.lock.
+static struct spinlock fdlock;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  initlock(&fdlock, "fdtable");
+}
+
+// Return a new reference to the file open as descriptor fd of
+// the current process, or 0. The caller must fileclose() it.
+struct file*
+fdget(int fd)
+{
+  struct proc *p = myproc()->leader;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  acquire(&fdlock);
+  if((f = p->ofile[fd]) != 0)
+    filedup(f);
+  release(&fdlock);
+  return f;
+}
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+int
+fdalloc(struct file *f)
+{
+  struct proc *p = myproc()->leader;
+  int fd;
+
+  acquire(&fdlock);
+  for(fd = 0; fd < NOFILE; fd++){
+    if(p->ofile[fd] == 0){
+      p->ofile[fd] = f;
+      release(&fdlock);
+      return fd;
+    }
+  }
+  release(&fdlock);
+  return -1;
+}
+
+// Remove descriptor fd of the current process and return the
+// file it referred to, whose reference passes to the caller,
+// or return 0 if fd was not open.
+struct file*
+fdfree(int fd)
+{
+  struct proc *p = myproc()->leader;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  acquire(&fdlock);
+  f = p->ofile[fd];
+  p->ofile[fd] = 0;
+  release(&fdlock);
+  return f;
+}
+
+// Give np references to all of the current process's open
+// files and its cwd, for fork().
+void
+fdcopy(struct proc *np)
+{
+  struct proc *p = myproc()->leader;
+  int fd;
+
+  acquire(&fdlock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(p->ofile[fd])
+      np->ofile[fd] = filedup(p->ofile[fd]);
+  np->cwd = idup(p->cwd);
+  release(&fdlock);
+}
+
+// Return a new reference to the current directory.
+struct inode*
+cwdget(void)
+{
+  struct inode *ip;
+
+  acquire(&fdlock);
+  ip = idup(myproc()->leader->cwd);
+  release(&fdlock);
+  return ip;
+}
+
+// Make ip, whose reference passes to the process, the current
+// directory, and return the old one for the caller to iput().
+struct inode*
+cwdset(struct inode *ip)
+{
+  struct proc *p = myproc()->leader;
+  struct inode *old;
+
+  acquire(&fdlock);
+  old = p->cwd;
+  p->cwd = ip;
+  release(&fdlock);
+  return old;
 }
 
 // Allocate a file structure.
@@ -79,6 +193,31 @@ fileclose(struct file *f)
   }
 }
 
+// Return which of POLLIN, POLLOUT, POLLERR and POLLHUP hold for
+// file f. If e is not 0, also queue it to be woken when that may
+// change. Regular files and most devices are always ready.
+int
+filepoll(struct file *f, struct pollent *e)
+{
+  int r, major;
+
+  r = POLLIN|POLLOUT;
+  if(f->type == FD_PIPE)
+    r = pipepoll(f->pipe, e);
+  else if(f->type == FD_INODE){
+    ilock(f->ip);
+    major = f->ip->type == T_DEV ? f->ip->major : -1;
+    iunlock(f->ip);
+    if(major >= 0 && major < NDEV && devsw[major].poll)
+      r = devsw[major].poll(f->ip, e);
+  }
+  if(!f->readable)
+    r &= ~(POLLIN|POLLHUP);
+  if(!f->writable)
+    r &= ~(POLLOUT|POLLERR);
+  return r;
+}
+
 // Get metadata about file f.
 int
 filestat(struct file *f, struct stat *st)
@@ -92,66 +231,321 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
-// Read from file f.
-int
-fileread(struct file *f, char *addr, int n)
+// Read from inode ip at *poff into the buffers in iov, in order,
+// advancing *poff. The inode is locked once for the whole vector.
+// Stops early at end of file.
+static int
+inodereadv(struct inode *ip, struct iovec *iov, int iovcnt, uint *poff)
 {
-  int r;
+  int i, r, tot;
 
+  tot = 0;
+  ilock(ip);
+  for(i = 0; i < iovcnt; i++){
+    if((r = readi(ip, iov[i].iov_base, *poff, iov[i].iov_len)) < 0){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    *poff += r;
+    tot += r;
+    if(r < iov[i].iov_len)
+      break;
+  }
+  iunlock(ip);
+  return tot;
+}
+
+// Largest log reservation one write transaction may take.
+// The rest of the log is left for ordinary operations that
+// run alongside a big write.
+#define MAXWRITEBLOCKS (LOGSIZE-MAXOPBLOCKS)
+
+// Blocks besides data that a write may log: the i-node,
+// the indirect block, and up to two bitmap blocks.
+#define WRITESLOP 4
+
+// Return how many bytes of an n-byte write fit in one log
+// transaction, and set *pnblk to the number of log blocks to
+// reserve with begin_opn() for them. Since bmap() logs a newly
+// allocated block when zeroing it and writei() then logs it again,
+// log absorption means each data block counts only once. An
+// unaligned run of bytes touches at most one more block than
+// an aligned one, so the reservation holds whatever the file
+// offset turns out to be once the inode is locked.
+static int
+writechunk(int n, int *pnblk)
+{
+  int m;
+
+  m = min(n, (MAXWRITEBLOCKS-WRITESLOP-1) * BSIZE);
+  *pnblk = (m + BSIZE-1)/BSIZE + 1 + WRITESLOP;
+  return m;
+}
+
+// Write the buffers in iov, in order, to inode ip at *poff,
+// advancing *poff. Each transaction reserves log space for as
+// much of the remaining data as fits, so a vector of small
+// records costs one begin_opn()/end_opn(), and a big write
+// needs far fewer commits than one per MAXOPBLOCKS.
+static int
+inodewritev(struct inode *ip, struct iovec *iov, int iovcnt, uint *poff)
+{
+  int i, done, tot, left, room, nblk, n1, r;
+
+  left = 0;
+  for(i = 0; i < iovcnt; i++)
+    left += iov[i].iov_len;
+
+  i = done = tot = r = 0;
+  while(tot < left){
+    room = writechunk(left - tot, &nblk);
+    begin_opn(nblk);
+    ilock(ip);
+    for(; room > 0; room -= r){
+      n1 = min(iov[i].iov_len - done, room);
+      if((r = writei(ip, (char*)iov[i].iov_base + done, *poff, n1)) < 0)
+        break;
+      if(r != n1)
+        panic("short filewrite");
+      *poff += r;
+      tot += r;
+      if((done += r) == iov[i].iov_len){
+        i++;
+        done = 0;
+      }
+    }
+    iunlock(ip);
+    end_opn(nblk);
+    if(r < 0)
+      return -1;
+  }
+  return tot;
+}
+
+// Read from file f into the buffers in iov.
+int
+filereadv(struct file *f, struct iovec *iov, int iovcnt)
+{
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
-    iunlock(f->ip);
-    return r;
-  }
+    return pipereadv(f->pipe, iov, iovcnt);
+  if(f->type == FD_INODE)
+    return inodereadv(f->ip, iov, iovcnt, &f->off);
   panic("fileread");
 }
 
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filereadv(f, &iov, 1);
+}
+
+// Read from file f at offset off, leaving f->off alone, so that
+// several readers can share one open file without serializing
+// on its offset.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  struct iovec iov;
+
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return inodereadv(f->ip, &iov, 1, &off);
+}
+
 //PAGEBREAK!
+// Write the buffers in iov to file f.
+int
+filewritev(struct file *f, struct iovec *iov, int iovcnt)
+{
+  int i, tot;
+
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_PIPE){
+    tot = 0;
+    for(i = 0; i < iovcnt; i++){
+      if(pipewrite(f->pipe, iov[i].iov_base, iov[i].iov_len) < 0)
+        return -1;
+      tot += iov[i].iov_len;
+    }
+    return tot;
+  }
+  if(f->type == FD_INODE)
+    return inodewritev(f->ip, iov, iovcnt, &f->off);
+  panic("filewrite");
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
 
-  if(f->writable == 0)
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filewritev(f, &iov, 1);
+}
+
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  struct iovec iov;
+
+  if(f->writable == 0 || f->type != FD_INODE)
     return -1;
-  if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return inodewritev(f->ip, &iov, 1, &off);
+}
+
+//PAGEBREAK!
+// Splice: move data from one file to another inside the kernel.
+//
+// A regular file is read straight out of the buffer cache: each
+// block is copied from bp->data into the destination pipe or file,
+// so the data never crosses into user space and never passes
+// through an intermediate buffer. Other combinations (pipe or
+// device sources, device destinations) fall back to a single
+// kernel bounce page, which still saves the two user copies that
+// a read()/write() loop would do.
+
+// Regular file to pipe.
+static int
+splicetopipe(struct file *in, struct pipe *pp, int n)
+{
+  struct inode *ip = in->ip;
+  struct buf *bp;
+  int tot, m, r;
+
+  for(tot = 0; tot < n; tot += r){
+    // Never sleep on a full pipe while holding a buffer:
+    // the reader might need that same block.
+    if(pipewaitspace(pp) < 0)
+      return tot > 0 ? tot : -1;
+    ilock(ip);
+    if(in->off >= ip->size){
+      iunlock(ip);
+      break;
+    }
+    m = min(n - tot, BSIZE - in->off%BSIZE);
+    m = min(m, ip->size - in->off);
+    bp = ibread(ip, in->off);
+    iunlock(ip);
+    r = pipeput(pp, (char*)bp->data + in->off%BSIZE, m);
+    brelse(bp);
+    if(r < 0)
+      return tot > 0 ? tot : -1;
+    in->off += r;
+  }
+  return tot;
+}
+
+// Regular file to regular file. Each transaction copies as many
+// bytes as filewrite() would put in one transaction.
+static int
+splicetofile(struct file *in, struct file *out, int n)
+{
+  struct inode *src = in->ip, *dst = out->ip;
+  struct inode *first, *second;
+  struct buf *bp;
+  int tot, n1, nblk, m, r, eof;
+
+  // Lock the two inodes in inode-number order so that two
+  // splices running in opposite directions cannot deadlock.
+  first = src->inum < dst->inum ? src : dst;
+  second = src->inum < dst->inum ? dst : src;
+
+  tot = 0;
+  eof = 0;
+  while(tot < n && !eof){
+    n1 = writechunk(n - tot, &nblk);
+    begin_opn(nblk);
+    ilock(first);
+    ilock(second);
+    while(n1 > 0){
+      if(in->off >= src->size){
+        eof = 1;
         break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+      }
+      m = min(n1, BSIZE - in->off%BSIZE);
+      m = min(m, src->size - in->off);
+      bp = ibread(src, in->off);
+      r = writei(dst, (char*)bp->data + in->off%BSIZE, out->off, m);
+      brelse(bp);
+      if(r != m)
+        break;
+      in->off += r;
+      out->off += r;
+      tot += r;
+      n1 -= r;
     }
-    return i == n ? n : -1;
+    iunlock(second);
+    iunlock(first);
+    end_opn(nblk);
+    if(n1 > 0 && !eof)
+      return tot > 0 ? tot : -1;
   }
-  panic("filewrite");
+  return tot;
 }
 
+// Anything else: read into a kernel page and write it back out.
+// Stops after the first short read, so a splice from a pipe or
+// the console returns as soon as some data has been moved.
+static int
+splicecopy(struct file *in, struct file *out, int n)
+{
+  char *buf;
+  int tot, m, r;
+
+  if((buf = kalloc()) == 0)
+    return -1;
+  tot = 0;
+  while(tot < n){
+    m = min(n - tot, PGSIZE);
+    if((r = fileread(in, buf, m)) <= 0){
+      if(r < 0 && tot == 0)
+        tot = -1;
+      break;
+    }
+    if(filewrite(out, buf, r) != r){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    tot += r;
+    if(r < m)
+      break;
+  }
+  kfree(buf);
+  return tot;
+}
+
+// Move up to n bytes from file in to file out, advancing both
+// offsets. Returns the number of bytes moved (0 at end of file)
+// or -1 on error.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  // The fast paths read the source through the buffer cache,
+  // which a tmpfs file does not use.
+  if(in->type == FD_INODE && in->ip->type == T_FILE && in->ip->dev != TMPFSDEV){
+    if(out->type == FD_PIPE)
+      return splicetopipe(in, out->pipe, n);
+    if(out->type == FD_INODE && out->ip->type == T_FILE && out->ip != in->ip)
+      return splicetofile(in, out, n);
+  }
+  return splicecopy(in, out, n);
+}
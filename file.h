@@ -30,6 +30,13 @@ struct inode {
 struct devsw {
   int (*read)(struct inode*, char*, int);
   int (*write)(struct inode*, char*, int);
+  int (*poll)(struct inode*, struct pollent*);  // 0 if always ready
+};
+
+// poll() calls waiting on a pipe or device, guarded by
+// the pipe's or device's lock; see poll.c.
+struct waitq {
+  struct pollent *head;
 };
 
 extern struct devsw devsw[];
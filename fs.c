@@ -17,6 +17,7 @@
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "rwlock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -168,12 +169,31 @@ struct {
   struct inode inode[NINODE];
 } icache;
 
+// Mount table.
+// A file system mounted on a directory hides that directory's
+// contents: namex() steps from the covered directory to the
+// root of the mounted file system, and from that root's ".."
+// back out to the covered directory's parent. Each entry holds
+// a reference to both inodes. namex() reads the table at every
+// step, and only mount and umount change it, so it has a
+// reader-writer lock. mtable.lock is taken before icache.lock.
+struct mount {
+  struct inode *covered;  // directory mounted on, 0 if unused
+  struct inode *root;     // root of the mounted file system
+};
+
+struct {
+  struct rwlock lock;
+  struct mount mount[NMOUNT];
+} mtable;
+
 void
 iinit(int dev)
 {
   int i = 0;
   
   initlock(&icache.lock, "icache");
+  initrwlock(&mtable.lock, "mtable");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
@@ -198,6 +218,12 @@ ialloc(uint dev, short type)
   struct buf *bp;
   struct dinode *dip;
 
+  if(dev == TMPFSDEV){
+    if((inum = tmpalloc(type)) == 0)
+      panic("ialloc: no inodes");
+    return iget(dev, inum);
+  }
+
   for(inum = 1; inum < sb.ninodes; inum++){
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
@@ -223,6 +249,11 @@ iupdate(struct inode *ip)
   struct buf *bp;
   struct dinode *dip;
 
+  if(ip->dev == TMPFSDEV){
+    tmpupdate(ip);
+    return;
+  }
+
   bp = bread(ip->dev, IBLOCK(ip->inum, sb));
   dip = (struct dinode*)bp->data + ip->inum%IPB;
   dip->type = ip->type;
@@ -295,6 +326,13 @@ ilock(struct inode *ip)
 
   acquiresleep(&ip->lock);
 
+  if(ip->valid == 0 && ip->dev == TMPFSDEV){
+    tmpload(ip);
+    ip->valid = 1;
+    if(ip->type == 0)
+      panic("ilock: no type");
+  }
+
   if(ip->valid == 0){
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
@@ -411,6 +449,12 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  pcachedrop(ip->dev, ip->inum);
+  if(ip->dev == TMPFSDEV){
+    tmptrunc(ip);
+    return;
+  }
+
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -465,6 +509,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  if(ip->dev == TMPFSDEV)
+    return tmpread(ip, dst, off, n);
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -475,6 +521,18 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Return the locked buffer holding the block that contains byte
+// off of inode ip, so that callers can move file data straight out
+// of the buffer cache (see filesplice). Caller must hold ip->lock,
+// must have checked that off < ip->size, and must brelse the result.
+struct buf*
+ibread(struct inode *ip, uint off)
+{
+  if(ip->dev == TMPFSDEV)
+    panic("ibread: tmpfs");
+  return bread(ip->dev, bmap(ip, off/BSIZE));
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
@@ -494,6 +552,10 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->type == T_FILE)
+    pcachewrite(ip, off, src, n);  // keep mmap()ed pages current
+  if(ip->dev == TMPFSDEV)
+    return tmpwrite(ip, src, off, n);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -617,6 +679,142 @@ skipelem(char *path, char *name)
   return path;
 }
 
+//PAGEBREAK!
+// Mounts
+
+// If ip is a directory with a file system mounted on it, drop the
+// reference to ip and return a reference to the mounted root instead.
+// Otherwise return ip.
+static struct inode*
+mountcross(struct inode *ip)
+{
+  struct mount *m;
+  struct inode *root;
+
+  root = 0;
+  acquireread(&mtable.lock);
+  for(m = mtable.mount; m < &mtable.mount[NMOUNT]; m++){
+    if(m->covered == ip){
+      root = idup(m->root);
+      break;
+    }
+  }
+  releaseread(&mtable.lock);
+  if(root == 0)
+    return ip;
+  iput(ip);
+  return root;
+}
+
+// If ip is the root of a mounted file system, return
+// a new reference to the directory it is mounted on.
+// Otherwise return 0.
+static struct inode*
+mountcovered(struct inode *ip)
+{
+  struct mount *m;
+  struct inode *covered;
+
+  covered = 0;
+  acquireread(&mtable.lock);
+  for(m = mtable.mount; m < &mtable.mount[NMOUNT]; m++){
+    if(m->covered && m->root == ip){
+      covered = idup(m->covered);
+      break;
+    }
+  }
+  releaseread(&mtable.lock);
+  return covered;
+}
+
+// Is some file system mounted on ip?
+int
+ismountpoint(struct inode *ip)
+{
+  struct mount *m;
+  int r;
+
+  r = 0;
+  acquireread(&mtable.lock);
+  for(m = mtable.mount; m < &mtable.mount[NMOUNT]; m++)
+    if(m->covered == ip)
+      r = 1;
+  releaseread(&mtable.lock);
+  return r;
+}
+
+// Mount a fresh tmpfs on directory ip.
+// On success the mount table takes over the caller's
+// reference to ip. Returns 0 on success, -1 on failure.
+int
+mount(struct inode *ip)
+{
+  struct mount *m, *free;
+
+  free = 0;
+  acquirewrite(&mtable.lock);
+  for(m = mtable.mount; m < &mtable.mount[NMOUNT]; m++){
+    if(m->covered == ip || m->root == ip)
+      goto bad;
+    if(free == 0 && m->covered == 0)
+      free = m;
+  }
+  if(free == 0 || tmpfsmount() < 0)
+    goto bad;
+  free->covered = ip;
+  free->root = iget(TMPFSDEV, ROOTINO);
+  releasewrite(&mtable.lock);
+  return 0;
+
+bad:
+  releasewrite(&mtable.lock);
+  return -1;
+}
+
+// Unmount the file system whose root is ip. Fails if any of
+// its inodes other than the root is in use, or if the root is
+// used by anyone but the mount table and the caller, who keeps
+// its reference. Returns 0 on success, -1 on failure.
+// Must be called inside a transaction since it calls iput().
+int
+umount(struct inode *ip)
+{
+  struct mount *m;
+  struct inode *p, *covered;
+
+  acquirewrite(&mtable.lock);
+  for(m = mtable.mount; m < &mtable.mount[NMOUNT]; m++)
+    if(m->covered && m->root == ip)
+      break;
+  if(m == &mtable.mount[NMOUNT]){
+    releasewrite(&mtable.lock);
+    return -1;
+  }
+
+  // Holding mtable.lock keeps anyone from stepping
+  // into the file system while we check.
+  acquire(&icache.lock);
+  for(p = &icache.inode[0]; p < &icache.inode[NINODE]; p++){
+    if(p->dev == ip->dev && p->ref > (p == ip ? 2 : 0)){
+      release(&icache.lock);
+      releasewrite(&mtable.lock);
+      return -1;
+    }
+  }
+  release(&icache.lock);
+
+  covered = m->covered;
+  m->covered = 0;
+  m->root = 0;
+  releasewrite(&mtable.lock);
+
+  iput(ip);
+  iput(covered);
+  pcachedrop(TMPFSDEV, 0);
+  tmpfsumount();
+  return 0;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
@@ -629,7 +827,7 @@ namex(char *path, int nameiparent, char *name)
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(myproc()->cwd);
+    ip = cwdget();
 
   while((path = skipelem(path, name)) != 0){
     ilock(ip);
@@ -642,12 +840,19 @@ namex(char *path, int nameiparent, char *name)
       iunlock(ip);
       return ip;
     }
+    if(namecmp(name, "..") == 0 && (next = mountcovered(ip)) != 0){
+      // Step out of a mounted file system: the parent
+      // of its root is the parent of the covered directory.
+      iunlockput(ip);
+      ip = next;
+      ilock(ip);
+    }
     if((next = dirlookup(ip, name, 0)) == 0){
       iunlockput(ip);
       return 0;
     }
     iunlockput(ip);
-    ip = next;
+    ip = mountcross(next);
   }
   if(nameiparent){
     iput(ip);
@@ -0,0 +1,136 @@
+// Futexes: fast user-space locking.
+//
+// A futex is a word of user memory. User code changes it with
+// atomic instructions, and calls futex() only to sleep while the
+// word says a lock is taken (FUTEX_WAIT), or to wake sleepers
+// after changing it (FUTEX_WAKE); an uncontended lock never
+// enters the kernel. Sleepers are keyed on the physical address
+// of the word, so threads of one process and processes sharing
+// a page all find each other.
+//
+// Sleepers hang on one of NFUTEXHASH chains, chosen by hashing
+// that address, each with its own lock. FUTEX_WAIT checks the
+// word with the chain's lock held and FUTEX_WAKE takes the same
+// lock, so a wake after the user changes the word cannot slip
+// in between the check and the sleep.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "futex.h"
+
+#define NFUTEXHASH 64
+
+// A sleeping FUTEX_WAIT, on its own kernel stack.
+struct fwaiter {
+  uint pa;                // physical address of the word
+  int woken;
+  struct fwaiter *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct fwaiter *head;
+} futextab[NFUTEXHASH];
+
+void
+futexinit(void)
+{
+  int i;
+
+  for(i = 0; i < NFUTEXHASH; i++)
+    initlock(&futextab[i].lock, "futex");
+}
+
+static uint
+futexhash(uint pa)
+{
+  return ((pa >> 2) ^ (pa >> 12)) % NFUTEXHASH;
+}
+
+// Sleep until a FUTEX_WAKE on pa, if the word at uaddr, whose
+// physical address is pa, still holds val. Returns 0 once woken,
+// or -1 if the word had changed or the process was killed.
+static int
+futexwait(volatile uint *uaddr, uint pa, uint val)
+{
+  struct fwaiter w, **pp;
+  uint h;
+
+  h = futexhash(pa);
+  acquire(&futextab[h].lock);
+  if(*uaddr != val){
+    release(&futextab[h].lock);
+    return -1;
+  }
+  // Join the end of the chain, so wakes go oldest first.
+  w.pa = pa;
+  w.woken = 0;
+  w.next = 0;
+  for(pp = &futextab[h].head; *pp; pp = &(*pp)->next)
+    ;
+  *pp = &w;
+  while(!w.woken && !myproc()->killed)
+    sleep(&w, &futextab[h].lock);
+  if(!w.woken){
+    for(pp = &futextab[h].head; *pp != &w; pp = &(*pp)->next)
+      ;
+    *pp = w.next;
+  }
+  release(&futextab[h].lock);
+  return w.woken ? 0 : -1;
+}
+
+// Wake up to n sleepers on pa, oldest first.
+// Returns the number woken.
+static int
+futexwake(uint pa, int n)
+{
+  struct fwaiter *w, **pp;
+  uint h;
+  int woken;
+
+  h = futexhash(pa);
+  woken = 0;
+  acquire(&futextab[h].lock);
+  for(pp = &futextab[h].head; (w = *pp) != 0 && woken < n; ){
+    if(w->pa != pa){
+      pp = &w->next;
+      continue;
+    }
+    *pp = w->next;
+    w->woken = 1;
+    wakeup(w);
+    woken++;
+  }
+  release(&futextab[h].lock);
+  return woken;
+}
+
+// Carry out futex operation op on the word at user address
+// uaddr, which the caller has checked is writable.
+int
+futex(volatile uint *uaddr, int op, int val)
+{
+  char *ka;
+  uint pa;
+
+  if((uint)uaddr % 4 != 0)
+    return -1;
+  if((ka = uva2ka(myproc()->pgdir, (char*)uaddr)) == 0)
+    return -1;
+  pa = V2P(ka) + ((uint)uaddr & (PGSIZE-1));
+
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(uaddr, pa, val);
+  case FUTEX_WAKE:
+    return futexwake(pa, val);
+  }
+  return -1;
+}
@@ -0,0 +1,5 @@
+// futex() operations.
+// Both the kernel and user programs use this header file.
+
+#define FUTEX_WAIT  1  // sleep if the word still holds val
+#define FUTEX_WAKE  2  // wake up to val sleepers
@@ -0,0 +1,2593 @@
+
+_futextest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "cond test ok\n");
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  waketest();
+      11:	e8 5a 01 00 00       	call   170 <waketest>
+  fastpathtest();
+      16:	e8 f5 01 00 00       	call   210 <fastpathtest>
+  mutextest();
+      1b:	e8 10 03 00 00       	call   330 <mutextest>
+  condtest();
+      20:	e8 ab 03 00 00       	call   3d0 <condtest>
+  printf(1, "futextest ok\n");
+      25:	83 ec 08             	sub    $0x8,%esp
+      28:	68 1c 13 00 00       	push   $0x131c
+      2d:	6a 01                	push   $0x1
+      2f:	e8 8c 0c 00 00       	call   cc0 <printf>
+  exit();
+      34:	e8 ea 09 00 00       	call   a23 <exit>
+      39:	66 90                	xchg   %ax,%ax
+      3b:	66 90                	xchg   %ax,%ax
+      3d:	66 90                	xchg   %ax,%ax
+      3f:	90                   	nop
+
+00000040 <adder>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	53                   	push   %ebx
+      44:	bb 20 4e 00 00       	mov    $0x4e20,%ebx
+      49:	83 ec 04             	sub    $0x4,%esp
+      4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&m);
+      50:	83 ec 0c             	sub    $0xc,%esp
+      53:	68 14 1b 00 00       	push   $0x1b14
+      58:	e8 b3 05 00 00       	call   610 <mutex_lock>
+    counter++;
+      5d:	a1 00 1b 00 00       	mov    0x1b00,%eax
+      62:	83 c0 01             	add    $0x1,%eax
+      65:	a3 00 1b 00 00       	mov    %eax,0x1b00
+    mutex_unlock(&m);
+      6a:	c7 04 24 14 1b 00 00 	movl   $0x1b14,(%esp)
+      71:	e8 0a 06 00 00       	call   680 <mutex_unlock>
+  for(i = 0; i < NINCR; i++){
+      76:	83 c4 10             	add    $0x10,%esp
+      79:	83 eb 01             	sub    $0x1,%ebx
+      7c:	75 d2                	jne    50 <adder+0x10>
+}
+      7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      81:	c9                   	leave
+      82:	c3                   	ret
+      83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000090 <producer>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	53                   	push   %ebx
+  for(i = 1; i <= NITEM; i++){
+      94:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+      99:	83 ec 04             	sub    $0x4,%esp
+      9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&m);
+      a0:	83 ec 0c             	sub    $0xc,%esp
+      a3:	68 14 1b 00 00       	push   $0x1b14
+      a8:	e8 63 05 00 00       	call   610 <mutex_lock>
+      ad:	eb 13                	jmp    c2 <producer+0x32>
+      af:	90                   	nop
+      cond_wait(&notfull, &m);
+      b0:	83 ec 08             	sub    $0x8,%esp
+      b3:	68 14 1b 00 00       	push   $0x1b14
+      b8:	68 0c 1b 00 00       	push   $0x1b0c
+      bd:	e8 0e 06 00 00       	call   6d0 <cond_wait>
+    while(head - tail == NSLOT)
+      c2:	a1 c8 1a 00 00       	mov    0x1ac8,%eax
+      c7:	83 c4 10             	add    $0x10,%esp
+      ca:	89 c2                	mov    %eax,%edx
+      cc:	2b 15 c4 1a 00 00    	sub    0x1ac4,%edx
+      d2:	83 fa 08             	cmp    $0x8,%edx
+      d5:	74 d9                	je     b0 <producer+0x20>
+    ring[head++ % NSLOT] = i;
+      d7:	8d 50 01             	lea    0x1(%eax),%edx
+    cond_signal(&notempty);
+      da:	83 ec 0c             	sub    $0xc,%esp
+    ring[head++ % NSLOT] = i;
+      dd:	89 15 c8 1a 00 00    	mov    %edx,0x1ac8
+      e3:	99                   	cltd
+      e4:	c1 ea 1d             	shr    $0x1d,%edx
+      e7:	01 d0                	add    %edx,%eax
+      e9:	83 e0 07             	and    $0x7,%eax
+      ec:	29 d0                	sub    %edx,%eax
+      ee:	89 1c 85 e0 1a 00 00 	mov    %ebx,0x1ae0(,%eax,4)
+  for(i = 1; i <= NITEM; i++){
+      f5:	83 c3 01             	add    $0x1,%ebx
+    cond_signal(&notempty);
+      f8:	68 04 1b 00 00       	push   $0x1b04
+      fd:	e8 5e 06 00 00       	call   760 <cond_signal>
+    mutex_unlock(&m);
+     102:	c7 04 24 14 1b 00 00 	movl   $0x1b14,(%esp)
+     109:	e8 72 05 00 00       	call   680 <mutex_unlock>
+  for(i = 1; i <= NITEM; i++){
+     10e:	83 c4 10             	add    $0x10,%esp
+     111:	81 fb d1 07 00 00    	cmp    $0x7d1,%ebx
+     117:	75 87                	jne    a0 <producer+0x10>
+}
+     119:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     11c:	c9                   	leave
+     11d:	c3                   	ret
+     11e:	66 90                	xchg   %ax,%ax
+
+00000120 <fail>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "futextest: %s failed\n", msg);
+     126:	ff 75 08             	push   0x8(%ebp)
+     129:	68 20 12 00 00       	push   $0x1220
+     12e:	6a 01                	push   $0x1
+     130:	e8 8b 0b 00 00       	call   cc0 <printf>
+  exit();
+     135:	e8 e9 08 00 00       	call   a23 <exit>
+     13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000140 <nfutex>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	83 ec 0c             	sub    $0xc,%esp
+  if(getsysstat(st, SYS_futex+1, 0) < 0)
+     146:	6a 00                	push   $0x0
+     148:	6a 3d                	push   $0x3d
+     14a:	68 20 1b 00 00       	push   $0x1b20
+     14f:	e8 57 0a 00 00       	call   bab <getsysstat>
+     154:	83 c4 10             	add    $0x10,%esp
+     157:	85 c0                	test   %eax,%eax
+     159:	78 07                	js     162 <nfutex+0x22>
+}
+     15b:	a1 00 3b 00 00       	mov    0x3b00,%eax
+     160:	c9                   	leave
+     161:	c3                   	ret
+    fail("getsysstat");
+     162:	83 ec 0c             	sub    $0xc,%esp
+     165:	68 36 12 00 00       	push   $0x1236
+     16a:	e8 b1 ff ff ff       	call   120 <fail>
+     16f:	90                   	nop
+
+00000170 <waketest>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "wake test\n");
+     176:	68 41 12 00 00       	push   $0x1241
+     17b:	6a 01                	push   $0x1
+     17d:	e8 3e 0b 00 00       	call   cc0 <printf>
+  if(futex(&word, FUTEX_WAIT, 0) >= 0)
+     182:	83 c4 0c             	add    $0xc,%esp
+  word = 1;
+     185:	c7 05 c0 1a 00 00 01 	movl   $0x1,0x1ac0
+     18c:	00 00 00 
+  if(futex(&word, FUTEX_WAIT, 0) >= 0)
+     18f:	6a 00                	push   $0x0
+     191:	6a 01                	push   $0x1
+     193:	68 c0 1a 00 00       	push   $0x1ac0
+     198:	e8 56 0a 00 00       	call   bf3 <futex>
+     19d:	83 c4 10             	add    $0x10,%esp
+     1a0:	85 c0                	test   %eax,%eax
+     1a2:	79 44                	jns    1e8 <waketest+0x78>
+  if(futex(&word, FUTEX_WAKE, 1) != 0)
+     1a4:	83 ec 04             	sub    $0x4,%esp
+     1a7:	6a 01                	push   $0x1
+     1a9:	6a 02                	push   $0x2
+     1ab:	68 c0 1a 00 00       	push   $0x1ac0
+     1b0:	e8 3e 0a 00 00       	call   bf3 <futex>
+     1b5:	83 c4 10             	add    $0x10,%esp
+     1b8:	85 c0                	test   %eax,%eax
+     1ba:	75 46                	jne    202 <waketest+0x92>
+  if(futex((uint*)((char*)&word + 1), FUTEX_WAKE, 1) >= 0)
+     1bc:	83 ec 04             	sub    $0x4,%esp
+     1bf:	6a 01                	push   $0x1
+     1c1:	6a 02                	push   $0x2
+     1c3:	68 c1 1a 00 00       	push   $0x1ac1
+     1c8:	e8 26 0a 00 00       	call   bf3 <futex>
+     1cd:	83 c4 10             	add    $0x10,%esp
+     1d0:	85 c0                	test   %eax,%eax
+     1d2:	79 21                	jns    1f5 <waketest+0x85>
+  printf(1, "wake test ok\n");
+     1d4:	83 ec 08             	sub    $0x8,%esp
+     1d7:	68 89 12 00 00       	push   $0x1289
+     1dc:	6a 01                	push   $0x1
+     1de:	e8 dd 0a 00 00       	call   cc0 <printf>
+}
+     1e3:	83 c4 10             	add    $0x10,%esp
+     1e6:	c9                   	leave
+     1e7:	c3                   	ret
+    fail("wait on a changed word");
+     1e8:	83 ec 0c             	sub    $0xc,%esp
+     1eb:	68 4c 12 00 00       	push   $0x124c
+     1f0:	e8 2b ff ff ff       	call   120 <fail>
+    fail("unaligned futex");
+     1f5:	83 ec 0c             	sub    $0xc,%esp
+     1f8:	68 79 12 00 00       	push   $0x1279
+     1fd:	e8 1e ff ff ff       	call   120 <fail>
+    fail("wake with no sleepers");
+     202:	83 ec 0c             	sub    $0xc,%esp
+     205:	68 63 12 00 00       	push   $0x1263
+     20a:	e8 11 ff ff ff       	call   120 <fail>
+     20f:	90                   	nop
+
+00000210 <fastpathtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	56                   	push   %esi
+     214:	53                   	push   %ebx
+  printf(1, "fast path test\n");
+     215:	83 ec 08             	sub    $0x8,%esp
+     218:	68 97 12 00 00       	push   $0x1297
+     21d:	6a 01                	push   $0x1
+     21f:	e8 9c 0a 00 00       	call   cc0 <printf>
+  mutex_init(&m);
+     224:	c7 04 24 14 1b 00 00 	movl   $0x1b14,(%esp)
+     22b:	e8 d0 03 00 00       	call   600 <mutex_init>
+  if(getsysstat(st, SYS_futex+1, 0) < 0)
+     230:	83 c4 0c             	add    $0xc,%esp
+     233:	6a 00                	push   $0x0
+     235:	6a 3d                	push   $0x3d
+     237:	68 20 1b 00 00       	push   $0x1b20
+     23c:	e8 6a 09 00 00       	call   bab <getsysstat>
+     241:	83 c4 10             	add    $0x10,%esp
+     244:	85 c0                	test   %eax,%eax
+     246:	0f 88 b3 00 00 00    	js     2ff <fastpathtest+0xef>
+  return st[SYS_futex].ncall;
+     24c:	8b 35 00 3b 00 00    	mov    0x3b00,%esi
+     252:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&m);
+     260:	83 ec 0c             	sub    $0xc,%esp
+     263:	68 14 1b 00 00       	push   $0x1b14
+     268:	e8 a3 03 00 00       	call   610 <mutex_lock>
+    mutex_unlock(&m);
+     26d:	c7 04 24 14 1b 00 00 	movl   $0x1b14,(%esp)
+     274:	e8 07 04 00 00       	call   680 <mutex_unlock>
+  for(i = 0; i < 1000; i++){
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	83 eb 01             	sub    $0x1,%ebx
+     27f:	75 df                	jne    260 <fastpathtest+0x50>
+  if(mutex_trylock(&m) < 0 || mutex_trylock(&m) >= 0)
+     281:	83 ec 0c             	sub    $0xc,%esp
+     284:	68 14 1b 00 00       	push   $0x1b14
+     289:	e8 d2 03 00 00       	call   660 <mutex_trylock>
+     28e:	83 c4 10             	add    $0x10,%esp
+     291:	85 c0                	test   %eax,%eax
+     293:	0f 88 80 00 00 00    	js     319 <fastpathtest+0x109>
+     299:	83 ec 0c             	sub    $0xc,%esp
+     29c:	68 14 1b 00 00       	push   $0x1b14
+     2a1:	e8 ba 03 00 00       	call   660 <mutex_trylock>
+     2a6:	83 c4 10             	add    $0x10,%esp
+     2a9:	85 c0                	test   %eax,%eax
+     2ab:	79 6c                	jns    319 <fastpathtest+0x109>
+  mutex_unlock(&m);
+     2ad:	83 ec 0c             	sub    $0xc,%esp
+     2b0:	68 14 1b 00 00       	push   $0x1b14
+     2b5:	e8 c6 03 00 00       	call   680 <mutex_unlock>
+  cond_signal(&notempty);
+     2ba:	c7 04 24 04 1b 00 00 	movl   $0x1b04,(%esp)
+     2c1:	e8 9a 04 00 00       	call   760 <cond_signal>
+  if(getsysstat(st, SYS_futex+1, 0) < 0)
+     2c6:	83 c4 0c             	add    $0xc,%esp
+     2c9:	6a 00                	push   $0x0
+     2cb:	6a 3d                	push   $0x3d
+     2cd:	68 20 1b 00 00       	push   $0x1b20
+     2d2:	e8 d4 08 00 00       	call   bab <getsysstat>
+     2d7:	83 c4 10             	add    $0x10,%esp
+     2da:	85 c0                	test   %eax,%eax
+     2dc:	78 21                	js     2ff <fastpathtest+0xef>
+  if(nfutex() != n)
+     2de:	3b 35 00 3b 00 00    	cmp    0x3b00,%esi
+     2e4:	75 26                	jne    30c <fastpathtest+0xfc>
+  printf(1, "fast path test ok\n");
+     2e6:	83 ec 08             	sub    $0x8,%esp
+     2e9:	68 af 12 00 00       	push   $0x12af
+     2ee:	6a 01                	push   $0x1
+     2f0:	e8 cb 09 00 00       	call   cc0 <printf>
+}
+     2f5:	83 c4 10             	add    $0x10,%esp
+     2f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2fb:	5b                   	pop    %ebx
+     2fc:	5e                   	pop    %esi
+     2fd:	5d                   	pop    %ebp
+     2fe:	c3                   	ret
+    fail("getsysstat");
+     2ff:	83 ec 0c             	sub    $0xc,%esp
+     302:	68 36 12 00 00       	push   $0x1236
+     307:	e8 14 fe ff ff       	call   120 <fail>
+    fail("uncontended mutex entered the kernel");
+     30c:	83 ec 0c             	sub    $0xc,%esp
+     30f:	68 2c 13 00 00       	push   $0x132c
+     314:	e8 07 fe ff ff       	call   120 <fail>
+    fail("trylock");
+     319:	83 ec 0c             	sub    $0xc,%esp
+     31c:	68 a7 12 00 00       	push   $0x12a7
+     321:	e8 fa fd ff ff       	call   120 <fail>
+     326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <mutextest>:
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+  counter = 0;
+     334:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+     339:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "mutex test\n");
+     33c:	68 c2 12 00 00       	push   $0x12c2
+     341:	6a 01                	push   $0x1
+     343:	e8 78 09 00 00       	call   cc0 <printf>
+  counter = 0;
+     348:	83 c4 10             	add    $0x10,%esp
+     34b:	c7 05 00 1b 00 00 00 	movl   $0x0,0x1b00
+     352:	00 00 00 
+    if(thread_create(adder, 0) < 0)
+     355:	83 ec 08             	sub    $0x8,%esp
+     358:	6a 00                	push   $0x0
+     35a:	68 40 00 00 00       	push   $0x40
+     35f:	e8 bc 01 00 00       	call   520 <thread_create>
+     364:	83 c4 10             	add    $0x10,%esp
+     367:	85 c0                	test   %eax,%eax
+     369:	78 3b                	js     3a6 <mutextest+0x76>
+  for(i = 0; i < NTHREAD; i++)
+     36b:	83 eb 01             	sub    $0x1,%ebx
+     36e:	75 e5                	jne    355 <mutextest+0x25>
+     370:	bb 04 00 00 00       	mov    $0x4,%ebx
+    if(thread_join() < 0)
+     375:	e8 06 02 00 00       	call   580 <thread_join>
+     37a:	85 c0                	test   %eax,%eax
+     37c:	78 35                	js     3b3 <mutextest+0x83>
+  for(i = 0; i < NTHREAD; i++)
+     37e:	83 eb 01             	sub    $0x1,%ebx
+     381:	75 f2                	jne    375 <mutextest+0x45>
+  if(counter != NTHREAD*NINCR)
+     383:	a1 00 1b 00 00       	mov    0x1b00,%eax
+     388:	3d 80 38 01 00       	cmp    $0x13880,%eax
+     38d:	75 31                	jne    3c0 <mutextest+0x90>
+  printf(1, "mutex test ok\n");
+     38f:	83 ec 08             	sub    $0x8,%esp
+     392:	68 f0 12 00 00       	push   $0x12f0
+     397:	6a 01                	push   $0x1
+     399:	e8 22 09 00 00       	call   cc0 <printf>
+}
+     39e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  printf(1, "mutex test ok\n");
+     3a1:	83 c4 10             	add    $0x10,%esp
+}
+     3a4:	c9                   	leave
+     3a5:	c3                   	ret
+      fail("thread_create");
+     3a6:	83 ec 0c             	sub    $0xc,%esp
+     3a9:	68 ce 12 00 00       	push   $0x12ce
+     3ae:	e8 6d fd ff ff       	call   120 <fail>
+      fail("thread_join");
+     3b3:	83 ec 0c             	sub    $0xc,%esp
+     3b6:	68 dc 12 00 00       	push   $0x12dc
+     3bb:	e8 60 fd ff ff       	call   120 <fail>
+    fail("counter");
+     3c0:	83 ec 0c             	sub    $0xc,%esp
+     3c3:	68 e8 12 00 00       	push   $0x12e8
+     3c8:	e8 53 fd ff ff       	call   120 <fail>
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <condtest>:
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	56                   	push   %esi
+     3d4:	53                   	push   %ebx
+  printf(1, "cond test\n");
+     3d5:	83 ec 08             	sub    $0x8,%esp
+     3d8:	68 ff 12 00 00       	push   $0x12ff
+     3dd:	6a 01                	push   $0x1
+     3df:	e8 dc 08 00 00       	call   cc0 <printf>
+  cond_init(&notfull);
+     3e4:	c7 04 24 0c 1b 00 00 	movl   $0x1b0c,(%esp)
+     3eb:	e8 c0 02 00 00       	call   6b0 <cond_init>
+  cond_init(&notempty);
+     3f0:	c7 04 24 04 1b 00 00 	movl   $0x1b04,(%esp)
+     3f7:	e8 b4 02 00 00       	call   6b0 <cond_init>
+  head = tail = 0;
+     3fc:	c7 05 c4 1a 00 00 00 	movl   $0x0,0x1ac4
+     403:	00 00 00 
+     406:	c7 05 c8 1a 00 00 00 	movl   $0x0,0x1ac8
+     40d:	00 00 00 
+  if(thread_create(producer, 0) < 0)
+     410:	58                   	pop    %eax
+     411:	5a                   	pop    %edx
+     412:	6a 00                	push   $0x0
+     414:	68 90 00 00 00       	push   $0x90
+     419:	e8 02 01 00 00       	call   520 <thread_create>
+     41e:	83 c4 10             	add    $0x10,%esp
+     421:	85 c0                	test   %eax,%eax
+     423:	0f 88 af 00 00 00    	js     4d8 <condtest+0x108>
+     429:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+  sum = 0;
+     42e:	31 f6                	xor    %esi,%esi
+    mutex_lock(&m);
+     430:	83 ec 0c             	sub    $0xc,%esp
+     433:	68 14 1b 00 00       	push   $0x1b14
+     438:	e8 d3 01 00 00       	call   610 <mutex_lock>
+    while(head == tail)
+     43d:	a1 c4 1a 00 00       	mov    0x1ac4,%eax
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	3b 05 c8 1a 00 00    	cmp    0x1ac8,%eax
+     44b:	75 25                	jne    472 <condtest+0xa2>
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+      cond_wait(&notempty, &m);
+     450:	83 ec 08             	sub    $0x8,%esp
+     453:	68 14 1b 00 00       	push   $0x1b14
+     458:	68 04 1b 00 00       	push   $0x1b04
+     45d:	e8 6e 02 00 00       	call   6d0 <cond_wait>
+    while(head == tail)
+     462:	a1 c4 1a 00 00       	mov    0x1ac4,%eax
+     467:	83 c4 10             	add    $0x10,%esp
+     46a:	39 05 c8 1a 00 00    	cmp    %eax,0x1ac8
+     470:	74 de                	je     450 <condtest+0x80>
+    sum += ring[tail++ % NSLOT];
+     472:	8d 50 01             	lea    0x1(%eax),%edx
+    cond_signal(&notfull);
+     475:	83 ec 0c             	sub    $0xc,%esp
+    sum += ring[tail++ % NSLOT];
+     478:	89 15 c4 1a 00 00    	mov    %edx,0x1ac4
+     47e:	99                   	cltd
+     47f:	c1 ea 1d             	shr    $0x1d,%edx
+     482:	01 d0                	add    %edx,%eax
+     484:	83 e0 07             	and    $0x7,%eax
+     487:	29 d0                	sub    %edx,%eax
+     489:	03 34 85 e0 1a 00 00 	add    0x1ae0(,%eax,4),%esi
+    cond_signal(&notfull);
+     490:	68 0c 1b 00 00       	push   $0x1b0c
+     495:	e8 c6 02 00 00       	call   760 <cond_signal>
+    mutex_unlock(&m);
+     49a:	c7 04 24 14 1b 00 00 	movl   $0x1b14,(%esp)
+     4a1:	e8 da 01 00 00       	call   680 <mutex_unlock>
+  for(i = 0; i < NITEM; i++){
+     4a6:	83 c4 10             	add    $0x10,%esp
+     4a9:	83 eb 01             	sub    $0x1,%ebx
+     4ac:	75 82                	jne    430 <condtest+0x60>
+  if(thread_join() < 0)
+     4ae:	e8 cd 00 00 00       	call   580 <thread_join>
+     4b3:	85 c0                	test   %eax,%eax
+     4b5:	78 3b                	js     4f2 <condtest+0x122>
+  if(sum != NITEM*(NITEM+1)/2)
+     4b7:	81 fe 68 88 1e 00    	cmp    $0x1e8868,%esi
+     4bd:	75 26                	jne    4e5 <condtest+0x115>
+  printf(1, "cond test ok\n");
+     4bf:	83 ec 08             	sub    $0x8,%esp
+     4c2:	68 0e 13 00 00       	push   $0x130e
+     4c7:	6a 01                	push   $0x1
+     4c9:	e8 f2 07 00 00       	call   cc0 <printf>
+     4ce:	83 c4 10             	add    $0x10,%esp
+}
+     4d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4d4:	5b                   	pop    %ebx
+     4d5:	5e                   	pop    %esi
+     4d6:	5d                   	pop    %ebp
+     4d7:	c3                   	ret
+    fail("thread_create");
+     4d8:	83 ec 0c             	sub    $0xc,%esp
+     4db:	68 ce 12 00 00       	push   $0x12ce
+     4e0:	e8 3b fc ff ff       	call   120 <fail>
+    fail("sum");
+     4e5:	83 ec 0c             	sub    $0xc,%esp
+     4e8:	68 0a 13 00 00       	push   $0x130a
+     4ed:	e8 2e fc ff ff       	call   120 <fail>
+    fail("thread_join");
+     4f2:	83 ec 0c             	sub    $0xc,%esp
+     4f5:	68 dc 12 00 00       	push   $0x12dc
+     4fa:	e8 21 fc ff ff       	call   120 <fail>
+     4ff:	90                   	nop
+
+00000500 <threadstart>:
+
+#define STACKSIZE 4096  // clone() takes a one-page stack
+
+static void
+threadstart(void *fn, void *arg)
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	83 ec 14             	sub    $0x14,%esp
+  ((void(*)(void*))fn)(arg);
+     506:	ff 75 0c             	push   0xc(%ebp)
+     509:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     50c:	e8 12 05 00 00       	call   a23 <exit>
+     511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+
+00000520 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	53                   	push   %ebx
+     524:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(STACKSIZE)) == 0)
+     527:	68 00 10 00 00       	push   $0x1000
+     52c:	e8 1f 0b 00 00       	call   1050 <malloc>
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	74 3f                	je     577 <thread_create+0x57>
+    return -1;
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+     538:	50                   	push   %eax
+     539:	89 c3                	mov    %eax,%ebx
+     53b:	ff 75 0c             	push   0xc(%ebp)
+     53e:	ff 75 08             	push   0x8(%ebp)
+     541:	68 00 05 00 00       	push   $0x500
+     546:	e8 98 06 00 00       	call   be3 <clone>
+     54b:	83 c4 10             	add    $0x10,%esp
+     54e:	85 c0                	test   %eax,%eax
+     550:	78 0e                	js     560 <thread_create+0x40>
+    free(stack);
+  return pid;
+}
+     552:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     555:	c9                   	leave
+     556:	c3                   	ret
+     557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55e:	66 90                	xchg   %ax,%ax
+    free(stack);
+     560:	83 ec 0c             	sub    $0xc,%esp
+     563:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     566:	53                   	push   %ebx
+     567:	e8 64 0a 00 00       	call   fd0 <free>
+     56c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     56f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+     572:	83 c4 10             	add    $0x10,%esp
+}
+     575:	c9                   	leave
+     576:	c3                   	ret
+    return -1;
+     577:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     57c:	eb d4                	jmp    552 <thread_create+0x32>
+     57e:	66 90                	xchg   %ax,%ax
+
+00000580 <thread_join>:
+
+// Wait for one of this process's threads to exit.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+     586:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     589:	50                   	push   %eax
+     58a:	e8 5c 06 00 00       	call   beb <join>
+     58f:	83 c4 10             	add    $0x10,%esp
+     592:	85 c0                	test   %eax,%eax
+     594:	79 0a                	jns    5a0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+     596:	c9                   	leave
+     597:	c3                   	ret
+     598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+     5a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+     5a3:	83 ec 0c             	sub    $0xc,%esp
+     5a6:	ff 75 f4             	push   -0xc(%ebp)
+     5a9:	e8 22 0a 00 00       	call   fd0 <free>
+     5ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5b1:	83 c4 10             	add    $0x10,%esp
+}
+     5b4:	c9                   	leave
+     5b5:	c3                   	ret
+     5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <lock_init>:
+
+// Spin locks, for threads.
+
+void
+lock_init(lock_t *lk)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+     5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     5cc:	5d                   	pop    %ebp
+     5cd:	c3                   	ret
+     5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+     5d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     5d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+     5d6:	89 e5                	mov    %esp,%ebp
+     5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+     5e0:	89 c8                	mov    %ecx,%eax
+     5e2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+     5e5:	85 c0                	test   %eax,%eax
+     5e7:	75 f7                	jne    5e0 <lock_acquire+0x10>
+    ;
+}
+     5e9:	5d                   	pop    %ebp
+     5ea:	c3                   	ret
+     5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ef:	90                   	nop
+
+000005f0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	31 c0                	xor    %eax,%eax
+     5f3:	89 e5                	mov    %esp,%ebp
+     5f5:	8b 55 08             	mov    0x8(%ebp),%edx
+     5f8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+     5fb:	5d                   	pop    %ebp
+     5fc:	c3                   	ret
+     5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <mutex_init>:
+// Taking a free mutex or releasing one no one waits for is a
+// single atomic instruction, with no system call.
+
+void
+mutex_init(mutex_t *m)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     603:	8b 45 08             	mov    0x8(%ebp),%eax
+     606:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     60c:	5d                   	pop    %ebp
+     60d:	c3                   	ret
+     60e:	66 90                	xchg   %ax,%ax
+
+00000610 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+     610:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+     611:	31 c0                	xor    %eax,%eax
+     613:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     618:	89 e5                	mov    %esp,%ebp
+     61a:	56                   	push   %esi
+     61b:	53                   	push   %ebx
+     61c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+     61f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     623:	85 c0                	test   %eax,%eax
+     625:	74 32                	je     659 <mutex_lock+0x49>
+    return;
+  // Contended: mark it as having sleepers, then sleep
+  // until a release finds it free.
+  if(c != 2)
+     627:	83 f8 02             	cmp    $0x2,%eax
+     62a:	74 0c                	je     638 <mutex_lock+0x28>
+     62c:	b8 02 00 00 00       	mov    $0x2,%eax
+     631:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     634:	85 c0                	test   %eax,%eax
+     636:	74 21                	je     659 <mutex_lock+0x49>
+     638:	be 02 00 00 00       	mov    $0x2,%esi
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     640:	83 ec 04             	sub    $0x4,%esp
+     643:	6a 02                	push   $0x2
+     645:	6a 01                	push   $0x1
+     647:	53                   	push   %ebx
+     648:	e8 a6 05 00 00       	call   bf3 <futex>
+     64d:	89 f0                	mov    %esi,%eax
+     64f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     652:	83 c4 10             	add    $0x10,%esp
+     655:	85 c0                	test   %eax,%eax
+     657:	75 e7                	jne    640 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     659:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     65c:	5b                   	pop    %ebx
+     65d:	5e                   	pop    %esi
+     65e:	5d                   	pop    %ebp
+     65f:	c3                   	ret
+
+00000660 <mutex_trylock>:
+
+// Take m if it is free. Returns 0 if it was taken, -1 if not.
+int
+mutex_trylock(mutex_t *m)
+{
+     660:	55                   	push   %ebp
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     661:	31 c0                	xor    %eax,%eax
+     663:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+     668:	89 e5                	mov    %esp,%ebp
+     66a:	8b 55 08             	mov    0x8(%ebp),%edx
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     66d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+}
+     671:	5d                   	pop    %ebp
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     672:	f7 d8                	neg    %eax
+     674:	19 c0                	sbb    %eax,%eax
+}
+     676:	c3                   	ret
+     677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67e:	66 90                	xchg   %ax,%ax
+
+00000680 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+     680:	55                   	push   %ebp
+     681:	31 c0                	xor    %eax,%eax
+     683:	89 e5                	mov    %esp,%ebp
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	8b 55 08             	mov    0x8(%ebp),%edx
+     68b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     68e:	83 f8 02             	cmp    $0x2,%eax
+     691:	74 05                	je     698 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     693:	c9                   	leave
+     694:	c3                   	ret
+     695:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     698:	83 ec 04             	sub    $0x4,%esp
+     69b:	6a 01                	push   $0x1
+     69d:	6a 02                	push   $0x2
+     69f:	52                   	push   %edx
+     6a0:	e8 4e 05 00 00       	call   bf3 <futex>
+     6a5:	83 c4 10             	add    $0x10,%esp
+}
+     6a8:	c9                   	leave
+     6a9:	c3                   	ret
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <cond_init>:
+// does not sleep through a signal sent in between. Signals
+// skip the system call when nwait says no one is waiting.
+
+void
+cond_init(cond_t *cv)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  cv->seq = 0;
+     6b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  cv->nwait = 0;
+     6bc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     6c3:	5d                   	pop    %ebp
+     6c4:	c3                   	ret
+     6c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <cond_wait>:
+
+void
+cond_wait(cond_t *cv, mutex_t *m)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 0c             	sub    $0xc,%esp
+     6d9:	8b 75 08             	mov    0x8(%ebp),%esi
+     6dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&cv->nwait, 1);
+     6df:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+     6e4:	31 c0                	xor    %eax,%eax
+  seq = cv->seq;
+     6e6:	8b 3e                	mov    (%esi),%edi
+     6e8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     6eb:	83 f8 02             	cmp    $0x2,%eax
+     6ee:	74 50                	je     740 <cond_wait+0x70>
+  mutex_unlock(m);
+  futex(&cv->seq, FUTEX_WAIT, seq);
+     6f0:	83 ec 04             	sub    $0x4,%esp
+     6f3:	57                   	push   %edi
+     6f4:	6a 01                	push   $0x1
+     6f6:	56                   	push   %esi
+     6f7:	e8 f7 04 00 00       	call   bf3 <futex>
+  __sync_fetch_and_sub(&cv->nwait, 1);
+     6fc:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+     701:	b8 02 00 00 00       	mov    $0x2,%eax
+     706:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be sleeping on m too, so take it as contended.
+  while(xchg(&m->state, 2) != 0)
+     709:	83 c4 10             	add    $0x10,%esp
+     70c:	85 c0                	test   %eax,%eax
+     70e:	74 21                	je     731 <cond_wait+0x61>
+     710:	be 02 00 00 00       	mov    $0x2,%esi
+     715:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     718:	83 ec 04             	sub    $0x4,%esp
+     71b:	6a 02                	push   $0x2
+     71d:	6a 01                	push   $0x1
+     71f:	53                   	push   %ebx
+     720:	e8 ce 04 00 00       	call   bf3 <futex>
+     725:	89 f0                	mov    %esi,%eax
+     727:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     72a:	83 c4 10             	add    $0x10,%esp
+     72d:	85 c0                	test   %eax,%eax
+     72f:	75 e7                	jne    718 <cond_wait+0x48>
+}
+     731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     734:	5b                   	pop    %ebx
+     735:	5e                   	pop    %esi
+     736:	5f                   	pop    %edi
+     737:	5d                   	pop    %ebp
+     738:	c3                   	ret
+     739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     740:	83 ec 04             	sub    $0x4,%esp
+     743:	6a 01                	push   $0x1
+     745:	6a 02                	push   $0x2
+     747:	53                   	push   %ebx
+     748:	e8 a6 04 00 00       	call   bf3 <futex>
+     74d:	83 c4 10             	add    $0x10,%esp
+     750:	eb 9e                	jmp    6f0 <cond_wait+0x20>
+     752:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <cond_signal>:
+
+void
+cond_signal(cond_t *cv)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	83 ec 08             	sub    $0x8,%esp
+     766:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&cv->seq, 1);
+     769:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(cv->nwait)
+     76d:	8b 50 04             	mov    0x4(%eax),%edx
+     770:	85 d2                	test   %edx,%edx
+     772:	75 0c                	jne    780 <cond_signal+0x20>
+    futex(&cv->seq, FUTEX_WAKE, 1);
+}
+     774:	c9                   	leave
+     775:	c3                   	ret
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&cv->seq, FUTEX_WAKE, 1);
+     780:	83 ec 04             	sub    $0x4,%esp
+     783:	6a 01                	push   $0x1
+     785:	6a 02                	push   $0x2
+     787:	50                   	push   %eax
+     788:	e8 66 04 00 00       	call   bf3 <futex>
+     78d:	83 c4 10             	add    $0x10,%esp
+}
+     790:	c9                   	leave
+     791:	c3                   	ret
+     792:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *cv)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	83 ec 08             	sub    $0x8,%esp
+     7a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&cv->seq, 1);
+     7a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(cv->nwait)
+     7ad:	8b 50 04             	mov    0x4(%eax),%edx
+     7b0:	85 d2                	test   %edx,%edx
+     7b2:	75 0c                	jne    7c0 <cond_broadcast+0x20>
+    futex(&cv->seq, FUTEX_WAKE, NPROC);
+}
+     7b4:	c9                   	leave
+     7b5:	c3                   	ret
+     7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&cv->seq, FUTEX_WAKE, NPROC);
+     7c0:	83 ec 04             	sub    $0x4,%esp
+     7c3:	6a 40                	push   $0x40
+     7c5:	6a 02                	push   $0x2
+     7c7:	50                   	push   %eax
+     7c8:	e8 26 04 00 00       	call   bf3 <futex>
+     7cd:	83 c4 10             	add    $0x10,%esp
+}
+     7d0:	c9                   	leave
+     7d1:	c3                   	ret
+     7d2:	66 90                	xchg   %ax,%ax
+     7d4:	66 90                	xchg   %ax,%ax
+     7d6:	66 90                	xchg   %ax,%ax
+     7d8:	66 90                	xchg   %ax,%ax
+     7da:	66 90                	xchg   %ax,%ax
+     7dc:	66 90                	xchg   %ax,%ax
+     7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     7e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     7e1:	31 c0                	xor    %eax,%eax
+{
+     7e3:	89 e5                	mov    %esp,%ebp
+     7e5:	53                   	push   %ebx
+     7e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     7e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     7f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     7f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     7f7:	83 c0 01             	add    $0x1,%eax
+     7fa:	84 d2                	test   %dl,%dl
+     7fc:	75 f2                	jne    7f0 <strcpy+0x10>
+    ;
+  return os;
+}
+     7fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     801:	89 c8                	mov    %ecx,%eax
+     803:	c9                   	leave
+     804:	c3                   	ret
+     805:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	53                   	push   %ebx
+     814:	8b 55 08             	mov    0x8(%ebp),%edx
+     817:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     81a:	0f b6 02             	movzbl (%edx),%eax
+     81d:	84 c0                	test   %al,%al
+     81f:	75 17                	jne    838 <strcmp+0x28>
+     821:	eb 3a                	jmp    85d <strcmp+0x4d>
+     823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     827:	90                   	nop
+     828:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     82c:	83 c2 01             	add    $0x1,%edx
+     82f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     832:	84 c0                	test   %al,%al
+     834:	74 1a                	je     850 <strcmp+0x40>
+    p++, q++;
+     836:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     838:	0f b6 19             	movzbl (%ecx),%ebx
+     83b:	38 c3                	cmp    %al,%bl
+     83d:	74 e9                	je     828 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     83f:	29 d8                	sub    %ebx,%eax
+}
+     841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     844:	c9                   	leave
+     845:	c3                   	ret
+     846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     850:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     854:	31 c0                	xor    %eax,%eax
+     856:	29 d8                	sub    %ebx,%eax
+}
+     858:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     85b:	c9                   	leave
+     85c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     85d:	0f b6 19             	movzbl (%ecx),%ebx
+     860:	31 c0                	xor    %eax,%eax
+     862:	eb db                	jmp    83f <strcmp+0x2f>
+     864:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     86f:	90                   	nop
+
+00000870 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     876:	80 3a 00             	cmpb   $0x0,(%edx)
+     879:	74 15                	je     890 <strlen+0x20>
+     87b:	31 c0                	xor    %eax,%eax
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+     880:	83 c0 01             	add    $0x1,%eax
+     883:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     887:	89 c1                	mov    %eax,%ecx
+     889:	75 f5                	jne    880 <strlen+0x10>
+    ;
+  return n;
+}
+     88b:	89 c8                	mov    %ecx,%eax
+     88d:	5d                   	pop    %ebp
+     88e:	c3                   	ret
+     88f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     890:	31 c9                	xor    %ecx,%ecx
+}
+     892:	5d                   	pop    %ebp
+     893:	89 c8                	mov    %ecx,%eax
+     895:	c3                   	ret
+     896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     8a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8ad:	89 d7                	mov    %edx,%edi
+     8af:	fc                   	cld
+     8b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     8b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     8b5:	89 d0                	mov    %edx,%eax
+     8b7:	c9                   	leave
+     8b8:	c3                   	ret
+     8b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     8ca:	0f b6 10             	movzbl (%eax),%edx
+     8cd:	84 d2                	test   %dl,%dl
+     8cf:	75 12                	jne    8e3 <strchr+0x23>
+     8d1:	eb 1d                	jmp    8f0 <strchr+0x30>
+     8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8d7:	90                   	nop
+     8d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     8dc:	83 c0 01             	add    $0x1,%eax
+     8df:	84 d2                	test   %dl,%dl
+     8e1:	74 0d                	je     8f0 <strchr+0x30>
+    if(*s == c)
+     8e3:	38 d1                	cmp    %dl,%cl
+     8e5:	75 f1                	jne    8d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     8e7:	5d                   	pop    %ebp
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     8f0:	31 c0                	xor    %eax,%eax
+}
+     8f2:	5d                   	pop    %ebp
+     8f3:	c3                   	ret
+     8f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+
+00000900 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     905:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     908:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     909:	31 db                	xor    %ebx,%ebx
+{
+     90b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     90e:	eb 27                	jmp    937 <gets+0x37>
+    cc = read(0, &c, 1);
+     910:	83 ec 04             	sub    $0x4,%esp
+     913:	6a 01                	push   $0x1
+     915:	56                   	push   %esi
+     916:	6a 00                	push   $0x0
+     918:	e8 1e 01 00 00       	call   a3b <read>
+    if(cc < 1)
+     91d:	83 c4 10             	add    $0x10,%esp
+     920:	85 c0                	test   %eax,%eax
+     922:	7e 1d                	jle    941 <gets+0x41>
+      break;
+    buf[i++] = c;
+     924:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     928:	8b 55 08             	mov    0x8(%ebp),%edx
+     92b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     92f:	3c 0a                	cmp    $0xa,%al
+     931:	74 10                	je     943 <gets+0x43>
+     933:	3c 0d                	cmp    $0xd,%al
+     935:	74 0c                	je     943 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     937:	89 df                	mov    %ebx,%edi
+     939:	83 c3 01             	add    $0x1,%ebx
+     93c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     93f:	7c cf                	jl     910 <gets+0x10>
+     941:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     943:	8b 45 08             	mov    0x8(%ebp),%eax
+     946:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     94a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     94d:	5b                   	pop    %ebx
+     94e:	5e                   	pop    %esi
+     94f:	5f                   	pop    %edi
+     950:	5d                   	pop    %ebp
+     951:	c3                   	ret
+     952:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	56                   	push   %esi
+     964:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     965:	83 ec 08             	sub    $0x8,%esp
+     968:	6a 00                	push   $0x0
+     96a:	ff 75 08             	push   0x8(%ebp)
+     96d:	e8 f1 00 00 00       	call   a63 <open>
+  if(fd < 0)
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	85 c0                	test   %eax,%eax
+     977:	78 27                	js     9a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	ff 75 0c             	push   0xc(%ebp)
+     97f:	89 c3                	mov    %eax,%ebx
+     981:	50                   	push   %eax
+     982:	e8 f4 00 00 00       	call   a7b <fstat>
+  close(fd);
+     987:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     98a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     98c:	e8 ba 00 00 00       	call   a4b <close>
+  return r;
+     991:	83 c4 10             	add    $0x10,%esp
+}
+     994:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     997:	89 f0                	mov    %esi,%eax
+     999:	5b                   	pop    %ebx
+     99a:	5e                   	pop    %esi
+     99b:	5d                   	pop    %ebp
+     99c:	c3                   	ret
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     9a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9a5:	eb ed                	jmp    994 <stat+0x34>
+     9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ae:	66 90                	xchg   %ax,%ax
+
+000009b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	53                   	push   %ebx
+     9b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     9b7:	0f be 02             	movsbl (%edx),%eax
+     9ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     9c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     9c5:	77 1e                	ja     9e5 <atoi+0x35>
+     9c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     9d0:	83 c2 01             	add    $0x1,%edx
+     9d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     9d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     9da:	0f be 02             	movsbl (%edx),%eax
+     9dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     9e0:	80 fb 09             	cmp    $0x9,%bl
+     9e3:	76 eb                	jbe    9d0 <atoi+0x20>
+  return n;
+}
+     9e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e8:	89 c8                	mov    %ecx,%eax
+     9ea:	c9                   	leave
+     9eb:	c3                   	ret
+     9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	57                   	push   %edi
+     9f4:	56                   	push   %esi
+     9f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     9fe:	85 c0                	test   %eax,%eax
+     a00:	7e 13                	jle    a15 <memmove+0x25>
+     a02:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     a04:	89 d7                	mov    %edx,%edi
+     a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a10:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a11:	39 f8                	cmp    %edi,%eax
+     a13:	75 fb                	jne    a10 <memmove+0x20>
+  return vdst;
+}
+     a15:	5e                   	pop    %esi
+     a16:	89 d0                	mov    %edx,%eax
+     a18:	5f                   	pop    %edi
+     a19:	5d                   	pop    %ebp
+     a1a:	c3                   	ret
+
+00000a1b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     a1b:	b8 01 00 00 00       	mov    $0x1,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <exit>:
+SYSCALL(exit)
+     a23:	b8 02 00 00 00       	mov    $0x2,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <wait>:
+SYSCALL(wait)
+     a2b:	b8 03 00 00 00       	mov    $0x3,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <pipe>:
+SYSCALL(pipe)
+     a33:	b8 04 00 00 00       	mov    $0x4,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <read>:
+SYSCALL(read)
+     a3b:	b8 05 00 00 00       	mov    $0x5,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <write>:
+SYSCALL(write)
+     a43:	b8 10 00 00 00       	mov    $0x10,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <close>:
+SYSCALL(close)
+     a4b:	b8 15 00 00 00       	mov    $0x15,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <kill>:
+SYSCALL(kill)
+     a53:	b8 06 00 00 00       	mov    $0x6,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <exec>:
+SYSCALL(exec)
+     a5b:	b8 07 00 00 00       	mov    $0x7,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <open>:
+SYSCALL(open)
+     a63:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <mknod>:
+SYSCALL(mknod)
+     a6b:	b8 11 00 00 00       	mov    $0x11,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <unlink>:
+SYSCALL(unlink)
+     a73:	b8 12 00 00 00       	mov    $0x12,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <fstat>:
+SYSCALL(fstat)
+     a7b:	b8 08 00 00 00       	mov    $0x8,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <link>:
+SYSCALL(link)
+     a83:	b8 13 00 00 00       	mov    $0x13,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <mkdir>:
+SYSCALL(mkdir)
+     a8b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <chdir>:
+SYSCALL(chdir)
+     a93:	b8 09 00 00 00       	mov    $0x9,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <dup>:
+SYSCALL(dup)
+     a9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <getpid>:
+SYSCALL(getpid)
+     aa3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <sbrk>:
+SYSCALL(sbrk)
+     aab:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <sleep>:
+SYSCALL(sleep)
+     ab3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <uptime>:
+SYSCALL(uptime)
+     abb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <getsysinfo>:
+SYSCALL(getsysinfo)
+     ac3:	b8 16 00 00 00       	mov    $0x16,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+
+00000acb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     acb:	b8 17 00 00 00       	mov    $0x17,%eax
+     ad0:	cd 40                	int    $0x40
+     ad2:	c3                   	ret
+
+00000ad3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     ad3:	b8 18 00 00 00       	mov    $0x18,%eax
+     ad8:	cd 40                	int    $0x40
+     ada:	c3                   	ret
+
+00000adb <mlfqstart>:
+SYSCALL(mlfqstart)
+     adb:	b8 19 00 00 00       	mov    $0x19,%eax
+     ae0:	cd 40                	int    $0x40
+     ae2:	c3                   	ret
+
+00000ae3 <mlfqstop>:
+SYSCALL(mlfqstop)
+     ae3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ae8:	cd 40                	int    $0x40
+     aea:	c3                   	ret
+
+00000aeb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     aeb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     af0:	cd 40                	int    $0x40
+     af2:	c3                   	ret
+
+00000af3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     af3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     af8:	cd 40                	int    $0x40
+     afa:	c3                   	ret
+
+00000afb <setpriority>:
+SYSCALL(setpriority)
+     afb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     b03:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <getcpustats>:
+SYSCALL(getcpustats)
+     b0b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <setscheduler>:
+SYSCALL(setscheduler)
+     b13:	b8 20 00 00 00       	mov    $0x20,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     b1b:	b8 21 00 00 00       	mov    $0x21,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <getscheduler>:
+SYSCALL(getscheduler)
+     b23:	b8 22 00 00 00       	mov    $0x22,%eax
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <splice>:
+SYSCALL(splice)
+     b2b:	b8 23 00 00 00       	mov    $0x23,%eax
+     b30:	cd 40                	int    $0x40
+     b32:	c3                   	ret
+
+00000b33 <readv>:
+SYSCALL(readv)
+     b33:	b8 24 00 00 00       	mov    $0x24,%eax
+     b38:	cd 40                	int    $0x40
+     b3a:	c3                   	ret
+
+00000b3b <writev>:
+SYSCALL(writev)
+     b3b:	b8 25 00 00 00       	mov    $0x25,%eax
+     b40:	cd 40                	int    $0x40
+     b42:	c3                   	ret
+
+00000b43 <pread>:
+SYSCALL(pread)
+     b43:	b8 26 00 00 00       	mov    $0x26,%eax
+     b48:	cd 40                	int    $0x40
+     b4a:	c3                   	ret
+
+00000b4b <pwrite>:
+SYSCALL(pwrite)
+     b4b:	b8 27 00 00 00       	mov    $0x27,%eax
+     b50:	cd 40                	int    $0x40
+     b52:	c3                   	ret
+
+00000b53 <getlogstat>:
+SYSCALL(getlogstat)
+     b53:	b8 28 00 00 00       	mov    $0x28,%eax
+     b58:	cd 40                	int    $0x40
+     b5a:	c3                   	ret
+
+00000b5b <mount>:
+SYSCALL(mount)
+     b5b:	b8 29 00 00 00       	mov    $0x29,%eax
+     b60:	cd 40                	int    $0x40
+     b62:	c3                   	ret
+
+00000b63 <umount>:
+SYSCALL(umount)
+     b63:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b68:	cd 40                	int    $0x40
+     b6a:	c3                   	ret
+
+00000b6b <mmap>:
+SYSCALL(mmap)
+     b6b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b70:	cd 40                	int    $0x40
+     b72:	c3                   	ret
+
+00000b73 <munmap>:
+SYSCALL(munmap)
+     b73:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b78:	cd 40                	int    $0x40
+     b7a:	c3                   	ret
+
+00000b7b <membench>:
+SYSCALL(membench)
+     b7b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b80:	cd 40                	int    $0x40
+     b82:	c3                   	ret
+
+00000b83 <getlockstat>:
+SYSCALL(getlockstat)
+     b83:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b88:	cd 40                	int    $0x40
+     b8a:	c3                   	ret
+
+00000b8b <lockbench>:
+SYSCALL(lockbench)
+     b8b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <prof>:
+SYSCALL(prof)
+     b93:	b8 30 00 00 00       	mov    $0x30,%eax
+     b98:	cd 40                	int    $0x40
+     b9a:	c3                   	ret
+
+00000b9b <tracectl>:
+SYSCALL(tracectl)
+     b9b:	b8 31 00 00 00       	mov    $0x31,%eax
+     ba0:	cd 40                	int    $0x40
+     ba2:	c3                   	ret
+
+00000ba3 <traceread>:
+SYSCALL(traceread)
+     ba3:	b8 32 00 00 00       	mov    $0x32,%eax
+     ba8:	cd 40                	int    $0x40
+     baa:	c3                   	ret
+
+00000bab <getsysstat>:
+SYSCALL(getsysstat)
+     bab:	b8 33 00 00 00       	mov    $0x33,%eax
+     bb0:	cd 40                	int    $0x40
+     bb2:	c3                   	ret
+
+00000bb3 <getwaitstat>:
+SYSCALL(getwaitstat)
+     bb3:	b8 34 00 00 00       	mov    $0x34,%eax
+     bb8:	cd 40                	int    $0x40
+     bba:	c3                   	ret
+
+00000bbb <getschedwait>:
+SYSCALL(getschedwait)
+     bbb:	b8 35 00 00 00       	mov    $0x35,%eax
+     bc0:	cd 40                	int    $0x40
+     bc2:	c3                   	ret
+
+00000bc3 <mlfqread>:
+SYSCALL(mlfqread)
+     bc3:	b8 36 00 00 00       	mov    $0x36,%eax
+     bc8:	cd 40                	int    $0x40
+     bca:	c3                   	ret
+
+00000bcb <dllock>:
+SYSCALL(dllock)
+     bcb:	b8 37 00 00 00       	mov    $0x37,%eax
+     bd0:	cd 40                	int    $0x40
+     bd2:	c3                   	ret
+
+00000bd3 <watchdogctl>:
+SYSCALL(watchdogctl)
+     bd3:	b8 38 00 00 00       	mov    $0x38,%eax
+     bd8:	cd 40                	int    $0x40
+     bda:	c3                   	ret
+
+00000bdb <deadlocklog>:
+SYSCALL(deadlocklog)
+     bdb:	b8 39 00 00 00       	mov    $0x39,%eax
+     be0:	cd 40                	int    $0x40
+     be2:	c3                   	ret
+
+00000be3 <clone>:
+SYSCALL(clone)
+     be3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     be8:	cd 40                	int    $0x40
+     bea:	c3                   	ret
+
+00000beb <join>:
+SYSCALL(join)
+     beb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     bf0:	cd 40                	int    $0x40
+     bf2:	c3                   	ret
+
+00000bf3 <futex>:
+SYSCALL(futex)
+     bf3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     bf8:	cd 40                	int    $0x40
+     bfa:	c3                   	ret
+
+00000bfb <shmat>:
+SYSCALL(shmat)
+     bfb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     c00:	cd 40                	int    $0x40
+     c02:	c3                   	ret
+
+00000c03 <shmdt>:
+SYSCALL(shmdt)
+     c03:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     c08:	cd 40                	int    $0x40
+     c0a:	c3                   	ret
+
+00000c0b <poll>:
+SYSCALL(poll)
+     c0b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     c10:	cd 40                	int    $0x40
+     c12:	c3                   	ret
+     c13:	66 90                	xchg   %ax,%ax
+     c15:	66 90                	xchg   %ax,%ax
+     c17:	66 90                	xchg   %ax,%ax
+     c19:	66 90                	xchg   %ax,%ax
+     c1b:	66 90                	xchg   %ax,%ax
+     c1d:	66 90                	xchg   %ax,%ax
+     c1f:	90                   	nop
+
+00000c20 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c28:	89 d1                	mov    %edx,%ecx
+{
+     c2a:	83 ec 3c             	sub    $0x3c,%esp
+     c2d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c30:	85 d2                	test   %edx,%edx
+     c32:	0f 89 80 00 00 00    	jns    cb8 <printint+0x98>
+     c38:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c3c:	74 7a                	je     cb8 <printint+0x98>
+    x = -xx;
+     c3e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c45:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c48:	31 f6                	xor    %esi,%esi
+     c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c50:	89 c8                	mov    %ecx,%eax
+     c52:	31 d2                	xor    %edx,%edx
+     c54:	89 f7                	mov    %esi,%edi
+     c56:	f7 f3                	div    %ebx
+     c58:	8d 76 01             	lea    0x1(%esi),%esi
+     c5b:	0f b6 92 b0 13 00 00 	movzbl 0x13b0(%edx),%edx
+     c62:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c66:	89 ca                	mov    %ecx,%edx
+     c68:	89 c1                	mov    %eax,%ecx
+     c6a:	39 da                	cmp    %ebx,%edx
+     c6c:	73 e2                	jae    c50 <printint+0x30>
+  if(neg)
+     c6e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c71:	85 c0                	test   %eax,%eax
+     c73:	74 07                	je     c7c <printint+0x5c>
+    buf[i++] = '-';
+     c75:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c7a:	89 f7                	mov    %esi,%edi
+     c7c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c7f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c82:	01 df                	add    %ebx,%edi
+     c84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c88:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     c8b:	83 ec 04             	sub    $0x4,%esp
+     c8e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c91:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c94:	6a 01                	push   $0x1
+     c96:	50                   	push   %eax
+     c97:	56                   	push   %esi
+     c98:	e8 a6 fd ff ff       	call   a43 <write>
+  while(--i >= 0)
+     c9d:	89 f8                	mov    %edi,%eax
+     c9f:	83 c4 10             	add    $0x10,%esp
+     ca2:	83 ef 01             	sub    $0x1,%edi
+     ca5:	39 d8                	cmp    %ebx,%eax
+     ca7:	75 df                	jne    c88 <printint+0x68>
+}
+     ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cac:	5b                   	pop    %ebx
+     cad:	5e                   	pop    %esi
+     cae:	5f                   	pop    %edi
+     caf:	5d                   	pop    %ebp
+     cb0:	c3                   	ret
+     cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     cb8:	31 c0                	xor    %eax,%eax
+     cba:	eb 89                	jmp    c45 <printint+0x25>
+     cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cc0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	57                   	push   %edi
+     cc4:	56                   	push   %esi
+     cc5:	53                   	push   %ebx
+     cc6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cc9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     ccf:	0f b6 1e             	movzbl (%esi),%ebx
+     cd2:	83 c6 01             	add    $0x1,%esi
+     cd5:	84 db                	test   %bl,%bl
+     cd7:	74 67                	je     d40 <printf+0x80>
+     cd9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cdc:	31 d2                	xor    %edx,%edx
+     cde:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     ce1:	eb 34                	jmp    d17 <printf+0x57>
+     ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ce7:	90                   	nop
+     ce8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     ceb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     cf0:	83 f8 25             	cmp    $0x25,%eax
+     cf3:	74 18                	je     d0d <printf+0x4d>
+  write(fd, &c, 1);
+     cf5:	83 ec 04             	sub    $0x4,%esp
+     cf8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     cfb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cfe:	6a 01                	push   $0x1
+     d00:	50                   	push   %eax
+     d01:	57                   	push   %edi
+     d02:	e8 3c fd ff ff       	call   a43 <write>
+     d07:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     d0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d0d:	0f b6 1e             	movzbl (%esi),%ebx
+     d10:	83 c6 01             	add    $0x1,%esi
+     d13:	84 db                	test   %bl,%bl
+     d15:	74 29                	je     d40 <printf+0x80>
+    c = fmt[i] & 0xff;
+     d17:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d1a:	85 d2                	test   %edx,%edx
+     d1c:	74 ca                	je     ce8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     d1e:	83 fa 25             	cmp    $0x25,%edx
+     d21:	75 ea                	jne    d0d <printf+0x4d>
+      if(c == 'd'){
+     d23:	83 f8 25             	cmp    $0x25,%eax
+     d26:	0f 84 24 01 00 00    	je     e50 <printf+0x190>
+     d2c:	83 e8 63             	sub    $0x63,%eax
+     d2f:	83 f8 15             	cmp    $0x15,%eax
+     d32:	77 1c                	ja     d50 <printf+0x90>
+     d34:	ff 24 85 58 13 00 00 	jmp    *0x1358(,%eax,4)
+     d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d43:	5b                   	pop    %ebx
+     d44:	5e                   	pop    %esi
+     d45:	5f                   	pop    %edi
+     d46:	5d                   	pop    %ebp
+     d47:	c3                   	ret
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+  write(fd, &c, 1);
+     d50:	83 ec 04             	sub    $0x4,%esp
+     d53:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d56:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d5a:	6a 01                	push   $0x1
+     d5c:	52                   	push   %edx
+     d5d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d60:	57                   	push   %edi
+     d61:	e8 dd fc ff ff       	call   a43 <write>
+     d66:	83 c4 0c             	add    $0xc,%esp
+     d69:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d6c:	6a 01                	push   $0x1
+     d6e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     d71:	52                   	push   %edx
+     d72:	57                   	push   %edi
+     d73:	e8 cb fc ff ff       	call   a43 <write>
+        putc(fd, c);
+     d78:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d7b:	31 d2                	xor    %edx,%edx
+     d7d:	eb 8e                	jmp    d0d <printf+0x4d>
+     d7f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     d80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     d83:	83 ec 0c             	sub    $0xc,%esp
+     d86:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d8b:	8b 13                	mov    (%ebx),%edx
+     d8d:	6a 00                	push   $0x0
+     d8f:	89 f8                	mov    %edi,%eax
+        ap++;
+     d91:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     d94:	e8 87 fe ff ff       	call   c20 <printint>
+        ap++;
+     d99:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     d9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d9f:	31 d2                	xor    %edx,%edx
+     da1:	e9 67 ff ff ff       	jmp    d0d <printf+0x4d>
+     da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     db0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     db3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     db5:	83 c0 04             	add    $0x4,%eax
+     db8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     dbb:	85 db                	test   %ebx,%ebx
+     dbd:	0f 84 9d 00 00 00    	je     e60 <printf+0x1a0>
+        while(*s != 0){
+     dc3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     dc6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     dc8:	84 c0                	test   %al,%al
+     dca:	0f 84 3d ff ff ff    	je     d0d <printf+0x4d>
+     dd0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     dd3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     dd6:	89 de                	mov    %ebx,%esi
+     dd8:	89 d3                	mov    %edx,%ebx
+     dda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     de0:	83 ec 04             	sub    $0x4,%esp
+     de3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     de6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     de9:	6a 01                	push   $0x1
+     deb:	53                   	push   %ebx
+     dec:	57                   	push   %edi
+     ded:	e8 51 fc ff ff       	call   a43 <write>
+        while(*s != 0){
+     df2:	0f b6 06             	movzbl (%esi),%eax
+     df5:	83 c4 10             	add    $0x10,%esp
+     df8:	84 c0                	test   %al,%al
+     dfa:	75 e4                	jne    de0 <printf+0x120>
+      state = 0;
+     dfc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     dff:	31 d2                	xor    %edx,%edx
+     e01:	e9 07 ff ff ff       	jmp    d0d <printf+0x4d>
+     e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     e10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     e13:	83 ec 0c             	sub    $0xc,%esp
+     e16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e1b:	8b 13                	mov    (%ebx),%edx
+     e1d:	6a 01                	push   $0x1
+     e1f:	e9 6b ff ff ff       	jmp    d8f <printf+0xcf>
+     e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     e28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     e2b:	83 ec 04             	sub    $0x4,%esp
+     e2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     e31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     e33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     e36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e39:	6a 01                	push   $0x1
+     e3b:	52                   	push   %edx
+     e3c:	57                   	push   %edi
+     e3d:	e8 01 fc ff ff       	call   a43 <write>
+        ap++;
+     e42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e48:	31 d2                	xor    %edx,%edx
+     e4a:	e9 be fe ff ff       	jmp    d0d <printf+0x4d>
+     e4f:	90                   	nop
+  write(fd, &c, 1);
+     e50:	83 ec 04             	sub    $0x4,%esp
+     e53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e59:	6a 01                	push   $0x1
+     e5b:	e9 11 ff ff ff       	jmp    d71 <printf+0xb1>
+     e60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e65:	bb 51 13 00 00       	mov    $0x1351,%ebx
+     e6a:	e9 61 ff ff ff       	jmp    dd0 <printf+0x110>
+     e6f:	90                   	nop
+
+00000e70 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e73:	a1 f4 3b 00 00       	mov    0x3bf4,%eax
+{
+     e78:	89 e5                	mov    %esp,%ebp
+     e7a:	56                   	push   %esi
+     e7b:	53                   	push   %ebx
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e80:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e82:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e84:	39 ca                	cmp    %ecx,%edx
+     e86:	73 30                	jae    eb8 <bigfree+0x48>
+     e88:	39 c1                	cmp    %eax,%ecx
+     e8a:	72 04                	jb     e90 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e8c:	39 c2                	cmp    %eax,%edx
+     e8e:	72 f0                	jb     e80 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e90:	8b 59 04             	mov    0x4(%ecx),%ebx
+     e93:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     e96:	39 f0                	cmp    %esi,%eax
+     e98:	74 26                	je     ec0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e9a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e9c:	8b 42 04             	mov    0x4(%edx),%eax
+     e9f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     ea2:	39 d9                	cmp    %ebx,%ecx
+     ea4:	74 30                	je     ed6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ea6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ea8:	5b                   	pop    %ebx
+  freep = p;
+     ea9:	89 15 f4 3b 00 00    	mov    %edx,0x3bf4
+}
+     eaf:	5e                   	pop    %esi
+     eb0:	5d                   	pop    %ebp
+     eb1:	c3                   	ret
+     eb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eb8:	39 c1                	cmp    %eax,%ecx
+     eba:	72 d0                	jb     e8c <bigfree+0x1c>
+     ebc:	eb c2                	jmp    e80 <bigfree+0x10>
+     ebe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     ec0:	03 58 04             	add    0x4(%eax),%ebx
+     ec3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ec6:	8b 02                	mov    (%edx),%eax
+     ec8:	8b 00                	mov    (%eax),%eax
+     eca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     ecc:	8b 42 04             	mov    0x4(%edx),%eax
+     ecf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     ed2:	39 d9                	cmp    %ebx,%ecx
+     ed4:	75 d0                	jne    ea6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+     ed6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     ed9:	89 15 f4 3b 00 00    	mov    %edx,0x3bf4
+    p->s.size += bp->s.size;
+     edf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ee2:	8b 09                	mov    (%ecx),%ecx
+     ee4:	89 0a                	mov    %ecx,(%edx)
+}
+     ee6:	5b                   	pop    %ebx
+     ee7:	5e                   	pop    %esi
+     ee8:	5d                   	pop    %ebp
+     ee9:	c3                   	ret
+     eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ef0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	57                   	push   %edi
+     ef4:	89 c7                	mov    %eax,%edi
+     ef6:	56                   	push   %esi
+     ef7:	53                   	push   %ebx
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     efb:	a1 f4 3b 00 00       	mov    0x3bf4,%eax
+     f00:	85 c0                	test   %eax,%eax
+     f02:	0f 84 88 00 00 00    	je     f90 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f08:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     f0a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     f0d:	39 f9                	cmp    %edi,%ecx
+     f0f:	73 5f                	jae    f70 <bigalloc+0x80>
+  if(nu < 4096)
+     f11:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f16:	39 df                	cmp    %ebx,%edi
+     f18:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f1b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f22:	eb 0d                	jmp    f31 <bigalloc+0x41>
+     f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     f2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     f2d:	39 f9                	cmp    %edi,%ecx
+     f2f:	73 3f                	jae    f70 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     f31:	89 d0                	mov    %edx,%eax
+     f33:	39 15 f4 3b 00 00    	cmp    %edx,0x3bf4
+     f39:	75 ed                	jne    f28 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     f3b:	83 ec 0c             	sub    $0xc,%esp
+     f3e:	56                   	push   %esi
+     f3f:	e8 67 fb ff ff       	call   aab <sbrk>
+  if(p == (char*)-1)
+     f44:	83 c4 10             	add    $0x10,%esp
+     f47:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f4a:	74 11                	je     f5d <bigalloc+0x6d>
+  hp->s.size = nu;
+     f4c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+     f4f:	e8 1c ff ff ff       	call   e70 <bigfree>
+  return freep;
+     f54:	a1 f4 3b 00 00       	mov    0x3bf4,%eax
+      if((p = morecore(nunits)) == 0)
+     f59:	85 c0                	test   %eax,%eax
+     f5b:	75 cb                	jne    f28 <bigalloc+0x38>
+        return 0;
+  }
+}
+     f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f60:	31 d2                	xor    %edx,%edx
+}
+     f62:	5b                   	pop    %ebx
+     f63:	89 d0                	mov    %edx,%eax
+     f65:	5e                   	pop    %esi
+     f66:	5f                   	pop    %edi
+     f67:	5d                   	pop    %ebp
+     f68:	c3                   	ret
+     f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     f70:	39 cf                	cmp    %ecx,%edi
+     f72:	74 4c                	je     fc0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+     f74:	29 f9                	sub    %edi,%ecx
+     f76:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     f79:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     f7c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     f7f:	a3 f4 3b 00 00       	mov    %eax,0x3bf4
+}
+     f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f87:	89 d0                	mov    %edx,%eax
+     f89:	5b                   	pop    %ebx
+     f8a:	5e                   	pop    %esi
+     f8b:	5f                   	pop    %edi
+     f8c:	5d                   	pop    %ebp
+     f8d:	c3                   	ret
+     f8e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+     f90:	c7 05 f4 3b 00 00 f8 	movl   $0x3bf8,0x3bf4
+     f97:	3b 00 00 
+    base.s.size = 0;
+     f9a:	ba f8 3b 00 00       	mov    $0x3bf8,%edx
+    base.s.ptr = freep = prevp = &base;
+     f9f:	c7 05 f8 3b 00 00 f8 	movl   $0x3bf8,0x3bf8
+     fa6:	3b 00 00 
+    base.s.size = 0;
+     fa9:	c7 05 fc 3b 00 00 00 	movl   $0x0,0x3bfc
+     fb0:	00 00 00 
+    if(p->s.size >= nunits){
+     fb3:	e9 59 ff ff ff       	jmp    f11 <bigalloc+0x21>
+     fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fc0:	8b 0a                	mov    (%edx),%ecx
+     fc2:	89 08                	mov    %ecx,(%eax)
+     fc4:	eb b9                	jmp    f7f <bigalloc+0x8f>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fd0 <free>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	53                   	push   %ebx
+     fd4:	83 ec 04             	sub    $0x4,%esp
+     fd7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+     fda:	85 c9                	test   %ecx,%ecx
+     fdc:	74 58                	je     1036 <free+0x66>
+  bp = (Header*)ap - 1;
+     fde:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+  asm volatile("lock; xchgl %0, %1" :
+     fe1:	ba 01 00 00 00       	mov    $0x1,%edx
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+     ff0:	89 d0                	mov    %edx,%eax
+     ff2:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+  while(xchg(&locked, 1) != 0)
+     ff9:	85 c0                	test   %eax,%eax
+     ffb:	75 f3                	jne    ff0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+     ffd:	8b 51 fc             	mov    -0x4(%ecx),%edx
+    1000:	83 fa 40             	cmp    $0x40,%edx
+    1003:	77 3b                	ja     1040 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+    1005:	83 fa 02             	cmp    $0x2,%edx
+    1008:	76 3f                	jbe    1049 <free+0x79>
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1010:	83 c0 01             	add    $0x1,%eax
+    1013:	39 14 85 e0 13 00 00 	cmp    %edx,0x13e0(,%eax,4)
+    101a:	72 f4                	jb     1010 <free+0x40>
+    bp->s.ptr = classfree[c];
+    101c:	8b 14 85 c0 3b 00 00 	mov    0x3bc0(,%eax,4),%edx
+    classfree[c] = bp;
+    1023:	89 1c 85 c0 3b 00 00 	mov    %ebx,0x3bc0(,%eax,4)
+    bp->s.ptr = classfree[c];
+    102a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+    102d:	31 c0                	xor    %eax,%eax
+    102f:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+}
+    1036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1039:	c9                   	leave
+    103a:	c3                   	ret
+    103b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+    bigfree(bp);
+    1040:	89 d8                	mov    %ebx,%eax
+    1042:	e8 29 fe ff ff       	call   e70 <bigfree>
+    1047:	eb e4                	jmp    102d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+    1049:	31 c0                	xor    %eax,%eax
+    104b:	eb cf                	jmp    101c <free+0x4c>
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001050 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1050:	55                   	push   %ebp
+    1051:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1056:	89 e5                	mov    %esp,%ebp
+    1058:	57                   	push   %edi
+    1059:	56                   	push   %esi
+    105a:	53                   	push   %ebx
+    105b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    105e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1061:	8d 50 07             	lea    0x7(%eax),%edx
+    1064:	c1 ea 03             	shr    $0x3,%edx
+    1067:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+    106a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1070:	89 c8                	mov    %ecx,%eax
+    1072:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+    1079:	85 c0                	test   %eax,%eax
+    107b:	75 f3                	jne    1070 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+    107d:	89 c3                	mov    %eax,%ebx
+    107f:	83 fa 40             	cmp    $0x40,%edx
+    1082:	77 4c                	ja     10d0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+    1084:	be 02 00 00 00       	mov    $0x2,%esi
+    1089:	83 fa 02             	cmp    $0x2,%edx
+    108c:	76 10                	jbe    109e <malloc+0x4e>
+    108e:	66 90                	xchg   %ax,%ax
+    1090:	83 c3 01             	add    $0x1,%ebx
+    1093:	8b 34 9d e0 13 00 00 	mov    0x13e0(,%ebx,4),%esi
+    109a:	39 d6                	cmp    %edx,%esi
+    109c:	72 f2                	jb     1090 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+    109e:	8b 14 9d c0 3b 00 00 	mov    0x3bc0(,%ebx,4),%edx
+    10a5:	85 d2                	test   %edx,%edx
+    10a7:	74 47                	je     10f0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    10a9:	8b 3a                	mov    (%edx),%edi
+    10ab:	89 3c 9d c0 3b 00 00 	mov    %edi,0x3bc0(,%ebx,4)
+    10b2:	31 c0                	xor    %eax,%eax
+    10b4:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+    10bb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+    10be:	8d 42 08             	lea    0x8(%edx),%eax
+}
+    10c1:	5b                   	pop    %ebx
+    10c2:	5e                   	pop    %esi
+    10c3:	5f                   	pop    %edi
+    10c4:	5d                   	pop    %ebp
+    10c5:	c3                   	ret
+    10c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+    10d0:	89 d0                	mov    %edx,%eax
+    10d2:	e8 19 fe ff ff       	call   ef0 <bigalloc>
+    10d7:	89 c2                	mov    %eax,%edx
+    10d9:	89 d8                	mov    %ebx,%eax
+    10db:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+  return p ? (void*)(p + 1) : 0;
+    10e2:	85 d2                	test   %edx,%edx
+    10e4:	75 d5                	jne    10bb <malloc+0x6b>
+    10e6:	31 c0                	xor    %eax,%eax
+}
+    10e8:	83 c4 1c             	add    $0x1c,%esp
+    10eb:	5b                   	pop    %ebx
+    10ec:	5e                   	pop    %esi
+    10ed:	5f                   	pop    %edi
+    10ee:	5d                   	pop    %ebp
+    10ef:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    10f0:	b8 00 02 00 00       	mov    $0x200,%eax
+    10f5:	e8 f6 fd ff ff       	call   ef0 <bigalloc>
+    10fa:	85 c0                	test   %eax,%eax
+    10fc:	74 44                	je     1142 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10fe:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    1105:	8b 14 9d c0 3b 00 00 	mov    0x3bc0(,%ebx,4),%edx
+    110c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    110f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    1112:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    1118:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    111b:	39 cf                	cmp    %ecx,%edi
+    111d:	72 8a                	jb     10a9 <malloc+0x59>
+    111f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    1122:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1125:	8d 76 00             	lea    0x0(%esi),%esi
+    1128:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    112a:	89 70 04             	mov    %esi,0x4(%eax)
+    112d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    112f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    1131:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    1133:	01 d8                	add    %ebx,%eax
+    1135:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    1138:	73 ee                	jae    1128 <malloc+0xd8>
+    113a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    113d:	e9 69 ff ff ff       	jmp    10ab <malloc+0x5b>
+    1142:	f0 87 05 a0 3b 00 00 	lock xchg %eax,0x3ba0
+  return p ? (void*)(p + 1) : 0;
+    1149:	31 c0                	xor    %eax,%eax
+    114b:	eb 9b                	jmp    10e8 <malloc+0x98>
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001150 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	56                   	push   %esi
+    1154:	53                   	push   %ebx
+    1155:	8b 45 08             	mov    0x8(%ebp),%eax
+    1158:	f7 65 0c             	mull   0xc(%ebp)
+    115b:	70 33                	jo     1190 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    115d:	83 ec 0c             	sub    $0xc,%esp
+    1160:	89 c3                	mov    %eax,%ebx
+    1162:	50                   	push   %eax
+    1163:	e8 e8 fe ff ff       	call   1050 <malloc>
+    1168:	83 c4 10             	add    $0x10,%esp
+    116b:	89 c6                	mov    %eax,%esi
+    116d:	85 c0                	test   %eax,%eax
+    116f:	74 1f                	je     1190 <calloc+0x40>
+    memset(p, 0, n);
+    1171:	83 ec 04             	sub    $0x4,%esp
+    1174:	53                   	push   %ebx
+    1175:	6a 00                	push   $0x0
+    1177:	50                   	push   %eax
+    1178:	e8 23 f7 ff ff       	call   8a0 <memset>
+    117d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1180:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1183:	89 f0                	mov    %esi,%eax
+    1185:	5b                   	pop    %ebx
+    1186:	5e                   	pop    %esi
+    1187:	5d                   	pop    %ebp
+    1188:	c3                   	ret
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1190:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1193:	31 f6                	xor    %esi,%esi
+}
+    1195:	89 f0                	mov    %esi,%eax
+    1197:	5b                   	pop    %ebx
+    1198:	5e                   	pop    %esi
+    1199:	5d                   	pop    %ebp
+    119a:	c3                   	ret
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+    11a5:	53                   	push   %ebx
+    11a6:	83 ec 0c             	sub    $0xc,%esp
+    11a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    11af:	85 db                	test   %ebx,%ebx
+    11b1:	74 55                	je     1208 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    11b3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    11b6:	89 de                	mov    %ebx,%esi
+    11b8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    11bf:	39 c7                	cmp    %eax,%edi
+    11c1:	72 0d                	jb     11d0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    11c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11c6:	89 f0                	mov    %esi,%eax
+    11c8:	5b                   	pop    %ebx
+    11c9:	5e                   	pop    %esi
+    11ca:	5f                   	pop    %edi
+    11cb:	5d                   	pop    %ebp
+    11cc:	c3                   	ret
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    11d0:	83 ec 0c             	sub    $0xc,%esp
+    11d3:	50                   	push   %eax
+    11d4:	e8 77 fe ff ff       	call   1050 <malloc>
+    11d9:	83 c4 10             	add    $0x10,%esp
+    11dc:	89 c6                	mov    %eax,%esi
+    11de:	85 c0                	test   %eax,%eax
+    11e0:	74 e1                	je     11c3 <realloc+0x23>
+  memmove(p, ap, have);
+    11e2:	83 ec 04             	sub    $0x4,%esp
+    11e5:	57                   	push   %edi
+    11e6:	53                   	push   %ebx
+    11e7:	50                   	push   %eax
+    11e8:	e8 03 f8 ff ff       	call   9f0 <memmove>
+  free(ap);
+    11ed:	89 1c 24             	mov    %ebx,(%esp)
+    11f0:	e8 db fd ff ff       	call   fd0 <free>
+  return p;
+    11f5:	83 c4 10             	add    $0x10,%esp
+}
+    11f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11fb:	89 f0                	mov    %esi,%eax
+    11fd:	5b                   	pop    %ebx
+    11fe:	5e                   	pop    %esi
+    11ff:	5f                   	pop    %edi
+    1200:	5d                   	pop    %ebp
+    1201:	c3                   	ret
+    1202:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1208:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    120b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    120e:	5b                   	pop    %ebx
+    120f:	5e                   	pop    %esi
+    1210:	5f                   	pop    %edi
+    1211:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1212:	e9 39 fe ff ff       	jmp    1050 <malloc>
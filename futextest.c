@@ -0,0 +1,156 @@
+// Tests for futex() and the mutexes and condition variables
+// built on it in uthread.c.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "sysstat.h"
+#include "futex.h"
+
+#define NTHREAD 4
+#define NINCR   20000
+#define NITEM   2000
+#define NSLOT   8
+
+struct sysstat st[SYS_futex+1];
+mutex_t m;
+cond_t notfull, notempty;
+volatile int counter;
+int ring[NSLOT], head, tail;
+volatile uint word;
+
+void
+fail(char *msg)
+{
+  printf(1, "futextest: %s failed\n", msg);
+  exit();
+}
+
+// Number of futex() calls made so far, by everyone.
+uint
+nfutex(void)
+{
+  if(getsysstat(st, SYS_futex+1, 0) < 0)
+    fail("getsysstat");
+  return st[SYS_futex].ncall;
+}
+
+void
+waketest(void)
+{
+  printf(1, "wake test\n");
+  word = 1;
+  if(futex(&word, FUTEX_WAIT, 0) >= 0)
+    fail("wait on a changed word");
+  if(futex(&word, FUTEX_WAKE, 1) != 0)
+    fail("wake with no sleepers");
+  if(futex((uint*)((char*)&word + 1), FUTEX_WAKE, 1) >= 0)
+    fail("unaligned futex");
+  printf(1, "wake test ok\n");
+}
+
+void
+fastpathtest(void)
+{
+  uint n;
+  int i;
+
+  printf(1, "fast path test\n");
+  mutex_init(&m);
+  n = nfutex();
+  for(i = 0; i < 1000; i++){
+    mutex_lock(&m);
+    mutex_unlock(&m);
+  }
+  if(mutex_trylock(&m) < 0 || mutex_trylock(&m) >= 0)
+    fail("trylock");
+  mutex_unlock(&m);
+  cond_signal(&notempty);
+  if(nfutex() != n)
+    fail("uncontended mutex entered the kernel");
+  printf(1, "fast path test ok\n");
+}
+
+void
+adder(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NINCR; i++){
+    mutex_lock(&m);
+    counter++;
+    mutex_unlock(&m);
+  }
+}
+
+void
+mutextest(void)
+{
+  int i;
+
+  printf(1, "mutex test\n");
+  counter = 0;
+  for(i = 0; i < NTHREAD; i++)
+    if(thread_create(adder, 0) < 0)
+      fail("thread_create");
+  for(i = 0; i < NTHREAD; i++)
+    if(thread_join() < 0)
+      fail("thread_join");
+  if(counter != NTHREAD*NINCR)
+    fail("counter");
+  printf(1, "mutex test ok\n");
+}
+
+void
+producer(void *arg)
+{
+  int i;
+
+  for(i = 1; i <= NITEM; i++){
+    mutex_lock(&m);
+    while(head - tail == NSLOT)
+      cond_wait(&notfull, &m);
+    ring[head++ % NSLOT] = i;
+    cond_signal(&notempty);
+    mutex_unlock(&m);
+  }
+}
+
+void
+condtest(void)
+{
+  int i, sum;
+
+  printf(1, "cond test\n");
+  cond_init(&notfull);
+  cond_init(&notempty);
+  head = tail = 0;
+  if(thread_create(producer, 0) < 0)
+    fail("thread_create");
+  sum = 0;
+  for(i = 0; i < NITEM; i++){
+    mutex_lock(&m);
+    while(head == tail)
+      cond_wait(&notempty, &m);
+    sum += ring[tail++ % NSLOT];
+    cond_signal(&notfull);
+    mutex_unlock(&m);
+  }
+  if(thread_join() < 0)
+    fail("thread_join");
+  if(sum != NITEM*(NITEM+1)/2)
+    fail("sum");
+  printf(1, "cond test ok\n");
+}
+
+int
+main(void)
+{
+  waketest();
+  fastpathtest();
+  mutextest();
+  condtest();
+  printf(1, "futextest ok\n");
+  exit();
+}
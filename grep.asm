@@ -0,0 +1,2247 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	0f 8e 84 00 00 00    	jle    a9 <main+0xa9>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  25:	8b 43 04             	mov    0x4(%ebx),%eax
+  28:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  2b:	83 7d e0 02          	cmpl   $0x2,-0x20(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2f:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(argc <= 2){
+  37:	75 1e                	jne    57 <main+0x57>
+  39:	e9 7e 00 00 00       	jmp    bc <main+0xbc>
+  3e:	66 90                	xchg   %ax,%ax
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    if(grepmap(pattern, fd) < 0)
+      grep(pattern, fd);
+    close(fd);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    close(fd);
+  49:	57                   	push   %edi
+  4a:	e8 ac 06 00 00       	call   6fb <close>
+  for(i = 2; i < argc; i++){
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+  55:	7e 39                	jle    90 <main+0x90>
+    if((fd = open(argv[i], 0)) < 0){
+  57:	83 ec 08             	sub    $0x8,%esp
+  5a:	6a 00                	push   $0x0
+  5c:	ff 33                	push   (%ebx)
+  5e:	e8 b0 06 00 00       	call   713 <open>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	89 c7                	mov    %eax,%edi
+  68:	85 c0                	test   %eax,%eax
+  6a:	78 29                	js     95 <main+0x95>
+    if(grepmap(pattern, fd) < 0)
+  6c:	83 ec 08             	sub    $0x8,%esp
+  6f:	50                   	push   %eax
+  70:	ff 75 e4             	push   -0x1c(%ebp)
+  73:	e8 b8 02 00 00       	call   330 <grepmap>
+  78:	83 c4 10             	add    $0x10,%esp
+  7b:	85 c0                	test   %eax,%eax
+  7d:	79 c1                	jns    40 <main+0x40>
+      grep(pattern, fd);
+  7f:	83 ec 08             	sub    $0x8,%esp
+  82:	57                   	push   %edi
+  83:	ff 75 e4             	push   -0x1c(%ebp)
+  86:	e8 b5 01 00 00       	call   240 <grep>
+  8b:	83 c4 10             	add    $0x10,%esp
+  8e:	eb b0                	jmp    40 <main+0x40>
+  }
+  exit();
+  90:	e8 3e 06 00 00       	call   6d3 <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  95:	50                   	push   %eax
+  96:	ff 33                	push   (%ebx)
+  98:	68 00 0f 00 00       	push   $0xf00
+  9d:	6a 01                	push   $0x1
+  9f:	e8 cc 08 00 00       	call   970 <printf>
+      exit();
+  a4:	e8 2a 06 00 00       	call   6d3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  a9:	51                   	push   %ecx
+  aa:	51                   	push   %ecx
+  ab:	68 e0 0e 00 00       	push   $0xee0
+  b0:	6a 02                	push   $0x2
+  b2:	e8 b9 08 00 00       	call   970 <printf>
+    exit();
+  b7:	e8 17 06 00 00       	call   6d3 <exit>
+    grep(pattern, 0);
+  bc:	52                   	push   %edx
+  bd:	52                   	push   %edx
+  be:	6a 00                	push   $0x0
+  c0:	50                   	push   %eax
+  c1:	e8 7a 01 00 00       	call   240 <grep>
+    exit();
+  c6:	e8 08 06 00 00       	call   6d3 <exit>
+  cb:	66 90                	xchg   %ax,%ax
+  cd:	66 90                	xchg   %ax,%ax
+  cf:	90                   	nop
+
+000000d0 <eol>:
+int matchstar(int, char*, char*);
+
+// Lines end at a nul in buf, or at the newline in a mapped file.
+int
+eol(int c)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  return c == '\0' || c == '\n';
+}
+  d6:	5d                   	pop    %ebp
+  return c == '\0' || c == '\n';
+  d7:	85 d2                	test   %edx,%edx
+  d9:	0f 94 c0             	sete   %al
+  dc:	83 fa 0a             	cmp    $0xa,%edx
+  df:	0f 94 c2             	sete   %dl
+  e2:	09 d0                	or     %edx,%eax
+  e4:	0f b6 c0             	movzbl %al,%eax
+}
+  e7:	c3                   	ret
+  e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	56                   	push   %esi
+  f5:	53                   	push   %ebx
+  f6:	83 ec 1c             	sub    $0x1c,%esp
+  f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(re[0] == '\0')
+  fc:	0f b6 37             	movzbl (%edi),%esi
+  ff:	89 f0                	mov    %esi,%eax
+ 101:	84 c0                	test   %al,%al
+ 103:	0f 84 b7 00 00 00    	je     1c0 <matchhere+0xd0>
+    return 1;
+  if(re[1] == '*')
+ 109:	0f b6 57 01          	movzbl 0x1(%edi),%edx
+ 10d:	80 fa 2a             	cmp    $0x2a,%dl
+ 110:	74 44                	je     156 <matchhere+0x66>
+ 112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return eol(*text);
+ 118:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11b:	0f b6 08             	movzbl (%eax),%ecx
+  return c == '\0' || c == '\n';
+ 11e:	80 f9 0a             	cmp    $0xa,%cl
+ 121:	0f 94 c0             	sete   %al
+ 124:	84 c9                	test   %cl,%cl
+ 126:	0f 94 45 e7          	sete   -0x19(%ebp)
+ 12a:	0f b6 5d e7          	movzbl -0x19(%ebp),%ebx
+ 12e:	09 d8                	or     %ebx,%eax
+  if(re[0] == '$' && re[1] == '\0')
+ 130:	89 f3                	mov    %esi,%ebx
+ 132:	80 fb 24             	cmp    $0x24,%bl
+ 135:	74 61                	je     198 <matchhere+0xa8>
+  if(!eol(*text) && (re[0]=='.' || re[0]==*text))
+ 137:	84 c0                	test   %al,%al
+ 139:	75 79                	jne    1b4 <matchhere+0xc4>
+ 13b:	80 fb 2e             	cmp    $0x2e,%bl
+ 13e:	75 70                	jne    1b0 <matchhere+0xc0>
+    return matchhere(re+1, text+1);
+ 140:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+ 144:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 147:	84 d2                	test   %dl,%dl
+ 149:	74 75                	je     1c0 <matchhere+0xd0>
+ 14b:	89 d6                	mov    %edx,%esi
+  if(re[1] == '*')
+ 14d:	0f b6 57 01          	movzbl 0x1(%edi),%edx
+ 151:	80 fa 2a             	cmp    $0x2a,%dl
+ 154:	75 c2                	jne    118 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 156:	89 f0                	mov    %esi,%eax
+ 158:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15b:	83 c7 02             	add    $0x2,%edi
+ 15e:	0f be f0             	movsbl %al,%esi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 168:	83 ec 08             	sub    $0x8,%esp
+ 16b:	53                   	push   %ebx
+ 16c:	57                   	push   %edi
+ 16d:	e8 7e ff ff ff       	call   f0 <matchhere>
+ 172:	83 c4 10             	add    $0x10,%esp
+ 175:	85 c0                	test   %eax,%eax
+ 177:	75 47                	jne    1c0 <matchhere+0xd0>
+      return 1;
+  }while(!eol(*text) && (*text++==c || c=='.'));
+ 179:	0f be 13             	movsbl (%ebx),%edx
+ 17c:	85 d2                	test   %edx,%edx
+ 17e:	74 45                	je     1c5 <matchhere+0xd5>
+ 180:	83 fa 0a             	cmp    $0xa,%edx
+ 183:	74 40                	je     1c5 <matchhere+0xd5>
+ 185:	83 c3 01             	add    $0x1,%ebx
+ 188:	39 d6                	cmp    %edx,%esi
+ 18a:	74 dc                	je     168 <matchhere+0x78>
+ 18c:	83 fe 2e             	cmp    $0x2e,%esi
+ 18f:	74 d7                	je     168 <matchhere+0x78>
+ 191:	eb 32                	jmp    1c5 <matchhere+0xd5>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+  if(re[0] == '$' && re[1] == '\0')
+ 198:	84 d2                	test   %dl,%dl
+ 19a:	74 31                	je     1cd <matchhere+0xdd>
+  if(!eol(*text) && (re[0]=='.' || re[0]==*text))
+ 19c:	84 c0                	test   %al,%al
+ 19e:	75 14                	jne    1b4 <matchhere+0xc4>
+ 1a0:	80 f9 24             	cmp    $0x24,%cl
+ 1a3:	75 0f                	jne    1b4 <matchhere+0xc4>
+    return matchhere(re+1, text+1);
+ 1a5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+ 1a9:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 1ac:	89 d6                	mov    %edx,%esi
+ 1ae:	eb 9d                	jmp    14d <matchhere+0x5d>
+  if(!eol(*text) && (re[0]=='.' || re[0]==*text))
+ 1b0:	38 d9                	cmp    %bl,%cl
+ 1b2:	74 8c                	je     140 <matchhere+0x50>
+}
+ 1b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 1b7:	31 c0                	xor    %eax,%eax
+}
+ 1b9:	5b                   	pop    %ebx
+ 1ba:	5e                   	pop    %esi
+ 1bb:	5f                   	pop    %edi
+ 1bc:	5d                   	pop    %ebp
+ 1bd:	c3                   	ret
+ 1be:	66 90                	xchg   %ax,%ax
+    return 1;
+ 1c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1c8:	5b                   	pop    %ebx
+ 1c9:	5e                   	pop    %esi
+ 1ca:	5f                   	pop    %edi
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+  return c == '\0' || c == '\n';
+ 1cd:	0f b6 c0             	movzbl %al,%eax
+    return eol(*text);
+ 1d0:	eb f3                	jmp    1c5 <matchhere+0xd5>
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <match>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+ 1e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 1eb:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 1ee:	75 17                	jne    207 <match+0x27>
+ 1f0:	eb 36                	jmp    228 <match+0x48>
+ 1f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(!eol(*text++));
+ 1f8:	0f be 16             	movsbl (%esi),%edx
+ 1fb:	83 c6 01             	add    $0x1,%esi
+ 1fe:	85 d2                	test   %edx,%edx
+ 200:	74 1b                	je     21d <match+0x3d>
+ 202:	83 fa 0a             	cmp    $0xa,%edx
+ 205:	74 16                	je     21d <match+0x3d>
+    if(matchhere(re, text))
+ 207:	83 ec 08             	sub    $0x8,%esp
+ 20a:	56                   	push   %esi
+ 20b:	53                   	push   %ebx
+ 20c:	e8 df fe ff ff       	call   f0 <matchhere>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	85 c0                	test   %eax,%eax
+ 216:	74 e0                	je     1f8 <match+0x18>
+      return 1;
+ 218:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 21d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 220:	5b                   	pop    %ebx
+ 221:	5e                   	pop    %esi
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return matchhere(re+1, text);
+ 228:	83 c3 01             	add    $0x1,%ebx
+ 22b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 22e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 231:	5b                   	pop    %ebx
+ 232:	5e                   	pop    %esi
+ 233:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 234:	e9 b7 fe ff ff       	jmp    f0 <matchhere>
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <grep>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	31 f6                	xor    %esi,%esi
+ 247:	53                   	push   %ebx
+ 248:	83 ec 1c             	sub    $0x1c,%esp
+ 24b:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 24e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 250:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 255:	83 ec 04             	sub    $0x4,%esp
+ 258:	29 f0                	sub    %esi,%eax
+ 25a:	50                   	push   %eax
+ 25b:	8d 86 80 14 00 00    	lea    0x1480(%esi),%eax
+ 261:	50                   	push   %eax
+ 262:	ff 75 0c             	push   0xc(%ebp)
+ 265:	e8 81 04 00 00       	call   6eb <read>
+ 26a:	83 c4 10             	add    $0x10,%esp
+ 26d:	85 c0                	test   %eax,%eax
+ 26f:	0f 8e aa 00 00 00    	jle    31f <grep+0xdf>
+    m += n;
+ 275:	01 c6                	add    %eax,%esi
+    p = buf;
+ 277:	bb 80 14 00 00       	mov    $0x1480,%ebx
+    buf[m] = '\0';
+ 27c:	c6 86 80 14 00 00 00 	movb   $0x0,0x1480(%esi)
+    while((q = strchr(p, '\n')) != 0){
+ 283:	89 75 e0             	mov    %esi,-0x20(%ebp)
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	6a 0a                	push   $0xa
+ 295:	53                   	push   %ebx
+ 296:	e8 d5 02 00 00       	call   570 <strchr>
+ 29b:	83 c4 10             	add    $0x10,%esp
+ 29e:	89 c6                	mov    %eax,%esi
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	74 3c                	je     2e0 <grep+0xa0>
+      if(match(pattern, p)){
+ 2a4:	83 ec 08             	sub    $0x8,%esp
+      *q = 0;
+ 2a7:	c6 06 00             	movb   $0x0,(%esi)
+      if(match(pattern, p)){
+ 2aa:	53                   	push   %ebx
+ 2ab:	57                   	push   %edi
+ 2ac:	e8 2f ff ff ff       	call   1e0 <match>
+ 2b1:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2b4:	8d 4e 01             	lea    0x1(%esi),%ecx
+      if(match(pattern, p)){
+ 2b7:	85 c0                	test   %eax,%eax
+ 2b9:	75 05                	jne    2c0 <grep+0x80>
+      p = q+1;
+ 2bb:	89 cb                	mov    %ecx,%ebx
+ 2bd:	eb d1                	jmp    290 <grep+0x50>
+ 2bf:	90                   	nop
+        write(1, p, q+1 - p);
+ 2c0:	89 c8                	mov    %ecx,%eax
+ 2c2:	83 ec 04             	sub    $0x4,%esp
+ 2c5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 2c8:	29 d8                	sub    %ebx,%eax
+        *q = '\n';
+ 2ca:	c6 06 0a             	movb   $0xa,(%esi)
+        write(1, p, q+1 - p);
+ 2cd:	50                   	push   %eax
+ 2ce:	53                   	push   %ebx
+ 2cf:	6a 01                	push   $0x1
+ 2d1:	e8 1d 04 00 00       	call   6f3 <write>
+ 2d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 2d9:	83 c4 10             	add    $0x10,%esp
+      p = q+1;
+ 2dc:	89 cb                	mov    %ecx,%ebx
+ 2de:	eb b0                	jmp    290 <grep+0x50>
+    if(p == buf)
+ 2e0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+ 2e3:	81 fb 80 14 00 00    	cmp    $0x1480,%ebx
+ 2e9:	74 2d                	je     318 <grep+0xd8>
+    if(m > 0){
+ 2eb:	85 f6                	test   %esi,%esi
+ 2ed:	0f 8e 5d ff ff ff    	jle    250 <grep+0x10>
+      m -= p - buf;
+ 2f3:	89 d8                	mov    %ebx,%eax
+      memmove(buf, p, m);
+ 2f5:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 2f8:	2d 80 14 00 00       	sub    $0x1480,%eax
+ 2fd:	29 c6                	sub    %eax,%esi
+      memmove(buf, p, m);
+ 2ff:	56                   	push   %esi
+ 300:	53                   	push   %ebx
+ 301:	68 80 14 00 00       	push   $0x1480
+ 306:	e8 95 03 00 00       	call   6a0 <memmove>
+ 30b:	83 c4 10             	add    $0x10,%esp
+ 30e:	e9 3d ff ff ff       	jmp    250 <grep+0x10>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+      m = 0;
+ 318:	31 f6                	xor    %esi,%esi
+ 31a:	e9 31 ff ff ff       	jmp    250 <grep+0x10>
+}
+ 31f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 322:	5b                   	pop    %ebx
+ 323:	5e                   	pop    %esi
+ 324:	5f                   	pop    %edi
+ 325:	5d                   	pop    %ebp
+ 326:	c3                   	ret
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <grepmap>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+  if(fstat(fd, &st) < 0 || st.type != T_FILE || st.size == 0)
+ 335:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+ 338:	53                   	push   %ebx
+ 339:	83 ec 44             	sub    $0x44,%esp
+ 33c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fstat(fd, &st) < 0 || st.type != T_FILE || st.size == 0)
+ 33f:	50                   	push   %eax
+ 340:	53                   	push   %ebx
+ 341:	e8 e5 03 00 00       	call   72b <fstat>
+ 346:	83 c4 10             	add    $0x10,%esp
+ 349:	85 c0                	test   %eax,%eax
+ 34b:	0f 88 cb 00 00 00    	js     41c <grepmap+0xec>
+ 351:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+ 356:	0f 85 c0 00 00 00    	jne    41c <grepmap+0xec>
+ 35c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 35f:	85 c0                	test   %eax,%eax
+ 361:	0f 84 b5 00 00 00    	je     41c <grepmap+0xec>
+  if((a = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) == MAP_FAILED)
+ 367:	83 ec 08             	sub    $0x8,%esp
+ 36a:	6a 00                	push   $0x0
+ 36c:	53                   	push   %ebx
+ 36d:	6a 01                	push   $0x1
+ 36f:	6a 01                	push   $0x1
+ 371:	50                   	push   %eax
+ 372:	6a 00                	push   $0x0
+ 374:	e8 a2 04 00 00       	call   81b <mmap>
+ 379:	83 c4 20             	add    $0x20,%esp
+ 37c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 37f:	89 c2                	mov    %eax,%edx
+ 381:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 384:	0f 84 92 00 00 00    	je     41c <grepmap+0xec>
+  end = a + st.size;
+ 38a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(p = a; p < end; p = q+1){
+ 38d:	89 d6                	mov    %edx,%esi
+  end = a + st.size;
+ 38f:	8d 3c 02             	lea    (%edx,%eax,1),%edi
+  for(p = a; p < end; p = q+1){
+ 392:	39 fa                	cmp    %edi,%edx
+ 394:	73 6d                	jae    403 <grepmap+0xd3>
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(q = p; q < end && *q != '\n'; q++)
+ 3a0:	89 f3                	mov    %esi,%ebx
+ 3a2:	39 fe                	cmp    %edi,%esi
+ 3a4:	72 11                	jb     3b7 <grepmap+0x87>
+ 3a6:	eb 14                	jmp    3bc <grepmap+0x8c>
+ 3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+ 3b0:	83 c3 01             	add    $0x1,%ebx
+ 3b3:	39 df                	cmp    %ebx,%edi
+ 3b5:	74 49                	je     400 <grepmap+0xd0>
+ 3b7:	80 3b 0a             	cmpb   $0xa,(%ebx)
+ 3ba:	75 f4                	jne    3b0 <grepmap+0x80>
+    if(q == end)
+ 3bc:	39 df                	cmp    %ebx,%edi
+ 3be:	74 40                	je     400 <grepmap+0xd0>
+    if(match(pattern, p))
+ 3c0:	83 ec 08             	sub    $0x8,%esp
+      write(1, p, q+1 - p);
+ 3c3:	83 c3 01             	add    $0x1,%ebx
+    if(match(pattern, p))
+ 3c6:	56                   	push   %esi
+ 3c7:	ff 75 08             	push   0x8(%ebp)
+ 3ca:	e8 11 fe ff ff       	call   1e0 <match>
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	85 c0                	test   %eax,%eax
+ 3d4:	75 0a                	jne    3e0 <grepmap+0xb0>
+  for(p = a; p < end; p = q+1){
+ 3d6:	39 fb                	cmp    %edi,%ebx
+ 3d8:	73 26                	jae    400 <grepmap+0xd0>
+ 3da:	89 de                	mov    %ebx,%esi
+ 3dc:	eb c2                	jmp    3a0 <grepmap+0x70>
+ 3de:	66 90                	xchg   %ax,%ax
+      write(1, p, q+1 - p);
+ 3e0:	89 d8                	mov    %ebx,%eax
+ 3e2:	83 ec 04             	sub    $0x4,%esp
+ 3e5:	29 f0                	sub    %esi,%eax
+ 3e7:	50                   	push   %eax
+ 3e8:	56                   	push   %esi
+ 3e9:	6a 01                	push   $0x1
+ 3eb:	e8 03 03 00 00       	call   6f3 <write>
+ 3f0:	83 c4 10             	add    $0x10,%esp
+  for(p = a; p < end; p = q+1){
+ 3f3:	39 fb                	cmp    %edi,%ebx
+ 3f5:	72 e3                	jb     3da <grepmap+0xaa>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+  munmap(a, st.size);
+ 400:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 403:	83 ec 08             	sub    $0x8,%esp
+ 406:	50                   	push   %eax
+ 407:	ff 75 c4             	push   -0x3c(%ebp)
+ 40a:	e8 14 04 00 00       	call   823 <munmap>
+  return 0;
+ 40f:	83 c4 10             	add    $0x10,%esp
+ 412:	31 c0                	xor    %eax,%eax
+}
+ 414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 417:	5b                   	pop    %ebx
+ 418:	5e                   	pop    %esi
+ 419:	5f                   	pop    %edi
+ 41a:	5d                   	pop    %ebp
+ 41b:	c3                   	ret
+    return -1;
+ 41c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 421:	eb f1                	jmp    414 <grepmap+0xe4>
+ 423:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <matchstar>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	83 ec 0c             	sub    $0xc,%esp
+ 439:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 43c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 43f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 442:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 448:	83 ec 08             	sub    $0x8,%esp
+ 44b:	57                   	push   %edi
+ 44c:	56                   	push   %esi
+ 44d:	e8 9e fc ff ff       	call   f0 <matchhere>
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	75 27                	jne    480 <matchstar+0x50>
+  }while(!eol(*text) && (*text++==c || c=='.'));
+ 459:	0f be 17             	movsbl (%edi),%edx
+ 45c:	85 d2                	test   %edx,%edx
+ 45e:	74 11                	je     471 <matchstar+0x41>
+ 460:	83 fa 0a             	cmp    $0xa,%edx
+ 463:	74 0c                	je     471 <matchstar+0x41>
+ 465:	83 c7 01             	add    $0x1,%edi
+ 468:	83 fb 2e             	cmp    $0x2e,%ebx
+ 46b:	74 db                	je     448 <matchstar+0x18>
+ 46d:	39 da                	cmp    %ebx,%edx
+ 46f:	74 d7                	je     448 <matchstar+0x18>
+}
+ 471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 474:	5b                   	pop    %ebx
+ 475:	5e                   	pop    %esi
+ 476:	5f                   	pop    %edi
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 480:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 483:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 488:	5b                   	pop    %ebx
+ 489:	5e                   	pop    %esi
+ 48a:	5f                   	pop    %edi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	66 90                	xchg   %ax,%ax
+ 48f:	90                   	nop
+
+00000490 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 490:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 491:	31 c0                	xor    %eax,%eax
+{
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	53                   	push   %ebx
+ 496:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4a7:	83 c0 01             	add    $0x1,%eax
+ 4aa:	84 d2                	test   %dl,%dl
+ 4ac:	75 f2                	jne    4a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b1:	89 c8                	mov    %ecx,%eax
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+ 4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ca:	0f b6 02             	movzbl (%edx),%eax
+ 4cd:	84 c0                	test   %al,%al
+ 4cf:	75 17                	jne    4e8 <strcmp+0x28>
+ 4d1:	eb 3a                	jmp    50d <strcmp+0x4d>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4dc:	83 c2 01             	add    $0x1,%edx
+ 4df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4e2:	84 c0                	test   %al,%al
+ 4e4:	74 1a                	je     500 <strcmp+0x40>
+    p++, q++;
+ 4e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4eb:	38 c3                	cmp    %al,%bl
+ 4ed:	74 e9                	je     4d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4ef:	29 d8                	sub    %ebx,%eax
+}
+ 4f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f4:	c9                   	leave
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 500:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 504:	31 c0                	xor    %eax,%eax
+ 506:	29 d8                	sub    %ebx,%eax
+}
+ 508:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 50b:	c9                   	leave
+ 50c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 50d:	0f b6 19             	movzbl (%ecx),%ebx
+ 510:	31 c0                	xor    %eax,%eax
+ 512:	eb db                	jmp    4ef <strcmp+0x2f>
+ 514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 526:	80 3a 00             	cmpb   $0x0,(%edx)
+ 529:	74 15                	je     540 <strlen+0x20>
+ 52b:	31 c0                	xor    %eax,%eax
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+ 530:	83 c0 01             	add    $0x1,%eax
+ 533:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 537:	89 c1                	mov    %eax,%ecx
+ 539:	75 f5                	jne    530 <strlen+0x10>
+    ;
+  return n;
+}
+ 53b:	89 c8                	mov    %ecx,%eax
+ 53d:	5d                   	pop    %ebp
+ 53e:	c3                   	ret
+ 53f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 540:	31 c9                	xor    %ecx,%ecx
+}
+ 542:	5d                   	pop    %ebp
+ 543:	89 c8                	mov    %ecx,%eax
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 557:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 55a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55d:	89 d7                	mov    %edx,%edi
+ 55f:	fc                   	cld
+ 560:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 562:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	c9                   	leave
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 57a:	0f b6 10             	movzbl (%eax),%edx
+ 57d:	84 d2                	test   %dl,%dl
+ 57f:	75 12                	jne    593 <strchr+0x23>
+ 581:	eb 1d                	jmp    5a0 <strchr+0x30>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 58c:	83 c0 01             	add    $0x1,%eax
+ 58f:	84 d2                	test   %dl,%dl
+ 591:	74 0d                	je     5a0 <strchr+0x30>
+    if(*s == c)
+ 593:	38 d1                	cmp    %dl,%cl
+ 595:	75 f1                	jne    588 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 597:	5d                   	pop    %ebp
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5a0:	31 c0                	xor    %eax,%eax
+}
+ 5a2:	5d                   	pop    %ebp
+ 5a3:	c3                   	ret
+ 5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5b9:	31 db                	xor    %ebx,%ebx
+{
+ 5bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5be:	eb 27                	jmp    5e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	6a 01                	push   $0x1
+ 5c5:	56                   	push   %esi
+ 5c6:	6a 00                	push   $0x0
+ 5c8:	e8 1e 01 00 00       	call   6eb <read>
+    if(cc < 1)
+ 5cd:	83 c4 10             	add    $0x10,%esp
+ 5d0:	85 c0                	test   %eax,%eax
+ 5d2:	7e 1d                	jle    5f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5df:	3c 0a                	cmp    $0xa,%al
+ 5e1:	74 10                	je     5f3 <gets+0x43>
+ 5e3:	3c 0d                	cmp    $0xd,%al
+ 5e5:	74 0c                	je     5f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5e7:	89 df                	mov    %ebx,%edi
+ 5e9:	83 c3 01             	add    $0x1,%ebx
+ 5ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5ef:	7c cf                	jl     5c0 <gets+0x10>
+ 5f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fd:	5b                   	pop    %ebx
+ 5fe:	5e                   	pop    %esi
+ 5ff:	5f                   	pop    %edi
+ 600:	5d                   	pop    %ebp
+ 601:	c3                   	ret
+ 602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	56                   	push   %esi
+ 614:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 615:	83 ec 08             	sub    $0x8,%esp
+ 618:	6a 00                	push   $0x0
+ 61a:	ff 75 08             	push   0x8(%ebp)
+ 61d:	e8 f1 00 00 00       	call   713 <open>
+  if(fd < 0)
+ 622:	83 c4 10             	add    $0x10,%esp
+ 625:	85 c0                	test   %eax,%eax
+ 627:	78 27                	js     650 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 629:	83 ec 08             	sub    $0x8,%esp
+ 62c:	ff 75 0c             	push   0xc(%ebp)
+ 62f:	89 c3                	mov    %eax,%ebx
+ 631:	50                   	push   %eax
+ 632:	e8 f4 00 00 00       	call   72b <fstat>
+  close(fd);
+ 637:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 63a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 63c:	e8 ba 00 00 00       	call   6fb <close>
+  return r;
+ 641:	83 c4 10             	add    $0x10,%esp
+}
+ 644:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 647:	89 f0                	mov    %esi,%eax
+ 649:	5b                   	pop    %ebx
+ 64a:	5e                   	pop    %esi
+ 64b:	5d                   	pop    %ebp
+ 64c:	c3                   	ret
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 650:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 655:	eb ed                	jmp    644 <stat+0x34>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	53                   	push   %ebx
+ 664:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 667:	0f be 02             	movsbl (%edx),%eax
+ 66a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 66d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 670:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 675:	77 1e                	ja     695 <atoi+0x35>
+ 677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 680:	83 c2 01             	add    $0x1,%edx
+ 683:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 686:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 68a:	0f be 02             	movsbl (%edx),%eax
+ 68d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 690:	80 fb 09             	cmp    $0x9,%bl
+ 693:	76 eb                	jbe    680 <atoi+0x20>
+  return n;
+}
+ 695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 698:	89 c8                	mov    %ecx,%eax
+ 69a:	c9                   	leave
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6ae:	85 c0                	test   %eax,%eax
+ 6b0:	7e 13                	jle    6c5 <memmove+0x25>
+ 6b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6b4:	89 d7                	mov    %edx,%edi
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6c1:	39 f8                	cmp    %edi,%eax
+ 6c3:	75 fb                	jne    6c0 <memmove+0x20>
+  return vdst;
+}
+ 6c5:	5e                   	pop    %esi
+ 6c6:	89 d0                	mov    %edx,%eax
+ 6c8:	5f                   	pop    %edi
+ 6c9:	5d                   	pop    %ebp
+ 6ca:	c3                   	ret
+
+000006cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <exit>:
+SYSCALL(exit)
+ 6d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <wait>:
+SYSCALL(wait)
+ 6db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <pipe>:
+SYSCALL(pipe)
+ 6e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <read>:
+SYSCALL(read)
+ 6eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <write>:
+SYSCALL(write)
+ 6f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <close>:
+SYSCALL(close)
+ 6fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <kill>:
+SYSCALL(kill)
+ 703:	b8 06 00 00 00       	mov    $0x6,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <exec>:
+SYSCALL(exec)
+ 70b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <open>:
+SYSCALL(open)
+ 713:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <mknod>:
+SYSCALL(mknod)
+ 71b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <unlink>:
+SYSCALL(unlink)
+ 723:	b8 12 00 00 00       	mov    $0x12,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <fstat>:
+SYSCALL(fstat)
+ 72b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <link>:
+SYSCALL(link)
+ 733:	b8 13 00 00 00       	mov    $0x13,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <mkdir>:
+SYSCALL(mkdir)
+ 73b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <chdir>:
+SYSCALL(chdir)
+ 743:	b8 09 00 00 00       	mov    $0x9,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <dup>:
+SYSCALL(dup)
+ 74b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <getpid>:
+SYSCALL(getpid)
+ 753:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <sbrk>:
+SYSCALL(sbrk)
+ 75b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <sleep>:
+SYSCALL(sleep)
+ 763:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <uptime>:
+SYSCALL(uptime)
+ 76b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 773:	b8 16 00 00 00       	mov    $0x16,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 77b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 783:	b8 18 00 00 00       	mov    $0x18,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 78b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 793:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 79b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 7a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <setpriority>:
+SYSCALL(setpriority)
+ 7ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 7b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <getcpustats>:
+SYSCALL(getcpustats)
+ 7bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <setscheduler>:
+SYSCALL(setscheduler)
+ 7c3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 7cb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <getscheduler>:
+SYSCALL(getscheduler)
+ 7d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <splice>:
+SYSCALL(splice)
+ 7db:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <readv>:
+SYSCALL(readv)
+ 7e3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <writev>:
+SYSCALL(writev)
+ 7eb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <pread>:
+SYSCALL(pread)
+ 7f3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <pwrite>:
+SYSCALL(pwrite)
+ 7fb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <getlogstat>:
+SYSCALL(getlogstat)
+ 803:	b8 28 00 00 00       	mov    $0x28,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <mount>:
+SYSCALL(mount)
+ 80b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <umount>:
+SYSCALL(umount)
+ 813:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <mmap>:
+SYSCALL(mmap)
+ 81b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <munmap>:
+SYSCALL(munmap)
+ 823:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <membench>:
+SYSCALL(membench)
+ 82b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <getlockstat>:
+SYSCALL(getlockstat)
+ 833:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <lockbench>:
+SYSCALL(lockbench)
+ 83b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <prof>:
+SYSCALL(prof)
+ 843:	b8 30 00 00 00       	mov    $0x30,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <tracectl>:
+SYSCALL(tracectl)
+ 84b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <traceread>:
+SYSCALL(traceread)
+ 853:	b8 32 00 00 00       	mov    $0x32,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <getsysstat>:
+SYSCALL(getsysstat)
+ 85b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 863:	b8 34 00 00 00       	mov    $0x34,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <getschedwait>:
+SYSCALL(getschedwait)
+ 86b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <mlfqread>:
+SYSCALL(mlfqread)
+ 873:	b8 36 00 00 00       	mov    $0x36,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <dllock>:
+SYSCALL(dllock)
+ 87b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 883:	b8 38 00 00 00       	mov    $0x38,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 88b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <clone>:
+SYSCALL(clone)
+ 893:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <join>:
+SYSCALL(join)
+ 89b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <futex>:
+SYSCALL(futex)
+ 8a3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <shmat>:
+SYSCALL(shmat)
+ 8ab:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <shmdt>:
+SYSCALL(shmdt)
+ 8b3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <poll>:
+SYSCALL(poll)
+ 8bb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+ 8c3:	66 90                	xchg   %ax,%ax
+ 8c5:	66 90                	xchg   %ax,%ax
+ 8c7:	66 90                	xchg   %ax,%ax
+ 8c9:	66 90                	xchg   %ax,%ax
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 78 0f 00 00 	movzbl 0xf78(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 a6 fd ff ff       	call   6f3 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 3c fd ff ff       	call   6f3 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 20 0f 00 00 	jmp    *0xf20(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 dd fc ff ff       	call   6f3 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 cb fc ff ff       	call   6f3 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 51 fc ff ff       	call   6f3 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 01 fc ff ff       	call   6f3 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 16 0f 00 00       	mov    $0xf16,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b23:	a1 d4 18 00 00       	mov    0x18d4,%eax
+{
+ b28:	89 e5                	mov    %esp,%ebp
+ b2a:	56                   	push   %esi
+ b2b:	53                   	push   %ebx
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b34:	39 ca                	cmp    %ecx,%edx
+ b36:	73 30                	jae    b68 <bigfree+0x48>
+ b38:	39 c1                	cmp    %eax,%ecx
+ b3a:	72 04                	jb     b40 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b3c:	39 c2                	cmp    %eax,%edx
+ b3e:	72 f0                	jb     b30 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b40:	8b 59 04             	mov    0x4(%ecx),%ebx
+ b43:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ b46:	39 f0                	cmp    %esi,%eax
+ b48:	74 26                	je     b70 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b4a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b4c:	8b 42 04             	mov    0x4(%edx),%eax
+ b4f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b52:	39 d9                	cmp    %ebx,%ecx
+ b54:	74 30                	je     b86 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b56:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b58:	5b                   	pop    %ebx
+  freep = p;
+ b59:	89 15 d4 18 00 00    	mov    %edx,0x18d4
+}
+ b5f:	5e                   	pop    %esi
+ b60:	5d                   	pop    %ebp
+ b61:	c3                   	ret
+ b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b68:	39 c1                	cmp    %eax,%ecx
+ b6a:	72 d0                	jb     b3c <bigfree+0x1c>
+ b6c:	eb c2                	jmp    b30 <bigfree+0x10>
+ b6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ b70:	03 58 04             	add    0x4(%eax),%ebx
+ b73:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b76:	8b 02                	mov    (%edx),%eax
+ b78:	8b 00                	mov    (%eax),%eax
+ b7a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ b7c:	8b 42 04             	mov    0x4(%edx),%eax
+ b7f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b82:	39 d9                	cmp    %ebx,%ecx
+ b84:	75 d0                	jne    b56 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ b86:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ b89:	89 15 d4 18 00 00    	mov    %edx,0x18d4
+    p->s.size += bp->s.size;
+ b8f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b92:	8b 09                	mov    (%ecx),%ecx
+ b94:	89 0a                	mov    %ecx,(%edx)
+}
+ b96:	5b                   	pop    %ebx
+ b97:	5e                   	pop    %esi
+ b98:	5d                   	pop    %ebp
+ b99:	c3                   	ret
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ba0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	89 c7                	mov    %eax,%edi
+ ba6:	56                   	push   %esi
+ ba7:	53                   	push   %ebx
+ ba8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ bab:	a1 d4 18 00 00       	mov    0x18d4,%eax
+ bb0:	85 c0                	test   %eax,%eax
+ bb2:	0f 84 88 00 00 00    	je     c40 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ bba:	8b 4a 04             	mov    0x4(%edx),%ecx
+ bbd:	39 f9                	cmp    %edi,%ecx
+ bbf:	73 5f                	jae    c20 <bigalloc+0x80>
+  if(nu < 4096)
+ bc1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bc6:	39 df                	cmp    %ebx,%edi
+ bc8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bcb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bd2:	eb 0d                	jmp    be1 <bigalloc+0x41>
+ bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ bda:	8b 4a 04             	mov    0x4(%edx),%ecx
+ bdd:	39 f9                	cmp    %edi,%ecx
+ bdf:	73 3f                	jae    c20 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ be1:	89 d0                	mov    %edx,%eax
+ be3:	39 15 d4 18 00 00    	cmp    %edx,0x18d4
+ be9:	75 ed                	jne    bd8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ beb:	83 ec 0c             	sub    $0xc,%esp
+ bee:	56                   	push   %esi
+ bef:	e8 67 fb ff ff       	call   75b <sbrk>
+  if(p == (char*)-1)
+ bf4:	83 c4 10             	add    $0x10,%esp
+ bf7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bfa:	74 11                	je     c0d <bigalloc+0x6d>
+  hp->s.size = nu;
+ bfc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ bff:	e8 1c ff ff ff       	call   b20 <bigfree>
+  return freep;
+ c04:	a1 d4 18 00 00       	mov    0x18d4,%eax
+      if((p = morecore(nunits)) == 0)
+ c09:	85 c0                	test   %eax,%eax
+ c0b:	75 cb                	jne    bd8 <bigalloc+0x38>
+        return 0;
+  }
+}
+ c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c10:	31 d2                	xor    %edx,%edx
+}
+ c12:	5b                   	pop    %ebx
+ c13:	89 d0                	mov    %edx,%eax
+ c15:	5e                   	pop    %esi
+ c16:	5f                   	pop    %edi
+ c17:	5d                   	pop    %ebp
+ c18:	c3                   	ret
+ c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ c20:	39 cf                	cmp    %ecx,%edi
+ c22:	74 4c                	je     c70 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ c24:	29 f9                	sub    %edi,%ecx
+ c26:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ c29:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ c2c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ c2f:	a3 d4 18 00 00       	mov    %eax,0x18d4
+}
+ c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c37:	89 d0                	mov    %edx,%eax
+ c39:	5b                   	pop    %ebx
+ c3a:	5e                   	pop    %esi
+ c3b:	5f                   	pop    %edi
+ c3c:	5d                   	pop    %ebp
+ c3d:	c3                   	ret
+ c3e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ c40:	c7 05 d4 18 00 00 d8 	movl   $0x18d8,0x18d4
+ c47:	18 00 00 
+    base.s.size = 0;
+ c4a:	ba d8 18 00 00       	mov    $0x18d8,%edx
+    base.s.ptr = freep = prevp = &base;
+ c4f:	c7 05 d8 18 00 00 d8 	movl   $0x18d8,0x18d8
+ c56:	18 00 00 
+    base.s.size = 0;
+ c59:	c7 05 dc 18 00 00 00 	movl   $0x0,0x18dc
+ c60:	00 00 00 
+    if(p->s.size >= nunits){
+ c63:	e9 59 ff ff ff       	jmp    bc1 <bigalloc+0x21>
+ c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c70:	8b 0a                	mov    (%edx),%ecx
+ c72:	89 08                	mov    %ecx,(%eax)
+ c74:	eb b9                	jmp    c2f <bigalloc+0x8f>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c80 <free>:
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	53                   	push   %ebx
+ c84:	83 ec 04             	sub    $0x4,%esp
+ c87:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ c8a:	85 c9                	test   %ecx,%ecx
+ c8c:	74 58                	je     ce6 <free+0x66>
+  bp = (Header*)ap - 1;
+ c8e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c91:	ba 01 00 00 00       	mov    $0x1,%edx
+ c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+ ca0:	89 d0                	mov    %edx,%eax
+ ca2:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+  while(xchg(&locked, 1) != 0)
+ ca9:	85 c0                	test   %eax,%eax
+ cab:	75 f3                	jne    ca0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ cad:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ cb0:	83 fa 40             	cmp    $0x40,%edx
+ cb3:	77 3b                	ja     cf0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ cb5:	83 fa 02             	cmp    $0x2,%edx
+ cb8:	76 3f                	jbe    cf9 <free+0x79>
+ cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ cc0:	83 c0 01             	add    $0x1,%eax
+ cc3:	39 14 85 a0 0f 00 00 	cmp    %edx,0xfa0(,%eax,4)
+ cca:	72 f4                	jb     cc0 <free+0x40>
+    bp->s.ptr = classfree[c];
+ ccc:	8b 14 85 a0 18 00 00 	mov    0x18a0(,%eax,4),%edx
+    classfree[c] = bp;
+ cd3:	89 1c 85 a0 18 00 00 	mov    %ebx,0x18a0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ cda:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ cdd:	31 c0                	xor    %eax,%eax
+ cdf:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+}
+ ce6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ce9:	c9                   	leave
+ cea:	c3                   	ret
+ ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+    bigfree(bp);
+ cf0:	89 d8                	mov    %ebx,%eax
+ cf2:	e8 29 fe ff ff       	call   b20 <bigfree>
+ cf7:	eb e4                	jmp    cdd <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ cf9:	31 c0                	xor    %eax,%eax
+ cfb:	eb cf                	jmp    ccc <free+0x4c>
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d00:	55                   	push   %ebp
+ d01:	b9 01 00 00 00       	mov    $0x1,%ecx
+ d06:	89 e5                	mov    %esp,%ebp
+ d08:	57                   	push   %edi
+ d09:	56                   	push   %esi
+ d0a:	53                   	push   %ebx
+ d0b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d11:	8d 50 07             	lea    0x7(%eax),%edx
+ d14:	c1 ea 03             	shr    $0x3,%edx
+ d17:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d20:	89 c8                	mov    %ecx,%eax
+ d22:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+ d29:	85 c0                	test   %eax,%eax
+ d2b:	75 f3                	jne    d20 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ d2d:	89 c3                	mov    %eax,%ebx
+ d2f:	83 fa 40             	cmp    $0x40,%edx
+ d32:	77 4c                	ja     d80 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ d34:	be 02 00 00 00       	mov    $0x2,%esi
+ d39:	83 fa 02             	cmp    $0x2,%edx
+ d3c:	76 10                	jbe    d4e <malloc+0x4e>
+ d3e:	66 90                	xchg   %ax,%ax
+ d40:	83 c3 01             	add    $0x1,%ebx
+ d43:	8b 34 9d a0 0f 00 00 	mov    0xfa0(,%ebx,4),%esi
+ d4a:	39 d6                	cmp    %edx,%esi
+ d4c:	72 f2                	jb     d40 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ d4e:	8b 14 9d a0 18 00 00 	mov    0x18a0(,%ebx,4),%edx
+ d55:	85 d2                	test   %edx,%edx
+ d57:	74 47                	je     da0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ d59:	8b 3a                	mov    (%edx),%edi
+ d5b:	89 3c 9d a0 18 00 00 	mov    %edi,0x18a0(,%ebx,4)
+ d62:	31 c0                	xor    %eax,%eax
+ d64:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ d6b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ d6e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ d71:	5b                   	pop    %ebx
+ d72:	5e                   	pop    %esi
+ d73:	5f                   	pop    %edi
+ d74:	5d                   	pop    %ebp
+ d75:	c3                   	ret
+ d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ d80:	89 d0                	mov    %edx,%eax
+ d82:	e8 19 fe ff ff       	call   ba0 <bigalloc>
+ d87:	89 c2                	mov    %eax,%edx
+ d89:	89 d8                	mov    %ebx,%eax
+ d8b:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+  return p ? (void*)(p + 1) : 0;
+ d92:	85 d2                	test   %edx,%edx
+ d94:	75 d5                	jne    d6b <malloc+0x6b>
+ d96:	31 c0                	xor    %eax,%eax
+}
+ d98:	83 c4 1c             	add    $0x1c,%esp
+ d9b:	5b                   	pop    %ebx
+ d9c:	5e                   	pop    %esi
+ d9d:	5f                   	pop    %edi
+ d9e:	5d                   	pop    %ebp
+ d9f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ da0:	b8 00 02 00 00       	mov    $0x200,%eax
+ da5:	e8 f6 fd ff ff       	call   ba0 <bigalloc>
+ daa:	85 c0                	test   %eax,%eax
+ dac:	74 44                	je     df2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ dae:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ db5:	8b 14 9d a0 18 00 00 	mov    0x18a0(,%ebx,4),%edx
+ dbc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ dbf:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ dc2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ dc8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ dcb:	39 cf                	cmp    %ecx,%edi
+ dcd:	72 8a                	jb     d59 <malloc+0x59>
+ dcf:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ dd2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ dd5:	8d 76 00             	lea    0x0(%esi),%esi
+ dd8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ dda:	89 70 04             	mov    %esi,0x4(%eax)
+ ddd:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ ddf:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ de1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ de3:	01 d8                	add    %ebx,%eax
+ de5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ de8:	73 ee                	jae    dd8 <malloc+0xd8>
+ dea:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ ded:	e9 69 ff ff ff       	jmp    d5b <malloc+0x5b>
+ df2:	f0 87 05 80 18 00 00 	lock xchg %eax,0x1880
+  return p ? (void*)(p + 1) : 0;
+ df9:	31 c0                	xor    %eax,%eax
+ dfb:	eb 9b                	jmp    d98 <malloc+0x98>
+ dfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e00 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	56                   	push   %esi
+ e04:	53                   	push   %ebx
+ e05:	8b 45 08             	mov    0x8(%ebp),%eax
+ e08:	f7 65 0c             	mull   0xc(%ebp)
+ e0b:	70 33                	jo     e40 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ e0d:	83 ec 0c             	sub    $0xc,%esp
+ e10:	89 c3                	mov    %eax,%ebx
+ e12:	50                   	push   %eax
+ e13:	e8 e8 fe ff ff       	call   d00 <malloc>
+ e18:	83 c4 10             	add    $0x10,%esp
+ e1b:	89 c6                	mov    %eax,%esi
+ e1d:	85 c0                	test   %eax,%eax
+ e1f:	74 1f                	je     e40 <calloc+0x40>
+    memset(p, 0, n);
+ e21:	83 ec 04             	sub    $0x4,%esp
+ e24:	53                   	push   %ebx
+ e25:	6a 00                	push   $0x0
+ e27:	50                   	push   %eax
+ e28:	e8 23 f7 ff ff       	call   550 <memset>
+ e2d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e33:	89 f0                	mov    %esi,%eax
+ e35:	5b                   	pop    %ebx
+ e36:	5e                   	pop    %esi
+ e37:	5d                   	pop    %ebp
+ e38:	c3                   	ret
+ e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ e43:	31 f6                	xor    %esi,%esi
+}
+ e45:	89 f0                	mov    %esi,%eax
+ e47:	5b                   	pop    %ebx
+ e48:	5e                   	pop    %esi
+ e49:	5d                   	pop    %ebp
+ e4a:	c3                   	ret
+ e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+
+00000e50 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ e50:	55                   	push   %ebp
+ e51:	89 e5                	mov    %esp,%ebp
+ e53:	57                   	push   %edi
+ e54:	56                   	push   %esi
+ e55:	53                   	push   %ebx
+ e56:	83 ec 0c             	sub    $0xc,%esp
+ e59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ e5f:	85 db                	test   %ebx,%ebx
+ e61:	74 55                	je     eb8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ e63:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ e66:	89 de                	mov    %ebx,%esi
+ e68:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ e6f:	39 c7                	cmp    %eax,%edi
+ e71:	72 0d                	jb     e80 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ e73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e76:	89 f0                	mov    %esi,%eax
+ e78:	5b                   	pop    %ebx
+ e79:	5e                   	pop    %esi
+ e7a:	5f                   	pop    %edi
+ e7b:	5d                   	pop    %ebp
+ e7c:	c3                   	ret
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ e80:	83 ec 0c             	sub    $0xc,%esp
+ e83:	50                   	push   %eax
+ e84:	e8 77 fe ff ff       	call   d00 <malloc>
+ e89:	83 c4 10             	add    $0x10,%esp
+ e8c:	89 c6                	mov    %eax,%esi
+ e8e:	85 c0                	test   %eax,%eax
+ e90:	74 e1                	je     e73 <realloc+0x23>
+  memmove(p, ap, have);
+ e92:	83 ec 04             	sub    $0x4,%esp
+ e95:	57                   	push   %edi
+ e96:	53                   	push   %ebx
+ e97:	50                   	push   %eax
+ e98:	e8 03 f8 ff ff       	call   6a0 <memmove>
+  free(ap);
+ e9d:	89 1c 24             	mov    %ebx,(%esp)
+ ea0:	e8 db fd ff ff       	call   c80 <free>
+  return p;
+ ea5:	83 c4 10             	add    $0x10,%esp
+}
+ ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eab:	89 f0                	mov    %esi,%eax
+ ead:	5b                   	pop    %ebx
+ eae:	5e                   	pop    %esi
+ eaf:	5f                   	pop    %edi
+ eb0:	5d                   	pop    %ebp
+ eb1:	c3                   	ret
+ eb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ eb8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ebe:	5b                   	pop    %ebx
+ ebf:	5e                   	pop    %esi
+ ec0:	5f                   	pop    %edi
+ ec1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ ec2:	e9 39 fe ff ff       	jmp    d00 <malloc>
@@ -3,6 +3,7 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "mman.h"
 
 char buf[1024];
 int match(char*, char*);
@@ -35,6 +36,32 @@ grep(char *pattern, int fd)
   }
 }
 
+// Search a regular file by mapping it into memory,
+// which needs no read() calls and no copying.
+// Returns -1 if the file cannot be mapped.
+int
+grepmap(char *pattern, int fd)
+{
+  struct stat st;
+  char *a, *end, *p, *q;
+
+  if(fstat(fd, &st) < 0 || st.type != T_FILE || st.size == 0)
+    return -1;
+  if((a = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) == MAP_FAILED)
+    return -1;
+  end = a + st.size;
+  for(p = a; p < end; p = q+1){
+    for(q = p; q < end && *q != '\n'; q++)
+      ;
+    if(q == end)
+      break;  // like grep(), ignore an unterminated last line
+    if(match(pattern, p))
+      write(1, p, q+1 - p);
+  }
+  munmap(a, st.size);
+  return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -57,7 +84,8 @@ main(int argc, char *argv[])
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    if(grepmap(pattern, fd) < 0)
+      grep(pattern, fd);
     close(fd);
   }
   exit();
@@ -69,6 +97,13 @@ main(int argc, char *argv[])
 int matchhere(char*, char*);
 int matchstar(int, char*, char*);
 
+// Lines end at a nul in buf, or at the newline in a mapped file.
+int
+eol(int c)
+{
+  return c == '\0' || c == '\n';
+}
+
 int
 match(char *re, char *text)
 {
@@ -77,7 +112,7 @@ match(char *re, char *text)
   do{  // must look at empty string
     if(matchhere(re, text))
       return 1;
-  }while(*text++ != '\0');
+  }while(!eol(*text++));
   return 0;
 }
 
@@ -89,8 +124,8 @@ int matchhere(char *re, char *text)
   if(re[1] == '*')
     return matchstar(re[0], re+2, text);
   if(re[0] == '$' && re[1] == '\0')
-    return *text == '\0';
-  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    return eol(*text);
+  if(!eol(*text) && (re[0]=='.' || re[0]==*text))
     return matchhere(re+1, text+1);
   return 0;
 }
@@ -101,7 +136,7 @@ int matchstar(int c, char *re, char *text)
   do{  // a * matches zero or more instances
     if(matchhere(re, text))
       return 1;
-  }while(*text!='\0' && (*text++==c || c=='.'));
+  }while(!eol(*text) && (*text++==c || c=='.'));
   return 0;
 }
 
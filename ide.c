@@ -12,6 +12,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "trace.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -83,6 +84,7 @@ idestart(struct buf *b)
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
+  ktrace(TE_DISKSTART, b->blockno, (b->flags & B_DIRTY) != 0);
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
@@ -113,6 +115,7 @@ ideintr(void)
     return;
   }
   idequeue = b->qnext;
+  ktrace(TE_DISKDONE, b->blockno, (b->flags & B_DIRTY) != 0);
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
@@ -0,0 +1,1775 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 60 0b 00 00       	push   $0xb60
+  19:	e8 85 03 00 00       	call   3a3 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 c5 00 00 00    	js     ee <main+0xee>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 a8 03 00 00       	call   3db <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 9c 03 00 00       	call   3db <dup>
+
+  // Scratch files live in memory.
+  mkdir("/tmp");
+  3f:	c7 04 24 68 0b 00 00 	movl   $0xb68,(%esp)
+  46:	e8 80 03 00 00       	call   3cb <mkdir>
+  if(mount("/tmp") < 0)
+  4b:	c7 04 24 68 0b 00 00 	movl   $0xb68,(%esp)
+  52:	e8 44 04 00 00       	call   49b <mount>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	85 c0                	test   %eax,%eax
+  5c:	78 7a                	js     d8 <main+0xd8>
+  5e:	66 90                	xchg   %ax,%ax
+    printf(1, "init: cannot mount /tmp\n");
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 86 0b 00 00       	push   $0xb86
+  68:	6a 01                	push   $0x1
+  6a:	e8 91 05 00 00       	call   600 <printf>
+    pid = fork();
+  6f:	e8 e7 02 00 00       	call   35b <fork>
+    if(pid < 0){
+  74:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  77:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  79:	85 c0                	test   %eax,%eax
+  7b:	78 24                	js     a1 <main+0xa1>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  7d:	74 35                	je     b4 <main+0xb4>
+  7f:	90                   	nop
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  80:	e8 e6 02 00 00       	call   36b <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	78 d7                	js     60 <main+0x60>
+  89:	39 c3                	cmp    %eax,%ebx
+  8b:	74 d3                	je     60 <main+0x60>
+      printf(1, "zombie!\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 c5 0b 00 00       	push   $0xbc5
+  95:	6a 01                	push   $0x1
+  97:	e8 64 05 00 00       	call   600 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	eb df                	jmp    80 <main+0x80>
+      printf(1, "init: fork failed\n");
+  a1:	53                   	push   %ebx
+  a2:	53                   	push   %ebx
+  a3:	68 99 0b 00 00       	push   $0xb99
+  a8:	6a 01                	push   $0x1
+  aa:	e8 51 05 00 00       	call   600 <printf>
+      exit();
+  af:	e8 af 02 00 00       	call   363 <exit>
+      exec("sh", argv);
+  b4:	50                   	push   %eax
+  b5:	50                   	push   %eax
+  b6:	68 fc 0f 00 00       	push   $0xffc
+  bb:	68 ac 0b 00 00       	push   $0xbac
+  c0:	e8 d6 02 00 00       	call   39b <exec>
+      printf(1, "init: exec sh failed\n");
+  c5:	5a                   	pop    %edx
+  c6:	59                   	pop    %ecx
+  c7:	68 af 0b 00 00       	push   $0xbaf
+  cc:	6a 01                	push   $0x1
+  ce:	e8 2d 05 00 00       	call   600 <printf>
+      exit();
+  d3:	e8 8b 02 00 00       	call   363 <exit>
+    printf(1, "init: cannot mount /tmp\n");
+  d8:	50                   	push   %eax
+  d9:	50                   	push   %eax
+  da:	68 6d 0b 00 00       	push   $0xb6d
+  df:	6a 01                	push   $0x1
+  e1:	e8 1a 05 00 00       	call   600 <printf>
+  e6:	83 c4 10             	add    $0x10,%esp
+  e9:	e9 72 ff ff ff       	jmp    60 <main+0x60>
+    mknod("console", 1, 1);
+  ee:	50                   	push   %eax
+  ef:	6a 01                	push   $0x1
+  f1:	6a 01                	push   $0x1
+  f3:	68 60 0b 00 00       	push   $0xb60
+  f8:	e8 ae 02 00 00       	call   3ab <mknod>
+    open("console", O_RDWR);
+  fd:	58                   	pop    %eax
+  fe:	5a                   	pop    %edx
+  ff:	6a 02                	push   $0x2
+ 101:	68 60 0b 00 00       	push   $0xb60
+ 106:	e8 98 02 00 00       	call   3a3 <open>
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	e9 16 ff ff ff       	jmp    29 <main+0x29>
+ 113:	66 90                	xchg   %ax,%ax
+ 115:	66 90                	xchg   %ax,%ax
+ 117:	66 90                	xchg   %ax,%ax
+ 119:	66 90                	xchg   %ax,%ax
+ 11b:	66 90                	xchg   %ax,%ax
+ 11d:	66 90                	xchg   %ax,%ax
+ 11f:	90                   	nop
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 1e 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 f1 00 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 f4 00 00 00       	call   3bb <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 ba 00 00 00       	call   38b <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 403:	b8 16 00 00 00       	mov    $0x16,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 40b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 413:	b8 18 00 00 00       	mov    $0x18,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 41b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 423:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 42b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <setpriority>:
+SYSCALL(setpriority)
+ 43b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getcpustats>:
+SYSCALL(getcpustats)
+ 44b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <setscheduler>:
+SYSCALL(setscheduler)
+ 453:	b8 20 00 00 00       	mov    $0x20,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 45b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getscheduler>:
+SYSCALL(getscheduler)
+ 463:	b8 22 00 00 00       	mov    $0x22,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <splice>:
+SYSCALL(splice)
+ 46b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <readv>:
+SYSCALL(readv)
+ 473:	b8 24 00 00 00       	mov    $0x24,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <writev>:
+SYSCALL(writev)
+ 47b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <pread>:
+SYSCALL(pread)
+ 483:	b8 26 00 00 00       	mov    $0x26,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <pwrite>:
+SYSCALL(pwrite)
+ 48b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getlogstat>:
+SYSCALL(getlogstat)
+ 493:	b8 28 00 00 00       	mov    $0x28,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mount>:
+SYSCALL(mount)
+ 49b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <umount>:
+SYSCALL(umount)
+ 4a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mmap>:
+SYSCALL(mmap)
+ 4ab:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <munmap>:
+SYSCALL(munmap)
+ 4b3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <membench>:
+SYSCALL(membench)
+ 4bb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getlockstat>:
+SYSCALL(getlockstat)
+ 4c3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <lockbench>:
+SYSCALL(lockbench)
+ 4cb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <prof>:
+SYSCALL(prof)
+ 4d3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <tracectl>:
+SYSCALL(tracectl)
+ 4db:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <traceread>:
+SYSCALL(traceread)
+ 4e3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getsysstat>:
+SYSCALL(getsysstat)
+ 4eb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 4f3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getschedwait>:
+SYSCALL(getschedwait)
+ 4fb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <mlfqread>:
+SYSCALL(mlfqread)
+ 503:	b8 36 00 00 00       	mov    $0x36,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <dllock>:
+SYSCALL(dllock)
+ 50b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 513:	b8 38 00 00 00       	mov    $0x38,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 51b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <clone>:
+SYSCALL(clone)
+ 523:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <join>:
+SYSCALL(join)
+ 52b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <futex>:
+SYSCALL(futex)
+ 533:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <shmat>:
+SYSCALL(shmat)
+ 53b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <shmdt>:
+SYSCALL(shmdt)
+ 543:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <poll>:
+SYSCALL(poll)
+ 54b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+ 553:	66 90                	xchg   %ax,%ax
+ 555:	66 90                	xchg   %ax,%ax
+ 557:	66 90                	xchg   %ax,%ax
+ 559:	66 90                	xchg   %ax,%ax
+ 55b:	66 90                	xchg   %ax,%ax
+ 55d:	66 90                	xchg   %ax,%ax
+ 55f:	90                   	nop
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 568:	89 d1                	mov    %edx,%ecx
+{
+ 56a:	83 ec 3c             	sub    $0x3c,%esp
+ 56d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 570:	85 d2                	test   %edx,%edx
+ 572:	0f 89 80 00 00 00    	jns    5f8 <printint+0x98>
+ 578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 57c:	74 7a                	je     5f8 <printint+0x98>
+    x = -xx;
+ 57e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 588:	31 f6                	xor    %esi,%esi
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 590:	89 c8                	mov    %ecx,%eax
+ 592:	31 d2                	xor    %edx,%edx
+ 594:	89 f7                	mov    %esi,%edi
+ 596:	f7 f3                	div    %ebx
+ 598:	8d 76 01             	lea    0x1(%esi),%esi
+ 59b:	0f b6 92 30 0c 00 00 	movzbl 0xc30(%edx),%edx
+ 5a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5a6:	89 ca                	mov    %ecx,%edx
+ 5a8:	89 c1                	mov    %eax,%ecx
+ 5aa:	39 da                	cmp    %ebx,%edx
+ 5ac:	73 e2                	jae    590 <printint+0x30>
+  if(neg)
+ 5ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 07                	je     5bc <printint+0x5c>
+    buf[i++] = '-';
+ 5b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ba:	89 f7                	mov    %esi,%edi
+ 5bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5c2:	01 df                	add    %ebx,%edi
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	50                   	push   %eax
+ 5d7:	56                   	push   %esi
+ 5d8:	e8 a6 fd ff ff       	call   383 <write>
+  while(--i >= 0)
+ 5dd:	89 f8                	mov    %edi,%eax
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	83 ef 01             	sub    $0x1,%edi
+ 5e5:	39 d8                	cmp    %ebx,%eax
+ 5e7:	75 df                	jne    5c8 <printint+0x68>
+}
+ 5e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5f8:	31 c0                	xor    %eax,%eax
+ 5fa:	eb 89                	jmp    585 <printint+0x25>
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 60c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 60f:	0f b6 1e             	movzbl (%esi),%ebx
+ 612:	83 c6 01             	add    $0x1,%esi
+ 615:	84 db                	test   %bl,%bl
+ 617:	74 67                	je     680 <printf+0x80>
+ 619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 61c:	31 d2                	xor    %edx,%edx
+ 61e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 621:	eb 34                	jmp    657 <printf+0x57>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 62b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 630:	83 f8 25             	cmp    $0x25,%eax
+ 633:	74 18                	je     64d <printf+0x4d>
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63e:	6a 01                	push   $0x1
+ 640:	50                   	push   %eax
+ 641:	57                   	push   %edi
+ 642:	e8 3c fd ff ff       	call   383 <write>
+ 647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 64d:	0f b6 1e             	movzbl (%esi),%ebx
+ 650:	83 c6 01             	add    $0x1,%esi
+ 653:	84 db                	test   %bl,%bl
+ 655:	74 29                	je     680 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 65a:	85 d2                	test   %edx,%edx
+ 65c:	74 ca                	je     628 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 65e:	83 fa 25             	cmp    $0x25,%edx
+ 661:	75 ea                	jne    64d <printf+0x4d>
+      if(c == 'd'){
+ 663:	83 f8 25             	cmp    $0x25,%eax
+ 666:	0f 84 24 01 00 00    	je     790 <printf+0x190>
+ 66c:	83 e8 63             	sub    $0x63,%eax
+ 66f:	83 f8 15             	cmp    $0x15,%eax
+ 672:	77 1c                	ja     690 <printf+0x90>
+ 674:	ff 24 85 d8 0b 00 00 	jmp    *0xbd8(,%eax,4)
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 69a:	6a 01                	push   $0x1
+ 69c:	52                   	push   %edx
+ 69d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6a0:	57                   	push   %edi
+ 6a1:	e8 dd fc ff ff       	call   383 <write>
+ 6a6:	83 c4 0c             	add    $0xc,%esp
+ 6a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6b1:	52                   	push   %edx
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 cb fc ff ff       	call   383 <write>
+        putc(fd, c);
+ 6b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bb:	31 d2                	xor    %edx,%edx
+ 6bd:	eb 8e                	jmp    64d <printf+0x4d>
+ 6bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6d4:	e8 87 fe ff ff       	call   560 <printint>
+        ap++;
+ 6d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6df:	31 d2                	xor    %edx,%edx
+ 6e1:	e9 67 ff ff ff       	jmp    64d <printf+0x4d>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6f5:	83 c0 04             	add    $0x4,%eax
+ 6f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6fb:	85 db                	test   %ebx,%ebx
+ 6fd:	0f 84 9d 00 00 00    	je     7a0 <printf+0x1a0>
+        while(*s != 0){
+ 703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	0f 84 3d ff ff ff    	je     64d <printf+0x4d>
+ 710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 716:	89 de                	mov    %ebx,%esi
+ 718:	89 d3                	mov    %edx,%ebx
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	53                   	push   %ebx
+ 72c:	57                   	push   %edi
+ 72d:	e8 51 fc ff ff       	call   383 <write>
+        while(*s != 0){
+ 732:	0f b6 06             	movzbl (%esi),%eax
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	84 c0                	test   %al,%al
+ 73a:	75 e4                	jne    720 <printf+0x120>
+      state = 0;
+ 73c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 07 ff ff ff       	jmp    64d <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 01                	push   $0x1
+ 75f:	e9 6b ff ff ff       	jmp    6cf <printf+0xcf>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	52                   	push   %edx
+ 77c:	57                   	push   %edi
+ 77d:	e8 01 fc ff ff       	call   383 <write>
+        ap++;
+ 782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 788:	31 d2                	xor    %edx,%edx
+ 78a:	e9 be fe ff ff       	jmp    64d <printf+0x4d>
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 799:	6a 01                	push   $0x1
+ 79b:	e9 11 ff ff ff       	jmp    6b1 <printf+0xb1>
+ 7a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7a5:	bb ce 0b 00 00       	mov    $0xbce,%ebx
+ 7aa:	e9 61 ff ff ff       	jmp    710 <printf+0x110>
+ 7af:	90                   	nop
+
+000007b0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b3:	a1 74 10 00 00       	mov    0x1074,%eax
+{
+ 7b8:	89 e5                	mov    %esp,%ebp
+ 7ba:	56                   	push   %esi
+ 7bb:	53                   	push   %ebx
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c4:	39 ca                	cmp    %ecx,%edx
+ 7c6:	73 30                	jae    7f8 <bigfree+0x48>
+ 7c8:	39 c1                	cmp    %eax,%ecx
+ 7ca:	72 04                	jb     7d0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7cc:	39 c2                	cmp    %eax,%edx
+ 7ce:	72 f0                	jb     7c0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7d0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 7d3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 7d6:	39 f0                	cmp    %esi,%eax
+ 7d8:	74 26                	je     800 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7da:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7dc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7df:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7e2:	39 d9                	cmp    %ebx,%ecx
+ 7e4:	74 30                	je     816 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7e6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e8:	5b                   	pop    %ebx
+  freep = p;
+ 7e9:	89 15 74 10 00 00    	mov    %edx,0x1074
+}
+ 7ef:	5e                   	pop    %esi
+ 7f0:	5d                   	pop    %ebp
+ 7f1:	c3                   	ret
+ 7f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f8:	39 c1                	cmp    %eax,%ecx
+ 7fa:	72 d0                	jb     7cc <bigfree+0x1c>
+ 7fc:	eb c2                	jmp    7c0 <bigfree+0x10>
+ 7fe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 58 04             	add    0x4(%eax),%ebx
+ 803:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 80c:	8b 42 04             	mov    0x4(%edx),%eax
+ 80f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 812:	39 d9                	cmp    %ebx,%ecx
+ 814:	75 d0                	jne    7e6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 816:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 819:	89 15 74 10 00 00    	mov    %edx,0x1074
+    p->s.size += bp->s.size;
+ 81f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 822:	8b 09                	mov    (%ecx),%ecx
+ 824:	89 0a                	mov    %ecx,(%edx)
+}
+ 826:	5b                   	pop    %ebx
+ 827:	5e                   	pop    %esi
+ 828:	5d                   	pop    %ebp
+ 829:	c3                   	ret
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000830 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	89 c7                	mov    %eax,%edi
+ 836:	56                   	push   %esi
+ 837:	53                   	push   %ebx
+ 838:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 83b:	a1 74 10 00 00       	mov    0x1074,%eax
+ 840:	85 c0                	test   %eax,%eax
+ 842:	0f 84 88 00 00 00    	je     8d0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 848:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 84a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 84d:	39 f9                	cmp    %edi,%ecx
+ 84f:	73 5f                	jae    8b0 <bigalloc+0x80>
+  if(nu < 4096)
+ 851:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 856:	39 df                	cmp    %ebx,%edi
+ 858:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 85b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 862:	eb 0d                	jmp    871 <bigalloc+0x41>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 868:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 86a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 86d:	39 f9                	cmp    %edi,%ecx
+ 86f:	73 3f                	jae    8b0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 871:	89 d0                	mov    %edx,%eax
+ 873:	39 15 74 10 00 00    	cmp    %edx,0x1074
+ 879:	75 ed                	jne    868 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 87b:	83 ec 0c             	sub    $0xc,%esp
+ 87e:	56                   	push   %esi
+ 87f:	e8 67 fb ff ff       	call   3eb <sbrk>
+  if(p == (char*)-1)
+ 884:	83 c4 10             	add    $0x10,%esp
+ 887:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 88a:	74 11                	je     89d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 88c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 88f:	e8 1c ff ff ff       	call   7b0 <bigfree>
+  return freep;
+ 894:	a1 74 10 00 00       	mov    0x1074,%eax
+      if((p = morecore(nunits)) == 0)
+ 899:	85 c0                	test   %eax,%eax
+ 89b:	75 cb                	jne    868 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 89d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8a0:	31 d2                	xor    %edx,%edx
+}
+ 8a2:	5b                   	pop    %ebx
+ 8a3:	89 d0                	mov    %edx,%eax
+ 8a5:	5e                   	pop    %esi
+ 8a6:	5f                   	pop    %edi
+ 8a7:	5d                   	pop    %ebp
+ 8a8:	c3                   	ret
+ 8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8b0:	39 cf                	cmp    %ecx,%edi
+ 8b2:	74 4c                	je     900 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 8b4:	29 f9                	sub    %edi,%ecx
+ 8b6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8b9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8bc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8bf:	a3 74 10 00 00       	mov    %eax,0x1074
+}
+ 8c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c7:	89 d0                	mov    %edx,%eax
+ 8c9:	5b                   	pop    %ebx
+ 8ca:	5e                   	pop    %esi
+ 8cb:	5f                   	pop    %edi
+ 8cc:	5d                   	pop    %ebp
+ 8cd:	c3                   	ret
+ 8ce:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 8d0:	c7 05 74 10 00 00 78 	movl   $0x1078,0x1074
+ 8d7:	10 00 00 
+    base.s.size = 0;
+ 8da:	ba 78 10 00 00       	mov    $0x1078,%edx
+    base.s.ptr = freep = prevp = &base;
+ 8df:	c7 05 78 10 00 00 78 	movl   $0x1078,0x1078
+ 8e6:	10 00 00 
+    base.s.size = 0;
+ 8e9:	c7 05 7c 10 00 00 00 	movl   $0x0,0x107c
+ 8f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8f3:	e9 59 ff ff ff       	jmp    851 <bigalloc+0x21>
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 900:	8b 0a                	mov    (%edx),%ecx
+ 902:	89 08                	mov    %ecx,(%eax)
+ 904:	eb b9                	jmp    8bf <bigalloc+0x8f>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <free>:
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	53                   	push   %ebx
+ 914:	83 ec 04             	sub    $0x4,%esp
+ 917:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 91a:	85 c9                	test   %ecx,%ecx
+ 91c:	74 58                	je     976 <free+0x66>
+  bp = (Header*)ap - 1;
+ 91e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 921:	ba 01 00 00 00       	mov    $0x1,%edx
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+ 930:	89 d0                	mov    %edx,%eax
+ 932:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+  while(xchg(&locked, 1) != 0)
+ 939:	85 c0                	test   %eax,%eax
+ 93b:	75 f3                	jne    930 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 93d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 940:	83 fa 40             	cmp    $0x40,%edx
+ 943:	77 3b                	ja     980 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 945:	83 fa 02             	cmp    $0x2,%edx
+ 948:	76 3f                	jbe    989 <free+0x79>
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 950:	83 c0 01             	add    $0x1,%eax
+ 953:	39 14 85 60 0c 00 00 	cmp    %edx,0xc60(,%eax,4)
+ 95a:	72 f4                	jb     950 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 95c:	8b 14 85 40 10 00 00 	mov    0x1040(,%eax,4),%edx
+    classfree[c] = bp;
+ 963:	89 1c 85 40 10 00 00 	mov    %ebx,0x1040(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 96a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 96d:	31 c0                	xor    %eax,%eax
+ 96f:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+}
+ 976:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 979:	c9                   	leave
+ 97a:	c3                   	ret
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+    bigfree(bp);
+ 980:	89 d8                	mov    %ebx,%eax
+ 982:	e8 29 fe ff ff       	call   7b0 <bigfree>
+ 987:	eb e4                	jmp    96d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 989:	31 c0                	xor    %eax,%eax
+ 98b:	eb cf                	jmp    95c <free+0x4c>
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 990:	55                   	push   %ebp
+ 991:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	57                   	push   %edi
+ 999:	56                   	push   %esi
+ 99a:	53                   	push   %ebx
+ 99b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 99e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a1:	8d 50 07             	lea    0x7(%eax),%edx
+ 9a4:	c1 ea 03             	shr    $0x3,%edx
+ 9a7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+ 9b9:	85 c0                	test   %eax,%eax
+ 9bb:	75 f3                	jne    9b0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 9bd:	89 c3                	mov    %eax,%ebx
+ 9bf:	83 fa 40             	cmp    $0x40,%edx
+ 9c2:	77 4c                	ja     a10 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 9c4:	be 02 00 00 00       	mov    $0x2,%esi
+ 9c9:	83 fa 02             	cmp    $0x2,%edx
+ 9cc:	76 10                	jbe    9de <malloc+0x4e>
+ 9ce:	66 90                	xchg   %ax,%ax
+ 9d0:	83 c3 01             	add    $0x1,%ebx
+ 9d3:	8b 34 9d 60 0c 00 00 	mov    0xc60(,%ebx,4),%esi
+ 9da:	39 d6                	cmp    %edx,%esi
+ 9dc:	72 f2                	jb     9d0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 9de:	8b 14 9d 40 10 00 00 	mov    0x1040(,%ebx,4),%edx
+ 9e5:	85 d2                	test   %edx,%edx
+ 9e7:	74 47                	je     a30 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 9e9:	8b 3a                	mov    (%edx),%edi
+ 9eb:	89 3c 9d 40 10 00 00 	mov    %edi,0x1040(,%ebx,4)
+ 9f2:	31 c0                	xor    %eax,%eax
+ 9f4:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 9fb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 9fe:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ a01:	5b                   	pop    %ebx
+ a02:	5e                   	pop    %esi
+ a03:	5f                   	pop    %edi
+ a04:	5d                   	pop    %ebp
+ a05:	c3                   	ret
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ a10:	89 d0                	mov    %edx,%eax
+ a12:	e8 19 fe ff ff       	call   830 <bigalloc>
+ a17:	89 c2                	mov    %eax,%edx
+ a19:	89 d8                	mov    %ebx,%eax
+ a1b:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+  return p ? (void*)(p + 1) : 0;
+ a22:	85 d2                	test   %edx,%edx
+ a24:	75 d5                	jne    9fb <malloc+0x6b>
+ a26:	31 c0                	xor    %eax,%eax
+}
+ a28:	83 c4 1c             	add    $0x1c,%esp
+ a2b:	5b                   	pop    %ebx
+ a2c:	5e                   	pop    %esi
+ a2d:	5f                   	pop    %edi
+ a2e:	5d                   	pop    %ebp
+ a2f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ a30:	b8 00 02 00 00       	mov    $0x200,%eax
+ a35:	e8 f6 fd ff ff       	call   830 <bigalloc>
+ a3a:	85 c0                	test   %eax,%eax
+ a3c:	74 44                	je     a82 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a3e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ a45:	8b 14 9d 40 10 00 00 	mov    0x1040(,%ebx,4),%edx
+ a4c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ a4f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ a52:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ a58:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ a5b:	39 cf                	cmp    %ecx,%edi
+ a5d:	72 8a                	jb     9e9 <malloc+0x59>
+ a5f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ a62:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ a65:	8d 76 00             	lea    0x0(%esi),%esi
+ a68:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ a6a:	89 70 04             	mov    %esi,0x4(%eax)
+ a6d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a6f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ a71:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a73:	01 d8                	add    %ebx,%eax
+ a75:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ a78:	73 ee                	jae    a68 <malloc+0xd8>
+ a7a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ a7d:	e9 69 ff ff ff       	jmp    9eb <malloc+0x5b>
+ a82:	f0 87 05 20 10 00 00 	lock xchg %eax,0x1020
+  return p ? (void*)(p + 1) : 0;
+ a89:	31 c0                	xor    %eax,%eax
+ a8b:	eb 9b                	jmp    a28 <malloc+0x98>
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	53                   	push   %ebx
+ a95:	8b 45 08             	mov    0x8(%ebp),%eax
+ a98:	f7 65 0c             	mull   0xc(%ebp)
+ a9b:	70 33                	jo     ad0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ a9d:	83 ec 0c             	sub    $0xc,%esp
+ aa0:	89 c3                	mov    %eax,%ebx
+ aa2:	50                   	push   %eax
+ aa3:	e8 e8 fe ff ff       	call   990 <malloc>
+ aa8:	83 c4 10             	add    $0x10,%esp
+ aab:	89 c6                	mov    %eax,%esi
+ aad:	85 c0                	test   %eax,%eax
+ aaf:	74 1f                	je     ad0 <calloc+0x40>
+    memset(p, 0, n);
+ ab1:	83 ec 04             	sub    $0x4,%esp
+ ab4:	53                   	push   %ebx
+ ab5:	6a 00                	push   $0x0
+ ab7:	50                   	push   %eax
+ ab8:	e8 23 f7 ff ff       	call   1e0 <memset>
+ abd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ac0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ac3:	89 f0                	mov    %esi,%eax
+ ac5:	5b                   	pop    %ebx
+ ac6:	5e                   	pop    %esi
+ ac7:	5d                   	pop    %ebp
+ ac8:	c3                   	ret
+ ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ad0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ ad3:	31 f6                	xor    %esi,%esi
+}
+ ad5:	89 f0                	mov    %esi,%eax
+ ad7:	5b                   	pop    %ebx
+ ad8:	5e                   	pop    %esi
+ ad9:	5d                   	pop    %ebp
+ ada:	c3                   	ret
+ adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+
+00000ae0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 0c             	sub    $0xc,%esp
+ ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ aec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ aef:	85 db                	test   %ebx,%ebx
+ af1:	74 55                	je     b48 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ af3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ af6:	89 de                	mov    %ebx,%esi
+ af8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ aff:	39 c7                	cmp    %eax,%edi
+ b01:	72 0d                	jb     b10 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b06:	89 f0                	mov    %esi,%eax
+ b08:	5b                   	pop    %ebx
+ b09:	5e                   	pop    %esi
+ b0a:	5f                   	pop    %edi
+ b0b:	5d                   	pop    %ebp
+ b0c:	c3                   	ret
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b10:	83 ec 0c             	sub    $0xc,%esp
+ b13:	50                   	push   %eax
+ b14:	e8 77 fe ff ff       	call   990 <malloc>
+ b19:	83 c4 10             	add    $0x10,%esp
+ b1c:	89 c6                	mov    %eax,%esi
+ b1e:	85 c0                	test   %eax,%eax
+ b20:	74 e1                	je     b03 <realloc+0x23>
+  memmove(p, ap, have);
+ b22:	83 ec 04             	sub    $0x4,%esp
+ b25:	57                   	push   %edi
+ b26:	53                   	push   %ebx
+ b27:	50                   	push   %eax
+ b28:	e8 03 f8 ff ff       	call   330 <memmove>
+  free(ap);
+ b2d:	89 1c 24             	mov    %ebx,(%esp)
+ b30:	e8 db fd ff ff       	call   910 <free>
+  return p;
+ b35:	83 c4 10             	add    $0x10,%esp
+}
+ b38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b3b:	89 f0                	mov    %esi,%eax
+ b3d:	5b                   	pop    %ebx
+ b3e:	5e                   	pop    %esi
+ b3f:	5f                   	pop    %edi
+ b40:	5d                   	pop    %ebp
+ b41:	c3                   	ret
+ b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b48:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b4e:	5b                   	pop    %ebx
+ b4f:	5e                   	pop    %esi
+ b50:	5f                   	pop    %edi
+ b51:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b52:	e9 39 fe ff ff       	jmp    990 <malloc>
@@ -0,0 +1,2295 @@
+
+_iotest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "pipe test ok\n");
+}
+
+int
+main(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 e4 f0             	and    $0xfffffff0,%esp
+  vectortest();
+       6:	e8 15 01 00 00       	call   120 <vectortest>
+  positiontest();
+       b:	e8 60 03 00 00       	call   370 <positiontest>
+  pipetest();
+      10:	e8 eb 04 00 00       	call   500 <pipetest>
+  exit();
+      15:	e8 79 08 00 00       	call   893 <exit>
+      1a:	66 90                	xchg   %ax,%ax
+      1c:	66 90                	xchg   %ax,%ax
+      1e:	66 90                	xchg   %ax,%ax
+
+00000020 <fail>:
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+      23:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "iotest: %s failed\n", msg);
+      26:	ff 75 08             	push   0x8(%ebp)
+      29:	68 a0 10 00 00       	push   $0x10a0
+      2e:	6a 01                	push   $0x1
+      30:	e8 fb 0a 00 00       	call   b30 <printf>
+  exit();
+      35:	e8 59 08 00 00       	call   893 <exit>
+      3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000040 <fill>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	53                   	push   %ebx
+      44:	8b 45 08             	mov    0x8(%ebp),%eax
+      47:	8b 55 0c             	mov    0xc(%ebp),%edx
+    p[i] = seed + i;
+      4a:	0f b6 4d 10          	movzbl 0x10(%ebp),%ecx
+      4e:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+      51:	29 c1                	sub    %eax,%ecx
+  for(i = 0; i < n; i++)
+      53:	85 d2                	test   %edx,%edx
+      55:	7e 16                	jle    6d <fill+0x2d>
+      57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      5e:	66 90                	xchg   %ax,%ax
+    p[i] = seed + i;
+      60:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  for(i = 0; i < n; i++)
+      63:	83 c0 01             	add    $0x1,%eax
+    p[i] = seed + i;
+      66:	88 50 ff             	mov    %dl,-0x1(%eax)
+  for(i = 0; i < n; i++)
+      69:	39 d8                	cmp    %ebx,%eax
+      6b:	75 f3                	jne    60 <fill+0x20>
+}
+      6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      70:	c9                   	leave
+      71:	c3                   	ret
+      72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000080 <same>:
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	53                   	push   %ebx
+  while(n-- > 0)
+      84:	8b 45 0c             	mov    0xc(%ebp),%eax
+      87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+{
+      8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  while(n-- > 0)
+      8d:	01 c3                	add    %eax,%ebx
+      8f:	eb 16                	jmp    a7 <same+0x27>
+      91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(*p++ != *q++)
+      98:	83 c2 01             	add    $0x1,%edx
+      9b:	83 c0 01             	add    $0x1,%eax
+      9e:	0f b6 48 ff          	movzbl -0x1(%eax),%ecx
+      a2:	38 4a ff             	cmp    %cl,-0x1(%edx)
+      a5:	75 19                	jne    c0 <same+0x40>
+  while(n-- > 0)
+      a7:	89 d9                	mov    %ebx,%ecx
+      a9:	29 c1                	sub    %eax,%ecx
+      ab:	85 c9                	test   %ecx,%ecx
+      ad:	7f e9                	jg     98 <same+0x18>
+}
+      af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 1;
+      b2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      b7:	c9                   	leave
+      b8:	c3                   	ret
+      b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+      c3:	31 c0                	xor    %eax,%eax
+}
+      c5:	c9                   	leave
+      c6:	c3                   	ret
+      c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <check>:
+{
+      d0:	55                   	push   %ebp
+      d1:	89 e5                	mov    %esp,%ebp
+      d3:	53                   	push   %ebx
+      d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  for(i = 0; i < n; i++)
+      d7:	85 c9                	test   %ecx,%ecx
+      d9:	7e 2d                	jle    108 <check+0x38>
+      db:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(p[i] != (char)(seed + i))
+      de:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+      e2:	01 c1                	add    %eax,%ecx
+      e4:	29 c3                	sub    %eax,%ebx
+      e6:	eb 0f                	jmp    f7 <check+0x27>
+      e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+  for(i = 0; i < n; i++)
+      f0:	83 c0 01             	add    $0x1,%eax
+      f3:	39 c8                	cmp    %ecx,%eax
+      f5:	74 11                	je     108 <check+0x38>
+    if(p[i] != (char)(seed + i))
+      f7:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      fa:	38 10                	cmp    %dl,(%eax)
+      fc:	74 f2                	je     f0 <check+0x20>
+}
+      fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+     101:	31 c0                	xor    %eax,%eax
+}
+     103:	c9                   	leave
+     104:	c3                   	ret
+     105:	8d 76 00             	lea    0x0(%esi),%esi
+     108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 1;
+     10b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     110:	c9                   	leave
+     111:	c3                   	ret
+     112:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <vectortest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	56                   	push   %esi
+     124:	53                   	push   %ebx
+     125:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "vector test\n");
+     128:	68 b3 10 00 00       	push   $0x10b3
+     12d:	6a 01                	push   $0x1
+     12f:	e8 fc 09 00 00       	call   b30 <printf>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	b8 01 00 00 00       	mov    $0x1,%eax
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seed + i;
+     140:	88 80 1f 1d 00 00    	mov    %al,0x1d1f(%eax)
+  for(i = 0; i < n; i++)
+     146:	83 c0 01             	add    $0x1,%eax
+     149:	3d 59 02 00 00       	cmp    $0x259,%eax
+     14e:	75 f0                	jne    140 <vectortest+0x20>
+     150:	31 c0                	xor    %eax,%eax
+     152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    p[i] = seed + i;
+     158:	8d 50 02             	lea    0x2(%eax),%edx
+  for(i = 0; i < n; i++)
+     15b:	83 c0 01             	add    $0x1,%eax
+    p[i] = seed + i;
+     15e:	88 90 3f 17 00 00    	mov    %dl,0x173f(%eax)
+  for(i = 0; i < n; i++)
+     164:	3d dc 05 00 00       	cmp    $0x5dc,%eax
+     169:	75 ed                	jne    158 <vectortest+0x38>
+    p[i] = seed + i;
+     16b:	0f b7 05 d6 11 00 00 	movzwl 0x11d6,%eax
+  fd = open("iotest.f", O_CREATE|O_RDWR);
+     172:	83 ec 08             	sub    $0x8,%esp
+    p[i] = seed + i;
+     175:	c6 05 22 17 00 00 05 	movb   $0x5,0x1722
+  iov[0].iov_base = a;
+     17c:	c7 45 e0 20 1d 00 00 	movl   $0x1d20,-0x20(%ebp)
+    p[i] = seed + i;
+     183:	66 a3 20 17 00 00    	mov    %ax,0x1720
+  iov[0].iov_len = sizeof(a);
+     189:	c7 45 e4 58 02 00 00 	movl   $0x258,-0x1c(%ebp)
+  iov[1].iov_base = b;
+     190:	c7 45 e8 40 17 00 00 	movl   $0x1740,-0x18(%ebp)
+  iov[1].iov_len = sizeof(b);
+     197:	c7 45 ec dc 05 00 00 	movl   $0x5dc,-0x14(%ebp)
+  iov[2].iov_base = c;
+     19e:	c7 45 f0 20 17 00 00 	movl   $0x1720,-0x10(%ebp)
+  iov[2].iov_len = sizeof(c);
+     1a5:	c7 45 f4 03 00 00 00 	movl   $0x3,-0xc(%ebp)
+  fd = open("iotest.f", O_CREATE|O_RDWR);
+     1ac:	68 02 02 00 00       	push   $0x202
+     1b1:	68 c0 10 00 00       	push   $0x10c0
+     1b6:	e8 18 07 00 00       	call   8d3 <open>
+  if(fd < 0)
+     1bb:	83 c4 10             	add    $0x10,%esp
+  fd = open("iotest.f", O_CREATE|O_RDWR);
+     1be:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+     1c0:	85 c0                	test   %eax,%eax
+     1c2:	0f 88 78 01 00 00    	js     340 <vectortest+0x220>
+  if(writev(fd, iov, 3) != sizeof(a) + sizeof(b) + sizeof(c))
+     1c8:	83 ec 04             	sub    $0x4,%esp
+     1cb:	8d 75 e0             	lea    -0x20(%ebp),%esi
+     1ce:	6a 03                	push   $0x3
+     1d0:	56                   	push   %esi
+     1d1:	50                   	push   %eax
+     1d2:	e8 d4 07 00 00       	call   9ab <writev>
+     1d7:	83 c4 10             	add    $0x10,%esp
+     1da:	3d 37 08 00 00       	cmp    $0x837,%eax
+     1df:	0f 85 75 01 00 00    	jne    35a <vectortest+0x23a>
+  close(fd);
+     1e5:	83 ec 0c             	sub    $0xc,%esp
+     1e8:	53                   	push   %ebx
+     1e9:	e8 cd 06 00 00       	call   8bb <close>
+  memset(a, 0, sizeof(a));
+     1ee:	83 c4 0c             	add    $0xc,%esp
+     1f1:	68 58 02 00 00       	push   $0x258
+     1f6:	6a 00                	push   $0x0
+     1f8:	68 20 1d 00 00       	push   $0x1d20
+     1fd:	e8 0e 05 00 00       	call   710 <memset>
+  memset(b, 0, sizeof(b));
+     202:	83 c4 0c             	add    $0xc,%esp
+     205:	68 dc 05 00 00       	push   $0x5dc
+     20a:	6a 00                	push   $0x0
+     20c:	68 40 17 00 00       	push   $0x1740
+     211:	e8 fa 04 00 00       	call   710 <memset>
+  memset(c, 0, sizeof(c));
+     216:	83 c4 0c             	add    $0xc,%esp
+     219:	6a 03                	push   $0x3
+     21b:	6a 00                	push   $0x0
+     21d:	68 20 17 00 00       	push   $0x1720
+     222:	e8 e9 04 00 00       	call   710 <memset>
+  fd = open("iotest.f", O_RDONLY);
+     227:	59                   	pop    %ecx
+     228:	5b                   	pop    %ebx
+     229:	6a 00                	push   $0x0
+     22b:	68 c0 10 00 00       	push   $0x10c0
+     230:	e8 9e 06 00 00       	call   8d3 <open>
+  if(readv(fd, iov, 3) != sizeof(a) + sizeof(b) + sizeof(c))
+     235:	83 c4 0c             	add    $0xc,%esp
+     238:	6a 03                	push   $0x3
+  fd = open("iotest.f", O_RDONLY);
+     23a:	89 c3                	mov    %eax,%ebx
+  if(readv(fd, iov, 3) != sizeof(a) + sizeof(b) + sizeof(c))
+     23c:	56                   	push   %esi
+     23d:	50                   	push   %eax
+     23e:	e8 60 07 00 00       	call   9a3 <readv>
+     243:	83 c4 10             	add    $0x10,%esp
+     246:	3d 37 08 00 00       	cmp    $0x837,%eax
+     24b:	0f 85 fc 00 00 00    	jne    34d <vectortest+0x22d>
+     251:	b8 01 00 00 00       	mov    $0x1,%eax
+     256:	eb 12                	jmp    26a <vectortest+0x14a>
+     258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25f:	90                   	nop
+  for(i = 0; i < n; i++)
+     260:	83 c0 01             	add    $0x1,%eax
+     263:	3d 59 02 00 00       	cmp    $0x259,%eax
+     268:	74 16                	je     280 <vectortest+0x160>
+    if(p[i] != (char)(seed + i))
+     26a:	38 80 1f 1d 00 00    	cmp    %al,0x1d1f(%eax)
+     270:	74 ee                	je     260 <vectortest+0x140>
+    fail("readv data");
+     272:	83 ec 0c             	sub    $0xc,%esp
+     275:	68 af 11 00 00       	push   $0x11af
+     27a:	e8 a1 fd ff ff       	call   20 <fail>
+     27f:	90                   	nop
+     280:	31 c0                	xor    %eax,%eax
+     282:	eb 0e                	jmp    292 <vectortest+0x172>
+     284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++)
+     288:	83 c0 01             	add    $0x1,%eax
+     28b:	3d dc 05 00 00       	cmp    $0x5dc,%eax
+     290:	74 0e                	je     2a0 <vectortest+0x180>
+    if(p[i] != (char)(seed + i))
+     292:	8d 50 02             	lea    0x2(%eax),%edx
+     295:	3a 90 40 17 00 00    	cmp    0x1740(%eax),%dl
+     29b:	74 eb                	je     288 <vectortest+0x168>
+     29d:	eb d3                	jmp    272 <vectortest+0x152>
+     29f:	90                   	nop
+     2a0:	80 3d 20 17 00 00 03 	cmpb   $0x3,0x1720
+     2a7:	75 c9                	jne    272 <vectortest+0x152>
+     2a9:	80 3d 21 17 00 00 04 	cmpb   $0x4,0x1721
+     2b0:	75 c0                	jne    272 <vectortest+0x152>
+     2b2:	80 3d 22 17 00 00 05 	cmpb   $0x5,0x1722
+     2b9:	75 b7                	jne    272 <vectortest+0x152>
+  if(readv(fd, iov, 3) != 0)
+     2bb:	83 ec 04             	sub    $0x4,%esp
+     2be:	6a 03                	push   $0x3
+     2c0:	56                   	push   %esi
+     2c1:	53                   	push   %ebx
+     2c2:	e8 dc 06 00 00       	call   9a3 <readv>
+     2c7:	83 c4 10             	add    $0x10,%esp
+     2ca:	85 c0                	test   %eax,%eax
+     2cc:	75 4b                	jne    319 <vectortest+0x1f9>
+  if(readv(fd, iov, IOV_MAX+1) >= 0)
+     2ce:	83 ec 04             	sub    $0x4,%esp
+     2d1:	6a 11                	push   $0x11
+     2d3:	56                   	push   %esi
+     2d4:	53                   	push   %ebx
+     2d5:	e8 c9 06 00 00       	call   9a3 <readv>
+     2da:	83 c4 10             	add    $0x10,%esp
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	79 45                	jns    326 <vectortest+0x206>
+  if(readv(fd, iov, 2) >= 0)
+     2e1:	83 ec 04             	sub    $0x4,%esp
+  iov[1].iov_base = (void*)0xffff0000;
+     2e4:	c7 45 e8 00 00 ff ff 	movl   $0xffff0000,-0x18(%ebp)
+  if(readv(fd, iov, 2) >= 0)
+     2eb:	6a 02                	push   $0x2
+     2ed:	56                   	push   %esi
+     2ee:	53                   	push   %ebx
+     2ef:	e8 af 06 00 00       	call   9a3 <readv>
+     2f4:	83 c4 10             	add    $0x10,%esp
+     2f7:	85 c0                	test   %eax,%eax
+     2f9:	79 38                	jns    333 <vectortest+0x213>
+  close(fd);
+     2fb:	83 ec 0c             	sub    $0xc,%esp
+     2fe:	53                   	push   %ebx
+     2ff:	e8 b7 05 00 00       	call   8bb <close>
+  printf(1, "vector test ok\n");
+     304:	58                   	pop    %eax
+     305:	5a                   	pop    %edx
+     306:	68 05 11 00 00       	push   $0x1105
+     30b:	6a 01                	push   $0x1
+     30d:	e8 1e 08 00 00       	call   b30 <printf>
+}
+     312:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     315:	5b                   	pop    %ebx
+     316:	5e                   	pop    %esi
+     317:	5d                   	pop    %ebp
+     318:	c3                   	ret
+    fail("readv at eof");
+     319:	83 ec 0c             	sub    $0xc,%esp
+     31c:	68 d0 10 00 00       	push   $0x10d0
+     321:	e8 fa fc ff ff       	call   20 <fail>
+    fail("readv too many iovecs");
+     326:	83 ec 0c             	sub    $0xc,%esp
+     329:	68 dd 10 00 00       	push   $0x10dd
+     32e:	e8 ed fc ff ff       	call   20 <fail>
+    fail("readv bad address");
+     333:	83 ec 0c             	sub    $0xc,%esp
+     336:	68 f3 10 00 00       	push   $0x10f3
+     33b:	e8 e0 fc ff ff       	call   20 <fail>
+    fail("create");
+     340:	83 ec 0c             	sub    $0xc,%esp
+     343:	68 c9 10 00 00       	push   $0x10c9
+     348:	e8 d3 fc ff ff       	call   20 <fail>
+    fail("readv");
+     34d:	83 ec 0c             	sub    $0xc,%esp
+     350:	68 a4 11 00 00       	push   $0x11a4
+     355:	e8 c6 fc ff ff       	call   20 <fail>
+    fail("writev");
+     35a:	83 ec 0c             	sub    $0xc,%esp
+     35d:	68 98 11 00 00       	push   $0x1198
+     362:	e8 b9 fc ff ff       	call   20 <fail>
+     367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36e:	66 90                	xchg   %ax,%ax
+
+00000370 <positiontest>:
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	56                   	push   %esi
+     374:	53                   	push   %ebx
+     375:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "position test\n");
+     378:	68 15 11 00 00       	push   $0x1115
+     37d:	6a 01                	push   $0x1
+     37f:	e8 ac 07 00 00       	call   b30 <printf>
+  fd = open("iotest.f", O_RDWR);
+     384:	5e                   	pop    %esi
+     385:	58                   	pop    %eax
+     386:	6a 02                	push   $0x2
+     388:	68 c0 10 00 00       	push   $0x10c0
+     38d:	e8 41 05 00 00       	call   8d3 <open>
+  if(fd < 0)
+     392:	83 c4 10             	add    $0x10,%esp
+     395:	85 c0                	test   %eax,%eax
+     397:	0f 88 22 01 00 00    	js     4bf <positiontest+0x14f>
+  if(pwrite(fd, "hello", 5, 1000) != 5)
+     39d:	68 e8 03 00 00       	push   $0x3e8
+     3a2:	89 c3                	mov    %eax,%ebx
+     3a4:	6a 05                	push   $0x5
+     3a6:	68 29 11 00 00       	push   $0x1129
+     3ab:	50                   	push   %eax
+     3ac:	e8 0a 06 00 00       	call   9bb <pwrite>
+     3b1:	83 c4 10             	add    $0x10,%esp
+     3b4:	83 f8 05             	cmp    $0x5,%eax
+     3b7:	0f 85 29 01 00 00    	jne    4e6 <positiontest+0x176>
+  if(pread(fd, buf, 5, 1000) != 5 || !same(buf, "hello", 5))
+     3bd:	8d 75 e8             	lea    -0x18(%ebp),%esi
+     3c0:	68 e8 03 00 00       	push   $0x3e8
+     3c5:	6a 05                	push   $0x5
+     3c7:	56                   	push   %esi
+     3c8:	53                   	push   %ebx
+     3c9:	e8 e5 05 00 00       	call   9b3 <pread>
+     3ce:	83 c4 10             	add    $0x10,%esp
+     3d1:	83 f8 05             	cmp    $0x5,%eax
+     3d4:	0f 85 d8 00 00 00    	jne    4b2 <positiontest+0x142>
+    if(*p++ != *q++)
+     3da:	80 7d e8 68          	cmpb   $0x68,-0x18(%ebp)
+     3de:	0f 85 ce 00 00 00    	jne    4b2 <positiontest+0x142>
+     3e4:	b8 01 00 00 00       	mov    $0x1,%eax
+     3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3f0:	0f b6 14 06          	movzbl (%esi,%eax,1),%edx
+     3f4:	83 c0 01             	add    $0x1,%eax
+     3f7:	3a 90 28 11 00 00    	cmp    0x1128(%eax),%dl
+     3fd:	0f 85 af 00 00 00    	jne    4b2 <positiontest+0x142>
+  while(n-- > 0)
+     403:	83 f8 05             	cmp    $0x5,%eax
+     406:	75 e8                	jne    3f0 <positiontest+0x80>
+  if(read(fd, buf, sizeof(buf)) != sizeof(buf) || !check(buf, sizeof(buf), 1))
+     408:	83 ec 04             	sub    $0x4,%esp
+     40b:	6a 10                	push   $0x10
+     40d:	56                   	push   %esi
+     40e:	53                   	push   %ebx
+     40f:	e8 97 04 00 00       	call   8ab <read>
+     414:	83 c4 10             	add    $0x10,%esp
+     417:	83 f8 10             	cmp    $0x10,%eax
+     41a:	75 1a                	jne    436 <positiontest+0xc6>
+     41c:	b8 01 00 00 00       	mov    $0x1,%eax
+     421:	eb 0d                	jmp    430 <positiontest+0xc0>
+     423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     427:	90                   	nop
+  for(i = 0; i < n; i++)
+     428:	83 c0 01             	add    $0x1,%eax
+     42b:	83 f8 11             	cmp    $0x11,%eax
+     42e:	74 18                	je     448 <positiontest+0xd8>
+    if(p[i] != (char)(seed + i))
+     430:	38 44 05 e7          	cmp    %al,-0x19(%ebp,%eax,1)
+     434:	74 f2                	je     428 <positiontest+0xb8>
+    fail("offset moved");
+     436:	83 ec 0c             	sub    $0xc,%esp
+     439:	68 3c 11 00 00       	push   $0x113c
+     43e:	e8 dd fb ff ff       	call   20 <fail>
+     443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     447:	90                   	nop
+  if(pread(fd, buf, 5, -1) >= 0)
+     448:	6a ff                	push   $0xffffffff
+     44a:	6a 05                	push   $0x5
+     44c:	56                   	push   %esi
+     44d:	53                   	push   %ebx
+     44e:	e8 60 05 00 00       	call   9b3 <pread>
+     453:	83 c4 10             	add    $0x10,%esp
+     456:	85 c0                	test   %eax,%eax
+     458:	79 72                	jns    4cc <positiontest+0x15c>
+  close(fd);
+     45a:	83 ec 0c             	sub    $0xc,%esp
+     45d:	53                   	push   %ebx
+     45e:	e8 58 04 00 00       	call   8bb <close>
+  fd = open("iotest.f", O_RDONLY);
+     463:	59                   	pop    %ecx
+     464:	5b                   	pop    %ebx
+     465:	6a 00                	push   $0x0
+     467:	68 c0 10 00 00       	push   $0x10c0
+     46c:	e8 62 04 00 00       	call   8d3 <open>
+  if(pread(fd, buf, sizeof(buf), sizeof(a) + sizeof(b) + sizeof(c)) != 0)
+     471:	68 37 08 00 00       	push   $0x837
+     476:	6a 10                	push   $0x10
+  fd = open("iotest.f", O_RDONLY);
+     478:	89 c3                	mov    %eax,%ebx
+  if(pread(fd, buf, sizeof(buf), sizeof(a) + sizeof(b) + sizeof(c)) != 0)
+     47a:	56                   	push   %esi
+     47b:	50                   	push   %eax
+     47c:	e8 32 05 00 00       	call   9b3 <pread>
+     481:	83 c4 20             	add    $0x20,%esp
+     484:	85 c0                	test   %eax,%eax
+     486:	75 51                	jne    4d9 <positiontest+0x169>
+  close(fd);
+     488:	83 ec 0c             	sub    $0xc,%esp
+     48b:	53                   	push   %ebx
+     48c:	e8 2a 04 00 00       	call   8bb <close>
+  unlink("iotest.f");
+     491:	c7 04 24 c0 10 00 00 	movl   $0x10c0,(%esp)
+     498:	e8 46 04 00 00       	call   8e3 <unlink>
+  printf(1, "position test ok\n");
+     49d:	58                   	pop    %eax
+     49e:	5a                   	pop    %edx
+     49f:	68 6c 11 00 00       	push   $0x116c
+     4a4:	6a 01                	push   $0x1
+     4a6:	e8 85 06 00 00       	call   b30 <printf>
+}
+     4ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ae:	5b                   	pop    %ebx
+     4af:	5e                   	pop    %esi
+     4b0:	5d                   	pop    %ebp
+     4b1:	c3                   	ret
+    fail("pread");
+     4b2:	83 ec 0c             	sub    $0xc,%esp
+     4b5:	68 36 11 00 00       	push   $0x1136
+     4ba:	e8 61 fb ff ff       	call   20 <fail>
+    fail("open");
+     4bf:	83 ec 0c             	sub    $0xc,%esp
+     4c2:	68 24 11 00 00       	push   $0x1124
+     4c7:	e8 54 fb ff ff       	call   20 <fail>
+    fail("pread negative offset");
+     4cc:	83 ec 0c             	sub    $0xc,%esp
+     4cf:	68 49 11 00 00       	push   $0x1149
+     4d4:	e8 47 fb ff ff       	call   20 <fail>
+    fail("pread at eof");
+     4d9:	83 ec 0c             	sub    $0xc,%esp
+     4dc:	68 5f 11 00 00       	push   $0x115f
+     4e1:	e8 3a fb ff ff       	call   20 <fail>
+    fail("pwrite");
+     4e6:	83 ec 0c             	sub    $0xc,%esp
+     4e9:	68 2f 11 00 00       	push   $0x112f
+     4ee:	e8 2d fb ff ff       	call   20 <fail>
+     4f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000500 <pipetest>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	56                   	push   %esi
+     505:	53                   	push   %ebx
+     506:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "pipe test\n");
+     509:	68 7e 11 00 00       	push   $0x117e
+     50e:	6a 01                	push   $0x1
+     510:	e8 1b 06 00 00       	call   b30 <printf>
+  if(pipe(fds) < 0)
+     515:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     518:	89 04 24             	mov    %eax,(%esp)
+     51b:	e8 83 03 00 00       	call   8a3 <pipe>
+     520:	83 c4 10             	add    $0x10,%esp
+     523:	85 c0                	test   %eax,%eax
+     525:	0f 88 06 01 00 00    	js     631 <pipetest+0x131>
+  if(writev(fds[1], iov, 2) != 8)
+     52b:	83 ec 04             	sub    $0x4,%esp
+     52e:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  iov[0].iov_base = "abc";
+     531:	c7 45 d8 89 11 00 00 	movl   $0x1189,-0x28(%ebp)
+  iov[0].iov_len = 3;
+     538:	c7 45 dc 03 00 00 00 	movl   $0x3,-0x24(%ebp)
+  iov[1].iov_base = "defgh";
+     53f:	c7 45 e0 8d 11 00 00 	movl   $0x118d,-0x20(%ebp)
+  iov[1].iov_len = 5;
+     546:	c7 45 e4 05 00 00 00 	movl   $0x5,-0x1c(%ebp)
+  if(writev(fds[1], iov, 2) != 8)
+     54d:	6a 02                	push   $0x2
+     54f:	57                   	push   %edi
+     550:	ff 75 d4             	push   -0x2c(%ebp)
+     553:	e8 53 04 00 00       	call   9ab <writev>
+     558:	83 c4 10             	add    $0x10,%esp
+     55b:	83 f8 08             	cmp    $0x8,%eax
+     55e:	0f 85 c0 00 00 00    	jne    624 <pipetest+0x124>
+  if(readv(fds[0], iov, 2) != 8)
+     564:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = x;
+     567:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+  iov[1].iov_base = y;
+     56a:	8d 75 cb             	lea    -0x35(%ebp),%esi
+  iov[0].iov_base = x;
+     56d:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  iov[1].iov_base = y;
+     570:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  if(readv(fds[0], iov, 2) != 8)
+     573:	6a 02                	push   $0x2
+     575:	57                   	push   %edi
+     576:	ff 75 d0             	push   -0x30(%ebp)
+     579:	e8 25 04 00 00       	call   9a3 <readv>
+     57e:	83 c4 10             	add    $0x10,%esp
+     581:	83 f8 08             	cmp    $0x8,%eax
+     584:	0f 85 8d 00 00 00    	jne    617 <pipetest+0x117>
+    if(*p++ != *q++)
+     58a:	80 7d c8 61          	cmpb   $0x61,-0x38(%ebp)
+     58e:	75 7a                	jne    60a <pipetest+0x10a>
+     590:	b8 01 00 00 00       	mov    $0x1,%eax
+     595:	8d 76 00             	lea    0x0(%esi),%esi
+     598:	0f b6 88 89 11 00 00 	movzbl 0x1189(%eax),%ecx
+     59f:	8d 50 01             	lea    0x1(%eax),%edx
+     5a2:	38 0c 03             	cmp    %cl,(%ebx,%eax,1)
+     5a5:	75 63                	jne    60a <pipetest+0x10a>
+     5a7:	b8 02 00 00 00       	mov    $0x2,%eax
+  while(n-- > 0)
+     5ac:	83 fa 03             	cmp    $0x3,%edx
+     5af:	75 e7                	jne    598 <pipetest+0x98>
+     5b1:	31 c0                	xor    %eax,%eax
+     5b3:	eb 12                	jmp    5c7 <pipetest+0xc7>
+     5b5:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*p++ != *q++)
+     5b8:	0f b6 14 06          	movzbl (%esi,%eax,1),%edx
+     5bc:	83 c0 01             	add    $0x1,%eax
+     5bf:	3a 90 8c 11 00 00    	cmp    0x118c(%eax),%dl
+     5c5:	75 43                	jne    60a <pipetest+0x10a>
+  while(n-- > 0)
+     5c7:	83 f8 05             	cmp    $0x5,%eax
+     5ca:	75 ec                	jne    5b8 <pipetest+0xb8>
+  if(pread(fds[0], x, 1, 0) >= 0)
+     5cc:	6a 00                	push   $0x0
+     5ce:	6a 01                	push   $0x1
+     5d0:	53                   	push   %ebx
+     5d1:	ff 75 d0             	push   -0x30(%ebp)
+     5d4:	e8 da 03 00 00       	call   9b3 <pread>
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	79 5e                	jns    63e <pipetest+0x13e>
+  close(fds[0]);
+     5e0:	83 ec 0c             	sub    $0xc,%esp
+     5e3:	ff 75 d0             	push   -0x30(%ebp)
+     5e6:	e8 d0 02 00 00       	call   8bb <close>
+  close(fds[1]);
+     5eb:	58                   	pop    %eax
+     5ec:	ff 75 d4             	push   -0x2c(%ebp)
+     5ef:	e8 c7 02 00 00       	call   8bb <close>
+  printf(1, "pipe test ok\n");
+     5f4:	5a                   	pop    %edx
+     5f5:	59                   	pop    %ecx
+     5f6:	68 c8 11 00 00       	push   $0x11c8
+     5fb:	6a 01                	push   $0x1
+     5fd:	e8 2e 05 00 00       	call   b30 <printf>
+}
+     602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     605:	5b                   	pop    %ebx
+     606:	5e                   	pop    %esi
+     607:	5f                   	pop    %edi
+     608:	5d                   	pop    %ebp
+     609:	c3                   	ret
+    fail("pipe readv data");
+     60a:	83 ec 0c             	sub    $0xc,%esp
+     60d:	68 aa 11 00 00       	push   $0x11aa
+     612:	e8 09 fa ff ff       	call   20 <fail>
+    fail("pipe readv");
+     617:	83 ec 0c             	sub    $0xc,%esp
+     61a:	68 9f 11 00 00       	push   $0x119f
+     61f:	e8 fc f9 ff ff       	call   20 <fail>
+    fail("pipe writev");
+     624:	83 ec 0c             	sub    $0xc,%esp
+     627:	68 93 11 00 00       	push   $0x1193
+     62c:	e8 ef f9 ff ff       	call   20 <fail>
+    fail("pipe");
+     631:	83 ec 0c             	sub    $0xc,%esp
+     634:	68 c3 11 00 00       	push   $0x11c3
+     639:	e8 e2 f9 ff ff       	call   20 <fail>
+    fail("pread on pipe");
+     63e:	83 ec 0c             	sub    $0xc,%esp
+     641:	68 ba 11 00 00       	push   $0x11ba
+     646:	e8 d5 f9 ff ff       	call   20 <fail>
+     64b:	66 90                	xchg   %ax,%ax
+     64d:	66 90                	xchg   %ax,%ax
+     64f:	90                   	nop
+
+00000650 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     650:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     651:	31 c0                	xor    %eax,%eax
+{
+     653:	89 e5                	mov    %esp,%ebp
+     655:	53                   	push   %ebx
+     656:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     660:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     664:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     667:	83 c0 01             	add    $0x1,%eax
+     66a:	84 d2                	test   %dl,%dl
+     66c:	75 f2                	jne    660 <strcpy+0x10>
+    ;
+  return os;
+}
+     66e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     671:	89 c8                	mov    %ecx,%eax
+     673:	c9                   	leave
+     674:	c3                   	ret
+     675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	53                   	push   %ebx
+     684:	8b 55 08             	mov    0x8(%ebp),%edx
+     687:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     68a:	0f b6 02             	movzbl (%edx),%eax
+     68d:	84 c0                	test   %al,%al
+     68f:	75 17                	jne    6a8 <strcmp+0x28>
+     691:	eb 3a                	jmp    6cd <strcmp+0x4d>
+     693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     697:	90                   	nop
+     698:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     69c:	83 c2 01             	add    $0x1,%edx
+     69f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6a2:	84 c0                	test   %al,%al
+     6a4:	74 1a                	je     6c0 <strcmp+0x40>
+    p++, q++;
+     6a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6a8:	0f b6 19             	movzbl (%ecx),%ebx
+     6ab:	38 c3                	cmp    %al,%bl
+     6ad:	74 e9                	je     698 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6af:	29 d8                	sub    %ebx,%eax
+}
+     6b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6b4:	c9                   	leave
+     6b5:	c3                   	ret
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6c4:	31 c0                	xor    %eax,%eax
+     6c6:	29 d8                	sub    %ebx,%eax
+}
+     6c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6cb:	c9                   	leave
+     6cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6cd:	0f b6 19             	movzbl (%ecx),%ebx
+     6d0:	31 c0                	xor    %eax,%eax
+     6d2:	eb db                	jmp    6af <strcmp+0x2f>
+     6d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     6e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     6e9:	74 15                	je     700 <strlen+0x20>
+     6eb:	31 c0                	xor    %eax,%eax
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+     6f0:	83 c0 01             	add    $0x1,%eax
+     6f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6f7:	89 c1                	mov    %eax,%ecx
+     6f9:	75 f5                	jne    6f0 <strlen+0x10>
+    ;
+  return n;
+}
+     6fb:	89 c8                	mov    %ecx,%eax
+     6fd:	5d                   	pop    %ebp
+     6fe:	c3                   	ret
+     6ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     700:	31 c9                	xor    %ecx,%ecx
+}
+     702:	5d                   	pop    %ebp
+     703:	89 c8                	mov    %ecx,%eax
+     705:	c3                   	ret
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     717:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     71a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     71d:	89 d7                	mov    %edx,%edi
+     71f:	fc                   	cld
+     720:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     722:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     725:	89 d0                	mov    %edx,%eax
+     727:	c9                   	leave
+     728:	c3                   	ret
+     729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     73a:	0f b6 10             	movzbl (%eax),%edx
+     73d:	84 d2                	test   %dl,%dl
+     73f:	75 12                	jne    753 <strchr+0x23>
+     741:	eb 1d                	jmp    760 <strchr+0x30>
+     743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     747:	90                   	nop
+     748:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     74c:	83 c0 01             	add    $0x1,%eax
+     74f:	84 d2                	test   %dl,%dl
+     751:	74 0d                	je     760 <strchr+0x30>
+    if(*s == c)
+     753:	38 d1                	cmp    %dl,%cl
+     755:	75 f1                	jne    748 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     757:	5d                   	pop    %ebp
+     758:	c3                   	ret
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     760:	31 c0                	xor    %eax,%eax
+}
+     762:	5d                   	pop    %ebp
+     763:	c3                   	ret
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     775:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     778:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     779:	31 db                	xor    %ebx,%ebx
+{
+     77b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     77e:	eb 27                	jmp    7a7 <gets+0x37>
+    cc = read(0, &c, 1);
+     780:	83 ec 04             	sub    $0x4,%esp
+     783:	6a 01                	push   $0x1
+     785:	56                   	push   %esi
+     786:	6a 00                	push   $0x0
+     788:	e8 1e 01 00 00       	call   8ab <read>
+    if(cc < 1)
+     78d:	83 c4 10             	add    $0x10,%esp
+     790:	85 c0                	test   %eax,%eax
+     792:	7e 1d                	jle    7b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     794:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     798:	8b 55 08             	mov    0x8(%ebp),%edx
+     79b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     79f:	3c 0a                	cmp    $0xa,%al
+     7a1:	74 10                	je     7b3 <gets+0x43>
+     7a3:	3c 0d                	cmp    $0xd,%al
+     7a5:	74 0c                	je     7b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     7a7:	89 df                	mov    %ebx,%edi
+     7a9:	83 c3 01             	add    $0x1,%ebx
+     7ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7af:	7c cf                	jl     780 <gets+0x10>
+     7b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     7ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7bd:	5b                   	pop    %ebx
+     7be:	5e                   	pop    %esi
+     7bf:	5f                   	pop    %edi
+     7c0:	5d                   	pop    %ebp
+     7c1:	c3                   	ret
+     7c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	56                   	push   %esi
+     7d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     7d5:	83 ec 08             	sub    $0x8,%esp
+     7d8:	6a 00                	push   $0x0
+     7da:	ff 75 08             	push   0x8(%ebp)
+     7dd:	e8 f1 00 00 00       	call   8d3 <open>
+  if(fd < 0)
+     7e2:	83 c4 10             	add    $0x10,%esp
+     7e5:	85 c0                	test   %eax,%eax
+     7e7:	78 27                	js     810 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     7e9:	83 ec 08             	sub    $0x8,%esp
+     7ec:	ff 75 0c             	push   0xc(%ebp)
+     7ef:	89 c3                	mov    %eax,%ebx
+     7f1:	50                   	push   %eax
+     7f2:	e8 f4 00 00 00       	call   8eb <fstat>
+  close(fd);
+     7f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     7fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7fc:	e8 ba 00 00 00       	call   8bb <close>
+  return r;
+     801:	83 c4 10             	add    $0x10,%esp
+}
+     804:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     807:	89 f0                	mov    %esi,%eax
+     809:	5b                   	pop    %ebx
+     80a:	5e                   	pop    %esi
+     80b:	5d                   	pop    %ebp
+     80c:	c3                   	ret
+     80d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     810:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     815:	eb ed                	jmp    804 <stat+0x34>
+     817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81e:	66 90                	xchg   %ax,%ax
+
+00000820 <atoi>:
+
+int
+atoi(const char *s)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	53                   	push   %ebx
+     824:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     827:	0f be 02             	movsbl (%edx),%eax
+     82a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     82d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     835:	77 1e                	ja     855 <atoi+0x35>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     840:	83 c2 01             	add    $0x1,%edx
+     843:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     846:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     84a:	0f be 02             	movsbl (%edx),%eax
+     84d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     850:	80 fb 09             	cmp    $0x9,%bl
+     853:	76 eb                	jbe    840 <atoi+0x20>
+  return n;
+}
+     855:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     858:	89 c8                	mov    %ecx,%eax
+     85a:	c9                   	leave
+     85b:	c3                   	ret
+     85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	8b 45 10             	mov    0x10(%ebp),%eax
+     868:	8b 55 08             	mov    0x8(%ebp),%edx
+     86b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     86e:	85 c0                	test   %eax,%eax
+     870:	7e 13                	jle    885 <memmove+0x25>
+     872:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     874:	89 d7                	mov    %edx,%edi
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     880:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     881:	39 f8                	cmp    %edi,%eax
+     883:	75 fb                	jne    880 <memmove+0x20>
+  return vdst;
+}
+     885:	5e                   	pop    %esi
+     886:	89 d0                	mov    %edx,%eax
+     888:	5f                   	pop    %edi
+     889:	5d                   	pop    %ebp
+     88a:	c3                   	ret
+
+0000088b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     88b:	b8 01 00 00 00       	mov    $0x1,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <exit>:
+SYSCALL(exit)
+     893:	b8 02 00 00 00       	mov    $0x2,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <wait>:
+SYSCALL(wait)
+     89b:	b8 03 00 00 00       	mov    $0x3,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <pipe>:
+SYSCALL(pipe)
+     8a3:	b8 04 00 00 00       	mov    $0x4,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+
+000008ab <read>:
+SYSCALL(read)
+     8ab:	b8 05 00 00 00       	mov    $0x5,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <write>:
+SYSCALL(write)
+     8b3:	b8 10 00 00 00       	mov    $0x10,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <close>:
+SYSCALL(close)
+     8bb:	b8 15 00 00 00       	mov    $0x15,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <kill>:
+SYSCALL(kill)
+     8c3:	b8 06 00 00 00       	mov    $0x6,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <exec>:
+SYSCALL(exec)
+     8cb:	b8 07 00 00 00       	mov    $0x7,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <open>:
+SYSCALL(open)
+     8d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+
+000008db <mknod>:
+SYSCALL(mknod)
+     8db:	b8 11 00 00 00       	mov    $0x11,%eax
+     8e0:	cd 40                	int    $0x40
+     8e2:	c3                   	ret
+
+000008e3 <unlink>:
+SYSCALL(unlink)
+     8e3:	b8 12 00 00 00       	mov    $0x12,%eax
+     8e8:	cd 40                	int    $0x40
+     8ea:	c3                   	ret
+
+000008eb <fstat>:
+SYSCALL(fstat)
+     8eb:	b8 08 00 00 00       	mov    $0x8,%eax
+     8f0:	cd 40                	int    $0x40
+     8f2:	c3                   	ret
+
+000008f3 <link>:
+SYSCALL(link)
+     8f3:	b8 13 00 00 00       	mov    $0x13,%eax
+     8f8:	cd 40                	int    $0x40
+     8fa:	c3                   	ret
+
+000008fb <mkdir>:
+SYSCALL(mkdir)
+     8fb:	b8 14 00 00 00       	mov    $0x14,%eax
+     900:	cd 40                	int    $0x40
+     902:	c3                   	ret
+
+00000903 <chdir>:
+SYSCALL(chdir)
+     903:	b8 09 00 00 00       	mov    $0x9,%eax
+     908:	cd 40                	int    $0x40
+     90a:	c3                   	ret
+
+0000090b <dup>:
+SYSCALL(dup)
+     90b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     910:	cd 40                	int    $0x40
+     912:	c3                   	ret
+
+00000913 <getpid>:
+SYSCALL(getpid)
+     913:	b8 0b 00 00 00       	mov    $0xb,%eax
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+
+0000091b <sbrk>:
+SYSCALL(sbrk)
+     91b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     920:	cd 40                	int    $0x40
+     922:	c3                   	ret
+
+00000923 <sleep>:
+SYSCALL(sleep)
+     923:	b8 0d 00 00 00       	mov    $0xd,%eax
+     928:	cd 40                	int    $0x40
+     92a:	c3                   	ret
+
+0000092b <uptime>:
+SYSCALL(uptime)
+     92b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <getsysinfo>:
+SYSCALL(getsysinfo)
+     933:	b8 16 00 00 00       	mov    $0x16,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     93b:	b8 17 00 00 00       	mov    $0x17,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     943:	b8 18 00 00 00       	mov    $0x18,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <mlfqstart>:
+SYSCALL(mlfqstart)
+     94b:	b8 19 00 00 00       	mov    $0x19,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <mlfqstop>:
+SYSCALL(mlfqstop)
+     953:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     95b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     963:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <setpriority>:
+SYSCALL(setpriority)
+     96b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     973:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <getcpustats>:
+SYSCALL(getcpustats)
+     97b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <setscheduler>:
+SYSCALL(setscheduler)
+     983:	b8 20 00 00 00       	mov    $0x20,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     98b:	b8 21 00 00 00       	mov    $0x21,%eax
+     990:	cd 40                	int    $0x40
+     992:	c3                   	ret
+
+00000993 <getscheduler>:
+SYSCALL(getscheduler)
+     993:	b8 22 00 00 00       	mov    $0x22,%eax
+     998:	cd 40                	int    $0x40
+     99a:	c3                   	ret
+
+0000099b <splice>:
+SYSCALL(splice)
+     99b:	b8 23 00 00 00       	mov    $0x23,%eax
+     9a0:	cd 40                	int    $0x40
+     9a2:	c3                   	ret
+
+000009a3 <readv>:
+SYSCALL(readv)
+     9a3:	b8 24 00 00 00       	mov    $0x24,%eax
+     9a8:	cd 40                	int    $0x40
+     9aa:	c3                   	ret
+
+000009ab <writev>:
+SYSCALL(writev)
+     9ab:	b8 25 00 00 00       	mov    $0x25,%eax
+     9b0:	cd 40                	int    $0x40
+     9b2:	c3                   	ret
+
+000009b3 <pread>:
+SYSCALL(pread)
+     9b3:	b8 26 00 00 00       	mov    $0x26,%eax
+     9b8:	cd 40                	int    $0x40
+     9ba:	c3                   	ret
+
+000009bb <pwrite>:
+SYSCALL(pwrite)
+     9bb:	b8 27 00 00 00       	mov    $0x27,%eax
+     9c0:	cd 40                	int    $0x40
+     9c2:	c3                   	ret
+
+000009c3 <getlogstat>:
+SYSCALL(getlogstat)
+     9c3:	b8 28 00 00 00       	mov    $0x28,%eax
+     9c8:	cd 40                	int    $0x40
+     9ca:	c3                   	ret
+
+000009cb <mount>:
+SYSCALL(mount)
+     9cb:	b8 29 00 00 00       	mov    $0x29,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <umount>:
+SYSCALL(umount)
+     9d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <mmap>:
+SYSCALL(mmap)
+     9db:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <munmap>:
+SYSCALL(munmap)
+     9e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <membench>:
+SYSCALL(membench)
+     9eb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <getlockstat>:
+SYSCALL(getlockstat)
+     9f3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <lockbench>:
+SYSCALL(lockbench)
+     9fb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <prof>:
+SYSCALL(prof)
+     a03:	b8 30 00 00 00       	mov    $0x30,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <tracectl>:
+SYSCALL(tracectl)
+     a0b:	b8 31 00 00 00       	mov    $0x31,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <traceread>:
+SYSCALL(traceread)
+     a13:	b8 32 00 00 00       	mov    $0x32,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <getsysstat>:
+SYSCALL(getsysstat)
+     a1b:	b8 33 00 00 00       	mov    $0x33,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <getwaitstat>:
+SYSCALL(getwaitstat)
+     a23:	b8 34 00 00 00       	mov    $0x34,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <getschedwait>:
+SYSCALL(getschedwait)
+     a2b:	b8 35 00 00 00       	mov    $0x35,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <mlfqread>:
+SYSCALL(mlfqread)
+     a33:	b8 36 00 00 00       	mov    $0x36,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <dllock>:
+SYSCALL(dllock)
+     a3b:	b8 37 00 00 00       	mov    $0x37,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <watchdogctl>:
+SYSCALL(watchdogctl)
+     a43:	b8 38 00 00 00       	mov    $0x38,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <deadlocklog>:
+SYSCALL(deadlocklog)
+     a4b:	b8 39 00 00 00       	mov    $0x39,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <clone>:
+SYSCALL(clone)
+     a53:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <join>:
+SYSCALL(join)
+     a5b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <futex>:
+SYSCALL(futex)
+     a63:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <shmat>:
+SYSCALL(shmat)
+     a6b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <shmdt>:
+SYSCALL(shmdt)
+     a73:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <poll>:
+SYSCALL(poll)
+     a7b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+     a83:	66 90                	xchg   %ax,%ax
+     a85:	66 90                	xchg   %ax,%ax
+     a87:	66 90                	xchg   %ax,%ax
+     a89:	66 90                	xchg   %ax,%ax
+     a8b:	66 90                	xchg   %ax,%ax
+     a8d:	66 90                	xchg   %ax,%ax
+     a8f:	90                   	nop
+
+00000a90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+     a96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     a98:	89 d1                	mov    %edx,%ecx
+{
+     a9a:	83 ec 3c             	sub    $0x3c,%esp
+     a9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     aa0:	85 d2                	test   %edx,%edx
+     aa2:	0f 89 80 00 00 00    	jns    b28 <printint+0x98>
+     aa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     aac:	74 7a                	je     b28 <printint+0x98>
+    x = -xx;
+     aae:	f7 d9                	neg    %ecx
+    neg = 1;
+     ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ab5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ab8:	31 f6                	xor    %esi,%esi
+     aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     ac0:	89 c8                	mov    %ecx,%eax
+     ac2:	31 d2                	xor    %edx,%edx
+     ac4:	89 f7                	mov    %esi,%edi
+     ac6:	f7 f3                	div    %ebx
+     ac8:	8d 76 01             	lea    0x1(%esi),%esi
+     acb:	0f b6 92 38 12 00 00 	movzbl 0x1238(%edx),%edx
+     ad2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ad6:	89 ca                	mov    %ecx,%edx
+     ad8:	89 c1                	mov    %eax,%ecx
+     ada:	39 da                	cmp    %ebx,%edx
+     adc:	73 e2                	jae    ac0 <printint+0x30>
+  if(neg)
+     ade:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ae1:	85 c0                	test   %eax,%eax
+     ae3:	74 07                	je     aec <printint+0x5c>
+    buf[i++] = '-';
+     ae5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     aea:	89 f7                	mov    %esi,%edi
+     aec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     aef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     af2:	01 df                	add    %ebx,%edi
+     af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     af8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     afb:	83 ec 04             	sub    $0x4,%esp
+     afe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b04:	6a 01                	push   $0x1
+     b06:	50                   	push   %eax
+     b07:	56                   	push   %esi
+     b08:	e8 a6 fd ff ff       	call   8b3 <write>
+  while(--i >= 0)
+     b0d:	89 f8                	mov    %edi,%eax
+     b0f:	83 c4 10             	add    $0x10,%esp
+     b12:	83 ef 01             	sub    $0x1,%edi
+     b15:	39 d8                	cmp    %ebx,%eax
+     b17:	75 df                	jne    af8 <printint+0x68>
+}
+     b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b1c:	5b                   	pop    %ebx
+     b1d:	5e                   	pop    %esi
+     b1e:	5f                   	pop    %edi
+     b1f:	5d                   	pop    %ebp
+     b20:	c3                   	ret
+     b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b28:	31 c0                	xor    %eax,%eax
+     b2a:	eb 89                	jmp    ab5 <printint+0x25>
+     b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	56                   	push   %esi
+     b35:	53                   	push   %ebx
+     b36:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     b39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     b3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     b3f:	0f b6 1e             	movzbl (%esi),%ebx
+     b42:	83 c6 01             	add    $0x1,%esi
+     b45:	84 db                	test   %bl,%bl
+     b47:	74 67                	je     bb0 <printf+0x80>
+     b49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b4c:	31 d2                	xor    %edx,%edx
+     b4e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     b51:	eb 34                	jmp    b87 <printf+0x57>
+     b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b57:	90                   	nop
+     b58:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     b5b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     b60:	83 f8 25             	cmp    $0x25,%eax
+     b63:	74 18                	je     b7d <printf+0x4d>
+  write(fd, &c, 1);
+     b65:	83 ec 04             	sub    $0x4,%esp
+     b68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     b6b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     b6e:	6a 01                	push   $0x1
+     b70:	50                   	push   %eax
+     b71:	57                   	push   %edi
+     b72:	e8 3c fd ff ff       	call   8b3 <write>
+     b77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     b7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     b7d:	0f b6 1e             	movzbl (%esi),%ebx
+     b80:	83 c6 01             	add    $0x1,%esi
+     b83:	84 db                	test   %bl,%bl
+     b85:	74 29                	je     bb0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     b87:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     b8a:	85 d2                	test   %edx,%edx
+     b8c:	74 ca                	je     b58 <printf+0x28>
+      }
+    } else if(state == '%'){
+     b8e:	83 fa 25             	cmp    $0x25,%edx
+     b91:	75 ea                	jne    b7d <printf+0x4d>
+      if(c == 'd'){
+     b93:	83 f8 25             	cmp    $0x25,%eax
+     b96:	0f 84 24 01 00 00    	je     cc0 <printf+0x190>
+     b9c:	83 e8 63             	sub    $0x63,%eax
+     b9f:	83 f8 15             	cmp    $0x15,%eax
+     ba2:	77 1c                	ja     bc0 <printf+0x90>
+     ba4:	ff 24 85 e0 11 00 00 	jmp    *0x11e0(,%eax,4)
+     bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb3:	5b                   	pop    %ebx
+     bb4:	5e                   	pop    %esi
+     bb5:	5f                   	pop    %edi
+     bb6:	5d                   	pop    %ebp
+     bb7:	c3                   	ret
+     bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbf:	90                   	nop
+  write(fd, &c, 1);
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     bc6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     bca:	6a 01                	push   $0x1
+     bcc:	52                   	push   %edx
+     bcd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     bd0:	57                   	push   %edi
+     bd1:	e8 dd fc ff ff       	call   8b3 <write>
+     bd6:	83 c4 0c             	add    $0xc,%esp
+     bd9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     bdc:	6a 01                	push   $0x1
+     bde:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     be1:	52                   	push   %edx
+     be2:	57                   	push   %edi
+     be3:	e8 cb fc ff ff       	call   8b3 <write>
+        putc(fd, c);
+     be8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     beb:	31 d2                	xor    %edx,%edx
+     bed:	eb 8e                	jmp    b7d <printf+0x4d>
+     bef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     bf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     bf3:	83 ec 0c             	sub    $0xc,%esp
+     bf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     bfb:	8b 13                	mov    (%ebx),%edx
+     bfd:	6a 00                	push   $0x0
+     bff:	89 f8                	mov    %edi,%eax
+        ap++;
+     c01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     c04:	e8 87 fe ff ff       	call   a90 <printint>
+        ap++;
+     c09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     c0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c0f:	31 d2                	xor    %edx,%edx
+     c11:	e9 67 ff ff ff       	jmp    b7d <printf+0x4d>
+     c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     c20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     c23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     c25:	83 c0 04             	add    $0x4,%eax
+     c28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     c2b:	85 db                	test   %ebx,%ebx
+     c2d:	0f 84 9d 00 00 00    	je     cd0 <printf+0x1a0>
+        while(*s != 0){
+     c33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     c36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     c38:	84 c0                	test   %al,%al
+     c3a:	0f 84 3d ff ff ff    	je     b7d <printf+0x4d>
+     c40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     c46:	89 de                	mov    %ebx,%esi
+     c48:	89 d3                	mov    %edx,%ebx
+     c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     c50:	83 ec 04             	sub    $0x4,%esp
+     c53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     c56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     c59:	6a 01                	push   $0x1
+     c5b:	53                   	push   %ebx
+     c5c:	57                   	push   %edi
+     c5d:	e8 51 fc ff ff       	call   8b3 <write>
+        while(*s != 0){
+     c62:	0f b6 06             	movzbl (%esi),%eax
+     c65:	83 c4 10             	add    $0x10,%esp
+     c68:	84 c0                	test   %al,%al
+     c6a:	75 e4                	jne    c50 <printf+0x120>
+      state = 0;
+     c6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     c6f:	31 d2                	xor    %edx,%edx
+     c71:	e9 07 ff ff ff       	jmp    b7d <printf+0x4d>
+     c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     c80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c83:	83 ec 0c             	sub    $0xc,%esp
+     c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c8b:	8b 13                	mov    (%ebx),%edx
+     c8d:	6a 01                	push   $0x1
+     c8f:	e9 6b ff ff ff       	jmp    bff <printf+0xcf>
+     c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     c98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     c9b:	83 ec 04             	sub    $0x4,%esp
+     c9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     ca1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     ca3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     ca6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ca9:	6a 01                	push   $0x1
+     cab:	52                   	push   %edx
+     cac:	57                   	push   %edi
+     cad:	e8 01 fc ff ff       	call   8b3 <write>
+        ap++;
+     cb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     cb5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cb8:	31 d2                	xor    %edx,%edx
+     cba:	e9 be fe ff ff       	jmp    b7d <printf+0x4d>
+     cbf:	90                   	nop
+  write(fd, &c, 1);
+     cc0:	83 ec 04             	sub    $0x4,%esp
+     cc3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cc6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     cc9:	6a 01                	push   $0x1
+     ccb:	e9 11 ff ff ff       	jmp    be1 <printf+0xb1>
+     cd0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     cd5:	bb d8 11 00 00       	mov    $0x11d8,%ebx
+     cda:	e9 61 ff ff ff       	jmp    c40 <printf+0x110>
+     cdf:	90                   	nop
+
+00000ce0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ce3:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+{
+     ce8:	89 e5                	mov    %esp,%ebp
+     cea:	56                   	push   %esi
+     ceb:	53                   	push   %ebx
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cf0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cf2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cf4:	39 ca                	cmp    %ecx,%edx
+     cf6:	73 30                	jae    d28 <bigfree+0x48>
+     cf8:	39 c1                	cmp    %eax,%ecx
+     cfa:	72 04                	jb     d00 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cfc:	39 c2                	cmp    %eax,%edx
+     cfe:	72 f0                	jb     cf0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     d00:	8b 59 04             	mov    0x4(%ecx),%ebx
+     d03:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     d06:	39 f0                	cmp    %esi,%eax
+     d08:	74 26                	je     d30 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d0a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     d0c:	8b 42 04             	mov    0x4(%edx),%eax
+     d0f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     d12:	39 d9                	cmp    %ebx,%ecx
+     d14:	74 30                	je     d46 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     d16:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     d18:	5b                   	pop    %ebx
+  freep = p;
+     d19:	89 15 d4 1f 00 00    	mov    %edx,0x1fd4
+}
+     d1f:	5e                   	pop    %esi
+     d20:	5d                   	pop    %ebp
+     d21:	c3                   	ret
+     d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d28:	39 c1                	cmp    %eax,%ecx
+     d2a:	72 d0                	jb     cfc <bigfree+0x1c>
+     d2c:	eb c2                	jmp    cf0 <bigfree+0x10>
+     d2e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     d30:	03 58 04             	add    0x4(%eax),%ebx
+     d33:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d36:	8b 02                	mov    (%edx),%eax
+     d38:	8b 00                	mov    (%eax),%eax
+     d3a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     d3c:	8b 42 04             	mov    0x4(%edx),%eax
+     d3f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     d42:	39 d9                	cmp    %ebx,%ecx
+     d44:	75 d0                	jne    d16 <bigfree+0x36>
+    p->s.size += bp->s.size;
+     d46:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     d49:	89 15 d4 1f 00 00    	mov    %edx,0x1fd4
+    p->s.size += bp->s.size;
+     d4f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     d52:	8b 09                	mov    (%ecx),%ecx
+     d54:	89 0a                	mov    %ecx,(%edx)
+}
+     d56:	5b                   	pop    %ebx
+     d57:	5e                   	pop    %esi
+     d58:	5d                   	pop    %ebp
+     d59:	c3                   	ret
+     d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d60 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	89 c7                	mov    %eax,%edi
+     d66:	56                   	push   %esi
+     d67:	53                   	push   %ebx
+     d68:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     d6b:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+     d70:	85 c0                	test   %eax,%eax
+     d72:	0f 84 88 00 00 00    	je     e00 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     d78:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     d7a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     d7d:	39 f9                	cmp    %edi,%ecx
+     d7f:	73 5f                	jae    de0 <bigalloc+0x80>
+  if(nu < 4096)
+     d81:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     d86:	39 df                	cmp    %ebx,%edi
+     d88:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     d8b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     d92:	eb 0d                	jmp    da1 <bigalloc+0x41>
+     d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     d98:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     d9a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     d9d:	39 f9                	cmp    %edi,%ecx
+     d9f:	73 3f                	jae    de0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     da1:	89 d0                	mov    %edx,%eax
+     da3:	39 15 d4 1f 00 00    	cmp    %edx,0x1fd4
+     da9:	75 ed                	jne    d98 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     dab:	83 ec 0c             	sub    $0xc,%esp
+     dae:	56                   	push   %esi
+     daf:	e8 67 fb ff ff       	call   91b <sbrk>
+  if(p == (char*)-1)
+     db4:	83 c4 10             	add    $0x10,%esp
+     db7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dba:	74 11                	je     dcd <bigalloc+0x6d>
+  hp->s.size = nu;
+     dbc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+     dbf:	e8 1c ff ff ff       	call   ce0 <bigfree>
+  return freep;
+     dc4:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+      if((p = morecore(nunits)) == 0)
+     dc9:	85 c0                	test   %eax,%eax
+     dcb:	75 cb                	jne    d98 <bigalloc+0x38>
+        return 0;
+  }
+}
+     dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     dd0:	31 d2                	xor    %edx,%edx
+}
+     dd2:	5b                   	pop    %ebx
+     dd3:	89 d0                	mov    %edx,%eax
+     dd5:	5e                   	pop    %esi
+     dd6:	5f                   	pop    %edi
+     dd7:	5d                   	pop    %ebp
+     dd8:	c3                   	ret
+     dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     de0:	39 cf                	cmp    %ecx,%edi
+     de2:	74 4c                	je     e30 <bigalloc+0xd0>
+        p->s.size -= nunits;
+     de4:	29 f9                	sub    %edi,%ecx
+     de6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     de9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     dec:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     def:	a3 d4 1f 00 00       	mov    %eax,0x1fd4
+}
+     df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df7:	89 d0                	mov    %edx,%eax
+     df9:	5b                   	pop    %ebx
+     dfa:	5e                   	pop    %esi
+     dfb:	5f                   	pop    %edi
+     dfc:	5d                   	pop    %ebp
+     dfd:	c3                   	ret
+     dfe:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+     e00:	c7 05 d4 1f 00 00 d8 	movl   $0x1fd8,0x1fd4
+     e07:	1f 00 00 
+    base.s.size = 0;
+     e0a:	ba d8 1f 00 00       	mov    $0x1fd8,%edx
+    base.s.ptr = freep = prevp = &base;
+     e0f:	c7 05 d8 1f 00 00 d8 	movl   $0x1fd8,0x1fd8
+     e16:	1f 00 00 
+    base.s.size = 0;
+     e19:	c7 05 dc 1f 00 00 00 	movl   $0x0,0x1fdc
+     e20:	00 00 00 
+    if(p->s.size >= nunits){
+     e23:	e9 59 ff ff ff       	jmp    d81 <bigalloc+0x21>
+     e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     e30:	8b 0a                	mov    (%edx),%ecx
+     e32:	89 08                	mov    %ecx,(%eax)
+     e34:	eb b9                	jmp    def <bigalloc+0x8f>
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <free>:
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	53                   	push   %ebx
+     e44:	83 ec 04             	sub    $0x4,%esp
+     e47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+     e4a:	85 c9                	test   %ecx,%ecx
+     e4c:	74 58                	je     ea6 <free+0x66>
+  bp = (Header*)ap - 1;
+     e4e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     e51:	ba 01 00 00 00       	mov    $0x1,%edx
+     e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5d:	8d 76 00             	lea    0x0(%esi),%esi
+     e60:	89 d0                	mov    %edx,%eax
+     e62:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+  while(xchg(&locked, 1) != 0)
+     e69:	85 c0                	test   %eax,%eax
+     e6b:	75 f3                	jne    e60 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+     e6d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+     e70:	83 fa 40             	cmp    $0x40,%edx
+     e73:	77 3b                	ja     eb0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+     e75:	83 fa 02             	cmp    $0x2,%edx
+     e78:	76 3f                	jbe    eb9 <free+0x79>
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e80:	83 c0 01             	add    $0x1,%eax
+     e83:	39 14 85 60 12 00 00 	cmp    %edx,0x1260(,%eax,4)
+     e8a:	72 f4                	jb     e80 <free+0x40>
+    bp->s.ptr = classfree[c];
+     e8c:	8b 14 85 a0 1f 00 00 	mov    0x1fa0(,%eax,4),%edx
+    classfree[c] = bp;
+     e93:	89 1c 85 a0 1f 00 00 	mov    %ebx,0x1fa0(,%eax,4)
+    bp->s.ptr = classfree[c];
+     e9a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+     e9d:	31 c0                	xor    %eax,%eax
+     e9f:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+}
+     ea6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ea9:	c9                   	leave
+     eaa:	c3                   	ret
+     eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+    bigfree(bp);
+     eb0:	89 d8                	mov    %ebx,%eax
+     eb2:	e8 29 fe ff ff       	call   ce0 <bigfree>
+     eb7:	eb e4                	jmp    e9d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+     eb9:	31 c0                	xor    %eax,%eax
+     ebb:	eb cf                	jmp    e8c <free+0x4c>
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ec0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	b9 01 00 00 00       	mov    $0x1,%ecx
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	57                   	push   %edi
+     ec9:	56                   	push   %esi
+     eca:	53                   	push   %ebx
+     ecb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ece:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed1:	8d 50 07             	lea    0x7(%eax),%edx
+     ed4:	c1 ea 03             	shr    $0x3,%edx
+     ed7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     ee0:	89 c8                	mov    %ecx,%eax
+     ee2:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+     ee9:	85 c0                	test   %eax,%eax
+     eeb:	75 f3                	jne    ee0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+     eed:	89 c3                	mov    %eax,%ebx
+     eef:	83 fa 40             	cmp    $0x40,%edx
+     ef2:	77 4c                	ja     f40 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+     ef4:	be 02 00 00 00       	mov    $0x2,%esi
+     ef9:	83 fa 02             	cmp    $0x2,%edx
+     efc:	76 10                	jbe    f0e <malloc+0x4e>
+     efe:	66 90                	xchg   %ax,%ax
+     f00:	83 c3 01             	add    $0x1,%ebx
+     f03:	8b 34 9d 60 12 00 00 	mov    0x1260(,%ebx,4),%esi
+     f0a:	39 d6                	cmp    %edx,%esi
+     f0c:	72 f2                	jb     f00 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+     f0e:	8b 14 9d a0 1f 00 00 	mov    0x1fa0(,%ebx,4),%edx
+     f15:	85 d2                	test   %edx,%edx
+     f17:	74 47                	je     f60 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+     f19:	8b 3a                	mov    (%edx),%edi
+     f1b:	89 3c 9d a0 1f 00 00 	mov    %edi,0x1fa0(,%ebx,4)
+     f22:	31 c0                	xor    %eax,%eax
+     f24:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+     f2b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+     f2e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+     f31:	5b                   	pop    %ebx
+     f32:	5e                   	pop    %esi
+     f33:	5f                   	pop    %edi
+     f34:	5d                   	pop    %ebp
+     f35:	c3                   	ret
+     f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+     f40:	89 d0                	mov    %edx,%eax
+     f42:	e8 19 fe ff ff       	call   d60 <bigalloc>
+     f47:	89 c2                	mov    %eax,%edx
+     f49:	89 d8                	mov    %ebx,%eax
+     f4b:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+  return p ? (void*)(p + 1) : 0;
+     f52:	85 d2                	test   %edx,%edx
+     f54:	75 d5                	jne    f2b <malloc+0x6b>
+     f56:	31 c0                	xor    %eax,%eax
+}
+     f58:	83 c4 1c             	add    $0x1c,%esp
+     f5b:	5b                   	pop    %ebx
+     f5c:	5e                   	pop    %esi
+     f5d:	5f                   	pop    %edi
+     f5e:	5d                   	pop    %ebp
+     f5f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+     f60:	b8 00 02 00 00       	mov    $0x200,%eax
+     f65:	e8 f6 fd ff ff       	call   d60 <bigalloc>
+     f6a:	85 c0                	test   %eax,%eax
+     f6c:	74 44                	je     fb2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+     f6e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+     f75:	8b 14 9d a0 1f 00 00 	mov    0x1fa0(,%ebx,4),%edx
+     f7c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+     f7f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+     f82:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+     f88:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     f8b:	39 cf                	cmp    %ecx,%edi
+     f8d:	72 8a                	jb     f19 <malloc+0x59>
+     f8f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+     f92:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     f95:	8d 76 00             	lea    0x0(%esi),%esi
+     f98:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+     f9a:	89 70 04             	mov    %esi,0x4(%eax)
+     f9d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+     f9f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+     fa1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+     fa3:	01 d8                	add    %ebx,%eax
+     fa5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+     fa8:	73 ee                	jae    f98 <malloc+0xd8>
+     faa:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+     fad:	e9 69 ff ff ff       	jmp    f1b <malloc+0x5b>
+     fb2:	f0 87 05 80 1f 00 00 	lock xchg %eax,0x1f80
+  return p ? (void*)(p + 1) : 0;
+     fb9:	31 c0                	xor    %eax,%eax
+     fbb:	eb 9b                	jmp    f58 <malloc+0x98>
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fc0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	56                   	push   %esi
+     fc4:	53                   	push   %ebx
+     fc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc8:	f7 65 0c             	mull   0xc(%ebp)
+     fcb:	70 33                	jo     1000 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+     fcd:	83 ec 0c             	sub    $0xc,%esp
+     fd0:	89 c3                	mov    %eax,%ebx
+     fd2:	50                   	push   %eax
+     fd3:	e8 e8 fe ff ff       	call   ec0 <malloc>
+     fd8:	83 c4 10             	add    $0x10,%esp
+     fdb:	89 c6                	mov    %eax,%esi
+     fdd:	85 c0                	test   %eax,%eax
+     fdf:	74 1f                	je     1000 <calloc+0x40>
+    memset(p, 0, n);
+     fe1:	83 ec 04             	sub    $0x4,%esp
+     fe4:	53                   	push   %ebx
+     fe5:	6a 00                	push   $0x0
+     fe7:	50                   	push   %eax
+     fe8:	e8 23 f7 ff ff       	call   710 <memset>
+     fed:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+     ff0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ff3:	89 f0                	mov    %esi,%eax
+     ff5:	5b                   	pop    %ebx
+     ff6:	5e                   	pop    %esi
+     ff7:	5d                   	pop    %ebp
+     ff8:	c3                   	ret
+     ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1000:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1003:	31 f6                	xor    %esi,%esi
+}
+    1005:	89 f0                	mov    %esi,%eax
+    1007:	5b                   	pop    %ebx
+    1008:	5e                   	pop    %esi
+    1009:	5d                   	pop    %ebp
+    100a:	c3                   	ret
+    100b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+
+00001010 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	53                   	push   %ebx
+    1016:	83 ec 0c             	sub    $0xc,%esp
+    1019:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    101c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    101f:	85 db                	test   %ebx,%ebx
+    1021:	74 55                	je     1078 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1023:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1026:	89 de                	mov    %ebx,%esi
+    1028:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    102f:	39 c7                	cmp    %eax,%edi
+    1031:	72 0d                	jb     1040 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1036:	89 f0                	mov    %esi,%eax
+    1038:	5b                   	pop    %ebx
+    1039:	5e                   	pop    %esi
+    103a:	5f                   	pop    %edi
+    103b:	5d                   	pop    %ebp
+    103c:	c3                   	ret
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	50                   	push   %eax
+    1044:	e8 77 fe ff ff       	call   ec0 <malloc>
+    1049:	83 c4 10             	add    $0x10,%esp
+    104c:	89 c6                	mov    %eax,%esi
+    104e:	85 c0                	test   %eax,%eax
+    1050:	74 e1                	je     1033 <realloc+0x23>
+  memmove(p, ap, have);
+    1052:	83 ec 04             	sub    $0x4,%esp
+    1055:	57                   	push   %edi
+    1056:	53                   	push   %ebx
+    1057:	50                   	push   %eax
+    1058:	e8 03 f8 ff ff       	call   860 <memmove>
+  free(ap);
+    105d:	89 1c 24             	mov    %ebx,(%esp)
+    1060:	e8 db fd ff ff       	call   e40 <free>
+  return p;
+    1065:	83 c4 10             	add    $0x10,%esp
+}
+    1068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    106b:	89 f0                	mov    %esi,%eax
+    106d:	5b                   	pop    %ebx
+    106e:	5e                   	pop    %esi
+    106f:	5f                   	pop    %edi
+    1070:	5d                   	pop    %ebp
+    1071:	c3                   	ret
+    1072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1078:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    107b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    107e:	5b                   	pop    %ebx
+    107f:	5e                   	pop    %esi
+    1080:	5f                   	pop    %edi
+    1081:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1082:	e9 39 fe ff ff       	jmp    ec0 <malloc>
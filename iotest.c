@@ -0,0 +1,160 @@
+// Tests for readv(), writev(), pread() and pwrite().
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "uio.h"
+
+char a[600], b[1500], c[3];
+
+void
+fail(char *msg)
+{
+  printf(1, "iotest: %s failed\n", msg);
+  exit();
+}
+
+void
+fill(char *p, int n, int seed)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    p[i] = seed + i;
+}
+
+int
+same(char *p, char *q, int n)
+{
+  while(n-- > 0)
+    if(*p++ != *q++)
+      return 0;
+  return 1;
+}
+
+int
+check(char *p, int n, int seed)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(p[i] != (char)(seed + i))
+      return 0;
+  return 1;
+}
+
+void
+vectortest(void)
+{
+  struct iovec iov[3];
+  int fd;
+
+  printf(1, "vector test\n");
+  fill(a, sizeof(a), 1);
+  fill(b, sizeof(b), 2);
+  fill(c, sizeof(c), 3);
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  iov[2].iov_base = c;
+  iov[2].iov_len = sizeof(c);
+
+  fd = open("iotest.f", O_CREATE|O_RDWR);
+  if(fd < 0)
+    fail("create");
+  if(writev(fd, iov, 3) != sizeof(a) + sizeof(b) + sizeof(c))
+    fail("writev");
+  close(fd);
+
+  memset(a, 0, sizeof(a));
+  memset(b, 0, sizeof(b));
+  memset(c, 0, sizeof(c));
+  fd = open("iotest.f", O_RDONLY);
+  if(readv(fd, iov, 3) != sizeof(a) + sizeof(b) + sizeof(c))
+    fail("readv");
+  if(!check(a, sizeof(a), 1) || !check(b, sizeof(b), 2) ||
+     !check(c, sizeof(c), 3))
+    fail("readv data");
+  if(readv(fd, iov, 3) != 0)
+    fail("readv at eof");
+  if(readv(fd, iov, IOV_MAX+1) >= 0)
+    fail("readv too many iovecs");
+  iov[1].iov_base = (void*)0xffff0000;
+  if(readv(fd, iov, 2) >= 0)
+    fail("readv bad address");
+  close(fd);
+
+  printf(1, "vector test ok\n");
+}
+
+void
+positiontest(void)
+{
+  char buf[16];
+  int fd;
+
+  printf(1, "position test\n");
+  fd = open("iotest.f", O_RDWR);
+  if(fd < 0)
+    fail("open");
+
+  // pread and pwrite must not move the file offset.
+  if(pwrite(fd, "hello", 5, 1000) != 5)
+    fail("pwrite");
+  if(pread(fd, buf, 5, 1000) != 5 || !same(buf, "hello", 5))
+    fail("pread");
+  if(read(fd, buf, sizeof(buf)) != sizeof(buf) || !check(buf, sizeof(buf), 1))
+    fail("offset moved");
+  if(pread(fd, buf, 5, -1) >= 0)
+    fail("pread negative offset");
+  close(fd);
+
+  // Reading at the end of the file returns nothing.
+  fd = open("iotest.f", O_RDONLY);
+  if(pread(fd, buf, sizeof(buf), sizeof(a) + sizeof(b) + sizeof(c)) != 0)
+    fail("pread at eof");
+  close(fd);
+
+  unlink("iotest.f");
+  printf(1, "position test ok\n");
+}
+
+void
+pipetest(void)
+{
+  struct iovec iov[2];
+  char x[3], y[5];
+  int fds[2];
+
+  printf(1, "pipe test\n");
+  if(pipe(fds) < 0)
+    fail("pipe");
+  iov[0].iov_base = "abc";
+  iov[0].iov_len = 3;
+  iov[1].iov_base = "defgh";
+  iov[1].iov_len = 5;
+  if(writev(fds[1], iov, 2) != 8)
+    fail("pipe writev");
+  iov[0].iov_base = x;
+  iov[1].iov_base = y;
+  if(readv(fds[0], iov, 2) != 8)
+    fail("pipe readv");
+  if(!same(x, "abc", 3) || !same(y, "defgh", 5))
+    fail("pipe readv data");
+  if(pread(fds[0], x, 1, 0) >= 0)
+    fail("pread on pipe");
+  close(fds[0]);
+  close(fds[1]);
+  printf(1, "pipe test ok\n");
+}
+
+int
+main(void)
+{
+  vectortest();
+  positiontest();
+  pipetest();
+  exit();
+}
@@ -0,0 +1,2491 @@
+
+_kprof:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	89 c8                	mov    %ecx,%eax
+       c:	55                   	push   %ebp
+       d:	89 e5                	mov    %esp,%ebp
+       f:	57                   	push   %edi
+      10:	56                   	push   %esi
+      11:	53                   	push   %ebx
+      12:	51                   	push   %ecx
+      13:	83 ec 28             	sub    $0x28,%esp
+      16:	8b 09                	mov    (%ecx),%ecx
+      18:	8b 58 04             	mov    0x4(%eax),%ebx
+  int i, j, n, top, ticks, dropped, total, pid;
+  struct sym t;
+
+  top = 15;
+  ticks = 0;
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      1b:	83 f9 01             	cmp    $0x1,%ecx
+      1e:	0f 8e af 00 00 00    	jle    d3 <main+0xd3>
+      24:	8d 71 fe             	lea    -0x2(%ecx),%esi
+      27:	8d 79 ff             	lea    -0x1(%ecx),%edi
+      2a:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+      2d:	83 e6 fe             	and    $0xfffffffe,%esi
+  ticks = 0;
+      30:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      37:	83 cf 01             	or     $0x1,%edi
+      3a:	8d 46 03             	lea    0x3(%esi),%eax
+  top = 15;
+      3d:	c7 45 dc 0f 00 00 00 	movl   $0xf,-0x24(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      44:	be 01 00 00 00       	mov    $0x1,%esi
+      49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      4c:	eb 1e                	jmp    6c <main+0x6c>
+      4e:	66 90                	xchg   %ax,%ax
+    if(i+1 >= argc)
+      usage();
+    if(strcmp(argv[i], "-n") == 0)
+      top = atoi(argv[i+1]);
+      50:	83 ec 0c             	sub    $0xc,%esp
+      53:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      57:	83 c6 02             	add    $0x2,%esi
+      top = atoi(argv[i+1]);
+      5a:	e8 11 09 00 00       	call   970 <atoi>
+      5f:	83 c4 10             	add    $0x10,%esp
+      62:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      65:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      68:	39 c6                	cmp    %eax,%esi
+      6a:	74 54                	je     c0 <main+0xc0>
+      6c:	8b 04 b3             	mov    (%ebx,%esi,4),%eax
+      6f:	80 38 2d             	cmpb   $0x2d,(%eax)
+      72:	75 4c                	jne    c0 <main+0xc0>
+    if(i+1 >= argc)
+      74:	39 fe                	cmp    %edi,%esi
+      76:	74 5b                	je     d3 <main+0xd3>
+    if(strcmp(argv[i], "-n") == 0)
+      78:	83 ec 08             	sub    $0x8,%esp
+      7b:	68 ec 11 00 00       	push   $0x11ec
+      80:	50                   	push   %eax
+      81:	e8 4a 07 00 00       	call   7d0 <strcmp>
+      86:	83 c4 10             	add    $0x10,%esp
+      89:	85 c0                	test   %eax,%eax
+      8b:	74 c3                	je     50 <main+0x50>
+    else if(strcmp(argv[i], "-t") == 0)
+      8d:	83 ec 08             	sub    $0x8,%esp
+      90:	68 ef 11 00 00       	push   $0x11ef
+      95:	ff 34 b3             	push   (%ebx,%esi,4)
+      98:	e8 33 07 00 00       	call   7d0 <strcmp>
+      9d:	83 c4 10             	add    $0x10,%esp
+      a0:	85 c0                	test   %eax,%eax
+      a2:	75 2f                	jne    d3 <main+0xd3>
+      ticks = atoi(argv[i+1]);
+      a4:	83 ec 0c             	sub    $0xc,%esp
+      a7:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      ab:	83 c6 02             	add    $0x2,%esi
+      ticks = atoi(argv[i+1]);
+      ae:	e8 bd 08 00 00       	call   970 <atoi>
+      b3:	83 c4 10             	add    $0x10,%esp
+      b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+      b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      bc:	39 c6                	cmp    %eax,%esi
+      be:	75 ac                	jne    6c <main+0x6c>
+    else
+      usage();
+  }
+  if((i < argc) == (ticks > 0))
+      c0:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+      c3:	39 f1                	cmp    %esi,%ecx
+      c5:	0f 9e c1             	setle  %cl
+      c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+      cc:	0f 9f c0             	setg   %al
+      cf:	38 c1                	cmp    %al,%cl
+      d1:	74 05                	je     d8 <main+0xd8>
+      usage();
+      d3:	e8 a8 06 00 00       	call   780 <usage>
+    usage();
+
+  loadsyms();
+      d8:	e8 b3 02 00 00       	call   390 <loadsyms>
+  if(prof(PROF_START, 0, 0) < 0){
+      dd:	50                   	push   %eax
+      de:	6a 00                	push   $0x0
+      e0:	6a 00                	push   $0x0
+      e2:	6a 01                	push   $0x1
+      e4:	e8 6a 0a 00 00       	call   b53 <prof>
+      e9:	83 c4 10             	add    $0x10,%esp
+      ec:	85 c0                	test   %eax,%eax
+      ee:	0f 88 12 02 00 00    	js     306 <main+0x306>
+    printf(2, "kprof: prof failed\n");
+    exit();
+  }
+  if(ticks > 0)
+      f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      f7:	85 c0                	test   %eax,%eax
+      f9:	0f 8e d9 01 00 00    	jle    2d8 <main+0x2d8>
+    sleep(ticks);
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	50                   	push   %eax
+     103:	e8 6b 09 00 00       	call   a73 <sleep>
+     108:	83 c4 10             	add    $0x10,%esp
+      printf(2, "kprof: exec %s failed\n", argv[i]);
+      exit();
+    } else
+      wait();
+  }
+  dropped = prof(PROF_STOP, 0, 0);
+     10b:	57                   	push   %edi
+     10c:	6a 00                	push   $0x0
+     10e:	6a 00                	push   $0x0
+     110:	6a 02                	push   $0x2
+     112:	e8 3c 0a 00 00       	call   b53 <prof>
+  while((n = prof(PROF_READ, buf, sizeof(buf)/sizeof(buf[0]))) > 0)
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     11d:	8d 76 00             	lea    0x0(%esi),%esi
+     120:	83 ec 04             	sub    $0x4,%esp
+     123:	68 00 01 00 00       	push   $0x100
+     128:	68 20 18 00 00       	push   $0x1820
+     12d:	6a 03                	push   $0x3
+     12f:	e8 1f 0a 00 00       	call   b53 <prof>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	89 c7                	mov    %eax,%edi
+     139:	85 c0                	test   %eax,%eax
+     13b:	7e 23                	jle    160 <main+0x160>
+     13d:	bb 20 18 00 00       	mov    $0x1820,%ebx
+    for(j = 0; j < n; j++)
+     142:	31 f6                	xor    %esi,%esi
+     144:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      count(&buf[j]);
+     148:	83 ec 0c             	sub    $0xc,%esp
+    for(j = 0; j < n; j++)
+     14b:	83 c6 01             	add    $0x1,%esi
+      count(&buf[j]);
+     14e:	53                   	push   %ebx
+    for(j = 0; j < n; j++)
+     14f:	83 c3 0c             	add    $0xc,%ebx
+      count(&buf[j]);
+     152:	e8 29 05 00 00       	call   680 <count>
+    for(j = 0; j < n; j++)
+     157:	83 c4 10             	add    $0x10,%esp
+     15a:	39 f7                	cmp    %esi,%edi
+     15c:	75 ea                	jne    148 <main+0x148>
+     15e:	eb c0                	jmp    120 <main+0x120>
+
+  total = nkernel + nuser + nother;
+     160:	a1 08 18 00 00       	mov    0x1808,%eax
+     165:	8b 0d 04 18 00 00    	mov    0x1804,%ecx
+     16b:	8b 15 00 18 00 00    	mov    0x1800,%edx
+     171:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     174:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+     177:	8d 3c 16             	lea    (%esi,%edx,1),%edi
+  printf(1, "%d samples (%d dropped): %d kernel, %d user\n",
+     17a:	01 d0                	add    %edx,%eax
+     17c:	56                   	push   %esi
+     17d:	56                   	push   %esi
+     17e:	51                   	push   %ecx
+     17f:	50                   	push   %eax
+     180:	53                   	push   %ebx
+     181:	57                   	push   %edi
+     182:	68 e0 12 00 00       	push   $0x12e0
+     187:	6a 01                	push   $0x1
+     189:	e8 f2 0a 00 00       	call   c80 <printf>
+         total, dropped, nkernel + nother, nuser);
+  if(total == 0)
+     18e:	83 c4 20             	add    $0x20,%esp
+     191:	85 ff                	test   %edi,%edi
+     193:	0f 84 3a 01 00 00    	je     2d3 <main+0x2d3>
+    exit();
+
+  // Sort by sample count, most first.
+  for(i = 1; i < nsym; i++){
+     199:	a1 40 26 00 00       	mov    0x2640,%eax
+     19e:	be 6c 26 00 00       	mov    $0x266c,%esi
+     1a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+     1a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     1ab:	83 e8 01             	sub    $0x1,%eax
+     1ae:	7e 72                	jle    222 <main+0x222>
+     1b0:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     1b3:	89 cf                	mov    %ecx,%edi
+     1b5:	8d 76 00             	lea    0x0(%esi),%esi
+    t = sym[i];
+     1b8:	8b 06                	mov    (%esi),%eax
+     1ba:	8b 4e 08             	mov    0x8(%esi),%ecx
+     1bd:	89 fa                	mov    %edi,%edx
+     1bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     1c2:	8b 46 04             	mov    0x4(%esi),%eax
+     1c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1c8:	89 f0                	mov    %esi,%eax
+     1ca:	eb 1d                	jmp    1e9 <main+0x1e9>
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(j = i; j > 0 && sym[j-1].count < t.count; j--)
+      sym[j] = sym[j-1];
+     1d0:	8b 58 f4             	mov    -0xc(%eax),%ebx
+    for(j = i; j > 0 && sym[j-1].count < t.count; j--)
+     1d3:	83 e8 0c             	sub    $0xc,%eax
+      sym[j] = sym[j-1];
+     1d6:	89 58 0c             	mov    %ebx,0xc(%eax)
+     1d9:	8b 58 04             	mov    0x4(%eax),%ebx
+     1dc:	89 58 10             	mov    %ebx,0x10(%eax)
+     1df:	8b 58 08             	mov    0x8(%eax),%ebx
+     1e2:	89 58 14             	mov    %ebx,0x14(%eax)
+    for(j = i; j > 0 && sym[j-1].count < t.count; j--)
+     1e5:	85 d2                	test   %edx,%edx
+     1e7:	74 0c                	je     1f5 <main+0x1f5>
+     1e9:	89 d3                	mov    %edx,%ebx
+     1eb:	83 ea 01             	sub    $0x1,%edx
+     1ee:	39 48 fc             	cmp    %ecx,-0x4(%eax)
+     1f1:	7c dd                	jl     1d0 <main+0x1d0>
+     1f3:	89 da                	mov    %ebx,%edx
+    sym[j] = t;
+     1f5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     1f8:	8d 14 52             	lea    (%edx,%edx,2),%edx
+  for(i = 1; i < nsym; i++){
+     1fb:	83 c7 01             	add    $0x1,%edi
+     1fe:	83 c6 0c             	add    $0xc,%esi
+    sym[j] = t;
+     201:	8d 04 95 60 26 00 00 	lea    0x2660(,%edx,4),%eax
+     208:	89 1c 95 60 26 00 00 	mov    %ebx,0x2660(,%edx,4)
+     20f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     212:	89 48 08             	mov    %ecx,0x8(%eax)
+     215:	89 50 04             	mov    %edx,0x4(%eax)
+  for(i = 1; i < nsym; i++){
+     218:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     21b:	39 c7                	cmp    %eax,%edi
+     21d:	75 99                	jne    1b8 <main+0x1b8>
+     21f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  }
+  printf(1, "samples\t%%\tfunction\n");
+     222:	50                   	push   %eax
+     223:	50                   	push   %eax
+     224:	68 31 12 00 00       	push   $0x1231
+     229:	6a 01                	push   $0x1
+     22b:	e8 50 0a 00 00       	call   c80 <printf>
+  for(i = 0; i < nsym && i < top && sym[i].count > 0; i++)
+     230:	83 c4 10             	add    $0x10,%esp
+     233:	83 3d 40 26 00 00 00 	cmpl   $0x0,0x2640
+     23a:	7e 4f                	jle    28b <main+0x28b>
+     23c:	31 f6                	xor    %esi,%esi
+     23e:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+     242:	bb 64 26 00 00       	mov    $0x2664,%ebx
+     247:	7e 42                	jle    28b <main+0x28b>
+     249:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     24c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+     24f:	90                   	nop
+     250:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     253:	85 c9                	test   %ecx,%ecx
+     255:	7e 31                	jle    288 <main+0x288>
+    printf(1, "%d\t%d\t%s\n", sym[i].count, sym[i].count*100/total, sym[i].name);
+     257:	6b c1 64             	imul   $0x64,%ecx,%eax
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	ff 33                	push   (%ebx)
+  for(i = 0; i < nsym && i < top && sym[i].count > 0; i++)
+     25f:	83 c6 01             	add    $0x1,%esi
+     262:	83 c3 0c             	add    $0xc,%ebx
+    printf(1, "%d\t%d\t%s\n", sym[i].count, sym[i].count*100/total, sym[i].name);
+     265:	99                   	cltd
+     266:	f7 7d e4             	idivl  -0x1c(%ebp)
+     269:	50                   	push   %eax
+     26a:	51                   	push   %ecx
+     26b:	68 46 12 00 00       	push   $0x1246
+     270:	6a 01                	push   $0x1
+     272:	e8 09 0a 00 00       	call   c80 <printf>
+  for(i = 0; i < nsym && i < top && sym[i].count > 0; i++)
+     277:	a1 40 26 00 00       	mov    0x2640,%eax
+     27c:	39 c7                	cmp    %eax,%edi
+     27e:	0f 4e c7             	cmovle %edi,%eax
+     281:	83 c4 20             	add    $0x20,%esp
+     284:	39 c6                	cmp    %eax,%esi
+     286:	7c c8                	jl     250 <main+0x250>
+     288:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  for(i = 0; i < nupid; i++)
+     28b:	31 db                	xor    %ebx,%ebx
+     28d:	83 3d 20 24 00 00 00 	cmpl   $0x0,0x2420
+     294:	7e 3d                	jle    2d3 <main+0x2d3>
+     296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%d\t%d\t[user pid %d]\n", upid[i].count,
+           upid[i].count*100/total, upid[i].pid);
+     2a0:	8b 0c dd 44 24 00 00 	mov    0x2444(,%ebx,8),%ecx
+    printf(1, "%d\t%d\t[user pid %d]\n", upid[i].count,
+     2a7:	83 ec 0c             	sub    $0xc,%esp
+     2aa:	ff 34 dd 40 24 00 00 	push   0x2440(,%ebx,8)
+  for(i = 0; i < nupid; i++)
+     2b1:	83 c3 01             	add    $0x1,%ebx
+           upid[i].count*100/total, upid[i].pid);
+     2b4:	6b c1 64             	imul   $0x64,%ecx,%eax
+    printf(1, "%d\t%d\t[user pid %d]\n", upid[i].count,
+     2b7:	99                   	cltd
+     2b8:	f7 ff                	idiv   %edi
+     2ba:	50                   	push   %eax
+     2bb:	51                   	push   %ecx
+     2bc:	68 50 12 00 00       	push   $0x1250
+     2c1:	6a 01                	push   $0x1
+     2c3:	e8 b8 09 00 00       	call   c80 <printf>
+  for(i = 0; i < nupid; i++)
+     2c8:	83 c4 20             	add    $0x20,%esp
+     2cb:	39 1d 20 24 00 00    	cmp    %ebx,0x2420
+     2d1:	7f cd                	jg     2a0 <main+0x2a0>
+    exit();
+     2d3:	e8 0b 07 00 00       	call   9e3 <exit>
+    pid = fork();
+     2d8:	e8 fe 06 00 00       	call   9db <fork>
+    if(pid < 0){
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	78 38                	js     319 <main+0x319>
+    } else if(pid == 0){
+     2e1:	75 4c                	jne    32f <main+0x32f>
+      exec(argv[i], argv+i);
+     2e3:	8d 1c b3             	lea    (%ebx,%esi,4),%ebx
+     2e6:	50                   	push   %eax
+     2e7:	50                   	push   %eax
+     2e8:	53                   	push   %ebx
+     2e9:	ff 33                	push   (%ebx)
+     2eb:	e8 2b 07 00 00       	call   a1b <exec>
+      printf(2, "kprof: exec %s failed\n", argv[i]);
+     2f0:	83 c4 0c             	add    $0xc,%esp
+     2f3:	ff 33                	push   (%ebx)
+     2f5:	68 1a 12 00 00       	push   $0x121a
+     2fa:	6a 02                	push   $0x2
+     2fc:	e8 7f 09 00 00       	call   c80 <printf>
+      exit();
+     301:	e8 dd 06 00 00       	call   9e3 <exit>
+    printf(2, "kprof: prof failed\n");
+     306:	50                   	push   %eax
+     307:	50                   	push   %eax
+     308:	68 f2 11 00 00       	push   $0x11f2
+     30d:	6a 02                	push   $0x2
+     30f:	e8 6c 09 00 00       	call   c80 <printf>
+    exit();
+     314:	e8 ca 06 00 00       	call   9e3 <exit>
+      printf(2, "kprof: fork failed\n");
+     319:	50                   	push   %eax
+     31a:	50                   	push   %eax
+     31b:	68 06 12 00 00       	push   $0x1206
+     320:	6a 02                	push   $0x2
+     322:	e8 59 09 00 00       	call   c80 <printf>
+     327:	83 c4 10             	add    $0x10,%esp
+     32a:	e9 dc fd ff ff       	jmp    10b <main+0x10b>
+      wait();
+     32f:	e8 b7 06 00 00       	call   9eb <wait>
+     334:	e9 d2 fd ff ff       	jmp    10b <main+0x10b>
+     339:	66 90                	xchg   %ax,%ax
+     33b:	66 90                	xchg   %ax,%ax
+     33d:	66 90                	xchg   %ax,%ax
+     33f:	90                   	nop
+
+00000340 <hex>:
+{
+     340:	55                   	push   %ebp
+  for(v = 0; ; s++){
+     341:	31 c0                	xor    %eax,%eax
+{
+     343:	89 e5                	mov    %esp,%ebp
+     345:	53                   	push   %ebx
+     346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     349:	eb 0f                	jmp    35a <hex+0x1a>
+     34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     34f:	90                   	nop
+      v = v*16 + *s - '0';
+     350:	c1 e0 04             	shl    $0x4,%eax
+     353:	8d 44 10 d0          	lea    -0x30(%eax,%edx,1),%eax
+  for(v = 0; ; s++){
+     357:	83 c1 01             	add    $0x1,%ecx
+    if(*s >= '0' && *s <= '9')
+     35a:	0f be 11             	movsbl (%ecx),%edx
+     35d:	8d 5a d0             	lea    -0x30(%edx),%ebx
+     360:	80 fb 09             	cmp    $0x9,%bl
+     363:	76 eb                	jbe    350 <hex+0x10>
+    else if(*s >= 'a' && *s <= 'f')
+     365:	8d 5a 9f             	lea    -0x61(%edx),%ebx
+     368:	80 fb 05             	cmp    $0x5,%bl
+     36b:	77 13                	ja     380 <hex+0x40>
+      v = v*16 + *s - 'a' + 10;
+     36d:	c1 e0 04             	shl    $0x4,%eax
+     370:	8d 44 10 a9          	lea    -0x57(%eax,%edx,1),%eax
+     374:	eb e1                	jmp    357 <hex+0x17>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     383:	c9                   	leave
+     384:	c3                   	ret
+     385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <loadsyms>:
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+     395:	53                   	push   %ebx
+     396:	83 ec 44             	sub    $0x44,%esp
+  if((fd = open("/kernel.sym", O_RDONLY)) < 0 || fstat(fd, &st) < 0){
+     399:	6a 00                	push   $0x0
+     39b:	68 e0 11 00 00       	push   $0x11e0
+     3a0:	e8 7e 06 00 00       	call   a23 <open>
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	85 c0                	test   %eax,%eax
+     3aa:	0f 88 34 02 00 00    	js     5e4 <loadsyms+0x254>
+     3b0:	83 ec 08             	sub    $0x8,%esp
+     3b3:	89 c3                	mov    %eax,%ebx
+     3b5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3b8:	50                   	push   %eax
+     3b9:	53                   	push   %ebx
+     3ba:	e8 7c 06 00 00       	call   a3b <fstat>
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	85 c0                	test   %eax,%eax
+     3c4:	0f 88 1a 02 00 00    	js     5e4 <loadsyms+0x254>
+  if((p = malloc(st.size + 1)) == 0 || read(fd, p, st.size) != st.size){
+     3ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     3cd:	83 ec 0c             	sub    $0xc,%esp
+     3d0:	83 c0 01             	add    $0x1,%eax
+     3d3:	50                   	push   %eax
+     3d4:	e8 37 0c 00 00       	call   1010 <malloc>
+     3d9:	83 c4 10             	add    $0x10,%esp
+     3dc:	89 c6                	mov    %eax,%esi
+     3de:	85 c0                	test   %eax,%eax
+     3e0:	0f 84 11 02 00 00    	je     5f7 <loadsyms+0x267>
+     3e6:	83 ec 04             	sub    $0x4,%esp
+     3e9:	ff 75 e4             	push   -0x1c(%ebp)
+     3ec:	50                   	push   %eax
+     3ed:	53                   	push   %ebx
+     3ee:	e8 08 06 00 00       	call   9fb <read>
+     3f3:	83 c4 10             	add    $0x10,%esp
+     3f6:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     3f9:	0f 85 f8 01 00 00    	jne    5f7 <loadsyms+0x267>
+  close(fd);
+     3ff:	83 ec 0c             	sub    $0xc,%esp
+     402:	53                   	push   %ebx
+     403:	e8 03 06 00 00       	call   a0b <close>
+  p[st.size] = 0;
+     408:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+     40b:	83 c4 10             	add    $0x10,%esp
+  p[st.size] = 0;
+     40e:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+     412:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  for(i = 1; i < nsym; i++){
+     415:	a1 40 26 00 00       	mov    0x2640,%eax
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+     41a:	01 f3                	add    %esi,%ebx
+  for(i = 1; i < nsym; i++){
+     41c:	89 45 bc             	mov    %eax,-0x44(%ebp)
+     41f:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+     422:	39 de                	cmp    %ebx,%esi
+     424:	0f 83 e5 00 00 00    	jae    50f <loadsyms+0x17f>
+     42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     430:	81 ff ff 03 00 00    	cmp    $0x3ff,%edi
+     436:	0f 8f d0 00 00 00    	jg     50c <loadsyms+0x17c>
+     43c:	89 f2                	mov    %esi,%edx
+  for(v = 0; ; s++){
+     43e:	31 c0                	xor    %eax,%eax
+     440:	89 df                	mov    %ebx,%edi
+     442:	eb 0e                	jmp    452 <loadsyms+0xc2>
+     444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      v = v*16 + *s - '0';
+     448:	c1 e0 04             	shl    $0x4,%eax
+     44b:	8d 44 08 d0          	lea    -0x30(%eax,%ecx,1),%eax
+  for(v = 0; ; s++){
+     44f:	83 c2 01             	add    $0x1,%edx
+    if(*s >= '0' && *s <= '9')
+     452:	0f be 0a             	movsbl (%edx),%ecx
+     455:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     458:	80 fb 09             	cmp    $0x9,%bl
+     45b:	76 eb                	jbe    448 <loadsyms+0xb8>
+    else if(*s >= 'a' && *s <= 'f')
+     45d:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+     460:	80 fb 05             	cmp    $0x5,%bl
+     463:	77 0b                	ja     470 <loadsyms+0xe0>
+      v = v*16 + *s - 'a' + 10;
+     465:	c1 e0 04             	shl    $0x4,%eax
+     468:	8d 44 08 a9          	lea    -0x57(%eax,%ecx,1),%eax
+     46c:	eb e1                	jmp    44f <loadsyms+0xbf>
+     46e:	66 90                	xchg   %ax,%ax
+    while(p < e && *p != ' ')
+     470:	89 fb                	mov    %edi,%ebx
+     472:	89 f1                	mov    %esi,%ecx
+     474:	39 fe                	cmp    %edi,%esi
+     476:	72 10                	jb     488 <loadsyms+0xf8>
+     478:	eb 1b                	jmp    495 <loadsyms+0x105>
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     480:	39 f3                	cmp    %esi,%ebx
+     482:	0f 84 38 01 00 00    	je     5c0 <loadsyms+0x230>
+     488:	0f b6 16             	movzbl (%esi),%edx
+     48b:	89 f1                	mov    %esi,%ecx
+      p++;
+     48d:	8d 76 01             	lea    0x1(%esi),%esi
+    while(p < e && *p != ' ')
+     490:	80 fa 20             	cmp    $0x20,%dl
+     493:	75 eb                	jne    480 <loadsyms+0xf0>
+    t.name = ++p;
+     495:	83 c1 01             	add    $0x1,%ecx
+     498:	89 ce                	mov    %ecx,%esi
+     49a:	89 ca                	mov    %ecx,%edx
+    while(p < e && *p != '\n')
+     49c:	39 d9                	cmp    %ebx,%ecx
+     49e:	73 1e                	jae    4be <loadsyms+0x12e>
+     4a0:	89 c7                	mov    %eax,%edi
+     4a2:	eb 0c                	jmp    4b0 <loadsyms+0x120>
+     4a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4a8:	39 f3                	cmp    %esi,%ebx
+     4aa:	0f 84 20 01 00 00    	je     5d0 <loadsyms+0x240>
+     4b0:	0f b6 06             	movzbl (%esi),%eax
+     4b3:	89 f2                	mov    %esi,%edx
+      p++;
+     4b5:	8d 76 01             	lea    0x1(%esi),%esi
+    while(p < e && *p != '\n')
+     4b8:	3c 0a                	cmp    $0xa,%al
+     4ba:	75 ec                	jne    4a8 <loadsyms+0x118>
+     4bc:	89 f8                	mov    %edi,%eax
+    *p = 0;
+     4be:	c6 02 00             	movb   $0x0,(%edx)
+      sym[nsym++] = t;
+     4c1:	8b 3d 40 26 00 00    	mov    0x2640,%edi
+    if(t.addr >= KERNBASE)
+     4c7:	85 c0                	test   %eax,%eax
+     4c9:	79 36                	jns    501 <loadsyms+0x171>
+      sym[nsym++] = t;
+     4cb:	8b 35 40 26 00 00    	mov    0x2640,%esi
+     4d1:	8d 7e 01             	lea    0x1(%esi),%edi
+     4d4:	8d 34 76             	lea    (%esi,%esi,2),%esi
+     4d7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     4da:	8d 34 b5 60 26 00 00 	lea    0x2660(,%esi,4),%esi
+     4e1:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     4e4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+     4e7:	89 3d 40 26 00 00    	mov    %edi,0x2640
+     4ed:	89 04 b5 60 26 00 00 	mov    %eax,0x2660(,%esi,4)
+     4f4:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     4f7:	89 48 04             	mov    %ecx,0x4(%eax)
+     4fa:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+     501:	8d 72 01             	lea    0x1(%edx),%esi
+     504:	39 de                	cmp    %ebx,%esi
+     506:	0f 82 24 ff ff ff    	jb     430 <loadsyms+0xa0>
+     50c:	89 7d bc             	mov    %edi,-0x44(%ebp)
+  for(i = 1; i < nsym; i++){
+     50f:	83 7d bc 01          	cmpl   $0x1,-0x44(%ebp)
+     513:	bf 0c 00 00 00       	mov    $0xc,%edi
+     518:	be 01 00 00 00       	mov    $0x1,%esi
+     51d:	0f 8e 91 00 00 00    	jle    5b4 <loadsyms+0x224>
+     523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     527:	90                   	nop
+    t = sym[i];
+     528:	8b 87 64 26 00 00    	mov    0x2664(%edi),%eax
+     52e:	8b 9f 60 26 00 00    	mov    0x2660(%edi),%ebx
+     534:	89 f2                	mov    %esi,%edx
+     536:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     539:	8b 87 68 26 00 00    	mov    0x2668(%edi),%eax
+     53f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     542:	89 f8                	mov    %edi,%eax
+     544:	eb 35                	jmp    57b <loadsyms+0x1eb>
+     546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54d:	8d 76 00             	lea    0x0(%esi),%esi
+      sym[j] = sym[j-1];
+     550:	8b 88 54 26 00 00    	mov    0x2654(%eax),%ecx
+    for(j = i; j > 0 && sym[j-1].addr > t.addr; j--)
+     556:	83 e8 0c             	sub    $0xc,%eax
+      sym[j] = sym[j-1];
+     559:	89 88 6c 26 00 00    	mov    %ecx,0x266c(%eax)
+     55f:	8b 88 64 26 00 00    	mov    0x2664(%eax),%ecx
+     565:	89 88 70 26 00 00    	mov    %ecx,0x2670(%eax)
+     56b:	8b 88 68 26 00 00    	mov    0x2668(%eax),%ecx
+     571:	89 88 74 26 00 00    	mov    %ecx,0x2674(%eax)
+    for(j = i; j > 0 && sym[j-1].addr > t.addr; j--)
+     577:	85 d2                	test   %edx,%edx
+     579:	74 65                	je     5e0 <loadsyms+0x250>
+     57b:	89 d1                	mov    %edx,%ecx
+     57d:	8d 52 ff             	lea    -0x1(%edx),%edx
+     580:	3b 98 54 26 00 00    	cmp    0x2654(%eax),%ebx
+     586:	72 c8                	jb     550 <loadsyms+0x1c0>
+    sym[j] = t;
+     588:	8d 14 49             	lea    (%ecx,%ecx,2),%edx
+  for(i = 1; i < nsym; i++){
+     58b:	83 c6 01             	add    $0x1,%esi
+     58e:	83 c7 0c             	add    $0xc,%edi
+    sym[j] = t;
+     591:	89 1c 95 60 26 00 00 	mov    %ebx,0x2660(,%edx,4)
+     598:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+     59b:	8d 04 95 60 26 00 00 	lea    0x2660(,%edx,4),%eax
+     5a2:	89 58 04             	mov    %ebx,0x4(%eax)
+     5a5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+     5a8:	89 58 08             	mov    %ebx,0x8(%eax)
+  for(i = 1; i < nsym; i++){
+     5ab:	39 75 bc             	cmp    %esi,-0x44(%ebp)
+     5ae:	0f 85 74 ff ff ff    	jne    528 <loadsyms+0x198>
+}
+     5b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b7:	5b                   	pop    %ebx
+     5b8:	5e                   	pop    %esi
+     5b9:	5f                   	pop    %edi
+     5ba:	5d                   	pop    %ebp
+     5bb:	c3                   	ret
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      p++;
+     5c0:	89 d9                	mov    %ebx,%ecx
+     5c2:	e9 ce fe ff ff       	jmp    495 <loadsyms+0x105>
+     5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ce:	66 90                	xchg   %ax,%ax
+      p++;
+     5d0:	89 f8                	mov    %edi,%eax
+     5d2:	89 da                	mov    %ebx,%edx
+     5d4:	e9 e5 fe ff ff       	jmp    4be <loadsyms+0x12e>
+     5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5e0:	31 c9                	xor    %ecx,%ecx
+     5e2:	eb a4                	jmp    588 <loadsyms+0x1f8>
+    printf(2, "kprof: cannot open /kernel.sym\n");
+     5e4:	52                   	push   %edx
+     5e5:	52                   	push   %edx
+     5e6:	68 68 12 00 00       	push   $0x1268
+     5eb:	6a 02                	push   $0x2
+     5ed:	e8 8e 06 00 00       	call   c80 <printf>
+    exit();
+     5f2:	e8 ec 03 00 00       	call   9e3 <exit>
+    printf(2, "kprof: cannot read /kernel.sym\n");
+     5f7:	50                   	push   %eax
+     5f8:	50                   	push   %eax
+     5f9:	68 88 12 00 00       	push   $0x1288
+     5fe:	6a 02                	push   $0x2
+     600:	e8 7b 06 00 00       	call   c80 <printf>
+    exit();
+     605:	e8 d9 03 00 00       	call   9e3 <exit>
+     60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000610 <lookup>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	56                   	push   %esi
+     614:	53                   	push   %ebx
+  hi = nsym - 1;
+     615:	8b 1d 40 26 00 00    	mov    0x2640,%ebx
+{
+     61b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(nsym == 0 || eip < sym[0].addr)
+     61e:	85 db                	test   %ebx,%ebx
+     620:	74 4e                	je     670 <lookup+0x60>
+     622:	3b 35 60 26 00 00    	cmp    0x2660,%esi
+     628:	72 46                	jb     670 <lookup+0x60>
+  hi = nsym - 1;
+     62a:	83 eb 01             	sub    $0x1,%ebx
+  lo = 0;
+     62d:	31 d2                	xor    %edx,%edx
+     62f:	eb 1f                	jmp    650 <lookup+0x40>
+     631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mid = (lo + hi + 1) / 2;
+     638:	8d 44 1a 01          	lea    0x1(%edx,%ebx,1),%eax
+     63c:	89 c1                	mov    %eax,%ecx
+    if(sym[mid].addr <= eip)
+     63e:	83 e0 fe             	and    $0xfffffffe,%eax
+    mid = (lo + hi + 1) / 2;
+     641:	d1 f9                	sar    %ecx
+    if(sym[mid].addr <= eip)
+     643:	01 c8                	add    %ecx,%eax
+     645:	3b 34 85 60 26 00 00 	cmp    0x2660(,%eax,4),%esi
+     64c:	72 1a                	jb     668 <lookup+0x58>
+    mid = (lo + hi + 1) / 2;
+     64e:	89 ca                	mov    %ecx,%edx
+  while(lo < hi){
+     650:	39 da                	cmp    %ebx,%edx
+     652:	7c e4                	jl     638 <lookup+0x28>
+  return &sym[lo];
+     654:	8d 04 52             	lea    (%edx,%edx,2),%eax
+}
+     657:	5b                   	pop    %ebx
+     658:	5e                   	pop    %esi
+  return &sym[lo];
+     659:	8d 04 85 60 26 00 00 	lea    0x2660(,%eax,4),%eax
+}
+     660:	5d                   	pop    %ebp
+     661:	c3                   	ret
+     662:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      hi = mid - 1;
+     668:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+     66b:	eb e3                	jmp    650 <lookup+0x40>
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     670:	5b                   	pop    %ebx
+    return 0;
+     671:	31 c0                	xor    %eax,%eax
+}
+     673:	5e                   	pop    %esi
+     674:	5d                   	pop    %ebp
+     675:	c3                   	ret
+     676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000680 <count>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+     685:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(!s->user){
+     688:	80 79 09 00          	cmpb   $0x0,0x9(%ecx)
+     68c:	74 42                	je     6d0 <count+0x50>
+  for(i = 0; i < nupid && upid[i].pid != s->pid; i++)
+     68e:	8b 15 20 24 00 00    	mov    0x2420,%edx
+  nuser++;
+     694:	83 05 04 18 00 00 01 	addl   $0x1,0x1804
+  for(i = 0; i < nupid && upid[i].pid != s->pid; i++)
+     69b:	85 d2                	test   %edx,%edx
+     69d:	0f 8e c1 00 00 00    	jle    764 <count+0xe4>
+     6a3:	8b 49 04             	mov    0x4(%ecx),%ecx
+     6a6:	31 c0                	xor    %eax,%eax
+     6a8:	eb 0d                	jmp    6b7 <count+0x37>
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     6b0:	83 c0 01             	add    $0x1,%eax
+     6b3:	39 d0                	cmp    %edx,%eax
+     6b5:	74 71                	je     728 <count+0xa8>
+     6b7:	39 0c c5 40 24 00 00 	cmp    %ecx,0x2440(,%eax,8)
+     6be:	75 f0                	jne    6b0 <count+0x30>
+  if(i == nupid){
+     6c0:	39 d0                	cmp    %edx,%eax
+     6c2:	74 64                	je     728 <count+0xa8>
+  upid[i].count++;
+     6c4:	83 04 c5 44 24 00 00 	addl   $0x1,0x2444(,%eax,8)
+     6cb:	01 
+}
+     6cc:	5b                   	pop    %ebx
+     6cd:	5e                   	pop    %esi
+     6ce:	5d                   	pop    %ebp
+     6cf:	c3                   	ret
+  hi = nsym - 1;
+     6d0:	8b 1d 40 26 00 00    	mov    0x2640,%ebx
+    if((sp = lookup(s->eip)) == 0){
+     6d6:	8b 31                	mov    (%ecx),%esi
+  if(nsym == 0 || eip < sym[0].addr)
+     6d8:	85 db                	test   %ebx,%ebx
+     6da:	74 7c                	je     758 <count+0xd8>
+     6dc:	3b 35 60 26 00 00    	cmp    0x2660,%esi
+     6e2:	72 74                	jb     758 <count+0xd8>
+  hi = nsym - 1;
+     6e4:	83 eb 01             	sub    $0x1,%ebx
+  lo = 0;
+     6e7:	31 d2                	xor    %edx,%edx
+     6e9:	eb 1d                	jmp    708 <count+0x88>
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+    mid = (lo + hi + 1) / 2;
+     6f0:	8d 44 13 01          	lea    0x1(%ebx,%edx,1),%eax
+     6f4:	89 c1                	mov    %eax,%ecx
+    if(sym[mid].addr <= eip)
+     6f6:	83 e0 fe             	and    $0xfffffffe,%eax
+    mid = (lo + hi + 1) / 2;
+     6f9:	d1 f9                	sar    %ecx
+    if(sym[mid].addr <= eip)
+     6fb:	01 c8                	add    %ecx,%eax
+     6fd:	3b 34 85 60 26 00 00 	cmp    0x2660(,%eax,4),%esi
+     704:	72 4a                	jb     750 <count+0xd0>
+    mid = (lo + hi + 1) / 2;
+     706:	89 ca                	mov    %ecx,%edx
+  while(lo < hi){
+     708:	39 da                	cmp    %ebx,%edx
+     70a:	7c e4                	jl     6f0 <count+0x70>
+    sp->count++;
+     70c:	8d 04 52             	lea    (%edx,%edx,2),%eax
+}
+     70f:	5b                   	pop    %ebx
+    nkernel++;
+     710:	83 05 08 18 00 00 01 	addl   $0x1,0x1808
+}
+     717:	5e                   	pop    %esi
+    sp->count++;
+     718:	83 04 85 68 26 00 00 	addl   $0x1,0x2668(,%eax,4)
+     71f:	01 
+}
+     720:	5d                   	pop    %ebp
+     721:	c3                   	ret
+     722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(nupid == MAXPID)
+     728:	83 fa 40             	cmp    $0x40,%edx
+     72b:	74 9f                	je     6cc <count+0x4c>
+     72d:	89 d0                	mov    %edx,%eax
+    upid[nupid].pid = s->pid;
+     72f:	89 0c d5 40 24 00 00 	mov    %ecx,0x2440(,%edx,8)
+    upid[nupid++].count = 0;
+     736:	8d 4a 01             	lea    0x1(%edx),%ecx
+     739:	89 0d 20 24 00 00    	mov    %ecx,0x2420
+     73f:	c7 04 d5 44 24 00 00 	movl   $0x0,0x2444(,%edx,8)
+     746:	00 00 00 00 
+     74a:	e9 75 ff ff ff       	jmp    6c4 <count+0x44>
+     74f:	90                   	nop
+      hi = mid - 1;
+     750:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+     753:	eb b3                	jmp    708 <count+0x88>
+     755:	8d 76 00             	lea    0x0(%esi),%esi
+      nother++;
+     758:	83 05 00 18 00 00 01 	addl   $0x1,0x1800
+      return;
+     75f:	e9 68 ff ff ff       	jmp    6cc <count+0x4c>
+  for(i = 0; i < nupid && upid[i].pid != s->pid; i++)
+     764:	b8 00 00 00 00       	mov    $0x0,%eax
+  if(i == nupid){
+     769:	0f 85 55 ff ff ff    	jne    6c4 <count+0x44>
+    upid[nupid].pid = s->pid;
+     76f:	8b 49 04             	mov    0x4(%ecx),%ecx
+     772:	eb bb                	jmp    72f <count+0xaf>
+     774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <usage>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: kprof [-n count] [-t ticks | command args...]\n");
+     786:	68 a8 12 00 00       	push   $0x12a8
+     78b:	6a 02                	push   $0x2
+     78d:	e8 ee 04 00 00       	call   c80 <printf>
+  exit();
+     792:	e8 4c 02 00 00       	call   9e3 <exit>
+     797:	66 90                	xchg   %ax,%ax
+     799:	66 90                	xchg   %ax,%ax
+     79b:	66 90                	xchg   %ax,%ax
+     79d:	66 90                	xchg   %ax,%ax
+     79f:	90                   	nop
+
+000007a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     7a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     7a1:	31 c0                	xor    %eax,%eax
+{
+     7a3:	89 e5                	mov    %esp,%ebp
+     7a5:	53                   	push   %ebx
+     7a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     7a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     7b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     7b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     7b7:	83 c0 01             	add    $0x1,%eax
+     7ba:	84 d2                	test   %dl,%dl
+     7bc:	75 f2                	jne    7b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     7be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7c1:	89 c8                	mov    %ecx,%eax
+     7c3:	c9                   	leave
+     7c4:	c3                   	ret
+     7c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	53                   	push   %ebx
+     7d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     7d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     7da:	0f b6 02             	movzbl (%edx),%eax
+     7dd:	84 c0                	test   %al,%al
+     7df:	75 17                	jne    7f8 <strcmp+0x28>
+     7e1:	eb 3a                	jmp    81d <strcmp+0x4d>
+     7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7e7:	90                   	nop
+     7e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     7ec:	83 c2 01             	add    $0x1,%edx
+     7ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     7f2:	84 c0                	test   %al,%al
+     7f4:	74 1a                	je     810 <strcmp+0x40>
+    p++, q++;
+     7f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     7f8:	0f b6 19             	movzbl (%ecx),%ebx
+     7fb:	38 c3                	cmp    %al,%bl
+     7fd:	74 e9                	je     7e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     7ff:	29 d8                	sub    %ebx,%eax
+}
+     801:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     804:	c9                   	leave
+     805:	c3                   	ret
+     806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     810:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     814:	31 c0                	xor    %eax,%eax
+     816:	29 d8                	sub    %ebx,%eax
+}
+     818:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     81b:	c9                   	leave
+     81c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     81d:	0f b6 19             	movzbl (%ecx),%ebx
+     820:	31 c0                	xor    %eax,%eax
+     822:	eb db                	jmp    7ff <strcmp+0x2f>
+     824:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+
+00000830 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     836:	80 3a 00             	cmpb   $0x0,(%edx)
+     839:	74 15                	je     850 <strlen+0x20>
+     83b:	31 c0                	xor    %eax,%eax
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+     840:	83 c0 01             	add    $0x1,%eax
+     843:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     847:	89 c1                	mov    %eax,%ecx
+     849:	75 f5                	jne    840 <strlen+0x10>
+    ;
+  return n;
+}
+     84b:	89 c8                	mov    %ecx,%eax
+     84d:	5d                   	pop    %ebp
+     84e:	c3                   	ret
+     84f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     850:	31 c9                	xor    %ecx,%ecx
+}
+     852:	5d                   	pop    %ebp
+     853:	89 c8                	mov    %ecx,%eax
+     855:	c3                   	ret
+     856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     867:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     86a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     86d:	89 d7                	mov    %edx,%edi
+     86f:	fc                   	cld
+     870:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     872:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     875:	89 d0                	mov    %edx,%eax
+     877:	c9                   	leave
+     878:	c3                   	ret
+     879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	8b 45 08             	mov    0x8(%ebp),%eax
+     886:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     88a:	0f b6 10             	movzbl (%eax),%edx
+     88d:	84 d2                	test   %dl,%dl
+     88f:	75 12                	jne    8a3 <strchr+0x23>
+     891:	eb 1d                	jmp    8b0 <strchr+0x30>
+     893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     897:	90                   	nop
+     898:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     89c:	83 c0 01             	add    $0x1,%eax
+     89f:	84 d2                	test   %dl,%dl
+     8a1:	74 0d                	je     8b0 <strchr+0x30>
+    if(*s == c)
+     8a3:	38 d1                	cmp    %dl,%cl
+     8a5:	75 f1                	jne    898 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     8a7:	5d                   	pop    %ebp
+     8a8:	c3                   	ret
+     8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     8b0:	31 c0                	xor    %eax,%eax
+}
+     8b2:	5d                   	pop    %ebp
+     8b3:	c3                   	ret
+     8b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8bf:	90                   	nop
+
+000008c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     8c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     8c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     8c9:	31 db                	xor    %ebx,%ebx
+{
+     8cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     8ce:	eb 27                	jmp    8f7 <gets+0x37>
+    cc = read(0, &c, 1);
+     8d0:	83 ec 04             	sub    $0x4,%esp
+     8d3:	6a 01                	push   $0x1
+     8d5:	56                   	push   %esi
+     8d6:	6a 00                	push   $0x0
+     8d8:	e8 1e 01 00 00       	call   9fb <read>
+    if(cc < 1)
+     8dd:	83 c4 10             	add    $0x10,%esp
+     8e0:	85 c0                	test   %eax,%eax
+     8e2:	7e 1d                	jle    901 <gets+0x41>
+      break;
+    buf[i++] = c;
+     8e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     8e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     8ef:	3c 0a                	cmp    $0xa,%al
+     8f1:	74 10                	je     903 <gets+0x43>
+     8f3:	3c 0d                	cmp    $0xd,%al
+     8f5:	74 0c                	je     903 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     8f7:	89 df                	mov    %ebx,%edi
+     8f9:	83 c3 01             	add    $0x1,%ebx
+     8fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8ff:	7c cf                	jl     8d0 <gets+0x10>
+     901:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     903:	8b 45 08             	mov    0x8(%ebp),%eax
+     906:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     90a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     90d:	5b                   	pop    %ebx
+     90e:	5e                   	pop    %esi
+     90f:	5f                   	pop    %edi
+     910:	5d                   	pop    %ebp
+     911:	c3                   	ret
+     912:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	56                   	push   %esi
+     924:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     925:	83 ec 08             	sub    $0x8,%esp
+     928:	6a 00                	push   $0x0
+     92a:	ff 75 08             	push   0x8(%ebp)
+     92d:	e8 f1 00 00 00       	call   a23 <open>
+  if(fd < 0)
+     932:	83 c4 10             	add    $0x10,%esp
+     935:	85 c0                	test   %eax,%eax
+     937:	78 27                	js     960 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     939:	83 ec 08             	sub    $0x8,%esp
+     93c:	ff 75 0c             	push   0xc(%ebp)
+     93f:	89 c3                	mov    %eax,%ebx
+     941:	50                   	push   %eax
+     942:	e8 f4 00 00 00       	call   a3b <fstat>
+  close(fd);
+     947:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     94a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     94c:	e8 ba 00 00 00       	call   a0b <close>
+  return r;
+     951:	83 c4 10             	add    $0x10,%esp
+}
+     954:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     957:	89 f0                	mov    %esi,%eax
+     959:	5b                   	pop    %ebx
+     95a:	5e                   	pop    %esi
+     95b:	5d                   	pop    %ebp
+     95c:	c3                   	ret
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     960:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     965:	eb ed                	jmp    954 <stat+0x34>
+     967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96e:	66 90                	xchg   %ax,%ax
+
+00000970 <atoi>:
+
+int
+atoi(const char *s)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	53                   	push   %ebx
+     974:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     977:	0f be 02             	movsbl (%edx),%eax
+     97a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     97d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     980:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     985:	77 1e                	ja     9a5 <atoi+0x35>
+     987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     990:	83 c2 01             	add    $0x1,%edx
+     993:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     996:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     99a:	0f be 02             	movsbl (%edx),%eax
+     99d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     9a0:	80 fb 09             	cmp    $0x9,%bl
+     9a3:	76 eb                	jbe    990 <atoi+0x20>
+  return n;
+}
+     9a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9a8:	89 c8                	mov    %ecx,%eax
+     9aa:	c9                   	leave
+     9ab:	c3                   	ret
+     9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	56                   	push   %esi
+     9b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     9be:	85 c0                	test   %eax,%eax
+     9c0:	7e 13                	jle    9d5 <memmove+0x25>
+     9c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9c4:	89 d7                	mov    %edx,%edi
+     9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9d1:	39 f8                	cmp    %edi,%eax
+     9d3:	75 fb                	jne    9d0 <memmove+0x20>
+  return vdst;
+}
+     9d5:	5e                   	pop    %esi
+     9d6:	89 d0                	mov    %edx,%eax
+     9d8:	5f                   	pop    %edi
+     9d9:	5d                   	pop    %ebp
+     9da:	c3                   	ret
+
+000009db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     9db:	b8 01 00 00 00       	mov    $0x1,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <exit>:
+SYSCALL(exit)
+     9e3:	b8 02 00 00 00       	mov    $0x2,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <wait>:
+SYSCALL(wait)
+     9eb:	b8 03 00 00 00       	mov    $0x3,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <pipe>:
+SYSCALL(pipe)
+     9f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <read>:
+SYSCALL(read)
+     9fb:	b8 05 00 00 00       	mov    $0x5,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <write>:
+SYSCALL(write)
+     a03:	b8 10 00 00 00       	mov    $0x10,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <close>:
+SYSCALL(close)
+     a0b:	b8 15 00 00 00       	mov    $0x15,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <kill>:
+SYSCALL(kill)
+     a13:	b8 06 00 00 00       	mov    $0x6,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <exec>:
+SYSCALL(exec)
+     a1b:	b8 07 00 00 00       	mov    $0x7,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <open>:
+SYSCALL(open)
+     a23:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <mknod>:
+SYSCALL(mknod)
+     a2b:	b8 11 00 00 00       	mov    $0x11,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <unlink>:
+SYSCALL(unlink)
+     a33:	b8 12 00 00 00       	mov    $0x12,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <fstat>:
+SYSCALL(fstat)
+     a3b:	b8 08 00 00 00       	mov    $0x8,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <link>:
+SYSCALL(link)
+     a43:	b8 13 00 00 00       	mov    $0x13,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <mkdir>:
+SYSCALL(mkdir)
+     a4b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <chdir>:
+SYSCALL(chdir)
+     a53:	b8 09 00 00 00       	mov    $0x9,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <dup>:
+SYSCALL(dup)
+     a5b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <getpid>:
+SYSCALL(getpid)
+     a63:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <sbrk>:
+SYSCALL(sbrk)
+     a6b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <sleep>:
+SYSCALL(sleep)
+     a73:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <uptime>:
+SYSCALL(uptime)
+     a7b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <getsysinfo>:
+SYSCALL(getsysinfo)
+     a83:	b8 16 00 00 00       	mov    $0x16,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     a8b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     a93:	b8 18 00 00 00       	mov    $0x18,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <mlfqstart>:
+SYSCALL(mlfqstart)
+     a9b:	b8 19 00 00 00       	mov    $0x19,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <mlfqstop>:
+SYSCALL(mlfqstop)
+     aa3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     aab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     ab3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <setpriority>:
+SYSCALL(setpriority)
+     abb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     ac3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+
+00000acb <getcpustats>:
+SYSCALL(getcpustats)
+     acb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ad0:	cd 40                	int    $0x40
+     ad2:	c3                   	ret
+
+00000ad3 <setscheduler>:
+SYSCALL(setscheduler)
+     ad3:	b8 20 00 00 00       	mov    $0x20,%eax
+     ad8:	cd 40                	int    $0x40
+     ada:	c3                   	ret
+
+00000adb <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     adb:	b8 21 00 00 00       	mov    $0x21,%eax
+     ae0:	cd 40                	int    $0x40
+     ae2:	c3                   	ret
+
+00000ae3 <getscheduler>:
+SYSCALL(getscheduler)
+     ae3:	b8 22 00 00 00       	mov    $0x22,%eax
+     ae8:	cd 40                	int    $0x40
+     aea:	c3                   	ret
+
+00000aeb <splice>:
+SYSCALL(splice)
+     aeb:	b8 23 00 00 00       	mov    $0x23,%eax
+     af0:	cd 40                	int    $0x40
+     af2:	c3                   	ret
+
+00000af3 <readv>:
+SYSCALL(readv)
+     af3:	b8 24 00 00 00       	mov    $0x24,%eax
+     af8:	cd 40                	int    $0x40
+     afa:	c3                   	ret
+
+00000afb <writev>:
+SYSCALL(writev)
+     afb:	b8 25 00 00 00       	mov    $0x25,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <pread>:
+SYSCALL(pread)
+     b03:	b8 26 00 00 00       	mov    $0x26,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <pwrite>:
+SYSCALL(pwrite)
+     b0b:	b8 27 00 00 00       	mov    $0x27,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <getlogstat>:
+SYSCALL(getlogstat)
+     b13:	b8 28 00 00 00       	mov    $0x28,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <mount>:
+SYSCALL(mount)
+     b1b:	b8 29 00 00 00       	mov    $0x29,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <umount>:
+SYSCALL(umount)
+     b23:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <mmap>:
+SYSCALL(mmap)
+     b2b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b30:	cd 40                	int    $0x40
+     b32:	c3                   	ret
+
+00000b33 <munmap>:
+SYSCALL(munmap)
+     b33:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b38:	cd 40                	int    $0x40
+     b3a:	c3                   	ret
+
+00000b3b <membench>:
+SYSCALL(membench)
+     b3b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b40:	cd 40                	int    $0x40
+     b42:	c3                   	ret
+
+00000b43 <getlockstat>:
+SYSCALL(getlockstat)
+     b43:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b48:	cd 40                	int    $0x40
+     b4a:	c3                   	ret
+
+00000b4b <lockbench>:
+SYSCALL(lockbench)
+     b4b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b50:	cd 40                	int    $0x40
+     b52:	c3                   	ret
+
+00000b53 <prof>:
+SYSCALL(prof)
+     b53:	b8 30 00 00 00       	mov    $0x30,%eax
+     b58:	cd 40                	int    $0x40
+     b5a:	c3                   	ret
+
+00000b5b <tracectl>:
+SYSCALL(tracectl)
+     b5b:	b8 31 00 00 00       	mov    $0x31,%eax
+     b60:	cd 40                	int    $0x40
+     b62:	c3                   	ret
+
+00000b63 <traceread>:
+SYSCALL(traceread)
+     b63:	b8 32 00 00 00       	mov    $0x32,%eax
+     b68:	cd 40                	int    $0x40
+     b6a:	c3                   	ret
+
+00000b6b <getsysstat>:
+SYSCALL(getsysstat)
+     b6b:	b8 33 00 00 00       	mov    $0x33,%eax
+     b70:	cd 40                	int    $0x40
+     b72:	c3                   	ret
+
+00000b73 <getwaitstat>:
+SYSCALL(getwaitstat)
+     b73:	b8 34 00 00 00       	mov    $0x34,%eax
+     b78:	cd 40                	int    $0x40
+     b7a:	c3                   	ret
+
+00000b7b <getschedwait>:
+SYSCALL(getschedwait)
+     b7b:	b8 35 00 00 00       	mov    $0x35,%eax
+     b80:	cd 40                	int    $0x40
+     b82:	c3                   	ret
+
+00000b83 <mlfqread>:
+SYSCALL(mlfqread)
+     b83:	b8 36 00 00 00       	mov    $0x36,%eax
+     b88:	cd 40                	int    $0x40
+     b8a:	c3                   	ret
+
+00000b8b <dllock>:
+SYSCALL(dllock)
+     b8b:	b8 37 00 00 00       	mov    $0x37,%eax
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <watchdogctl>:
+SYSCALL(watchdogctl)
+     b93:	b8 38 00 00 00       	mov    $0x38,%eax
+     b98:	cd 40                	int    $0x40
+     b9a:	c3                   	ret
+
+00000b9b <deadlocklog>:
+SYSCALL(deadlocklog)
+     b9b:	b8 39 00 00 00       	mov    $0x39,%eax
+     ba0:	cd 40                	int    $0x40
+     ba2:	c3                   	ret
+
+00000ba3 <clone>:
+SYSCALL(clone)
+     ba3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     ba8:	cd 40                	int    $0x40
+     baa:	c3                   	ret
+
+00000bab <join>:
+SYSCALL(join)
+     bab:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     bb0:	cd 40                	int    $0x40
+     bb2:	c3                   	ret
+
+00000bb3 <futex>:
+SYSCALL(futex)
+     bb3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     bb8:	cd 40                	int    $0x40
+     bba:	c3                   	ret
+
+00000bbb <shmat>:
+SYSCALL(shmat)
+     bbb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     bc0:	cd 40                	int    $0x40
+     bc2:	c3                   	ret
+
+00000bc3 <shmdt>:
+SYSCALL(shmdt)
+     bc3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bc8:	cd 40                	int    $0x40
+     bca:	c3                   	ret
+
+00000bcb <poll>:
+SYSCALL(poll)
+     bcb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bd0:	cd 40                	int    $0x40
+     bd2:	c3                   	ret
+     bd3:	66 90                	xchg   %ax,%ax
+     bd5:	66 90                	xchg   %ax,%ax
+     bd7:	66 90                	xchg   %ax,%ax
+     bd9:	66 90                	xchg   %ax,%ax
+     bdb:	66 90                	xchg   %ax,%ax
+     bdd:	66 90                	xchg   %ax,%ax
+     bdf:	90                   	nop
+
+00000be0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	56                   	push   %esi
+     be5:	53                   	push   %ebx
+     be6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     be8:	89 d1                	mov    %edx,%ecx
+{
+     bea:	83 ec 3c             	sub    $0x3c,%esp
+     bed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     bf0:	85 d2                	test   %edx,%edx
+     bf2:	0f 89 80 00 00 00    	jns    c78 <printint+0x98>
+     bf8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     bfc:	74 7a                	je     c78 <printint+0x98>
+    x = -xx;
+     bfe:	f7 d9                	neg    %ecx
+    neg = 1;
+     c00:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c05:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c08:	31 f6                	xor    %esi,%esi
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c10:	89 c8                	mov    %ecx,%eax
+     c12:	31 d2                	xor    %edx,%edx
+     c14:	89 f7                	mov    %esi,%edi
+     c16:	f7 f3                	div    %ebx
+     c18:	8d 76 01             	lea    0x1(%esi),%esi
+     c1b:	0f b6 92 6c 13 00 00 	movzbl 0x136c(%edx),%edx
+     c22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c26:	89 ca                	mov    %ecx,%edx
+     c28:	89 c1                	mov    %eax,%ecx
+     c2a:	39 da                	cmp    %ebx,%edx
+     c2c:	73 e2                	jae    c10 <printint+0x30>
+  if(neg)
+     c2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c31:	85 c0                	test   %eax,%eax
+     c33:	74 07                	je     c3c <printint+0x5c>
+    buf[i++] = '-';
+     c35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c3a:	89 f7                	mov    %esi,%edi
+     c3c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c3f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c42:	01 df                	add    %ebx,%edi
+     c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c48:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     c4b:	83 ec 04             	sub    $0x4,%esp
+     c4e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c51:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c54:	6a 01                	push   $0x1
+     c56:	50                   	push   %eax
+     c57:	56                   	push   %esi
+     c58:	e8 a6 fd ff ff       	call   a03 <write>
+  while(--i >= 0)
+     c5d:	89 f8                	mov    %edi,%eax
+     c5f:	83 c4 10             	add    $0x10,%esp
+     c62:	83 ef 01             	sub    $0x1,%edi
+     c65:	39 d8                	cmp    %ebx,%eax
+     c67:	75 df                	jne    c48 <printint+0x68>
+}
+     c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c6c:	5b                   	pop    %ebx
+     c6d:	5e                   	pop    %esi
+     c6e:	5f                   	pop    %edi
+     c6f:	5d                   	pop    %ebp
+     c70:	c3                   	ret
+     c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c78:	31 c0                	xor    %eax,%eax
+     c7a:	eb 89                	jmp    c05 <printint+0x25>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	53                   	push   %ebx
+     c86:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c89:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     c8c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     c8f:	0f b6 1e             	movzbl (%esi),%ebx
+     c92:	83 c6 01             	add    $0x1,%esi
+     c95:	84 db                	test   %bl,%bl
+     c97:	74 67                	je     d00 <printf+0x80>
+     c99:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c9c:	31 d2                	xor    %edx,%edx
+     c9e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     ca1:	eb 34                	jmp    cd7 <printf+0x57>
+     ca3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ca7:	90                   	nop
+     ca8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     cab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     cb0:	83 f8 25             	cmp    $0x25,%eax
+     cb3:	74 18                	je     ccd <printf+0x4d>
+  write(fd, &c, 1);
+     cb5:	83 ec 04             	sub    $0x4,%esp
+     cb8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     cbb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cbe:	6a 01                	push   $0x1
+     cc0:	50                   	push   %eax
+     cc1:	57                   	push   %edi
+     cc2:	e8 3c fd ff ff       	call   a03 <write>
+     cc7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     cca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     ccd:	0f b6 1e             	movzbl (%esi),%ebx
+     cd0:	83 c6 01             	add    $0x1,%esi
+     cd3:	84 db                	test   %bl,%bl
+     cd5:	74 29                	je     d00 <printf+0x80>
+    c = fmt[i] & 0xff;
+     cd7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cda:	85 d2                	test   %edx,%edx
+     cdc:	74 ca                	je     ca8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     cde:	83 fa 25             	cmp    $0x25,%edx
+     ce1:	75 ea                	jne    ccd <printf+0x4d>
+      if(c == 'd'){
+     ce3:	83 f8 25             	cmp    $0x25,%eax
+     ce6:	0f 84 24 01 00 00    	je     e10 <printf+0x190>
+     cec:	83 e8 63             	sub    $0x63,%eax
+     cef:	83 f8 15             	cmp    $0x15,%eax
+     cf2:	77 1c                	ja     d10 <printf+0x90>
+     cf4:	ff 24 85 14 13 00 00 	jmp    *0x1314(,%eax,4)
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d03:	5b                   	pop    %ebx
+     d04:	5e                   	pop    %esi
+     d05:	5f                   	pop    %edi
+     d06:	5d                   	pop    %ebp
+     d07:	c3                   	ret
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+  write(fd, &c, 1);
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d1a:	6a 01                	push   $0x1
+     d1c:	52                   	push   %edx
+     d1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d20:	57                   	push   %edi
+     d21:	e8 dd fc ff ff       	call   a03 <write>
+     d26:	83 c4 0c             	add    $0xc,%esp
+     d29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d2c:	6a 01                	push   $0x1
+     d2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     d31:	52                   	push   %edx
+     d32:	57                   	push   %edi
+     d33:	e8 cb fc ff ff       	call   a03 <write>
+        putc(fd, c);
+     d38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d3b:	31 d2                	xor    %edx,%edx
+     d3d:	eb 8e                	jmp    ccd <printf+0x4d>
+     d3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     d40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     d43:	83 ec 0c             	sub    $0xc,%esp
+     d46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d4b:	8b 13                	mov    (%ebx),%edx
+     d4d:	6a 00                	push   $0x0
+     d4f:	89 f8                	mov    %edi,%eax
+        ap++;
+     d51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     d54:	e8 87 fe ff ff       	call   be0 <printint>
+        ap++;
+     d59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     d5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d5f:	31 d2                	xor    %edx,%edx
+     d61:	e9 67 ff ff ff       	jmp    ccd <printf+0x4d>
+     d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     d73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d75:	83 c0 04             	add    $0x4,%eax
+     d78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     d7b:	85 db                	test   %ebx,%ebx
+     d7d:	0f 84 9d 00 00 00    	je     e20 <printf+0x1a0>
+        while(*s != 0){
+     d83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     d86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     d88:	84 c0                	test   %al,%al
+     d8a:	0f 84 3d ff ff ff    	je     ccd <printf+0x4d>
+     d90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     d96:	89 de                	mov    %ebx,%esi
+     d98:	89 d3                	mov    %edx,%ebx
+     d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     da0:	83 ec 04             	sub    $0x4,%esp
+     da3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     da6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     da9:	6a 01                	push   $0x1
+     dab:	53                   	push   %ebx
+     dac:	57                   	push   %edi
+     dad:	e8 51 fc ff ff       	call   a03 <write>
+        while(*s != 0){
+     db2:	0f b6 06             	movzbl (%esi),%eax
+     db5:	83 c4 10             	add    $0x10,%esp
+     db8:	84 c0                	test   %al,%al
+     dba:	75 e4                	jne    da0 <printf+0x120>
+      state = 0;
+     dbc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     dbf:	31 d2                	xor    %edx,%edx
+     dc1:	e9 07 ff ff ff       	jmp    ccd <printf+0x4d>
+     dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     dd0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     dd3:	83 ec 0c             	sub    $0xc,%esp
+     dd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ddb:	8b 13                	mov    (%ebx),%edx
+     ddd:	6a 01                	push   $0x1
+     ddf:	e9 6b ff ff ff       	jmp    d4f <printf+0xcf>
+     de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     de8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     deb:	83 ec 04             	sub    $0x4,%esp
+     dee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     df1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     df3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     df6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     df9:	6a 01                	push   $0x1
+     dfb:	52                   	push   %edx
+     dfc:	57                   	push   %edi
+     dfd:	e8 01 fc ff ff       	call   a03 <write>
+        ap++;
+     e02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e08:	31 d2                	xor    %edx,%edx
+     e0a:	e9 be fe ff ff       	jmp    ccd <printf+0x4d>
+     e0f:	90                   	nop
+  write(fd, &c, 1);
+     e10:	83 ec 04             	sub    $0x4,%esp
+     e13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e19:	6a 01                	push   $0x1
+     e1b:	e9 11 ff ff ff       	jmp    d31 <printf+0xb1>
+     e20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e25:	bb 0d 13 00 00       	mov    $0x130d,%ebx
+     e2a:	e9 61 ff ff ff       	jmp    d90 <printf+0x110>
+     e2f:	90                   	nop
+
+00000e30 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e33:	a1 b4 56 00 00       	mov    0x56b4,%eax
+{
+     e38:	89 e5                	mov    %esp,%ebp
+     e3a:	56                   	push   %esi
+     e3b:	53                   	push   %ebx
+     e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e40:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e42:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e44:	39 ca                	cmp    %ecx,%edx
+     e46:	73 30                	jae    e78 <bigfree+0x48>
+     e48:	39 c1                	cmp    %eax,%ecx
+     e4a:	72 04                	jb     e50 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e4c:	39 c2                	cmp    %eax,%edx
+     e4e:	72 f0                	jb     e40 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e50:	8b 59 04             	mov    0x4(%ecx),%ebx
+     e53:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     e56:	39 f0                	cmp    %esi,%eax
+     e58:	74 26                	je     e80 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e5a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e5c:	8b 42 04             	mov    0x4(%edx),%eax
+     e5f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     e62:	39 d9                	cmp    %ebx,%ecx
+     e64:	74 30                	je     e96 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e66:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e68:	5b                   	pop    %ebx
+  freep = p;
+     e69:	89 15 b4 56 00 00    	mov    %edx,0x56b4
+}
+     e6f:	5e                   	pop    %esi
+     e70:	5d                   	pop    %ebp
+     e71:	c3                   	ret
+     e72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e78:	39 c1                	cmp    %eax,%ecx
+     e7a:	72 d0                	jb     e4c <bigfree+0x1c>
+     e7c:	eb c2                	jmp    e40 <bigfree+0x10>
+     e7e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e80:	03 58 04             	add    0x4(%eax),%ebx
+     e83:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e86:	8b 02                	mov    (%edx),%eax
+     e88:	8b 00                	mov    (%eax),%eax
+     e8a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     e8c:	8b 42 04             	mov    0x4(%edx),%eax
+     e8f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     e92:	39 d9                	cmp    %ebx,%ecx
+     e94:	75 d0                	jne    e66 <bigfree+0x36>
+    p->s.size += bp->s.size;
+     e96:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     e99:	89 15 b4 56 00 00    	mov    %edx,0x56b4
+    p->s.size += bp->s.size;
+     e9f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ea2:	8b 09                	mov    (%ecx),%ecx
+     ea4:	89 0a                	mov    %ecx,(%edx)
+}
+     ea6:	5b                   	pop    %ebx
+     ea7:	5e                   	pop    %esi
+     ea8:	5d                   	pop    %ebp
+     ea9:	c3                   	ret
+     eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000eb0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	89 c7                	mov    %eax,%edi
+     eb6:	56                   	push   %esi
+     eb7:	53                   	push   %ebx
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     ebb:	a1 b4 56 00 00       	mov    0x56b4,%eax
+     ec0:	85 c0                	test   %eax,%eax
+     ec2:	0f 84 88 00 00 00    	je     f50 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ec8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     eca:	8b 4a 04             	mov    0x4(%edx),%ecx
+     ecd:	39 f9                	cmp    %edi,%ecx
+     ecf:	73 5f                	jae    f30 <bigalloc+0x80>
+  if(nu < 4096)
+     ed1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ed6:	39 df                	cmp    %ebx,%edi
+     ed8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     edb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     ee2:	eb 0d                	jmp    ef1 <bigalloc+0x41>
+     ee4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ee8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     eea:	8b 4a 04             	mov    0x4(%edx),%ecx
+     eed:	39 f9                	cmp    %edi,%ecx
+     eef:	73 3f                	jae    f30 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     ef1:	89 d0                	mov    %edx,%eax
+     ef3:	39 15 b4 56 00 00    	cmp    %edx,0x56b4
+     ef9:	75 ed                	jne    ee8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     efb:	83 ec 0c             	sub    $0xc,%esp
+     efe:	56                   	push   %esi
+     eff:	e8 67 fb ff ff       	call   a6b <sbrk>
+  if(p == (char*)-1)
+     f04:	83 c4 10             	add    $0x10,%esp
+     f07:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f0a:	74 11                	je     f1d <bigalloc+0x6d>
+  hp->s.size = nu;
+     f0c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+     f0f:	e8 1c ff ff ff       	call   e30 <bigfree>
+  return freep;
+     f14:	a1 b4 56 00 00       	mov    0x56b4,%eax
+      if((p = morecore(nunits)) == 0)
+     f19:	85 c0                	test   %eax,%eax
+     f1b:	75 cb                	jne    ee8 <bigalloc+0x38>
+        return 0;
+  }
+}
+     f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f20:	31 d2                	xor    %edx,%edx
+}
+     f22:	5b                   	pop    %ebx
+     f23:	89 d0                	mov    %edx,%eax
+     f25:	5e                   	pop    %esi
+     f26:	5f                   	pop    %edi
+     f27:	5d                   	pop    %ebp
+     f28:	c3                   	ret
+     f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     f30:	39 cf                	cmp    %ecx,%edi
+     f32:	74 4c                	je     f80 <bigalloc+0xd0>
+        p->s.size -= nunits;
+     f34:	29 f9                	sub    %edi,%ecx
+     f36:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     f39:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     f3c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     f3f:	a3 b4 56 00 00       	mov    %eax,0x56b4
+}
+     f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f47:	89 d0                	mov    %edx,%eax
+     f49:	5b                   	pop    %ebx
+     f4a:	5e                   	pop    %esi
+     f4b:	5f                   	pop    %edi
+     f4c:	5d                   	pop    %ebp
+     f4d:	c3                   	ret
+     f4e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+     f50:	c7 05 b4 56 00 00 b8 	movl   $0x56b8,0x56b4
+     f57:	56 00 00 
+    base.s.size = 0;
+     f5a:	ba b8 56 00 00       	mov    $0x56b8,%edx
+    base.s.ptr = freep = prevp = &base;
+     f5f:	c7 05 b8 56 00 00 b8 	movl   $0x56b8,0x56b8
+     f66:	56 00 00 
+    base.s.size = 0;
+     f69:	c7 05 bc 56 00 00 00 	movl   $0x0,0x56bc
+     f70:	00 00 00 
+    if(p->s.size >= nunits){
+     f73:	e9 59 ff ff ff       	jmp    ed1 <bigalloc+0x21>
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f80:	8b 0a                	mov    (%edx),%ecx
+     f82:	89 08                	mov    %ecx,(%eax)
+     f84:	eb b9                	jmp    f3f <bigalloc+0x8f>
+     f86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f90 <free>:
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	53                   	push   %ebx
+     f94:	83 ec 04             	sub    $0x4,%esp
+     f97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+     f9a:	85 c9                	test   %ecx,%ecx
+     f9c:	74 58                	je     ff6 <free+0x66>
+  bp = (Header*)ap - 1;
+     f9e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     fa1:	ba 01 00 00 00       	mov    $0x1,%edx
+     fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fad:	8d 76 00             	lea    0x0(%esi),%esi
+     fb0:	89 d0                	mov    %edx,%eax
+     fb2:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+  while(xchg(&locked, 1) != 0)
+     fb9:	85 c0                	test   %eax,%eax
+     fbb:	75 f3                	jne    fb0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+     fbd:	8b 51 fc             	mov    -0x4(%ecx),%edx
+     fc0:	83 fa 40             	cmp    $0x40,%edx
+     fc3:	77 3b                	ja     1000 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+     fc5:	83 fa 02             	cmp    $0x2,%edx
+     fc8:	76 3f                	jbe    1009 <free+0x79>
+     fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     fd0:	83 c0 01             	add    $0x1,%eax
+     fd3:	39 14 85 80 13 00 00 	cmp    %edx,0x1380(,%eax,4)
+     fda:	72 f4                	jb     fd0 <free+0x40>
+    bp->s.ptr = classfree[c];
+     fdc:	8b 14 85 80 56 00 00 	mov    0x5680(,%eax,4),%edx
+    classfree[c] = bp;
+     fe3:	89 1c 85 80 56 00 00 	mov    %ebx,0x5680(,%eax,4)
+    bp->s.ptr = classfree[c];
+     fea:	89 51 f8             	mov    %edx,-0x8(%ecx)
+     fed:	31 c0                	xor    %eax,%eax
+     fef:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+}
+     ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ff9:	c9                   	leave
+     ffa:	c3                   	ret
+     ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+    bigfree(bp);
+    1000:	89 d8                	mov    %ebx,%eax
+    1002:	e8 29 fe ff ff       	call   e30 <bigfree>
+    1007:	eb e4                	jmp    fed <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+    1009:	31 c0                	xor    %eax,%eax
+    100b:	eb cf                	jmp    fdc <free+0x4c>
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001010 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1010:	55                   	push   %ebp
+    1011:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1016:	89 e5                	mov    %esp,%ebp
+    1018:	57                   	push   %edi
+    1019:	56                   	push   %esi
+    101a:	53                   	push   %ebx
+    101b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    101e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1021:	8d 50 07             	lea    0x7(%eax),%edx
+    1024:	c1 ea 03             	shr    $0x3,%edx
+    1027:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1030:	89 c8                	mov    %ecx,%eax
+    1032:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+    1039:	85 c0                	test   %eax,%eax
+    103b:	75 f3                	jne    1030 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+    103d:	89 c3                	mov    %eax,%ebx
+    103f:	83 fa 40             	cmp    $0x40,%edx
+    1042:	77 4c                	ja     1090 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+    1044:	be 02 00 00 00       	mov    $0x2,%esi
+    1049:	83 fa 02             	cmp    $0x2,%edx
+    104c:	76 10                	jbe    105e <malloc+0x4e>
+    104e:	66 90                	xchg   %ax,%ax
+    1050:	83 c3 01             	add    $0x1,%ebx
+    1053:	8b 34 9d 80 13 00 00 	mov    0x1380(,%ebx,4),%esi
+    105a:	39 d6                	cmp    %edx,%esi
+    105c:	72 f2                	jb     1050 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+    105e:	8b 14 9d 80 56 00 00 	mov    0x5680(,%ebx,4),%edx
+    1065:	85 d2                	test   %edx,%edx
+    1067:	74 47                	je     10b0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    1069:	8b 3a                	mov    (%edx),%edi
+    106b:	89 3c 9d 80 56 00 00 	mov    %edi,0x5680(,%ebx,4)
+    1072:	31 c0                	xor    %eax,%eax
+    1074:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+    107b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+    107e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+    1081:	5b                   	pop    %ebx
+    1082:	5e                   	pop    %esi
+    1083:	5f                   	pop    %edi
+    1084:	5d                   	pop    %ebp
+    1085:	c3                   	ret
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+    1090:	89 d0                	mov    %edx,%eax
+    1092:	e8 19 fe ff ff       	call   eb0 <bigalloc>
+    1097:	89 c2                	mov    %eax,%edx
+    1099:	89 d8                	mov    %ebx,%eax
+    109b:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+  return p ? (void*)(p + 1) : 0;
+    10a2:	85 d2                	test   %edx,%edx
+    10a4:	75 d5                	jne    107b <malloc+0x6b>
+    10a6:	31 c0                	xor    %eax,%eax
+}
+    10a8:	83 c4 1c             	add    $0x1c,%esp
+    10ab:	5b                   	pop    %ebx
+    10ac:	5e                   	pop    %esi
+    10ad:	5f                   	pop    %edi
+    10ae:	5d                   	pop    %ebp
+    10af:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    10b0:	b8 00 02 00 00       	mov    $0x200,%eax
+    10b5:	e8 f6 fd ff ff       	call   eb0 <bigalloc>
+    10ba:	85 c0                	test   %eax,%eax
+    10bc:	74 44                	je     1102 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10be:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    10c5:	8b 14 9d 80 56 00 00 	mov    0x5680(,%ebx,4),%edx
+    10cc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    10cf:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    10d2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    10d8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    10db:	39 cf                	cmp    %ecx,%edi
+    10dd:	72 8a                	jb     1069 <malloc+0x59>
+    10df:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    10e2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    10e5:	8d 76 00             	lea    0x0(%esi),%esi
+    10e8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    10ea:	89 70 04             	mov    %esi,0x4(%eax)
+    10ed:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10ef:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    10f1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10f3:	01 d8                	add    %ebx,%eax
+    10f5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    10f8:	73 ee                	jae    10e8 <malloc+0xd8>
+    10fa:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    10fd:	e9 69 ff ff ff       	jmp    106b <malloc+0x5b>
+    1102:	f0 87 05 60 56 00 00 	lock xchg %eax,0x5660
+  return p ? (void*)(p + 1) : 0;
+    1109:	31 c0                	xor    %eax,%eax
+    110b:	eb 9b                	jmp    10a8 <malloc+0x98>
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001110 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	56                   	push   %esi
+    1114:	53                   	push   %ebx
+    1115:	8b 45 08             	mov    0x8(%ebp),%eax
+    1118:	f7 65 0c             	mull   0xc(%ebp)
+    111b:	70 33                	jo     1150 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    111d:	83 ec 0c             	sub    $0xc,%esp
+    1120:	89 c3                	mov    %eax,%ebx
+    1122:	50                   	push   %eax
+    1123:	e8 e8 fe ff ff       	call   1010 <malloc>
+    1128:	83 c4 10             	add    $0x10,%esp
+    112b:	89 c6                	mov    %eax,%esi
+    112d:	85 c0                	test   %eax,%eax
+    112f:	74 1f                	je     1150 <calloc+0x40>
+    memset(p, 0, n);
+    1131:	83 ec 04             	sub    $0x4,%esp
+    1134:	53                   	push   %ebx
+    1135:	6a 00                	push   $0x0
+    1137:	50                   	push   %eax
+    1138:	e8 23 f7 ff ff       	call   860 <memset>
+    113d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1140:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1143:	89 f0                	mov    %esi,%eax
+    1145:	5b                   	pop    %ebx
+    1146:	5e                   	pop    %esi
+    1147:	5d                   	pop    %ebp
+    1148:	c3                   	ret
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1153:	31 f6                	xor    %esi,%esi
+}
+    1155:	89 f0                	mov    %esi,%eax
+    1157:	5b                   	pop    %ebx
+    1158:	5e                   	pop    %esi
+    1159:	5d                   	pop    %ebp
+    115a:	c3                   	ret
+    115b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+
+00001160 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	56                   	push   %esi
+    1165:	53                   	push   %ebx
+    1166:	83 ec 0c             	sub    $0xc,%esp
+    1169:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    116c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    116f:	85 db                	test   %ebx,%ebx
+    1171:	74 55                	je     11c8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1173:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1176:	89 de                	mov    %ebx,%esi
+    1178:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    117f:	39 c7                	cmp    %eax,%edi
+    1181:	72 0d                	jb     1190 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1186:	89 f0                	mov    %esi,%eax
+    1188:	5b                   	pop    %ebx
+    1189:	5e                   	pop    %esi
+    118a:	5f                   	pop    %edi
+    118b:	5d                   	pop    %ebp
+    118c:	c3                   	ret
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	50                   	push   %eax
+    1194:	e8 77 fe ff ff       	call   1010 <malloc>
+    1199:	83 c4 10             	add    $0x10,%esp
+    119c:	89 c6                	mov    %eax,%esi
+    119e:	85 c0                	test   %eax,%eax
+    11a0:	74 e1                	je     1183 <realloc+0x23>
+  memmove(p, ap, have);
+    11a2:	83 ec 04             	sub    $0x4,%esp
+    11a5:	57                   	push   %edi
+    11a6:	53                   	push   %ebx
+    11a7:	50                   	push   %eax
+    11a8:	e8 03 f8 ff ff       	call   9b0 <memmove>
+  free(ap);
+    11ad:	89 1c 24             	mov    %ebx,(%esp)
+    11b0:	e8 db fd ff ff       	call   f90 <free>
+  return p;
+    11b5:	83 c4 10             	add    $0x10,%esp
+}
+    11b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11bb:	89 f0                	mov    %esi,%eax
+    11bd:	5b                   	pop    %ebx
+    11be:	5e                   	pop    %esi
+    11bf:	5f                   	pop    %edi
+    11c0:	5d                   	pop    %ebp
+    11c1:	c3                   	ret
+    11c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    11c8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    11cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ce:	5b                   	pop    %ebx
+    11cf:	5e                   	pop    %esi
+    11d0:	5f                   	pop    %edi
+    11d1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    11d2:	e9 39 fe ff ff       	jmp    1010 <malloc>
@@ -0,0 +1,210 @@
+// Sampling profiler front end.
+// usage: kprof [-n count] [-t ticks | command args...]
+// Samples every CPU's timer interrupts while the command runs
+// (or for the given number of ticks), then lists the kernel
+// functions, and the processes running in user space, that
+// were sampled most often. Kernel addresses are looked up in
+// /kernel.sym.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "prof.h"
+
+#define KERNBASE 0x80000000
+#define MAXSYM   1024
+#define MAXPID   64
+
+struct sym {
+  uint addr;
+  char *name;
+  int count;
+} sym[MAXSYM];
+int nsym;
+
+struct {
+  int pid;
+  int count;
+} upid[MAXPID];
+int nupid;
+
+struct profsample buf[256];
+int nkernel, nuser, nother;
+
+uint
+hex(char *s)
+{
+  uint v;
+
+  for(v = 0; ; s++){
+    if(*s >= '0' && *s <= '9')
+      v = v*16 + *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      v = v*16 + *s - 'a' + 10;
+    else
+      return v;
+  }
+}
+
+// Load the kernel's symbols, sorted by address.
+void
+loadsyms(void)
+{
+  struct stat st;
+  struct sym t;
+  char *p, *e;
+  int fd, i, j;
+
+  if((fd = open("/kernel.sym", O_RDONLY)) < 0 || fstat(fd, &st) < 0){
+    printf(2, "kprof: cannot open /kernel.sym\n");
+    exit();
+  }
+  if((p = malloc(st.size + 1)) == 0 || read(fd, p, st.size) != st.size){
+    printf(2, "kprof: cannot read /kernel.sym\n");
+    exit();
+  }
+  close(fd);
+  p[st.size] = 0;
+
+  // Each line is "address name".
+  for(e = p + st.size; p < e && nsym < MAXSYM; p++){
+    t.addr = hex(p);
+    while(p < e && *p != ' ')
+      p++;
+    t.name = ++p;
+    while(p < e && *p != '\n')
+      p++;
+    *p = 0;
+    t.count = 0;
+    if(t.addr >= KERNBASE)
+      sym[nsym++] = t;
+  }
+
+  for(i = 1; i < nsym; i++){
+    t = sym[i];
+    for(j = i; j > 0 && sym[j-1].addr > t.addr; j--)
+      sym[j] = sym[j-1];
+    sym[j] = t;
+  }
+}
+
+// The symbol containing kernel address eip, or 0.
+struct sym*
+lookup(uint eip)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = nsym - 1;
+  if(nsym == 0 || eip < sym[0].addr)
+    return 0;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(sym[mid].addr <= eip)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return &sym[lo];
+}
+
+void
+count(struct profsample *s)
+{
+  struct sym *sp;
+  int i;
+
+  if(!s->user){
+    if((sp = lookup(s->eip)) == 0){
+      nother++;
+      return;
+    }
+    sp->count++;
+    nkernel++;
+    return;
+  }
+  nuser++;
+  for(i = 0; i < nupid && upid[i].pid != s->pid; i++)
+    ;
+  if(i == nupid){
+    if(nupid == MAXPID)
+      return;
+    upid[nupid].pid = s->pid;
+    upid[nupid++].count = 0;
+  }
+  upid[i].count++;
+}
+
+void
+usage(void)
+{
+  printf(2, "usage: kprof [-n count] [-t ticks | command args...]\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, top, ticks, dropped, total, pid;
+  struct sym t;
+
+  top = 15;
+  ticks = 0;
+  for(i = 1; i < argc && argv[i][0] == '-'; i += 2){
+    if(i+1 >= argc)
+      usage();
+    if(strcmp(argv[i], "-n") == 0)
+      top = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-t") == 0)
+      ticks = atoi(argv[i+1]);
+    else
+      usage();
+  }
+  if((i < argc) == (ticks > 0))
+    usage();
+
+  loadsyms();
+  if(prof(PROF_START, 0, 0) < 0){
+    printf(2, "kprof: prof failed\n");
+    exit();
+  }
+  if(ticks > 0)
+    sleep(ticks);
+  else {
+    pid = fork();
+    if(pid < 0){
+      printf(2, "kprof: fork failed\n");
+    } else if(pid == 0){
+      exec(argv[i], argv+i);
+      printf(2, "kprof: exec %s failed\n", argv[i]);
+      exit();
+    } else
+      wait();
+  }
+  dropped = prof(PROF_STOP, 0, 0);
+  while((n = prof(PROF_READ, buf, sizeof(buf)/sizeof(buf[0]))) > 0)
+    for(j = 0; j < n; j++)
+      count(&buf[j]);
+
+  total = nkernel + nuser + nother;
+  printf(1, "%d samples (%d dropped): %d kernel, %d user\n",
+         total, dropped, nkernel + nother, nuser);
+  if(total == 0)
+    exit();
+
+  // Sort by sample count, most first.
+  for(i = 1; i < nsym; i++){
+    t = sym[i];
+    for(j = i; j > 0 && sym[j-1].count < t.count; j--)
+      sym[j] = sym[j-1];
+    sym[j] = t;
+  }
+  printf(1, "samples\t%%\tfunction\n");
+  for(i = 0; i < nsym && i < top && sym[i].count > 0; i++)
+    printf(1, "%d\t%d\t%s\n", sym[i].count, sym[i].count*100/total, sym[i].name);
+  for(i = 0; i < nupid; i++)
+    printf(1, "%d\t%d\t[user pid %d]\n", upid[i].count,
+           upid[i].count*100/total, upid[i].pid);
+  exit();
+}
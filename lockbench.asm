@@ -0,0 +1,1978 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  uint done;     // finishing time, in units of 1024 cycles
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i, pid, nproc, iters, hold, fds[2], maxwait;
+  uint first, last, sum, kc;
+  uint64 t0;
+  struct result r;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  19:	83 ff 01             	cmp    $0x1,%edi
+  1c:	0f 8f 6a 01 00 00    	jg     18c <main+0x18c>
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+  22:	c7 45 c8 20 4e 00 00 	movl   $0x4e20,-0x38(%ebp)
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  29:	be 04 00 00 00       	mov    $0x4,%esi
+  hold = argc > 3 ? atoi(argv[3]) : 200;
+  2e:	c7 45 c4 c8 00 00 00 	movl   $0xc8,-0x3c(%ebp)
+  if(nproc < 1 || iters < 1 || hold < 0){
+    printf(2, "usage: lockbench [nproc [iters [hold]]]\n");
+    exit();
+  }
+  if(pipe(fds) < 0){
+  35:	83 ec 0c             	sub    $0xc,%esp
+  38:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  3b:	50                   	push   %eax
+  3c:	e8 f2 04 00 00       	call   533 <pipe>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	85 c0                	test   %eax,%eax
+  46:	0f 88 c3 01 00 00    	js     20f <main+0x20f>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+  4c:	0f 31                	rdtsc
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+
+  t0 = rdtsc();
+  for(i = 0; i < nproc; i++){
+  4e:	31 db                	xor    %ebx,%ebx
+  50:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  53:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  56:	eb 19                	jmp    71 <main+0x71>
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+    pid = fork();
+    if(pid < 0){
+      printf(2, "lockbench: fork failed\n");
+      break;
+    }
+    if(pid == 0){
+  60:	0f 84 c8 01 00 00    	je     22e <main+0x22e>
+  for(i = 0; i < nproc; i++){
+  66:	83 c3 01             	add    $0x1,%ebx
+  69:	39 f3                	cmp    %esi,%ebx
+  6b:	0f 84 12 02 00 00    	je     283 <main+0x283>
+    pid = fork();
+  71:	e8 a5 04 00 00       	call   51b <fork>
+    if(pid < 0){
+  76:	85 c0                	test   %eax,%eax
+  78:	79 e6                	jns    60 <main+0x60>
+      printf(2, "lockbench: fork failed\n");
+  7a:	50                   	push   %eax
+  close(fds[1]);
+
+  maxwait = 0;
+  first = 0xffffffff;
+  last = sum = 0;
+  for(i = 0; i < nproc && read(fds[0], &r, sizeof(r)) == sizeof(r); i++){
+  7b:	89 de                	mov    %ebx,%esi
+      printf(2, "lockbench: fork failed\n");
+  7d:	50                   	push   %eax
+  7e:	68 04 0e 00 00       	push   $0xe04
+  83:	6a 02                	push   $0x2
+  85:	e8 36 07 00 00       	call   7c0 <printf>
+  close(fds[1]);
+  8a:	58                   	pop    %eax
+  8b:	ff 75 dc             	push   -0x24(%ebp)
+  8e:	e8 b8 04 00 00       	call   54b <close>
+  for(i = 0; i < nproc && read(fds[0], &r, sizeof(r)) == sizeof(r); i++){
+  93:	83 c4 10             	add    $0x10,%esp
+  96:	85 db                	test   %ebx,%ebx
+  98:	0f 84 1e 02 00 00    	je     2bc <main+0x2bc>
+  9e:	83 c9 ff             	or     $0xffffffff,%ecx
+  a1:	31 d2                	xor    %edx,%edx
+  a3:	31 c0                	xor    %eax,%eax
+  a5:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  a8:	89 55 c0             	mov    %edx,-0x40(%ebp)
+  ab:	89 ce                	mov    %ecx,%esi
+  ad:	31 ff                	xor    %edi,%edi
+  af:	31 db                	xor    %ebx,%ebx
+  b1:	89 c1                	mov    %eax,%ecx
+  b3:	eb 2b                	jmp    e0 <main+0xe0>
+  b5:	8d 76 00             	lea    0x0(%esi),%esi
+    if(r.maxwait > maxwait)
+  b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  bb:	39 c7                	cmp    %eax,%edi
+  bd:	0f 4c f8             	cmovl  %eax,%edi
+      maxwait = r.maxwait;
+    sum += r.maxwait / nproc;
+  c0:	99                   	cltd
+  c1:	f7 7d d0             	idivl  -0x30(%ebp)
+  c4:	01 45 c0             	add    %eax,-0x40(%ebp)
+    if(r.done < first)
+  c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  ca:	39 c6                	cmp    %eax,%esi
+  cc:	0f 47 f0             	cmova  %eax,%esi
+      first = r.done;
+    if(r.done > last)
+  cf:	39 c1                	cmp    %eax,%ecx
+  d1:	0f 42 c8             	cmovb  %eax,%ecx
+  for(i = 0; i < nproc && read(fds[0], &r, sizeof(r)) == sizeof(r); i++){
+  d4:	83 c3 01             	add    $0x1,%ebx
+  d7:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+  da:	0f 84 93 01 00 00    	je     273 <main+0x273>
+  e0:	83 ec 04             	sub    $0x4,%esp
+  e3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  e6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  e9:	6a 08                	push   $0x8
+  eb:	50                   	push   %eax
+  ec:	ff 75 d8             	push   -0x28(%ebp)
+  ef:	e8 47 04 00 00       	call   53b <read>
+  f4:	83 c4 10             	add    $0x10,%esp
+  f7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  fa:	83 f8 08             	cmp    $0x8,%eax
+  fd:	74 b9                	je     b8 <main+0xb8>
+  ff:	89 75 bc             	mov    %esi,-0x44(%ebp)
+ 102:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 105:	8d 76 00             	lea    0x0(%esi),%esi
+      last = r.done;
+  }
+  while(wait() >= 0)
+ 108:	e8 1e 04 00 00       	call   52b <wait>
+ 10d:	85 c0                	test   %eax,%eax
+ 10f:	79 f7                	jns    108 <main+0x108>
+    ;
+  if(i < nproc){
+ 111:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+ 114:	39 f3                	cmp    %esi,%ebx
+ 116:	0f 8c 8d 01 00 00    	jl     2a9 <main+0x2a9>
+    printf(2, "lockbench: lost results\n");
+    exit();
+  }
+  kc = last ? last : 1;
+ 11c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 11f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 124:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 127:	85 d2                	test   %edx,%edx
+ 129:	0f 45 c2             	cmovne %edx,%eax
+
+  printf(1, "%d procs, %d acquires each, hold %d cycles\n", nproc, iters, hold);
+ 12c:	83 ec 0c             	sub    $0xc,%esp
+ 12f:	ff 75 c4             	push   -0x3c(%ebp)
+ 132:	ff 75 c8             	push   -0x38(%ebp)
+ 135:	56                   	push   %esi
+  kc = last ? last : 1;
+ 136:	89 c3                	mov    %eax,%ebx
+  printf(1, "%d procs, %d acquires each, hold %d cycles\n", nproc, iters, hold);
+ 138:	68 4c 0d 00 00       	push   $0xd4c
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 7c 06 00 00       	call   7c0 <printf>
+  printf(1, "throughput: %d acquires per Mcycle\n", nproc * iters * 1024 / kc);
+ 144:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 147:	31 d2                	xor    %edx,%edx
+ 149:	83 c4 1c             	add    $0x1c,%esp
+ 14c:	0f af c6             	imul   %esi,%eax
+ 14f:	c1 e0 0a             	shl    $0xa,%eax
+ 152:	f7 f3                	div    %ebx
+ 154:	50                   	push   %eax
+ 155:	68 78 0d 00 00       	push   $0xd78
+ 15a:	6a 01                	push   $0x1
+ 15c:	e8 5f 06 00 00       	call   7c0 <printf>
+  printf(1, "worst wait: %d cycles (average worst %d)\n", maxwait, sum);
+ 161:	ff 75 c0             	push   -0x40(%ebp)
+ 164:	57                   	push   %edi
+ 165:	68 9c 0d 00 00       	push   $0xd9c
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 4f 06 00 00       	call   7c0 <printf>
+  printf(1, "finished between %d and %d Kcycles\n", first, last);
+ 171:	83 c4 20             	add    $0x20,%esp
+ 174:	ff 75 cc             	push   -0x34(%ebp)
+ 177:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 17a:	51                   	push   %ecx
+ 17b:	68 c8 0d 00 00       	push   $0xdc8
+ 180:	6a 01                	push   $0x1
+ 182:	e8 39 06 00 00       	call   7c0 <printf>
+  exit();
+ 187:	e8 97 03 00 00       	call   523 <exit>
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+ 18c:	83 ec 0c             	sub    $0xc,%esp
+ 18f:	ff 73 04             	push   0x4(%ebx)
+ 192:	e8 19 03 00 00       	call   4b0 <atoi>
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+ 197:	83 c4 10             	add    $0x10,%esp
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+ 19a:	89 c6                	mov    %eax,%esi
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+ 19c:	83 ff 02             	cmp    $0x2,%edi
+ 19f:	75 17                	jne    1b8 <main+0x1b8>
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 1a1:	85 c0                	test   %eax,%eax
+ 1a3:	7e 56                	jle    1fb <main+0x1fb>
+ 1a5:	c7 45 c8 20 4e 00 00 	movl   $0x4e20,-0x38(%ebp)
+  hold = argc > 3 ? atoi(argv[3]) : 200;
+ 1ac:	c7 45 c4 c8 00 00 00 	movl   $0xc8,-0x3c(%ebp)
+ 1b3:	e9 7d fe ff ff       	jmp    35 <main+0x35>
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+ 1b8:	83 ec 0c             	sub    $0xc,%esp
+ 1bb:	ff 73 08             	push   0x8(%ebx)
+ 1be:	e8 ed 02 00 00       	call   4b0 <atoi>
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 1c3:	83 c4 10             	add    $0x10,%esp
+ 1c6:	85 f6                	test   %esi,%esi
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+ 1c8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 1cb:	0f 9e 45 d0          	setle  -0x30(%ebp)
+  hold = argc > 3 ? atoi(argv[3]) : 200;
+ 1cf:	83 ff 03             	cmp    $0x3,%edi
+ 1d2:	74 4e                	je     222 <main+0x222>
+ 1d4:	83 ec 0c             	sub    $0xc,%esp
+ 1d7:	ff 73 0c             	push   0xc(%ebx)
+ 1da:	e8 d1 02 00 00       	call   4b0 <atoi>
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+  hold = argc > 3 ? atoi(argv[3]) : 200;
+ 1e6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 1e9:	89 c7                	mov    %eax,%edi
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 1eb:	0f 9e c0             	setle  %al
+ 1ee:	0a 45 d0             	or     -0x30(%ebp),%al
+ 1f1:	75 08                	jne    1fb <main+0x1fb>
+ 1f3:	85 ff                	test   %edi,%edi
+ 1f5:	0f 89 3a fe ff ff    	jns    35 <main+0x35>
+    printf(2, "usage: lockbench [nproc [iters [hold]]]\n");
+ 1fb:	83 ec 08             	sub    $0x8,%esp
+ 1fe:	68 20 0d 00 00       	push   $0xd20
+ 203:	6a 02                	push   $0x2
+ 205:	e8 b6 05 00 00       	call   7c0 <printf>
+    exit();
+ 20a:	e8 14 03 00 00       	call   523 <exit>
+    printf(2, "lockbench: pipe failed\n");
+ 20f:	50                   	push   %eax
+ 210:	50                   	push   %eax
+ 211:	68 ec 0d 00 00       	push   $0xdec
+ 216:	6a 02                	push   $0x2
+ 218:	e8 a3 05 00 00       	call   7c0 <printf>
+    exit();
+ 21d:	e8 01 03 00 00       	call   523 <exit>
+  if(nproc < 1 || iters < 1 || hold < 0){
+ 222:	85 c0                	test   %eax,%eax
+ 224:	7e d5                	jle    1fb <main+0x1fb>
+ 226:	80 7d d0 00          	cmpb   $0x0,-0x30(%ebp)
+ 22a:	74 80                	je     1ac <main+0x1ac>
+ 22c:	eb cd                	jmp    1fb <main+0x1fb>
+      close(fds[0]);
+ 22e:	83 ec 0c             	sub    $0xc,%esp
+ 231:	ff 75 d8             	push   -0x28(%ebp)
+ 234:	e8 12 03 00 00       	call   54b <close>
+      if((r.maxwait = lockbench(iters, hold)) < 0){
+ 239:	5f                   	pop    %edi
+ 23a:	58                   	pop    %eax
+ 23b:	ff 75 c4             	push   -0x3c(%ebp)
+ 23e:	ff 75 c8             	push   -0x38(%ebp)
+ 241:	e8 45 04 00 00       	call   68b <lockbench>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 24c:	85 c0                	test   %eax,%eax
+ 24e:	78 46                	js     296 <main+0x296>
+ 250:	0f 31                	rdtsc
+      r.done = (rdtsc() - t0) >> 10;
+ 252:	2b 45 d0             	sub    -0x30(%ebp),%eax
+ 255:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+ 258:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 25c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      write(fds[1], &r, sizeof(r));
+ 25f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 262:	53                   	push   %ebx
+ 263:	6a 08                	push   $0x8
+ 265:	50                   	push   %eax
+ 266:	ff 75 dc             	push   -0x24(%ebp)
+ 269:	e8 d5 02 00 00       	call   543 <write>
+      exit();
+ 26e:	e8 b0 02 00 00       	call   523 <exit>
+ 273:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+ 276:	89 f1                	mov    %esi,%ecx
+ 278:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 27b:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+ 27e:	e9 85 fe ff ff       	jmp    108 <main+0x108>
+  close(fds[1]);
+ 283:	83 ec 0c             	sub    $0xc,%esp
+ 286:	ff 75 dc             	push   -0x24(%ebp)
+ 289:	e8 bd 02 00 00       	call   54b <close>
+ 28e:	83 c4 10             	add    $0x10,%esp
+ 291:	e9 08 fe ff ff       	jmp    9e <main+0x9e>
+        printf(2, "lockbench: lockbench failed\n");
+ 296:	56                   	push   %esi
+ 297:	56                   	push   %esi
+ 298:	68 1c 0e 00 00       	push   $0xe1c
+ 29d:	6a 02                	push   $0x2
+ 29f:	e8 1c 05 00 00       	call   7c0 <printf>
+        exit();
+ 2a4:	e8 7a 02 00 00       	call   523 <exit>
+    printf(2, "lockbench: lost results\n");
+ 2a9:	50                   	push   %eax
+ 2aa:	50                   	push   %eax
+ 2ab:	68 39 0e 00 00       	push   $0xe39
+ 2b0:	6a 02                	push   $0x2
+ 2b2:	e8 09 05 00 00       	call   7c0 <printf>
+    exit();
+ 2b7:	e8 67 02 00 00       	call   523 <exit>
+  last = sum = 0;
+ 2bc:	31 c0                	xor    %eax,%eax
+  first = 0xffffffff;
+ 2be:	83 c9 ff             	or     $0xffffffff,%ecx
+  maxwait = 0;
+ 2c1:	31 ff                	xor    %edi,%edi
+  last = sum = 0;
+ 2c3:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 2c6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 2c9:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+ 2cc:	e9 37 fe ff ff       	jmp    108 <main+0x108>
+ 2d1:	66 90                	xchg   %ax,%ax
+ 2d3:	66 90                	xchg   %ax,%ax
+ 2d5:	66 90                	xchg   %ax,%ax
+ 2d7:	66 90                	xchg   %ax,%ax
+ 2d9:	66 90                	xchg   %ax,%ax
+ 2db:	66 90                	xchg   %ax,%ax
+ 2dd:	66 90                	xchg   %ax,%ax
+ 2df:	90                   	nop
+
+000002e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2e1:	31 c0                	xor    %eax,%eax
+{
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	53                   	push   %ebx
+ 2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2f7:	83 c0 01             	add    $0x1,%eax
+ 2fa:	84 d2                	test   %dl,%dl
+ 2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 301:	89 c8                	mov    %ecx,%eax
+ 303:	c9                   	leave
+ 304:	c3                   	ret
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+ 317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 31a:	0f b6 02             	movzbl (%edx),%eax
+ 31d:	84 c0                	test   %al,%al
+ 31f:	75 17                	jne    338 <strcmp+0x28>
+ 321:	eb 3a                	jmp    35d <strcmp+0x4d>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 32c:	83 c2 01             	add    $0x1,%edx
+ 32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 332:	84 c0                	test   %al,%al
+ 334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+ 336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 338:	0f b6 19             	movzbl (%ecx),%ebx
+ 33b:	38 c3                	cmp    %al,%bl
+ 33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 33f:	29 d8                	sub    %ebx,%eax
+}
+ 341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 354:	31 c0                	xor    %eax,%eax
+ 356:	29 d8                	sub    %ebx,%eax
+}
+ 358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 35d:	0f b6 19             	movzbl (%ecx),%ebx
+ 360:	31 c0                	xor    %eax,%eax
+ 362:	eb db                	jmp    33f <strcmp+0x2f>
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 1e 01 00 00       	call   53b <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 f1 00 00 00       	call   563 <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 f4 00 00 00       	call   57b <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 ba 00 00 00       	call   54b <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4b7:	0f be 02             	movsbl (%edx),%eax
+ 4ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4c5:	77 1e                	ja     4e5 <atoi+0x35>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4d0:	83 c2 01             	add    $0x1,%edx
+ 4d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4da:	0f be 02             	movsbl (%edx),%eax
+ 4dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4e0:	80 fb 09             	cmp    $0x9,%bl
+ 4e3:	76 eb                	jbe    4d0 <atoi+0x20>
+  return n;
+}
+ 4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e8:	89 c8                	mov    %ecx,%eax
+ 4ea:	c9                   	leave
+ 4eb:	c3                   	ret
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4fe:	85 c0                	test   %eax,%eax
+ 500:	7e 13                	jle    515 <memmove+0x25>
+ 502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 504:	89 d7                	mov    %edx,%edi
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 511:	39 f8                	cmp    %edi,%eax
+ 513:	75 fb                	jne    510 <memmove+0x20>
+  return vdst;
+}
+ 515:	5e                   	pop    %esi
+ 516:	89 d0                	mov    %edx,%eax
+ 518:	5f                   	pop    %edi
+ 519:	5d                   	pop    %ebp
+ 51a:	c3                   	ret
+
+0000051b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 51b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <exit>:
+SYSCALL(exit)
+ 523:	b8 02 00 00 00       	mov    $0x2,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <wait>:
+SYSCALL(wait)
+ 52b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <pipe>:
+SYSCALL(pipe)
+ 533:	b8 04 00 00 00       	mov    $0x4,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <read>:
+SYSCALL(read)
+ 53b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <write>:
+SYSCALL(write)
+ 543:	b8 10 00 00 00       	mov    $0x10,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <close>:
+SYSCALL(close)
+ 54b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <kill>:
+SYSCALL(kill)
+ 553:	b8 06 00 00 00       	mov    $0x6,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <exec>:
+SYSCALL(exec)
+ 55b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <open>:
+SYSCALL(open)
+ 563:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mknod>:
+SYSCALL(mknod)
+ 56b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <unlink>:
+SYSCALL(unlink)
+ 573:	b8 12 00 00 00       	mov    $0x12,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <fstat>:
+SYSCALL(fstat)
+ 57b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <link>:
+SYSCALL(link)
+ 583:	b8 13 00 00 00       	mov    $0x13,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <mkdir>:
+SYSCALL(mkdir)
+ 58b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <chdir>:
+SYSCALL(chdir)
+ 593:	b8 09 00 00 00       	mov    $0x9,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <dup>:
+SYSCALL(dup)
+ 59b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getpid>:
+SYSCALL(getpid)
+ 5a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <sbrk>:
+SYSCALL(sbrk)
+ 5ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <sleep>:
+SYSCALL(sleep)
+ 5b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <uptime>:
+SYSCALL(uptime)
+ 5bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 5c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 5cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 5d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mlfqstart>:
+SYSCALL(mlfqstart)
+ 5db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 5e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 5eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 5f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <setpriority>:
+SYSCALL(setpriority)
+ 5fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 603:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <getcpustats>:
+SYSCALL(getcpustats)
+ 60b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <setscheduler>:
+SYSCALL(setscheduler)
+ 613:	b8 20 00 00 00       	mov    $0x20,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 61b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getscheduler>:
+SYSCALL(getscheduler)
+ 623:	b8 22 00 00 00       	mov    $0x22,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <splice>:
+SYSCALL(splice)
+ 62b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <readv>:
+SYSCALL(readv)
+ 633:	b8 24 00 00 00       	mov    $0x24,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <writev>:
+SYSCALL(writev)
+ 63b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <pread>:
+SYSCALL(pread)
+ 643:	b8 26 00 00 00       	mov    $0x26,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <pwrite>:
+SYSCALL(pwrite)
+ 64b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <getlogstat>:
+SYSCALL(getlogstat)
+ 653:	b8 28 00 00 00       	mov    $0x28,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mount>:
+SYSCALL(mount)
+ 65b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <umount>:
+SYSCALL(umount)
+ 663:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mmap>:
+SYSCALL(mmap)
+ 66b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <munmap>:
+SYSCALL(munmap)
+ 673:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <membench>:
+SYSCALL(membench)
+ 67b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <getlockstat>:
+SYSCALL(getlockstat)
+ 683:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <lockbench>:
+SYSCALL(lockbench)
+ 68b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <prof>:
+SYSCALL(prof)
+ 693:	b8 30 00 00 00       	mov    $0x30,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <tracectl>:
+SYSCALL(tracectl)
+ 69b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <traceread>:
+SYSCALL(traceread)
+ 6a3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <getsysstat>:
+SYSCALL(getsysstat)
+ 6ab:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 6b3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <getschedwait>:
+SYSCALL(getschedwait)
+ 6bb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <mlfqread>:
+SYSCALL(mlfqread)
+ 6c3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <dllock>:
+SYSCALL(dllock)
+ 6cb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 6d3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <deadlocklog>:
+SYSCALL(deadlocklog)
+ 6db:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <clone>:
+SYSCALL(clone)
+ 6e3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <join>:
+SYSCALL(join)
+ 6eb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <futex>:
+SYSCALL(futex)
+ 6f3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <shmat>:
+SYSCALL(shmat)
+ 6fb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <shmdt>:
+SYSCALL(shmdt)
+ 703:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <poll>:
+SYSCALL(poll)
+ 70b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+ 713:	66 90                	xchg   %ax,%ax
+ 715:	66 90                	xchg   %ax,%ax
+ 717:	66 90                	xchg   %ax,%ax
+ 719:	66 90                	xchg   %ax,%ax
+ 71b:	66 90                	xchg   %ax,%ax
+ 71d:	66 90                	xchg   %ax,%ax
+ 71f:	90                   	nop
+
+00000720 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 728:	89 d1                	mov    %edx,%ecx
+{
+ 72a:	83 ec 3c             	sub    $0x3c,%esp
+ 72d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 730:	85 d2                	test   %edx,%edx
+ 732:	0f 89 80 00 00 00    	jns    7b8 <printint+0x98>
+ 738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73c:	74 7a                	je     7b8 <printint+0x98>
+    x = -xx;
+ 73e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 740:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 745:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 748:	31 f6                	xor    %esi,%esi
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f7                	mov    %esi,%edi
+ 756:	f7 f3                	div    %ebx
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 b4 0e 00 00 	movzbl 0xeb4(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 da                	cmp    %ebx,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 771:	85 c0                	test   %eax,%eax
+ 773:	74 07                	je     77c <printint+0x5c>
+    buf[i++] = '-';
+ 775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77a:	89 f7                	mov    %esi,%edi
+ 77c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 77f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 782:	01 df                	add    %ebx,%edi
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 788:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 791:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 794:	6a 01                	push   $0x1
+ 796:	50                   	push   %eax
+ 797:	56                   	push   %esi
+ 798:	e8 a6 fd ff ff       	call   543 <write>
+  while(--i >= 0)
+ 79d:	89 f8                	mov    %edi,%eax
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 ef 01             	sub    $0x1,%edi
+ 7a5:	39 d8                	cmp    %ebx,%eax
+ 7a7:	75 df                	jne    788 <printint+0x68>
+}
+ 7a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ac:	5b                   	pop    %ebx
+ 7ad:	5e                   	pop    %esi
+ 7ae:	5f                   	pop    %edi
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7b8:	31 c0                	xor    %eax,%eax
+ 7ba:	eb 89                	jmp    745 <printint+0x25>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d2:	83 c6 01             	add    $0x1,%esi
+ 7d5:	84 db                	test   %bl,%bl
+ 7d7:	74 67                	je     840 <printf+0x80>
+ 7d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7dc:	31 d2                	xor    %edx,%edx
+ 7de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7e1:	eb 34                	jmp    817 <printf+0x57>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7f0:	83 f8 25             	cmp    $0x25,%eax
+ 7f3:	74 18                	je     80d <printf+0x4d>
+  write(fd, &c, 1);
+ 7f5:	83 ec 04             	sub    $0x4,%esp
+ 7f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fe:	6a 01                	push   $0x1
+ 800:	50                   	push   %eax
+ 801:	57                   	push   %edi
+ 802:	e8 3c fd ff ff       	call   543 <write>
+ 807:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 80a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 80d:	0f b6 1e             	movzbl (%esi),%ebx
+ 810:	83 c6 01             	add    $0x1,%esi
+ 813:	84 db                	test   %bl,%bl
+ 815:	74 29                	je     840 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 817:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 81a:	85 d2                	test   %edx,%edx
+ 81c:	74 ca                	je     7e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 81e:	83 fa 25             	cmp    $0x25,%edx
+ 821:	75 ea                	jne    80d <printf+0x4d>
+      if(c == 'd'){
+ 823:	83 f8 25             	cmp    $0x25,%eax
+ 826:	0f 84 24 01 00 00    	je     950 <printf+0x190>
+ 82c:	83 e8 63             	sub    $0x63,%eax
+ 82f:	83 f8 15             	cmp    $0x15,%eax
+ 832:	77 1c                	ja     850 <printf+0x90>
+ 834:	ff 24 85 5c 0e 00 00 	jmp    *0xe5c(,%eax,4)
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 843:	5b                   	pop    %ebx
+ 844:	5e                   	pop    %esi
+ 845:	5f                   	pop    %edi
+ 846:	5d                   	pop    %ebp
+ 847:	c3                   	ret
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 856:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 85a:	6a 01                	push   $0x1
+ 85c:	52                   	push   %edx
+ 85d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 860:	57                   	push   %edi
+ 861:	e8 dd fc ff ff       	call   543 <write>
+ 866:	83 c4 0c             	add    $0xc,%esp
+ 869:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86c:	6a 01                	push   $0x1
+ 86e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 871:	52                   	push   %edx
+ 872:	57                   	push   %edi
+ 873:	e8 cb fc ff ff       	call   543 <write>
+        putc(fd, c);
+ 878:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87b:	31 d2                	xor    %edx,%edx
+ 87d:	eb 8e                	jmp    80d <printf+0x4d>
+ 87f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 00                	push   $0x0
+ 88f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 891:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 894:	e8 87 fe ff ff       	call   720 <printint>
+        ap++;
+ 899:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 89c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 67 ff ff ff       	jmp    80d <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8bb:	85 db                	test   %ebx,%ebx
+ 8bd:	0f 84 9d 00 00 00    	je     960 <printf+0x1a0>
+        while(*s != 0){
+ 8c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	0f 84 3d ff ff ff    	je     80d <printf+0x4d>
+ 8d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8d6:	89 de                	mov    %ebx,%esi
+ 8d8:	89 d3                	mov    %edx,%ebx
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	53                   	push   %ebx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 51 fc ff ff       	call   543 <write>
+        while(*s != 0){
+ 8f2:	0f b6 06             	movzbl (%esi),%eax
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	75 e4                	jne    8e0 <printf+0x120>
+      state = 0;
+ 8fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 07 ff ff ff       	jmp    80d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 01                	push   $0x1
+ 91f:	e9 6b ff ff ff       	jmp    88f <printf+0xcf>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 928:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 931:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 933:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 936:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	52                   	push   %edx
+ 93c:	57                   	push   %edi
+ 93d:	e8 01 fc ff ff       	call   543 <write>
+        ap++;
+ 942:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 945:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	e9 be fe ff ff       	jmp    80d <printf+0x4d>
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 956:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 959:	6a 01                	push   $0x1
+ 95b:	e9 11 ff ff ff       	jmp    871 <printf+0xb1>
+ 960:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 965:	bb 52 0e 00 00       	mov    $0xe52,%ebx
+ 96a:	e9 61 ff ff ff       	jmp    8d0 <printf+0x110>
+ 96f:	90                   	nop
+
+00000970 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 973:	a1 f4 12 00 00       	mov    0x12f4,%eax
+{
+ 978:	89 e5                	mov    %esp,%ebp
+ 97a:	56                   	push   %esi
+ 97b:	53                   	push   %ebx
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 980:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 982:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 984:	39 ca                	cmp    %ecx,%edx
+ 986:	73 30                	jae    9b8 <bigfree+0x48>
+ 988:	39 c1                	cmp    %eax,%ecx
+ 98a:	72 04                	jb     990 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98c:	39 c2                	cmp    %eax,%edx
+ 98e:	72 f0                	jb     980 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 990:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 993:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 996:	39 f0                	cmp    %esi,%eax
+ 998:	74 26                	je     9c0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 99a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 99c:	8b 42 04             	mov    0x4(%edx),%eax
+ 99f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9a2:	39 d9                	cmp    %ebx,%ecx
+ 9a4:	74 30                	je     9d6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a8:	5b                   	pop    %ebx
+  freep = p;
+ 9a9:	89 15 f4 12 00 00    	mov    %edx,0x12f4
+}
+ 9af:	5e                   	pop    %esi
+ 9b0:	5d                   	pop    %ebp
+ 9b1:	c3                   	ret
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b8:	39 c1                	cmp    %eax,%ecx
+ 9ba:	72 d0                	jb     98c <bigfree+0x1c>
+ 9bc:	eb c2                	jmp    980 <bigfree+0x10>
+ 9be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 58 04             	add    0x4(%eax),%ebx
+ 9c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9d2:	39 d9                	cmp    %ebx,%ecx
+ 9d4:	75 d0                	jne    9a6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 9d6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9d9:	89 15 f4 12 00 00    	mov    %edx,0x12f4
+    p->s.size += bp->s.size;
+ 9df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e2:	8b 09                	mov    (%ecx),%ecx
+ 9e4:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e6:	5b                   	pop    %ebx
+ 9e7:	5e                   	pop    %esi
+ 9e8:	5d                   	pop    %ebp
+ 9e9:	c3                   	ret
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009f0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	89 c7                	mov    %eax,%edi
+ 9f6:	56                   	push   %esi
+ 9f7:	53                   	push   %ebx
+ 9f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9fb:	a1 f4 12 00 00       	mov    0x12f4,%eax
+ a00:	85 c0                	test   %eax,%eax
+ a02:	0f 84 88 00 00 00    	je     a90 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a08:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a0a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a0d:	39 f9                	cmp    %edi,%ecx
+ a0f:	73 5f                	jae    a70 <bigalloc+0x80>
+  if(nu < 4096)
+ a11:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a16:	39 df                	cmp    %ebx,%edi
+ a18:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a1b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a22:	eb 0d                	jmp    a31 <bigalloc+0x41>
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a2d:	39 f9                	cmp    %edi,%ecx
+ a2f:	73 3f                	jae    a70 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a31:	89 d0                	mov    %edx,%eax
+ a33:	39 15 f4 12 00 00    	cmp    %edx,0x12f4
+ a39:	75 ed                	jne    a28 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a3b:	83 ec 0c             	sub    $0xc,%esp
+ a3e:	56                   	push   %esi
+ a3f:	e8 67 fb ff ff       	call   5ab <sbrk>
+  if(p == (char*)-1)
+ a44:	83 c4 10             	add    $0x10,%esp
+ a47:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a4a:	74 11                	je     a5d <bigalloc+0x6d>
+  hp->s.size = nu;
+ a4c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ a4f:	e8 1c ff ff ff       	call   970 <bigfree>
+  return freep;
+ a54:	a1 f4 12 00 00       	mov    0x12f4,%eax
+      if((p = morecore(nunits)) == 0)
+ a59:	85 c0                	test   %eax,%eax
+ a5b:	75 cb                	jne    a28 <bigalloc+0x38>
+        return 0;
+  }
+}
+ a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a60:	31 d2                	xor    %edx,%edx
+}
+ a62:	5b                   	pop    %ebx
+ a63:	89 d0                	mov    %edx,%eax
+ a65:	5e                   	pop    %esi
+ a66:	5f                   	pop    %edi
+ a67:	5d                   	pop    %ebp
+ a68:	c3                   	ret
+ a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a70:	39 cf                	cmp    %ecx,%edi
+ a72:	74 4c                	je     ac0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ a74:	29 f9                	sub    %edi,%ecx
+ a76:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a79:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a7c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a7f:	a3 f4 12 00 00       	mov    %eax,0x12f4
+}
+ a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a87:	89 d0                	mov    %edx,%eax
+ a89:	5b                   	pop    %ebx
+ a8a:	5e                   	pop    %esi
+ a8b:	5f                   	pop    %edi
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+ a8e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ a90:	c7 05 f4 12 00 00 f8 	movl   $0x12f8,0x12f4
+ a97:	12 00 00 
+    base.s.size = 0;
+ a9a:	ba f8 12 00 00       	mov    $0x12f8,%edx
+    base.s.ptr = freep = prevp = &base;
+ a9f:	c7 05 f8 12 00 00 f8 	movl   $0x12f8,0x12f8
+ aa6:	12 00 00 
+    base.s.size = 0;
+ aa9:	c7 05 fc 12 00 00 00 	movl   $0x0,0x12fc
+ ab0:	00 00 00 
+    if(p->s.size >= nunits){
+ ab3:	e9 59 ff ff ff       	jmp    a11 <bigalloc+0x21>
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ac0:	8b 0a                	mov    (%edx),%ecx
+ ac2:	89 08                	mov    %ecx,(%eax)
+ ac4:	eb b9                	jmp    a7f <bigalloc+0x8f>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <free>:
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	53                   	push   %ebx
+ ad4:	83 ec 04             	sub    $0x4,%esp
+ ad7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ ada:	85 c9                	test   %ecx,%ecx
+ adc:	74 58                	je     b36 <free+0x66>
+  bp = (Header*)ap - 1;
+ ade:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+  asm volatile("lock; xchgl %0, %1" :
+ ae1:	ba 01 00 00 00       	mov    $0x1,%edx
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+ af0:	89 d0                	mov    %edx,%eax
+ af2:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+  while(xchg(&locked, 1) != 0)
+ af9:	85 c0                	test   %eax,%eax
+ afb:	75 f3                	jne    af0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ afd:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ b00:	83 fa 40             	cmp    $0x40,%edx
+ b03:	77 3b                	ja     b40 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ b05:	83 fa 02             	cmp    $0x2,%edx
+ b08:	76 3f                	jbe    b49 <free+0x79>
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b10:	83 c0 01             	add    $0x1,%eax
+ b13:	39 14 85 e0 0e 00 00 	cmp    %edx,0xee0(,%eax,4)
+ b1a:	72 f4                	jb     b10 <free+0x40>
+    bp->s.ptr = classfree[c];
+ b1c:	8b 14 85 c0 12 00 00 	mov    0x12c0(,%eax,4),%edx
+    classfree[c] = bp;
+ b23:	89 1c 85 c0 12 00 00 	mov    %ebx,0x12c0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ b2a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ b2d:	31 c0                	xor    %eax,%eax
+ b2f:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+}
+ b36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b39:	c9                   	leave
+ b3a:	c3                   	ret
+ b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+    bigfree(bp);
+ b40:	89 d8                	mov    %ebx,%eax
+ b42:	e8 29 fe ff ff       	call   970 <bigfree>
+ b47:	eb e4                	jmp    b2d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ b49:	31 c0                	xor    %eax,%eax
+ b4b:	eb cf                	jmp    b1c <free+0x4c>
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b50:	55                   	push   %ebp
+ b51:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	57                   	push   %edi
+ b59:	56                   	push   %esi
+ b5a:	53                   	push   %ebx
+ b5b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b61:	8d 50 07             	lea    0x7(%eax),%edx
+ b64:	c1 ea 03             	shr    $0x3,%edx
+ b67:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b70:	89 c8                	mov    %ecx,%eax
+ b72:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+ b79:	85 c0                	test   %eax,%eax
+ b7b:	75 f3                	jne    b70 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ b7d:	89 c3                	mov    %eax,%ebx
+ b7f:	83 fa 40             	cmp    $0x40,%edx
+ b82:	77 4c                	ja     bd0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ b84:	be 02 00 00 00       	mov    $0x2,%esi
+ b89:	83 fa 02             	cmp    $0x2,%edx
+ b8c:	76 10                	jbe    b9e <malloc+0x4e>
+ b8e:	66 90                	xchg   %ax,%ax
+ b90:	83 c3 01             	add    $0x1,%ebx
+ b93:	8b 34 9d e0 0e 00 00 	mov    0xee0(,%ebx,4),%esi
+ b9a:	39 d6                	cmp    %edx,%esi
+ b9c:	72 f2                	jb     b90 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ b9e:	8b 14 9d c0 12 00 00 	mov    0x12c0(,%ebx,4),%edx
+ ba5:	85 d2                	test   %edx,%edx
+ ba7:	74 47                	je     bf0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ ba9:	8b 3a                	mov    (%edx),%edi
+ bab:	89 3c 9d c0 12 00 00 	mov    %edi,0x12c0(,%ebx,4)
+ bb2:	31 c0                	xor    %eax,%eax
+ bb4:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ bbb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ bbe:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ bc1:	5b                   	pop    %ebx
+ bc2:	5e                   	pop    %esi
+ bc3:	5f                   	pop    %edi
+ bc4:	5d                   	pop    %ebp
+ bc5:	c3                   	ret
+ bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ bd0:	89 d0                	mov    %edx,%eax
+ bd2:	e8 19 fe ff ff       	call   9f0 <bigalloc>
+ bd7:	89 c2                	mov    %eax,%edx
+ bd9:	89 d8                	mov    %ebx,%eax
+ bdb:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+  return p ? (void*)(p + 1) : 0;
+ be2:	85 d2                	test   %edx,%edx
+ be4:	75 d5                	jne    bbb <malloc+0x6b>
+ be6:	31 c0                	xor    %eax,%eax
+}
+ be8:	83 c4 1c             	add    $0x1c,%esp
+ beb:	5b                   	pop    %ebx
+ bec:	5e                   	pop    %esi
+ bed:	5f                   	pop    %edi
+ bee:	5d                   	pop    %ebp
+ bef:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ bf0:	b8 00 02 00 00       	mov    $0x200,%eax
+ bf5:	e8 f6 fd ff ff       	call   9f0 <bigalloc>
+ bfa:	85 c0                	test   %eax,%eax
+ bfc:	74 44                	je     c42 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ bfe:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ c05:	8b 14 9d c0 12 00 00 	mov    0x12c0(,%ebx,4),%edx
+ c0c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ c0f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ c12:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ c18:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ c1b:	39 cf                	cmp    %ecx,%edi
+ c1d:	72 8a                	jb     ba9 <malloc+0x59>
+ c1f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ c22:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ c25:	8d 76 00             	lea    0x0(%esi),%esi
+ c28:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ c2a:	89 70 04             	mov    %esi,0x4(%eax)
+ c2d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c2f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ c31:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c33:	01 d8                	add    %ebx,%eax
+ c35:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ c38:	73 ee                	jae    c28 <malloc+0xd8>
+ c3a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ c3d:	e9 69 ff ff ff       	jmp    bab <malloc+0x5b>
+ c42:	f0 87 05 a0 12 00 00 	lock xchg %eax,0x12a0
+  return p ? (void*)(p + 1) : 0;
+ c49:	31 c0                	xor    %eax,%eax
+ c4b:	eb 9b                	jmp    be8 <malloc+0x98>
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	56                   	push   %esi
+ c54:	53                   	push   %ebx
+ c55:	8b 45 08             	mov    0x8(%ebp),%eax
+ c58:	f7 65 0c             	mull   0xc(%ebp)
+ c5b:	70 33                	jo     c90 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ c5d:	83 ec 0c             	sub    $0xc,%esp
+ c60:	89 c3                	mov    %eax,%ebx
+ c62:	50                   	push   %eax
+ c63:	e8 e8 fe ff ff       	call   b50 <malloc>
+ c68:	83 c4 10             	add    $0x10,%esp
+ c6b:	89 c6                	mov    %eax,%esi
+ c6d:	85 c0                	test   %eax,%eax
+ c6f:	74 1f                	je     c90 <calloc+0x40>
+    memset(p, 0, n);
+ c71:	83 ec 04             	sub    $0x4,%esp
+ c74:	53                   	push   %ebx
+ c75:	6a 00                	push   $0x0
+ c77:	50                   	push   %eax
+ c78:	e8 23 f7 ff ff       	call   3a0 <memset>
+ c7d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c83:	89 f0                	mov    %esi,%eax
+ c85:	5b                   	pop    %ebx
+ c86:	5e                   	pop    %esi
+ c87:	5d                   	pop    %ebp
+ c88:	c3                   	ret
+ c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c93:	31 f6                	xor    %esi,%esi
+}
+ c95:	89 f0                	mov    %esi,%eax
+ c97:	5b                   	pop    %ebx
+ c98:	5e                   	pop    %esi
+ c99:	5d                   	pop    %ebp
+ c9a:	c3                   	ret
+ c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+
+00000ca0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	57                   	push   %edi
+ ca4:	56                   	push   %esi
+ ca5:	53                   	push   %ebx
+ ca6:	83 ec 0c             	sub    $0xc,%esp
+ ca9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ caf:	85 db                	test   %ebx,%ebx
+ cb1:	74 55                	je     d08 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ cb3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ cb6:	89 de                	mov    %ebx,%esi
+ cb8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ cbf:	39 c7                	cmp    %eax,%edi
+ cc1:	72 0d                	jb     cd0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cc6:	89 f0                	mov    %esi,%eax
+ cc8:	5b                   	pop    %ebx
+ cc9:	5e                   	pop    %esi
+ cca:	5f                   	pop    %edi
+ ccb:	5d                   	pop    %ebp
+ ccc:	c3                   	ret
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ cd0:	83 ec 0c             	sub    $0xc,%esp
+ cd3:	50                   	push   %eax
+ cd4:	e8 77 fe ff ff       	call   b50 <malloc>
+ cd9:	83 c4 10             	add    $0x10,%esp
+ cdc:	89 c6                	mov    %eax,%esi
+ cde:	85 c0                	test   %eax,%eax
+ ce0:	74 e1                	je     cc3 <realloc+0x23>
+  memmove(p, ap, have);
+ ce2:	83 ec 04             	sub    $0x4,%esp
+ ce5:	57                   	push   %edi
+ ce6:	53                   	push   %ebx
+ ce7:	50                   	push   %eax
+ ce8:	e8 03 f8 ff ff       	call   4f0 <memmove>
+  free(ap);
+ ced:	89 1c 24             	mov    %ebx,(%esp)
+ cf0:	e8 db fd ff ff       	call   ad0 <free>
+  return p;
+ cf5:	83 c4 10             	add    $0x10,%esp
+}
+ cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cfb:	89 f0                	mov    %esi,%eax
+ cfd:	5b                   	pop    %ebx
+ cfe:	5e                   	pop    %esi
+ cff:	5f                   	pop    %edi
+ d00:	5d                   	pop    %ebp
+ d01:	c3                   	ret
+ d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ d08:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d0e:	5b                   	pop    %ebx
+ d0f:	5e                   	pop    %esi
+ d10:	5f                   	pop    %edi
+ d11:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d12:	e9 39 fe ff ff       	jmp    b50 <malloc>
@@ -0,0 +1,85 @@
+// Spinlock stress test: nproc processes contend for one kernel
+// spinlock, each acquiring it iters times and holding it for
+// hold cycles. Reports throughput, the worst wait for the lock,
+// and how far apart the processes finished, which shows how
+// fair the lock is. Compare kernels built with and without
+// TICKETLOCK=1, booted with CPUS=4 and CPUS=8.
+// usage: lockbench [nproc [iters [hold]]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+struct result {
+  int maxwait;   // longest wait for the lock, in cycles
+  uint done;     // finishing time, in units of 1024 cycles
+};
+
+int
+main(int argc, char *argv[])
+{
+  int i, pid, nproc, iters, hold, fds[2], maxwait;
+  uint first, last, sum, kc;
+  uint64 t0;
+  struct result r;
+
+  nproc = argc > 1 ? atoi(argv[1]) : 4;
+  iters = argc > 2 ? atoi(argv[2]) : 20000;
+  hold = argc > 3 ? atoi(argv[3]) : 200;
+  if(nproc < 1 || iters < 1 || hold < 0){
+    printf(2, "usage: lockbench [nproc [iters [hold]]]\n");
+    exit();
+  }
+  if(pipe(fds) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+
+  t0 = rdtsc();
+  for(i = 0; i < nproc; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "lockbench: fork failed\n");
+      break;
+    }
+    if(pid == 0){
+      close(fds[0]);
+      if((r.maxwait = lockbench(iters, hold)) < 0){
+        printf(2, "lockbench: lockbench failed\n");
+        exit();
+      }
+      r.done = (rdtsc() - t0) >> 10;
+      write(fds[1], &r, sizeof(r));
+      exit();
+    }
+  }
+  nproc = i;
+  close(fds[1]);
+
+  maxwait = 0;
+  first = 0xffffffff;
+  last = sum = 0;
+  for(i = 0; i < nproc && read(fds[0], &r, sizeof(r)) == sizeof(r); i++){
+    if(r.maxwait > maxwait)
+      maxwait = r.maxwait;
+    sum += r.maxwait / nproc;
+    if(r.done < first)
+      first = r.done;
+    if(r.done > last)
+      last = r.done;
+  }
+  while(wait() >= 0)
+    ;
+  if(i < nproc){
+    printf(2, "lockbench: lost results\n");
+    exit();
+  }
+  kc = last ? last : 1;
+
+  printf(1, "%d procs, %d acquires each, hold %d cycles\n", nproc, iters, hold);
+  printf(1, "throughput: %d acquires per Mcycle\n", nproc * iters * 1024 / kc);
+  printf(1, "worst wait: %d cycles (average worst %d)\n", maxwait, sum);
+  printf(1, "finished between %d and %d Kcycles\n", first, last);
+  exit();
+}
@@ -0,0 +1,1952 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 48             	sub    $0x48,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i, j, n, top, pid;
+  struct lockstat t;
+
+  top = 10;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-n") == 0){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8e a4 00 00 00    	jle    c6 <main+0xc6>
+  22:	50                   	push   %eax
+  23:	50                   	push   %eax
+  24:	68 64 0d 00 00       	push   $0xd64
+  29:	ff 77 04             	push   0x4(%edi)
+  2c:	e8 bf 02 00 00       	call   2f0 <strcmp>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	85 c0                	test   %eax,%eax
+  36:	74 56                	je     8e <main+0x8e>
+  top = 10;
+  38:	be 0a 00 00 00       	mov    $0xa,%esi
+  i = 1;
+  3d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    top = atoi(argv[i+1]);
+    i += 2;
+  }
+
+  if(i < argc){
+    if(getlockstat(st, MAXCLASS, 1) < 0){
+  42:	50                   	push   %eax
+  43:	6a 01                	push   $0x1
+  45:	6a 20                	push   $0x20
+  47:	68 00 12 00 00       	push   $0x1200
+  4c:	e8 12 06 00 00       	call   663 <getlockstat>
+  51:	83 c4 10             	add    $0x10,%esp
+  54:	85 c0                	test   %eax,%eax
+  56:	78 5b                	js     b3 <main+0xb3>
+      printf(2, "lockstat: getlockstat failed\n");
+      exit();
+    }
+    pid = fork();
+  58:	e8 9e 04 00 00       	call   4fb <fork>
+    if(pid < 0){
+  5d:	85 c0                	test   %eax,%eax
+  5f:	0f 88 26 02 00 00    	js     28b <main+0x28b>
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	0f 85 16 02 00 00    	jne    281 <main+0x281>
+      exec(argv[i], argv+i);
+  6b:	8d 1c 9f             	lea    (%edi,%ebx,4),%ebx
+  6e:	52                   	push   %edx
+  6f:	52                   	push   %edx
+  70:	53                   	push   %ebx
+  71:	ff 33                	push   (%ebx)
+  73:	e8 c3 04 00 00       	call   53b <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[i]);
+  78:	83 c4 0c             	add    $0xc,%esp
+  7b:	ff 33                	push   (%ebx)
+  7d:	68 9c 0d 00 00       	push   $0xd9c
+  82:	6a 02                	push   $0x2
+  84:	e8 17 07 00 00       	call   7a0 <printf>
+      exit();
+  89:	e8 75 04 00 00       	call   503 <exit>
+    if(i+1 >= argc)
+  8e:	83 fb 02             	cmp    $0x2,%ebx
+  91:	0f 84 e5 01 00 00    	je     27c <main+0x27c>
+    top = atoi(argv[i+1]);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	ff 77 08             	push   0x8(%edi)
+  9d:	e8 ee 03 00 00       	call   490 <atoi>
+  if(i < argc){
+  a2:	83 c4 10             	add    $0x10,%esp
+    top = atoi(argv[i+1]);
+  a5:	89 c6                	mov    %eax,%esi
+  if(i < argc){
+  a7:	83 fb 03             	cmp    $0x3,%ebx
+  aa:	74 1f                	je     cb <main+0xcb>
+    i += 2;
+  ac:	bb 03 00 00 00       	mov    $0x3,%ebx
+  b1:	eb 8f                	jmp    42 <main+0x42>
+      printf(2, "lockstat: getlockstat failed\n");
+  b3:	53                   	push   %ebx
+  b4:	53                   	push   %ebx
+  b5:	68 67 0d 00 00       	push   $0xd67
+  ba:	6a 02                	push   $0x2
+  bc:	e8 df 06 00 00       	call   7a0 <printf>
+      exit();
+  c1:	e8 3d 04 00 00       	call   503 <exit>
+  top = 10;
+  c6:	be 0a 00 00 00       	mov    $0xa,%esi
+    }
+    wait();
+  }
+
+  if((n = getlockstat(st, MAXCLASS, 0)) < 0){
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	6a 00                	push   $0x0
+  d0:	6a 20                	push   $0x20
+  d2:	68 00 12 00 00       	push   $0x1200
+  d7:	e8 87 05 00 00       	call   663 <getlockstat>
+  dc:	83 c4 10             	add    $0x10,%esp
+  df:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  e2:	85 c0                	test   %eax,%eax
+  e4:	78 cd                	js     b3 <main+0xb3>
+    printf(2, "lockstat: getlockstat failed\n");
+    exit();
+  }
+
+  // Sort by cycles spent spinning, most first.
+  for(i = 1; i < n; i++){
+  e6:	83 e8 01             	sub    $0x1,%eax
+  e9:	0f 8e f2 00 00 00    	jle    1e1 <main+0x1e1>
+  ef:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  f2:	bb 24 12 00 00       	mov    $0x1224,%ebx
+  f7:	bf 01 00 00 00       	mov    $0x1,%edi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    t = st[i];
+ 100:	8b 03                	mov    (%ebx),%eax
+ 102:	8b 73 18             	mov    0x18(%ebx),%esi
+ 105:	89 fa                	mov    %edi,%edx
+ 107:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 10a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 10d:	89 75 dc             	mov    %esi,-0x24(%ebp)
+ 110:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 113:	8b 43 08             	mov    0x8(%ebx),%eax
+ 116:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 119:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 11c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 11f:	8b 43 10             	mov    0x10(%ebx),%eax
+ 122:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 125:	8b 43 14             	mov    0x14(%ebx),%eax
+ 128:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 12b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+ 12e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 131:	8b 43 20             	mov    0x20(%ebx),%eax
+ 134:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 137:	89 d8                	mov    %ebx,%eax
+ 139:	eb 46                	jmp    181 <main+0x181>
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+      st[j] = st[j-1];
+ 140:	8b 48 dc             	mov    -0x24(%eax),%ecx
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 143:	83 e8 24             	sub    $0x24,%eax
+      st[j] = st[j-1];
+ 146:	89 48 24             	mov    %ecx,0x24(%eax)
+ 149:	8b 48 04             	mov    0x4(%eax),%ecx
+ 14c:	89 48 28             	mov    %ecx,0x28(%eax)
+ 14f:	8b 48 08             	mov    0x8(%eax),%ecx
+ 152:	89 48 2c             	mov    %ecx,0x2c(%eax)
+ 155:	8b 48 0c             	mov    0xc(%eax),%ecx
+ 158:	89 48 30             	mov    %ecx,0x30(%eax)
+ 15b:	8b 48 10             	mov    0x10(%eax),%ecx
+ 15e:	89 48 34             	mov    %ecx,0x34(%eax)
+ 161:	8b 48 14             	mov    0x14(%eax),%ecx
+ 164:	89 48 38             	mov    %ecx,0x38(%eax)
+ 167:	8b 48 18             	mov    0x18(%eax),%ecx
+ 16a:	89 48 3c             	mov    %ecx,0x3c(%eax)
+ 16d:	8b 48 1c             	mov    0x1c(%eax),%ecx
+ 170:	89 48 40             	mov    %ecx,0x40(%eax)
+ 173:	8b 48 20             	mov    0x20(%eax),%ecx
+ 176:	89 48 44             	mov    %ecx,0x44(%eax)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 179:	85 d2                	test   %edx,%edx
+ 17b:	0f 84 ef 00 00 00    	je     270 <main+0x270>
+ 181:	89 d1                	mov    %edx,%ecx
+ 183:	8d 52 ff             	lea    -0x1(%edx),%edx
+ 186:	39 70 f4             	cmp    %esi,-0xc(%eax)
+ 189:	72 b5                	jb     140 <main+0x140>
+    st[j] = t;
+ 18b:	8d 14 c9             	lea    (%ecx,%ecx,8),%edx
+ 18e:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  for(i = 1; i < n; i++){
+ 191:	83 c7 01             	add    $0x1,%edi
+ 194:	83 c3 24             	add    $0x24,%ebx
+    st[j] = t;
+ 197:	8d 04 95 00 12 00 00 	lea    0x1200(,%edx,4),%eax
+ 19e:	89 0c 95 00 12 00 00 	mov    %ecx,0x1200(,%edx,4)
+ 1a5:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 1a8:	89 50 04             	mov    %edx,0x4(%eax)
+ 1ab:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1ae:	89 50 08             	mov    %edx,0x8(%eax)
+ 1b1:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 1b4:	89 50 0c             	mov    %edx,0xc(%eax)
+ 1b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 1ba:	89 50 10             	mov    %edx,0x10(%eax)
+ 1bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 1c0:	89 50 14             	mov    %edx,0x14(%eax)
+ 1c3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 1c6:	89 50 18             	mov    %edx,0x18(%eax)
+ 1c9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 1cc:	89 50 1c             	mov    %edx,0x1c(%eax)
+ 1cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1d2:	89 50 20             	mov    %edx,0x20(%eax)
+  for(i = 1; i < n; i++){
+ 1d5:	39 7d b4             	cmp    %edi,-0x4c(%ebp)
+ 1d8:	0f 85 22 ff ff ff    	jne    100 <main+0x100>
+ 1de:	8b 75 b0             	mov    -0x50(%ebp),%esi
+  }
+
+  printf(1, "lock\t\tacquire\tcontend\tspin(Kc)\thold(Kc)\tmaxhold(c)\n");
+ 1e1:	50                   	push   %eax
+ 1e2:	50                   	push   %eax
+ 1e3:	68 30 0d 00 00       	push   $0xd30
+ 1e8:	6a 01                	push   $0x1
+ 1ea:	e8 b1 05 00 00       	call   7a0 <printf>
+  for(i = 0; i < n && i < top; i++){
+ 1ef:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 1f2:	39 c6                	cmp    %eax,%esi
+ 1f4:	0f 4f f0             	cmovg  %eax,%esi
+ 1f7:	83 c4 10             	add    $0x10,%esp
+ 1fa:	85 f6                	test   %esi,%esi
+ 1fc:	7e 79                	jle    277 <main+0x277>
+ 1fe:	6b f6 24             	imul   $0x24,%esi,%esi
+ 201:	bb 00 12 00 00       	mov    $0x1200,%ebx
+ 206:	01 de                	add    %ebx,%esi
+ 208:	eb 2e                	jmp    238 <main+0x238>
+ 20a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "%s\t", st[i].name);
+    if(strlen(st[i].name) < 8)
+      printf(1, "\t");
+    printf(1, "%d\t%d\t%d\t\t%d\t\t%d\n", st[i].nacquire, st[i].ncontend,
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	ff 73 20             	push   0x20(%ebx)
+  for(i = 0; i < n && i < top; i++){
+ 216:	83 c3 24             	add    $0x24,%ebx
+    printf(1, "%d\t%d\t%d\t\t%d\t\t%d\n", st[i].nacquire, st[i].ncontend,
+ 219:	ff 73 f8             	push   -0x8(%ebx)
+ 21c:	ff 73 f4             	push   -0xc(%ebx)
+ 21f:	ff 73 f0             	push   -0x10(%ebx)
+ 222:	ff 73 ec             	push   -0x14(%ebx)
+ 225:	68 ba 0d 00 00       	push   $0xdba
+ 22a:	6a 01                	push   $0x1
+ 22c:	e8 6f 05 00 00       	call   7a0 <printf>
+  for(i = 0; i < n && i < top; i++){
+ 231:	83 c4 20             	add    $0x20,%esp
+ 234:	39 f3                	cmp    %esi,%ebx
+ 236:	74 3f                	je     277 <main+0x277>
+    printf(1, "%s\t", st[i].name);
+ 238:	83 ec 04             	sub    $0x4,%esp
+ 23b:	53                   	push   %ebx
+ 23c:	68 b6 0d 00 00       	push   $0xdb6
+ 241:	6a 01                	push   $0x1
+ 243:	e8 58 05 00 00       	call   7a0 <printf>
+    if(strlen(st[i].name) < 8)
+ 248:	89 1c 24             	mov    %ebx,(%esp)
+ 24b:	e8 00 01 00 00       	call   350 <strlen>
+ 250:	83 c4 10             	add    $0x10,%esp
+ 253:	83 f8 07             	cmp    $0x7,%eax
+ 256:	77 b8                	ja     210 <main+0x210>
+      printf(1, "\t");
+ 258:	83 ec 08             	sub    $0x8,%esp
+ 25b:	68 b8 0d 00 00       	push   $0xdb8
+ 260:	6a 01                	push   $0x1
+ 262:	e8 39 05 00 00       	call   7a0 <printf>
+ 267:	83 c4 10             	add    $0x10,%esp
+ 26a:	eb a4                	jmp    210 <main+0x210>
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 270:	31 c9                	xor    %ecx,%ecx
+ 272:	e9 14 ff ff ff       	jmp    18b <main+0x18b>
+           st[i].spin, st[i].hold, st[i].maxhold);
+  }
+  exit();
+ 277:	e8 87 02 00 00       	call   503 <exit>
+      usage();
+ 27c:	e8 1f 00 00 00       	call   2a0 <usage>
+    wait();
+ 281:	e8 85 02 00 00       	call   50b <wait>
+ 286:	e9 40 fe ff ff       	jmp    cb <main+0xcb>
+      printf(2, "lockstat: fork failed\n");
+ 28b:	51                   	push   %ecx
+ 28c:	51                   	push   %ecx
+ 28d:	68 85 0d 00 00       	push   $0xd85
+ 292:	6a 02                	push   $0x2
+ 294:	e8 07 05 00 00       	call   7a0 <printf>
+      exit();
+ 299:	e8 65 02 00 00       	call   503 <exit>
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <usage>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: lockstat [-n count] [command args...]\n");
+ 2a6:	68 00 0d 00 00       	push   $0xd00
+ 2ab:	6a 02                	push   $0x2
+ 2ad:	e8 ee 04 00 00       	call   7a0 <printf>
+  exit();
+ 2b2:	e8 4c 02 00 00       	call   503 <exit>
+ 2b7:	66 90                	xchg   %ax,%ax
+ 2b9:	66 90                	xchg   %ax,%ax
+ 2bb:	66 90                	xchg   %ax,%ax
+ 2bd:	66 90                	xchg   %ax,%ax
+ 2bf:	90                   	nop
+
+000002c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 1e 01 00 00       	call   51b <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 f1 00 00 00       	call   543 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 f4 00 00 00       	call   55b <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 ba 00 00 00       	call   52b <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+
+000004fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <exit>:
+SYSCALL(exit)
+ 503:	b8 02 00 00 00       	mov    $0x2,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <wait>:
+SYSCALL(wait)
+ 50b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <pipe>:
+SYSCALL(pipe)
+ 513:	b8 04 00 00 00       	mov    $0x4,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <read>:
+SYSCALL(read)
+ 51b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <write>:
+SYSCALL(write)
+ 523:	b8 10 00 00 00       	mov    $0x10,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <close>:
+SYSCALL(close)
+ 52b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <kill>:
+SYSCALL(kill)
+ 533:	b8 06 00 00 00       	mov    $0x6,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <exec>:
+SYSCALL(exec)
+ 53b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <open>:
+SYSCALL(open)
+ 543:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mknod>:
+SYSCALL(mknod)
+ 54b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <unlink>:
+SYSCALL(unlink)
+ 553:	b8 12 00 00 00       	mov    $0x12,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <fstat>:
+SYSCALL(fstat)
+ 55b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <link>:
+SYSCALL(link)
+ 563:	b8 13 00 00 00       	mov    $0x13,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mkdir>:
+SYSCALL(mkdir)
+ 56b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <chdir>:
+SYSCALL(chdir)
+ 573:	b8 09 00 00 00       	mov    $0x9,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <dup>:
+SYSCALL(dup)
+ 57b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getpid>:
+SYSCALL(getpid)
+ 583:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sbrk>:
+SYSCALL(sbrk)
+ 58b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <sleep>:
+SYSCALL(sleep)
+ 593:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <uptime>:
+SYSCALL(uptime)
+ 59b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 5a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 5ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 5b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 5bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 5c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 5cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 5d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <setpriority>:
+SYSCALL(setpriority)
+ 5db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 5e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <getcpustats>:
+SYSCALL(getcpustats)
+ 5eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <setscheduler>:
+SYSCALL(setscheduler)
+ 5f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 5fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getscheduler>:
+SYSCALL(getscheduler)
+ 603:	b8 22 00 00 00       	mov    $0x22,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <splice>:
+SYSCALL(splice)
+ 60b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <readv>:
+SYSCALL(readv)
+ 613:	b8 24 00 00 00       	mov    $0x24,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <writev>:
+SYSCALL(writev)
+ 61b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <pread>:
+SYSCALL(pread)
+ 623:	b8 26 00 00 00       	mov    $0x26,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <pwrite>:
+SYSCALL(pwrite)
+ 62b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getlogstat>:
+SYSCALL(getlogstat)
+ 633:	b8 28 00 00 00       	mov    $0x28,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <mount>:
+SYSCALL(mount)
+ 63b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <umount>:
+SYSCALL(umount)
+ 643:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mmap>:
+SYSCALL(mmap)
+ 64b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <munmap>:
+SYSCALL(munmap)
+ 653:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <membench>:
+SYSCALL(membench)
+ 65b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getlockstat>:
+SYSCALL(getlockstat)
+ 663:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <lockbench>:
+SYSCALL(lockbench)
+ 66b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <prof>:
+SYSCALL(prof)
+ 673:	b8 30 00 00 00       	mov    $0x30,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <tracectl>:
+SYSCALL(tracectl)
+ 67b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <traceread>:
+SYSCALL(traceread)
+ 683:	b8 32 00 00 00       	mov    $0x32,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <getsysstat>:
+SYSCALL(getsysstat)
+ 68b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 693:	b8 34 00 00 00       	mov    $0x34,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <getschedwait>:
+SYSCALL(getschedwait)
+ 69b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <mlfqread>:
+SYSCALL(mlfqread)
+ 6a3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <dllock>:
+SYSCALL(dllock)
+ 6ab:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 6b3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 6bb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <clone>:
+SYSCALL(clone)
+ 6c3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <join>:
+SYSCALL(join)
+ 6cb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <futex>:
+SYSCALL(futex)
+ 6d3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <shmat>:
+SYSCALL(shmat)
+ 6db:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <shmdt>:
+SYSCALL(shmdt)
+ 6e3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <poll>:
+SYSCALL(poll)
+ 6eb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+ 6f3:	66 90                	xchg   %ax,%ax
+ 6f5:	66 90                	xchg   %ax,%ax
+ 6f7:	66 90                	xchg   %ax,%ax
+ 6f9:	66 90                	xchg   %ax,%ax
+ 6fb:	66 90                	xchg   %ax,%ax
+ 6fd:	66 90                	xchg   %ax,%ax
+ 6ff:	90                   	nop
+
+00000700 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 708:	89 d1                	mov    %edx,%ecx
+{
+ 70a:	83 ec 3c             	sub    $0x3c,%esp
+ 70d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 710:	85 d2                	test   %edx,%edx
+ 712:	0f 89 80 00 00 00    	jns    798 <printint+0x98>
+ 718:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 71c:	74 7a                	je     798 <printint+0x98>
+    x = -xx;
+ 71e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 720:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 725:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 728:	31 f6                	xor    %esi,%esi
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 730:	89 c8                	mov    %ecx,%eax
+ 732:	31 d2                	xor    %edx,%edx
+ 734:	89 f7                	mov    %esi,%edi
+ 736:	f7 f3                	div    %ebx
+ 738:	8d 76 01             	lea    0x1(%esi),%esi
+ 73b:	0f b6 92 2c 0e 00 00 	movzbl 0xe2c(%edx),%edx
+ 742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 746:	89 ca                	mov    %ecx,%edx
+ 748:	89 c1                	mov    %eax,%ecx
+ 74a:	39 da                	cmp    %ebx,%edx
+ 74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+ 74e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 751:	85 c0                	test   %eax,%eax
+ 753:	74 07                	je     75c <printint+0x5c>
+    buf[i++] = '-';
+ 755:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 75a:	89 f7                	mov    %esi,%edi
+ 75c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 75f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 762:	01 df                	add    %ebx,%edi
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 768:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 771:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 774:	6a 01                	push   $0x1
+ 776:	50                   	push   %eax
+ 777:	56                   	push   %esi
+ 778:	e8 a6 fd ff ff       	call   523 <write>
+  while(--i >= 0)
+ 77d:	89 f8                	mov    %edi,%eax
+ 77f:	83 c4 10             	add    $0x10,%esp
+ 782:	83 ef 01             	sub    $0x1,%edi
+ 785:	39 d8                	cmp    %ebx,%eax
+ 787:	75 df                	jne    768 <printint+0x68>
+}
+ 789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 78c:	5b                   	pop    %ebx
+ 78d:	5e                   	pop    %esi
+ 78e:	5f                   	pop    %edi
+ 78f:	5d                   	pop    %ebp
+ 790:	c3                   	ret
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 798:	31 c0                	xor    %eax,%eax
+ 79a:	eb 89                	jmp    725 <printint+0x25>
+ 79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7af:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b2:	83 c6 01             	add    $0x1,%esi
+ 7b5:	84 db                	test   %bl,%bl
+ 7b7:	74 67                	je     820 <printf+0x80>
+ 7b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7bc:	31 d2                	xor    %edx,%edx
+ 7be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7c1:	eb 34                	jmp    7f7 <printf+0x57>
+ 7c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7c7:	90                   	nop
+ 7c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7d0:	83 f8 25             	cmp    $0x25,%eax
+ 7d3:	74 18                	je     7ed <printf+0x4d>
+  write(fd, &c, 1);
+ 7d5:	83 ec 04             	sub    $0x4,%esp
+ 7d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7de:	6a 01                	push   $0x1
+ 7e0:	50                   	push   %eax
+ 7e1:	57                   	push   %edi
+ 7e2:	e8 3c fd ff ff       	call   523 <write>
+ 7e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 7f0:	83 c6 01             	add    $0x1,%esi
+ 7f3:	84 db                	test   %bl,%bl
+ 7f5:	74 29                	je     820 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7fa:	85 d2                	test   %edx,%edx
+ 7fc:	74 ca                	je     7c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7fe:	83 fa 25             	cmp    $0x25,%edx
+ 801:	75 ea                	jne    7ed <printf+0x4d>
+      if(c == 'd'){
+ 803:	83 f8 25             	cmp    $0x25,%eax
+ 806:	0f 84 24 01 00 00    	je     930 <printf+0x190>
+ 80c:	83 e8 63             	sub    $0x63,%eax
+ 80f:	83 f8 15             	cmp    $0x15,%eax
+ 812:	77 1c                	ja     830 <printf+0x90>
+ 814:	ff 24 85 d4 0d 00 00 	jmp    *0xdd4(,%eax,4)
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 823:	5b                   	pop    %ebx
+ 824:	5e                   	pop    %esi
+ 825:	5f                   	pop    %edi
+ 826:	5d                   	pop    %ebp
+ 827:	c3                   	ret
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 836:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 83a:	6a 01                	push   $0x1
+ 83c:	52                   	push   %edx
+ 83d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 840:	57                   	push   %edi
+ 841:	e8 dd fc ff ff       	call   523 <write>
+ 846:	83 c4 0c             	add    $0xc,%esp
+ 849:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84c:	6a 01                	push   $0x1
+ 84e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 851:	52                   	push   %edx
+ 852:	57                   	push   %edi
+ 853:	e8 cb fc ff ff       	call   523 <write>
+        putc(fd, c);
+ 858:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 85b:	31 d2                	xor    %edx,%edx
+ 85d:	eb 8e                	jmp    7ed <printf+0x4d>
+ 85f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 00                	push   $0x0
+ 86f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 871:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 874:	e8 87 fe ff ff       	call   700 <printint>
+        ap++;
+ 879:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 87c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 67 ff ff ff       	jmp    7ed <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 890:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 893:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 895:	83 c0 04             	add    $0x4,%eax
+ 898:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 89b:	85 db                	test   %ebx,%ebx
+ 89d:	0f 84 9d 00 00 00    	je     940 <printf+0x1a0>
+        while(*s != 0){
+ 8a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	0f 84 3d ff ff ff    	je     7ed <printf+0x4d>
+ 8b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8b6:	89 de                	mov    %ebx,%esi
+ 8b8:	89 d3                	mov    %edx,%ebx
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	53                   	push   %ebx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 51 fc ff ff       	call   523 <write>
+        while(*s != 0){
+ 8d2:	0f b6 06             	movzbl (%esi),%eax
+ 8d5:	83 c4 10             	add    $0x10,%esp
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	75 e4                	jne    8c0 <printf+0x120>
+      state = 0;
+ 8dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	e9 07 ff ff ff       	jmp    7ed <printf+0x4d>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 01                	push   $0x1
+ 8ff:	e9 6b ff ff ff       	jmp    86f <printf+0xcf>
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 908:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 90b:	83 ec 04             	sub    $0x4,%esp
+ 90e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 911:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 913:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 916:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	52                   	push   %edx
+ 91c:	57                   	push   %edi
+ 91d:	e8 01 fc ff ff       	call   523 <write>
+        ap++;
+ 922:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 925:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 928:	31 d2                	xor    %edx,%edx
+ 92a:	e9 be fe ff ff       	jmp    7ed <printf+0x4d>
+ 92f:	90                   	nop
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 936:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 939:	6a 01                	push   $0x1
+ 93b:	e9 11 ff ff ff       	jmp    851 <printf+0xb1>
+ 940:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 945:	bb cc 0d 00 00       	mov    $0xdcc,%ebx
+ 94a:	e9 61 ff ff ff       	jmp    8b0 <printf+0x110>
+ 94f:	90                   	nop
+
+00000950 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 953:	a1 d4 16 00 00       	mov    0x16d4,%eax
+{
+ 958:	89 e5                	mov    %esp,%ebp
+ 95a:	56                   	push   %esi
+ 95b:	53                   	push   %ebx
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 960:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 962:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 964:	39 ca                	cmp    %ecx,%edx
+ 966:	73 30                	jae    998 <bigfree+0x48>
+ 968:	39 c1                	cmp    %eax,%ecx
+ 96a:	72 04                	jb     970 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 96c:	39 c2                	cmp    %eax,%edx
+ 96e:	72 f0                	jb     960 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 970:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 973:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 976:	39 f0                	cmp    %esi,%eax
+ 978:	74 26                	je     9a0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 97a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 97c:	8b 42 04             	mov    0x4(%edx),%eax
+ 97f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 982:	39 d9                	cmp    %ebx,%ecx
+ 984:	74 30                	je     9b6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 986:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 988:	5b                   	pop    %ebx
+  freep = p;
+ 989:	89 15 d4 16 00 00    	mov    %edx,0x16d4
+}
+ 98f:	5e                   	pop    %esi
+ 990:	5d                   	pop    %ebp
+ 991:	c3                   	ret
+ 992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 998:	39 c1                	cmp    %eax,%ecx
+ 99a:	72 d0                	jb     96c <bigfree+0x1c>
+ 99c:	eb c2                	jmp    960 <bigfree+0x10>
+ 99e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9a0:	03 58 04             	add    0x4(%eax),%ebx
+ 9a3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a6:	8b 02                	mov    (%edx),%eax
+ 9a8:	8b 00                	mov    (%eax),%eax
+ 9aa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9ac:	8b 42 04             	mov    0x4(%edx),%eax
+ 9af:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9b2:	39 d9                	cmp    %ebx,%ecx
+ 9b4:	75 d0                	jne    986 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 9b6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9b9:	89 15 d4 16 00 00    	mov    %edx,0x16d4
+    p->s.size += bp->s.size;
+ 9bf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9c2:	8b 09                	mov    (%ecx),%ecx
+ 9c4:	89 0a                	mov    %ecx,(%edx)
+}
+ 9c6:	5b                   	pop    %ebx
+ 9c7:	5e                   	pop    %esi
+ 9c8:	5d                   	pop    %ebp
+ 9c9:	c3                   	ret
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009d0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	89 c7                	mov    %eax,%edi
+ 9d6:	56                   	push   %esi
+ 9d7:	53                   	push   %ebx
+ 9d8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9db:	a1 d4 16 00 00       	mov    0x16d4,%eax
+ 9e0:	85 c0                	test   %eax,%eax
+ 9e2:	0f 84 88 00 00 00    	je     a70 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 9ed:	39 f9                	cmp    %edi,%ecx
+ 9ef:	73 5f                	jae    a50 <bigalloc+0x80>
+  if(nu < 4096)
+ 9f1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9f6:	39 df                	cmp    %ebx,%edi
+ 9f8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9fb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a02:	eb 0d                	jmp    a11 <bigalloc+0x41>
+ a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a08:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a0a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a0d:	39 f9                	cmp    %edi,%ecx
+ a0f:	73 3f                	jae    a50 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a11:	89 d0                	mov    %edx,%eax
+ a13:	39 15 d4 16 00 00    	cmp    %edx,0x16d4
+ a19:	75 ed                	jne    a08 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a1b:	83 ec 0c             	sub    $0xc,%esp
+ a1e:	56                   	push   %esi
+ a1f:	e8 67 fb ff ff       	call   58b <sbrk>
+  if(p == (char*)-1)
+ a24:	83 c4 10             	add    $0x10,%esp
+ a27:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a2a:	74 11                	je     a3d <bigalloc+0x6d>
+  hp->s.size = nu;
+ a2c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ a2f:	e8 1c ff ff ff       	call   950 <bigfree>
+  return freep;
+ a34:	a1 d4 16 00 00       	mov    0x16d4,%eax
+      if((p = morecore(nunits)) == 0)
+ a39:	85 c0                	test   %eax,%eax
+ a3b:	75 cb                	jne    a08 <bigalloc+0x38>
+        return 0;
+  }
+}
+ a3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a40:	31 d2                	xor    %edx,%edx
+}
+ a42:	5b                   	pop    %ebx
+ a43:	89 d0                	mov    %edx,%eax
+ a45:	5e                   	pop    %esi
+ a46:	5f                   	pop    %edi
+ a47:	5d                   	pop    %ebp
+ a48:	c3                   	ret
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a50:	39 cf                	cmp    %ecx,%edi
+ a52:	74 4c                	je     aa0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ a54:	29 f9                	sub    %edi,%ecx
+ a56:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a59:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a5c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a5f:	a3 d4 16 00 00       	mov    %eax,0x16d4
+}
+ a64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a67:	89 d0                	mov    %edx,%eax
+ a69:	5b                   	pop    %ebx
+ a6a:	5e                   	pop    %esi
+ a6b:	5f                   	pop    %edi
+ a6c:	5d                   	pop    %ebp
+ a6d:	c3                   	ret
+ a6e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ a70:	c7 05 d4 16 00 00 d8 	movl   $0x16d8,0x16d4
+ a77:	16 00 00 
+    base.s.size = 0;
+ a7a:	ba d8 16 00 00       	mov    $0x16d8,%edx
+    base.s.ptr = freep = prevp = &base;
+ a7f:	c7 05 d8 16 00 00 d8 	movl   $0x16d8,0x16d8
+ a86:	16 00 00 
+    base.s.size = 0;
+ a89:	c7 05 dc 16 00 00 00 	movl   $0x0,0x16dc
+ a90:	00 00 00 
+    if(p->s.size >= nunits){
+ a93:	e9 59 ff ff ff       	jmp    9f1 <bigalloc+0x21>
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ aa0:	8b 0a                	mov    (%edx),%ecx
+ aa2:	89 08                	mov    %ecx,(%eax)
+ aa4:	eb b9                	jmp    a5f <bigalloc+0x8f>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <free>:
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	53                   	push   %ebx
+ ab4:	83 ec 04             	sub    $0x4,%esp
+ ab7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ aba:	85 c9                	test   %ecx,%ecx
+ abc:	74 58                	je     b16 <free+0x66>
+  bp = (Header*)ap - 1;
+ abe:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ ac1:	ba 01 00 00 00       	mov    $0x1,%edx
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+ ad0:	89 d0                	mov    %edx,%eax
+ ad2:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+  while(xchg(&locked, 1) != 0)
+ ad9:	85 c0                	test   %eax,%eax
+ adb:	75 f3                	jne    ad0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ add:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ ae0:	83 fa 40             	cmp    $0x40,%edx
+ ae3:	77 3b                	ja     b20 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ ae5:	83 fa 02             	cmp    $0x2,%edx
+ ae8:	76 3f                	jbe    b29 <free+0x79>
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ af0:	83 c0 01             	add    $0x1,%eax
+ af3:	39 14 85 40 0e 00 00 	cmp    %edx,0xe40(,%eax,4)
+ afa:	72 f4                	jb     af0 <free+0x40>
+    bp->s.ptr = classfree[c];
+ afc:	8b 14 85 a0 16 00 00 	mov    0x16a0(,%eax,4),%edx
+    classfree[c] = bp;
+ b03:	89 1c 85 a0 16 00 00 	mov    %ebx,0x16a0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ b0a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ b0d:	31 c0                	xor    %eax,%eax
+ b0f:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+}
+ b16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b19:	c9                   	leave
+ b1a:	c3                   	ret
+ b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+    bigfree(bp);
+ b20:	89 d8                	mov    %ebx,%eax
+ b22:	e8 29 fe ff ff       	call   950 <bigfree>
+ b27:	eb e4                	jmp    b0d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ b29:	31 c0                	xor    %eax,%eax
+ b2b:	eb cf                	jmp    afc <free+0x4c>
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b30:	55                   	push   %ebp
+ b31:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b36:	89 e5                	mov    %esp,%ebp
+ b38:	57                   	push   %edi
+ b39:	56                   	push   %esi
+ b3a:	53                   	push   %ebx
+ b3b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b41:	8d 50 07             	lea    0x7(%eax),%edx
+ b44:	c1 ea 03             	shr    $0x3,%edx
+ b47:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b50:	89 c8                	mov    %ecx,%eax
+ b52:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+ b59:	85 c0                	test   %eax,%eax
+ b5b:	75 f3                	jne    b50 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ b5d:	89 c3                	mov    %eax,%ebx
+ b5f:	83 fa 40             	cmp    $0x40,%edx
+ b62:	77 4c                	ja     bb0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ b64:	be 02 00 00 00       	mov    $0x2,%esi
+ b69:	83 fa 02             	cmp    $0x2,%edx
+ b6c:	76 10                	jbe    b7e <malloc+0x4e>
+ b6e:	66 90                	xchg   %ax,%ax
+ b70:	83 c3 01             	add    $0x1,%ebx
+ b73:	8b 34 9d 40 0e 00 00 	mov    0xe40(,%ebx,4),%esi
+ b7a:	39 d6                	cmp    %edx,%esi
+ b7c:	72 f2                	jb     b70 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ b7e:	8b 14 9d a0 16 00 00 	mov    0x16a0(,%ebx,4),%edx
+ b85:	85 d2                	test   %edx,%edx
+ b87:	74 47                	je     bd0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ b89:	8b 3a                	mov    (%edx),%edi
+ b8b:	89 3c 9d a0 16 00 00 	mov    %edi,0x16a0(,%ebx,4)
+ b92:	31 c0                	xor    %eax,%eax
+ b94:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ b9b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ b9e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ ba1:	5b                   	pop    %ebx
+ ba2:	5e                   	pop    %esi
+ ba3:	5f                   	pop    %edi
+ ba4:	5d                   	pop    %ebp
+ ba5:	c3                   	ret
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ bb0:	89 d0                	mov    %edx,%eax
+ bb2:	e8 19 fe ff ff       	call   9d0 <bigalloc>
+ bb7:	89 c2                	mov    %eax,%edx
+ bb9:	89 d8                	mov    %ebx,%eax
+ bbb:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+  return p ? (void*)(p + 1) : 0;
+ bc2:	85 d2                	test   %edx,%edx
+ bc4:	75 d5                	jne    b9b <malloc+0x6b>
+ bc6:	31 c0                	xor    %eax,%eax
+}
+ bc8:	83 c4 1c             	add    $0x1c,%esp
+ bcb:	5b                   	pop    %ebx
+ bcc:	5e                   	pop    %esi
+ bcd:	5f                   	pop    %edi
+ bce:	5d                   	pop    %ebp
+ bcf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ bd0:	b8 00 02 00 00       	mov    $0x200,%eax
+ bd5:	e8 f6 fd ff ff       	call   9d0 <bigalloc>
+ bda:	85 c0                	test   %eax,%eax
+ bdc:	74 44                	je     c22 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ bde:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ be5:	8b 14 9d a0 16 00 00 	mov    0x16a0(,%ebx,4),%edx
+ bec:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ bef:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ bf2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ bf8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ bfb:	39 cf                	cmp    %ecx,%edi
+ bfd:	72 8a                	jb     b89 <malloc+0x59>
+ bff:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ c02:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ c05:	8d 76 00             	lea    0x0(%esi),%esi
+ c08:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ c0a:	89 70 04             	mov    %esi,0x4(%eax)
+ c0d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c0f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ c11:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c13:	01 d8                	add    %ebx,%eax
+ c15:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ c18:	73 ee                	jae    c08 <malloc+0xd8>
+ c1a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ c1d:	e9 69 ff ff ff       	jmp    b8b <malloc+0x5b>
+ c22:	f0 87 05 80 16 00 00 	lock xchg %eax,0x1680
+  return p ? (void*)(p + 1) : 0;
+ c29:	31 c0                	xor    %eax,%eax
+ c2b:	eb 9b                	jmp    bc8 <malloc+0x98>
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c30 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	56                   	push   %esi
+ c34:	53                   	push   %ebx
+ c35:	8b 45 08             	mov    0x8(%ebp),%eax
+ c38:	f7 65 0c             	mull   0xc(%ebp)
+ c3b:	70 33                	jo     c70 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ c3d:	83 ec 0c             	sub    $0xc,%esp
+ c40:	89 c3                	mov    %eax,%ebx
+ c42:	50                   	push   %eax
+ c43:	e8 e8 fe ff ff       	call   b30 <malloc>
+ c48:	83 c4 10             	add    $0x10,%esp
+ c4b:	89 c6                	mov    %eax,%esi
+ c4d:	85 c0                	test   %eax,%eax
+ c4f:	74 1f                	je     c70 <calloc+0x40>
+    memset(p, 0, n);
+ c51:	83 ec 04             	sub    $0x4,%esp
+ c54:	53                   	push   %ebx
+ c55:	6a 00                	push   $0x0
+ c57:	50                   	push   %eax
+ c58:	e8 23 f7 ff ff       	call   380 <memset>
+ c5d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c63:	89 f0                	mov    %esi,%eax
+ c65:	5b                   	pop    %ebx
+ c66:	5e                   	pop    %esi
+ c67:	5d                   	pop    %ebp
+ c68:	c3                   	ret
+ c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c73:	31 f6                	xor    %esi,%esi
+}
+ c75:	89 f0                	mov    %esi,%eax
+ c77:	5b                   	pop    %ebx
+ c78:	5e                   	pop    %esi
+ c79:	5d                   	pop    %ebp
+ c7a:	c3                   	ret
+ c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+
+00000c80 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	57                   	push   %edi
+ c84:	56                   	push   %esi
+ c85:	53                   	push   %ebx
+ c86:	83 ec 0c             	sub    $0xc,%esp
+ c89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c8f:	85 db                	test   %ebx,%ebx
+ c91:	74 55                	je     ce8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ c93:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ c96:	89 de                	mov    %ebx,%esi
+ c98:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ c9f:	39 c7                	cmp    %eax,%edi
+ ca1:	72 0d                	jb     cb0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ca6:	89 f0                	mov    %esi,%eax
+ ca8:	5b                   	pop    %ebx
+ ca9:	5e                   	pop    %esi
+ caa:	5f                   	pop    %edi
+ cab:	5d                   	pop    %ebp
+ cac:	c3                   	ret
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ cb0:	83 ec 0c             	sub    $0xc,%esp
+ cb3:	50                   	push   %eax
+ cb4:	e8 77 fe ff ff       	call   b30 <malloc>
+ cb9:	83 c4 10             	add    $0x10,%esp
+ cbc:	89 c6                	mov    %eax,%esi
+ cbe:	85 c0                	test   %eax,%eax
+ cc0:	74 e1                	je     ca3 <realloc+0x23>
+  memmove(p, ap, have);
+ cc2:	83 ec 04             	sub    $0x4,%esp
+ cc5:	57                   	push   %edi
+ cc6:	53                   	push   %ebx
+ cc7:	50                   	push   %eax
+ cc8:	e8 03 f8 ff ff       	call   4d0 <memmove>
+  free(ap);
+ ccd:	89 1c 24             	mov    %ebx,(%esp)
+ cd0:	e8 db fd ff ff       	call   ab0 <free>
+  return p;
+ cd5:	83 c4 10             	add    $0x10,%esp
+}
+ cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cdb:	89 f0                	mov    %esi,%eax
+ cdd:	5b                   	pop    %ebx
+ cde:	5e                   	pop    %esi
+ cdf:	5f                   	pop    %edi
+ ce0:	5d                   	pop    %ebp
+ ce1:	c3                   	ret
+ ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ce8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cee:	5b                   	pop    %ebx
+ cef:	5e                   	pop    %esi
+ cf0:	5f                   	pop    %edi
+ cf1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ cf2:	e9 39 fe ff ff       	jmp    b30 <malloc>
@@ -0,0 +1,78 @@
+// List the most contended kernel locks.
+// usage: lockstat [-n count] [command args...]
+// With a command, reset the statistics, run the command, and
+// report only what happened while it ran. Otherwise report the
+// totals since boot (or since the last reset).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define MAXCLASS 32
+
+struct lockstat st[MAXCLASS];
+
+void
+usage(void)
+{
+  printf(2, "usage: lockstat [-n count] [command args...]\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, top, pid;
+  struct lockstat t;
+
+  top = 10;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-n") == 0){
+    if(i+1 >= argc)
+      usage();
+    top = atoi(argv[i+1]);
+    i += 2;
+  }
+
+  if(i < argc){
+    if(getlockstat(st, MAXCLASS, 1) < 0){
+      printf(2, "lockstat: getlockstat failed\n");
+      exit();
+    }
+    pid = fork();
+    if(pid < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[i], argv+i);
+      printf(2, "lockstat: exec %s failed\n", argv[i]);
+      exit();
+    }
+    wait();
+  }
+
+  if((n = getlockstat(st, MAXCLASS, 0)) < 0){
+    printf(2, "lockstat: getlockstat failed\n");
+    exit();
+  }
+
+  // Sort by cycles spent spinning, most first.
+  for(i = 1; i < n; i++){
+    t = st[i];
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+      st[j] = st[j-1];
+    st[j] = t;
+  }
+
+  printf(1, "lock\t\tacquire\tcontend\tspin(Kc)\thold(Kc)\tmaxhold(c)\n");
+  for(i = 0; i < n && i < top; i++){
+    printf(1, "%s\t", st[i].name);
+    if(strlen(st[i].name) < 8)
+      printf(1, "\t");
+    printf(1, "%d\t%d\t%d\t\t%d\t\t%d\n", st[i].nacquire, st[i].ncontend,
+           st[i].spin, st[i].hold, st[i].maxhold);
+  }
+  exit();
+}
@@ -0,0 +1,13 @@
+// Lock statistics returned by getlockstat(), one per lock class.
+// Both the kernel and user programs use this header file.
+
+#define LOCKNAME 16  // longest lock class name kept
+
+struct lockstat {
+  char name[LOCKNAME];
+  uint nacquire;  // Acquisitions
+  uint ncontend;  // Acquisitions that had to spin
+  uint spin;      // Cycles spent spinning, in units of 1024
+  uint hold;      // Cycles held, in units of 1024
+  uint maxhold;   // Longest hold, in cycles
+};
@@ -5,6 +5,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "logstat.h"
+#include "trace.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -20,6 +22,10 @@
 // But if it thinks the log is close to running out, it
 // sleeps until the last outstanding end_op() commits.
 //
+// begin_op() reserves MAXOPBLOCKS blocks of log space. An
+// operation that knows it needs a different amount, such as
+// a large file write, uses begin_opn(n)/end_opn(n) instead.
+//
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
 //   header block, containing block #s for block A, B, C, ...
@@ -28,6 +34,14 @@
 //   block C
 //   ...
 // Log appends are synchronous.
+//
+// commit() only makes a transaction durable: it appends the
+// blocks to the log and rewrites the header. Installing them at
+// their home locations is left to the writeback kernel thread,
+// which writes every committed block in block number order and
+// only then empties the log. Until then, later transactions are
+// appended after the committed ones, and the committed blocks
+// stay pinned (B_DIRTY) in the buffer cache.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -41,14 +55,21 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks reserved by those calls.
   int committing;  // in commit(), please wait.
+  int committed;   // lh.block[0..committed-1] are committed, not installed.
+  int reclaiming;  // writeback is emptying the log, don't commit.
   int dev;
   struct logheader lh;
+  struct logstat stat;
 };
 struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void writeback(void*);
+
+static struct buf wbuf;  // for writing a committed block home from the log
 
 void
 initlog(int dev)
@@ -63,9 +84,13 @@ initlog(int dev)
   log.size = sb.nlog;
   log.dev = dev;
   recover_from_log();
+  initsleeplock(&wbuf.lock, "wbuf");
+  if(kthread_create("writeback", writeback, 0) < 0)
+    panic("initlog: writeback");
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// Used only by recovery; see writeback for the usual case.
 static void
 install_trans(void)
 {
@@ -95,17 +120,17 @@ read_head(void)
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write the first n blocks of the in-memory log header to disk.
 // This is the true point at which the
 // current transaction commits.
 static void
-write_head(void)
+write_head(int n)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
+  hb->n = n;
+  for (i = 0; i < n; i++) {
     hb->block[i] = log.lh.block[i];
   }
   bwrite(buf);
@@ -118,42 +143,58 @@ recover_from_log(void)
   read_head();
   install_trans(); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
+  write_head(0); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of an FS system call that
+// will write at most n distinct blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > LOGSIZE)
+    panic("begin_opn");
+
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > LOGSIZE){
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
       release(&log.lock);
       break;
     }
   }
 }
 
-// called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// called at the start of each FS system call.
 void
-end_op(void)
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// called at the end of an FS system call that began with
+// begin_opn(n). commits if this was the last outstanding
+// operation.
+void
+end_opn(int n)
 {
   int do_commit = 0;
 
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= n;
   if(log.committing)
     panic("log.committing");
   if(log.outstanding == 0){
     do_commit = 1;
     log.committing = 1;
+    while(log.reclaiming)
+      sleep(&log, &log.lock);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -173,13 +214,20 @@ end_op(void)
   }
 }
 
-// Copy modified blocks from cache to log.
+// called at the end of each FS system call.
+void
+end_op(void)
+{
+  end_opn(MAXOPBLOCKS);
+}
+
+// Copy the blocks modified since the last commit from cache to log.
 static void
 write_log(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
+  for (tail = log.committed; tail < log.lh.n; tail++) {
     struct buf *to = bread(log.dev, log.start+tail+1); // log block
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
@@ -192,12 +240,113 @@ write_log(void)
 static void
 commit()
 {
-  if (log.lh.n > 0) {
+  if (log.lh.n > log.committed) {
+    ktrace(TE_COMMIT, log.lh.n - log.committed, 0);
     write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    write_head(log.lh.n);  // Write header to disk -- the real commit
+    acquire(&log.lock);
+    log.stat.ncommit++;
+    log.stat.nblocks += log.lh.n - log.committed;
+    log.committed = log.lh.n;
+    wakeup(&log.committed);  // writeback installs it
+    release(&log.lock);
+  }
+}
+
+// Home locations of the committed blocks being installed, in
+// block number order, and the log slot of each one's newest copy.
+static struct {
+  uint blockno;
+  int slot;
+} inst[LOGSIZE];
+
+// Write the blocks in log slots from..to-1 to their home
+// locations, in block number order.
+static void
+install(int from, int to)
+{
+  struct buf *b, *lbuf;
+  int i, j, n, relogged;
+
+  acquire(&log.lock);
+  n = 0;
+  for (i = to - 1; i >= from; i--) {
+    for (j = 0; j < n && inst[j].blockno < log.lh.block[i]; j++)
+      ;
+    if (j < n && inst[j].blockno == log.lh.block[i])
+      continue;  // a later slot holds a newer copy
+    memmove(&inst[j+1], &inst[j], (n - j) * sizeof(inst[0]));
+    inst[j].blockno = log.lh.block[i];
+    inst[j].slot = i;
+    n++;
+  }
+  log.stat.ninstall += n;
+  log.stat.nbatch++;
+  release(&log.lock);
+
+  for (i = 0; i < n; i++) {
+    // Holding b->lock keeps transactions from changing it.
+    b = bread(log.dev, inst[i].blockno);
+    acquire(&log.lock);
+    relogged = 0;
+    for (j = log.committed; j < log.lh.n; j++)
+      if (log.lh.block[j] == b->blockno)
+        relogged = 1;
+    release(&log.lock);
+    if (!relogged) {
+      bwrite(b);  // the cached copy is the committed one
+      brelse(b);
+      continue;
+    }
+    // A transaction that has not committed has changed the
+    // cached copy, so write the committed one from the log.
+    brelse(b);
+    lbuf = bread(log.dev, log.start+inst[i].slot+1);
+    acquiresleep(&wbuf.lock);
+    memmove(wbuf.data, lbuf->data, BSIZE);
+    brelse(lbuf);
+    wbuf.dev = log.dev;
+    wbuf.blockno = inst[i].blockno;
+    wbuf.flags = B_DIRTY;
+    iderw(&wbuf);
+    releasesleep(&wbuf.lock);
+  }
+}
+
+// The writeback kernel thread. Installs committed transactions,
+// taking in every commit that lands while it works, then empties
+// the log and wakes begin_op()s waiting for log space.
+static void
+writeback(void *arg)
+{
+  int done, i, n;
+
+  acquire(&log.lock);
+  for(;;){
+    while(log.committed == 0)
+      sleep(&log.committed, &log.lock);
+    for(done = 0; done < log.committed; done = n){
+      n = log.committed;
+      release(&log.lock);
+      install(done, n);
+      acquire(&log.lock);
+      while(log.committing)
+        sleep(&log, &log.lock);
+    }
+
+    // Every committed block is home; no commit can start
+    // while the on-disk log is emptied.
+    log.reclaiming = 1;
+    release(&log.lock);
+    write_head(0);
+    acquire(&log.lock);
+    n = log.committed;
+    for(i = n; i < log.lh.n; i++)
+      log.lh.block[i - n] = log.lh.block[i];
+    log.lh.n -= n;
+    log.committed = 0;
+    log.reclaiming = 0;
+    wakeup(&log);
   }
 }
 
@@ -221,14 +370,28 @@ log_write(struct buf *b)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
+  log.stat.nwrite++;
+  // Only blocks of the running transaction can absorb; the
+  // log copies of committed ones must not change.
+  for (i = log.committed; i < log.lh.n; i++) {
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
   log.lh.block[i] = b->blockno;
   if (i == log.lh.n)
     log.lh.n++;
+  else
+    log.stat.nabsorb++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
 
+
+// Copy the log statistics into *st.
+void
+logstat(struct logstat *st)
+{
+  acquire(&log.lock);
+  *st = log.stat;
+  release(&log.lock);
+}
@@ -0,0 +1,2219 @@
+
+_logcollect:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int nprod, nlines, console, nopen, k, fd[2], t;
+
+  console = 0;
+  if(argc > 1 && strcmp(argv[1], "-c") == 0){
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7f 71                	jg     8f <main+0x8f>
+  console = 0;
+  1e:	31 c0                	xor    %eax,%eax
+  20:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+  27:	bb 04 00 00 00       	mov    $0x4,%ebx
+  2c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  nlines = argc > 2 ? atoi(argv[2]) : 10;
+  if(nprod < 1 || nprod > NPROD)
+    nprod = 4;
+
+  // Nothing is ready yet: a poll() with a timeout returns 0.
+  if(pipe(fd) < 0)
+  2f:	83 ec 0c             	sub    $0xc,%esp
+  32:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  35:	56                   	push   %esi
+  36:	e8 48 07 00 00       	call   783 <pipe>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	85 c0                	test   %eax,%eax
+  40:	0f 88 cf 00 00 00    	js     115 <main+0x115>
+    fail("pipe");
+  fds[0].fd = fd[0];
+  fds[0].events = POLLIN;
+  46:	66 c7 05 e4 19 00 00 	movw   $0x1,0x19e4
+  4d:	01 00 
+  fds[0].fd = fd[0];
+  4f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  52:	a3 e0 19 00 00       	mov    %eax,0x19e0
+  t = uptime();
+  57:	e8 af 07 00 00       	call   80b <uptime>
+  5c:	89 c7                	mov    %eax,%edi
+  if(poll(fds, 1, 3) != 0 || fds[0].revents != 0)
+  5e:	50                   	push   %eax
+  5f:	6a 03                	push   $0x3
+  61:	6a 01                	push   $0x1
+  63:	68 e0 19 00 00       	push   $0x19e0
+  68:	e8 ee 08 00 00       	call   95b <poll>
+  6d:	83 c4 10             	add    $0x10,%esp
+  70:	85 c0                	test   %eax,%eax
+  72:	75 0e                	jne    82 <main+0x82>
+  74:	66 83 3d e6 19 00 00 	cmpw   $0x0,0x19e6
+  7b:	00 
+  7c:	0f 84 f6 00 00 00    	je     178 <main+0x178>
+    fail("timeout");
+  82:	83 ec 0c             	sub    $0xc,%esp
+  85:	68 d5 0f 00 00       	push   $0xfd5
+  8a:	e8 c1 02 00 00       	call   350 <fail>
+  if(argc > 1 && strcmp(argv[1], "-c") == 0){
+  8f:	50                   	push   %eax
+  90:	50                   	push   %eax
+  91:	68 d2 0f 00 00       	push   $0xfd2
+  96:	ff 77 04             	push   0x4(%edi)
+  99:	e8 c2 04 00 00       	call   560 <strcmp>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	85 c0                	test   %eax,%eax
+  a3:	75 7d                	jne    122 <main+0x122>
+    argc--;
+  a5:	8d 46 ff             	lea    -0x1(%esi),%eax
+  a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  nprod = argc > 1 ? atoi(argv[1]) : 4;
+  ab:	83 fe 02             	cmp    $0x2,%esi
+  ae:	0f 84 b3 00 00 00    	je     167 <main+0x167>
+    console = 1;
+  b4:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+    argv++;
+  bb:	83 c7 04             	add    $0x4,%edi
+  be:	89 c6                	mov    %eax,%esi
+  c0:	eb 65                	jmp    127 <main+0x127>
+  c2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  close(fd[1]);
+  fds[1].fd = 99;
+  if(poll(fds + 1, 1, 0) != 1 || fds[1].revents != POLLNVAL)
+    fail("bad fd");
+
+  for(k = 0; k < nprod; k++){
+  c5:	31 ff                	xor    %edi,%edi
+  c7:	eb 3c                	jmp    105 <main+0x105>
+    if(pipe(fd) < 0)
+      fail("pipe");
+    if(fork() == 0){
+  c9:	e8 9d 06 00 00       	call   76b <fork>
+  ce:	85 c0                	test   %eax,%eax
+  d0:	0f 84 5e 01 00 00    	je     234 <main+0x234>
+      close(fd[0]);
+      produce(k, fd[1], nlines);
+    }
+    close(fd[1]);
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	ff 75 e4             	push   -0x1c(%ebp)
+  dc:	e8 ba 06 00 00       	call   79b <close>
+    fds[k].fd = fd[0];
+  e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  for(k = 0; k < nprod; k++){
+  e4:	8d 4f 01             	lea    0x1(%edi),%ecx
+  e7:	83 c4 10             	add    $0x10,%esp
+    fds[k].events = POLLIN;
+  ea:	66 c7 04 fd e4 19 00 	movw   $0x1,0x19e4(,%edi,8)
+  f1:	00 01 00 
+    fds[k].fd = fd[0];
+  f4:	89 04 fd e0 19 00 00 	mov    %eax,0x19e0(,%edi,8)
+  for(k = 0; k < nprod; k++){
+  fb:	39 cb                	cmp    %ecx,%ebx
+  fd:	0f 84 4b 01 00 00    	je     24e <main+0x24e>
+ 103:	89 cf                	mov    %ecx,%edi
+    if(pipe(fd) < 0)
+ 105:	83 ec 0c             	sub    $0xc,%esp
+ 108:	56                   	push   %esi
+ 109:	e8 75 06 00 00       	call   783 <pipe>
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	85 c0                	test   %eax,%eax
+ 113:	79 b4                	jns    c9 <main+0xc9>
+    fail("pipe");
+ 115:	83 ec 0c             	sub    $0xc,%esp
+ 118:	68 f5 0f 00 00       	push   $0xff5
+ 11d:	e8 2e 02 00 00       	call   350 <fail>
+  console = 0;
+ 122:	31 c0                	xor    %eax,%eax
+ 124:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  nprod = argc > 1 ? atoi(argv[1]) : 4;
+ 127:	83 ec 0c             	sub    $0xc,%esp
+ 12a:	ff 77 04             	push   0x4(%edi)
+ 12d:	e8 ce 05 00 00       	call   700 <atoi>
+  nlines = argc > 2 ? atoi(argv[2]) : 10;
+ 132:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+ 139:	83 c4 10             	add    $0x10,%esp
+  nprod = argc > 1 ? atoi(argv[1]) : 4;
+ 13c:	89 c3                	mov    %eax,%ebx
+  nlines = argc > 2 ? atoi(argv[2]) : 10;
+ 13e:	83 fe 02             	cmp    $0x2,%esi
+ 141:	74 11                	je     154 <main+0x154>
+ 143:	83 ec 0c             	sub    $0xc,%esp
+ 146:	ff 77 08             	push   0x8(%edi)
+ 149:	e8 b2 05 00 00       	call   700 <atoi>
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(nprod < 1 || nprod > NPROD)
+ 154:	8d 43 ff             	lea    -0x1(%ebx),%eax
+    nprod = 4;
+ 157:	83 f8 08             	cmp    $0x8,%eax
+ 15a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 15f:	0f 43 d8             	cmovae %eax,%ebx
+ 162:	e9 c8 fe ff ff       	jmp    2f <main+0x2f>
+ 167:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+ 16e:	bb 04 00 00 00       	mov    $0x4,%ebx
+ 173:	e9 b7 fe ff ff       	jmp    2f <main+0x2f>
+ 178:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if(uptime() - t < 3)
+ 17b:	e8 8b 06 00 00       	call   80b <uptime>
+ 180:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 183:	29 f8                	sub    %edi,%eax
+ 185:	83 f8 02             	cmp    $0x2,%eax
+ 188:	7f 0d                	jg     197 <main+0x197>
+    fail("timeout length");
+ 18a:	83 ec 0c             	sub    $0xc,%esp
+ 18d:	68 dd 0f 00 00       	push   $0xfdd
+ 192:	e8 b9 01 00 00       	call   350 <fail>
+  fds[1].fd = fd[1];
+ 197:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 19a:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  fds[1].events = POLLOUT;
+ 19d:	66 c7 05 ec 19 00 00 	movw   $0x4,0x19ec
+ 1a4:	04 00 
+  fds[1].fd = fd[1];
+ 1a6:	a3 e8 19 00 00       	mov    %eax,0x19e8
+  if(poll(fds, 2, 0) != 1 || fds[1].revents != POLLOUT)
+ 1ab:	50                   	push   %eax
+ 1ac:	6a 00                	push   $0x0
+ 1ae:	6a 02                	push   $0x2
+ 1b0:	68 e0 19 00 00       	push   $0x19e0
+ 1b5:	e8 a1 07 00 00       	call   95b <poll>
+ 1ba:	83 c4 10             	add    $0x10,%esp
+ 1bd:	83 e8 01             	sub    $0x1,%eax
+ 1c0:	75 65                	jne    227 <main+0x227>
+ 1c2:	66 83 3d ee 19 00 00 	cmpw   $0x4,0x19ee
+ 1c9:	04 
+ 1ca:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1cd:	75 58                	jne    227 <main+0x227>
+  close(fd[0]);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+ 1d5:	ff 75 e0             	push   -0x20(%ebp)
+ 1d8:	e8 be 05 00 00       	call   79b <close>
+  close(fd[1]);
+ 1dd:	5f                   	pop    %edi
+ 1de:	ff 75 e4             	push   -0x1c(%ebp)
+ 1e1:	e8 b5 05 00 00       	call   79b <close>
+  if(poll(fds + 1, 1, 0) != 1 || fds[1].revents != POLLNVAL)
+ 1e6:	83 c4 0c             	add    $0xc,%esp
+  fds[1].fd = 99;
+ 1e9:	c7 05 e8 19 00 00 63 	movl   $0x63,0x19e8
+ 1f0:	00 00 00 
+  if(poll(fds + 1, 1, 0) != 1 || fds[1].revents != POLLNVAL)
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	6a 01                	push   $0x1
+ 1f7:	68 e8 19 00 00       	push   $0x19e8
+ 1fc:	e8 5a 07 00 00       	call   95b <poll>
+ 201:	83 c4 10             	add    $0x10,%esp
+ 204:	83 e8 01             	sub    $0x1,%eax
+ 207:	75 11                	jne    21a <main+0x21a>
+ 209:	66 83 3d ee 19 00 00 	cmpw   $0x20,0x19ee
+ 210:	20 
+ 211:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 214:	0f 84 a8 fe ff ff    	je     c2 <main+0xc2>
+    fail("bad fd");
+ 21a:	83 ec 0c             	sub    $0xc,%esp
+ 21d:	68 fa 0f 00 00       	push   $0xffa
+ 222:	e8 29 01 00 00       	call   350 <fail>
+    fail("writable pipe");
+ 227:	83 ec 0c             	sub    $0xc,%esp
+ 22a:	68 ec 0f 00 00       	push   $0xfec
+ 22f:	e8 1c 01 00 00       	call   350 <fail>
+      close(fd[0]);
+ 234:	83 ec 0c             	sub    $0xc,%esp
+ 237:	ff 75 e0             	push   -0x20(%ebp)
+ 23a:	e8 5c 05 00 00       	call   79b <close>
+      produce(k, fd[1], nlines);
+ 23f:	83 c4 0c             	add    $0xc,%esp
+ 242:	ff 75 d4             	push   -0x2c(%ebp)
+ 245:	ff 75 e4             	push   -0x1c(%ebp)
+ 248:	57                   	push   %edi
+ 249:	e8 22 01 00 00       	call   370 <produce>
+  }
+  fds[nprod].fd = console ? 0 : -1;
+ 24e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 251:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 254:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 257:	89 cb                	mov    %ecx,%ebx
+  fds[nprod].events = POLLIN;
+ 259:	66 c7 04 cd e4 19 00 	movw   $0x1,0x19e4(,%ecx,8)
+ 260:	00 01 00 
+  fds[nprod].fd = console ? 0 : -1;
+ 263:	83 e8 01             	sub    $0x1,%eax
+ 266:	89 55 c8             	mov    %edx,-0x38(%ebp)
+ 269:	89 04 cd e0 19 00 00 	mov    %eax,0x19e0(,%ecx,8)
+
+  // One process, no busy loop: sleep until some producer has
+  // written, and stop when they have all closed their pipes.
+  nopen = nprod;
+  while(nopen > 0){
+ 270:	8d 47 02             	lea    0x2(%edi),%eax
+ 273:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    if(poll(fds, nprod + 1, -1) < 0)
+ 276:	51                   	push   %ecx
+ 277:	6a ff                	push   $0xffffffff
+ 279:	ff 75 cc             	push   -0x34(%ebp)
+ 27c:	68 e0 19 00 00       	push   $0x19e0
+ 281:	e8 d5 06 00 00       	call   95b <poll>
+ 286:	83 c4 10             	add    $0x10,%esp
+ 289:	85 c0                	test   %eax,%eax
+ 28b:	0f 88 9c 00 00 00    	js     32d <main+0x32d>
+      fail("poll");
+    for(k = 0; k <= nprod; k++){
+ 291:	31 f6                	xor    %esi,%esi
+ 293:	eb 2a                	jmp    2bf <main+0x2bf>
+        continue;
+      if(k == nprod){
+        fds[k].fd = -1;  // ^D on the console; stop listening to it
+        continue;
+      }
+      close(fds[k].fd);
+ 295:	83 ec 0c             	sub    $0xc,%esp
+ 298:	ff 34 f5 e0 19 00 00 	push   0x19e0(,%esi,8)
+ 29f:	e8 f7 04 00 00       	call   79b <close>
+      fds[k].fd = -1;
+      nopen--;
+ 2a4:	83 6d d0 01          	subl   $0x1,-0x30(%ebp)
+ 2a8:	83 c4 10             	add    $0x10,%esp
+      fds[k].fd = -1;
+ 2ab:	c7 04 f5 e0 19 00 00 	movl   $0xffffffff,0x19e0(,%esi,8)
+ 2b2:	ff ff ff ff 
+    for(k = 0; k <= nprod; k++){
+ 2b6:	8d 46 01             	lea    0x1(%esi),%eax
+ 2b9:	39 fe                	cmp    %edi,%esi
+ 2bb:	7f 31                	jg     2ee <main+0x2ee>
+ 2bd:	89 c6                	mov    %eax,%esi
+      if(fds[k].revents & POLLNVAL)
+ 2bf:	0f b7 04 f5 e6 19 00 	movzwl 0x19e6(,%esi,8),%eax
+ 2c6:	00 
+ 2c7:	a8 20                	test   $0x20,%al
+ 2c9:	75 55                	jne    320 <main+0x320>
+      if((fds[k].revents & (POLLIN|POLLHUP)) == 0 || drain(k, nprod))
+ 2cb:	a8 11                	test   $0x11,%al
+ 2cd:	74 e7                	je     2b6 <main+0x2b6>
+ 2cf:	52                   	push   %edx
+ 2d0:	52                   	push   %edx
+ 2d1:	53                   	push   %ebx
+ 2d2:	56                   	push   %esi
+ 2d3:	e8 a8 01 00 00       	call   480 <drain>
+ 2d8:	83 c4 10             	add    $0x10,%esp
+ 2db:	85 c0                	test   %eax,%eax
+ 2dd:	75 d7                	jne    2b6 <main+0x2b6>
+      if(k == nprod){
+ 2df:	39 f3                	cmp    %esi,%ebx
+ 2e1:	75 b2                	jne    295 <main+0x295>
+        fds[k].fd = -1;  // ^D on the console; stop listening to it
+ 2e3:	c7 04 dd e0 19 00 00 	movl   $0xffffffff,0x19e0(,%ebx,8)
+ 2ea:	ff ff ff ff 
+  while(nopen > 0){
+ 2ee:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+ 2f2:	7f 82                	jg     276 <main+0x276>
+ 2f4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+ 2f7:	eb 09                	jmp    302 <main+0x302>
+    }
+  }
+  for(k = 0; k < nprod; k++){
+ 2f9:	8d 43 01             	lea    0x1(%ebx),%eax
+ 2fc:	39 fb                	cmp    %edi,%ebx
+ 2fe:	74 3a                	je     33a <main+0x33a>
+ 300:	89 c3                	mov    %eax,%ebx
+    wait();
+ 302:	e8 74 04 00 00       	call   77b <wait>
+    if(next[k] != nlines)
+ 307:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 30a:	39 04 9d 00 15 00 00 	cmp    %eax,0x1500(,%ebx,4)
+ 311:	74 e6                	je     2f9 <main+0x2f9>
+      fail("lost lines");
+ 313:	83 ec 0c             	sub    $0xc,%esp
+ 316:	68 0e 10 00 00       	push   $0x100e
+ 31b:	e8 30 00 00 00       	call   350 <fail>
+        fail("poll fd");
+ 320:	83 ec 0c             	sub    $0xc,%esp
+ 323:	68 06 10 00 00       	push   $0x1006
+ 328:	e8 23 00 00 00       	call   350 <fail>
+      fail("poll");
+ 32d:	83 ec 0c             	sub    $0xc,%esp
+ 330:	68 01 10 00 00       	push   $0x1001
+ 335:	e8 16 00 00 00       	call   350 <fail>
+  }
+  printf(1, "logcollect ok\n");
+ 33a:	50                   	push   %eax
+ 33b:	50                   	push   %eax
+ 33c:	68 19 10 00 00       	push   $0x1019
+ 341:	6a 01                	push   $0x1
+ 343:	e8 c8 06 00 00       	call   a10 <printf>
+  exit();
+ 348:	e8 26 04 00 00       	call   773 <exit>
+ 34d:	66 90                	xchg   %ax,%ax
+ 34f:	90                   	nop
+
+00000350 <fail>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "logcollect: %s failed\n", msg);
+ 356:	ff 75 08             	push   0x8(%ebp)
+ 359:	68 80 0f 00 00       	push   $0xf80
+ 35e:	6a 01                	push   $0x1
+ 360:	e8 ab 06 00 00       	call   a10 <printf>
+  exit();
+ 365:	e8 09 04 00 00       	call   773 <exit>
+ 36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <produce>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	53                   	push   %ebx
+ 376:	31 db                	xor    %ebx,%ebx
+ 378:	83 ec 0c             	sub    $0xc,%esp
+ 37b:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < nlines; i++){
+ 37e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 381:	8d 7e 01             	lea    0x1(%esi),%edi
+ 384:	85 c0                	test   %eax,%eax
+ 386:	7f 10                	jg     398 <produce+0x28>
+ 388:	eb 3e                	jmp    3c8 <produce+0x58>
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 390:	83 c3 01             	add    $0x1,%ebx
+ 393:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+ 396:	74 30                	je     3c8 <produce+0x58>
+    printf(fd, "%d %d\n", k, i);
+ 398:	53                   	push   %ebx
+ 399:	56                   	push   %esi
+ 39a:	68 97 0f 00 00       	push   $0xf97
+ 39f:	ff 75 0c             	push   0xc(%ebp)
+ 3a2:	e8 69 06 00 00       	call   a10 <printf>
+    if(i % (k + 1) == 0)
+ 3a7:	89 d8                	mov    %ebx,%eax
+ 3a9:	83 c4 10             	add    $0x10,%esp
+ 3ac:	99                   	cltd
+ 3ad:	f7 ff                	idiv   %edi
+ 3af:	85 d2                	test   %edx,%edx
+ 3b1:	75 dd                	jne    390 <produce+0x20>
+      sleep(1);
+ 3b3:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < nlines; i++){
+ 3b6:	83 c3 01             	add    $0x1,%ebx
+      sleep(1);
+ 3b9:	6a 01                	push   $0x1
+ 3bb:	e8 43 04 00 00       	call   803 <sleep>
+ 3c0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nlines; i++){
+ 3c3:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+ 3c6:	75 d0                	jne    398 <produce+0x28>
+  exit();
+ 3c8:	e8 a6 03 00 00       	call   773 <exit>
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <collect>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+ 3d5:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(k == nprod){
+ 3db:	3b 75 10             	cmp    0x10(%ebp),%esi
+ 3de:	74 60                	je     440 <collect+0x70>
+  if(atoi(s) != k)
+ 3e0:	83 ec 0c             	sub    $0xc,%esp
+ 3e3:	53                   	push   %ebx
+ 3e4:	e8 17 03 00 00       	call   700 <atoi>
+ 3e9:	83 c4 10             	add    $0x10,%esp
+ 3ec:	39 f0                	cmp    %esi,%eax
+ 3ee:	74 0b                	je     3fb <collect+0x2b>
+ 3f0:	eb 77                	jmp    469 <collect+0x99>
+ 3f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+ 3f8:	83 c3 01             	add    $0x1,%ebx
+  while(*s && *s != ' ')
+ 3fb:	f6 03 df             	testb  $0xdf,(%ebx)
+ 3fe:	75 f8                	jne    3f8 <collect+0x28>
+  i = atoi(s);
+ 400:	83 ec 0c             	sub    $0xc,%esp
+ 403:	53                   	push   %ebx
+ 404:	e8 f7 02 00 00       	call   700 <atoi>
+  if(i != next[k])
+ 409:	83 c4 10             	add    $0x10,%esp
+ 40c:	3b 04 b5 00 15 00 00 	cmp    0x1500(,%esi,4),%eax
+ 413:	75 47                	jne    45c <collect+0x8c>
+  next[k]++;
+ 415:	8d 50 01             	lea    0x1(%eax),%edx
+ 418:	89 14 b5 00 15 00 00 	mov    %edx,0x1500(,%esi,4)
+  printf(1, "[%d] line %d\n", k, i);
+ 41f:	50                   	push   %eax
+ 420:	56                   	push   %esi
+ 421:	68 c4 0f 00 00       	push   $0xfc4
+ 426:	6a 01                	push   $0x1
+ 428:	e8 e3 05 00 00       	call   a10 <printf>
+ 42d:	83 c4 10             	add    $0x10,%esp
+}
+ 430:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 433:	5b                   	pop    %ebx
+ 434:	5e                   	pop    %esi
+ 435:	5d                   	pop    %ebp
+ 436:	c3                   	ret
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    printf(1, "[console] %s\n", s);
+ 440:	89 5d 10             	mov    %ebx,0x10(%ebp)
+ 443:	c7 45 0c 9e 0f 00 00 	movl   $0xf9e,0xc(%ebp)
+ 44a:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 454:	5b                   	pop    %ebx
+ 455:	5e                   	pop    %esi
+ 456:	5d                   	pop    %ebp
+    printf(1, "[console] %s\n", s);
+ 457:	e9 b4 05 00 00       	jmp    a10 <printf>
+    fail("line order");
+ 45c:	83 ec 0c             	sub    $0xc,%esp
+ 45f:	68 b9 0f 00 00       	push   $0xfb9
+ 464:	e8 e7 fe ff ff       	call   350 <fail>
+    fail("producer tag");
+ 469:	83 ec 0c             	sub    $0xc,%esp
+ 46c:	68 ac 0f 00 00       	push   $0xfac
+ 471:	e8 da fe ff ff       	call   350 <fail>
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <drain>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+  if((n = read(fds[k].fd, buf, sizeof(buf))) <= 0)
+ 486:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+{
+ 489:	83 ec 60             	sub    $0x60,%esp
+ 48c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((n = read(fds[k].fd, buf, sizeof(buf))) <= 0)
+ 48f:	6a 40                	push   $0x40
+ 491:	53                   	push   %ebx
+ 492:	ff 34 f5 e0 19 00 00 	push   0x19e0(,%esi,8)
+ 499:	e8 ed 02 00 00       	call   78b <read>
+ 49e:	83 c4 10             	add    $0x10,%esp
+ 4a1:	31 d2                	xor    %edx,%edx
+ 4a3:	85 c0                	test   %eax,%eax
+ 4a5:	7e 72                	jle    519 <drain+0x99>
+      collect(k, line[k], nprod);
+ 4a7:	89 f7                	mov    %esi,%edi
+ 4a9:	01 d8                	add    %ebx,%eax
+ 4ab:	c1 e7 07             	shl    $0x7,%edi
+ 4ae:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+ 4b1:	81 c7 60 15 00 00    	add    $0x1560,%edi
+ 4b7:	eb 1e                	jmp    4d7 <drain+0x57>
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      line[k][len[k]++] = buf[i];
+ 4c0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4c3:	88 14 07             	mov    %dl,(%edi,%eax,1)
+  for(i = 0; i < n; i++){
+ 4c6:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 4c9:	83 c3 01             	add    $0x1,%ebx
+      line[k][len[k]++] = buf[i];
+ 4cc:	89 0c b5 20 15 00 00 	mov    %ecx,0x1520(,%esi,4)
+  for(i = 0; i < n; i++){
+ 4d3:	39 c3                	cmp    %eax,%ebx
+ 4d5:	74 3d                	je     514 <drain+0x94>
+    if(buf[i] == '\n' || len[k] == sizeof(line[k]) - 1){
+ 4d7:	0f b6 13             	movzbl (%ebx),%edx
+ 4da:	8b 04 b5 20 15 00 00 	mov    0x1520(,%esi,4),%eax
+ 4e1:	80 fa 0a             	cmp    $0xa,%dl
+ 4e4:	74 05                	je     4eb <drain+0x6b>
+ 4e6:	83 f8 7f             	cmp    $0x7f,%eax
+ 4e9:	75 d5                	jne    4c0 <drain+0x40>
+      collect(k, line[k], nprod);
+ 4eb:	83 ec 04             	sub    $0x4,%esp
+      line[k][len[k]] = 0;
+ 4ee:	c6 04 07 00          	movb   $0x0,(%edi,%eax,1)
+  for(i = 0; i < n; i++){
+ 4f2:	83 c3 01             	add    $0x1,%ebx
+      collect(k, line[k], nprod);
+ 4f5:	ff 75 0c             	push   0xc(%ebp)
+ 4f8:	57                   	push   %edi
+ 4f9:	56                   	push   %esi
+ 4fa:	e8 d1 fe ff ff       	call   3d0 <collect>
+  for(i = 0; i < n; i++){
+ 4ff:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+      len[k] = 0;
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	c7 04 b5 20 15 00 00 	movl   $0x0,0x1520(,%esi,4)
+ 50c:	00 00 00 00 
+  for(i = 0; i < n; i++){
+ 510:	39 c3                	cmp    %eax,%ebx
+ 512:	75 c3                	jne    4d7 <drain+0x57>
+  return 1;
+ 514:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+ 519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51c:	89 d0                	mov    %edx,%eax
+ 51e:	5b                   	pop    %ebx
+ 51f:	5e                   	pop    %esi
+ 520:	5f                   	pop    %edi
+ 521:	5d                   	pop    %ebp
+ 522:	c3                   	ret
+ 523:	66 90                	xchg   %ax,%ax
+ 525:	66 90                	xchg   %ax,%ax
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 530:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 531:	31 c0                	xor    %eax,%eax
+{
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	53                   	push   %ebx
+ 536:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 539:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 540:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 544:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 547:	83 c0 01             	add    $0x1,%eax
+ 54a:	84 d2                	test   %dl,%dl
+ 54c:	75 f2                	jne    540 <strcpy+0x10>
+    ;
+  return os;
+}
+ 54e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 551:	89 c8                	mov    %ecx,%eax
+ 553:	c9                   	leave
+ 554:	c3                   	ret
+ 555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	53                   	push   %ebx
+ 564:	8b 55 08             	mov    0x8(%ebp),%edx
+ 567:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 56a:	0f b6 02             	movzbl (%edx),%eax
+ 56d:	84 c0                	test   %al,%al
+ 56f:	75 17                	jne    588 <strcmp+0x28>
+ 571:	eb 3a                	jmp    5ad <strcmp+0x4d>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 57c:	83 c2 01             	add    $0x1,%edx
+ 57f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 582:	84 c0                	test   %al,%al
+ 584:	74 1a                	je     5a0 <strcmp+0x40>
+    p++, q++;
+ 586:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 588:	0f b6 19             	movzbl (%ecx),%ebx
+ 58b:	38 c3                	cmp    %al,%bl
+ 58d:	74 e9                	je     578 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 58f:	29 d8                	sub    %ebx,%eax
+}
+ 591:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 594:	c9                   	leave
+ 595:	c3                   	ret
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5a4:	31 c0                	xor    %eax,%eax
+ 5a6:	29 d8                	sub    %ebx,%eax
+}
+ 5a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5ab:	c9                   	leave
+ 5ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 5b0:	31 c0                	xor    %eax,%eax
+ 5b2:	eb db                	jmp    58f <strcmp+0x2f>
+ 5b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+
+000005c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5c9:	74 15                	je     5e0 <strlen+0x20>
+ 5cb:	31 c0                	xor    %eax,%eax
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5d0:	83 c0 01             	add    $0x1,%eax
+ 5d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5d7:	89 c1                	mov    %eax,%ecx
+ 5d9:	75 f5                	jne    5d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5db:	89 c8                	mov    %ecx,%eax
+ 5dd:	5d                   	pop    %ebp
+ 5de:	c3                   	ret
+ 5df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5e0:	31 c9                	xor    %ecx,%ecx
+}
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	89 c8                	mov    %ecx,%eax
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5fd:	89 d7                	mov    %edx,%edi
+ 5ff:	fc                   	cld
+ 600:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 602:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 605:	89 d0                	mov    %edx,%eax
+ 607:	c9                   	leave
+ 608:	c3                   	ret
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	8b 45 08             	mov    0x8(%ebp),%eax
+ 616:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 61a:	0f b6 10             	movzbl (%eax),%edx
+ 61d:	84 d2                	test   %dl,%dl
+ 61f:	75 12                	jne    633 <strchr+0x23>
+ 621:	eb 1d                	jmp    640 <strchr+0x30>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 62c:	83 c0 01             	add    $0x1,%eax
+ 62f:	84 d2                	test   %dl,%dl
+ 631:	74 0d                	je     640 <strchr+0x30>
+    if(*s == c)
+ 633:	38 d1                	cmp    %dl,%cl
+ 635:	75 f1                	jne    628 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 637:	5d                   	pop    %ebp
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 640:	31 c0                	xor    %eax,%eax
+}
+ 642:	5d                   	pop    %ebp
+ 643:	c3                   	ret
+ 644:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+
+00000650 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 655:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 658:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 659:	31 db                	xor    %ebx,%ebx
+{
+ 65b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 65e:	eb 27                	jmp    687 <gets+0x37>
+    cc = read(0, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	6a 01                	push   $0x1
+ 665:	56                   	push   %esi
+ 666:	6a 00                	push   $0x0
+ 668:	e8 1e 01 00 00       	call   78b <read>
+    if(cc < 1)
+ 66d:	83 c4 10             	add    $0x10,%esp
+ 670:	85 c0                	test   %eax,%eax
+ 672:	7e 1d                	jle    691 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 674:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 678:	8b 55 08             	mov    0x8(%ebp),%edx
+ 67b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 67f:	3c 0a                	cmp    $0xa,%al
+ 681:	74 10                	je     693 <gets+0x43>
+ 683:	3c 0d                	cmp    $0xd,%al
+ 685:	74 0c                	je     693 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 687:	89 df                	mov    %ebx,%edi
+ 689:	83 c3 01             	add    $0x1,%ebx
+ 68c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 68f:	7c cf                	jl     660 <gets+0x10>
+ 691:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 693:	8b 45 08             	mov    0x8(%ebp),%eax
+ 696:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 69a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69d:	5b                   	pop    %ebx
+ 69e:	5e                   	pop    %esi
+ 69f:	5f                   	pop    %edi
+ 6a0:	5d                   	pop    %ebp
+ 6a1:	c3                   	ret
+ 6a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	56                   	push   %esi
+ 6b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6b5:	83 ec 08             	sub    $0x8,%esp
+ 6b8:	6a 00                	push   $0x0
+ 6ba:	ff 75 08             	push   0x8(%ebp)
+ 6bd:	e8 f1 00 00 00       	call   7b3 <open>
+  if(fd < 0)
+ 6c2:	83 c4 10             	add    $0x10,%esp
+ 6c5:	85 c0                	test   %eax,%eax
+ 6c7:	78 27                	js     6f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6c9:	83 ec 08             	sub    $0x8,%esp
+ 6cc:	ff 75 0c             	push   0xc(%ebp)
+ 6cf:	89 c3                	mov    %eax,%ebx
+ 6d1:	50                   	push   %eax
+ 6d2:	e8 f4 00 00 00       	call   7cb <fstat>
+  close(fd);
+ 6d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6dc:	e8 ba 00 00 00       	call   79b <close>
+  return r;
+ 6e1:	83 c4 10             	add    $0x10,%esp
+}
+ 6e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6e7:	89 f0                	mov    %esi,%eax
+ 6e9:	5b                   	pop    %ebx
+ 6ea:	5e                   	pop    %esi
+ 6eb:	5d                   	pop    %ebp
+ 6ec:	c3                   	ret
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 6f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6f5:	eb ed                	jmp    6e4 <stat+0x34>
+ 6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fe:	66 90                	xchg   %ax,%ax
+
+00000700 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	53                   	push   %ebx
+ 704:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 707:	0f be 02             	movsbl (%edx),%eax
+ 70a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 70d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 715:	77 1e                	ja     735 <atoi+0x35>
+ 717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 720:	83 c2 01             	add    $0x1,%edx
+ 723:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 726:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 72a:	0f be 02             	movsbl (%edx),%eax
+ 72d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 730:	80 fb 09             	cmp    $0x9,%bl
+ 733:	76 eb                	jbe    720 <atoi+0x20>
+  return n;
+}
+ 735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 738:	89 c8                	mov    %ecx,%eax
+ 73a:	c9                   	leave
+ 73b:	c3                   	ret
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	8b 45 10             	mov    0x10(%ebp),%eax
+ 748:	8b 55 08             	mov    0x8(%ebp),%edx
+ 74b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 74e:	85 c0                	test   %eax,%eax
+ 750:	7e 13                	jle    765 <memmove+0x25>
+ 752:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 754:	89 d7                	mov    %edx,%edi
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 760:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 761:	39 f8                	cmp    %edi,%eax
+ 763:	75 fb                	jne    760 <memmove+0x20>
+  return vdst;
+}
+ 765:	5e                   	pop    %esi
+ 766:	89 d0                	mov    %edx,%eax
+ 768:	5f                   	pop    %edi
+ 769:	5d                   	pop    %ebp
+ 76a:	c3                   	ret
+
+0000076b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 76b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <exit>:
+SYSCALL(exit)
+ 773:	b8 02 00 00 00       	mov    $0x2,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <wait>:
+SYSCALL(wait)
+ 77b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <pipe>:
+SYSCALL(pipe)
+ 783:	b8 04 00 00 00       	mov    $0x4,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <read>:
+SYSCALL(read)
+ 78b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <write>:
+SYSCALL(write)
+ 793:	b8 10 00 00 00       	mov    $0x10,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <close>:
+SYSCALL(close)
+ 79b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <kill>:
+SYSCALL(kill)
+ 7a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <exec>:
+SYSCALL(exec)
+ 7ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <open>:
+SYSCALL(open)
+ 7b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <mknod>:
+SYSCALL(mknod)
+ 7bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <unlink>:
+SYSCALL(unlink)
+ 7c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <fstat>:
+SYSCALL(fstat)
+ 7cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <link>:
+SYSCALL(link)
+ 7d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <mkdir>:
+SYSCALL(mkdir)
+ 7db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <chdir>:
+SYSCALL(chdir)
+ 7e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <dup>:
+SYSCALL(dup)
+ 7eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <getpid>:
+SYSCALL(getpid)
+ 7f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <sbrk>:
+SYSCALL(sbrk)
+ 7fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <sleep>:
+SYSCALL(sleep)
+ 803:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <uptime>:
+SYSCALL(uptime)
+ 80b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 813:	b8 16 00 00 00       	mov    $0x16,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 81b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 823:	b8 18 00 00 00       	mov    $0x18,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 82b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 833:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 83b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 843:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <setpriority>:
+SYSCALL(setpriority)
+ 84b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 853:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <getcpustats>:
+SYSCALL(getcpustats)
+ 85b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <setscheduler>:
+SYSCALL(setscheduler)
+ 863:	b8 20 00 00 00       	mov    $0x20,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 86b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <getscheduler>:
+SYSCALL(getscheduler)
+ 873:	b8 22 00 00 00       	mov    $0x22,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <splice>:
+SYSCALL(splice)
+ 87b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <readv>:
+SYSCALL(readv)
+ 883:	b8 24 00 00 00       	mov    $0x24,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <writev>:
+SYSCALL(writev)
+ 88b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <pread>:
+SYSCALL(pread)
+ 893:	b8 26 00 00 00       	mov    $0x26,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <pwrite>:
+SYSCALL(pwrite)
+ 89b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <getlogstat>:
+SYSCALL(getlogstat)
+ 8a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <mount>:
+SYSCALL(mount)
+ 8ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <umount>:
+SYSCALL(umount)
+ 8b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <mmap>:
+SYSCALL(mmap)
+ 8bb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <munmap>:
+SYSCALL(munmap)
+ 8c3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+000008cb <membench>:
+SYSCALL(membench)
+ 8cb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <getlockstat>:
+SYSCALL(getlockstat)
+ 8d3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <lockbench>:
+SYSCALL(lockbench)
+ 8db:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+000008e3 <prof>:
+SYSCALL(prof)
+ 8e3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+000008eb <tracectl>:
+SYSCALL(tracectl)
+ 8eb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+000008f3 <traceread>:
+SYSCALL(traceread)
+ 8f3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <getsysstat>:
+SYSCALL(getsysstat)
+ 8fb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 903:	b8 34 00 00 00       	mov    $0x34,%eax
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+0000090b <getschedwait>:
+SYSCALL(getschedwait)
+ 90b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 910:	cd 40                	int    $0x40
+ 912:	c3                   	ret
+
+00000913 <mlfqread>:
+SYSCALL(mlfqread)
+ 913:	b8 36 00 00 00       	mov    $0x36,%eax
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <dllock>:
+SYSCALL(dllock)
+ 91b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+00000923 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 923:	b8 38 00 00 00       	mov    $0x38,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 92b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <clone>:
+SYSCALL(clone)
+ 933:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <join>:
+SYSCALL(join)
+ 93b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <futex>:
+SYSCALL(futex)
+ 943:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <shmat>:
+SYSCALL(shmat)
+ 94b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <shmdt>:
+SYSCALL(shmdt)
+ 953:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <poll>:
+SYSCALL(poll)
+ 95b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+ 963:	66 90                	xchg   %ax,%ax
+ 965:	66 90                	xchg   %ax,%ax
+ 967:	66 90                	xchg   %ax,%ax
+ 969:	66 90                	xchg   %ax,%ax
+ 96b:	66 90                	xchg   %ax,%ax
+ 96d:	66 90                	xchg   %ax,%ax
+ 96f:	90                   	nop
+
+00000970 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 978:	89 d1                	mov    %edx,%ecx
+{
+ 97a:	83 ec 3c             	sub    $0x3c,%esp
+ 97d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 980:	85 d2                	test   %edx,%edx
+ 982:	0f 89 80 00 00 00    	jns    a08 <printint+0x98>
+ 988:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 98c:	74 7a                	je     a08 <printint+0x98>
+    x = -xx;
+ 98e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 990:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 995:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 998:	31 f6                	xor    %esi,%esi
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9a0:	89 c8                	mov    %ecx,%eax
+ 9a2:	31 d2                	xor    %edx,%edx
+ 9a4:	89 f7                	mov    %esi,%edi
+ 9a6:	f7 f3                	div    %ebx
+ 9a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9ab:	0f b6 92 88 10 00 00 	movzbl 0x1088(%edx),%edx
+ 9b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9b6:	89 ca                	mov    %ecx,%edx
+ 9b8:	89 c1                	mov    %eax,%ecx
+ 9ba:	39 da                	cmp    %ebx,%edx
+ 9bc:	73 e2                	jae    9a0 <printint+0x30>
+  if(neg)
+ 9be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9c1:	85 c0                	test   %eax,%eax
+ 9c3:	74 07                	je     9cc <printint+0x5c>
+    buf[i++] = '-';
+ 9c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9ca:	89 f7                	mov    %esi,%edi
+ 9cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9d2:	01 df                	add    %ebx,%edi
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9db:	83 ec 04             	sub    $0x4,%esp
+ 9de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9e4:	6a 01                	push   $0x1
+ 9e6:	50                   	push   %eax
+ 9e7:	56                   	push   %esi
+ 9e8:	e8 a6 fd ff ff       	call   793 <write>
+  while(--i >= 0)
+ 9ed:	89 f8                	mov    %edi,%eax
+ 9ef:	83 c4 10             	add    $0x10,%esp
+ 9f2:	83 ef 01             	sub    $0x1,%edi
+ 9f5:	39 d8                	cmp    %ebx,%eax
+ 9f7:	75 df                	jne    9d8 <printint+0x68>
+}
+ 9f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9fc:	5b                   	pop    %ebx
+ 9fd:	5e                   	pop    %esi
+ 9fe:	5f                   	pop    %edi
+ 9ff:	5d                   	pop    %ebp
+ a00:	c3                   	ret
+ a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a08:	31 c0                	xor    %eax,%eax
+ a0a:	eb 89                	jmp    995 <printint+0x25>
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a19:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a1f:	0f b6 1e             	movzbl (%esi),%ebx
+ a22:	83 c6 01             	add    $0x1,%esi
+ a25:	84 db                	test   %bl,%bl
+ a27:	74 67                	je     a90 <printf+0x80>
+ a29:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a2c:	31 d2                	xor    %edx,%edx
+ a2e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a31:	eb 34                	jmp    a67 <printf+0x57>
+ a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a37:	90                   	nop
+ a38:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a3b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a40:	83 f8 25             	cmp    $0x25,%eax
+ a43:	74 18                	je     a5d <printf+0x4d>
+  write(fd, &c, 1);
+ a45:	83 ec 04             	sub    $0x4,%esp
+ a48:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a4b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a4e:	6a 01                	push   $0x1
+ a50:	50                   	push   %eax
+ a51:	57                   	push   %edi
+ a52:	e8 3c fd ff ff       	call   793 <write>
+ a57:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a5a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a5d:	0f b6 1e             	movzbl (%esi),%ebx
+ a60:	83 c6 01             	add    $0x1,%esi
+ a63:	84 db                	test   %bl,%bl
+ a65:	74 29                	je     a90 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a67:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a6a:	85 d2                	test   %edx,%edx
+ a6c:	74 ca                	je     a38 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a6e:	83 fa 25             	cmp    $0x25,%edx
+ a71:	75 ea                	jne    a5d <printf+0x4d>
+      if(c == 'd'){
+ a73:	83 f8 25             	cmp    $0x25,%eax
+ a76:	0f 84 24 01 00 00    	je     ba0 <printf+0x190>
+ a7c:	83 e8 63             	sub    $0x63,%eax
+ a7f:	83 f8 15             	cmp    $0x15,%eax
+ a82:	77 1c                	ja     aa0 <printf+0x90>
+ a84:	ff 24 85 30 10 00 00 	jmp    *0x1030(,%eax,4)
+ a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a93:	5b                   	pop    %ebx
+ a94:	5e                   	pop    %esi
+ a95:	5f                   	pop    %edi
+ a96:	5d                   	pop    %ebp
+ a97:	c3                   	ret
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ aa6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aaa:	6a 01                	push   $0x1
+ aac:	52                   	push   %edx
+ aad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ab0:	57                   	push   %edi
+ ab1:	e8 dd fc ff ff       	call   793 <write>
+ ab6:	83 c4 0c             	add    $0xc,%esp
+ ab9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ abc:	6a 01                	push   $0x1
+ abe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ac1:	52                   	push   %edx
+ ac2:	57                   	push   %edi
+ ac3:	e8 cb fc ff ff       	call   793 <write>
+        putc(fd, c);
+ ac8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ acb:	31 d2                	xor    %edx,%edx
+ acd:	eb 8e                	jmp    a5d <printf+0x4d>
+ acf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ adb:	8b 13                	mov    (%ebx),%edx
+ add:	6a 00                	push   $0x0
+ adf:	89 f8                	mov    %edi,%eax
+        ap++;
+ ae1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ae4:	e8 87 fe ff ff       	call   970 <printint>
+        ap++;
+ ae9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aef:	31 d2                	xor    %edx,%edx
+ af1:	e9 67 ff ff ff       	jmp    a5d <printf+0x4d>
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b05:	83 c0 04             	add    $0x4,%eax
+ b08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b0b:	85 db                	test   %ebx,%ebx
+ b0d:	0f 84 9d 00 00 00    	je     bb0 <printf+0x1a0>
+        while(*s != 0){
+ b13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b18:	84 c0                	test   %al,%al
+ b1a:	0f 84 3d ff ff ff    	je     a5d <printf+0x4d>
+ b20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b26:	89 de                	mov    %ebx,%esi
+ b28:	89 d3                	mov    %edx,%ebx
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b39:	6a 01                	push   $0x1
+ b3b:	53                   	push   %ebx
+ b3c:	57                   	push   %edi
+ b3d:	e8 51 fc ff ff       	call   793 <write>
+        while(*s != 0){
+ b42:	0f b6 06             	movzbl (%esi),%eax
+ b45:	83 c4 10             	add    $0x10,%esp
+ b48:	84 c0                	test   %al,%al
+ b4a:	75 e4                	jne    b30 <printf+0x120>
+      state = 0;
+ b4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b4f:	31 d2                	xor    %edx,%edx
+ b51:	e9 07 ff ff ff       	jmp    a5d <printf+0x4d>
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b6b:	8b 13                	mov    (%ebx),%edx
+ b6d:	6a 01                	push   $0x1
+ b6f:	e9 6b ff ff ff       	jmp    adf <printf+0xcf>
+ b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b7b:	83 ec 04             	sub    $0x4,%esp
+ b7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b89:	6a 01                	push   $0x1
+ b8b:	52                   	push   %edx
+ b8c:	57                   	push   %edi
+ b8d:	e8 01 fc ff ff       	call   793 <write>
+        ap++;
+ b92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b98:	31 d2                	xor    %edx,%edx
+ b9a:	e9 be fe ff ff       	jmp    a5d <printf+0x4d>
+ b9f:	90                   	nop
+  write(fd, &c, 1);
+ ba0:	83 ec 04             	sub    $0x4,%esp
+ ba3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ba6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ba9:	6a 01                	push   $0x1
+ bab:	e9 11 ff ff ff       	jmp    ac1 <printf+0xb1>
+ bb0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bb5:	bb 28 10 00 00       	mov    $0x1028,%ebx
+ bba:	e9 61 ff ff ff       	jmp    b20 <printf+0x110>
+ bbf:	90                   	nop
+
+00000bc0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc3:	a1 94 1a 00 00       	mov    0x1a94,%eax
+{
+ bc8:	89 e5                	mov    %esp,%ebp
+ bca:	56                   	push   %esi
+ bcb:	53                   	push   %ebx
+ bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bd2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd4:	39 ca                	cmp    %ecx,%edx
+ bd6:	73 30                	jae    c08 <bigfree+0x48>
+ bd8:	39 c1                	cmp    %eax,%ecx
+ bda:	72 04                	jb     be0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bdc:	39 c2                	cmp    %eax,%edx
+ bde:	72 f0                	jb     bd0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ be0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ be3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ be6:	39 f0                	cmp    %esi,%eax
+ be8:	74 26                	je     c10 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bea:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bec:	8b 42 04             	mov    0x4(%edx),%eax
+ bef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ bf2:	39 d9                	cmp    %ebx,%ecx
+ bf4:	74 30                	je     c26 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bf6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ bf8:	5b                   	pop    %ebx
+  freep = p;
+ bf9:	89 15 94 1a 00 00    	mov    %edx,0x1a94
+}
+ bff:	5e                   	pop    %esi
+ c00:	5d                   	pop    %ebp
+ c01:	c3                   	ret
+ c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c08:	39 c1                	cmp    %eax,%ecx
+ c0a:	72 d0                	jb     bdc <bigfree+0x1c>
+ c0c:	eb c2                	jmp    bd0 <bigfree+0x10>
+ c0e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ c10:	03 58 04             	add    0x4(%eax),%ebx
+ c13:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c16:	8b 02                	mov    (%edx),%eax
+ c18:	8b 00                	mov    (%eax),%eax
+ c1a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ c1c:	8b 42 04             	mov    0x4(%edx),%eax
+ c1f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ c22:	39 d9                	cmp    %ebx,%ecx
+ c24:	75 d0                	jne    bf6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ c26:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ c29:	89 15 94 1a 00 00    	mov    %edx,0x1a94
+    p->s.size += bp->s.size;
+ c2f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c32:	8b 09                	mov    (%ecx),%ecx
+ c34:	89 0a                	mov    %ecx,(%edx)
+}
+ c36:	5b                   	pop    %ebx
+ c37:	5e                   	pop    %esi
+ c38:	5d                   	pop    %ebp
+ c39:	c3                   	ret
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c40 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	57                   	push   %edi
+ c44:	89 c7                	mov    %eax,%edi
+ c46:	56                   	push   %esi
+ c47:	53                   	push   %ebx
+ c48:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ c4b:	a1 94 1a 00 00       	mov    0x1a94,%eax
+ c50:	85 c0                	test   %eax,%eax
+ c52:	0f 84 88 00 00 00    	je     ce0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c58:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ c5a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ c5d:	39 f9                	cmp    %edi,%ecx
+ c5f:	73 5f                	jae    cc0 <bigalloc+0x80>
+  if(nu < 4096)
+ c61:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c66:	39 df                	cmp    %ebx,%edi
+ c68:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c6b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c72:	eb 0d                	jmp    c81 <bigalloc+0x41>
+ c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c78:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ c7a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ c7d:	39 f9                	cmp    %edi,%ecx
+ c7f:	73 3f                	jae    cc0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ c81:	89 d0                	mov    %edx,%eax
+ c83:	39 15 94 1a 00 00    	cmp    %edx,0x1a94
+ c89:	75 ed                	jne    c78 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ c8b:	83 ec 0c             	sub    $0xc,%esp
+ c8e:	56                   	push   %esi
+ c8f:	e8 67 fb ff ff       	call   7fb <sbrk>
+  if(p == (char*)-1)
+ c94:	83 c4 10             	add    $0x10,%esp
+ c97:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c9a:	74 11                	je     cad <bigalloc+0x6d>
+  hp->s.size = nu;
+ c9c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ c9f:	e8 1c ff ff ff       	call   bc0 <bigfree>
+  return freep;
+ ca4:	a1 94 1a 00 00       	mov    0x1a94,%eax
+      if((p = morecore(nunits)) == 0)
+ ca9:	85 c0                	test   %eax,%eax
+ cab:	75 cb                	jne    c78 <bigalloc+0x38>
+        return 0;
+  }
+}
+ cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cb0:	31 d2                	xor    %edx,%edx
+}
+ cb2:	5b                   	pop    %ebx
+ cb3:	89 d0                	mov    %edx,%eax
+ cb5:	5e                   	pop    %esi
+ cb6:	5f                   	pop    %edi
+ cb7:	5d                   	pop    %ebp
+ cb8:	c3                   	ret
+ cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ cc0:	39 cf                	cmp    %ecx,%edi
+ cc2:	74 4c                	je     d10 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ cc4:	29 f9                	sub    %edi,%ecx
+ cc6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ cc9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ ccc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ ccf:	a3 94 1a 00 00       	mov    %eax,0x1a94
+}
+ cd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cd7:	89 d0                	mov    %edx,%eax
+ cd9:	5b                   	pop    %ebx
+ cda:	5e                   	pop    %esi
+ cdb:	5f                   	pop    %edi
+ cdc:	5d                   	pop    %ebp
+ cdd:	c3                   	ret
+ cde:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ ce0:	c7 05 94 1a 00 00 98 	movl   $0x1a98,0x1a94
+ ce7:	1a 00 00 
+    base.s.size = 0;
+ cea:	ba 98 1a 00 00       	mov    $0x1a98,%edx
+    base.s.ptr = freep = prevp = &base;
+ cef:	c7 05 98 1a 00 00 98 	movl   $0x1a98,0x1a98
+ cf6:	1a 00 00 
+    base.s.size = 0;
+ cf9:	c7 05 9c 1a 00 00 00 	movl   $0x0,0x1a9c
+ d00:	00 00 00 
+    if(p->s.size >= nunits){
+ d03:	e9 59 ff ff ff       	jmp    c61 <bigalloc+0x21>
+ d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d10:	8b 0a                	mov    (%edx),%ecx
+ d12:	89 08                	mov    %ecx,(%eax)
+ d14:	eb b9                	jmp    ccf <bigalloc+0x8f>
+ d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d20 <free>:
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	53                   	push   %ebx
+ d24:	83 ec 04             	sub    $0x4,%esp
+ d27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ d2a:	85 c9                	test   %ecx,%ecx
+ d2c:	74 58                	je     d86 <free+0x66>
+  bp = (Header*)ap - 1;
+ d2e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ d31:	ba 01 00 00 00       	mov    $0x1,%edx
+ d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+ d40:	89 d0                	mov    %edx,%eax
+ d42:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+  while(xchg(&locked, 1) != 0)
+ d49:	85 c0                	test   %eax,%eax
+ d4b:	75 f3                	jne    d40 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ d4d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ d50:	83 fa 40             	cmp    $0x40,%edx
+ d53:	77 3b                	ja     d90 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ d55:	83 fa 02             	cmp    $0x2,%edx
+ d58:	76 3f                	jbe    d99 <free+0x79>
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d60:	83 c0 01             	add    $0x1,%eax
+ d63:	39 14 85 a0 10 00 00 	cmp    %edx,0x10a0(,%eax,4)
+ d6a:	72 f4                	jb     d60 <free+0x40>
+    bp->s.ptr = classfree[c];
+ d6c:	8b 14 85 60 1a 00 00 	mov    0x1a60(,%eax,4),%edx
+    classfree[c] = bp;
+ d73:	89 1c 85 60 1a 00 00 	mov    %ebx,0x1a60(,%eax,4)
+    bp->s.ptr = classfree[c];
+ d7a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ d7d:	31 c0                	xor    %eax,%eax
+ d7f:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+}
+ d86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d89:	c9                   	leave
+ d8a:	c3                   	ret
+ d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+    bigfree(bp);
+ d90:	89 d8                	mov    %ebx,%eax
+ d92:	e8 29 fe ff ff       	call   bc0 <bigfree>
+ d97:	eb e4                	jmp    d7d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ d99:	31 c0                	xor    %eax,%eax
+ d9b:	eb cf                	jmp    d6c <free+0x4c>
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000da0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ da0:	55                   	push   %ebp
+ da1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ da6:	89 e5                	mov    %esp,%ebp
+ da8:	57                   	push   %edi
+ da9:	56                   	push   %esi
+ daa:	53                   	push   %ebx
+ dab:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dae:	8b 45 08             	mov    0x8(%ebp),%eax
+ db1:	8d 50 07             	lea    0x7(%eax),%edx
+ db4:	c1 ea 03             	shr    $0x3,%edx
+ db7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ dc0:	89 c8                	mov    %ecx,%eax
+ dc2:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+ dc9:	85 c0                	test   %eax,%eax
+ dcb:	75 f3                	jne    dc0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ dcd:	89 c3                	mov    %eax,%ebx
+ dcf:	83 fa 40             	cmp    $0x40,%edx
+ dd2:	77 4c                	ja     e20 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ dd4:	be 02 00 00 00       	mov    $0x2,%esi
+ dd9:	83 fa 02             	cmp    $0x2,%edx
+ ddc:	76 10                	jbe    dee <malloc+0x4e>
+ dde:	66 90                	xchg   %ax,%ax
+ de0:	83 c3 01             	add    $0x1,%ebx
+ de3:	8b 34 9d a0 10 00 00 	mov    0x10a0(,%ebx,4),%esi
+ dea:	39 d6                	cmp    %edx,%esi
+ dec:	72 f2                	jb     de0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ dee:	8b 14 9d 60 1a 00 00 	mov    0x1a60(,%ebx,4),%edx
+ df5:	85 d2                	test   %edx,%edx
+ df7:	74 47                	je     e40 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ df9:	8b 3a                	mov    (%edx),%edi
+ dfb:	89 3c 9d 60 1a 00 00 	mov    %edi,0x1a60(,%ebx,4)
+ e02:	31 c0                	xor    %eax,%eax
+ e04:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ e0b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ e0e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ e11:	5b                   	pop    %ebx
+ e12:	5e                   	pop    %esi
+ e13:	5f                   	pop    %edi
+ e14:	5d                   	pop    %ebp
+ e15:	c3                   	ret
+ e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ e20:	89 d0                	mov    %edx,%eax
+ e22:	e8 19 fe ff ff       	call   c40 <bigalloc>
+ e27:	89 c2                	mov    %eax,%edx
+ e29:	89 d8                	mov    %ebx,%eax
+ e2b:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+  return p ? (void*)(p + 1) : 0;
+ e32:	85 d2                	test   %edx,%edx
+ e34:	75 d5                	jne    e0b <malloc+0x6b>
+ e36:	31 c0                	xor    %eax,%eax
+}
+ e38:	83 c4 1c             	add    $0x1c,%esp
+ e3b:	5b                   	pop    %ebx
+ e3c:	5e                   	pop    %esi
+ e3d:	5f                   	pop    %edi
+ e3e:	5d                   	pop    %ebp
+ e3f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ e40:	b8 00 02 00 00       	mov    $0x200,%eax
+ e45:	e8 f6 fd ff ff       	call   c40 <bigalloc>
+ e4a:	85 c0                	test   %eax,%eax
+ e4c:	74 44                	je     e92 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e4e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ e55:	8b 14 9d 60 1a 00 00 	mov    0x1a60(,%ebx,4),%edx
+ e5c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ e5f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ e62:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ e68:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ e6b:	39 cf                	cmp    %ecx,%edi
+ e6d:	72 8a                	jb     df9 <malloc+0x59>
+ e6f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ e72:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ e75:	8d 76 00             	lea    0x0(%esi),%esi
+ e78:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ e7a:	89 70 04             	mov    %esi,0x4(%eax)
+ e7d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e7f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ e81:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e83:	01 d8                	add    %ebx,%eax
+ e85:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ e88:	73 ee                	jae    e78 <malloc+0xd8>
+ e8a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ e8d:	e9 69 ff ff ff       	jmp    dfb <malloc+0x5b>
+ e92:	f0 87 05 40 1a 00 00 	lock xchg %eax,0x1a40
+  return p ? (void*)(p + 1) : 0;
+ e99:	31 c0                	xor    %eax,%eax
+ e9b:	eb 9b                	jmp    e38 <malloc+0x98>
+ e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ ea0:	55                   	push   %ebp
+ ea1:	89 e5                	mov    %esp,%ebp
+ ea3:	56                   	push   %esi
+ ea4:	53                   	push   %ebx
+ ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ea8:	f7 65 0c             	mull   0xc(%ebp)
+ eab:	70 33                	jo     ee0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ ead:	83 ec 0c             	sub    $0xc,%esp
+ eb0:	89 c3                	mov    %eax,%ebx
+ eb2:	50                   	push   %eax
+ eb3:	e8 e8 fe ff ff       	call   da0 <malloc>
+ eb8:	83 c4 10             	add    $0x10,%esp
+ ebb:	89 c6                	mov    %eax,%esi
+ ebd:	85 c0                	test   %eax,%eax
+ ebf:	74 1f                	je     ee0 <calloc+0x40>
+    memset(p, 0, n);
+ ec1:	83 ec 04             	sub    $0x4,%esp
+ ec4:	53                   	push   %ebx
+ ec5:	6a 00                	push   $0x0
+ ec7:	50                   	push   %eax
+ ec8:	e8 23 f7 ff ff       	call   5f0 <memset>
+ ecd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ed0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ed3:	89 f0                	mov    %esi,%eax
+ ed5:	5b                   	pop    %ebx
+ ed6:	5e                   	pop    %esi
+ ed7:	5d                   	pop    %ebp
+ ed8:	c3                   	ret
+ ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ee0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ ee3:	31 f6                	xor    %esi,%esi
+}
+ ee5:	89 f0                	mov    %esi,%eax
+ ee7:	5b                   	pop    %ebx
+ ee8:	5e                   	pop    %esi
+ ee9:	5d                   	pop    %ebp
+ eea:	c3                   	ret
+ eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ eef:	90                   	nop
+
+00000ef0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ ef0:	55                   	push   %ebp
+ ef1:	89 e5                	mov    %esp,%ebp
+ ef3:	57                   	push   %edi
+ ef4:	56                   	push   %esi
+ ef5:	53                   	push   %ebx
+ ef6:	83 ec 0c             	sub    $0xc,%esp
+ ef9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ efc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ eff:	85 db                	test   %ebx,%ebx
+ f01:	74 55                	je     f58 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ f03:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ f06:	89 de                	mov    %ebx,%esi
+ f08:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ f0f:	39 c7                	cmp    %eax,%edi
+ f11:	72 0d                	jb     f20 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f16:	89 f0                	mov    %esi,%eax
+ f18:	5b                   	pop    %ebx
+ f19:	5e                   	pop    %esi
+ f1a:	5f                   	pop    %edi
+ f1b:	5d                   	pop    %ebp
+ f1c:	c3                   	ret
+ f1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ f20:	83 ec 0c             	sub    $0xc,%esp
+ f23:	50                   	push   %eax
+ f24:	e8 77 fe ff ff       	call   da0 <malloc>
+ f29:	83 c4 10             	add    $0x10,%esp
+ f2c:	89 c6                	mov    %eax,%esi
+ f2e:	85 c0                	test   %eax,%eax
+ f30:	74 e1                	je     f13 <realloc+0x23>
+  memmove(p, ap, have);
+ f32:	83 ec 04             	sub    $0x4,%esp
+ f35:	57                   	push   %edi
+ f36:	53                   	push   %ebx
+ f37:	50                   	push   %eax
+ f38:	e8 03 f8 ff ff       	call   740 <memmove>
+  free(ap);
+ f3d:	89 1c 24             	mov    %ebx,(%esp)
+ f40:	e8 db fd ff ff       	call   d20 <free>
+  return p;
+ f45:	83 c4 10             	add    $0x10,%esp
+}
+ f48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f4b:	89 f0                	mov    %esi,%eax
+ f4d:	5b                   	pop    %ebx
+ f4e:	5e                   	pop    %esi
+ f4f:	5f                   	pop    %edi
+ f50:	5d                   	pop    %ebp
+ f51:	c3                   	ret
+ f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ f58:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f5e:	5b                   	pop    %ebx
+ f5f:	5e                   	pop    %esi
+ f60:	5f                   	pop    %edi
+ f61:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ f62:	e9 39 fe ff ff       	jmp    da0 <malloc>
@@ -0,0 +1,162 @@
+// Log collector: gathers lines from several producer processes,
+// each writing to its own pipe, in one process with poll(), and
+// prints them tagged with the producer they came from. With -c,
+// lines typed on the console are collected too.
+// Checks that every producer's lines arrive, in order, and that
+// a poll() with nothing ready times out.
+// usage: logcollect [-c] [nproducers [nlines]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "poll.h"
+
+#define NPROD 8
+
+struct pollfd fds[NPROD+1];
+char line[NPROD+1][128];  // partial line from each source
+int len[NPROD+1];
+int next[NPROD];          // number of the next line expected
+
+void
+fail(char *msg)
+{
+  printf(1, "logcollect: %s failed\n", msg);
+  exit();
+}
+
+// Write nlines lines to fd, at a pace that differs by producer
+// so that the collector sees them interleaved.
+void
+produce(int k, int fd, int nlines)
+{
+  int i;
+
+  for(i = 0; i < nlines; i++){
+    printf(fd, "%d %d\n", k, i);
+    if(i % (k + 1) == 0)
+      sleep(1);
+  }
+  exit();
+}
+
+// Handle a complete line from source k.
+void
+collect(int k, char *s, int nprod)
+{
+  int i;
+
+  if(k == nprod){
+    printf(1, "[console] %s\n", s);
+    return;
+  }
+  if(atoi(s) != k)
+    fail("producer tag");
+  while(*s && *s != ' ')
+    s++;
+  i = atoi(s);
+  if(i != next[k])
+    fail("line order");
+  next[k]++;
+  printf(1, "[%d] line %d\n", k, i);
+}
+
+// Read what is ready on source k, collecting whole lines.
+// Returns 0 at end of file.
+int
+drain(int k, int nprod)
+{
+  char buf[64];
+  int i, n;
+
+  if((n = read(fds[k].fd, buf, sizeof(buf))) <= 0)
+    return 0;
+  for(i = 0; i < n; i++){
+    if(buf[i] == '\n' || len[k] == sizeof(line[k]) - 1){
+      line[k][len[k]] = 0;
+      collect(k, line[k], nprod);
+      len[k] = 0;
+    } else
+      line[k][len[k]++] = buf[i];
+  }
+  return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nprod, nlines, console, nopen, k, fd[2], t;
+
+  console = 0;
+  if(argc > 1 && strcmp(argv[1], "-c") == 0){
+    console = 1;
+    argc--;
+    argv++;
+  }
+  nprod = argc > 1 ? atoi(argv[1]) : 4;
+  nlines = argc > 2 ? atoi(argv[2]) : 10;
+  if(nprod < 1 || nprod > NPROD)
+    nprod = 4;
+
+  // Nothing is ready yet: a poll() with a timeout returns 0.
+  if(pipe(fd) < 0)
+    fail("pipe");
+  fds[0].fd = fd[0];
+  fds[0].events = POLLIN;
+  t = uptime();
+  if(poll(fds, 1, 3) != 0 || fds[0].revents != 0)
+    fail("timeout");
+  if(uptime() - t < 3)
+    fail("timeout length");
+  fds[1].fd = fd[1];
+  fds[1].events = POLLOUT;
+  if(poll(fds, 2, 0) != 1 || fds[1].revents != POLLOUT)
+    fail("writable pipe");
+  close(fd[0]);
+  close(fd[1]);
+  fds[1].fd = 99;
+  if(poll(fds + 1, 1, 0) != 1 || fds[1].revents != POLLNVAL)
+    fail("bad fd");
+
+  for(k = 0; k < nprod; k++){
+    if(pipe(fd) < 0)
+      fail("pipe");
+    if(fork() == 0){
+      close(fd[0]);
+      produce(k, fd[1], nlines);
+    }
+    close(fd[1]);
+    fds[k].fd = fd[0];
+    fds[k].events = POLLIN;
+  }
+  fds[nprod].fd = console ? 0 : -1;
+  fds[nprod].events = POLLIN;
+
+  // One process, no busy loop: sleep until some producer has
+  // written, and stop when they have all closed their pipes.
+  nopen = nprod;
+  while(nopen > 0){
+    if(poll(fds, nprod + 1, -1) < 0)
+      fail("poll");
+    for(k = 0; k <= nprod; k++){
+      if(fds[k].revents & POLLNVAL)
+        fail("poll fd");
+      if((fds[k].revents & (POLLIN|POLLHUP)) == 0 || drain(k, nprod))
+        continue;
+      if(k == nprod){
+        fds[k].fd = -1;  // ^D on the console; stop listening to it
+        continue;
+      }
+      close(fds[k].fd);
+      fds[k].fd = -1;
+      nopen--;
+    }
+  }
+  for(k = 0; k < nprod; k++){
+    wait();
+    if(next[k] != nlines)
+      fail("lost lines");
+  }
+  printf(1, "logcollect ok\n");
+  exit();
+}
@@ -0,0 +1,11 @@
+// Log statistics returned by getlogstat().
+// Both the kernel and user programs use this header file.
+
+struct logstat {
+  uint ncommit;  // Transactions committed
+  uint nblocks;  // Blocks written to the log by those commits
+  uint nwrite;   // Calls to log_write()
+  uint nabsorb;  // log_write() calls absorbed by a block already logged
+  uint ninstall; // Blocks written home by the writeback daemon
+  uint nbatch;   // Batches it wrote them in
+};
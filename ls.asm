@@ -0,0 +1,1975 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 41 05 00 00       	call   583 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 c8 0d 00 00       	push   $0xdc8
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 2f 05 00 00       	call   583 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 60 12 00 00       	push   $0x1260
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 60 12 00 00       	mov    $0x1260,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 60 12 00 00       	add    $0x1260,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 ac 04 00 00       	call   5c3 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 a7 04 00 00       	call   5db <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 50 04 00 00       	call   5ab <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 a8 0d 00 00       	push   $0xda8
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 7c 06 00 00       	call   820 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 89 03 00 00       	call   59b <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 a8 0d 00 00       	push   $0xda8
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 72 05 00 00       	call   820 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 80 0d 00 00       	push   $0xd80
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 50 05 00 00       	call   820 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 b5 0d 00 00       	push   $0xdb5
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 31 05 00 00       	call   820 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 94 0d 00 00       	push   $0xd94
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 10 05 00 00       	call   820 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 93 02 00 00       	call   5ab <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 94 0d 00 00       	push   $0xd94
+ 331:	6a 01                	push   $0x1
+ 333:	e8 e8 04 00 00       	call   820 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 1e 01 00 00       	call   59b <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 f1 00 00 00       	call   5c3 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 f4 00 00 00       	call   5db <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 ba 00 00 00       	call   5ab <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+
+0000057b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 57b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <exit>:
+SYSCALL(exit)
+ 583:	b8 02 00 00 00       	mov    $0x2,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <wait>:
+SYSCALL(wait)
+ 58b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <pipe>:
+SYSCALL(pipe)
+ 593:	b8 04 00 00 00       	mov    $0x4,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <read>:
+SYSCALL(read)
+ 59b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <write>:
+SYSCALL(write)
+ 5a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <close>:
+SYSCALL(close)
+ 5ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <kill>:
+SYSCALL(kill)
+ 5b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <exec>:
+SYSCALL(exec)
+ 5bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <open>:
+SYSCALL(open)
+ 5c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mknod>:
+SYSCALL(mknod)
+ 5cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <unlink>:
+SYSCALL(unlink)
+ 5d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <fstat>:
+SYSCALL(fstat)
+ 5db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <link>:
+SYSCALL(link)
+ 5e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mkdir>:
+SYSCALL(mkdir)
+ 5eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <chdir>:
+SYSCALL(chdir)
+ 5f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <dup>:
+SYSCALL(dup)
+ 5fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getpid>:
+SYSCALL(getpid)
+ 603:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <sbrk>:
+SYSCALL(sbrk)
+ 60b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <sleep>:
+SYSCALL(sleep)
+ 613:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <uptime>:
+SYSCALL(uptime)
+ 61b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 623:	b8 16 00 00 00       	mov    $0x16,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 62b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 633:	b8 18 00 00 00       	mov    $0x18,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 63b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 643:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 64b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 653:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <setpriority>:
+SYSCALL(setpriority)
+ 65b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 663:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <getcpustats>:
+SYSCALL(getcpustats)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <setscheduler>:
+SYSCALL(setscheduler)
+ 673:	b8 20 00 00 00       	mov    $0x20,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 67b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <getscheduler>:
+SYSCALL(getscheduler)
+ 683:	b8 22 00 00 00       	mov    $0x22,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <splice>:
+SYSCALL(splice)
+ 68b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <readv>:
+SYSCALL(readv)
+ 693:	b8 24 00 00 00       	mov    $0x24,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <writev>:
+SYSCALL(writev)
+ 69b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <pread>:
+SYSCALL(pread)
+ 6a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <pwrite>:
+SYSCALL(pwrite)
+ 6ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getlogstat>:
+SYSCALL(getlogstat)
+ 6b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <mount>:
+SYSCALL(mount)
+ 6bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <umount>:
+SYSCALL(umount)
+ 6c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mmap>:
+SYSCALL(mmap)
+ 6cb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <munmap>:
+SYSCALL(munmap)
+ 6d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <membench>:
+SYSCALL(membench)
+ 6db:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getlockstat>:
+SYSCALL(getlockstat)
+ 6e3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <lockbench>:
+SYSCALL(lockbench)
+ 6eb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <prof>:
+SYSCALL(prof)
+ 6f3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <tracectl>:
+SYSCALL(tracectl)
+ 6fb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <traceread>:
+SYSCALL(traceread)
+ 703:	b8 32 00 00 00       	mov    $0x32,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <getsysstat>:
+SYSCALL(getsysstat)
+ 70b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 713:	b8 34 00 00 00       	mov    $0x34,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <getschedwait>:
+SYSCALL(getschedwait)
+ 71b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <mlfqread>:
+SYSCALL(mlfqread)
+ 723:	b8 36 00 00 00       	mov    $0x36,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <dllock>:
+SYSCALL(dllock)
+ 72b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 733:	b8 38 00 00 00       	mov    $0x38,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 73b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <clone>:
+SYSCALL(clone)
+ 743:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <join>:
+SYSCALL(join)
+ 74b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <futex>:
+SYSCALL(futex)
+ 753:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <shmat>:
+SYSCALL(shmat)
+ 75b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <shmdt>:
+SYSCALL(shmdt)
+ 763:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <poll>:
+SYSCALL(poll)
+ 76b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+ 773:	66 90                	xchg   %ax,%ax
+ 775:	66 90                	xchg   %ax,%ax
+ 777:	66 90                	xchg   %ax,%ax
+ 779:	66 90                	xchg   %ax,%ax
+ 77b:	66 90                	xchg   %ax,%ax
+ 77d:	66 90                	xchg   %ax,%ax
+ 77f:	90                   	nop
+
+00000780 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 788:	89 d1                	mov    %edx,%ecx
+{
+ 78a:	83 ec 3c             	sub    $0x3c,%esp
+ 78d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 790:	85 d2                	test   %edx,%edx
+ 792:	0f 89 80 00 00 00    	jns    818 <printint+0x98>
+ 798:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79c:	74 7a                	je     818 <printint+0x98>
+    x = -xx;
+ 79e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7a8:	31 f6                	xor    %esi,%esi
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f7                	mov    %esi,%edi
+ 7b6:	f7 f3                	div    %ebx
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 2c 0e 00 00 	movzbl 0xe2c(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 da                	cmp    %ebx,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7d1:	85 c0                	test   %eax,%eax
+ 7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+ 7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7da:	89 f7                	mov    %esi,%edi
+ 7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7e2:	01 df                	add    %ebx,%edi
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7f4:	6a 01                	push   $0x1
+ 7f6:	50                   	push   %eax
+ 7f7:	56                   	push   %esi
+ 7f8:	e8 a6 fd ff ff       	call   5a3 <write>
+  while(--i >= 0)
+ 7fd:	89 f8                	mov    %edi,%eax
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	83 ef 01             	sub    $0x1,%edi
+ 805:	39 d8                	cmp    %ebx,%eax
+ 807:	75 df                	jne    7e8 <printint+0x68>
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 818:	31 c0                	xor    %eax,%eax
+ 81a:	eb 89                	jmp    7a5 <printint+0x25>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 829:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 82c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 82f:	0f b6 1e             	movzbl (%esi),%ebx
+ 832:	83 c6 01             	add    $0x1,%esi
+ 835:	84 db                	test   %bl,%bl
+ 837:	74 67                	je     8a0 <printf+0x80>
+ 839:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 83c:	31 d2                	xor    %edx,%edx
+ 83e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 841:	eb 34                	jmp    877 <printf+0x57>
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+ 848:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 84b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 850:	83 f8 25             	cmp    $0x25,%eax
+ 853:	74 18                	je     86d <printf+0x4d>
+  write(fd, &c, 1);
+ 855:	83 ec 04             	sub    $0x4,%esp
+ 858:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 85b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85e:	6a 01                	push   $0x1
+ 860:	50                   	push   %eax
+ 861:	57                   	push   %edi
+ 862:	e8 3c fd ff ff       	call   5a3 <write>
+ 867:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 86a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 86d:	0f b6 1e             	movzbl (%esi),%ebx
+ 870:	83 c6 01             	add    $0x1,%esi
+ 873:	84 db                	test   %bl,%bl
+ 875:	74 29                	je     8a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 877:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 87a:	85 d2                	test   %edx,%edx
+ 87c:	74 ca                	je     848 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 87e:	83 fa 25             	cmp    $0x25,%edx
+ 881:	75 ea                	jne    86d <printf+0x4d>
+      if(c == 'd'){
+ 883:	83 f8 25             	cmp    $0x25,%eax
+ 886:	0f 84 24 01 00 00    	je     9b0 <printf+0x190>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 1c                	ja     8b0 <printf+0x90>
+ 894:	ff 24 85 d4 0d 00 00 	jmp    *0xdd4(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ba:	6a 01                	push   $0x1
+ 8bc:	52                   	push   %edx
+ 8bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8c0:	57                   	push   %edi
+ 8c1:	e8 dd fc ff ff       	call   5a3 <write>
+ 8c6:	83 c4 0c             	add    $0xc,%esp
+ 8c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8cc:	6a 01                	push   $0x1
+ 8ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8d1:	52                   	push   %edx
+ 8d2:	57                   	push   %edi
+ 8d3:	e8 cb fc ff ff       	call   5a3 <write>
+        putc(fd, c);
+ 8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8db:	31 d2                	xor    %edx,%edx
+ 8dd:	eb 8e                	jmp    86d <printf+0x4d>
+ 8df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 00                	push   $0x0
+ 8ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8f4:	e8 87 fe ff ff       	call   780 <printint>
+        ap++;
+ 8f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 67 ff ff ff       	jmp    86d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 913:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 91b:	85 db                	test   %ebx,%ebx
+ 91d:	0f 84 9d 00 00 00    	je     9c0 <printf+0x1a0>
+        while(*s != 0){
+ 923:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 926:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 928:	84 c0                	test   %al,%al
+ 92a:	0f 84 3d ff ff ff    	je     86d <printf+0x4d>
+ 930:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 933:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 936:	89 de                	mov    %ebx,%esi
+ 938:	89 d3                	mov    %edx,%ebx
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 946:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	53                   	push   %ebx
+ 94c:	57                   	push   %edi
+ 94d:	e8 51 fc ff ff       	call   5a3 <write>
+        while(*s != 0){
+ 952:	0f b6 06             	movzbl (%esi),%eax
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	84 c0                	test   %al,%al
+ 95a:	75 e4                	jne    940 <printf+0x120>
+      state = 0;
+ 95c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 07 ff ff ff       	jmp    86d <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	e9 6b ff ff ff       	jmp    8ef <printf+0xcf>
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 988:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 991:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 993:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 996:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	52                   	push   %edx
+ 99c:	57                   	push   %edi
+ 99d:	e8 01 fc ff ff       	call   5a3 <write>
+        ap++;
+ 9a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	e9 be fe ff ff       	jmp    86d <printf+0x4d>
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	e9 11 ff ff ff       	jmp    8d1 <printf+0xb1>
+ 9c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9c5:	bb ca 0d 00 00       	mov    $0xdca,%ebx
+ 9ca:	e9 61 ff ff ff       	jmp    930 <printf+0x110>
+ 9cf:	90                   	nop
+
+000009d0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d3:	a1 d4 12 00 00       	mov    0x12d4,%eax
+{
+ 9d8:	89 e5                	mov    %esp,%ebp
+ 9da:	56                   	push   %esi
+ 9db:	53                   	push   %ebx
+ 9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e4:	39 ca                	cmp    %ecx,%edx
+ 9e6:	73 30                	jae    a18 <bigfree+0x48>
+ 9e8:	39 c1                	cmp    %eax,%ecx
+ 9ea:	72 04                	jb     9f0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ec:	39 c2                	cmp    %eax,%edx
+ 9ee:	72 f0                	jb     9e0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9f0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 9f3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 9f6:	39 f0                	cmp    %esi,%eax
+ 9f8:	74 26                	je     a20 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9fa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a02:	39 d9                	cmp    %ebx,%ecx
+ a04:	74 30                	je     a36 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a06:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a08:	5b                   	pop    %ebx
+  freep = p;
+ a09:	89 15 d4 12 00 00    	mov    %edx,0x12d4
+}
+ a0f:	5e                   	pop    %esi
+ a10:	5d                   	pop    %ebp
+ a11:	c3                   	ret
+ a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a18:	39 c1                	cmp    %eax,%ecx
+ a1a:	72 d0                	jb     9ec <bigfree+0x1c>
+ a1c:	eb c2                	jmp    9e0 <bigfree+0x10>
+ a1e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a20:	03 58 04             	add    0x4(%eax),%ebx
+ a23:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a26:	8b 02                	mov    (%edx),%eax
+ a28:	8b 00                	mov    (%eax),%eax
+ a2a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ a2c:	8b 42 04             	mov    0x4(%edx),%eax
+ a2f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a32:	39 d9                	cmp    %ebx,%ecx
+ a34:	75 d0                	jne    a06 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ a36:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ a39:	89 15 d4 12 00 00    	mov    %edx,0x12d4
+    p->s.size += bp->s.size;
+ a3f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a42:	8b 09                	mov    (%ecx),%ecx
+ a44:	89 0a                	mov    %ecx,(%edx)
+}
+ a46:	5b                   	pop    %ebx
+ a47:	5e                   	pop    %esi
+ a48:	5d                   	pop    %ebp
+ a49:	c3                   	ret
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a50 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	89 c7                	mov    %eax,%edi
+ a56:	56                   	push   %esi
+ a57:	53                   	push   %ebx
+ a58:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ a5b:	a1 d4 12 00 00       	mov    0x12d4,%eax
+ a60:	85 c0                	test   %eax,%eax
+ a62:	0f 84 88 00 00 00    	je     af0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a68:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a6a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a6d:	39 f9                	cmp    %edi,%ecx
+ a6f:	73 5f                	jae    ad0 <bigalloc+0x80>
+  if(nu < 4096)
+ a71:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a76:	39 df                	cmp    %ebx,%edi
+ a78:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a7b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a82:	eb 0d                	jmp    a91 <bigalloc+0x41>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a88:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a8a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a8d:	39 f9                	cmp    %edi,%ecx
+ a8f:	73 3f                	jae    ad0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a91:	89 d0                	mov    %edx,%eax
+ a93:	39 15 d4 12 00 00    	cmp    %edx,0x12d4
+ a99:	75 ed                	jne    a88 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a9b:	83 ec 0c             	sub    $0xc,%esp
+ a9e:	56                   	push   %esi
+ a9f:	e8 67 fb ff ff       	call   60b <sbrk>
+  if(p == (char*)-1)
+ aa4:	83 c4 10             	add    $0x10,%esp
+ aa7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aaa:	74 11                	je     abd <bigalloc+0x6d>
+  hp->s.size = nu;
+ aac:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ aaf:	e8 1c ff ff ff       	call   9d0 <bigfree>
+  return freep;
+ ab4:	a1 d4 12 00 00       	mov    0x12d4,%eax
+      if((p = morecore(nunits)) == 0)
+ ab9:	85 c0                	test   %eax,%eax
+ abb:	75 cb                	jne    a88 <bigalloc+0x38>
+        return 0;
+  }
+}
+ abd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ac0:	31 d2                	xor    %edx,%edx
+}
+ ac2:	5b                   	pop    %ebx
+ ac3:	89 d0                	mov    %edx,%eax
+ ac5:	5e                   	pop    %esi
+ ac6:	5f                   	pop    %edi
+ ac7:	5d                   	pop    %ebp
+ ac8:	c3                   	ret
+ ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ ad0:	39 cf                	cmp    %ecx,%edi
+ ad2:	74 4c                	je     b20 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ ad4:	29 f9                	sub    %edi,%ecx
+ ad6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ ad9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ adc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ adf:	a3 d4 12 00 00       	mov    %eax,0x12d4
+}
+ ae4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae7:	89 d0                	mov    %edx,%eax
+ ae9:	5b                   	pop    %ebx
+ aea:	5e                   	pop    %esi
+ aeb:	5f                   	pop    %edi
+ aec:	5d                   	pop    %ebp
+ aed:	c3                   	ret
+ aee:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ af0:	c7 05 d4 12 00 00 d8 	movl   $0x12d8,0x12d4
+ af7:	12 00 00 
+    base.s.size = 0;
+ afa:	ba d8 12 00 00       	mov    $0x12d8,%edx
+    base.s.ptr = freep = prevp = &base;
+ aff:	c7 05 d8 12 00 00 d8 	movl   $0x12d8,0x12d8
+ b06:	12 00 00 
+    base.s.size = 0;
+ b09:	c7 05 dc 12 00 00 00 	movl   $0x0,0x12dc
+ b10:	00 00 00 
+    if(p->s.size >= nunits){
+ b13:	e9 59 ff ff ff       	jmp    a71 <bigalloc+0x21>
+ b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b20:	8b 0a                	mov    (%edx),%ecx
+ b22:	89 08                	mov    %ecx,(%eax)
+ b24:	eb b9                	jmp    adf <bigalloc+0x8f>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <free>:
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	53                   	push   %ebx
+ b34:	83 ec 04             	sub    $0x4,%esp
+ b37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ b3a:	85 c9                	test   %ecx,%ecx
+ b3c:	74 58                	je     b96 <free+0x66>
+  bp = (Header*)ap - 1;
+ b3e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ b41:	ba 01 00 00 00       	mov    $0x1,%edx
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+ b50:	89 d0                	mov    %edx,%eax
+ b52:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+  while(xchg(&locked, 1) != 0)
+ b59:	85 c0                	test   %eax,%eax
+ b5b:	75 f3                	jne    b50 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ b5d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ b60:	83 fa 40             	cmp    $0x40,%edx
+ b63:	77 3b                	ja     ba0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ b65:	83 fa 02             	cmp    $0x2,%edx
+ b68:	76 3f                	jbe    ba9 <free+0x79>
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b70:	83 c0 01             	add    $0x1,%eax
+ b73:	39 14 85 40 0e 00 00 	cmp    %edx,0xe40(,%eax,4)
+ b7a:	72 f4                	jb     b70 <free+0x40>
+    bp->s.ptr = classfree[c];
+ b7c:	8b 14 85 a0 12 00 00 	mov    0x12a0(,%eax,4),%edx
+    classfree[c] = bp;
+ b83:	89 1c 85 a0 12 00 00 	mov    %ebx,0x12a0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ b8a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ b8d:	31 c0                	xor    %eax,%eax
+ b8f:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+}
+ b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b99:	c9                   	leave
+ b9a:	c3                   	ret
+ b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+    bigfree(bp);
+ ba0:	89 d8                	mov    %ebx,%eax
+ ba2:	e8 29 fe ff ff       	call   9d0 <bigfree>
+ ba7:	eb e4                	jmp    b8d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ ba9:	31 c0                	xor    %eax,%eax
+ bab:	eb cf                	jmp    b7c <free+0x4c>
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ bb6:	89 e5                	mov    %esp,%ebp
+ bb8:	57                   	push   %edi
+ bb9:	56                   	push   %esi
+ bba:	53                   	push   %ebx
+ bbb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bbe:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc1:	8d 50 07             	lea    0x7(%eax),%edx
+ bc4:	c1 ea 03             	shr    $0x3,%edx
+ bc7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ bd0:	89 c8                	mov    %ecx,%eax
+ bd2:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+ bd9:	85 c0                	test   %eax,%eax
+ bdb:	75 f3                	jne    bd0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ bdd:	89 c3                	mov    %eax,%ebx
+ bdf:	83 fa 40             	cmp    $0x40,%edx
+ be2:	77 4c                	ja     c30 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ be4:	be 02 00 00 00       	mov    $0x2,%esi
+ be9:	83 fa 02             	cmp    $0x2,%edx
+ bec:	76 10                	jbe    bfe <malloc+0x4e>
+ bee:	66 90                	xchg   %ax,%ax
+ bf0:	83 c3 01             	add    $0x1,%ebx
+ bf3:	8b 34 9d 40 0e 00 00 	mov    0xe40(,%ebx,4),%esi
+ bfa:	39 d6                	cmp    %edx,%esi
+ bfc:	72 f2                	jb     bf0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ bfe:	8b 14 9d a0 12 00 00 	mov    0x12a0(,%ebx,4),%edx
+ c05:	85 d2                	test   %edx,%edx
+ c07:	74 47                	je     c50 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ c09:	8b 3a                	mov    (%edx),%edi
+ c0b:	89 3c 9d a0 12 00 00 	mov    %edi,0x12a0(,%ebx,4)
+ c12:	31 c0                	xor    %eax,%eax
+ c14:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ c1b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ c1e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ c21:	5b                   	pop    %ebx
+ c22:	5e                   	pop    %esi
+ c23:	5f                   	pop    %edi
+ c24:	5d                   	pop    %ebp
+ c25:	c3                   	ret
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ c30:	89 d0                	mov    %edx,%eax
+ c32:	e8 19 fe ff ff       	call   a50 <bigalloc>
+ c37:	89 c2                	mov    %eax,%edx
+ c39:	89 d8                	mov    %ebx,%eax
+ c3b:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+  return p ? (void*)(p + 1) : 0;
+ c42:	85 d2                	test   %edx,%edx
+ c44:	75 d5                	jne    c1b <malloc+0x6b>
+ c46:	31 c0                	xor    %eax,%eax
+}
+ c48:	83 c4 1c             	add    $0x1c,%esp
+ c4b:	5b                   	pop    %ebx
+ c4c:	5e                   	pop    %esi
+ c4d:	5f                   	pop    %edi
+ c4e:	5d                   	pop    %ebp
+ c4f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ c50:	b8 00 02 00 00       	mov    $0x200,%eax
+ c55:	e8 f6 fd ff ff       	call   a50 <bigalloc>
+ c5a:	85 c0                	test   %eax,%eax
+ c5c:	74 44                	je     ca2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c5e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ c65:	8b 14 9d a0 12 00 00 	mov    0x12a0(,%ebx,4),%edx
+ c6c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ c6f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ c72:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ c78:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ c7b:	39 cf                	cmp    %ecx,%edi
+ c7d:	72 8a                	jb     c09 <malloc+0x59>
+ c7f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ c82:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ c85:	8d 76 00             	lea    0x0(%esi),%esi
+ c88:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ c8a:	89 70 04             	mov    %esi,0x4(%eax)
+ c8d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c8f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ c91:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c93:	01 d8                	add    %ebx,%eax
+ c95:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ c98:	73 ee                	jae    c88 <malloc+0xd8>
+ c9a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ c9d:	e9 69 ff ff ff       	jmp    c0b <malloc+0x5b>
+ ca2:	f0 87 05 80 12 00 00 	lock xchg %eax,0x1280
+  return p ? (void*)(p + 1) : 0;
+ ca9:	31 c0                	xor    %eax,%eax
+ cab:	eb 9b                	jmp    c48 <malloc+0x98>
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	56                   	push   %esi
+ cb4:	53                   	push   %ebx
+ cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb8:	f7 65 0c             	mull   0xc(%ebp)
+ cbb:	70 33                	jo     cf0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ cbd:	83 ec 0c             	sub    $0xc,%esp
+ cc0:	89 c3                	mov    %eax,%ebx
+ cc2:	50                   	push   %eax
+ cc3:	e8 e8 fe ff ff       	call   bb0 <malloc>
+ cc8:	83 c4 10             	add    $0x10,%esp
+ ccb:	89 c6                	mov    %eax,%esi
+ ccd:	85 c0                	test   %eax,%eax
+ ccf:	74 1f                	je     cf0 <calloc+0x40>
+    memset(p, 0, n);
+ cd1:	83 ec 04             	sub    $0x4,%esp
+ cd4:	53                   	push   %ebx
+ cd5:	6a 00                	push   $0x0
+ cd7:	50                   	push   %eax
+ cd8:	e8 23 f7 ff ff       	call   400 <memset>
+ cdd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ce0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ce3:	89 f0                	mov    %esi,%eax
+ ce5:	5b                   	pop    %ebx
+ ce6:	5e                   	pop    %esi
+ ce7:	5d                   	pop    %ebp
+ ce8:	c3                   	ret
+ ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ cf3:	31 f6                	xor    %esi,%esi
+}
+ cf5:	89 f0                	mov    %esi,%eax
+ cf7:	5b                   	pop    %ebx
+ cf8:	5e                   	pop    %esi
+ cf9:	5d                   	pop    %ebp
+ cfa:	c3                   	ret
+ cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+
+00000d00 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 0c             	sub    $0xc,%esp
+ d09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d0f:	85 db                	test   %ebx,%ebx
+ d11:	74 55                	je     d68 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ d13:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ d16:	89 de                	mov    %ebx,%esi
+ d18:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ d1f:	39 c7                	cmp    %eax,%edi
+ d21:	72 0d                	jb     d30 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d26:	89 f0                	mov    %esi,%eax
+ d28:	5b                   	pop    %ebx
+ d29:	5e                   	pop    %esi
+ d2a:	5f                   	pop    %edi
+ d2b:	5d                   	pop    %ebp
+ d2c:	c3                   	ret
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ d30:	83 ec 0c             	sub    $0xc,%esp
+ d33:	50                   	push   %eax
+ d34:	e8 77 fe ff ff       	call   bb0 <malloc>
+ d39:	83 c4 10             	add    $0x10,%esp
+ d3c:	89 c6                	mov    %eax,%esi
+ d3e:	85 c0                	test   %eax,%eax
+ d40:	74 e1                	je     d23 <realloc+0x23>
+  memmove(p, ap, have);
+ d42:	83 ec 04             	sub    $0x4,%esp
+ d45:	57                   	push   %edi
+ d46:	53                   	push   %ebx
+ d47:	50                   	push   %eax
+ d48:	e8 03 f8 ff ff       	call   550 <memmove>
+  free(ap);
+ d4d:	89 1c 24             	mov    %ebx,(%esp)
+ d50:	e8 db fd ff ff       	call   b30 <free>
+  return p;
+ d55:	83 c4 10             	add    $0x10,%esp
+}
+ d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d5b:	89 f0                	mov    %esi,%eax
+ d5d:	5b                   	pop    %ebx
+ d5e:	5e                   	pop    %esi
+ d5f:	5f                   	pop    %edi
+ d60:	5d                   	pop    %ebp
+ d61:	c3                   	ret
+ d62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ d68:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d6e:	5b                   	pop    %ebx
+ d6f:	5e                   	pop    %esi
+ d70:	5f                   	pop    %edi
+ d71:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d72:	e9 39 fe ff ff       	jmp    bb0 <malloc>
@@ -22,18 +22,28 @@ main(void)
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
+  sseinit();       // SSE for large copies
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  deadlockinit();  // wait-for graph
+  futexinit();     // futex wait queues
   tvinit();        // trap vectors
+  profinit();      // sampling profiler
+  traceinit();     // event tracing
   binit();         // buffer cache
+  pcacheinit();    // file page cache
+  pollinit();      // poll() wait queues
+  shminit();       // shared memory segments
   fileinit();      // file table
+  tmpfsinit();     // in-memory file system
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();      // first user process
+  kthread_create("watchdog", watchdog, 0); // deadlock watchdog
   mpmain();        // finish this processor's setup
 }
 
@@ -43,6 +53,7 @@ mpenter(void)
 {
   switchkvm();
   seginit();
+  sseinit();
   lapicinit();
   mpmain();
 }
@@ -0,0 +1,2004 @@
+
+_mallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s\t%d calls\t%d cycles/call\n", name, n, n ? cycles / n : 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  uint sz, t;
+  uint nmalloc, nfree, nrealloc;
+  uint cmalloc, cfree, crealloc;
+  char *p;
+
+  nops = argc > 1 ? atoi(argv[1]) : 50000;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  nops = argc > 1 ? atoi(argv[1]) : 50000;
+  1a:	c7 45 e4 50 c3 00 00 	movl   $0xc350,-0x1c(%ebp)
+  21:	0f 8f 97 01 00 00    	jg     1be <main+0x1be>
+  nmalloc = nfree = nrealloc = 0;
+  cmalloc = cfree = crealloc = 0;
+  27:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+
+  for(i = 0; i < nops; i++){
+  2e:	31 ff                	xor    %edi,%edi
+  cmalloc = cfree = crealloc = 0;
+  30:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  37:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  nmalloc = nfree = nrealloc = 0;
+  3e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  45:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  4c:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+  53:	eb 54                	jmp    a9 <main+0xa9>
+  55:	8d 76 00             	lea    0x0(%esi),%esi
+        exit();
+      }
+      p[0] = p[sz-1] = k;
+      slot[k] = p;
+    } else if(i % 8 == 0){
+      sz = randsize();
+  58:	e8 e3 01 00 00       	call   240 <randsize>
+  5d:	89 c1                	mov    %eax,%ecx
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+  5f:	0f 31                	rdtsc
+      t = rdtsc();
+      p = realloc(slot[k], sz);
+  61:	83 ec 08             	sub    $0x8,%esp
+  64:	89 c6                	mov    %eax,%esi
+  66:	51                   	push   %ecx
+  67:	ff 34 9d 60 12 00 00 	push   0x1260(,%ebx,4)
+  6e:	e8 5d 0c 00 00       	call   cd0 <realloc>
+  73:	89 c1                	mov    %eax,%ecx
+  75:	0f 31                	rdtsc
+  return val;
+  77:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      crealloc += (uint)rdtsc() - t;
+      nrealloc++;
+  7a:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+      if(p == 0){
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	01 c2                	add    %eax,%edx
+  83:	89 d0                	mov    %edx,%eax
+      crealloc += (uint)rdtsc() - t;
+  85:	29 f0                	sub    %esi,%eax
+  87:	89 45 dc             	mov    %eax,-0x24(%ebp)
+      if(p == 0){
+  8a:	85 c9                	test   %ecx,%ecx
+  8c:	0f 84 5e 01 00 00    	je     1f0 <main+0x1f0>
+        printf(2, "mallocbench: out of memory\n");
+        exit();
+      }
+      if(p[0] != (char)k){
+  92:	38 19                	cmp    %bl,(%ecx)
+  94:	0f 85 69 01 00 00    	jne    203 <main+0x203>
+      slot[k] = p;
+  9a:	89 0c 9d 60 12 00 00 	mov    %ecx,0x1260(,%ebx,4)
+  for(i = 0; i < nops; i++){
+  a1:	83 c7 01             	add    $0x1,%edi
+  a4:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  a7:	7e 6d                	jle    116 <main+0x116>
+  seed = seed * 1103515245 + 12345;
+  a9:	69 1d 4c 12 00 00 6d 	imul   $0x41c64e6d,0x124c,%ebx
+  b0:	4e c6 41 
+  b3:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+  b9:	89 1d 4c 12 00 00    	mov    %ebx,0x124c
+  return seed >> 8;
+  bf:	c1 eb 08             	shr    $0x8,%ebx
+  c2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+    if(slot[k] == 0){
+  c8:	8b 0c 9d 60 12 00 00 	mov    0x1260(,%ebx,4),%ecx
+  cf:	85 c9                	test   %ecx,%ecx
+  d1:	0f 84 a9 00 00 00    	je     180 <main+0x180>
+    } else if(i % 8 == 0){
+  d7:	f7 c7 07 00 00 00    	test   $0x7,%edi
+  dd:	0f 84 75 ff ff ff    	je     58 <main+0x58>
+  asm volatile("rdtsc" : "=A" (val));
+  e3:	0f 31                	rdtsc
+        exit();
+      }
+      slot[k] = p;
+    } else {
+      t = rdtsc();
+      free(slot[k]);
+  e5:	83 ec 0c             	sub    $0xc,%esp
+  e8:	89 c6                	mov    %eax,%esi
+  ea:	51                   	push   %ecx
+  eb:	e8 10 0a 00 00       	call   b00 <free>
+  f0:	0f 31                	rdtsc
+  return val;
+  f2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      cfree += (uint)rdtsc() - t;
+      nfree++;
+  f5:	31 c9                	xor    %ecx,%ecx
+  f7:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  fb:	83 c4 10             	add    $0x10,%esp
+      slot[k] = p;
+  fe:	89 0c 9d 60 12 00 00 	mov    %ecx,0x1260(,%ebx,4)
+  for(i = 0; i < nops; i++){
+ 105:	83 c7 01             	add    $0x1,%edi
+ 108:	01 c2                	add    %eax,%edx
+ 10a:	89 d0                	mov    %edx,%eax
+      cfree += (uint)rdtsc() - t;
+ 10c:	29 f0                	sub    %esi,%eax
+ 10e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < nops; i++){
+ 111:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 114:	7f 93                	jg     a9 <main+0xa9>
+      slot[k] = 0;
+    }
+  }
+  for(k = 0; k < NSLOT; k++)
+ 116:	31 db                	xor    %ebx,%ebx
+ 118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+    free(slot[k]);
+ 120:	83 ec 0c             	sub    $0xc,%esp
+ 123:	ff 34 9d 60 12 00 00 	push   0x1260(,%ebx,4)
+  for(k = 0; k < NSLOT; k++)
+ 12a:	83 c3 01             	add    $0x1,%ebx
+    free(slot[k]);
+ 12d:	e8 ce 09 00 00       	call   b00 <free>
+  for(k = 0; k < NSLOT; k++)
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+ 13b:	75 e3                	jne    120 <main+0x120>
+
+  report("malloc", cmalloc, nmalloc);
+ 13d:	50                   	push   %eax
+ 13e:	ff 75 c8             	push   -0x38(%ebp)
+ 141:	ff 75 d0             	push   -0x30(%ebp)
+ 144:	68 98 0d 00 00       	push   $0xd98
+ 149:	e8 92 01 00 00       	call   2e0 <report>
+  report("free", cfree, nfree);
+ 14e:	83 c4 0c             	add    $0xc,%esp
+ 151:	ff 75 d8             	push   -0x28(%ebp)
+ 154:	ff 75 e0             	push   -0x20(%ebp)
+ 157:	68 9f 0d 00 00       	push   $0xd9f
+ 15c:	e8 7f 01 00 00       	call   2e0 <report>
+  report("realloc", crealloc, nrealloc);
+ 161:	83 c4 0c             	add    $0xc,%esp
+ 164:	ff 75 d4             	push   -0x2c(%ebp)
+ 167:	ff 75 dc             	push   -0x24(%ebp)
+ 16a:	68 a4 0d 00 00       	push   $0xda4
+ 16f:	e8 6c 01 00 00       	call   2e0 <report>
+  exit();
+ 174:	e8 da 03 00 00       	call   553 <exit>
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      sz = randsize();
+ 180:	e8 bb 00 00 00       	call   240 <randsize>
+ 185:	89 c6                	mov    %eax,%esi
+  asm volatile("rdtsc" : "=A" (val));
+ 187:	0f 31                	rdtsc
+      p = malloc(sz);
+ 189:	83 ec 0c             	sub    $0xc,%esp
+ 18c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 18f:	56                   	push   %esi
+ 190:	e8 eb 09 00 00       	call   b80 <malloc>
+ 195:	89 c1                	mov    %eax,%ecx
+ 197:	0f 31                	rdtsc
+  return val;
+ 199:	8b 55 d0             	mov    -0x30(%ebp),%edx
+      nmalloc++;
+ 19c:	83 45 c8 01          	addl   $0x1,-0x38(%ebp)
+      if(p == 0){
+ 1a0:	83 c4 10             	add    $0x10,%esp
+ 1a3:	01 c2                	add    %eax,%edx
+ 1a5:	89 d0                	mov    %edx,%eax
+      cmalloc += (uint)rdtsc() - t;
+ 1a7:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1aa:	29 d0                	sub    %edx,%eax
+ 1ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+      if(p == 0){
+ 1af:	85 c9                	test   %ecx,%ecx
+ 1b1:	74 3d                	je     1f0 <main+0x1f0>
+      p[0] = p[sz-1] = k;
+ 1b3:	88 5c 31 ff          	mov    %bl,-0x1(%ecx,%esi,1)
+ 1b7:	88 19                	mov    %bl,(%ecx)
+      slot[k] = p;
+ 1b9:	e9 dc fe ff ff       	jmp    9a <main+0x9a>
+  nops = argc > 1 ? atoi(argv[1]) : 50000;
+ 1be:	83 ec 0c             	sub    $0xc,%esp
+ 1c1:	ff 70 04             	push   0x4(%eax)
+ 1c4:	e8 17 03 00 00       	call   4e0 <atoi>
+  for(i = 0; i < nops; i++){
+ 1c9:	83 c4 10             	add    $0x10,%esp
+  nops = argc > 1 ? atoi(argv[1]) : 50000;
+ 1cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nops; i++){
+ 1cf:	85 c0                	test   %eax,%eax
+ 1d1:	0f 8f 50 fe ff ff    	jg     27 <main+0x27>
+  nmalloc = nfree = nrealloc = 0;
+ 1d7:	31 d2                	xor    %edx,%edx
+ 1d9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 1dc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1df:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 1e2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 1e5:	89 55 d8             	mov    %edx,-0x28(%ebp)
+ 1e8:	89 55 c8             	mov    %edx,-0x38(%ebp)
+ 1eb:	e9 26 ff ff ff       	jmp    116 <main+0x116>
+        printf(2, "mallocbench: out of memory\n");
+ 1f0:	53                   	push   %ebx
+ 1f1:	53                   	push   %ebx
+ 1f2:	68 7c 0d 00 00       	push   $0xd7c
+ 1f7:	6a 02                	push   $0x2
+ 1f9:	e8 f2 05 00 00       	call   7f0 <printf>
+        exit();
+ 1fe:	e8 50 03 00 00       	call   553 <exit>
+        printf(2, "mallocbench: realloc lost data\n");
+ 203:	51                   	push   %ecx
+ 204:	51                   	push   %ecx
+ 205:	68 ac 0d 00 00       	push   $0xdac
+ 20a:	6a 02                	push   $0x2
+ 20c:	e8 df 05 00 00       	call   7f0 <printf>
+        exit();
+ 211:	e8 3d 03 00 00       	call   553 <exit>
+ 216:	66 90                	xchg   %ax,%ax
+ 218:	66 90                	xchg   %ax,%ax
+ 21a:	66 90                	xchg   %ax,%ax
+ 21c:	66 90                	xchg   %ax,%ax
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <rand>:
+  seed = seed * 1103515245 + 12345;
+ 220:	69 05 4c 12 00 00 6d 	imul   $0x41c64e6d,0x124c,%eax
+ 227:	4e c6 41 
+ 22a:	05 39 30 00 00       	add    $0x3039,%eax
+ 22f:	a3 4c 12 00 00       	mov    %eax,0x124c
+  return seed >> 8;
+ 234:	c1 e8 08             	shr    $0x8,%eax
+}
+ 237:	c3                   	ret
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <randsize>:
+  seed = seed * 1103515245 + 12345;
+ 240:	69 0d 4c 12 00 00 6d 	imul   $0x41c64e6d,0x124c,%ecx
+ 247:	4e c6 41 
+{
+ 24a:	55                   	push   %ebp
+  uint r = rand() % 100;
+ 24b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  seed = seed * 1103515245 + 12345;
+ 250:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+{
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	56                   	push   %esi
+ 259:	53                   	push   %ebx
+  return seed >> 8;
+ 25a:	89 cb                	mov    %ecx,%ebx
+  seed = seed * 1103515245 + 12345;
+ 25c:	69 c9 6d 4e c6 41    	imul   $0x41c64e6d,%ecx,%ecx
+  return seed >> 8;
+ 262:	c1 eb 08             	shr    $0x8,%ebx
+  uint r = rand() % 100;
+ 265:	f7 e3                	mul    %ebx
+  seed = seed * 1103515245 + 12345;
+ 267:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+  uint r = rand() % 100;
+ 26d:	c1 ea 05             	shr    $0x5,%edx
+ 270:	6b c2 64             	imul   $0x64,%edx,%eax
+ 273:	29 c3                	sub    %eax,%ebx
+ 275:	89 da                	mov    %ebx,%edx
+  return seed >> 8;
+ 277:	89 cb                	mov    %ecx,%ebx
+ 279:	c1 eb 08             	shr    $0x8,%ebx
+    return 1 + rand() % 256;
+ 27c:	0f b6 c3             	movzbl %bl,%eax
+ 27f:	83 c0 01             	add    $0x1,%eax
+  if(r < 80)
+ 282:	83 fa 4f             	cmp    $0x4f,%edx
+ 285:	76 20                	jbe    2a7 <randsize+0x67>
+  if(r < 95)
+ 287:	83 fa 5e             	cmp    $0x5e,%edx
+    return 256 + rand() % 1792;
+ 28a:	89 ca                	mov    %ecx,%edx
+  if(r < 95)
+ 28c:	76 2a                	jbe    2b8 <randsize+0x78>
+  return 2048 + rand() % 14336;
+ 28e:	b8 49 4a 92 24       	mov    $0x24924a49,%eax
+ 293:	c1 ea 13             	shr    $0x13,%edx
+ 296:	f7 e2                	mul    %edx
+ 298:	89 d8                	mov    %ebx,%eax
+ 29a:	69 d2 00 38 00 00    	imul   $0x3800,%edx,%edx
+ 2a0:	29 d0                	sub    %edx,%eax
+ 2a2:	05 00 08 00 00       	add    $0x800,%eax
+}
+ 2a7:	5b                   	pop    %ebx
+ 2a8:	5e                   	pop    %esi
+  seed = seed * 1103515245 + 12345;
+ 2a9:	89 0d 4c 12 00 00    	mov    %ecx,0x124c
+}
+ 2af:	5d                   	pop    %ebp
+ 2b0:	c3                   	ret
+ 2b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return 256 + rand() % 1792;
+ 2b8:	b8 49 49 92 24       	mov    $0x24924949,%eax
+ 2bd:	c1 ea 10             	shr    $0x10,%edx
+  seed = seed * 1103515245 + 12345;
+ 2c0:	89 0d 4c 12 00 00    	mov    %ecx,0x124c
+    return 256 + rand() % 1792;
+ 2c6:	f7 e2                	mul    %edx
+ 2c8:	89 d8                	mov    %ebx,%eax
+}
+ 2ca:	5b                   	pop    %ebx
+ 2cb:	5e                   	pop    %esi
+ 2cc:	5d                   	pop    %ebp
+    return 256 + rand() % 1792;
+ 2cd:	69 d2 00 07 00 00    	imul   $0x700,%edx,%edx
+ 2d3:	29 d0                	sub    %edx,%eax
+ 2d5:	05 00 01 00 00       	add    $0x100,%eax
+}
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <report>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	31 c0                	xor    %eax,%eax
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	83 ec 08             	sub    $0x8,%esp
+ 2e8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  printf(1, "%s\t%d calls\t%d cycles/call\n", name, n, n ? cycles / n : 0);
+ 2eb:	85 c9                	test   %ecx,%ecx
+ 2ed:	74 07                	je     2f6 <report+0x16>
+ 2ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f2:	31 d2                	xor    %edx,%edx
+ 2f4:	f7 f1                	div    %ecx
+ 2f6:	83 ec 0c             	sub    $0xc,%esp
+ 2f9:	50                   	push   %eax
+ 2fa:	51                   	push   %ecx
+ 2fb:	ff 75 08             	push   0x8(%ebp)
+ 2fe:	68 60 0d 00 00       	push   $0xd60
+ 303:	6a 01                	push   $0x1
+ 305:	e8 e6 04 00 00       	call   7f0 <printf>
+}
+ 30a:	83 c4 20             	add    $0x20,%esp
+ 30d:	c9                   	leave
+ 30e:	c3                   	ret
+ 30f:	90                   	nop
+
+00000310 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 310:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 311:	31 c0                	xor    %eax,%eax
+{
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	53                   	push   %ebx
+ 316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 320:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 324:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 327:	83 c0 01             	add    $0x1,%eax
+ 32a:	84 d2                	test   %dl,%dl
+ 32c:	75 f2                	jne    320 <strcpy+0x10>
+    ;
+  return os;
+}
+ 32e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 331:	89 c8                	mov    %ecx,%eax
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+ 335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+ 347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 34a:	0f b6 02             	movzbl (%edx),%eax
+ 34d:	84 c0                	test   %al,%al
+ 34f:	75 17                	jne    368 <strcmp+0x28>
+ 351:	eb 3a                	jmp    38d <strcmp+0x4d>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 35c:	83 c2 01             	add    $0x1,%edx
+ 35f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 362:	84 c0                	test   %al,%al
+ 364:	74 1a                	je     380 <strcmp+0x40>
+    p++, q++;
+ 366:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 368:	0f b6 19             	movzbl (%ecx),%ebx
+ 36b:	38 c3                	cmp    %al,%bl
+ 36d:	74 e9                	je     358 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 36f:	29 d8                	sub    %ebx,%eax
+}
+ 371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 374:	c9                   	leave
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 380:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 384:	31 c0                	xor    %eax,%eax
+ 386:	29 d8                	sub    %ebx,%eax
+}
+ 388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 38b:	c9                   	leave
+ 38c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 38d:	0f b6 19             	movzbl (%ecx),%ebx
+ 390:	31 c0                	xor    %eax,%eax
+ 392:	eb db                	jmp    36f <strcmp+0x2f>
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3a9:	74 15                	je     3c0 <strlen+0x20>
+ 3ab:	31 c0                	xor    %eax,%eax
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 3b0:	83 c0 01             	add    $0x1,%eax
+ 3b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	75 f5                	jne    3b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3bb:	89 c8                	mov    %ecx,%eax
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+ 3bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3c0:	31 c9                	xor    %ecx,%ecx
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	89 c8                	mov    %ecx,%eax
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 3d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dd:	89 d7                	mov    %edx,%edi
+ 3df:	fc                   	cld
+ 3e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3fa:	0f b6 10             	movzbl (%eax),%edx
+ 3fd:	84 d2                	test   %dl,%dl
+ 3ff:	75 12                	jne    413 <strchr+0x23>
+ 401:	eb 1d                	jmp    420 <strchr+0x30>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 40c:	83 c0 01             	add    $0x1,%eax
+ 40f:	84 d2                	test   %dl,%dl
+ 411:	74 0d                	je     420 <strchr+0x30>
+    if(*s == c)
+ 413:	38 d1                	cmp    %dl,%cl
+ 415:	75 f1                	jne    408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 420:	31 c0                	xor    %eax,%eax
+}
+ 422:	5d                   	pop    %ebp
+ 423:	c3                   	ret
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 439:	31 db                	xor    %ebx,%ebx
+{
+ 43b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 43e:	eb 27                	jmp    467 <gets+0x37>
+    cc = read(0, &c, 1);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	6a 01                	push   $0x1
+ 445:	56                   	push   %esi
+ 446:	6a 00                	push   $0x0
+ 448:	e8 1e 01 00 00       	call   56b <read>
+    if(cc < 1)
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	85 c0                	test   %eax,%eax
+ 452:	7e 1d                	jle    471 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 45f:	3c 0a                	cmp    $0xa,%al
+ 461:	74 10                	je     473 <gets+0x43>
+ 463:	3c 0d                	cmp    $0xd,%al
+ 465:	74 0c                	je     473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 467:	89 df                	mov    %ebx,%edi
+ 469:	83 c3 01             	add    $0x1,%ebx
+ 46c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 46f:	7c cf                	jl     440 <gets+0x10>
+ 471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 47a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47d:	5b                   	pop    %ebx
+ 47e:	5e                   	pop    %esi
+ 47f:	5f                   	pop    %edi
+ 480:	5d                   	pop    %ebp
+ 481:	c3                   	ret
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 495:	83 ec 08             	sub    $0x8,%esp
+ 498:	6a 00                	push   $0x0
+ 49a:	ff 75 08             	push   0x8(%ebp)
+ 49d:	e8 f1 00 00 00       	call   593 <open>
+  if(fd < 0)
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	78 27                	js     4d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	ff 75 0c             	push   0xc(%ebp)
+ 4af:	89 c3                	mov    %eax,%ebx
+ 4b1:	50                   	push   %eax
+ 4b2:	e8 f4 00 00 00       	call   5ab <fstat>
+  close(fd);
+ 4b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4bc:	e8 ba 00 00 00       	call   57b <close>
+  return r;
+ 4c1:	83 c4 10             	add    $0x10,%esp
+}
+ 4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4c7:	89 f0                	mov    %esi,%eax
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4d5:	eb ed                	jmp    4c4 <stat+0x34>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	53                   	push   %ebx
+ 4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4e7:	0f be 02             	movsbl (%edx),%eax
+ 4ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4f5:	77 1e                	ja     515 <atoi+0x35>
+ 4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 500:	83 c2 01             	add    $0x1,%edx
+ 503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 50a:	0f be 02             	movsbl (%edx),%eax
+ 50d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 510:	80 fb 09             	cmp    $0x9,%bl
+ 513:	76 eb                	jbe    500 <atoi+0x20>
+  return n;
+}
+ 515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 518:	89 c8                	mov    %ecx,%eax
+ 51a:	c9                   	leave
+ 51b:	c3                   	ret
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	8b 45 10             	mov    0x10(%ebp),%eax
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 52e:	85 c0                	test   %eax,%eax
+ 530:	7e 13                	jle    545 <memmove+0x25>
+ 532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 534:	89 d7                	mov    %edx,%edi
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 541:	39 f8                	cmp    %edi,%eax
+ 543:	75 fb                	jne    540 <memmove+0x20>
+  return vdst;
+}
+ 545:	5e                   	pop    %esi
+ 546:	89 d0                	mov    %edx,%eax
+ 548:	5f                   	pop    %edi
+ 549:	5d                   	pop    %ebp
+ 54a:	c3                   	ret
+
+0000054b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 54b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <exit>:
+SYSCALL(exit)
+ 553:	b8 02 00 00 00       	mov    $0x2,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <wait>:
+SYSCALL(wait)
+ 55b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <pipe>:
+SYSCALL(pipe)
+ 563:	b8 04 00 00 00       	mov    $0x4,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <read>:
+SYSCALL(read)
+ 56b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <write>:
+SYSCALL(write)
+ 573:	b8 10 00 00 00       	mov    $0x10,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <close>:
+SYSCALL(close)
+ 57b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <kill>:
+SYSCALL(kill)
+ 583:	b8 06 00 00 00       	mov    $0x6,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <exec>:
+SYSCALL(exec)
+ 58b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <open>:
+SYSCALL(open)
+ 593:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mknod>:
+SYSCALL(mknod)
+ 59b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <unlink>:
+SYSCALL(unlink)
+ 5a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <fstat>:
+SYSCALL(fstat)
+ 5ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <link>:
+SYSCALL(link)
+ 5b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mkdir>:
+SYSCALL(mkdir)
+ 5bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <chdir>:
+SYSCALL(chdir)
+ 5c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <dup>:
+SYSCALL(dup)
+ 5cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getpid>:
+SYSCALL(getpid)
+ 5d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sbrk>:
+SYSCALL(sbrk)
+ 5db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+ 5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <uptime>:
+SYSCALL(uptime)
+ 5eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 5f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 5fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 603:	b8 18 00 00 00       	mov    $0x18,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 60b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 61b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 623:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <setpriority>:
+SYSCALL(setpriority)
+ 62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 633:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getcpustats>:
+SYSCALL(getcpustats)
+ 63b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <setscheduler>:
+SYSCALL(setscheduler)
+ 643:	b8 20 00 00 00       	mov    $0x20,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 64b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <getscheduler>:
+SYSCALL(getscheduler)
+ 653:	b8 22 00 00 00       	mov    $0x22,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <splice>:
+SYSCALL(splice)
+ 65b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <readv>:
+SYSCALL(readv)
+ 663:	b8 24 00 00 00       	mov    $0x24,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <writev>:
+SYSCALL(writev)
+ 66b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <pread>:
+SYSCALL(pread)
+ 673:	b8 26 00 00 00       	mov    $0x26,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <pwrite>:
+SYSCALL(pwrite)
+ 67b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <getlogstat>:
+SYSCALL(getlogstat)
+ 683:	b8 28 00 00 00       	mov    $0x28,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mount>:
+SYSCALL(mount)
+ 68b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <umount>:
+SYSCALL(umount)
+ 693:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <mmap>:
+SYSCALL(mmap)
+ 69b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <munmap>:
+SYSCALL(munmap)
+ 6a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <membench>:
+SYSCALL(membench)
+ 6ab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getlockstat>:
+SYSCALL(getlockstat)
+ 6b3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <lockbench>:
+SYSCALL(lockbench)
+ 6bb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <prof>:
+SYSCALL(prof)
+ 6c3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <tracectl>:
+SYSCALL(tracectl)
+ 6cb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <traceread>:
+SYSCALL(traceread)
+ 6d3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <getsysstat>:
+SYSCALL(getsysstat)
+ 6db:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 6e3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <getschedwait>:
+SYSCALL(getschedwait)
+ 6eb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <mlfqread>:
+SYSCALL(mlfqread)
+ 6f3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dllock>:
+SYSCALL(dllock)
+ 6fb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 703:	b8 38 00 00 00       	mov    $0x38,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 70b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <clone>:
+SYSCALL(clone)
+ 713:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <join>:
+SYSCALL(join)
+ 71b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <futex>:
+SYSCALL(futex)
+ 723:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <shmat>:
+SYSCALL(shmat)
+ 72b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <shmdt>:
+SYSCALL(shmdt)
+ 733:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <poll>:
+SYSCALL(poll)
+ 73b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+ 743:	66 90                	xchg   %ax,%ax
+ 745:	66 90                	xchg   %ax,%ax
+ 747:	66 90                	xchg   %ax,%ax
+ 749:	66 90                	xchg   %ax,%ax
+ 74b:	66 90                	xchg   %ax,%ax
+ 74d:	66 90                	xchg   %ax,%ax
+ 74f:	90                   	nop
+
+00000750 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 758:	89 d1                	mov    %edx,%ecx
+{
+ 75a:	83 ec 3c             	sub    $0x3c,%esp
+ 75d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 760:	85 d2                	test   %edx,%edx
+ 762:	0f 89 80 00 00 00    	jns    7e8 <printint+0x98>
+ 768:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 76c:	74 7a                	je     7e8 <printint+0x98>
+    x = -xx;
+ 76e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 770:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 775:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 778:	31 f6                	xor    %esi,%esi
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 780:	89 c8                	mov    %ecx,%eax
+ 782:	31 d2                	xor    %edx,%edx
+ 784:	89 f7                	mov    %esi,%edi
+ 786:	f7 f3                	div    %ebx
+ 788:	8d 76 01             	lea    0x1(%esi),%esi
+ 78b:	0f b6 92 2c 0e 00 00 	movzbl 0xe2c(%edx),%edx
+ 792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 796:	89 ca                	mov    %ecx,%edx
+ 798:	89 c1                	mov    %eax,%ecx
+ 79a:	39 da                	cmp    %ebx,%edx
+ 79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+ 79e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+ 7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7aa:	89 f7                	mov    %esi,%edi
+ 7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7b2:	01 df                	add    %ebx,%edi
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7c4:	6a 01                	push   $0x1
+ 7c6:	50                   	push   %eax
+ 7c7:	56                   	push   %esi
+ 7c8:	e8 a6 fd ff ff       	call   573 <write>
+  while(--i >= 0)
+ 7cd:	89 f8                	mov    %edi,%eax
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	83 ef 01             	sub    $0x1,%edi
+ 7d5:	39 d8                	cmp    %ebx,%eax
+ 7d7:	75 df                	jne    7b8 <printint+0x68>
+}
+ 7d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7e8:	31 c0                	xor    %eax,%eax
+ 7ea:	eb 89                	jmp    775 <printint+0x25>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 802:	83 c6 01             	add    $0x1,%esi
+ 805:	84 db                	test   %bl,%bl
+ 807:	74 67                	je     870 <printf+0x80>
+ 809:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 80c:	31 d2                	xor    %edx,%edx
+ 80e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 811:	eb 34                	jmp    847 <printf+0x57>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+ 818:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 81b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 820:	83 f8 25             	cmp    $0x25,%eax
+ 823:	74 18                	je     83d <printf+0x4d>
+  write(fd, &c, 1);
+ 825:	83 ec 04             	sub    $0x4,%esp
+ 828:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82e:	6a 01                	push   $0x1
+ 830:	50                   	push   %eax
+ 831:	57                   	push   %edi
+ 832:	e8 3c fd ff ff       	call   573 <write>
+ 837:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 83a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 83d:	0f b6 1e             	movzbl (%esi),%ebx
+ 840:	83 c6 01             	add    $0x1,%esi
+ 843:	84 db                	test   %bl,%bl
+ 845:	74 29                	je     870 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 847:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84a:	85 d2                	test   %edx,%edx
+ 84c:	74 ca                	je     818 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 84e:	83 fa 25             	cmp    $0x25,%edx
+ 851:	75 ea                	jne    83d <printf+0x4d>
+      if(c == 'd'){
+ 853:	83 f8 25             	cmp    $0x25,%eax
+ 856:	0f 84 24 01 00 00    	je     980 <printf+0x190>
+ 85c:	83 e8 63             	sub    $0x63,%eax
+ 85f:	83 f8 15             	cmp    $0x15,%eax
+ 862:	77 1c                	ja     880 <printf+0x90>
+ 864:	ff 24 85 d4 0d 00 00 	jmp    *0xdd4(,%eax,4)
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 873:	5b                   	pop    %ebx
+ 874:	5e                   	pop    %esi
+ 875:	5f                   	pop    %edi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 886:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 88a:	6a 01                	push   $0x1
+ 88c:	52                   	push   %edx
+ 88d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 890:	57                   	push   %edi
+ 891:	e8 dd fc ff ff       	call   573 <write>
+ 896:	83 c4 0c             	add    $0xc,%esp
+ 899:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 89c:	6a 01                	push   $0x1
+ 89e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8a1:	52                   	push   %edx
+ 8a2:	57                   	push   %edi
+ 8a3:	e8 cb fc ff ff       	call   573 <write>
+        putc(fd, c);
+ 8a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ab:	31 d2                	xor    %edx,%edx
+ 8ad:	eb 8e                	jmp    83d <printf+0x4d>
+ 8af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 00                	push   $0x0
+ 8bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8c4:	e8 87 fe ff ff       	call   750 <printint>
+        ap++;
+ 8c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 67 ff ff ff       	jmp    83d <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8e5:	83 c0 04             	add    $0x4,%eax
+ 8e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	0f 84 9d 00 00 00    	je     990 <printf+0x1a0>
+        while(*s != 0){
+ 8f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	0f 84 3d ff ff ff    	je     83d <printf+0x4d>
+ 900:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 903:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 906:	89 de                	mov    %ebx,%esi
+ 908:	89 d3                	mov    %edx,%ebx
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 916:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	53                   	push   %ebx
+ 91c:	57                   	push   %edi
+ 91d:	e8 51 fc ff ff       	call   573 <write>
+        while(*s != 0){
+ 922:	0f b6 06             	movzbl (%esi),%eax
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	84 c0                	test   %al,%al
+ 92a:	75 e4                	jne    910 <printf+0x120>
+      state = 0;
+ 92c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 07 ff ff ff       	jmp    83d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 01                	push   $0x1
+ 94f:	e9 6b ff ff ff       	jmp    8bf <printf+0xcf>
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 958:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 961:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 963:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 966:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	52                   	push   %edx
+ 96c:	57                   	push   %edi
+ 96d:	e8 01 fc ff ff       	call   573 <write>
+        ap++;
+ 972:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 975:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	e9 be fe ff ff       	jmp    83d <printf+0x4d>
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 986:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 989:	6a 01                	push   $0x1
+ 98b:	e9 11 ff ff ff       	jmp    8a1 <printf+0xb1>
+ 990:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 995:	bb cc 0d 00 00       	mov    $0xdcc,%ebx
+ 99a:	e9 61 ff ff ff       	jmp    900 <printf+0x110>
+ 99f:	90                   	nop
+
+000009a0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a3:	a1 b4 1a 00 00       	mov    0x1ab4,%eax
+{
+ 9a8:	89 e5                	mov    %esp,%ebp
+ 9aa:	56                   	push   %esi
+ 9ab:	53                   	push   %ebx
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b4:	39 ca                	cmp    %ecx,%edx
+ 9b6:	73 30                	jae    9e8 <bigfree+0x48>
+ 9b8:	39 c1                	cmp    %eax,%ecx
+ 9ba:	72 04                	jb     9c0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9bc:	39 c2                	cmp    %eax,%edx
+ 9be:	72 f0                	jb     9b0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 9c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 9c6:	39 f0                	cmp    %esi,%eax
+ 9c8:	74 26                	je     9f0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9d2:	39 d9                	cmp    %ebx,%ecx
+ 9d4:	74 30                	je     a06 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9d8:	5b                   	pop    %ebx
+  freep = p;
+ 9d9:	89 15 b4 1a 00 00    	mov    %edx,0x1ab4
+}
+ 9df:	5e                   	pop    %esi
+ 9e0:	5d                   	pop    %ebp
+ 9e1:	c3                   	ret
+ 9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e8:	39 c1                	cmp    %eax,%ecx
+ 9ea:	72 d0                	jb     9bc <bigfree+0x1c>
+ 9ec:	eb c2                	jmp    9b0 <bigfree+0x10>
+ 9ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9f0:	03 58 04             	add    0x4(%eax),%ebx
+ 9f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f6:	8b 02                	mov    (%edx),%eax
+ 9f8:	8b 00                	mov    (%eax),%eax
+ 9fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a02:	39 d9                	cmp    %ebx,%ecx
+ a04:	75 d0                	jne    9d6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ a06:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ a09:	89 15 b4 1a 00 00    	mov    %edx,0x1ab4
+    p->s.size += bp->s.size;
+ a0f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a12:	8b 09                	mov    (%ecx),%ecx
+ a14:	89 0a                	mov    %ecx,(%edx)
+}
+ a16:	5b                   	pop    %ebx
+ a17:	5e                   	pop    %esi
+ a18:	5d                   	pop    %ebp
+ a19:	c3                   	ret
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a20 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	89 c7                	mov    %eax,%edi
+ a26:	56                   	push   %esi
+ a27:	53                   	push   %ebx
+ a28:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ a2b:	a1 b4 1a 00 00       	mov    0x1ab4,%eax
+ a30:	85 c0                	test   %eax,%eax
+ a32:	0f 84 88 00 00 00    	je     ac0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a38:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a3a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a3d:	39 f9                	cmp    %edi,%ecx
+ a3f:	73 5f                	jae    aa0 <bigalloc+0x80>
+  if(nu < 4096)
+ a41:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a46:	39 df                	cmp    %ebx,%edi
+ a48:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a4b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a52:	eb 0d                	jmp    a61 <bigalloc+0x41>
+ a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a58:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a5a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a5d:	39 f9                	cmp    %edi,%ecx
+ a5f:	73 3f                	jae    aa0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a61:	89 d0                	mov    %edx,%eax
+ a63:	39 15 b4 1a 00 00    	cmp    %edx,0x1ab4
+ a69:	75 ed                	jne    a58 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a6b:	83 ec 0c             	sub    $0xc,%esp
+ a6e:	56                   	push   %esi
+ a6f:	e8 67 fb ff ff       	call   5db <sbrk>
+  if(p == (char*)-1)
+ a74:	83 c4 10             	add    $0x10,%esp
+ a77:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a7a:	74 11                	je     a8d <bigalloc+0x6d>
+  hp->s.size = nu;
+ a7c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ a7f:	e8 1c ff ff ff       	call   9a0 <bigfree>
+  return freep;
+ a84:	a1 b4 1a 00 00       	mov    0x1ab4,%eax
+      if((p = morecore(nunits)) == 0)
+ a89:	85 c0                	test   %eax,%eax
+ a8b:	75 cb                	jne    a58 <bigalloc+0x38>
+        return 0;
+  }
+}
+ a8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a90:	31 d2                	xor    %edx,%edx
+}
+ a92:	5b                   	pop    %ebx
+ a93:	89 d0                	mov    %edx,%eax
+ a95:	5e                   	pop    %esi
+ a96:	5f                   	pop    %edi
+ a97:	5d                   	pop    %ebp
+ a98:	c3                   	ret
+ a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ aa0:	39 cf                	cmp    %ecx,%edi
+ aa2:	74 4c                	je     af0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ aa4:	29 f9                	sub    %edi,%ecx
+ aa6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ aa9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ aac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ aaf:	a3 b4 1a 00 00       	mov    %eax,0x1ab4
+}
+ ab4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ab7:	89 d0                	mov    %edx,%eax
+ ab9:	5b                   	pop    %ebx
+ aba:	5e                   	pop    %esi
+ abb:	5f                   	pop    %edi
+ abc:	5d                   	pop    %ebp
+ abd:	c3                   	ret
+ abe:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ ac0:	c7 05 b4 1a 00 00 b8 	movl   $0x1ab8,0x1ab4
+ ac7:	1a 00 00 
+    base.s.size = 0;
+ aca:	ba b8 1a 00 00       	mov    $0x1ab8,%edx
+    base.s.ptr = freep = prevp = &base;
+ acf:	c7 05 b8 1a 00 00 b8 	movl   $0x1ab8,0x1ab8
+ ad6:	1a 00 00 
+    base.s.size = 0;
+ ad9:	c7 05 bc 1a 00 00 00 	movl   $0x0,0x1abc
+ ae0:	00 00 00 
+    if(p->s.size >= nunits){
+ ae3:	e9 59 ff ff ff       	jmp    a41 <bigalloc+0x21>
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ af0:	8b 0a                	mov    (%edx),%ecx
+ af2:	89 08                	mov    %ecx,(%eax)
+ af4:	eb b9                	jmp    aaf <bigalloc+0x8f>
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b00 <free>:
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	53                   	push   %ebx
+ b04:	83 ec 04             	sub    $0x4,%esp
+ b07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ b0a:	85 c9                	test   %ecx,%ecx
+ b0c:	74 58                	je     b66 <free+0x66>
+  bp = (Header*)ap - 1;
+ b0e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+  asm volatile("lock; xchgl %0, %1" :
+ b11:	ba 01 00 00 00       	mov    $0x1,%edx
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+ b20:	89 d0                	mov    %edx,%eax
+ b22:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+  while(xchg(&locked, 1) != 0)
+ b29:	85 c0                	test   %eax,%eax
+ b2b:	75 f3                	jne    b20 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ b2d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ b30:	83 fa 40             	cmp    $0x40,%edx
+ b33:	77 3b                	ja     b70 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ b35:	83 fa 02             	cmp    $0x2,%edx
+ b38:	76 3f                	jbe    b79 <free+0x79>
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b40:	83 c0 01             	add    $0x1,%eax
+ b43:	39 14 85 40 0e 00 00 	cmp    %edx,0xe40(,%eax,4)
+ b4a:	72 f4                	jb     b40 <free+0x40>
+    bp->s.ptr = classfree[c];
+ b4c:	8b 14 85 80 1a 00 00 	mov    0x1a80(,%eax,4),%edx
+    classfree[c] = bp;
+ b53:	89 1c 85 80 1a 00 00 	mov    %ebx,0x1a80(,%eax,4)
+    bp->s.ptr = classfree[c];
+ b5a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ b5d:	31 c0                	xor    %eax,%eax
+ b5f:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+}
+ b66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b69:	c9                   	leave
+ b6a:	c3                   	ret
+ b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+    bigfree(bp);
+ b70:	89 d8                	mov    %ebx,%eax
+ b72:	e8 29 fe ff ff       	call   9a0 <bigfree>
+ b77:	eb e4                	jmp    b5d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ b79:	31 c0                	xor    %eax,%eax
+ b7b:	eb cf                	jmp    b4c <free+0x4c>
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b80 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b80:	55                   	push   %ebp
+ b81:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b86:	89 e5                	mov    %esp,%ebp
+ b88:	57                   	push   %edi
+ b89:	56                   	push   %esi
+ b8a:	53                   	push   %ebx
+ b8b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b91:	8d 50 07             	lea    0x7(%eax),%edx
+ b94:	c1 ea 03             	shr    $0x3,%edx
+ b97:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ ba0:	89 c8                	mov    %ecx,%eax
+ ba2:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+ ba9:	85 c0                	test   %eax,%eax
+ bab:	75 f3                	jne    ba0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ bad:	89 c3                	mov    %eax,%ebx
+ baf:	83 fa 40             	cmp    $0x40,%edx
+ bb2:	77 4c                	ja     c00 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ bb4:	be 02 00 00 00       	mov    $0x2,%esi
+ bb9:	83 fa 02             	cmp    $0x2,%edx
+ bbc:	76 10                	jbe    bce <malloc+0x4e>
+ bbe:	66 90                	xchg   %ax,%ax
+ bc0:	83 c3 01             	add    $0x1,%ebx
+ bc3:	8b 34 9d 40 0e 00 00 	mov    0xe40(,%ebx,4),%esi
+ bca:	39 d6                	cmp    %edx,%esi
+ bcc:	72 f2                	jb     bc0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ bce:	8b 14 9d 80 1a 00 00 	mov    0x1a80(,%ebx,4),%edx
+ bd5:	85 d2                	test   %edx,%edx
+ bd7:	74 47                	je     c20 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ bd9:	8b 3a                	mov    (%edx),%edi
+ bdb:	89 3c 9d 80 1a 00 00 	mov    %edi,0x1a80(,%ebx,4)
+ be2:	31 c0                	xor    %eax,%eax
+ be4:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ beb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ bee:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ bf1:	5b                   	pop    %ebx
+ bf2:	5e                   	pop    %esi
+ bf3:	5f                   	pop    %edi
+ bf4:	5d                   	pop    %ebp
+ bf5:	c3                   	ret
+ bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ c00:	89 d0                	mov    %edx,%eax
+ c02:	e8 19 fe ff ff       	call   a20 <bigalloc>
+ c07:	89 c2                	mov    %eax,%edx
+ c09:	89 d8                	mov    %ebx,%eax
+ c0b:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+  return p ? (void*)(p + 1) : 0;
+ c12:	85 d2                	test   %edx,%edx
+ c14:	75 d5                	jne    beb <malloc+0x6b>
+ c16:	31 c0                	xor    %eax,%eax
+}
+ c18:	83 c4 1c             	add    $0x1c,%esp
+ c1b:	5b                   	pop    %ebx
+ c1c:	5e                   	pop    %esi
+ c1d:	5f                   	pop    %edi
+ c1e:	5d                   	pop    %ebp
+ c1f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ c20:	b8 00 02 00 00       	mov    $0x200,%eax
+ c25:	e8 f6 fd ff ff       	call   a20 <bigalloc>
+ c2a:	85 c0                	test   %eax,%eax
+ c2c:	74 44                	je     c72 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c2e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ c35:	8b 14 9d 80 1a 00 00 	mov    0x1a80(,%ebx,4),%edx
+ c3c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ c3f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ c42:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ c48:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ c4b:	39 cf                	cmp    %ecx,%edi
+ c4d:	72 8a                	jb     bd9 <malloc+0x59>
+ c4f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ c52:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ c55:	8d 76 00             	lea    0x0(%esi),%esi
+ c58:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ c5a:	89 70 04             	mov    %esi,0x4(%eax)
+ c5d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c5f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ c61:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c63:	01 d8                	add    %ebx,%eax
+ c65:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ c68:	73 ee                	jae    c58 <malloc+0xd8>
+ c6a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ c6d:	e9 69 ff ff ff       	jmp    bdb <malloc+0x5b>
+ c72:	f0 87 05 60 1a 00 00 	lock xchg %eax,0x1a60
+  return p ? (void*)(p + 1) : 0;
+ c79:	31 c0                	xor    %eax,%eax
+ c7b:	eb 9b                	jmp    c18 <malloc+0x98>
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c80 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	56                   	push   %esi
+ c84:	53                   	push   %ebx
+ c85:	8b 45 08             	mov    0x8(%ebp),%eax
+ c88:	f7 65 0c             	mull   0xc(%ebp)
+ c8b:	70 33                	jo     cc0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ c8d:	83 ec 0c             	sub    $0xc,%esp
+ c90:	89 c3                	mov    %eax,%ebx
+ c92:	50                   	push   %eax
+ c93:	e8 e8 fe ff ff       	call   b80 <malloc>
+ c98:	83 c4 10             	add    $0x10,%esp
+ c9b:	89 c6                	mov    %eax,%esi
+ c9d:	85 c0                	test   %eax,%eax
+ c9f:	74 1f                	je     cc0 <calloc+0x40>
+    memset(p, 0, n);
+ ca1:	83 ec 04             	sub    $0x4,%esp
+ ca4:	53                   	push   %ebx
+ ca5:	6a 00                	push   $0x0
+ ca7:	50                   	push   %eax
+ ca8:	e8 23 f7 ff ff       	call   3d0 <memset>
+ cad:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ cb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cb3:	89 f0                	mov    %esi,%eax
+ cb5:	5b                   	pop    %ebx
+ cb6:	5e                   	pop    %esi
+ cb7:	5d                   	pop    %ebp
+ cb8:	c3                   	ret
+ cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ cc3:	31 f6                	xor    %esi,%esi
+}
+ cc5:	89 f0                	mov    %esi,%eax
+ cc7:	5b                   	pop    %ebx
+ cc8:	5e                   	pop    %esi
+ cc9:	5d                   	pop    %ebp
+ cca:	c3                   	ret
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+
+00000cd0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	57                   	push   %edi
+ cd4:	56                   	push   %esi
+ cd5:	53                   	push   %ebx
+ cd6:	83 ec 0c             	sub    $0xc,%esp
+ cd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ cdf:	85 db                	test   %ebx,%ebx
+ ce1:	74 55                	je     d38 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ce3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ce6:	89 de                	mov    %ebx,%esi
+ ce8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ cef:	39 c7                	cmp    %eax,%edi
+ cf1:	72 0d                	jb     d00 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cf6:	89 f0                	mov    %esi,%eax
+ cf8:	5b                   	pop    %ebx
+ cf9:	5e                   	pop    %esi
+ cfa:	5f                   	pop    %edi
+ cfb:	5d                   	pop    %ebp
+ cfc:	c3                   	ret
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ d00:	83 ec 0c             	sub    $0xc,%esp
+ d03:	50                   	push   %eax
+ d04:	e8 77 fe ff ff       	call   b80 <malloc>
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	89 c6                	mov    %eax,%esi
+ d0e:	85 c0                	test   %eax,%eax
+ d10:	74 e1                	je     cf3 <realloc+0x23>
+  memmove(p, ap, have);
+ d12:	83 ec 04             	sub    $0x4,%esp
+ d15:	57                   	push   %edi
+ d16:	53                   	push   %ebx
+ d17:	50                   	push   %eax
+ d18:	e8 03 f8 ff ff       	call   520 <memmove>
+  free(ap);
+ d1d:	89 1c 24             	mov    %ebx,(%esp)
+ d20:	e8 db fd ff ff       	call   b00 <free>
+  return p;
+ d25:	83 c4 10             	add    $0x10,%esp
+}
+ d28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d2b:	89 f0                	mov    %esi,%eax
+ d2d:	5b                   	pop    %ebx
+ d2e:	5e                   	pop    %esi
+ d2f:	5f                   	pop    %edi
+ d30:	5d                   	pop    %ebp
+ d31:	c3                   	ret
+ d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ d38:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d3e:	5b                   	pop    %ebx
+ d3f:	5e                   	pop    %esi
+ d40:	5f                   	pop    %edi
+ d41:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d42:	e9 39 fe ff ff       	jmp    b80 <malloc>
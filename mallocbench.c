@@ -0,0 +1,100 @@
+// Allocator benchmark: a random mix of malloc, free and realloc
+// over a pool of live blocks, mostly small with some large ones.
+// Prints the average cycles per call of each.
+// usage: mallocbench [nops]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define NSLOT 512
+
+char *slot[NSLOT];
+uint seed = 1;
+
+uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// A request size: mostly under 256 bytes, some up to 2KB,
+// and a few up to 16KB.
+uint
+randsize(void)
+{
+  uint r = rand() % 100;
+
+  if(r < 80)
+    return 1 + rand() % 256;
+  if(r < 95)
+    return 256 + rand() % 1792;
+  return 2048 + rand() % 14336;
+}
+
+void
+report(char *name, uint cycles, uint n)
+{
+  printf(1, "%s\t%d calls\t%d cycles/call\n", name, n, n ? cycles / n : 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, k, nops;
+  uint sz, t;
+  uint nmalloc, nfree, nrealloc;
+  uint cmalloc, cfree, crealloc;
+  char *p;
+
+  nops = argc > 1 ? atoi(argv[1]) : 50000;
+  nmalloc = nfree = nrealloc = 0;
+  cmalloc = cfree = crealloc = 0;
+
+  for(i = 0; i < nops; i++){
+    k = rand() % NSLOT;
+    if(slot[k] == 0){
+      sz = randsize();
+      t = rdtsc();
+      p = malloc(sz);
+      cmalloc += (uint)rdtsc() - t;
+      nmalloc++;
+      if(p == 0){
+        printf(2, "mallocbench: out of memory\n");
+        exit();
+      }
+      p[0] = p[sz-1] = k;
+      slot[k] = p;
+    } else if(i % 8 == 0){
+      sz = randsize();
+      t = rdtsc();
+      p = realloc(slot[k], sz);
+      crealloc += (uint)rdtsc() - t;
+      nrealloc++;
+      if(p == 0){
+        printf(2, "mallocbench: out of memory\n");
+        exit();
+      }
+      if(p[0] != (char)k){
+        printf(2, "mallocbench: realloc lost data\n");
+        exit();
+      }
+      slot[k] = p;
+    } else {
+      t = rdtsc();
+      free(slot[k]);
+      cfree += (uint)rdtsc() - t;
+      nfree++;
+      slot[k] = 0;
+    }
+  }
+  for(k = 0; k < NSLOT; k++)
+    free(slot[k]);
+
+  report("malloc", cmalloc, nmalloc);
+  report("free", cfree, nfree);
+  report("realloc", crealloc, nrealloc);
+  exit();
+}
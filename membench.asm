@@ -0,0 +1,1860 @@
+
+_membench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  int i, op, n, cycles;
+
+  printf(1, "bytes/cycle\nsize");
+  for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++)
+  10:	31 db                	xor    %ebx,%ebx
+{
+  12:	51                   	push   %ecx
+  13:	83 ec 20             	sub    $0x20,%esp
+  printf(1, "bytes/cycle\nsize");
+  16:	68 28 0c 00 00       	push   $0xc28
+  1b:	6a 01                	push   $0x1
+  1d:	e8 8e 06 00 00       	call   6b0 <printf>
+  22:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\t%s", opname[op]);
+  25:	83 ec 04             	sub    $0x4,%esp
+  28:	ff 34 9d e8 10 00 00 	push   0x10e8(,%ebx,4)
+  for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++)
+  2f:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "\t%s", opname[op]);
+  32:	68 39 0c 00 00       	push   $0xc39
+  37:	6a 01                	push   $0x1
+  39:	e8 72 06 00 00       	call   6b0 <printf>
+  for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	83 fb 04             	cmp    $0x4,%ebx
+  44:	75 df                	jne    25 <main+0x25>
+  printf(1, "\n");
+  46:	83 ec 08             	sub    $0x8,%esp
+
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+  49:	31 ff                	xor    %edi,%edi
+  printf(1, "\n");
+  4b:	68 50 0c 00 00       	push   $0xc50
+  50:	6a 01                	push   $0x1
+  52:	e8 59 06 00 00       	call   6b0 <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+    n = sizes[i];
+  5a:	8b 34 bd d4 10 00 00 	mov    0x10d4(,%edi,4),%esi
+    printf(1, "%d", n);
+  61:	83 ec 04             	sub    $0x4,%esp
+    for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++){
+  64:	31 db                	xor    %ebx,%ebx
+    n = sizes[i];
+  66:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    printf(1, "%d", n);
+  69:	56                   	push   %esi
+  6a:	68 25 0c 00 00       	push   $0xc25
+  6f:	6a 01                	push   $0x1
+  71:	e8 3a 06 00 00       	call   6b0 <printf>
+      if((cycles = membench(op, buf, n, TOTAL / n)) < 0){
+  76:	b8 00 00 10 00       	mov    $0x100000,%eax
+  7b:	31 d2                	xor    %edx,%edx
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+  7d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+      if((cycles = membench(op, buf, n, TOTAL / n)) < 0){
+  80:	f7 fe                	idiv   %esi
+  82:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+  85:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+      if((cycles = membench(op, buf, n, TOTAL / n)) < 0){
+  8a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8d:	ff 75 e0             	push   -0x20(%ebp)
+  90:	ff 75 e4             	push   -0x1c(%ebp)
+  93:	68 00 11 00 00       	push   $0x1100
+  98:	53                   	push   %ebx
+  99:	e8 cd 04 00 00       	call   56b <membench>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	89 c7                	mov    %eax,%edi
+  a3:	85 c0                	test   %eax,%eax
+  a5:	0f 88 92 00 00 00    	js     13d <main+0x13d>
+        printf(2, "membench: %s failed\n", opname[op]);
+        exit();
+      }
+      printf(1, "\t");
+  ab:	83 ec 08             	sub    $0x8,%esp
+  ae:	68 52 0c 00 00       	push   $0xc52
+  b3:	6a 01                	push   $0x1
+  b5:	e8 f6 05 00 00       	call   6b0 <printf>
+  r = bytes * 100 / cycles;
+  ba:	85 ff                	test   %edi,%edi
+  bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  c1:	0f 44 f8             	cmove  %eax,%edi
+  c4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+  c9:	31 d2                	xor    %edx,%edx
+    for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++){
+  cb:	83 c3 01             	add    $0x1,%ebx
+  r = bytes * 100 / cycles;
+  ce:	f7 f7                	div    %edi
+  d0:	89 c7                	mov    %eax,%edi
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+  d2:	f7 e6                	mul    %esi
+  d4:	89 d1                	mov    %edx,%ecx
+  d6:	89 fa                	mov    %edi,%edx
+  d8:	c1 e9 03             	shr    $0x3,%ecx
+  db:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+  de:	01 c0                	add    %eax,%eax
+  e0:	29 c2                	sub    %eax,%edx
+  e2:	89 c8                	mov    %ecx,%eax
+  e4:	89 14 24             	mov    %edx,(%esp)
+  e7:	f7 e6                	mul    %esi
+  e9:	c1 ea 03             	shr    $0x3,%edx
+  ec:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  ef:	01 c0                	add    %eax,%eax
+  f1:	29 c1                	sub    %eax,%ecx
+  f3:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  f8:	f7 e7                	mul    %edi
+  fa:	51                   	push   %ecx
+  fb:	c1 ea 05             	shr    $0x5,%edx
+  fe:	52                   	push   %edx
+  ff:	68 20 0c 00 00       	push   $0xc20
+ 104:	6a 01                	push   $0x1
+ 106:	e8 a5 05 00 00       	call   6b0 <printf>
+    for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++){
+ 10b:	83 c4 20             	add    $0x20,%esp
+ 10e:	83 fb 04             	cmp    $0x4,%ebx
+ 111:	0f 85 76 ff ff ff    	jne    8d <main+0x8d>
+      rate(TOTAL, cycles);
+    }
+    printf(1, "\n");
+ 117:	83 ec 08             	sub    $0x8,%esp
+ 11a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+ 11d:	68 50 0c 00 00       	push   $0xc50
+ 122:	6a 01                	push   $0x1
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+    printf(1, "\n");
+ 127:	e8 84 05 00 00       	call   6b0 <printf>
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+ 12c:	83 c4 10             	add    $0x10,%esp
+ 12f:	83 ff 05             	cmp    $0x5,%edi
+ 132:	0f 85 22 ff ff ff    	jne    5a <main+0x5a>
+  }
+  exit();
+ 138:	e8 d6 02 00 00       	call   413 <exit>
+        printf(2, "membench: %s failed\n", opname[op]);
+ 13d:	50                   	push   %eax
+ 13e:	ff 34 9d e8 10 00 00 	push   0x10e8(,%ebx,4)
+ 145:	68 3d 0c 00 00       	push   $0xc3d
+ 14a:	6a 02                	push   $0x2
+ 14c:	e8 5f 05 00 00       	call   6b0 <printf>
+        exit();
+ 151:	e8 bd 02 00 00       	call   413 <exit>
+ 156:	66 90                	xchg   %ax,%ax
+ 158:	66 90                	xchg   %ax,%ax
+ 15a:	66 90                	xchg   %ax,%ax
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <rate>:
+{
+ 160:	55                   	push   %ebp
+  r = bytes * 100 / cycles;
+ 161:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 166:	89 e5                	mov    %esp,%ebp
+ 168:	56                   	push   %esi
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+ 169:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 16e:	53                   	push   %ebx
+ 16f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  r = bytes * 100 / cycles;
+ 172:	6b 45 08 64          	imul   $0x64,0x8(%ebp),%eax
+ 176:	85 db                	test   %ebx,%ebx
+ 178:	0f 44 da             	cmove  %edx,%ebx
+ 17b:	31 d2                	xor    %edx,%edx
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+ 17d:	83 ec 0c             	sub    $0xc,%esp
+  r = bytes * 100 / cycles;
+ 180:	f7 f3                	div    %ebx
+ 182:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+ 184:	f7 e6                	mul    %esi
+ 186:	89 d3                	mov    %edx,%ebx
+ 188:	89 ca                	mov    %ecx,%edx
+ 18a:	c1 eb 03             	shr    $0x3,%ebx
+ 18d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 190:	01 c0                	add    %eax,%eax
+ 192:	29 c2                	sub    %eax,%edx
+ 194:	89 d8                	mov    %ebx,%eax
+ 196:	52                   	push   %edx
+ 197:	f7 e6                	mul    %esi
+ 199:	c1 ea 03             	shr    $0x3,%edx
+ 19c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 19f:	01 c0                	add    %eax,%eax
+ 1a1:	29 c3                	sub    %eax,%ebx
+ 1a3:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 1a8:	f7 e1                	mul    %ecx
+ 1aa:	53                   	push   %ebx
+ 1ab:	c1 ea 05             	shr    $0x5,%edx
+ 1ae:	52                   	push   %edx
+ 1af:	68 20 0c 00 00       	push   $0xc20
+ 1b4:	6a 01                	push   $0x1
+ 1b6:	e8 f5 04 00 00       	call   6b0 <printf>
+}
+ 1bb:	83 c4 20             	add    $0x20,%esp
+ 1be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1c1:	5b                   	pop    %ebx
+ 1c2:	5e                   	pop    %esi
+ 1c3:	5d                   	pop    %ebp
+ 1c4:	c3                   	ret
+ 1c5:	66 90                	xchg   %ax,%ax
+ 1c7:	66 90                	xchg   %ax,%ax
+ 1c9:	66 90                	xchg   %ax,%ax
+ 1cb:	66 90                	xchg   %ax,%ax
+ 1cd:	66 90                	xchg   %ax,%ax
+ 1cf:	90                   	nop
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 1e 01 00 00       	call   42b <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <exit>:
+SYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <exec>:
+SYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <setpriority>:
+SYSCALL(setpriority)
+ 4eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getcpustats>:
+SYSCALL(getcpustats)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <setscheduler>:
+SYSCALL(setscheduler)
+ 503:	b8 20 00 00 00       	mov    $0x20,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 50b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getscheduler>:
+SYSCALL(getscheduler)
+ 513:	b8 22 00 00 00       	mov    $0x22,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <splice>:
+SYSCALL(splice)
+ 51b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <readv>:
+SYSCALL(readv)
+ 523:	b8 24 00 00 00       	mov    $0x24,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <writev>:
+SYSCALL(writev)
+ 52b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <pread>:
+SYSCALL(pread)
+ 533:	b8 26 00 00 00       	mov    $0x26,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <pwrite>:
+SYSCALL(pwrite)
+ 53b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getlogstat>:
+SYSCALL(getlogstat)
+ 543:	b8 28 00 00 00       	mov    $0x28,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mount>:
+SYSCALL(mount)
+ 54b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <umount>:
+SYSCALL(umount)
+ 553:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <munmap>:
+SYSCALL(munmap)
+ 563:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <membench>:
+SYSCALL(membench)
+ 56b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <getlockstat>:
+SYSCALL(getlockstat)
+ 573:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <lockbench>:
+SYSCALL(lockbench)
+ 57b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <prof>:
+SYSCALL(prof)
+ 583:	b8 30 00 00 00       	mov    $0x30,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <tracectl>:
+SYSCALL(tracectl)
+ 58b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <traceread>:
+SYSCALL(traceread)
+ 593:	b8 32 00 00 00       	mov    $0x32,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <getsysstat>:
+SYSCALL(getsysstat)
+ 59b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 5a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <getschedwait>:
+SYSCALL(getschedwait)
+ 5ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 5b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <dllock>:
+SYSCALL(dllock)
+ 5bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 5c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 5cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <clone>:
+SYSCALL(clone)
+ 5d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <join>:
+SYSCALL(join)
+ 5db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <futex>:
+SYSCALL(futex)
+ 5e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <shmat>:
+SYSCALL(shmat)
+ 5eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <shmdt>:
+SYSCALL(shmdt)
+ 5f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <poll>:
+SYSCALL(poll)
+ 5fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+ 603:	66 90                	xchg   %ax,%ax
+ 605:	66 90                	xchg   %ax,%ax
+ 607:	66 90                	xchg   %ax,%ax
+ 609:	66 90                	xchg   %ax,%ax
+ 60b:	66 90                	xchg   %ax,%ax
+ 60d:	66 90                	xchg   %ax,%ax
+ 60f:	90                   	nop
+
+00000610 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 618:	89 d1                	mov    %edx,%ecx
+{
+ 61a:	83 ec 3c             	sub    $0x3c,%esp
+ 61d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 620:	85 d2                	test   %edx,%edx
+ 622:	0f 89 80 00 00 00    	jns    6a8 <printint+0x98>
+ 628:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 62c:	74 7a                	je     6a8 <printint+0x98>
+    x = -xx;
+ 62e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 630:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 635:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 638:	31 f6                	xor    %esi,%esi
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 640:	89 c8                	mov    %ecx,%eax
+ 642:	31 d2                	xor    %edx,%edx
+ 644:	89 f7                	mov    %esi,%edi
+ 646:	f7 f3                	div    %ebx
+ 648:	8d 76 01             	lea    0x1(%esi),%esi
+ 64b:	0f b6 92 d4 0c 00 00 	movzbl 0xcd4(%edx),%edx
+ 652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 656:	89 ca                	mov    %ecx,%edx
+ 658:	89 c1                	mov    %eax,%ecx
+ 65a:	39 da                	cmp    %ebx,%edx
+ 65c:	73 e2                	jae    640 <printint+0x30>
+  if(neg)
+ 65e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 661:	85 c0                	test   %eax,%eax
+ 663:	74 07                	je     66c <printint+0x5c>
+    buf[i++] = '-';
+ 665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 66a:	89 f7                	mov    %esi,%edi
+ 66c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 66f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 672:	01 df                	add    %ebx,%edi
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 678:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 681:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 684:	6a 01                	push   $0x1
+ 686:	50                   	push   %eax
+ 687:	56                   	push   %esi
+ 688:	e8 a6 fd ff ff       	call   433 <write>
+  while(--i >= 0)
+ 68d:	89 f8                	mov    %edi,%eax
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	83 ef 01             	sub    $0x1,%edi
+ 695:	39 d8                	cmp    %ebx,%eax
+ 697:	75 df                	jne    678 <printint+0x68>
+}
+ 699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69c:	5b                   	pop    %ebx
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+ 6aa:	eb 89                	jmp    635 <printint+0x25>
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c2:	83 c6 01             	add    $0x1,%esi
+ 6c5:	84 db                	test   %bl,%bl
+ 6c7:	74 67                	je     730 <printf+0x80>
+ 6c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6cc:	31 d2                	xor    %edx,%edx
+ 6ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6d1:	eb 34                	jmp    707 <printf+0x57>
+ 6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d7:	90                   	nop
+ 6d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6e0:	83 f8 25             	cmp    $0x25,%eax
+ 6e3:	74 18                	je     6fd <printf+0x4d>
+  write(fd, &c, 1);
+ 6e5:	83 ec 04             	sub    $0x4,%esp
+ 6e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	50                   	push   %eax
+ 6f1:	57                   	push   %edi
+ 6f2:	e8 3c fd ff ff       	call   433 <write>
+ 6f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 700:	83 c6 01             	add    $0x1,%esi
+ 703:	84 db                	test   %bl,%bl
+ 705:	74 29                	je     730 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 707:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 ca                	je     6d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 70e:	83 fa 25             	cmp    $0x25,%edx
+ 711:	75 ea                	jne    6fd <printf+0x4d>
+      if(c == 'd'){
+ 713:	83 f8 25             	cmp    $0x25,%eax
+ 716:	0f 84 24 01 00 00    	je     840 <printf+0x190>
+ 71c:	83 e8 63             	sub    $0x63,%eax
+ 71f:	83 f8 15             	cmp    $0x15,%eax
+ 722:	77 1c                	ja     740 <printf+0x90>
+ 724:	ff 24 85 7c 0c 00 00 	jmp    *0xc7c(,%eax,4)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 746:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 74a:	6a 01                	push   $0x1
+ 74c:	52                   	push   %edx
+ 74d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 750:	57                   	push   %edi
+ 751:	e8 dd fc ff ff       	call   433 <write>
+ 756:	83 c4 0c             	add    $0xc,%esp
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75c:	6a 01                	push   $0x1
+ 75e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 761:	52                   	push   %edx
+ 762:	57                   	push   %edi
+ 763:	e8 cb fc ff ff       	call   433 <write>
+        putc(fd, c);
+ 768:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76b:	31 d2                	xor    %edx,%edx
+ 76d:	eb 8e                	jmp    6fd <printf+0x4d>
+ 76f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 00                	push   $0x0
+ 77f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 781:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 784:	e8 87 fe ff ff       	call   610 <printint>
+        ap++;
+ 789:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 78c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 67 ff ff ff       	jmp    6fd <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7ab:	85 db                	test   %ebx,%ebx
+ 7ad:	0f 84 9d 00 00 00    	je     850 <printf+0x1a0>
+        while(*s != 0){
+ 7b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	0f 84 3d ff ff ff    	je     6fd <printf+0x4d>
+ 7c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7c6:	89 de                	mov    %ebx,%esi
+ 7c8:	89 d3                	mov    %edx,%ebx
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	53                   	push   %ebx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 51 fc ff ff       	call   433 <write>
+        while(*s != 0){
+ 7e2:	0f b6 06             	movzbl (%esi),%eax
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	75 e4                	jne    7d0 <printf+0x120>
+      state = 0;
+ 7ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 07 ff ff ff       	jmp    6fd <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 01                	push   $0x1
+ 80f:	e9 6b ff ff ff       	jmp    77f <printf+0xcf>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 818:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 821:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 823:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 826:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	52                   	push   %edx
+ 82c:	57                   	push   %edi
+ 82d:	e8 01 fc ff ff       	call   433 <write>
+        ap++;
+ 832:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 835:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 838:	31 d2                	xor    %edx,%edx
+ 83a:	e9 be fe ff ff       	jmp    6fd <printf+0x4d>
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 846:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 849:	6a 01                	push   $0x1
+ 84b:	e9 11 ff ff ff       	jmp    761 <printf+0xb1>
+ 850:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 855:	bb 74 0c 00 00       	mov    $0xc74,%ebx
+ 85a:	e9 61 ff ff ff       	jmp    7c0 <printf+0x110>
+ 85f:	90                   	nop
+
+00000860 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 863:	a1 54 21 00 00       	mov    0x2154,%eax
+{
+ 868:	89 e5                	mov    %esp,%ebp
+ 86a:	56                   	push   %esi
+ 86b:	53                   	push   %ebx
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 870:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 872:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 874:	39 ca                	cmp    %ecx,%edx
+ 876:	73 30                	jae    8a8 <bigfree+0x48>
+ 878:	39 c1                	cmp    %eax,%ecx
+ 87a:	72 04                	jb     880 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87c:	39 c2                	cmp    %eax,%edx
+ 87e:	72 f0                	jb     870 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 880:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 883:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 886:	39 f0                	cmp    %esi,%eax
+ 888:	74 26                	je     8b0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 88a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 88c:	8b 42 04             	mov    0x4(%edx),%eax
+ 88f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 892:	39 d9                	cmp    %ebx,%ecx
+ 894:	74 30                	je     8c6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 896:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 898:	5b                   	pop    %ebx
+  freep = p;
+ 899:	89 15 54 21 00 00    	mov    %edx,0x2154
+}
+ 89f:	5e                   	pop    %esi
+ 8a0:	5d                   	pop    %ebp
+ 8a1:	c3                   	ret
+ 8a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a8:	39 c1                	cmp    %eax,%ecx
+ 8aa:	72 d0                	jb     87c <bigfree+0x1c>
+ 8ac:	eb c2                	jmp    870 <bigfree+0x10>
+ 8ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8b0:	03 58 04             	add    0x4(%eax),%ebx
+ 8b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b6:	8b 02                	mov    (%edx),%eax
+ 8b8:	8b 00                	mov    (%eax),%eax
+ 8ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 8bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 8bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8c2:	39 d9                	cmp    %ebx,%ecx
+ 8c4:	75 d0                	jne    896 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 8c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 8c9:	89 15 54 21 00 00    	mov    %edx,0x2154
+    p->s.size += bp->s.size;
+ 8cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8d2:	8b 09                	mov    (%ecx),%ecx
+ 8d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 8d6:	5b                   	pop    %ebx
+ 8d7:	5e                   	pop    %esi
+ 8d8:	5d                   	pop    %ebp
+ 8d9:	c3                   	ret
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008e0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	89 c7                	mov    %eax,%edi
+ 8e6:	56                   	push   %esi
+ 8e7:	53                   	push   %ebx
+ 8e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 8eb:	a1 54 21 00 00       	mov    0x2154,%eax
+ 8f0:	85 c0                	test   %eax,%eax
+ 8f2:	0f 84 88 00 00 00    	je     980 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 8fd:	39 f9                	cmp    %edi,%ecx
+ 8ff:	73 5f                	jae    960 <bigalloc+0x80>
+  if(nu < 4096)
+ 901:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 906:	39 df                	cmp    %ebx,%edi
+ 908:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 90b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 912:	eb 0d                	jmp    921 <bigalloc+0x41>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 918:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 91a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 91d:	39 f9                	cmp    %edi,%ecx
+ 91f:	73 3f                	jae    960 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 921:	89 d0                	mov    %edx,%eax
+ 923:	39 15 54 21 00 00    	cmp    %edx,0x2154
+ 929:	75 ed                	jne    918 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 92b:	83 ec 0c             	sub    $0xc,%esp
+ 92e:	56                   	push   %esi
+ 92f:	e8 67 fb ff ff       	call   49b <sbrk>
+  if(p == (char*)-1)
+ 934:	83 c4 10             	add    $0x10,%esp
+ 937:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 93a:	74 11                	je     94d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 93c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 93f:	e8 1c ff ff ff       	call   860 <bigfree>
+  return freep;
+ 944:	a1 54 21 00 00       	mov    0x2154,%eax
+      if((p = morecore(nunits)) == 0)
+ 949:	85 c0                	test   %eax,%eax
+ 94b:	75 cb                	jne    918 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 94d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 950:	31 d2                	xor    %edx,%edx
+}
+ 952:	5b                   	pop    %ebx
+ 953:	89 d0                	mov    %edx,%eax
+ 955:	5e                   	pop    %esi
+ 956:	5f                   	pop    %edi
+ 957:	5d                   	pop    %ebp
+ 958:	c3                   	ret
+ 959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 960:	39 cf                	cmp    %ecx,%edi
+ 962:	74 4c                	je     9b0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 964:	29 f9                	sub    %edi,%ecx
+ 966:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 969:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 96c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 96f:	a3 54 21 00 00       	mov    %eax,0x2154
+}
+ 974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 977:	89 d0                	mov    %edx,%eax
+ 979:	5b                   	pop    %ebx
+ 97a:	5e                   	pop    %esi
+ 97b:	5f                   	pop    %edi
+ 97c:	5d                   	pop    %ebp
+ 97d:	c3                   	ret
+ 97e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 980:	c7 05 54 21 00 00 58 	movl   $0x2158,0x2154
+ 987:	21 00 00 
+    base.s.size = 0;
+ 98a:	ba 58 21 00 00       	mov    $0x2158,%edx
+    base.s.ptr = freep = prevp = &base;
+ 98f:	c7 05 58 21 00 00 58 	movl   $0x2158,0x2158
+ 996:	21 00 00 
+    base.s.size = 0;
+ 999:	c7 05 5c 21 00 00 00 	movl   $0x0,0x215c
+ 9a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9a3:	e9 59 ff ff ff       	jmp    901 <bigalloc+0x21>
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9b0:	8b 0a                	mov    (%edx),%ecx
+ 9b2:	89 08                	mov    %ecx,(%eax)
+ 9b4:	eb b9                	jmp    96f <bigalloc+0x8f>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <free>:
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	53                   	push   %ebx
+ 9c4:	83 ec 04             	sub    $0x4,%esp
+ 9c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 9ca:	85 c9                	test   %ecx,%ecx
+ 9cc:	74 58                	je     a26 <free+0x66>
+  bp = (Header*)ap - 1;
+ 9ce:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 9d1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 9e0:	89 d0                	mov    %edx,%eax
+ 9e2:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+  while(xchg(&locked, 1) != 0)
+ 9e9:	85 c0                	test   %eax,%eax
+ 9eb:	75 f3                	jne    9e0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 9ed:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 9f0:	83 fa 40             	cmp    $0x40,%edx
+ 9f3:	77 3b                	ja     a30 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 9f5:	83 fa 02             	cmp    $0x2,%edx
+ 9f8:	76 3f                	jbe    a39 <free+0x79>
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a00:	83 c0 01             	add    $0x1,%eax
+ a03:	39 14 85 00 0d 00 00 	cmp    %edx,0xd00(,%eax,4)
+ a0a:	72 f4                	jb     a00 <free+0x40>
+    bp->s.ptr = classfree[c];
+ a0c:	8b 14 85 20 21 00 00 	mov    0x2120(,%eax,4),%edx
+    classfree[c] = bp;
+ a13:	89 1c 85 20 21 00 00 	mov    %ebx,0x2120(,%eax,4)
+    bp->s.ptr = classfree[c];
+ a1a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ a1d:	31 c0                	xor    %eax,%eax
+ a1f:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+}
+ a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a29:	c9                   	leave
+ a2a:	c3                   	ret
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+    bigfree(bp);
+ a30:	89 d8                	mov    %ebx,%eax
+ a32:	e8 29 fe ff ff       	call   860 <bigfree>
+ a37:	eb e4                	jmp    a1d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ a39:	31 c0                	xor    %eax,%eax
+ a3b:	eb cf                	jmp    a0c <free+0x4c>
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a40:	55                   	push   %ebp
+ a41:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a46:	89 e5                	mov    %esp,%ebp
+ a48:	57                   	push   %edi
+ a49:	56                   	push   %esi
+ a4a:	53                   	push   %ebx
+ a4b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a51:	8d 50 07             	lea    0x7(%eax),%edx
+ a54:	c1 ea 03             	shr    $0x3,%edx
+ a57:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+ a69:	85 c0                	test   %eax,%eax
+ a6b:	75 f3                	jne    a60 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ a6d:	89 c3                	mov    %eax,%ebx
+ a6f:	83 fa 40             	cmp    $0x40,%edx
+ a72:	77 4c                	ja     ac0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ a74:	be 02 00 00 00       	mov    $0x2,%esi
+ a79:	83 fa 02             	cmp    $0x2,%edx
+ a7c:	76 10                	jbe    a8e <malloc+0x4e>
+ a7e:	66 90                	xchg   %ax,%ax
+ a80:	83 c3 01             	add    $0x1,%ebx
+ a83:	8b 34 9d 00 0d 00 00 	mov    0xd00(,%ebx,4),%esi
+ a8a:	39 d6                	cmp    %edx,%esi
+ a8c:	72 f2                	jb     a80 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ a8e:	8b 14 9d 20 21 00 00 	mov    0x2120(,%ebx,4),%edx
+ a95:	85 d2                	test   %edx,%edx
+ a97:	74 47                	je     ae0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ a99:	8b 3a                	mov    (%edx),%edi
+ a9b:	89 3c 9d 20 21 00 00 	mov    %edi,0x2120(,%ebx,4)
+ aa2:	31 c0                	xor    %eax,%eax
+ aa4:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ aab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ aae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ ab1:	5b                   	pop    %ebx
+ ab2:	5e                   	pop    %esi
+ ab3:	5f                   	pop    %edi
+ ab4:	5d                   	pop    %ebp
+ ab5:	c3                   	ret
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ ac0:	89 d0                	mov    %edx,%eax
+ ac2:	e8 19 fe ff ff       	call   8e0 <bigalloc>
+ ac7:	89 c2                	mov    %eax,%edx
+ ac9:	89 d8                	mov    %ebx,%eax
+ acb:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+  return p ? (void*)(p + 1) : 0;
+ ad2:	85 d2                	test   %edx,%edx
+ ad4:	75 d5                	jne    aab <malloc+0x6b>
+ ad6:	31 c0                	xor    %eax,%eax
+}
+ ad8:	83 c4 1c             	add    $0x1c,%esp
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5f                   	pop    %edi
+ ade:	5d                   	pop    %ebp
+ adf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ ae0:	b8 00 02 00 00       	mov    $0x200,%eax
+ ae5:	e8 f6 fd ff ff       	call   8e0 <bigalloc>
+ aea:	85 c0                	test   %eax,%eax
+ aec:	74 44                	je     b32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ aee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ af5:	8b 14 9d 20 21 00 00 	mov    0x2120(,%ebx,4),%edx
+ afc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ aff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ b02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ b08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ b0b:	39 cf                	cmp    %ecx,%edi
+ b0d:	72 8a                	jb     a99 <malloc+0x59>
+ b0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ b12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ b15:	8d 76 00             	lea    0x0(%esi),%esi
+ b18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ b1a:	89 70 04             	mov    %esi,0x4(%eax)
+ b1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ b21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b23:	01 d8                	add    %ebx,%eax
+ b25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ b28:	73 ee                	jae    b18 <malloc+0xd8>
+ b2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ b2d:	e9 69 ff ff ff       	jmp    a9b <malloc+0x5b>
+ b32:	f0 87 05 00 21 00 00 	lock xchg %eax,0x2100
+  return p ? (void*)(p + 1) : 0;
+ b39:	31 c0                	xor    %eax,%eax
+ b3b:	eb 9b                	jmp    ad8 <malloc+0x98>
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	56                   	push   %esi
+ b44:	53                   	push   %ebx
+ b45:	8b 45 08             	mov    0x8(%ebp),%eax
+ b48:	f7 65 0c             	mull   0xc(%ebp)
+ b4b:	70 33                	jo     b80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ b4d:	83 ec 0c             	sub    $0xc,%esp
+ b50:	89 c3                	mov    %eax,%ebx
+ b52:	50                   	push   %eax
+ b53:	e8 e8 fe ff ff       	call   a40 <malloc>
+ b58:	83 c4 10             	add    $0x10,%esp
+ b5b:	89 c6                	mov    %eax,%esi
+ b5d:	85 c0                	test   %eax,%eax
+ b5f:	74 1f                	je     b80 <calloc+0x40>
+    memset(p, 0, n);
+ b61:	83 ec 04             	sub    $0x4,%esp
+ b64:	53                   	push   %ebx
+ b65:	6a 00                	push   $0x0
+ b67:	50                   	push   %eax
+ b68:	e8 23 f7 ff ff       	call   290 <memset>
+ b6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b73:	89 f0                	mov    %esi,%eax
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5d                   	pop    %ebp
+ b78:	c3                   	ret
+ b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b83:	31 f6                	xor    %esi,%esi
+}
+ b85:	89 f0                	mov    %esi,%eax
+ b87:	5b                   	pop    %ebx
+ b88:	5e                   	pop    %esi
+ b89:	5d                   	pop    %ebp
+ b8a:	c3                   	ret
+ b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+
+00000b90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	57                   	push   %edi
+ b94:	56                   	push   %esi
+ b95:	53                   	push   %ebx
+ b96:	83 ec 0c             	sub    $0xc,%esp
+ b99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b9f:	85 db                	test   %ebx,%ebx
+ ba1:	74 55                	je     bf8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ba3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ba6:	89 de                	mov    %ebx,%esi
+ ba8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ baf:	39 c7                	cmp    %eax,%edi
+ bb1:	72 0d                	jb     bc0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ bb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bb6:	89 f0                	mov    %esi,%eax
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ bc0:	83 ec 0c             	sub    $0xc,%esp
+ bc3:	50                   	push   %eax
+ bc4:	e8 77 fe ff ff       	call   a40 <malloc>
+ bc9:	83 c4 10             	add    $0x10,%esp
+ bcc:	89 c6                	mov    %eax,%esi
+ bce:	85 c0                	test   %eax,%eax
+ bd0:	74 e1                	je     bb3 <realloc+0x23>
+  memmove(p, ap, have);
+ bd2:	83 ec 04             	sub    $0x4,%esp
+ bd5:	57                   	push   %edi
+ bd6:	53                   	push   %ebx
+ bd7:	50                   	push   %eax
+ bd8:	e8 03 f8 ff ff       	call   3e0 <memmove>
+  free(ap);
+ bdd:	89 1c 24             	mov    %ebx,(%esp)
+ be0:	e8 db fd ff ff       	call   9c0 <free>
+  return p;
+ be5:	83 c4 10             	add    $0x10,%esp
+}
+ be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ beb:	89 f0                	mov    %esi,%eax
+ bed:	5b                   	pop    %ebx
+ bee:	5e                   	pop    %esi
+ bef:	5f                   	pop    %edi
+ bf0:	5d                   	pop    %ebp
+ bf1:	c3                   	ret
+ bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ bf8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bfe:	5b                   	pop    %ebx
+ bff:	5e                   	pop    %esi
+ c00:	5f                   	pop    %edi
+ c01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c02:	e9 39 fe ff ff       	jmp    a40 <malloc>
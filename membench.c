@@ -0,0 +1,60 @@
+// Measure the kernel's block copy and compare routines.
+// For each size, the membench() system call times enough runs of
+// each operation to move 1MB, and this prints bytes per cycle.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "membench.h"
+
+#define TOTAL (1024*1024)
+
+char buf[4096];
+
+char *opname[] = {
+  [MB_BYTECOPY] "bytecopy",
+  [MB_MEMMOVE]  "memmove",
+  [MB_MEMCMP]   "memcmp",
+  [MB_COPYOUT]  "copyout",
+};
+
+int sizes[] = { 16, 64, 256, 1024, 4096 };
+
+// Print bytes/cycle with two decimals.
+// bytes is at most TOTAL, so bytes*100 cannot overflow.
+void
+rate(uint bytes, uint cycles)
+{
+  uint r;
+
+  if(cycles == 0)
+    cycles = 1;
+  r = bytes * 100 / cycles;
+  printf(1, "%d.%d%d", r / 100, r / 10 % 10, r % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, op, n, cycles;
+
+  printf(1, "bytes/cycle\nsize");
+  for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++)
+    printf(1, "\t%s", opname[op]);
+  printf(1, "\n");
+
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+    n = sizes[i];
+    printf(1, "%d", n);
+    for(op = MB_BYTECOPY; op <= MB_COPYOUT; op++){
+      if((cycles = membench(op, buf, n, TOTAL / n)) < 0){
+        printf(2, "membench: %s failed\n", opname[op]);
+        exit();
+      }
+      printf(1, "\t");
+      rate(TOTAL, cycles);
+    }
+    printf(1, "\n");
+  }
+  exit();
+}
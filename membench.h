@@ -0,0 +1,5 @@
+// Operations timed by the membench() system call.
+#define MB_BYTECOPY  0   // copy a byte at a time, for comparison
+#define MB_MEMMOVE   1   // kernel memmove
+#define MB_MEMCMP    2   // kernel memcmp of equal buffers
+#define MB_COPYOUT   3   // copyout into a user buffer
@@ -0,0 +1,26 @@
+// MLFQ transition records, read from the kernel's recorder
+// by mlfqread(), and snapshots of the queues, from mlfqstatus().
+// Both the kernel and user programs use this header file.
+
+#define MLFQ_NONE 0xff  // as from: process created; as to: exited
+
+// One change of a process's MLFQ level. Ticks are delta-encoded:
+// each record holds the ticks since the record before it, and
+// mlfqread() also returns the tick of the record before the first.
+struct mlfqrec {
+  ushort dtick;  // ticks since the previous record
+  uchar from;    // old level, or MLFQ_NONE
+  uchar to;      // new level, or MLFQ_NONE
+  int pid;       // 0 for a record that only advances the clock
+};
+
+// The MLFQ queues at one moment, from mlfqstatus().
+// NQUEUE and NPROC come from param.h.
+struct mlfqstat {
+  uint tick;               // when the snapshot was taken
+  int recording;           // is the recorder on (mlfqstart)?
+  uint pending;            // records not yet read by mlfqread()
+  uint dropped;            // transitions dropped since mlfqstart()
+  int count[NQUEUE];       // RUNNABLE or RUNNING processes per queue
+  int pid[NQUEUE][NPROC];  // and their pids
+};
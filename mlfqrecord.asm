@@ -0,0 +1,2052 @@
+
+_mlfqrecord:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "Max processes observed:\n");
+  for(q = 0; q < NQUEUE; q++)
+    printf(1, "  Queue %d: %d processes\n", q, max_counts[q]);
+}
+
+int main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  printf(1, "\n");
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	68 f7 0e 00 00       	push   $0xef7
+  17:	6a 01                	push   $0x1
+  19:	e8 92 08 00 00       	call   8b0 <printf>
+  printf(1, "========================================\n");
+  1e:	58                   	pop    %eax
+  1f:	5a                   	pop    %edx
+  20:	68 18 0f 00 00       	push   $0xf18
+  25:	6a 01                	push   $0x1
+  27:	e8 84 08 00 00       	call   8b0 <printf>
+  printf(1, "    MLFQ DEMONSTRATION & RECORDING\n");
+  2c:	59                   	pop    %ecx
+  2d:	5b                   	pop    %ebx
+  2e:	68 44 0f 00 00       	push   $0xf44
+  33:	6a 01                	push   $0x1
+  35:	e8 76 08 00 00       	call   8b0 <printf>
+  printf(1, "========================================\n\n");
+  3a:	58                   	pop    %eax
+  3b:	5a                   	pop    %edx
+  3c:	68 68 0f 00 00       	push   $0xf68
+  41:	6a 01                	push   $0x1
+  43:	e8 68 08 00 00       	call   8b0 <printf>
+  
+  printf(1, "This demo will:\n");
+  48:	59                   	pop    %ecx
+  49:	5b                   	pop    %ebx
+  4a:	68 53 0e 00 00       	push   $0xe53
+  4f:	6a 01                	push   $0x1
+  51:	e8 5a 08 00 00       	call   8b0 <printf>
+  printf(1, "  1. Start MLFQ recording\n");
+  56:	58                   	pop    %eax
+  57:	5a                   	pop    %edx
+  58:	68 64 0e 00 00       	push   $0xe64
+  5d:	6a 01                	push   $0x1
+  5f:	e8 4c 08 00 00       	call   8b0 <printf>
+  printf(1, "  2. Launch 3 CPU-intensive worker processes\n");
+  64:	59                   	pop    %ecx
+  65:	5b                   	pop    %ebx
+  66:	68 94 0f 00 00       	push   $0xf94
+  6b:	6a 01                	push   $0x1
+  6d:	e8 3e 08 00 00       	call   8b0 <printf>
+  printf(1, "  3. Track how they move through MLFQ queues\n");
+  72:	58                   	pop    %eax
+  73:	5a                   	pop    %edx
+  74:	68 c4 0f 00 00       	push   $0xfc4
+  79:	6a 01                	push   $0x1
+  7b:	e8 30 08 00 00       	call   8b0 <printf>
+  printf(1, "  4. Show you the results\n\n");
+  80:	59                   	pop    %ecx
+  81:	5b                   	pop    %ebx
+  82:	68 7f 0e 00 00       	push   $0xe7f
+  87:	6a 01                	push   $0x1
+  89:	e8 22 08 00 00       	call   8b0 <printf>
+  
+  printf(1, "MLFQ Queue Levels:\n");
+  8e:	58                   	pop    %eax
+  8f:	5a                   	pop    %edx
+  90:	68 9b 0e 00 00       	push   $0xe9b
+  95:	6a 01                	push   $0x1
+  97:	e8 14 08 00 00       	call   8b0 <printf>
+  printf(1, "  Queue 0: Highest priority (5 tick time slice)\n");
+  9c:	59                   	pop    %ecx
+  9d:	5b                   	pop    %ebx
+  9e:	68 f4 0f 00 00       	push   $0xff4
+  a3:	6a 01                	push   $0x1
+  a5:	e8 06 08 00 00       	call   8b0 <printf>
+  printf(1, "  Queue 1: Medium priority  (10 tick time slice)\n");
+  aa:	58                   	pop    %eax
+  ab:	5a                   	pop    %edx
+  ac:	68 28 10 00 00       	push   $0x1028
+  b1:	6a 01                	push   $0x1
+  b3:	e8 f8 07 00 00       	call   8b0 <printf>
+  printf(1, "  Queue 2: Lowest priority  (20 tick time slice)\n\n");
+  b8:	59                   	pop    %ecx
+  b9:	5b                   	pop    %ebx
+  ba:	68 5c 10 00 00       	push   $0x105c
+  bf:	6a 01                	push   $0x1
+  c1:	e8 ea 07 00 00       	call   8b0 <printf>
+  
+  printf(1, "Starting recording...\n");
+  c6:	58                   	pop    %eax
+  c7:	5a                   	pop    %edx
+  c8:	68 af 0e 00 00       	push   $0xeaf
+  cd:	6a 01                	push   $0x1
+  cf:	e8 dc 07 00 00       	call   8b0 <printf>
+  mlfqstart();
+  d4:	e8 f2 05 00 00       	call   6cb <mlfqstart>
+  
+  printf(1, "Launching 3 worker processes...\n");
+  d9:	59                   	pop    %ecx
+  da:	5b                   	pop    %ebx
+  db:	68 90 10 00 00       	push   $0x1090
+  e0:	6a 01                	push   $0x1
+  e2:	e8 c9 07 00 00       	call   8b0 <printf>
+  int child_pids[3];
+  
+  // Fork CPU-intensive processes
+  for(int i = 0; i < 3; i++) {
+    int pid = fork();
+  e7:	e8 1f 05 00 00       	call   60b <fork>
+    if(pid == 0) {
+  ec:	83 c4 10             	add    $0x10,%esp
+  ef:	85 c0                	test   %eax,%eax
+  f1:	0f 84 39 01 00 00    	je     230 <main+0x230>
+    int pid = fork();
+  f7:	e8 0f 05 00 00       	call   60b <fork>
+    if(pid == 0) {
+  fc:	85 c0                	test   %eax,%eax
+  fe:	0f 84 5f 01 00 00    	je     263 <main+0x263>
+    int pid = fork();
+ 104:	e8 02 05 00 00       	call   60b <fork>
+      // Child process - do CPU intensive work
+      printf(1, "  Worker %d (PID %d) started in Queue 0\n", i+1, getpid());
+ 109:	bb 03 00 00 00       	mov    $0x3,%ebx
+    if(pid == 0) {
+ 10e:	85 c0                	test   %eax,%eax
+ 110:	0f 84 1f 01 00 00    	je     235 <main+0x235>
+    } else {
+      child_pids[i] = pid;
+    }
+  }
+  
+  printf(1, "\nWorkers running... (this will take a few seconds)\n");
+ 116:	83 ec 08             	sub    $0x8,%esp
+ 119:	68 00 11 00 00       	push   $0x1100
+ 11e:	6a 01                	push   $0x1
+ 120:	e8 8b 07 00 00       	call   8b0 <printf>
+  
+  // Wait for children
+  for(int i = 0; i < 3; i++) {
+    wait();
+ 125:	e8 f1 04 00 00       	call   61b <wait>
+ 12a:	e8 ec 04 00 00       	call   61b <wait>
+ 12f:	e8 e7 04 00 00       	call   61b <wait>
+  }
+  
+  int dropped = mlfqstop();
+ 134:	e8 9a 05 00 00       	call   6d3 <mlfqstop>
+ 139:	89 c3                	mov    %eax,%ebx
+  
+  printf(1, "\n");
+ 13b:	58                   	pop    %eax
+ 13c:	5a                   	pop    %edx
+ 13d:	68 f7 0e 00 00       	push   $0xef7
+ 142:	6a 01                	push   $0x1
+ 144:	e8 67 07 00 00       	call   8b0 <printf>
+  printf(1, "========================================\n");
+ 149:	59                   	pop    %ecx
+ 14a:	58                   	pop    %eax
+ 14b:	68 18 0f 00 00       	push   $0xf18
+ 150:	6a 01                	push   $0x1
+ 152:	e8 59 07 00 00       	call   8b0 <printf>
+  printf(1, "         RECORDING COMPLETE!\n");
+ 157:	58                   	pop    %eax
+ 158:	5a                   	pop    %edx
+ 159:	68 c6 0e 00 00       	push   $0xec6
+ 15e:	6a 01                	push   $0x1
+ 160:	e8 4b 07 00 00       	call   8b0 <printf>
+  printf(1, "========================================\n\n");
+ 165:	59                   	pop    %ecx
+ 166:	58                   	pop    %eax
+ 167:	68 68 0f 00 00       	push   $0xf68
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 3d 07 00 00       	call   8b0 <printf>
+  
+  printf(1, "RESULTS:\n");
+ 173:	58                   	pop    %eax
+ 174:	5a                   	pop    %edx
+ 175:	68 e4 0e 00 00       	push   $0xee4
+ 17a:	6a 01                	push   $0x1
+ 17c:	e8 2f 07 00 00       	call   8b0 <printf>
+  printf(1, "--------\n\n");
+ 181:	59                   	pop    %ecx
+ 182:	58                   	pop    %eax
+ 183:	68 ee 0e 00 00       	push   $0xeee
+ 188:	6a 01                	push   $0x1
+ 18a:	e8 21 07 00 00       	call   8b0 <printf>
+  
+  summarize();
+ 18f:	e8 dc 00 00 00       	call   270 <summarize>
+  if(dropped > 0)
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 db                	test   %ebx,%ebx
+ 199:	7e 11                	jle    1ac <main+0x1ac>
+    printf(1, "(%d transitions were dropped)\n", dropped);
+ 19b:	50                   	push   %eax
+ 19c:	53                   	push   %ebx
+ 19d:	68 34 11 00 00       	push   $0x1134
+ 1a2:	6a 01                	push   $0x1
+ 1a4:	e8 07 07 00 00       	call   8b0 <printf>
+ 1a9:	83 c4 10             	add    $0x10,%esp
+  
+  printf(1, "\n");
+ 1ac:	83 ec 08             	sub    $0x8,%esp
+ 1af:	68 f7 0e 00 00       	push   $0xef7
+ 1b4:	6a 01                	push   $0x1
+ 1b6:	e8 f5 06 00 00       	call   8b0 <printf>
+  printf(1, "EXPLANATION:\n");
+ 1bb:	58                   	pop    %eax
+ 1bc:	5a                   	pop    %edx
+ 1bd:	68 f9 0e 00 00       	push   $0xef9
+ 1c2:	6a 01                	push   $0x1
+ 1c4:	e8 e7 06 00 00       	call   8b0 <printf>
+  printf(1, "------------\n");
+ 1c9:	59                   	pop    %ecx
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	68 07 0f 00 00       	push   $0xf07
+ 1d0:	6a 01                	push   $0x1
+ 1d2:	e8 d9 06 00 00       	call   8b0 <printf>
+  printf(1, "Each worker started in Queue 0 (highest priority).\n");
+ 1d7:	58                   	pop    %eax
+ 1d8:	5a                   	pop    %edx
+ 1d9:	68 54 11 00 00       	push   $0x1154
+ 1de:	6a 01                	push   $0x1
+ 1e0:	e8 cb 06 00 00       	call   8b0 <printf>
+  printf(1, "After consuming their time slice, they were demoted:\n");
+ 1e5:	59                   	pop    %ecx
+ 1e6:	5b                   	pop    %ebx
+ 1e7:	68 88 11 00 00       	push   $0x1188
+ 1ec:	6a 01                	push   $0x1
+ 1ee:	e8 bd 06 00 00       	call   8b0 <printf>
+  printf(1, "  Queue 0 (5 ticks) -> Queue 1 (10 ticks) -> Queue 2 (20 ticks)\n\n");
+ 1f3:	58                   	pop    %eax
+ 1f4:	5a                   	pop    %edx
+ 1f5:	68 c0 11 00 00       	push   $0x11c0
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	e8 af 06 00 00       	call   8b0 <printf>
+  printf(1, "The numbers above show the maximum processes observed\n");
+ 201:	59                   	pop    %ecx
+ 202:	5b                   	pop    %ebx
+ 203:	68 04 12 00 00       	push   $0x1204
+ 208:	6a 01                	push   $0x1
+ 20a:	e8 a1 06 00 00       	call   8b0 <printf>
+  printf(1, "in each queue during the recording period.\n\n");
+ 20f:	58                   	pop    %eax
+ 210:	5a                   	pop    %edx
+ 211:	68 3c 12 00 00       	push   $0x123c
+ 216:	6a 01                	push   $0x1
+ 218:	e8 93 06 00 00       	call   8b0 <printf>
+  
+  printf(1, "========================================\n\n");
+ 21d:	59                   	pop    %ecx
+ 21e:	5b                   	pop    %ebx
+ 21f:	68 68 0f 00 00       	push   $0xf68
+ 224:	6a 01                	push   $0x1
+ 226:	e8 85 06 00 00       	call   8b0 <printf>
+  
+  exit();
+ 22b:	e8 e3 03 00 00       	call   613 <exit>
+      printf(1, "  Worker %d (PID %d) started in Queue 0\n", i+1, getpid());
+ 230:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 235:	e8 59 04 00 00       	call   693 <getpid>
+ 23a:	50                   	push   %eax
+ 23b:	53                   	push   %ebx
+ 23c:	68 b4 10 00 00       	push   $0x10b4
+ 241:	6a 01                	push   $0x1
+ 243:	e8 68 06 00 00       	call   8b0 <printf>
+      printf(1, "  Worker %d (PID %d) completed\n", i+1, getpid());
+ 248:	e8 46 04 00 00       	call   693 <getpid>
+ 24d:	50                   	push   %eax
+ 24e:	53                   	push   %ebx
+ 24f:	68 e0 10 00 00       	push   $0x10e0
+ 254:	6a 01                	push   $0x1
+ 256:	e8 55 06 00 00       	call   8b0 <printf>
+      exit();
+ 25b:	83 c4 20             	add    $0x20,%esp
+ 25e:	e8 b0 03 00 00       	call   613 <exit>
+      printf(1, "  Worker %d (PID %d) started in Queue 0\n", i+1, getpid());
+ 263:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 268:	eb cb                	jmp    235 <main+0x235>
+ 26a:	66 90                	xchg   %ax,%ax
+ 26c:	66 90                	xchg   %ax,%ax
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <summarize>:
+void summarize(void) {
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	53                   	push   %ebx
+ 276:	83 ec 2c             	sub    $0x2c,%esp
+  int counts[NQUEUE] = {0}, max_counts[NQUEUE] = {0};
+ 279:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+ 280:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+ 28e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 295:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 29c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = mlfqread(rec, NREC, &tick)) > 0) {
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	83 ec 04             	sub    $0x4,%esp
+ 2ab:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 2ae:	50                   	push   %eax
+ 2af:	6a 40                	push   $0x40
+ 2b1:	68 c0 18 00 00       	push   $0x18c0
+ 2b6:	e8 f8 04 00 00       	call   7b3 <mlfqread>
+ 2bb:	83 c4 10             	add    $0x10,%esp
+ 2be:	89 c6                	mov    %eax,%esi
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	0f 8e cc 00 00 00    	jle    394 <summarize+0x124>
+    for(i = 0; i < n; i++) {
+ 2c8:	31 c9                	xor    %ecx,%ecx
+ 2ca:	eb 0b                	jmp    2d7 <summarize+0x67>
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d0:	83 c1 01             	add    $0x1,%ecx
+ 2d3:	39 ce                	cmp    %ecx,%esi
+ 2d5:	74 d1                	je     2a8 <summarize+0x38>
+      if(r->pid == 0)
+ 2d7:	8b 14 cd c4 18 00 00 	mov    0x18c4(,%ecx,8),%edx
+ 2de:	85 d2                	test   %edx,%edx
+ 2e0:	74 ee                	je     2d0 <summarize+0x60>
+      for(slot = 0; slot < NPROC && pids[slot] != r->pid; slot++)
+ 2e2:	31 c0                	xor    %eax,%eax
+ 2e4:	eb 12                	jmp    2f8 <summarize+0x88>
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	83 f8 40             	cmp    $0x40,%eax
+ 2f6:	74 78                	je     370 <summarize+0x100>
+ 2f8:	3b 14 85 c0 16 00 00 	cmp    0x16c0(,%eax,4),%edx
+ 2ff:	75 ef                	jne    2f0 <summarize+0x80>
+      if(r->from != MLFQ_NONE && pids[slot] == r->pid)
+ 301:	80 3c cd c2 18 00 00 	cmpb   $0xff,0x18c2(,%ecx,8)
+ 308:	ff 
+ 309:	74 15                	je     320 <summarize+0xb0>
+ 30b:	3b 14 85 c0 16 00 00 	cmp    0x16c0(,%eax,4),%edx
+ 312:	75 0c                	jne    320 <summarize+0xb0>
+        counts[level[slot]]--;
+ 314:	8b 3c 85 c0 17 00 00 	mov    0x17c0(,%eax,4),%edi
+ 31b:	83 6c bd d0 01       	subl   $0x1,-0x30(%ebp,%edi,4)
+      if(r->to == MLFQ_NONE) {
+ 320:	0f b6 1c cd c3 18 00 	movzbl 0x18c3(,%ecx,8),%ebx
+ 327:	00 
+ 328:	80 fb ff             	cmp    $0xff,%bl
+ 32b:	74 33                	je     360 <summarize+0xf0>
+        pids[slot] = r->pid;
+ 32d:	89 14 85 c0 16 00 00 	mov    %edx,0x16c0(,%eax,4)
+        level[slot] = r->to;
+ 334:	0f b6 d3             	movzbl %bl,%edx
+ 337:	89 14 85 c0 17 00 00 	mov    %edx,0x17c0(,%eax,4)
+        if(++counts[r->to] > max_counts[r->to])
+ 33e:	8b 44 95 d0          	mov    -0x30(%ebp,%edx,4),%eax
+ 342:	83 c0 01             	add    $0x1,%eax
+ 345:	89 44 95 d0          	mov    %eax,-0x30(%ebp,%edx,4)
+ 349:	3b 44 95 dc          	cmp    -0x24(%ebp,%edx,4),%eax
+ 34d:	7e 81                	jle    2d0 <summarize+0x60>
+          max_counts[r->to] = counts[r->to];
+ 34f:	89 44 95 dc          	mov    %eax,-0x24(%ebp,%edx,4)
+ 353:	e9 78 ff ff ff       	jmp    2d0 <summarize+0x60>
+ 358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+        pids[slot] = 0;
+ 360:	c7 04 85 c0 16 00 00 	movl   $0x0,0x16c0(,%eax,4)
+ 367:	00 00 00 00 
+ 36b:	e9 60 ff ff ff       	jmp    2d0 <summarize+0x60>
+ 370:	31 c0                	xor    %eax,%eax
+ 372:	eb 10                	jmp    384 <summarize+0x114>
+ 374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        for(slot = 0; slot < NPROC && pids[slot] != 0; slot++)
+ 378:	83 c0 01             	add    $0x1,%eax
+ 37b:	83 f8 40             	cmp    $0x40,%eax
+ 37e:	0f 84 4c ff ff ff    	je     2d0 <summarize+0x60>
+ 384:	8b 1c 85 c0 16 00 00 	mov    0x16c0(,%eax,4),%ebx
+ 38b:	85 db                	test   %ebx,%ebx
+ 38d:	75 e9                	jne    378 <summarize+0x108>
+ 38f:	e9 6d ff ff ff       	jmp    301 <summarize+0x91>
+  printf(1, "Max processes observed:\n");
+ 394:	83 ec 08             	sub    $0x8,%esp
+  for(q = 0; q < NQUEUE; q++)
+ 397:	31 db                	xor    %ebx,%ebx
+  printf(1, "Max processes observed:\n");
+ 399:	68 20 0e 00 00       	push   $0xe20
+ 39e:	6a 01                	push   $0x1
+ 3a0:	e8 0b 05 00 00       	call   8b0 <printf>
+ 3a5:	83 c4 10             	add    $0x10,%esp
+    printf(1, "  Queue %d: %d processes\n", q, max_counts[q]);
+ 3a8:	ff 74 9d dc          	push   -0x24(%ebp,%ebx,4)
+ 3ac:	53                   	push   %ebx
+  for(q = 0; q < NQUEUE; q++)
+ 3ad:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "  Queue %d: %d processes\n", q, max_counts[q]);
+ 3b0:	68 39 0e 00 00       	push   $0xe39
+ 3b5:	6a 01                	push   $0x1
+ 3b7:	e8 f4 04 00 00       	call   8b0 <printf>
+  for(q = 0; q < NQUEUE; q++)
+ 3bc:	83 c4 10             	add    $0x10,%esp
+ 3bf:	83 fb 03             	cmp    $0x3,%ebx
+ 3c2:	75 e4                	jne    3a8 <summarize+0x138>
+}
+ 3c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3c7:	5b                   	pop    %ebx
+ 3c8:	5e                   	pop    %esi
+ 3c9:	5f                   	pop    %edi
+ 3ca:	5d                   	pop    %ebp
+ 3cb:	c3                   	ret
+ 3cc:	66 90                	xchg   %ax,%ax
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3d1:	31 c0                	xor    %eax,%eax
+{
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	53                   	push   %ebx
+ 3d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3e7:	83 c0 01             	add    $0x1,%eax
+ 3ea:	84 d2                	test   %dl,%dl
+ 3ec:	75 f2                	jne    3e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f1:	89 c8                	mov    %ecx,%eax
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+ 3f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+ 407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 40a:	0f b6 02             	movzbl (%edx),%eax
+ 40d:	84 c0                	test   %al,%al
+ 40f:	75 17                	jne    428 <strcmp+0x28>
+ 411:	eb 3a                	jmp    44d <strcmp+0x4d>
+ 413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 417:	90                   	nop
+ 418:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 41c:	83 c2 01             	add    $0x1,%edx
+ 41f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 422:	84 c0                	test   %al,%al
+ 424:	74 1a                	je     440 <strcmp+0x40>
+    p++, q++;
+ 426:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 428:	0f b6 19             	movzbl (%ecx),%ebx
+ 42b:	38 c3                	cmp    %al,%bl
+ 42d:	74 e9                	je     418 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 42f:	29 d8                	sub    %ebx,%eax
+}
+ 431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 434:	c9                   	leave
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 440:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 444:	31 c0                	xor    %eax,%eax
+ 446:	29 d8                	sub    %ebx,%eax
+}
+ 448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 44d:	0f b6 19             	movzbl (%ecx),%ebx
+ 450:	31 c0                	xor    %eax,%eax
+ 452:	eb db                	jmp    42f <strcmp+0x2f>
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 466:	80 3a 00             	cmpb   $0x0,(%edx)
+ 469:	74 15                	je     480 <strlen+0x20>
+ 46b:	31 c0                	xor    %eax,%eax
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+ 470:	83 c0 01             	add    $0x1,%eax
+ 473:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 477:	89 c1                	mov    %eax,%ecx
+ 479:	75 f5                	jne    470 <strlen+0x10>
+    ;
+  return n;
+}
+ 47b:	89 c8                	mov    %ecx,%eax
+ 47d:	5d                   	pop    %ebp
+ 47e:	c3                   	ret
+ 47f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 480:	31 c9                	xor    %ecx,%ecx
+}
+ 482:	5d                   	pop    %ebp
+ 483:	89 c8                	mov    %ecx,%eax
+ 485:	c3                   	ret
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000490 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 497:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	89 d7                	mov    %edx,%edi
+ 49f:	fc                   	cld
+ 4a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4a5:	89 d0                	mov    %edx,%eax
+ 4a7:	c9                   	leave
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ba:	0f b6 10             	movzbl (%eax),%edx
+ 4bd:	84 d2                	test   %dl,%dl
+ 4bf:	75 12                	jne    4d3 <strchr+0x23>
+ 4c1:	eb 1d                	jmp    4e0 <strchr+0x30>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4cc:	83 c0 01             	add    $0x1,%eax
+ 4cf:	84 d2                	test   %dl,%dl
+ 4d1:	74 0d                	je     4e0 <strchr+0x30>
+    if(*s == c)
+ 4d3:	38 d1                	cmp    %dl,%cl
+ 4d5:	75 f1                	jne    4c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4d7:	5d                   	pop    %ebp
+ 4d8:	c3                   	ret
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4e0:	31 c0                	xor    %eax,%eax
+}
+ 4e2:	5d                   	pop    %ebp
+ 4e3:	c3                   	ret
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4f9:	31 db                	xor    %ebx,%ebx
+{
+ 4fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4fe:	eb 27                	jmp    527 <gets+0x37>
+    cc = read(0, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	6a 01                	push   $0x1
+ 505:	56                   	push   %esi
+ 506:	6a 00                	push   $0x0
+ 508:	e8 1e 01 00 00       	call   62b <read>
+    if(cc < 1)
+ 50d:	83 c4 10             	add    $0x10,%esp
+ 510:	85 c0                	test   %eax,%eax
+ 512:	7e 1d                	jle    531 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 514:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 51f:	3c 0a                	cmp    $0xa,%al
+ 521:	74 10                	je     533 <gets+0x43>
+ 523:	3c 0d                	cmp    $0xd,%al
+ 525:	74 0c                	je     533 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 527:	89 df                	mov    %ebx,%edi
+ 529:	83 c3 01             	add    $0x1,%ebx
+ 52c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 52f:	7c cf                	jl     500 <gets+0x10>
+ 531:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 53a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53d:	5b                   	pop    %ebx
+ 53e:	5e                   	pop    %esi
+ 53f:	5f                   	pop    %edi
+ 540:	5d                   	pop    %ebp
+ 541:	c3                   	ret
+ 542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	56                   	push   %esi
+ 554:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 555:	83 ec 08             	sub    $0x8,%esp
+ 558:	6a 00                	push   $0x0
+ 55a:	ff 75 08             	push   0x8(%ebp)
+ 55d:	e8 f1 00 00 00       	call   653 <open>
+  if(fd < 0)
+ 562:	83 c4 10             	add    $0x10,%esp
+ 565:	85 c0                	test   %eax,%eax
+ 567:	78 27                	js     590 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 569:	83 ec 08             	sub    $0x8,%esp
+ 56c:	ff 75 0c             	push   0xc(%ebp)
+ 56f:	89 c3                	mov    %eax,%ebx
+ 571:	50                   	push   %eax
+ 572:	e8 f4 00 00 00       	call   66b <fstat>
+  close(fd);
+ 577:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 57a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 57c:	e8 ba 00 00 00       	call   63b <close>
+  return r;
+ 581:	83 c4 10             	add    $0x10,%esp
+}
+ 584:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 587:	89 f0                	mov    %esi,%eax
+ 589:	5b                   	pop    %ebx
+ 58a:	5e                   	pop    %esi
+ 58b:	5d                   	pop    %ebp
+ 58c:	c3                   	ret
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 590:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 595:	eb ed                	jmp    584 <stat+0x34>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	53                   	push   %ebx
+ 5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5a7:	0f be 02             	movsbl (%edx),%eax
+ 5aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5b5:	77 1e                	ja     5d5 <atoi+0x35>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5c0:	83 c2 01             	add    $0x1,%edx
+ 5c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ca:	0f be 02             	movsbl (%edx),%eax
+ 5cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5d0:	80 fb 09             	cmp    $0x9,%bl
+ 5d3:	76 eb                	jbe    5c0 <atoi+0x20>
+  return n;
+}
+ 5d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5d8:	89 c8                	mov    %ecx,%eax
+ 5da:	c9                   	leave
+ 5db:	c3                   	ret
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5ee:	85 c0                	test   %eax,%eax
+ 5f0:	7e 13                	jle    605 <memmove+0x25>
+ 5f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5f4:	89 d7                	mov    %edx,%edi
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 600:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 601:	39 f8                	cmp    %edi,%eax
+ 603:	75 fb                	jne    600 <memmove+0x20>
+  return vdst;
+}
+ 605:	5e                   	pop    %esi
+ 606:	89 d0                	mov    %edx,%eax
+ 608:	5f                   	pop    %edi
+ 609:	5d                   	pop    %ebp
+ 60a:	c3                   	ret
+
+0000060b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 60b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <exit>:
+SYSCALL(exit)
+ 613:	b8 02 00 00 00       	mov    $0x2,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <wait>:
+SYSCALL(wait)
+ 61b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <pipe>:
+SYSCALL(pipe)
+ 623:	b8 04 00 00 00       	mov    $0x4,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <read>:
+SYSCALL(read)
+ 62b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <write>:
+SYSCALL(write)
+ 633:	b8 10 00 00 00       	mov    $0x10,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <close>:
+SYSCALL(close)
+ 63b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <kill>:
+SYSCALL(kill)
+ 643:	b8 06 00 00 00       	mov    $0x6,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <exec>:
+SYSCALL(exec)
+ 64b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <open>:
+SYSCALL(open)
+ 653:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mknod>:
+SYSCALL(mknod)
+ 65b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <unlink>:
+SYSCALL(unlink)
+ 663:	b8 12 00 00 00       	mov    $0x12,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <fstat>:
+SYSCALL(fstat)
+ 66b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <link>:
+SYSCALL(link)
+ 673:	b8 13 00 00 00       	mov    $0x13,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <mkdir>:
+SYSCALL(mkdir)
+ 67b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <chdir>:
+SYSCALL(chdir)
+ 683:	b8 09 00 00 00       	mov    $0x9,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <dup>:
+SYSCALL(dup)
+ 68b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getpid>:
+SYSCALL(getpid)
+ 693:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <sbrk>:
+SYSCALL(sbrk)
+ 69b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <sleep>:
+SYSCALL(sleep)
+ 6a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <uptime>:
+SYSCALL(uptime)
+ 6ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 6b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 6bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 6c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 6cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 6d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 6db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 6e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <setpriority>:
+SYSCALL(setpriority)
+ 6eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 6f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <getcpustats>:
+SYSCALL(getcpustats)
+ 6fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <setscheduler>:
+SYSCALL(setscheduler)
+ 703:	b8 20 00 00 00       	mov    $0x20,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 70b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <getscheduler>:
+SYSCALL(getscheduler)
+ 713:	b8 22 00 00 00       	mov    $0x22,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <splice>:
+SYSCALL(splice)
+ 71b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <readv>:
+SYSCALL(readv)
+ 723:	b8 24 00 00 00       	mov    $0x24,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <writev>:
+SYSCALL(writev)
+ 72b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <pread>:
+SYSCALL(pread)
+ 733:	b8 26 00 00 00       	mov    $0x26,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <pwrite>:
+SYSCALL(pwrite)
+ 73b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <getlogstat>:
+SYSCALL(getlogstat)
+ 743:	b8 28 00 00 00       	mov    $0x28,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <mount>:
+SYSCALL(mount)
+ 74b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <umount>:
+SYSCALL(umount)
+ 753:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <mmap>:
+SYSCALL(mmap)
+ 75b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <munmap>:
+SYSCALL(munmap)
+ 763:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <membench>:
+SYSCALL(membench)
+ 76b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getlockstat>:
+SYSCALL(getlockstat)
+ 773:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <lockbench>:
+SYSCALL(lockbench)
+ 77b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <prof>:
+SYSCALL(prof)
+ 783:	b8 30 00 00 00       	mov    $0x30,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <tracectl>:
+SYSCALL(tracectl)
+ 78b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <traceread>:
+SYSCALL(traceread)
+ 793:	b8 32 00 00 00       	mov    $0x32,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <getsysstat>:
+SYSCALL(getsysstat)
+ 79b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 7a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <getschedwait>:
+SYSCALL(getschedwait)
+ 7ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 7b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <dllock>:
+SYSCALL(dllock)
+ 7bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 7c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 7cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <clone>:
+SYSCALL(clone)
+ 7d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <join>:
+SYSCALL(join)
+ 7db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <futex>:
+SYSCALL(futex)
+ 7e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <shmat>:
+SYSCALL(shmat)
+ 7eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <shmdt>:
+SYSCALL(shmdt)
+ 7f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <poll>:
+SYSCALL(poll)
+ 7fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+ 803:	66 90                	xchg   %ax,%ax
+ 805:	66 90                	xchg   %ax,%ax
+ 807:	66 90                	xchg   %ax,%ax
+ 809:	66 90                	xchg   %ax,%ax
+ 80b:	66 90                	xchg   %ax,%ax
+ 80d:	66 90                	xchg   %ax,%ax
+ 80f:	90                   	nop
+
+00000810 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 818:	89 d1                	mov    %edx,%ecx
+{
+ 81a:	83 ec 3c             	sub    $0x3c,%esp
+ 81d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 820:	85 d2                	test   %edx,%edx
+ 822:	0f 89 80 00 00 00    	jns    8a8 <printint+0x98>
+ 828:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 82c:	74 7a                	je     8a8 <printint+0x98>
+    x = -xx;
+ 82e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 830:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 835:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 838:	31 f6                	xor    %esi,%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 840:	89 c8                	mov    %ecx,%eax
+ 842:	31 d2                	xor    %edx,%edx
+ 844:	89 f7                	mov    %esi,%edi
+ 846:	f7 f3                	div    %ebx
+ 848:	8d 76 01             	lea    0x1(%esi),%esi
+ 84b:	0f b6 92 c8 12 00 00 	movzbl 0x12c8(%edx),%edx
+ 852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 856:	89 ca                	mov    %ecx,%edx
+ 858:	89 c1                	mov    %eax,%ecx
+ 85a:	39 da                	cmp    %ebx,%edx
+ 85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+ 85e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 861:	85 c0                	test   %eax,%eax
+ 863:	74 07                	je     86c <printint+0x5c>
+    buf[i++] = '-';
+ 865:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 86a:	89 f7                	mov    %esi,%edi
+ 86c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 86f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 872:	01 df                	add    %ebx,%edi
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 878:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 881:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 884:	6a 01                	push   $0x1
+ 886:	50                   	push   %eax
+ 887:	56                   	push   %esi
+ 888:	e8 a6 fd ff ff       	call   633 <write>
+  while(--i >= 0)
+ 88d:	89 f8                	mov    %edi,%eax
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	83 ef 01             	sub    $0x1,%edi
+ 895:	39 d8                	cmp    %ebx,%eax
+ 897:	75 df                	jne    878 <printint+0x68>
+}
+ 899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89c:	5b                   	pop    %ebx
+ 89d:	5e                   	pop    %esi
+ 89e:	5f                   	pop    %edi
+ 89f:	5d                   	pop    %ebp
+ 8a0:	c3                   	ret
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8a8:	31 c0                	xor    %eax,%eax
+ 8aa:	eb 89                	jmp    835 <printint+0x25>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c2:	83 c6 01             	add    $0x1,%esi
+ 8c5:	84 db                	test   %bl,%bl
+ 8c7:	74 67                	je     930 <printf+0x80>
+ 8c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8cc:	31 d2                	xor    %edx,%edx
+ 8ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8d1:	eb 34                	jmp    907 <printf+0x57>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8e0:	83 f8 25             	cmp    $0x25,%eax
+ 8e3:	74 18                	je     8fd <printf+0x4d>
+  write(fd, &c, 1);
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ee:	6a 01                	push   $0x1
+ 8f0:	50                   	push   %eax
+ 8f1:	57                   	push   %edi
+ 8f2:	e8 3c fd ff ff       	call   633 <write>
+ 8f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 900:	83 c6 01             	add    $0x1,%esi
+ 903:	84 db                	test   %bl,%bl
+ 905:	74 29                	je     930 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 907:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 90a:	85 d2                	test   %edx,%edx
+ 90c:	74 ca                	je     8d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 90e:	83 fa 25             	cmp    $0x25,%edx
+ 911:	75 ea                	jne    8fd <printf+0x4d>
+      if(c == 'd'){
+ 913:	83 f8 25             	cmp    $0x25,%eax
+ 916:	0f 84 24 01 00 00    	je     a40 <printf+0x190>
+ 91c:	83 e8 63             	sub    $0x63,%eax
+ 91f:	83 f8 15             	cmp    $0x15,%eax
+ 922:	77 1c                	ja     940 <printf+0x90>
+ 924:	ff 24 85 70 12 00 00 	jmp    *0x1270(,%eax,4)
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 933:	5b                   	pop    %ebx
+ 934:	5e                   	pop    %esi
+ 935:	5f                   	pop    %edi
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 946:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 94a:	6a 01                	push   $0x1
+ 94c:	52                   	push   %edx
+ 94d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 950:	57                   	push   %edi
+ 951:	e8 dd fc ff ff       	call   633 <write>
+ 956:	83 c4 0c             	add    $0xc,%esp
+ 959:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95c:	6a 01                	push   $0x1
+ 95e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 961:	52                   	push   %edx
+ 962:	57                   	push   %edi
+ 963:	e8 cb fc ff ff       	call   633 <write>
+        putc(fd, c);
+ 968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96b:	31 d2                	xor    %edx,%edx
+ 96d:	eb 8e                	jmp    8fd <printf+0x4d>
+ 96f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 00                	push   $0x0
+ 97f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 981:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 984:	e8 87 fe ff ff       	call   810 <printint>
+        ap++;
+ 989:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 67 ff ff ff       	jmp    8fd <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9ab:	85 db                	test   %ebx,%ebx
+ 9ad:	0f 84 9d 00 00 00    	je     a50 <printf+0x1a0>
+        while(*s != 0){
+ 9b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	0f 84 3d ff ff ff    	je     8fd <printf+0x4d>
+ 9c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	89 d3                	mov    %edx,%ebx
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9d9:	6a 01                	push   $0x1
+ 9db:	53                   	push   %ebx
+ 9dc:	57                   	push   %edi
+ 9dd:	e8 51 fc ff ff       	call   633 <write>
+        while(*s != 0){
+ 9e2:	0f b6 06             	movzbl (%esi),%eax
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	75 e4                	jne    9d0 <printf+0x120>
+      state = 0;
+ 9ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 07 ff ff ff       	jmp    8fd <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	e9 6b ff ff ff       	jmp    97f <printf+0xcf>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	52                   	push   %edx
+ a2c:	57                   	push   %edi
+ a2d:	e8 01 fc ff ff       	call   633 <write>
+        ap++;
+ a32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a38:	31 d2                	xor    %edx,%edx
+ a3a:	e9 be fe ff ff       	jmp    8fd <printf+0x4d>
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a49:	6a 01                	push   $0x1
+ a4b:	e9 11 ff ff ff       	jmp    961 <printf+0xb1>
+ a50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a55:	bb 69 12 00 00       	mov    $0x1269,%ebx
+ a5a:	e9 61 ff ff ff       	jmp    9c0 <printf+0x110>
+ a5f:	90                   	nop
+
+00000a60 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a63:	a1 14 1b 00 00       	mov    0x1b14,%eax
+{
+ a68:	89 e5                	mov    %esp,%ebp
+ a6a:	56                   	push   %esi
+ a6b:	53                   	push   %ebx
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a70:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a72:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a74:	39 ca                	cmp    %ecx,%edx
+ a76:	73 30                	jae    aa8 <bigfree+0x48>
+ a78:	39 c1                	cmp    %eax,%ecx
+ a7a:	72 04                	jb     a80 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7c:	39 c2                	cmp    %eax,%edx
+ a7e:	72 f0                	jb     a70 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a80:	8b 59 04             	mov    0x4(%ecx),%ebx
+ a83:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ a86:	39 f0                	cmp    %esi,%eax
+ a88:	74 26                	je     ab0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a8a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a8c:	8b 42 04             	mov    0x4(%edx),%eax
+ a8f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a92:	39 d9                	cmp    %ebx,%ecx
+ a94:	74 30                	je     ac6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a96:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a98:	5b                   	pop    %ebx
+  freep = p;
+ a99:	89 15 14 1b 00 00    	mov    %edx,0x1b14
+}
+ a9f:	5e                   	pop    %esi
+ aa0:	5d                   	pop    %ebp
+ aa1:	c3                   	ret
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa8:	39 c1                	cmp    %eax,%ecx
+ aaa:	72 d0                	jb     a7c <bigfree+0x1c>
+ aac:	eb c2                	jmp    a70 <bigfree+0x10>
+ aae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ ab0:	03 58 04             	add    0x4(%eax),%ebx
+ ab3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab6:	8b 02                	mov    (%edx),%eax
+ ab8:	8b 00                	mov    (%eax),%eax
+ aba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ abc:	8b 42 04             	mov    0x4(%edx),%eax
+ abf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ ac2:	39 d9                	cmp    %ebx,%ecx
+ ac4:	75 d0                	jne    a96 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ ac6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ ac9:	89 15 14 1b 00 00    	mov    %edx,0x1b14
+    p->s.size += bp->s.size;
+ acf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ad2:	8b 09                	mov    (%ecx),%ecx
+ ad4:	89 0a                	mov    %ecx,(%edx)
+}
+ ad6:	5b                   	pop    %ebx
+ ad7:	5e                   	pop    %esi
+ ad8:	5d                   	pop    %ebp
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ae0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	89 c7                	mov    %eax,%edi
+ ae6:	56                   	push   %esi
+ ae7:	53                   	push   %ebx
+ ae8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ aeb:	a1 14 1b 00 00       	mov    0x1b14,%eax
+ af0:	85 c0                	test   %eax,%eax
+ af2:	0f 84 88 00 00 00    	je     b80 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ afa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ afd:	39 f9                	cmp    %edi,%ecx
+ aff:	73 5f                	jae    b60 <bigalloc+0x80>
+  if(nu < 4096)
+ b01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b06:	39 df                	cmp    %ebx,%edi
+ b08:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b0b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b12:	eb 0d                	jmp    b21 <bigalloc+0x41>
+ b14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b1d:	39 f9                	cmp    %edi,%ecx
+ b1f:	73 3f                	jae    b60 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b21:	89 d0                	mov    %edx,%eax
+ b23:	39 15 14 1b 00 00    	cmp    %edx,0x1b14
+ b29:	75 ed                	jne    b18 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b2b:	83 ec 0c             	sub    $0xc,%esp
+ b2e:	56                   	push   %esi
+ b2f:	e8 67 fb ff ff       	call   69b <sbrk>
+  if(p == (char*)-1)
+ b34:	83 c4 10             	add    $0x10,%esp
+ b37:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b3a:	74 11                	je     b4d <bigalloc+0x6d>
+  hp->s.size = nu;
+ b3c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ b3f:	e8 1c ff ff ff       	call   a60 <bigfree>
+  return freep;
+ b44:	a1 14 1b 00 00       	mov    0x1b14,%eax
+      if((p = morecore(nunits)) == 0)
+ b49:	85 c0                	test   %eax,%eax
+ b4b:	75 cb                	jne    b18 <bigalloc+0x38>
+        return 0;
+  }
+}
+ b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b50:	31 d2                	xor    %edx,%edx
+}
+ b52:	5b                   	pop    %ebx
+ b53:	89 d0                	mov    %edx,%eax
+ b55:	5e                   	pop    %esi
+ b56:	5f                   	pop    %edi
+ b57:	5d                   	pop    %ebp
+ b58:	c3                   	ret
+ b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b60:	39 cf                	cmp    %ecx,%edi
+ b62:	74 4c                	je     bb0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ b64:	29 f9                	sub    %edi,%ecx
+ b66:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b69:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b6c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b6f:	a3 14 1b 00 00       	mov    %eax,0x1b14
+}
+ b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b77:	89 d0                	mov    %edx,%eax
+ b79:	5b                   	pop    %ebx
+ b7a:	5e                   	pop    %esi
+ b7b:	5f                   	pop    %edi
+ b7c:	5d                   	pop    %ebp
+ b7d:	c3                   	ret
+ b7e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ b80:	c7 05 14 1b 00 00 18 	movl   $0x1b18,0x1b14
+ b87:	1b 00 00 
+    base.s.size = 0;
+ b8a:	ba 18 1b 00 00       	mov    $0x1b18,%edx
+    base.s.ptr = freep = prevp = &base;
+ b8f:	c7 05 18 1b 00 00 18 	movl   $0x1b18,0x1b18
+ b96:	1b 00 00 
+    base.s.size = 0;
+ b99:	c7 05 1c 1b 00 00 00 	movl   $0x0,0x1b1c
+ ba0:	00 00 00 
+    if(p->s.size >= nunits){
+ ba3:	e9 59 ff ff ff       	jmp    b01 <bigalloc+0x21>
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bb0:	8b 0a                	mov    (%edx),%ecx
+ bb2:	89 08                	mov    %ecx,(%eax)
+ bb4:	eb b9                	jmp    b6f <bigalloc+0x8f>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <free>:
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	53                   	push   %ebx
+ bc4:	83 ec 04             	sub    $0x4,%esp
+ bc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ bca:	85 c9                	test   %ecx,%ecx
+ bcc:	74 58                	je     c26 <free+0x66>
+  bp = (Header*)ap - 1;
+ bce:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ bd1:	ba 01 00 00 00       	mov    $0x1,%edx
+ bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+ be0:	89 d0                	mov    %edx,%eax
+ be2:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+  while(xchg(&locked, 1) != 0)
+ be9:	85 c0                	test   %eax,%eax
+ beb:	75 f3                	jne    be0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ bed:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ bf0:	83 fa 40             	cmp    $0x40,%edx
+ bf3:	77 3b                	ja     c30 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ bf5:	83 fa 02             	cmp    $0x2,%edx
+ bf8:	76 3f                	jbe    c39 <free+0x79>
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c00:	83 c0 01             	add    $0x1,%eax
+ c03:	39 14 85 e0 12 00 00 	cmp    %edx,0x12e0(,%eax,4)
+ c0a:	72 f4                	jb     c00 <free+0x40>
+    bp->s.ptr = classfree[c];
+ c0c:	8b 14 85 e0 1a 00 00 	mov    0x1ae0(,%eax,4),%edx
+    classfree[c] = bp;
+ c13:	89 1c 85 e0 1a 00 00 	mov    %ebx,0x1ae0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ c1a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ c1d:	31 c0                	xor    %eax,%eax
+ c1f:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+}
+ c26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c29:	c9                   	leave
+ c2a:	c3                   	ret
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+    bigfree(bp);
+ c30:	89 d8                	mov    %ebx,%eax
+ c32:	e8 29 fe ff ff       	call   a60 <bigfree>
+ c37:	eb e4                	jmp    c1d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ c39:	31 c0                	xor    %eax,%eax
+ c3b:	eb cf                	jmp    c0c <free+0x4c>
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c40 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c40:	55                   	push   %ebp
+ c41:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c46:	89 e5                	mov    %esp,%ebp
+ c48:	57                   	push   %edi
+ c49:	56                   	push   %esi
+ c4a:	53                   	push   %ebx
+ c4b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c51:	8d 50 07             	lea    0x7(%eax),%edx
+ c54:	c1 ea 03             	shr    $0x3,%edx
+ c57:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c60:	89 c8                	mov    %ecx,%eax
+ c62:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+ c69:	85 c0                	test   %eax,%eax
+ c6b:	75 f3                	jne    c60 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ c6d:	89 c3                	mov    %eax,%ebx
+ c6f:	83 fa 40             	cmp    $0x40,%edx
+ c72:	77 4c                	ja     cc0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ c74:	be 02 00 00 00       	mov    $0x2,%esi
+ c79:	83 fa 02             	cmp    $0x2,%edx
+ c7c:	76 10                	jbe    c8e <malloc+0x4e>
+ c7e:	66 90                	xchg   %ax,%ax
+ c80:	83 c3 01             	add    $0x1,%ebx
+ c83:	8b 34 9d e0 12 00 00 	mov    0x12e0(,%ebx,4),%esi
+ c8a:	39 d6                	cmp    %edx,%esi
+ c8c:	72 f2                	jb     c80 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ c8e:	8b 14 9d e0 1a 00 00 	mov    0x1ae0(,%ebx,4),%edx
+ c95:	85 d2                	test   %edx,%edx
+ c97:	74 47                	je     ce0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ c99:	8b 3a                	mov    (%edx),%edi
+ c9b:	89 3c 9d e0 1a 00 00 	mov    %edi,0x1ae0(,%ebx,4)
+ ca2:	31 c0                	xor    %eax,%eax
+ ca4:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ cab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ cae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ cb1:	5b                   	pop    %ebx
+ cb2:	5e                   	pop    %esi
+ cb3:	5f                   	pop    %edi
+ cb4:	5d                   	pop    %ebp
+ cb5:	c3                   	ret
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ cc0:	89 d0                	mov    %edx,%eax
+ cc2:	e8 19 fe ff ff       	call   ae0 <bigalloc>
+ cc7:	89 c2                	mov    %eax,%edx
+ cc9:	89 d8                	mov    %ebx,%eax
+ ccb:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+  return p ? (void*)(p + 1) : 0;
+ cd2:	85 d2                	test   %edx,%edx
+ cd4:	75 d5                	jne    cab <malloc+0x6b>
+ cd6:	31 c0                	xor    %eax,%eax
+}
+ cd8:	83 c4 1c             	add    $0x1c,%esp
+ cdb:	5b                   	pop    %ebx
+ cdc:	5e                   	pop    %esi
+ cdd:	5f                   	pop    %edi
+ cde:	5d                   	pop    %ebp
+ cdf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ ce0:	b8 00 02 00 00       	mov    $0x200,%eax
+ ce5:	e8 f6 fd ff ff       	call   ae0 <bigalloc>
+ cea:	85 c0                	test   %eax,%eax
+ cec:	74 44                	je     d32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ cee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ cf5:	8b 14 9d e0 1a 00 00 	mov    0x1ae0(,%ebx,4),%edx
+ cfc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ cff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ d02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ d08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ d0b:	39 cf                	cmp    %ecx,%edi
+ d0d:	72 8a                	jb     c99 <malloc+0x59>
+ d0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ d12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ d15:	8d 76 00             	lea    0x0(%esi),%esi
+ d18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ d1a:	89 70 04             	mov    %esi,0x4(%eax)
+ d1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ d21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d23:	01 d8                	add    %ebx,%eax
+ d25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ d28:	73 ee                	jae    d18 <malloc+0xd8>
+ d2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ d2d:	e9 69 ff ff ff       	jmp    c9b <malloc+0x5b>
+ d32:	f0 87 05 c0 1a 00 00 	lock xchg %eax,0x1ac0
+  return p ? (void*)(p + 1) : 0;
+ d39:	31 c0                	xor    %eax,%eax
+ d3b:	eb 9b                	jmp    cd8 <malloc+0x98>
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	56                   	push   %esi
+ d44:	53                   	push   %ebx
+ d45:	8b 45 08             	mov    0x8(%ebp),%eax
+ d48:	f7 65 0c             	mull   0xc(%ebp)
+ d4b:	70 33                	jo     d80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ d4d:	83 ec 0c             	sub    $0xc,%esp
+ d50:	89 c3                	mov    %eax,%ebx
+ d52:	50                   	push   %eax
+ d53:	e8 e8 fe ff ff       	call   c40 <malloc>
+ d58:	83 c4 10             	add    $0x10,%esp
+ d5b:	89 c6                	mov    %eax,%esi
+ d5d:	85 c0                	test   %eax,%eax
+ d5f:	74 1f                	je     d80 <calloc+0x40>
+    memset(p, 0, n);
+ d61:	83 ec 04             	sub    $0x4,%esp
+ d64:	53                   	push   %ebx
+ d65:	6a 00                	push   $0x0
+ d67:	50                   	push   %eax
+ d68:	e8 23 f7 ff ff       	call   490 <memset>
+ d6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d73:	89 f0                	mov    %esi,%eax
+ d75:	5b                   	pop    %ebx
+ d76:	5e                   	pop    %esi
+ d77:	5d                   	pop    %ebp
+ d78:	c3                   	ret
+ d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ d83:	31 f6                	xor    %esi,%esi
+}
+ d85:	89 f0                	mov    %esi,%eax
+ d87:	5b                   	pop    %ebx
+ d88:	5e                   	pop    %esi
+ d89:	5d                   	pop    %ebp
+ d8a:	c3                   	ret
+ d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+
+00000d90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	57                   	push   %edi
+ d94:	56                   	push   %esi
+ d95:	53                   	push   %ebx
+ d96:	83 ec 0c             	sub    $0xc,%esp
+ d99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d9f:	85 db                	test   %ebx,%ebx
+ da1:	74 55                	je     df8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ da3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ da6:	89 de                	mov    %ebx,%esi
+ da8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ daf:	39 c7                	cmp    %eax,%edi
+ db1:	72 0d                	jb     dc0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ db6:	89 f0                	mov    %esi,%eax
+ db8:	5b                   	pop    %ebx
+ db9:	5e                   	pop    %esi
+ dba:	5f                   	pop    %edi
+ dbb:	5d                   	pop    %ebp
+ dbc:	c3                   	ret
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ dc0:	83 ec 0c             	sub    $0xc,%esp
+ dc3:	50                   	push   %eax
+ dc4:	e8 77 fe ff ff       	call   c40 <malloc>
+ dc9:	83 c4 10             	add    $0x10,%esp
+ dcc:	89 c6                	mov    %eax,%esi
+ dce:	85 c0                	test   %eax,%eax
+ dd0:	74 e1                	je     db3 <realloc+0x23>
+  memmove(p, ap, have);
+ dd2:	83 ec 04             	sub    $0x4,%esp
+ dd5:	57                   	push   %edi
+ dd6:	53                   	push   %ebx
+ dd7:	50                   	push   %eax
+ dd8:	e8 03 f8 ff ff       	call   5e0 <memmove>
+  free(ap);
+ ddd:	89 1c 24             	mov    %ebx,(%esp)
+ de0:	e8 db fd ff ff       	call   bc0 <free>
+  return p;
+ de5:	83 c4 10             	add    $0x10,%esp
+}
+ de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ deb:	89 f0                	mov    %esi,%eax
+ ded:	5b                   	pop    %ebx
+ dee:	5e                   	pop    %esi
+ def:	5f                   	pop    %edi
+ df0:	5d                   	pop    %ebp
+ df1:	c3                   	ret
+ df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ df8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dfe:	5b                   	pop    %ebx
+ dff:	5e                   	pop    %esi
+ e00:	5f                   	pop    %edi
+ e01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ e02:	e9 39 fe ff ff       	jmp    c40 <malloc>
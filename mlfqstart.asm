@@ -0,0 +1,1651 @@
+
+_mlfqstart:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int main(void) {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+    mlfqstart();
+   6:	e8 00 03 00 00       	call   30b <mlfqstart>
+    exit();
+   b:	e8 43 02 00 00       	call   253 <exit>
+
+00000010 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  10:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  11:	31 c0                	xor    %eax,%eax
+{
+  13:	89 e5                	mov    %esp,%ebp
+  15:	53                   	push   %ebx
+  16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  27:	83 c0 01             	add    $0x1,%eax
+  2a:	84 d2                	test   %dl,%dl
+  2c:	75 f2                	jne    20 <strcpy+0x10>
+    ;
+  return os;
+}
+  2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  31:	89 c8                	mov    %ecx,%eax
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  44:	8b 55 08             	mov    0x8(%ebp),%edx
+  47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  4a:	0f b6 02             	movzbl (%edx),%eax
+  4d:	84 c0                	test   %al,%al
+  4f:	75 17                	jne    68 <strcmp+0x28>
+  51:	eb 3a                	jmp    8d <strcmp+0x4d>
+  53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  57:	90                   	nop
+  58:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  5c:	83 c2 01             	add    $0x1,%edx
+  5f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  62:	84 c0                	test   %al,%al
+  64:	74 1a                	je     80 <strcmp+0x40>
+    p++, q++;
+  66:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  68:	0f b6 19             	movzbl (%ecx),%ebx
+  6b:	38 c3                	cmp    %al,%bl
+  6d:	74 e9                	je     58 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  6f:	29 d8                	sub    %ebx,%eax
+}
+  71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  74:	c9                   	leave
+  75:	c3                   	ret
+  76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  80:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  84:	31 c0                	xor    %eax,%eax
+  86:	29 d8                	sub    %ebx,%eax
+}
+  88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8b:	c9                   	leave
+  8c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  8d:	0f b6 19             	movzbl (%ecx),%ebx
+  90:	31 c0                	xor    %eax,%eax
+  92:	eb db                	jmp    6f <strcmp+0x2f>
+  94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  9f:	90                   	nop
+
+000000a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  a6:	80 3a 00             	cmpb   $0x0,(%edx)
+  a9:	74 15                	je     c0 <strlen+0x20>
+  ab:	31 c0                	xor    %eax,%eax
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  b0:	83 c0 01             	add    $0x1,%eax
+  b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  b7:	89 c1                	mov    %eax,%ecx
+  b9:	75 f5                	jne    b0 <strlen+0x10>
+    ;
+  return n;
+}
+  bb:	89 c8                	mov    %ecx,%eax
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+  bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+  c0:	31 c9                	xor    %ecx,%ecx
+}
+  c2:	5d                   	pop    %ebp
+  c3:	89 c8                	mov    %ecx,%eax
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  dd:	89 d7                	mov    %edx,%edi
+  df:	fc                   	cld
+  e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e5:	89 d0                	mov    %edx,%eax
+  e7:	c9                   	leave
+  e8:	c3                   	ret
+  e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	0f b6 10             	movzbl (%eax),%edx
+  fd:	84 d2                	test   %dl,%dl
+  ff:	75 12                	jne    113 <strchr+0x23>
+ 101:	eb 1d                	jmp    120 <strchr+0x30>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 10c:	83 c0 01             	add    $0x1,%eax
+ 10f:	84 d2                	test   %dl,%dl
+ 111:	74 0d                	je     120 <strchr+0x30>
+    if(*s == c)
+ 113:	38 d1                	cmp    %dl,%cl
+ 115:	75 f1                	jne    108 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 117:	5d                   	pop    %ebp
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 120:	31 c0                	xor    %eax,%eax
+}
+ 122:	5d                   	pop    %ebp
+ 123:	c3                   	ret
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 135:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 138:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 139:	31 db                	xor    %ebx,%ebx
+{
+ 13b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 13e:	eb 27                	jmp    167 <gets+0x37>
+    cc = read(0, &c, 1);
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	6a 01                	push   $0x1
+ 145:	56                   	push   %esi
+ 146:	6a 00                	push   $0x0
+ 148:	e8 1e 01 00 00       	call   26b <read>
+    if(cc < 1)
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	85 c0                	test   %eax,%eax
+ 152:	7e 1d                	jle    171 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 154:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 158:	8b 55 08             	mov    0x8(%ebp),%edx
+ 15b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 15f:	3c 0a                	cmp    $0xa,%al
+ 161:	74 10                	je     173 <gets+0x43>
+ 163:	3c 0d                	cmp    $0xd,%al
+ 165:	74 0c                	je     173 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 167:	89 df                	mov    %ebx,%edi
+ 169:	83 c3 01             	add    $0x1,%ebx
+ 16c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 16f:	7c cf                	jl     140 <gets+0x10>
+ 171:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+ 182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	6a 00                	push   $0x0
+ 19a:	ff 75 08             	push   0x8(%ebp)
+ 19d:	e8 f1 00 00 00       	call   293 <open>
+  if(fd < 0)
+ 1a2:	83 c4 10             	add    $0x10,%esp
+ 1a5:	85 c0                	test   %eax,%eax
+ 1a7:	78 27                	js     1d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	ff 75 0c             	push   0xc(%ebp)
+ 1af:	89 c3                	mov    %eax,%ebx
+ 1b1:	50                   	push   %eax
+ 1b2:	e8 f4 00 00 00       	call   2ab <fstat>
+  close(fd);
+ 1b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1bc:	e8 ba 00 00 00       	call   27b <close>
+  return r;
+ 1c1:	83 c4 10             	add    $0x10,%esp
+}
+ 1c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1c7:	89 f0                	mov    %esi,%eax
+ 1c9:	5b                   	pop    %ebx
+ 1ca:	5e                   	pop    %esi
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1d5:	eb ed                	jmp    1c4 <stat+0x34>
+ 1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1e7:	0f be 02             	movsbl (%edx),%eax
+ 1ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 1f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 1f5:	77 1e                	ja     215 <atoi+0x35>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 200:	83 c2 01             	add    $0x1,%edx
+ 203:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 206:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 20a:	0f be 02             	movsbl (%edx),%eax
+ 20d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 210:	80 fb 09             	cmp    $0x9,%bl
+ 213:	76 eb                	jbe    200 <atoi+0x20>
+  return n;
+}
+ 215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 218:	89 c8                	mov    %ecx,%eax
+ 21a:	c9                   	leave
+ 21b:	c3                   	ret
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	56                   	push   %esi
+ 225:	8b 45 10             	mov    0x10(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 22e:	85 c0                	test   %eax,%eax
+ 230:	7e 13                	jle    245 <memmove+0x25>
+ 232:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 234:	89 d7                	mov    %edx,%edi
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 240:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 241:	39 f8                	cmp    %edi,%eax
+ 243:	75 fb                	jne    240 <memmove+0x20>
+  return vdst;
+}
+ 245:	5e                   	pop    %esi
+ 246:	89 d0                	mov    %edx,%eax
+ 248:	5f                   	pop    %edi
+ 249:	5d                   	pop    %ebp
+ 24a:	c3                   	ret
+
+0000024b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 24b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 250:	cd 40                	int    $0x40
+ 252:	c3                   	ret
+
+00000253 <exit>:
+SYSCALL(exit)
+ 253:	b8 02 00 00 00       	mov    $0x2,%eax
+ 258:	cd 40                	int    $0x40
+ 25a:	c3                   	ret
+
+0000025b <wait>:
+SYSCALL(wait)
+ 25b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 260:	cd 40                	int    $0x40
+ 262:	c3                   	ret
+
+00000263 <pipe>:
+SYSCALL(pipe)
+ 263:	b8 04 00 00 00       	mov    $0x4,%eax
+ 268:	cd 40                	int    $0x40
+ 26a:	c3                   	ret
+
+0000026b <read>:
+SYSCALL(read)
+ 26b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <write>:
+SYSCALL(write)
+ 273:	b8 10 00 00 00       	mov    $0x10,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <close>:
+SYSCALL(close)
+ 27b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <kill>:
+SYSCALL(kill)
+ 283:	b8 06 00 00 00       	mov    $0x6,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <exec>:
+SYSCALL(exec)
+ 28b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <open>:
+SYSCALL(open)
+ 293:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <mknod>:
+SYSCALL(mknod)
+ 29b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <unlink>:
+SYSCALL(unlink)
+ 2a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <fstat>:
+SYSCALL(fstat)
+ 2ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <link>:
+SYSCALL(link)
+ 2b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mkdir>:
+SYSCALL(mkdir)
+ 2bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <chdir>:
+SYSCALL(chdir)
+ 2c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <dup>:
+SYSCALL(dup)
+ 2cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <getpid>:
+SYSCALL(getpid)
+ 2d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <sbrk>:
+SYSCALL(sbrk)
+ 2db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <sleep>:
+SYSCALL(sleep)
+ 2e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <uptime>:
+SYSCALL(uptime)
+ 2eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 2f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 2fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 303:	b8 18 00 00 00       	mov    $0x18,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 30b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 313:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 31b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 323:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <setpriority>:
+SYSCALL(setpriority)
+ 32b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 333:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <getcpustats>:
+SYSCALL(getcpustats)
+ 33b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <setscheduler>:
+SYSCALL(setscheduler)
+ 343:	b8 20 00 00 00       	mov    $0x20,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 34b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getscheduler>:
+SYSCALL(getscheduler)
+ 353:	b8 22 00 00 00       	mov    $0x22,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <splice>:
+SYSCALL(splice)
+ 35b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <readv>:
+SYSCALL(readv)
+ 363:	b8 24 00 00 00       	mov    $0x24,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <writev>:
+SYSCALL(writev)
+ 36b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pread>:
+SYSCALL(pread)
+ 373:	b8 26 00 00 00       	mov    $0x26,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <pwrite>:
+SYSCALL(pwrite)
+ 37b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getlogstat>:
+SYSCALL(getlogstat)
+ 383:	b8 28 00 00 00       	mov    $0x28,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mount>:
+SYSCALL(mount)
+ 38b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <umount>:
+SYSCALL(umount)
+ 393:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mmap>:
+SYSCALL(mmap)
+ 39b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <munmap>:
+SYSCALL(munmap)
+ 3a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <membench>:
+SYSCALL(membench)
+ 3ab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <getlockstat>:
+SYSCALL(getlockstat)
+ 3b3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <lockbench>:
+SYSCALL(lockbench)
+ 3bb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <prof>:
+SYSCALL(prof)
+ 3c3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <tracectl>:
+SYSCALL(tracectl)
+ 3cb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <traceread>:
+SYSCALL(traceread)
+ 3d3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <getsysstat>:
+SYSCALL(getsysstat)
+ 3db:	b8 33 00 00 00       	mov    $0x33,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 3e3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <getschedwait>:
+SYSCALL(getschedwait)
+ 3eb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <mlfqread>:
+SYSCALL(mlfqread)
+ 3f3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <dllock>:
+SYSCALL(dllock)
+ 3fb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 403:	b8 38 00 00 00       	mov    $0x38,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 40b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <clone>:
+SYSCALL(clone)
+ 413:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <join>:
+SYSCALL(join)
+ 41b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <futex>:
+SYSCALL(futex)
+ 423:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <shmat>:
+SYSCALL(shmat)
+ 42b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <shmdt>:
+SYSCALL(shmdt)
+ 433:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <poll>:
+SYSCALL(poll)
+ 43b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+ 443:	66 90                	xchg   %ax,%ax
+ 445:	66 90                	xchg   %ax,%ax
+ 447:	66 90                	xchg   %ax,%ax
+ 449:	66 90                	xchg   %ax,%ax
+ 44b:	66 90                	xchg   %ax,%ax
+ 44d:	66 90                	xchg   %ax,%ax
+ 44f:	90                   	nop
+
+00000450 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 458:	89 d1                	mov    %edx,%ecx
+{
+ 45a:	83 ec 3c             	sub    $0x3c,%esp
+ 45d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 460:	85 d2                	test   %edx,%edx
+ 462:	0f 89 80 00 00 00    	jns    4e8 <printint+0x98>
+ 468:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 46c:	74 7a                	je     4e8 <printint+0x98>
+    x = -xx;
+ 46e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 470:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 475:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 478:	31 f6                	xor    %esi,%esi
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 480:	89 c8                	mov    %ecx,%eax
+ 482:	31 d2                	xor    %edx,%edx
+ 484:	89 f7                	mov    %esi,%edi
+ 486:	f7 f3                	div    %ebx
+ 488:	8d 76 01             	lea    0x1(%esi),%esi
+ 48b:	0f b6 92 c0 0a 00 00 	movzbl 0xac0(%edx),%edx
+ 492:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 496:	89 ca                	mov    %ecx,%edx
+ 498:	89 c1                	mov    %eax,%ecx
+ 49a:	39 da                	cmp    %ebx,%edx
+ 49c:	73 e2                	jae    480 <printint+0x30>
+  if(neg)
+ 49e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4a1:	85 c0                	test   %eax,%eax
+ 4a3:	74 07                	je     4ac <printint+0x5c>
+    buf[i++] = '-';
+ 4a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4aa:	89 f7                	mov    %esi,%edi
+ 4ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4b2:	01 df                	add    %ebx,%edi
+ 4b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4bb:	83 ec 04             	sub    $0x4,%esp
+ 4be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	50                   	push   %eax
+ 4c7:	56                   	push   %esi
+ 4c8:	e8 a6 fd ff ff       	call   273 <write>
+  while(--i >= 0)
+ 4cd:	89 f8                	mov    %edi,%eax
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	83 ef 01             	sub    $0x1,%edi
+ 4d5:	39 d8                	cmp    %ebx,%eax
+ 4d7:	75 df                	jne    4b8 <printint+0x68>
+}
+ 4d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dc:	5b                   	pop    %ebx
+ 4dd:	5e                   	pop    %esi
+ 4de:	5f                   	pop    %edi
+ 4df:	5d                   	pop    %ebp
+ 4e0:	c3                   	ret
+ 4e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4e8:	31 c0                	xor    %eax,%eax
+ 4ea:	eb 89                	jmp    475 <printint+0x25>
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 502:	83 c6 01             	add    $0x1,%esi
+ 505:	84 db                	test   %bl,%bl
+ 507:	74 67                	je     570 <printf+0x80>
+ 509:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 50c:	31 d2                	xor    %edx,%edx
+ 50e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 511:	eb 34                	jmp    547 <printf+0x57>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 51b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 520:	83 f8 25             	cmp    $0x25,%eax
+ 523:	74 18                	je     53d <printf+0x4d>
+  write(fd, &c, 1);
+ 525:	83 ec 04             	sub    $0x4,%esp
+ 528:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 52b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 52e:	6a 01                	push   $0x1
+ 530:	50                   	push   %eax
+ 531:	57                   	push   %edi
+ 532:	e8 3c fd ff ff       	call   273 <write>
+ 537:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 53a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 53d:	0f b6 1e             	movzbl (%esi),%ebx
+ 540:	83 c6 01             	add    $0x1,%esi
+ 543:	84 db                	test   %bl,%bl
+ 545:	74 29                	je     570 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 547:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 54a:	85 d2                	test   %edx,%edx
+ 54c:	74 ca                	je     518 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 54e:	83 fa 25             	cmp    $0x25,%edx
+ 551:	75 ea                	jne    53d <printf+0x4d>
+      if(c == 'd'){
+ 553:	83 f8 25             	cmp    $0x25,%eax
+ 556:	0f 84 24 01 00 00    	je     680 <printf+0x190>
+ 55c:	83 e8 63             	sub    $0x63,%eax
+ 55f:	83 f8 15             	cmp    $0x15,%eax
+ 562:	77 1c                	ja     580 <printf+0x90>
+ 564:	ff 24 85 68 0a 00 00 	jmp    *0xa68(,%eax,4)
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 573:	5b                   	pop    %ebx
+ 574:	5e                   	pop    %esi
+ 575:	5f                   	pop    %edi
+ 576:	5d                   	pop    %ebp
+ 577:	c3                   	ret
+ 578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 586:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 58a:	6a 01                	push   $0x1
+ 58c:	52                   	push   %edx
+ 58d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 590:	57                   	push   %edi
+ 591:	e8 dd fc ff ff       	call   273 <write>
+ 596:	83 c4 0c             	add    $0xc,%esp
+ 599:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59c:	6a 01                	push   $0x1
+ 59e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5a1:	52                   	push   %edx
+ 5a2:	57                   	push   %edi
+ 5a3:	e8 cb fc ff ff       	call   273 <write>
+        putc(fd, c);
+ 5a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ab:	31 d2                	xor    %edx,%edx
+ 5ad:	eb 8e                	jmp    53d <printf+0x4d>
+ 5af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 00                	push   $0x0
+ 5bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5c4:	e8 87 fe ff ff       	call   450 <printint>
+        ap++;
+ 5c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 67 ff ff ff       	jmp    53d <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5e5:	83 c0 04             	add    $0x4,%eax
+ 5e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5eb:	85 db                	test   %ebx,%ebx
+ 5ed:	0f 84 9d 00 00 00    	je     690 <printf+0x1a0>
+        while(*s != 0){
+ 5f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5f8:	84 c0                	test   %al,%al
+ 5fa:	0f 84 3d ff ff ff    	je     53d <printf+0x4d>
+ 600:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 603:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 606:	89 de                	mov    %ebx,%esi
+ 608:	89 d3                	mov    %edx,%ebx
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 616:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	53                   	push   %ebx
+ 61c:	57                   	push   %edi
+ 61d:	e8 51 fc ff ff       	call   273 <write>
+        while(*s != 0){
+ 622:	0f b6 06             	movzbl (%esi),%eax
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	84 c0                	test   %al,%al
+ 62a:	75 e4                	jne    610 <printf+0x120>
+      state = 0;
+ 62c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 07 ff ff ff       	jmp    53d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 01                	push   $0x1
+ 64f:	e9 6b ff ff ff       	jmp    5bf <printf+0xcf>
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 658:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 661:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 663:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 666:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	52                   	push   %edx
+ 66c:	57                   	push   %edi
+ 66d:	e8 01 fc ff ff       	call   273 <write>
+        ap++;
+ 672:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 675:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 678:	31 d2                	xor    %edx,%edx
+ 67a:	e9 be fe ff ff       	jmp    53d <printf+0x4d>
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 686:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 689:	6a 01                	push   $0x1
+ 68b:	e9 11 ff ff ff       	jmp    5a1 <printf+0xb1>
+ 690:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 695:	bb 60 0a 00 00       	mov    $0xa60,%ebx
+ 69a:	e9 61 ff ff ff       	jmp    600 <printf+0x110>
+ 69f:	90                   	nop
+
+000006a0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a3:	a1 d4 0e 00 00       	mov    0xed4,%eax
+{
+ 6a8:	89 e5                	mov    %esp,%ebp
+ 6aa:	56                   	push   %esi
+ 6ab:	53                   	push   %ebx
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b4:	39 ca                	cmp    %ecx,%edx
+ 6b6:	73 30                	jae    6e8 <bigfree+0x48>
+ 6b8:	39 c1                	cmp    %eax,%ecx
+ 6ba:	72 04                	jb     6c0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6bc:	39 c2                	cmp    %eax,%edx
+ 6be:	72 f0                	jb     6b0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 6c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 6c6:	39 f0                	cmp    %esi,%eax
+ 6c8:	74 26                	je     6f0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 6cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6d2:	39 d9                	cmp    %ebx,%ecx
+ 6d4:	74 30                	je     706 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6d8:	5b                   	pop    %ebx
+  freep = p;
+ 6d9:	89 15 d4 0e 00 00    	mov    %edx,0xed4
+}
+ 6df:	5e                   	pop    %esi
+ 6e0:	5d                   	pop    %ebp
+ 6e1:	c3                   	ret
+ 6e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e8:	39 c1                	cmp    %eax,%ecx
+ 6ea:	72 d0                	jb     6bc <bigfree+0x1c>
+ 6ec:	eb c2                	jmp    6b0 <bigfree+0x10>
+ 6ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6f0:	03 58 04             	add    0x4(%eax),%ebx
+ 6f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6f6:	8b 02                	mov    (%edx),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 6fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 6ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 702:	39 d9                	cmp    %ebx,%ecx
+ 704:	75 d0                	jne    6d6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 706:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 709:	89 15 d4 0e 00 00    	mov    %edx,0xed4
+    p->s.size += bp->s.size;
+ 70f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 712:	8b 09                	mov    (%ecx),%ecx
+ 714:	89 0a                	mov    %ecx,(%edx)
+}
+ 716:	5b                   	pop    %ebx
+ 717:	5e                   	pop    %esi
+ 718:	5d                   	pop    %ebp
+ 719:	c3                   	ret
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000720 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	89 c7                	mov    %eax,%edi
+ 726:	56                   	push   %esi
+ 727:	53                   	push   %ebx
+ 728:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 72b:	a1 d4 0e 00 00       	mov    0xed4,%eax
+ 730:	85 c0                	test   %eax,%eax
+ 732:	0f 84 88 00 00 00    	je     7c0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 738:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 73a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 73d:	39 f9                	cmp    %edi,%ecx
+ 73f:	73 5f                	jae    7a0 <bigalloc+0x80>
+  if(nu < 4096)
+ 741:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 746:	39 df                	cmp    %ebx,%edi
+ 748:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 74b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 752:	eb 0d                	jmp    761 <bigalloc+0x41>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 758:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 75a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 75d:	39 f9                	cmp    %edi,%ecx
+ 75f:	73 3f                	jae    7a0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 761:	89 d0                	mov    %edx,%eax
+ 763:	39 15 d4 0e 00 00    	cmp    %edx,0xed4
+ 769:	75 ed                	jne    758 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 76b:	83 ec 0c             	sub    $0xc,%esp
+ 76e:	56                   	push   %esi
+ 76f:	e8 67 fb ff ff       	call   2db <sbrk>
+  if(p == (char*)-1)
+ 774:	83 c4 10             	add    $0x10,%esp
+ 777:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 77a:	74 11                	je     78d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 77c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 77f:	e8 1c ff ff ff       	call   6a0 <bigfree>
+  return freep;
+ 784:	a1 d4 0e 00 00       	mov    0xed4,%eax
+      if((p = morecore(nunits)) == 0)
+ 789:	85 c0                	test   %eax,%eax
+ 78b:	75 cb                	jne    758 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 78d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 790:	31 d2                	xor    %edx,%edx
+}
+ 792:	5b                   	pop    %ebx
+ 793:	89 d0                	mov    %edx,%eax
+ 795:	5e                   	pop    %esi
+ 796:	5f                   	pop    %edi
+ 797:	5d                   	pop    %ebp
+ 798:	c3                   	ret
+ 799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7a0:	39 cf                	cmp    %ecx,%edi
+ 7a2:	74 4c                	je     7f0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 7a4:	29 f9                	sub    %edi,%ecx
+ 7a6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7a9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7ac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7af:	a3 d4 0e 00 00       	mov    %eax,0xed4
+}
+ 7b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b7:	89 d0                	mov    %edx,%eax
+ 7b9:	5b                   	pop    %ebx
+ 7ba:	5e                   	pop    %esi
+ 7bb:	5f                   	pop    %edi
+ 7bc:	5d                   	pop    %ebp
+ 7bd:	c3                   	ret
+ 7be:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 7c0:	c7 05 d4 0e 00 00 d8 	movl   $0xed8,0xed4
+ 7c7:	0e 00 00 
+    base.s.size = 0;
+ 7ca:	ba d8 0e 00 00       	mov    $0xed8,%edx
+    base.s.ptr = freep = prevp = &base;
+ 7cf:	c7 05 d8 0e 00 00 d8 	movl   $0xed8,0xed8
+ 7d6:	0e 00 00 
+    base.s.size = 0;
+ 7d9:	c7 05 dc 0e 00 00 00 	movl   $0x0,0xedc
+ 7e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7e3:	e9 59 ff ff ff       	jmp    741 <bigalloc+0x21>
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7f0:	8b 0a                	mov    (%edx),%ecx
+ 7f2:	89 08                	mov    %ecx,(%eax)
+ 7f4:	eb b9                	jmp    7af <bigalloc+0x8f>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000800 <free>:
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	53                   	push   %ebx
+ 804:	83 ec 04             	sub    $0x4,%esp
+ 807:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 80a:	85 c9                	test   %ecx,%ecx
+ 80c:	74 58                	je     866 <free+0x66>
+  bp = (Header*)ap - 1;
+ 80e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 811:	ba 01 00 00 00       	mov    $0x1,%edx
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+ 820:	89 d0                	mov    %edx,%eax
+ 822:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+  while(xchg(&locked, 1) != 0)
+ 829:	85 c0                	test   %eax,%eax
+ 82b:	75 f3                	jne    820 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 82d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 830:	83 fa 40             	cmp    $0x40,%edx
+ 833:	77 3b                	ja     870 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 835:	83 fa 02             	cmp    $0x2,%edx
+ 838:	76 3f                	jbe    879 <free+0x79>
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 840:	83 c0 01             	add    $0x1,%eax
+ 843:	39 14 85 e0 0a 00 00 	cmp    %edx,0xae0(,%eax,4)
+ 84a:	72 f4                	jb     840 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 84c:	8b 14 85 a0 0e 00 00 	mov    0xea0(,%eax,4),%edx
+    classfree[c] = bp;
+ 853:	89 1c 85 a0 0e 00 00 	mov    %ebx,0xea0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 85a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 85d:	31 c0                	xor    %eax,%eax
+ 85f:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+}
+ 866:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 869:	c9                   	leave
+ 86a:	c3                   	ret
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+    bigfree(bp);
+ 870:	89 d8                	mov    %ebx,%eax
+ 872:	e8 29 fe ff ff       	call   6a0 <bigfree>
+ 877:	eb e4                	jmp    85d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 879:	31 c0                	xor    %eax,%eax
+ 87b:	eb cf                	jmp    84c <free+0x4c>
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 880:	55                   	push   %ebp
+ 881:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	57                   	push   %edi
+ 889:	56                   	push   %esi
+ 88a:	53                   	push   %ebx
+ 88b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 88e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 891:	8d 50 07             	lea    0x7(%eax),%edx
+ 894:	c1 ea 03             	shr    $0x3,%edx
+ 897:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8a0:	89 c8                	mov    %ecx,%eax
+ 8a2:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+ 8a9:	85 c0                	test   %eax,%eax
+ 8ab:	75 f3                	jne    8a0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 8ad:	89 c3                	mov    %eax,%ebx
+ 8af:	83 fa 40             	cmp    $0x40,%edx
+ 8b2:	77 4c                	ja     900 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 8b4:	be 02 00 00 00       	mov    $0x2,%esi
+ 8b9:	83 fa 02             	cmp    $0x2,%edx
+ 8bc:	76 10                	jbe    8ce <malloc+0x4e>
+ 8be:	66 90                	xchg   %ax,%ax
+ 8c0:	83 c3 01             	add    $0x1,%ebx
+ 8c3:	8b 34 9d e0 0a 00 00 	mov    0xae0(,%ebx,4),%esi
+ 8ca:	39 d6                	cmp    %edx,%esi
+ 8cc:	72 f2                	jb     8c0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 8ce:	8b 14 9d a0 0e 00 00 	mov    0xea0(,%ebx,4),%edx
+ 8d5:	85 d2                	test   %edx,%edx
+ 8d7:	74 47                	je     920 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 8d9:	8b 3a                	mov    (%edx),%edi
+ 8db:	89 3c 9d a0 0e 00 00 	mov    %edi,0xea0(,%ebx,4)
+ 8e2:	31 c0                	xor    %eax,%eax
+ 8e4:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 8eb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 8ee:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 8f1:	5b                   	pop    %ebx
+ 8f2:	5e                   	pop    %esi
+ 8f3:	5f                   	pop    %edi
+ 8f4:	5d                   	pop    %ebp
+ 8f5:	c3                   	ret
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ 900:	89 d0                	mov    %edx,%eax
+ 902:	e8 19 fe ff ff       	call   720 <bigalloc>
+ 907:	89 c2                	mov    %eax,%edx
+ 909:	89 d8                	mov    %ebx,%eax
+ 90b:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+  return p ? (void*)(p + 1) : 0;
+ 912:	85 d2                	test   %edx,%edx
+ 914:	75 d5                	jne    8eb <malloc+0x6b>
+ 916:	31 c0                	xor    %eax,%eax
+}
+ 918:	83 c4 1c             	add    $0x1c,%esp
+ 91b:	5b                   	pop    %ebx
+ 91c:	5e                   	pop    %esi
+ 91d:	5f                   	pop    %edi
+ 91e:	5d                   	pop    %ebp
+ 91f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ 920:	b8 00 02 00 00       	mov    $0x200,%eax
+ 925:	e8 f6 fd ff ff       	call   720 <bigalloc>
+ 92a:	85 c0                	test   %eax,%eax
+ 92c:	74 44                	je     972 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 92e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 935:	8b 14 9d a0 0e 00 00 	mov    0xea0(,%ebx,4),%edx
+ 93c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 93f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ 942:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ 948:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 94b:	39 cf                	cmp    %ecx,%edi
+ 94d:	72 8a                	jb     8d9 <malloc+0x59>
+ 94f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ 952:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 955:	8d 76 00             	lea    0x0(%esi),%esi
+ 958:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ 95a:	89 70 04             	mov    %esi,0x4(%eax)
+ 95d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 95f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ 961:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 963:	01 d8                	add    %ebx,%eax
+ 965:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ 968:	73 ee                	jae    958 <malloc+0xd8>
+ 96a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 96d:	e9 69 ff ff ff       	jmp    8db <malloc+0x5b>
+ 972:	f0 87 05 80 0e 00 00 	lock xchg %eax,0xe80
+  return p ? (void*)(p + 1) : 0;
+ 979:	31 c0                	xor    %eax,%eax
+ 97b:	eb 9b                	jmp    918 <malloc+0x98>
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	56                   	push   %esi
+ 984:	53                   	push   %ebx
+ 985:	8b 45 08             	mov    0x8(%ebp),%eax
+ 988:	f7 65 0c             	mull   0xc(%ebp)
+ 98b:	70 33                	jo     9c0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ 98d:	83 ec 0c             	sub    $0xc,%esp
+ 990:	89 c3                	mov    %eax,%ebx
+ 992:	50                   	push   %eax
+ 993:	e8 e8 fe ff ff       	call   880 <malloc>
+ 998:	83 c4 10             	add    $0x10,%esp
+ 99b:	89 c6                	mov    %eax,%esi
+ 99d:	85 c0                	test   %eax,%eax
+ 99f:	74 1f                	je     9c0 <calloc+0x40>
+    memset(p, 0, n);
+ 9a1:	83 ec 04             	sub    $0x4,%esp
+ 9a4:	53                   	push   %ebx
+ 9a5:	6a 00                	push   $0x0
+ 9a7:	50                   	push   %eax
+ 9a8:	e8 23 f7 ff ff       	call   d0 <memset>
+ 9ad:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9b3:	89 f0                	mov    %esi,%eax
+ 9b5:	5b                   	pop    %ebx
+ 9b6:	5e                   	pop    %esi
+ 9b7:	5d                   	pop    %ebp
+ 9b8:	c3                   	ret
+ 9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 9c3:	31 f6                	xor    %esi,%esi
+}
+ 9c5:	89 f0                	mov    %esi,%eax
+ 9c7:	5b                   	pop    %ebx
+ 9c8:	5e                   	pop    %esi
+ 9c9:	5d                   	pop    %ebp
+ 9ca:	c3                   	ret
+ 9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+
+000009d0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 0c             	sub    $0xc,%esp
+ 9d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ 9df:	85 db                	test   %ebx,%ebx
+ 9e1:	74 55                	je     a38 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ 9e3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ 9e6:	89 de                	mov    %ebx,%esi
+ 9e8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ 9ef:	39 c7                	cmp    %eax,%edi
+ 9f1:	72 0d                	jb     a00 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ 9f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f6:	89 f0                	mov    %esi,%eax
+ 9f8:	5b                   	pop    %ebx
+ 9f9:	5e                   	pop    %esi
+ 9fa:	5f                   	pop    %edi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a00:	83 ec 0c             	sub    $0xc,%esp
+ a03:	50                   	push   %eax
+ a04:	e8 77 fe ff ff       	call   880 <malloc>
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	89 c6                	mov    %eax,%esi
+ a0e:	85 c0                	test   %eax,%eax
+ a10:	74 e1                	je     9f3 <realloc+0x23>
+  memmove(p, ap, have);
+ a12:	83 ec 04             	sub    $0x4,%esp
+ a15:	57                   	push   %edi
+ a16:	53                   	push   %ebx
+ a17:	50                   	push   %eax
+ a18:	e8 03 f8 ff ff       	call   220 <memmove>
+  free(ap);
+ a1d:	89 1c 24             	mov    %ebx,(%esp)
+ a20:	e8 db fd ff ff       	call   800 <free>
+  return p;
+ a25:	83 c4 10             	add    $0x10,%esp
+}
+ a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a2b:	89 f0                	mov    %esi,%eax
+ a2d:	5b                   	pop    %ebx
+ a2e:	5e                   	pop    %esi
+ a2f:	5f                   	pop    %edi
+ a30:	5d                   	pop    %ebp
+ a31:	c3                   	ret
+ a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a38:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3e:	5b                   	pop    %ebx
+ a3f:	5e                   	pop    %esi
+ a40:	5f                   	pop    %edi
+ a41:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a42:	e9 39 fe ff ff       	jmp    880 <malloc>
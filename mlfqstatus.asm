@@ -0,0 +1,1849 @@
+
+_mlfqstatus:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct mlfqstat st;
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 24             	sub    $0x24,%esp
+    char *names[NQUEUE] = { "HIGHEST", "MEDIUM ", "LOWEST " };
+  14:	c7 45 dc 20 0c 00 00 	movl   $0xc20,-0x24(%ebp)
+  1b:	c7 45 e0 28 0c 00 00 	movl   $0xc28,-0x20(%ebp)
+  22:	c7 45 e4 30 0c 00 00 	movl   $0xc30,-0x1c(%ebp)
+    int i, j, n;
+
+    // The kernel only takes the snapshot; it is formatted here.
+    if(mlfqstatus(&st) < 0) {
+  29:	68 80 12 00 00       	push   $0x1280
+  2e:	e8 a0 04 00 00       	call   4d3 <mlfqstatus>
+  33:	83 c4 10             	add    $0x10,%esp
+  36:	85 c0                	test   %eax,%eax
+  38:	0f 88 c9 00 00 00    	js     107 <main+0x107>
+        printf(2, "mlfqstatus: failed\n");
+        exit();
+    }
+
+    printf(1, "=== MLFQ Status (tick %d) ===\n", st.tick);
+  3e:	50                   	push   %eax
+  3f:	ff 35 80 12 00 00    	push   0x1280
+  45:	68 64 0c 00 00       	push   $0xc64
+  4a:	6a 01                	push   $0x1
+  4c:	e8 6f 06 00 00       	call   6c0 <printf>
+    printf(1, "┌─────────────────────────────────┐\n");
+  51:	58                   	pop    %eax
+  52:	5a                   	pop    %edx
+  53:	68 84 0c 00 00       	push   $0xc84
+  58:	6a 01                	push   $0x1
+  5a:	e8 61 06 00 00       	call   6c0 <printf>
+    printf(1, "│           MLFQ STATUS           │\n");
+  5f:	59                   	pop    %ecx
+  60:	5b                   	pop    %ebx
+  61:	68 f0 0c 00 00       	push   $0xcf0
+  66:	6a 01                	push   $0x1
+  68:	e8 53 06 00 00       	call   6c0 <printf>
+    printf(1, "├─────────────────────────────────┤\n");
+  6d:	5e                   	pop    %esi
+  6e:	5f                   	pop    %edi
+  6f:	68 1c 0d 00 00       	push   $0xd1c
+  74:	6a 01                	push   $0x1
+    for(i = 0; i < NQUEUE; i++) {
+  76:	31 f6                	xor    %esi,%esi
+    printf(1, "├─────────────────────────────────┤\n");
+  78:	e8 43 06 00 00       	call   6c0 <printf>
+  7d:	83 c4 10             	add    $0x10,%esp
+        printf(1, "│ Queue %d (%s): %d processes", i,
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	ff 34 b5 90 12 00 00 	push   0x1290(,%esi,4)
+               i < 3 ? names[i] : "", st.count[i]);
+        n = 0;
+  8a:	31 db                	xor    %ebx,%ebx
+        printf(1, "│ Queue %d (%s): %d processes", i,
+  8c:	ff 74 b5 dc          	push   -0x24(%ebp,%esi,4)
+  90:	56                   	push   %esi
+  91:	68 88 0d 00 00       	push   $0xd88
+  96:	6a 01                	push   $0x1
+  98:	e8 23 06 00 00       	call   6c0 <printf>
+        if(st.count[i] > 0) {
+  9d:	8b 04 b5 90 12 00 00 	mov    0x1290(,%esi,4),%eax
+  a4:	83 c4 20             	add    $0x20,%esp
+  a7:	85 c0                	test   %eax,%eax
+  a9:	7f 6f                	jg     11a <main+0x11a>
+  ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+            printf(1, "]");
+            n = 8 + j * 3 + (st.count[i] > 4 ? 3 : 0);
+        }
+        // Pad to align the closing bracket
+        for(j = n; j < 33; j++)
+            printf(1, " ");
+  b0:	83 ec 08             	sub    $0x8,%esp
+        for(j = n; j < 33; j++)
+  b3:	83 c3 01             	add    $0x1,%ebx
+            printf(1, " ");
+  b6:	68 2e 0c 00 00       	push   $0xc2e
+  bb:	6a 01                	push   $0x1
+  bd:	e8 fe 05 00 00       	call   6c0 <printf>
+        for(j = n; j < 33; j++)
+  c2:	83 c4 10             	add    $0x10,%esp
+  c5:	83 fb 21             	cmp    $0x21,%ebx
+  c8:	75 e6                	jne    b0 <main+0xb0>
+        printf(1, "│\n");
+  ca:	83 ec 08             	sub    $0x8,%esp
+    for(i = 0; i < NQUEUE; i++) {
+  cd:	83 c6 01             	add    $0x1,%esi
+        printf(1, "│\n");
+  d0:	68 5e 0c 00 00       	push   $0xc5e
+  d5:	6a 01                	push   $0x1
+  d7:	e8 e4 05 00 00       	call   6c0 <printf>
+    for(i = 0; i < NQUEUE; i++) {
+  dc:	83 c4 10             	add    $0x10,%esp
+  df:	83 fe 03             	cmp    $0x3,%esi
+  e2:	75 9c                	jne    80 <main+0x80>
+    }
+    printf(1, "└─────────────────────────────────┘\n");
+  e4:	50                   	push   %eax
+  e5:	50                   	push   %eax
+  e6:	68 a8 0d 00 00       	push   $0xda8
+  eb:	6a 01                	push   $0x1
+  ed:	e8 ce 05 00 00       	call   6c0 <printf>
+
+    if(st.recording)
+  f2:	83 c4 10             	add    $0x10,%esp
+  f5:	83 3d 84 12 00 00 00 	cmpl   $0x0,0x1284
+  fc:	0f 85 9a 00 00 00    	jne    19c <main+0x19c>
+        printf(1, "Recording: %d transitions unread, %d dropped\n",
+               st.pending, st.dropped);
+    exit();
+ 102:	e8 1c 03 00 00       	call   423 <exit>
+        printf(2, "mlfqstatus: failed\n");
+ 107:	50                   	push   %eax
+ 108:	50                   	push   %eax
+ 109:	68 38 0c 00 00       	push   $0xc38
+ 10e:	6a 02                	push   $0x2
+ 110:	e8 ab 05 00 00       	call   6c0 <printf>
+        exit();
+ 115:	e8 09 03 00 00       	call   423 <exit>
+            printf(1, " [PIDs:");
+ 11a:	57                   	push   %edi
+ 11b:	57                   	push   %edi
+ 11c:	68 4c 0c 00 00       	push   $0xc4c
+ 121:	6a 01                	push   $0x1
+ 123:	e8 98 05 00 00       	call   6c0 <printf>
+            for(j = 0; j < st.count[i] && j < 4; j++)  // Show up to 4 PIDs
+ 128:	83 c4 10             	add    $0x10,%esp
+ 12b:	83 3c b5 90 12 00 00 	cmpl   $0x0,0x1290(,%esi,4)
+ 132:	00 
+ 133:	0f 8e 96 00 00 00    	jle    1cf <main+0x1cf>
+ 139:	89 f7                	mov    %esi,%edi
+ 13b:	c1 e7 08             	shl    $0x8,%edi
+                printf(1, " %d", st.pid[i][j]);
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	ff b4 9f 9c 12 00 00 	push   0x129c(%edi,%ebx,4)
+            for(j = 0; j < st.count[i] && j < 4; j++)  // Show up to 4 PIDs
+ 148:	83 c3 01             	add    $0x1,%ebx
+                printf(1, " %d", st.pid[i][j]);
+ 14b:	68 54 0c 00 00       	push   $0xc54
+ 150:	6a 01                	push   $0x1
+ 152:	e8 69 05 00 00       	call   6c0 <printf>
+            for(j = 0; j < st.count[i] && j < 4; j++)  // Show up to 4 PIDs
+ 157:	8b 04 b5 90 12 00 00 	mov    0x1290(,%esi,4),%eax
+ 15e:	83 c4 10             	add    $0x10,%esp
+ 161:	39 d8                	cmp    %ebx,%eax
+ 163:	7e 0a                	jle    16f <main+0x16f>
+ 165:	83 fb 04             	cmp    $0x4,%ebx
+ 168:	75 d4                	jne    13e <main+0x13e>
+            if(st.count[i] > 4)
+ 16a:	83 f8 04             	cmp    $0x4,%eax
+ 16d:	7f 4d                	jg     1bc <main+0x1bc>
+            printf(1, "]");
+ 16f:	52                   	push   %edx
+            n = 8 + j * 3 + (st.count[i] > 4 ? 3 : 0);
+ 170:	8d 1c 5b             	lea    (%ebx,%ebx,2),%ebx
+            printf(1, "]");
+ 173:	52                   	push   %edx
+ 174:	68 5c 0c 00 00       	push   $0xc5c
+ 179:	6a 01                	push   $0x1
+ 17b:	e8 40 05 00 00       	call   6c0 <printf>
+            n = 8 + j * 3 + (st.count[i] > 4 ? 3 : 0);
+ 180:	31 c0                	xor    %eax,%eax
+ 182:	83 c4 10             	add    $0x10,%esp
+ 185:	83 3c b5 90 12 00 00 	cmpl   $0x5,0x1290(,%esi,4)
+ 18c:	05 
+ 18d:	0f 9d c0             	setge  %al
+ 190:	8d 04 40             	lea    (%eax,%eax,2),%eax
+ 193:	8d 5c 18 08          	lea    0x8(%eax,%ebx,1),%ebx
+        for(j = n; j < 33; j++)
+ 197:	e9 14 ff ff ff       	jmp    b0 <main+0xb0>
+        printf(1, "Recording: %d transitions unread, %d dropped\n",
+ 19c:	ff 35 8c 12 00 00    	push   0x128c
+ 1a2:	ff 35 88 12 00 00    	push   0x1288
+ 1a8:	68 14 0e 00 00       	push   $0xe14
+ 1ad:	6a 01                	push   $0x1
+ 1af:	e8 0c 05 00 00       	call   6c0 <printf>
+ 1b4:	83 c4 10             	add    $0x10,%esp
+ 1b7:	e9 46 ff ff ff       	jmp    102 <main+0x102>
+                printf(1, "...");
+ 1bc:	51                   	push   %ecx
+ 1bd:	51                   	push   %ecx
+ 1be:	68 58 0c 00 00       	push   $0xc58
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 f6 04 00 00       	call   6c0 <printf>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+ 1cd:	eb a0                	jmp    16f <main+0x16f>
+            for(j = 0; j < st.count[i] && j < 4; j++)  // Show up to 4 PIDs
+ 1cf:	31 db                	xor    %ebx,%ebx
+ 1d1:	eb 9c                	jmp    16f <main+0x16f>
+ 1d3:	66 90                	xchg   %ax,%ax
+ 1d5:	66 90                	xchg   %ax,%ax
+ 1d7:	66 90                	xchg   %ax,%ax
+ 1d9:	66 90                	xchg   %ax,%ax
+ 1db:	66 90                	xchg   %ax,%ax
+ 1dd:	66 90                	xchg   %ax,%ax
+ 1df:	90                   	nop
+
+000001e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f7:	83 c0 01             	add    $0x1,%eax
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	75 f2                	jne    1f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 201:	89 c8                	mov    %ecx,%eax
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+ 205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 276:	80 3a 00             	cmpb   $0x0,(%edx)
+ 279:	74 15                	je     290 <strlen+0x20>
+ 27b:	31 c0                	xor    %eax,%eax
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 287:	89 c1                	mov    %eax,%ecx
+ 289:	75 f5                	jne    280 <strlen+0x10>
+    ;
+  return n;
+}
+ 28b:	89 c8                	mov    %ecx,%eax
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+ 28f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 290:	31 c9                	xor    %ecx,%ecx
+}
+ 292:	5d                   	pop    %ebp
+ 293:	89 c8                	mov    %ecx,%eax
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ad:	89 d7                	mov    %edx,%edi
+ 2af:	fc                   	cld
+ 2b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2b5:	89 d0                	mov    %edx,%eax
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	84 d2                	test   %dl,%dl
+ 2cf:	75 12                	jne    2e3 <strchr+0x23>
+ 2d1:	eb 1d                	jmp    2f0 <strchr+0x30>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2dc:	83 c0 01             	add    $0x1,%eax
+ 2df:	84 d2                	test   %dl,%dl
+ 2e1:	74 0d                	je     2f0 <strchr+0x30>
+    if(*s == c)
+ 2e3:	38 d1                	cmp    %dl,%cl
+ 2e5:	75 f1                	jne    2d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2f0:	31 c0                	xor    %eax,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 305:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 308:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 309:	31 db                	xor    %ebx,%ebx
+{
+ 30b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 30e:	eb 27                	jmp    337 <gets+0x37>
+    cc = read(0, &c, 1);
+ 310:	83 ec 04             	sub    $0x4,%esp
+ 313:	6a 01                	push   $0x1
+ 315:	56                   	push   %esi
+ 316:	6a 00                	push   $0x0
+ 318:	e8 1e 01 00 00       	call   43b <read>
+    if(cc < 1)
+ 31d:	83 c4 10             	add    $0x10,%esp
+ 320:	85 c0                	test   %eax,%eax
+ 322:	7e 1d                	jle    341 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 324:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 32f:	3c 0a                	cmp    $0xa,%al
+ 331:	74 10                	je     343 <gets+0x43>
+ 333:	3c 0d                	cmp    $0xd,%al
+ 335:	74 0c                	je     343 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 337:	89 df                	mov    %ebx,%edi
+ 339:	83 c3 01             	add    $0x1,%ebx
+ 33c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 33f:	7c cf                	jl     310 <gets+0x10>
+ 341:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 34a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 34d:	5b                   	pop    %ebx
+ 34e:	5e                   	pop    %esi
+ 34f:	5f                   	pop    %edi
+ 350:	5d                   	pop    %ebp
+ 351:	c3                   	ret
+ 352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 365:	83 ec 08             	sub    $0x8,%esp
+ 368:	6a 00                	push   $0x0
+ 36a:	ff 75 08             	push   0x8(%ebp)
+ 36d:	e8 f1 00 00 00       	call   463 <open>
+  if(fd < 0)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	78 27                	js     3a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 379:	83 ec 08             	sub    $0x8,%esp
+ 37c:	ff 75 0c             	push   0xc(%ebp)
+ 37f:	89 c3                	mov    %eax,%ebx
+ 381:	50                   	push   %eax
+ 382:	e8 f4 00 00 00       	call   47b <fstat>
+  close(fd);
+ 387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 38a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 38c:	e8 ba 00 00 00       	call   44b <close>
+  return r;
+ 391:	83 c4 10             	add    $0x10,%esp
+}
+ 394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 397:	89 f0                	mov    %esi,%eax
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3a5:	eb ed                	jmp    394 <stat+0x34>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3b7:	0f be 02             	movsbl (%edx),%eax
+ 3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3c5:	77 1e                	ja     3e5 <atoi+0x35>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3da:	0f be 02             	movsbl (%edx),%eax
+ 3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3e0:	80 fb 09             	cmp    $0x9,%bl
+ 3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+ 3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	7e 13                	jle    415 <memmove+0x25>
+ 402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 404:	89 d7                	mov    %edx,%edi
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 411:	39 f8                	cmp    %edi,%eax
+ 413:	75 fb                	jne    410 <memmove+0x20>
+  return vdst;
+}
+ 415:	5e                   	pop    %esi
+ 416:	89 d0                	mov    %edx,%eax
+ 418:	5f                   	pop    %edi
+ 419:	5d                   	pop    %ebp
+ 41a:	c3                   	ret
+
+0000041b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 41b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <exit>:
+SYSCALL(exit)
+ 423:	b8 02 00 00 00       	mov    $0x2,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <wait>:
+SYSCALL(wait)
+ 42b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <pipe>:
+SYSCALL(pipe)
+ 433:	b8 04 00 00 00       	mov    $0x4,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <read>:
+SYSCALL(read)
+ 43b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <write>:
+SYSCALL(write)
+ 443:	b8 10 00 00 00       	mov    $0x10,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <close>:
+SYSCALL(close)
+ 44b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <kill>:
+SYSCALL(kill)
+ 453:	b8 06 00 00 00       	mov    $0x6,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <exec>:
+SYSCALL(exec)
+ 45b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <open>:
+SYSCALL(open)
+ 463:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mknod>:
+SYSCALL(mknod)
+ 46b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <unlink>:
+SYSCALL(unlink)
+ 473:	b8 12 00 00 00       	mov    $0x12,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <fstat>:
+SYSCALL(fstat)
+ 47b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <link>:
+SYSCALL(link)
+ 483:	b8 13 00 00 00       	mov    $0x13,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <chdir>:
+SYSCALL(chdir)
+ 493:	b8 09 00 00 00       	mov    $0x9,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dup>:
+SYSCALL(dup)
+ 49b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getpid>:
+SYSCALL(getpid)
+ 4a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <sbrk>:
+SYSCALL(sbrk)
+ 4ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <sleep>:
+SYSCALL(sleep)
+ 4b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <uptime>:
+SYSCALL(uptime)
+ 4bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 4c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 4cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 4d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mlfqstart>:
+SYSCALL(mlfqstart)
+ 4db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 4e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 4eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 4f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <setpriority>:
+SYSCALL(setpriority)
+ 4fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <getcpustats>:
+SYSCALL(getcpustats)
+ 50b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <setscheduler>:
+SYSCALL(setscheduler)
+ 513:	b8 20 00 00 00       	mov    $0x20,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 51b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getscheduler>:
+SYSCALL(getscheduler)
+ 523:	b8 22 00 00 00       	mov    $0x22,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <splice>:
+SYSCALL(splice)
+ 52b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <readv>:
+SYSCALL(readv)
+ 533:	b8 24 00 00 00       	mov    $0x24,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <writev>:
+SYSCALL(writev)
+ 53b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <pread>:
+SYSCALL(pread)
+ 543:	b8 26 00 00 00       	mov    $0x26,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <pwrite>:
+SYSCALL(pwrite)
+ 54b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getlogstat>:
+SYSCALL(getlogstat)
+ 553:	b8 28 00 00 00       	mov    $0x28,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mount>:
+SYSCALL(mount)
+ 55b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <umount>:
+SYSCALL(umount)
+ 563:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mmap>:
+SYSCALL(mmap)
+ 56b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <munmap>:
+SYSCALL(munmap)
+ 573:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <membench>:
+SYSCALL(membench)
+ 57b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getlockstat>:
+SYSCALL(getlockstat)
+ 583:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <lockbench>:
+SYSCALL(lockbench)
+ 58b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <prof>:
+SYSCALL(prof)
+ 593:	b8 30 00 00 00       	mov    $0x30,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <tracectl>:
+SYSCALL(tracectl)
+ 59b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <traceread>:
+SYSCALL(traceread)
+ 5a3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <getsysstat>:
+SYSCALL(getsysstat)
+ 5ab:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 5b3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getschedwait>:
+SYSCALL(getschedwait)
+ 5bb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <mlfqread>:
+SYSCALL(mlfqread)
+ 5c3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <dllock>:
+SYSCALL(dllock)
+ 5cb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 5d3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <deadlocklog>:
+SYSCALL(deadlocklog)
+ 5db:	b8 39 00 00 00       	mov    $0x39,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <clone>:
+SYSCALL(clone)
+ 5e3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <join>:
+SYSCALL(join)
+ 5eb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <futex>:
+SYSCALL(futex)
+ 5f3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <shmat>:
+SYSCALL(shmat)
+ 5fb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <shmdt>:
+SYSCALL(shmdt)
+ 603:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <poll>:
+SYSCALL(poll)
+ 60b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+ 613:	66 90                	xchg   %ax,%ax
+ 615:	66 90                	xchg   %ax,%ax
+ 617:	66 90                	xchg   %ax,%ax
+ 619:	66 90                	xchg   %ax,%ax
+ 61b:	66 90                	xchg   %ax,%ax
+ 61d:	66 90                	xchg   %ax,%ax
+ 61f:	90                   	nop
+
+00000620 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 628:	89 d1                	mov    %edx,%ecx
+{
+ 62a:	83 ec 3c             	sub    $0x3c,%esp
+ 62d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 630:	85 d2                	test   %edx,%edx
+ 632:	0f 89 80 00 00 00    	jns    6b8 <printint+0x98>
+ 638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 63c:	74 7a                	je     6b8 <printint+0x98>
+    x = -xx;
+ 63e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 645:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 648:	31 f6                	xor    %esi,%esi
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	31 d2                	xor    %edx,%edx
+ 654:	89 f7                	mov    %esi,%edi
+ 656:	f7 f3                	div    %ebx
+ 658:	8d 76 01             	lea    0x1(%esi),%esi
+ 65b:	0f b6 92 a4 0e 00 00 	movzbl 0xea4(%edx),%edx
+ 662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 666:	89 ca                	mov    %ecx,%edx
+ 668:	89 c1                	mov    %eax,%ecx
+ 66a:	39 da                	cmp    %ebx,%edx
+ 66c:	73 e2                	jae    650 <printint+0x30>
+  if(neg)
+ 66e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 07                	je     67c <printint+0x5c>
+    buf[i++] = '-';
+ 675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 67a:	89 f7                	mov    %esi,%edi
+ 67c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 67f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 682:	01 df                	add    %ebx,%edi
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 688:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 691:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 694:	6a 01                	push   $0x1
+ 696:	50                   	push   %eax
+ 697:	56                   	push   %esi
+ 698:	e8 a6 fd ff ff       	call   443 <write>
+  while(--i >= 0)
+ 69d:	89 f8                	mov    %edi,%eax
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	83 ef 01             	sub    $0x1,%edi
+ 6a5:	39 d8                	cmp    %ebx,%eax
+ 6a7:	75 df                	jne    688 <printint+0x68>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6b8:	31 c0                	xor    %eax,%eax
+ 6ba:	eb 89                	jmp    645 <printint+0x25>
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	83 c6 01             	add    $0x1,%esi
+ 6d5:	84 db                	test   %bl,%bl
+ 6d7:	74 67                	je     740 <printf+0x80>
+ 6d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6dc:	31 d2                	xor    %edx,%edx
+ 6de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6e1:	eb 34                	jmp    717 <printf+0x57>
+ 6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6e7:	90                   	nop
+ 6e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6f0:	83 f8 25             	cmp    $0x25,%eax
+ 6f3:	74 18                	je     70d <printf+0x4d>
+  write(fd, &c, 1);
+ 6f5:	83 ec 04             	sub    $0x4,%esp
+ 6f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fe:	6a 01                	push   $0x1
+ 700:	50                   	push   %eax
+ 701:	57                   	push   %edi
+ 702:	e8 3c fd ff ff       	call   443 <write>
+ 707:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 70a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 70d:	0f b6 1e             	movzbl (%esi),%ebx
+ 710:	83 c6 01             	add    $0x1,%esi
+ 713:	84 db                	test   %bl,%bl
+ 715:	74 29                	je     740 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 d2                	test   %edx,%edx
+ 71c:	74 ca                	je     6e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 71e:	83 fa 25             	cmp    $0x25,%edx
+ 721:	75 ea                	jne    70d <printf+0x4d>
+      if(c == 'd'){
+ 723:	83 f8 25             	cmp    $0x25,%eax
+ 726:	0f 84 24 01 00 00    	je     850 <printf+0x190>
+ 72c:	83 e8 63             	sub    $0x63,%eax
+ 72f:	83 f8 15             	cmp    $0x15,%eax
+ 732:	77 1c                	ja     750 <printf+0x90>
+ 734:	ff 24 85 4c 0e 00 00 	jmp    *0xe4c(,%eax,4)
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 743:	5b                   	pop    %ebx
+ 744:	5e                   	pop    %esi
+ 745:	5f                   	pop    %edi
+ 746:	5d                   	pop    %ebp
+ 747:	c3                   	ret
+ 748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 756:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 75a:	6a 01                	push   $0x1
+ 75c:	52                   	push   %edx
+ 75d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 760:	57                   	push   %edi
+ 761:	e8 dd fc ff ff       	call   443 <write>
+ 766:	83 c4 0c             	add    $0xc,%esp
+ 769:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76c:	6a 01                	push   $0x1
+ 76e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 771:	52                   	push   %edx
+ 772:	57                   	push   %edi
+ 773:	e8 cb fc ff ff       	call   443 <write>
+        putc(fd, c);
+ 778:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77b:	31 d2                	xor    %edx,%edx
+ 77d:	eb 8e                	jmp    70d <printf+0x4d>
+ 77f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 00                	push   $0x0
+ 78f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 791:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 794:	e8 87 fe ff ff       	call   620 <printint>
+        ap++;
+ 799:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 79c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 67 ff ff ff       	jmp    70d <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7b5:	83 c0 04             	add    $0x4,%eax
+ 7b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7bb:	85 db                	test   %ebx,%ebx
+ 7bd:	0f 84 9d 00 00 00    	je     860 <printf+0x1a0>
+        while(*s != 0){
+ 7c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	0f 84 3d ff ff ff    	je     70d <printf+0x4d>
+ 7d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7d6:	89 de                	mov    %ebx,%esi
+ 7d8:	89 d3                	mov    %edx,%ebx
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	53                   	push   %ebx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 51 fc ff ff       	call   443 <write>
+        while(*s != 0){
+ 7f2:	0f b6 06             	movzbl (%esi),%eax
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 e4                	jne    7e0 <printf+0x120>
+      state = 0;
+ 7fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 07 ff ff ff       	jmp    70d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 01                	push   $0x1
+ 81f:	e9 6b ff ff ff       	jmp    78f <printf+0xcf>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 828:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 82b:	83 ec 04             	sub    $0x4,%esp
+ 82e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 831:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 833:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	52                   	push   %edx
+ 83c:	57                   	push   %edi
+ 83d:	e8 01 fc ff ff       	call   443 <write>
+        ap++;
+ 842:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 845:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 848:	31 d2                	xor    %edx,%edx
+ 84a:	e9 be fe ff ff       	jmp    70d <printf+0x4d>
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 856:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 859:	6a 01                	push   $0x1
+ 85b:	e9 11 ff ff ff       	jmp    771 <printf+0xb1>
+ 860:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 865:	bb 42 0e 00 00       	mov    $0xe42,%ebx
+ 86a:	e9 61 ff ff ff       	jmp    7d0 <printf+0x110>
+ 86f:	90                   	nop
+
+00000870 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 873:	a1 f4 15 00 00       	mov    0x15f4,%eax
+{
+ 878:	89 e5                	mov    %esp,%ebp
+ 87a:	56                   	push   %esi
+ 87b:	53                   	push   %ebx
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 880:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 882:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 884:	39 ca                	cmp    %ecx,%edx
+ 886:	73 30                	jae    8b8 <bigfree+0x48>
+ 888:	39 c1                	cmp    %eax,%ecx
+ 88a:	72 04                	jb     890 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88c:	39 c2                	cmp    %eax,%edx
+ 88e:	72 f0                	jb     880 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 890:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 893:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 896:	39 f0                	cmp    %esi,%eax
+ 898:	74 26                	je     8c0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 89a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 89c:	8b 42 04             	mov    0x4(%edx),%eax
+ 89f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8a2:	39 d9                	cmp    %ebx,%ecx
+ 8a4:	74 30                	je     8d6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8a6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8a8:	5b                   	pop    %ebx
+  freep = p;
+ 8a9:	89 15 f4 15 00 00    	mov    %edx,0x15f4
+}
+ 8af:	5e                   	pop    %esi
+ 8b0:	5d                   	pop    %ebp
+ 8b1:	c3                   	ret
+ 8b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b8:	39 c1                	cmp    %eax,%ecx
+ 8ba:	72 d0                	jb     88c <bigfree+0x1c>
+ 8bc:	eb c2                	jmp    880 <bigfree+0x10>
+ 8be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	03 58 04             	add    0x4(%eax),%ebx
+ 8c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c6:	8b 02                	mov    (%edx),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 8cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 8cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8d2:	39 d9                	cmp    %ebx,%ecx
+ 8d4:	75 d0                	jne    8a6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 8d6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 8d9:	89 15 f4 15 00 00    	mov    %edx,0x15f4
+    p->s.size += bp->s.size;
+ 8df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8e2:	8b 09                	mov    (%ecx),%ecx
+ 8e4:	89 0a                	mov    %ecx,(%edx)
+}
+ 8e6:	5b                   	pop    %ebx
+ 8e7:	5e                   	pop    %esi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008f0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	89 c7                	mov    %eax,%edi
+ 8f6:	56                   	push   %esi
+ 8f7:	53                   	push   %ebx
+ 8f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 8fb:	a1 f4 15 00 00       	mov    0x15f4,%eax
+ 900:	85 c0                	test   %eax,%eax
+ 902:	0f 84 88 00 00 00    	je     990 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 908:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 90a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 90d:	39 f9                	cmp    %edi,%ecx
+ 90f:	73 5f                	jae    970 <bigalloc+0x80>
+  if(nu < 4096)
+ 911:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 916:	39 df                	cmp    %ebx,%edi
+ 918:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 91b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 922:	eb 0d                	jmp    931 <bigalloc+0x41>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 928:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 92a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 92d:	39 f9                	cmp    %edi,%ecx
+ 92f:	73 3f                	jae    970 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 931:	89 d0                	mov    %edx,%eax
+ 933:	39 15 f4 15 00 00    	cmp    %edx,0x15f4
+ 939:	75 ed                	jne    928 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 93b:	83 ec 0c             	sub    $0xc,%esp
+ 93e:	56                   	push   %esi
+ 93f:	e8 67 fb ff ff       	call   4ab <sbrk>
+  if(p == (char*)-1)
+ 944:	83 c4 10             	add    $0x10,%esp
+ 947:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 94a:	74 11                	je     95d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 94c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 94f:	e8 1c ff ff ff       	call   870 <bigfree>
+  return freep;
+ 954:	a1 f4 15 00 00       	mov    0x15f4,%eax
+      if((p = morecore(nunits)) == 0)
+ 959:	85 c0                	test   %eax,%eax
+ 95b:	75 cb                	jne    928 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 95d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 960:	31 d2                	xor    %edx,%edx
+}
+ 962:	5b                   	pop    %ebx
+ 963:	89 d0                	mov    %edx,%eax
+ 965:	5e                   	pop    %esi
+ 966:	5f                   	pop    %edi
+ 967:	5d                   	pop    %ebp
+ 968:	c3                   	ret
+ 969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 970:	39 cf                	cmp    %ecx,%edi
+ 972:	74 4c                	je     9c0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 974:	29 f9                	sub    %edi,%ecx
+ 976:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 979:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 97c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 97f:	a3 f4 15 00 00       	mov    %eax,0x15f4
+}
+ 984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 987:	89 d0                	mov    %edx,%eax
+ 989:	5b                   	pop    %ebx
+ 98a:	5e                   	pop    %esi
+ 98b:	5f                   	pop    %edi
+ 98c:	5d                   	pop    %ebp
+ 98d:	c3                   	ret
+ 98e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 990:	c7 05 f4 15 00 00 f8 	movl   $0x15f8,0x15f4
+ 997:	15 00 00 
+    base.s.size = 0;
+ 99a:	ba f8 15 00 00       	mov    $0x15f8,%edx
+    base.s.ptr = freep = prevp = &base;
+ 99f:	c7 05 f8 15 00 00 f8 	movl   $0x15f8,0x15f8
+ 9a6:	15 00 00 
+    base.s.size = 0;
+ 9a9:	c7 05 fc 15 00 00 00 	movl   $0x0,0x15fc
+ 9b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9b3:	e9 59 ff ff ff       	jmp    911 <bigalloc+0x21>
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9c0:	8b 0a                	mov    (%edx),%ecx
+ 9c2:	89 08                	mov    %ecx,(%eax)
+ 9c4:	eb b9                	jmp    97f <bigalloc+0x8f>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <free>:
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	53                   	push   %ebx
+ 9d4:	83 ec 04             	sub    $0x4,%esp
+ 9d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 9da:	85 c9                	test   %ecx,%ecx
+ 9dc:	74 58                	je     a36 <free+0x66>
+  bp = (Header*)ap - 1;
+ 9de:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 9e1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 9f0:	89 d0                	mov    %edx,%eax
+ 9f2:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+  while(xchg(&locked, 1) != 0)
+ 9f9:	85 c0                	test   %eax,%eax
+ 9fb:	75 f3                	jne    9f0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 9fd:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ a00:	83 fa 40             	cmp    $0x40,%edx
+ a03:	77 3b                	ja     a40 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ a05:	83 fa 02             	cmp    $0x2,%edx
+ a08:	76 3f                	jbe    a49 <free+0x79>
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a10:	83 c0 01             	add    $0x1,%eax
+ a13:	39 14 85 c0 0e 00 00 	cmp    %edx,0xec0(,%eax,4)
+ a1a:	72 f4                	jb     a10 <free+0x40>
+    bp->s.ptr = classfree[c];
+ a1c:	8b 14 85 c0 15 00 00 	mov    0x15c0(,%eax,4),%edx
+    classfree[c] = bp;
+ a23:	89 1c 85 c0 15 00 00 	mov    %ebx,0x15c0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ a2a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ a2d:	31 c0                	xor    %eax,%eax
+ a2f:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+}
+ a36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a39:	c9                   	leave
+ a3a:	c3                   	ret
+ a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+    bigfree(bp);
+ a40:	89 d8                	mov    %ebx,%eax
+ a42:	e8 29 fe ff ff       	call   870 <bigfree>
+ a47:	eb e4                	jmp    a2d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ a49:	31 c0                	xor    %eax,%eax
+ a4b:	eb cf                	jmp    a1c <free+0x4c>
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a56:	89 e5                	mov    %esp,%ebp
+ a58:	57                   	push   %edi
+ a59:	56                   	push   %esi
+ a5a:	53                   	push   %ebx
+ a5b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a61:	8d 50 07             	lea    0x7(%eax),%edx
+ a64:	c1 ea 03             	shr    $0x3,%edx
+ a67:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a70:	89 c8                	mov    %ecx,%eax
+ a72:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+ a79:	85 c0                	test   %eax,%eax
+ a7b:	75 f3                	jne    a70 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ a7d:	89 c3                	mov    %eax,%ebx
+ a7f:	83 fa 40             	cmp    $0x40,%edx
+ a82:	77 4c                	ja     ad0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ a84:	be 02 00 00 00       	mov    $0x2,%esi
+ a89:	83 fa 02             	cmp    $0x2,%edx
+ a8c:	76 10                	jbe    a9e <malloc+0x4e>
+ a8e:	66 90                	xchg   %ax,%ax
+ a90:	83 c3 01             	add    $0x1,%ebx
+ a93:	8b 34 9d c0 0e 00 00 	mov    0xec0(,%ebx,4),%esi
+ a9a:	39 d6                	cmp    %edx,%esi
+ a9c:	72 f2                	jb     a90 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ a9e:	8b 14 9d c0 15 00 00 	mov    0x15c0(,%ebx,4),%edx
+ aa5:	85 d2                	test   %edx,%edx
+ aa7:	74 47                	je     af0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ aa9:	8b 3a                	mov    (%edx),%edi
+ aab:	89 3c 9d c0 15 00 00 	mov    %edi,0x15c0(,%ebx,4)
+ ab2:	31 c0                	xor    %eax,%eax
+ ab4:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ abb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ abe:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ ac1:	5b                   	pop    %ebx
+ ac2:	5e                   	pop    %esi
+ ac3:	5f                   	pop    %edi
+ ac4:	5d                   	pop    %ebp
+ ac5:	c3                   	ret
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ ad0:	89 d0                	mov    %edx,%eax
+ ad2:	e8 19 fe ff ff       	call   8f0 <bigalloc>
+ ad7:	89 c2                	mov    %eax,%edx
+ ad9:	89 d8                	mov    %ebx,%eax
+ adb:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+  return p ? (void*)(p + 1) : 0;
+ ae2:	85 d2                	test   %edx,%edx
+ ae4:	75 d5                	jne    abb <malloc+0x6b>
+ ae6:	31 c0                	xor    %eax,%eax
+}
+ ae8:	83 c4 1c             	add    $0x1c,%esp
+ aeb:	5b                   	pop    %ebx
+ aec:	5e                   	pop    %esi
+ aed:	5f                   	pop    %edi
+ aee:	5d                   	pop    %ebp
+ aef:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ af0:	b8 00 02 00 00       	mov    $0x200,%eax
+ af5:	e8 f6 fd ff ff       	call   8f0 <bigalloc>
+ afa:	85 c0                	test   %eax,%eax
+ afc:	74 44                	je     b42 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ afe:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ b05:	8b 14 9d c0 15 00 00 	mov    0x15c0(,%ebx,4),%edx
+ b0c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ b0f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ b12:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ b18:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ b1b:	39 cf                	cmp    %ecx,%edi
+ b1d:	72 8a                	jb     aa9 <malloc+0x59>
+ b1f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ b22:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ b25:	8d 76 00             	lea    0x0(%esi),%esi
+ b28:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ b2a:	89 70 04             	mov    %esi,0x4(%eax)
+ b2d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b2f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ b31:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b33:	01 d8                	add    %ebx,%eax
+ b35:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ b38:	73 ee                	jae    b28 <malloc+0xd8>
+ b3a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ b3d:	e9 69 ff ff ff       	jmp    aab <malloc+0x5b>
+ b42:	f0 87 05 a0 15 00 00 	lock xchg %eax,0x15a0
+  return p ? (void*)(p + 1) : 0;
+ b49:	31 c0                	xor    %eax,%eax
+ b4b:	eb 9b                	jmp    ae8 <malloc+0x98>
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	56                   	push   %esi
+ b54:	53                   	push   %ebx
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	f7 65 0c             	mull   0xc(%ebp)
+ b5b:	70 33                	jo     b90 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ b5d:	83 ec 0c             	sub    $0xc,%esp
+ b60:	89 c3                	mov    %eax,%ebx
+ b62:	50                   	push   %eax
+ b63:	e8 e8 fe ff ff       	call   a50 <malloc>
+ b68:	83 c4 10             	add    $0x10,%esp
+ b6b:	89 c6                	mov    %eax,%esi
+ b6d:	85 c0                	test   %eax,%eax
+ b6f:	74 1f                	je     b90 <calloc+0x40>
+    memset(p, 0, n);
+ b71:	83 ec 04             	sub    $0x4,%esp
+ b74:	53                   	push   %ebx
+ b75:	6a 00                	push   $0x0
+ b77:	50                   	push   %eax
+ b78:	e8 23 f7 ff ff       	call   2a0 <memset>
+ b7d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b83:	89 f0                	mov    %esi,%eax
+ b85:	5b                   	pop    %ebx
+ b86:	5e                   	pop    %esi
+ b87:	5d                   	pop    %ebp
+ b88:	c3                   	ret
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b93:	31 f6                	xor    %esi,%esi
+}
+ b95:	89 f0                	mov    %esi,%eax
+ b97:	5b                   	pop    %ebx
+ b98:	5e                   	pop    %esi
+ b99:	5d                   	pop    %ebp
+ b9a:	c3                   	ret
+ b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+
+00000ba0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 0c             	sub    $0xc,%esp
+ ba9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ baf:	85 db                	test   %ebx,%ebx
+ bb1:	74 55                	je     c08 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ bb3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ bb6:	89 de                	mov    %ebx,%esi
+ bb8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ bbf:	39 c7                	cmp    %eax,%edi
+ bc1:	72 0d                	jb     bd0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ bc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bc6:	89 f0                	mov    %esi,%eax
+ bc8:	5b                   	pop    %ebx
+ bc9:	5e                   	pop    %esi
+ bca:	5f                   	pop    %edi
+ bcb:	5d                   	pop    %ebp
+ bcc:	c3                   	ret
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ bd0:	83 ec 0c             	sub    $0xc,%esp
+ bd3:	50                   	push   %eax
+ bd4:	e8 77 fe ff ff       	call   a50 <malloc>
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	89 c6                	mov    %eax,%esi
+ bde:	85 c0                	test   %eax,%eax
+ be0:	74 e1                	je     bc3 <realloc+0x23>
+  memmove(p, ap, have);
+ be2:	83 ec 04             	sub    $0x4,%esp
+ be5:	57                   	push   %edi
+ be6:	53                   	push   %ebx
+ be7:	50                   	push   %eax
+ be8:	e8 03 f8 ff ff       	call   3f0 <memmove>
+  free(ap);
+ bed:	89 1c 24             	mov    %ebx,(%esp)
+ bf0:	e8 db fd ff ff       	call   9d0 <free>
+  return p;
+ bf5:	83 c4 10             	add    $0x10,%esp
+}
+ bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bfb:	89 f0                	mov    %esi,%eax
+ bfd:	5b                   	pop    %ebx
+ bfe:	5e                   	pop    %esi
+ bff:	5f                   	pop    %edi
+ c00:	5d                   	pop    %ebp
+ c01:	c3                   	ret
+ c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ c08:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c0e:	5b                   	pop    %ebx
+ c0f:	5e                   	pop    %esi
+ c10:	5f                   	pop    %edi
+ c11:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c12:	e9 39 fe ff ff       	jmp    a50 <malloc>
@@ -1,11 +1,49 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "param.h"
+#include "mlfqrec.h"
+
+struct mlfqstat st;
 
 int
 main(void)
 {
-    printf(1, "=== MLFQ Status ===\n");
-    mlfqstatus();   // system call to kernel
+    char *names[NQUEUE] = { "HIGHEST", "MEDIUM ", "LOWEST " };
+    int i, j, n;
+
+    // The kernel only takes the snapshot; it is formatted here.
+    if(mlfqstatus(&st) < 0) {
+        printf(2, "mlfqstatus: failed\n");
+        exit();
+    }
+
+    printf(1, "=== MLFQ Status (tick %d) ===\n", st.tick);
+    printf(1, "┌─────────────────────────────────┐\n");
+    printf(1, "│           MLFQ STATUS           │\n");
+    printf(1, "├─────────────────────────────────┤\n");
+    for(i = 0; i < NQUEUE; i++) {
+        printf(1, "│ Queue %d (%s): %d processes", i,
+               i < 3 ? names[i] : "", st.count[i]);
+        n = 0;
+        if(st.count[i] > 0) {
+            printf(1, " [PIDs:");
+            for(j = 0; j < st.count[i] && j < 4; j++)  // Show up to 4 PIDs
+                printf(1, " %d", st.pid[i][j]);
+            if(st.count[i] > 4)
+                printf(1, "...");
+            printf(1, "]");
+            n = 8 + j * 3 + (st.count[i] > 4 ? 3 : 0);
+        }
+        // Pad to align the closing bracket
+        for(j = n; j < 33; j++)
+            printf(1, " ");
+        printf(1, "│\n");
+    }
+    printf(1, "└─────────────────────────────────┘\n");
+
+    if(st.recording)
+        printf(1, "Recording: %d transitions unread, %d dropped\n",
+               st.pending, st.dropped);
     exit();
 }
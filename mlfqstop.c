@@ -3,6 +3,8 @@
 #include "user.h"
 
 int main(void) {
-    mlfqstop();
+    int dropped = mlfqstop();
+    if(dropped > 0)
+        printf(1, "mlfqstop: %d transitions were dropped\n", dropped);
     exit();
 }
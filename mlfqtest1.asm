@@ -0,0 +1,1741 @@
+
+_mlfqtest1:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+    
+    printf(1, "MLFQ Test 1: CPU-intensive process started (PID: %d)\n", getpid());
+    printf(1, "Starting in MLFQ Queue 0 (will demote based on CPU usage)\n");
+    
+    // CPU intensive loop to consume time slices
+    for(i = 0; i < 100000; i++) {
+   e:	31 db                	xor    %ebx,%ebx
+{
+  10:	51                   	push   %ecx
+    printf(1, "MLFQ Test 1: CPU-intensive process started (PID: %d)\n", getpid());
+  11:	e8 7d 03 00 00       	call   393 <getpid>
+  16:	83 ec 04             	sub    $0x4,%esp
+  19:	50                   	push   %eax
+  1a:	68 20 0b 00 00       	push   $0xb20
+  1f:	6a 01                	push   $0x1
+  21:	e8 8a 05 00 00       	call   5b0 <printf>
+    printf(1, "Starting in MLFQ Queue 0 (will demote based on CPU usage)\n");
+  26:	58                   	pop    %eax
+  27:	5a                   	pop    %edx
+  28:	68 58 0b 00 00       	push   $0xb58
+  2d:	6a 01                	push   $0x1
+  2f:	e8 7c 05 00 00       	call   5b0 <printf>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	eb 22                	jmp    5b <main+0x5b>
+  39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        for(j = 0; j < 1000; j++) {
+            // Busy wait to consume CPU time
+        }
+        if(i % 10000 == 0) {
+            printf(1, "MLFQ Test 1 (PID %d): iteration %d\n", getpid(), i);
+  40:	69 c3 1d e6 cb 0b    	imul   $0xbcbe61d,%ebx,%eax
+  46:	c1 c8 03             	ror    $0x3,%eax
+        }
+        // Sleep occasionally to allow other processes to run
+        if(i % 25000 == 0) {
+  49:	3d 16 9f 02 00       	cmp    $0x29f16,%eax
+  4e:	76 41                	jbe    91 <main+0x91>
+    for(i = 0; i < 100000; i++) {
+  50:	83 c3 01             	add    $0x1,%ebx
+  53:	81 fb a0 86 01 00    	cmp    $0x186a0,%ebx
+  59:	74 4e                	je     a9 <main+0xa9>
+    printf(1, "Starting in MLFQ Queue 0 (will demote based on CPU usage)\n");
+  5b:	69 c3 91 7e fb 3a    	imul   $0x3afb7e91,%ebx,%eax
+  61:	c1 c8 04             	ror    $0x4,%eax
+        if(i % 10000 == 0) {
+  64:	3d b8 8d 06 00       	cmp    $0x68db8,%eax
+  69:	77 d5                	ja     40 <main+0x40>
+            printf(1, "MLFQ Test 1 (PID %d): iteration %d\n", getpid(), i);
+  6b:	e8 23 03 00 00       	call   393 <getpid>
+  70:	53                   	push   %ebx
+  71:	50                   	push   %eax
+  72:	68 94 0b 00 00       	push   $0xb94
+  77:	6a 01                	push   $0x1
+  79:	e8 32 05 00 00       	call   5b0 <printf>
+  7e:	69 c3 1d e6 cb 0b    	imul   $0xbcbe61d,%ebx,%eax
+  84:	83 c4 10             	add    $0x10,%esp
+  87:	c1 c8 03             	ror    $0x3,%eax
+        if(i % 25000 == 0) {
+  8a:	3d 16 9f 02 00       	cmp    $0x29f16,%eax
+  8f:	77 bf                	ja     50 <main+0x50>
+            sleep(10);
+  91:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; i < 100000; i++) {
+  94:	83 c3 01             	add    $0x1,%ebx
+            sleep(10);
+  97:	6a 0a                	push   $0xa
+  99:	e8 05 03 00 00       	call   3a3 <sleep>
+  9e:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 100000; i++) {
+  a1:	81 fb a0 86 01 00    	cmp    $0x186a0,%ebx
+  a7:	75 b2                	jne    5b <main+0x5b>
+        }
+    }
+    
+    printf(1, "MLFQ Test 1 (PID %d): completed\n", getpid());
+  a9:	e8 e5 02 00 00       	call   393 <getpid>
+  ae:	83 ec 04             	sub    $0x4,%esp
+  b1:	50                   	push   %eax
+  b2:	68 b8 0b 00 00       	push   $0xbb8
+  b7:	6a 01                	push   $0x1
+  b9:	e8 f2 04 00 00       	call   5b0 <printf>
+    exit();
+  be:	e8 50 02 00 00       	call   313 <exit>
+  c3:	66 90                	xchg   %ax,%ax
+  c5:	66 90                	xchg   %ax,%ax
+  c7:	66 90                	xchg   %ax,%ax
+  c9:	66 90                	xchg   %ax,%ax
+  cb:	66 90                	xchg   %ax,%ax
+  cd:	66 90                	xchg   %ax,%ax
+  cf:	90                   	nop
+
+000000d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  d1:	31 c0                	xor    %eax,%eax
+{
+  d3:	89 e5                	mov    %esp,%ebp
+  d5:	53                   	push   %ebx
+  d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  e7:	83 c0 01             	add    $0x1,%eax
+  ea:	84 d2                	test   %dl,%dl
+  ec:	75 f2                	jne    e0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f1:	89 c8                	mov    %ecx,%eax
+  f3:	c9                   	leave
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	53                   	push   %ebx
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+ 107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 10a:	0f b6 02             	movzbl (%edx),%eax
+ 10d:	84 c0                	test   %al,%al
+ 10f:	75 17                	jne    128 <strcmp+0x28>
+ 111:	eb 3a                	jmp    14d <strcmp+0x4d>
+ 113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 117:	90                   	nop
+ 118:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 11c:	83 c2 01             	add    $0x1,%edx
+ 11f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 122:	84 c0                	test   %al,%al
+ 124:	74 1a                	je     140 <strcmp+0x40>
+    p++, q++;
+ 126:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 128:	0f b6 19             	movzbl (%ecx),%ebx
+ 12b:	38 c3                	cmp    %al,%bl
+ 12d:	74 e9                	je     118 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 12f:	29 d8                	sub    %ebx,%eax
+}
+ 131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 134:	c9                   	leave
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 140:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 144:	31 c0                	xor    %eax,%eax
+ 146:	29 d8                	sub    %ebx,%eax
+}
+ 148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 14b:	c9                   	leave
+ 14c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 14d:	0f b6 19             	movzbl (%ecx),%ebx
+ 150:	31 c0                	xor    %eax,%eax
+ 152:	eb db                	jmp    12f <strcmp+0x2f>
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 166:	80 3a 00             	cmpb   $0x0,(%edx)
+ 169:	74 15                	je     180 <strlen+0x20>
+ 16b:	31 c0                	xor    %eax,%eax
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+ 170:	83 c0 01             	add    $0x1,%eax
+ 173:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 177:	89 c1                	mov    %eax,%ecx
+ 179:	75 f5                	jne    170 <strlen+0x10>
+    ;
+  return n;
+}
+ 17b:	89 c8                	mov    %ecx,%eax
+ 17d:	5d                   	pop    %ebp
+ 17e:	c3                   	ret
+ 17f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 180:	31 c9                	xor    %ecx,%ecx
+}
+ 182:	5d                   	pop    %ebp
+ 183:	89 c8                	mov    %ecx,%eax
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 197:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 19a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19d:	89 d7                	mov    %edx,%edi
+ 19f:	fc                   	cld
+ 1a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1a5:	89 d0                	mov    %edx,%eax
+ 1a7:	c9                   	leave
+ 1a8:	c3                   	ret
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	84 d2                	test   %dl,%dl
+ 1bf:	75 12                	jne    1d3 <strchr+0x23>
+ 1c1:	eb 1d                	jmp    1e0 <strchr+0x30>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1cc:	83 c0 01             	add    $0x1,%eax
+ 1cf:	84 d2                	test   %dl,%dl
+ 1d1:	74 0d                	je     1e0 <strchr+0x30>
+    if(*s == c)
+ 1d3:	38 d1                	cmp    %dl,%cl
+ 1d5:	75 f1                	jne    1c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1d7:	5d                   	pop    %ebp
+ 1d8:	c3                   	ret
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1e0:	31 c0                	xor    %eax,%eax
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	c3                   	ret
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1f9:	31 db                	xor    %ebx,%ebx
+{
+ 1fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1fe:	eb 27                	jmp    227 <gets+0x37>
+    cc = read(0, &c, 1);
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	6a 01                	push   $0x1
+ 205:	56                   	push   %esi
+ 206:	6a 00                	push   $0x0
+ 208:	e8 1e 01 00 00       	call   32b <read>
+    if(cc < 1)
+ 20d:	83 c4 10             	add    $0x10,%esp
+ 210:	85 c0                	test   %eax,%eax
+ 212:	7e 1d                	jle    231 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 214:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 218:	8b 55 08             	mov    0x8(%ebp),%edx
+ 21b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 21f:	3c 0a                	cmp    $0xa,%al
+ 221:	74 10                	je     233 <gets+0x43>
+ 223:	3c 0d                	cmp    $0xd,%al
+ 225:	74 0c                	je     233 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 227:	89 df                	mov    %ebx,%edi
+ 229:	83 c3 01             	add    $0x1,%ebx
+ 22c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 22f:	7c cf                	jl     200 <gets+0x10>
+ 231:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 23a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 23d:	5b                   	pop    %ebx
+ 23e:	5e                   	pop    %esi
+ 23f:	5f                   	pop    %edi
+ 240:	5d                   	pop    %ebp
+ 241:	c3                   	ret
+ 242:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+ 254:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 255:	83 ec 08             	sub    $0x8,%esp
+ 258:	6a 00                	push   $0x0
+ 25a:	ff 75 08             	push   0x8(%ebp)
+ 25d:	e8 f1 00 00 00       	call   353 <open>
+  if(fd < 0)
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	85 c0                	test   %eax,%eax
+ 267:	78 27                	js     290 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 269:	83 ec 08             	sub    $0x8,%esp
+ 26c:	ff 75 0c             	push   0xc(%ebp)
+ 26f:	89 c3                	mov    %eax,%ebx
+ 271:	50                   	push   %eax
+ 272:	e8 f4 00 00 00       	call   36b <fstat>
+  close(fd);
+ 277:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 27a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 27c:	e8 ba 00 00 00       	call   33b <close>
+  return r;
+ 281:	83 c4 10             	add    $0x10,%esp
+}
+ 284:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 287:	89 f0                	mov    %esi,%eax
+ 289:	5b                   	pop    %ebx
+ 28a:	5e                   	pop    %esi
+ 28b:	5d                   	pop    %ebp
+ 28c:	c3                   	ret
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 290:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 295:	eb ed                	jmp    284 <stat+0x34>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2a7:	0f be 02             	movsbl (%edx),%eax
+ 2aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2b5:	77 1e                	ja     2d5 <atoi+0x35>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2c0:	83 c2 01             	add    $0x1,%edx
+ 2c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ca:	0f be 02             	movsbl (%edx),%eax
+ 2cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2d0:	80 fb 09             	cmp    $0x9,%bl
+ 2d3:	76 eb                	jbe    2c0 <atoi+0x20>
+  return n;
+}
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d8:	89 c8                	mov    %ecx,%eax
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ee:	85 c0                	test   %eax,%eax
+ 2f0:	7e 13                	jle    305 <memmove+0x25>
+ 2f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2f4:	89 d7                	mov    %edx,%edi
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 300:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 301:	39 f8                	cmp    %edi,%eax
+ 303:	75 fb                	jne    300 <memmove+0x20>
+  return vdst;
+}
+ 305:	5e                   	pop    %esi
+ 306:	89 d0                	mov    %edx,%eax
+ 308:	5f                   	pop    %edi
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+
+0000030b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 30b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <exit>:
+SYSCALL(exit)
+ 313:	b8 02 00 00 00       	mov    $0x2,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <wait>:
+SYSCALL(wait)
+ 31b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <pipe>:
+SYSCALL(pipe)
+ 323:	b8 04 00 00 00       	mov    $0x4,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <read>:
+SYSCALL(read)
+ 32b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <write>:
+SYSCALL(write)
+ 333:	b8 10 00 00 00       	mov    $0x10,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <close>:
+SYSCALL(close)
+ 33b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <kill>:
+SYSCALL(kill)
+ 343:	b8 06 00 00 00       	mov    $0x6,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <exec>:
+SYSCALL(exec)
+ 34b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <open>:
+SYSCALL(open)
+ 353:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mknod>:
+SYSCALL(mknod)
+ 35b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <unlink>:
+SYSCALL(unlink)
+ 363:	b8 12 00 00 00       	mov    $0x12,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <fstat>:
+SYSCALL(fstat)
+ 36b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <link>:
+SYSCALL(link)
+ 373:	b8 13 00 00 00       	mov    $0x13,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <mkdir>:
+SYSCALL(mkdir)
+ 37b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <chdir>:
+SYSCALL(chdir)
+ 383:	b8 09 00 00 00       	mov    $0x9,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <dup>:
+SYSCALL(dup)
+ 38b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getpid>:
+SYSCALL(getpid)
+ 393:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <sbrk>:
+SYSCALL(sbrk)
+ 39b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <sleep>:
+SYSCALL(sleep)
+ 3a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <uptime>:
+SYSCALL(uptime)
+ 3ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 3b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 3bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 3c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 3cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 3d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 3db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 3e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <setpriority>:
+SYSCALL(setpriority)
+ 3eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 3f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <getcpustats>:
+SYSCALL(getcpustats)
+ 3fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <setscheduler>:
+SYSCALL(setscheduler)
+ 403:	b8 20 00 00 00       	mov    $0x20,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 40b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getscheduler>:
+SYSCALL(getscheduler)
+ 413:	b8 22 00 00 00       	mov    $0x22,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <splice>:
+SYSCALL(splice)
+ 41b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <readv>:
+SYSCALL(readv)
+ 423:	b8 24 00 00 00       	mov    $0x24,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <writev>:
+SYSCALL(writev)
+ 42b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <pread>:
+SYSCALL(pread)
+ 433:	b8 26 00 00 00       	mov    $0x26,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <pwrite>:
+SYSCALL(pwrite)
+ 43b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getlogstat>:
+SYSCALL(getlogstat)
+ 443:	b8 28 00 00 00       	mov    $0x28,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mount>:
+SYSCALL(mount)
+ 44b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <umount>:
+SYSCALL(umount)
+ 453:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mmap>:
+SYSCALL(mmap)
+ 45b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <munmap>:
+SYSCALL(munmap)
+ 463:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <membench>:
+SYSCALL(membench)
+ 46b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getlockstat>:
+SYSCALL(getlockstat)
+ 473:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <lockbench>:
+SYSCALL(lockbench)
+ 47b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <prof>:
+SYSCALL(prof)
+ 483:	b8 30 00 00 00       	mov    $0x30,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <tracectl>:
+SYSCALL(tracectl)
+ 48b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <traceread>:
+SYSCALL(traceread)
+ 493:	b8 32 00 00 00       	mov    $0x32,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <getsysstat>:
+SYSCALL(getsysstat)
+ 49b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 4a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <getschedwait>:
+SYSCALL(getschedwait)
+ 4ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 4b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <dllock>:
+SYSCALL(dllock)
+ 4bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 4c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 4cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <clone>:
+SYSCALL(clone)
+ 4d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <join>:
+SYSCALL(join)
+ 4db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <futex>:
+SYSCALL(futex)
+ 4e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <shmat>:
+SYSCALL(shmat)
+ 4eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <shmdt>:
+SYSCALL(shmdt)
+ 4f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <poll>:
+SYSCALL(poll)
+ 4fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+ 503:	66 90                	xchg   %ax,%ax
+ 505:	66 90                	xchg   %ax,%ax
+ 507:	66 90                	xchg   %ax,%ax
+ 509:	66 90                	xchg   %ax,%ax
+ 50b:	66 90                	xchg   %ax,%ax
+ 50d:	66 90                	xchg   %ax,%ax
+ 50f:	90                   	nop
+
+00000510 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 518:	89 d1                	mov    %edx,%ecx
+{
+ 51a:	83 ec 3c             	sub    $0x3c,%esp
+ 51d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 520:	85 d2                	test   %edx,%edx
+ 522:	0f 89 80 00 00 00    	jns    5a8 <printint+0x98>
+ 528:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 52c:	74 7a                	je     5a8 <printint+0x98>
+    x = -xx;
+ 52e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 530:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 535:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 538:	31 f6                	xor    %esi,%esi
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 540:	89 c8                	mov    %ecx,%eax
+ 542:	31 d2                	xor    %edx,%edx
+ 544:	89 f7                	mov    %esi,%edi
+ 546:	f7 f3                	div    %ebx
+ 548:	8d 76 01             	lea    0x1(%esi),%esi
+ 54b:	0f b6 92 38 0c 00 00 	movzbl 0xc38(%edx),%edx
+ 552:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 556:	89 ca                	mov    %ecx,%edx
+ 558:	89 c1                	mov    %eax,%ecx
+ 55a:	39 da                	cmp    %ebx,%edx
+ 55c:	73 e2                	jae    540 <printint+0x30>
+  if(neg)
+ 55e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 561:	85 c0                	test   %eax,%eax
+ 563:	74 07                	je     56c <printint+0x5c>
+    buf[i++] = '-';
+ 565:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 56a:	89 f7                	mov    %esi,%edi
+ 56c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 56f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 572:	01 df                	add    %ebx,%edi
+ 574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 578:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 57b:	83 ec 04             	sub    $0x4,%esp
+ 57e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 581:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 584:	6a 01                	push   $0x1
+ 586:	50                   	push   %eax
+ 587:	56                   	push   %esi
+ 588:	e8 a6 fd ff ff       	call   333 <write>
+  while(--i >= 0)
+ 58d:	89 f8                	mov    %edi,%eax
+ 58f:	83 c4 10             	add    $0x10,%esp
+ 592:	83 ef 01             	sub    $0x1,%edi
+ 595:	39 d8                	cmp    %ebx,%eax
+ 597:	75 df                	jne    578 <printint+0x68>
+}
+ 599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 59c:	5b                   	pop    %ebx
+ 59d:	5e                   	pop    %esi
+ 59e:	5f                   	pop    %edi
+ 59f:	5d                   	pop    %ebp
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5a8:	31 c0                	xor    %eax,%eax
+ 5aa:	eb 89                	jmp    535 <printint+0x25>
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c2:	83 c6 01             	add    $0x1,%esi
+ 5c5:	84 db                	test   %bl,%bl
+ 5c7:	74 67                	je     630 <printf+0x80>
+ 5c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5cc:	31 d2                	xor    %edx,%edx
+ 5ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5d1:	eb 34                	jmp    607 <printf+0x57>
+ 5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5d7:	90                   	nop
+ 5d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5e0:	83 f8 25             	cmp    $0x25,%eax
+ 5e3:	74 18                	je     5fd <printf+0x4d>
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	50                   	push   %eax
+ 5f1:	57                   	push   %edi
+ 5f2:	e8 3c fd ff ff       	call   333 <write>
+ 5f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 600:	83 c6 01             	add    $0x1,%esi
+ 603:	84 db                	test   %bl,%bl
+ 605:	74 29                	je     630 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 607:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 60a:	85 d2                	test   %edx,%edx
+ 60c:	74 ca                	je     5d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 60e:	83 fa 25             	cmp    $0x25,%edx
+ 611:	75 ea                	jne    5fd <printf+0x4d>
+      if(c == 'd'){
+ 613:	83 f8 25             	cmp    $0x25,%eax
+ 616:	0f 84 24 01 00 00    	je     740 <printf+0x190>
+ 61c:	83 e8 63             	sub    $0x63,%eax
+ 61f:	83 f8 15             	cmp    $0x15,%eax
+ 622:	77 1c                	ja     640 <printf+0x90>
+ 624:	ff 24 85 e0 0b 00 00 	jmp    *0xbe0(,%eax,4)
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5f                   	pop    %edi
+ 636:	5d                   	pop    %ebp
+ 637:	c3                   	ret
+ 638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 646:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 64a:	6a 01                	push   $0x1
+ 64c:	52                   	push   %edx
+ 64d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 650:	57                   	push   %edi
+ 651:	e8 dd fc ff ff       	call   333 <write>
+ 656:	83 c4 0c             	add    $0xc,%esp
+ 659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65c:	6a 01                	push   $0x1
+ 65e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 661:	52                   	push   %edx
+ 662:	57                   	push   %edi
+ 663:	e8 cb fc ff ff       	call   333 <write>
+        putc(fd, c);
+ 668:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66b:	31 d2                	xor    %edx,%edx
+ 66d:	eb 8e                	jmp    5fd <printf+0x4d>
+ 66f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 673:	83 ec 0c             	sub    $0xc,%esp
+ 676:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 67b:	8b 13                	mov    (%ebx),%edx
+ 67d:	6a 00                	push   $0x0
+ 67f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 681:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 684:	e8 87 fe ff ff       	call   510 <printint>
+        ap++;
+ 689:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 68c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 67 ff ff ff       	jmp    5fd <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6a5:	83 c0 04             	add    $0x4,%eax
+ 6a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6ab:	85 db                	test   %ebx,%ebx
+ 6ad:	0f 84 9d 00 00 00    	je     750 <printf+0x1a0>
+        while(*s != 0){
+ 6b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	0f 84 3d ff ff ff    	je     5fd <printf+0x4d>
+ 6c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6c6:	89 de                	mov    %ebx,%esi
+ 6c8:	89 d3                	mov    %edx,%ebx
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	53                   	push   %ebx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 51 fc ff ff       	call   333 <write>
+        while(*s != 0){
+ 6e2:	0f b6 06             	movzbl (%esi),%eax
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 e4                	jne    6d0 <printf+0x120>
+      state = 0;
+ 6ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 07 ff ff ff       	jmp    5fd <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 01                	push   $0x1
+ 70f:	e9 6b ff ff ff       	jmp    67f <printf+0xcf>
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 718:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 721:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 723:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 726:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	52                   	push   %edx
+ 72c:	57                   	push   %edi
+ 72d:	e8 01 fc ff ff       	call   333 <write>
+        ap++;
+ 732:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 735:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 738:	31 d2                	xor    %edx,%edx
+ 73a:	e9 be fe ff ff       	jmp    5fd <printf+0x4d>
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 746:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 749:	6a 01                	push   $0x1
+ 74b:	e9 11 ff ff ff       	jmp    661 <printf+0xb1>
+ 750:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 755:	bb d9 0b 00 00       	mov    $0xbd9,%ebx
+ 75a:	e9 61 ff ff ff       	jmp    6c0 <printf+0x110>
+ 75f:	90                   	nop
+
+00000760 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 763:	a1 54 10 00 00       	mov    0x1054,%eax
+{
+ 768:	89 e5                	mov    %esp,%ebp
+ 76a:	56                   	push   %esi
+ 76b:	53                   	push   %ebx
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 770:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 772:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 774:	39 ca                	cmp    %ecx,%edx
+ 776:	73 30                	jae    7a8 <bigfree+0x48>
+ 778:	39 c1                	cmp    %eax,%ecx
+ 77a:	72 04                	jb     780 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 77c:	39 c2                	cmp    %eax,%edx
+ 77e:	72 f0                	jb     770 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 780:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 783:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 786:	39 f0                	cmp    %esi,%eax
+ 788:	74 26                	je     7b0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 78a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 78c:	8b 42 04             	mov    0x4(%edx),%eax
+ 78f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 792:	39 d9                	cmp    %ebx,%ecx
+ 794:	74 30                	je     7c6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 796:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 798:	5b                   	pop    %ebx
+  freep = p;
+ 799:	89 15 54 10 00 00    	mov    %edx,0x1054
+}
+ 79f:	5e                   	pop    %esi
+ 7a0:	5d                   	pop    %ebp
+ 7a1:	c3                   	ret
+ 7a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a8:	39 c1                	cmp    %eax,%ecx
+ 7aa:	72 d0                	jb     77c <bigfree+0x1c>
+ 7ac:	eb c2                	jmp    770 <bigfree+0x10>
+ 7ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7b0:	03 58 04             	add    0x4(%eax),%ebx
+ 7b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b6:	8b 02                	mov    (%edx),%eax
+ 7b8:	8b 00                	mov    (%eax),%eax
+ 7ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7c2:	39 d9                	cmp    %ebx,%ecx
+ 7c4:	75 d0                	jne    796 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 7c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 7c9:	89 15 54 10 00 00    	mov    %edx,0x1054
+    p->s.size += bp->s.size;
+ 7cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7d2:	8b 09                	mov    (%ecx),%ecx
+ 7d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7d6:	5b                   	pop    %ebx
+ 7d7:	5e                   	pop    %esi
+ 7d8:	5d                   	pop    %ebp
+ 7d9:	c3                   	ret
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007e0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	89 c7                	mov    %eax,%edi
+ 7e6:	56                   	push   %esi
+ 7e7:	53                   	push   %ebx
+ 7e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 7eb:	a1 54 10 00 00       	mov    0x1054,%eax
+ 7f0:	85 c0                	test   %eax,%eax
+ 7f2:	0f 84 88 00 00 00    	je     880 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 7fd:	39 f9                	cmp    %edi,%ecx
+ 7ff:	73 5f                	jae    860 <bigalloc+0x80>
+  if(nu < 4096)
+ 801:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 806:	39 df                	cmp    %ebx,%edi
+ 808:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 80b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 812:	eb 0d                	jmp    821 <bigalloc+0x41>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 818:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 81a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 81d:	39 f9                	cmp    %edi,%ecx
+ 81f:	73 3f                	jae    860 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 821:	89 d0                	mov    %edx,%eax
+ 823:	39 15 54 10 00 00    	cmp    %edx,0x1054
+ 829:	75 ed                	jne    818 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 82b:	83 ec 0c             	sub    $0xc,%esp
+ 82e:	56                   	push   %esi
+ 82f:	e8 67 fb ff ff       	call   39b <sbrk>
+  if(p == (char*)-1)
+ 834:	83 c4 10             	add    $0x10,%esp
+ 837:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 83a:	74 11                	je     84d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 83c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 83f:	e8 1c ff ff ff       	call   760 <bigfree>
+  return freep;
+ 844:	a1 54 10 00 00       	mov    0x1054,%eax
+      if((p = morecore(nunits)) == 0)
+ 849:	85 c0                	test   %eax,%eax
+ 84b:	75 cb                	jne    818 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 84d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 850:	31 d2                	xor    %edx,%edx
+}
+ 852:	5b                   	pop    %ebx
+ 853:	89 d0                	mov    %edx,%eax
+ 855:	5e                   	pop    %esi
+ 856:	5f                   	pop    %edi
+ 857:	5d                   	pop    %ebp
+ 858:	c3                   	ret
+ 859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 869:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 86c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 86f:	a3 54 10 00 00       	mov    %eax,0x1054
+}
+ 874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 877:	89 d0                	mov    %edx,%eax
+ 879:	5b                   	pop    %ebx
+ 87a:	5e                   	pop    %esi
+ 87b:	5f                   	pop    %edi
+ 87c:	5d                   	pop    %ebp
+ 87d:	c3                   	ret
+ 87e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 880:	c7 05 54 10 00 00 58 	movl   $0x1058,0x1054
+ 887:	10 00 00 
+    base.s.size = 0;
+ 88a:	ba 58 10 00 00       	mov    $0x1058,%edx
+    base.s.ptr = freep = prevp = &base;
+ 88f:	c7 05 58 10 00 00 58 	movl   $0x1058,0x1058
+ 896:	10 00 00 
+    base.s.size = 0;
+ 899:	c7 05 5c 10 00 00 00 	movl   $0x0,0x105c
+ 8a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8a3:	e9 59 ff ff ff       	jmp    801 <bigalloc+0x21>
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 0a                	mov    (%edx),%ecx
+ 8b2:	89 08                	mov    %ecx,(%eax)
+ 8b4:	eb b9                	jmp    86f <bigalloc+0x8f>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <free>:
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	53                   	push   %ebx
+ 8c4:	83 ec 04             	sub    $0x4,%esp
+ 8c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 8ca:	85 c9                	test   %ecx,%ecx
+ 8cc:	74 58                	je     926 <free+0x66>
+  bp = (Header*)ap - 1;
+ 8ce:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8d1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 8e0:	89 d0                	mov    %edx,%eax
+ 8e2:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+  while(xchg(&locked, 1) != 0)
+ 8e9:	85 c0                	test   %eax,%eax
+ 8eb:	75 f3                	jne    8e0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 8ed:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 8f0:	83 fa 40             	cmp    $0x40,%edx
+ 8f3:	77 3b                	ja     930 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 8f5:	83 fa 02             	cmp    $0x2,%edx
+ 8f8:	76 3f                	jbe    939 <free+0x79>
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 900:	83 c0 01             	add    $0x1,%eax
+ 903:	39 14 85 60 0c 00 00 	cmp    %edx,0xc60(,%eax,4)
+ 90a:	72 f4                	jb     900 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 90c:	8b 14 85 20 10 00 00 	mov    0x1020(,%eax,4),%edx
+    classfree[c] = bp;
+ 913:	89 1c 85 20 10 00 00 	mov    %ebx,0x1020(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 91a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 91d:	31 c0                	xor    %eax,%eax
+ 91f:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+}
+ 926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 929:	c9                   	leave
+ 92a:	c3                   	ret
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+    bigfree(bp);
+ 930:	89 d8                	mov    %ebx,%eax
+ 932:	e8 29 fe ff ff       	call   760 <bigfree>
+ 937:	eb e4                	jmp    91d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 939:	31 c0                	xor    %eax,%eax
+ 93b:	eb cf                	jmp    90c <free+0x4c>
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 946:	89 e5                	mov    %esp,%ebp
+ 948:	57                   	push   %edi
+ 949:	56                   	push   %esi
+ 94a:	53                   	push   %ebx
+ 94b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 94e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 951:	8d 50 07             	lea    0x7(%eax),%edx
+ 954:	c1 ea 03             	shr    $0x3,%edx
+ 957:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 960:	89 c8                	mov    %ecx,%eax
+ 962:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+ 969:	85 c0                	test   %eax,%eax
+ 96b:	75 f3                	jne    960 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 96d:	89 c3                	mov    %eax,%ebx
+ 96f:	83 fa 40             	cmp    $0x40,%edx
+ 972:	77 4c                	ja     9c0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 974:	be 02 00 00 00       	mov    $0x2,%esi
+ 979:	83 fa 02             	cmp    $0x2,%edx
+ 97c:	76 10                	jbe    98e <malloc+0x4e>
+ 97e:	66 90                	xchg   %ax,%ax
+ 980:	83 c3 01             	add    $0x1,%ebx
+ 983:	8b 34 9d 60 0c 00 00 	mov    0xc60(,%ebx,4),%esi
+ 98a:	39 d6                	cmp    %edx,%esi
+ 98c:	72 f2                	jb     980 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 98e:	8b 14 9d 20 10 00 00 	mov    0x1020(,%ebx,4),%edx
+ 995:	85 d2                	test   %edx,%edx
+ 997:	74 47                	je     9e0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 999:	8b 3a                	mov    (%edx),%edi
+ 99b:	89 3c 9d 20 10 00 00 	mov    %edi,0x1020(,%ebx,4)
+ 9a2:	31 c0                	xor    %eax,%eax
+ 9a4:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 9ab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 9ae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 9b1:	5b                   	pop    %ebx
+ 9b2:	5e                   	pop    %esi
+ 9b3:	5f                   	pop    %edi
+ 9b4:	5d                   	pop    %ebp
+ 9b5:	c3                   	ret
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ 9c0:	89 d0                	mov    %edx,%eax
+ 9c2:	e8 19 fe ff ff       	call   7e0 <bigalloc>
+ 9c7:	89 c2                	mov    %eax,%edx
+ 9c9:	89 d8                	mov    %ebx,%eax
+ 9cb:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+  return p ? (void*)(p + 1) : 0;
+ 9d2:	85 d2                	test   %edx,%edx
+ 9d4:	75 d5                	jne    9ab <malloc+0x6b>
+ 9d6:	31 c0                	xor    %eax,%eax
+}
+ 9d8:	83 c4 1c             	add    $0x1c,%esp
+ 9db:	5b                   	pop    %ebx
+ 9dc:	5e                   	pop    %esi
+ 9dd:	5f                   	pop    %edi
+ 9de:	5d                   	pop    %ebp
+ 9df:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ 9e0:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9e5:	e8 f6 fd ff ff       	call   7e0 <bigalloc>
+ 9ea:	85 c0                	test   %eax,%eax
+ 9ec:	74 44                	je     a32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 9ee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 9f5:	8b 14 9d 20 10 00 00 	mov    0x1020(,%ebx,4),%edx
+ 9fc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 9ff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ a02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ a08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ a0b:	39 cf                	cmp    %ecx,%edi
+ a0d:	72 8a                	jb     999 <malloc+0x59>
+ a0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ a12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ a15:	8d 76 00             	lea    0x0(%esi),%esi
+ a18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ a1a:	89 70 04             	mov    %esi,0x4(%eax)
+ a1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ a21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a23:	01 d8                	add    %ebx,%eax
+ a25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ a28:	73 ee                	jae    a18 <malloc+0xd8>
+ a2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ a2d:	e9 69 ff ff ff       	jmp    99b <malloc+0x5b>
+ a32:	f0 87 05 00 10 00 00 	lock xchg %eax,0x1000
+  return p ? (void*)(p + 1) : 0;
+ a39:	31 c0                	xor    %eax,%eax
+ a3b:	eb 9b                	jmp    9d8 <malloc+0x98>
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	56                   	push   %esi
+ a44:	53                   	push   %ebx
+ a45:	8b 45 08             	mov    0x8(%ebp),%eax
+ a48:	f7 65 0c             	mull   0xc(%ebp)
+ a4b:	70 33                	jo     a80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ a4d:	83 ec 0c             	sub    $0xc,%esp
+ a50:	89 c3                	mov    %eax,%ebx
+ a52:	50                   	push   %eax
+ a53:	e8 e8 fe ff ff       	call   940 <malloc>
+ a58:	83 c4 10             	add    $0x10,%esp
+ a5b:	89 c6                	mov    %eax,%esi
+ a5d:	85 c0                	test   %eax,%eax
+ a5f:	74 1f                	je     a80 <calloc+0x40>
+    memset(p, 0, n);
+ a61:	83 ec 04             	sub    $0x4,%esp
+ a64:	53                   	push   %ebx
+ a65:	6a 00                	push   $0x0
+ a67:	50                   	push   %eax
+ a68:	e8 23 f7 ff ff       	call   190 <memset>
+ a6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a73:	89 f0                	mov    %esi,%eax
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5d                   	pop    %ebp
+ a78:	c3                   	ret
+ a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a83:	31 f6                	xor    %esi,%esi
+}
+ a85:	89 f0                	mov    %esi,%eax
+ a87:	5b                   	pop    %ebx
+ a88:	5e                   	pop    %esi
+ a89:	5d                   	pop    %ebp
+ a8a:	c3                   	ret
+ a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+
+00000a90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 0c             	sub    $0xc,%esp
+ a99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a9f:	85 db                	test   %ebx,%ebx
+ aa1:	74 55                	je     af8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ aa3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ aa6:	89 de                	mov    %ebx,%esi
+ aa8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ aaf:	39 c7                	cmp    %eax,%edi
+ ab1:	72 0d                	jb     ac0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ab6:	89 f0                	mov    %esi,%eax
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ac0:	83 ec 0c             	sub    $0xc,%esp
+ ac3:	50                   	push   %eax
+ ac4:	e8 77 fe ff ff       	call   940 <malloc>
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	89 c6                	mov    %eax,%esi
+ ace:	85 c0                	test   %eax,%eax
+ ad0:	74 e1                	je     ab3 <realloc+0x23>
+  memmove(p, ap, have);
+ ad2:	83 ec 04             	sub    $0x4,%esp
+ ad5:	57                   	push   %edi
+ ad6:	53                   	push   %ebx
+ ad7:	50                   	push   %eax
+ ad8:	e8 03 f8 ff ff       	call   2e0 <memmove>
+  free(ap);
+ add:	89 1c 24             	mov    %ebx,(%esp)
+ ae0:	e8 db fd ff ff       	call   8c0 <free>
+  return p;
+ ae5:	83 c4 10             	add    $0x10,%esp
+}
+ ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aeb:	89 f0                	mov    %esi,%eax
+ aed:	5b                   	pop    %ebx
+ aee:	5e                   	pop    %esi
+ aef:	5f                   	pop    %edi
+ af0:	5d                   	pop    %ebp
+ af1:	c3                   	ret
+ af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ af8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afe:	5b                   	pop    %ebx
+ aff:	5e                   	pop    %esi
+ b00:	5f                   	pop    %edi
+ b01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b02:	e9 39 fe ff ff       	jmp    940 <malloc>
@@ -1,28 +1,124 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "param.h"
+#include "mlfqrec.h"
+
+#define NWORKER 5
+
+// The level of every process the recorder has told us about.
+struct {
+    int pid;
+    int level;
+} live[NPROC];
+
+#define NREC 64
+
+// Give up waiting for exit records after this many reads in a
+// row find nothing; a worker may sit in Q2 without a transition
+// until the next priority boost.
+#define MAXIDLE (2 * BOOST_INTERVAL_TICKS / 10)
+
+struct mlfqrec rec[NREC];
+struct mlfqstat st;
+uint tick;
+int nworker, nexited;
+int workers[NWORKER];
+
+// Apply one transition to live[].
+void
+apply(struct mlfqrec *r)
+{
+    int i, slot;
+
+    slot = -1;
+    for(i = 0; i < NPROC; i++) {
+        if(live[i].pid == r->pid)
+            break;
+        if(slot < 0 && live[i].pid == 0)
+            slot = i;
+    }
+    if(i == NPROC)
+        i = slot;
+    if(i < 0)
+        return;
+    if(r->to == MLFQ_NONE) {
+        live[i].pid = 0;
+    } else {
+        live[i].pid = r->pid;
+        live[i].level = r->to;
+    }
+}
+
+// Print one transition, followed by the queues after it.
+void
+show(struct mlfqrec *r)
+{
+    int i, q;
+
+    printf(1, "%d\tpid %d\t", tick, r->pid);
+    if(r->from == MLFQ_NONE)
+        printf(1, "new  -> Q%d", r->to);
+    else if(r->to == MLFQ_NONE)
+        printf(1, "Q%d -> exit", r->from);
+    else
+        printf(1, "Q%d -> Q%d  ", r->from, r->to);
+    for(q = 0; q < NQUEUE; q++) {
+        printf(1, "  | Q%d:", q);
+        for(i = 0; i < NPROC; i++)
+            if(live[i].pid && live[i].level == q)
+                printf(1, " %d", live[i].pid);
+    }
+    printf(1, "\n");
+}
+
+// Read and show every transition recorded so far.
+// Returns the number of records read.
+int
+drain(void)
+{
+    int i, j, n, total;
+
+    total = 0;
+    while((n = mlfqread(rec, NREC, &tick)) > 0) {
+        total += n;
+        for(i = 0; i < n; i++) {
+            tick += rec[i].dtick;
+            if(rec[i].pid == 0)
+                continue;
+            apply(&rec[i]);
+            show(&rec[i]);
+            if(rec[i].to == MLFQ_NONE)
+                for(j = 0; j < nworker; j++)
+                    if(workers[j] == rec[i].pid)
+                        nexited++;
+        }
+    }
+    return total;
+}
 
 int
 main(void)
 {
-    int i, pid;
+    int i, pid, dropped, idle;
     
     printf(1, "\n");
     printf(1, "========================================\n");
     printf(1, "    MLFQ VISUAL DEMONSTRATION\n");
     printf(1, "========================================\n");
     printf(1, "Time slices: Queue 0=5 ticks, Queue 1=10 ticks, Queue 2=20 ticks\n");
-    printf(1, "Spawning 5 worker processes...\n");
+    printf(1, "Spawning %d worker processes...\n", NWORKER);
     printf(1, "========================================\n\n");
     
-    // Fork 5 worker processes
-    for(i = 0; i < 5; i++) {
+    mlfqstart();
+
+    // Fork the worker processes
+    for(i = 0; i < NWORKER; i++) {
         pid = fork();
         if(pid == 0) {
             // Child process - run CPU intensive work
             int j, k;
             
-            // CPU intensive loop with minimal output to avoid conflicts
             for(j = 0; j < 200000; j++) {
                 // Busy work
                 for(k = 0; k < 5000; k++) {
@@ -38,20 +134,34 @@ main(void)
             exit();
         } else if(pid < 0) {
             printf(1, "Fork failed for worker %d\n", i+1);
+        } else {
+            workers[nworker++] = pid;
         }
     }
     
-    printf(1, "All workers spawned! Monitoring MLFQ status...\n\n");
+    printf(1, "TICK\tPROCESS\tTRANSITION  | QUEUES AFTERWARDS\n");
     
-    // Parent process - monitor MLFQ status with clear formatting
-    for(i = 0; i < 8; i++) {
-        printf(1, "--- Time: %d seconds ---\n", i*2);
-        mlfqrealtime();  // Use real-time status instead of recorded data
-        printf(1, "\n");
-        
-        // Wait 2 seconds before next check
-        sleep(2);
+    // Show the transitions as they happen, until every worker
+    // has exited. Recording runs as long as we keep reading.
+    // An exit record may have been dropped, so also stop once
+    // any record has been, or nothing has come for a long time;
+    // wait() then collects the remaining workers.
+    idle = 0;
+    while(nexited < nworker && idle < MAXIDLE) {
+        if(drain() > 0)
+            idle = 0;
+        else
+            idle++;
+        if(mlfqstatus(&st) == 0 && st.dropped > 0)
+            break;
+        sleep(10);
     }
+    for(i = 0; i < nworker; i++)
+        wait();
+    dropped = mlfqstop();
+    drain();
+    if(dropped > 0)
+        printf(1, "(%d transitions were dropped)\n", dropped);
     
     printf(1, "========================================\n");
     printf(1, "    MLFQ DEMONSTRATION COMPLETE\n");
@@ -0,0 +1,10 @@
+// Memory-mapped files: mmap() protection and flags.
+// Both the kernel and user programs use this header file.
+
+#define PROT_READ    0x1  // pages may be read
+#define PROT_WRITE   0x2  // pages may be written (MAP_PRIVATE only)
+
+#define MAP_SHARED   0x1  // share the file's pages (read-only)
+#define MAP_PRIVATE  0x2  // copy pages on first write
+
+#define MAP_FAILED   ((void*)-1)
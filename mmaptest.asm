@@ -0,0 +1,2375 @@
+
+_mmaptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "bad args test ok\n");
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  makefile();
+      11:	e8 9a 00 00 00       	call   b0 <makefile>
+  sharedtest();
+      16:	e8 65 01 00 00       	call   180 <sharedtest>
+  privatetest();
+      1b:	e8 f0 03 00 00       	call   410 <privatetest>
+  badtest();
+      20:	e8 1b 06 00 00       	call   640 <badtest>
+  unlink("mmaptest.f");
+      25:	83 ec 0c             	sub    $0xc,%esp
+      28:	68 f5 11 00 00       	push   $0x11f5
+      2d:	e8 f1 09 00 00       	call   a23 <unlink>
+  printf(1, "mmaptest ok\n");
+      32:	58                   	pop    %eax
+      33:	5a                   	pop    %edx
+      34:	68 a4 13 00 00       	push   $0x13a4
+      39:	6a 01                	push   $0x1
+      3b:	e8 30 0c 00 00       	call   c70 <printf>
+  exit();
+      40:	e8 8e 09 00 00       	call   9d3 <exit>
+      45:	66 90                	xchg   %ax,%ax
+      47:	66 90                	xchg   %ax,%ax
+      49:	66 90                	xchg   %ax,%ax
+      4b:	66 90                	xchg   %ax,%ax
+      4d:	66 90                	xchg   %ax,%ax
+      4f:	90                   	nop
+
+00000050 <fail>:
+{
+      50:	55                   	push   %ebp
+      51:	89 e5                	mov    %esp,%ebp
+      53:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "mmaptest: %s failed\n", msg);
+      56:	ff 75 08             	push   0x8(%ebp)
+      59:	68 e0 11 00 00       	push   $0x11e0
+      5e:	6a 01                	push   $0x1
+      60:	e8 0b 0c 00 00       	call   c70 <printf>
+  unlink("mmaptest.f");
+      65:	c7 04 24 f5 11 00 00 	movl   $0x11f5,(%esp)
+      6c:	e8 b2 09 00 00       	call   a23 <unlink>
+  exit();
+      71:	e8 5d 09 00 00       	call   9d3 <exit>
+      76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000080 <expect>:
+{
+      80:	55                   	push   %ebp
+  return 'a' + i % 23;
+      81:	b8 c9 42 16 b2       	mov    $0xb21642c9,%eax
+{
+      86:	89 e5                	mov    %esp,%ebp
+      88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+}
+      8b:	5d                   	pop    %ebp
+  return 'a' + i % 23;
+      8c:	f7 e9                	imul   %ecx
+      8e:	89 c8                	mov    %ecx,%eax
+      90:	c1 f8 1f             	sar    $0x1f,%eax
+      93:	01 ca                	add    %ecx,%edx
+      95:	c1 fa 04             	sar    $0x4,%edx
+      98:	29 c2                	sub    %eax,%edx
+      9a:	6b d2 17             	imul   $0x17,%edx,%edx
+      9d:	29 d1                	sub    %edx,%ecx
+      9f:	8d 41 61             	lea    0x61(%ecx),%eax
+}
+      a2:	c3                   	ret
+      a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000b0 <makefile>:
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	57                   	push   %edi
+      b4:	56                   	push   %esi
+      b5:	53                   	push   %ebx
+      b6:	83 ec 24             	sub    $0x24,%esp
+  if((fd = open("mmaptest.f", O_CREATE|O_RDWR)) < 0)
+      b9:	68 02 02 00 00       	push   $0x202
+      be:	68 f5 11 00 00       	push   $0x11f5
+      c3:	e8 4b 09 00 00       	call   a13 <open>
+      c8:	83 c4 10             	add    $0x10,%esp
+      cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      ce:	85 c0                	test   %eax,%eax
+      d0:	0f 88 85 00 00 00    	js     15b <makefile+0xab>
+  for(i = 0; i < FSIZE; i += n){
+      d6:	31 f6                	xor    %esi,%esi
+      d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      df:	90                   	nop
+    n = FSIZE - i < sizeof(buf) ? FSIZE - i : sizeof(buf);
+      e0:	bf 64 30 00 00       	mov    $0x3064,%edi
+      e5:	b8 00 10 00 00       	mov    $0x1000,%eax
+      ea:	29 f7                	sub    %esi,%edi
+      ec:	39 c7                	cmp    %eax,%edi
+      ee:	0f 47 f8             	cmova  %eax,%edi
+    for(j = 0; j < n; j++)
+      f1:	31 db                	xor    %ebx,%ebx
+      f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      f7:	90                   	nop
+      buf[j] = expect(i + j);
+      f8:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  return 'a' + i % 23;
+      fb:	b8 c9 42 16 b2       	mov    $0xb21642c9,%eax
+    for(j = 0; j < n; j++)
+     100:	83 c3 01             	add    $0x1,%ebx
+  return 'a' + i % 23;
+     103:	f7 e9                	imul   %ecx
+     105:	89 c8                	mov    %ecx,%eax
+     107:	c1 f8 1f             	sar    $0x1f,%eax
+     10a:	01 ca                	add    %ecx,%edx
+     10c:	c1 fa 04             	sar    $0x4,%edx
+     10f:	29 c2                	sub    %eax,%edx
+     111:	6b d2 17             	imul   $0x17,%edx,%edx
+     114:	29 d1                	sub    %edx,%ecx
+     116:	83 c1 61             	add    $0x61,%ecx
+     119:	88 8b ff 18 00 00    	mov    %cl,0x18ff(%ebx)
+    for(j = 0; j < n; j++)
+     11f:	39 df                	cmp    %ebx,%edi
+     121:	7f d5                	jg     f8 <makefile+0x48>
+    if(write(fd, buf, n) != n)
+     123:	83 ec 04             	sub    $0x4,%esp
+     126:	57                   	push   %edi
+     127:	68 00 19 00 00       	push   $0x1900
+     12c:	ff 75 e4             	push   -0x1c(%ebp)
+     12f:	e8 bf 08 00 00       	call   9f3 <write>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	39 f8                	cmp    %edi,%eax
+     139:	75 35                	jne    170 <makefile+0xc0>
+  for(i = 0; i < FSIZE; i += n){
+     13b:	01 fe                	add    %edi,%esi
+     13d:	81 fe 63 30 00 00    	cmp    $0x3063,%esi
+     143:	7e 9b                	jle    e0 <makefile+0x30>
+  close(fd);
+     145:	83 ec 0c             	sub    $0xc,%esp
+     148:	ff 75 e4             	push   -0x1c(%ebp)
+     14b:	e8 ab 08 00 00       	call   9fb <close>
+}
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     156:	5b                   	pop    %ebx
+     157:	5e                   	pop    %esi
+     158:	5f                   	pop    %edi
+     159:	5d                   	pop    %ebp
+     15a:	c3                   	ret
+    fail("create");
+     15b:	83 ec 0c             	sub    $0xc,%esp
+     15e:	68 00 12 00 00       	push   $0x1200
+     163:	e8 e8 fe ff ff       	call   50 <fail>
+     168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16f:	90                   	nop
+      fail("write");
+     170:	83 ec 0c             	sub    $0xc,%esp
+     173:	68 34 12 00 00       	push   $0x1234
+     178:	e8 d3 fe ff ff       	call   50 <fail>
+     17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <sharedtest>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	57                   	push   %edi
+     184:	56                   	push   %esi
+     185:	53                   	push   %ebx
+     186:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "shared test\n");
+     189:	68 07 12 00 00       	push   $0x1207
+     18e:	6a 01                	push   $0x1
+     190:	e8 db 0a 00 00       	call   c70 <printf>
+  fd = open("mmaptest.f", O_RDWR);
+     195:	5b                   	pop    %ebx
+     196:	5e                   	pop    %esi
+     197:	6a 02                	push   $0x2
+     199:	68 f5 11 00 00       	push   $0x11f5
+     19e:	e8 70 08 00 00       	call   a13 <open>
+  a = mmap(0, FSIZE, PROT_READ, MAP_SHARED, fd, 0);
+     1a3:	5f                   	pop    %edi
+     1a4:	5a                   	pop    %edx
+     1a5:	6a 00                	push   $0x0
+     1a7:	50                   	push   %eax
+  fd = open("mmaptest.f", O_RDWR);
+     1a8:	89 c6                	mov    %eax,%esi
+  a = mmap(0, FSIZE, PROT_READ, MAP_SHARED, fd, 0);
+     1aa:	6a 01                	push   $0x1
+     1ac:	6a 01                	push   $0x1
+     1ae:	68 64 30 00 00       	push   $0x3064
+     1b3:	6a 00                	push   $0x0
+     1b5:	e8 61 09 00 00       	call   b1b <mmap>
+  if(a == MAP_FAILED)
+     1ba:	83 c4 20             	add    $0x20,%esp
+     1bd:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1c0:	0f 84 b6 01 00 00    	je     37c <sharedtest+0x1fc>
+     1c6:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < FSIZE; i++)
+     1c8:	31 c9                	xor    %ecx,%ecx
+  return 'a' + i % 23;
+     1ca:	bf c9 42 16 b2       	mov    $0xb21642c9,%edi
+     1cf:	90                   	nop
+     1d0:	89 c8                	mov    %ecx,%eax
+     1d2:	f7 e7                	mul    %edi
+     1d4:	89 c8                	mov    %ecx,%eax
+     1d6:	c1 ea 04             	shr    $0x4,%edx
+     1d9:	6b d2 17             	imul   $0x17,%edx,%edx
+     1dc:	29 d0                	sub    %edx,%eax
+     1de:	83 c0 61             	add    $0x61,%eax
+    if(a[i] != expect(i))
+     1e1:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+     1e4:	0f 85 85 01 00 00    	jne    36f <sharedtest+0x1ef>
+  for(i = 0; i < FSIZE; i++)
+     1ea:	83 c1 01             	add    $0x1,%ecx
+     1ed:	81 f9 64 30 00 00    	cmp    $0x3064,%ecx
+     1f3:	75 db                	jne    1d0 <sharedtest+0x50>
+  if(a[FSIZE] != 0 || a[4*4096-1] != 0)
+     1f5:	80 bb 64 30 00 00 00 	cmpb   $0x0,0x3064(%ebx)
+     1fc:	0f 85 fc 01 00 00    	jne    3fe <sharedtest+0x27e>
+     202:	80 bb ff 3f 00 00 00 	cmpb   $0x0,0x3fff(%ebx)
+     209:	0f 85 ef 01 00 00    	jne    3fe <sharedtest+0x27e>
+  if(pwrite(fd, "XYZ", 3, 4095) != 3)
+     20f:	68 ff 0f 00 00       	push   $0xfff
+     214:	6a 03                	push   $0x3
+     216:	68 2f 12 00 00       	push   $0x122f
+     21b:	56                   	push   %esi
+     21c:	e8 da 08 00 00       	call   afb <pwrite>
+     221:	83 c4 10             	add    $0x10,%esp
+     224:	83 f8 03             	cmp    $0x3,%eax
+     227:	0f 85 c4 01 00 00    	jne    3f1 <sharedtest+0x271>
+  if(a[4095] != 'X' || a[4096] != 'Y' || a[4097] != 'Z')
+     22d:	80 bb ff 0f 00 00 58 	cmpb   $0x58,0xfff(%ebx)
+     234:	0f 85 aa 01 00 00    	jne    3e4 <sharedtest+0x264>
+     23a:	80 bb 00 10 00 00 59 	cmpb   $0x59,0x1000(%ebx)
+     241:	0f 85 9d 01 00 00    	jne    3e4 <sharedtest+0x264>
+     247:	80 bb 01 10 00 00 5a 	cmpb   $0x5a,0x1001(%ebx)
+     24e:	0f 85 90 01 00 00    	jne    3e4 <sharedtest+0x264>
+    orig[i] = expect(4095 + i);
+     254:	0f b7 05 d4 13 00 00 	movzwl 0x13d4,%eax
+     25b:	c6 45 de 64          	movb   $0x64,-0x22(%ebp)
+     25f:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+  if(pwrite(fd, orig, 3, 4095) != 3 || a[4096] != expect(4096))
+     263:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     266:	68 ff 0f 00 00       	push   $0xfff
+     26b:	6a 03                	push   $0x3
+     26d:	50                   	push   %eax
+     26e:	56                   	push   %esi
+     26f:	e8 87 08 00 00       	call   afb <pwrite>
+     274:	83 c4 10             	add    $0x10,%esp
+     277:	83 f8 03             	cmp    $0x3,%eax
+     27a:	0f 85 57 01 00 00    	jne    3d7 <sharedtest+0x257>
+     280:	80 bb 00 10 00 00 63 	cmpb   $0x63,0x1000(%ebx)
+     287:	0f 85 4a 01 00 00    	jne    3d7 <sharedtest+0x257>
+  if(pipe(fds) < 0)
+     28d:	83 ec 0c             	sub    $0xc,%esp
+     290:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     293:	50                   	push   %eax
+     294:	e8 4a 07 00 00       	call   9e3 <pipe>
+     299:	83 c4 10             	add    $0x10,%esp
+     29c:	85 c0                	test   %eax,%eax
+     29e:	0f 88 26 01 00 00    	js     3ca <sharedtest+0x24a>
+  if(write(fds[1], a + 4090, 10) != 10)
+     2a4:	83 ec 04             	sub    $0x4,%esp
+     2a7:	8d 83 fa 0f 00 00    	lea    0xffa(%ebx),%eax
+     2ad:	6a 0a                	push   $0xa
+     2af:	50                   	push   %eax
+     2b0:	ff 75 e4             	push   -0x1c(%ebp)
+     2b3:	e8 3b 07 00 00       	call   9f3 <write>
+     2b8:	83 c4 10             	add    $0x10,%esp
+     2bb:	83 f8 0a             	cmp    $0xa,%eax
+     2be:	0f 85 f9 00 00 00    	jne    3bd <sharedtest+0x23d>
+  if(read(fds[0], buf, 10) != 10 || buf[9] != expect(4099))
+     2c4:	83 ec 04             	sub    $0x4,%esp
+     2c7:	6a 0a                	push   $0xa
+     2c9:	68 00 19 00 00       	push   $0x1900
+     2ce:	ff 75 e0             	push   -0x20(%ebp)
+     2d1:	e8 15 07 00 00       	call   9eb <read>
+     2d6:	83 c4 10             	add    $0x10,%esp
+     2d9:	83 f8 0a             	cmp    $0xa,%eax
+     2dc:	0f 85 ce 00 00 00    	jne    3b0 <sharedtest+0x230>
+     2e2:	80 3d 09 19 00 00 66 	cmpb   $0x66,0x1909
+     2e9:	0f 85 c1 00 00 00    	jne    3b0 <sharedtest+0x230>
+  close(fds[0]);
+     2ef:	83 ec 0c             	sub    $0xc,%esp
+     2f2:	ff 75 e0             	push   -0x20(%ebp)
+     2f5:	e8 01 07 00 00       	call   9fb <close>
+  close(fds[1]);
+     2fa:	59                   	pop    %ecx
+     2fb:	ff 75 e4             	push   -0x1c(%ebp)
+     2fe:	e8 f8 06 00 00       	call   9fb <close>
+  if(read(fd, a, 10) >= 0)
+     303:	83 c4 0c             	add    $0xc,%esp
+     306:	6a 0a                	push   $0xa
+     308:	53                   	push   %ebx
+     309:	56                   	push   %esi
+     30a:	e8 dc 06 00 00       	call   9eb <read>
+     30f:	83 c4 10             	add    $0x10,%esp
+     312:	85 c0                	test   %eax,%eax
+     314:	0f 89 89 00 00 00    	jns    3a3 <sharedtest+0x223>
+  if(mmap(0, FSIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED)
+     31a:	83 ec 08             	sub    $0x8,%esp
+     31d:	6a 00                	push   $0x0
+     31f:	56                   	push   %esi
+     320:	6a 01                	push   $0x1
+     322:	6a 03                	push   $0x3
+     324:	68 64 30 00 00       	push   $0x3064
+     329:	6a 00                	push   $0x0
+     32b:	e8 eb 07 00 00       	call   b1b <mmap>
+     330:	83 c4 20             	add    $0x20,%esp
+     333:	83 f8 ff             	cmp    $0xffffffff,%eax
+     336:	75 5e                	jne    396 <sharedtest+0x216>
+  if(munmap(a, FSIZE) < 0)
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	68 64 30 00 00       	push   $0x3064
+     340:	53                   	push   %ebx
+     341:	e8 dd 07 00 00       	call   b23 <munmap>
+     346:	83 c4 10             	add    $0x10,%esp
+     349:	85 c0                	test   %eax,%eax
+     34b:	78 3c                	js     389 <sharedtest+0x209>
+  close(fd);
+     34d:	83 ec 0c             	sub    $0xc,%esp
+     350:	56                   	push   %esi
+     351:	e8 a5 06 00 00       	call   9fb <close>
+  printf(1, "shared test ok\n");
+     356:	58                   	pop    %eax
+     357:	5a                   	pop    %edx
+     358:	68 a1 12 00 00       	push   $0x12a1
+     35d:	6a 01                	push   $0x1
+     35f:	e8 0c 09 00 00       	call   c70 <printf>
+}
+     364:	83 c4 10             	add    $0x10,%esp
+     367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     36a:	5b                   	pop    %ebx
+     36b:	5e                   	pop    %esi
+     36c:	5f                   	pop    %edi
+     36d:	5d                   	pop    %ebp
+     36e:	c3                   	ret
+      fail("shared data");
+     36f:	83 ec 0c             	sub    $0xc,%esp
+     372:	68 19 12 00 00       	push   $0x1219
+     377:	e8 d4 fc ff ff       	call   50 <fail>
+    fail("mmap");
+     37c:	83 ec 0c             	sub    $0xc,%esp
+     37f:	68 14 12 00 00       	push   $0x1214
+     384:	e8 c7 fc ff ff       	call   50 <fail>
+    fail("munmap");
+     389:	83 ec 0c             	sub    $0xc,%esp
+     38c:	68 1b 13 00 00       	push   $0x131b
+     391:	e8 ba fc ff ff       	call   50 <fail>
+    fail("writable shared mapping");
+     396:	83 ec 0c             	sub    $0xc,%esp
+     399:	68 89 12 00 00       	push   $0x1289
+     39e:	e8 ad fc ff ff       	call   50 <fail>
+    fail("read into read-only mapping");
+     3a3:	83 ec 0c             	sub    $0xc,%esp
+     3a6:	68 6d 12 00 00       	push   $0x126d
+     3ab:	e8 a0 fc ff ff       	call   50 <fail>
+    fail("pipe data");
+     3b0:	83 ec 0c             	sub    $0xc,%esp
+     3b3:	68 63 12 00 00       	push   $0x1263
+     3b8:	e8 93 fc ff ff       	call   50 <fail>
+    fail("write from mapping");
+     3bd:	83 ec 0c             	sub    $0xc,%esp
+     3c0:	68 50 12 00 00       	push   $0x1250
+     3c5:	e8 86 fc ff ff       	call   50 <fail>
+    fail("pipe");
+     3ca:	83 ec 0c             	sub    $0xc,%esp
+     3cd:	68 60 13 00 00       	push   $0x1360
+     3d2:	e8 79 fc ff ff       	call   50 <fail>
+    fail("pwrite back");
+     3d7:	83 ec 0c             	sub    $0xc,%esp
+     3da:	68 44 12 00 00       	push   $0x1244
+     3df:	e8 6c fc ff ff       	call   50 <fail>
+    fail("coherence");
+     3e4:	83 ec 0c             	sub    $0xc,%esp
+     3e7:	68 3a 12 00 00       	push   $0x123a
+     3ec:	e8 5f fc ff ff       	call   50 <fail>
+    fail("pwrite");
+     3f1:	83 ec 0c             	sub    $0xc,%esp
+     3f4:	68 33 12 00 00       	push   $0x1233
+     3f9:	e8 52 fc ff ff       	call   50 <fail>
+    fail("zero fill");
+     3fe:	83 ec 0c             	sub    $0xc,%esp
+     401:	68 25 12 00 00       	push   $0x1225
+     406:	e8 45 fc ff ff       	call   50 <fail>
+     40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     40f:	90                   	nop
+
+00000410 <privatetest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	57                   	push   %edi
+     414:	56                   	push   %esi
+     415:	53                   	push   %ebx
+     416:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "private test\n");
+     419:	68 b1 12 00 00       	push   $0x12b1
+     41e:	6a 01                	push   $0x1
+     420:	e8 4b 08 00 00       	call   c70 <printf>
+  fd = open("mmaptest.f", O_RDONLY);
+     425:	59                   	pop    %ecx
+     426:	5b                   	pop    %ebx
+     427:	6a 00                	push   $0x0
+     429:	68 f5 11 00 00       	push   $0x11f5
+     42e:	e8 e0 05 00 00       	call   a13 <open>
+  a = mmap(0, FSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+     433:	5f                   	pop    %edi
+     434:	5a                   	pop    %edx
+     435:	6a 00                	push   $0x0
+     437:	50                   	push   %eax
+  fd = open("mmaptest.f", O_RDONLY);
+     438:	89 c6                	mov    %eax,%esi
+  a = mmap(0, FSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+     43a:	6a 02                	push   $0x2
+     43c:	6a 03                	push   $0x3
+     43e:	68 64 30 00 00       	push   $0x3064
+     443:	6a 00                	push   $0x0
+     445:	e8 d1 06 00 00       	call   b1b <mmap>
+  if(a == MAP_FAILED)
+     44a:	83 c4 20             	add    $0x20,%esp
+     44d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     450:	0f 84 82 01 00 00    	je     5d8 <privatetest+0x1c8>
+  close(fd);  // the mapping keeps the file open
+     456:	83 ec 0c             	sub    $0xc,%esp
+     459:	89 c3                	mov    %eax,%ebx
+     45b:	56                   	push   %esi
+     45c:	e8 9a 05 00 00       	call   9fb <close>
+  a[0] = '!';
+     461:	c6 03 21             	movb   $0x21,(%ebx)
+  a[FSIZE-1] = '!';
+     464:	c6 83 63 30 00 00 21 	movb   $0x21,0x3063(%ebx)
+  fd = open("mmaptest.f", O_RDONLY);
+     46b:	58                   	pop    %eax
+     46c:	5a                   	pop    %edx
+     46d:	6a 00                	push   $0x0
+     46f:	68 f5 11 00 00       	push   $0x11f5
+     474:	e8 9a 05 00 00       	call   a13 <open>
+  if(pread(fd, buf, 1, 0) != 1 || buf[0] != expect(0))
+     479:	6a 00                	push   $0x0
+     47b:	6a 01                	push   $0x1
+  fd = open("mmaptest.f", O_RDONLY);
+     47d:	89 c7                	mov    %eax,%edi
+  if(pread(fd, buf, 1, 0) != 1 || buf[0] != expect(0))
+     47f:	68 00 19 00 00       	push   $0x1900
+     484:	50                   	push   %eax
+     485:	e8 69 06 00 00       	call   af3 <pread>
+     48a:	83 c4 20             	add    $0x20,%esp
+     48d:	83 f8 01             	cmp    $0x1,%eax
+     490:	0f 85 5c 01 00 00    	jne    5f2 <privatetest+0x1e2>
+     496:	80 3d 00 19 00 00 61 	cmpb   $0x61,0x1900
+     49d:	0f 85 4f 01 00 00    	jne    5f2 <privatetest+0x1e2>
+  if(read(fd, a + 4096, 10) != 10 || a[4096] != expect(0))
+     4a3:	83 ec 04             	sub    $0x4,%esp
+     4a6:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+     4ac:	6a 0a                	push   $0xa
+     4ae:	56                   	push   %esi
+     4af:	57                   	push   %edi
+     4b0:	e8 36 05 00 00       	call   9eb <read>
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	83 f8 0a             	cmp    $0xa,%eax
+     4bb:	0f 85 24 01 00 00    	jne    5e5 <privatetest+0x1d5>
+     4c1:	80 bb 00 10 00 00 61 	cmpb   $0x61,0x1000(%ebx)
+     4c8:	0f 85 17 01 00 00    	jne    5e5 <privatetest+0x1d5>
+  close(fd);
+     4ce:	83 ec 0c             	sub    $0xc,%esp
+     4d1:	57                   	push   %edi
+     4d2:	e8 24 05 00 00       	call   9fb <close>
+  pid = fork();
+     4d7:	e8 ef 04 00 00       	call   9cb <fork>
+  if(pid < 0)
+     4dc:	83 c4 10             	add    $0x10,%esp
+     4df:	85 c0                	test   %eax,%eax
+     4e1:	0f 88 e4 00 00 00    	js     5cb <privatetest+0x1bb>
+  if(pid == 0){
+     4e7:	75 27                	jne    510 <privatetest+0x100>
+    if(a[0] != '!' || a[1] != expect(1) || a[FSIZE-1] != '!')
+     4e9:	80 3b 21             	cmpb   $0x21,(%ebx)
+     4ec:	75 13                	jne    501 <privatetest+0xf1>
+     4ee:	80 7b 01 62          	cmpb   $0x62,0x1(%ebx)
+     4f2:	75 0d                	jne    501 <privatetest+0xf1>
+     4f4:	80 bb 63 30 00 00 21 	cmpb   $0x21,0x3063(%ebx)
+     4fb:	0f 84 b4 00 00 00    	je     5b5 <privatetest+0x1a5>
+      fail("child data");
+     501:	83 ec 0c             	sub    $0xc,%esp
+     504:	68 de 12 00 00       	push   $0x12de
+     509:	e8 42 fb ff ff       	call   50 <fail>
+     50e:	66 90                	xchg   %ax,%ax
+  wait();
+     510:	e8 c6 04 00 00       	call   9db <wait>
+  if(a[1] != expect(1))
+     515:	80 7b 01 62          	cmpb   $0x62,0x1(%ebx)
+     519:	0f 85 e0 00 00 00    	jne    5ff <privatetest+0x1ef>
+  if(munmap(a, 4096) < 0)
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 00 10 00 00       	push   $0x1000
+     527:	53                   	push   %ebx
+     528:	e8 f6 05 00 00       	call   b23 <munmap>
+     52d:	83 c4 10             	add    $0x10,%esp
+     530:	85 c0                	test   %eax,%eax
+     532:	0f 88 d4 00 00 00    	js     60c <privatetest+0x1fc>
+  for(i = 4096+10; i < FSIZE-1; i++)
+     538:	b9 0a 10 00 00       	mov    $0x100a,%ecx
+  return 'a' + i % 23;
+     53d:	bf c9 42 16 b2       	mov    $0xb21642c9,%edi
+     542:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     548:	89 c8                	mov    %ecx,%eax
+     54a:	f7 e7                	mul    %edi
+     54c:	89 c8                	mov    %ecx,%eax
+     54e:	c1 ea 04             	shr    $0x4,%edx
+     551:	6b d2 17             	imul   $0x17,%edx,%edx
+     554:	29 d0                	sub    %edx,%eax
+     556:	83 c0 61             	add    $0x61,%eax
+    if(a[i] != expect(i))
+     559:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+     55c:	75 60                	jne    5be <privatetest+0x1ae>
+  for(i = 4096+10; i < FSIZE-1; i++)
+     55e:	83 c1 01             	add    $0x1,%ecx
+     561:	81 f9 63 30 00 00    	cmp    $0x3063,%ecx
+     567:	75 df                	jne    548 <privatetest+0x138>
+  if(munmap(a + 4096, FSIZE - 4096) < 0)
+     569:	83 ec 08             	sub    $0x8,%esp
+     56c:	68 64 20 00 00       	push   $0x2064
+     571:	56                   	push   %esi
+     572:	e8 ac 05 00 00       	call   b23 <munmap>
+     577:	83 c4 10             	add    $0x10,%esp
+     57a:	85 c0                	test   %eax,%eax
+     57c:	0f 88 97 00 00 00    	js     619 <privatetest+0x209>
+  if(munmap(a, 4096) >= 0)
+     582:	83 ec 08             	sub    $0x8,%esp
+     585:	68 00 10 00 00       	push   $0x1000
+     58a:	53                   	push   %ebx
+     58b:	e8 93 05 00 00       	call   b23 <munmap>
+     590:	83 c4 10             	add    $0x10,%esp
+     593:	85 c0                	test   %eax,%eax
+     595:	0f 89 8b 00 00 00    	jns    626 <privatetest+0x216>
+  printf(1, "private test ok\n");
+     59b:	83 ec 08             	sub    $0x8,%esp
+     59e:	68 3b 13 00 00       	push   $0x133b
+     5a3:	6a 01                	push   $0x1
+     5a5:	e8 c6 06 00 00       	call   c70 <printf>
+}
+     5aa:	83 c4 10             	add    $0x10,%esp
+     5ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b0:	5b                   	pop    %ebx
+     5b1:	5e                   	pop    %esi
+     5b2:	5f                   	pop    %edi
+     5b3:	5d                   	pop    %ebp
+     5b4:	c3                   	ret
+    a[1] = '?';
+     5b5:	c6 43 01 3f          	movb   $0x3f,0x1(%ebx)
+    exit();
+     5b9:	e8 15 04 00 00       	call   9d3 <exit>
+      fail("data after munmap");
+     5be:	83 ec 0c             	sub    $0xc,%esp
+     5c1:	68 10 13 00 00       	push   $0x1310
+     5c6:	e8 85 fa ff ff       	call   50 <fail>
+    fail("fork");
+     5cb:	83 ec 0c             	sub    $0xc,%esp
+     5ce:	68 d9 12 00 00       	push   $0x12d9
+     5d3:	e8 78 fa ff ff       	call   50 <fail>
+    fail("mmap");
+     5d8:	83 ec 0c             	sub    $0xc,%esp
+     5db:	68 14 12 00 00       	push   $0x1214
+     5e0:	e8 6b fa ff ff       	call   50 <fail>
+    fail("read into private mapping");
+     5e5:	83 ec 0c             	sub    $0xc,%esp
+     5e8:	68 bf 12 00 00       	push   $0x12bf
+     5ed:	e8 5e fa ff ff       	call   50 <fail>
+    fail("private write reached the file");
+     5f2:	83 ec 0c             	sub    $0xc,%esp
+     5f5:	68 b4 13 00 00       	push   $0x13b4
+     5fa:	e8 51 fa ff ff       	call   50 <fail>
+    fail("child write reached parent");
+     5ff:	83 ec 0c             	sub    $0xc,%esp
+     602:	68 e9 12 00 00       	push   $0x12e9
+     607:	e8 44 fa ff ff       	call   50 <fail>
+    fail("munmap head");
+     60c:	83 ec 0c             	sub    $0xc,%esp
+     60f:	68 04 13 00 00       	push   $0x1304
+     614:	e8 37 fa ff ff       	call   50 <fail>
+    fail("munmap tail");
+     619:	83 ec 0c             	sub    $0xc,%esp
+     61c:	68 22 13 00 00       	push   $0x1322
+     621:	e8 2a fa ff ff       	call   50 <fail>
+    fail("munmap twice");
+     626:	83 ec 0c             	sub    $0xc,%esp
+     629:	68 2e 13 00 00       	push   $0x132e
+     62e:	e8 1d fa ff ff       	call   50 <fail>
+     633:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000640 <badtest>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	53                   	push   %ebx
+     644:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "bad args test\n");
+     647:	68 4c 13 00 00       	push   $0x134c
+     64c:	6a 01                	push   $0x1
+     64e:	e8 1d 06 00 00       	call   c70 <printf>
+  if(pipe(fds) < 0)
+     653:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     656:	89 04 24             	mov    %eax,(%esp)
+     659:	e8 85 03 00 00       	call   9e3 <pipe>
+     65e:	83 c4 10             	add    $0x10,%esp
+     661:	85 c0                	test   %eax,%eax
+     663:	0f 88 d9 00 00 00    	js     742 <badtest+0x102>
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fds[0], 0) != MAP_FAILED)
+     669:	83 ec 08             	sub    $0x8,%esp
+     66c:	6a 00                	push   $0x0
+     66e:	ff 75 f0             	push   -0x10(%ebp)
+     671:	6a 01                	push   $0x1
+     673:	6a 01                	push   $0x1
+     675:	68 00 10 00 00       	push   $0x1000
+     67a:	6a 00                	push   $0x0
+     67c:	e8 9a 04 00 00       	call   b1b <mmap>
+     681:	83 c4 20             	add    $0x20,%esp
+     684:	83 f8 ff             	cmp    $0xffffffff,%eax
+     687:	0f 85 e9 00 00 00    	jne    776 <badtest+0x136>
+  close(fds[0]);
+     68d:	83 ec 0c             	sub    $0xc,%esp
+     690:	ff 75 f0             	push   -0x10(%ebp)
+     693:	e8 63 03 00 00       	call   9fb <close>
+  close(fds[1]);
+     698:	59                   	pop    %ecx
+     699:	ff 75 f4             	push   -0xc(%ebp)
+     69c:	e8 5a 03 00 00       	call   9fb <close>
+  fd = open("mmaptest.f", O_RDONLY);
+     6a1:	5b                   	pop    %ebx
+     6a2:	58                   	pop    %eax
+     6a3:	6a 00                	push   $0x0
+     6a5:	68 f5 11 00 00       	push   $0x11f5
+     6aa:	e8 64 03 00 00       	call   a13 <open>
+     6af:	89 c3                	mov    %eax,%ebx
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 100) != MAP_FAILED)
+     6b1:	58                   	pop    %eax
+     6b2:	5a                   	pop    %edx
+     6b3:	6a 64                	push   $0x64
+     6b5:	53                   	push   %ebx
+     6b6:	6a 01                	push   $0x1
+     6b8:	6a 01                	push   $0x1
+     6ba:	68 00 10 00 00       	push   $0x1000
+     6bf:	6a 00                	push   $0x0
+     6c1:	e8 55 04 00 00       	call   b1b <mmap>
+     6c6:	83 c4 20             	add    $0x20,%esp
+     6c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6cc:	0f 85 97 00 00 00    	jne    769 <badtest+0x129>
+  if(mmap(0, 0, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+     6d2:	83 ec 08             	sub    $0x8,%esp
+     6d5:	6a 00                	push   $0x0
+     6d7:	53                   	push   %ebx
+     6d8:	6a 01                	push   $0x1
+     6da:	6a 01                	push   $0x1
+     6dc:	6a 00                	push   $0x0
+     6de:	6a 00                	push   $0x0
+     6e0:	e8 36 04 00 00       	call   b1b <mmap>
+     6e5:	83 c4 20             	add    $0x20,%esp
+     6e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6eb:	75 6f                	jne    75c <badtest+0x11c>
+  close(fd);
+     6ed:	83 ec 0c             	sub    $0xc,%esp
+     6f0:	53                   	push   %ebx
+     6f1:	e8 05 03 00 00       	call   9fb <close>
+  fd = open("mmaptest.f", O_WRONLY);
+     6f6:	59                   	pop    %ecx
+     6f7:	5b                   	pop    %ebx
+     6f8:	6a 01                	push   $0x1
+     6fa:	68 f5 11 00 00       	push   $0x11f5
+     6ff:	e8 0f 03 00 00       	call   a13 <open>
+     704:	89 c3                	mov    %eax,%ebx
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+     706:	58                   	pop    %eax
+     707:	5a                   	pop    %edx
+     708:	6a 00                	push   $0x0
+     70a:	53                   	push   %ebx
+     70b:	6a 01                	push   $0x1
+     70d:	6a 01                	push   $0x1
+     70f:	68 00 10 00 00       	push   $0x1000
+     714:	6a 00                	push   $0x0
+     716:	e8 00 04 00 00       	call   b1b <mmap>
+     71b:	83 c4 20             	add    $0x20,%esp
+     71e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     721:	75 2c                	jne    74f <badtest+0x10f>
+  close(fd);
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	53                   	push   %ebx
+     727:	e8 cf 02 00 00       	call   9fb <close>
+  printf(1, "bad args test ok\n");
+     72c:	58                   	pop    %eax
+     72d:	5a                   	pop    %edx
+     72e:	68 92 13 00 00       	push   $0x1392
+     733:	6a 01                	push   $0x1
+     735:	e8 36 05 00 00       	call   c70 <printf>
+}
+     73a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     73d:	83 c4 10             	add    $0x10,%esp
+     740:	c9                   	leave
+     741:	c3                   	ret
+    fail("pipe");
+     742:	83 ec 0c             	sub    $0xc,%esp
+     745:	68 60 13 00 00       	push   $0x1360
+     74a:	e8 01 f9 ff ff       	call   50 <fail>
+    fail("write-only file");
+     74f:	83 ec 0c             	sub    $0xc,%esp
+     752:	68 82 13 00 00       	push   $0x1382
+     757:	e8 f4 f8 ff ff       	call   50 <fail>
+    fail("zero length");
+     75c:	83 ec 0c             	sub    $0xc,%esp
+     75f:	68 76 13 00 00       	push   $0x1376
+     764:	e8 e7 f8 ff ff       	call   50 <fail>
+    fail("unaligned offset");
+     769:	83 ec 0c             	sub    $0xc,%esp
+     76c:	68 65 13 00 00       	push   $0x1365
+     771:	e8 da f8 ff ff       	call   50 <fail>
+    fail("mmap pipe");
+     776:	83 ec 0c             	sub    $0xc,%esp
+     779:	68 5b 13 00 00       	push   $0x135b
+     77e:	e8 cd f8 ff ff       	call   50 <fail>
+     783:	66 90                	xchg   %ax,%ax
+     785:	66 90                	xchg   %ax,%ax
+     787:	66 90                	xchg   %ax,%ax
+     789:	66 90                	xchg   %ax,%ax
+     78b:	66 90                	xchg   %ax,%ax
+     78d:	66 90                	xchg   %ax,%ax
+     78f:	90                   	nop
+
+00000790 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     790:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     791:	31 c0                	xor    %eax,%eax
+{
+     793:	89 e5                	mov    %esp,%ebp
+     795:	53                   	push   %ebx
+     796:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     799:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     7a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     7a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     7a7:	83 c0 01             	add    $0x1,%eax
+     7aa:	84 d2                	test   %dl,%dl
+     7ac:	75 f2                	jne    7a0 <strcpy+0x10>
+    ;
+  return os;
+}
+     7ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7b1:	89 c8                	mov    %ecx,%eax
+     7b3:	c9                   	leave
+     7b4:	c3                   	ret
+     7b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	53                   	push   %ebx
+     7c4:	8b 55 08             	mov    0x8(%ebp),%edx
+     7c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     7ca:	0f b6 02             	movzbl (%edx),%eax
+     7cd:	84 c0                	test   %al,%al
+     7cf:	75 17                	jne    7e8 <strcmp+0x28>
+     7d1:	eb 3a                	jmp    80d <strcmp+0x4d>
+     7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7d7:	90                   	nop
+     7d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     7dc:	83 c2 01             	add    $0x1,%edx
+     7df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     7e2:	84 c0                	test   %al,%al
+     7e4:	74 1a                	je     800 <strcmp+0x40>
+    p++, q++;
+     7e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     7e8:	0f b6 19             	movzbl (%ecx),%ebx
+     7eb:	38 c3                	cmp    %al,%bl
+     7ed:	74 e9                	je     7d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     7ef:	29 d8                	sub    %ebx,%eax
+}
+     7f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7f4:	c9                   	leave
+     7f5:	c3                   	ret
+     7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     800:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     804:	31 c0                	xor    %eax,%eax
+     806:	29 d8                	sub    %ebx,%eax
+}
+     808:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     80b:	c9                   	leave
+     80c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     80d:	0f b6 19             	movzbl (%ecx),%ebx
+     810:	31 c0                	xor    %eax,%eax
+     812:	eb db                	jmp    7ef <strcmp+0x2f>
+     814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+
+00000820 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     826:	80 3a 00             	cmpb   $0x0,(%edx)
+     829:	74 15                	je     840 <strlen+0x20>
+     82b:	31 c0                	xor    %eax,%eax
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+     830:	83 c0 01             	add    $0x1,%eax
+     833:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     837:	89 c1                	mov    %eax,%ecx
+     839:	75 f5                	jne    830 <strlen+0x10>
+    ;
+  return n;
+}
+     83b:	89 c8                	mov    %ecx,%eax
+     83d:	5d                   	pop    %ebp
+     83e:	c3                   	ret
+     83f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     840:	31 c9                	xor    %ecx,%ecx
+}
+     842:	5d                   	pop    %ebp
+     843:	89 c8                	mov    %ecx,%eax
+     845:	c3                   	ret
+     846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	57                   	push   %edi
+     854:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     857:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     85a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     85d:	89 d7                	mov    %edx,%edi
+     85f:	fc                   	cld
+     860:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     862:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     865:	89 d0                	mov    %edx,%eax
+     867:	c9                   	leave
+     868:	c3                   	ret
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	8b 45 08             	mov    0x8(%ebp),%eax
+     876:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     87a:	0f b6 10             	movzbl (%eax),%edx
+     87d:	84 d2                	test   %dl,%dl
+     87f:	75 12                	jne    893 <strchr+0x23>
+     881:	eb 1d                	jmp    8a0 <strchr+0x30>
+     883:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     887:	90                   	nop
+     888:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     88c:	83 c0 01             	add    $0x1,%eax
+     88f:	84 d2                	test   %dl,%dl
+     891:	74 0d                	je     8a0 <strchr+0x30>
+    if(*s == c)
+     893:	38 d1                	cmp    %dl,%cl
+     895:	75 f1                	jne    888 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     897:	5d                   	pop    %ebp
+     898:	c3                   	ret
+     899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     8a0:	31 c0                	xor    %eax,%eax
+}
+     8a2:	5d                   	pop    %ebp
+     8a3:	c3                   	ret
+     8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+
+000008b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+     8b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     8b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     8b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     8b9:	31 db                	xor    %ebx,%ebx
+{
+     8bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     8be:	eb 27                	jmp    8e7 <gets+0x37>
+    cc = read(0, &c, 1);
+     8c0:	83 ec 04             	sub    $0x4,%esp
+     8c3:	6a 01                	push   $0x1
+     8c5:	56                   	push   %esi
+     8c6:	6a 00                	push   $0x0
+     8c8:	e8 1e 01 00 00       	call   9eb <read>
+    if(cc < 1)
+     8cd:	83 c4 10             	add    $0x10,%esp
+     8d0:	85 c0                	test   %eax,%eax
+     8d2:	7e 1d                	jle    8f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     8d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     8d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     8df:	3c 0a                	cmp    $0xa,%al
+     8e1:	74 10                	je     8f3 <gets+0x43>
+     8e3:	3c 0d                	cmp    $0xd,%al
+     8e5:	74 0c                	je     8f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     8e7:	89 df                	mov    %ebx,%edi
+     8e9:	83 c3 01             	add    $0x1,%ebx
+     8ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8ef:	7c cf                	jl     8c0 <gets+0x10>
+     8f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     8f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     8fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8fd:	5b                   	pop    %ebx
+     8fe:	5e                   	pop    %esi
+     8ff:	5f                   	pop    %edi
+     900:	5d                   	pop    %ebp
+     901:	c3                   	ret
+     902:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	56                   	push   %esi
+     914:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     915:	83 ec 08             	sub    $0x8,%esp
+     918:	6a 00                	push   $0x0
+     91a:	ff 75 08             	push   0x8(%ebp)
+     91d:	e8 f1 00 00 00       	call   a13 <open>
+  if(fd < 0)
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 27                	js     950 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     929:	83 ec 08             	sub    $0x8,%esp
+     92c:	ff 75 0c             	push   0xc(%ebp)
+     92f:	89 c3                	mov    %eax,%ebx
+     931:	50                   	push   %eax
+     932:	e8 f4 00 00 00       	call   a2b <fstat>
+  close(fd);
+     937:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     93a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     93c:	e8 ba 00 00 00       	call   9fb <close>
+  return r;
+     941:	83 c4 10             	add    $0x10,%esp
+}
+     944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     947:	89 f0                	mov    %esi,%eax
+     949:	5b                   	pop    %ebx
+     94a:	5e                   	pop    %esi
+     94b:	5d                   	pop    %ebp
+     94c:	c3                   	ret
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     950:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     955:	eb ed                	jmp    944 <stat+0x34>
+     957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95e:	66 90                	xchg   %ax,%ax
+
+00000960 <atoi>:
+
+int
+atoi(const char *s)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	53                   	push   %ebx
+     964:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     967:	0f be 02             	movsbl (%edx),%eax
+     96a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     96d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     970:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     975:	77 1e                	ja     995 <atoi+0x35>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     980:	83 c2 01             	add    $0x1,%edx
+     983:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     986:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     98a:	0f be 02             	movsbl (%edx),%eax
+     98d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     990:	80 fb 09             	cmp    $0x9,%bl
+     993:	76 eb                	jbe    980 <atoi+0x20>
+  return n;
+}
+     995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     998:	89 c8                	mov    %ecx,%eax
+     99a:	c9                   	leave
+     99b:	c3                   	ret
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	56                   	push   %esi
+     9a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     9ae:	85 c0                	test   %eax,%eax
+     9b0:	7e 13                	jle    9c5 <memmove+0x25>
+     9b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9b4:	89 d7                	mov    %edx,%edi
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9c1:	39 f8                	cmp    %edi,%eax
+     9c3:	75 fb                	jne    9c0 <memmove+0x20>
+  return vdst;
+}
+     9c5:	5e                   	pop    %esi
+     9c6:	89 d0                	mov    %edx,%eax
+     9c8:	5f                   	pop    %edi
+     9c9:	5d                   	pop    %ebp
+     9ca:	c3                   	ret
+
+000009cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     9cb:	b8 01 00 00 00       	mov    $0x1,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <exit>:
+SYSCALL(exit)
+     9d3:	b8 02 00 00 00       	mov    $0x2,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <wait>:
+SYSCALL(wait)
+     9db:	b8 03 00 00 00       	mov    $0x3,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <pipe>:
+SYSCALL(pipe)
+     9e3:	b8 04 00 00 00       	mov    $0x4,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <read>:
+SYSCALL(read)
+     9eb:	b8 05 00 00 00       	mov    $0x5,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <write>:
+SYSCALL(write)
+     9f3:	b8 10 00 00 00       	mov    $0x10,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <close>:
+SYSCALL(close)
+     9fb:	b8 15 00 00 00       	mov    $0x15,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <kill>:
+SYSCALL(kill)
+     a03:	b8 06 00 00 00       	mov    $0x6,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <exec>:
+SYSCALL(exec)
+     a0b:	b8 07 00 00 00       	mov    $0x7,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <open>:
+SYSCALL(open)
+     a13:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <mknod>:
+SYSCALL(mknod)
+     a1b:	b8 11 00 00 00       	mov    $0x11,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <unlink>:
+SYSCALL(unlink)
+     a23:	b8 12 00 00 00       	mov    $0x12,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <fstat>:
+SYSCALL(fstat)
+     a2b:	b8 08 00 00 00       	mov    $0x8,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <link>:
+SYSCALL(link)
+     a33:	b8 13 00 00 00       	mov    $0x13,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <mkdir>:
+SYSCALL(mkdir)
+     a3b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <chdir>:
+SYSCALL(chdir)
+     a43:	b8 09 00 00 00       	mov    $0x9,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <dup>:
+SYSCALL(dup)
+     a4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <getpid>:
+SYSCALL(getpid)
+     a53:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <sbrk>:
+SYSCALL(sbrk)
+     a5b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <sleep>:
+SYSCALL(sleep)
+     a63:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <uptime>:
+SYSCALL(uptime)
+     a6b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <getsysinfo>:
+SYSCALL(getsysinfo)
+     a73:	b8 16 00 00 00       	mov    $0x16,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     a7b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     a83:	b8 18 00 00 00       	mov    $0x18,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <mlfqstart>:
+SYSCALL(mlfqstart)
+     a8b:	b8 19 00 00 00       	mov    $0x19,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <mlfqstop>:
+SYSCALL(mlfqstop)
+     a93:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     a9b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     aa3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <setpriority>:
+SYSCALL(setpriority)
+     aab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     ab3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <getcpustats>:
+SYSCALL(getcpustats)
+     abb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <setscheduler>:
+SYSCALL(setscheduler)
+     ac3:	b8 20 00 00 00       	mov    $0x20,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+
+00000acb <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     acb:	b8 21 00 00 00       	mov    $0x21,%eax
+     ad0:	cd 40                	int    $0x40
+     ad2:	c3                   	ret
+
+00000ad3 <getscheduler>:
+SYSCALL(getscheduler)
+     ad3:	b8 22 00 00 00       	mov    $0x22,%eax
+     ad8:	cd 40                	int    $0x40
+     ada:	c3                   	ret
+
+00000adb <splice>:
+SYSCALL(splice)
+     adb:	b8 23 00 00 00       	mov    $0x23,%eax
+     ae0:	cd 40                	int    $0x40
+     ae2:	c3                   	ret
+
+00000ae3 <readv>:
+SYSCALL(readv)
+     ae3:	b8 24 00 00 00       	mov    $0x24,%eax
+     ae8:	cd 40                	int    $0x40
+     aea:	c3                   	ret
+
+00000aeb <writev>:
+SYSCALL(writev)
+     aeb:	b8 25 00 00 00       	mov    $0x25,%eax
+     af0:	cd 40                	int    $0x40
+     af2:	c3                   	ret
+
+00000af3 <pread>:
+SYSCALL(pread)
+     af3:	b8 26 00 00 00       	mov    $0x26,%eax
+     af8:	cd 40                	int    $0x40
+     afa:	c3                   	ret
+
+00000afb <pwrite>:
+SYSCALL(pwrite)
+     afb:	b8 27 00 00 00       	mov    $0x27,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <getlogstat>:
+SYSCALL(getlogstat)
+     b03:	b8 28 00 00 00       	mov    $0x28,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <mount>:
+SYSCALL(mount)
+     b0b:	b8 29 00 00 00       	mov    $0x29,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <umount>:
+SYSCALL(umount)
+     b13:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <mmap>:
+SYSCALL(mmap)
+     b1b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <munmap>:
+SYSCALL(munmap)
+     b23:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <membench>:
+SYSCALL(membench)
+     b2b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b30:	cd 40                	int    $0x40
+     b32:	c3                   	ret
+
+00000b33 <getlockstat>:
+SYSCALL(getlockstat)
+     b33:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b38:	cd 40                	int    $0x40
+     b3a:	c3                   	ret
+
+00000b3b <lockbench>:
+SYSCALL(lockbench)
+     b3b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b40:	cd 40                	int    $0x40
+     b42:	c3                   	ret
+
+00000b43 <prof>:
+SYSCALL(prof)
+     b43:	b8 30 00 00 00       	mov    $0x30,%eax
+     b48:	cd 40                	int    $0x40
+     b4a:	c3                   	ret
+
+00000b4b <tracectl>:
+SYSCALL(tracectl)
+     b4b:	b8 31 00 00 00       	mov    $0x31,%eax
+     b50:	cd 40                	int    $0x40
+     b52:	c3                   	ret
+
+00000b53 <traceread>:
+SYSCALL(traceread)
+     b53:	b8 32 00 00 00       	mov    $0x32,%eax
+     b58:	cd 40                	int    $0x40
+     b5a:	c3                   	ret
+
+00000b5b <getsysstat>:
+SYSCALL(getsysstat)
+     b5b:	b8 33 00 00 00       	mov    $0x33,%eax
+     b60:	cd 40                	int    $0x40
+     b62:	c3                   	ret
+
+00000b63 <getwaitstat>:
+SYSCALL(getwaitstat)
+     b63:	b8 34 00 00 00       	mov    $0x34,%eax
+     b68:	cd 40                	int    $0x40
+     b6a:	c3                   	ret
+
+00000b6b <getschedwait>:
+SYSCALL(getschedwait)
+     b6b:	b8 35 00 00 00       	mov    $0x35,%eax
+     b70:	cd 40                	int    $0x40
+     b72:	c3                   	ret
+
+00000b73 <mlfqread>:
+SYSCALL(mlfqread)
+     b73:	b8 36 00 00 00       	mov    $0x36,%eax
+     b78:	cd 40                	int    $0x40
+     b7a:	c3                   	ret
+
+00000b7b <dllock>:
+SYSCALL(dllock)
+     b7b:	b8 37 00 00 00       	mov    $0x37,%eax
+     b80:	cd 40                	int    $0x40
+     b82:	c3                   	ret
+
+00000b83 <watchdogctl>:
+SYSCALL(watchdogctl)
+     b83:	b8 38 00 00 00       	mov    $0x38,%eax
+     b88:	cd 40                	int    $0x40
+     b8a:	c3                   	ret
+
+00000b8b <deadlocklog>:
+SYSCALL(deadlocklog)
+     b8b:	b8 39 00 00 00       	mov    $0x39,%eax
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <clone>:
+SYSCALL(clone)
+     b93:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b98:	cd 40                	int    $0x40
+     b9a:	c3                   	ret
+
+00000b9b <join>:
+SYSCALL(join)
+     b9b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ba0:	cd 40                	int    $0x40
+     ba2:	c3                   	ret
+
+00000ba3 <futex>:
+SYSCALL(futex)
+     ba3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ba8:	cd 40                	int    $0x40
+     baa:	c3                   	ret
+
+00000bab <shmat>:
+SYSCALL(shmat)
+     bab:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     bb0:	cd 40                	int    $0x40
+     bb2:	c3                   	ret
+
+00000bb3 <shmdt>:
+SYSCALL(shmdt)
+     bb3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bb8:	cd 40                	int    $0x40
+     bba:	c3                   	ret
+
+00000bbb <poll>:
+SYSCALL(poll)
+     bbb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bc0:	cd 40                	int    $0x40
+     bc2:	c3                   	ret
+     bc3:	66 90                	xchg   %ax,%ax
+     bc5:	66 90                	xchg   %ax,%ax
+     bc7:	66 90                	xchg   %ax,%ax
+     bc9:	66 90                	xchg   %ax,%ax
+     bcb:	66 90                	xchg   %ax,%ax
+     bcd:	66 90                	xchg   %ax,%ax
+     bcf:	90                   	nop
+
+00000bd0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     bd8:	89 d1                	mov    %edx,%ecx
+{
+     bda:	83 ec 3c             	sub    $0x3c,%esp
+     bdd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     be0:	85 d2                	test   %edx,%edx
+     be2:	0f 89 80 00 00 00    	jns    c68 <printint+0x98>
+     be8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     bec:	74 7a                	je     c68 <printint+0x98>
+    x = -xx;
+     bee:	f7 d9                	neg    %ecx
+    neg = 1;
+     bf0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     bf5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     bf8:	31 f6                	xor    %esi,%esi
+     bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c00:	89 c8                	mov    %ecx,%eax
+     c02:	31 d2                	xor    %edx,%edx
+     c04:	89 f7                	mov    %esi,%edi
+     c06:	f7 f3                	div    %ebx
+     c08:	8d 76 01             	lea    0x1(%esi),%esi
+     c0b:	0f b6 92 38 14 00 00 	movzbl 0x1438(%edx),%edx
+     c12:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c16:	89 ca                	mov    %ecx,%edx
+     c18:	89 c1                	mov    %eax,%ecx
+     c1a:	39 da                	cmp    %ebx,%edx
+     c1c:	73 e2                	jae    c00 <printint+0x30>
+  if(neg)
+     c1e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c21:	85 c0                	test   %eax,%eax
+     c23:	74 07                	je     c2c <printint+0x5c>
+    buf[i++] = '-';
+     c25:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c2a:	89 f7                	mov    %esi,%edi
+     c2c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c2f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c32:	01 df                	add    %ebx,%edi
+     c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c38:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     c3b:	83 ec 04             	sub    $0x4,%esp
+     c3e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c41:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c44:	6a 01                	push   $0x1
+     c46:	50                   	push   %eax
+     c47:	56                   	push   %esi
+     c48:	e8 a6 fd ff ff       	call   9f3 <write>
+  while(--i >= 0)
+     c4d:	89 f8                	mov    %edi,%eax
+     c4f:	83 c4 10             	add    $0x10,%esp
+     c52:	83 ef 01             	sub    $0x1,%edi
+     c55:	39 d8                	cmp    %ebx,%eax
+     c57:	75 df                	jne    c38 <printint+0x68>
+}
+     c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c5c:	5b                   	pop    %ebx
+     c5d:	5e                   	pop    %esi
+     c5e:	5f                   	pop    %edi
+     c5f:	5d                   	pop    %ebp
+     c60:	c3                   	ret
+     c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c68:	31 c0                	xor    %eax,%eax
+     c6a:	eb 89                	jmp    bf5 <printint+0x25>
+     c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	53                   	push   %ebx
+     c76:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c79:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     c7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     c7f:	0f b6 1e             	movzbl (%esi),%ebx
+     c82:	83 c6 01             	add    $0x1,%esi
+     c85:	84 db                	test   %bl,%bl
+     c87:	74 67                	je     cf0 <printf+0x80>
+     c89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c8c:	31 d2                	xor    %edx,%edx
+     c8e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     c91:	eb 34                	jmp    cc7 <printf+0x57>
+     c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c97:	90                   	nop
+     c98:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     c9b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     ca0:	83 f8 25             	cmp    $0x25,%eax
+     ca3:	74 18                	je     cbd <printf+0x4d>
+  write(fd, &c, 1);
+     ca5:	83 ec 04             	sub    $0x4,%esp
+     ca8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     cab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cae:	6a 01                	push   $0x1
+     cb0:	50                   	push   %eax
+     cb1:	57                   	push   %edi
+     cb2:	e8 3c fd ff ff       	call   9f3 <write>
+     cb7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     cba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     cbd:	0f b6 1e             	movzbl (%esi),%ebx
+     cc0:	83 c6 01             	add    $0x1,%esi
+     cc3:	84 db                	test   %bl,%bl
+     cc5:	74 29                	je     cf0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     cc7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cca:	85 d2                	test   %edx,%edx
+     ccc:	74 ca                	je     c98 <printf+0x28>
+      }
+    } else if(state == '%'){
+     cce:	83 fa 25             	cmp    $0x25,%edx
+     cd1:	75 ea                	jne    cbd <printf+0x4d>
+      if(c == 'd'){
+     cd3:	83 f8 25             	cmp    $0x25,%eax
+     cd6:	0f 84 24 01 00 00    	je     e00 <printf+0x190>
+     cdc:	83 e8 63             	sub    $0x63,%eax
+     cdf:	83 f8 15             	cmp    $0x15,%eax
+     ce2:	77 1c                	ja     d00 <printf+0x90>
+     ce4:	ff 24 85 e0 13 00 00 	jmp    *0x13e0(,%eax,4)
+     ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf3:	5b                   	pop    %ebx
+     cf4:	5e                   	pop    %esi
+     cf5:	5f                   	pop    %edi
+     cf6:	5d                   	pop    %ebp
+     cf7:	c3                   	ret
+     cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+  write(fd, &c, 1);
+     d00:	83 ec 04             	sub    $0x4,%esp
+     d03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d0a:	6a 01                	push   $0x1
+     d0c:	52                   	push   %edx
+     d0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d10:	57                   	push   %edi
+     d11:	e8 dd fc ff ff       	call   9f3 <write>
+     d16:	83 c4 0c             	add    $0xc,%esp
+     d19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d1c:	6a 01                	push   $0x1
+     d1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     d21:	52                   	push   %edx
+     d22:	57                   	push   %edi
+     d23:	e8 cb fc ff ff       	call   9f3 <write>
+        putc(fd, c);
+     d28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d2b:	31 d2                	xor    %edx,%edx
+     d2d:	eb 8e                	jmp    cbd <printf+0x4d>
+     d2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     d30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     d33:	83 ec 0c             	sub    $0xc,%esp
+     d36:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d3b:	8b 13                	mov    (%ebx),%edx
+     d3d:	6a 00                	push   $0x0
+     d3f:	89 f8                	mov    %edi,%eax
+        ap++;
+     d41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     d44:	e8 87 fe ff ff       	call   bd0 <printint>
+        ap++;
+     d49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     d4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d4f:	31 d2                	xor    %edx,%edx
+     d51:	e9 67 ff ff ff       	jmp    cbd <printf+0x4d>
+     d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     d63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d65:	83 c0 04             	add    $0x4,%eax
+     d68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     d6b:	85 db                	test   %ebx,%ebx
+     d6d:	0f 84 9d 00 00 00    	je     e10 <printf+0x1a0>
+        while(*s != 0){
+     d73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     d76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     d78:	84 c0                	test   %al,%al
+     d7a:	0f 84 3d ff ff ff    	je     cbd <printf+0x4d>
+     d80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     d86:	89 de                	mov    %ebx,%esi
+     d88:	89 d3                	mov    %edx,%ebx
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     d90:	83 ec 04             	sub    $0x4,%esp
+     d93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     d96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     d99:	6a 01                	push   $0x1
+     d9b:	53                   	push   %ebx
+     d9c:	57                   	push   %edi
+     d9d:	e8 51 fc ff ff       	call   9f3 <write>
+        while(*s != 0){
+     da2:	0f b6 06             	movzbl (%esi),%eax
+     da5:	83 c4 10             	add    $0x10,%esp
+     da8:	84 c0                	test   %al,%al
+     daa:	75 e4                	jne    d90 <printf+0x120>
+      state = 0;
+     dac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     daf:	31 d2                	xor    %edx,%edx
+     db1:	e9 07 ff ff ff       	jmp    cbd <printf+0x4d>
+     db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     dc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     dc3:	83 ec 0c             	sub    $0xc,%esp
+     dc6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     dcb:	8b 13                	mov    (%ebx),%edx
+     dcd:	6a 01                	push   $0x1
+     dcf:	e9 6b ff ff ff       	jmp    d3f <printf+0xcf>
+     dd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     dd8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     ddb:	83 ec 04             	sub    $0x4,%esp
+     dde:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     de1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     de3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     de6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     de9:	6a 01                	push   $0x1
+     deb:	52                   	push   %edx
+     dec:	57                   	push   %edi
+     ded:	e8 01 fc ff ff       	call   9f3 <write>
+        ap++;
+     df2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     df5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     df8:	31 d2                	xor    %edx,%edx
+     dfa:	e9 be fe ff ff       	jmp    cbd <printf+0x4d>
+     dff:	90                   	nop
+  write(fd, &c, 1);
+     e00:	83 ec 04             	sub    $0x4,%esp
+     e03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e09:	6a 01                	push   $0x1
+     e0b:	e9 11 ff ff ff       	jmp    d21 <printf+0xb1>
+     e10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e15:	bb d6 13 00 00       	mov    $0x13d6,%ebx
+     e1a:	e9 61 ff ff ff       	jmp    d80 <printf+0x110>
+     e1f:	90                   	nop
+
+00000e20 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+     e20:	55                   	push   %ebp
+     e21:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e23:	a1 54 29 00 00       	mov    0x2954,%eax
+{
+     e28:	89 e5                	mov    %esp,%ebp
+     e2a:	56                   	push   %esi
+     e2b:	53                   	push   %ebx
+     e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e34:	39 ca                	cmp    %ecx,%edx
+     e36:	73 30                	jae    e68 <bigfree+0x48>
+     e38:	39 c1                	cmp    %eax,%ecx
+     e3a:	72 04                	jb     e40 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e3c:	39 c2                	cmp    %eax,%edx
+     e3e:	72 f0                	jb     e30 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e40:	8b 59 04             	mov    0x4(%ecx),%ebx
+     e43:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     e46:	39 f0                	cmp    %esi,%eax
+     e48:	74 26                	je     e70 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e4a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e4c:	8b 42 04             	mov    0x4(%edx),%eax
+     e4f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     e52:	39 d9                	cmp    %ebx,%ecx
+     e54:	74 30                	je     e86 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e56:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e58:	5b                   	pop    %ebx
+  freep = p;
+     e59:	89 15 54 29 00 00    	mov    %edx,0x2954
+}
+     e5f:	5e                   	pop    %esi
+     e60:	5d                   	pop    %ebp
+     e61:	c3                   	ret
+     e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e68:	39 c1                	cmp    %eax,%ecx
+     e6a:	72 d0                	jb     e3c <bigfree+0x1c>
+     e6c:	eb c2                	jmp    e30 <bigfree+0x10>
+     e6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e70:	03 58 04             	add    0x4(%eax),%ebx
+     e73:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e76:	8b 02                	mov    (%edx),%eax
+     e78:	8b 00                	mov    (%eax),%eax
+     e7a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     e7c:	8b 42 04             	mov    0x4(%edx),%eax
+     e7f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     e82:	39 d9                	cmp    %ebx,%ecx
+     e84:	75 d0                	jne    e56 <bigfree+0x36>
+    p->s.size += bp->s.size;
+     e86:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     e89:	89 15 54 29 00 00    	mov    %edx,0x2954
+    p->s.size += bp->s.size;
+     e8f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e92:	8b 09                	mov    (%ecx),%ecx
+     e94:	89 0a                	mov    %ecx,(%edx)
+}
+     e96:	5b                   	pop    %ebx
+     e97:	5e                   	pop    %esi
+     e98:	5d                   	pop    %ebp
+     e99:	c3                   	ret
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ea0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	89 c7                	mov    %eax,%edi
+     ea6:	56                   	push   %esi
+     ea7:	53                   	push   %ebx
+     ea8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     eab:	a1 54 29 00 00       	mov    0x2954,%eax
+     eb0:	85 c0                	test   %eax,%eax
+     eb2:	0f 84 88 00 00 00    	je     f40 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eb8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     eba:	8b 4a 04             	mov    0x4(%edx),%ecx
+     ebd:	39 f9                	cmp    %edi,%ecx
+     ebf:	73 5f                	jae    f20 <bigalloc+0x80>
+  if(nu < 4096)
+     ec1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ec6:	39 df                	cmp    %ebx,%edi
+     ec8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ecb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     ed2:	eb 0d                	jmp    ee1 <bigalloc+0x41>
+     ed4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ed8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     eda:	8b 4a 04             	mov    0x4(%edx),%ecx
+     edd:	39 f9                	cmp    %edi,%ecx
+     edf:	73 3f                	jae    f20 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     ee1:	89 d0                	mov    %edx,%eax
+     ee3:	39 15 54 29 00 00    	cmp    %edx,0x2954
+     ee9:	75 ed                	jne    ed8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     eeb:	83 ec 0c             	sub    $0xc,%esp
+     eee:	56                   	push   %esi
+     eef:	e8 67 fb ff ff       	call   a5b <sbrk>
+  if(p == (char*)-1)
+     ef4:	83 c4 10             	add    $0x10,%esp
+     ef7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     efa:	74 11                	je     f0d <bigalloc+0x6d>
+  hp->s.size = nu;
+     efc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+     eff:	e8 1c ff ff ff       	call   e20 <bigfree>
+  return freep;
+     f04:	a1 54 29 00 00       	mov    0x2954,%eax
+      if((p = morecore(nunits)) == 0)
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	75 cb                	jne    ed8 <bigalloc+0x38>
+        return 0;
+  }
+}
+     f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f10:	31 d2                	xor    %edx,%edx
+}
+     f12:	5b                   	pop    %ebx
+     f13:	89 d0                	mov    %edx,%eax
+     f15:	5e                   	pop    %esi
+     f16:	5f                   	pop    %edi
+     f17:	5d                   	pop    %ebp
+     f18:	c3                   	ret
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     f20:	39 cf                	cmp    %ecx,%edi
+     f22:	74 4c                	je     f70 <bigalloc+0xd0>
+        p->s.size -= nunits;
+     f24:	29 f9                	sub    %edi,%ecx
+     f26:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     f29:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     f2c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     f2f:	a3 54 29 00 00       	mov    %eax,0x2954
+}
+     f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f37:	89 d0                	mov    %edx,%eax
+     f39:	5b                   	pop    %ebx
+     f3a:	5e                   	pop    %esi
+     f3b:	5f                   	pop    %edi
+     f3c:	5d                   	pop    %ebp
+     f3d:	c3                   	ret
+     f3e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+     f40:	c7 05 54 29 00 00 58 	movl   $0x2958,0x2954
+     f47:	29 00 00 
+    base.s.size = 0;
+     f4a:	ba 58 29 00 00       	mov    $0x2958,%edx
+    base.s.ptr = freep = prevp = &base;
+     f4f:	c7 05 58 29 00 00 58 	movl   $0x2958,0x2958
+     f56:	29 00 00 
+    base.s.size = 0;
+     f59:	c7 05 5c 29 00 00 00 	movl   $0x0,0x295c
+     f60:	00 00 00 
+    if(p->s.size >= nunits){
+     f63:	e9 59 ff ff ff       	jmp    ec1 <bigalloc+0x21>
+     f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f70:	8b 0a                	mov    (%edx),%ecx
+     f72:	89 08                	mov    %ecx,(%eax)
+     f74:	eb b9                	jmp    f2f <bigalloc+0x8f>
+     f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <free>:
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	83 ec 04             	sub    $0x4,%esp
+     f87:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+     f8a:	85 c9                	test   %ecx,%ecx
+     f8c:	74 58                	je     fe6 <free+0x66>
+  bp = (Header*)ap - 1;
+     f8e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     f91:	ba 01 00 00 00       	mov    $0x1,%edx
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+     fa0:	89 d0                	mov    %edx,%eax
+     fa2:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+  while(xchg(&locked, 1) != 0)
+     fa9:	85 c0                	test   %eax,%eax
+     fab:	75 f3                	jne    fa0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+     fad:	8b 51 fc             	mov    -0x4(%ecx),%edx
+     fb0:	83 fa 40             	cmp    $0x40,%edx
+     fb3:	77 3b                	ja     ff0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+     fb5:	83 fa 02             	cmp    $0x2,%edx
+     fb8:	76 3f                	jbe    ff9 <free+0x79>
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     fc0:	83 c0 01             	add    $0x1,%eax
+     fc3:	39 14 85 60 14 00 00 	cmp    %edx,0x1460(,%eax,4)
+     fca:	72 f4                	jb     fc0 <free+0x40>
+    bp->s.ptr = classfree[c];
+     fcc:	8b 14 85 20 29 00 00 	mov    0x2920(,%eax,4),%edx
+    classfree[c] = bp;
+     fd3:	89 1c 85 20 29 00 00 	mov    %ebx,0x2920(,%eax,4)
+    bp->s.ptr = classfree[c];
+     fda:	89 51 f8             	mov    %edx,-0x8(%ecx)
+     fdd:	31 c0                	xor    %eax,%eax
+     fdf:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+}
+     fe6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fe9:	c9                   	leave
+     fea:	c3                   	ret
+     feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+    bigfree(bp);
+     ff0:	89 d8                	mov    %ebx,%eax
+     ff2:	e8 29 fe ff ff       	call   e20 <bigfree>
+     ff7:	eb e4                	jmp    fdd <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+     ff9:	31 c0                	xor    %eax,%eax
+     ffb:	eb cf                	jmp    fcc <free+0x4c>
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001000 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1000:	55                   	push   %ebp
+    1001:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1006:	89 e5                	mov    %esp,%ebp
+    1008:	57                   	push   %edi
+    1009:	56                   	push   %esi
+    100a:	53                   	push   %ebx
+    100b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    100e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1011:	8d 50 07             	lea    0x7(%eax),%edx
+    1014:	c1 ea 03             	shr    $0x3,%edx
+    1017:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1020:	89 c8                	mov    %ecx,%eax
+    1022:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+    1029:	85 c0                	test   %eax,%eax
+    102b:	75 f3                	jne    1020 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+    102d:	89 c3                	mov    %eax,%ebx
+    102f:	83 fa 40             	cmp    $0x40,%edx
+    1032:	77 4c                	ja     1080 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+    1034:	be 02 00 00 00       	mov    $0x2,%esi
+    1039:	83 fa 02             	cmp    $0x2,%edx
+    103c:	76 10                	jbe    104e <malloc+0x4e>
+    103e:	66 90                	xchg   %ax,%ax
+    1040:	83 c3 01             	add    $0x1,%ebx
+    1043:	8b 34 9d 60 14 00 00 	mov    0x1460(,%ebx,4),%esi
+    104a:	39 d6                	cmp    %edx,%esi
+    104c:	72 f2                	jb     1040 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+    104e:	8b 14 9d 20 29 00 00 	mov    0x2920(,%ebx,4),%edx
+    1055:	85 d2                	test   %edx,%edx
+    1057:	74 47                	je     10a0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    1059:	8b 3a                	mov    (%edx),%edi
+    105b:	89 3c 9d 20 29 00 00 	mov    %edi,0x2920(,%ebx,4)
+    1062:	31 c0                	xor    %eax,%eax
+    1064:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+    106b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+    106e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+    1071:	5b                   	pop    %ebx
+    1072:	5e                   	pop    %esi
+    1073:	5f                   	pop    %edi
+    1074:	5d                   	pop    %ebp
+    1075:	c3                   	ret
+    1076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+    1080:	89 d0                	mov    %edx,%eax
+    1082:	e8 19 fe ff ff       	call   ea0 <bigalloc>
+    1087:	89 c2                	mov    %eax,%edx
+    1089:	89 d8                	mov    %ebx,%eax
+    108b:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+  return p ? (void*)(p + 1) : 0;
+    1092:	85 d2                	test   %edx,%edx
+    1094:	75 d5                	jne    106b <malloc+0x6b>
+    1096:	31 c0                	xor    %eax,%eax
+}
+    1098:	83 c4 1c             	add    $0x1c,%esp
+    109b:	5b                   	pop    %ebx
+    109c:	5e                   	pop    %esi
+    109d:	5f                   	pop    %edi
+    109e:	5d                   	pop    %ebp
+    109f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    10a0:	b8 00 02 00 00       	mov    $0x200,%eax
+    10a5:	e8 f6 fd ff ff       	call   ea0 <bigalloc>
+    10aa:	85 c0                	test   %eax,%eax
+    10ac:	74 44                	je     10f2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10ae:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    10b5:	8b 14 9d 20 29 00 00 	mov    0x2920(,%ebx,4),%edx
+    10bc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    10bf:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    10c2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    10c8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    10cb:	39 cf                	cmp    %ecx,%edi
+    10cd:	72 8a                	jb     1059 <malloc+0x59>
+    10cf:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    10d2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    10d5:	8d 76 00             	lea    0x0(%esi),%esi
+    10d8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    10da:	89 70 04             	mov    %esi,0x4(%eax)
+    10dd:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10df:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    10e1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    10e3:	01 d8                	add    %ebx,%eax
+    10e5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    10e8:	73 ee                	jae    10d8 <malloc+0xd8>
+    10ea:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    10ed:	e9 69 ff ff ff       	jmp    105b <malloc+0x5b>
+    10f2:	f0 87 05 00 29 00 00 	lock xchg %eax,0x2900
+  return p ? (void*)(p + 1) : 0;
+    10f9:	31 c0                	xor    %eax,%eax
+    10fb:	eb 9b                	jmp    1098 <malloc+0x98>
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001100 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	56                   	push   %esi
+    1104:	53                   	push   %ebx
+    1105:	8b 45 08             	mov    0x8(%ebp),%eax
+    1108:	f7 65 0c             	mull   0xc(%ebp)
+    110b:	70 33                	jo     1140 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    110d:	83 ec 0c             	sub    $0xc,%esp
+    1110:	89 c3                	mov    %eax,%ebx
+    1112:	50                   	push   %eax
+    1113:	e8 e8 fe ff ff       	call   1000 <malloc>
+    1118:	83 c4 10             	add    $0x10,%esp
+    111b:	89 c6                	mov    %eax,%esi
+    111d:	85 c0                	test   %eax,%eax
+    111f:	74 1f                	je     1140 <calloc+0x40>
+    memset(p, 0, n);
+    1121:	83 ec 04             	sub    $0x4,%esp
+    1124:	53                   	push   %ebx
+    1125:	6a 00                	push   $0x0
+    1127:	50                   	push   %eax
+    1128:	e8 23 f7 ff ff       	call   850 <memset>
+    112d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1133:	89 f0                	mov    %esi,%eax
+    1135:	5b                   	pop    %ebx
+    1136:	5e                   	pop    %esi
+    1137:	5d                   	pop    %ebp
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1140:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1143:	31 f6                	xor    %esi,%esi
+}
+    1145:	89 f0                	mov    %esi,%eax
+    1147:	5b                   	pop    %ebx
+    1148:	5e                   	pop    %esi
+    1149:	5d                   	pop    %ebp
+    114a:	c3                   	ret
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+    1155:	53                   	push   %ebx
+    1156:	83 ec 0c             	sub    $0xc,%esp
+    1159:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    115c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    115f:	85 db                	test   %ebx,%ebx
+    1161:	74 55                	je     11b8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1163:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1166:	89 de                	mov    %ebx,%esi
+    1168:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    116f:	39 c7                	cmp    %eax,%edi
+    1171:	72 0d                	jb     1180 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1176:	89 f0                	mov    %esi,%eax
+    1178:	5b                   	pop    %ebx
+    1179:	5e                   	pop    %esi
+    117a:	5f                   	pop    %edi
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1180:	83 ec 0c             	sub    $0xc,%esp
+    1183:	50                   	push   %eax
+    1184:	e8 77 fe ff ff       	call   1000 <malloc>
+    1189:	83 c4 10             	add    $0x10,%esp
+    118c:	89 c6                	mov    %eax,%esi
+    118e:	85 c0                	test   %eax,%eax
+    1190:	74 e1                	je     1173 <realloc+0x23>
+  memmove(p, ap, have);
+    1192:	83 ec 04             	sub    $0x4,%esp
+    1195:	57                   	push   %edi
+    1196:	53                   	push   %ebx
+    1197:	50                   	push   %eax
+    1198:	e8 03 f8 ff ff       	call   9a0 <memmove>
+  free(ap);
+    119d:	89 1c 24             	mov    %ebx,(%esp)
+    11a0:	e8 db fd ff ff       	call   f80 <free>
+  return p;
+    11a5:	83 c4 10             	add    $0x10,%esp
+}
+    11a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ab:	89 f0                	mov    %esi,%eax
+    11ad:	5b                   	pop    %ebx
+    11ae:	5e                   	pop    %esi
+    11af:	5f                   	pop    %edi
+    11b0:	5d                   	pop    %ebp
+    11b1:	c3                   	ret
+    11b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    11b8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    11bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11be:	5b                   	pop    %ebx
+    11bf:	5e                   	pop    %esi
+    11c0:	5f                   	pop    %edi
+    11c1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    11c2:	e9 39 fe ff ff       	jmp    1000 <malloc>
@@ -0,0 +1,181 @@
+// Tests for mmap() and munmap().
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mman.h"
+
+#define FSIZE (3*4096 + 100)  // three pages and a bit
+
+char buf[4096];
+
+void
+fail(char *msg)
+{
+  printf(1, "mmaptest: %s failed\n", msg);
+  unlink("mmaptest.f");
+  exit();
+}
+
+// Expected byte at offset i of the test file.
+char
+expect(int i)
+{
+  return 'a' + i % 23;
+}
+
+void
+makefile(void)
+{
+  int fd, i, j, n;
+
+  if((fd = open("mmaptest.f", O_CREATE|O_RDWR)) < 0)
+    fail("create");
+  for(i = 0; i < FSIZE; i += n){
+    n = FSIZE - i < sizeof(buf) ? FSIZE - i : sizeof(buf);
+    for(j = 0; j < n; j++)
+      buf[j] = expect(i + j);
+    if(write(fd, buf, n) != n)
+      fail("write");
+  }
+  close(fd);
+}
+
+void
+sharedtest(void)
+{
+  char *a, orig[3];
+  int fd, i, fds[2];
+
+  printf(1, "shared test\n");
+  fd = open("mmaptest.f", O_RDWR);
+  a = mmap(0, FSIZE, PROT_READ, MAP_SHARED, fd, 0);
+  if(a == MAP_FAILED)
+    fail("mmap");
+  for(i = 0; i < FSIZE; i++)
+    if(a[i] != expect(i))
+      fail("shared data");
+  // The rest of the last page reads as zero.
+  if(a[FSIZE] != 0 || a[4*4096-1] != 0)
+    fail("zero fill");
+
+  // A write() to the file shows up in the mapping.
+  if(pwrite(fd, "XYZ", 3, 4095) != 3)
+    fail("pwrite");
+  if(a[4095] != 'X' || a[4096] != 'Y' || a[4097] != 'Z')
+    fail("coherence");
+  for(i = 0; i < 3; i++)
+    orig[i] = expect(4095 + i);
+  if(pwrite(fd, orig, 3, 4095) != 3 || a[4096] != expect(4096))
+    fail("pwrite back");
+
+  // The kernel may read a mapping but not write into it.
+  if(pipe(fds) < 0)
+    fail("pipe");
+  if(write(fds[1], a + 4090, 10) != 10)
+    fail("write from mapping");
+  if(read(fds[0], buf, 10) != 10 || buf[9] != expect(4099))
+    fail("pipe data");
+  close(fds[0]);
+  close(fds[1]);
+  if(read(fd, a, 10) >= 0)
+    fail("read into read-only mapping");
+
+  // Shared mappings are read-only.
+  if(mmap(0, FSIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED)
+    fail("writable shared mapping");
+  if(munmap(a, FSIZE) < 0)
+    fail("munmap");
+  close(fd);
+  printf(1, "shared test ok\n");
+}
+
+void
+privatetest(void)
+{
+  char *a;
+  int fd, i, pid;
+
+  printf(1, "private test\n");
+  fd = open("mmaptest.f", O_RDONLY);
+  a = mmap(0, FSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(a == MAP_FAILED)
+    fail("mmap");
+  close(fd);  // the mapping keeps the file open
+
+  // Writes go to a private copy, not the file.
+  a[0] = '!';
+  a[FSIZE-1] = '!';
+  fd = open("mmaptest.f", O_RDONLY);
+  if(pread(fd, buf, 1, 0) != 1 || buf[0] != expect(0))
+    fail("private write reached the file");
+
+  // The kernel may read() into a private mapping.
+  if(read(fd, a + 4096, 10) != 10 || a[4096] != expect(0))
+    fail("read into private mapping");
+  close(fd);
+
+  // fork() copies the mapping.
+  pid = fork();
+  if(pid < 0)
+    fail("fork");
+  if(pid == 0){
+    if(a[0] != '!' || a[1] != expect(1) || a[FSIZE-1] != '!')
+      fail("child data");
+    a[1] = '?';
+    exit();
+  }
+  wait();
+  if(a[1] != expect(1))
+    fail("child write reached parent");
+
+  // Unmap the first page, then the rest.
+  if(munmap(a, 4096) < 0)
+    fail("munmap head");
+  for(i = 4096+10; i < FSIZE-1; i++)
+    if(a[i] != expect(i))
+      fail("data after munmap");
+  if(munmap(a + 4096, FSIZE - 4096) < 0)
+    fail("munmap tail");
+  if(munmap(a, 4096) >= 0)
+    fail("munmap twice");
+  printf(1, "private test ok\n");
+}
+
+void
+badtest(void)
+{
+  int fds[2], fd;
+
+  printf(1, "bad args test\n");
+  if(pipe(fds) < 0)
+    fail("pipe");
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fds[0], 0) != MAP_FAILED)
+    fail("mmap pipe");
+  close(fds[0]);
+  close(fds[1]);
+  fd = open("mmaptest.f", O_RDONLY);
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 100) != MAP_FAILED)
+    fail("unaligned offset");
+  if(mmap(0, 0, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+    fail("zero length");
+  close(fd);
+  fd = open("mmaptest.f", O_WRONLY);
+  if(mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+    fail("write-only file");
+  close(fd);
+  printf(1, "bad args test ok\n");
+}
+
+int
+main(void)
+{
+  makefile();
+  sharedtest();
+  privatetest();
+  badtest();
+  unlink("mmaptest.f");
+  printf(1, "mmaptest ok\n");
+  exit();
+}
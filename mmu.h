@@ -10,6 +10,11 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_OSFXSR      0x00000200      // Enable fxsave/fxrstor and SSE
+
+// CPUID leaf 1 %edx feature flags
+#define CPUID_FXSR      0x01000000      // fxsave/fxrstor
+#define CPUID_SSE2      0x04000000      // SSE2
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -95,6 +100,11 @@ struct segdesc {
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
 #define PTE_PS          0x080   // Page Size
+#define PTE_PC          0x200   // Page cache page (bit for software use)
+#define PTE_SHM         0x400   // Shared memory segment page (software)
+
+// Page fault error code bits
+#define FEC_WR          0x002   // Fault was caused by a write
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -6,10 +6,25 @@
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
+#define TMPFSDEV      2  // device number of the in-memory tmpfs
+#define NTNODE      200  // maximum number of tmpfs i-nodes
+#define NMOUNT        4  // maximum number of mounted file systems
+#define NPCACHE     128  // size of file page cache, in pages
+#define NVMA          8  // mmap()ed regions per process
+#define NSHM         16  // shared memory segments
+#define SHMMAXPAGES  64  // pages in a shared memory segment
+#define NLOCKCLASS   32  // lock classes tracked by lock statistics
+#define LBMAXITERS 1000000  // max acquires per lockbench() call
+#define LBMAXHOLD  1000000  // max cycles lockbench() holds its lock, with interrupts off
+#define NPROFSAMPLE 2048  // profiler samples buffered per CPU
+#define NTRACE     1024  // trace events buffered per CPU
+#define NDLLOCK       8  // test sleep-locks for dltest (deadlock.c)
+#define NDEADLOG     16  // deadlocks kept in the watchdog's log
 #define MAXARG       32  // max exec arguments
+#define MAXPATH     128  // max path name passed to a system call
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (LOGSIZE+MAXOPBLOCKS*2)  // size of disk block cache: logged blocks stay pinned, plus room for reads
 #define FSSIZE       2500  // size of file system in blocks (increased to fit all programs)
 
 // MLFQ constants
@@ -18,5 +33,5 @@
 #define TIME_SLICE_1 10  
 #define TIME_SLICE_2 20
 #define BOOST_INTERVAL_TICKS 1000 // Priority boost every 500 ticks (5 seconds)
-#define MAX_MLFQ_SNAPSHOTS 1000  // Increased from 200 to 1000
+#define NMLFQREC 1024  // MLFQ recorder ring size, in transitions
 
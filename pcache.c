@@ -0,0 +1,230 @@
+// File page cache.
+//
+// The page cache holds whole pages of file contents, keyed by
+// (device, inode number, page number within the file), so that
+// mmap() can map file data straight into user page tables.
+// A page is filled from the file with readi() the first time it
+// is needed, and stays cached until it is recycled.
+//
+// Interface:
+// * To get a referenced page of a file, call pcacheget.
+// * To take another reference to a page, call pcachedup.
+// * When done with the page, call pcacheput.
+// * writei calls pcachewrite so that cached pages always
+//     match the file.
+// * When a file is freed, pcachedrop forgets its pages.
+//
+// Cached pages are never written back: mappings that can be
+// written are private, and get their own copy of a page before
+// the first write (see vmfault in vm.c).
+//
+// A page with references is mapped by some process and cannot
+// be recycled. pg->lock is held only while the page is filled.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+struct page {
+  uint dev;
+  uint inum;
+  uint pgno;            // page number within the file
+  int valid;            // has data been read from the file?
+  uint refcnt;
+  struct sleeplock lock;
+  char *data;           // PGSIZE bytes, allocated on first use
+  struct page *prev;    // LRU cache list
+  struct page *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct page page[NPCACHE];
+
+  // Linked list of all pages, through prev/next.
+  // head.next is most recently used.
+  struct page head;
+} pcache;
+
+void
+pcacheinit(void)
+{
+  struct page *pg;
+
+  initlock(&pcache.lock, "pcache");
+
+  pcache.head.prev = &pcache.head;
+  pcache.head.next = &pcache.head;
+  for(pg = pcache.page; pg < pcache.page+NPCACHE; pg++){
+    pg->next = pcache.head.next;
+    pg->prev = &pcache.head;
+    initsleeplock(&pg->lock, "page");
+    pcache.head.next->prev = pg;
+    pcache.head.next = pg;
+  }
+}
+
+// Look through the page cache for page pgno of inode inum on
+// device dev. If not found, recycle an unused page.
+// In either case, return a referenced, locked page,
+// or 0 if every page is in use or there is no memory.
+static struct page*
+pget(uint dev, uint inum, uint pgno)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+
+  // Is the page already cached?
+  for(pg = pcache.head.next; pg != &pcache.head; pg = pg->next){
+    if(pg->dev == dev && pg->inum == inum && pg->pgno == pgno){
+      pg->refcnt++;
+      release(&pcache.lock);
+      acquiresleep(&pg->lock);
+      return pg;
+    }
+  }
+
+  // Not cached; recycle the least recently used unused page.
+  for(pg = pcache.head.prev; pg != &pcache.head; pg = pg->prev){
+    if(pg->refcnt == 0){
+      if(pg->data == 0 && (pg->data = kalloc()) == 0)
+        break;
+      pg->dev = dev;
+      pg->inum = inum;
+      pg->pgno = pgno;
+      pg->valid = 0;
+      pg->refcnt = 1;
+      release(&pcache.lock);
+      acquiresleep(&pg->lock);
+      return pg;
+    }
+  }
+  release(&pcache.lock);
+  return 0;
+}
+
+// Return the kernel address of page pgno of file ip, reading it
+// from the file if necessary, and take a reference to it.
+// Bytes past the end of the file read as zero.
+// Returns 0 if the page cache is full.
+// Caller must not hold ip->lock.
+char*
+pcacheget(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+
+  if((pg = pget(ip->dev, ip->inum, pgno)) == 0)
+    return 0;
+  if(!pg->valid){
+    memset(pg->data, 0, PGSIZE);
+    ilock(ip);
+    readi(ip, pg->data, pgno*PGSIZE, PGSIZE);
+    // Set valid while still holding ip->lock, so that
+    // no writei() can slip in between and be missed.
+    acquire(&pcache.lock);
+    pg->valid = 1;
+    release(&pcache.lock);
+    iunlock(ip);
+  }
+  releasesleep(&pg->lock);
+  return pg->data;
+}
+
+// Find the page whose data is at kernel address data.
+// Caller must hold pcache.lock.
+static struct page*
+pfind(char *data)
+{
+  struct page *pg;
+
+  for(pg = pcache.page; pg < pcache.page+NPCACHE; pg++)
+    if(pg->data == data)
+      return pg;
+  panic("pfind");
+}
+
+// Take another reference to the cached page at data.
+void
+pcachedup(char *data)
+{
+  acquire(&pcache.lock);
+  pfind(data)->refcnt++;
+  release(&pcache.lock);
+}
+
+// Drop a reference to the cached page at data.
+// Move it to the head of the most-recently-used list
+// if that was the last reference.
+void
+pcacheput(char *data)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+  pg = pfind(data);
+  if(pg->refcnt < 1)
+    panic("pcacheput");
+  pg->refcnt--;
+  if(pg->refcnt == 0){
+    // no one is mapping it.
+    pg->next->prev = pg->prev;
+    pg->prev->next = pg->next;
+    pg->next = pcache.head.next;
+    pg->prev = &pcache.head;
+    pcache.head.next->prev = pg;
+    pcache.head.next = pg;
+  }
+  release(&pcache.lock);
+}
+
+// Copy n bytes just written at offset off of file ip into
+// any cached pages that hold them.
+// Called by writei, with ip->lock held.
+void
+pcachewrite(struct inode *ip, uint off, char *src, uint n)
+{
+  struct page *pg;
+  uint start, end;
+
+  acquire(&pcache.lock);
+  for(pg = pcache.page; pg < pcache.page+NPCACHE; pg++){
+    if(!pg->valid || pg->dev != ip->dev || pg->inum != ip->inum)
+      continue;
+    start = pg->pgno*PGSIZE;
+    end = start + PGSIZE;
+    if(off >= end || off + n <= start)
+      continue;
+    if(off >= start)
+      memmove(pg->data + (off - start), src, min(n, end - off));
+    else
+      memmove(pg->data, src + (start - off), min(off + n - start, PGSIZE));
+  }
+  release(&pcache.lock);
+}
+
+// Forget the cached pages of inode inum on device dev, or of
+// every inode on dev if inum is 0, because the inode has been
+// freed and its number may be reused. Pages that are still
+// mapped keep their data but can no longer be found.
+void
+pcachedrop(uint dev, uint inum)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+  for(pg = pcache.page; pg < pcache.page+NPCACHE; pg++){
+    if(pg->dev == dev && (inum == 0 || pg->inum == inum)){
+      pg->inum = 0;
+      pg->valid = 0;
+    }
+  }
+  release(&pcache.lock);
+}
@@ -7,9 +7,13 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
+#include "poll.h"
 
 #define PIPESIZE 512
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
 struct pipe {
   struct spinlock lock;
   char data[PIPESIZE];
@@ -17,8 +21,18 @@ struct pipe {
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  struct waitq pollq;  // poll() calls waiting on either end
 };
 
+// Wake readers or writers sleeping on chan, and every poll()
+// on the pipe. Caller must hold p->lock.
+static void
+pipewakeup(struct pipe *p, void *chan)
+{
+  wakeup(chan);
+  pollwakeup(&p->pollq);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -34,6 +48,7 @@ pipealloc(struct file **f0, struct file **f1)
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
+  p->pollq.head = 0;
   initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
@@ -62,10 +77,10 @@ pipeclose(struct pipe *p, int writable)
   acquire(&p->lock);
   if(writable){
     p->writeopen = 0;
-    wakeup(&p->nread);
+    pipewakeup(p, &p->nread);
   } else {
     p->readopen = 0;
-    wakeup(&p->nwrite);
+    pipewakeup(p, &p->nwrite);
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
@@ -74,6 +89,41 @@ pipeclose(struct pipe *p, int writable)
     release(&p->lock);
 }
 
+// Copy as much of addr[0..n-1] into p->data as fits, in at
+// most two memmoves, one either side of the wrap-around point.
+// Caller must hold p->lock.
+static int
+pipecopyin(struct pipe *p, char *addr, int n)
+{
+  int tot, m;
+
+  for(tot = 0; tot < n && p->nwrite != p->nread + PIPESIZE; tot += m){
+    m = min(n - tot, PIPESIZE - (p->nwrite - p->nread));
+    m = min(m, PIPESIZE - p->nwrite % PIPESIZE);
+    memmove(&p->data[p->nwrite % PIPESIZE], addr + tot, m);
+    p->nwrite += m;
+  }
+  myproc()->pipeout += tot;
+  return tot;
+}
+
+// Copy up to n bytes out of p->data into addr.
+// Caller must hold p->lock.
+static int
+pipecopyout(struct pipe *p, char *addr, int n)
+{
+  int tot, m;
+
+  for(tot = 0; tot < n && p->nread != p->nwrite; tot += m){
+    m = min(n - tot, p->nwrite - p->nread);
+    m = min(m, PIPESIZE - p->nread % PIPESIZE);
+    memmove(addr + tot, &p->data[p->nread % PIPESIZE], m);
+    p->nread += m;
+  }
+  myproc()->pipein += tot;
+  return tot;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
@@ -81,18 +131,18 @@ pipewrite(struct pipe *p, char *addr, int n)
   int i;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
+  for(i = 0; i < n; ){
     while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
       }
-      wakeup(&p->nread);
+      pipewakeup(p, &p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    i += pipecopyin(p, addr + i, n - i);
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  pipewakeup(p, &p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -110,12 +160,97 @@ piperead(struct pipe *p, char *addr, int n)
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  i = pipecopyout(p, addr, n);  //DOC: piperead-copy
+  pipewakeup(p, &p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+  return i;
+}
+
+// Like piperead, but scatter the data over the buffers in iov.
+// Waits only until the pipe is non-empty, then copies whatever
+// is available under a single acquisition of the pipe lock.
+int
+pipereadv(struct pipe *p, struct iovec *iov, int iovcnt)
+{
+  int i, tot;
+
+  acquire(&p->lock);
+  while(p->nread == p->nwrite && p->writeopen){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock);
+  }
+  tot = 0;
+  for(i = 0; i < iovcnt && p->nread != p->nwrite; i++)
+    tot += pipecopyout(p, iov[i].iov_base, iov[i].iov_len);
+  pipewakeup(p, &p->nwrite);
+  release(&p->lock);
+  return tot;
+}
+
+// Wait until the pipe has room for at least one byte.
+// Returns -1 if the read side has been closed or the
+// caller was killed while waiting.
+int
+pipewaitspace(struct pipe *p)
+{
+  acquire(&p->lock);
+  while(p->nwrite == p->nread + PIPESIZE){
+    if(p->readopen == 0 || myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    pipewakeup(p, &p->nread);
+    sleep(&p->nwrite, &p->lock);
+  }
+  release(&p->lock);
+  return 0;
+}
+
+// Report whether the pipe can be read (POLLIN) or written
+// (POLLOUT) without blocking, and whether the other end has
+// been closed (POLLHUP for readers, POLLERR for writers).
+// If e is not 0, queue it to be woken on any change.
+int
+pipepoll(struct pipe *p, struct pollent *e)
+{
+  int r;
+
+  acquire(&p->lock);
+  if(e)
+    pollqueue(&p->pollq, &p->lock, e);
+  r = 0;
+  if(p->nread != p->nwrite || !p->writeopen)
+    r |= POLLIN;
+  if(!p->writeopen)
+    r |= POLLHUP;
+  if(p->nwrite != p->nread + PIPESIZE || !p->readopen)
+    r |= POLLOUT;
+  if(!p->readopen)
+    r |= POLLERR;
+  release(&p->lock);
+  return r;
+}
+
+// Copy as much of addr[0..n-1] into the pipe as currently fits,
+// without sleeping. Used by splice, which must not sleep on a
+// full pipe while it holds a buffer cache block.
+// Returns the number of bytes copied, or -1 if the read side
+// has been closed.
+int
+pipeput(struct pipe *p, char *addr, int n)
+{
+  int i;
+
+  acquire(&p->lock);
+  if(p->readopen == 0){
+    release(&p->lock);
+    return -1;
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  i = pipecopyin(p, addr, n);
+  pipewakeup(p, &p->nread);
   release(&p->lock);
   return i;
 }
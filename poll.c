@@ -0,0 +1,193 @@
+// poll(): wait for any of several files to become ready.
+//
+// Pipes and the console each keep a wait queue (struct waitq)
+// of the poll() calls waiting on them, guarded by the pipe's or
+// console's own lock. poll() puts one entry (struct pollent) on
+// the queue of every file it is asked about, checking the file
+// under the same lock, and sleeps on its struct poller. Anything
+// that may make the file ready calls pollwakeup(), with the lock
+// held, which marks every queued poller woken and wakes it; so a
+// change between the check and the sleep cannot be missed. A
+// woken poll() checks all its files again and, if none is ready
+// after all, goes back to sleep with its entries still queued.
+//
+// A poll() with a timeout also sits on a list of timed pollers,
+// which the timer interrupt wakes through polltimer() once
+// their time is up.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "poll.h"
+
+struct poller {
+  int woken;             // something may be ready
+  uint start;            // ticks when poll() began
+  int timeout;           // ticks to wait, if on the timed list
+  struct poller *next;   // timed list
+};
+
+struct pollent {
+  struct poller *pl;
+  struct waitq *q;       // queue this entry is on, or 0
+  struct spinlock *lk;   // lock guarding q
+  struct pollent *next;  // in q
+};
+
+// pollock guards every poller's woken flag and the timed list.
+// It is taken with a pipe or console lock held, never the other
+// way around.
+static struct spinlock pollock;
+static struct poller *timed;
+
+void
+pollinit(void)
+{
+  initlock(&pollock, "poll");
+}
+
+// Put e on q, which lk guards, so that pollwakeup(q) wakes
+// e's poller. Caller must hold lk.
+void
+pollqueue(struct waitq *q, struct spinlock *lk, struct pollent *e)
+{
+  e->q = q;
+  e->lk = lk;
+  e->next = q->head;
+  q->head = e;
+}
+
+// Take e off the queue it is on, if any.
+static void
+pollunqueue(struct pollent *e)
+{
+  struct pollent **pp;
+
+  if(e->q == 0)
+    return;
+  acquire(e->lk);
+  for(pp = &e->q->head; *pp; pp = &(*pp)->next){
+    if(*pp == e){
+      *pp = e->next;
+      break;
+    }
+  }
+  release(e->lk);
+  e->q = 0;
+}
+
+// Wake every poll() waiting on q.
+// Caller must hold the lock guarding q.
+void
+pollwakeup(struct waitq *q)
+{
+  struct pollent *e;
+
+  if(q->head == 0)
+    return;
+  acquire(&pollock);
+  for(e = q->head; e; e = e->next){
+    e->pl->woken = 1;
+    wakeup(e->pl);
+  }
+  release(&pollock);
+}
+
+// Wake the timed pollers whose time is up.
+// Called by the timer interrupt on every tick.
+void
+polltimer(void)
+{
+  struct poller *pl;
+
+  if(timed == 0)
+    return;
+  acquire(&pollock);
+  for(pl = timed; pl; pl = pl->next){
+    if(ticks - pl->start >= pl->timeout){
+      pl->woken = 1;
+      wakeup(pl);
+    }
+  }
+  release(&pollock);
+}
+
+// Check fds[0..n-1] for the events asked for, setting revents,
+// and if none is ready wait until one is, or until timeout ticks
+// have passed if timeout is not negative. Returns the number of
+// fds with revents set, 0 on timeout, or -1 if killed.
+int
+poll(struct pollfd *fds, int n, int timeout)
+{
+  struct proc *curproc = myproc();
+  struct file *f[NOFILE];
+  struct pollent ent[NOFILE];
+  struct poller pl, **pp;
+  int i, fd, nready, queued;
+
+  if(n < 0 || n > NOFILE)
+    return -1;
+  for(i = 0; i < n; i++){
+    fd = fds[i].fd;
+    f[i] = fdget(fd);
+    ent[i].pl = &pl;
+    ent[i].q = 0;
+  }
+  pl.woken = 0;
+  pl.start = ticks;
+  pl.timeout = timeout;
+
+  // Queue the entries on the first pass only, and not at all
+  // if there is to be no waiting.
+  queued = timeout == 0;
+  for(;;){
+    nready = 0;
+    for(i = 0; i < n; i++){
+      fds[i].revents = 0;
+      if(fds[i].fd < 0)
+        continue;
+      if(f[i] == 0)
+        fds[i].revents = POLLNVAL;
+      else
+        fds[i].revents = filepoll(f[i], queued ? 0 : &ent[i]) &
+                         (fds[i].events | POLLERR | POLLHUP);
+      if(fds[i].revents)
+        nready++;
+    }
+    queued = 1;
+    if(nready || curproc->killed)
+      break;
+    if(timeout >= 0 && ticks - pl.start >= timeout)
+      break;
+
+    acquire(&pollock);
+    if(timeout > 0){
+      pl.next = timed;
+      timed = &pl;
+    }
+    while(!pl.woken && !curproc->killed)
+      sleep(&pl, &pollock);
+    pl.woken = 0;
+    if(timeout > 0){
+      for(pp = &timed; *pp != &pl; pp = &(*pp)->next)
+        ;
+      *pp = pl.next;
+    }
+    release(&pollock);
+  }
+
+  for(i = 0; i < n; i++){
+    pollunqueue(&ent[i]);
+    if(f[i])
+      fileclose(f[i]);
+  }
+  if(curproc->killed)
+    return -1;
+  return nready;
+}
@@ -0,0 +1,14 @@
+// poll() events.
+// Both the kernel and user programs use this header file.
+
+#define POLLIN    0x01  // there is data to read, or end of file
+#define POLLOUT   0x04  // writing will not block
+#define POLLERR   0x08  // write end of a pipe with no reader (revents only)
+#define POLLHUP   0x10  // read end of a pipe with no writer (revents only)
+#define POLLNVAL  0x20  // fd is not open (revents only)
+
+struct pollfd {
+  int fd;         // file descriptor, or negative to skip
+  short events;   // POLLIN and/or POLLOUT
+  short revents;  // set by poll()
+};
@@ -6,6 +6,10 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "seqlock.h"
+#include "trace.h"
+#include "waitstat.h"
+#include "mlfqrec.h"
 
 extern uint ticks;
 extern struct spinlock tickslock;
@@ -15,8 +19,20 @@ struct {
   struct proc proc[NPROC];
 } ptable;
 
-// MLFQ recorder instance (declared as extern in proc.h)
-struct mlfq_recorder_t mlfq_recorder;
+// MLFQ recorder: a ring of level transitions, filled by
+// mlfqlog() while recording and drained by mlfqread().
+// Writers alone advance head and the reader alone advances
+// tail; transitions that find the ring full are dropped.
+struct {
+  struct spinlock lock;
+  int recording;             // 1 if recording, 0 otherwise
+  uint head;                 // next record to write
+  uint tail;                 // next record to read
+  uint lasttick;             // tick of the newest record
+  uint readtick;             // tick of the newest record read
+  uint dropped;              // transitions lost to a full ring
+  struct mlfqrec rec[NMLFQREC];
+} mlfq_recorder;
 
 static struct proc *initproc;
 
@@ -28,36 +44,42 @@ int nextpid = 1;
 #define SCHED_MLFQ 2    // Multi-Level Feedback Queue
 
 int current_scheduler_policy = SCHED_MLFQ;  // Start with MLFQ to demonstrate it works
-struct spinlock policy_lock;
+struct seqlock policy_lock;
 
 // MLFQ Global
 uint last_boost_tick = 0;
 
+// Scheduling latency of each process slot and of each policy,
+// as in struct waitstat but keeping the full cycle count.
+// Protected by ptable.lock.
+struct waitacct {
+  uint64 cycles;
+  struct waitstat st;
+};
+
+static struct waitacct procwait[NPROC];
+static struct waitacct schedwait[NSCHEDPOLICY];
+
 // CPU Stats Global - Full definition here
 struct cpustats_kernel {
-  struct spinlock lock;
+  struct seqlock lock;
   uint total_ticks;
   uint idle_ticks;
 };
 
 struct cpustats_kernel cpu_stats;
 
-// Deadlock Detector Globals
-int wfg[NPROC][NPROC];
-int visited[NPROC];
-int recursion_stack[NPROC];
-int cycle[NPROC];
-int cycle_len = 0;
 // --- END NEW GLOBALS ---
 extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static int livethreads(struct proc*);
 
 void
 statsinit(void)
 {
-  initlock(&cpu_stats.lock, "cpu_stats");
+  initseqlock(&cpu_stats.lock, "cpu_stats");
   cpu_stats.total_ticks = 0;
   cpu_stats.idle_ticks = 0;
 }
@@ -66,68 +88,13 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
-  initlock(&policy_lock, "policy");
+  initseqlock(&policy_lock, "policy");
+  initlock(&mlfq_recorder.lock, "mlfqrec");
   statsinit(); // Initialize new stats structure
   // MLFQ initialization happens per-process in allocproc()
 }
 
 
-void print_queues(void){
-  struct proc *p;
-  int counts[NQUEUE] = {0};
-  int pids[NQUEUE][NPROC];  // Store PIDs for each queue
-  int pid_counts[NQUEUE] = {0};  // Count of PIDs stored for each queue
-  
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == RUNNABLE && p->queue_level < NQUEUE) {
-      counts[p->queue_level]++;
-      if(pid_counts[p->queue_level] < NPROC) {
-        pids[p->queue_level][pid_counts[p->queue_level]] = p->pid;
-        pid_counts[p->queue_level]++;
-      }
-    }
-  }
-  release(&ptable.lock);
-  
-  cprintf("┌─────────────────────────────────┐\n");
-  cprintf("│           MLFQ STATUS           │\n");
-  cprintf("├─────────────────────────────────┤\n");
-  
-  for(int i = 0; i < NQUEUE; i++){
-    char priority[20];
-    if(i == 0) {
-      priority[0] = 'H'; priority[1] = 'I'; priority[2] = 'G'; priority[3] = 'H';
-      priority[4] = 'E'; priority[5] = 'S'; priority[6] = 'T'; priority[7] = '\0';
-    } else if(i == 1) {
-      priority[0] = 'M'; priority[1] = 'E'; priority[2] = 'D'; priority[3] = 'I';
-      priority[4] = 'U'; priority[5] = 'M'; priority[6] = ' '; priority[7] = '\0';
-    } else {
-      priority[0] = 'L'; priority[1] = 'O'; priority[2] = 'W'; priority[3] = 'E';
-      priority[4] = 'S'; priority[5] = 'T'; priority[6] = ' '; priority[7] = '\0';
-    }
-    
-    cprintf("│ Queue %d (%s): %d processes", i, priority, counts[i]);
-    
-    if(counts[i] > 0) {
-      cprintf(" [PIDs:");
-      for(int j = 0; j < pid_counts[i] && j < 4; j++) {  // Show up to 4 PIDs
-        cprintf(" %d", pids[i][j]);
-      }
-      if(counts[i] > 4) cprintf("...");
-      cprintf("]");
-    }
-    
-    // Add padding to align the closing bracket
-    int padding = 33 - (counts[i] > 0 ? 8 + pid_counts[i] * 3 : 0);
-    if(counts[i] > 4) padding -= 3;
-    for(int k = 0; k < padding; k++) cprintf(" ");
-    cprintf("│\n");
-  }
-  
-  cprintf("└─────────────────────────────────┘\n");
-}
-
 // Must be called with interrupts disabled
 int
 cpuid() {
@@ -167,6 +134,52 @@ myproc(void) {
   return p;
 }
 
+// Count a wait of t cycles to be scheduled in w.
+static void
+waitadd(struct waitacct *w, uint64 t)
+{
+  uint c;
+
+  c = t > 0xffffffff ? 0xffffffff : t;
+  w->cycles += t;
+  w->st.nwait++;
+  if(c > w->st.maxwait)
+    w->st.maxwait = c;
+  w->st.hist[c ? 31 - __builtin_clz(c) : 0]++;
+}
+
+// Move p to state, charging the ticks since its last state
+// change to the time it spent RUNNABLE or SLEEPING.
+// A process going from RUNNABLE to RUNNING also has its wait
+// timed, with the cycle counter, for p and for the policy
+// that picked it.
+// Caller must hold ptable.lock.
+static void
+setstate(struct proc *p, enum procstate state)
+{
+  uint now = ticks;
+  uint64 tsc, t;
+
+  if(state == RUNNING && p->state == RUNNABLE){
+    // It may have become RUNNABLE on another CPU, whose
+    // counter need not agree exactly with this one's.
+    tsc = rdtsc();
+    t = tsc > p->runnable_tsc ? tsc - p->runnable_tsc : 0;
+    waitadd(&procwait[p - ptable.proc], t);
+    if(current_scheduler_policy >= 0 && current_scheduler_policy < NSCHEDPOLICY)
+      waitadd(&schedwait[current_scheduler_policy], t);
+  }
+  if(state == RUNNABLE)
+    p->runnable_tsc = rdtsc();
+
+  if(p->state == RUNNABLE)
+    p->runnable_ticks += now - p->state_tick;
+  else if(p->state == SLEEPING)
+    p->sleep_ticks += now - p->state_tick;
+  p->state = state;
+  p->state_tick = now;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -188,7 +201,7 @@ allocproc(void)
   return 0;
 
 found:
-  p->state = EMBRYO;
+  setstate(p, EMBRYO);
   p->pid = nextpid++;
   
   // Initialize MLFQ fields (legacy)
@@ -203,7 +216,16 @@ found:
   p->mlfq_ticks = 0;
   p->start_time = ticks;           // Capture the current time
   p->cpu_ticks = 0;
-  p->waiting_on_chan = 0;
+  p->nvcsw = p->nivcsw = 0;
+  p->nsyscall = 0;
+  p->nblkread = p->nblkwrite = 0;
+  p->pipein = p->pipeout = 0;
+  p->npages = 0;
+  p->runnable_ticks = p->sleep_ticks = 0;
+  memset(&procwait[p - ptable.proc], 0, sizeof(procwait[0]));
+  p->waitlock = 0;
+  p->leader = p;
+  p->ustack = 0;
 
   release(&ptable.lock);
 
@@ -246,6 +268,7 @@ userinit(void)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
+  p->npages = 1;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -264,12 +287,54 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  setstate(p, RUNNABLE);
   // add_to_mlfq(p);  // MLFQ disabled temporarily
 
   release(&ptable.lock);
 }
 
+// A kernel thread's first scheduling by scheduler()
+// will swtch here, instead of to forkret.
+static void
+kthreadstart(void)
+{
+  struct proc *p = myproc();
+
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  p->kfn(p->karg);
+  exit();
+}
+
+// Create a kernel thread: a process that runs fn(arg) on its
+// own kernel stack and never enters user space. It has no user
+// page table (pgdir is 0), no files and no cwd, and is scheduled
+// like any other process under every policy. If fn returns, the
+// thread exits and init reaps it.
+// Returns the new pid, or -1 if there is no free process.
+int
+kthread_create(char *name, void (*fn)(void*), void *arg)
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  p->pgdir = 0;
+  p->sz = 0;
+  p->kfn = fn;
+  p->karg = arg;
+  p->parent = initproc;
+  p->context->eip = (uint)kthreadstart;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  mlfqlog(p->pid, MLFQ_NONE, p->mlfq_level);
+  setstate(p, RUNNABLE);
+  release(&ptable.lock);
+
+  return p->pid;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -277,16 +342,30 @@ growproc(int n)
 {
   uint sz;
   struct proc *curproc = myproc();
+  struct proc *p;
 
+  // Threads share sz; ptable.lock keeps two from growing at once.
+  acquire(&ptable.lock);
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      release(&ptable.lock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Other threads could go on using the freed pages through
+    // their TLBs; there is no shootdown, so refuse.
+    if(livethreads(curproc) > 0 ||
+       (sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      release(&ptable.lock);
       return -1;
+    }
   }
-  curproc->sz = sz;
+  addpages(curproc, (int)(PGROUNDUP(sz) - PGROUNDUP(curproc->sz)) / PGSIZE);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->pgdir == curproc->pgdir)
+      p->sz = sz;
+  release(&ptable.lock);
   switchuvm(curproc);
   return 0;
 }
@@ -297,7 +376,7 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -314,16 +393,22 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
+  np->npages = PGROUNDUP(np->sz) / PGSIZE;  // vmcopy adds its copies
+  if(vmcopy(np, curproc) < 0){
+    vmfree(np);
+    freevm(np->pgdir);
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
   np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
+  fdcopy(np);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
   
@@ -335,7 +420,8 @@ fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  mlfqlog(pid, MLFQ_NONE, np->mlfq_level);
+  setstate(np, RUNNABLE);
   // add_to_mlfq(np);  // MLFQ disabled temporarily
 
   release(&ptable.lock);
@@ -343,9 +429,166 @@ fork(void)
   return pid;
 }
 
+// Create a thread of the current process that starts at fn(arg1,
+// arg2) in user space, on the one-page user stack at stack. It
+// shares the address space (pgdir, sz and mapped regions), the open
+// files and the cwd with the process; see fdget() in file.c.
+// Returns the new thread's pid to the caller, or -1.
+int
+clone(void (*fn)(void*, void*), void *arg1, void *arg2, void *stack)
+{
+  int pid;
+  uint sp, ustack[3];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((uint)stack % 4 != 0 || (uint)stack + PGSIZE > curproc->sz ||
+     (uint)stack + PGSIZE < (uint)stack)
+    return -1;
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // Return address, so that returning from fn faults, and arguments.
+  ustack[0] = 0xffffffff;
+  ustack[1] = (uint)arg1;
+  ustack[2] = (uint)arg2;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+
+  np->pgdir = curproc->pgdir;
+  np->leader = curproc->leader;
+  np->parent = curproc;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = (uint)fn;
+  np->tf->esp = sp;
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->priority = curproc->priority;
+  np->mlfq_level = curproc->mlfq_level;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->sz = curproc->sz;  // under the lock, in case of a growproc()
+  mlfqlog(pid, MLFQ_NONE, np->mlfq_level);
+  setstate(np, RUNNABLE);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Return the number of other live threads sharing p's pgdir.
+// Caller must hold ptable.lock.
+static int
+livethreads(struct proc *p)
+{
+  struct proc *q;
+  int n;
+
+  n = 0;
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+    if(q != p && q->state != UNUSED && q->state != ZOMBIE &&
+       q->pgdir == p->pgdir)
+      n++;
+  return n;
+}
+
+// Return the number of other live threads sharing p's pgdir.
+// Only those threads can clone() more, so once it is 0 for the
+// current process it stays 0 until the process itself clones.
+int
+threadcount(struct proc *p)
+{
+  int n;
+
+  acquire(&ptable.lock);
+  n = livethreads(p);
+  release(&ptable.lock);
+  return n;
+}
+
+// Free the slot of zombie p, except for its page table.
+// Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  p->pgdir = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->leader = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+}
+
+// For exec(): free the exited, unjoined threads of curproc,
+// which would otherwise be left pointing at a process with a
+// new address space. Returns -1, freeing nothing, if curproc
+// has live threads. Since only they could clone() more, none
+// can appear before exec() has switched to the new image.
+int
+execthreads(struct proc *curproc)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  if(livethreads(curproc) > 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p != curproc && p->state == ZOMBIE && p->pgdir == curproc->pgdir)
+      freeproc(p);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Kill the other threads of the exiting process curproc and
+// free them once they have exited, so that no one else is left
+// using its address space by the time its parent frees it.
+static void
+reapthreads(struct proc *curproc)
+{
+  struct proc *p;
+  int live;
+
+  acquire(&ptable.lock);
+  for(;;){
+    live = 0;
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p == curproc || p->state == UNUSED || p->pgdir != curproc->pgdir)
+        continue;
+      if(p->state == ZOMBIE){
+        freeproc(p);
+        continue;
+      }
+      p->killed = 1;
+      if(p->state == SLEEPING)
+        setstate(p, RUNNABLE);
+      live++;
+    }
+    if(live == 0)
+      break;
+    // Threads wake their leader when they exit.
+    sleep(curproc, &ptable.lock);
+  }
+  release(&ptable.lock);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
+// A thread remains a zombie until join() or its leader's exit.
 void
 exit(void)
 {
@@ -356,36 +599,51 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
+  if(curproc->leader == curproc && curproc->pgdir)
+    reapthreads(curproc);
+
+  // Release any dltest locks, so their waiters can go on.
+  dlexit(curproc);
+
+  // Close all open files. A thread has none of its own,
+  // and the leader keeps them until its threads are gone.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  vmfree(curproc);
 
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  if(curproc->cwd){  // threads and kernel threads have none
+    begin_op();
+    iput(curproc->cwd);
+    end_op();
+    curproc->cwd = 0;
+  }
 
   acquire(&ptable.lock);
 
   // Remove from MLFQ queue
   // remove_from_mlfq(curproc);
 
-  // Parent might be sleeping in wait().
+  // Parent might be sleeping in wait() or join(),
+  // and the leader in reapthreads().
   wakeup1(curproc->parent);
+  if(curproc->leader != curproc)
+    wakeup1(curproc->leader);
 
-  // Pass abandoned children to init.
+  // Pass abandoned children to init, and threads to the leader.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
-      p->parent = initproc;
+      p->parent = p->leader != p ? p->leader : initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup1(p->parent);
     }
   }
 
+  mlfqlog(curproc->pid, curproc->mlfq_level, MLFQ_NONE);
+
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
   sched();
@@ -406,20 +664,15 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || p->leader != p)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one. Its threads are gone; see reapthreads.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        if(p->pgdir)
+          freevm(p->pgdir);
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -436,6 +689,40 @@ wait(void)
   }
 }
 
+// Wait for a thread this process created with clone() to exit.
+// Store the user stack it was given in *stack and return its
+// pid, or return -1 if this process has no threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  int havekids, pid;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    havekids = 0;
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p->parent != curproc || p->leader == p)
+        continue;
+      havekids = 1;
+      if(p->state == ZOMBIE){
+        pid = p->pid;
+        *stack = p->ustack;
+        freeproc(p);  // the address space is still in use
+        release(&ptable.lock);
+        return pid;
+      }
+    }
+
+    if(!havekids || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(curproc, &ptable.lock);
+  }
+}
+
 //PAGEBREAK: 42
 // Forward declarations for the policy implementations
 static void scheduler_rr(struct cpu *c);
@@ -464,12 +751,15 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Read the current policy.
-    // We acquire the lock to ensure we don't read the
-    // value mid-write (a "tear") from another CPU.
-    acquire(&policy_lock);
-    int policy = current_scheduler_policy;
-    release(&policy_lock);
+    // Read the current policy. The seqlock keeps us from
+    // reading it mid-write without making every CPU's
+    // scheduler loop write to a shared lock.
+    int policy;
+    uint seq;
+    do {
+      seq = seqbegin(&policy_lock);
+      policy = current_scheduler_policy;
+    } while(seqretry(&policy_lock, seq));
 
     // Dispatch to the correct scheduler
     if(policy == SCHED_PBS) {
@@ -496,7 +786,8 @@ scheduler_rr(struct cpu *c)
     // Switch to chosen process.
     c->proc = p;
     switchuvm(p);
-    p->state = RUNNING;
+    setstate(p, RUNNING);
+    ktrace(TE_SWITCHIN, p->pid, 0);
 
     swtch(&c->scheduler, p->context);
     switchkvm();
@@ -549,10 +840,11 @@ scheduler_pbs(struct cpu *c)
 
   // 3. Run the best process
   if(best_p) {
-    best_p->state = RUNNING;
+    setstate(best_p, RUNNING);
     best_p->wait_time = 0; // Reset wait time
     c->proc = best_p;
     switchuvm(best_p);
+    ktrace(TE_SWITCHIN, best_p->pid, 0);
     
     swtch(&c->scheduler, best_p->context);
     switchkvm();
@@ -580,6 +872,8 @@ scheduler_mlfq(struct cpu *c)
   if(current_ticks > last_boost_tick + BOOST_INTERVAL_TICKS) {
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
       if(p->state != UNUSED) {
+        if(p->mlfq_level != 0 && p->state != ZOMBIE)
+          mlfqlog(p->pid, p->mlfq_level, 0);
         p->mlfq_level = 0;
         p->mlfq_ticks = 0;
       }
@@ -587,13 +881,6 @@ scheduler_mlfq(struct cpu *c)
     last_boost_tick = current_ticks;
   }
   
-  // Record MLFQ snapshot every 100 ticks if recording is active
-  static uint last_snapshot_tick = 0;
-  if(mlfq_recorder.recording && current_ticks >= last_snapshot_tick + 100) {
-    record_mlfq_snapshot();
-    last_snapshot_tick = current_ticks;
-  }
-  
   // 2. Find highest-priority runnable process
   // Iterate from Q0 down to Q(NQUEUE-1)
   for(int level = 0; level < NQUEUE; level++) {
@@ -610,9 +897,10 @@ scheduler_mlfq(struct cpu *c)
 
 found:
   // 3. Run the chosen process
-  best_p->state = RUNNING;
+  setstate(best_p, RUNNING);
   c->proc = best_p;
   switchuvm(best_p);
+  ktrace(TE_SWITCHIN, best_p->pid, 0);
   
   swtch(&c->scheduler, best_p->context);
   switchkvm();
@@ -644,6 +932,7 @@ sched(void)
   if(readeflags()&FL_IF)
     panic("sched interruptible");
   intena = mycpu()->intena;
+  ktrace(TE_SWITCHOUT, p->state, 0);
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
 }
@@ -654,7 +943,8 @@ yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
   struct proc *p = myproc();
-  p->state = RUNNABLE;
+  setstate(p, RUNNABLE);
+  p->nivcsw++;
   
   // Remove from current queue and add back to same queue
   // remove_from_mlfq(p);
@@ -710,7 +1000,8 @@ sleep(void *chan, struct spinlock *lk)
   }
   // Go to sleep.
   p->chan = chan;
-  p->state = SLEEPING;
+  setstate(p, SLEEPING);
+  p->nvcsw++;
 
   sched();
 
@@ -734,11 +1025,8 @@ wakeup1(void *chan)
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
     if(p->state == SLEEPING && p->chan == chan) {
-      // --- DEADLOCK INSTRUMENTATION (WAKEUP) ---
-      p->waiting_on_chan = 0; // No longer waiting
-      // --- END INSTRUMENTATION ---
-      
-      p->state = RUNNABLE;
+      setstate(p, RUNNABLE);
+      ktrace(TE_WAKEUP, p->pid, 0);
       // add_to_mlfq(p);  // MLFQ disabled temporarily
     }
 }
@@ -763,10 +1051,14 @@ kill(int pid)
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
+      if(p->pgdir == 0){  // a kernel thread
+        release(&ptable.lock);
+        return -1;
+      }
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING) {
-        p->state = RUNNABLE;
+        setstate(p, RUNNABLE);
         // add_to_mlfq(p);  // MLFQ disabled temporarily
       }
       release(&ptable.lock);
@@ -777,6 +1069,52 @@ kill(int pid)
   return -1;
 }
 
+// Copy out w, with its cycle count in units of 1024.
+static void
+waitcopy(struct waitstat *st, struct waitacct *w)
+{
+  *st = w->st;
+  st->cycles = w->cycles >> 10;
+}
+
+// Copy the scheduling latency of process pid to st.
+// Returns 0, or -1 if there is no such process.
+int
+procwaitstat(int pid, struct waitstat *st)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      waitcopy(st, &procwait[p - ptable.proc]);
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Copy the scheduling latency under policies 0 to n-1 to st,
+// and optionally reset it. Returns the number of entries copied.
+int
+schedwaitstats(struct waitstat *st, int n, int reset)
+{
+  int i;
+
+  if(n > NSCHEDPOLICY)
+    n = NSCHEDPOLICY;
+  acquire(&ptable.lock);
+  for(i = 0; i < n; i++){
+    waitcopy(&st[i], &schedwait[i]);
+    if(reset)
+      memset(&schedwait[i], 0, sizeof(schedwait[i]));
+  }
+  release(&ptable.lock);
+  return n;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -811,47 +1149,127 @@ procdump(void)
 
 // MLFQ Recording Functions
 
-void record_mlfq_snapshot(void) {
-  if(mlfq_recorder.snapshot_count >= MAX_MLFQ_SNAPSHOTS)
+// Record that process pid moved from MLFQ level from to level
+// to, if recording. A gap too long for dtick is bridged with
+// records that only advance the clock.
+void
+mlfqlog(int pid, int from, int to)
+{
+  struct mlfqrec *r;
+  uint d;
+
+  acquire(&mlfq_recorder.lock);
+  if(!mlfq_recorder.recording){
+    release(&mlfq_recorder.lock);
     return;
-    
-  struct mlfq_snapshot *snap = &mlfq_recorder.snapshots[mlfq_recorder.snapshot_count];
-  snap->tick = ticks;
-  
-  // Reset counts
-  for(int i = 0; i < NQUEUE; i++) {
-    snap->counts[i] = 0;
-    snap->pid_counts[i] = 0;
   }
-  
-  // Scan process table - capture RUNNABLE and RUNNING processes
+  d = ticks - mlfq_recorder.lasttick;
+  for(;;){
+    if(mlfq_recorder.head - mlfq_recorder.tail == NMLFQREC){
+      mlfq_recorder.dropped++;
+      break;
+    }
+    r = &mlfq_recorder.rec[mlfq_recorder.head++ % NMLFQREC];
+    if(d > 0xffff){
+      r->dtick = 0xffff;
+      r->pid = 0;
+      r->from = r->to = MLFQ_NONE;
+      mlfq_recorder.lasttick += 0xffff;
+      d -= 0xffff;
+      continue;
+    }
+    r->dtick = d;
+    r->pid = pid;
+    r->from = from;
+    r->to = to;
+    mlfq_recorder.lasttick += d;
+    break;
+  }
+  release(&mlfq_recorder.lock);
+}
+
+// Copy up to n records from the recorder to dst, and set *tick
+// to the tick of the record before the first one. Unless peek
+// is set, the records are consumed.
+// Returns the number of records copied.
+int
+mlfqread(struct mlfqrec *dst, int n, uint *tick, int peek)
+{
+  uint tail, t;
+  int i;
+
+  acquire(&mlfq_recorder.lock);
+  tail = mlfq_recorder.tail;
+  t = mlfq_recorder.readtick;
+  *tick = t;
+  for(i = 0; i < n && tail != mlfq_recorder.head; i++){
+    dst[i] = mlfq_recorder.rec[tail++ % NMLFQREC];
+    t += dst[i].dtick;
+  }
+  if(!peek){
+    mlfq_recorder.tail = tail;
+    mlfq_recorder.readtick = t;
+  }
+  release(&mlfq_recorder.lock);
+  return i;
+}
+
+// Copy a snapshot of the MLFQ queues and the recorder to st.
+// Formatting it is left to the caller, so that the locks are
+// held only while copying.
+void
+mlfqsnapshot(struct mlfqstat *st)
+{
   struct proc *p;
+  int q;
+
+  for(q = 0; q < NQUEUE; q++)
+    st->count[q] = 0;
+  acquire(&ptable.lock);
+  st->tick = ticks;
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if((p->state == RUNNABLE || p->state == RUNNING) && p->mlfq_level < NQUEUE) {
-      int q = p->mlfq_level;
-      snap->counts[q]++;
-      if(snap->pid_counts[q] < NPROC) {
-        snap->pids[q][snap->pid_counts[q]] = p->pid;
-        snap->pid_counts[q]++;
-      }
+    if((p->state == RUNNABLE || p->state == RUNNING) &&
+       p->mlfq_level >= 0 && p->mlfq_level < NQUEUE){
+      q = p->mlfq_level;
+      st->pid[q][st->count[q]++] = p->pid;
     }
   }
-  
-  mlfq_recorder.snapshot_count++;
+  release(&ptable.lock);
+
+  acquire(&mlfq_recorder.lock);
+  st->recording = mlfq_recorder.recording;
+  st->pending = mlfq_recorder.head - mlfq_recorder.tail;
+  st->dropped = mlfq_recorder.dropped;
+  release(&mlfq_recorder.lock);
 }
 
+// Start recording, with an empty ring that begins with the
+// current level of every process.
 int sys_mlfqstart(void) {
+  struct proc *p;
+
   acquire(&ptable.lock);
+  acquire(&mlfq_recorder.lock);
   mlfq_recorder.recording = 1;
-  mlfq_recorder.snapshot_count = 0;
-  record_mlfq_snapshot();  // Record initial state
+  mlfq_recorder.head = mlfq_recorder.tail = 0;
+  mlfq_recorder.lasttick = mlfq_recorder.readtick = ticks;
+  mlfq_recorder.dropped = 0;
+  release(&mlfq_recorder.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->state != ZOMBIE && p->state != EMBRYO)
+      mlfqlog(p->pid, MLFQ_NONE, p->mlfq_level);
   release(&ptable.lock);
   return 0;
 }
 
+// Stop recording. Records already made can still be read.
+// Returns the number of transitions dropped.
 int sys_mlfqstop(void) {
-  acquire(&ptable.lock);
+  int dropped;
+
+  acquire(&mlfq_recorder.lock);
   mlfq_recorder.recording = 0;
-  release(&ptable.lock);
-  return 0;
+  dropped = mlfq_recorder.dropped;
+  release(&mlfq_recorder.lock);
+  return dropped;
 }
@@ -41,21 +41,37 @@ struct context {
   uint eip;
 };
 
+// A region of a process's address space mapped by mmap() or shmat().
+struct vma {
+  uint start;                  // First address, page-aligned
+  uint end;                    // One past the last address, page-aligned
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+  struct file *f;              // Mapped file, or
+  struct shmseg *shm;          // shared memory segment; both 0 if unused
+  uint off;                    // File offset of start, page-aligned
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
-  pde_t* pgdir;                // Page table
+  pde_t* pgdir;                // Page table, 0 for a kernel thread
   char *kstack;                // Bottom of kernel stack for this process
+  void (*kfn)(void*);          // Kernel thread function (kthread_create)
+  void *karg;                  // and its argument
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *leader;         // Process whose threads share pgdir; itself if not a thread
+  void *ustack;                // Thread's user stack, from clone()
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct file *ofile[NOFILE];  // Open files; a thread uses its leader's
+  struct inode *cwd;           // Current directory; likewise
   char name[16];               // Process name (debugging)
+  struct vma vmas[NVMA];       // mmap()ed regions; a thread uses its leader's
   
   // -- FIELDS FOR PRIORITY-BASED SCHEDULER (PBS) --
   int priority;                // Static priority, set by set_priority()
@@ -71,9 +87,24 @@ struct proc {
   // -- FIELDS FOR PERFORMANCE MONITORING (top) --
   uint start_time;             // Kernel ticks at process creation (allocproc)
   uint cpu_ticks;              // Total ticks this process has been RUNNING
+
+  // -- FIELDS FOR RESOURCE ACCOUNTING (ps, top) --
+  uint nvcsw;                  // Voluntary context switches (sleep)
+  uint nivcsw;                 // Involuntary context switches (yield)
+  uint nsyscall;               // System calls made
+  uint nblkread;               // Disk blocks read
+  uint nblkwrite;              // Disk blocks written
+  uint pipein;                 // Bytes read from pipes
+  uint pipeout;                // Bytes written to pipes
+  uint npages;                 // User pages resident (kept by the leader)
+  uint runnable_ticks;         // Total ticks spent RUNNABLE
+  uint sleep_ticks;            // Total ticks spent SLEEPING
+  uint state_tick;             // Kernel ticks at last state change (setstate)
+  uint64 runnable_tsc;         // Cycle counter when last made RUNNABLE
   
   // -- FIELD FOR DEADLOCK DETECTION --
-  void *waiting_on_chan;       // The 'chan' this process is sleeping on
+  struct sleeplock *waitlock;  // Sleep-lock this process waits for (deadlock.c)
+  int waitintr;                // If non-zero, being killed ends that wait
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -82,32 +113,10 @@ struct proc {
 //   fixed-size stack
 //   expandable heap
 
-// MLFQ recording structure
-struct mlfq_snapshot {
-  int tick;                      // System tick when recorded
-  int counts[NQUEUE];            // Process count per queue
-  int pids[NQUEUE][NPROC];       // PIDs in each queue
-  int pid_counts[NQUEUE];        // Number of PIDs per queue
-};
-
-// MLFQ recorder structure type
-struct mlfq_recorder_t {
-  int recording;                           // 1 if recording, 0 otherwise
-  int snapshot_count;                      // Number of snapshots taken
-  struct mlfq_snapshot snapshots[MAX_MLFQ_SNAPSHOTS];
-};
-
-// External declaration (defined in proc.c)
-extern struct mlfq_recorder_t mlfq_recorder;
-
 // Global CPU stats structure (defined in proc.c)
 // We declare it as an incomplete type here to avoid circular dependencies
 struct cpustats_kernel;
 
 extern struct cpustats_kernel cpu_stats;
-extern struct spinlock policy_lock;
+extern struct seqlock policy_lock;
 extern int current_scheduler_policy;
-
-// Function declarations
-void print_queues(void);
-void record_mlfq_snapshot(void);
@@ -20,6 +20,16 @@ struct procinfo {
   int mlfq_level;         // From MLFQ
   uint start_time;
   uint cpu_ticks;
+  uint nvcsw;             // Voluntary context switches
+  uint nivcsw;            // Involuntary context switches
+  uint nsyscall;          // System calls made
+  uint nblkread;          // Disk blocks read
+  uint nblkwrite;         // Disk blocks written
+  uint pipein;            // Bytes read from pipes
+  uint pipeout;           // Bytes written to pipes
+  uint npages;            // User pages resident in its address space
+  uint runnable_ticks;    // Ticks spent waiting to run
+  uint sleep_ticks;       // Ticks spent sleeping
 };
 
 // User-space-safe structure for CPU stats
@@ -30,9 +40,35 @@ struct cpustats {
 };
 
 // User-space-safe structure for deadlock info
+// Cycle i has cycle_len[i] pids in pids_in_cycle, after those of
+// the cycles before it. Each process waits for a sleep-lock held
+// by the next, and the last for one held by the first.
 struct deadlockinfo {
-  int found;
+  int found;                // Number of deadlocked cycles
+  int npids;                // Number of pids in all cycles
   int pids_in_cycle[NPROC];
+  int cycle_len[NPROC];
+};
+
+// dllock() operations on the test sleep-locks
+#define DL_LOCK   1
+#define DL_UNLOCK 2
+
+// Deadlock watchdog victim policies, for watchdogctl()
+#define WD_REPORT   0   // log deadlocks, kill nothing
+#define WD_YOUNGEST 1   // kill the most recently started process
+#define WD_LOWPRI   2   // kill the lowest priority (highest value) process
+#define WD_LEASTCPU 3   // kill the process with the fewest cpu_ticks
+#define NWDPOLICY   4
+#define WD_INTERVAL 100 // default ticks between watchdog scans
+
+// One deadlock found by the watchdog, read by deadlocklog()
+#define NDLCYCLE 8
+struct deadlogent {
+  uint tick;              // when it was found
+  int victim;             // pid killed to break it, 0, or -1 if none could be
+  int len;                // number of processes in the cycle
+  int pids[NDLCYCLE];     // the first NDLCYCLE of them
 };
 
 #endif // _PROCINFO_H_
@@ -0,0 +1,116 @@
+// Sampling profiler.
+//
+// While profiling is on, every CPU's timer interrupt records the
+// interrupted eip, the running process and the CPU in that CPU's
+// own ring of samples. The interrupt handler is the only writer
+// of its ring's head and prof() the only writer of tail, so the
+// timer path takes no lock; if the ring is full the sample is
+// dropped and counted. prof.lock only serializes prof() callers.
+//
+// The kprof program turns kernel eips into function names
+// using kernel.sym, which the Makefile puts in fs.img.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "prof.h"
+
+struct profring {
+  struct profsample s[NPROFSAMPLE];
+  uint head;      // next slot to fill
+  uint tail;      // next slot to read
+  uint dropped;   // samples lost because the ring was full
+} __attribute__((aligned(64)));
+
+static struct {
+  struct spinlock lock;
+  int on;
+  struct profring ring[NCPU];
+} prof;
+
+void
+profinit(void)
+{
+  initlock(&prof.lock, "prof");
+}
+
+// Record a sample from the timer interrupt that built tf.
+void
+proftick(struct trapframe *tf)
+{
+  struct profring *r;
+  struct profsample *s;
+  struct proc *p;
+
+  if(!prof.on)
+    return;
+  r = &prof.ring[cpuid()];
+  if(r->head - r->tail == NPROFSAMPLE){
+    r->dropped++;
+    return;
+  }
+  s = &r->s[r->head % NPROFSAMPLE];
+  p = myproc();
+  s->eip = tf->eip;
+  s->pid = p ? p->pid : 0;
+  s->cpu = cpuid();
+  s->user = (tf->cs&3) == DPL_USER;
+  // The sample must be complete before the reader can see it.
+  __sync_synchronize();
+  r->head++;
+}
+
+// Copy up to n samples, oldest first on each CPU, into dst.
+// Returns the number copied.
+static int
+profread(struct profsample *dst, int n)
+{
+  struct profring *r;
+  int i;
+
+  i = 0;
+  for(r = prof.ring; r < &prof.ring[ncpu]; r++){
+    while(i < n && r->tail != *(volatile uint*)&r->head){
+      dst[i++] = r->s[r->tail % NPROFSAMPLE];
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  return i;
+}
+
+// Start or stop sampling, or read samples into dst.
+int
+profctl(int cmd, struct profsample *dst, int n)
+{
+  struct profring *r;
+  int ret;
+
+  ret = 0;
+  acquire(&prof.lock);
+  switch(cmd){
+  case PROF_START:
+    for(r = prof.ring; r < &prof.ring[ncpu]; r++){
+      r->tail = r->head;
+      r->dropped = 0;
+    }
+    prof.on = 1;
+    break;
+  case PROF_STOP:
+    prof.on = 0;
+    for(r = prof.ring; r < &prof.ring[ncpu]; r++)
+      ret += r->dropped;
+    break;
+  case PROF_READ:
+    ret = profread(dst, n);
+    break;
+  default:
+    ret = -1;
+  }
+  release(&prof.lock);
+  return ret;
+}
@@ -0,0 +1,14 @@
+// Sampling profiler records, read with prof(PROF_READ, ...).
+// Both the kernel and user programs use this header file.
+
+struct profsample {
+  uint eip;    // Interrupted instruction
+  int pid;     // Process running, 0 if the CPU was idle
+  uchar cpu;   // CPU that took the sample
+  uchar user;  // Was the CPU in user mode?
+};
+
+// prof() commands
+#define PROF_START  1  // discard old samples and start sampling
+#define PROF_STOP   2  // stop; returns the number of samples dropped
+#define PROF_READ   3  // drain up to n samples into buf
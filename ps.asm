@@ -0,0 +1,1814 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// Too big for the one-page user stack.
+struct procinfo processes[NPROC];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  struct procinfo *p;
+  int count, i, lflag;
+
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+  1a:	7f 77                	jg     93 <main+0x93>
+
+  // 1. Make a *single* system call
+  count = getallprocinfo(processes, NPROC);
+  1c:	83 ec 08             	sub    $0x8,%esp
+  1f:	6a 40                	push   $0x40
+  21:	68 20 11 00 00       	push   $0x1120
+  26:	e8 48 04 00 00       	call   473 <getallprocinfo>
+  if(count < 0){
+  2b:	83 c4 10             	add    $0x10,%esp
+  count = getallprocinfo(processes, NPROC);
+  2e:	89 c7                	mov    %eax,%edi
+  if(count < 0){
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 88 eb 00 00 00    	js     123 <main+0x123>
+    }
+    exit();
+  }
+
+  // 2. Print header
+  printf(1, "PID\tPPID\tSTATE\t\tPRI\tMLFQ\tCPU_TICKS\tNAME\n");
+  38:	50                   	push   %eax
+  39:	50                   	push   %eax
+  3a:	68 80 0c 00 00       	push   $0xc80
+  3f:	6a 01                	push   $0x1
+  41:	e8 ea 05 00 00       	call   630 <printf>
+
+  // 3. Loop through the *local* array and print
+  for(i = 0; i < count; i++){
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	85 ff                	test   %edi,%edi
+  4b:	74 41                	je     8e <main+0x8e>
+  4d:	bb 2c 11 00 00       	mov    $0x112c,%ebx
+  52:	31 f6                	xor    %esi,%esi
+  54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t\t%s\n",
+  58:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < count; i++){
+  5b:	83 c6 01             	add    $0x1,%esi
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t\t%s\n",
+  5e:	53                   	push   %ebx
+  for(i = 0; i < count; i++){
+  5f:	83 c3 54             	add    $0x54,%ebx
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t\t%s\n",
+  62:	ff 73 c8             	push   -0x38(%ebx)
+  65:	ff 73 c0             	push   -0x40(%ebx)
+  68:	ff 73 bc             	push   -0x44(%ebx)
+  return states[state];
+  6b:	8b 43 a8             	mov    -0x58(%ebx),%eax
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t\t%s\n",
+  6e:	ff 34 85 ac 0c 00 00 	push   0xcac(,%eax,4)
+  75:	ff 73 a4             	push   -0x5c(%ebx)
+  78:	ff 73 a0             	push   -0x60(%ebx)
+  7b:	68 be 0b 00 00       	push   $0xbbe
+  80:	6a 01                	push   $0x1
+  82:	e8 a9 05 00 00       	call   630 <printf>
+  for(i = 0; i < count; i++){
+  87:	83 c4 30             	add    $0x30,%esp
+  8a:	39 fe                	cmp    %edi,%esi
+  8c:	75 ca                	jne    58 <main+0x58>
+    exit();
+  8e:	e8 00 03 00 00       	call   393 <exit>
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+  93:	56                   	push   %esi
+  94:	56                   	push   %esi
+  95:	68 a0 0b 00 00       	push   $0xba0
+  9a:	ff 70 04             	push   0x4(%eax)
+  9d:	e8 de 00 00 00       	call   180 <strcmp>
+  a2:	83 c4 10             	add    $0x10,%esp
+  a5:	89 c6                	mov    %eax,%esi
+  a7:	85 c0                	test   %eax,%eax
+  a9:	0f 85 6d ff ff ff    	jne    1c <main+0x1c>
+  count = getallprocinfo(processes, NPROC);
+  af:	53                   	push   %ebx
+  b0:	53                   	push   %ebx
+  b1:	6a 40                	push   $0x40
+  b3:	68 20 11 00 00       	push   $0x1120
+  b8:	e8 b6 03 00 00       	call   473 <getallprocinfo>
+  if(count < 0){
+  bd:	83 c4 10             	add    $0x10,%esp
+  count = getallprocinfo(processes, NPROC);
+  c0:	89 c7                	mov    %eax,%edi
+  if(count < 0){
+  c2:	85 c0                	test   %eax,%eax
+  c4:	78 5d                	js     123 <main+0x123>
+    printf(1, "PID\tVCSW\tIVCSW\tSYSCALL\tBREAD\tBWRITE\tPIPEIN\tPIPEOUT\tPAGES\tWAIT\tSLEEP\tNAME\n");
+  c6:	52                   	push   %edx
+  c7:	52                   	push   %edx
+  c8:	68 0c 0c 00 00       	push   $0xc0c
+  cd:	6a 01                	push   $0x1
+  cf:	e8 5c 05 00 00       	call   630 <printf>
+    for(i = 0; i < count; i++){
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	85 ff                	test   %edi,%edi
+  d9:	74 b3                	je     8e <main+0x8e>
+  db:	bb 2c 11 00 00       	mov    $0x112c,%ebx
+      printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+  e0:	83 ec 08             	sub    $0x8,%esp
+    for(i = 0; i < count; i++){
+  e3:	83 c6 01             	add    $0x1,%esi
+      printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+  e6:	53                   	push   %ebx
+    for(i = 0; i < count; i++){
+  e7:	83 c3 54             	add    $0x54,%ebx
+      printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+  ea:	ff 73 f0             	push   -0x10(%ebx)
+  ed:	ff 73 ec             	push   -0x14(%ebx)
+  f0:	ff 73 e8             	push   -0x18(%ebx)
+  f3:	ff 73 e4             	push   -0x1c(%ebx)
+  f6:	ff 73 e0             	push   -0x20(%ebx)
+  f9:	ff 73 dc             	push   -0x24(%ebx)
+  fc:	ff 73 d8             	push   -0x28(%ebx)
+  ff:	ff 73 d4             	push   -0x2c(%ebx)
+ 102:	ff 73 d0             	push   -0x30(%ebx)
+ 105:	ff 73 cc             	push   -0x34(%ebx)
+ 108:	ff 73 a0             	push   -0x60(%ebx)
+ 10b:	68 58 0c 00 00       	push   $0xc58
+ 110:	6a 01                	push   $0x1
+ 112:	e8 19 05 00 00       	call   630 <printf>
+    for(i = 0; i < count; i++){
+ 117:	83 c4 40             	add    $0x40,%esp
+ 11a:	39 fe                	cmp    %edi,%esi
+ 11c:	75 c2                	jne    e0 <main+0xe0>
+ 11e:	e9 6b ff ff ff       	jmp    8e <main+0x8e>
+    printf(2, "ps: getallprocinfo failed\n");
+ 123:	51                   	push   %ecx
+ 124:	51                   	push   %ecx
+ 125:	68 a3 0b 00 00       	push   $0xba3
+ 12a:	6a 02                	push   $0x2
+ 12c:	e8 ff 04 00 00       	call   630 <printf>
+    exit();
+ 131:	e8 5d 02 00 00       	call   393 <exit>
+ 136:	66 90                	xchg   %ax,%ax
+ 138:	66 90                	xchg   %ax,%ax
+ 13a:	66 90                	xchg   %ax,%ax
+ 13c:	66 90                	xchg   %ax,%ax
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <get_state_str>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+  return states[state];
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	5d                   	pop    %ebp
+  return states[state];
+ 147:	8b 04 85 ac 0c 00 00 	mov    0xcac(,%eax,4),%eax
+}
+ 14e:	c3                   	ret
+ 14f:	90                   	nop
+
+00000150 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 1e 01 00 00       	call   3ab <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 f1 00 00 00       	call   3d3 <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 f4 00 00 00       	call   3eb <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 ba 00 00 00       	call   3bb <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	8b 45 10             	mov    0x10(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7e 13                	jle    385 <memmove+0x25>
+ 372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 374:	89 d7                	mov    %edx,%edi
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 381:	39 f8                	cmp    %edi,%eax
+ 383:	75 fb                	jne    380 <memmove+0x20>
+  return vdst;
+}
+ 385:	5e                   	pop    %esi
+ 386:	89 d0                	mov    %edx,%eax
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+
+0000038b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <exit>:
+SYSCALL(exit)
+ 393:	b8 02 00 00 00       	mov    $0x2,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <wait>:
+SYSCALL(wait)
+ 39b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <pipe>:
+SYSCALL(pipe)
+ 3a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <read>:
+SYSCALL(read)
+ 3ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <write>:
+SYSCALL(write)
+ 3b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <close>:
+SYSCALL(close)
+ 3bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <kill>:
+SYSCALL(kill)
+ 3c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <exec>:
+SYSCALL(exec)
+ 3cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <open>:
+SYSCALL(open)
+ 3d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mknod>:
+SYSCALL(mknod)
+ 3db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <unlink>:
+SYSCALL(unlink)
+ 3e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <fstat>:
+SYSCALL(fstat)
+ 3eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <link>:
+SYSCALL(link)
+ 3f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mkdir>:
+SYSCALL(mkdir)
+ 3fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <chdir>:
+SYSCALL(chdir)
+ 403:	b8 09 00 00 00       	mov    $0x9,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <dup>:
+SYSCALL(dup)
+ 40b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getpid>:
+SYSCALL(getpid)
+ 413:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <sbrk>:
+SYSCALL(sbrk)
+ 41b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <sleep>:
+SYSCALL(sleep)
+ 423:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <uptime>:
+SYSCALL(uptime)
+ 42b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 433:	b8 16 00 00 00       	mov    $0x16,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 43b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 443:	b8 18 00 00 00       	mov    $0x18,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 44b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 453:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 45b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 463:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <setpriority>:
+SYSCALL(setpriority)
+ 46b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 473:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getcpustats>:
+SYSCALL(getcpustats)
+ 47b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <setscheduler>:
+SYSCALL(setscheduler)
+ 483:	b8 20 00 00 00       	mov    $0x20,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 48b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getscheduler>:
+SYSCALL(getscheduler)
+ 493:	b8 22 00 00 00       	mov    $0x22,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <splice>:
+SYSCALL(splice)
+ 49b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <readv>:
+SYSCALL(readv)
+ 4a3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <writev>:
+SYSCALL(writev)
+ 4ab:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pread>:
+SYSCALL(pread)
+ 4b3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <pwrite>:
+SYSCALL(pwrite)
+ 4bb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getlogstat>:
+SYSCALL(getlogstat)
+ 4c3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mount>:
+SYSCALL(mount)
+ 4cb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <umount>:
+SYSCALL(umount)
+ 4d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mmap>:
+SYSCALL(mmap)
+ 4db:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <munmap>:
+SYSCALL(munmap)
+ 4e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <membench>:
+SYSCALL(membench)
+ 4eb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getlockstat>:
+SYSCALL(getlockstat)
+ 4f3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <lockbench>:
+SYSCALL(lockbench)
+ 4fb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <prof>:
+SYSCALL(prof)
+ 503:	b8 30 00 00 00       	mov    $0x30,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <tracectl>:
+SYSCALL(tracectl)
+ 50b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <traceread>:
+SYSCALL(traceread)
+ 513:	b8 32 00 00 00       	mov    $0x32,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getsysstat>:
+SYSCALL(getsysstat)
+ 51b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 523:	b8 34 00 00 00       	mov    $0x34,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getschedwait>:
+SYSCALL(getschedwait)
+ 52b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <mlfqread>:
+SYSCALL(mlfqread)
+ 533:	b8 36 00 00 00       	mov    $0x36,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dllock>:
+SYSCALL(dllock)
+ 53b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 543:	b8 38 00 00 00       	mov    $0x38,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 54b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <clone>:
+SYSCALL(clone)
+ 553:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <join>:
+SYSCALL(join)
+ 55b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <futex>:
+SYSCALL(futex)
+ 563:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <shmat>:
+SYSCALL(shmat)
+ 56b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <shmdt>:
+SYSCALL(shmdt)
+ 573:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <poll>:
+SYSCALL(poll)
+ 57b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+ 583:	66 90                	xchg   %ax,%ax
+ 585:	66 90                	xchg   %ax,%ax
+ 587:	66 90                	xchg   %ax,%ax
+ 589:	66 90                	xchg   %ax,%ax
+ 58b:	66 90                	xchg   %ax,%ax
+ 58d:	66 90                	xchg   %ax,%ax
+ 58f:	90                   	nop
+
+00000590 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+{
+ 59a:	83 ec 3c             	sub    $0x3c,%esp
+ 59d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	85 d2                	test   %edx,%edx
+ 5a2:	0f 89 80 00 00 00    	jns    628 <printint+0x98>
+ 5a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ac:	74 7a                	je     628 <printint+0x98>
+    x = -xx;
+ 5ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5b8:	31 f6                	xor    %esi,%esi
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	89 f7                	mov    %esi,%edi
+ 5c6:	f7 f3                	div    %ebx
+ 5c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5cb:	0f b6 92 24 0d 00 00 	movzbl 0xd24(%edx),%edx
+ 5d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5d6:	89 ca                	mov    %ecx,%edx
+ 5d8:	89 c1                	mov    %eax,%ecx
+ 5da:	39 da                	cmp    %ebx,%edx
+ 5dc:	73 e2                	jae    5c0 <printint+0x30>
+  if(neg)
+ 5de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5e1:	85 c0                	test   %eax,%eax
+ 5e3:	74 07                	je     5ec <printint+0x5c>
+    buf[i++] = '-';
+ 5e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ea:	89 f7                	mov    %esi,%edi
+ 5ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5f2:	01 df                	add    %ebx,%edi
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 601:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 604:	6a 01                	push   $0x1
+ 606:	50                   	push   %eax
+ 607:	56                   	push   %esi
+ 608:	e8 a6 fd ff ff       	call   3b3 <write>
+  while(--i >= 0)
+ 60d:	89 f8                	mov    %edi,%eax
+ 60f:	83 c4 10             	add    $0x10,%esp
+ 612:	83 ef 01             	sub    $0x1,%edi
+ 615:	39 d8                	cmp    %ebx,%eax
+ 617:	75 df                	jne    5f8 <printint+0x68>
+}
+ 619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61c:	5b                   	pop    %ebx
+ 61d:	5e                   	pop    %esi
+ 61e:	5f                   	pop    %edi
+ 61f:	5d                   	pop    %ebp
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb 89                	jmp    5b5 <printint+0x25>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 639:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 63c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 63f:	0f b6 1e             	movzbl (%esi),%ebx
+ 642:	83 c6 01             	add    $0x1,%esi
+ 645:	84 db                	test   %bl,%bl
+ 647:	74 67                	je     6b0 <printf+0x80>
+ 649:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 64c:	31 d2                	xor    %edx,%edx
+ 64e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 651:	eb 34                	jmp    687 <printf+0x57>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 65b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 660:	83 f8 25             	cmp    $0x25,%eax
+ 663:	74 18                	je     67d <printf+0x4d>
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66e:	6a 01                	push   $0x1
+ 670:	50                   	push   %eax
+ 671:	57                   	push   %edi
+ 672:	e8 3c fd ff ff       	call   3b3 <write>
+ 677:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 67a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 67d:	0f b6 1e             	movzbl (%esi),%ebx
+ 680:	83 c6 01             	add    $0x1,%esi
+ 683:	84 db                	test   %bl,%bl
+ 685:	74 29                	je     6b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 687:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 68a:	85 d2                	test   %edx,%edx
+ 68c:	74 ca                	je     658 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 68e:	83 fa 25             	cmp    $0x25,%edx
+ 691:	75 ea                	jne    67d <printf+0x4d>
+      if(c == 'd'){
+ 693:	83 f8 25             	cmp    $0x25,%eax
+ 696:	0f 84 24 01 00 00    	je     7c0 <printf+0x190>
+ 69c:	83 e8 63             	sub    $0x63,%eax
+ 69f:	83 f8 15             	cmp    $0x15,%eax
+ 6a2:	77 1c                	ja     6c0 <printf+0x90>
+ 6a4:	ff 24 85 cc 0c 00 00 	jmp    *0xccc(,%eax,4)
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ca:	6a 01                	push   $0x1
+ 6cc:	52                   	push   %edx
+ 6cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6d0:	57                   	push   %edi
+ 6d1:	e8 dd fc ff ff       	call   3b3 <write>
+ 6d6:	83 c4 0c             	add    $0xc,%esp
+ 6d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6dc:	6a 01                	push   $0x1
+ 6de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6e1:	52                   	push   %edx
+ 6e2:	57                   	push   %edi
+ 6e3:	e8 cb fc ff ff       	call   3b3 <write>
+        putc(fd, c);
+ 6e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6eb:	31 d2                	xor    %edx,%edx
+ 6ed:	eb 8e                	jmp    67d <printf+0x4d>
+ 6ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6fb:	8b 13                	mov    (%ebx),%edx
+ 6fd:	6a 00                	push   $0x0
+ 6ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 701:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 704:	e8 87 fe ff ff       	call   590 <printint>
+        ap++;
+ 709:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 70c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 67 ff ff ff       	jmp    67d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 723:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 72b:	85 db                	test   %ebx,%ebx
+ 72d:	0f 84 9d 00 00 00    	je     7d0 <printf+0x1a0>
+        while(*s != 0){
+ 733:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 736:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 738:	84 c0                	test   %al,%al
+ 73a:	0f 84 3d ff ff ff    	je     67d <printf+0x4d>
+ 740:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 743:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 746:	89 de                	mov    %ebx,%esi
+ 748:	89 d3                	mov    %edx,%ebx
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 756:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	53                   	push   %ebx
+ 75c:	57                   	push   %edi
+ 75d:	e8 51 fc ff ff       	call   3b3 <write>
+        while(*s != 0){
+ 762:	0f b6 06             	movzbl (%esi),%eax
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	84 c0                	test   %al,%al
+ 76a:	75 e4                	jne    750 <printf+0x120>
+      state = 0;
+ 76c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 07 ff ff ff       	jmp    67d <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 01                	push   $0x1
+ 78f:	e9 6b ff ff ff       	jmp    6ff <printf+0xcf>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 798:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	52                   	push   %edx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 01 fc ff ff       	call   3b3 <write>
+        ap++;
+ 7b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7b8:	31 d2                	xor    %edx,%edx
+ 7ba:	e9 be fe ff ff       	jmp    67d <printf+0x4d>
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	e9 11 ff ff ff       	jmp    6e1 <printf+0xb1>
+ 7d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7d5:	bb c4 0c 00 00       	mov    $0xcc4,%ebx
+ 7da:	e9 61 ff ff ff       	jmp    740 <printf+0x110>
+ 7df:	90                   	nop
+
+000007e0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e3:	a1 74 26 00 00       	mov    0x2674,%eax
+{
+ 7e8:	89 e5                	mov    %esp,%ebp
+ 7ea:	56                   	push   %esi
+ 7eb:	53                   	push   %ebx
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f4:	39 ca                	cmp    %ecx,%edx
+ 7f6:	73 30                	jae    828 <bigfree+0x48>
+ 7f8:	39 c1                	cmp    %eax,%ecx
+ 7fa:	72 04                	jb     800 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fc:	39 c2                	cmp    %eax,%edx
+ 7fe:	72 f0                	jb     7f0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 800:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 803:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 806:	39 f0                	cmp    %esi,%eax
+ 808:	74 26                	je     830 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 80a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 80c:	8b 42 04             	mov    0x4(%edx),%eax
+ 80f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 812:	39 d9                	cmp    %ebx,%ecx
+ 814:	74 30                	je     846 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 816:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 818:	5b                   	pop    %ebx
+  freep = p;
+ 819:	89 15 74 26 00 00    	mov    %edx,0x2674
+}
+ 81f:	5e                   	pop    %esi
+ 820:	5d                   	pop    %ebp
+ 821:	c3                   	ret
+ 822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 828:	39 c1                	cmp    %eax,%ecx
+ 82a:	72 d0                	jb     7fc <bigfree+0x1c>
+ 82c:	eb c2                	jmp    7f0 <bigfree+0x10>
+ 82e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 58 04             	add    0x4(%eax),%ebx
+ 833:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 83c:	8b 42 04             	mov    0x4(%edx),%eax
+ 83f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 842:	39 d9                	cmp    %ebx,%ecx
+ 844:	75 d0                	jne    816 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 846:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 849:	89 15 74 26 00 00    	mov    %edx,0x2674
+    p->s.size += bp->s.size;
+ 84f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 852:	8b 09                	mov    (%ecx),%ecx
+ 854:	89 0a                	mov    %ecx,(%edx)
+}
+ 856:	5b                   	pop    %ebx
+ 857:	5e                   	pop    %esi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	89 c7                	mov    %eax,%edi
+ 866:	56                   	push   %esi
+ 867:	53                   	push   %ebx
+ 868:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 86b:	a1 74 26 00 00       	mov    0x2674,%eax
+ 870:	85 c0                	test   %eax,%eax
+ 872:	0f 84 88 00 00 00    	je     900 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 878:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 87a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 87d:	39 f9                	cmp    %edi,%ecx
+ 87f:	73 5f                	jae    8e0 <bigalloc+0x80>
+  if(nu < 4096)
+ 881:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 886:	39 df                	cmp    %ebx,%edi
+ 888:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 88b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 892:	eb 0d                	jmp    8a1 <bigalloc+0x41>
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 898:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 89a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 89d:	39 f9                	cmp    %edi,%ecx
+ 89f:	73 3f                	jae    8e0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 8a1:	89 d0                	mov    %edx,%eax
+ 8a3:	39 15 74 26 00 00    	cmp    %edx,0x2674
+ 8a9:	75 ed                	jne    898 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 8ab:	83 ec 0c             	sub    $0xc,%esp
+ 8ae:	56                   	push   %esi
+ 8af:	e8 67 fb ff ff       	call   41b <sbrk>
+  if(p == (char*)-1)
+ 8b4:	83 c4 10             	add    $0x10,%esp
+ 8b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8ba:	74 11                	je     8cd <bigalloc+0x6d>
+  hp->s.size = nu;
+ 8bc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 8bf:	e8 1c ff ff ff       	call   7e0 <bigfree>
+  return freep;
+ 8c4:	a1 74 26 00 00       	mov    0x2674,%eax
+      if((p = morecore(nunits)) == 0)
+ 8c9:	85 c0                	test   %eax,%eax
+ 8cb:	75 cb                	jne    898 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 8cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8d0:	31 d2                	xor    %edx,%edx
+}
+ 8d2:	5b                   	pop    %ebx
+ 8d3:	89 d0                	mov    %edx,%eax
+ 8d5:	5e                   	pop    %esi
+ 8d6:	5f                   	pop    %edi
+ 8d7:	5d                   	pop    %ebp
+ 8d8:	c3                   	ret
+ 8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8e0:	39 cf                	cmp    %ecx,%edi
+ 8e2:	74 4c                	je     930 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 8e4:	29 f9                	sub    %edi,%ecx
+ 8e6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8e9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8ec:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8ef:	a3 74 26 00 00       	mov    %eax,0x2674
+}
+ 8f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f7:	89 d0                	mov    %edx,%eax
+ 8f9:	5b                   	pop    %ebx
+ 8fa:	5e                   	pop    %esi
+ 8fb:	5f                   	pop    %edi
+ 8fc:	5d                   	pop    %ebp
+ 8fd:	c3                   	ret
+ 8fe:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 900:	c7 05 74 26 00 00 78 	movl   $0x2678,0x2674
+ 907:	26 00 00 
+    base.s.size = 0;
+ 90a:	ba 78 26 00 00       	mov    $0x2678,%edx
+    base.s.ptr = freep = prevp = &base;
+ 90f:	c7 05 78 26 00 00 78 	movl   $0x2678,0x2678
+ 916:	26 00 00 
+    base.s.size = 0;
+ 919:	c7 05 7c 26 00 00 00 	movl   $0x0,0x267c
+ 920:	00 00 00 
+    if(p->s.size >= nunits){
+ 923:	e9 59 ff ff ff       	jmp    881 <bigalloc+0x21>
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 930:	8b 0a                	mov    (%edx),%ecx
+ 932:	89 08                	mov    %ecx,(%eax)
+ 934:	eb b9                	jmp    8ef <bigalloc+0x8f>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <free>:
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	53                   	push   %ebx
+ 944:	83 ec 04             	sub    $0x4,%esp
+ 947:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 94a:	85 c9                	test   %ecx,%ecx
+ 94c:	74 58                	je     9a6 <free+0x66>
+  bp = (Header*)ap - 1;
+ 94e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 951:	ba 01 00 00 00       	mov    $0x1,%edx
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+ 960:	89 d0                	mov    %edx,%eax
+ 962:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+  while(xchg(&locked, 1) != 0)
+ 969:	85 c0                	test   %eax,%eax
+ 96b:	75 f3                	jne    960 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 96d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 970:	83 fa 40             	cmp    $0x40,%edx
+ 973:	77 3b                	ja     9b0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 975:	83 fa 02             	cmp    $0x2,%edx
+ 978:	76 3f                	jbe    9b9 <free+0x79>
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 980:	83 c0 01             	add    $0x1,%eax
+ 983:	39 14 85 40 0d 00 00 	cmp    %edx,0xd40(,%eax,4)
+ 98a:	72 f4                	jb     980 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 98c:	8b 14 85 40 26 00 00 	mov    0x2640(,%eax,4),%edx
+    classfree[c] = bp;
+ 993:	89 1c 85 40 26 00 00 	mov    %ebx,0x2640(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 99a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 99d:	31 c0                	xor    %eax,%eax
+ 99f:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+}
+ 9a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9a9:	c9                   	leave
+ 9aa:	c3                   	ret
+ 9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+    bigfree(bp);
+ 9b0:	89 d8                	mov    %ebx,%eax
+ 9b2:	e8 29 fe ff ff       	call   7e0 <bigfree>
+ 9b7:	eb e4                	jmp    99d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 9b9:	31 c0                	xor    %eax,%eax
+ 9bb:	eb cf                	jmp    98c <free+0x4c>
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	57                   	push   %edi
+ 9c9:	56                   	push   %esi
+ 9ca:	53                   	push   %ebx
+ 9cb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d1:	8d 50 07             	lea    0x7(%eax),%edx
+ 9d4:	c1 ea 03             	shr    $0x3,%edx
+ 9d7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9e0:	89 c8                	mov    %ecx,%eax
+ 9e2:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+ 9e9:	85 c0                	test   %eax,%eax
+ 9eb:	75 f3                	jne    9e0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 9ed:	89 c3                	mov    %eax,%ebx
+ 9ef:	83 fa 40             	cmp    $0x40,%edx
+ 9f2:	77 4c                	ja     a40 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 9f4:	be 02 00 00 00       	mov    $0x2,%esi
+ 9f9:	83 fa 02             	cmp    $0x2,%edx
+ 9fc:	76 10                	jbe    a0e <malloc+0x4e>
+ 9fe:	66 90                	xchg   %ax,%ax
+ a00:	83 c3 01             	add    $0x1,%ebx
+ a03:	8b 34 9d 40 0d 00 00 	mov    0xd40(,%ebx,4),%esi
+ a0a:	39 d6                	cmp    %edx,%esi
+ a0c:	72 f2                	jb     a00 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ a0e:	8b 14 9d 40 26 00 00 	mov    0x2640(,%ebx,4),%edx
+ a15:	85 d2                	test   %edx,%edx
+ a17:	74 47                	je     a60 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ a19:	8b 3a                	mov    (%edx),%edi
+ a1b:	89 3c 9d 40 26 00 00 	mov    %edi,0x2640(,%ebx,4)
+ a22:	31 c0                	xor    %eax,%eax
+ a24:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ a2b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ a2e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ a31:	5b                   	pop    %ebx
+ a32:	5e                   	pop    %esi
+ a33:	5f                   	pop    %edi
+ a34:	5d                   	pop    %ebp
+ a35:	c3                   	ret
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ a40:	89 d0                	mov    %edx,%eax
+ a42:	e8 19 fe ff ff       	call   860 <bigalloc>
+ a47:	89 c2                	mov    %eax,%edx
+ a49:	89 d8                	mov    %ebx,%eax
+ a4b:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+  return p ? (void*)(p + 1) : 0;
+ a52:	85 d2                	test   %edx,%edx
+ a54:	75 d5                	jne    a2b <malloc+0x6b>
+ a56:	31 c0                	xor    %eax,%eax
+}
+ a58:	83 c4 1c             	add    $0x1c,%esp
+ a5b:	5b                   	pop    %ebx
+ a5c:	5e                   	pop    %esi
+ a5d:	5f                   	pop    %edi
+ a5e:	5d                   	pop    %ebp
+ a5f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ a60:	b8 00 02 00 00       	mov    $0x200,%eax
+ a65:	e8 f6 fd ff ff       	call   860 <bigalloc>
+ a6a:	85 c0                	test   %eax,%eax
+ a6c:	74 44                	je     ab2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a6e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ a75:	8b 14 9d 40 26 00 00 	mov    0x2640(,%ebx,4),%edx
+ a7c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ a7f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ a82:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ a88:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ a8b:	39 cf                	cmp    %ecx,%edi
+ a8d:	72 8a                	jb     a19 <malloc+0x59>
+ a8f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ a92:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ a95:	8d 76 00             	lea    0x0(%esi),%esi
+ a98:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ a9a:	89 70 04             	mov    %esi,0x4(%eax)
+ a9d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ a9f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ aa1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ aa3:	01 d8                	add    %ebx,%eax
+ aa5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ aa8:	73 ee                	jae    a98 <malloc+0xd8>
+ aaa:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ aad:	e9 69 ff ff ff       	jmp    a1b <malloc+0x5b>
+ ab2:	f0 87 05 20 26 00 00 	lock xchg %eax,0x2620
+  return p ? (void*)(p + 1) : 0;
+ ab9:	31 c0                	xor    %eax,%eax
+ abb:	eb 9b                	jmp    a58 <malloc+0x98>
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	56                   	push   %esi
+ ac4:	53                   	push   %ebx
+ ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac8:	f7 65 0c             	mull   0xc(%ebp)
+ acb:	70 33                	jo     b00 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ acd:	83 ec 0c             	sub    $0xc,%esp
+ ad0:	89 c3                	mov    %eax,%ebx
+ ad2:	50                   	push   %eax
+ ad3:	e8 e8 fe ff ff       	call   9c0 <malloc>
+ ad8:	83 c4 10             	add    $0x10,%esp
+ adb:	89 c6                	mov    %eax,%esi
+ add:	85 c0                	test   %eax,%eax
+ adf:	74 1f                	je     b00 <calloc+0x40>
+    memset(p, 0, n);
+ ae1:	83 ec 04             	sub    $0x4,%esp
+ ae4:	53                   	push   %ebx
+ ae5:	6a 00                	push   $0x0
+ ae7:	50                   	push   %eax
+ ae8:	e8 23 f7 ff ff       	call   210 <memset>
+ aed:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ af0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ af3:	89 f0                	mov    %esi,%eax
+ af5:	5b                   	pop    %ebx
+ af6:	5e                   	pop    %esi
+ af7:	5d                   	pop    %ebp
+ af8:	c3                   	ret
+ af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b03:	31 f6                	xor    %esi,%esi
+}
+ b05:	89 f0                	mov    %esi,%eax
+ b07:	5b                   	pop    %ebx
+ b08:	5e                   	pop    %esi
+ b09:	5d                   	pop    %ebp
+ b0a:	c3                   	ret
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+
+00000b10 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 0c             	sub    $0xc,%esp
+ b19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b1f:	85 db                	test   %ebx,%ebx
+ b21:	74 55                	je     b78 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b23:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b26:	89 de                	mov    %ebx,%esi
+ b28:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b2f:	39 c7                	cmp    %eax,%edi
+ b31:	72 0d                	jb     b40 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b36:	89 f0                	mov    %esi,%eax
+ b38:	5b                   	pop    %ebx
+ b39:	5e                   	pop    %esi
+ b3a:	5f                   	pop    %edi
+ b3b:	5d                   	pop    %ebp
+ b3c:	c3                   	ret
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b40:	83 ec 0c             	sub    $0xc,%esp
+ b43:	50                   	push   %eax
+ b44:	e8 77 fe ff ff       	call   9c0 <malloc>
+ b49:	83 c4 10             	add    $0x10,%esp
+ b4c:	89 c6                	mov    %eax,%esi
+ b4e:	85 c0                	test   %eax,%eax
+ b50:	74 e1                	je     b33 <realloc+0x23>
+  memmove(p, ap, have);
+ b52:	83 ec 04             	sub    $0x4,%esp
+ b55:	57                   	push   %edi
+ b56:	53                   	push   %ebx
+ b57:	50                   	push   %eax
+ b58:	e8 03 f8 ff ff       	call   360 <memmove>
+  free(ap);
+ b5d:	89 1c 24             	mov    %ebx,(%esp)
+ b60:	e8 db fd ff ff       	call   940 <free>
+  return p;
+ b65:	83 c4 10             	add    $0x10,%esp
+}
+ b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b6b:	89 f0                	mov    %esi,%eax
+ b6d:	5b                   	pop    %ebx
+ b6e:	5e                   	pop    %esi
+ b6f:	5f                   	pop    %edi
+ b70:	5d                   	pop    %ebp
+ b71:	c3                   	ret
+ b72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b78:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b7e:	5b                   	pop    %ebx
+ b7f:	5e                   	pop    %esi
+ b80:	5f                   	pop    %edi
+ b81:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b82:	e9 39 fe ff ff       	jmp    9c0 <malloc>
@@ -18,11 +18,16 @@ get_state_str(enum procstate state)
   return states[state];
 }
 
+// Too big for the one-page user stack.
+struct procinfo processes[NPROC];
+
 int
 main(int argc, char *argv[])
 {
-  struct procinfo processes[NPROC];
-  int count;
+  struct procinfo *p;
+  int count, i, lflag;
+
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
 
   // 1. Make a *single* system call
   count = getallprocinfo(processes, NPROC);
@@ -31,11 +36,25 @@ main(int argc, char *argv[])
     exit();
   }
 
+  // With -l, show the resource counters instead of the
+  // scheduling fields.
+  if(lflag){
+    printf(1, "PID\tVCSW\tIVCSW\tSYSCALL\tBREAD\tBWRITE\tPIPEIN\tPIPEOUT\tPAGES\tWAIT\tSLEEP\tNAME\n");
+    for(i = 0; i < count; i++){
+      p = &processes[i];
+      printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+        p->pid, p->nvcsw, p->nivcsw, p->nsyscall, p->nblkread,
+        p->nblkwrite, p->pipein, p->pipeout, p->npages,
+        p->runnable_ticks, p->sleep_ticks, p->name);
+    }
+    exit();
+  }
+
   // 2. Print header
   printf(1, "PID\tPPID\tSTATE\t\tPRI\tMLFQ\tCPU_TICKS\tNAME\n");
 
   // 3. Loop through the *local* array and print
-  for(int i = 0; i < count; i++){
+  for(i = 0; i < count; i++){
     printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t\t%s\n",
       processes[i].pid,
       processes[i].ppid,
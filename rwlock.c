@@ -0,0 +1,79 @@
+// Reader-writer spin locks.
+//
+// Any number of readers may hold the lock at once, or a single
+// writer. They suit tables that are read far more often than
+// they change, such as the mount table, where readers would
+// otherwise queue behind each other on a spinlock.
+//
+// A writer that finds the lock busy sets RW_WAITING, which keeps
+// new readers out, so a steady stream of readers cannot starve
+// it. As with spinlocks, interrupts are off while the lock is
+// held, and holders must not sleep. Readers must not acquire
+// the same lock again while holding it: a writer waiting in
+// between would deadlock them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *rw, char *name)
+{
+  rw->name = name;
+  rw->bits = 0;
+}
+
+void
+acquireread(struct rwlock *rw)
+{
+  uint v;
+
+  pushcli();
+  for(;;){
+    v = *(volatile uint*)&rw->bits;
+    if((v & (RW_WRITER|RW_WAITING)) == 0 &&
+       __sync_bool_compare_and_swap(&rw->bits, v, v+1))
+      break;
+    pause();
+  }
+}
+
+void
+releaseread(struct rwlock *rw)
+{
+  if((rw->bits & ~(RW_WRITER|RW_WAITING)) == 0)
+    panic("releaseread");
+  __sync_fetch_and_sub(&rw->bits, 1);
+  popcli();
+}
+
+void
+acquirewrite(struct rwlock *rw)
+{
+  uint v;
+
+  pushcli();
+  for(;;){
+    // Take the lock once there are no readers and no writer,
+    // clearing RW_WAITING; any other waiting writer sets it
+    // again on its next try.
+    v = *(volatile uint*)&rw->bits;
+    if((v & ~RW_WAITING) == 0 &&
+       __sync_bool_compare_and_swap(&rw->bits, v, RW_WRITER))
+      break;
+    if((v & RW_WAITING) == 0)
+      __sync_fetch_and_or(&rw->bits, RW_WAITING);
+    pause();
+  }
+}
+
+void
+releasewrite(struct rwlock *rw)
+{
+  if((rw->bits & RW_WRITER) == 0)
+    panic("releasewrite");
+  __sync_fetch_and_and(&rw->bits, ~RW_WRITER);
+  popcli();
+}
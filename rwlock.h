@@ -0,0 +1,10 @@
+// Reader-writer spin locks
+struct rwlock {
+  uint bits;         // RW_WRITER, RW_WAITING and the reader count
+
+  // For debugging:
+  char *name;        // Name of lock.
+};
+
+#define RW_WRITER   0x80000000  // held by a writer
+#define RW_WAITING  0x40000000  // a writer is waiting
@@ -0,0 +1,2110 @@
+
+_schedlat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+        printf(1, "\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int i, n, hist, pid;
+
+  hist = 0;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-h") == 0){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	7f 60                	jg     7e <main+0x7e>
+    hist = 1;
+    i++;
+  }
+
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+  1e:	50                   	push   %eax
+  hist = 0;
+  1f:	31 db                	xor    %ebx,%ebx
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+  21:	50                   	push   %eax
+  22:	68 c8 0e 00 00       	push   $0xec8
+  27:	6a 01                	push   $0x1
+  29:	e8 b2 08 00 00       	call   8e0 <printf>
+  2e:	83 c4 10             	add    $0x10,%esp
+      printf(2, "schedlat: exec %s failed\n", argv[i]);
+      exit();
+    }
+    wait();
+  }
+  if((n = getschedwait(st, NSCHEDPOLICY, 0)) < 0){
+  31:	52                   	push   %edx
+  32:	6a 00                	push   $0x0
+  34:	6a 03                	push   $0x3
+  36:	68 a0 13 00 00       	push   $0x13a0
+  3b:	e8 9b 07 00 00       	call   7db <getschedwait>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  46:	85 c0                	test   %eax,%eax
+  48:	0f 88 02 01 00 00    	js     150 <main+0x150>
+    printf(2, "schedlat: getschedwait failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+  4e:	74 29                	je     79 <main+0x79>
+  50:	bf a0 13 00 00       	mov    $0x13a0,%edi
+  55:	31 f6                	xor    %esi,%esi
+    report(policyname[i], &st[i], hist);
+  57:	83 ec 04             	sub    $0x4,%esp
+  5a:	53                   	push   %ebx
+  5b:	57                   	push   %edi
+  for(i = 0; i < n; i++)
+  5c:	81 c7 8c 00 00 00    	add    $0x8c,%edi
+    report(policyname[i], &st[i], hist);
+  62:	ff 34 b5 94 13 00 00 	push   0x1394(,%esi,4)
+  for(i = 0; i < n; i++)
+  69:	83 c6 01             	add    $0x1,%esi
+    report(policyname[i], &st[i], hist);
+  6c:	e8 df 01 00 00       	call   250 <report>
+  for(i = 0; i < n; i++)
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  77:	75 de                	jne    57 <main+0x57>
+  exit();
+  79:	e8 c5 05 00 00       	call   643 <exit>
+  if(i < argc && strcmp(argv[i], "-h") == 0){
+  7e:	50                   	push   %eax
+  7f:	50                   	push   %eax
+  80:	68 6c 0e 00 00       	push   $0xe6c
+  85:	ff 76 04             	push   0x4(%esi)
+  88:	e8 a3 03 00 00       	call   430 <strcmp>
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	85 c0                	test   %eax,%eax
+  92:	0f 85 88 00 00 00    	jne    120 <main+0x120>
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+  98:	50                   	push   %eax
+  99:	50                   	push   %eax
+  9a:	68 c8 0e 00 00       	push   $0xec8
+  9f:	6a 01                	push   $0x1
+  a1:	e8 3a 08 00 00       	call   8e0 <printf>
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	83 fb 03             	cmp    $0x3,%ebx
+    hist = 1;
+  ac:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+  b1:	0f 8e f7 00 00 00    	jle    1ae <main+0x1ae>
+    i++;
+  b7:	bf 02 00 00 00       	mov    $0x2,%edi
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+  bc:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+  c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c6:	50                   	push   %eax
+  c7:	50                   	push   %eax
+  c8:	68 6f 0e 00 00       	push   $0xe6f
+  cd:	ff 34 be             	push   (%esi,%edi,4)
+  d0:	e8 5b 03 00 00       	call   430 <strcmp>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	85 c0                	test   %eax,%eax
+  da:	0f 84 96 00 00 00    	je     176 <main+0x176>
+    getschedwait(st, NSCHEDPOLICY, 1);
+  e0:	50                   	push   %eax
+  e1:	6a 01                	push   $0x1
+  e3:	6a 03                	push   $0x3
+  e5:	68 a0 13 00 00       	push   $0x13a0
+  ea:	e8 ec 06 00 00       	call   7db <getschedwait>
+    pid = fork();
+  ef:	e8 47 05 00 00       	call   63b <fork>
+    if(pid < 0){
+  f4:	83 c4 10             	add    $0x10,%esp
+  f7:	85 c0                	test   %eax,%eax
+  f9:	78 68                	js     163 <main+0x163>
+    if(pid == 0){
+  fb:	75 49                	jne    146 <main+0x146>
+      exec(argv[i], argv+i);
+  fd:	8d 1c be             	lea    (%esi,%edi,4),%ebx
+ 100:	51                   	push   %ecx
+ 101:	51                   	push   %ecx
+ 102:	53                   	push   %ebx
+ 103:	ff 33                	push   (%ebx)
+ 105:	e8 71 05 00 00       	call   67b <exec>
+      printf(2, "schedlat: exec %s failed\n", argv[i]);
+ 10a:	83 c4 0c             	add    $0xc,%esp
+ 10d:	ff 33                	push   (%ebx)
+ 10f:	68 a2 0e 00 00       	push   $0xea2
+ 114:	6a 02                	push   $0x2
+ 116:	e8 c5 07 00 00       	call   8e0 <printf>
+      exit();
+ 11b:	e8 23 05 00 00       	call   643 <exit>
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+ 120:	50                   	push   %eax
+  i = 1;
+ 121:	bf 01 00 00 00       	mov    $0x1,%edi
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+ 126:	50                   	push   %eax
+ 127:	68 c8 0e 00 00       	push   $0xec8
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 ad 07 00 00       	call   8e0 <printf>
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	83 fb 02             	cmp    $0x2,%ebx
+  hist = 0;
+ 139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+ 13e:	0f 85 78 ff ff ff    	jne    bc <main+0xbc>
+ 144:	eb 9a                	jmp    e0 <main+0xe0>
+    wait();
+ 146:	e8 00 05 00 00       	call   64b <wait>
+ 14b:	e9 e1 fe ff ff       	jmp    31 <main+0x31>
+    printf(2, "schedlat: getschedwait failed\n");
+ 150:	50                   	push   %eax
+ 151:	50                   	push   %eax
+ 152:	68 ec 0e 00 00       	push   $0xeec
+ 157:	6a 02                	push   $0x2
+ 159:	e8 82 07 00 00       	call   8e0 <printf>
+    exit();
+ 15e:	e8 e0 04 00 00       	call   643 <exit>
+      printf(2, "schedlat: fork failed\n");
+ 163:	53                   	push   %ebx
+ 164:	53                   	push   %ebx
+ 165:	68 8b 0e 00 00       	push   $0xe8b
+ 16a:	6a 02                	push   $0x2
+ 16c:	e8 6f 07 00 00       	call   8e0 <printf>
+      exit();
+ 171:	e8 cd 04 00 00       	call   643 <exit>
+    if(getwaitstat(atoi(argv[i+1]), &st[0]) < 0){
+ 176:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 179:	83 ec 0c             	sub    $0xc,%esp
+ 17c:	8d 74 06 04          	lea    0x4(%esi,%eax,1),%esi
+ 180:	ff 36                	push   (%esi)
+ 182:	e8 49 04 00 00       	call   5d0 <atoi>
+ 187:	5a                   	pop    %edx
+ 188:	59                   	pop    %ecx
+ 189:	68 a0 13 00 00       	push   $0x13a0
+ 18e:	50                   	push   %eax
+ 18f:	e8 3f 06 00 00       	call   7d3 <getwaitstat>
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	78 23                	js     1be <main+0x1be>
+    report(argv[i+1], &st[0], hist);
+ 19b:	50                   	push   %eax
+ 19c:	53                   	push   %ebx
+ 19d:	68 a0 13 00 00       	push   $0x13a0
+ 1a2:	ff 36                	push   (%esi)
+ 1a4:	e8 a7 00 00 00       	call   250 <report>
+    exit();
+ 1a9:	e8 95 04 00 00       	call   643 <exit>
+  if(i < argc){
+ 1ae:	0f 85 7d fe ff ff    	jne    31 <main+0x31>
+    i++;
+ 1b4:	bf 02 00 00 00       	mov    $0x2,%edi
+ 1b9:	e9 22 ff ff ff       	jmp    e0 <main+0xe0>
+      printf(2, "schedlat: no process %s\n", argv[i+1]);
+ 1be:	50                   	push   %eax
+ 1bf:	ff 36                	push   (%esi)
+ 1c1:	68 72 0e 00 00       	push   $0xe72
+ 1c6:	6a 02                	push   $0x2
+ 1c8:	e8 13 07 00 00       	call   8e0 <printf>
+      exit();
+ 1cd:	e8 71 04 00 00       	call   643 <exit>
+ 1d2:	66 90                	xchg   %ax,%ax
+ 1d4:	66 90                	xchg   %ax,%ax
+ 1d6:	66 90                	xchg   %ax,%ax
+ 1d8:	66 90                	xchg   %ax,%ax
+ 1da:	66 90                	xchg   %ax,%ax
+ 1dc:	66 90                	xchg   %ax,%ax
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <percentile>:
+{
+ 1e0:	55                   	push   %ebp
+  want = (s->nwait * q + 99) / 100;
+ 1e1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+{
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	53                   	push   %ebx
+ 1e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  want = (s->nwait * q + 99) / 100;
+ 1ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ef:	0f af 13             	imul   (%ebx),%edx
+ 1f2:	83 c2 63             	add    $0x63,%edx
+ 1f5:	f7 e2                	mul    %edx
+    n += s->hist[b];
+ 1f7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  want = (s->nwait * q + 99) / 100;
+ 1fa:	c1 ea 05             	shr    $0x5,%edx
+    if(n >= want)
+ 1fd:	39 d0                	cmp    %edx,%eax
+ 1ff:	73 39                	jae    23a <percentile+0x5a>
+  for(b = 0; b < NWAITHIST; b++){
+ 201:	31 c9                	xor    %ecx,%ecx
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	83 c1 01             	add    $0x1,%ecx
+ 20b:	83 f9 20             	cmp    $0x20,%ecx
+ 20e:	74 20                	je     230 <percentile+0x50>
+    n += s->hist[b];
+ 210:	03 44 8b 0c          	add    0xc(%ebx,%ecx,4),%eax
+    if(n >= want)
+ 214:	39 d0                	cmp    %edx,%eax
+ 216:	72 f0                	jb     208 <percentile+0x28>
+  if(b >= 31)
+ 218:	83 f9 1f             	cmp    $0x1f,%ecx
+ 21b:	74 13                	je     230 <percentile+0x50>
+  return (2 << b) - 1;
+ 21d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 222:	d3 e0                	shl    %cl,%eax
+ 224:	83 e8 01             	sub    $0x1,%eax
+}
+ 227:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 22a:	c9                   	leave
+ 22b:	c3                   	ret
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0xffffffff;
+ 233:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+    if(n >= want)
+ 23a:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (2 << b) - 1;
+ 23f:	eb e6                	jmp    227 <percentile+0x47>
+ 241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <report>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	53                   	push   %ebx
+ 256:	83 ec 2c             	sub    $0x2c,%esp
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(s->nwait == 0){
+ 262:	8b 3b                	mov    (%ebx),%edi
+{
+ 264:	8b 45 10             	mov    0x10(%ebp),%eax
+ 267:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(s->nwait == 0){
+ 26a:	85 ff                	test   %edi,%edi
+ 26c:	0f 84 2e 01 00 00    	je     3a0 <report+0x150>
+  avg = s->cycles / s->nwait * 1024 +
+ 272:	8b 43 04             	mov    0x4(%ebx),%eax
+ 275:	31 d2                	xor    %edx,%edx
+    n += s->hist[b];
+ 277:	8b 73 0c             	mov    0xc(%ebx),%esi
+ 27a:	f7 f7                	div    %edi
+ 27c:	89 c1                	mov    %eax,%ecx
+        s->cycles % s->nwait * 1024 / s->nwait;
+ 27e:	89 d0                	mov    %edx,%eax
+ 280:	31 d2                	xor    %edx,%edx
+ 282:	c1 e0 0a             	shl    $0xa,%eax
+  avg = s->cycles / s->nwait * 1024 +
+ 285:	c1 e1 0a             	shl    $0xa,%ecx
+        s->cycles % s->nwait * 1024 / s->nwait;
+ 288:	f7 f7                	div    %edi
+  want = (s->nwait * q + 99) / 100;
+ 28a:	8d 57 01             	lea    0x1(%edi),%edx
+ 28d:	6b d2 63             	imul   $0x63,%edx,%edx
+  avg = s->cycles / s->nwait * 1024 +
+ 290:	01 c8                	add    %ecx,%eax
+ 292:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\n", name, s->nwait, avg,
+ 295:	8b 43 08             	mov    0x8(%ebx),%eax
+ 298:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  want = (s->nwait * q + 99) / 100;
+ 29b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 2a0:	f7 e2                	mul    %edx
+ 2a2:	c1 ea 05             	shr    $0x5,%edx
+    if(n >= want)
+ 2a5:	39 d6                	cmp    %edx,%esi
+ 2a7:	0f 83 39 01 00 00    	jae    3e6 <report+0x196>
+    n += s->hist[b];
+ 2ad:	89 f0                	mov    %esi,%eax
+  for(b = 0; b < NWAITHIST; b++){
+ 2af:	31 c9                	xor    %ecx,%ecx
+ 2b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b8:	83 c1 01             	add    $0x1,%ecx
+ 2bb:	83 f9 20             	cmp    $0x20,%ecx
+ 2be:	0f 84 0c 01 00 00    	je     3d0 <report+0x180>
+    n += s->hist[b];
+ 2c4:	03 44 8b 0c          	add    0xc(%ebx,%ecx,4),%eax
+    if(n >= want)
+ 2c8:	39 d0                	cmp    %edx,%eax
+ 2ca:	72 ec                	jb     2b8 <report+0x68>
+  if(b >= 31)
+ 2cc:	83 f9 1f             	cmp    $0x1f,%ecx
+ 2cf:	0f 84 fb 00 00 00    	je     3d0 <report+0x180>
+  return (2 << b) - 1;
+ 2d5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2da:	d3 e0                	shl    %cl,%eax
+ 2dc:	83 e8 01             	sub    $0x1,%eax
+ 2df:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  want = (s->nwait * q + 99) / 100;
+ 2e2:	6b d7 32             	imul   $0x32,%edi,%edx
+ 2e5:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 2ea:	83 c2 63             	add    $0x63,%edx
+ 2ed:	f7 e2                	mul    %edx
+ 2ef:	c1 ea 05             	shr    $0x5,%edx
+    if(n >= want)
+ 2f2:	39 d6                	cmp    %edx,%esi
+ 2f4:	0f 83 e2 00 00 00    	jae    3dc <report+0x18c>
+  for(b = 0; b < NWAITHIST; b++){
+ 2fa:	31 c9                	xor    %ecx,%ecx
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 300:	83 c1 01             	add    $0x1,%ecx
+ 303:	83 f9 20             	cmp    $0x20,%ecx
+ 306:	0f 84 b4 00 00 00    	je     3c0 <report+0x170>
+    n += s->hist[b];
+ 30c:	03 74 8b 0c          	add    0xc(%ebx,%ecx,4),%esi
+    if(n >= want)
+ 310:	39 d6                	cmp    %edx,%esi
+ 312:	72 ec                	jb     300 <report+0xb0>
+  if(b >= 31)
+ 314:	83 f9 1f             	cmp    $0x1f,%ecx
+ 317:	0f 84 a3 00 00 00    	je     3c0 <report+0x170>
+  return (2 << b) - 1;
+ 31d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 322:	d3 e0                	shl    %cl,%eax
+ 324:	83 e8 01             	sub    $0x1,%eax
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\n", name, s->nwait, avg,
+ 327:	ff 75 d8             	push   -0x28(%ebp)
+ 32a:	ff 75 dc             	push   -0x24(%ebp)
+ 32d:	50                   	push   %eax
+ 32e:	ff 75 d4             	push   -0x2c(%ebp)
+ 331:	57                   	push   %edi
+ 332:	ff 75 e4             	push   -0x1c(%ebp)
+ 335:	68 46 0e 00 00       	push   $0xe46
+ 33a:	6a 01                	push   $0x1
+ 33c:	e8 9f 05 00 00       	call   8e0 <printf>
+  if(hist)
+ 341:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 344:	83 c4 20             	add    $0x20,%esp
+ 347:	85 c0                	test   %eax,%eax
+ 349:	74 4a                	je     395 <report+0x145>
+    for(b = 0; b < NWAITHIST; b++)
+ 34b:	31 f6                	xor    %esi,%esi
+        printf(1, "\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 34d:	bf 02 00 00 00       	mov    $0x2,%edi
+ 352:	eb 0c                	jmp    360 <report+0x110>
+ 354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(b = 0; b < NWAITHIST; b++)
+ 358:	83 c6 01             	add    $0x1,%esi
+ 35b:	83 fe 20             	cmp    $0x20,%esi
+ 35e:	74 35                	je     395 <report+0x145>
+      if(s->hist[b])
+ 360:	8b 44 b3 0c          	mov    0xc(%ebx,%esi,4),%eax
+ 364:	85 c0                	test   %eax,%eax
+ 366:	74 f0                	je     358 <report+0x108>
+        printf(1, "\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	89 f1                	mov    %esi,%ecx
+    for(b = 0; b < NWAITHIST; b++)
+ 36d:	83 c6 01             	add    $0x1,%esi
+        printf(1, "\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 370:	50                   	push   %eax
+ 371:	89 f8                	mov    %edi,%eax
+ 373:	d3 e0                	shl    %cl,%eax
+ 375:	83 e8 01             	sub    $0x1,%eax
+ 378:	50                   	push   %eax
+ 379:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37e:	d3 e0                	shl    %cl,%eax
+ 380:	50                   	push   %eax
+ 381:	68 59 0e 00 00       	push   $0xe59
+ 386:	6a 01                	push   $0x1
+ 388:	e8 53 05 00 00       	call   8e0 <printf>
+ 38d:	83 c4 20             	add    $0x20,%esp
+    for(b = 0; b < NWAITHIST; b++)
+ 390:	83 fe 20             	cmp    $0x20,%esi
+ 393:	75 cb                	jne    360 <report+0x110>
+}
+ 395:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 398:	5b                   	pop    %ebx
+ 399:	5e                   	pop    %esi
+ 39a:	5f                   	pop    %edi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s\t0\n", name);
+ 3a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3a3:	c7 45 0c 40 0e 00 00 	movl   $0xe40,0xc(%ebp)
+ 3aa:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 3b1:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 3b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3b7:	5b                   	pop    %ebx
+ 3b8:	5e                   	pop    %esi
+ 3b9:	5f                   	pop    %edi
+ 3ba:	5d                   	pop    %ebp
+    printf(1, "%s\t0\n", name);
+ 3bb:	e9 20 05 00 00       	jmp    8e0 <printf>
+    return 0xffffffff;
+ 3c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3c5:	e9 5d ff ff ff       	jmp    327 <report+0xd7>
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 3d0:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+ 3d7:	e9 06 ff ff ff       	jmp    2e2 <report+0x92>
+    if(n >= want)
+ 3dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (2 << b) - 1;
+ 3e1:	e9 41 ff ff ff       	jmp    327 <report+0xd7>
+    if(n >= want)
+ 3e6:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+  return (2 << b) - 1;
+ 3ed:	e9 f0 fe ff ff       	jmp    2e2 <report+0x92>
+ 3f2:	66 90                	xchg   %ax,%ax
+ 3f4:	66 90                	xchg   %ax,%ax
+ 3f6:	66 90                	xchg   %ax,%ax
+ 3f8:	66 90                	xchg   %ax,%ax
+ 3fa:	66 90                	xchg   %ax,%ax
+ 3fc:	66 90                	xchg   %ax,%ax
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 400:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 401:	31 c0                	xor    %eax,%eax
+{
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	53                   	push   %ebx
+ 406:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 410:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 414:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 417:	83 c0 01             	add    $0x1,%eax
+ 41a:	84 d2                	test   %dl,%dl
+ 41c:	75 f2                	jne    410 <strcpy+0x10>
+    ;
+  return os;
+}
+ 41e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 421:	89 c8                	mov    %ecx,%eax
+ 423:	c9                   	leave
+ 424:	c3                   	ret
+ 425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+ 437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 43a:	0f b6 02             	movzbl (%edx),%eax
+ 43d:	84 c0                	test   %al,%al
+ 43f:	75 17                	jne    458 <strcmp+0x28>
+ 441:	eb 3a                	jmp    47d <strcmp+0x4d>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 44c:	83 c2 01             	add    $0x1,%edx
+ 44f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 452:	84 c0                	test   %al,%al
+ 454:	74 1a                	je     470 <strcmp+0x40>
+    p++, q++;
+ 456:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 458:	0f b6 19             	movzbl (%ecx),%ebx
+ 45b:	38 c3                	cmp    %al,%bl
+ 45d:	74 e9                	je     448 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 45f:	29 d8                	sub    %ebx,%eax
+}
+ 461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 464:	c9                   	leave
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 470:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 474:	31 c0                	xor    %eax,%eax
+ 476:	29 d8                	sub    %ebx,%eax
+}
+ 478:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 47b:	c9                   	leave
+ 47c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 47d:	0f b6 19             	movzbl (%ecx),%ebx
+ 480:	31 c0                	xor    %eax,%eax
+ 482:	eb db                	jmp    45f <strcmp+0x2f>
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 496:	80 3a 00             	cmpb   $0x0,(%edx)
+ 499:	74 15                	je     4b0 <strlen+0x20>
+ 49b:	31 c0                	xor    %eax,%eax
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+ 4a0:	83 c0 01             	add    $0x1,%eax
+ 4a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4a7:	89 c1                	mov    %eax,%ecx
+ 4a9:	75 f5                	jne    4a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4ab:	89 c8                	mov    %ecx,%eax
+ 4ad:	5d                   	pop    %ebp
+ 4ae:	c3                   	ret
+ 4af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4b0:	31 c9                	xor    %ecx,%ecx
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	89 c8                	mov    %ecx,%eax
+ 4b5:	c3                   	ret
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4cd:	89 d7                	mov    %edx,%edi
+ 4cf:	fc                   	cld
+ 4d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4d5:	89 d0                	mov    %edx,%eax
+ 4d7:	c9                   	leave
+ 4d8:	c3                   	ret
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ea:	0f b6 10             	movzbl (%eax),%edx
+ 4ed:	84 d2                	test   %dl,%dl
+ 4ef:	75 12                	jne    503 <strchr+0x23>
+ 4f1:	eb 1d                	jmp    510 <strchr+0x30>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4fc:	83 c0 01             	add    $0x1,%eax
+ 4ff:	84 d2                	test   %dl,%dl
+ 501:	74 0d                	je     510 <strchr+0x30>
+    if(*s == c)
+ 503:	38 d1                	cmp    %dl,%cl
+ 505:	75 f1                	jne    4f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 507:	5d                   	pop    %ebp
+ 508:	c3                   	ret
+ 509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 510:	31 c0                	xor    %eax,%eax
+}
+ 512:	5d                   	pop    %ebp
+ 513:	c3                   	ret
+ 514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 525:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 528:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 529:	31 db                	xor    %ebx,%ebx
+{
+ 52b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 52e:	eb 27                	jmp    557 <gets+0x37>
+    cc = read(0, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	6a 01                	push   $0x1
+ 535:	56                   	push   %esi
+ 536:	6a 00                	push   $0x0
+ 538:	e8 1e 01 00 00       	call   65b <read>
+    if(cc < 1)
+ 53d:	83 c4 10             	add    $0x10,%esp
+ 540:	85 c0                	test   %eax,%eax
+ 542:	7e 1d                	jle    561 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 544:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+ 54b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 54f:	3c 0a                	cmp    $0xa,%al
+ 551:	74 10                	je     563 <gets+0x43>
+ 553:	3c 0d                	cmp    $0xd,%al
+ 555:	74 0c                	je     563 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 557:	89 df                	mov    %ebx,%edi
+ 559:	83 c3 01             	add    $0x1,%ebx
+ 55c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 55f:	7c cf                	jl     530 <gets+0x10>
+ 561:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 56a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56d:	5b                   	pop    %ebx
+ 56e:	5e                   	pop    %esi
+ 56f:	5f                   	pop    %edi
+ 570:	5d                   	pop    %ebp
+ 571:	c3                   	ret
+ 572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	56                   	push   %esi
+ 584:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 585:	83 ec 08             	sub    $0x8,%esp
+ 588:	6a 00                	push   $0x0
+ 58a:	ff 75 08             	push   0x8(%ebp)
+ 58d:	e8 f1 00 00 00       	call   683 <open>
+  if(fd < 0)
+ 592:	83 c4 10             	add    $0x10,%esp
+ 595:	85 c0                	test   %eax,%eax
+ 597:	78 27                	js     5c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 599:	83 ec 08             	sub    $0x8,%esp
+ 59c:	ff 75 0c             	push   0xc(%ebp)
+ 59f:	89 c3                	mov    %eax,%ebx
+ 5a1:	50                   	push   %eax
+ 5a2:	e8 f4 00 00 00       	call   69b <fstat>
+  close(fd);
+ 5a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5ac:	e8 ba 00 00 00       	call   66b <close>
+  return r;
+ 5b1:	83 c4 10             	add    $0x10,%esp
+}
+ 5b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5b7:	89 f0                	mov    %esi,%eax
+ 5b9:	5b                   	pop    %ebx
+ 5ba:	5e                   	pop    %esi
+ 5bb:	5d                   	pop    %ebp
+ 5bc:	c3                   	ret
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5c5:	eb ed                	jmp    5b4 <stat+0x34>
+ 5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	53                   	push   %ebx
+ 5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5d7:	0f be 02             	movsbl (%edx),%eax
+ 5da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5e5:	77 1e                	ja     605 <atoi+0x35>
+ 5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5f0:	83 c2 01             	add    $0x1,%edx
+ 5f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5fa:	0f be 02             	movsbl (%edx),%eax
+ 5fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 600:	80 fb 09             	cmp    $0x9,%bl
+ 603:	76 eb                	jbe    5f0 <atoi+0x20>
+  return n;
+}
+ 605:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 608:	89 c8                	mov    %ecx,%eax
+ 60a:	c9                   	leave
+ 60b:	c3                   	ret
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	8b 45 10             	mov    0x10(%ebp),%eax
+ 618:	8b 55 08             	mov    0x8(%ebp),%edx
+ 61b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 61e:	85 c0                	test   %eax,%eax
+ 620:	7e 13                	jle    635 <memmove+0x25>
+ 622:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 624:	89 d7                	mov    %edx,%edi
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 630:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 631:	39 f8                	cmp    %edi,%eax
+ 633:	75 fb                	jne    630 <memmove+0x20>
+  return vdst;
+}
+ 635:	5e                   	pop    %esi
+ 636:	89 d0                	mov    %edx,%eax
+ 638:	5f                   	pop    %edi
+ 639:	5d                   	pop    %ebp
+ 63a:	c3                   	ret
+
+0000063b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 63b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <exit>:
+SYSCALL(exit)
+ 643:	b8 02 00 00 00       	mov    $0x2,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <wait>:
+SYSCALL(wait)
+ 64b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <pipe>:
+SYSCALL(pipe)
+ 653:	b8 04 00 00 00       	mov    $0x4,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <read>:
+SYSCALL(read)
+ 65b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <write>:
+SYSCALL(write)
+ 663:	b8 10 00 00 00       	mov    $0x10,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <close>:
+SYSCALL(close)
+ 66b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <kill>:
+SYSCALL(kill)
+ 673:	b8 06 00 00 00       	mov    $0x6,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <exec>:
+SYSCALL(exec)
+ 67b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <open>:
+SYSCALL(open)
+ 683:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mknod>:
+SYSCALL(mknod)
+ 68b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <unlink>:
+SYSCALL(unlink)
+ 693:	b8 12 00 00 00       	mov    $0x12,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <fstat>:
+SYSCALL(fstat)
+ 69b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <link>:
+SYSCALL(link)
+ 6a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mkdir>:
+SYSCALL(mkdir)
+ 6ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <chdir>:
+SYSCALL(chdir)
+ 6b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <dup>:
+SYSCALL(dup)
+ 6bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <getpid>:
+SYSCALL(getpid)
+ 6c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <sbrk>:
+SYSCALL(sbrk)
+ 6cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <sleep>:
+SYSCALL(sleep)
+ 6d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <uptime>:
+SYSCALL(uptime)
+ 6db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 6e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 6eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 6f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 6fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 703:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 70b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 713:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <setpriority>:
+SYSCALL(setpriority)
+ 71b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 723:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <getcpustats>:
+SYSCALL(getcpustats)
+ 72b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <setscheduler>:
+SYSCALL(setscheduler)
+ 733:	b8 20 00 00 00       	mov    $0x20,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 73b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <getscheduler>:
+SYSCALL(getscheduler)
+ 743:	b8 22 00 00 00       	mov    $0x22,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <splice>:
+SYSCALL(splice)
+ 74b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <readv>:
+SYSCALL(readv)
+ 753:	b8 24 00 00 00       	mov    $0x24,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <writev>:
+SYSCALL(writev)
+ 75b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <pread>:
+SYSCALL(pread)
+ 763:	b8 26 00 00 00       	mov    $0x26,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <pwrite>:
+SYSCALL(pwrite)
+ 76b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getlogstat>:
+SYSCALL(getlogstat)
+ 773:	b8 28 00 00 00       	mov    $0x28,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <mount>:
+SYSCALL(mount)
+ 77b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <umount>:
+SYSCALL(umount)
+ 783:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <mmap>:
+SYSCALL(mmap)
+ 78b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <munmap>:
+SYSCALL(munmap)
+ 793:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <membench>:
+SYSCALL(membench)
+ 79b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <getlockstat>:
+SYSCALL(getlockstat)
+ 7a3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <lockbench>:
+SYSCALL(lockbench)
+ 7ab:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <prof>:
+SYSCALL(prof)
+ 7b3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <tracectl>:
+SYSCALL(tracectl)
+ 7bb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <traceread>:
+SYSCALL(traceread)
+ 7c3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <getsysstat>:
+SYSCALL(getsysstat)
+ 7cb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 7d3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <getschedwait>:
+SYSCALL(getschedwait)
+ 7db:	b8 35 00 00 00       	mov    $0x35,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <mlfqread>:
+SYSCALL(mlfqread)
+ 7e3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <dllock>:
+SYSCALL(dllock)
+ 7eb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 7f3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 7fb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <clone>:
+SYSCALL(clone)
+ 803:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <join>:
+SYSCALL(join)
+ 80b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <futex>:
+SYSCALL(futex)
+ 813:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <shmat>:
+SYSCALL(shmat)
+ 81b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <shmdt>:
+SYSCALL(shmdt)
+ 823:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <poll>:
+SYSCALL(poll)
+ 82b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+ 833:	66 90                	xchg   %ax,%ax
+ 835:	66 90                	xchg   %ax,%ax
+ 837:	66 90                	xchg   %ax,%ax
+ 839:	66 90                	xchg   %ax,%ax
+ 83b:	66 90                	xchg   %ax,%ax
+ 83d:	66 90                	xchg   %ax,%ax
+ 83f:	90                   	nop
+
+00000840 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 848:	89 d1                	mov    %edx,%ecx
+{
+ 84a:	83 ec 3c             	sub    $0x3c,%esp
+ 84d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 850:	85 d2                	test   %edx,%edx
+ 852:	0f 89 80 00 00 00    	jns    8d8 <printint+0x98>
+ 858:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 85c:	74 7a                	je     8d8 <printint+0x98>
+    x = -xx;
+ 85e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 860:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 865:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 868:	31 f6                	xor    %esi,%esi
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 870:	89 c8                	mov    %ecx,%eax
+ 872:	31 d2                	xor    %edx,%edx
+ 874:	89 f7                	mov    %esi,%edi
+ 876:	f7 f3                	div    %ebx
+ 878:	8d 76 01             	lea    0x1(%esi),%esi
+ 87b:	0f b6 92 6c 0f 00 00 	movzbl 0xf6c(%edx),%edx
+ 882:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 886:	89 ca                	mov    %ecx,%edx
+ 888:	89 c1                	mov    %eax,%ecx
+ 88a:	39 da                	cmp    %ebx,%edx
+ 88c:	73 e2                	jae    870 <printint+0x30>
+  if(neg)
+ 88e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 891:	85 c0                	test   %eax,%eax
+ 893:	74 07                	je     89c <printint+0x5c>
+    buf[i++] = '-';
+ 895:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 89a:	89 f7                	mov    %esi,%edi
+ 89c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 89f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8a2:	01 df                	add    %ebx,%edi
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8ab:	83 ec 04             	sub    $0x4,%esp
+ 8ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8b4:	6a 01                	push   $0x1
+ 8b6:	50                   	push   %eax
+ 8b7:	56                   	push   %esi
+ 8b8:	e8 a6 fd ff ff       	call   663 <write>
+  while(--i >= 0)
+ 8bd:	89 f8                	mov    %edi,%eax
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	83 ef 01             	sub    $0x1,%edi
+ 8c5:	39 d8                	cmp    %ebx,%eax
+ 8c7:	75 df                	jne    8a8 <printint+0x68>
+}
+ 8c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8cc:	5b                   	pop    %ebx
+ 8cd:	5e                   	pop    %esi
+ 8ce:	5f                   	pop    %edi
+ 8cf:	5d                   	pop    %ebp
+ 8d0:	c3                   	ret
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8d8:	31 c0                	xor    %eax,%eax
+ 8da:	eb 89                	jmp    865 <printint+0x25>
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 8f2:	83 c6 01             	add    $0x1,%esi
+ 8f5:	84 db                	test   %bl,%bl
+ 8f7:	74 67                	je     960 <printf+0x80>
+ 8f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8fc:	31 d2                	xor    %edx,%edx
+ 8fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 901:	eb 34                	jmp    937 <printf+0x57>
+ 903:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 907:	90                   	nop
+ 908:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 90b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 910:	83 f8 25             	cmp    $0x25,%eax
+ 913:	74 18                	je     92d <printf+0x4d>
+  write(fd, &c, 1);
+ 915:	83 ec 04             	sub    $0x4,%esp
+ 918:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 91b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 91e:	6a 01                	push   $0x1
+ 920:	50                   	push   %eax
+ 921:	57                   	push   %edi
+ 922:	e8 3c fd ff ff       	call   663 <write>
+ 927:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 92a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 92d:	0f b6 1e             	movzbl (%esi),%ebx
+ 930:	83 c6 01             	add    $0x1,%esi
+ 933:	84 db                	test   %bl,%bl
+ 935:	74 29                	je     960 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 937:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 93a:	85 d2                	test   %edx,%edx
+ 93c:	74 ca                	je     908 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 93e:	83 fa 25             	cmp    $0x25,%edx
+ 941:	75 ea                	jne    92d <printf+0x4d>
+      if(c == 'd'){
+ 943:	83 f8 25             	cmp    $0x25,%eax
+ 946:	0f 84 24 01 00 00    	je     a70 <printf+0x190>
+ 94c:	83 e8 63             	sub    $0x63,%eax
+ 94f:	83 f8 15             	cmp    $0x15,%eax
+ 952:	77 1c                	ja     970 <printf+0x90>
+ 954:	ff 24 85 14 0f 00 00 	jmp    *0xf14(,%eax,4)
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 963:	5b                   	pop    %ebx
+ 964:	5e                   	pop    %esi
+ 965:	5f                   	pop    %edi
+ 966:	5d                   	pop    %ebp
+ 967:	c3                   	ret
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 976:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 97a:	6a 01                	push   $0x1
+ 97c:	52                   	push   %edx
+ 97d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 980:	57                   	push   %edi
+ 981:	e8 dd fc ff ff       	call   663 <write>
+ 986:	83 c4 0c             	add    $0xc,%esp
+ 989:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 98c:	6a 01                	push   $0x1
+ 98e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 991:	52                   	push   %edx
+ 992:	57                   	push   %edi
+ 993:	e8 cb fc ff ff       	call   663 <write>
+        putc(fd, c);
+ 998:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99b:	31 d2                	xor    %edx,%edx
+ 99d:	eb 8e                	jmp    92d <printf+0x4d>
+ 99f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9ab:	8b 13                	mov    (%ebx),%edx
+ 9ad:	6a 00                	push   $0x0
+ 9af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9b4:	e8 87 fe ff ff       	call   840 <printint>
+        ap++;
+ 9b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9bf:	31 d2                	xor    %edx,%edx
+ 9c1:	e9 67 ff ff ff       	jmp    92d <printf+0x4d>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9d5:	83 c0 04             	add    $0x4,%eax
+ 9d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9db:	85 db                	test   %ebx,%ebx
+ 9dd:	0f 84 9d 00 00 00    	je     a80 <printf+0x1a0>
+        while(*s != 0){
+ 9e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	0f 84 3d ff ff ff    	je     92d <printf+0x4d>
+ 9f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9f6:	89 de                	mov    %ebx,%esi
+ 9f8:	89 d3                	mov    %edx,%ebx
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a09:	6a 01                	push   $0x1
+ a0b:	53                   	push   %ebx
+ a0c:	57                   	push   %edi
+ a0d:	e8 51 fc ff ff       	call   663 <write>
+        while(*s != 0){
+ a12:	0f b6 06             	movzbl (%esi),%eax
+ a15:	83 c4 10             	add    $0x10,%esp
+ a18:	84 c0                	test   %al,%al
+ a1a:	75 e4                	jne    a00 <printf+0x120>
+      state = 0;
+ a1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a1f:	31 d2                	xor    %edx,%edx
+ a21:	e9 07 ff ff ff       	jmp    92d <printf+0x4d>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 01                	push   $0x1
+ a3f:	e9 6b ff ff ff       	jmp    9af <printf+0xcf>
+ a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a4b:	83 ec 04             	sub    $0x4,%esp
+ a4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a59:	6a 01                	push   $0x1
+ a5b:	52                   	push   %edx
+ a5c:	57                   	push   %edi
+ a5d:	e8 01 fc ff ff       	call   663 <write>
+        ap++;
+ a62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a68:	31 d2                	xor    %edx,%edx
+ a6a:	e9 be fe ff ff       	jmp    92d <printf+0x4d>
+ a6f:	90                   	nop
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a79:	6a 01                	push   $0x1
+ a7b:	e9 11 ff ff ff       	jmp    991 <printf+0xb1>
+ a80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a85:	bb 0b 0f 00 00       	mov    $0xf0b,%ebx
+ a8a:	e9 61 ff ff ff       	jmp    9f0 <printf+0x110>
+ a8f:	90                   	nop
+
+00000a90 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a93:	a1 b4 15 00 00       	mov    0x15b4,%eax
+{
+ a98:	89 e5                	mov    %esp,%ebp
+ a9a:	56                   	push   %esi
+ a9b:	53                   	push   %ebx
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa4:	39 ca                	cmp    %ecx,%edx
+ aa6:	73 30                	jae    ad8 <bigfree+0x48>
+ aa8:	39 c1                	cmp    %eax,%ecx
+ aaa:	72 04                	jb     ab0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aac:	39 c2                	cmp    %eax,%edx
+ aae:	72 f0                	jb     aa0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ab0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ ab3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ ab6:	39 f0                	cmp    %esi,%eax
+ ab8:	74 26                	je     ae0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ abc:	8b 42 04             	mov    0x4(%edx),%eax
+ abf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ ac2:	39 d9                	cmp    %ebx,%ecx
+ ac4:	74 30                	je     af6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ ac6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ac8:	5b                   	pop    %ebx
+  freep = p;
+ ac9:	89 15 b4 15 00 00    	mov    %edx,0x15b4
+}
+ acf:	5e                   	pop    %esi
+ ad0:	5d                   	pop    %ebp
+ ad1:	c3                   	ret
+ ad2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad8:	39 c1                	cmp    %eax,%ecx
+ ada:	72 d0                	jb     aac <bigfree+0x1c>
+ adc:	eb c2                	jmp    aa0 <bigfree+0x10>
+ ade:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ ae0:	03 58 04             	add    0x4(%eax),%ebx
+ ae3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae6:	8b 02                	mov    (%edx),%eax
+ ae8:	8b 00                	mov    (%eax),%eax
+ aea:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ aec:	8b 42 04             	mov    0x4(%edx),%eax
+ aef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ af2:	39 d9                	cmp    %ebx,%ecx
+ af4:	75 d0                	jne    ac6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ af6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ af9:	89 15 b4 15 00 00    	mov    %edx,0x15b4
+    p->s.size += bp->s.size;
+ aff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b02:	8b 09                	mov    (%ecx),%ecx
+ b04:	89 0a                	mov    %ecx,(%edx)
+}
+ b06:	5b                   	pop    %ebx
+ b07:	5e                   	pop    %esi
+ b08:	5d                   	pop    %ebp
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b10 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	89 c7                	mov    %eax,%edi
+ b16:	56                   	push   %esi
+ b17:	53                   	push   %ebx
+ b18:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ b1b:	a1 b4 15 00 00       	mov    0x15b4,%eax
+ b20:	85 c0                	test   %eax,%eax
+ b22:	0f 84 88 00 00 00    	je     bb0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b2d:	39 f9                	cmp    %edi,%ecx
+ b2f:	73 5f                	jae    b90 <bigalloc+0x80>
+  if(nu < 4096)
+ b31:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b36:	39 df                	cmp    %ebx,%edi
+ b38:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b3b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b42:	eb 0d                	jmp    b51 <bigalloc+0x41>
+ b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b48:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b4a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b4d:	39 f9                	cmp    %edi,%ecx
+ b4f:	73 3f                	jae    b90 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b51:	89 d0                	mov    %edx,%eax
+ b53:	39 15 b4 15 00 00    	cmp    %edx,0x15b4
+ b59:	75 ed                	jne    b48 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b5b:	83 ec 0c             	sub    $0xc,%esp
+ b5e:	56                   	push   %esi
+ b5f:	e8 67 fb ff ff       	call   6cb <sbrk>
+  if(p == (char*)-1)
+ b64:	83 c4 10             	add    $0x10,%esp
+ b67:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b6a:	74 11                	je     b7d <bigalloc+0x6d>
+  hp->s.size = nu;
+ b6c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ b6f:	e8 1c ff ff ff       	call   a90 <bigfree>
+  return freep;
+ b74:	a1 b4 15 00 00       	mov    0x15b4,%eax
+      if((p = morecore(nunits)) == 0)
+ b79:	85 c0                	test   %eax,%eax
+ b7b:	75 cb                	jne    b48 <bigalloc+0x38>
+        return 0;
+  }
+}
+ b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b80:	31 d2                	xor    %edx,%edx
+}
+ b82:	5b                   	pop    %ebx
+ b83:	89 d0                	mov    %edx,%eax
+ b85:	5e                   	pop    %esi
+ b86:	5f                   	pop    %edi
+ b87:	5d                   	pop    %ebp
+ b88:	c3                   	ret
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b90:	39 cf                	cmp    %ecx,%edi
+ b92:	74 4c                	je     be0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ b94:	29 f9                	sub    %edi,%ecx
+ b96:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b99:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b9c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b9f:	a3 b4 15 00 00       	mov    %eax,0x15b4
+}
+ ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba7:	89 d0                	mov    %edx,%eax
+ ba9:	5b                   	pop    %ebx
+ baa:	5e                   	pop    %esi
+ bab:	5f                   	pop    %edi
+ bac:	5d                   	pop    %ebp
+ bad:	c3                   	ret
+ bae:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ bb0:	c7 05 b4 15 00 00 b8 	movl   $0x15b8,0x15b4
+ bb7:	15 00 00 
+    base.s.size = 0;
+ bba:	ba b8 15 00 00       	mov    $0x15b8,%edx
+    base.s.ptr = freep = prevp = &base;
+ bbf:	c7 05 b8 15 00 00 b8 	movl   $0x15b8,0x15b8
+ bc6:	15 00 00 
+    base.s.size = 0;
+ bc9:	c7 05 bc 15 00 00 00 	movl   $0x0,0x15bc
+ bd0:	00 00 00 
+    if(p->s.size >= nunits){
+ bd3:	e9 59 ff ff ff       	jmp    b31 <bigalloc+0x21>
+ bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ be0:	8b 0a                	mov    (%edx),%ecx
+ be2:	89 08                	mov    %ecx,(%eax)
+ be4:	eb b9                	jmp    b9f <bigalloc+0x8f>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bf0 <free>:
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	53                   	push   %ebx
+ bf4:	83 ec 04             	sub    $0x4,%esp
+ bf7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ bfa:	85 c9                	test   %ecx,%ecx
+ bfc:	74 58                	je     c56 <free+0x66>
+  bp = (Header*)ap - 1;
+ bfe:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c01:	ba 01 00 00 00       	mov    $0x1,%edx
+ c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+ c10:	89 d0                	mov    %edx,%eax
+ c12:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+  while(xchg(&locked, 1) != 0)
+ c19:	85 c0                	test   %eax,%eax
+ c1b:	75 f3                	jne    c10 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ c1d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ c20:	83 fa 40             	cmp    $0x40,%edx
+ c23:	77 3b                	ja     c60 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ c25:	83 fa 02             	cmp    $0x2,%edx
+ c28:	76 3f                	jbe    c69 <free+0x79>
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c30:	83 c0 01             	add    $0x1,%eax
+ c33:	39 14 85 80 0f 00 00 	cmp    %edx,0xf80(,%eax,4)
+ c3a:	72 f4                	jb     c30 <free+0x40>
+    bp->s.ptr = classfree[c];
+ c3c:	8b 14 85 80 15 00 00 	mov    0x1580(,%eax,4),%edx
+    classfree[c] = bp;
+ c43:	89 1c 85 80 15 00 00 	mov    %ebx,0x1580(,%eax,4)
+    bp->s.ptr = classfree[c];
+ c4a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ c4d:	31 c0                	xor    %eax,%eax
+ c4f:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+}
+ c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c59:	c9                   	leave
+ c5a:	c3                   	ret
+ c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+    bigfree(bp);
+ c60:	89 d8                	mov    %ebx,%eax
+ c62:	e8 29 fe ff ff       	call   a90 <bigfree>
+ c67:	eb e4                	jmp    c4d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ c69:	31 c0                	xor    %eax,%eax
+ c6b:	eb cf                	jmp    c3c <free+0x4c>
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c70 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c70:	55                   	push   %ebp
+ c71:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c76:	89 e5                	mov    %esp,%ebp
+ c78:	57                   	push   %edi
+ c79:	56                   	push   %esi
+ c7a:	53                   	push   %ebx
+ c7b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c81:	8d 50 07             	lea    0x7(%eax),%edx
+ c84:	c1 ea 03             	shr    $0x3,%edx
+ c87:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c90:	89 c8                	mov    %ecx,%eax
+ c92:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+ c99:	85 c0                	test   %eax,%eax
+ c9b:	75 f3                	jne    c90 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ c9d:	89 c3                	mov    %eax,%ebx
+ c9f:	83 fa 40             	cmp    $0x40,%edx
+ ca2:	77 4c                	ja     cf0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ ca4:	be 02 00 00 00       	mov    $0x2,%esi
+ ca9:	83 fa 02             	cmp    $0x2,%edx
+ cac:	76 10                	jbe    cbe <malloc+0x4e>
+ cae:	66 90                	xchg   %ax,%ax
+ cb0:	83 c3 01             	add    $0x1,%ebx
+ cb3:	8b 34 9d 80 0f 00 00 	mov    0xf80(,%ebx,4),%esi
+ cba:	39 d6                	cmp    %edx,%esi
+ cbc:	72 f2                	jb     cb0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ cbe:	8b 14 9d 80 15 00 00 	mov    0x1580(,%ebx,4),%edx
+ cc5:	85 d2                	test   %edx,%edx
+ cc7:	74 47                	je     d10 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ cc9:	8b 3a                	mov    (%edx),%edi
+ ccb:	89 3c 9d 80 15 00 00 	mov    %edi,0x1580(,%ebx,4)
+ cd2:	31 c0                	xor    %eax,%eax
+ cd4:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ cdb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ cde:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ ce1:	5b                   	pop    %ebx
+ ce2:	5e                   	pop    %esi
+ ce3:	5f                   	pop    %edi
+ ce4:	5d                   	pop    %ebp
+ ce5:	c3                   	ret
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ cf0:	89 d0                	mov    %edx,%eax
+ cf2:	e8 19 fe ff ff       	call   b10 <bigalloc>
+ cf7:	89 c2                	mov    %eax,%edx
+ cf9:	89 d8                	mov    %ebx,%eax
+ cfb:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+  return p ? (void*)(p + 1) : 0;
+ d02:	85 d2                	test   %edx,%edx
+ d04:	75 d5                	jne    cdb <malloc+0x6b>
+ d06:	31 c0                	xor    %eax,%eax
+}
+ d08:	83 c4 1c             	add    $0x1c,%esp
+ d0b:	5b                   	pop    %ebx
+ d0c:	5e                   	pop    %esi
+ d0d:	5f                   	pop    %edi
+ d0e:	5d                   	pop    %ebp
+ d0f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ d10:	b8 00 02 00 00       	mov    $0x200,%eax
+ d15:	e8 f6 fd ff ff       	call   b10 <bigalloc>
+ d1a:	85 c0                	test   %eax,%eax
+ d1c:	74 44                	je     d62 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d1e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ d25:	8b 14 9d 80 15 00 00 	mov    0x1580(,%ebx,4),%edx
+ d2c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ d2f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ d32:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ d38:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ d3b:	39 cf                	cmp    %ecx,%edi
+ d3d:	72 8a                	jb     cc9 <malloc+0x59>
+ d3f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ d42:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ d45:	8d 76 00             	lea    0x0(%esi),%esi
+ d48:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ d4a:	89 70 04             	mov    %esi,0x4(%eax)
+ d4d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d4f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ d51:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d53:	01 d8                	add    %ebx,%eax
+ d55:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ d58:	73 ee                	jae    d48 <malloc+0xd8>
+ d5a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ d5d:	e9 69 ff ff ff       	jmp    ccb <malloc+0x5b>
+ d62:	f0 87 05 60 15 00 00 	lock xchg %eax,0x1560
+  return p ? (void*)(p + 1) : 0;
+ d69:	31 c0                	xor    %eax,%eax
+ d6b:	eb 9b                	jmp    d08 <malloc+0x98>
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	56                   	push   %esi
+ d74:	53                   	push   %ebx
+ d75:	8b 45 08             	mov    0x8(%ebp),%eax
+ d78:	f7 65 0c             	mull   0xc(%ebp)
+ d7b:	70 33                	jo     db0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ d7d:	83 ec 0c             	sub    $0xc,%esp
+ d80:	89 c3                	mov    %eax,%ebx
+ d82:	50                   	push   %eax
+ d83:	e8 e8 fe ff ff       	call   c70 <malloc>
+ d88:	83 c4 10             	add    $0x10,%esp
+ d8b:	89 c6                	mov    %eax,%esi
+ d8d:	85 c0                	test   %eax,%eax
+ d8f:	74 1f                	je     db0 <calloc+0x40>
+    memset(p, 0, n);
+ d91:	83 ec 04             	sub    $0x4,%esp
+ d94:	53                   	push   %ebx
+ d95:	6a 00                	push   $0x0
+ d97:	50                   	push   %eax
+ d98:	e8 23 f7 ff ff       	call   4c0 <memset>
+ d9d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ da3:	89 f0                	mov    %esi,%eax
+ da5:	5b                   	pop    %ebx
+ da6:	5e                   	pop    %esi
+ da7:	5d                   	pop    %ebp
+ da8:	c3                   	ret
+ da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ db0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ db3:	31 f6                	xor    %esi,%esi
+}
+ db5:	89 f0                	mov    %esi,%eax
+ db7:	5b                   	pop    %ebx
+ db8:	5e                   	pop    %esi
+ db9:	5d                   	pop    %ebp
+ dba:	c3                   	ret
+ dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dbf:	90                   	nop
+
+00000dc0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	57                   	push   %edi
+ dc4:	56                   	push   %esi
+ dc5:	53                   	push   %ebx
+ dc6:	83 ec 0c             	sub    $0xc,%esp
+ dc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ dcc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ dcf:	85 db                	test   %ebx,%ebx
+ dd1:	74 55                	je     e28 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ dd3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ dd6:	89 de                	mov    %ebx,%esi
+ dd8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ ddf:	39 c7                	cmp    %eax,%edi
+ de1:	72 0d                	jb     df0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ de6:	89 f0                	mov    %esi,%eax
+ de8:	5b                   	pop    %ebx
+ de9:	5e                   	pop    %esi
+ dea:	5f                   	pop    %edi
+ deb:	5d                   	pop    %ebp
+ dec:	c3                   	ret
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	50                   	push   %eax
+ df4:	e8 77 fe ff ff       	call   c70 <malloc>
+ df9:	83 c4 10             	add    $0x10,%esp
+ dfc:	89 c6                	mov    %eax,%esi
+ dfe:	85 c0                	test   %eax,%eax
+ e00:	74 e1                	je     de3 <realloc+0x23>
+  memmove(p, ap, have);
+ e02:	83 ec 04             	sub    $0x4,%esp
+ e05:	57                   	push   %edi
+ e06:	53                   	push   %ebx
+ e07:	50                   	push   %eax
+ e08:	e8 03 f8 ff ff       	call   610 <memmove>
+  free(ap);
+ e0d:	89 1c 24             	mov    %ebx,(%esp)
+ e10:	e8 db fd ff ff       	call   bf0 <free>
+  return p;
+ e15:	83 c4 10             	add    $0x10,%esp
+}
+ e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e1b:	89 f0                	mov    %esi,%eax
+ e1d:	5b                   	pop    %ebx
+ e1e:	5e                   	pop    %esi
+ e1f:	5f                   	pop    %edi
+ e20:	5d                   	pop    %ebp
+ e21:	c3                   	ret
+ e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ e28:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e2e:	5b                   	pop    %ebx
+ e2f:	5e                   	pop    %esi
+ e30:	5f                   	pop    %edi
+ e31:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ e32:	e9 39 fe ff ff       	jmp    c70 <malloc>
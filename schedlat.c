@@ -0,0 +1,103 @@
+// Report scheduling latency: how long processes wait between
+// becoming RUNNABLE and being picked to run.
+// usage: schedlat [-h] [-p pid | command args...]
+// With -p, report process pid. With a command, reset the counts,
+// run the command, and report the waits of every process while it
+// ran, under the policy in force (see setsched). Otherwise report
+// each policy's waits since boot. -h adds a log2 histogram of the
+// waits in cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "waitstat.h"
+
+char *policyname[NSCHEDPOLICY] = { "RR", "PBS", "MLFQ" };
+
+struct waitstat st[NSCHEDPOLICY];
+
+// Return the upper bound in cycles of the bucket holding
+// the q-th percentile wait.
+uint
+percentile(struct waitstat *s, int q)
+{
+  uint n, want;
+  int b;
+
+  want = (s->nwait * q + 99) / 100;
+  n = 0;
+  for(b = 0; b < NWAITHIST; b++){
+    n += s->hist[b];
+    if(n >= want)
+      break;
+  }
+  if(b >= 31)
+    return 0xffffffff;
+  return (2 << b) - 1;
+}
+
+void
+report(char *name, struct waitstat *s, int hist)
+{
+  uint avg;
+  int b;
+
+  if(s->nwait == 0){
+    printf(1, "%s\t0\n", name);
+    return;
+  }
+  // cycles is in units of 1024.
+  avg = s->cycles / s->nwait * 1024 +
+        s->cycles % s->nwait * 1024 / s->nwait;
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\n", name, s->nwait, avg,
+         percentile(s, 50), percentile(s, 99), s->maxwait);
+  if(hist)
+    for(b = 0; b < NWAITHIST; b++)
+      if(s->hist[b])
+        printf(1, "\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, hist, pid;
+
+  hist = 0;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-h") == 0){
+    hist = 1;
+    i++;
+  }
+
+  printf(1, "\twaits\tavg(c)\tp50(c)\tp99(c)\tmax(c)\n");
+  if(i + 1 < argc && strcmp(argv[i], "-p") == 0){
+    if(getwaitstat(atoi(argv[i+1]), &st[0]) < 0){
+      printf(2, "schedlat: no process %s\n", argv[i+1]);
+      exit();
+    }
+    report(argv[i+1], &st[0], hist);
+    exit();
+  }
+
+  if(i < argc){
+    getschedwait(st, NSCHEDPOLICY, 1);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "schedlat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[i], argv+i);
+      printf(2, "schedlat: exec %s failed\n", argv[i]);
+      exit();
+    }
+    wait();
+  }
+  if((n = getschedwait(st, NSCHEDPOLICY, 0)) < 0){
+    printf(2, "schedlat: getschedwait failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    report(policyname[i], &st[i], hist);
+  exit();
+}
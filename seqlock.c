@@ -0,0 +1,67 @@
+// Sequence locks.
+//
+// A seqlock protects a small snapshot that is read often, such
+// as a few counters, without making readers write anything.
+// Writers serialize on a spinlock and bump seq before and after
+// each update, so seq is odd while an update is in progress.
+// A reader never blocks a writer: it notes seq, copies the
+// data, and copies again if seq has changed meanwhile.
+//
+//   do {
+//     seq = seqbegin(&sl);
+//     ... copy the protected data into locals ...
+//   } while(seqretry(&sl, seq));
+//
+// Readers must only copy, since what they read may be torn
+// until seqretry says otherwise.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "seqlock.h"
+
+void
+initseqlock(struct seqlock *sl, char *name)
+{
+  initlock(&sl->lk, name);
+  sl->seq = 0;
+}
+
+void
+acquireseq(struct seqlock *sl)
+{
+  acquire(&sl->lk);
+  sl->seq++;
+  __sync_synchronize();
+}
+
+void
+releaseseq(struct seqlock *sl)
+{
+  __sync_synchronize();
+  sl->seq++;
+  release(&sl->lk);
+}
+
+// Wait for any update in progress to finish, and return
+// the sequence number to pass to seqretry.
+uint
+seqbegin(struct seqlock *sl)
+{
+  uint seq;
+
+  while((seq = *(volatile uint*)&sl->seq) & 1)
+    pause();
+  __sync_synchronize();
+  return seq;
+}
+
+// Did a writer change the data since seqbegin returned seq?
+int
+seqretry(struct seqlock *sl, uint seq)
+{
+  __sync_synchronize();
+  return *(volatile uint*)&sl->seq != seq;
+}
@@ -0,0 +1,5 @@
+// Sequence locks
+struct seqlock {
+  uint seq;             // Odd while a writer is updating
+  struct spinlock lk;   // spinlock serializing writers
+};
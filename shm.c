@@ -0,0 +1,124 @@
+// Shared memory segments.
+//
+// A segment is a set of zeroed pages named by a positive key.
+// shmat() in vm.c maps all of a segment's pages into a region of
+// the caller's address space, so any number of processes can
+// share them; fork() shares the region with the child, and
+// exit(), exec() and shmdt() take it away. Each mapping holds a
+// reference, and the pages are freed when the last one goes.
+//
+// Interface:
+// * To find or create a segment and take a reference, call shmget.
+// * To take another reference, for fork, call shmdup.
+// * When a mapping goes away, call shmput.
+// * shmpage returns the kernel address of one of its pages.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+struct shmseg {
+  int key;              // 0 if this segment is free
+  uint npages;
+  uint ref;             // mappings of it
+  char *pages[SHMMAXPAGES];
+};
+
+struct {
+  struct spinlock lock;
+  struct shmseg seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Free the pages of s and the segment itself.
+// Caller must hold shmtab.lock.
+static void
+shmfree(struct shmseg *s)
+{
+  uint i;
+
+  for(i = 0; i < s->npages; i++)
+    kfree(s->pages[i]);
+  s->npages = 0;
+  s->key = 0;
+}
+
+// Return the segment named key, with a new reference, creating
+// it with npages zeroed pages if there is none. Returns 0 if an
+// existing segment is smaller than npages, or there is no free
+// segment or no memory.
+struct shmseg*
+shmget(int key, uint npages)
+{
+  struct shmseg *s, *free;
+
+  if(key <= 0 || npages == 0 || npages > SHMMAXPAGES)
+    return 0;
+  acquire(&shmtab.lock);
+  free = 0;
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+    if(s->key == key){
+      if(npages > s->npages){
+        release(&shmtab.lock);
+        return 0;
+      }
+      s->ref++;
+      release(&shmtab.lock);
+      return s;
+    }
+    if(s->key == 0 && free == 0)
+      free = s;
+  }
+  if((s = free) == 0){
+    release(&shmtab.lock);
+    return 0;
+  }
+  s->key = key;
+  for(s->npages = 0; s->npages < npages; s->npages++){
+    if((s->pages[s->npages] = kalloc()) == 0){
+      shmfree(s);
+      release(&shmtab.lock);
+      return 0;
+    }
+    memset(s->pages[s->npages], 0, PGSIZE);
+  }
+  s->ref = 1;
+  release(&shmtab.lock);
+  return s;
+}
+
+// Take another reference to s.
+void
+shmdup(struct shmseg *s)
+{
+  acquire(&shmtab.lock);
+  s->ref++;
+  release(&shmtab.lock);
+}
+
+// Drop a reference to s, freeing it if that was the last.
+void
+shmput(struct shmseg *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmput");
+  if(--s->ref == 0)
+    shmfree(s);
+  release(&shmtab.lock);
+}
+
+// Return the kernel address of page i of s, or 0 past its end.
+// The caller holds a reference, so the pages cannot go away.
+char*
+shmpage(struct shmseg *s, uint i)
+{
+  return i < s->npages ? s->pages[i] : 0;
+}
@@ -0,0 +1,2466 @@
+
+_shmbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return t;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 00 04 00 00       	mov    $0x400,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+  uint kb, total, sum, want, i;
+  uint64 cycles;
+
+  kb = argc > 1 ? atoi(argv[1]) : 1024;
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  kb = argc > 1 ? atoi(argv[1]) : 1024;
+      1f:	7e 18                	jle    39 <main+0x39>
+      21:	83 ec 0c             	sub    $0xc,%esp
+      24:	ff 70 04             	push   0x4(%eax)
+      27:	be 01 00 00 00       	mov    $0x1,%esi
+      2c:	e8 8f 08 00 00       	call   8c0 <atoi>
+  if(kb == 0)
+      31:	85 c0                	test   %eax,%eax
+      33:	0f 45 f0             	cmovne %eax,%esi
+      36:	83 c4 10             	add    $0x10,%esp
+    kb = 1;
+  total = kb * 1024;
+      39:	89 f3                	mov    %esi,%ebx
+      3b:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < CHUNK; i++)
+      3d:	31 c0                	xor    %eax,%eax
+  total = kb * 1024;
+      3f:	c1 e3 0a             	shl    $0xa,%ebx
+  for(i = 0; i < CHUNK; i++)
+      42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    src[i] = i * 7 + (i >> 8);
+      48:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < CHUNK; i++)
+      4a:	83 c0 01             	add    $0x1,%eax
+    src[i] = i * 7 + (i >> 8);
+      4d:	c1 ea 08             	shr    $0x8,%edx
+      50:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < CHUNK; i++)
+      52:	83 c1 07             	add    $0x7,%ecx
+    src[i] = i * 7 + (i >> 8);
+      55:	88 90 5f 27 00 00    	mov    %dl,0x275f(%eax)
+  for(i = 0; i < CHUNK; i++)
+      5b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      60:	75 e6                	jne    48 <main+0x48>
+  want = expected(total);
+      62:	83 ec 0c             	sub    $0xc,%esp
+      65:	53                   	push   %ebx
+      66:	e8 95 00 00 00       	call   100 <expected>
+      6b:	5a                   	pop    %edx
+      6c:	59                   	pop    %ecx
+
+  cycles = pipebench(total, &sum);
+      6d:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+      70:	51                   	push   %ecx
+  want = expected(total);
+      71:	89 c7                	mov    %eax,%edi
+  cycles = pipebench(total, &sum);
+      73:	53                   	push   %ebx
+      74:	e8 57 01 00 00       	call   1d0 <pipebench>
+  report("pipe", cycles, kb, sum, want);
+      79:	83 c4 08             	add    $0x8,%esp
+      7c:	57                   	push   %edi
+      7d:	ff 75 e4             	push   -0x1c(%ebp)
+      80:	56                   	push   %esi
+      81:	52                   	push   %edx
+      82:	50                   	push   %eax
+      83:	68 92 11 00 00       	push   $0x1192
+      88:	e8 e3 00 00 00       	call   170 <report>
+  cycles = shmbench(total, &sum);
+      8d:	83 c4 18             	add    $0x18,%esp
+      90:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+      93:	51                   	push   %ecx
+      94:	53                   	push   %ebx
+      95:	e8 86 05 00 00       	call   620 <shmbench>
+  report("shm", cycles, kb, sum, want);
+      9a:	59                   	pop    %ecx
+      9b:	5b                   	pop    %ebx
+      9c:	57                   	push   %edi
+      9d:	ff 75 e4             	push   -0x1c(%ebp)
+      a0:	56                   	push   %esi
+      a1:	52                   	push   %edx
+      a2:	50                   	push   %eax
+      a3:	68 97 11 00 00       	push   $0x1197
+      a8:	e8 c3 00 00 00       	call   170 <report>
+  exit();
+      ad:	83 c4 20             	add    $0x20,%esp
+      b0:	e8 7e 08 00 00       	call   933 <exit>
+      b5:	66 90                	xchg   %ax,%ax
+      b7:	66 90                	xchg   %ax,%ax
+      b9:	66 90                	xchg   %ax,%ax
+      bb:	66 90                	xchg   %ax,%ax
+      bd:	66 90                	xchg   %ax,%ax
+      bf:	90                   	nop
+
+000000c0 <checksum>:
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	53                   	push   %ebx
+      c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+      c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(n-- > 0)
+      ca:	85 db                	test   %ebx,%ebx
+      cc:	7e 2a                	jle    f8 <checksum+0x38>
+      ce:	8b 45 08             	mov    0x8(%ebp),%eax
+      d1:	01 d3                	add    %edx,%ebx
+      d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      d7:	90                   	nop
+    sum = sum * 31 + (uchar)*p++;
+      d8:	89 c1                	mov    %eax,%ecx
+      da:	83 c2 01             	add    $0x1,%edx
+      dd:	c1 e1 05             	shl    $0x5,%ecx
+      e0:	29 c1                	sub    %eax,%ecx
+      e2:	0f b6 42 ff          	movzbl -0x1(%edx),%eax
+      e6:	01 c8                	add    %ecx,%eax
+  while(n-- > 0)
+      e8:	39 da                	cmp    %ebx,%edx
+      ea:	75 ec                	jne    d8 <checksum+0x18>
+}
+      ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+      f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(n-- > 0)
+      f8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+      fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      fe:	c9                   	leave
+      ff:	c3                   	ret
+
+00000100 <expected>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; i < total; i += CHUNK)
+     109:	85 ff                	test   %edi,%edi
+     10b:	74 4e                	je     15b <expected+0x5b>
+     10d:	31 f6                	xor    %esi,%esi
+  sum = 0;
+     10f:	31 c0                	xor    %eax,%eax
+     111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sum = checksum(sum, src, min(CHUNK, total - i));
+     118:	89 fb                	mov    %edi,%ebx
+     11a:	ba 00 10 00 00       	mov    $0x1000,%edx
+     11f:	29 f3                	sub    %esi,%ebx
+     121:	39 d3                	cmp    %edx,%ebx
+     123:	0f 47 da             	cmova  %edx,%ebx
+     126:	ba 60 27 00 00       	mov    $0x2760,%edx
+     12b:	81 c3 60 27 00 00    	add    $0x2760,%ebx
+     131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sum = sum * 31 + (uchar)*p++;
+     138:	89 c1                	mov    %eax,%ecx
+     13a:	83 c2 01             	add    $0x1,%edx
+     13d:	c1 e1 05             	shl    $0x5,%ecx
+     140:	29 c1                	sub    %eax,%ecx
+     142:	0f b6 42 ff          	movzbl -0x1(%edx),%eax
+     146:	01 c8                	add    %ecx,%eax
+  while(n-- > 0)
+     148:	39 da                	cmp    %ebx,%edx
+     14a:	75 ec                	jne    138 <expected+0x38>
+  for(i = 0; i < total; i += CHUNK)
+     14c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+     152:	39 fe                	cmp    %edi,%esi
+     154:	72 c2                	jb     118 <expected+0x18>
+}
+     156:	5b                   	pop    %ebx
+     157:	5e                   	pop    %esi
+     158:	5f                   	pop    %edi
+     159:	5d                   	pop    %ebp
+     15a:	c3                   	ret
+     15b:	5b                   	pop    %ebx
+  sum = 0;
+     15c:	31 c0                	xor    %eax,%eax
+}
+     15e:	5e                   	pop    %esi
+     15f:	5f                   	pop    %edi
+     160:	5d                   	pop    %ebp
+     161:	c3                   	ret
+     162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <report>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	56                   	push   %esi
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+     174:	be 40 11 00 00       	mov    $0x1140,%esi
+{
+     179:	53                   	push   %ebx
+  uint k = cycles >> 10;
+     17a:	8b 55 10             	mov    0x10(%ebp),%edx
+     17d:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+     180:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+     183:	c7 45 0c 4a 11 00 00 	movl   $0x114a,0xc(%ebp)
+     18a:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+  uint k = cycles >> 10;
+     18d:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+     191:	39 4d 18             	cmp    %ecx,0x18(%ebp)
+     194:	ba 79 11 00 00       	mov    $0x1179,%edx
+     199:	0f 44 f2             	cmove  %edx,%esi
+     19c:	31 d2                	xor    %edx,%edx
+     19e:	f7 f3                	div    %ebx
+     1a0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+     1a3:	89 c1                	mov    %eax,%ecx
+         k / kb * 1024 + k % kb * 1024 / kb,
+     1a5:	89 d0                	mov    %edx,%eax
+     1a7:	31 d2                	xor    %edx,%edx
+     1a9:	c1 e0 0a             	shl    $0xa,%eax
+     1ac:	c1 e1 0a             	shl    $0xa,%ecx
+     1af:	f7 f3                	div    %ebx
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+     1b1:	01 c8                	add    %ecx,%eax
+     1b3:	89 45 18             	mov    %eax,0x18(%ebp)
+     1b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     1b9:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+     1c0:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+     1c3:	5b                   	pop    %ebx
+     1c4:	5e                   	pop    %esi
+     1c5:	5d                   	pop    %ebp
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+     1c6:	e9 05 0a 00 00       	jmp    bd0 <printf>
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <pipebench>:
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	57                   	push   %edi
+     1d4:	56                   	push   %esi
+  if(pipe(fds) < 0){
+     1d5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     1d8:	53                   	push   %ebx
+     1d9:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(fds) < 0){
+     1dc:	50                   	push   %eax
+     1dd:	e8 61 07 00 00       	call   943 <pipe>
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	85 c0                	test   %eax,%eax
+     1e7:	0f 88 b3 00 00 00    	js     2a0 <pipebench+0xd0>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+     1ed:	0f 31                	rdtsc
+     1ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     1f2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  if(fork() == 0){
+     1f5:	e8 31 07 00 00       	call   92b <fork>
+     1fa:	85 c0                	test   %eax,%eax
+     1fc:	0f 84 b1 00 00 00    	je     2b3 <pipebench+0xe3>
+  close(fds[1]);
+     202:	83 ec 0c             	sub    $0xc,%esp
+     205:	ff 75 e4             	push   -0x1c(%ebp)
+     208:	e8 4e 07 00 00       	call   95b <close>
+  *sum = 0;
+     20d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(got = 0; got < total; got += n){
+     210:	83 c4 10             	add    $0x10,%esp
+  *sum = 0;
+     213:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(got = 0; got < total; got += n){
+     219:	8b 45 08             	mov    0x8(%ebp),%eax
+     21c:	85 c0                	test   %eax,%eax
+     21e:	74 60                	je     280 <pipebench+0xb0>
+     220:	31 f6                	xor    %esi,%esi
+     222:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((n = read(fds[0], dst, CHUNK)) <= 0)
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	68 00 10 00 00       	push   $0x1000
+     230:	68 60 17 00 00       	push   $0x1760
+     235:	ff 75 e0             	push   -0x20(%ebp)
+     238:	e8 0e 07 00 00       	call   94b <read>
+     23d:	83 c4 10             	add    $0x10,%esp
+     240:	89 c7                	mov    %eax,%edi
+     242:	85 c0                	test   %eax,%eax
+     244:	7e 3a                	jle    280 <pipebench+0xb0>
+    *sum = checksum(*sum, dst, n);
+     246:	8b 45 0c             	mov    0xc(%ebp),%eax
+     249:	8d 9f 60 17 00 00    	lea    0x1760(%edi),%ebx
+     24f:	ba 60 17 00 00       	mov    $0x1760,%edx
+     254:	8b 00                	mov    (%eax),%eax
+  while(n-- > 0)
+     256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum = sum * 31 + (uchar)*p++;
+     260:	89 c1                	mov    %eax,%ecx
+     262:	83 c2 01             	add    $0x1,%edx
+     265:	c1 e1 05             	shl    $0x5,%ecx
+     268:	29 c1                	sub    %eax,%ecx
+     26a:	0f b6 42 ff          	movzbl -0x1(%edx),%eax
+     26e:	01 c8                	add    %ecx,%eax
+  while(n-- > 0)
+     270:	39 da                	cmp    %ebx,%edx
+     272:	75 ec                	jne    260 <pipebench+0x90>
+    *sum = checksum(*sum, dst, n);
+     274:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  for(got = 0; got < total; got += n){
+     277:	01 fe                	add    %edi,%esi
+    *sum = checksum(*sum, dst, n);
+     279:	89 03                	mov    %eax,(%ebx)
+  for(got = 0; got < total; got += n){
+     27b:	3b 75 08             	cmp    0x8(%ebp),%esi
+     27e:	72 a8                	jb     228 <pipebench+0x58>
+  close(fds[0]);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	ff 75 e0             	push   -0x20(%ebp)
+     286:	e8 d0 06 00 00       	call   95b <close>
+  wait();
+     28b:	e8 ab 06 00 00       	call   93b <wait>
+     290:	0f 31                	rdtsc
+  return rdtsc() - t;
+     292:	2b 45 d0             	sub    -0x30(%ebp),%eax
+     295:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+}
+     298:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     29b:	5b                   	pop    %ebx
+     29c:	5e                   	pop    %esi
+     29d:	5f                   	pop    %edi
+     29e:	5d                   	pop    %ebp
+     29f:	c3                   	ret
+    printf(2, "shmbench: pipe failed\n");
+     2a0:	52                   	push   %edx
+     2a1:	52                   	push   %edx
+     2a2:	68 63 11 00 00       	push   $0x1163
+     2a7:	6a 02                	push   $0x2
+     2a9:	e8 22 09 00 00       	call   bd0 <printf>
+    exit();
+     2ae:	e8 80 06 00 00       	call   933 <exit>
+    close(fds[0]);
+     2b3:	83 ec 0c             	sub    $0xc,%esp
+     2b6:	ff 75 e0             	push   -0x20(%ebp)
+     2b9:	e8 9d 06 00 00       	call   95b <close>
+    for(got = 0; got < total; got += CHUNK)
+     2be:	83 c4 10             	add    $0x10,%esp
+     2c1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     2c5:	74 30                	je     2f7 <pipebench+0x127>
+     2c7:	31 db                	xor    %ebx,%ebx
+      write(fds[1], src, min(CHUNK, total - got));
+     2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+     2cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+     2d1:	83 ec 04             	sub    $0x4,%esp
+     2d4:	29 d8                	sub    %ebx,%eax
+     2d6:	39 d0                	cmp    %edx,%eax
+     2d8:	0f 47 c2             	cmova  %edx,%eax
+    for(got = 0; got < total; got += CHUNK)
+     2db:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      write(fds[1], src, min(CHUNK, total - got));
+     2e1:	50                   	push   %eax
+     2e2:	68 60 27 00 00       	push   $0x2760
+     2e7:	ff 75 e4             	push   -0x1c(%ebp)
+     2ea:	e8 64 06 00 00       	call   953 <write>
+    for(got = 0; got < total; got += CHUNK)
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	3b 5d 08             	cmp    0x8(%ebp),%ebx
+     2f5:	72 d2                	jb     2c9 <pipebench+0xf9>
+    exit();
+     2f7:	e8 37 06 00 00       	call   933 <exit>
+     2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <produce>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	56                   	push   %esi
+     305:	53                   	push   %ebx
+     306:	83 ec 2c             	sub    $0x2c,%esp
+     309:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(sent = 0; sent < total; sent += n){
+     30c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  h = r->head;
+     30f:	8b 3b                	mov    (%ebx),%edi
+  for(sent = 0; sent < total; sent += n){
+     311:	85 c0                	test   %eax,%eax
+     313:	0f 84 16 01 00 00    	je     42f <produce+0x12f>
+    memmove(r->buf + i, src + sent % CHUNK, n);
+     319:	8d 43 10             	lea    0x10(%ebx),%eax
+  for(sent = 0; sent < total; sent += n){
+     31c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    memmove(r->buf + i, src + sent % CHUNK, n);
+     323:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        futex((uint*)&r->tail, FUTEX_WAIT, h - RINGSZ);
+     326:	8d 43 04             	lea    0x4(%ebx),%eax
+     329:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    while(h - r->tail == RINGSZ){
+     330:	8b 53 04             	mov    0x4(%ebx),%edx
+     333:	89 f8                	mov    %edi,%eax
+        futex((uint*)&r->tail, FUTEX_WAIT, h - RINGSZ);
+     335:	8d b7 00 80 ff ff    	lea    -0x8000(%edi),%esi
+    while(h - r->tail == RINGSZ){
+     33b:	29 d0                	sub    %edx,%eax
+     33d:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     342:	74 21                	je     365 <produce+0x65>
+     344:	eb 52                	jmp    398 <produce+0x98>
+     346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+      r->pwait = 0;
+     350:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    while(h - r->tail == RINGSZ){
+     357:	8b 53 04             	mov    0x4(%ebx),%edx
+     35a:	89 f8                	mov    %edi,%eax
+     35c:	29 d0                	sub    %edx,%eax
+     35e:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     363:	75 33                	jne    398 <produce+0x98>
+      r->pwait = 1;
+     365:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+      if(h - r->tail == RINGSZ)
+     36c:	89 f8                	mov    %edi,%eax
+      __sync_synchronize();
+     36e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+      if(h - r->tail == RINGSZ)
+     373:	8b 53 04             	mov    0x4(%ebx),%edx
+     376:	29 d0                	sub    %edx,%eax
+     378:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     37d:	75 d1                	jne    350 <produce+0x50>
+        futex((uint*)&r->tail, FUTEX_WAIT, h - RINGSZ);
+     37f:	83 ec 04             	sub    $0x4,%esp
+     382:	56                   	push   %esi
+     383:	6a 01                	push   $0x1
+     385:	ff 75 d8             	push   -0x28(%ebp)
+     388:	e8 76 07 00 00       	call   b03 <futex>
+     38d:	83 c4 10             	add    $0x10,%esp
+     390:	eb be                	jmp    350 <produce+0x50>
+     392:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    i = h % RINGSZ;
+     398:	89 f8                	mov    %edi,%eax
+    n = min(RINGSZ - (h - r->tail), RINGSZ - i);
+     39a:	ba 00 80 00 00       	mov    $0x8000,%edx
+    i = h % RINGSZ;
+     39f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+     3a4:	89 c1                	mov    %eax,%ecx
+     3a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    n = min(RINGSZ - (h - r->tail), RINGSZ - i);
+     3a9:	8b 43 04             	mov    0x4(%ebx),%eax
+     3ac:	29 ca                	sub    %ecx,%edx
+     3ae:	05 00 80 00 00       	add    $0x8000,%eax
+     3b3:	29 f8                	sub    %edi,%eax
+     3b5:	39 d0                	cmp    %edx,%eax
+     3b7:	73 0b                	jae    3c4 <produce+0xc4>
+     3b9:	8b 53 04             	mov    0x4(%ebx),%edx
+     3bc:	81 c2 00 80 00 00    	add    $0x8000,%edx
+     3c2:	29 fa                	sub    %edi,%edx
+    n = min(n, CHUNK - sent % CHUNK);
+     3c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     3c7:	b8 00 10 00 00       	mov    $0x1000,%eax
+     3cc:	89 f1                	mov    %esi,%ecx
+     3ce:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+     3d4:	29 c8                	sub    %ecx,%eax
+     3d6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    n = min(n, total - sent);
+     3d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3dc:	29 f0                	sub    %esi,%eax
+     3de:	89 c6                	mov    %eax,%esi
+     3e0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     3e3:	39 f0                	cmp    %esi,%eax
+     3e5:	0f 47 c6             	cmova  %esi,%eax
+     3e8:	89 d6                	mov    %edx,%esi
+     3ea:	39 d0                	cmp    %edx,%eax
+     3ec:	0f 46 f0             	cmovbe %eax,%esi
+    memmove(r->buf + i, src + sent % CHUNK, n);
+     3ef:	83 ec 04             	sub    $0x4,%esp
+     3f2:	81 c1 60 27 00 00    	add    $0x2760,%ecx
+     3f8:	56                   	push   %esi
+    r->head = h += n;
+     3f9:	01 f7                	add    %esi,%edi
+    memmove(r->buf + i, src + sent % CHUNK, n);
+     3fb:	51                   	push   %ecx
+     3fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     3ff:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     402:	01 c8                	add    %ecx,%eax
+     404:	50                   	push   %eax
+     405:	e8 f6 04 00 00       	call   900 <memmove>
+    if(r->cwait)
+     40a:	83 c4 10             	add    $0x10,%esp
+    __sync_synchronize();
+     40d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    r->head = h += n;
+     412:	89 3b                	mov    %edi,(%ebx)
+    __sync_synchronize();
+     414:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(r->cwait)
+     419:	8b 43 08             	mov    0x8(%ebx),%eax
+     41c:	85 c0                	test   %eax,%eax
+     41e:	75 20                	jne    440 <produce+0x140>
+  for(sent = 0; sent < total; sent += n){
+     420:	01 75 e4             	add    %esi,-0x1c(%ebp)
+     423:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     426:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     429:	0f 82 01 ff ff ff    	jb     330 <produce+0x30>
+}
+     42f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     432:	5b                   	pop    %ebx
+     433:	5e                   	pop    %esi
+     434:	5f                   	pop    %edi
+     435:	5d                   	pop    %ebp
+     436:	c3                   	ret
+     437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43e:	66 90                	xchg   %ax,%ax
+      futex((uint*)&r->head, FUTEX_WAKE, 1);
+     440:	83 ec 04             	sub    $0x4,%esp
+     443:	6a 01                	push   $0x1
+     445:	6a 02                	push   $0x2
+     447:	53                   	push   %ebx
+     448:	e8 b6 06 00 00       	call   b03 <futex>
+     44d:	83 c4 10             	add    $0x10,%esp
+     450:	eb ce                	jmp    420 <produce+0x120>
+     452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <consume>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	53                   	push   %ebx
+     466:	83 ec 1c             	sub    $0x1c,%esp
+     469:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(got = 0; got < total; got += n){
+     46c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  t = r->tail;
+     46f:	8b 56 04             	mov    0x4(%esi),%edx
+  for(got = 0; got < total; got += n){
+     472:	85 c0                	test   %eax,%eax
+     474:	0f 84 93 01 00 00    	je     60d <consume+0x1ad>
+    memmove(dst, r->buf + i, n);
+     47a:	8d 46 10             	lea    0x10(%esi),%eax
+  for(got = 0; got < total; got += n){
+     47d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  sum = 0;
+     484:	31 db                	xor    %ebx,%ebx
+     486:	89 d7                	mov    %edx,%edi
+    memmove(dst, r->buf + i, n);
+     488:	89 45 dc             	mov    %eax,-0x24(%ebp)
+      futex((uint*)&r->tail, FUTEX_WAKE, 1);
+     48b:	8d 46 04             	lea    0x4(%esi),%eax
+     48e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while(r->head == t){
+     498:	8b 06                	mov    (%esi),%eax
+     49a:	39 c7                	cmp    %eax,%edi
+     49c:	74 0f                	je     4ad <consume+0x4d>
+     49e:	eb 40                	jmp    4e0 <consume+0x80>
+      r->cwait = 0;
+     4a0:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+    while(r->head == t){
+     4a7:	8b 06                	mov    (%esi),%eax
+     4a9:	39 f8                	cmp    %edi,%eax
+     4ab:	75 33                	jne    4e0 <consume+0x80>
+      r->cwait = 1;
+     4ad:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+      __sync_synchronize();
+     4b4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+      if(r->head == t)
+     4b9:	8b 06                	mov    (%esi),%eax
+     4bb:	39 f8                	cmp    %edi,%eax
+     4bd:	75 e1                	jne    4a0 <consume+0x40>
+        futex((uint*)&r->head, FUTEX_WAIT, t);
+     4bf:	83 ec 04             	sub    $0x4,%esp
+     4c2:	57                   	push   %edi
+     4c3:	6a 01                	push   $0x1
+     4c5:	56                   	push   %esi
+     4c6:	e8 38 06 00 00       	call   b03 <futex>
+      r->cwait = 0;
+     4cb:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+    while(r->head == t){
+     4d2:	8b 06                	mov    (%esi),%eax
+        futex((uint*)&r->head, FUTEX_WAIT, t);
+     4d4:	83 c4 10             	add    $0x10,%esp
+    while(r->head == t){
+     4d7:	39 f8                	cmp    %edi,%eax
+     4d9:	74 d2                	je     4ad <consume+0x4d>
+     4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+    n = min(r->head - t, RINGSZ - i);
+     4e0:	8b 16                	mov    (%esi),%edx
+    i = t % RINGSZ;
+     4e2:	89 f8                	mov    %edi,%eax
+    n = min(r->head - t, RINGSZ - i);
+     4e4:	b9 00 80 00 00       	mov    $0x8000,%ecx
+    i = t % RINGSZ;
+     4e9:	25 ff 7f 00 00       	and    $0x7fff,%eax
+    n = min(r->head - t, RINGSZ - i);
+     4ee:	29 c1                	sub    %eax,%ecx
+     4f0:	29 fa                	sub    %edi,%edx
+     4f2:	39 ca                	cmp    %ecx,%edx
+     4f4:	0f 83 96 00 00 00    	jae    590 <consume+0x130>
+     4fa:	8b 16                	mov    (%esi),%edx
+     4fc:	29 fa                	sub    %edi,%edx
+     4fe:	89 d1                	mov    %edx,%ecx
+    n = min(n, CHUNK);
+     500:	ba 00 10 00 00       	mov    $0x1000,%edx
+     505:	39 d1                	cmp    %edx,%ecx
+     507:	0f 47 ca             	cmova  %edx,%ecx
+    memmove(dst, r->buf + i, n);
+     50a:	83 ec 04             	sub    $0x4,%esp
+     50d:	51                   	push   %ecx
+     50e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     511:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     514:	01 d0                	add    %edx,%eax
+     516:	50                   	push   %eax
+     517:	68 60 17 00 00       	push   $0x1760
+     51c:	e8 df 03 00 00       	call   900 <memmove>
+    if(r->pwait)
+     521:	83 c4 10             	add    $0x10,%esp
+    __sync_synchronize();
+     524:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    r->tail = t += n;
+     529:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     52c:	01 cf                	add    %ecx,%edi
+     52e:	89 7e 04             	mov    %edi,0x4(%esi)
+    __sync_synchronize();
+     531:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(r->pwait)
+     536:	8b 46 0c             	mov    0xc(%esi),%eax
+     539:	85 c0                	test   %eax,%eax
+     53b:	0f 85 af 00 00 00    	jne    5f0 <consume+0x190>
+  while(n-- > 0)
+     541:	85 c9                	test   %ecx,%ecx
+     543:	74 2a                	je     56f <consume+0x10f>
+{
+     545:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     548:	8d 91 60 17 00 00    	lea    0x1760(%ecx),%edx
+     54e:	b8 60 17 00 00       	mov    $0x1760,%eax
+     553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     557:	90                   	nop
+    sum = sum * 31 + (uchar)*p++;
+     558:	89 d9                	mov    %ebx,%ecx
+     55a:	83 c0 01             	add    $0x1,%eax
+     55d:	c1 e1 05             	shl    $0x5,%ecx
+     560:	29 d9                	sub    %ebx,%ecx
+     562:	0f b6 58 ff          	movzbl -0x1(%eax),%ebx
+     566:	01 cb                	add    %ecx,%ebx
+  while(n-- > 0)
+     568:	39 d0                	cmp    %edx,%eax
+     56a:	75 ec                	jne    558 <consume+0xf8>
+     56c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  for(got = 0; got < total; got += n){
+     56f:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+     572:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     575:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     578:	0f 82 1a ff ff ff    	jb     498 <consume+0x38>
+}
+     57e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     581:	89 d8                	mov    %ebx,%eax
+     583:	5b                   	pop    %ebx
+     584:	5e                   	pop    %esi
+     585:	5f                   	pop    %edi
+     586:	5d                   	pop    %ebp
+     587:	c3                   	ret
+     588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+    n = min(n, CHUNK);
+     590:	ba 00 10 00 00       	mov    $0x1000,%edx
+     595:	39 d1                	cmp    %edx,%ecx
+     597:	0f 47 ca             	cmova  %edx,%ecx
+    memmove(dst, r->buf + i, n);
+     59a:	83 ec 04             	sub    $0x4,%esp
+     59d:	51                   	push   %ecx
+     59e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     5a1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     5a4:	01 d0                	add    %edx,%eax
+     5a6:	50                   	push   %eax
+     5a7:	68 60 17 00 00       	push   $0x1760
+     5ac:	e8 4f 03 00 00       	call   900 <memmove>
+    if(r->pwait)
+     5b1:	83 c4 10             	add    $0x10,%esp
+    __sync_synchronize();
+     5b4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    r->tail = t += n;
+     5b9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     5bc:	01 cf                	add    %ecx,%edi
+     5be:	89 7e 04             	mov    %edi,0x4(%esi)
+    __sync_synchronize();
+     5c1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(r->pwait)
+     5c6:	8b 46 0c             	mov    0xc(%esi),%eax
+     5c9:	85 c0                	test   %eax,%eax
+     5cb:	0f 84 74 ff ff ff    	je     545 <consume+0xe5>
+      futex((uint*)&r->tail, FUTEX_WAKE, 1);
+     5d1:	83 ec 04             	sub    $0x4,%esp
+     5d4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     5d7:	6a 01                	push   $0x1
+     5d9:	6a 02                	push   $0x2
+     5db:	ff 75 d8             	push   -0x28(%ebp)
+     5de:	e8 20 05 00 00       	call   b03 <futex>
+  while(n-- > 0)
+     5e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      futex((uint*)&r->tail, FUTEX_WAKE, 1);
+     5e6:	83 c4 10             	add    $0x10,%esp
+     5e9:	e9 57 ff ff ff       	jmp    545 <consume+0xe5>
+     5ee:	66 90                	xchg   %ax,%ax
+     5f0:	83 ec 04             	sub    $0x4,%esp
+     5f3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     5f6:	6a 01                	push   $0x1
+     5f8:	6a 02                	push   $0x2
+     5fa:	ff 75 d8             	push   -0x28(%ebp)
+     5fd:	e8 01 05 00 00       	call   b03 <futex>
+     602:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     605:	83 c4 10             	add    $0x10,%esp
+     608:	e9 34 ff ff ff       	jmp    541 <consume+0xe1>
+}
+     60d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  sum = 0;
+     610:	31 db                	xor    %ebx,%ebx
+}
+     612:	89 d8                	mov    %ebx,%eax
+     614:	5b                   	pop    %ebx
+     615:	5e                   	pop    %esi
+     616:	5f                   	pop    %edi
+     617:	5d                   	pop    %ebp
+     618:	c3                   	ret
+     619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <shmbench>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+     625:	53                   	push   %ebx
+     626:	83 ec 1c             	sub    $0x1c,%esp
+  key = getpid();
+     629:	e8 85 03 00 00       	call   9b3 <getpid>
+  if((r = shmat(key, sizeof(*r))) == (void*)-1){
+     62e:	83 ec 08             	sub    $0x8,%esp
+  key = getpid();
+     631:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((r = shmat(key, sizeof(*r))) == (void*)-1){
+     634:	68 10 80 00 00       	push   $0x8010
+     639:	50                   	push   %eax
+     63a:	e8 cc 04 00 00       	call   b0b <shmat>
+     63f:	83 c4 10             	add    $0x10,%esp
+     642:	83 f8 ff             	cmp    $0xffffffff,%eax
+     645:	0f 84 91 00 00 00    	je     6dc <shmbench+0xbc>
+     64b:	89 c3                	mov    %eax,%ebx
+     64d:	0f 31                	rdtsc
+     64f:	89 c6                	mov    %eax,%esi
+     651:	89 d7                	mov    %edx,%edi
+  if(fork() == 0){
+     653:	e8 d3 02 00 00       	call   92b <fork>
+     658:	85 c0                	test   %eax,%eax
+     65a:	75 34                	jne    690 <shmbench+0x70>
+    shmdt(r);
+     65c:	83 ec 0c             	sub    $0xc,%esp
+     65f:	53                   	push   %ebx
+     660:	e8 ae 04 00 00       	call   b13 <shmdt>
+    if((r = shmat(key, sizeof(*r))) == (void*)-1){
+     665:	58                   	pop    %eax
+     666:	5a                   	pop    %edx
+     667:	68 10 80 00 00       	push   $0x8010
+     66c:	ff 75 e4             	push   -0x1c(%ebp)
+     66f:	e8 97 04 00 00       	call   b0b <shmat>
+     674:	83 c4 10             	add    $0x10,%esp
+     677:	83 f8 ff             	cmp    $0xffffffff,%eax
+     67a:	74 4c                	je     6c8 <shmbench+0xa8>
+    produce(r, total);
+     67c:	83 ec 08             	sub    $0x8,%esp
+     67f:	ff 75 08             	push   0x8(%ebp)
+     682:	50                   	push   %eax
+     683:	e8 78 fc ff ff       	call   300 <produce>
+    exit();
+     688:	e8 a6 02 00 00       	call   933 <exit>
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+  *sum = consume(r, total);
+     690:	83 ec 08             	sub    $0x8,%esp
+     693:	ff 75 08             	push   0x8(%ebp)
+     696:	53                   	push   %ebx
+     697:	e8 c4 fd ff ff       	call   460 <consume>
+     69c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     69f:	89 02                	mov    %eax,(%edx)
+  wait();
+     6a1:	e8 95 02 00 00       	call   93b <wait>
+     6a6:	0f 31                	rdtsc
+  shmdt(r);
+     6a8:	89 1c 24             	mov    %ebx,(%esp)
+  t = rdtsc() - t;
+     6ab:	29 f0                	sub    %esi,%eax
+     6ad:	19 fa                	sbb    %edi,%edx
+     6af:	89 c6                	mov    %eax,%esi
+     6b1:	89 d7                	mov    %edx,%edi
+  shmdt(r);
+     6b3:	e8 5b 04 00 00       	call   b13 <shmdt>
+}
+     6b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6bb:	89 f0                	mov    %esi,%eax
+     6bd:	89 fa                	mov    %edi,%edx
+     6bf:	5b                   	pop    %ebx
+     6c0:	5e                   	pop    %esi
+     6c1:	5f                   	pop    %edi
+     6c2:	5d                   	pop    %ebp
+     6c3:	c3                   	ret
+     6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(2, "shmbench: shmat in child failed\n");
+     6c8:	83 ec 08             	sub    $0x8,%esp
+     6cb:	68 9c 11 00 00       	push   $0x119c
+     6d0:	6a 02                	push   $0x2
+     6d2:	e8 f9 04 00 00       	call   bd0 <printf>
+      exit();
+     6d7:	e8 57 02 00 00       	call   933 <exit>
+    printf(2, "shmbench: shmat failed\n");
+     6dc:	51                   	push   %ecx
+     6dd:	51                   	push   %ecx
+     6de:	68 7a 11 00 00       	push   $0x117a
+     6e3:	6a 02                	push   $0x2
+     6e5:	e8 e6 04 00 00       	call   bd0 <printf>
+    exit();
+     6ea:	e8 44 02 00 00       	call   933 <exit>
+     6ef:	90                   	nop
+
+000006f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     6f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     6f1:	31 c0                	xor    %eax,%eax
+{
+     6f3:	89 e5                	mov    %esp,%ebp
+     6f5:	53                   	push   %ebx
+     6f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     700:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     704:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     707:	83 c0 01             	add    $0x1,%eax
+     70a:	84 d2                	test   %dl,%dl
+     70c:	75 f2                	jne    700 <strcpy+0x10>
+    ;
+  return os;
+}
+     70e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     711:	89 c8                	mov    %ecx,%eax
+     713:	c9                   	leave
+     714:	c3                   	ret
+     715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	8b 55 08             	mov    0x8(%ebp),%edx
+     727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     72a:	0f b6 02             	movzbl (%edx),%eax
+     72d:	84 c0                	test   %al,%al
+     72f:	75 17                	jne    748 <strcmp+0x28>
+     731:	eb 3a                	jmp    76d <strcmp+0x4d>
+     733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     737:	90                   	nop
+     738:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     73c:	83 c2 01             	add    $0x1,%edx
+     73f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     742:	84 c0                	test   %al,%al
+     744:	74 1a                	je     760 <strcmp+0x40>
+    p++, q++;
+     746:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     748:	0f b6 19             	movzbl (%ecx),%ebx
+     74b:	38 c3                	cmp    %al,%bl
+     74d:	74 e9                	je     738 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     74f:	29 d8                	sub    %ebx,%eax
+}
+     751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     754:	c9                   	leave
+     755:	c3                   	ret
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     760:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     764:	31 c0                	xor    %eax,%eax
+     766:	29 d8                	sub    %ebx,%eax
+}
+     768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     76b:	c9                   	leave
+     76c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     76d:	0f b6 19             	movzbl (%ecx),%ebx
+     770:	31 c0                	xor    %eax,%eax
+     772:	eb db                	jmp    74f <strcmp+0x2f>
+     774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     786:	80 3a 00             	cmpb   $0x0,(%edx)
+     789:	74 15                	je     7a0 <strlen+0x20>
+     78b:	31 c0                	xor    %eax,%eax
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+     790:	83 c0 01             	add    $0x1,%eax
+     793:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     797:	89 c1                	mov    %eax,%ecx
+     799:	75 f5                	jne    790 <strlen+0x10>
+    ;
+  return n;
+}
+     79b:	89 c8                	mov    %ecx,%eax
+     79d:	5d                   	pop    %ebp
+     79e:	c3                   	ret
+     79f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     7a0:	31 c9                	xor    %ecx,%ecx
+}
+     7a2:	5d                   	pop    %ebp
+     7a3:	89 c8                	mov    %ecx,%eax
+     7a5:	c3                   	ret
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     7b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7bd:	89 d7                	mov    %edx,%edi
+     7bf:	fc                   	cld
+     7c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     7c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7c5:	89 d0                	mov    %edx,%eax
+     7c7:	c9                   	leave
+     7c8:	c3                   	ret
+     7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7da:	0f b6 10             	movzbl (%eax),%edx
+     7dd:	84 d2                	test   %dl,%dl
+     7df:	75 12                	jne    7f3 <strchr+0x23>
+     7e1:	eb 1d                	jmp    800 <strchr+0x30>
+     7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7e7:	90                   	nop
+     7e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7ec:	83 c0 01             	add    $0x1,%eax
+     7ef:	84 d2                	test   %dl,%dl
+     7f1:	74 0d                	je     800 <strchr+0x30>
+    if(*s == c)
+     7f3:	38 d1                	cmp    %dl,%cl
+     7f5:	75 f1                	jne    7e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     7f7:	5d                   	pop    %ebp
+     7f8:	c3                   	ret
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     800:	31 c0                	xor    %eax,%eax
+}
+     802:	5d                   	pop    %ebp
+     803:	c3                   	ret
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     815:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     818:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     819:	31 db                	xor    %ebx,%ebx
+{
+     81b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     81e:	eb 27                	jmp    847 <gets+0x37>
+    cc = read(0, &c, 1);
+     820:	83 ec 04             	sub    $0x4,%esp
+     823:	6a 01                	push   $0x1
+     825:	56                   	push   %esi
+     826:	6a 00                	push   $0x0
+     828:	e8 1e 01 00 00       	call   94b <read>
+    if(cc < 1)
+     82d:	83 c4 10             	add    $0x10,%esp
+     830:	85 c0                	test   %eax,%eax
+     832:	7e 1d                	jle    851 <gets+0x41>
+      break;
+    buf[i++] = c;
+     834:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     838:	8b 55 08             	mov    0x8(%ebp),%edx
+     83b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     83f:	3c 0a                	cmp    $0xa,%al
+     841:	74 10                	je     853 <gets+0x43>
+     843:	3c 0d                	cmp    $0xd,%al
+     845:	74 0c                	je     853 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     847:	89 df                	mov    %ebx,%edi
+     849:	83 c3 01             	add    $0x1,%ebx
+     84c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     84f:	7c cf                	jl     820 <gets+0x10>
+     851:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     853:	8b 45 08             	mov    0x8(%ebp),%eax
+     856:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     85a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     85d:	5b                   	pop    %ebx
+     85e:	5e                   	pop    %esi
+     85f:	5f                   	pop    %edi
+     860:	5d                   	pop    %ebp
+     861:	c3                   	ret
+     862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	56                   	push   %esi
+     874:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     875:	83 ec 08             	sub    $0x8,%esp
+     878:	6a 00                	push   $0x0
+     87a:	ff 75 08             	push   0x8(%ebp)
+     87d:	e8 f1 00 00 00       	call   973 <open>
+  if(fd < 0)
+     882:	83 c4 10             	add    $0x10,%esp
+     885:	85 c0                	test   %eax,%eax
+     887:	78 27                	js     8b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     889:	83 ec 08             	sub    $0x8,%esp
+     88c:	ff 75 0c             	push   0xc(%ebp)
+     88f:	89 c3                	mov    %eax,%ebx
+     891:	50                   	push   %eax
+     892:	e8 f4 00 00 00       	call   98b <fstat>
+  close(fd);
+     897:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     89a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     89c:	e8 ba 00 00 00       	call   95b <close>
+  return r;
+     8a1:	83 c4 10             	add    $0x10,%esp
+}
+     8a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8a7:	89 f0                	mov    %esi,%eax
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5d                   	pop    %ebp
+     8ac:	c3                   	ret
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     8b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8b5:	eb ed                	jmp    8a4 <stat+0x34>
+     8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	53                   	push   %ebx
+     8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     8c7:	0f be 02             	movsbl (%edx),%eax
+     8ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     8cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8d5:	77 1e                	ja     8f5 <atoi+0x35>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8e0:	83 c2 01             	add    $0x1,%edx
+     8e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8ea:	0f be 02             	movsbl (%edx),%eax
+     8ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8f0:	80 fb 09             	cmp    $0x9,%bl
+     8f3:	76 eb                	jbe    8e0 <atoi+0x20>
+  return n;
+}
+     8f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f8:	89 c8                	mov    %ecx,%eax
+     8fa:	c9                   	leave
+     8fb:	c3                   	ret
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	8b 45 10             	mov    0x10(%ebp),%eax
+     908:	8b 55 08             	mov    0x8(%ebp),%edx
+     90b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     90e:	85 c0                	test   %eax,%eax
+     910:	7e 13                	jle    925 <memmove+0x25>
+     912:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     914:	89 d7                	mov    %edx,%edi
+     916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     920:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     921:	39 f8                	cmp    %edi,%eax
+     923:	75 fb                	jne    920 <memmove+0x20>
+  return vdst;
+}
+     925:	5e                   	pop    %esi
+     926:	89 d0                	mov    %edx,%eax
+     928:	5f                   	pop    %edi
+     929:	5d                   	pop    %ebp
+     92a:	c3                   	ret
+
+0000092b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     92b:	b8 01 00 00 00       	mov    $0x1,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <exit>:
+SYSCALL(exit)
+     933:	b8 02 00 00 00       	mov    $0x2,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <wait>:
+SYSCALL(wait)
+     93b:	b8 03 00 00 00       	mov    $0x3,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <pipe>:
+SYSCALL(pipe)
+     943:	b8 04 00 00 00       	mov    $0x4,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <read>:
+SYSCALL(read)
+     94b:	b8 05 00 00 00       	mov    $0x5,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <write>:
+SYSCALL(write)
+     953:	b8 10 00 00 00       	mov    $0x10,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <close>:
+SYSCALL(close)
+     95b:	b8 15 00 00 00       	mov    $0x15,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <kill>:
+SYSCALL(kill)
+     963:	b8 06 00 00 00       	mov    $0x6,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <exec>:
+SYSCALL(exec)
+     96b:	b8 07 00 00 00       	mov    $0x7,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <open>:
+SYSCALL(open)
+     973:	b8 0f 00 00 00       	mov    $0xf,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <mknod>:
+SYSCALL(mknod)
+     97b:	b8 11 00 00 00       	mov    $0x11,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <unlink>:
+SYSCALL(unlink)
+     983:	b8 12 00 00 00       	mov    $0x12,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <fstat>:
+SYSCALL(fstat)
+     98b:	b8 08 00 00 00       	mov    $0x8,%eax
+     990:	cd 40                	int    $0x40
+     992:	c3                   	ret
+
+00000993 <link>:
+SYSCALL(link)
+     993:	b8 13 00 00 00       	mov    $0x13,%eax
+     998:	cd 40                	int    $0x40
+     99a:	c3                   	ret
+
+0000099b <mkdir>:
+SYSCALL(mkdir)
+     99b:	b8 14 00 00 00       	mov    $0x14,%eax
+     9a0:	cd 40                	int    $0x40
+     9a2:	c3                   	ret
+
+000009a3 <chdir>:
+SYSCALL(chdir)
+     9a3:	b8 09 00 00 00       	mov    $0x9,%eax
+     9a8:	cd 40                	int    $0x40
+     9aa:	c3                   	ret
+
+000009ab <dup>:
+SYSCALL(dup)
+     9ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9b0:	cd 40                	int    $0x40
+     9b2:	c3                   	ret
+
+000009b3 <getpid>:
+SYSCALL(getpid)
+     9b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9b8:	cd 40                	int    $0x40
+     9ba:	c3                   	ret
+
+000009bb <sbrk>:
+SYSCALL(sbrk)
+     9bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9c0:	cd 40                	int    $0x40
+     9c2:	c3                   	ret
+
+000009c3 <sleep>:
+SYSCALL(sleep)
+     9c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9c8:	cd 40                	int    $0x40
+     9ca:	c3                   	ret
+
+000009cb <uptime>:
+SYSCALL(uptime)
+     9cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <getsysinfo>:
+SYSCALL(getsysinfo)
+     9d3:	b8 16 00 00 00       	mov    $0x16,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     9db:	b8 17 00 00 00       	mov    $0x17,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     9e3:	b8 18 00 00 00       	mov    $0x18,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <mlfqstart>:
+SYSCALL(mlfqstart)
+     9eb:	b8 19 00 00 00       	mov    $0x19,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <mlfqstop>:
+SYSCALL(mlfqstop)
+     9f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     9fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     a03:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <setpriority>:
+SYSCALL(setpriority)
+     a0b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     a13:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <getcpustats>:
+SYSCALL(getcpustats)
+     a1b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <setscheduler>:
+SYSCALL(setscheduler)
+     a23:	b8 20 00 00 00       	mov    $0x20,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     a2b:	b8 21 00 00 00       	mov    $0x21,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <getscheduler>:
+SYSCALL(getscheduler)
+     a33:	b8 22 00 00 00       	mov    $0x22,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <splice>:
+SYSCALL(splice)
+     a3b:	b8 23 00 00 00       	mov    $0x23,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <readv>:
+SYSCALL(readv)
+     a43:	b8 24 00 00 00       	mov    $0x24,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <writev>:
+SYSCALL(writev)
+     a4b:	b8 25 00 00 00       	mov    $0x25,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <pread>:
+SYSCALL(pread)
+     a53:	b8 26 00 00 00       	mov    $0x26,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <pwrite>:
+SYSCALL(pwrite)
+     a5b:	b8 27 00 00 00       	mov    $0x27,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <getlogstat>:
+SYSCALL(getlogstat)
+     a63:	b8 28 00 00 00       	mov    $0x28,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <mount>:
+SYSCALL(mount)
+     a6b:	b8 29 00 00 00       	mov    $0x29,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <umount>:
+SYSCALL(umount)
+     a73:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <mmap>:
+SYSCALL(mmap)
+     a7b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <munmap>:
+SYSCALL(munmap)
+     a83:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <membench>:
+SYSCALL(membench)
+     a8b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <getlockstat>:
+SYSCALL(getlockstat)
+     a93:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <lockbench>:
+SYSCALL(lockbench)
+     a9b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <prof>:
+SYSCALL(prof)
+     aa3:	b8 30 00 00 00       	mov    $0x30,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <tracectl>:
+SYSCALL(tracectl)
+     aab:	b8 31 00 00 00       	mov    $0x31,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <traceread>:
+SYSCALL(traceread)
+     ab3:	b8 32 00 00 00       	mov    $0x32,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <getsysstat>:
+SYSCALL(getsysstat)
+     abb:	b8 33 00 00 00       	mov    $0x33,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <getwaitstat>:
+SYSCALL(getwaitstat)
+     ac3:	b8 34 00 00 00       	mov    $0x34,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+
+00000acb <getschedwait>:
+SYSCALL(getschedwait)
+     acb:	b8 35 00 00 00       	mov    $0x35,%eax
+     ad0:	cd 40                	int    $0x40
+     ad2:	c3                   	ret
+
+00000ad3 <mlfqread>:
+SYSCALL(mlfqread)
+     ad3:	b8 36 00 00 00       	mov    $0x36,%eax
+     ad8:	cd 40                	int    $0x40
+     ada:	c3                   	ret
+
+00000adb <dllock>:
+SYSCALL(dllock)
+     adb:	b8 37 00 00 00       	mov    $0x37,%eax
+     ae0:	cd 40                	int    $0x40
+     ae2:	c3                   	ret
+
+00000ae3 <watchdogctl>:
+SYSCALL(watchdogctl)
+     ae3:	b8 38 00 00 00       	mov    $0x38,%eax
+     ae8:	cd 40                	int    $0x40
+     aea:	c3                   	ret
+
+00000aeb <deadlocklog>:
+SYSCALL(deadlocklog)
+     aeb:	b8 39 00 00 00       	mov    $0x39,%eax
+     af0:	cd 40                	int    $0x40
+     af2:	c3                   	ret
+
+00000af3 <clone>:
+SYSCALL(clone)
+     af3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     af8:	cd 40                	int    $0x40
+     afa:	c3                   	ret
+
+00000afb <join>:
+SYSCALL(join)
+     afb:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <futex>:
+SYSCALL(futex)
+     b03:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <shmat>:
+SYSCALL(shmat)
+     b0b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <shmdt>:
+SYSCALL(shmdt)
+     b13:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <poll>:
+SYSCALL(poll)
+     b1b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+     b23:	66 90                	xchg   %ax,%ax
+     b25:	66 90                	xchg   %ax,%ax
+     b27:	66 90                	xchg   %ax,%ax
+     b29:	66 90                	xchg   %ax,%ax
+     b2b:	66 90                	xchg   %ax,%ax
+     b2d:	66 90                	xchg   %ax,%ax
+     b2f:	90                   	nop
+
+00000b30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	56                   	push   %esi
+     b35:	53                   	push   %ebx
+     b36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b38:	89 d1                	mov    %edx,%ecx
+{
+     b3a:	83 ec 3c             	sub    $0x3c,%esp
+     b3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     b40:	85 d2                	test   %edx,%edx
+     b42:	0f 89 80 00 00 00    	jns    bc8 <printint+0x98>
+     b48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b4c:	74 7a                	je     bc8 <printint+0x98>
+    x = -xx;
+     b4e:	f7 d9                	neg    %ecx
+    neg = 1;
+     b50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b58:	31 f6                	xor    %esi,%esi
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b60:	89 c8                	mov    %ecx,%eax
+     b62:	31 d2                	xor    %edx,%edx
+     b64:	89 f7                	mov    %esi,%edi
+     b66:	f7 f3                	div    %ebx
+     b68:	8d 76 01             	lea    0x1(%esi),%esi
+     b6b:	0f b6 92 1c 12 00 00 	movzbl 0x121c(%edx),%edx
+     b72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b76:	89 ca                	mov    %ecx,%edx
+     b78:	89 c1                	mov    %eax,%ecx
+     b7a:	39 da                	cmp    %ebx,%edx
+     b7c:	73 e2                	jae    b60 <printint+0x30>
+  if(neg)
+     b7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b81:	85 c0                	test   %eax,%eax
+     b83:	74 07                	je     b8c <printint+0x5c>
+    buf[i++] = '-';
+     b85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b8a:	89 f7                	mov    %esi,%edi
+     b8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b92:	01 df                	add    %ebx,%edi
+     b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     b9b:	83 ec 04             	sub    $0x4,%esp
+     b9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     ba1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     ba4:	6a 01                	push   $0x1
+     ba6:	50                   	push   %eax
+     ba7:	56                   	push   %esi
+     ba8:	e8 a6 fd ff ff       	call   953 <write>
+  while(--i >= 0)
+     bad:	89 f8                	mov    %edi,%eax
+     baf:	83 c4 10             	add    $0x10,%esp
+     bb2:	83 ef 01             	sub    $0x1,%edi
+     bb5:	39 d8                	cmp    %ebx,%eax
+     bb7:	75 df                	jne    b98 <printint+0x68>
+}
+     bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bbc:	5b                   	pop    %ebx
+     bbd:	5e                   	pop    %esi
+     bbe:	5f                   	pop    %edi
+     bbf:	5d                   	pop    %ebp
+     bc0:	c3                   	ret
+     bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     bc8:	31 c0                	xor    %eax,%eax
+     bca:	eb 89                	jmp    b55 <printint+0x25>
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     bd9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     bdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     bdf:	0f b6 1e             	movzbl (%esi),%ebx
+     be2:	83 c6 01             	add    $0x1,%esi
+     be5:	84 db                	test   %bl,%bl
+     be7:	74 67                	je     c50 <printf+0x80>
+     be9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bec:	31 d2                	xor    %edx,%edx
+     bee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     bf1:	eb 34                	jmp    c27 <printf+0x57>
+     bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bf7:	90                   	nop
+     bf8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     bfb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     c00:	83 f8 25             	cmp    $0x25,%eax
+     c03:	74 18                	je     c1d <printf+0x4d>
+  write(fd, &c, 1);
+     c05:	83 ec 04             	sub    $0x4,%esp
+     c08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     c0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     c0e:	6a 01                	push   $0x1
+     c10:	50                   	push   %eax
+     c11:	57                   	push   %edi
+     c12:	e8 3c fd ff ff       	call   953 <write>
+     c17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     c1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     c1d:	0f b6 1e             	movzbl (%esi),%ebx
+     c20:	83 c6 01             	add    $0x1,%esi
+     c23:	84 db                	test   %bl,%bl
+     c25:	74 29                	je     c50 <printf+0x80>
+    c = fmt[i] & 0xff;
+     c27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     c2a:	85 d2                	test   %edx,%edx
+     c2c:	74 ca                	je     bf8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     c2e:	83 fa 25             	cmp    $0x25,%edx
+     c31:	75 ea                	jne    c1d <printf+0x4d>
+      if(c == 'd'){
+     c33:	83 f8 25             	cmp    $0x25,%eax
+     c36:	0f 84 24 01 00 00    	je     d60 <printf+0x190>
+     c3c:	83 e8 63             	sub    $0x63,%eax
+     c3f:	83 f8 15             	cmp    $0x15,%eax
+     c42:	77 1c                	ja     c60 <printf+0x90>
+     c44:	ff 24 85 c4 11 00 00 	jmp    *0x11c4(,%eax,4)
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     c50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c53:	5b                   	pop    %ebx
+     c54:	5e                   	pop    %esi
+     c55:	5f                   	pop    %edi
+     c56:	5d                   	pop    %ebp
+     c57:	c3                   	ret
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+  write(fd, &c, 1);
+     c60:	83 ec 04             	sub    $0x4,%esp
+     c63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     c6a:	6a 01                	push   $0x1
+     c6c:	52                   	push   %edx
+     c6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     c70:	57                   	push   %edi
+     c71:	e8 dd fc ff ff       	call   953 <write>
+     c76:	83 c4 0c             	add    $0xc,%esp
+     c79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     c7c:	6a 01                	push   $0x1
+     c7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     c81:	52                   	push   %edx
+     c82:	57                   	push   %edi
+     c83:	e8 cb fc ff ff       	call   953 <write>
+        putc(fd, c);
+     c88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c8b:	31 d2                	xor    %edx,%edx
+     c8d:	eb 8e                	jmp    c1d <printf+0x4d>
+     c8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     c90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c9b:	8b 13                	mov    (%ebx),%edx
+     c9d:	6a 00                	push   $0x0
+     c9f:	89 f8                	mov    %edi,%eax
+        ap++;
+     ca1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     ca4:	e8 87 fe ff ff       	call   b30 <printint>
+        ap++;
+     ca9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     cac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     caf:	31 d2                	xor    %edx,%edx
+     cb1:	e9 67 ff ff ff       	jmp    c1d <printf+0x4d>
+     cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     cc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     cc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     cc5:	83 c0 04             	add    $0x4,%eax
+     cc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     ccb:	85 db                	test   %ebx,%ebx
+     ccd:	0f 84 9d 00 00 00    	je     d70 <printf+0x1a0>
+        while(*s != 0){
+     cd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     cd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     cd8:	84 c0                	test   %al,%al
+     cda:	0f 84 3d ff ff ff    	je     c1d <printf+0x4d>
+     ce0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ce3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     ce6:	89 de                	mov    %ebx,%esi
+     ce8:	89 d3                	mov    %edx,%ebx
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     cf0:	83 ec 04             	sub    $0x4,%esp
+     cf3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     cf6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     cf9:	6a 01                	push   $0x1
+     cfb:	53                   	push   %ebx
+     cfc:	57                   	push   %edi
+     cfd:	e8 51 fc ff ff       	call   953 <write>
+        while(*s != 0){
+     d02:	0f b6 06             	movzbl (%esi),%eax
+     d05:	83 c4 10             	add    $0x10,%esp
+     d08:	84 c0                	test   %al,%al
+     d0a:	75 e4                	jne    cf0 <printf+0x120>
+      state = 0;
+     d0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     d0f:	31 d2                	xor    %edx,%edx
+     d11:	e9 07 ff ff ff       	jmp    c1d <printf+0x4d>
+     d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     d20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     d23:	83 ec 0c             	sub    $0xc,%esp
+     d26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d2b:	8b 13                	mov    (%ebx),%edx
+     d2d:	6a 01                	push   $0x1
+     d2f:	e9 6b ff ff ff       	jmp    c9f <printf+0xcf>
+     d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     d38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     d3b:	83 ec 04             	sub    $0x4,%esp
+     d3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     d41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     d43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     d46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     d49:	6a 01                	push   $0x1
+     d4b:	52                   	push   %edx
+     d4c:	57                   	push   %edi
+     d4d:	e8 01 fc ff ff       	call   953 <write>
+        ap++;
+     d52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     d55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d58:	31 d2                	xor    %edx,%edx
+     d5a:	e9 be fe ff ff       	jmp    c1d <printf+0x4d>
+     d5f:	90                   	nop
+  write(fd, &c, 1);
+     d60:	83 ec 04             	sub    $0x4,%esp
+     d63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d69:	6a 01                	push   $0x1
+     d6b:	e9 11 ff ff ff       	jmp    c81 <printf+0xb1>
+     d70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     d75:	bb bd 11 00 00       	mov    $0x11bd,%ebx
+     d7a:	e9 61 ff ff ff       	jmp    ce0 <printf+0x110>
+     d7f:	90                   	nop
+
+00000d80 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+     d80:	55                   	push   %ebp
+     d81:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d83:	a1 b4 37 00 00       	mov    0x37b4,%eax
+{
+     d88:	89 e5                	mov    %esp,%ebp
+     d8a:	56                   	push   %esi
+     d8b:	53                   	push   %ebx
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d90:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d92:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d94:	39 ca                	cmp    %ecx,%edx
+     d96:	73 30                	jae    dc8 <bigfree+0x48>
+     d98:	39 c1                	cmp    %eax,%ecx
+     d9a:	72 04                	jb     da0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d9c:	39 c2                	cmp    %eax,%edx
+     d9e:	72 f0                	jb     d90 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     da0:	8b 59 04             	mov    0x4(%ecx),%ebx
+     da3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     da6:	39 f0                	cmp    %esi,%eax
+     da8:	74 26                	je     dd0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     daa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     dac:	8b 42 04             	mov    0x4(%edx),%eax
+     daf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     db2:	39 d9                	cmp    %ebx,%ecx
+     db4:	74 30                	je     de6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     db6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     db8:	5b                   	pop    %ebx
+  freep = p;
+     db9:	89 15 b4 37 00 00    	mov    %edx,0x37b4
+}
+     dbf:	5e                   	pop    %esi
+     dc0:	5d                   	pop    %ebp
+     dc1:	c3                   	ret
+     dc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dc8:	39 c1                	cmp    %eax,%ecx
+     dca:	72 d0                	jb     d9c <bigfree+0x1c>
+     dcc:	eb c2                	jmp    d90 <bigfree+0x10>
+     dce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     dd0:	03 58 04             	add    0x4(%eax),%ebx
+     dd3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     dd6:	8b 02                	mov    (%edx),%eax
+     dd8:	8b 00                	mov    (%eax),%eax
+     dda:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     ddc:	8b 42 04             	mov    0x4(%edx),%eax
+     ddf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     de2:	39 d9                	cmp    %ebx,%ecx
+     de4:	75 d0                	jne    db6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+     de6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     de9:	89 15 b4 37 00 00    	mov    %edx,0x37b4
+    p->s.size += bp->s.size;
+     def:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     df2:	8b 09                	mov    (%ecx),%ecx
+     df4:	89 0a                	mov    %ecx,(%edx)
+}
+     df6:	5b                   	pop    %ebx
+     df7:	5e                   	pop    %esi
+     df8:	5d                   	pop    %ebp
+     df9:	c3                   	ret
+     dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e00 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	57                   	push   %edi
+     e04:	89 c7                	mov    %eax,%edi
+     e06:	56                   	push   %esi
+     e07:	53                   	push   %ebx
+     e08:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     e0b:	a1 b4 37 00 00       	mov    0x37b4,%eax
+     e10:	85 c0                	test   %eax,%eax
+     e12:	0f 84 88 00 00 00    	je     ea0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     e1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     e1d:	39 f9                	cmp    %edi,%ecx
+     e1f:	73 5f                	jae    e80 <bigalloc+0x80>
+  if(nu < 4096)
+     e21:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     e26:	39 df                	cmp    %ebx,%edi
+     e28:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     e2b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     e32:	eb 0d                	jmp    e41 <bigalloc+0x41>
+     e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e38:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     e3a:	8b 4a 04             	mov    0x4(%edx),%ecx
+     e3d:	39 f9                	cmp    %edi,%ecx
+     e3f:	73 3f                	jae    e80 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     e41:	89 d0                	mov    %edx,%eax
+     e43:	39 15 b4 37 00 00    	cmp    %edx,0x37b4
+     e49:	75 ed                	jne    e38 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     e4b:	83 ec 0c             	sub    $0xc,%esp
+     e4e:	56                   	push   %esi
+     e4f:	e8 67 fb ff ff       	call   9bb <sbrk>
+  if(p == (char*)-1)
+     e54:	83 c4 10             	add    $0x10,%esp
+     e57:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e5a:	74 11                	je     e6d <bigalloc+0x6d>
+  hp->s.size = nu;
+     e5c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+     e5f:	e8 1c ff ff ff       	call   d80 <bigfree>
+  return freep;
+     e64:	a1 b4 37 00 00       	mov    0x37b4,%eax
+      if((p = morecore(nunits)) == 0)
+     e69:	85 c0                	test   %eax,%eax
+     e6b:	75 cb                	jne    e38 <bigalloc+0x38>
+        return 0;
+  }
+}
+     e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     e70:	31 d2                	xor    %edx,%edx
+}
+     e72:	5b                   	pop    %ebx
+     e73:	89 d0                	mov    %edx,%eax
+     e75:	5e                   	pop    %esi
+     e76:	5f                   	pop    %edi
+     e77:	5d                   	pop    %ebp
+     e78:	c3                   	ret
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     e80:	39 cf                	cmp    %ecx,%edi
+     e82:	74 4c                	je     ed0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+     e84:	29 f9                	sub    %edi,%ecx
+     e86:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     e89:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     e8c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     e8f:	a3 b4 37 00 00       	mov    %eax,0x37b4
+}
+     e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e97:	89 d0                	mov    %edx,%eax
+     e99:	5b                   	pop    %ebx
+     e9a:	5e                   	pop    %esi
+     e9b:	5f                   	pop    %edi
+     e9c:	5d                   	pop    %ebp
+     e9d:	c3                   	ret
+     e9e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+     ea0:	c7 05 b4 37 00 00 b8 	movl   $0x37b8,0x37b4
+     ea7:	37 00 00 
+    base.s.size = 0;
+     eaa:	ba b8 37 00 00       	mov    $0x37b8,%edx
+    base.s.ptr = freep = prevp = &base;
+     eaf:	c7 05 b8 37 00 00 b8 	movl   $0x37b8,0x37b8
+     eb6:	37 00 00 
+    base.s.size = 0;
+     eb9:	c7 05 bc 37 00 00 00 	movl   $0x0,0x37bc
+     ec0:	00 00 00 
+    if(p->s.size >= nunits){
+     ec3:	e9 59 ff ff ff       	jmp    e21 <bigalloc+0x21>
+     ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ecf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     ed0:	8b 0a                	mov    (%edx),%ecx
+     ed2:	89 08                	mov    %ecx,(%eax)
+     ed4:	eb b9                	jmp    e8f <bigalloc+0x8f>
+     ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ee0 <free>:
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	53                   	push   %ebx
+     ee4:	83 ec 04             	sub    $0x4,%esp
+     ee7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+     eea:	85 c9                	test   %ecx,%ecx
+     eec:	74 58                	je     f46 <free+0x66>
+  bp = (Header*)ap - 1;
+     eee:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+  asm volatile("lock; xchgl %0, %1" :
+     ef1:	ba 01 00 00 00       	mov    $0x1,%edx
+     ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+     f00:	89 d0                	mov    %edx,%eax
+     f02:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+  while(xchg(&locked, 1) != 0)
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	75 f3                	jne    f00 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+     f0d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+     f10:	83 fa 40             	cmp    $0x40,%edx
+     f13:	77 3b                	ja     f50 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+     f15:	83 fa 02             	cmp    $0x2,%edx
+     f18:	76 3f                	jbe    f59 <free+0x79>
+     f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f20:	83 c0 01             	add    $0x1,%eax
+     f23:	39 14 85 40 12 00 00 	cmp    %edx,0x1240(,%eax,4)
+     f2a:	72 f4                	jb     f20 <free+0x40>
+    bp->s.ptr = classfree[c];
+     f2c:	8b 14 85 80 37 00 00 	mov    0x3780(,%eax,4),%edx
+    classfree[c] = bp;
+     f33:	89 1c 85 80 37 00 00 	mov    %ebx,0x3780(,%eax,4)
+    bp->s.ptr = classfree[c];
+     f3a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+     f3d:	31 c0                	xor    %eax,%eax
+     f3f:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+}
+     f46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f49:	c9                   	leave
+     f4a:	c3                   	ret
+     f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+    bigfree(bp);
+     f50:	89 d8                	mov    %ebx,%eax
+     f52:	e8 29 fe ff ff       	call   d80 <bigfree>
+     f57:	eb e4                	jmp    f3d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+     f59:	31 c0                	xor    %eax,%eax
+     f5b:	eb cf                	jmp    f2c <free+0x4c>
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f60 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f60:	55                   	push   %ebp
+     f61:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f66:	89 e5                	mov    %esp,%ebp
+     f68:	57                   	push   %edi
+     f69:	56                   	push   %esi
+     f6a:	53                   	push   %ebx
+     f6b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f71:	8d 50 07             	lea    0x7(%eax),%edx
+     f74:	c1 ea 03             	shr    $0x3,%edx
+     f77:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f80:	89 c8                	mov    %ecx,%eax
+     f82:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+     f89:	85 c0                	test   %eax,%eax
+     f8b:	75 f3                	jne    f80 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+     f8d:	89 c3                	mov    %eax,%ebx
+     f8f:	83 fa 40             	cmp    $0x40,%edx
+     f92:	77 4c                	ja     fe0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+     f94:	be 02 00 00 00       	mov    $0x2,%esi
+     f99:	83 fa 02             	cmp    $0x2,%edx
+     f9c:	76 10                	jbe    fae <malloc+0x4e>
+     f9e:	66 90                	xchg   %ax,%ax
+     fa0:	83 c3 01             	add    $0x1,%ebx
+     fa3:	8b 34 9d 40 12 00 00 	mov    0x1240(,%ebx,4),%esi
+     faa:	39 d6                	cmp    %edx,%esi
+     fac:	72 f2                	jb     fa0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+     fae:	8b 14 9d 80 37 00 00 	mov    0x3780(,%ebx,4),%edx
+     fb5:	85 d2                	test   %edx,%edx
+     fb7:	74 47                	je     1000 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+     fb9:	8b 3a                	mov    (%edx),%edi
+     fbb:	89 3c 9d 80 37 00 00 	mov    %edi,0x3780(,%ebx,4)
+     fc2:	31 c0                	xor    %eax,%eax
+     fc4:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+     fcb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+     fce:	8d 42 08             	lea    0x8(%edx),%eax
+}
+     fd1:	5b                   	pop    %ebx
+     fd2:	5e                   	pop    %esi
+     fd3:	5f                   	pop    %edi
+     fd4:	5d                   	pop    %ebp
+     fd5:	c3                   	ret
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+     fe0:	89 d0                	mov    %edx,%eax
+     fe2:	e8 19 fe ff ff       	call   e00 <bigalloc>
+     fe7:	89 c2                	mov    %eax,%edx
+     fe9:	89 d8                	mov    %ebx,%eax
+     feb:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+  return p ? (void*)(p + 1) : 0;
+     ff2:	85 d2                	test   %edx,%edx
+     ff4:	75 d5                	jne    fcb <malloc+0x6b>
+     ff6:	31 c0                	xor    %eax,%eax
+}
+     ff8:	83 c4 1c             	add    $0x1c,%esp
+     ffb:	5b                   	pop    %ebx
+     ffc:	5e                   	pop    %esi
+     ffd:	5f                   	pop    %edi
+     ffe:	5d                   	pop    %ebp
+     fff:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    1000:	b8 00 02 00 00       	mov    $0x200,%eax
+    1005:	e8 f6 fd ff ff       	call   e00 <bigalloc>
+    100a:	85 c0                	test   %eax,%eax
+    100c:	74 44                	je     1052 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    100e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    1015:	8b 14 9d 80 37 00 00 	mov    0x3780(,%ebx,4),%edx
+    101c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    101f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    1022:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    1028:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    102b:	39 cf                	cmp    %ecx,%edi
+    102d:	72 8a                	jb     fb9 <malloc+0x59>
+    102f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    1032:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1035:	8d 76 00             	lea    0x0(%esi),%esi
+    1038:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    103a:	89 70 04             	mov    %esi,0x4(%eax)
+    103d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    103f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    1041:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    1043:	01 d8                	add    %ebx,%eax
+    1045:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    1048:	73 ee                	jae    1038 <malloc+0xd8>
+    104a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    104d:	e9 69 ff ff ff       	jmp    fbb <malloc+0x5b>
+    1052:	f0 87 05 60 37 00 00 	lock xchg %eax,0x3760
+  return p ? (void*)(p + 1) : 0;
+    1059:	31 c0                	xor    %eax,%eax
+    105b:	eb 9b                	jmp    ff8 <malloc+0x98>
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001060 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	56                   	push   %esi
+    1064:	53                   	push   %ebx
+    1065:	8b 45 08             	mov    0x8(%ebp),%eax
+    1068:	f7 65 0c             	mull   0xc(%ebp)
+    106b:	70 33                	jo     10a0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    106d:	83 ec 0c             	sub    $0xc,%esp
+    1070:	89 c3                	mov    %eax,%ebx
+    1072:	50                   	push   %eax
+    1073:	e8 e8 fe ff ff       	call   f60 <malloc>
+    1078:	83 c4 10             	add    $0x10,%esp
+    107b:	89 c6                	mov    %eax,%esi
+    107d:	85 c0                	test   %eax,%eax
+    107f:	74 1f                	je     10a0 <calloc+0x40>
+    memset(p, 0, n);
+    1081:	83 ec 04             	sub    $0x4,%esp
+    1084:	53                   	push   %ebx
+    1085:	6a 00                	push   $0x0
+    1087:	50                   	push   %eax
+    1088:	e8 23 f7 ff ff       	call   7b0 <memset>
+    108d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1093:	89 f0                	mov    %esi,%eax
+    1095:	5b                   	pop    %ebx
+    1096:	5e                   	pop    %esi
+    1097:	5d                   	pop    %ebp
+    1098:	c3                   	ret
+    1099:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    10a3:	31 f6                	xor    %esi,%esi
+}
+    10a5:	89 f0                	mov    %esi,%eax
+    10a7:	5b                   	pop    %ebx
+    10a8:	5e                   	pop    %esi
+    10a9:	5d                   	pop    %ebp
+    10aa:	c3                   	ret
+    10ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+
+000010b0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	53                   	push   %ebx
+    10b6:	83 ec 0c             	sub    $0xc,%esp
+    10b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    10bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    10bf:	85 db                	test   %ebx,%ebx
+    10c1:	74 55                	je     1118 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    10c3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    10c6:	89 de                	mov    %ebx,%esi
+    10c8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    10cf:	39 c7                	cmp    %eax,%edi
+    10d1:	72 0d                	jb     10e0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    10d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10d6:	89 f0                	mov    %esi,%eax
+    10d8:	5b                   	pop    %ebx
+    10d9:	5e                   	pop    %esi
+    10da:	5f                   	pop    %edi
+    10db:	5d                   	pop    %ebp
+    10dc:	c3                   	ret
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    10e0:	83 ec 0c             	sub    $0xc,%esp
+    10e3:	50                   	push   %eax
+    10e4:	e8 77 fe ff ff       	call   f60 <malloc>
+    10e9:	83 c4 10             	add    $0x10,%esp
+    10ec:	89 c6                	mov    %eax,%esi
+    10ee:	85 c0                	test   %eax,%eax
+    10f0:	74 e1                	je     10d3 <realloc+0x23>
+  memmove(p, ap, have);
+    10f2:	83 ec 04             	sub    $0x4,%esp
+    10f5:	57                   	push   %edi
+    10f6:	53                   	push   %ebx
+    10f7:	50                   	push   %eax
+    10f8:	e8 03 f8 ff ff       	call   900 <memmove>
+  free(ap);
+    10fd:	89 1c 24             	mov    %ebx,(%esp)
+    1100:	e8 db fd ff ff       	call   ee0 <free>
+  return p;
+    1105:	83 c4 10             	add    $0x10,%esp
+}
+    1108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    110b:	89 f0                	mov    %esi,%eax
+    110d:	5b                   	pop    %ebx
+    110e:	5e                   	pop    %esi
+    110f:	5f                   	pop    %edi
+    1110:	5d                   	pop    %ebp
+    1111:	c3                   	ret
+    1112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1118:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    111b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    111e:	5b                   	pop    %ebx
+    111f:	5e                   	pop    %esi
+    1120:	5f                   	pop    %edi
+    1121:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1122:	e9 39 fe ff ff       	jmp    f60 <malloc>
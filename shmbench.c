@@ -0,0 +1,200 @@
+// Shared memory benchmark: a child process sends data to its
+// parent, first through a pipe and then through a ring buffer in
+// a shared memory segment, and the parent checks it arrived.
+// Prints cycles per KB for each.
+// usage: shmbench [kbytes]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "futex.h"
+
+#define CHUNK  4096
+#define RINGSZ (8*4096)
+
+// head and tail count bytes ever written and read; the data is at
+// buf[tail % RINGSZ] up to buf[head % RINGSZ]. The consumer sleeps
+// on head and the producer on tail, after setting cwait or pwait
+// so that the other side knows to wake it.
+struct ring {
+  volatile uint head;
+  volatile uint tail;
+  volatile uint cwait;
+  volatile uint pwait;
+  char buf[RINGSZ];
+};
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+char src[CHUNK];
+char dst[CHUNK];
+
+// Add n bytes at p to the running checksum sum.
+uint
+checksum(uint sum, char *p, int n)
+{
+  while(n-- > 0)
+    sum = sum * 31 + (uchar)*p++;
+  return sum;
+}
+
+// What the parent should receive: total bytes of src repeated.
+uint
+expected(uint total)
+{
+  uint sum, i;
+
+  sum = 0;
+  for(i = 0; i < total; i += CHUNK)
+    sum = checksum(sum, src, min(CHUNK, total - i));
+  return sum;
+}
+
+void
+report(char *name, uint64 cycles, uint kb, uint sum, uint want)
+{
+  uint k = cycles >> 10;
+
+  printf(1, "%s\t%d KB\t%d cycles/KB%s\n", name, kb,
+         k / kb * 1024 + k % kb * 1024 / kb,
+         sum == want ? "" : "\tBAD DATA");
+}
+
+uint64
+pipebench(uint total, uint *sum)
+{
+  int fds[2], n;
+  uint got;
+  uint64 t;
+
+  if(pipe(fds) < 0){
+    printf(2, "shmbench: pipe failed\n");
+    exit();
+  }
+  t = rdtsc();
+  if(fork() == 0){
+    close(fds[0]);
+    for(got = 0; got < total; got += CHUNK)
+      write(fds[1], src, min(CHUNK, total - got));
+    exit();
+  }
+  close(fds[1]);
+  *sum = 0;
+  for(got = 0; got < total; got += n){
+    if((n = read(fds[0], dst, CHUNK)) <= 0)
+      break;
+    *sum = checksum(*sum, dst, n);
+  }
+  close(fds[0]);
+  wait();
+  return rdtsc() - t;
+}
+
+void
+produce(struct ring *r, uint total)
+{
+  uint h, sent, i, n;
+
+  h = r->head;
+  for(sent = 0; sent < total; sent += n){
+    while(h - r->tail == RINGSZ){
+      r->pwait = 1;
+      __sync_synchronize();
+      if(h - r->tail == RINGSZ)
+        futex((uint*)&r->tail, FUTEX_WAIT, h - RINGSZ);
+      r->pwait = 0;
+    }
+    i = h % RINGSZ;
+    n = min(RINGSZ - (h - r->tail), RINGSZ - i);
+    n = min(n, CHUNK - sent % CHUNK);
+    n = min(n, total - sent);
+    memmove(r->buf + i, src + sent % CHUNK, n);
+    __sync_synchronize();
+    r->head = h += n;
+    __sync_synchronize();
+    if(r->cwait)
+      futex((uint*)&r->head, FUTEX_WAKE, 1);
+  }
+}
+
+uint
+consume(struct ring *r, uint total)
+{
+  uint t, got, i, n, sum;
+
+  sum = 0;
+  t = r->tail;
+  for(got = 0; got < total; got += n){
+    while(r->head == t){
+      r->cwait = 1;
+      __sync_synchronize();
+      if(r->head == t)
+        futex((uint*)&r->head, FUTEX_WAIT, t);
+      r->cwait = 0;
+    }
+    i = t % RINGSZ;
+    n = min(r->head - t, RINGSZ - i);
+    n = min(n, CHUNK);
+    memmove(dst, r->buf + i, n);
+    __sync_synchronize();
+    r->tail = t += n;
+    __sync_synchronize();
+    if(r->pwait)
+      futex((uint*)&r->tail, FUTEX_WAKE, 1);
+    sum = checksum(sum, dst, n);
+  }
+  return sum;
+}
+
+// The child attaches the segment by key rather than using the
+// copy of the parent's mapping it inherits.
+uint64
+shmbench(uint total, uint *sum)
+{
+  struct ring *r;
+  int key;
+  uint64 t;
+
+  key = getpid();
+  if((r = shmat(key, sizeof(*r))) == (void*)-1){
+    printf(2, "shmbench: shmat failed\n");
+    exit();
+  }
+  t = rdtsc();
+  if(fork() == 0){
+    shmdt(r);
+    if((r = shmat(key, sizeof(*r))) == (void*)-1){
+      printf(2, "shmbench: shmat in child failed\n");
+      exit();
+    }
+    produce(r, total);
+    exit();
+  }
+  *sum = consume(r, total);
+  wait();
+  t = rdtsc() - t;
+  shmdt(r);
+  return t;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint kb, total, sum, want, i;
+  uint64 cycles;
+
+  kb = argc > 1 ? atoi(argv[1]) : 1024;
+  if(kb == 0)
+    kb = 1;
+  total = kb * 1024;
+  for(i = 0; i < CHUNK; i++)
+    src[i] = i * 7 + (i >> 8);
+  want = expected(total);
+
+  cycles = pipebench(total, &sum);
+  report("pipe", cycles, kb, sum, want);
+  cycles = shmbench(total, &sum);
+  report("shm", cycles, kb, sum, want);
+  exit();
+}
@@ -17,38 +17,52 @@ initsleeplock(struct sleeplock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+  lk->holder = 0;
 }
 
-void
-acquiresleep(struct sleeplock *lk)
+// Wait for lk and take it. If intr is set, give up if the
+// process is killed while waiting, and return -1.
+// The wait-for graph (deadlock.c) follows every wait.
+static int
+acquiresleep1(struct sleeplock *lk, int intr)
 {
   acquire(&lk->lk);
   while (lk->locked) {
-    // --- DEADLOCK INSTRUMENTATION (WAIT) ---
-    myproc()->waiting_on_chan = (void*)lk;
-    // --- END INSTRUMENTATION ---
-    
+    if(intr && myproc()->killed){
+      wfghold(0);
+      release(&lk->lk);
+      return -1;
+    }
+    wfgwait(lk, intr);
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
-
-  // --- DEADLOCK INSTRUMENTATION (HOLD) ---
   lk->pid = myproc()->pid;
-  myproc()->waiting_on_chan = 0; // No longer waiting
-  // --- END INSTRUMENTATION ---
-  
+  wfghold(lk);
   release(&lk->lk);
+  return 0;
+}
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+  acquiresleep1(lk, 0);
+}
+
+// Like acquiresleep, but returns -1 without the lock if
+// the process is killed while waiting, and 0 otherwise.
+int
+acquiresleepintr(struct sleeplock *lk)
+{
+  return acquiresleep1(lk, 1);
 }
 
 void
 releasesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
-  
-  // --- DEADLOCK INSTRUMENTATION (RELEASE) ---
-  lk->pid = 0; // No process holds it now
-  // --- END INSTRUMENTATION ---
-
+  lk->pid = 0;
+  wfgrelease(lk);
   lk->locked = 0;
   wakeup(lk);
   release(&lk->lk);
@@ -8,29 +8,121 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+// Lock statistics.
+//
+// Locks with the same name form a lock class, such as all the
+// "pipe" locks, and each CPU keeps its own counters for each
+// class. A CPU holds interrupts off from acquire to release, so
+// it can update its counters with plain loads and stores, and no
+// cache line is shared between CPUs. An uncontended acquire costs
+// one rdtsc to start the hold timer; only a contended acquire
+// also times its spinning.
+
+struct lockcpu {
+  uint nacquire;   // acquisitions
+  uint ncontend;   // acquisitions that found the lock held
+  uint64 spin;     // cycles spent spinning
+  uint64 hold;     // cycles held
+  uint maxhold;    // longest hold, in cycles
+};
+
+static struct {
+  struct lockcpu cls[NLOCKCLASS];
+} __attribute__((aligned(64))) lockcpu[NCPU];
+
+// Class names; class 0 is not used. Classes are only added,
+// under classlock, which is a bare test-and-set lock because
+// it is used by initlock itself, some of it before mycpu()
+// works.
+static char *classname[NLOCKCLASS];
+static uint classlock;
+
+// Return the lock class named name, adding it if it is new,
+// or 0 if there are too many classes.
+static int
+lockclass(char *name)
+{
+  int c;
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&classlock, 1) != 0)
+    ;
+  for(c = 1; c < NLOCKCLASS && classname[c]; c++)
+    if(strncmp(classname[c], name, LOCKNAME) == 0)
+      break;
+  if(c < NLOCKCLASS && classname[c] == 0)
+    classname[c] = name;
+  xchg(&classlock, 0);
+  if(eflags & FL_IF)
+    sti();
+  return c < NLOCKCLASS ? c : 0;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
   lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->lclass = lockclass(name);
 }
 
 // Acquire the lock.
 // Loops (spins) until the lock is acquired.
 // Holding a lock for a long time may cause
 // other CPUs to waste time spinning to acquire it.
+//
+// By default a spinlock is a test-and-set lock. Waiters spin
+// reading locked, which stays in their own caches, and only
+// retry the xchg once it looks free. Kernels built with
+// TICKETLOCK=1 use ticket locks instead: each waiter takes
+// the next ticket and spins until owner reaches it, so CPUs
+// get the lock in the order they asked for it and none can
+// be starved.
 void
 acquire(struct spinlock *lk)
 {
+  struct lockcpu *ls;
+  uint64 t0;
+  int contended;
+#if TICKETLOCK
+  uint ticket;
+#endif
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
+  contended = 0;
+#if TICKETLOCK
+  // The fetch-and-add is atomic.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  if(*(volatile uint*)&lk->owner != ticket){
+    contended = 1;
+    t0 = rdtsc();
+    while(*(volatile uint*)&lk->owner != ticket)
+      pause();
+    t0 = rdtsc() - t0;
+  }
+  lk->locked = 1;
+#else
   // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  if(xchg(&lk->locked, 1) != 0){
+    contended = 1;
+    t0 = rdtsc();
+    do {
+      while(*(volatile uint*)&lk->locked)
+        pause();
+    } while(xchg(&lk->locked, 1) != 0);
+    t0 = rdtsc() - t0;
+  }
+#endif
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,15 +132,36 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+
+  if(lk->lclass){
+    ls = &lockcpu[lk->cpu - cpus].cls[lk->lclass];
+    ls->nacquire++;
+    if(contended){
+      ls->ncontend++;
+      ls->spin += t0;
+    }
+    lk->tacquire = rdtsc();
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  struct lockcpu *ls;
+  uint64 hold;
+
   if(!holding(lk))
     panic("release");
 
+  if(lk->lclass){
+    hold = rdtsc() - lk->tacquire;
+    ls = &lockcpu[lk->cpu - cpus].cls[lk->lclass];
+    ls->hold += hold;
+    if(hold > ls->maxhold)
+      ls->maxhold = hold > 0xffffffff ? 0xffffffff : hold;
+  }
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -63,10 +176,80 @@ release(struct spinlock *lk)
   // This code can't use a C assignment, since it might
   // not be atomic. A real OS would use C atomics here.
   asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+#if TICKETLOCK
+  // Serve the next ticket. Only the holder writes owner.
+  asm volatile("incl %0" : "+m" (lk->owner) : );
+#endif
 
   popcli();
 }
 
+// A lock for lockbench() alone, so that the benchmark
+// measures the lock itself and nothing else contends for it.
+// It is not in a lock class: it would be timed twice.
+static struct spinlock benchlock = { .name = "lockbench" };
+
+// Acquire and release benchlock iters times, holding it for
+// hold cycles each time and then waiting as long again before
+// the next try. Returns the longest time spent waiting to
+// acquire it, in cycles.
+int
+lockbench(int iters, int hold)
+{
+  uint64 t0, wait, maxwait;
+  int i;
+
+  maxwait = 0;
+  for(i = 0; i < iters; i++){
+    t0 = rdtsc();
+    acquire(&benchlock);
+    wait = rdtsc() - t0;
+    if(wait > maxwait)
+      maxwait = wait;
+    t0 = rdtsc();
+    while(rdtsc() - t0 < hold)
+      ;
+    release(&benchlock);
+    t0 = rdtsc();
+    while(rdtsc() - t0 < hold)
+      ;
+  }
+  return maxwait > 0x7fffffff ? 0x7fffffff : maxwait;
+}
+
+// Copy the statistics of up to n lock classes into st,
+// summed over all CPUs, and return how many were copied.
+// If reset is set, start counting again from zero; counts
+// taken by other CPUs while this runs may be lost.
+int
+lockstats(struct lockstat *st, int n, int reset)
+{
+  int c, i, k;
+  uint64 spin, hold;
+  struct lockcpu *ls;
+
+  k = 0;
+  for(c = 1; c < NLOCKCLASS && classname[c] && k < n; c++, k++){
+    memset(&st[k], 0, sizeof(st[k]));
+    safestrcpy(st[k].name, classname[c], LOCKNAME);
+    spin = hold = 0;
+    for(i = 0; i < ncpu; i++){
+      ls = &lockcpu[i].cls[c];
+      st[k].nacquire += ls->nacquire;
+      st[k].ncontend += ls->ncontend;
+      spin += ls->spin;
+      hold += ls->hold;
+      if(ls->maxhold > st[k].maxhold)
+        st[k].maxhold = ls->maxhold;
+      if(reset)
+        memset(ls, 0, sizeof(*ls));
+    }
+    st[k].spin = spin >> 10;
+    st[k].hold = hold >> 10;
+  }
+  return k;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
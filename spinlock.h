@@ -1,11 +1,17 @@
 // Mutual exclusion lock.
 struct spinlock {
   uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out (TICKETLOCK)
+  uint owner;        // Ticket being served (TICKETLOCK)
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For lock statistics (see spinlock.c):
+  int lclass;        // Lock class, 0 if not tracked.
+  uint64 tacquire;   // Time stamp counter when acquired.
 };
 
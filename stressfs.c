@@ -12,6 +12,49 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "logstat.h"
+
+// Run with -b to benchmark big sequential writes instead: write
+// a BENCHSIZE-byte file with write() calls of several sizes and
+// report how many log commits and how much time each size took.
+#define BENCHSIZE (64*1024)
+
+char big[BENCHSIZE];
+
+void
+bench(int size)
+{
+  struct logstat s0, s1;
+  int fd, i, t;
+
+  unlink("stressfs.b");
+  if((fd = open("stressfs.b", O_CREATE | O_RDWR)) < 0){
+    printf(1, "stressfs: cannot create stressfs.b\n");
+    exit();
+  }
+  getlogstat(&s0);
+  t = uptime();
+  for(i = 0; i < BENCHSIZE; i += size){
+    if(write(fd, big + i, size) != size){
+      printf(1, "stressfs: write failed\n");
+      exit();
+    }
+  }
+  t = uptime() - t;
+  getlogstat(&s1);
+  close(fd);
+  unlink("stressfs.b");
+
+  printf(1, "write size %d: %d commits, %d log blocks, %d absorbed, "
+         "%d installed in %d batches, %d ticks",
+         size, s1.ncommit - s0.ncommit, s1.nblocks - s0.nblocks,
+         s1.nabsorb - s0.nabsorb, s1.ninstall - s0.ninstall,
+         s1.nbatch - s0.nbatch, t);
+  // 100 ticks per second
+  if(t > 0)
+    printf(1, ", %d KB/s", BENCHSIZE / 1024 * 100 / t);
+  printf(1, "\n");
+}
 
 int
 main(int argc, char *argv[])
@@ -20,6 +63,15 @@ main(int argc, char *argv[])
   char path[] = "stressfs0";
   char data[512];
 
+  if(argc > 1 && strcmp(argv[1], "-b") == 0){
+    printf(1, "stressfs: writing %d bytes\n", BENCHSIZE);
+    memset(big, 'b', sizeof(big));
+    bench(512);
+    bench(4096);
+    bench(BENCHSIZE);
+    exit();
+  }
+
   printf(1, "stressfs starting\n");
   memset(data, 'a', sizeof(data));
 
@@ -1,6 +1,38 @@
 #include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
 #include "x86.h"
 
+// Copies of at least SSEMIN bytes use SSE2 when the kernel is
+// built with KSSE=1 and the CPU supports it. The SSE registers
+// may hold a user process's state, so they are saved around the
+// copy with fxsave, into a per-CPU area; interrupts stay off so
+// that nothing else on this CPU can use the area meanwhile.
+// That costs a few hundred cycles, so only page-sized copies
+// are worth it.
+#define SSEMIN 1024
+
+#if KSSE
+static int usesse;
+static uchar fxarea[NCPU][512] __attribute__((aligned(16)));
+#endif
+
+// Called on each CPU at boot to turn on SSE if the kernel
+// was built to use it.
+void
+sseinit(void)
+{
+#if KSSE
+  uint need = CPUID_FXSR|CPUID_SSE2;
+
+  if((cpufeatures() & need) != need)
+    return;
+  lcr4(rcr4() | CR4_OSFXSR);
+  usesse = 1;
+#endif
+}
+
 void*
 memset(void *dst, int c, uint n)
 {
@@ -16,9 +48,20 @@ int
 memcmp(const void *v1, const void *v2, uint n)
 {
   const uchar *s1, *s2;
-
-  s1 = v1;
-  s2 = v2;
+  const uint *w1, *w2;
+
+  // Skip equal words, 16 bytes at a time and then one at a time,
+  // then find the differing byte.
+  w1 = v1;
+  w2 = v2;
+  while(n >= 16 && w1[0] == w2[0] && w1[1] == w2[1] &&
+        w1[2] == w2[2] && w1[3] == w2[3])
+    w1 += 4, w2 += 4, n -= 16;
+  while(n >= 4 && *w1 == *w2)
+    w1++, w2++, n -= 4;
+
+  s1 = (const uchar*)w1;
+  s2 = (const uchar*)w2;
   while(n-- > 0){
     if(*s1 != *s2)
       return *s1 - *s2;
@@ -28,22 +71,82 @@ memcmp(const void *v1, const void *v2, uint n)
   return 0;
 }
 
+#if KSSE
+// Copy n bytes, a multiple of 64, with SSE2.
+static void
+ssecopy(char *d, const char *s, uint n)
+{
+  asm volatile("1: movdqu (%0), %%xmm0\n\t"
+               "movdqu 16(%0), %%xmm1\n\t"
+               "movdqu 32(%0), %%xmm2\n\t"
+               "movdqu 48(%0), %%xmm3\n\t"
+               "movdqu %%xmm0, (%1)\n\t"
+               "movdqu %%xmm1, 16(%1)\n\t"
+               "movdqu %%xmm2, 32(%1)\n\t"
+               "movdqu %%xmm3, 48(%1)\n\t"
+               "addl $64, %0\n\t"
+               "addl $64, %1\n\t"
+               "subl $64, %2\n\t"
+               "jnz 1b" :
+               "+r" (s), "+r" (d), "+r" (n) :
+               : "memory", "cc");
+}
+#endif
+
 void*
 memmove(void *dst, const void *src, uint n)
 {
   const char *s;
   char *d;
+  uint m;
+#if KSSE
+  uchar *area;
+#endif
 
   s = src;
   d = dst;
   if(s < d && s + n > d){
+    // Overlapping with dst above src: copy backward,
+    // a word at a time while there are whole words left.
     s += n;
     d += n;
+    for(; n >= 4; n -= 4){
+      d -= 4;
+      s -= 4;
+      *(uint*)d = *(const uint*)s;
+    }
     while(n-- > 0)
       *--d = *--s;
-  } else
-    while(n-- > 0)
+    return dst;
+  }
+
+  if(n >= 16){
+    // Align dst, so that the stores below are aligned.
+    while((uint)d % 4){
       *d++ = *s++;
+      n--;
+    }
+  }
+#if KSSE
+  if(usesse && n >= SSEMIN){
+    m = n & ~63;
+    pushcli();
+    area = fxarea[cpuid()];
+    fxsave(area);
+    ssecopy(d, s, m);
+    fxrstor(area);
+    popcli();
+    d += m;
+    s += m;
+    n -= m;
+  }
+#endif
+  m = n & ~3;
+  movsl(d, s, m/4);
+  d += m;
+  s += m;
+  for(n -= m; n > 0; n--)
+    *d++ = *s++;
 
   return dst;
 }
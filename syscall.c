@@ -6,6 +6,8 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "trace.h"
+#include "sysstat.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -27,7 +29,9 @@ fetchint(uint addr, int *ip)
 
 // Fetch the nul-terminated string at addr from the current process.
 // Doesn't actually copy the string - just sets *pp to point at it.
-// Returns length of string, not including nul.
+// Returns length of string, not including nul. Other threads can
+// still change the string, so use it in place only while the
+// process has none (as exec() does); otherwise use argstr().
 int
 fetchstr(uint addr, char **pp)
 {
@@ -54,32 +58,56 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+// lies within the process address space, and that the kernel
+// may write the block if write is set.
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
-  struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || uvmcheck((uint)i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
-// Fetch the nth word-sized system call argument as a string pointer.
-// Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// Fetch a pointer to a block the kernel will only read.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Fetch a pointer to a block the kernel will write into.
 int
-argstr(int n, char **pp)
+argptrw(int n, char **pp, int size)
 {
-  int addr;
+  return argbuf(n, pp, size, 1);
+}
+
+// Fetch the nth word-sized system call argument as a string and
+// copy it into buf, which holds max bytes including the nul.
+// The string is copied because another thread may write it, or
+// overwrite its nul, while the kernel is still using it.
+// Returns the length of the string, or -1 if it is not valid or
+// does not fit.
+int
+argstr(int n, char *buf, int max)
+{
+  char *s;
+  int addr, len;
+
   if(argint(n, &addr) < 0)
     return -1;
-  return fetchstr(addr, pp);
+  if((len = fetchstr(addr, &s)) < 0 || len >= max)
+    return -1;
+  // Threads cannot shrink the address space (see growproc),
+  // so the len bytes checked are still there to copy.
+  memmove(buf, s, len);
+  buf[len] = 0;
+  return len;
 }
 
 extern int sys_chdir(void);
@@ -116,6 +144,35 @@ extern int sys_getcpustats(void);
 extern int sys_setscheduler(void);
 extern int sys_getdeadlockinfo(void);
 extern int sys_getscheduler(void);
+extern int sys_splice(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_getlogstat(void);
+extern int sys_mount(void);
+extern int sys_umount(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_membench(void);
+extern int sys_getlockstat(void);
+extern int sys_lockbench(void);
+extern int sys_prof(void);
+extern int sys_tracectl(void);
+extern int sys_traceread(void);
+extern int sys_getsysstat(void);
+extern int sys_getwaitstat(void);
+extern int sys_getschedwait(void);
+extern int sys_mlfqread(void);
+extern int sys_dllock(void);
+extern int sys_watchdogctl(void);
+extern int sys_deadlocklog(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_poll(void);
 
 static int (*syscalls[])(void) = {
   [SYS_fork]           = sys_fork,
@@ -151,21 +208,119 @@ static int (*syscalls[])(void) = {
   [SYS_getcpustats]    = sys_getcpustats,
   [SYS_setscheduler]   = sys_setscheduler,
   [SYS_getdeadlockinfo]= sys_getdeadlockinfo,
-  [SYS_getscheduler]   = sys_getscheduler
+  [SYS_getscheduler]   = sys_getscheduler,
+  [SYS_splice]         = sys_splice,
+  [SYS_readv]          = sys_readv,
+  [SYS_writev]         = sys_writev,
+  [SYS_pread]          = sys_pread,
+  [SYS_pwrite]         = sys_pwrite,
+  [SYS_getlogstat]     = sys_getlogstat,
+  [SYS_mount]          = sys_mount,
+  [SYS_umount]         = sys_umount,
+  [SYS_mmap]           = sys_mmap,
+  [SYS_munmap]         = sys_munmap,
+  [SYS_membench]       = sys_membench,
+  [SYS_getlockstat]    = sys_getlockstat,
+  [SYS_lockbench]      = sys_lockbench,
+  [SYS_prof]           = sys_prof,
+  [SYS_tracectl]       = sys_tracectl,
+  [SYS_traceread]      = sys_traceread,
+  [SYS_getsysstat]     = sys_getsysstat,
+  [SYS_getwaitstat]    = sys_getwaitstat,
+  [SYS_getschedwait]   = sys_getschedwait,
+  [SYS_mlfqread]       = sys_mlfqread,
+  [SYS_dllock]         = sys_dllock,
+  [SYS_watchdogctl]    = sys_watchdogctl,
+  [SYS_deadlocklog]    = sys_deadlocklog,
+  [SYS_clone]          = sys_clone,
+  [SYS_join]           = sys_join,
+  [SYS_futex]          = sys_futex,
+  [SYS_shmat]          = sys_shmat,
+  [SYS_shmdt]          = sys_shmdt,
+  [SYS_poll]           = sys_poll
 };
 
+// Per-CPU system call counts and latency histograms.
+// A CPU updates only its own row, with interrupts off,
+// so the counters need no lock.
+struct syscpu {
+  uint ncall;
+  uint64 cycles;
+  uint hist[NSYSHIST];
+};
+
+static struct {
+  struct syscpu sc[NELEM(syscalls)];
+} __attribute__((aligned(64))) sysstats[NCPU];
+
+// Count a call to system call num that took t cycles.
+static void
+sysaccount(int num, uint64 t)
+{
+  struct syscpu *sc;
+  uint c;
+
+  c = t > 0xffffffff ? 0xffffffff : t;
+  pushcli();
+  sc = &sysstats[cpuid()].sc[num];
+  sc->ncall++;
+  sc->cycles += t;
+  sc->hist[c ? 31 - __builtin_clz(c) : 0]++;
+  popcli();
+}
+
 void
 syscall(void)
 {
   int num;
   struct proc *curproc = myproc();
+  uint64 t0;
 
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    curproc->nsyscall++;
+    ktrace(TE_SYSENTER, num, 0);
+    t0 = rdtsc();
     curproc->tf->eax = syscalls[num]();
+    sysaccount(num, rdtsc() - t0);
+    ktrace(TE_SYSEXIT, num, curproc->tf->eax);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
     curproc->tf->eax = -1;
   }
 }
+
+// Copy the statistics of system calls 0 to n-1, summed over all
+// CPUs, to the user, and optionally reset them. Returns the
+// number of entries copied.
+int
+sys_getsysstat(void)
+{
+  struct sysstat *st;
+  struct syscpu *sc;
+  uint64 cycles;
+  int n, reset, num, i, b;
+
+  if(argint(1, &n) < 0 || argint(2, &reset) < 0 || n < 0)
+    return -1;
+  if(n > NELEM(syscalls))
+    n = NELEM(syscalls);
+  if(argptrw(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  for(num = 0; num < n; num++){
+    memset(&st[num], 0, sizeof(st[num]));
+    cycles = 0;
+    for(i = 0; i < ncpu; i++){
+      sc = &sysstats[i].sc[num];
+      st[num].ncall += sc->ncall;
+      cycles += sc->cycles;
+      for(b = 0; b < NSYSHIST; b++)
+        st[num].hist[b] += sc->hist[b];
+      if(reset)
+        memset(sc, 0, sizeof(*sc));
+    }
+    st[num].cycles = cycles >> 10;
+  }
+  return n;
+}
@@ -33,3 +33,32 @@
 #define SYS_setscheduler 32
 #define SYS_getdeadlockinfo 33
 #define SYS_getscheduler 34
+#define SYS_splice 35
+#define SYS_readv 36
+#define SYS_writev 37
+#define SYS_pread 38
+#define SYS_pwrite 39
+#define SYS_getlogstat 40
+#define SYS_mount 41
+#define SYS_umount 42
+#define SYS_mmap 43
+#define SYS_munmap 44
+#define SYS_membench 45
+#define SYS_getlockstat 46
+#define SYS_lockbench 47
+#define SYS_prof 48
+#define SYS_tracectl 49
+#define SYS_traceread 50
+#define SYS_getsysstat 51
+#define SYS_getwaitstat 52
+#define SYS_getschedwait 53
+#define SYS_mlfqread 54
+#define SYS_dllock 55
+#define SYS_watchdogctl 56
+#define SYS_deadlocklog 57
+#define SYS_clone 58
+#define SYS_join 59
+#define SYS_futex 60
+#define SYS_shmat 61
+#define SYS_shmdt 62
+#define SYS_poll 63
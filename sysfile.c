@@ -15,79 +15,183 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "uio.h"
+#include "logstat.h"
+#include "poll.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return the corresponding struct file, with a reference of its
+// own, since another thread may close the descriptor meanwhile.
+// The caller must fileclose() it.
 static int
-argfd(int n, int *pfd, struct file **pf)
+argfd(int n, struct file **pf)
 {
   int fd;
+
+  if(argint(n, &fd) < 0 || (*pf = fdget(fd)) == 0)
+    return -1;
+  return 0;
+}
+
+int
+sys_dup(void)
+{
   struct file *f;
+  int fd;
 
-  if(argint(n, &fd) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if((fd=fdalloc(f)) < 0)
+    fileclose(f);
+  return fd;
+}
+
+int
+sys_read(void)
+{
+  struct file *f;
+  int n, r;
+  char *p;
+
+  if(argfd(0, &f) < 0)
     return -1;
-  if(pfd)
-    *pfd = fd;
-  if(pf)
-    *pf = f;
-  return 0;
+  r = -1;
+  if(argint(2, &n) >= 0 && argptrw(1, &p, n) >= 0)
+    r = fileread(f, p, n);
+  fileclose(f);
+  return r;
+}
+
+int
+sys_write(void)
+{
+  struct file *f;
+  int n, r;
+  char *p;
+
+  if(argfd(0, &f) < 0)
+    return -1;
+  r = -1;
+  if(argint(2, &n) >= 0 && argptr(1, &p, n) >= 0)
+    r = filewrite(f, p, n);
+  fileclose(f);
+  return r;
+}
+
+// Move up to n bytes from fdin to fdout without copying
+// them through user space.
+int
+sys_splice(void)
+{
+  struct file *fin, *fout;
+  int n, r;
+
+  if(argfd(0, &fin) < 0)
+    return -1;
+  if(argfd(1, &fout) < 0){
+    fileclose(fin);
+    return -1;
+  }
+  r = -1;
+  if(argint(2, &n) >= 0)
+    r = filesplice(fin, fout, n);
+  fileclose(fin);
+  fileclose(fout);
+  return r;
 }
 
-// Allocate a file descriptor for the given file.
-// Takes over file reference from caller on success.
+// Fetch the iovec array that is system call argument n, whose
+// length is argument n+1, into iov[], checking that every buffer
+// lies within the process address space, and that the kernel may
+// write the buffers if write is set.
 static int
-fdalloc(struct file *f)
+argiov(int n, struct iovec *iov, int *piovcnt, int write)
 {
-  int fd;
-  struct proc *curproc = myproc();
+  struct iovec *uiov;
+  uint tot;
+  int i, iovcnt;
 
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
-      return fd;
-    }
+  if(argint(n+1, &iovcnt) < 0 || iovcnt < 0 || iovcnt > IOV_MAX)
+    return -1;
+  if(argptr(n, (void*)&uiov, iovcnt*sizeof(*uiov)) < 0)
+    return -1;
+  tot = 0;
+  for(i = 0; i < iovcnt; i++){
+    iov[i] = uiov[i];
+    if(uvmcheck((uint)iov[i].iov_base, iov[i].iov_len, write) < 0)
+      return -1;
+    // The total is returned as an int.
+    if((tot += iov[i].iov_len) > 0x7fffffff)
+      return -1;
   }
-  return -1;
+  *piovcnt = iovcnt;
+  return 0;
 }
 
 int
-sys_dup(void)
+sys_readv(void)
 {
   struct file *f;
-  int fd;
+  struct iovec iov[IOV_MAX];
+  int iovcnt, r;
 
-  if(argfd(0, 0, &f) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  if((fd=fdalloc(f)) < 0)
+  r = -1;
+  if(argiov(1, iov, &iovcnt, 1) >= 0)
+    r = filereadv(f, iov, iovcnt);
+  fileclose(f);
+  return r;
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int iovcnt, r;
+
+  if(argfd(0, &f) < 0)
     return -1;
-  filedup(f);
-  return fd;
+  r = -1;
+  if(argiov(1, iov, &iovcnt, 0) >= 0)
+    r = filewritev(f, iov, iovcnt);
+  fileclose(f);
+  return r;
 }
 
 int
-sys_read(void)
+sys_pread(void)
 {
   struct file *f;
-  int n;
+  int n, off, r;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return fileread(f, p, n);
+  r = -1;
+  if(argint(2, &n) >= 0 && argptrw(1, &p, n) >= 0 &&
+     argint(3, &off) >= 0 && off >= 0)
+    r = filepread(f, p, n, off);
+  fileclose(f);
+  return r;
 }
 
 int
-sys_write(void)
+sys_pwrite(void)
 {
   struct file *f;
-  int n;
+  int n, off, r;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return filewrite(f, p, n);
+  r = -1;
+  if(argint(2, &n) >= 0 && argptr(1, &p, n) >= 0 &&
+     argint(3, &off) >= 0 && off >= 0)
+    r = filepwrite(f, p, n, off);
+  fileclose(f);
+  return r;
 }
 
 int
@@ -96,9 +200,8 @@ sys_close(void)
   int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argint(0, &fd) < 0 || (f = fdfree(fd)) == 0)
     return -1;
-  myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -108,20 +211,25 @@ sys_fstat(void)
 {
   struct file *f;
   struct stat *st;
+  int r;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return filestat(f, st);
+  r = -1;
+  if(argptrw(1, (void*)&st, sizeof(*st)) >= 0)
+    r = filestat(f, st);
+  fileclose(f);
+  return r;
 }
 
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char name[DIRSIZ], new[MAXPATH], old[MAXPATH];
   struct inode *dp, *ip;
 
-  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+  if(argstr(0, old, sizeof(old)) < 0 || argstr(1, new, sizeof(new)) < 0)
     return -1;
 
   begin_op();
@@ -186,10 +294,10 @@ sys_unlink(void)
 {
   struct inode *ip, *dp;
   struct dirent de;
-  char name[DIRSIZ], *path;
+  char name[DIRSIZ], path[MAXPATH];
   uint off;
 
-  if(argstr(0, &path) < 0)
+  if(argstr(0, path, sizeof(path)) < 0)
     return -1;
 
   begin_op();
@@ -210,7 +318,7 @@ sys_unlink(void)
 
   if(ip->nlink < 1)
     panic("unlink: nlink < 1");
-  if(ip->type == T_DIR && !isdirempty(ip)){
+  if(ip->type == T_DIR && (!isdirempty(ip) || ismountpoint(ip))){
     iunlockput(ip);
     goto bad;
   }
@@ -285,12 +393,12 @@ create(char *path, short type, short major, short minor)
 int
 sys_open(void)
 {
-  char *path;
+  char path[MAXPATH];
   int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+  if(argstr(0, path, sizeof(path)) < 0 || argint(1, &omode) < 0)
     return -1;
 
   begin_op();
@@ -314,9 +422,7 @@ sys_open(void)
     }
   }
 
-  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
-    if(f)
-      fileclose(f);
+  if((f = filealloc()) == 0){
     iunlockput(ip);
     end_op();
     return -1;
@@ -324,22 +430,25 @@ sys_open(void)
   iunlock(ip);
   end_op();
 
+  // Set f up before another thread can reach it through fd.
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  if((fd = fdalloc(f)) < 0)
+    fileclose(f);
   return fd;
 }
 
 int
 sys_mkdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
 
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  if(argstr(0, path, sizeof(path)) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
   }
@@ -352,11 +461,11 @@ int
 sys_mknod(void)
 {
   struct inode *ip;
-  char *path;
+  char path[MAXPATH];
   int major, minor;
 
   begin_op();
-  if((argstr(0, &path)) < 0 ||
+  if((argstr(0, path, sizeof(path))) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
      (ip = create(path, T_DEV, major, minor)) == 0){
@@ -371,12 +480,11 @@ sys_mknod(void)
 int
 sys_chdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
-  struct proc *curproc = myproc();
-  
+
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+  if(argstr(0, path, sizeof(path)) < 0 || (ip = namei(path)) == 0){
     end_op();
     return -1;
   }
@@ -387,20 +495,66 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(curproc->cwd);
+  iput(cwdset(ip));
   end_op();
-  curproc->cwd = ip;
   return 0;
 }
 
+// Mount a new tmpfs on the directory path.
+int
+sys_mount(void)
+{
+  char path[MAXPATH];
+  struct inode *ip;
+
+  begin_op();
+  if(argstr(0, path, sizeof(path)) < 0 || (ip = namei(path)) == 0){
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+  if(ip->type != T_DIR || (ip->dev == ROOTDEV && ip->inum == ROOTINO)){
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+  if(mount(ip) < 0){
+    iput(ip);
+    end_op();
+    return -1;
+  }
+  end_op();
+  return 0;
+}
+
+// Unmount the file system mounted on path.
+int
+sys_umount(void)
+{
+  char path[MAXPATH];
+  struct inode *ip;
+  int r;
+
+  begin_op();
+  if(argstr(0, path, sizeof(path)) < 0 || (ip = namei(path)) == 0){
+    end_op();
+    return -1;
+  }
+  r = umount(ip);
+  iput(ip);
+  end_op();
+  return r;
+}
+
 int
 sys_exec(void)
 {
-  char *path, *argv[MAXARG];
+  char path[MAXPATH], *argv[MAXARG];
   int i;
   uint uargv, uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argstr(0, path, sizeof(path)) < 0 || argint(1, (int*)&uargv) < 0){
     return -1;
   }
   memset(argv, 0, sizeof(argv));
@@ -426,14 +580,14 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      fdfree(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -442,3 +596,75 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_poll(void)
+{
+  struct pollfd *fds;
+  int n, timeout;
+
+  if(argint(1, &n) < 0 || argint(2, &timeout) < 0)
+    return -1;
+  if(n < 0 || n > NOFILE)
+    return -1;
+  if(argptrw(0, (void*)&fds, n*sizeof(*fds)) < 0)
+    return -1;
+  return poll(fds, n, timeout);
+}
+
+int
+sys_getlogstat(void)
+{
+  struct logstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  logstat(st);
+  return 0;
+}
+
+// Map a file into memory.
+// The address argument is a hint that this kernel ignores.
+int
+sys_mmap(void)
+{
+  struct file *f;
+  int len, prot, flags, off, r;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+     argint(5, &off) < 0 || off < 0 || argfd(4, &f) < 0)
+    return -1;
+  r = mmap(f, off, len, prot, flags);
+  fileclose(f);
+  return r;
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  return munmap(addr, len);
+}
+
+int
+sys_shmat(void)
+{
+  int key, size;
+
+  if(argint(0, &key) < 0 || argint(1, &size) < 0)
+    return -1;
+  return shmat(key, size);
+}
+
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(addr);
+}
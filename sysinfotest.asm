@@ -0,0 +1,1684 @@
+
+_sysinfotest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+struct sysinfo {
+    int nproc;
+    uint ticks;
+};
+
+int main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+    struct sysinfo info;
+    if(getsysinfo(&info) < 0){
+   e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+int main(void) {
+  11:	83 ec 20             	sub    $0x20,%esp
+    if(getsysinfo(&info) < 0){
+  14:	50                   	push   %eax
+  15:	e8 19 03 00 00       	call   333 <getsysinfo>
+  1a:	83 c4 10             	add    $0x10,%esp
+  1d:	85 c0                	test   %eax,%eax
+  1f:	78 17                	js     38 <main+0x38>
+        printf(1, "sysinfotest: failed\n");
+        exit();
+    }
+    printf(1, "Running processes: %d, Uptime: %d ticks\n", info.nproc, info.ticks);
+  21:	ff 75 f4             	push   -0xc(%ebp)
+  24:	ff 75 f0             	push   -0x10(%ebp)
+  27:	68 b8 0a 00 00       	push   $0xab8
+  2c:	6a 01                	push   $0x1
+  2e:	e8 fd 04 00 00       	call   530 <printf>
+    exit();
+  33:	e8 5b 02 00 00       	call   293 <exit>
+        printf(1, "sysinfotest: failed\n");
+  38:	50                   	push   %eax
+  39:	50                   	push   %eax
+  3a:	68 a0 0a 00 00       	push   $0xaa0
+  3f:	6a 01                	push   $0x1
+  41:	e8 ea 04 00 00       	call   530 <printf>
+        exit();
+  46:	e8 48 02 00 00       	call   293 <exit>
+  4b:	66 90                	xchg   %ax,%ax
+  4d:	66 90                	xchg   %ax,%ax
+  4f:	90                   	nop
+
+00000050 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  50:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  51:	31 c0                	xor    %eax,%eax
+{
+  53:	89 e5                	mov    %esp,%ebp
+  55:	53                   	push   %ebx
+  56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  60:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  64:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  67:	83 c0 01             	add    $0x1,%eax
+  6a:	84 d2                	test   %dl,%dl
+  6c:	75 f2                	jne    60 <strcpy+0x10>
+    ;
+  return os;
+}
+  6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  71:	89 c8                	mov    %ecx,%eax
+  73:	c9                   	leave
+  74:	c3                   	ret
+  75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000080 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	53                   	push   %ebx
+  84:	8b 55 08             	mov    0x8(%ebp),%edx
+  87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  8a:	0f b6 02             	movzbl (%edx),%eax
+  8d:	84 c0                	test   %al,%al
+  8f:	75 17                	jne    a8 <strcmp+0x28>
+  91:	eb 3a                	jmp    cd <strcmp+0x4d>
+  93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  97:	90                   	nop
+  98:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  9c:	83 c2 01             	add    $0x1,%edx
+  9f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  a2:	84 c0                	test   %al,%al
+  a4:	74 1a                	je     c0 <strcmp+0x40>
+    p++, q++;
+  a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  a8:	0f b6 19             	movzbl (%ecx),%ebx
+  ab:	38 c3                	cmp    %al,%bl
+  ad:	74 e9                	je     98 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  af:	29 d8                	sub    %ebx,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+  b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  c4:	31 c0                	xor    %eax,%eax
+  c6:	29 d8                	sub    %ebx,%eax
+}
+  c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  cd:	0f b6 19             	movzbl (%ecx),%ebx
+  d0:	31 c0                	xor    %eax,%eax
+  d2:	eb db                	jmp    af <strcmp+0x2f>
+  d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  df:	90                   	nop
+
+000000e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  e6:	80 3a 00             	cmpb   $0x0,(%edx)
+  e9:	74 15                	je     100 <strlen+0x20>
+  eb:	31 c0                	xor    %eax,%eax
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  f0:	83 c0 01             	add    $0x1,%eax
+  f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  f7:	89 c1                	mov    %eax,%ecx
+  f9:	75 f5                	jne    f0 <strlen+0x10>
+    ;
+  return n;
+}
+  fb:	89 c8                	mov    %ecx,%eax
+  fd:	5d                   	pop    %ebp
+  fe:	c3                   	ret
+  ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 100:	31 c9                	xor    %ecx,%ecx
+}
+ 102:	5d                   	pop    %ebp
+ 103:	89 c8                	mov    %ecx,%eax
+ 105:	c3                   	ret
+ 106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000110 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	57                   	push   %edi
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 117:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	89 d7                	mov    %edx,%edi
+ 11f:	fc                   	cld
+ 120:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 122:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 125:	89 d0                	mov    %edx,%eax
+ 127:	c9                   	leave
+ 128:	c3                   	ret
+ 129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	8b 45 08             	mov    0x8(%ebp),%eax
+ 136:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 13a:	0f b6 10             	movzbl (%eax),%edx
+ 13d:	84 d2                	test   %dl,%dl
+ 13f:	75 12                	jne    153 <strchr+0x23>
+ 141:	eb 1d                	jmp    160 <strchr+0x30>
+ 143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 147:	90                   	nop
+ 148:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 14c:	83 c0 01             	add    $0x1,%eax
+ 14f:	84 d2                	test   %dl,%dl
+ 151:	74 0d                	je     160 <strchr+0x30>
+    if(*s == c)
+ 153:	38 d1                	cmp    %dl,%cl
+ 155:	75 f1                	jne    148 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 157:	5d                   	pop    %ebp
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 160:	31 c0                	xor    %eax,%eax
+}
+ 162:	5d                   	pop    %ebp
+ 163:	c3                   	ret
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 175:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 178:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 179:	31 db                	xor    %ebx,%ebx
+{
+ 17b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 17e:	eb 27                	jmp    1a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 180:	83 ec 04             	sub    $0x4,%esp
+ 183:	6a 01                	push   $0x1
+ 185:	56                   	push   %esi
+ 186:	6a 00                	push   $0x0
+ 188:	e8 1e 01 00 00       	call   2ab <read>
+    if(cc < 1)
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	85 c0                	test   %eax,%eax
+ 192:	7e 1d                	jle    1b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 194:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 198:	8b 55 08             	mov    0x8(%ebp),%edx
+ 19b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 19f:	3c 0a                	cmp    $0xa,%al
+ 1a1:	74 10                	je     1b3 <gets+0x43>
+ 1a3:	3c 0d                	cmp    $0xd,%al
+ 1a5:	74 0c                	je     1b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1a7:	89 df                	mov    %ebx,%edi
+ 1a9:	83 c3 01             	add    $0x1,%ebx
+ 1ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1af:	7c cf                	jl     180 <gets+0x10>
+ 1b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1bd:	5b                   	pop    %ebx
+ 1be:	5e                   	pop    %esi
+ 1bf:	5f                   	pop    %edi
+ 1c0:	5d                   	pop    %ebp
+ 1c1:	c3                   	ret
+ 1c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	56                   	push   %esi
+ 1d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1d5:	83 ec 08             	sub    $0x8,%esp
+ 1d8:	6a 00                	push   $0x0
+ 1da:	ff 75 08             	push   0x8(%ebp)
+ 1dd:	e8 f1 00 00 00       	call   2d3 <open>
+  if(fd < 0)
+ 1e2:	83 c4 10             	add    $0x10,%esp
+ 1e5:	85 c0                	test   %eax,%eax
+ 1e7:	78 27                	js     210 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1e9:	83 ec 08             	sub    $0x8,%esp
+ 1ec:	ff 75 0c             	push   0xc(%ebp)
+ 1ef:	89 c3                	mov    %eax,%ebx
+ 1f1:	50                   	push   %eax
+ 1f2:	e8 f4 00 00 00       	call   2eb <fstat>
+  close(fd);
+ 1f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1fc:	e8 ba 00 00 00       	call   2bb <close>
+  return r;
+ 201:	83 c4 10             	add    $0x10,%esp
+}
+ 204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 207:	89 f0                	mov    %esi,%eax
+ 209:	5b                   	pop    %ebx
+ 20a:	5e                   	pop    %esi
+ 20b:	5d                   	pop    %ebp
+ 20c:	c3                   	ret
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 210:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 215:	eb ed                	jmp    204 <stat+0x34>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 227:	0f be 02             	movsbl (%edx),%eax
+ 22a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 22d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 235:	77 1e                	ja     255 <atoi+0x35>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 240:	83 c2 01             	add    $0x1,%edx
+ 243:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 246:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 24a:	0f be 02             	movsbl (%edx),%eax
+ 24d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 250:	80 fb 09             	cmp    $0x9,%bl
+ 253:	76 eb                	jbe    240 <atoi+0x20>
+  return n;
+}
+ 255:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 258:	89 c8                	mov    %ecx,%eax
+ 25a:	c9                   	leave
+ 25b:	c3                   	ret
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+ 265:	8b 45 10             	mov    0x10(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 26e:	85 c0                	test   %eax,%eax
+ 270:	7e 13                	jle    285 <memmove+0x25>
+ 272:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 274:	89 d7                	mov    %edx,%edi
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 280:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 281:	39 f8                	cmp    %edi,%eax
+ 283:	75 fb                	jne    280 <memmove+0x20>
+  return vdst;
+}
+ 285:	5e                   	pop    %esi
+ 286:	89 d0                	mov    %edx,%eax
+ 288:	5f                   	pop    %edi
+ 289:	5d                   	pop    %ebp
+ 28a:	c3                   	ret
+
+0000028b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 28b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <exit>:
+SYSCALL(exit)
+ 293:	b8 02 00 00 00       	mov    $0x2,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <wait>:
+SYSCALL(wait)
+ 29b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <pipe>:
+SYSCALL(pipe)
+ 2a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <read>:
+SYSCALL(read)
+ 2ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <write>:
+SYSCALL(write)
+ 2b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <close>:
+SYSCALL(close)
+ 2bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <kill>:
+SYSCALL(kill)
+ 2c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <exec>:
+SYSCALL(exec)
+ 2cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <open>:
+SYSCALL(open)
+ 2d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mknod>:
+SYSCALL(mknod)
+ 2db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <unlink>:
+SYSCALL(unlink)
+ 2e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <fstat>:
+SYSCALL(fstat)
+ 2eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <link>:
+SYSCALL(link)
+ 2f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mkdir>:
+SYSCALL(mkdir)
+ 2fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <chdir>:
+SYSCALL(chdir)
+ 303:	b8 09 00 00 00       	mov    $0x9,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <dup>:
+SYSCALL(dup)
+ 30b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <getpid>:
+SYSCALL(getpid)
+ 313:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <sbrk>:
+SYSCALL(sbrk)
+ 31b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <sleep>:
+SYSCALL(sleep)
+ 323:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <uptime>:
+SYSCALL(uptime)
+ 32b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 333:	b8 16 00 00 00       	mov    $0x16,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 33b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 343:	b8 18 00 00 00       	mov    $0x18,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 34b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 353:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 35b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 363:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <setpriority>:
+SYSCALL(setpriority)
+ 36b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 373:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <getcpustats>:
+SYSCALL(getcpustats)
+ 37b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <setscheduler>:
+SYSCALL(setscheduler)
+ 383:	b8 20 00 00 00       	mov    $0x20,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 38b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getscheduler>:
+SYSCALL(getscheduler)
+ 393:	b8 22 00 00 00       	mov    $0x22,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <splice>:
+SYSCALL(splice)
+ 39b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <readv>:
+SYSCALL(readv)
+ 3a3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <writev>:
+SYSCALL(writev)
+ 3ab:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <pread>:
+SYSCALL(pread)
+ 3b3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <pwrite>:
+SYSCALL(pwrite)
+ 3bb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <getlogstat>:
+SYSCALL(getlogstat)
+ 3c3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mount>:
+SYSCALL(mount)
+ 3cb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <umount>:
+SYSCALL(umount)
+ 3d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mmap>:
+SYSCALL(mmap)
+ 3db:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <munmap>:
+SYSCALL(munmap)
+ 3e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <membench>:
+SYSCALL(membench)
+ 3eb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getlockstat>:
+SYSCALL(getlockstat)
+ 3f3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <lockbench>:
+SYSCALL(lockbench)
+ 3fb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <prof>:
+SYSCALL(prof)
+ 403:	b8 30 00 00 00       	mov    $0x30,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <tracectl>:
+SYSCALL(tracectl)
+ 40b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <traceread>:
+SYSCALL(traceread)
+ 413:	b8 32 00 00 00       	mov    $0x32,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getsysstat>:
+SYSCALL(getsysstat)
+ 41b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 423:	b8 34 00 00 00       	mov    $0x34,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <getschedwait>:
+SYSCALL(getschedwait)
+ 42b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <mlfqread>:
+SYSCALL(mlfqread)
+ 433:	b8 36 00 00 00       	mov    $0x36,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dllock>:
+SYSCALL(dllock)
+ 43b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 443:	b8 38 00 00 00       	mov    $0x38,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 44b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <clone>:
+SYSCALL(clone)
+ 453:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <join>:
+SYSCALL(join)
+ 45b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <futex>:
+SYSCALL(futex)
+ 463:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <shmat>:
+SYSCALL(shmat)
+ 46b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <shmdt>:
+SYSCALL(shmdt)
+ 473:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <poll>:
+SYSCALL(poll)
+ 47b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+ 483:	66 90                	xchg   %ax,%ax
+ 485:	66 90                	xchg   %ax,%ax
+ 487:	66 90                	xchg   %ax,%ax
+ 489:	66 90                	xchg   %ax,%ax
+ 48b:	66 90                	xchg   %ax,%ax
+ 48d:	66 90                	xchg   %ax,%ax
+ 48f:	90                   	nop
+
+00000490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 498:	89 d1                	mov    %edx,%ecx
+{
+ 49a:	83 ec 3c             	sub    $0x3c,%esp
+ 49d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	85 d2                	test   %edx,%edx
+ 4a2:	0f 89 80 00 00 00    	jns    528 <printint+0x98>
+ 4a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ac:	74 7a                	je     528 <printint+0x98>
+    x = -xx;
+ 4ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4b8:	31 f6                	xor    %esi,%esi
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4c0:	89 c8                	mov    %ecx,%eax
+ 4c2:	31 d2                	xor    %edx,%edx
+ 4c4:	89 f7                	mov    %esi,%edi
+ 4c6:	f7 f3                	div    %ebx
+ 4c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4cb:	0f b6 92 40 0b 00 00 	movzbl 0xb40(%edx),%edx
+ 4d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4d6:	89 ca                	mov    %ecx,%edx
+ 4d8:	89 c1                	mov    %eax,%ecx
+ 4da:	39 da                	cmp    %ebx,%edx
+ 4dc:	73 e2                	jae    4c0 <printint+0x30>
+  if(neg)
+ 4de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4e1:	85 c0                	test   %eax,%eax
+ 4e3:	74 07                	je     4ec <printint+0x5c>
+    buf[i++] = '-';
+ 4e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ea:	89 f7                	mov    %esi,%edi
+ 4ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4f2:	01 df                	add    %ebx,%edi
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4fb:	83 ec 04             	sub    $0x4,%esp
+ 4fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 501:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 504:	6a 01                	push   $0x1
+ 506:	50                   	push   %eax
+ 507:	56                   	push   %esi
+ 508:	e8 a6 fd ff ff       	call   2b3 <write>
+  while(--i >= 0)
+ 50d:	89 f8                	mov    %edi,%eax
+ 50f:	83 c4 10             	add    $0x10,%esp
+ 512:	83 ef 01             	sub    $0x1,%edi
+ 515:	39 d8                	cmp    %ebx,%eax
+ 517:	75 df                	jne    4f8 <printint+0x68>
+}
+ 519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51c:	5b                   	pop    %ebx
+ 51d:	5e                   	pop    %esi
+ 51e:	5f                   	pop    %edi
+ 51f:	5d                   	pop    %ebp
+ 520:	c3                   	ret
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 528:	31 c0                	xor    %eax,%eax
+ 52a:	eb 89                	jmp    4b5 <printint+0x25>
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 539:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 53c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 53f:	0f b6 1e             	movzbl (%esi),%ebx
+ 542:	83 c6 01             	add    $0x1,%esi
+ 545:	84 db                	test   %bl,%bl
+ 547:	74 67                	je     5b0 <printf+0x80>
+ 549:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 54c:	31 d2                	xor    %edx,%edx
+ 54e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 551:	eb 34                	jmp    587 <printf+0x57>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 55b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 560:	83 f8 25             	cmp    $0x25,%eax
+ 563:	74 18                	je     57d <printf+0x4d>
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 56b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 56e:	6a 01                	push   $0x1
+ 570:	50                   	push   %eax
+ 571:	57                   	push   %edi
+ 572:	e8 3c fd ff ff       	call   2b3 <write>
+ 577:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 57a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 57d:	0f b6 1e             	movzbl (%esi),%ebx
+ 580:	83 c6 01             	add    $0x1,%esi
+ 583:	84 db                	test   %bl,%bl
+ 585:	74 29                	je     5b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 587:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 58a:	85 d2                	test   %edx,%edx
+ 58c:	74 ca                	je     558 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 58e:	83 fa 25             	cmp    $0x25,%edx
+ 591:	75 ea                	jne    57d <printf+0x4d>
+      if(c == 'd'){
+ 593:	83 f8 25             	cmp    $0x25,%eax
+ 596:	0f 84 24 01 00 00    	je     6c0 <printf+0x190>
+ 59c:	83 e8 63             	sub    $0x63,%eax
+ 59f:	83 f8 15             	cmp    $0x15,%eax
+ 5a2:	77 1c                	ja     5c0 <printf+0x90>
+ 5a4:	ff 24 85 e8 0a 00 00 	jmp    *0xae8(,%eax,4)
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b3:	5b                   	pop    %ebx
+ 5b4:	5e                   	pop    %esi
+ 5b5:	5f                   	pop    %edi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ca:	6a 01                	push   $0x1
+ 5cc:	52                   	push   %edx
+ 5cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5d0:	57                   	push   %edi
+ 5d1:	e8 dd fc ff ff       	call   2b3 <write>
+ 5d6:	83 c4 0c             	add    $0xc,%esp
+ 5d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5dc:	6a 01                	push   $0x1
+ 5de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5e1:	52                   	push   %edx
+ 5e2:	57                   	push   %edi
+ 5e3:	e8 cb fc ff ff       	call   2b3 <write>
+        putc(fd, c);
+ 5e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5eb:	31 d2                	xor    %edx,%edx
+ 5ed:	eb 8e                	jmp    57d <printf+0x4d>
+ 5ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 00                	push   $0x0
+ 5ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 601:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 604:	e8 87 fe ff ff       	call   490 <printint>
+        ap++;
+ 609:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 60c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 67 ff ff ff       	jmp    57d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 623:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 625:	83 c0 04             	add    $0x4,%eax
+ 628:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 62b:	85 db                	test   %ebx,%ebx
+ 62d:	0f 84 9d 00 00 00    	je     6d0 <printf+0x1a0>
+        while(*s != 0){
+ 633:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 636:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 638:	84 c0                	test   %al,%al
+ 63a:	0f 84 3d ff ff ff    	je     57d <printf+0x4d>
+ 640:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 643:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 646:	89 de                	mov    %ebx,%esi
+ 648:	89 d3                	mov    %edx,%ebx
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 656:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	53                   	push   %ebx
+ 65c:	57                   	push   %edi
+ 65d:	e8 51 fc ff ff       	call   2b3 <write>
+        while(*s != 0){
+ 662:	0f b6 06             	movzbl (%esi),%eax
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	84 c0                	test   %al,%al
+ 66a:	75 e4                	jne    650 <printf+0x120>
+      state = 0;
+ 66c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 07 ff ff ff       	jmp    57d <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 01                	push   $0x1
+ 68f:	e9 6b ff ff ff       	jmp    5ff <printf+0xcf>
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 698:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	52                   	push   %edx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 01 fc ff ff       	call   2b3 <write>
+        ap++;
+ 6b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6b8:	31 d2                	xor    %edx,%edx
+ 6ba:	e9 be fe ff ff       	jmp    57d <printf+0x4d>
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	e9 11 ff ff ff       	jmp    5e1 <printf+0xb1>
+ 6d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6d5:	bb e1 0a 00 00       	mov    $0xae1,%ebx
+ 6da:	e9 61 ff ff ff       	jmp    640 <printf+0x110>
+ 6df:	90                   	nop
+
+000006e0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e3:	a1 54 0f 00 00       	mov    0xf54,%eax
+{
+ 6e8:	89 e5                	mov    %esp,%ebp
+ 6ea:	56                   	push   %esi
+ 6eb:	53                   	push   %ebx
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f4:	39 ca                	cmp    %ecx,%edx
+ 6f6:	73 30                	jae    728 <bigfree+0x48>
+ 6f8:	39 c1                	cmp    %eax,%ecx
+ 6fa:	72 04                	jb     700 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fc:	39 c2                	cmp    %eax,%edx
+ 6fe:	72 f0                	jb     6f0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 700:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 703:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 706:	39 f0                	cmp    %esi,%eax
+ 708:	74 26                	je     730 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 70a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 70c:	8b 42 04             	mov    0x4(%edx),%eax
+ 70f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 712:	39 d9                	cmp    %ebx,%ecx
+ 714:	74 30                	je     746 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 716:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 718:	5b                   	pop    %ebx
+  freep = p;
+ 719:	89 15 54 0f 00 00    	mov    %edx,0xf54
+}
+ 71f:	5e                   	pop    %esi
+ 720:	5d                   	pop    %ebp
+ 721:	c3                   	ret
+ 722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 728:	39 c1                	cmp    %eax,%ecx
+ 72a:	72 d0                	jb     6fc <bigfree+0x1c>
+ 72c:	eb c2                	jmp    6f0 <bigfree+0x10>
+ 72e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 730:	03 58 04             	add    0x4(%eax),%ebx
+ 733:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 736:	8b 02                	mov    (%edx),%eax
+ 738:	8b 00                	mov    (%eax),%eax
+ 73a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 73c:	8b 42 04             	mov    0x4(%edx),%eax
+ 73f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 742:	39 d9                	cmp    %ebx,%ecx
+ 744:	75 d0                	jne    716 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 746:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 749:	89 15 54 0f 00 00    	mov    %edx,0xf54
+    p->s.size += bp->s.size;
+ 74f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 752:	8b 09                	mov    (%ecx),%ecx
+ 754:	89 0a                	mov    %ecx,(%edx)
+}
+ 756:	5b                   	pop    %ebx
+ 757:	5e                   	pop    %esi
+ 758:	5d                   	pop    %ebp
+ 759:	c3                   	ret
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000760 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	89 c7                	mov    %eax,%edi
+ 766:	56                   	push   %esi
+ 767:	53                   	push   %ebx
+ 768:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 76b:	a1 54 0f 00 00       	mov    0xf54,%eax
+ 770:	85 c0                	test   %eax,%eax
+ 772:	0f 84 88 00 00 00    	je     800 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 778:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 77a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 77d:	39 f9                	cmp    %edi,%ecx
+ 77f:	73 5f                	jae    7e0 <bigalloc+0x80>
+  if(nu < 4096)
+ 781:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 786:	39 df                	cmp    %ebx,%edi
+ 788:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 78b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 792:	eb 0d                	jmp    7a1 <bigalloc+0x41>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 798:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 79a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 79d:	39 f9                	cmp    %edi,%ecx
+ 79f:	73 3f                	jae    7e0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 7a1:	89 d0                	mov    %edx,%eax
+ 7a3:	39 15 54 0f 00 00    	cmp    %edx,0xf54
+ 7a9:	75 ed                	jne    798 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 7ab:	83 ec 0c             	sub    $0xc,%esp
+ 7ae:	56                   	push   %esi
+ 7af:	e8 67 fb ff ff       	call   31b <sbrk>
+  if(p == (char*)-1)
+ 7b4:	83 c4 10             	add    $0x10,%esp
+ 7b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7ba:	74 11                	je     7cd <bigalloc+0x6d>
+  hp->s.size = nu;
+ 7bc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 7bf:	e8 1c ff ff ff       	call   6e0 <bigfree>
+  return freep;
+ 7c4:	a1 54 0f 00 00       	mov    0xf54,%eax
+      if((p = morecore(nunits)) == 0)
+ 7c9:	85 c0                	test   %eax,%eax
+ 7cb:	75 cb                	jne    798 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 7cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7d0:	31 d2                	xor    %edx,%edx
+}
+ 7d2:	5b                   	pop    %ebx
+ 7d3:	89 d0                	mov    %edx,%eax
+ 7d5:	5e                   	pop    %esi
+ 7d6:	5f                   	pop    %edi
+ 7d7:	5d                   	pop    %ebp
+ 7d8:	c3                   	ret
+ 7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7e0:	39 cf                	cmp    %ecx,%edi
+ 7e2:	74 4c                	je     830 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 7e4:	29 f9                	sub    %edi,%ecx
+ 7e6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7e9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7ec:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7ef:	a3 54 0f 00 00       	mov    %eax,0xf54
+}
+ 7f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f7:	89 d0                	mov    %edx,%eax
+ 7f9:	5b                   	pop    %ebx
+ 7fa:	5e                   	pop    %esi
+ 7fb:	5f                   	pop    %edi
+ 7fc:	5d                   	pop    %ebp
+ 7fd:	c3                   	ret
+ 7fe:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 800:	c7 05 54 0f 00 00 58 	movl   $0xf58,0xf54
+ 807:	0f 00 00 
+    base.s.size = 0;
+ 80a:	ba 58 0f 00 00       	mov    $0xf58,%edx
+    base.s.ptr = freep = prevp = &base;
+ 80f:	c7 05 58 0f 00 00 58 	movl   $0xf58,0xf58
+ 816:	0f 00 00 
+    base.s.size = 0;
+ 819:	c7 05 5c 0f 00 00 00 	movl   $0x0,0xf5c
+ 820:	00 00 00 
+    if(p->s.size >= nunits){
+ 823:	e9 59 ff ff ff       	jmp    781 <bigalloc+0x21>
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 830:	8b 0a                	mov    (%edx),%ecx
+ 832:	89 08                	mov    %ecx,(%eax)
+ 834:	eb b9                	jmp    7ef <bigalloc+0x8f>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <free>:
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	53                   	push   %ebx
+ 844:	83 ec 04             	sub    $0x4,%esp
+ 847:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 84a:	85 c9                	test   %ecx,%ecx
+ 84c:	74 58                	je     8a6 <free+0x66>
+  bp = (Header*)ap - 1;
+ 84e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 851:	ba 01 00 00 00       	mov    $0x1,%edx
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+ 860:	89 d0                	mov    %edx,%eax
+ 862:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+  while(xchg(&locked, 1) != 0)
+ 869:	85 c0                	test   %eax,%eax
+ 86b:	75 f3                	jne    860 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 86d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 870:	83 fa 40             	cmp    $0x40,%edx
+ 873:	77 3b                	ja     8b0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 875:	83 fa 02             	cmp    $0x2,%edx
+ 878:	76 3f                	jbe    8b9 <free+0x79>
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 880:	83 c0 01             	add    $0x1,%eax
+ 883:	39 14 85 60 0b 00 00 	cmp    %edx,0xb60(,%eax,4)
+ 88a:	72 f4                	jb     880 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 88c:	8b 14 85 20 0f 00 00 	mov    0xf20(,%eax,4),%edx
+    classfree[c] = bp;
+ 893:	89 1c 85 20 0f 00 00 	mov    %ebx,0xf20(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 89a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 89d:	31 c0                	xor    %eax,%eax
+ 89f:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+}
+ 8a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a9:	c9                   	leave
+ 8aa:	c3                   	ret
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+    bigfree(bp);
+ 8b0:	89 d8                	mov    %ebx,%eax
+ 8b2:	e8 29 fe ff ff       	call   6e0 <bigfree>
+ 8b7:	eb e4                	jmp    89d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 8b9:	31 c0                	xor    %eax,%eax
+ 8bb:	eb cf                	jmp    88c <free+0x4c>
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	57                   	push   %edi
+ 8c9:	56                   	push   %esi
+ 8ca:	53                   	push   %ebx
+ 8cb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d1:	8d 50 07             	lea    0x7(%eax),%edx
+ 8d4:	c1 ea 03             	shr    $0x3,%edx
+ 8d7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8e0:	89 c8                	mov    %ecx,%eax
+ 8e2:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+ 8e9:	85 c0                	test   %eax,%eax
+ 8eb:	75 f3                	jne    8e0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 8ed:	89 c3                	mov    %eax,%ebx
+ 8ef:	83 fa 40             	cmp    $0x40,%edx
+ 8f2:	77 4c                	ja     940 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 8f4:	be 02 00 00 00       	mov    $0x2,%esi
+ 8f9:	83 fa 02             	cmp    $0x2,%edx
+ 8fc:	76 10                	jbe    90e <malloc+0x4e>
+ 8fe:	66 90                	xchg   %ax,%ax
+ 900:	83 c3 01             	add    $0x1,%ebx
+ 903:	8b 34 9d 60 0b 00 00 	mov    0xb60(,%ebx,4),%esi
+ 90a:	39 d6                	cmp    %edx,%esi
+ 90c:	72 f2                	jb     900 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 90e:	8b 14 9d 20 0f 00 00 	mov    0xf20(,%ebx,4),%edx
+ 915:	85 d2                	test   %edx,%edx
+ 917:	74 47                	je     960 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 919:	8b 3a                	mov    (%edx),%edi
+ 91b:	89 3c 9d 20 0f 00 00 	mov    %edi,0xf20(,%ebx,4)
+ 922:	31 c0                	xor    %eax,%eax
+ 924:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 92b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 92e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 931:	5b                   	pop    %ebx
+ 932:	5e                   	pop    %esi
+ 933:	5f                   	pop    %edi
+ 934:	5d                   	pop    %ebp
+ 935:	c3                   	ret
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ 940:	89 d0                	mov    %edx,%eax
+ 942:	e8 19 fe ff ff       	call   760 <bigalloc>
+ 947:	89 c2                	mov    %eax,%edx
+ 949:	89 d8                	mov    %ebx,%eax
+ 94b:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+  return p ? (void*)(p + 1) : 0;
+ 952:	85 d2                	test   %edx,%edx
+ 954:	75 d5                	jne    92b <malloc+0x6b>
+ 956:	31 c0                	xor    %eax,%eax
+}
+ 958:	83 c4 1c             	add    $0x1c,%esp
+ 95b:	5b                   	pop    %ebx
+ 95c:	5e                   	pop    %esi
+ 95d:	5f                   	pop    %edi
+ 95e:	5d                   	pop    %ebp
+ 95f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ 960:	b8 00 02 00 00       	mov    $0x200,%eax
+ 965:	e8 f6 fd ff ff       	call   760 <bigalloc>
+ 96a:	85 c0                	test   %eax,%eax
+ 96c:	74 44                	je     9b2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 96e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 975:	8b 14 9d 20 0f 00 00 	mov    0xf20(,%ebx,4),%edx
+ 97c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 97f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ 982:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ 988:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 98b:	39 cf                	cmp    %ecx,%edi
+ 98d:	72 8a                	jb     919 <malloc+0x59>
+ 98f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ 992:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 995:	8d 76 00             	lea    0x0(%esi),%esi
+ 998:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ 99a:	89 70 04             	mov    %esi,0x4(%eax)
+ 99d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 99f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ 9a1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 9a3:	01 d8                	add    %ebx,%eax
+ 9a5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ 9a8:	73 ee                	jae    998 <malloc+0xd8>
+ 9aa:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 9ad:	e9 69 ff ff ff       	jmp    91b <malloc+0x5b>
+ 9b2:	f0 87 05 00 0f 00 00 	lock xchg %eax,0xf00
+  return p ? (void*)(p + 1) : 0;
+ 9b9:	31 c0                	xor    %eax,%eax
+ 9bb:	eb 9b                	jmp    958 <malloc+0x98>
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	56                   	push   %esi
+ 9c4:	53                   	push   %ebx
+ 9c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9c8:	f7 65 0c             	mull   0xc(%ebp)
+ 9cb:	70 33                	jo     a00 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ 9cd:	83 ec 0c             	sub    $0xc,%esp
+ 9d0:	89 c3                	mov    %eax,%ebx
+ 9d2:	50                   	push   %eax
+ 9d3:	e8 e8 fe ff ff       	call   8c0 <malloc>
+ 9d8:	83 c4 10             	add    $0x10,%esp
+ 9db:	89 c6                	mov    %eax,%esi
+ 9dd:	85 c0                	test   %eax,%eax
+ 9df:	74 1f                	je     a00 <calloc+0x40>
+    memset(p, 0, n);
+ 9e1:	83 ec 04             	sub    $0x4,%esp
+ 9e4:	53                   	push   %ebx
+ 9e5:	6a 00                	push   $0x0
+ 9e7:	50                   	push   %eax
+ 9e8:	e8 23 f7 ff ff       	call   110 <memset>
+ 9ed:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9f3:	89 f0                	mov    %esi,%eax
+ 9f5:	5b                   	pop    %ebx
+ 9f6:	5e                   	pop    %esi
+ 9f7:	5d                   	pop    %ebp
+ 9f8:	c3                   	ret
+ 9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a03:	31 f6                	xor    %esi,%esi
+}
+ a05:	89 f0                	mov    %esi,%eax
+ a07:	5b                   	pop    %ebx
+ a08:	5e                   	pop    %esi
+ a09:	5d                   	pop    %ebp
+ a0a:	c3                   	ret
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+
+00000a10 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 0c             	sub    $0xc,%esp
+ a19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a1f:	85 db                	test   %ebx,%ebx
+ a21:	74 55                	je     a78 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a23:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a26:	89 de                	mov    %ebx,%esi
+ a28:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a2f:	39 c7                	cmp    %eax,%edi
+ a31:	72 0d                	jb     a40 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a36:	89 f0                	mov    %esi,%eax
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a40:	83 ec 0c             	sub    $0xc,%esp
+ a43:	50                   	push   %eax
+ a44:	e8 77 fe ff ff       	call   8c0 <malloc>
+ a49:	83 c4 10             	add    $0x10,%esp
+ a4c:	89 c6                	mov    %eax,%esi
+ a4e:	85 c0                	test   %eax,%eax
+ a50:	74 e1                	je     a33 <realloc+0x23>
+  memmove(p, ap, have);
+ a52:	83 ec 04             	sub    $0x4,%esp
+ a55:	57                   	push   %edi
+ a56:	53                   	push   %ebx
+ a57:	50                   	push   %eax
+ a58:	e8 03 f8 ff ff       	call   260 <memmove>
+  free(ap);
+ a5d:	89 1c 24             	mov    %ebx,(%esp)
+ a60:	e8 db fd ff ff       	call   840 <free>
+  return p;
+ a65:	83 c4 10             	add    $0x10,%esp
+}
+ a68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a6b:	89 f0                	mov    %esi,%eax
+ a6d:	5b                   	pop    %ebx
+ a6e:	5e                   	pop    %esi
+ a6f:	5f                   	pop    %edi
+ a70:	5d                   	pop    %ebp
+ a71:	c3                   	ret
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a78:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a7e:	5b                   	pop    %ebx
+ a7f:	5e                   	pop    %esi
+ a80:	5f                   	pop    %edi
+ a81:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a82:	e9 39 fe ff ff       	jmp    8c0 <malloc>
@@ -6,12 +6,19 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "seqlock.h"
 #include "proc.h"
 #include "procinfo.h"
+#include "membench.h"
+#include "lockstat.h"
+#include "prof.h"
+#include "trace.h"
+#include "waitstat.h"
+#include "mlfqrec.h"
 
 // Define cpustats_kernel structure here since it's not in a header
 struct cpustats_kernel {
-  struct spinlock lock;
+  struct seqlock lock;
   uint total_ticks;
   uint idle_ticks;
 };
@@ -22,6 +29,39 @@ sys_fork(void)
   return fork();
 }
 
+int
+sys_clone(void)
+{
+  int fn, arg1, arg2, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg1) < 0 ||
+     argint(2, &arg2) < 0 || argint(3, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*, void*))fn, (void*)arg1, (void*)arg2, (void*)stack);
+}
+
+int
+sys_futex(void)
+{
+  uint *uaddr;
+  int op, val;
+
+  if(argptrw(0, (void*)&uaddr, sizeof(*uaddr)) < 0 ||
+     argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  return futex(uaddr, op, val);
+}
+
+int
+sys_join(void)
+{
+  void **stack;
+
+  if(argptrw(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  return join(stack);
+}
+
 int
 sys_exit(void)
 {
@@ -122,83 +162,62 @@ sys_getsysinfo(void) {
     return 0;
 }
 
+// Fetch the arguments (buf, n, tick) of mlfqread() or
+// mlfqvisual() and copy the records.
+static int
+mlfqreadargs(int peek)
+{
+  struct mlfqrec *buf;
+  uint *tick;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NMLFQREC)
+    n = NMLFQREC;  // no more can be recorded; keeps n*sizeof from wrapping
+  if(argptrw(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  if(argptrw(2, (void*)&tick, sizeof(*tick)) < 0)
+    return -1;
+  return mlfqread(buf, n, tick, peek);
+}
+
 int
 sys_detect_deadlock(void) {
     return detect_deadlock();
 }
 
+// Copy a snapshot of the MLFQ queues to the user's buffer.
+// The mlfqstatus program formats it.
 int
 sys_mlfqstatus(void) {
-  if(mlfq_recorder.recording) {
-    // Show summary of recorded data when recording is active
-    cprintf("=== MLFQ Recorded Status ===\n");
-    cprintf("Total snapshots: %d\n", mlfq_recorder.snapshot_count);
-    
-    // Calculate max processes seen in each queue
-    int max_counts[NQUEUE] = {0};
-    for(int i = 0; i < mlfq_recorder.snapshot_count; i++) {
-      for(int q = 0; q < NQUEUE; q++) {
-        if(mlfq_recorder.snapshots[i].counts[q] > max_counts[q])
-          max_counts[q] = mlfq_recorder.snapshots[i].counts[q];
-      }
-    }
-    
-    cprintf("Max processes observed:\n");
-    for(int q = 0; q < NQUEUE; q++) {
-      cprintf("  Queue %d: %d processes\n", q, max_counts[q]);
-    }
-  } else {
-    // Show current state when not recording
-    print_queues();
-  }
+  struct mlfqstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  mlfqsnapshot(st);
   return 0;
 }
 
+// Copy MLFQ transition records to the user's buffer, like
+// mlfqread(), but leave them to be read again.
 int
 sys_mlfqvisual(void) {
-  if(!mlfq_recorder.recording && mlfq_recorder.snapshot_count == 0) {
-    cprintf("No MLFQ data recorded. Call mlfqstart() first.\n");
-    return -1;
-  }
-  
-  if(mlfq_recorder.snapshot_count == 0) {
-    cprintf("Recording started but no transitions captured yet.\n");
-    return 0;
-  }
-  
-  cprintf("\n=== MLFQ Visual Recording ===\n");
-  cprintf("Showing %d queue transitions\n\n", mlfq_recorder.snapshot_count);
-  
-  // Show all snapshots
-  for(int i = 0; i < mlfq_recorder.snapshot_count; i++) {
-    struct mlfq_snapshot *snap = &mlfq_recorder.snapshots[i];
-    cprintf("--- Tick %d ---\n", snap->tick);
-    
-    for(int q = 0; q < NQUEUE; q++) {
-      cprintf("Queue %d: %d processes [", q, snap->counts[q]);
-      for(int j = 0; j < snap->pid_counts[q] && j < 5; j++) {
-        cprintf("%d", snap->pids[q][j]);
-        if(j < snap->pid_counts[q] - 1 && j < 4) cprintf(", ");
-      }
-      if(snap->pid_counts[q] > 5) cprintf("...");
-      cprintf("]\n");
-    }
-    cprintf("\n");
-  }
-  
-  // Show process transitions
-  cprintf("=== Process Transitions ===\n");
-  // Track each PID through snapshots
-  // (implementation showing which processes moved between queues)
-  
-  return 0;
+  return mlfqreadargs(1);
 }
 
+// Move up to n MLFQ transition records to the user's buffer,
+// and the tick before the first of them to *tick.
+int
+sys_mlfqread(void)
+{
+  return mlfqreadargs(0);
+}
+
+// The same snapshot as mlfqstatus(), kept for old programs.
 int
 sys_mlfqrealtime(void) {
-  // Always show current real-time status, regardless of recording state
-  print_queues();
-  return 0;
+  return sys_mlfqstatus();
 }
 
 int
@@ -233,14 +252,8 @@ extern struct {
 } ptable;
 
 extern int current_scheduler_policy;
-extern struct spinlock policy_lock;
+extern struct seqlock policy_lock;
 extern struct cpustats_kernel cpu_stats;
-extern void build_wfg(void);
-extern int dfs_check_cycle(int);
-extern int visited[NPROC];
-extern int recursion_stack[NPROC];
-extern int cycle[NPROC];
-extern int cycle_len;
 
 int
 sys_getallprocinfo(void)
@@ -257,7 +270,10 @@ sys_getallprocinfo(void)
     return -1;
   }
   
-  struct procinfo k_info_buf[NPROC];
+  // A whole table of procinfo no longer fits on the kernel
+  // stack, so fill in and copy out one entry at a time.
+  // copyout never sleeps, so it is safe under ptable.lock.
+  struct procinfo info;
   struct proc *p;
   int count = 0;
 
@@ -267,23 +283,39 @@ sys_getallprocinfo(void)
     if(p->state == UNUSED)
       continue;
     
-    k_info_buf[count].pid = p->pid;
-    k_info_buf[count].ppid = p->parent ? p->parent->pid : 0;
-    k_info_buf[count].state = p->state;
-    safestrcpy(k_info_buf[count].name, p->name, 16);
-    k_info_buf[count].priority = p->priority;
-    k_info_buf[count].mlfq_level = p->mlfq_level;
-    k_info_buf[count].start_time = p->start_time;
-    k_info_buf[count].cpu_ticks = p->cpu_ticks;
+    info.pid = p->pid;
+    info.ppid = p->parent ? p->parent->pid : 0;
+    info.state = p->state;
+    safestrcpy(info.name, p->name, 16);
+    info.priority = p->priority;
+    info.mlfq_level = p->mlfq_level;
+    info.start_time = p->start_time;
+    info.cpu_ticks = p->cpu_ticks;
+    info.nvcsw = p->nvcsw;
+    info.nivcsw = p->nivcsw;
+    info.nsyscall = p->nsyscall;
+    info.nblkread = p->nblkread;
+    info.nblkwrite = p->nblkwrite;
+    info.pipein = p->pipein;
+    info.pipeout = p->pipeout;
+    info.npages = p->leader ? p->leader->npages : p->npages;
+    // Include the time spent so far in the current state.
+    info.runnable_ticks = p->runnable_ticks;
+    info.sleep_ticks = p->sleep_ticks;
+    if(p->state == RUNNABLE)
+      info.runnable_ticks += ticks - p->state_tick;
+    else if(p->state == SLEEPING)
+      info.sleep_ticks += ticks - p->state_tick;
     
+    if(copyout(myproc()->pgdir, user_buf_addr + count*sizeof(info),
+               (char*)&info, sizeof(info)) < 0) {
+      release(&ptable.lock);
+      return -1;
+    }
     count++;
   }
   
   release(&ptable.lock);
-
-  if(copyout(myproc()->pgdir, user_buf_addr, (char*)k_info_buf, count * sizeof(struct procinfo)) < 0) {
-    return -1;
-  }
   
   return count;
 }
@@ -293,14 +325,16 @@ sys_getcpustats(void)
 {
   uint user_addr;
   struct cpustats k_stats; // Kernel-side temporary copy
+  uint seq;
 
   if(argint(0, (int*)&user_addr) < 0)
     return -1;
     
-  acquire(&cpu_stats.lock);
-  k_stats.total_ticks = cpu_stats.total_ticks;
-  k_stats.idle_ticks = cpu_stats.idle_ticks;
-  release(&cpu_stats.lock);
+  do {
+    seq = seqbegin(&cpu_stats.lock);
+    k_stats.total_ticks = cpu_stats.total_ticks;
+    k_stats.idle_ticks = cpu_stats.idle_ticks;
+  } while(seqretry(&cpu_stats.lock, seq));
   
   if(copyout(myproc()->pgdir, user_addr, (char*)&k_stats, sizeof(k_stats)) < 0)
     return -1;
@@ -320,9 +354,9 @@ sys_setscheduler(void)
   if(policy < 0 || policy > 2) // 0=RR, 1=PBS, 2=MLFQ
     return -1; // Invalid policy number
 
-  acquire(&policy_lock);
+  acquireseq(&policy_lock);
   current_scheduler_policy = policy;
-  release(&policy_lock);
+  releaseseq(&policy_lock);
   
   return 0;
 }
@@ -331,10 +365,12 @@ int
 sys_getscheduler(void)
 {
   int policy;
+  uint seq;
   
-  acquire(&policy_lock);
-  policy = current_scheduler_policy;
-  release(&policy_lock);
+  do {
+    seq = seqbegin(&policy_lock);
+    policy = current_scheduler_policy;
+  } while(seqretry(&policy_lock, seq));
   
   return policy;
 }
@@ -342,38 +378,211 @@ sys_getscheduler(void)
 int
 sys_getdeadlockinfo(void)
 {
-  uint user_addr;
-  struct deadlockinfo k_info;
-  memset(&k_info, 0, sizeof(k_info));
+  struct deadlockinfo *info;
 
-  if(argint(0, (int*)&user_addr) < 0)
+  if(argptrw(0, (void*)&info, sizeof(*info)) < 0)
+    return -1;
+
+  // Scan the wait-for graph and copy out every cycle.
+  deadlockscan(info);
+  return 0;
+}
+
+// Take or release one of the test sleep-locks, for dltest.
+int
+sys_dllock(void)
+{
+  int op, n;
+
+  if(argint(0, &op) < 0 || argint(1, &n) < 0)
+    return -1;
+  return dllock(op, n);
+}
+
+int
+sys_watchdogctl(void)
+{
+  int policy, interval;
+
+  if(argint(0, &policy) < 0 || argint(1, &interval) < 0)
+    return -1;
+  return watchdogctl(policy, interval);
+}
+
+int
+sys_deadlocklog(void)
+{
+  struct deadlogent *log;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NDEADLOG)
+    n = NDEADLOG;  // no more are logged; keeps n*sizeof from wrapping
+  if(argptrw(0, (void*)&log, n*sizeof(*log)) < 0)
     return -1;
+  return deadlocklog(log, n);
+}
 
-  // 1. Build the WFG
-  build_wfg();
-
-  // 2. Clear DFS state and search for a cycle
-  memset(visited, 0, sizeof(visited));
-  memset(recursion_stack, 0, sizeof(recursion_stack));
-  cycle_len = 0;
-
-  // Only check processes with valid PIDs
-  for(int i = 0; i < NPROC; i++) {
-    struct proc *proc = &ptable.proc[i];
-    if(proc->state != UNUSED && proc->pid > 0 && proc->pid < NPROC && !visited[proc->pid]) {
-      if(dfs_check_cycle(proc->pid)) {
-        k_info.found = 1;
-        // Copy the cycle array into k_info
-        for(int j=0; j < cycle_len && j < NPROC; j++)
-          k_info.pids_in_cycle[j] = cycle[j];
-        break; // Found one, that's enough
-      }
+// Time iters runs of a block operation on n bytes, for the
+// membench program. buf is the user buffer for MB_COPYOUT.
+// Returns the elapsed time-stamp counter cycles, which fit
+// in an int for any sensible size and count.
+int
+sys_membench(void)
+{
+  int op, n, iters, i, r;
+  uint buf;
+  char *src, *dst;
+  volatile char *d;
+  char *s, *e;
+  uint64 t0;
+
+  if(argint(0, &op) < 0 || argint(2, &n) < 0 || argint(3, &iters) < 0)
+    return -1;
+  if(n < 0 || n > PGSIZE || iters < 0 || argint(1, (int*)&buf) < 0)
+    return -1;
+  if((src = kalloc()) == 0)
+    return -1;
+  if((dst = kalloc()) == 0){
+    kfree(src);
+    return -1;
+  }
+  memset(src, 0x5a, PGSIZE);
+  memset(dst, 0x5a, PGSIZE);
+
+  r = 0;
+  t0 = rdtsc();
+  for(i = 0; i < iters && r == 0; i++){
+    switch(op){
+    case MB_BYTECOPY:
+      d = dst;
+      for(s = src, e = src + n; s < e; )
+        *d++ = *s++;
+      break;
+    case MB_MEMMOVE:
+      memmove(dst, src, n);
+      break;
+    case MB_MEMCMP:
+      r = memcmp(dst, src, n);
+      break;
+    case MB_COPYOUT:
+      r = copyout(myproc()->pgdir, buf, src, n);
+      break;
+    default:
+      r = -1;
     }
   }
+  t0 = rdtsc() - t0;
 
-  // 3. Copy result to user
-  if(copyout(myproc()->pgdir, user_addr, (char*)&k_info, sizeof(k_info)) < 0)
+  kfree(src);
+  kfree(dst);
+  if(r != 0)
     return -1;
-    
-  return 0;
+  return (int)t0;
+}
+
+// Copy statistics for up to n lock classes to the user,
+// optionally resetting them. Returns the number copied.
+int
+sys_getlockstat(void)
+{
+  struct lockstat *st;
+  int n, reset;
+
+  if(argint(1, &n) < 0 || argint(2, &reset) < 0)
+    return -1;
+  if(n < 0 || n > NLOCKCLASS)
+    return -1;
+  if(argptrw(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return lockstats(st, n, reset);
+}
+
+// Contend for a kernel spinlock, for the lockbench program.
+// Returns the longest wait to acquire it, in cycles.
+int
+sys_lockbench(void)
+{
+  int iters, hold;
+
+  if(argint(0, &iters) < 0 || argint(1, &hold) < 0)
+    return -1;
+  if(iters < 0 || iters > LBMAXITERS || hold < 0 || hold > LBMAXHOLD)
+    return -1;
+  return lockbench(iters, hold);
+}
+
+// Control the sampling profiler; see prof.c.
+int
+sys_prof(void)
+{
+  int cmd, n;
+  struct profsample *buf;
+
+  if(argint(0, &cmd) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  if(n > NCPU*NPROFSAMPLE)
+    n = NCPU*NPROFSAMPLE;  // no more can be buffered; keeps n*sizeof from wrapping
+  buf = 0;
+  if(cmd == PROF_READ && argptrw(1, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return profctl(cmd, buf, n);
+}
+
+// Enable trace event classes; see trace.c.
+int
+sys_tracectl(void)
+{
+  int mask;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+  return tracectl(mask);
+}
+
+int
+sys_traceread(void)
+{
+  struct traceevent *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NCPU*NTRACE)
+    n = NCPU*NTRACE;  // no more can be buffered; keeps n*sizeof from wrapping
+  if(argptrw(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return traceread(buf, n);
+}
+
+// Copy the scheduling latency of process pid to the user.
+int
+sys_getwaitstat(void)
+{
+  struct waitstat *st;
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(argptrw(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return procwaitstat(pid, st);
+}
+
+// Copy the scheduling latency under each of the first n
+// policies to the user, and optionally reset it.
+int
+sys_getschedwait(void)
+{
+  struct waitstat *st;
+  int n, reset;
+
+  if(argint(1, &n) < 0 || argint(2, &reset) < 0)
+    return -1;
+  if(n < 0 || n > NSCHEDPOLICY)
+    return -1;
+  if(argptrw(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return schedwaitstats(st, n, reset);
 }
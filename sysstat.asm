@@ -0,0 +1,1973 @@
+
+_sysstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+      printf(1, "\t\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int i, j, t, n, hist, pid;
+  uint calls, avg;
+
+  hist = 0;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-h") == 0){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8e 09 02 00 00    	jle    22b <main+0x22b>
+  22:	51                   	push   %ecx
+  23:	51                   	push   %ecx
+  24:	68 36 0d 00 00       	push   $0xd36
+  29:	ff 76 04             	push   0x4(%esi)
+  2c:	e8 cf 02 00 00       	call   300 <strcmp>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	85 c0                	test   %eax,%eax
+  36:	0f 85 a0 00 00 00    	jne    dc <main+0xdc>
+    hist = 1;
+  3c:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+    i++;
+  }
+
+  if(i < argc){
+  43:	83 fb 02             	cmp    $0x2,%ebx
+  46:	0f 85 19 02 00 00    	jne    265 <main+0x265>
+      printf(2, "sysstat: exec %s failed\n", argv[i]);
+      exit();
+    }
+    wait();
+  }
+  if((n = getsysstat(st, MAXSYS, 0)) < 0){
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	6a 00                	push   $0x0
+  51:	6a 40                	push   $0x40
+  53:	68 00 16 00 00       	push   $0x1600
+  58:	e8 3e 06 00 00       	call   69b <getsysstat>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  63:	85 c0                	test   %eax,%eax
+  65:	0f 88 ca 01 00 00    	js     235 <main+0x235>
+    printf(2, "sysstat: getsysstat failed\n");
+    exit();
+  }
+
+  // Sort by total time, most first.
+  for(i = 0; i < n; i++){
+  6b:	0f 84 8f 01 00 00    	je     200 <main+0x200>
+  71:	bf 04 16 00 00       	mov    $0x1604,%edi
+  76:	31 d2                	xor    %edx,%edx
+  78:	89 f9                	mov    %edi,%ecx
+  7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  80:	89 d0                	mov    %edx,%eax
+  82:	31 db                	xor    %ebx,%ebx
+    t = i;
+    for(j = i; j > 0 && st[order[j-1]].cycles < st[t].cycles; j--)
+      order[j] = order[j-1];
+    order[j] = t;
+  84:	89 14 9d 00 15 00 00 	mov    %edx,0x1500(,%ebx,4)
+  for(i = 0; i < n; i++){
+  8b:	81 c1 88 00 00 00    	add    $0x88,%ecx
+  91:	83 c2 01             	add    $0x1,%edx
+  94:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+  97:	0f 84 9b 00 00 00    	je     138 <main+0x138>
+    for(j = i; j > 0 && st[order[j-1]].cycles < st[t].cycles; j--)
+  9d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  a0:	8b 39                	mov    (%ecx),%edi
+  for(i = 0; i < n; i++){
+  a2:	89 d0                	mov    %edx,%eax
+  a4:	eb 15                	jmp    bb <main+0xbb>
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+      order[j] = order[j-1];
+  b0:	89 0c 85 04 15 00 00 	mov    %ecx,0x1504(,%eax,4)
+    for(j = i; j > 0 && st[order[j-1]].cycles < st[t].cycles; j--)
+  b7:	85 c0                	test   %eax,%eax
+  b9:	74 75                	je     130 <main+0x130>
+  bb:	89 c3                	mov    %eax,%ebx
+  bd:	8d 40 ff             	lea    -0x1(%eax),%eax
+  c0:	8b 0c 85 00 15 00 00 	mov    0x1500(,%eax,4),%ecx
+  c7:	69 f1 88 00 00 00    	imul   $0x88,%ecx,%esi
+  cd:	39 be 04 16 00 00    	cmp    %edi,0x1604(%esi)
+  d3:	72 db                	jb     b0 <main+0xb0>
+  for(i = 0; i < n; i++){
+  d5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  d8:	89 d0                	mov    %edx,%eax
+  da:	eb a8                	jmp    84 <main+0x84>
+  hist = 0;
+  dc:	31 d2                	xor    %edx,%edx
+  i = 1;
+  de:	bb 01 00 00 00       	mov    $0x1,%ebx
+  hist = 0;
+  e3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    getsysstat(st, MAXSYS, 1);
+  e6:	50                   	push   %eax
+  e7:	6a 01                	push   $0x1
+  e9:	6a 40                	push   $0x40
+  eb:	68 00 16 00 00       	push   $0x1600
+  f0:	e8 a6 05 00 00       	call   69b <getsysstat>
+    pid = fork();
+  f5:	e8 11 04 00 00       	call   50b <fork>
+    if(pid < 0){
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	85 c0                	test   %eax,%eax
+  ff:	0f 88 4d 01 00 00    	js     252 <main+0x252>
+    if(pid == 0){
+ 105:	0f 85 3d 01 00 00    	jne    248 <main+0x248>
+      exec(argv[i], argv+i);
+ 10b:	8d 1c 9e             	lea    (%esi,%ebx,4),%ebx
+ 10e:	50                   	push   %eax
+ 10f:	50                   	push   %eax
+ 110:	53                   	push   %ebx
+ 111:	ff 33                	push   (%ebx)
+ 113:	e8 33 04 00 00       	call   54b <exec>
+      printf(2, "sysstat: exec %s failed\n", argv[i]);
+ 118:	83 c4 0c             	add    $0xc,%esp
+ 11b:	ff 33                	push   (%ebx)
+ 11d:	68 4f 0d 00 00       	push   $0xd4f
+ 122:	6a 02                	push   $0x2
+ 124:	e8 87 06 00 00       	call   7b0 <printf>
+      exit();
+ 129:	e8 e5 03 00 00       	call   513 <exit>
+ 12e:	66 90                	xchg   %ax,%ax
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	e9 48 ff ff ff       	jmp    80 <main+0x80>
+  }
+
+  calls = 0;
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 138:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  calls = 0;
+ 13b:	31 db                	xor    %ebx,%ebx
+  for(i = 0; i < n; i++){
+ 13d:	31 ff                	xor    %edi,%edi
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 13f:	51                   	push   %ecx
+ 140:	51                   	push   %ecx
+ 141:	68 84 0f 00 00       	push   $0xf84
+ 146:	6a 01                	push   $0x1
+ 148:	e8 63 06 00 00       	call   7b0 <printf>
+  calls = 0;
+ 14d:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 150:	83 c4 10             	add    $0x10,%esp
+ 153:	eb 16                	jmp    16b <main+0x16b>
+ 155:	8d 76 00             	lea    0x0(%esi),%esi
+    j = order[i];
+    if(st[j].ncall == 0)
+      continue;
+    calls += st[j].ncall;
+ 158:	01 75 d8             	add    %esi,-0x28(%ebp)
+  for(i = 0; i < n; i++){
+ 15b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 15e:	8d 47 01             	lea    0x1(%edi),%eax
+ 161:	39 d7                	cmp    %edx,%edi
+ 163:	0f 84 ad 00 00 00    	je     216 <main+0x216>
+ 169:	89 c7                	mov    %eax,%edi
+    j = order[i];
+ 16b:	8b 1c bd 00 15 00 00 	mov    0x1500(,%edi,4),%ebx
+    if(st[j].ncall == 0)
+ 172:	69 c3 88 00 00 00    	imul   $0x88,%ebx,%eax
+ 178:	8b b0 00 16 00 00    	mov    0x1600(%eax),%esi
+ 17e:	85 f6                	test   %esi,%esi
+ 180:	74 d9                	je     15b <main+0x15b>
+    // cycles is in units of 1024.
+    avg = st[j].cycles / st[j].ncall * 1024 +
+ 182:	8b 88 04 16 00 00    	mov    0x1604(%eax),%ecx
+ 188:	31 d2                	xor    %edx,%edx
+ 18a:	89 c8                	mov    %ecx,%eax
+ 18c:	f7 f6                	div    %esi
+          st[j].cycles % st[j].ncall * 1024 / st[j].ncall;
+ 18e:	c1 e2 0a             	shl    $0xa,%edx
+ 191:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 194:	89 d0                	mov    %edx,%eax
+ 196:	31 d2                	xor    %edx,%edx
+ 198:	f7 f6                	div    %esi
+    avg = st[j].cycles / st[j].ncall * 1024 +
+ 19a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 19d:	c1 e2 0a             	shl    $0xa,%edx
+ 1a0:	01 d0                	add    %edx,%eax
+    printf(1, "%d\t%d\t\t%d\t%s\n", st[j].ncall, st[j].cycles, avg,
+ 1a2:	ba 34 0d 00 00       	mov    $0xd34,%edx
+    avg = st[j].cycles / st[j].ncall * 1024 +
+ 1a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    printf(1, "%d\t%d\t\t%d\t%s\n", st[j].ncall, st[j].cycles, avg,
+ 1aa:	83 fb 3f             	cmp    $0x3f,%ebx
+ 1ad:	7f 11                	jg     1c0 <main+0x1c0>
+           j < MAXSYS && name[j] ? name[j] : "?");
+ 1af:	8b 14 9d 00 14 00 00 	mov    0x1400(,%ebx,4),%edx
+    printf(1, "%d\t%d\t\t%d\t%s\n", st[j].ncall, st[j].cycles, avg,
+ 1b6:	b8 34 0d 00 00       	mov    $0xd34,%eax
+ 1bb:	85 d2                	test   %edx,%edx
+ 1bd:	0f 44 d0             	cmove  %eax,%edx
+ 1c0:	83 ec 08             	sub    $0x8,%esp
+ 1c3:	52                   	push   %edx
+ 1c4:	ff 75 e4             	push   -0x1c(%ebp)
+ 1c7:	51                   	push   %ecx
+ 1c8:	56                   	push   %esi
+ 1c9:	68 84 0d 00 00       	push   $0xd84
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	e8 db 05 00 00       	call   7b0 <printf>
+    if(hist)
+ 1d5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 1d8:	83 c4 20             	add    $0x20,%esp
+ 1db:	85 d2                	test   %edx,%edx
+ 1dd:	0f 84 75 ff ff ff    	je     158 <main+0x158>
+      histogram(&st[j]);
+ 1e3:	69 db 88 00 00 00    	imul   $0x88,%ebx,%ebx
+ 1e9:	83 ec 0c             	sub    $0xc,%esp
+ 1ec:	81 c3 00 16 00 00    	add    $0x1600,%ebx
+ 1f2:	53                   	push   %ebx
+ 1f3:	e8 78 00 00 00       	call   270 <histogram>
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	e9 58 ff ff ff       	jmp    158 <main+0x158>
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 200:	56                   	push   %esi
+  calls = 0;
+ 201:	31 ff                	xor    %edi,%edi
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 203:	56                   	push   %esi
+ 204:	68 84 0f 00 00       	push   $0xf84
+ 209:	6a 01                	push   $0x1
+ 20b:	e8 a0 05 00 00       	call   7b0 <printf>
+  calls = 0;
+ 210:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+ 213:	83 c4 10             	add    $0x10,%esp
+  }
+  printf(1, "%d calls\n", calls);
+ 216:	50                   	push   %eax
+ 217:	ff 75 d8             	push   -0x28(%ebp)
+ 21a:	68 92 0d 00 00       	push   $0xd92
+ 21f:	6a 01                	push   $0x1
+ 221:	e8 8a 05 00 00       	call   7b0 <printf>
+  exit();
+ 226:	e8 e8 02 00 00       	call   513 <exit>
+  hist = 0;
+ 22b:	31 c0                	xor    %eax,%eax
+ 22d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 230:	e9 17 fe ff ff       	jmp    4c <main+0x4c>
+    printf(2, "sysstat: getsysstat failed\n");
+ 235:	50                   	push   %eax
+ 236:	50                   	push   %eax
+ 237:	68 68 0d 00 00       	push   $0xd68
+ 23c:	6a 02                	push   $0x2
+ 23e:	e8 6d 05 00 00       	call   7b0 <printf>
+    exit();
+ 243:	e8 cb 02 00 00       	call   513 <exit>
+    wait();
+ 248:	e8 ce 02 00 00       	call   51b <wait>
+ 24d:	e9 fa fd ff ff       	jmp    4c <main+0x4c>
+      printf(2, "sysstat: fork failed\n");
+ 252:	50                   	push   %eax
+ 253:	50                   	push   %eax
+ 254:	68 39 0d 00 00       	push   $0xd39
+ 259:	6a 02                	push   $0x2
+ 25b:	e8 50 05 00 00       	call   7b0 <printf>
+      exit();
+ 260:	e8 ae 02 00 00       	call   513 <exit>
+ 265:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 26a:	e9 77 fe ff ff       	jmp    e6 <main+0xe6>
+ 26f:	90                   	nop
+
+00000270 <histogram>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+      printf(1, "\t\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 274:	bf 02 00 00 00       	mov    $0x2,%edi
+{
+ 279:	56                   	push   %esi
+ 27a:	53                   	push   %ebx
+  for(b = 0; b < NSYSHIST; b++)
+ 27b:	31 db                	xor    %ebx,%ebx
+{
+ 27d:	83 ec 0c             	sub    $0xc,%esp
+ 280:	8b 75 08             	mov    0x8(%ebp),%esi
+ 283:	eb 0b                	jmp    290 <histogram+0x20>
+ 285:	8d 76 00             	lea    0x0(%esi),%esi
+  for(b = 0; b < NSYSHIST; b++)
+ 288:	83 c3 01             	add    $0x1,%ebx
+ 28b:	83 fb 20             	cmp    $0x20,%ebx
+ 28e:	74 35                	je     2c5 <histogram+0x55>
+    if(s->hist[b])
+ 290:	8b 44 9e 08          	mov    0x8(%esi,%ebx,4),%eax
+ 294:	85 c0                	test   %eax,%eax
+ 296:	74 f0                	je     288 <histogram+0x18>
+      printf(1, "\t\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 298:	83 ec 0c             	sub    $0xc,%esp
+ 29b:	89 d9                	mov    %ebx,%ecx
+  for(b = 0; b < NSYSHIST; b++)
+ 29d:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "\t\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+ 2a0:	50                   	push   %eax
+ 2a1:	89 f8                	mov    %edi,%eax
+ 2a3:	d3 e0                	shl    %cl,%eax
+ 2a5:	83 e8 01             	sub    $0x1,%eax
+ 2a8:	50                   	push   %eax
+ 2a9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2ae:	d3 e0                	shl    %cl,%eax
+ 2b0:	50                   	push   %eax
+ 2b1:	68 20 0d 00 00       	push   $0xd20
+ 2b6:	6a 01                	push   $0x1
+ 2b8:	e8 f3 04 00 00       	call   7b0 <printf>
+ 2bd:	83 c4 20             	add    $0x20,%esp
+  for(b = 0; b < NSYSHIST; b++)
+ 2c0:	83 fb 20             	cmp    $0x20,%ebx
+ 2c3:	75 cb                	jne    290 <histogram+0x20>
+}
+ 2c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2c8:	5b                   	pop    %ebx
+ 2c9:	5e                   	pop    %esi
+ 2ca:	5f                   	pop    %edi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	66 90                	xchg   %ax,%ax
+ 2cf:	90                   	nop
+
+000002d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2d1:	31 c0                	xor    %eax,%eax
+{
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	84 d2                	test   %dl,%dl
+ 2ec:	75 f2                	jne    2e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f1:	89 c8                	mov    %ecx,%eax
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+ 307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 17                	jne    328 <strcmp+0x28>
+ 311:	eb 3a                	jmp    34d <strcmp+0x4d>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 31c:	83 c2 01             	add    $0x1,%edx
+ 31f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 322:	84 c0                	test   %al,%al
+ 324:	74 1a                	je     340 <strcmp+0x40>
+    p++, q++;
+ 326:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 328:	0f b6 19             	movzbl (%ecx),%ebx
+ 32b:	38 c3                	cmp    %al,%bl
+ 32d:	74 e9                	je     318 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 32f:	29 d8                	sub    %ebx,%eax
+}
+ 331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 334:	c9                   	leave
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 340:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 344:	31 c0                	xor    %eax,%eax
+ 346:	29 d8                	sub    %ebx,%eax
+}
+ 348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34b:	c9                   	leave
+ 34c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 34d:	0f b6 19             	movzbl (%ecx),%ebx
+ 350:	31 c0                	xor    %eax,%eax
+ 352:	eb db                	jmp    32f <strcmp+0x2f>
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 366:	80 3a 00             	cmpb   $0x0,(%edx)
+ 369:	74 15                	je     380 <strlen+0x20>
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	83 c0 01             	add    $0x1,%eax
+ 373:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	75 f5                	jne    370 <strlen+0x10>
+    ;
+  return n;
+}
+ 37b:	89 c8                	mov    %ecx,%eax
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 380:	31 c9                	xor    %ecx,%ecx
+}
+ 382:	5d                   	pop    %ebp
+ 383:	89 c8                	mov    %ecx,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	89 d7                	mov    %edx,%edi
+ 39f:	fc                   	cld
+ 3a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3a5:	89 d0                	mov    %edx,%eax
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ba:	0f b6 10             	movzbl (%eax),%edx
+ 3bd:	84 d2                	test   %dl,%dl
+ 3bf:	75 12                	jne    3d3 <strchr+0x23>
+ 3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3cc:	83 c0 01             	add    $0x1,%eax
+ 3cf:	84 d2                	test   %dl,%dl
+ 3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+ 3d3:	38 d1                	cmp    %dl,%cl
+ 3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3e0:	31 c0                	xor    %eax,%eax
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3f9:	31 db                	xor    %ebx,%ebx
+{
+ 3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3fe:	eb 27                	jmp    427 <gets+0x37>
+    cc = read(0, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 01                	push   $0x1
+ 405:	56                   	push   %esi
+ 406:	6a 00                	push   $0x0
+ 408:	e8 1e 01 00 00       	call   52b <read>
+    if(cc < 1)
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	85 c0                	test   %eax,%eax
+ 412:	7e 1d                	jle    431 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 41f:	3c 0a                	cmp    $0xa,%al
+ 421:	74 10                	je     433 <gets+0x43>
+ 423:	3c 0d                	cmp    $0xd,%al
+ 425:	74 0c                	je     433 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 42f:	7c cf                	jl     400 <gets+0x10>
+ 431:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 43a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5f                   	pop    %edi
+ 440:	5d                   	pop    %ebp
+ 441:	c3                   	ret
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	ff 75 08             	push   0x8(%ebp)
+ 45d:	e8 f1 00 00 00       	call   553 <open>
+  if(fd < 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	78 27                	js     490 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	ff 75 0c             	push   0xc(%ebp)
+ 46f:	89 c3                	mov    %eax,%ebx
+ 471:	50                   	push   %eax
+ 472:	e8 f4 00 00 00       	call   56b <fstat>
+  close(fd);
+ 477:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 47a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 47c:	e8 ba 00 00 00       	call   53b <close>
+  return r;
+ 481:	83 c4 10             	add    $0x10,%esp
+}
+ 484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 495:	eb ed                	jmp    484 <stat+0x34>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4a7:	0f be 02             	movsbl (%edx),%eax
+ 4aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4b5:	77 1e                	ja     4d5 <atoi+0x35>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4c0:	83 c2 01             	add    $0x1,%edx
+ 4c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ca:	0f be 02             	movsbl (%edx),%eax
+ 4cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4d0:	80 fb 09             	cmp    $0x9,%bl
+ 4d3:	76 eb                	jbe    4c0 <atoi+0x20>
+  return n;
+}
+ 4d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d8:	89 c8                	mov    %ecx,%eax
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+
+0000050b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 50b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <exit>:
+SYSCALL(exit)
+ 513:	b8 02 00 00 00       	mov    $0x2,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <wait>:
+SYSCALL(wait)
+ 51b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <pipe>:
+SYSCALL(pipe)
+ 523:	b8 04 00 00 00       	mov    $0x4,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <read>:
+SYSCALL(read)
+ 52b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <write>:
+SYSCALL(write)
+ 533:	b8 10 00 00 00       	mov    $0x10,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <close>:
+SYSCALL(close)
+ 53b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <kill>:
+SYSCALL(kill)
+ 543:	b8 06 00 00 00       	mov    $0x6,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <exec>:
+SYSCALL(exec)
+ 54b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <open>:
+SYSCALL(open)
+ 553:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mknod>:
+SYSCALL(mknod)
+ 55b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <unlink>:
+SYSCALL(unlink)
+ 563:	b8 12 00 00 00       	mov    $0x12,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <fstat>:
+SYSCALL(fstat)
+ 56b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <link>:
+SYSCALL(link)
+ 573:	b8 13 00 00 00       	mov    $0x13,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mkdir>:
+SYSCALL(mkdir)
+ 57b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <chdir>:
+SYSCALL(chdir)
+ 583:	b8 09 00 00 00       	mov    $0x9,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <dup>:
+SYSCALL(dup)
+ 58b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getpid>:
+SYSCALL(getpid)
+ 593:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sbrk>:
+SYSCALL(sbrk)
+ 59b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sleep>:
+SYSCALL(sleep)
+ 5a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <uptime>:
+SYSCALL(uptime)
+ 5ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 5b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 5bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 5c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 5cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 5d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 5db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 5e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <setpriority>:
+SYSCALL(setpriority)
+ 5eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 5f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getcpustats>:
+SYSCALL(getcpustats)
+ 5fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <setscheduler>:
+SYSCALL(setscheduler)
+ 603:	b8 20 00 00 00       	mov    $0x20,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 60b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getscheduler>:
+SYSCALL(getscheduler)
+ 613:	b8 22 00 00 00       	mov    $0x22,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <splice>:
+SYSCALL(splice)
+ 61b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <readv>:
+SYSCALL(readv)
+ 623:	b8 24 00 00 00       	mov    $0x24,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <writev>:
+SYSCALL(writev)
+ 62b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <pread>:
+SYSCALL(pread)
+ 633:	b8 26 00 00 00       	mov    $0x26,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <pwrite>:
+SYSCALL(pwrite)
+ 63b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getlogstat>:
+SYSCALL(getlogstat)
+ 643:	b8 28 00 00 00       	mov    $0x28,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mount>:
+SYSCALL(mount)
+ 64b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <umount>:
+SYSCALL(umount)
+ 653:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mmap>:
+SYSCALL(mmap)
+ 65b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <munmap>:
+SYSCALL(munmap)
+ 663:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <membench>:
+SYSCALL(membench)
+ 66b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getlockstat>:
+SYSCALL(getlockstat)
+ 673:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <lockbench>:
+SYSCALL(lockbench)
+ 67b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <prof>:
+SYSCALL(prof)
+ 683:	b8 30 00 00 00       	mov    $0x30,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <tracectl>:
+SYSCALL(tracectl)
+ 68b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <traceread>:
+SYSCALL(traceread)
+ 693:	b8 32 00 00 00       	mov    $0x32,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <getsysstat>:
+SYSCALL(getsysstat)
+ 69b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 6a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <getschedwait>:
+SYSCALL(getschedwait)
+ 6ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 6b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <dllock>:
+SYSCALL(dllock)
+ 6bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 6c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 6cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <clone>:
+SYSCALL(clone)
+ 6d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <join>:
+SYSCALL(join)
+ 6db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <futex>:
+SYSCALL(futex)
+ 6e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <shmat>:
+SYSCALL(shmat)
+ 6eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <shmdt>:
+SYSCALL(shmdt)
+ 6f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <poll>:
+SYSCALL(poll)
+ 6fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+ 703:	66 90                	xchg   %ax,%ax
+ 705:	66 90                	xchg   %ax,%ax
+ 707:	66 90                	xchg   %ax,%ax
+ 709:	66 90                	xchg   %ax,%ax
+ 70b:	66 90                	xchg   %ax,%ax
+ 70d:	66 90                	xchg   %ax,%ax
+ 70f:	90                   	nop
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 04 10 00 00 	movzbl 0x1004(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 a6 fd ff ff       	call   533 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 3c fd ff ff       	call   533 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 ac 0f 00 00 	jmp    *0xfac(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 dd fc ff ff       	call   533 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 cb fc ff ff       	call   533 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 51 fc ff ff       	call   533 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 01 fc ff ff       	call   533 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb a4 0f 00 00       	mov    $0xfa4,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 963:	a1 54 38 00 00       	mov    0x3854,%eax
+{
+ 968:	89 e5                	mov    %esp,%ebp
+ 96a:	56                   	push   %esi
+ 96b:	53                   	push   %ebx
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 970:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 972:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 974:	39 ca                	cmp    %ecx,%edx
+ 976:	73 30                	jae    9a8 <bigfree+0x48>
+ 978:	39 c1                	cmp    %eax,%ecx
+ 97a:	72 04                	jb     980 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97c:	39 c2                	cmp    %eax,%edx
+ 97e:	72 f0                	jb     970 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 980:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 983:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 986:	39 f0                	cmp    %esi,%eax
+ 988:	74 26                	je     9b0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 98a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 98c:	8b 42 04             	mov    0x4(%edx),%eax
+ 98f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 992:	39 d9                	cmp    %ebx,%ecx
+ 994:	74 30                	je     9c6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 996:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 998:	5b                   	pop    %ebx
+  freep = p;
+ 999:	89 15 54 38 00 00    	mov    %edx,0x3854
+}
+ 99f:	5e                   	pop    %esi
+ 9a0:	5d                   	pop    %ebp
+ 9a1:	c3                   	ret
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a8:	39 c1                	cmp    %eax,%ecx
+ 9aa:	72 d0                	jb     97c <bigfree+0x1c>
+ 9ac:	eb c2                	jmp    970 <bigfree+0x10>
+ 9ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9b0:	03 58 04             	add    0x4(%eax),%ebx
+ 9b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b6:	8b 02                	mov    (%edx),%eax
+ 9b8:	8b 00                	mov    (%eax),%eax
+ 9ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9c2:	39 d9                	cmp    %ebx,%ecx
+ 9c4:	75 d0                	jne    996 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 9c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9c9:	89 15 54 38 00 00    	mov    %edx,0x3854
+    p->s.size += bp->s.size;
+ 9cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9d2:	8b 09                	mov    (%ecx),%ecx
+ 9d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 9d6:	5b                   	pop    %ebx
+ 9d7:	5e                   	pop    %esi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	89 c7                	mov    %eax,%edi
+ 9e6:	56                   	push   %esi
+ 9e7:	53                   	push   %ebx
+ 9e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9eb:	a1 54 38 00 00       	mov    0x3854,%eax
+ 9f0:	85 c0                	test   %eax,%eax
+ 9f2:	0f 84 88 00 00 00    	je     a80 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 9fd:	39 f9                	cmp    %edi,%ecx
+ 9ff:	73 5f                	jae    a60 <bigalloc+0x80>
+  if(nu < 4096)
+ a01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a06:	39 df                	cmp    %ebx,%edi
+ a08:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a0b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a12:	eb 0d                	jmp    a21 <bigalloc+0x41>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a1d:	39 f9                	cmp    %edi,%ecx
+ a1f:	73 3f                	jae    a60 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a21:	89 d0                	mov    %edx,%eax
+ a23:	39 15 54 38 00 00    	cmp    %edx,0x3854
+ a29:	75 ed                	jne    a18 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a2b:	83 ec 0c             	sub    $0xc,%esp
+ a2e:	56                   	push   %esi
+ a2f:	e8 67 fb ff ff       	call   59b <sbrk>
+  if(p == (char*)-1)
+ a34:	83 c4 10             	add    $0x10,%esp
+ a37:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a3a:	74 11                	je     a4d <bigalloc+0x6d>
+  hp->s.size = nu;
+ a3c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ a3f:	e8 1c ff ff ff       	call   960 <bigfree>
+  return freep;
+ a44:	a1 54 38 00 00       	mov    0x3854,%eax
+      if((p = morecore(nunits)) == 0)
+ a49:	85 c0                	test   %eax,%eax
+ a4b:	75 cb                	jne    a18 <bigalloc+0x38>
+        return 0;
+  }
+}
+ a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a50:	31 d2                	xor    %edx,%edx
+}
+ a52:	5b                   	pop    %ebx
+ a53:	89 d0                	mov    %edx,%eax
+ a55:	5e                   	pop    %esi
+ a56:	5f                   	pop    %edi
+ a57:	5d                   	pop    %ebp
+ a58:	c3                   	ret
+ a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a60:	39 cf                	cmp    %ecx,%edi
+ a62:	74 4c                	je     ab0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ a64:	29 f9                	sub    %edi,%ecx
+ a66:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a69:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a6c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a6f:	a3 54 38 00 00       	mov    %eax,0x3854
+}
+ a74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a77:	89 d0                	mov    %edx,%eax
+ a79:	5b                   	pop    %ebx
+ a7a:	5e                   	pop    %esi
+ a7b:	5f                   	pop    %edi
+ a7c:	5d                   	pop    %ebp
+ a7d:	c3                   	ret
+ a7e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ a80:	c7 05 54 38 00 00 58 	movl   $0x3858,0x3854
+ a87:	38 00 00 
+    base.s.size = 0;
+ a8a:	ba 58 38 00 00       	mov    $0x3858,%edx
+    base.s.ptr = freep = prevp = &base;
+ a8f:	c7 05 58 38 00 00 58 	movl   $0x3858,0x3858
+ a96:	38 00 00 
+    base.s.size = 0;
+ a99:	c7 05 5c 38 00 00 00 	movl   $0x0,0x385c
+ aa0:	00 00 00 
+    if(p->s.size >= nunits){
+ aa3:	e9 59 ff ff ff       	jmp    a01 <bigalloc+0x21>
+ aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ab0:	8b 0a                	mov    (%edx),%ecx
+ ab2:	89 08                	mov    %ecx,(%eax)
+ ab4:	eb b9                	jmp    a6f <bigalloc+0x8f>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <free>:
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	53                   	push   %ebx
+ ac4:	83 ec 04             	sub    $0x4,%esp
+ ac7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ aca:	85 c9                	test   %ecx,%ecx
+ acc:	74 58                	je     b26 <free+0x66>
+  bp = (Header*)ap - 1;
+ ace:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ ad1:	ba 01 00 00 00       	mov    $0x1,%edx
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+ ae0:	89 d0                	mov    %edx,%eax
+ ae2:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+  while(xchg(&locked, 1) != 0)
+ ae9:	85 c0                	test   %eax,%eax
+ aeb:	75 f3                	jne    ae0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ aed:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ af0:	83 fa 40             	cmp    $0x40,%edx
+ af3:	77 3b                	ja     b30 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ af5:	83 fa 02             	cmp    $0x2,%edx
+ af8:	76 3f                	jbe    b39 <free+0x79>
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b00:	83 c0 01             	add    $0x1,%eax
+ b03:	39 14 85 20 10 00 00 	cmp    %edx,0x1020(,%eax,4)
+ b0a:	72 f4                	jb     b00 <free+0x40>
+    bp->s.ptr = classfree[c];
+ b0c:	8b 14 85 20 38 00 00 	mov    0x3820(,%eax,4),%edx
+    classfree[c] = bp;
+ b13:	89 1c 85 20 38 00 00 	mov    %ebx,0x3820(,%eax,4)
+    bp->s.ptr = classfree[c];
+ b1a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ b1d:	31 c0                	xor    %eax,%eax
+ b1f:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+}
+ b26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b29:	c9                   	leave
+ b2a:	c3                   	ret
+ b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+    bigfree(bp);
+ b30:	89 d8                	mov    %ebx,%eax
+ b32:	e8 29 fe ff ff       	call   960 <bigfree>
+ b37:	eb e4                	jmp    b1d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ b39:	31 c0                	xor    %eax,%eax
+ b3b:	eb cf                	jmp    b0c <free+0x4c>
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b40 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b40:	55                   	push   %ebp
+ b41:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b46:	89 e5                	mov    %esp,%ebp
+ b48:	57                   	push   %edi
+ b49:	56                   	push   %esi
+ b4a:	53                   	push   %ebx
+ b4b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b51:	8d 50 07             	lea    0x7(%eax),%edx
+ b54:	c1 ea 03             	shr    $0x3,%edx
+ b57:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b60:	89 c8                	mov    %ecx,%eax
+ b62:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+ b69:	85 c0                	test   %eax,%eax
+ b6b:	75 f3                	jne    b60 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ b6d:	89 c3                	mov    %eax,%ebx
+ b6f:	83 fa 40             	cmp    $0x40,%edx
+ b72:	77 4c                	ja     bc0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ b74:	be 02 00 00 00       	mov    $0x2,%esi
+ b79:	83 fa 02             	cmp    $0x2,%edx
+ b7c:	76 10                	jbe    b8e <malloc+0x4e>
+ b7e:	66 90                	xchg   %ax,%ax
+ b80:	83 c3 01             	add    $0x1,%ebx
+ b83:	8b 34 9d 20 10 00 00 	mov    0x1020(,%ebx,4),%esi
+ b8a:	39 d6                	cmp    %edx,%esi
+ b8c:	72 f2                	jb     b80 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ b8e:	8b 14 9d 20 38 00 00 	mov    0x3820(,%ebx,4),%edx
+ b95:	85 d2                	test   %edx,%edx
+ b97:	74 47                	je     be0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ b99:	8b 3a                	mov    (%edx),%edi
+ b9b:	89 3c 9d 20 38 00 00 	mov    %edi,0x3820(,%ebx,4)
+ ba2:	31 c0                	xor    %eax,%eax
+ ba4:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ bab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ bae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ bb1:	5b                   	pop    %ebx
+ bb2:	5e                   	pop    %esi
+ bb3:	5f                   	pop    %edi
+ bb4:	5d                   	pop    %ebp
+ bb5:	c3                   	ret
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ bc0:	89 d0                	mov    %edx,%eax
+ bc2:	e8 19 fe ff ff       	call   9e0 <bigalloc>
+ bc7:	89 c2                	mov    %eax,%edx
+ bc9:	89 d8                	mov    %ebx,%eax
+ bcb:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+  return p ? (void*)(p + 1) : 0;
+ bd2:	85 d2                	test   %edx,%edx
+ bd4:	75 d5                	jne    bab <malloc+0x6b>
+ bd6:	31 c0                	xor    %eax,%eax
+}
+ bd8:	83 c4 1c             	add    $0x1c,%esp
+ bdb:	5b                   	pop    %ebx
+ bdc:	5e                   	pop    %esi
+ bdd:	5f                   	pop    %edi
+ bde:	5d                   	pop    %ebp
+ bdf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ be0:	b8 00 02 00 00       	mov    $0x200,%eax
+ be5:	e8 f6 fd ff ff       	call   9e0 <bigalloc>
+ bea:	85 c0                	test   %eax,%eax
+ bec:	74 44                	je     c32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ bee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ bf5:	8b 14 9d 20 38 00 00 	mov    0x3820(,%ebx,4),%edx
+ bfc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ bff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ c02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ c08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ c0b:	39 cf                	cmp    %ecx,%edi
+ c0d:	72 8a                	jb     b99 <malloc+0x59>
+ c0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ c12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ c15:	8d 76 00             	lea    0x0(%esi),%esi
+ c18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ c1a:	89 70 04             	mov    %esi,0x4(%eax)
+ c1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ c21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ c23:	01 d8                	add    %ebx,%eax
+ c25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ c28:	73 ee                	jae    c18 <malloc+0xd8>
+ c2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ c2d:	e9 69 ff ff ff       	jmp    b9b <malloc+0x5b>
+ c32:	f0 87 05 00 38 00 00 	lock xchg %eax,0x3800
+  return p ? (void*)(p + 1) : 0;
+ c39:	31 c0                	xor    %eax,%eax
+ c3b:	eb 9b                	jmp    bd8 <malloc+0x98>
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	56                   	push   %esi
+ c44:	53                   	push   %ebx
+ c45:	8b 45 08             	mov    0x8(%ebp),%eax
+ c48:	f7 65 0c             	mull   0xc(%ebp)
+ c4b:	70 33                	jo     c80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ c4d:	83 ec 0c             	sub    $0xc,%esp
+ c50:	89 c3                	mov    %eax,%ebx
+ c52:	50                   	push   %eax
+ c53:	e8 e8 fe ff ff       	call   b40 <malloc>
+ c58:	83 c4 10             	add    $0x10,%esp
+ c5b:	89 c6                	mov    %eax,%esi
+ c5d:	85 c0                	test   %eax,%eax
+ c5f:	74 1f                	je     c80 <calloc+0x40>
+    memset(p, 0, n);
+ c61:	83 ec 04             	sub    $0x4,%esp
+ c64:	53                   	push   %ebx
+ c65:	6a 00                	push   $0x0
+ c67:	50                   	push   %eax
+ c68:	e8 23 f7 ff ff       	call   390 <memset>
+ c6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c73:	89 f0                	mov    %esi,%eax
+ c75:	5b                   	pop    %ebx
+ c76:	5e                   	pop    %esi
+ c77:	5d                   	pop    %ebp
+ c78:	c3                   	ret
+ c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c83:	31 f6                	xor    %esi,%esi
+}
+ c85:	89 f0                	mov    %esi,%eax
+ c87:	5b                   	pop    %ebx
+ c88:	5e                   	pop    %esi
+ c89:	5d                   	pop    %ebp
+ c8a:	c3                   	ret
+ c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+
+00000c90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+ c99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c9f:	85 db                	test   %ebx,%ebx
+ ca1:	74 55                	je     cf8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ca3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ca6:	89 de                	mov    %ebx,%esi
+ ca8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ caf:	39 c7                	cmp    %eax,%edi
+ cb1:	72 0d                	jb     cc0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cb6:	89 f0                	mov    %esi,%eax
+ cb8:	5b                   	pop    %ebx
+ cb9:	5e                   	pop    %esi
+ cba:	5f                   	pop    %edi
+ cbb:	5d                   	pop    %ebp
+ cbc:	c3                   	ret
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ cc0:	83 ec 0c             	sub    $0xc,%esp
+ cc3:	50                   	push   %eax
+ cc4:	e8 77 fe ff ff       	call   b40 <malloc>
+ cc9:	83 c4 10             	add    $0x10,%esp
+ ccc:	89 c6                	mov    %eax,%esi
+ cce:	85 c0                	test   %eax,%eax
+ cd0:	74 e1                	je     cb3 <realloc+0x23>
+  memmove(p, ap, have);
+ cd2:	83 ec 04             	sub    $0x4,%esp
+ cd5:	57                   	push   %edi
+ cd6:	53                   	push   %ebx
+ cd7:	50                   	push   %eax
+ cd8:	e8 03 f8 ff ff       	call   4e0 <memmove>
+  free(ap);
+ cdd:	89 1c 24             	mov    %ebx,(%esp)
+ ce0:	e8 db fd ff ff       	call   ac0 <free>
+  return p;
+ ce5:	83 c4 10             	add    $0x10,%esp
+}
+ ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ceb:	89 f0                	mov    %esi,%eax
+ ced:	5b                   	pop    %ebx
+ cee:	5e                   	pop    %esi
+ cef:	5f                   	pop    %edi
+ cf0:	5d                   	pop    %ebp
+ cf1:	c3                   	ret
+ cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ cf8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cfe:	5b                   	pop    %ebx
+ cff:	5e                   	pop    %esi
+ d00:	5f                   	pop    %edi
+ d01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d02:	e9 39 fe ff ff       	jmp    b40 <malloc>
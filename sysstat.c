@@ -0,0 +1,152 @@
+// Count system calls and their latency, like a small strace -c.
+// usage: sysstat [-h] [command args...]
+// With a command, reset the counts, run the command, and report
+// only the calls made while it ran (by any process). Otherwise
+// report the counts since boot. -h adds a log2 histogram of
+// each call's latency in cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "sysstat.h"
+
+#define MAXSYS 64
+
+char *name[MAXSYS] = {
+[SYS_fork]            "fork",
+[SYS_exit]            "exit",
+[SYS_wait]            "wait",
+[SYS_pipe]            "pipe",
+[SYS_read]            "read",
+[SYS_kill]            "kill",
+[SYS_exec]            "exec",
+[SYS_fstat]           "fstat",
+[SYS_chdir]           "chdir",
+[SYS_dup]             "dup",
+[SYS_getpid]          "getpid",
+[SYS_sbrk]            "sbrk",
+[SYS_sleep]           "sleep",
+[SYS_uptime]          "uptime",
+[SYS_open]            "open",
+[SYS_write]           "write",
+[SYS_mknod]           "mknod",
+[SYS_unlink]          "unlink",
+[SYS_link]            "link",
+[SYS_mkdir]           "mkdir",
+[SYS_close]           "close",
+[SYS_getsysinfo]      "getsysinfo",
+[SYS_detect_deadlock] "detect_deadlock",
+[SYS_mlfqstatus]      "mlfqstatus",
+[SYS_mlfqstart]       "mlfqstart",
+[SYS_mlfqstop]        "mlfqstop",
+[SYS_mlfqvisual]      "mlfqvisual",
+[SYS_mlfqrealtime]    "mlfqrealtime",
+[SYS_setpriority]     "setpriority",
+[SYS_getallprocinfo]  "getallprocinfo",
+[SYS_getcpustats]     "getcpustats",
+[SYS_setscheduler]    "setscheduler",
+[SYS_getdeadlockinfo] "getdeadlockinfo",
+[SYS_getscheduler]    "getscheduler",
+[SYS_splice]          "splice",
+[SYS_readv]           "readv",
+[SYS_writev]          "writev",
+[SYS_pread]           "pread",
+[SYS_pwrite]          "pwrite",
+[SYS_getlogstat]      "getlogstat",
+[SYS_mount]           "mount",
+[SYS_umount]          "umount",
+[SYS_mmap]            "mmap",
+[SYS_munmap]          "munmap",
+[SYS_membench]        "membench",
+[SYS_getlockstat]     "getlockstat",
+[SYS_lockbench]       "lockbench",
+[SYS_prof]            "prof",
+[SYS_tracectl]        "tracectl",
+[SYS_traceread]       "traceread",
+[SYS_getsysstat]      "getsysstat",
+[SYS_getwaitstat]     "getwaitstat",
+[SYS_getschedwait]    "getschedwait",
+[SYS_mlfqread]        "mlfqread",
+[SYS_dllock]          "dllock",
+[SYS_watchdogctl]     "watchdogctl",
+[SYS_deadlocklog]     "deadlocklog",
+[SYS_clone]           "clone",
+[SYS_join]            "join",
+[SYS_futex]           "futex",
+[SYS_shmat]           "shmat",
+[SYS_shmdt]           "shmdt",
+[SYS_poll]            "poll",
+};
+
+struct sysstat st[MAXSYS];
+int order[MAXSYS];
+
+void
+histogram(struct sysstat *s)
+{
+  int b;
+
+  for(b = 0; b < NSYSHIST; b++)
+    if(s->hist[b])
+      printf(1, "\t\t%d-%d cycles:\t%d\n", 1 << b, (2 << b) - 1, s->hist[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, t, n, hist, pid;
+  uint calls, avg;
+
+  hist = 0;
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-h") == 0){
+    hist = 1;
+    i++;
+  }
+
+  if(i < argc){
+    getsysstat(st, MAXSYS, 1);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "sysstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[i], argv+i);
+      printf(2, "sysstat: exec %s failed\n", argv[i]);
+      exit();
+    }
+    wait();
+  }
+  if((n = getsysstat(st, MAXSYS, 0)) < 0){
+    printf(2, "sysstat: getsysstat failed\n");
+    exit();
+  }
+
+  // Sort by total time, most first.
+  for(i = 0; i < n; i++){
+    t = i;
+    for(j = i; j > 0 && st[order[j-1]].cycles < st[t].cycles; j--)
+      order[j] = order[j-1];
+    order[j] = t;
+  }
+
+  calls = 0;
+  printf(1, "calls\ttotal(Kc)\tavg(c)\tsyscall\n");
+  for(i = 0; i < n; i++){
+    j = order[i];
+    if(st[j].ncall == 0)
+      continue;
+    calls += st[j].ncall;
+    // cycles is in units of 1024.
+    avg = st[j].cycles / st[j].ncall * 1024 +
+          st[j].cycles % st[j].ncall * 1024 / st[j].ncall;
+    printf(1, "%d\t%d\t\t%d\t%s\n", st[j].ncall, st[j].cycles, avg,
+           j < MAXSYS && name[j] ? name[j] : "?");
+    if(hist)
+      histogram(&st[j]);
+  }
+  printf(1, "%d calls\n", calls);
+  exit();
+}
@@ -0,0 +1,11 @@
+// Per-system-call statistics returned by getsysstat(),
+// indexed by system call number.
+// Both the kernel and user programs use this header file.
+
+#define NSYSHIST 32  // latency histogram buckets
+
+struct sysstat {
+  uint ncall;           // Completed calls
+  uint cycles;          // Total time in the kernel, in units of 1024 cycles
+  uint hist[NSYSHIST];  // hist[i] counts calls taking 2^i to 2^(i+1)-1 cycles
+};
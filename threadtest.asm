@@ -0,0 +1,2799 @@
+
+_threadtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "exit test ok\n");
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  counttest();
+      11:	e8 7a 01 00 00       	call   190 <counttest>
+  sharetest();
+      16:	e8 35 02 00 00       	call   250 <sharetest>
+  fdtest();
+      1b:	e8 20 04 00 00       	call   440 <fdtest>
+  exittest();
+      20:	e8 db 05 00 00       	call   600 <exittest>
+  printf(1, "threadtest ok\n");
+      25:	83 ec 08             	sub    $0x8,%esp
+      28:	68 50 16 00 00       	push   $0x1650
+      2d:	6a 01                	push   $0x1
+      2f:	e8 0c 0f 00 00       	call   f40 <printf>
+  exit();
+      34:	e8 6a 0c 00 00       	call   ca3 <exit>
+      39:	66 90                	xchg   %ax,%ax
+      3b:	66 90                	xchg   %ax,%ax
+      3d:	66 90                	xchg   %ax,%ax
+      3f:	90                   	nop
+
+00000040 <mapper>:
+{
+      40:	55                   	push   %ebp
+  mapok = mapped[0] == *(char*)arg;
+      41:	8b 15 10 1e 00 00    	mov    0x1e10,%edx
+{
+      47:	89 e5                	mov    %esp,%ebp
+  mapok = mapped[0] == *(char*)arg;
+      49:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+      4c:	5d                   	pop    %ebp
+  mapok = mapped[0] == *(char*)arg;
+      4d:	0f b6 00             	movzbl (%eax),%eax
+      50:	38 02                	cmp    %al,(%edx)
+      52:	0f 94 c0             	sete   %al
+      55:	0f b6 c0             	movzbl %al,%eax
+      58:	a3 0c 1e 00 00       	mov    %eax,0x1e0c
+}
+      5d:	c3                   	ret
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <spinner>:
+  for(;;)
+      60:	eb fe                	jmp    60 <spinner>
+      62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000070 <adder>:
+{
+      70:	55                   	push   %ebp
+      71:	89 e5                	mov    %esp,%ebp
+      73:	53                   	push   %ebx
+      74:	bb 10 27 00 00       	mov    $0x2710,%ebx
+      79:	83 ec 04             	sub    $0x4,%esp
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    lock_acquire(&lock);
+      80:	83 ec 0c             	sub    $0xc,%esp
+      83:	68 1c 1e 00 00       	push   $0x1e1c
+      88:	e8 c3 07 00 00       	call   850 <lock_acquire>
+    counter++;
+      8d:	a1 18 1e 00 00       	mov    0x1e18,%eax
+      92:	83 c0 01             	add    $0x1,%eax
+      95:	a3 18 1e 00 00       	mov    %eax,0x1e18
+    lock_release(&lock);
+      9a:	c7 04 24 1c 1e 00 00 	movl   $0x1e1c,(%esp)
+      a1:	e8 ca 07 00 00       	call   870 <lock_release>
+  for(i = 0; i < NINCR; i++){
+      a6:	83 c4 10             	add    $0x10,%esp
+      a9:	83 eb 01             	sub    $0x1,%ebx
+      ac:	75 d2                	jne    80 <adder+0x10>
+}
+      ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      b1:	c9                   	leave
+      b2:	c3                   	ret
+      b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000c0 <grower>:
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	83 ec 14             	sub    $0x14,%esp
+  if((p = sbrk(4096)) == (char*)-1)
+      c6:	68 00 10 00 00       	push   $0x1000
+      cb:	e8 5b 0c 00 00       	call   d2b <sbrk>
+      d0:	83 c4 10             	add    $0x10,%esp
+      d3:	83 f8 ff             	cmp    $0xffffffff,%eax
+      d6:	74 27                	je     ff <grower+0x3f>
+  write(fds[1], arg, 1);
+      d8:	83 ec 04             	sub    $0x4,%esp
+  p[0] = 'g';
+      db:	c6 00 67             	movb   $0x67,(%eax)
+  p[4095] = 'h';
+      de:	c6 80 ff 0f 00 00 68 	movb   $0x68,0xfff(%eax)
+  grown = p;
+      e5:	a3 14 1e 00 00       	mov    %eax,0x1e14
+  write(fds[1], arg, 1);
+      ea:	6a 01                	push   $0x1
+      ec:	ff 75 08             	push   0x8(%ebp)
+      ef:	ff 35 04 1e 00 00    	push   0x1e04
+      f5:	e8 c9 0b 00 00       	call   cc3 <write>
+}
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	c9                   	leave
+      fe:	c3                   	ret
+    exit();
+      ff:	e8 9f 0b 00 00       	call   ca3 <exit>
+     104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     10f:	90                   	nop
+
+00000110 <blocker>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	83 ec 1c             	sub    $0x1c,%esp
+  read(fds[0], &c, 1);
+     116:	8d 45 f7             	lea    -0x9(%ebp),%eax
+     119:	6a 01                	push   $0x1
+     11b:	50                   	push   %eax
+     11c:	ff 35 00 1e 00 00    	push   0x1e00
+     122:	e8 94 0b 00 00       	call   cbb <read>
+}
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	c9                   	leave
+     12b:	c3                   	ret
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <fdsharer>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	53                   	push   %ebx
+     134:	83 ec 0c             	sub    $0xc,%esp
+     137:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  tfd = open("README", O_RDONLY);
+     13a:	6a 00                	push   $0x0
+     13c:	68 41 15 00 00       	push   $0x1541
+     141:	e8 9d 0b 00 00       	call   ce3 <open>
+     146:	a3 08 1e 00 00       	mov    %eax,0x1e08
+  close(fds[1]);
+     14b:	58                   	pop    %eax
+     14c:	ff 35 04 1e 00 00    	push   0x1e04
+     152:	e8 74 0b 00 00       	call   ccb <close>
+  chdir(arg);
+     157:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     15a:	83 c4 10             	add    $0x10,%esp
+}
+     15d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     160:	c9                   	leave
+  chdir(arg);
+     161:	e9 ad 0b 00 00       	jmp    d13 <chdir>
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <fail>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "threadtest: %s failed\n", msg);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 a0 14 00 00       	push   $0x14a0
+     17e:	6a 01                	push   $0x1
+     180:	e8 bb 0d 00 00       	call   f40 <printf>
+  exit();
+     185:	e8 19 0b 00 00       	call   ca3 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <counttest>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	53                   	push   %ebx
+  counter = 0;
+     194:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+     199:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "count test\n");
+     19c:	68 b7 14 00 00       	push   $0x14b7
+     1a1:	6a 01                	push   $0x1
+     1a3:	e8 98 0d 00 00       	call   f40 <printf>
+  lock_init(&lock);
+     1a8:	c7 04 24 1c 1e 00 00 	movl   $0x1e1c,(%esp)
+     1af:	e8 8c 06 00 00       	call   840 <lock_init>
+  counter = 0;
+     1b4:	83 c4 10             	add    $0x10,%esp
+     1b7:	c7 05 18 1e 00 00 00 	movl   $0x0,0x1e18
+     1be:	00 00 00 
+    if(thread_create(adder, 0) < 0)
+     1c1:	83 ec 08             	sub    $0x8,%esp
+     1c4:	6a 00                	push   $0x0
+     1c6:	68 70 00 00 00       	push   $0x70
+     1cb:	e8 d0 05 00 00       	call   7a0 <thread_create>
+     1d0:	83 c4 10             	add    $0x10,%esp
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	78 44                	js     21b <counttest+0x8b>
+  for(i = 0; i < NTHREAD; i++)
+     1d7:	83 eb 01             	sub    $0x1,%ebx
+     1da:	75 e5                	jne    1c1 <counttest+0x31>
+     1dc:	bb 04 00 00 00       	mov    $0x4,%ebx
+    if(thread_join() < 0)
+     1e1:	e8 1a 06 00 00       	call   800 <thread_join>
+     1e6:	85 c0                	test   %eax,%eax
+     1e8:	78 3e                	js     228 <counttest+0x98>
+  for(i = 0; i < NTHREAD; i++)
+     1ea:	83 eb 01             	sub    $0x1,%ebx
+     1ed:	75 f2                	jne    1e1 <counttest+0x51>
+  if(thread_join() >= 0)
+     1ef:	e8 0c 06 00 00       	call   800 <thread_join>
+     1f4:	85 c0                	test   %eax,%eax
+     1f6:	79 4a                	jns    242 <counttest+0xb2>
+  if(counter != NTHREAD*NINCR)
+     1f8:	a1 18 1e 00 00       	mov    0x1e18,%eax
+     1fd:	3d 40 9c 00 00       	cmp    $0x9c40,%eax
+     202:	75 31                	jne    235 <counttest+0xa5>
+  printf(1, "count test ok\n");
+     204:	83 ec 08             	sub    $0x8,%esp
+     207:	68 fa 14 00 00       	push   $0x14fa
+     20c:	6a 01                	push   $0x1
+     20e:	e8 2d 0d 00 00       	call   f40 <printf>
+}
+     213:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  printf(1, "count test ok\n");
+     216:	83 c4 10             	add    $0x10,%esp
+}
+     219:	c9                   	leave
+     21a:	c3                   	ret
+      fail("thread_create");
+     21b:	83 ec 0c             	sub    $0xc,%esp
+     21e:	68 c3 14 00 00       	push   $0x14c3
+     223:	e8 48 ff ff ff       	call   170 <fail>
+      fail("thread_join");
+     228:	83 ec 0c             	sub    $0xc,%esp
+     22b:	68 d1 14 00 00       	push   $0x14d1
+     230:	e8 3b ff ff ff       	call   170 <fail>
+    fail("counter");
+     235:	83 ec 0c             	sub    $0xc,%esp
+     238:	68 f2 14 00 00       	push   $0x14f2
+     23d:	e8 2e ff ff ff       	call   170 <fail>
+    fail("join with no threads");
+     242:	83 ec 0c             	sub    $0xc,%esp
+     245:	68 dd 14 00 00       	push   $0x14dd
+     24a:	e8 21 ff ff ff       	call   170 <fail>
+     24f:	90                   	nop
+
+00000250 <sharetest>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	56                   	push   %esi
+     254:	53                   	push   %ebx
+     255:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "share test\n");
+     258:	68 09 15 00 00       	push   $0x1509
+     25d:	6a 01                	push   $0x1
+     25f:	e8 dc 0c 00 00       	call   f40 <printf>
+  if(pipe(fds) < 0)
+     264:	c7 04 24 00 1e 00 00 	movl   $0x1e00,(%esp)
+     26b:	e8 43 0a 00 00       	call   cb3 <pipe>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	0f 88 9c 01 00 00    	js     417 <sharetest+0x1c7>
+  if(thread_create(grower, "x") < 0)
+     27b:	83 ec 08             	sub    $0x8,%esp
+     27e:	68 1a 15 00 00       	push   $0x151a
+     283:	68 c0 00 00 00       	push   $0xc0
+     288:	e8 13 05 00 00       	call   7a0 <thread_create>
+     28d:	83 c4 10             	add    $0x10,%esp
+     290:	85 c0                	test   %eax,%eax
+     292:	0f 88 72 01 00 00    	js     40a <sharetest+0x1ba>
+  if(read(fds[0], &c, 1) != 1 || c != 'x')
+     298:	83 ec 04             	sub    $0x4,%esp
+     29b:	8d 75 f7             	lea    -0x9(%ebp),%esi
+     29e:	6a 01                	push   $0x1
+     2a0:	56                   	push   %esi
+     2a1:	ff 35 00 1e 00 00    	push   0x1e00
+     2a7:	e8 0f 0a 00 00       	call   cbb <read>
+     2ac:	83 c4 10             	add    $0x10,%esp
+     2af:	83 f8 01             	cmp    $0x1,%eax
+     2b2:	0f 85 1e 01 00 00    	jne    3d6 <sharetest+0x186>
+     2b8:	80 7d f7 78          	cmpb   $0x78,-0x9(%ebp)
+     2bc:	0f 85 14 01 00 00    	jne    3d6 <sharetest+0x186>
+  if(thread_join() < 0)
+     2c2:	e8 39 05 00 00       	call   800 <thread_join>
+     2c7:	85 c0                	test   %eax,%eax
+     2c9:	0f 88 55 01 00 00    	js     424 <sharetest+0x1d4>
+  if(grown == 0 || grown[0] != 'g' || grown[4095] != 'h')
+     2cf:	a1 14 1e 00 00       	mov    0x1e14,%eax
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	0f 84 ed 00 00 00    	je     3c9 <sharetest+0x179>
+     2dc:	0f b6 10             	movzbl (%eax),%edx
+     2df:	80 fa 67             	cmp    $0x67,%dl
+     2e2:	0f 85 e1 00 00 00    	jne    3c9 <sharetest+0x179>
+     2e8:	0f b6 80 ff 0f 00 00 	movzbl 0xfff(%eax),%eax
+     2ef:	3c 68                	cmp    $0x68,%al
+     2f1:	0f 85 d2 00 00 00    	jne    3c9 <sharetest+0x179>
+  close(fds[0]);
+     2f7:	83 ec 0c             	sub    $0xc,%esp
+     2fa:	ff 35 00 1e 00 00    	push   0x1e00
+     300:	e8 c6 09 00 00       	call   ccb <close>
+  close(fds[1]);
+     305:	58                   	pop    %eax
+     306:	ff 35 04 1e 00 00    	push   0x1e04
+     30c:	e8 ba 09 00 00       	call   ccb <close>
+  if((fd = open("README", O_RDONLY)) < 0 || read(fd, &c, 1) != 1)
+     311:	58                   	pop    %eax
+     312:	5a                   	pop    %edx
+     313:	6a 00                	push   $0x0
+     315:	68 41 15 00 00       	push   $0x1541
+     31a:	e8 c4 09 00 00       	call   ce3 <open>
+     31f:	83 c4 10             	add    $0x10,%esp
+     322:	89 c3                	mov    %eax,%ebx
+     324:	85 c0                	test   %eax,%eax
+     326:	0f 88 c4 00 00 00    	js     3f0 <sharetest+0x1a0>
+     32c:	83 ec 04             	sub    $0x4,%esp
+     32f:	6a 01                	push   $0x1
+     331:	56                   	push   %esi
+     332:	50                   	push   %eax
+     333:	e8 83 09 00 00       	call   cbb <read>
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	83 f8 01             	cmp    $0x1,%eax
+     33e:	0f 85 ac 00 00 00    	jne    3f0 <sharetest+0x1a0>
+  if((mapped = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	6a 00                	push   $0x0
+     349:	53                   	push   %ebx
+     34a:	6a 02                	push   $0x2
+     34c:	6a 01                	push   $0x1
+     34e:	68 00 10 00 00       	push   $0x1000
+     353:	6a 00                	push   $0x0
+     355:	e8 91 0a 00 00       	call   deb <mmap>
+     35a:	83 c4 20             	add    $0x20,%esp
+     35d:	a3 10 1e 00 00       	mov    %eax,0x1e10
+     362:	83 f8 ff             	cmp    $0xffffffff,%eax
+     365:	0f 84 92 00 00 00    	je     3fd <sharetest+0x1ad>
+  close(fd);
+     36b:	83 ec 0c             	sub    $0xc,%esp
+     36e:	53                   	push   %ebx
+     36f:	e8 57 09 00 00       	call   ccb <close>
+  if(thread_create(mapper, &c) < 0 || thread_join() < 0)
+     374:	59                   	pop    %ecx
+     375:	5b                   	pop    %ebx
+     376:	56                   	push   %esi
+     377:	68 40 00 00 00       	push   $0x40
+     37c:	e8 1f 04 00 00       	call   7a0 <thread_create>
+     381:	83 c4 10             	add    $0x10,%esp
+     384:	85 c0                	test   %eax,%eax
+     386:	78 5b                	js     3e3 <sharetest+0x193>
+     388:	e8 73 04 00 00       	call   800 <thread_join>
+     38d:	85 c0                	test   %eax,%eax
+     38f:	78 52                	js     3e3 <sharetest+0x193>
+  if(!mapok)
+     391:	a1 0c 1e 00 00       	mov    0x1e0c,%eax
+     396:	85 c0                	test   %eax,%eax
+     398:	0f 84 93 00 00 00    	je     431 <sharetest+0x1e1>
+  munmap(mapped, 4096);
+     39e:	83 ec 08             	sub    $0x8,%esp
+     3a1:	68 00 10 00 00       	push   $0x1000
+     3a6:	ff 35 10 1e 00 00    	push   0x1e10
+     3ac:	e8 42 0a 00 00       	call   df3 <munmap>
+  printf(1, "share test ok\n");
+     3b1:	58                   	pop    %eax
+     3b2:	5a                   	pop    %edx
+     3b3:	68 6d 15 00 00       	push   $0x156d
+     3b8:	6a 01                	push   $0x1
+     3ba:	e8 81 0b 00 00       	call   f40 <printf>
+}
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3c5:	5b                   	pop    %ebx
+     3c6:	5e                   	pop    %esi
+     3c7:	5d                   	pop    %ebp
+     3c8:	c3                   	ret
+    fail("sbrk in thread");
+     3c9:	83 ec 0c             	sub    $0xc,%esp
+     3cc:	68 2d 15 00 00       	push   $0x152d
+     3d1:	e8 9a fd ff ff       	call   170 <fail>
+    fail("pipe from thread");
+     3d6:	83 ec 0c             	sub    $0xc,%esp
+     3d9:	68 1c 15 00 00       	push   $0x151c
+     3de:	e8 8d fd ff ff       	call   170 <fail>
+    fail("mapper thread");
+     3e3:	83 ec 0c             	sub    $0xc,%esp
+     3e6:	68 4d 15 00 00       	push   $0x154d
+     3eb:	e8 80 fd ff ff       	call   170 <fail>
+    fail("read README");
+     3f0:	83 ec 0c             	sub    $0xc,%esp
+     3f3:	68 3c 15 00 00       	push   $0x153c
+     3f8:	e8 73 fd ff ff       	call   170 <fail>
+    fail("mmap");
+     3fd:	83 ec 0c             	sub    $0xc,%esp
+     400:	68 48 15 00 00       	push   $0x1548
+     405:	e8 66 fd ff ff       	call   170 <fail>
+    fail("thread_create");
+     40a:	83 ec 0c             	sub    $0xc,%esp
+     40d:	68 c3 14 00 00       	push   $0x14c3
+     412:	e8 59 fd ff ff       	call   170 <fail>
+    fail("pipe");
+     417:	83 ec 0c             	sub    $0xc,%esp
+     41a:	68 15 15 00 00       	push   $0x1515
+     41f:	e8 4c fd ff ff       	call   170 <fail>
+    fail("thread_join");
+     424:	83 ec 0c             	sub    $0xc,%esp
+     427:	68 d1 14 00 00       	push   $0x14d1
+     42c:	e8 3f fd ff ff       	call   170 <fail>
+    fail("mapping in thread");
+     431:	83 ec 0c             	sub    $0xc,%esp
+     434:	68 5b 15 00 00       	push   $0x155b
+     439:	e8 32 fd ff ff       	call   170 <fail>
+     43e:	66 90                	xchg   %ax,%ax
+
+00000440 <fdtest>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 20             	sub    $0x20,%esp
+  printf(1, "fd test\n");
+     446:	68 7c 15 00 00       	push   $0x157c
+     44b:	6a 01                	push   $0x1
+     44d:	e8 ee 0a 00 00       	call   f40 <printf>
+  if(pipe(fds) < 0)
+     452:	c7 04 24 00 1e 00 00 	movl   $0x1e00,(%esp)
+     459:	e8 55 08 00 00       	call   cb3 <pipe>
+     45e:	83 c4 10             	add    $0x10,%esp
+     461:	85 c0                	test   %eax,%eax
+     463:	0f 88 7b 01 00 00    	js     5e4 <fdtest+0x1a4>
+  if(mkdir("thrdir") < 0)
+     469:	83 ec 0c             	sub    $0xc,%esp
+     46c:	68 f7 15 00 00       	push   $0x15f7
+     471:	e8 95 08 00 00       	call   d0b <mkdir>
+     476:	83 c4 10             	add    $0x10,%esp
+     479:	85 c0                	test   %eax,%eax
+     47b:	0f 88 56 01 00 00    	js     5d7 <fdtest+0x197>
+  if(thread_create(fdsharer, "thrdir") < 0 || thread_join() < 0)
+     481:	83 ec 08             	sub    $0x8,%esp
+     484:	68 f7 15 00 00       	push   $0x15f7
+     489:	68 30 01 00 00       	push   $0x130
+     48e:	e8 0d 03 00 00       	call   7a0 <thread_create>
+     493:	83 c4 10             	add    $0x10,%esp
+     496:	85 c0                	test   %eax,%eax
+     498:	0f 88 f8 00 00 00    	js     596 <fdtest+0x156>
+     49e:	e8 5d 03 00 00       	call   800 <thread_join>
+     4a3:	85 c0                	test   %eax,%eax
+     4a5:	0f 88 eb 00 00 00    	js     596 <fdtest+0x156>
+  if(tfd < 0 || read(tfd, &c, 1) != 1)
+     4ab:	a1 08 1e 00 00       	mov    0x1e08,%eax
+     4b0:	85 c0                	test   %eax,%eax
+     4b2:	0f 88 f8 00 00 00    	js     5b0 <fdtest+0x170>
+     4b8:	a1 08 1e 00 00       	mov    0x1e08,%eax
+     4bd:	83 ec 04             	sub    $0x4,%esp
+     4c0:	8d 55 f7             	lea    -0x9(%ebp),%edx
+     4c3:	6a 01                	push   $0x1
+     4c5:	52                   	push   %edx
+     4c6:	50                   	push   %eax
+     4c7:	e8 ef 07 00 00       	call   cbb <read>
+     4cc:	83 c4 10             	add    $0x10,%esp
+     4cf:	83 f8 01             	cmp    $0x1,%eax
+     4d2:	0f 85 d8 00 00 00    	jne    5b0 <fdtest+0x170>
+  close(tfd);
+     4d8:	a1 08 1e 00 00       	mov    0x1e08,%eax
+     4dd:	83 ec 0c             	sub    $0xc,%esp
+     4e0:	50                   	push   %eax
+     4e1:	e8 e5 07 00 00       	call   ccb <close>
+  if(write(fds[1], "x", 1) >= 0)
+     4e6:	83 c4 0c             	add    $0xc,%esp
+     4e9:	6a 01                	push   $0x1
+     4eb:	68 1a 15 00 00       	push   $0x151a
+     4f0:	ff 35 04 1e 00 00    	push   0x1e04
+     4f6:	e8 c8 07 00 00       	call   cc3 <write>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	85 c0                	test   %eax,%eax
+     500:	0f 89 c4 00 00 00    	jns    5ca <fdtest+0x18a>
+  close(fds[0]);
+     506:	83 ec 0c             	sub    $0xc,%esp
+     509:	ff 35 00 1e 00 00    	push   0x1e00
+     50f:	e8 b7 07 00 00       	call   ccb <close>
+  if((fd = open("f", O_CREATE|O_RDWR)) < 0)
+     514:	59                   	pop    %ecx
+     515:	58                   	pop    %eax
+     516:	68 02 02 00 00       	push   $0x202
+     51b:	68 f4 15 00 00       	push   $0x15f4
+     520:	e8 be 07 00 00       	call   ce3 <open>
+     525:	83 c4 10             	add    $0x10,%esp
+     528:	85 c0                	test   %eax,%eax
+     52a:	0f 88 8d 00 00 00    	js     5bd <fdtest+0x17d>
+  close(fd);
+     530:	83 ec 0c             	sub    $0xc,%esp
+     533:	50                   	push   %eax
+     534:	e8 92 07 00 00       	call   ccb <close>
+  if(chdir("/") < 0 || (fd = open("/thrdir/f", O_RDONLY)) < 0)
+     539:	c7 04 24 da 15 00 00 	movl   $0x15da,(%esp)
+     540:	e8 ce 07 00 00       	call   d13 <chdir>
+     545:	83 c4 10             	add    $0x10,%esp
+     548:	85 c0                	test   %eax,%eax
+     54a:	78 57                	js     5a3 <fdtest+0x163>
+     54c:	83 ec 08             	sub    $0x8,%esp
+     54f:	6a 00                	push   $0x0
+     551:	68 ec 15 00 00       	push   $0x15ec
+     556:	e8 88 07 00 00       	call   ce3 <open>
+     55b:	83 c4 10             	add    $0x10,%esp
+     55e:	85 c0                	test   %eax,%eax
+     560:	78 41                	js     5a3 <fdtest+0x163>
+  close(fd);
+     562:	83 ec 0c             	sub    $0xc,%esp
+     565:	50                   	push   %eax
+     566:	e8 60 07 00 00       	call   ccb <close>
+  unlink("/thrdir/f");
+     56b:	c7 04 24 ec 15 00 00 	movl   $0x15ec,(%esp)
+     572:	e8 7c 07 00 00       	call   cf3 <unlink>
+  unlink("/thrdir");
+     577:	c7 04 24 f6 15 00 00 	movl   $0x15f6,(%esp)
+     57e:	e8 70 07 00 00       	call   cf3 <unlink>
+  printf(1, "fd test ok\n");
+     583:	58                   	pop    %eax
+     584:	5a                   	pop    %edx
+     585:	68 fe 15 00 00       	push   $0x15fe
+     58a:	6a 01                	push   $0x1
+     58c:	e8 af 09 00 00       	call   f40 <printf>
+}
+     591:	83 c4 10             	add    $0x10,%esp
+     594:	c9                   	leave
+     595:	c3                   	ret
+    fail("fdsharer thread");
+     596:	83 ec 0c             	sub    $0xc,%esp
+     599:	68 8b 15 00 00       	push   $0x158b
+     59e:	e8 cd fb ff ff       	call   170 <fail>
+    fail("chdir in thread");
+     5a3:	83 ec 0c             	sub    $0xc,%esp
+     5a6:	68 dc 15 00 00       	push   $0x15dc
+     5ab:	e8 c0 fb ff ff       	call   170 <fail>
+    fail("fd opened by thread");
+     5b0:	83 ec 0c             	sub    $0xc,%esp
+     5b3:	68 9b 15 00 00       	push   $0x159b
+     5b8:	e8 b3 fb ff ff       	call   170 <fail>
+    fail("create in thread's cwd");
+     5bd:	83 ec 0c             	sub    $0xc,%esp
+     5c0:	68 c3 15 00 00       	push   $0x15c3
+     5c5:	e8 a6 fb ff ff       	call   170 <fail>
+    fail("fd closed by thread");
+     5ca:	83 ec 0c             	sub    $0xc,%esp
+     5cd:	68 af 15 00 00       	push   $0x15af
+     5d2:	e8 99 fb ff ff       	call   170 <fail>
+    fail("mkdir");
+     5d7:	83 ec 0c             	sub    $0xc,%esp
+     5da:	68 85 15 00 00       	push   $0x1585
+     5df:	e8 8c fb ff ff       	call   170 <fail>
+    fail("pipe");
+     5e4:	83 ec 0c             	sub    $0xc,%esp
+     5e7:	68 15 15 00 00       	push   $0x1515
+     5ec:	e8 7f fb ff ff       	call   170 <fail>
+     5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+
+00000600 <exittest>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	53                   	push   %ebx
+     604:	83 ec 1c             	sub    $0x1c,%esp
+  char *argv[] = { "echo", "exec", "worked", 0 };
+     607:	c7 45 e8 0a 16 00 00 	movl   $0x160a,-0x18(%ebp)
+     60e:	c7 45 ec 0f 16 00 00 	movl   $0x160f,-0x14(%ebp)
+     615:	c7 45 f0 14 16 00 00 	movl   $0x1614,-0x10(%ebp)
+     61c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  printf(1, "exit test\n");
+     623:	68 1b 16 00 00       	push   $0x161b
+     628:	6a 01                	push   $0x1
+     62a:	e8 11 09 00 00       	call   f40 <printf>
+  if(pipe(fds) < 0)
+     62f:	c7 04 24 00 1e 00 00 	movl   $0x1e00,(%esp)
+     636:	e8 78 06 00 00       	call   cb3 <pipe>
+     63b:	83 c4 10             	add    $0x10,%esp
+     63e:	85 c0                	test   %eax,%eax
+     640:	0f 88 fc 00 00 00    	js     742 <exittest+0x142>
+  if(thread_create(blocker, 0) < 0)
+     646:	83 ec 08             	sub    $0x8,%esp
+     649:	6a 00                	push   $0x0
+     64b:	68 10 01 00 00       	push   $0x110
+     650:	e8 4b 01 00 00       	call   7a0 <thread_create>
+     655:	83 c4 10             	add    $0x10,%esp
+     658:	85 c0                	test   %eax,%eax
+     65a:	0f 88 97 00 00 00    	js     6f7 <exittest+0xf7>
+  if(exec("echo", argv) >= 0)
+     660:	83 ec 08             	sub    $0x8,%esp
+     663:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     666:	50                   	push   %eax
+     667:	68 0a 16 00 00       	push   $0x160a
+     66c:	e8 6a 06 00 00       	call   cdb <exec>
+     671:	83 c4 10             	add    $0x10,%esp
+     674:	85 c0                	test   %eax,%eax
+     676:	0f 89 e0 00 00 00    	jns    75c <exittest+0x15c>
+  write(fds[1], "x", 1);
+     67c:	83 ec 04             	sub    $0x4,%esp
+     67f:	6a 01                	push   $0x1
+     681:	68 1a 15 00 00       	push   $0x151a
+     686:	ff 35 04 1e 00 00    	push   0x1e04
+     68c:	e8 32 06 00 00       	call   cc3 <write>
+  if(thread_join() < 0)
+     691:	e8 6a 01 00 00       	call   800 <thread_join>
+     696:	83 c4 10             	add    $0x10,%esp
+     699:	85 c0                	test   %eax,%eax
+     69b:	0f 88 ae 00 00 00    	js     74f <exittest+0x14f>
+  close(fds[0]);
+     6a1:	83 ec 0c             	sub    $0xc,%esp
+     6a4:	ff 35 00 1e 00 00    	push   0x1e00
+     6aa:	e8 1c 06 00 00       	call   ccb <close>
+  close(fds[1]);
+     6af:	58                   	pop    %eax
+     6b0:	ff 35 04 1e 00 00    	push   0x1e04
+     6b6:	e8 10 06 00 00       	call   ccb <close>
+  pid = fork();
+     6bb:	e8 db 05 00 00       	call   c9b <fork>
+  if(pid < 0)
+     6c0:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+     6c3:	89 c3                	mov    %eax,%ebx
+  if(pid < 0)
+     6c5:	85 c0                	test   %eax,%eax
+     6c7:	78 6c                	js     735 <exittest+0x135>
+  if(pid == 0){
+     6c9:	75 3d                	jne    708 <exittest+0x108>
+    if(thread_create(spinner, 0) < 0 || thread_create(spinner, 0) < 0)
+     6cb:	83 ec 08             	sub    $0x8,%esp
+     6ce:	6a 00                	push   $0x0
+     6d0:	68 60 00 00 00       	push   $0x60
+     6d5:	e8 c6 00 00 00       	call   7a0 <thread_create>
+     6da:	83 c4 10             	add    $0x10,%esp
+     6dd:	85 c0                	test   %eax,%eax
+     6df:	78 16                	js     6f7 <exittest+0xf7>
+     6e1:	83 ec 08             	sub    $0x8,%esp
+     6e4:	6a 00                	push   $0x0
+     6e6:	68 60 00 00 00       	push   $0x60
+     6eb:	e8 b0 00 00 00       	call   7a0 <thread_create>
+     6f0:	83 c4 10             	add    $0x10,%esp
+     6f3:	85 c0                	test   %eax,%eax
+     6f5:	79 39                	jns    730 <exittest+0x130>
+    fail("thread_create");
+     6f7:	83 ec 0c             	sub    $0xc,%esp
+     6fa:	68 c3 14 00 00       	push   $0x14c3
+     6ff:	e8 6c fa ff ff       	call   170 <fail>
+     704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(wait() != pid)
+     708:	e8 9e 05 00 00       	call   cab <wait>
+     70d:	39 d8                	cmp    %ebx,%eax
+     70f:	75 58                	jne    769 <exittest+0x169>
+  printf(1, "exit test ok\n");
+     711:	83 ec 08             	sub    $0x8,%esp
+     714:	68 42 16 00 00       	push   $0x1642
+     719:	6a 01                	push   $0x1
+     71b:	e8 20 08 00 00       	call   f40 <printf>
+}
+     720:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     723:	83 c4 10             	add    $0x10,%esp
+     726:	c9                   	leave
+     727:	c3                   	ret
+     728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+    exit();
+     730:	e8 6e 05 00 00       	call   ca3 <exit>
+    fail("fork");
+     735:	83 ec 0c             	sub    $0xc,%esp
+     738:	68 38 16 00 00       	push   $0x1638
+     73d:	e8 2e fa ff ff       	call   170 <fail>
+    fail("pipe");
+     742:	83 ec 0c             	sub    $0xc,%esp
+     745:	68 15 15 00 00       	push   $0x1515
+     74a:	e8 21 fa ff ff       	call   170 <fail>
+    fail("thread_join");
+     74f:	83 ec 0c             	sub    $0xc,%esp
+     752:	68 d1 14 00 00       	push   $0x14d1
+     757:	e8 14 fa ff ff       	call   170 <fail>
+    fail("exec with threads");
+     75c:	83 ec 0c             	sub    $0xc,%esp
+     75f:	68 26 16 00 00       	push   $0x1626
+     764:	e8 07 fa ff ff       	call   170 <fail>
+    fail("wait");
+     769:	83 ec 0c             	sub    $0xc,%esp
+     76c:	68 3d 16 00 00       	push   $0x163d
+     771:	e8 fa f9 ff ff       	call   170 <fail>
+     776:	66 90                	xchg   %ax,%ax
+     778:	66 90                	xchg   %ax,%ax
+     77a:	66 90                	xchg   %ax,%ax
+     77c:	66 90                	xchg   %ax,%ax
+     77e:	66 90                	xchg   %ax,%ax
+
+00000780 <threadstart>:
+
+#define STACKSIZE 4096  // clone() takes a one-page stack
+
+static void
+threadstart(void *fn, void *arg)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	83 ec 14             	sub    $0x14,%esp
+  ((void(*)(void*))fn)(arg);
+     786:	ff 75 0c             	push   0xc(%ebp)
+     789:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     78c:	e8 12 05 00 00       	call   ca3 <exit>
+     791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	53                   	push   %ebx
+     7a4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(STACKSIZE)) == 0)
+     7a7:	68 00 10 00 00       	push   $0x1000
+     7ac:	e8 1f 0b 00 00       	call   12d0 <malloc>
+     7b1:	83 c4 10             	add    $0x10,%esp
+     7b4:	85 c0                	test   %eax,%eax
+     7b6:	74 3f                	je     7f7 <thread_create+0x57>
+    return -1;
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+     7b8:	50                   	push   %eax
+     7b9:	89 c3                	mov    %eax,%ebx
+     7bb:	ff 75 0c             	push   0xc(%ebp)
+     7be:	ff 75 08             	push   0x8(%ebp)
+     7c1:	68 80 07 00 00       	push   $0x780
+     7c6:	e8 98 06 00 00       	call   e63 <clone>
+     7cb:	83 c4 10             	add    $0x10,%esp
+     7ce:	85 c0                	test   %eax,%eax
+     7d0:	78 0e                	js     7e0 <thread_create+0x40>
+    free(stack);
+  return pid;
+}
+     7d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7d5:	c9                   	leave
+     7d6:	c3                   	ret
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+    free(stack);
+     7e0:	83 ec 0c             	sub    $0xc,%esp
+     7e3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     7e6:	53                   	push   %ebx
+     7e7:	e8 64 0a 00 00       	call   1250 <free>
+     7ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     7ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+     7f2:	83 c4 10             	add    $0x10,%esp
+}
+     7f5:	c9                   	leave
+     7f6:	c3                   	ret
+    return -1;
+     7f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7fc:	eb d4                	jmp    7d2 <thread_create+0x32>
+     7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <thread_join>:
+
+// Wait for one of this process's threads to exit.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+     806:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     809:	50                   	push   %eax
+     80a:	e8 5c 06 00 00       	call   e6b <join>
+     80f:	83 c4 10             	add    $0x10,%esp
+     812:	85 c0                	test   %eax,%eax
+     814:	79 0a                	jns    820 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+     816:	c9                   	leave
+     817:	c3                   	ret
+     818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+     820:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+     823:	83 ec 0c             	sub    $0xc,%esp
+     826:	ff 75 f4             	push   -0xc(%ebp)
+     829:	e8 22 0a 00 00       	call   1250 <free>
+     82e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     831:	83 c4 10             	add    $0x10,%esp
+}
+     834:	c9                   	leave
+     835:	c3                   	ret
+     836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <lock_init>:
+
+// Spin locks, for threads.
+
+void
+lock_init(lock_t *lk)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+     843:	8b 45 08             	mov    0x8(%ebp),%eax
+     846:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     84c:	5d                   	pop    %ebp
+     84d:	c3                   	ret
+     84e:	66 90                	xchg   %ax,%ax
+
+00000850 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+     850:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     851:	b9 01 00 00 00       	mov    $0x1,%ecx
+     856:	89 e5                	mov    %esp,%ebp
+     858:	8b 55 08             	mov    0x8(%ebp),%edx
+     85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     85f:	90                   	nop
+     860:	89 c8                	mov    %ecx,%eax
+     862:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+     865:	85 c0                	test   %eax,%eax
+     867:	75 f7                	jne    860 <lock_acquire+0x10>
+    ;
+}
+     869:	5d                   	pop    %ebp
+     86a:	c3                   	ret
+     86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     86f:	90                   	nop
+
+00000870 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+     870:	55                   	push   %ebp
+     871:	31 c0                	xor    %eax,%eax
+     873:	89 e5                	mov    %esp,%ebp
+     875:	8b 55 08             	mov    0x8(%ebp),%edx
+     878:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+     87b:	5d                   	pop    %ebp
+     87c:	c3                   	ret
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <mutex_init>:
+// Taking a free mutex or releasing one no one waits for is a
+// single atomic instruction, with no system call.
+
+void
+mutex_init(mutex_t *m)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     883:	8b 45 08             	mov    0x8(%ebp),%eax
+     886:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     88c:	5d                   	pop    %ebp
+     88d:	c3                   	ret
+     88e:	66 90                	xchg   %ax,%ax
+
+00000890 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+     890:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+     891:	31 c0                	xor    %eax,%eax
+     893:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     898:	89 e5                	mov    %esp,%ebp
+     89a:	56                   	push   %esi
+     89b:	53                   	push   %ebx
+     89c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+     89f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     8a3:	85 c0                	test   %eax,%eax
+     8a5:	74 32                	je     8d9 <mutex_lock+0x49>
+    return;
+  // Contended: mark it as having sleepers, then sleep
+  // until a release finds it free.
+  if(c != 2)
+     8a7:	83 f8 02             	cmp    $0x2,%eax
+     8aa:	74 0c                	je     8b8 <mutex_lock+0x28>
+     8ac:	b8 02 00 00 00       	mov    $0x2,%eax
+     8b1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     8b4:	85 c0                	test   %eax,%eax
+     8b6:	74 21                	je     8d9 <mutex_lock+0x49>
+     8b8:	be 02 00 00 00       	mov    $0x2,%esi
+     8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     8c0:	83 ec 04             	sub    $0x4,%esp
+     8c3:	6a 02                	push   $0x2
+     8c5:	6a 01                	push   $0x1
+     8c7:	53                   	push   %ebx
+     8c8:	e8 a6 05 00 00       	call   e73 <futex>
+     8cd:	89 f0                	mov    %esi,%eax
+     8cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     8d2:	83 c4 10             	add    $0x10,%esp
+     8d5:	85 c0                	test   %eax,%eax
+     8d7:	75 e7                	jne    8c0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     8d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8dc:	5b                   	pop    %ebx
+     8dd:	5e                   	pop    %esi
+     8de:	5d                   	pop    %ebp
+     8df:	c3                   	ret
+
+000008e0 <mutex_trylock>:
+
+// Take m if it is free. Returns 0 if it was taken, -1 if not.
+int
+mutex_trylock(mutex_t *m)
+{
+     8e0:	55                   	push   %ebp
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     8e1:	31 c0                	xor    %eax,%eax
+     8e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+     8e8:	89 e5                	mov    %esp,%ebp
+     8ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     8ed:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+}
+     8f1:	5d                   	pop    %ebp
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+     8f2:	f7 d8                	neg    %eax
+     8f4:	19 c0                	sbb    %eax,%eax
+}
+     8f6:	c3                   	ret
+     8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+     900:	55                   	push   %ebp
+     901:	31 c0                	xor    %eax,%eax
+     903:	89 e5                	mov    %esp,%ebp
+     905:	83 ec 08             	sub    $0x8,%esp
+     908:	8b 55 08             	mov    0x8(%ebp),%edx
+     90b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     90e:	83 f8 02             	cmp    $0x2,%eax
+     911:	74 05                	je     918 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     913:	c9                   	leave
+     914:	c3                   	ret
+     915:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     918:	83 ec 04             	sub    $0x4,%esp
+     91b:	6a 01                	push   $0x1
+     91d:	6a 02                	push   $0x2
+     91f:	52                   	push   %edx
+     920:	e8 4e 05 00 00       	call   e73 <futex>
+     925:	83 c4 10             	add    $0x10,%esp
+}
+     928:	c9                   	leave
+     929:	c3                   	ret
+     92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000930 <cond_init>:
+// does not sleep through a signal sent in between. Signals
+// skip the system call when nwait says no one is waiting.
+
+void
+cond_init(cond_t *cv)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	8b 45 08             	mov    0x8(%ebp),%eax
+  cv->seq = 0;
+     936:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  cv->nwait = 0;
+     93c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     943:	5d                   	pop    %ebp
+     944:	c3                   	ret
+     945:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <cond_wait>:
+
+void
+cond_wait(cond_t *cv, mutex_t *m)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 0c             	sub    $0xc,%esp
+     959:	8b 75 08             	mov    0x8(%ebp),%esi
+     95c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&cv->nwait, 1);
+     95f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+     964:	31 c0                	xor    %eax,%eax
+  seq = cv->seq;
+     966:	8b 3e                	mov    (%esi),%edi
+     968:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     96b:	83 f8 02             	cmp    $0x2,%eax
+     96e:	74 50                	je     9c0 <cond_wait+0x70>
+  mutex_unlock(m);
+  futex(&cv->seq, FUTEX_WAIT, seq);
+     970:	83 ec 04             	sub    $0x4,%esp
+     973:	57                   	push   %edi
+     974:	6a 01                	push   $0x1
+     976:	56                   	push   %esi
+     977:	e8 f7 04 00 00       	call   e73 <futex>
+  __sync_fetch_and_sub(&cv->nwait, 1);
+     97c:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+     981:	b8 02 00 00 00       	mov    $0x2,%eax
+     986:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be sleeping on m too, so take it as contended.
+  while(xchg(&m->state, 2) != 0)
+     989:	83 c4 10             	add    $0x10,%esp
+     98c:	85 c0                	test   %eax,%eax
+     98e:	74 21                	je     9b1 <cond_wait+0x61>
+     990:	be 02 00 00 00       	mov    $0x2,%esi
+     995:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     998:	83 ec 04             	sub    $0x4,%esp
+     99b:	6a 02                	push   $0x2
+     99d:	6a 01                	push   $0x1
+     99f:	53                   	push   %ebx
+     9a0:	e8 ce 04 00 00       	call   e73 <futex>
+     9a5:	89 f0                	mov    %esi,%eax
+     9a7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     9aa:	83 c4 10             	add    $0x10,%esp
+     9ad:	85 c0                	test   %eax,%eax
+     9af:	75 e7                	jne    998 <cond_wait+0x48>
+}
+     9b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9b4:	5b                   	pop    %ebx
+     9b5:	5e                   	pop    %esi
+     9b6:	5f                   	pop    %edi
+     9b7:	5d                   	pop    %ebp
+     9b8:	c3                   	ret
+     9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     9c0:	83 ec 04             	sub    $0x4,%esp
+     9c3:	6a 01                	push   $0x1
+     9c5:	6a 02                	push   $0x2
+     9c7:	53                   	push   %ebx
+     9c8:	e8 a6 04 00 00       	call   e73 <futex>
+     9cd:	83 c4 10             	add    $0x10,%esp
+     9d0:	eb 9e                	jmp    970 <cond_wait+0x20>
+     9d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <cond_signal>:
+
+void
+cond_signal(cond_t *cv)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	83 ec 08             	sub    $0x8,%esp
+     9e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&cv->seq, 1);
+     9e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(cv->nwait)
+     9ed:	8b 50 04             	mov    0x4(%eax),%edx
+     9f0:	85 d2                	test   %edx,%edx
+     9f2:	75 0c                	jne    a00 <cond_signal+0x20>
+    futex(&cv->seq, FUTEX_WAKE, 1);
+}
+     9f4:	c9                   	leave
+     9f5:	c3                   	ret
+     9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&cv->seq, FUTEX_WAKE, 1);
+     a00:	83 ec 04             	sub    $0x4,%esp
+     a03:	6a 01                	push   $0x1
+     a05:	6a 02                	push   $0x2
+     a07:	50                   	push   %eax
+     a08:	e8 66 04 00 00       	call   e73 <futex>
+     a0d:	83 c4 10             	add    $0x10,%esp
+}
+     a10:	c9                   	leave
+     a11:	c3                   	ret
+     a12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *cv)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	83 ec 08             	sub    $0x8,%esp
+     a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&cv->seq, 1);
+     a29:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(cv->nwait)
+     a2d:	8b 50 04             	mov    0x4(%eax),%edx
+     a30:	85 d2                	test   %edx,%edx
+     a32:	75 0c                	jne    a40 <cond_broadcast+0x20>
+    futex(&cv->seq, FUTEX_WAKE, NPROC);
+}
+     a34:	c9                   	leave
+     a35:	c3                   	ret
+     a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&cv->seq, FUTEX_WAKE, NPROC);
+     a40:	83 ec 04             	sub    $0x4,%esp
+     a43:	6a 40                	push   $0x40
+     a45:	6a 02                	push   $0x2
+     a47:	50                   	push   %eax
+     a48:	e8 26 04 00 00       	call   e73 <futex>
+     a4d:	83 c4 10             	add    $0x10,%esp
+}
+     a50:	c9                   	leave
+     a51:	c3                   	ret
+     a52:	66 90                	xchg   %ax,%ax
+     a54:	66 90                	xchg   %ax,%ax
+     a56:	66 90                	xchg   %ax,%ax
+     a58:	66 90                	xchg   %ax,%ax
+     a5a:	66 90                	xchg   %ax,%ax
+     a5c:	66 90                	xchg   %ax,%ax
+     a5e:	66 90                	xchg   %ax,%ax
+
+00000a60 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     a60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     a61:	31 c0                	xor    %eax,%eax
+{
+     a63:	89 e5                	mov    %esp,%ebp
+     a65:	53                   	push   %ebx
+     a66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     a69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     a70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     a74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     a77:	83 c0 01             	add    $0x1,%eax
+     a7a:	84 d2                	test   %dl,%dl
+     a7c:	75 f2                	jne    a70 <strcpy+0x10>
+    ;
+  return os;
+}
+     a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a81:	89 c8                	mov    %ecx,%eax
+     a83:	c9                   	leave
+     a84:	c3                   	ret
+     a85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a90 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	53                   	push   %ebx
+     a94:	8b 55 08             	mov    0x8(%ebp),%edx
+     a97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     a9a:	0f b6 02             	movzbl (%edx),%eax
+     a9d:	84 c0                	test   %al,%al
+     a9f:	75 17                	jne    ab8 <strcmp+0x28>
+     aa1:	eb 3a                	jmp    add <strcmp+0x4d>
+     aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aa7:	90                   	nop
+     aa8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     aac:	83 c2 01             	add    $0x1,%edx
+     aaf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     ab2:	84 c0                	test   %al,%al
+     ab4:	74 1a                	je     ad0 <strcmp+0x40>
+    p++, q++;
+     ab6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     ab8:	0f b6 19             	movzbl (%ecx),%ebx
+     abb:	38 c3                	cmp    %al,%bl
+     abd:	74 e9                	je     aa8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     abf:	29 d8                	sub    %ebx,%eax
+}
+     ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ac4:	c9                   	leave
+     ac5:	c3                   	ret
+     ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     ad0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     ad4:	31 c0                	xor    %eax,%eax
+     ad6:	29 d8                	sub    %ebx,%eax
+}
+     ad8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     adb:	c9                   	leave
+     adc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     add:	0f b6 19             	movzbl (%ecx),%ebx
+     ae0:	31 c0                	xor    %eax,%eax
+     ae2:	eb db                	jmp    abf <strcmp+0x2f>
+     ae4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+
+00000af0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     af6:	80 3a 00             	cmpb   $0x0,(%edx)
+     af9:	74 15                	je     b10 <strlen+0x20>
+     afb:	31 c0                	xor    %eax,%eax
+     afd:	8d 76 00             	lea    0x0(%esi),%esi
+     b00:	83 c0 01             	add    $0x1,%eax
+     b03:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b07:	89 c1                	mov    %eax,%ecx
+     b09:	75 f5                	jne    b00 <strlen+0x10>
+    ;
+  return n;
+}
+     b0b:	89 c8                	mov    %ecx,%eax
+     b0d:	5d                   	pop    %ebp
+     b0e:	c3                   	ret
+     b0f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     b10:	31 c9                	xor    %ecx,%ecx
+}
+     b12:	5d                   	pop    %ebp
+     b13:	89 c8                	mov    %ecx,%eax
+     b15:	c3                   	ret
+     b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b20 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     b27:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b2d:	89 d7                	mov    %edx,%edi
+     b2f:	fc                   	cld
+     b30:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     b32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     b35:	89 d0                	mov    %edx,%eax
+     b37:	c9                   	leave
+     b38:	c3                   	ret
+     b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b40 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	8b 45 08             	mov    0x8(%ebp),%eax
+     b46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     b4a:	0f b6 10             	movzbl (%eax),%edx
+     b4d:	84 d2                	test   %dl,%dl
+     b4f:	75 12                	jne    b63 <strchr+0x23>
+     b51:	eb 1d                	jmp    b70 <strchr+0x30>
+     b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b57:	90                   	nop
+     b58:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     b5c:	83 c0 01             	add    $0x1,%eax
+     b5f:	84 d2                	test   %dl,%dl
+     b61:	74 0d                	je     b70 <strchr+0x30>
+    if(*s == c)
+     b63:	38 d1                	cmp    %dl,%cl
+     b65:	75 f1                	jne    b58 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     b67:	5d                   	pop    %ebp
+     b68:	c3                   	ret
+     b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     b70:	31 c0                	xor    %eax,%eax
+}
+     b72:	5d                   	pop    %ebp
+     b73:	c3                   	ret
+     b74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+
+00000b80 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	57                   	push   %edi
+     b84:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     b85:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     b88:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     b89:	31 db                	xor    %ebx,%ebx
+{
+     b8b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     b8e:	eb 27                	jmp    bb7 <gets+0x37>
+    cc = read(0, &c, 1);
+     b90:	83 ec 04             	sub    $0x4,%esp
+     b93:	6a 01                	push   $0x1
+     b95:	56                   	push   %esi
+     b96:	6a 00                	push   $0x0
+     b98:	e8 1e 01 00 00       	call   cbb <read>
+    if(cc < 1)
+     b9d:	83 c4 10             	add    $0x10,%esp
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	7e 1d                	jle    bc1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     ba4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ba8:	8b 55 08             	mov    0x8(%ebp),%edx
+     bab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     baf:	3c 0a                	cmp    $0xa,%al
+     bb1:	74 10                	je     bc3 <gets+0x43>
+     bb3:	3c 0d                	cmp    $0xd,%al
+     bb5:	74 0c                	je     bc3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     bb7:	89 df                	mov    %ebx,%edi
+     bb9:	83 c3 01             	add    $0x1,%ebx
+     bbc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     bbf:	7c cf                	jl     b90 <gets+0x10>
+     bc1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bcd:	5b                   	pop    %ebx
+     bce:	5e                   	pop    %esi
+     bcf:	5f                   	pop    %edi
+     bd0:	5d                   	pop    %ebp
+     bd1:	c3                   	ret
+     bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	56                   	push   %esi
+     be4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     be5:	83 ec 08             	sub    $0x8,%esp
+     be8:	6a 00                	push   $0x0
+     bea:	ff 75 08             	push   0x8(%ebp)
+     bed:	e8 f1 00 00 00       	call   ce3 <open>
+  if(fd < 0)
+     bf2:	83 c4 10             	add    $0x10,%esp
+     bf5:	85 c0                	test   %eax,%eax
+     bf7:	78 27                	js     c20 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     bf9:	83 ec 08             	sub    $0x8,%esp
+     bfc:	ff 75 0c             	push   0xc(%ebp)
+     bff:	89 c3                	mov    %eax,%ebx
+     c01:	50                   	push   %eax
+     c02:	e8 f4 00 00 00       	call   cfb <fstat>
+  close(fd);
+     c07:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     c0a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     c0c:	e8 ba 00 00 00       	call   ccb <close>
+  return r;
+     c11:	83 c4 10             	add    $0x10,%esp
+}
+     c14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c17:	89 f0                	mov    %esi,%eax
+     c19:	5b                   	pop    %ebx
+     c1a:	5e                   	pop    %esi
+     c1b:	5d                   	pop    %ebp
+     c1c:	c3                   	ret
+     c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     c20:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     c25:	eb ed                	jmp    c14 <stat+0x34>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+
+00000c30 <atoi>:
+
+int
+atoi(const char *s)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	53                   	push   %ebx
+     c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     c37:	0f be 02             	movsbl (%edx),%eax
+     c3a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     c3d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     c45:	77 1e                	ja     c65 <atoi+0x35>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     c50:	83 c2 01             	add    $0x1,%edx
+     c53:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     c56:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     c5a:	0f be 02             	movsbl (%edx),%eax
+     c5d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     c60:	80 fb 09             	cmp    $0x9,%bl
+     c63:	76 eb                	jbe    c50 <atoi+0x20>
+  return n;
+}
+     c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c68:	89 c8                	mov    %ecx,%eax
+     c6a:	c9                   	leave
+     c6b:	c3                   	ret
+     c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	8b 45 10             	mov    0x10(%ebp),%eax
+     c78:	8b 55 08             	mov    0x8(%ebp),%edx
+     c7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     c7e:	85 c0                	test   %eax,%eax
+     c80:	7e 13                	jle    c95 <memmove+0x25>
+     c82:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     c84:	89 d7                	mov    %edx,%edi
+     c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     c90:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     c91:	39 f8                	cmp    %edi,%eax
+     c93:	75 fb                	jne    c90 <memmove+0x20>
+  return vdst;
+}
+     c95:	5e                   	pop    %esi
+     c96:	89 d0                	mov    %edx,%eax
+     c98:	5f                   	pop    %edi
+     c99:	5d                   	pop    %ebp
+     c9a:	c3                   	ret
+
+00000c9b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+     ca0:	cd 40                	int    $0x40
+     ca2:	c3                   	ret
+
+00000ca3 <exit>:
+SYSCALL(exit)
+     ca3:	b8 02 00 00 00       	mov    $0x2,%eax
+     ca8:	cd 40                	int    $0x40
+     caa:	c3                   	ret
+
+00000cab <wait>:
+SYSCALL(wait)
+     cab:	b8 03 00 00 00       	mov    $0x3,%eax
+     cb0:	cd 40                	int    $0x40
+     cb2:	c3                   	ret
+
+00000cb3 <pipe>:
+SYSCALL(pipe)
+     cb3:	b8 04 00 00 00       	mov    $0x4,%eax
+     cb8:	cd 40                	int    $0x40
+     cba:	c3                   	ret
+
+00000cbb <read>:
+SYSCALL(read)
+     cbb:	b8 05 00 00 00       	mov    $0x5,%eax
+     cc0:	cd 40                	int    $0x40
+     cc2:	c3                   	ret
+
+00000cc3 <write>:
+SYSCALL(write)
+     cc3:	b8 10 00 00 00       	mov    $0x10,%eax
+     cc8:	cd 40                	int    $0x40
+     cca:	c3                   	ret
+
+00000ccb <close>:
+SYSCALL(close)
+     ccb:	b8 15 00 00 00       	mov    $0x15,%eax
+     cd0:	cd 40                	int    $0x40
+     cd2:	c3                   	ret
+
+00000cd3 <kill>:
+SYSCALL(kill)
+     cd3:	b8 06 00 00 00       	mov    $0x6,%eax
+     cd8:	cd 40                	int    $0x40
+     cda:	c3                   	ret
+
+00000cdb <exec>:
+SYSCALL(exec)
+     cdb:	b8 07 00 00 00       	mov    $0x7,%eax
+     ce0:	cd 40                	int    $0x40
+     ce2:	c3                   	ret
+
+00000ce3 <open>:
+SYSCALL(open)
+     ce3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ce8:	cd 40                	int    $0x40
+     cea:	c3                   	ret
+
+00000ceb <mknod>:
+SYSCALL(mknod)
+     ceb:	b8 11 00 00 00       	mov    $0x11,%eax
+     cf0:	cd 40                	int    $0x40
+     cf2:	c3                   	ret
+
+00000cf3 <unlink>:
+SYSCALL(unlink)
+     cf3:	b8 12 00 00 00       	mov    $0x12,%eax
+     cf8:	cd 40                	int    $0x40
+     cfa:	c3                   	ret
+
+00000cfb <fstat>:
+SYSCALL(fstat)
+     cfb:	b8 08 00 00 00       	mov    $0x8,%eax
+     d00:	cd 40                	int    $0x40
+     d02:	c3                   	ret
+
+00000d03 <link>:
+SYSCALL(link)
+     d03:	b8 13 00 00 00       	mov    $0x13,%eax
+     d08:	cd 40                	int    $0x40
+     d0a:	c3                   	ret
+
+00000d0b <mkdir>:
+SYSCALL(mkdir)
+     d0b:	b8 14 00 00 00       	mov    $0x14,%eax
+     d10:	cd 40                	int    $0x40
+     d12:	c3                   	ret
+
+00000d13 <chdir>:
+SYSCALL(chdir)
+     d13:	b8 09 00 00 00       	mov    $0x9,%eax
+     d18:	cd 40                	int    $0x40
+     d1a:	c3                   	ret
+
+00000d1b <dup>:
+SYSCALL(dup)
+     d1b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     d20:	cd 40                	int    $0x40
+     d22:	c3                   	ret
+
+00000d23 <getpid>:
+SYSCALL(getpid)
+     d23:	b8 0b 00 00 00       	mov    $0xb,%eax
+     d28:	cd 40                	int    $0x40
+     d2a:	c3                   	ret
+
+00000d2b <sbrk>:
+SYSCALL(sbrk)
+     d2b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     d30:	cd 40                	int    $0x40
+     d32:	c3                   	ret
+
+00000d33 <sleep>:
+SYSCALL(sleep)
+     d33:	b8 0d 00 00 00       	mov    $0xd,%eax
+     d38:	cd 40                	int    $0x40
+     d3a:	c3                   	ret
+
+00000d3b <uptime>:
+SYSCALL(uptime)
+     d3b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     d40:	cd 40                	int    $0x40
+     d42:	c3                   	ret
+
+00000d43 <getsysinfo>:
+SYSCALL(getsysinfo)
+     d43:	b8 16 00 00 00       	mov    $0x16,%eax
+     d48:	cd 40                	int    $0x40
+     d4a:	c3                   	ret
+
+00000d4b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+     d4b:	b8 17 00 00 00       	mov    $0x17,%eax
+     d50:	cd 40                	int    $0x40
+     d52:	c3                   	ret
+
+00000d53 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+     d53:	b8 18 00 00 00       	mov    $0x18,%eax
+     d58:	cd 40                	int    $0x40
+     d5a:	c3                   	ret
+
+00000d5b <mlfqstart>:
+SYSCALL(mlfqstart)
+     d5b:	b8 19 00 00 00       	mov    $0x19,%eax
+     d60:	cd 40                	int    $0x40
+     d62:	c3                   	ret
+
+00000d63 <mlfqstop>:
+SYSCALL(mlfqstop)
+     d63:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d68:	cd 40                	int    $0x40
+     d6a:	c3                   	ret
+
+00000d6b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+     d6b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d70:	cd 40                	int    $0x40
+     d72:	c3                   	ret
+
+00000d73 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+     d73:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     d78:	cd 40                	int    $0x40
+     d7a:	c3                   	ret
+
+00000d7b <setpriority>:
+SYSCALL(setpriority)
+     d7b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d80:	cd 40                	int    $0x40
+     d82:	c3                   	ret
+
+00000d83 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+     d83:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d88:	cd 40                	int    $0x40
+     d8a:	c3                   	ret
+
+00000d8b <getcpustats>:
+SYSCALL(getcpustats)
+     d8b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d90:	cd 40                	int    $0x40
+     d92:	c3                   	ret
+
+00000d93 <setscheduler>:
+SYSCALL(setscheduler)
+     d93:	b8 20 00 00 00       	mov    $0x20,%eax
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+     d9b:	b8 21 00 00 00       	mov    $0x21,%eax
+     da0:	cd 40                	int    $0x40
+     da2:	c3                   	ret
+
+00000da3 <getscheduler>:
+SYSCALL(getscheduler)
+     da3:	b8 22 00 00 00       	mov    $0x22,%eax
+     da8:	cd 40                	int    $0x40
+     daa:	c3                   	ret
+
+00000dab <splice>:
+SYSCALL(splice)
+     dab:	b8 23 00 00 00       	mov    $0x23,%eax
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <readv>:
+SYSCALL(readv)
+     db3:	b8 24 00 00 00       	mov    $0x24,%eax
+     db8:	cd 40                	int    $0x40
+     dba:	c3                   	ret
+
+00000dbb <writev>:
+SYSCALL(writev)
+     dbb:	b8 25 00 00 00       	mov    $0x25,%eax
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <pread>:
+SYSCALL(pread)
+     dc3:	b8 26 00 00 00       	mov    $0x26,%eax
+     dc8:	cd 40                	int    $0x40
+     dca:	c3                   	ret
+
+00000dcb <pwrite>:
+SYSCALL(pwrite)
+     dcb:	b8 27 00 00 00       	mov    $0x27,%eax
+     dd0:	cd 40                	int    $0x40
+     dd2:	c3                   	ret
+
+00000dd3 <getlogstat>:
+SYSCALL(getlogstat)
+     dd3:	b8 28 00 00 00       	mov    $0x28,%eax
+     dd8:	cd 40                	int    $0x40
+     dda:	c3                   	ret
+
+00000ddb <mount>:
+SYSCALL(mount)
+     ddb:	b8 29 00 00 00       	mov    $0x29,%eax
+     de0:	cd 40                	int    $0x40
+     de2:	c3                   	ret
+
+00000de3 <umount>:
+SYSCALL(umount)
+     de3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     de8:	cd 40                	int    $0x40
+     dea:	c3                   	ret
+
+00000deb <mmap>:
+SYSCALL(mmap)
+     deb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     df0:	cd 40                	int    $0x40
+     df2:	c3                   	ret
+
+00000df3 <munmap>:
+SYSCALL(munmap)
+     df3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     df8:	cd 40                	int    $0x40
+     dfa:	c3                   	ret
+
+00000dfb <membench>:
+SYSCALL(membench)
+     dfb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     e00:	cd 40                	int    $0x40
+     e02:	c3                   	ret
+
+00000e03 <getlockstat>:
+SYSCALL(getlockstat)
+     e03:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     e08:	cd 40                	int    $0x40
+     e0a:	c3                   	ret
+
+00000e0b <lockbench>:
+SYSCALL(lockbench)
+     e0b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     e10:	cd 40                	int    $0x40
+     e12:	c3                   	ret
+
+00000e13 <prof>:
+SYSCALL(prof)
+     e13:	b8 30 00 00 00       	mov    $0x30,%eax
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <tracectl>:
+SYSCALL(tracectl)
+     e1b:	b8 31 00 00 00       	mov    $0x31,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <traceread>:
+SYSCALL(traceread)
+     e23:	b8 32 00 00 00       	mov    $0x32,%eax
+     e28:	cd 40                	int    $0x40
+     e2a:	c3                   	ret
+
+00000e2b <getsysstat>:
+SYSCALL(getsysstat)
+     e2b:	b8 33 00 00 00       	mov    $0x33,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <getwaitstat>:
+SYSCALL(getwaitstat)
+     e33:	b8 34 00 00 00       	mov    $0x34,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <getschedwait>:
+SYSCALL(getschedwait)
+     e3b:	b8 35 00 00 00       	mov    $0x35,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <mlfqread>:
+SYSCALL(mlfqread)
+     e43:	b8 36 00 00 00       	mov    $0x36,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+
+00000e4b <dllock>:
+SYSCALL(dllock)
+     e4b:	b8 37 00 00 00       	mov    $0x37,%eax
+     e50:	cd 40                	int    $0x40
+     e52:	c3                   	ret
+
+00000e53 <watchdogctl>:
+SYSCALL(watchdogctl)
+     e53:	b8 38 00 00 00       	mov    $0x38,%eax
+     e58:	cd 40                	int    $0x40
+     e5a:	c3                   	ret
+
+00000e5b <deadlocklog>:
+SYSCALL(deadlocklog)
+     e5b:	b8 39 00 00 00       	mov    $0x39,%eax
+     e60:	cd 40                	int    $0x40
+     e62:	c3                   	ret
+
+00000e63 <clone>:
+SYSCALL(clone)
+     e63:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     e68:	cd 40                	int    $0x40
+     e6a:	c3                   	ret
+
+00000e6b <join>:
+SYSCALL(join)
+     e6b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     e70:	cd 40                	int    $0x40
+     e72:	c3                   	ret
+
+00000e73 <futex>:
+SYSCALL(futex)
+     e73:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     e78:	cd 40                	int    $0x40
+     e7a:	c3                   	ret
+
+00000e7b <shmat>:
+SYSCALL(shmat)
+     e7b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <shmdt>:
+SYSCALL(shmdt)
+     e83:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     e88:	cd 40                	int    $0x40
+     e8a:	c3                   	ret
+
+00000e8b <poll>:
+SYSCALL(poll)
+     e8b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     e90:	cd 40                	int    $0x40
+     e92:	c3                   	ret
+     e93:	66 90                	xchg   %ax,%ax
+     e95:	66 90                	xchg   %ax,%ax
+     e97:	66 90                	xchg   %ax,%ax
+     e99:	66 90                	xchg   %ax,%ax
+     e9b:	66 90                	xchg   %ax,%ax
+     e9d:	66 90                	xchg   %ax,%ax
+     e9f:	90                   	nop
+
+00000ea0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ea8:	89 d1                	mov    %edx,%ecx
+{
+     eaa:	83 ec 3c             	sub    $0x3c,%esp
+     ead:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     eb0:	85 d2                	test   %edx,%edx
+     eb2:	0f 89 80 00 00 00    	jns    f38 <printint+0x98>
+     eb8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     ebc:	74 7a                	je     f38 <printint+0x98>
+    x = -xx;
+     ebe:	f7 d9                	neg    %ecx
+    neg = 1;
+     ec0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ec5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ec8:	31 f6                	xor    %esi,%esi
+     eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     ed0:	89 c8                	mov    %ecx,%eax
+     ed2:	31 d2                	xor    %edx,%edx
+     ed4:	89 f7                	mov    %esi,%edi
+     ed6:	f7 f3                	div    %ebx
+     ed8:	8d 76 01             	lea    0x1(%esi),%esi
+     edb:	0f b6 92 c0 16 00 00 	movzbl 0x16c0(%edx),%edx
+     ee2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ee6:	89 ca                	mov    %ecx,%edx
+     ee8:	89 c1                	mov    %eax,%ecx
+     eea:	39 da                	cmp    %ebx,%edx
+     eec:	73 e2                	jae    ed0 <printint+0x30>
+  if(neg)
+     eee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ef1:	85 c0                	test   %eax,%eax
+     ef3:	74 07                	je     efc <printint+0x5c>
+    buf[i++] = '-';
+     ef5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     efa:	89 f7                	mov    %esi,%edi
+     efc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     eff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     f02:	01 df                	add    %ebx,%edi
+     f04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     f08:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     f0b:	83 ec 04             	sub    $0x4,%esp
+     f0e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     f11:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     f14:	6a 01                	push   $0x1
+     f16:	50                   	push   %eax
+     f17:	56                   	push   %esi
+     f18:	e8 a6 fd ff ff       	call   cc3 <write>
+  while(--i >= 0)
+     f1d:	89 f8                	mov    %edi,%eax
+     f1f:	83 c4 10             	add    $0x10,%esp
+     f22:	83 ef 01             	sub    $0x1,%edi
+     f25:	39 d8                	cmp    %ebx,%eax
+     f27:	75 df                	jne    f08 <printint+0x68>
+}
+     f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f2c:	5b                   	pop    %ebx
+     f2d:	5e                   	pop    %esi
+     f2e:	5f                   	pop    %edi
+     f2f:	5d                   	pop    %ebp
+     f30:	c3                   	ret
+     f31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     f38:	31 c0                	xor    %eax,%eax
+     f3a:	eb 89                	jmp    ec5 <printint+0x25>
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f40 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	57                   	push   %edi
+     f44:	56                   	push   %esi
+     f45:	53                   	push   %ebx
+     f46:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     f49:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     f4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     f4f:	0f b6 1e             	movzbl (%esi),%ebx
+     f52:	83 c6 01             	add    $0x1,%esi
+     f55:	84 db                	test   %bl,%bl
+     f57:	74 67                	je     fc0 <printf+0x80>
+     f59:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f5c:	31 d2                	xor    %edx,%edx
+     f5e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     f61:	eb 34                	jmp    f97 <printf+0x57>
+     f63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f67:	90                   	nop
+     f68:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     f6b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     f70:	83 f8 25             	cmp    $0x25,%eax
+     f73:	74 18                	je     f8d <printf+0x4d>
+  write(fd, &c, 1);
+     f75:	83 ec 04             	sub    $0x4,%esp
+     f78:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f7b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f7e:	6a 01                	push   $0x1
+     f80:	50                   	push   %eax
+     f81:	57                   	push   %edi
+     f82:	e8 3c fd ff ff       	call   cc3 <write>
+     f87:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     f8a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     f8d:	0f b6 1e             	movzbl (%esi),%ebx
+     f90:	83 c6 01             	add    $0x1,%esi
+     f93:	84 db                	test   %bl,%bl
+     f95:	74 29                	je     fc0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     f97:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     f9a:	85 d2                	test   %edx,%edx
+     f9c:	74 ca                	je     f68 <printf+0x28>
+      }
+    } else if(state == '%'){
+     f9e:	83 fa 25             	cmp    $0x25,%edx
+     fa1:	75 ea                	jne    f8d <printf+0x4d>
+      if(c == 'd'){
+     fa3:	83 f8 25             	cmp    $0x25,%eax
+     fa6:	0f 84 24 01 00 00    	je     10d0 <printf+0x190>
+     fac:	83 e8 63             	sub    $0x63,%eax
+     faf:	83 f8 15             	cmp    $0x15,%eax
+     fb2:	77 1c                	ja     fd0 <printf+0x90>
+     fb4:	ff 24 85 68 16 00 00 	jmp    *0x1668(,%eax,4)
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     fc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fc3:	5b                   	pop    %ebx
+     fc4:	5e                   	pop    %esi
+     fc5:	5f                   	pop    %edi
+     fc6:	5d                   	pop    %ebp
+     fc7:	c3                   	ret
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+  write(fd, &c, 1);
+     fd0:	83 ec 04             	sub    $0x4,%esp
+     fd3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     fd6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     fda:	6a 01                	push   $0x1
+     fdc:	52                   	push   %edx
+     fdd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     fe0:	57                   	push   %edi
+     fe1:	e8 dd fc ff ff       	call   cc3 <write>
+     fe6:	83 c4 0c             	add    $0xc,%esp
+     fe9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     fec:	6a 01                	push   $0x1
+     fee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     ff1:	52                   	push   %edx
+     ff2:	57                   	push   %edi
+     ff3:	e8 cb fc ff ff       	call   cc3 <write>
+        putc(fd, c);
+     ff8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ffb:	31 d2                	xor    %edx,%edx
+     ffd:	eb 8e                	jmp    f8d <printf+0x4d>
+     fff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1000:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1003:	83 ec 0c             	sub    $0xc,%esp
+    1006:	b9 10 00 00 00       	mov    $0x10,%ecx
+    100b:	8b 13                	mov    (%ebx),%edx
+    100d:	6a 00                	push   $0x0
+    100f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1011:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1014:	e8 87 fe ff ff       	call   ea0 <printint>
+        ap++;
+    1019:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    101c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    101f:	31 d2                	xor    %edx,%edx
+    1021:	e9 67 ff ff ff       	jmp    f8d <printf+0x4d>
+    1026:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1030:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1033:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1035:	83 c0 04             	add    $0x4,%eax
+    1038:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    103b:	85 db                	test   %ebx,%ebx
+    103d:	0f 84 9d 00 00 00    	je     10e0 <printf+0x1a0>
+        while(*s != 0){
+    1043:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1046:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1048:	84 c0                	test   %al,%al
+    104a:	0f 84 3d ff ff ff    	je     f8d <printf+0x4d>
+    1050:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1053:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1056:	89 de                	mov    %ebx,%esi
+    1058:	89 d3                	mov    %edx,%ebx
+    105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1060:	83 ec 04             	sub    $0x4,%esp
+    1063:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1066:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1069:	6a 01                	push   $0x1
+    106b:	53                   	push   %ebx
+    106c:	57                   	push   %edi
+    106d:	e8 51 fc ff ff       	call   cc3 <write>
+        while(*s != 0){
+    1072:	0f b6 06             	movzbl (%esi),%eax
+    1075:	83 c4 10             	add    $0x10,%esp
+    1078:	84 c0                	test   %al,%al
+    107a:	75 e4                	jne    1060 <printf+0x120>
+      state = 0;
+    107c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    107f:	31 d2                	xor    %edx,%edx
+    1081:	e9 07 ff ff ff       	jmp    f8d <printf+0x4d>
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1090:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1093:	83 ec 0c             	sub    $0xc,%esp
+    1096:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    109b:	8b 13                	mov    (%ebx),%edx
+    109d:	6a 01                	push   $0x1
+    109f:	e9 6b ff ff ff       	jmp    100f <printf+0xcf>
+    10a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    10a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    10ab:	83 ec 04             	sub    $0x4,%esp
+    10ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    10b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    10b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    10b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    10b9:	6a 01                	push   $0x1
+    10bb:	52                   	push   %edx
+    10bc:	57                   	push   %edi
+    10bd:	e8 01 fc ff ff       	call   cc3 <write>
+        ap++;
+    10c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    10c8:	31 d2                	xor    %edx,%edx
+    10ca:	e9 be fe ff ff       	jmp    f8d <printf+0x4d>
+    10cf:	90                   	nop
+  write(fd, &c, 1);
+    10d0:	83 ec 04             	sub    $0x4,%esp
+    10d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    10d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    10d9:	6a 01                	push   $0x1
+    10db:	e9 11 ff ff ff       	jmp    ff1 <printf+0xb1>
+    10e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    10e5:	bb 5f 16 00 00       	mov    $0x165f,%ebx
+    10ea:	e9 61 ff ff ff       	jmp    1050 <printf+0x110>
+    10ef:	90                   	nop
+
+000010f0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10f3:	a1 74 1e 00 00       	mov    0x1e74,%eax
+{
+    10f8:	89 e5                	mov    %esp,%ebp
+    10fa:	56                   	push   %esi
+    10fb:	53                   	push   %ebx
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1100:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1102:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1104:	39 ca                	cmp    %ecx,%edx
+    1106:	73 30                	jae    1138 <bigfree+0x48>
+    1108:	39 c1                	cmp    %eax,%ecx
+    110a:	72 04                	jb     1110 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    110c:	39 c2                	cmp    %eax,%edx
+    110e:	72 f0                	jb     1100 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1110:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1113:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1116:	39 f0                	cmp    %esi,%eax
+    1118:	74 26                	je     1140 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    111a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    111c:	8b 42 04             	mov    0x4(%edx),%eax
+    111f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1122:	39 d9                	cmp    %ebx,%ecx
+    1124:	74 30                	je     1156 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1126:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1128:	5b                   	pop    %ebx
+  freep = p;
+    1129:	89 15 74 1e 00 00    	mov    %edx,0x1e74
+}
+    112f:	5e                   	pop    %esi
+    1130:	5d                   	pop    %ebp
+    1131:	c3                   	ret
+    1132:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1138:	39 c1                	cmp    %eax,%ecx
+    113a:	72 d0                	jb     110c <bigfree+0x1c>
+    113c:	eb c2                	jmp    1100 <bigfree+0x10>
+    113e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1140:	03 58 04             	add    0x4(%eax),%ebx
+    1143:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1146:	8b 02                	mov    (%edx),%eax
+    1148:	8b 00                	mov    (%eax),%eax
+    114a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    114c:	8b 42 04             	mov    0x4(%edx),%eax
+    114f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1152:	39 d9                	cmp    %ebx,%ecx
+    1154:	75 d0                	jne    1126 <bigfree+0x36>
+    p->s.size += bp->s.size;
+    1156:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    1159:	89 15 74 1e 00 00    	mov    %edx,0x1e74
+    p->s.size += bp->s.size;
+    115f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1162:	8b 09                	mov    (%ecx),%ecx
+    1164:	89 0a                	mov    %ecx,(%edx)
+}
+    1166:	5b                   	pop    %ebx
+    1167:	5e                   	pop    %esi
+    1168:	5d                   	pop    %ebp
+    1169:	c3                   	ret
+    116a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001170 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	89 c7                	mov    %eax,%edi
+    1176:	56                   	push   %esi
+    1177:	53                   	push   %ebx
+    1178:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    117b:	a1 74 1e 00 00       	mov    0x1e74,%eax
+    1180:	85 c0                	test   %eax,%eax
+    1182:	0f 84 88 00 00 00    	je     1210 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1188:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    118a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    118d:	39 f9                	cmp    %edi,%ecx
+    118f:	73 5f                	jae    11f0 <bigalloc+0x80>
+  if(nu < 4096)
+    1191:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1196:	39 df                	cmp    %ebx,%edi
+    1198:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    119b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    11a2:	eb 0d                	jmp    11b1 <bigalloc+0x41>
+    11a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    11aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    11ad:	39 f9                	cmp    %edi,%ecx
+    11af:	73 3f                	jae    11f0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    11b1:	89 d0                	mov    %edx,%eax
+    11b3:	39 15 74 1e 00 00    	cmp    %edx,0x1e74
+    11b9:	75 ed                	jne    11a8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    11bb:	83 ec 0c             	sub    $0xc,%esp
+    11be:	56                   	push   %esi
+    11bf:	e8 67 fb ff ff       	call   d2b <sbrk>
+  if(p == (char*)-1)
+    11c4:	83 c4 10             	add    $0x10,%esp
+    11c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11ca:	74 11                	je     11dd <bigalloc+0x6d>
+  hp->s.size = nu;
+    11cc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+    11cf:	e8 1c ff ff ff       	call   10f0 <bigfree>
+  return freep;
+    11d4:	a1 74 1e 00 00       	mov    0x1e74,%eax
+      if((p = morecore(nunits)) == 0)
+    11d9:	85 c0                	test   %eax,%eax
+    11db:	75 cb                	jne    11a8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    11dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    11e0:	31 d2                	xor    %edx,%edx
+}
+    11e2:	5b                   	pop    %ebx
+    11e3:	89 d0                	mov    %edx,%eax
+    11e5:	5e                   	pop    %esi
+    11e6:	5f                   	pop    %edi
+    11e7:	5d                   	pop    %ebp
+    11e8:	c3                   	ret
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    11f0:	39 cf                	cmp    %ecx,%edi
+    11f2:	74 4c                	je     1240 <bigalloc+0xd0>
+        p->s.size -= nunits;
+    11f4:	29 f9                	sub    %edi,%ecx
+    11f6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    11f9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    11fc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    11ff:	a3 74 1e 00 00       	mov    %eax,0x1e74
+}
+    1204:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1207:	89 d0                	mov    %edx,%eax
+    1209:	5b                   	pop    %ebx
+    120a:	5e                   	pop    %esi
+    120b:	5f                   	pop    %edi
+    120c:	5d                   	pop    %ebp
+    120d:	c3                   	ret
+    120e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+    1210:	c7 05 74 1e 00 00 78 	movl   $0x1e78,0x1e74
+    1217:	1e 00 00 
+    base.s.size = 0;
+    121a:	ba 78 1e 00 00       	mov    $0x1e78,%edx
+    base.s.ptr = freep = prevp = &base;
+    121f:	c7 05 78 1e 00 00 78 	movl   $0x1e78,0x1e78
+    1226:	1e 00 00 
+    base.s.size = 0;
+    1229:	c7 05 7c 1e 00 00 00 	movl   $0x0,0x1e7c
+    1230:	00 00 00 
+    if(p->s.size >= nunits){
+    1233:	e9 59 ff ff ff       	jmp    1191 <bigalloc+0x21>
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1240:	8b 0a                	mov    (%edx),%ecx
+    1242:	89 08                	mov    %ecx,(%eax)
+    1244:	eb b9                	jmp    11ff <bigalloc+0x8f>
+    1246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001250 <free>:
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	53                   	push   %ebx
+    1254:	83 ec 04             	sub    $0x4,%esp
+    1257:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+    125a:	85 c9                	test   %ecx,%ecx
+    125c:	74 58                	je     12b6 <free+0x66>
+  bp = (Header*)ap - 1;
+    125e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+  asm volatile("lock; xchgl %0, %1" :
+    1261:	ba 01 00 00 00       	mov    $0x1,%edx
+    1266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+    1270:	89 d0                	mov    %edx,%eax
+    1272:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+  while(xchg(&locked, 1) != 0)
+    1279:	85 c0                	test   %eax,%eax
+    127b:	75 f3                	jne    1270 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+    127d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+    1280:	83 fa 40             	cmp    $0x40,%edx
+    1283:	77 3b                	ja     12c0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+    1285:	83 fa 02             	cmp    $0x2,%edx
+    1288:	76 3f                	jbe    12c9 <free+0x79>
+    128a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1290:	83 c0 01             	add    $0x1,%eax
+    1293:	39 14 85 e0 16 00 00 	cmp    %edx,0x16e0(,%eax,4)
+    129a:	72 f4                	jb     1290 <free+0x40>
+    bp->s.ptr = classfree[c];
+    129c:	8b 14 85 40 1e 00 00 	mov    0x1e40(,%eax,4),%edx
+    classfree[c] = bp;
+    12a3:	89 1c 85 40 1e 00 00 	mov    %ebx,0x1e40(,%eax,4)
+    bp->s.ptr = classfree[c];
+    12aa:	89 51 f8             	mov    %edx,-0x8(%ecx)
+    12ad:	31 c0                	xor    %eax,%eax
+    12af:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+}
+    12b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12b9:	c9                   	leave
+    12ba:	c3                   	ret
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+    bigfree(bp);
+    12c0:	89 d8                	mov    %ebx,%eax
+    12c2:	e8 29 fe ff ff       	call   10f0 <bigfree>
+    12c7:	eb e4                	jmp    12ad <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+    12c9:	31 c0                	xor    %eax,%eax
+    12cb:	eb cf                	jmp    129c <free+0x4c>
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12d6:	89 e5                	mov    %esp,%ebp
+    12d8:	57                   	push   %edi
+    12d9:	56                   	push   %esi
+    12da:	53                   	push   %ebx
+    12db:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    12de:	8b 45 08             	mov    0x8(%ebp),%eax
+    12e1:	8d 50 07             	lea    0x7(%eax),%edx
+    12e4:	c1 ea 03             	shr    $0x3,%edx
+    12e7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+    12ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    12f0:	89 c8                	mov    %ecx,%eax
+    12f2:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+    12f9:	85 c0                	test   %eax,%eax
+    12fb:	75 f3                	jne    12f0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+    12fd:	89 c3                	mov    %eax,%ebx
+    12ff:	83 fa 40             	cmp    $0x40,%edx
+    1302:	77 4c                	ja     1350 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+    1304:	be 02 00 00 00       	mov    $0x2,%esi
+    1309:	83 fa 02             	cmp    $0x2,%edx
+    130c:	76 10                	jbe    131e <malloc+0x4e>
+    130e:	66 90                	xchg   %ax,%ax
+    1310:	83 c3 01             	add    $0x1,%ebx
+    1313:	8b 34 9d e0 16 00 00 	mov    0x16e0(,%ebx,4),%esi
+    131a:	39 d6                	cmp    %edx,%esi
+    131c:	72 f2                	jb     1310 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+    131e:	8b 14 9d 40 1e 00 00 	mov    0x1e40(,%ebx,4),%edx
+    1325:	85 d2                	test   %edx,%edx
+    1327:	74 47                	je     1370 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    1329:	8b 3a                	mov    (%edx),%edi
+    132b:	89 3c 9d 40 1e 00 00 	mov    %edi,0x1e40(,%ebx,4)
+    1332:	31 c0                	xor    %eax,%eax
+    1334:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+    133b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+    133e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+    1341:	5b                   	pop    %ebx
+    1342:	5e                   	pop    %esi
+    1343:	5f                   	pop    %edi
+    1344:	5d                   	pop    %ebp
+    1345:	c3                   	ret
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+    1350:	89 d0                	mov    %edx,%eax
+    1352:	e8 19 fe ff ff       	call   1170 <bigalloc>
+    1357:	89 c2                	mov    %eax,%edx
+    1359:	89 d8                	mov    %ebx,%eax
+    135b:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+  return p ? (void*)(p + 1) : 0;
+    1362:	85 d2                	test   %edx,%edx
+    1364:	75 d5                	jne    133b <malloc+0x6b>
+    1366:	31 c0                	xor    %eax,%eax
+}
+    1368:	83 c4 1c             	add    $0x1c,%esp
+    136b:	5b                   	pop    %ebx
+    136c:	5e                   	pop    %esi
+    136d:	5f                   	pop    %edi
+    136e:	5d                   	pop    %ebp
+    136f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    1370:	b8 00 02 00 00       	mov    $0x200,%eax
+    1375:	e8 f6 fd ff ff       	call   1170 <bigalloc>
+    137a:	85 c0                	test   %eax,%eax
+    137c:	74 44                	je     13c2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    137e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    1385:	8b 14 9d 40 1e 00 00 	mov    0x1e40(,%ebx,4),%edx
+    138c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    138f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    1392:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    1398:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    139b:	39 cf                	cmp    %ecx,%edi
+    139d:	72 8a                	jb     1329 <malloc+0x59>
+    139f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    13a2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    13a5:	8d 76 00             	lea    0x0(%esi),%esi
+    13a8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    13aa:	89 70 04             	mov    %esi,0x4(%eax)
+    13ad:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    13af:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    13b1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    13b3:	01 d8                	add    %ebx,%eax
+    13b5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    13b8:	73 ee                	jae    13a8 <malloc+0xd8>
+    13ba:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    13bd:	e9 69 ff ff ff       	jmp    132b <malloc+0x5b>
+    13c2:	f0 87 05 20 1e 00 00 	lock xchg %eax,0x1e20
+  return p ? (void*)(p + 1) : 0;
+    13c9:	31 c0                	xor    %eax,%eax
+    13cb:	eb 9b                	jmp    1368 <malloc+0x98>
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013d0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	56                   	push   %esi
+    13d4:	53                   	push   %ebx
+    13d5:	8b 45 08             	mov    0x8(%ebp),%eax
+    13d8:	f7 65 0c             	mull   0xc(%ebp)
+    13db:	70 33                	jo     1410 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    13dd:	83 ec 0c             	sub    $0xc,%esp
+    13e0:	89 c3                	mov    %eax,%ebx
+    13e2:	50                   	push   %eax
+    13e3:	e8 e8 fe ff ff       	call   12d0 <malloc>
+    13e8:	83 c4 10             	add    $0x10,%esp
+    13eb:	89 c6                	mov    %eax,%esi
+    13ed:	85 c0                	test   %eax,%eax
+    13ef:	74 1f                	je     1410 <calloc+0x40>
+    memset(p, 0, n);
+    13f1:	83 ec 04             	sub    $0x4,%esp
+    13f4:	53                   	push   %ebx
+    13f5:	6a 00                	push   $0x0
+    13f7:	50                   	push   %eax
+    13f8:	e8 23 f7 ff ff       	call   b20 <memset>
+    13fd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1400:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1403:	89 f0                	mov    %esi,%eax
+    1405:	5b                   	pop    %ebx
+    1406:	5e                   	pop    %esi
+    1407:	5d                   	pop    %ebp
+    1408:	c3                   	ret
+    1409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1410:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1413:	31 f6                	xor    %esi,%esi
+}
+    1415:	89 f0                	mov    %esi,%eax
+    1417:	5b                   	pop    %ebx
+    1418:	5e                   	pop    %esi
+    1419:	5d                   	pop    %ebp
+    141a:	c3                   	ret
+    141b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    141f:	90                   	nop
+
+00001420 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 0c             	sub    $0xc,%esp
+    1429:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    142c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    142f:	85 db                	test   %ebx,%ebx
+    1431:	74 55                	je     1488 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1433:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1436:	89 de                	mov    %ebx,%esi
+    1438:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    143f:	39 c7                	cmp    %eax,%edi
+    1441:	72 0d                	jb     1450 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1446:	89 f0                	mov    %esi,%eax
+    1448:	5b                   	pop    %ebx
+    1449:	5e                   	pop    %esi
+    144a:	5f                   	pop    %edi
+    144b:	5d                   	pop    %ebp
+    144c:	c3                   	ret
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1450:	83 ec 0c             	sub    $0xc,%esp
+    1453:	50                   	push   %eax
+    1454:	e8 77 fe ff ff       	call   12d0 <malloc>
+    1459:	83 c4 10             	add    $0x10,%esp
+    145c:	89 c6                	mov    %eax,%esi
+    145e:	85 c0                	test   %eax,%eax
+    1460:	74 e1                	je     1443 <realloc+0x23>
+  memmove(p, ap, have);
+    1462:	83 ec 04             	sub    $0x4,%esp
+    1465:	57                   	push   %edi
+    1466:	53                   	push   %ebx
+    1467:	50                   	push   %eax
+    1468:	e8 03 f8 ff ff       	call   c70 <memmove>
+  free(ap);
+    146d:	89 1c 24             	mov    %ebx,(%esp)
+    1470:	e8 db fd ff ff       	call   1250 <free>
+  return p;
+    1475:	83 c4 10             	add    $0x10,%esp
+}
+    1478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147b:	89 f0                	mov    %esi,%eax
+    147d:	5b                   	pop    %ebx
+    147e:	5e                   	pop    %esi
+    147f:	5f                   	pop    %edi
+    1480:	5d                   	pop    %ebp
+    1481:	c3                   	ret
+    1482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1488:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    148b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    148e:	5b                   	pop    %ebx
+    148f:	5e                   	pop    %esi
+    1490:	5f                   	pop    %edi
+    1491:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1492:	e9 39 fe ff ff       	jmp    12d0 <malloc>
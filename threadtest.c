@@ -0,0 +1,216 @@
+// Tests for clone() and join() threads, through the
+// thread_create/thread_join library in uthread.c.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mman.h"
+
+#define NTHREAD 4
+#define NINCR   10000
+
+lock_t lock;
+volatile int counter;
+volatile char *grown;
+char *mapped;
+volatile int mapok;
+volatile int tfd;
+int fds[2];
+
+void
+fail(char *msg)
+{
+  printf(1, "threadtest: %s failed\n", msg);
+  exit();
+}
+
+void
+adder(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NINCR; i++){
+    lock_acquire(&lock);
+    counter++;
+    lock_release(&lock);
+  }
+}
+
+void
+counttest(void)
+{
+  int i;
+
+  printf(1, "count test\n");
+  lock_init(&lock);
+  counter = 0;
+  for(i = 0; i < NTHREAD; i++)
+    if(thread_create(adder, 0) < 0)
+      fail("thread_create");
+  for(i = 0; i < NTHREAD; i++)
+    if(thread_join() < 0)
+      fail("thread_join");
+  if(thread_join() >= 0)
+    fail("join with no threads");
+  if(counter != NTHREAD*NINCR)
+    fail("counter");
+  printf(1, "count test ok\n");
+}
+
+// Grow the shared address space and write to the new memory
+// and to a file descriptor opened before the thread started.
+void
+grower(void *arg)
+{
+  char *p;
+
+  if((p = sbrk(4096)) == (char*)-1)
+    exit();
+  p[0] = 'g';
+  p[4095] = 'h';
+  grown = p;
+  write(fds[1], arg, 1);
+}
+
+// Touch a file mapped by the main thread; the page fault
+// finds the region in the shared vmas.
+void
+mapper(void *arg)
+{
+  mapok = mapped[0] == *(char*)arg;
+}
+
+void
+sharetest(void)
+{
+  char c;
+  int fd;
+
+  printf(1, "share test\n");
+  if(pipe(fds) < 0)
+    fail("pipe");
+  if(thread_create(grower, "x") < 0)
+    fail("thread_create");
+  if(read(fds[0], &c, 1) != 1 || c != 'x')
+    fail("pipe from thread");
+  if(thread_join() < 0)
+    fail("thread_join");
+  if(grown == 0 || grown[0] != 'g' || grown[4095] != 'h')
+    fail("sbrk in thread");
+  close(fds[0]);
+  close(fds[1]);
+
+  if((fd = open("README", O_RDONLY)) < 0 || read(fd, &c, 1) != 1)
+    fail("read README");
+  if((mapped = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    fail("mmap");
+  close(fd);
+  if(thread_create(mapper, &c) < 0 || thread_join() < 0)
+    fail("mapper thread");
+  if(!mapok)
+    fail("mapping in thread");
+  munmap(mapped, 4096);
+  printf(1, "share test ok\n");
+}
+
+// Open a file, close the main thread's pipe and change
+// directory, all on behalf of the whole process.
+void
+fdsharer(void *arg)
+{
+  tfd = open("README", O_RDONLY);
+  close(fds[1]);
+  chdir(arg);
+}
+
+// Threads share the descriptor table and cwd.
+void
+fdtest(void)
+{
+  char c;
+  int fd;
+
+  printf(1, "fd test\n");
+  if(pipe(fds) < 0)
+    fail("pipe");
+  if(mkdir("thrdir") < 0)
+    fail("mkdir");
+  if(thread_create(fdsharer, "thrdir") < 0 || thread_join() < 0)
+    fail("fdsharer thread");
+  if(tfd < 0 || read(tfd, &c, 1) != 1)
+    fail("fd opened by thread");
+  close(tfd);
+  if(write(fds[1], "x", 1) >= 0)
+    fail("fd closed by thread");
+  close(fds[0]);
+  if((fd = open("f", O_CREATE|O_RDWR)) < 0)
+    fail("create in thread's cwd");
+  close(fd);
+  if(chdir("/") < 0 || (fd = open("/thrdir/f", O_RDONLY)) < 0)
+    fail("chdir in thread");
+  close(fd);
+  unlink("/thrdir/f");
+  unlink("/thrdir");
+  printf(1, "fd test ok\n");
+}
+
+void
+blocker(void *arg)
+{
+  char c;
+
+  read(fds[0], &c, 1);
+}
+
+void
+spinner(void *arg)
+{
+  for(;;)
+    ;
+}
+
+// A process with threads cannot exec, and exiting takes
+// its threads with it.
+void
+exittest(void)
+{
+  char *argv[] = { "echo", "exec", "worked", 0 };
+  int pid;
+
+  printf(1, "exit test\n");
+  if(pipe(fds) < 0)
+    fail("pipe");
+  if(thread_create(blocker, 0) < 0)
+    fail("thread_create");
+  if(exec("echo", argv) >= 0)
+    fail("exec with threads");
+  write(fds[1], "x", 1);
+  if(thread_join() < 0)
+    fail("thread_join");
+  close(fds[0]);
+  close(fds[1]);
+
+  pid = fork();
+  if(pid < 0)
+    fail("fork");
+  if(pid == 0){
+    if(thread_create(spinner, 0) < 0 || thread_create(spinner, 0) < 0)
+      fail("thread_create");
+    exit();
+  }
+  if(wait() != pid)
+    fail("wait");
+  printf(1, "exit test ok\n");
+}
+
+int
+main(void)
+{
+  counttest();
+  sharetest();
+  fdtest();
+  exittest();
+  printf(1, "threadtest ok\n");
+  exit();
+}
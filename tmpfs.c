@@ -0,0 +1,221 @@
+// In-memory file system (tmpfs).
+//
+// tmpfs keeps files entirely in RAM: there is no log and no buffer
+// cache, and each file's data lives in whole pages that its tnode
+// owns directly. fs.c sends inodes whose ip->dev is TMPFSDEV here
+// instead of to the disk, so the in-memory inode cache, directories,
+// path names and file descriptors all work unchanged.
+//
+// A tnode is the tmpfs counterpart of a struct dinode. Inode
+// numbers index tmpfs.node[]; as on disk, inode 0 is unused and
+// ROOTINO is the root directory. Like a dinode, a tnode's contents
+// are protected by the sleep-lock of its in-memory inode; only
+// allocation, which scans for a free tnode, takes tmpfs.lock.
+//
+// There is a single tmpfs instance. It is created empty when it is
+// mounted and all of its memory is freed when it is unmounted.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+// Pages needed to hold the largest file.
+#define NTPAGE ((MAXFILE*BSIZE + PGSIZE-1) / PGSIZE)
+
+struct tnode {
+  short type;           // File type, 0 if free
+  short major;          // Major device number (T_DEV only)
+  short minor;          // Minor device number (T_DEV only)
+  short nlink;          // Number of links to inode in file system
+  uint size;            // Size of file (bytes)
+  char *pages[NTPAGE];  // Data pages, allocated as the file grows
+};
+
+struct {
+  struct spinlock lock;
+  int mounted;
+  struct tnode node[NTNODE];
+} tmpfs;
+
+void
+tmpfsinit(void)
+{
+  initlock(&tmpfs.lock, "tmpfs");
+}
+
+// Free the data pages of tnode tp.
+static void
+tfree(struct tnode *tp)
+{
+  int i;
+
+  for(i = 0; i < NTPAGE; i++){
+    if(tp->pages[i]){
+      kfree(tp->pages[i]);
+      tp->pages[i] = 0;
+    }
+  }
+}
+
+// Create an empty tmpfs, whose root directory holds just
+// "." and "..". Returns -1 if tmpfs is already mounted
+// or there is no memory for the root directory.
+int
+tmpfsmount(void)
+{
+  struct tnode *root;
+  struct dirent *de;
+  char *pg;
+
+  acquire(&tmpfs.lock);
+  if(tmpfs.mounted || (pg = kalloc()) == 0){
+    release(&tmpfs.lock);
+    return -1;
+  }
+  memset(pg, 0, PGSIZE);
+  de = (struct dirent*)pg;
+  de[0].inum = ROOTINO;
+  safestrcpy(de[0].name, ".", DIRSIZ);
+  de[1].inum = ROOTINO;
+  safestrcpy(de[1].name, "..", DIRSIZ);
+
+  root = &tmpfs.node[ROOTINO];
+  memset(root, 0, sizeof(*root));
+  root->type = T_DIR;
+  root->nlink = 1;
+  root->size = 2*sizeof(*de);
+  root->pages[0] = pg;
+  tmpfs.mounted = 1;
+  release(&tmpfs.lock);
+  return 0;
+}
+
+// Throw away the whole tmpfs. The caller has made sure
+// that nothing refers to any of its inodes.
+void
+tmpfsumount(void)
+{
+  struct tnode *tp;
+
+  acquire(&tmpfs.lock);
+  for(tp = tmpfs.node; tp < &tmpfs.node[NTNODE]; tp++){
+    tfree(tp);
+    tp->type = 0;
+  }
+  tmpfs.mounted = 0;
+  release(&tmpfs.lock);
+}
+
+// Allocate a tnode of the given type.
+// Returns its inode number, or 0 if there are none left.
+uint
+tmpalloc(short type)
+{
+  uint inum;
+  struct tnode *tp;
+
+  acquire(&tmpfs.lock);
+  for(inum = 1; inum < NTNODE; inum++){
+    tp = &tmpfs.node[inum];
+    if(tp->type == 0){  // a free tnode
+      memset(tp, 0, sizeof(*tp));
+      tp->type = type;
+      release(&tmpfs.lock);
+      return inum;
+    }
+  }
+  release(&tmpfs.lock);
+  return 0;
+}
+
+// Fill in the in-memory inode ip from its tnode.
+// Caller must hold ip->lock.
+void
+tmpload(struct inode *ip)
+{
+  struct tnode *tp = &tmpfs.node[ip->inum];
+
+  ip->type = tp->type;
+  ip->major = tp->major;
+  ip->minor = tp->minor;
+  ip->nlink = tp->nlink;
+  ip->size = tp->size;
+}
+
+// Copy a modified in-memory inode to its tnode.
+// Caller must hold ip->lock.
+void
+tmpupdate(struct inode *ip)
+{
+  struct tnode *tp = &tmpfs.node[ip->inum];
+
+  acquire(&tmpfs.lock);
+  tp->type = ip->type;
+  tp->major = ip->major;
+  tp->minor = ip->minor;
+  tp->nlink = ip->nlink;
+  tp->size = ip->size;
+  release(&tmpfs.lock);
+}
+
+// Discard the contents of ip.
+// Caller must hold ip->lock.
+void
+tmptrunc(struct inode *ip)
+{
+  tfree(&tmpfs.node[ip->inum]);
+  ip->size = 0;
+  tmpupdate(ip);
+}
+
+// Read data from tmpfs inode ip. readi() has already
+// checked the range and clipped n to the file size.
+// Caller must hold ip->lock.
+int
+tmpread(struct inode *ip, char *dst, uint off, uint n)
+{
+  struct tnode *tp = &tmpfs.node[ip->inum];
+  uint tot, m;
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    memmove(dst, tp->pages[off/PGSIZE] + off%PGSIZE, m);
+  }
+  return n;
+}
+
+// Write data to tmpfs inode ip, allocating pages as needed.
+// writei() has already checked the range.
+// Caller must hold ip->lock.
+int
+tmpwrite(struct inode *ip, char *src, uint off, uint n)
+{
+  struct tnode *tp = &tmpfs.node[ip->inum];
+  uint tot, m;
+  char *pg;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+    if((pg = tp->pages[off/PGSIZE]) == 0){
+      if((pg = kalloc()) == 0)
+        return -1;
+      memset(pg, 0, PGSIZE);
+      tp->pages[off/PGSIZE] = pg;
+    }
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    memmove(pg + off%PGSIZE, src, m);
+  }
+
+  if(n > 0 && off > ip->size){
+    ip->size = off;
+    tmpupdate(ip);
+  }
+  return n;
+}
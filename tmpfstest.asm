@@ -0,0 +1,2034 @@
+
+_tmpfstest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "dir test ok\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  filetest();
+   6:	e8 35 00 00 00       	call   40 <filetest>
+  dirtest();
+   b:	e8 40 02 00 00       	call   250 <dirtest>
+  exit();
+  10:	e8 9e 06 00 00       	call   6b3 <exit>
+  15:	66 90                	xchg   %ax,%ax
+  17:	66 90                	xchg   %ax,%ax
+  19:	66 90                	xchg   %ax,%ax
+  1b:	66 90                	xchg   %ax,%ax
+  1d:	66 90                	xchg   %ax,%ax
+  1f:	90                   	nop
+
+00000020 <fail>:
+{
+  20:	55                   	push   %ebp
+  21:	89 e5                	mov    %esp,%ebp
+  23:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "tmpfstest: %s failed\n", msg);
+  26:	ff 75 08             	push   0x8(%ebp)
+  29:	68 c0 0e 00 00       	push   $0xec0
+  2e:	6a 01                	push   $0x1
+  30:	e8 1b 09 00 00       	call   950 <printf>
+  exit();
+  35:	e8 79 06 00 00       	call   6b3 <exit>
+  3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000040 <filetest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	56                   	push   %esi
+  44:	53                   	push   %ebx
+  45:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "file test\n");
+  48:	68 d6 0e 00 00       	push   $0xed6
+  4d:	6a 01                	push   $0x1
+  4f:	e8 fc 08 00 00       	call   950 <printf>
+  if(stat("/tmp", &st) < 0 || st.type != T_DIR || st.dev != TMPFSDEV)
+  54:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  57:	59                   	pop    %ecx
+  58:	5b                   	pop    %ebx
+  59:	50                   	push   %eax
+  5a:	68 e6 0e 00 00       	push   $0xee6
+  5f:	e8 8c 05 00 00       	call   5f0 <stat>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	85 c0                	test   %eax,%eax
+  69:	0f 88 ab 01 00 00    	js     21a <filetest+0x1da>
+  6f:	66 83 7d e4 01       	cmpw   $0x1,-0x1c(%ebp)
+  74:	0f 85 a0 01 00 00    	jne    21a <filetest+0x1da>
+  7a:	83 7d e8 02          	cmpl   $0x2,-0x18(%ebp)
+  7e:	0f 85 96 01 00 00    	jne    21a <filetest+0x1da>
+  fd = open("/tmp/big", O_CREATE|O_RDWR);
+  84:	83 ec 08             	sub    $0x8,%esp
+  87:	68 02 02 00 00       	push   $0x202
+  8c:	68 eb 0e 00 00       	push   $0xeeb
+  91:	e8 5d 06 00 00       	call   6f3 <open>
+  if(fd < 0)
+  96:	83 c4 10             	add    $0x10,%esp
+  fd = open("/tmp/big", O_CREATE|O_RDWR);
+  99:	89 c6                	mov    %eax,%esi
+  if(fd < 0)
+  9b:	85 c0                	test   %eax,%eax
+  9d:	0f 88 6a 01 00 00    	js     20d <filetest+0x1cd>
+  for(i = 0; i < sizeof(buf); i++)
+  a3:	31 c0                	xor    %eax,%eax
+  a5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[i] = i;
+  a8:	88 80 c0 14 00 00    	mov    %al,0x14c0(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+  ae:	83 c0 01             	add    $0x1,%eax
+  b1:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  b6:	75 f0                	jne    a8 <filetest+0x68>
+  b8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 20 00 00       	push   $0x2000
+  c8:	68 c0 14 00 00       	push   $0x14c0
+  cd:	56                   	push   %esi
+  ce:	e8 00 06 00 00       	call   6d3 <write>
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  db:	0f 85 1f 01 00 00    	jne    200 <filetest+0x1c0>
+  for(i = 0; i < MAXFILE*BSIZE / sizeof(buf); i++)
+  e1:	83 eb 01             	sub    $0x1,%ebx
+  e4:	75 da                	jne    c0 <filetest+0x80>
+  if(write(fd, buf, n) != n)
+  e6:	83 ec 04             	sub    $0x4,%esp
+  e9:	68 00 18 00 00       	push   $0x1800
+  ee:	68 c0 14 00 00       	push   $0x14c0
+  f3:	56                   	push   %esi
+  f4:	e8 da 05 00 00       	call   6d3 <write>
+  f9:	83 c4 10             	add    $0x10,%esp
+  fc:	3d 00 18 00 00       	cmp    $0x1800,%eax
+ 101:	0f 85 ec 00 00 00    	jne    1f3 <filetest+0x1b3>
+  if(write(fd, buf, 1) >= 0)
+ 107:	83 ec 04             	sub    $0x4,%esp
+ 10a:	6a 01                	push   $0x1
+ 10c:	68 c0 14 00 00       	push   $0x14c0
+ 111:	56                   	push   %esi
+ 112:	e8 bc 05 00 00       	call   6d3 <write>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 89 c4 00 00 00    	jns    1e6 <filetest+0x1a6>
+  close(fd);
+ 122:	83 ec 0c             	sub    $0xc,%esp
+ 125:	56                   	push   %esi
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+ 126:	31 f6                	xor    %esi,%esi
+  close(fd);
+ 128:	e8 ae 05 00 00       	call   6db <close>
+  fd = open("/tmp/big", O_RDONLY);
+ 12d:	58                   	pop    %eax
+ 12e:	5a                   	pop    %edx
+ 12f:	6a 00                	push   $0x0
+ 131:	68 eb 0e 00 00       	push   $0xeeb
+ 136:	e8 b8 05 00 00       	call   6f3 <open>
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+ 13b:	83 c4 10             	add    $0x10,%esp
+  fd = open("/tmp/big", O_RDONLY);
+ 13e:	89 c3                	mov    %eax,%ebx
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+ 140:	eb 22                	jmp    164 <filetest+0x124>
+ 142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(buf[0] != (char)i || buf[n-1] != (char)(i+n-1))
+ 148:	89 f1                	mov    %esi,%ecx
+ 14a:	38 0d c0 14 00 00    	cmp    %cl,0x14c0
+ 150:	0f 85 83 00 00 00    	jne    1d9 <filetest+0x199>
+ 156:	8d 54 06 ff          	lea    -0x1(%esi,%eax,1),%edx
+ 15a:	38 90 bf 14 00 00    	cmp    %dl,0x14bf(%eax)
+ 160:	75 77                	jne    1d9 <filetest+0x199>
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+ 162:	01 c6                	add    %eax,%esi
+ 164:	83 ec 04             	sub    $0x4,%esp
+ 167:	68 00 20 00 00       	push   $0x2000
+ 16c:	68 c0 14 00 00       	push   $0x14c0
+ 171:	53                   	push   %ebx
+ 172:	e8 54 05 00 00       	call   6cb <read>
+ 177:	83 c4 10             	add    $0x10,%esp
+ 17a:	85 c0                	test   %eax,%eax
+ 17c:	7f ca                	jg     148 <filetest+0x108>
+  if(i != MAXFILE*BSIZE)
+ 17e:	81 fe 00 18 01 00    	cmp    $0x11800,%esi
+ 184:	0f 85 b7 00 00 00    	jne    241 <filetest+0x201>
+  close(fd);
+ 18a:	83 ec 0c             	sub    $0xc,%esp
+ 18d:	53                   	push   %ebx
+ 18e:	e8 48 05 00 00       	call   6db <close>
+  if(unlink("/tmp/big") < 0)
+ 193:	c7 04 24 eb 0e 00 00 	movl   $0xeeb,(%esp)
+ 19a:	e8 64 05 00 00       	call   703 <unlink>
+ 19f:	83 c4 10             	add    $0x10,%esp
+ 1a2:	85 c0                	test   %eax,%eax
+ 1a4:	0f 88 8a 00 00 00    	js     234 <filetest+0x1f4>
+  if(open("/tmp/big", O_RDONLY) >= 0)
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	68 eb 0e 00 00       	push   $0xeeb
+ 1b4:	e8 3a 05 00 00       	call   6f3 <open>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	85 c0                	test   %eax,%eax
+ 1be:	79 67                	jns    227 <filetest+0x1e7>
+  printf(1, "file test ok\n");
+ 1c0:	83 ec 08             	sub    $0x8,%esp
+ 1c3:	68 4b 0f 00 00       	push   $0xf4b
+ 1c8:	6a 01                	push   $0x1
+ 1ca:	e8 81 07 00 00       	call   950 <printf>
+}
+ 1cf:	83 c4 10             	add    $0x10,%esp
+ 1d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d5:	5b                   	pop    %ebx
+ 1d6:	5e                   	pop    %esi
+ 1d7:	5d                   	pop    %ebp
+ 1d8:	c3                   	ret
+      fail("read data");
+ 1d9:	83 ec 0c             	sub    $0xc,%esp
+ 1dc:	68 25 0f 00 00       	push   $0xf25
+ 1e1:	e8 3a fe ff ff       	call   20 <fail>
+    fail("write past MAXFILE");
+ 1e6:	83 ec 0c             	sub    $0xc,%esp
+ 1e9:	68 12 0f 00 00       	push   $0xf12
+ 1ee:	e8 2d fe ff ff       	call   20 <fail>
+    fail("write to MAXFILE");
+ 1f3:	83 ec 0c             	sub    $0xc,%esp
+ 1f6:	68 01 0f 00 00       	push   $0xf01
+ 1fb:	e8 20 fe ff ff       	call   20 <fail>
+      fail("write");
+ 200:	83 ec 0c             	sub    $0xc,%esp
+ 203:	68 fb 0e 00 00       	push   $0xefb
+ 208:	e8 13 fe ff ff       	call   20 <fail>
+    fail("create");
+ 20d:	83 ec 0c             	sub    $0xc,%esp
+ 210:	68 f4 0e 00 00       	push   $0xef4
+ 215:	e8 06 fe ff ff       	call   20 <fail>
+    fail("stat /tmp");
+ 21a:	83 ec 0c             	sub    $0xc,%esp
+ 21d:	68 e1 0e 00 00       	push   $0xee1
+ 222:	e8 f9 fd ff ff       	call   20 <fail>
+    fail("open after unlink");
+ 227:	83 ec 0c             	sub    $0xc,%esp
+ 22a:	68 39 0f 00 00       	push   $0xf39
+ 22f:	e8 ec fd ff ff       	call   20 <fail>
+    fail("unlink");
+ 234:	83 ec 0c             	sub    $0xc,%esp
+ 237:	68 44 0f 00 00       	push   $0xf44
+ 23c:	e8 df fd ff ff       	call   20 <fail>
+    fail("read size");
+ 241:	83 ec 0c             	sub    $0xc,%esp
+ 244:	68 2f 0f 00 00       	push   $0xf2f
+ 249:	e8 d2 fd ff ff       	call   20 <fail>
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <dirtest>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	83 ec 2c             	sub    $0x2c,%esp
+  printf(1, "dir test\n");
+ 257:	68 59 0f 00 00       	push   $0xf59
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 ed 06 00 00       	call   950 <printf>
+  if(mkdir("/tmp/d") < 0 || chdir("/tmp/d") < 0)
+ 263:	c7 04 24 63 0f 00 00 	movl   $0xf63,(%esp)
+ 26a:	e8 ac 04 00 00       	call   71b <mkdir>
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	85 c0                	test   %eax,%eax
+ 274:	0f 88 79 01 00 00    	js     3f3 <dirtest+0x1a3>
+ 27a:	83 ec 0c             	sub    $0xc,%esp
+ 27d:	68 63 0f 00 00       	push   $0xf63
+ 282:	e8 9c 04 00 00       	call   723 <chdir>
+ 287:	83 c4 10             	add    $0x10,%esp
+ 28a:	85 c0                	test   %eax,%eax
+ 28c:	0f 88 61 01 00 00    	js     3f3 <dirtest+0x1a3>
+  if((fd = open("f", O_CREATE|O_RDWR)) < 0)
+ 292:	83 ec 08             	sub    $0x8,%esp
+ 295:	68 02 02 00 00       	push   $0x202
+ 29a:	68 89 0f 00 00       	push   $0xf89
+ 29f:	e8 4f 04 00 00       	call   6f3 <open>
+ 2a4:	83 c4 10             	add    $0x10,%esp
+ 2a7:	85 c0                	test   %eax,%eax
+ 2a9:	0f 88 6b 01 00 00    	js     41a <dirtest+0x1ca>
+  close(fd);
+ 2af:	83 ec 0c             	sub    $0xc,%esp
+ 2b2:	50                   	push   %eax
+ 2b3:	e8 23 04 00 00       	call   6db <close>
+  if(link("f", "/tmpfstest.f") >= 0)
+ 2b8:	58                   	pop    %eax
+ 2b9:	5a                   	pop    %edx
+ 2ba:	68 7e 0f 00 00       	push   $0xf7e
+ 2bf:	68 89 0f 00 00       	push   $0xf89
+ 2c4:	e8 4a 04 00 00       	call   713 <link>
+ 2c9:	83 c4 10             	add    $0x10,%esp
+ 2cc:	85 c0                	test   %eax,%eax
+ 2ce:	0f 89 87 01 00 00    	jns    45b <dirtest+0x20b>
+  if(chdir("../../..") < 0 || stat(".", &st) < 0 ||
+ 2d4:	83 ec 0c             	sub    $0xc,%esp
+ 2d7:	68 a4 0f 00 00       	push   $0xfa4
+ 2dc:	e8 42 04 00 00       	call   723 <chdir>
+ 2e1:	83 c4 10             	add    $0x10,%esp
+ 2e4:	85 c0                	test   %eax,%eax
+ 2e6:	0f 88 fa 00 00 00    	js     3e6 <dirtest+0x196>
+ 2ec:	83 ec 08             	sub    $0x8,%esp
+ 2ef:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+ 2f2:	53                   	push   %ebx
+ 2f3:	68 ab 0f 00 00       	push   $0xfab
+ 2f8:	e8 f3 02 00 00       	call   5f0 <stat>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	0f 88 de 00 00 00    	js     3e6 <dirtest+0x196>
+ 308:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+ 30c:	0f 85 d4 00 00 00    	jne    3e6 <dirtest+0x196>
+     st.dev != ROOTDEV || st.ino != ROOTINO)
+ 312:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+ 316:	0f 85 ca 00 00 00    	jne    3e6 <dirtest+0x196>
+  if(stat("tmp/d/../d/f", &st) < 0 || st.dev != TMPFSDEV)
+ 31c:	83 ec 08             	sub    $0x8,%esp
+ 31f:	53                   	push   %ebx
+ 320:	68 ad 0f 00 00       	push   $0xfad
+ 325:	e8 c6 02 00 00       	call   5f0 <stat>
+ 32a:	83 c4 10             	add    $0x10,%esp
+ 32d:	85 c0                	test   %eax,%eax
+ 32f:	0f 88 d8 00 00 00    	js     40d <dirtest+0x1bd>
+ 335:	83 7d e8 02          	cmpl   $0x2,-0x18(%ebp)
+ 339:	0f 85 ce 00 00 00    	jne    40d <dirtest+0x1bd>
+  if((fd = open("/tmp/d/f", O_RDONLY)) < 0)
+ 33f:	83 ec 08             	sub    $0x8,%esp
+ 342:	6a 00                	push   $0x0
+ 344:	68 cd 0f 00 00       	push   $0xfcd
+ 349:	e8 a5 03 00 00       	call   6f3 <open>
+ 34e:	83 c4 10             	add    $0x10,%esp
+ 351:	89 c3                	mov    %eax,%ebx
+ 353:	85 c0                	test   %eax,%eax
+ 355:	0f 88 e6 00 00 00    	js     441 <dirtest+0x1f1>
+  if(umount("/tmp") >= 0)
+ 35b:	83 ec 0c             	sub    $0xc,%esp
+ 35e:	68 e6 0e 00 00       	push   $0xee6
+ 363:	e8 8b 04 00 00       	call   7f3 <umount>
+ 368:	83 c4 10             	add    $0x10,%esp
+ 36b:	85 c0                	test   %eax,%eax
+ 36d:	0f 89 b4 00 00 00    	jns    427 <dirtest+0x1d7>
+  close(fd);
+ 373:	83 ec 0c             	sub    $0xc,%esp
+ 376:	53                   	push   %ebx
+ 377:	e8 5f 03 00 00       	call   6db <close>
+  if(unlink("/tmp/d") >= 0)
+ 37c:	c7 04 24 63 0f 00 00 	movl   $0xf63,(%esp)
+ 383:	e8 7b 03 00 00       	call   703 <unlink>
+ 388:	83 c4 10             	add    $0x10,%esp
+ 38b:	85 c0                	test   %eax,%eax
+ 38d:	0f 89 bb 00 00 00    	jns    44e <dirtest+0x1fe>
+  if(unlink("/tmp/d/f") < 0 || unlink("/tmp/d") < 0)
+ 393:	83 ec 0c             	sub    $0xc,%esp
+ 396:	68 cd 0f 00 00       	push   $0xfcd
+ 39b:	e8 63 03 00 00       	call   703 <unlink>
+ 3a0:	83 c4 10             	add    $0x10,%esp
+ 3a3:	85 c0                	test   %eax,%eax
+ 3a5:	78 59                	js     400 <dirtest+0x1b0>
+ 3a7:	83 ec 0c             	sub    $0xc,%esp
+ 3aa:	68 63 0f 00 00       	push   $0xf63
+ 3af:	e8 4f 03 00 00       	call   703 <unlink>
+ 3b4:	83 c4 10             	add    $0x10,%esp
+ 3b7:	85 c0                	test   %eax,%eax
+ 3b9:	78 45                	js     400 <dirtest+0x1b0>
+  if(unlink("/tmp") >= 0)
+ 3bb:	83 ec 0c             	sub    $0xc,%esp
+ 3be:	68 e6 0e 00 00       	push   $0xee6
+ 3c3:	e8 3b 03 00 00       	call   703 <unlink>
+ 3c8:	83 c4 10             	add    $0x10,%esp
+ 3cb:	85 c0                	test   %eax,%eax
+ 3cd:	79 65                	jns    434 <dirtest+0x1e4>
+  printf(1, "dir test ok\n");
+ 3cf:	83 ec 08             	sub    $0x8,%esp
+ 3d2:	68 28 10 00 00       	push   $0x1028
+ 3d7:	6a 01                	push   $0x1
+ 3d9:	e8 72 05 00 00       	call   950 <printf>
+}
+ 3de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e1:	83 c4 10             	add    $0x10,%esp
+ 3e4:	c9                   	leave
+ 3e5:	c3                   	ret
+    fail("..");
+ 3e6:	83 ec 0c             	sub    $0xc,%esp
+ 3e9:	68 aa 0f 00 00       	push   $0xfaa
+ 3ee:	e8 2d fc ff ff       	call   20 <fail>
+    fail("mkdir");
+ 3f3:	83 ec 0c             	sub    $0xc,%esp
+ 3f6:	68 6a 0f 00 00       	push   $0xf6a
+ 3fb:	e8 20 fc ff ff       	call   20 <fail>
+    fail("unlink dir");
+ 400:	83 ec 0c             	sub    $0xc,%esp
+ 403:	68 0a 10 00 00       	push   $0x100a
+ 408:	e8 13 fc ff ff       	call   20 <fail>
+    fail("path through mount");
+ 40d:	83 ec 0c             	sub    $0xc,%esp
+ 410:	68 ba 0f 00 00       	push   $0xfba
+ 415:	e8 06 fc ff ff       	call   20 <fail>
+    fail("create in dir");
+ 41a:	83 ec 0c             	sub    $0xc,%esp
+ 41d:	68 70 0f 00 00       	push   $0xf70
+ 422:	e8 f9 fb ff ff       	call   20 <fail>
+    fail("umount busy");
+ 427:	83 ec 0c             	sub    $0xc,%esp
+ 42a:	68 e9 0f 00 00       	push   $0xfe9
+ 42f:	e8 ec fb ff ff       	call   20 <fail>
+    fail("unlink mount point");
+ 434:	83 ec 0c             	sub    $0xc,%esp
+ 437:	68 15 10 00 00       	push   $0x1015
+ 43c:	e8 df fb ff ff       	call   20 <fail>
+    fail("open through mount");
+ 441:	83 ec 0c             	sub    $0xc,%esp
+ 444:	68 d6 0f 00 00       	push   $0xfd6
+ 449:	e8 d2 fb ff ff       	call   20 <fail>
+    fail("unlink non-empty dir");
+ 44e:	83 ec 0c             	sub    $0xc,%esp
+ 451:	68 f5 0f 00 00       	push   $0xff5
+ 456:	e8 c5 fb ff ff       	call   20 <fail>
+    fail("link across file systems");
+ 45b:	83 ec 0c             	sub    $0xc,%esp
+ 45e:	68 8b 0f 00 00       	push   $0xf8b
+ 463:	e8 b8 fb ff ff       	call   20 <fail>
+ 468:	66 90                	xchg   %ax,%ax
+ 46a:	66 90                	xchg   %ax,%ax
+ 46c:	66 90                	xchg   %ax,%ax
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 470:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 471:	31 c0                	xor    %eax,%eax
+{
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	53                   	push   %ebx
+ 476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 480:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 484:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 487:	83 c0 01             	add    $0x1,%eax
+ 48a:	84 d2                	test   %dl,%dl
+ 48c:	75 f2                	jne    480 <strcpy+0x10>
+    ;
+  return os;
+}
+ 48e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 491:	89 c8                	mov    %ecx,%eax
+ 493:	c9                   	leave
+ 494:	c3                   	ret
+ 495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4aa:	0f b6 02             	movzbl (%edx),%eax
+ 4ad:	84 c0                	test   %al,%al
+ 4af:	75 17                	jne    4c8 <strcmp+0x28>
+ 4b1:	eb 3a                	jmp    4ed <strcmp+0x4d>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4bc:	83 c2 01             	add    $0x1,%edx
+ 4bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4c2:	84 c0                	test   %al,%al
+ 4c4:	74 1a                	je     4e0 <strcmp+0x40>
+    p++, q++;
+ 4c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4cb:	38 c3                	cmp    %al,%bl
+ 4cd:	74 e9                	je     4b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4cf:	29 d8                	sub    %ebx,%eax
+}
+ 4d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d4:	c9                   	leave
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4e4:	31 c0                	xor    %eax,%eax
+ 4e6:	29 d8                	sub    %ebx,%eax
+}
+ 4e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4eb:	c9                   	leave
+ 4ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 4f0:	31 c0                	xor    %eax,%eax
+ 4f2:	eb db                	jmp    4cf <strcmp+0x2f>
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 506:	80 3a 00             	cmpb   $0x0,(%edx)
+ 509:	74 15                	je     520 <strlen+0x20>
+ 50b:	31 c0                	xor    %eax,%eax
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+ 510:	83 c0 01             	add    $0x1,%eax
+ 513:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 517:	89 c1                	mov    %eax,%ecx
+ 519:	75 f5                	jne    510 <strlen+0x10>
+    ;
+  return n;
+}
+ 51b:	89 c8                	mov    %ecx,%eax
+ 51d:	5d                   	pop    %ebp
+ 51e:	c3                   	ret
+ 51f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 520:	31 c9                	xor    %ecx,%ecx
+}
+ 522:	5d                   	pop    %ebp
+ 523:	89 c8                	mov    %ecx,%eax
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 537:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 53a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 53d:	89 d7                	mov    %edx,%edi
+ 53f:	fc                   	cld
+ 540:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 542:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 545:	89 d0                	mov    %edx,%eax
+ 547:	c9                   	leave
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 55a:	0f b6 10             	movzbl (%eax),%edx
+ 55d:	84 d2                	test   %dl,%dl
+ 55f:	75 12                	jne    573 <strchr+0x23>
+ 561:	eb 1d                	jmp    580 <strchr+0x30>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 56c:	83 c0 01             	add    $0x1,%eax
+ 56f:	84 d2                	test   %dl,%dl
+ 571:	74 0d                	je     580 <strchr+0x30>
+    if(*s == c)
+ 573:	38 d1                	cmp    %dl,%cl
+ 575:	75 f1                	jne    568 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 577:	5d                   	pop    %ebp
+ 578:	c3                   	ret
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 580:	31 c0                	xor    %eax,%eax
+}
+ 582:	5d                   	pop    %ebp
+ 583:	c3                   	ret
+ 584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 595:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 598:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 599:	31 db                	xor    %ebx,%ebx
+{
+ 59b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 59e:	eb 27                	jmp    5c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	6a 01                	push   $0x1
+ 5a5:	56                   	push   %esi
+ 5a6:	6a 00                	push   $0x0
+ 5a8:	e8 1e 01 00 00       	call   6cb <read>
+    if(cc < 1)
+ 5ad:	83 c4 10             	add    $0x10,%esp
+ 5b0:	85 c0                	test   %eax,%eax
+ 5b2:	7e 1d                	jle    5d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5bf:	3c 0a                	cmp    $0xa,%al
+ 5c1:	74 10                	je     5d3 <gets+0x43>
+ 5c3:	3c 0d                	cmp    $0xd,%al
+ 5c5:	74 0c                	je     5d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5c7:	89 df                	mov    %ebx,%edi
+ 5c9:	83 c3 01             	add    $0x1,%ebx
+ 5cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5cf:	7c cf                	jl     5a0 <gets+0x10>
+ 5d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dd:	5b                   	pop    %ebx
+ 5de:	5e                   	pop    %esi
+ 5df:	5f                   	pop    %edi
+ 5e0:	5d                   	pop    %ebp
+ 5e1:	c3                   	ret
+ 5e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	56                   	push   %esi
+ 5f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5f5:	83 ec 08             	sub    $0x8,%esp
+ 5f8:	6a 00                	push   $0x0
+ 5fa:	ff 75 08             	push   0x8(%ebp)
+ 5fd:	e8 f1 00 00 00       	call   6f3 <open>
+  if(fd < 0)
+ 602:	83 c4 10             	add    $0x10,%esp
+ 605:	85 c0                	test   %eax,%eax
+ 607:	78 27                	js     630 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 609:	83 ec 08             	sub    $0x8,%esp
+ 60c:	ff 75 0c             	push   0xc(%ebp)
+ 60f:	89 c3                	mov    %eax,%ebx
+ 611:	50                   	push   %eax
+ 612:	e8 f4 00 00 00       	call   70b <fstat>
+  close(fd);
+ 617:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 61a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 61c:	e8 ba 00 00 00       	call   6db <close>
+  return r;
+ 621:	83 c4 10             	add    $0x10,%esp
+}
+ 624:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 627:	89 f0                	mov    %esi,%eax
+ 629:	5b                   	pop    %ebx
+ 62a:	5e                   	pop    %esi
+ 62b:	5d                   	pop    %ebp
+ 62c:	c3                   	ret
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 635:	eb ed                	jmp    624 <stat+0x34>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	53                   	push   %ebx
+ 644:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 647:	0f be 02             	movsbl (%edx),%eax
+ 64a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 64d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 655:	77 1e                	ja     675 <atoi+0x35>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 660:	83 c2 01             	add    $0x1,%edx
+ 663:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 666:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 66a:	0f be 02             	movsbl (%edx),%eax
+ 66d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 670:	80 fb 09             	cmp    $0x9,%bl
+ 673:	76 eb                	jbe    660 <atoi+0x20>
+  return n;
+}
+ 675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 678:	89 c8                	mov    %ecx,%eax
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	8b 45 10             	mov    0x10(%ebp),%eax
+ 688:	8b 55 08             	mov    0x8(%ebp),%edx
+ 68b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 68e:	85 c0                	test   %eax,%eax
+ 690:	7e 13                	jle    6a5 <memmove+0x25>
+ 692:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 694:	89 d7                	mov    %edx,%edi
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6a1:	39 f8                	cmp    %edi,%eax
+ 6a3:	75 fb                	jne    6a0 <memmove+0x20>
+  return vdst;
+}
+ 6a5:	5e                   	pop    %esi
+ 6a6:	89 d0                	mov    %edx,%eax
+ 6a8:	5f                   	pop    %edi
+ 6a9:	5d                   	pop    %ebp
+ 6aa:	c3                   	ret
+
+000006ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <exit>:
+SYSCALL(exit)
+ 6b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <wait>:
+SYSCALL(wait)
+ 6bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <pipe>:
+SYSCALL(pipe)
+ 6c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <read>:
+SYSCALL(read)
+ 6cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <write>:
+SYSCALL(write)
+ 6d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <close>:
+SYSCALL(close)
+ 6db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <kill>:
+SYSCALL(kill)
+ 6e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <exec>:
+SYSCALL(exec)
+ 6eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <open>:
+SYSCALL(open)
+ 6f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <mknod>:
+SYSCALL(mknod)
+ 6fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <unlink>:
+SYSCALL(unlink)
+ 703:	b8 12 00 00 00       	mov    $0x12,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <fstat>:
+SYSCALL(fstat)
+ 70b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <link>:
+SYSCALL(link)
+ 713:	b8 13 00 00 00       	mov    $0x13,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <mkdir>:
+SYSCALL(mkdir)
+ 71b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <chdir>:
+SYSCALL(chdir)
+ 723:	b8 09 00 00 00       	mov    $0x9,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <dup>:
+SYSCALL(dup)
+ 72b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <getpid>:
+SYSCALL(getpid)
+ 733:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <sbrk>:
+SYSCALL(sbrk)
+ 73b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <sleep>:
+SYSCALL(sleep)
+ 743:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <uptime>:
+SYSCALL(uptime)
+ 74b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 753:	b8 16 00 00 00       	mov    $0x16,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 75b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 763:	b8 18 00 00 00       	mov    $0x18,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 76b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 773:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 77b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 783:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <setpriority>:
+SYSCALL(setpriority)
+ 78b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 793:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <getcpustats>:
+SYSCALL(getcpustats)
+ 79b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <setscheduler>:
+SYSCALL(setscheduler)
+ 7a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 7ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getscheduler>:
+SYSCALL(getscheduler)
+ 7b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <splice>:
+SYSCALL(splice)
+ 7bb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <readv>:
+SYSCALL(readv)
+ 7c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <writev>:
+SYSCALL(writev)
+ 7cb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <pread>:
+SYSCALL(pread)
+ 7d3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <pwrite>:
+SYSCALL(pwrite)
+ 7db:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <getlogstat>:
+SYSCALL(getlogstat)
+ 7e3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <mount>:
+SYSCALL(mount)
+ 7eb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <umount>:
+SYSCALL(umount)
+ 7f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <mmap>:
+SYSCALL(mmap)
+ 7fb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <munmap>:
+SYSCALL(munmap)
+ 803:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <membench>:
+SYSCALL(membench)
+ 80b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getlockstat>:
+SYSCALL(getlockstat)
+ 813:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <lockbench>:
+SYSCALL(lockbench)
+ 81b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <prof>:
+SYSCALL(prof)
+ 823:	b8 30 00 00 00       	mov    $0x30,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <tracectl>:
+SYSCALL(tracectl)
+ 82b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <traceread>:
+SYSCALL(traceread)
+ 833:	b8 32 00 00 00       	mov    $0x32,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <getsysstat>:
+SYSCALL(getsysstat)
+ 83b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 843:	b8 34 00 00 00       	mov    $0x34,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <getschedwait>:
+SYSCALL(getschedwait)
+ 84b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <mlfqread>:
+SYSCALL(mlfqread)
+ 853:	b8 36 00 00 00       	mov    $0x36,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <dllock>:
+SYSCALL(dllock)
+ 85b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 863:	b8 38 00 00 00       	mov    $0x38,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 86b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <clone>:
+SYSCALL(clone)
+ 873:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <join>:
+SYSCALL(join)
+ 87b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <futex>:
+SYSCALL(futex)
+ 883:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <shmat>:
+SYSCALL(shmat)
+ 88b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <shmdt>:
+SYSCALL(shmdt)
+ 893:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <poll>:
+SYSCALL(poll)
+ 89b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+ 8a3:	66 90                	xchg   %ax,%ax
+ 8a5:	66 90                	xchg   %ax,%ax
+ 8a7:	66 90                	xchg   %ax,%ax
+ 8a9:	66 90                	xchg   %ax,%ax
+ 8ab:	66 90                	xchg   %ax,%ax
+ 8ad:	66 90                	xchg   %ax,%ax
+ 8af:	90                   	nop
+
+000008b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8b8:	89 d1                	mov    %edx,%ecx
+{
+ 8ba:	83 ec 3c             	sub    $0x3c,%esp
+ 8bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8c0:	85 d2                	test   %edx,%edx
+ 8c2:	0f 89 80 00 00 00    	jns    948 <printint+0x98>
+ 8c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8cc:	74 7a                	je     948 <printint+0x98>
+    x = -xx;
+ 8ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8d8:	31 f6                	xor    %esi,%esi
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8e0:	89 c8                	mov    %ecx,%eax
+ 8e2:	31 d2                	xor    %edx,%edx
+ 8e4:	89 f7                	mov    %esi,%edi
+ 8e6:	f7 f3                	div    %ebx
+ 8e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8eb:	0f b6 92 94 10 00 00 	movzbl 0x1094(%edx),%edx
+ 8f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8f6:	89 ca                	mov    %ecx,%edx
+ 8f8:	89 c1                	mov    %eax,%ecx
+ 8fa:	39 da                	cmp    %ebx,%edx
+ 8fc:	73 e2                	jae    8e0 <printint+0x30>
+  if(neg)
+ 8fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 901:	85 c0                	test   %eax,%eax
+ 903:	74 07                	je     90c <printint+0x5c>
+    buf[i++] = '-';
+ 905:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 90a:	89 f7                	mov    %esi,%edi
+ 90c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 90f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 912:	01 df                	add    %ebx,%edi
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 918:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 921:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 924:	6a 01                	push   $0x1
+ 926:	50                   	push   %eax
+ 927:	56                   	push   %esi
+ 928:	e8 a6 fd ff ff       	call   6d3 <write>
+  while(--i >= 0)
+ 92d:	89 f8                	mov    %edi,%eax
+ 92f:	83 c4 10             	add    $0x10,%esp
+ 932:	83 ef 01             	sub    $0x1,%edi
+ 935:	39 d8                	cmp    %ebx,%eax
+ 937:	75 df                	jne    918 <printint+0x68>
+}
+ 939:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 93c:	5b                   	pop    %ebx
+ 93d:	5e                   	pop    %esi
+ 93e:	5f                   	pop    %edi
+ 93f:	5d                   	pop    %ebp
+ 940:	c3                   	ret
+ 941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 948:	31 c0                	xor    %eax,%eax
+ 94a:	eb 89                	jmp    8d5 <printint+0x25>
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 959:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 95c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 95f:	0f b6 1e             	movzbl (%esi),%ebx
+ 962:	83 c6 01             	add    $0x1,%esi
+ 965:	84 db                	test   %bl,%bl
+ 967:	74 67                	je     9d0 <printf+0x80>
+ 969:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 96c:	31 d2                	xor    %edx,%edx
+ 96e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 971:	eb 34                	jmp    9a7 <printf+0x57>
+ 973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 977:	90                   	nop
+ 978:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 97b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 980:	83 f8 25             	cmp    $0x25,%eax
+ 983:	74 18                	je     99d <printf+0x4d>
+  write(fd, &c, 1);
+ 985:	83 ec 04             	sub    $0x4,%esp
+ 988:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 98b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 98e:	6a 01                	push   $0x1
+ 990:	50                   	push   %eax
+ 991:	57                   	push   %edi
+ 992:	e8 3c fd ff ff       	call   6d3 <write>
+ 997:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 99a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 99d:	0f b6 1e             	movzbl (%esi),%ebx
+ 9a0:	83 c6 01             	add    $0x1,%esi
+ 9a3:	84 db                	test   %bl,%bl
+ 9a5:	74 29                	je     9d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9aa:	85 d2                	test   %edx,%edx
+ 9ac:	74 ca                	je     978 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ae:	83 fa 25             	cmp    $0x25,%edx
+ 9b1:	75 ea                	jne    99d <printf+0x4d>
+      if(c == 'd'){
+ 9b3:	83 f8 25             	cmp    $0x25,%eax
+ 9b6:	0f 84 24 01 00 00    	je     ae0 <printf+0x190>
+ 9bc:	83 e8 63             	sub    $0x63,%eax
+ 9bf:	83 f8 15             	cmp    $0x15,%eax
+ 9c2:	77 1c                	ja     9e0 <printf+0x90>
+ 9c4:	ff 24 85 3c 10 00 00 	jmp    *0x103c(,%eax,4)
+ 9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d3:	5b                   	pop    %ebx
+ 9d4:	5e                   	pop    %esi
+ 9d5:	5f                   	pop    %edi
+ 9d6:	5d                   	pop    %ebp
+ 9d7:	c3                   	ret
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ea:	6a 01                	push   $0x1
+ 9ec:	52                   	push   %edx
+ 9ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9f0:	57                   	push   %edi
+ 9f1:	e8 dd fc ff ff       	call   6d3 <write>
+ 9f6:	83 c4 0c             	add    $0xc,%esp
+ 9f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9fc:	6a 01                	push   $0x1
+ 9fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a01:	52                   	push   %edx
+ a02:	57                   	push   %edi
+ a03:	e8 cb fc ff ff       	call   6d3 <write>
+        putc(fd, c);
+ a08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a0b:	31 d2                	xor    %edx,%edx
+ a0d:	eb 8e                	jmp    99d <printf+0x4d>
+ a0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a1b:	8b 13                	mov    (%ebx),%edx
+ a1d:	6a 00                	push   $0x0
+ a1f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a24:	e8 87 fe ff ff       	call   8b0 <printint>
+        ap++;
+ a29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2f:	31 d2                	xor    %edx,%edx
+ a31:	e9 67 ff ff ff       	jmp    99d <printf+0x4d>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a45:	83 c0 04             	add    $0x4,%eax
+ a48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a4b:	85 db                	test   %ebx,%ebx
+ a4d:	0f 84 9d 00 00 00    	je     af0 <printf+0x1a0>
+        while(*s != 0){
+ a53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a58:	84 c0                	test   %al,%al
+ a5a:	0f 84 3d ff ff ff    	je     99d <printf+0x4d>
+ a60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a66:	89 de                	mov    %ebx,%esi
+ a68:	89 d3                	mov    %edx,%ebx
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a79:	6a 01                	push   $0x1
+ a7b:	53                   	push   %ebx
+ a7c:	57                   	push   %edi
+ a7d:	e8 51 fc ff ff       	call   6d3 <write>
+        while(*s != 0){
+ a82:	0f b6 06             	movzbl (%esi),%eax
+ a85:	83 c4 10             	add    $0x10,%esp
+ a88:	84 c0                	test   %al,%al
+ a8a:	75 e4                	jne    a70 <printf+0x120>
+      state = 0;
+ a8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a8f:	31 d2                	xor    %edx,%edx
+ a91:	e9 07 ff ff ff       	jmp    99d <printf+0x4d>
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ aa0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ aab:	8b 13                	mov    (%ebx),%edx
+ aad:	6a 01                	push   $0x1
+ aaf:	e9 6b ff ff ff       	jmp    a1f <printf+0xcf>
+ ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ab8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ abb:	83 ec 04             	sub    $0x4,%esp
+ abe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ac1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ac3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ac6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	52                   	push   %edx
+ acc:	57                   	push   %edi
+ acd:	e8 01 fc ff ff       	call   6d3 <write>
+        ap++;
+ ad2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ad5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ad8:	31 d2                	xor    %edx,%edx
+ ada:	e9 be fe ff ff       	jmp    99d <printf+0x4d>
+ adf:	90                   	nop
+  write(fd, &c, 1);
+ ae0:	83 ec 04             	sub    $0x4,%esp
+ ae3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ae6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ae9:	6a 01                	push   $0x1
+ aeb:	e9 11 ff ff ff       	jmp    a01 <printf+0xb1>
+ af0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ af5:	bb 35 10 00 00       	mov    $0x1035,%ebx
+ afa:	e9 61 ff ff ff       	jmp    a60 <printf+0x110>
+ aff:	90                   	nop
+
+00000b00 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b03:	a1 14 35 00 00       	mov    0x3514,%eax
+{
+ b08:	89 e5                	mov    %esp,%ebp
+ b0a:	56                   	push   %esi
+ b0b:	53                   	push   %ebx
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b10:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b12:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b14:	39 ca                	cmp    %ecx,%edx
+ b16:	73 30                	jae    b48 <bigfree+0x48>
+ b18:	39 c1                	cmp    %eax,%ecx
+ b1a:	72 04                	jb     b20 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b1c:	39 c2                	cmp    %eax,%edx
+ b1e:	72 f0                	jb     b10 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b20:	8b 59 04             	mov    0x4(%ecx),%ebx
+ b23:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ b26:	39 f0                	cmp    %esi,%eax
+ b28:	74 26                	je     b50 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b2a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b2c:	8b 42 04             	mov    0x4(%edx),%eax
+ b2f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b32:	39 d9                	cmp    %ebx,%ecx
+ b34:	74 30                	je     b66 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b36:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b38:	5b                   	pop    %ebx
+  freep = p;
+ b39:	89 15 14 35 00 00    	mov    %edx,0x3514
+}
+ b3f:	5e                   	pop    %esi
+ b40:	5d                   	pop    %ebp
+ b41:	c3                   	ret
+ b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b48:	39 c1                	cmp    %eax,%ecx
+ b4a:	72 d0                	jb     b1c <bigfree+0x1c>
+ b4c:	eb c2                	jmp    b10 <bigfree+0x10>
+ b4e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ b50:	03 58 04             	add    0x4(%eax),%ebx
+ b53:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b56:	8b 02                	mov    (%edx),%eax
+ b58:	8b 00                	mov    (%eax),%eax
+ b5a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ b5c:	8b 42 04             	mov    0x4(%edx),%eax
+ b5f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b62:	39 d9                	cmp    %ebx,%ecx
+ b64:	75 d0                	jne    b36 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ b66:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ b69:	89 15 14 35 00 00    	mov    %edx,0x3514
+    p->s.size += bp->s.size;
+ b6f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b72:	8b 09                	mov    (%ecx),%ecx
+ b74:	89 0a                	mov    %ecx,(%edx)
+}
+ b76:	5b                   	pop    %ebx
+ b77:	5e                   	pop    %esi
+ b78:	5d                   	pop    %ebp
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b80 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	89 c7                	mov    %eax,%edi
+ b86:	56                   	push   %esi
+ b87:	53                   	push   %ebx
+ b88:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ b8b:	a1 14 35 00 00       	mov    0x3514,%eax
+ b90:	85 c0                	test   %eax,%eax
+ b92:	0f 84 88 00 00 00    	je     c20 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b98:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b9a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b9d:	39 f9                	cmp    %edi,%ecx
+ b9f:	73 5f                	jae    c00 <bigalloc+0x80>
+  if(nu < 4096)
+ ba1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ba6:	39 df                	cmp    %ebx,%edi
+ ba8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bb2:	eb 0d                	jmp    bc1 <bigalloc+0x41>
+ bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ bba:	8b 4a 04             	mov    0x4(%edx),%ecx
+ bbd:	39 f9                	cmp    %edi,%ecx
+ bbf:	73 3f                	jae    c00 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ bc1:	89 d0                	mov    %edx,%eax
+ bc3:	39 15 14 35 00 00    	cmp    %edx,0x3514
+ bc9:	75 ed                	jne    bb8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ bcb:	83 ec 0c             	sub    $0xc,%esp
+ bce:	56                   	push   %esi
+ bcf:	e8 67 fb ff ff       	call   73b <sbrk>
+  if(p == (char*)-1)
+ bd4:	83 c4 10             	add    $0x10,%esp
+ bd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bda:	74 11                	je     bed <bigalloc+0x6d>
+  hp->s.size = nu;
+ bdc:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ bdf:	e8 1c ff ff ff       	call   b00 <bigfree>
+  return freep;
+ be4:	a1 14 35 00 00       	mov    0x3514,%eax
+      if((p = morecore(nunits)) == 0)
+ be9:	85 c0                	test   %eax,%eax
+ beb:	75 cb                	jne    bb8 <bigalloc+0x38>
+        return 0;
+  }
+}
+ bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bf0:	31 d2                	xor    %edx,%edx
+}
+ bf2:	5b                   	pop    %ebx
+ bf3:	89 d0                	mov    %edx,%eax
+ bf5:	5e                   	pop    %esi
+ bf6:	5f                   	pop    %edi
+ bf7:	5d                   	pop    %ebp
+ bf8:	c3                   	ret
+ bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ c00:	39 cf                	cmp    %ecx,%edi
+ c02:	74 4c                	je     c50 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ c04:	29 f9                	sub    %edi,%ecx
+ c06:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ c09:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ c0c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ c0f:	a3 14 35 00 00       	mov    %eax,0x3514
+}
+ c14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c17:	89 d0                	mov    %edx,%eax
+ c19:	5b                   	pop    %ebx
+ c1a:	5e                   	pop    %esi
+ c1b:	5f                   	pop    %edi
+ c1c:	5d                   	pop    %ebp
+ c1d:	c3                   	ret
+ c1e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ c20:	c7 05 14 35 00 00 18 	movl   $0x3518,0x3514
+ c27:	35 00 00 
+    base.s.size = 0;
+ c2a:	ba 18 35 00 00       	mov    $0x3518,%edx
+    base.s.ptr = freep = prevp = &base;
+ c2f:	c7 05 18 35 00 00 18 	movl   $0x3518,0x3518
+ c36:	35 00 00 
+    base.s.size = 0;
+ c39:	c7 05 1c 35 00 00 00 	movl   $0x0,0x351c
+ c40:	00 00 00 
+    if(p->s.size >= nunits){
+ c43:	e9 59 ff ff ff       	jmp    ba1 <bigalloc+0x21>
+ c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c50:	8b 0a                	mov    (%edx),%ecx
+ c52:	89 08                	mov    %ecx,(%eax)
+ c54:	eb b9                	jmp    c0f <bigalloc+0x8f>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <free>:
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	53                   	push   %ebx
+ c64:	83 ec 04             	sub    $0x4,%esp
+ c67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ c6a:	85 c9                	test   %ecx,%ecx
+ c6c:	74 58                	je     cc6 <free+0x66>
+  bp = (Header*)ap - 1;
+ c6e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c71:	ba 01 00 00 00       	mov    $0x1,%edx
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+ c80:	89 d0                	mov    %edx,%eax
+ c82:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+  while(xchg(&locked, 1) != 0)
+ c89:	85 c0                	test   %eax,%eax
+ c8b:	75 f3                	jne    c80 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ c8d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ c90:	83 fa 40             	cmp    $0x40,%edx
+ c93:	77 3b                	ja     cd0 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ c95:	83 fa 02             	cmp    $0x2,%edx
+ c98:	76 3f                	jbe    cd9 <free+0x79>
+ c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ ca0:	83 c0 01             	add    $0x1,%eax
+ ca3:	39 14 85 c0 10 00 00 	cmp    %edx,0x10c0(,%eax,4)
+ caa:	72 f4                	jb     ca0 <free+0x40>
+    bp->s.ptr = classfree[c];
+ cac:	8b 14 85 e0 34 00 00 	mov    0x34e0(,%eax,4),%edx
+    classfree[c] = bp;
+ cb3:	89 1c 85 e0 34 00 00 	mov    %ebx,0x34e0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ cba:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ cbd:	31 c0                	xor    %eax,%eax
+ cbf:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+}
+ cc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ cc9:	c9                   	leave
+ cca:	c3                   	ret
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+    bigfree(bp);
+ cd0:	89 d8                	mov    %ebx,%eax
+ cd2:	e8 29 fe ff ff       	call   b00 <bigfree>
+ cd7:	eb e4                	jmp    cbd <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ cd9:	31 c0                	xor    %eax,%eax
+ cdb:	eb cf                	jmp    cac <free+0x4c>
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ce0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ce6:	89 e5                	mov    %esp,%ebp
+ ce8:	57                   	push   %edi
+ ce9:	56                   	push   %esi
+ cea:	53                   	push   %ebx
+ ceb:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cee:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf1:	8d 50 07             	lea    0x7(%eax),%edx
+ cf4:	c1 ea 03             	shr    $0x3,%edx
+ cf7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d00:	89 c8                	mov    %ecx,%eax
+ d02:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+ d09:	85 c0                	test   %eax,%eax
+ d0b:	75 f3                	jne    d00 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ d0d:	89 c3                	mov    %eax,%ebx
+ d0f:	83 fa 40             	cmp    $0x40,%edx
+ d12:	77 4c                	ja     d60 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ d14:	be 02 00 00 00       	mov    $0x2,%esi
+ d19:	83 fa 02             	cmp    $0x2,%edx
+ d1c:	76 10                	jbe    d2e <malloc+0x4e>
+ d1e:	66 90                	xchg   %ax,%ax
+ d20:	83 c3 01             	add    $0x1,%ebx
+ d23:	8b 34 9d c0 10 00 00 	mov    0x10c0(,%ebx,4),%esi
+ d2a:	39 d6                	cmp    %edx,%esi
+ d2c:	72 f2                	jb     d20 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ d2e:	8b 14 9d e0 34 00 00 	mov    0x34e0(,%ebx,4),%edx
+ d35:	85 d2                	test   %edx,%edx
+ d37:	74 47                	je     d80 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ d39:	8b 3a                	mov    (%edx),%edi
+ d3b:	89 3c 9d e0 34 00 00 	mov    %edi,0x34e0(,%ebx,4)
+ d42:	31 c0                	xor    %eax,%eax
+ d44:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ d4b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ d4e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ d51:	5b                   	pop    %ebx
+ d52:	5e                   	pop    %esi
+ d53:	5f                   	pop    %edi
+ d54:	5d                   	pop    %ebp
+ d55:	c3                   	ret
+ d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ d60:	89 d0                	mov    %edx,%eax
+ d62:	e8 19 fe ff ff       	call   b80 <bigalloc>
+ d67:	89 c2                	mov    %eax,%edx
+ d69:	89 d8                	mov    %ebx,%eax
+ d6b:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+  return p ? (void*)(p + 1) : 0;
+ d72:	85 d2                	test   %edx,%edx
+ d74:	75 d5                	jne    d4b <malloc+0x6b>
+ d76:	31 c0                	xor    %eax,%eax
+}
+ d78:	83 c4 1c             	add    $0x1c,%esp
+ d7b:	5b                   	pop    %ebx
+ d7c:	5e                   	pop    %esi
+ d7d:	5f                   	pop    %edi
+ d7e:	5d                   	pop    %ebp
+ d7f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ d80:	b8 00 02 00 00       	mov    $0x200,%eax
+ d85:	e8 f6 fd ff ff       	call   b80 <bigalloc>
+ d8a:	85 c0                	test   %eax,%eax
+ d8c:	74 44                	je     dd2 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d8e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ d95:	8b 14 9d e0 34 00 00 	mov    0x34e0(,%ebx,4),%edx
+ d9c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ d9f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ da2:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ da8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ dab:	39 cf                	cmp    %ecx,%edi
+ dad:	72 8a                	jb     d39 <malloc+0x59>
+ daf:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ db2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ db5:	8d 76 00             	lea    0x0(%esi),%esi
+ db8:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ dba:	89 70 04             	mov    %esi,0x4(%eax)
+ dbd:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ dbf:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ dc1:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ dc3:	01 d8                	add    %ebx,%eax
+ dc5:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ dc8:	73 ee                	jae    db8 <malloc+0xd8>
+ dca:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ dcd:	e9 69 ff ff ff       	jmp    d3b <malloc+0x5b>
+ dd2:	f0 87 05 c0 34 00 00 	lock xchg %eax,0x34c0
+  return p ? (void*)(p + 1) : 0;
+ dd9:	31 c0                	xor    %eax,%eax
+ ddb:	eb 9b                	jmp    d78 <malloc+0x98>
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000de0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	56                   	push   %esi
+ de4:	53                   	push   %ebx
+ de5:	8b 45 08             	mov    0x8(%ebp),%eax
+ de8:	f7 65 0c             	mull   0xc(%ebp)
+ deb:	70 33                	jo     e20 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ ded:	83 ec 0c             	sub    $0xc,%esp
+ df0:	89 c3                	mov    %eax,%ebx
+ df2:	50                   	push   %eax
+ df3:	e8 e8 fe ff ff       	call   ce0 <malloc>
+ df8:	83 c4 10             	add    $0x10,%esp
+ dfb:	89 c6                	mov    %eax,%esi
+ dfd:	85 c0                	test   %eax,%eax
+ dff:	74 1f                	je     e20 <calloc+0x40>
+    memset(p, 0, n);
+ e01:	83 ec 04             	sub    $0x4,%esp
+ e04:	53                   	push   %ebx
+ e05:	6a 00                	push   $0x0
+ e07:	50                   	push   %eax
+ e08:	e8 23 f7 ff ff       	call   530 <memset>
+ e0d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ e10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e13:	89 f0                	mov    %esi,%eax
+ e15:	5b                   	pop    %ebx
+ e16:	5e                   	pop    %esi
+ e17:	5d                   	pop    %ebp
+ e18:	c3                   	ret
+ e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ e23:	31 f6                	xor    %esi,%esi
+}
+ e25:	89 f0                	mov    %esi,%eax
+ e27:	5b                   	pop    %ebx
+ e28:	5e                   	pop    %esi
+ e29:	5d                   	pop    %ebp
+ e2a:	c3                   	ret
+ e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e2f:	90                   	nop
+
+00000e30 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ e30:	55                   	push   %ebp
+ e31:	89 e5                	mov    %esp,%ebp
+ e33:	57                   	push   %edi
+ e34:	56                   	push   %esi
+ e35:	53                   	push   %ebx
+ e36:	83 ec 0c             	sub    $0xc,%esp
+ e39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ e3f:	85 db                	test   %ebx,%ebx
+ e41:	74 55                	je     e98 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ e43:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ e46:	89 de                	mov    %ebx,%esi
+ e48:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ e4f:	39 c7                	cmp    %eax,%edi
+ e51:	72 0d                	jb     e60 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e56:	89 f0                	mov    %esi,%eax
+ e58:	5b                   	pop    %ebx
+ e59:	5e                   	pop    %esi
+ e5a:	5f                   	pop    %edi
+ e5b:	5d                   	pop    %ebp
+ e5c:	c3                   	ret
+ e5d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ e60:	83 ec 0c             	sub    $0xc,%esp
+ e63:	50                   	push   %eax
+ e64:	e8 77 fe ff ff       	call   ce0 <malloc>
+ e69:	83 c4 10             	add    $0x10,%esp
+ e6c:	89 c6                	mov    %eax,%esi
+ e6e:	85 c0                	test   %eax,%eax
+ e70:	74 e1                	je     e53 <realloc+0x23>
+  memmove(p, ap, have);
+ e72:	83 ec 04             	sub    $0x4,%esp
+ e75:	57                   	push   %edi
+ e76:	53                   	push   %ebx
+ e77:	50                   	push   %eax
+ e78:	e8 03 f8 ff ff       	call   680 <memmove>
+  free(ap);
+ e7d:	89 1c 24             	mov    %ebx,(%esp)
+ e80:	e8 db fd ff ff       	call   c60 <free>
+  return p;
+ e85:	83 c4 10             	add    $0x10,%esp
+}
+ e88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e8b:	89 f0                	mov    %esi,%eax
+ e8d:	5b                   	pop    %ebx
+ e8e:	5e                   	pop    %esi
+ e8f:	5f                   	pop    %edi
+ e90:	5d                   	pop    %ebp
+ e91:	c3                   	ret
+ e92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ e98:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e9e:	5b                   	pop    %ebx
+ e9f:	5e                   	pop    %esi
+ ea0:	5f                   	pop    %edi
+ ea1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ ea2:	e9 39 fe ff ff       	jmp    ce0 <malloc>
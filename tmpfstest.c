@@ -0,0 +1,101 @@
+// Tests for the in-memory file system mounted on /tmp by init.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "param.h"
+
+char buf[8192];
+
+void
+fail(char *msg)
+{
+  printf(1, "tmpfstest: %s failed\n", msg);
+  exit();
+}
+
+void
+filetest(void)
+{
+  struct stat st;
+  int fd, i, n;
+
+  printf(1, "file test\n");
+  if(stat("/tmp", &st) < 0 || st.type != T_DIR || st.dev != TMPFSDEV)
+    fail("stat /tmp");
+
+  fd = open("/tmp/big", O_CREATE|O_RDWR);
+  if(fd < 0)
+    fail("create");
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i;
+  for(i = 0; i < MAXFILE*BSIZE / sizeof(buf); i++)
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("write");
+  n = MAXFILE*BSIZE - i*sizeof(buf);
+  if(write(fd, buf, n) != n)
+    fail("write to MAXFILE");
+  if(write(fd, buf, 1) >= 0)
+    fail("write past MAXFILE");
+  close(fd);
+
+  fd = open("/tmp/big", O_RDONLY);
+  for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+    if(buf[0] != (char)i || buf[n-1] != (char)(i+n-1))
+      fail("read data");
+  if(i != MAXFILE*BSIZE)
+    fail("read size");
+  close(fd);
+
+  if(unlink("/tmp/big") < 0)
+    fail("unlink");
+  if(open("/tmp/big", O_RDONLY) >= 0)
+    fail("open after unlink");
+  printf(1, "file test ok\n");
+}
+
+void
+dirtest(void)
+{
+  struct stat st;
+  int fd;
+
+  printf(1, "dir test\n");
+  if(mkdir("/tmp/d") < 0 || chdir("/tmp/d") < 0)
+    fail("mkdir");
+  if((fd = open("f", O_CREATE|O_RDWR)) < 0)
+    fail("create in dir");
+  close(fd);
+  if(link("f", "/tmpfstest.f") >= 0)
+    fail("link across file systems");
+
+  // ".." from the tmpfs root leads back to the disk root.
+  if(chdir("../../..") < 0 || stat(".", &st) < 0 ||
+     st.dev != ROOTDEV || st.ino != ROOTINO)
+    fail("..");
+  if(stat("tmp/d/../d/f", &st) < 0 || st.dev != TMPFSDEV)
+    fail("path through mount");
+
+  if((fd = open("/tmp/d/f", O_RDONLY)) < 0)
+    fail("open through mount");
+  if(umount("/tmp") >= 0)
+    fail("umount busy");
+  close(fd);
+  if(unlink("/tmp/d") >= 0)
+    fail("unlink non-empty dir");
+  if(unlink("/tmp/d/f") < 0 || unlink("/tmp/d") < 0)
+    fail("unlink dir");
+  if(unlink("/tmp") >= 0)
+    fail("unlink mount point");
+  printf(1, "dir test ok\n");
+}
+
+int
+main(void)
+{
+  filetest();
+  dirtest();
+  exit();
+}
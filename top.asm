@@ -0,0 +1,2106 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 05 00 00 00       	mov    $0x5,%edi
+  13:	56                   	push   %esi
+  struct cpustats stats, old_stats;
+  int iterations = 0;
+  int max_iterations = 5; // Run for 20 iterations then exit
+  
+  // Get initial stats to avoid divide-by-zero
+  if(getcpustats(&old_stats) < 0) {
+  14:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+  17:	53                   	push   %ebx
+  18:	51                   	push   %ecx
+  19:	83 ec 54             	sub    $0x54,%esp
+  if(getcpustats(&old_stats) < 0) {
+  1c:	50                   	push   %eax
+  1d:	e8 d9 06 00 00       	call   6fb <getcpustats>
+  22:	83 c4 10             	add    $0x10,%esp
+  25:	85 c0                	test   %eax,%eax
+  27:	0f 88 fa 02 00 00    	js     327 <main+0x327>
+  }
+
+  while(iterations < max_iterations) {
+    iterations++;
+    // 1. Clear Screen & Move Cursor to Home
+    printf(1, CLEAR_SCREEN CURSOR_HOME);
+  2d:	83 ec 08             	sub    $0x8,%esp
+  30:	68 39 0e 00 00       	push   $0xe39
+  35:	6a 01                	push   $0x1
+  37:	e8 74 08 00 00       	call   8b0 <printf>
+
+    // 2. Get Data
+    if(getcpustats(&stats) < 0) {
+  3c:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  3f:	89 04 24             	mov    %eax,(%esp)
+  42:	e8 b4 06 00 00       	call   6fb <getcpustats>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	0f 88 fe 02 00 00    	js     350 <main+0x350>
+      printf(2, "top: getcpustats failed\n");
+      break;
+    }
+    int count = getallprocinfo(processes, NPROC);
+  52:	83 ec 08             	sub    $0x8,%esp
+  55:	6a 40                	push   $0x40
+  57:	68 00 2a 00 00       	push   $0x2a00
+  5c:	e8 92 06 00 00       	call   6f3 <getallprocinfo>
+    if(count < 0) {
+  61:	83 c4 10             	add    $0x10,%esp
+    int count = getallprocinfo(processes, NPROC);
+  64:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    if(count < 0) {
+  67:	85 c0                	test   %eax,%eax
+  69:	0f 88 cb 02 00 00    	js     33a <main+0x33a>
+      printf(2, "top: getallprocinfo failed\n");
+      break;
+    }
+
+    // 3. Get current scheduler policy
+    int policy = getscheduler();
+  6f:	e8 9f 06 00 00       	call   713 <getscheduler>
+    const char *policy_names[] = {"Round-Robin", "Priority-Based", "MLFQ"};
+    
+    // 4. Render Header
+    printf(1, "xv6-project-top\n");
+  74:	83 ec 08             	sub    $0x8,%esp
+    const char *policy_names[] = {"Round-Robin", "Priority-Based", "MLFQ"};
+  77:	c7 45 dc 5d 0e 00 00 	movl   $0xe5d,-0x24(%ebp)
+    int policy = getscheduler();
+  7e:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  81:	89 c6                	mov    %eax,%esi
+    const char *policy_names[] = {"Round-Robin", "Priority-Based", "MLFQ"};
+  83:	c7 45 e0 69 0e 00 00 	movl   $0xe69,-0x20(%ebp)
+  8a:	c7 45 e4 78 0e 00 00 	movl   $0xe78,-0x1c(%ebp)
+    printf(1, "xv6-project-top\n");
+  91:	68 7d 0e 00 00       	push   $0xe7d
+  96:	6a 01                	push   $0x1
+  98:	e8 13 08 00 00       	call   8b0 <printf>
+    printf(1, "Scheduler: %s\n", policy_names[policy]);
+  9d:	83 c4 0c             	add    $0xc,%esp
+  a0:	ff 74 b5 dc          	push   -0x24(%ebp,%esi,4)
+  a4:	68 8e 0e 00 00       	push   $0xe8e
+  a9:	6a 01                	push   $0x1
+  ab:	e8 00 08 00 00       	call   8b0 <printf>
+    printf(1, "Total Processes: %d\n", count);
+  b0:	83 c4 0c             	add    $0xc,%esp
+  b3:	ff 75 b4             	push   -0x4c(%ebp)
+  b6:	68 9d 0e 00 00       	push   $0xe9d
+  bb:	6a 01                	push   $0x1
+  bd:	e8 ee 07 00 00       	call   8b0 <printf>
+    printf(1, "Total Ticks: %d\n\n", stats.total_ticks);
+  c2:	83 c4 0c             	add    $0xc,%esp
+  c5:	ff 75 cc             	push   -0x34(%ebp)
+  c8:	68 b2 0e 00 00       	push   $0xeb2
+  cd:	6a 01                	push   $0x1
+  cf:	e8 dc 07 00 00       	call   8b0 <printf>
+    
+    // Display appropriate column headers based on scheduler
+    if(policy == 2) { // MLFQ
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	83 fe 02             	cmp    $0x2,%esi
+  da:	0f 84 31 02 00 00    	je     311 <main+0x311>
+      printf(1, "PID\tSTATE\t\tMLFQ\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
+    } else if(policy == 1) { // PBS
+  e0:	83 7d b8 01          	cmpl   $0x1,-0x48(%ebp)
+  e4:	0f 84 10 02 00 00    	je     2fa <main+0x2fa>
+      printf(1, "PID\tSTATE\t\tPRI\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
+    } else { // RR
+      printf(1, "PID\tSTATE\t\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
+  ea:	83 ec 08             	sub    $0x8,%esp
+  ed:	68 b4 0f 00 00       	push   $0xfb4
+  f2:	6a 01                	push   $0x1
+  f4:	e8 b7 07 00 00       	call   8b0 <printf>
+  f9:	83 c4 10             	add    $0x10,%esp
+    }
+    printf(1, "----------------------------------------------------------------------------------------\n");
+  fc:	83 ec 08             	sub    $0x8,%esp
+  ff:	be 0c 2a 00 00       	mov    $0x2a0c,%esi
+ 104:	68 e8 0f 00 00       	push   $0xfe8
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 a0 07 00 00       	call   8b0 <printf>
+
+    // 5. Render Process List
+    for(int i = 0; i < count; i++){
+ 110:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 113:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 11a:	83 c4 10             	add    $0x10,%esp
+ 11d:	85 c0                	test   %eax,%eax
+ 11f:	0f 84 ff 00 00 00    	je     224 <main+0x224>
+ 125:	89 7d b0             	mov    %edi,-0x50(%ebp)
+ 128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+      // Highlight RUNNING processes in green
+      if(processes[i].state == RUNNING)
+ 130:	8b 4e fc             	mov    -0x4(%esi),%ecx
+ 133:	83 f9 04             	cmp    $0x4,%ecx
+ 136:	0f 84 a4 01 00 00    	je     2e0 <main+0x2e0>
+        printf(1, COLOR_GREEN);
+
+      // Display appropriate columns based on scheduler
+      // Calculate uptime safely (handle wraparound)
+      int uptime_secs = 0;
+      if(stats.total_ticks >= processes[i].start_time) {
+ 13c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 13f:	8b 5e 18             	mov    0x18(%esi),%ebx
+      int uptime_secs = 0;
+ 142:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+      if(stats.total_ticks >= processes[i].start_time) {
+ 149:	39 d8                	cmp    %ebx,%eax
+ 14b:	72 0f                	jb     15c <main+0x15c>
+        uptime_secs = (stats.total_ticks - processes[i].start_time) / 100;
+ 14d:	29 d8                	sub    %ebx,%eax
+ 14f:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+ 154:	f7 e2                	mul    %edx
+ 156:	c1 ea 05             	shr    $0x5,%edx
+ 159:	89 55 c0             	mov    %edx,-0x40(%ebp)
+  for(int i = 0; i < old_count; i++)
+ 15c:	8b 3d e0 14 00 00    	mov    0x14e0,%edi
+        csw -= op->nvcsw + op->nivcsw;
+        blkio -= op->nblkread + op->nblkwrite;
+      }
+      
+      if(policy == 2) { // MLFQ - show MLFQ level
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 162:	8b 56 f4             	mov    -0xc(%esi),%edx
+  for(int i = 0; i < old_count; i++)
+ 165:	85 ff                	test   %edi,%edi
+ 167:	0f 8e 03 01 00 00    	jle    270 <main+0x270>
+ 16d:	31 db                	xor    %ebx,%ebx
+ 16f:	eb 12                	jmp    183 <main+0x183>
+ 171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 178:	83 c3 01             	add    $0x1,%ebx
+ 17b:	39 fb                	cmp    %edi,%ebx
+ 17d:	0f 84 ed 00 00 00    	je     270 <main+0x270>
+    if(old_processes[i].pid == p->pid)
+ 183:	6b c3 54             	imul   $0x54,%ebx,%eax
+ 186:	39 90 00 15 00 00    	cmp    %edx,0x1500(%eax)
+ 18c:	75 ea                	jne    178 <main+0x178>
+        sysc -= op->nsyscall;
+ 18e:	8b 5e 28             	mov    0x28(%esi),%ebx
+ 191:	2b 98 34 15 00 00    	sub    0x1534(%eax),%ebx
+        blkio -= op->nblkread + op->nblkwrite;
+ 197:	8b 7e 30             	mov    0x30(%esi),%edi
+ 19a:	03 7e 2c             	add    0x2c(%esi),%edi
+        sysc -= op->nsyscall;
+ 19d:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+        blkio -= op->nblkread + op->nblkwrite;
+ 1a0:	2b b8 38 15 00 00    	sub    0x1538(%eax),%edi
+        csw -= op->nvcsw + op->nivcsw;
+ 1a6:	8b 5e 24             	mov    0x24(%esi),%ebx
+        blkio -= op->nblkread + op->nblkwrite;
+ 1a9:	2b b8 3c 15 00 00    	sub    0x153c(%eax),%edi
+        csw -= op->nvcsw + op->nivcsw;
+ 1af:	03 5e 20             	add    0x20(%esi),%ebx
+ 1b2:	2b 98 2c 15 00 00    	sub    0x152c(%eax),%ebx
+ 1b8:	2b 98 30 15 00 00    	sub    0x1530(%eax),%ebx
+        blkio -= op->nblkread + op->nblkwrite;
+ 1be:	89 f8                	mov    %edi,%eax
+      if(policy == 2) { // MLFQ - show MLFQ level
+ 1c0:	83 7d b8 02          	cmpl   $0x2,-0x48(%ebp)
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 1c4:	8b 7e 1c             	mov    0x1c(%esi),%edi
+  return states[state];
+ 1c7:	8b 0c 8d 44 10 00 00 	mov    0x1044(,%ecx,4),%ecx
+      if(policy == 2) { // MLFQ - show MLFQ level
+ 1ce:	0f 84 c2 00 00 00    	je     296 <main+0x296>
+          processes[i].cpu_ticks,
+          uptime_secs,
+          sysc, csw, blkio,
+          processes[i].name
+        );
+      } else if(policy == 1) { // PBS - show priority
+ 1d4:	83 7d b8 01          	cmpl   $0x1,-0x48(%ebp)
+ 1d8:	0f 84 d2 00 00 00    	je     2b0 <main+0x2b0>
+          uptime_secs,
+          sysc, csw, blkio,
+          processes[i].name
+        );
+      } else { // RR - no priority or MLFQ
+        printf(1, "%d\t%s\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 1de:	83 ec 08             	sub    $0x8,%esp
+ 1e1:	56                   	push   %esi
+ 1e2:	50                   	push   %eax
+ 1e3:	53                   	push   %ebx
+ 1e4:	ff 75 bc             	push   -0x44(%ebp)
+ 1e7:	ff 75 c0             	push   -0x40(%ebp)
+ 1ea:	57                   	push   %edi
+ 1eb:	51                   	push   %ecx
+ 1ec:	52                   	push   %edx
+ 1ed:	68 e8 0e 00 00       	push   $0xee8
+ 1f2:	6a 01                	push   $0x1
+ 1f4:	e8 b7 06 00 00       	call   8b0 <printf>
+ 1f9:	83 c4 30             	add    $0x30,%esp
+          sysc, csw, blkio,
+          processes[i].name
+        );
+      }
+      
+      printf(1, COLOR_RESET); // Reset color after each line
+ 1fc:	83 ec 08             	sub    $0x8,%esp
+    for(int i = 0; i < count; i++){
+ 1ff:	83 c6 54             	add    $0x54,%esi
+      printf(1, COLOR_RESET); // Reset color after each line
+ 202:	68 03 0f 00 00       	push   $0xf03
+ 207:	6a 01                	push   $0x1
+ 209:	e8 a2 06 00 00       	call   8b0 <printf>
+    for(int i = 0; i < count; i++){
+ 20e:	83 45 c4 01          	addl   $0x1,-0x3c(%ebp)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 218:	39 45 b4             	cmp    %eax,-0x4c(%ebp)
+ 21b:	0f 85 0f ff ff ff    	jne    130 <main+0x130>
+ 221:	8b 7d b0             	mov    -0x50(%ebp),%edi
+    }
+    
+    // 6. Save current stats for next delta calculation
+    old_stats = stats;
+ 224:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    memmove(old_processes, processes, count * sizeof(processes[0]));
+ 227:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 22a:	83 ec 04             	sub    $0x4,%esp
+    old_stats = stats;
+ 22d:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 230:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    memmove(old_processes, processes, count * sizeof(processes[0]));
+ 233:	6b c6 54             	imul   $0x54,%esi,%eax
+    old_stats = stats;
+ 236:	89 55 d8             	mov    %edx,-0x28(%ebp)
+    memmove(old_processes, processes, count * sizeof(processes[0]));
+ 239:	50                   	push   %eax
+ 23a:	68 00 2a 00 00       	push   $0x2a00
+ 23f:	68 00 15 00 00       	push   $0x1500
+ 244:	e8 97 03 00 00       	call   5e0 <memmove>
+    old_count = count;
+
+    // 7. Sleep for 1 second (100 ticks in xv6)
+    sleep(100);
+ 249:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+    old_count = count;
+ 250:	89 35 e0 14 00 00    	mov    %esi,0x14e0
+    sleep(100);
+ 256:	e8 48 04 00 00       	call   6a3 <sleep>
+  while(iterations < max_iterations) {
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	83 ef 01             	sub    $0x1,%edi
+ 261:	0f 85 c6 fd ff ff    	jne    2d <main+0x2d>
+  }
+
+  exit();
+ 267:	e8 a7 03 00 00       	call   613 <exit>
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      int sysc = p->nsyscall;
+ 270:	8b 46 28             	mov    0x28(%esi),%eax
+      int csw = p->nvcsw + p->nivcsw;
+ 273:	8b 5e 24             	mov    0x24(%esi),%ebx
+ 276:	03 5e 20             	add    0x20(%esi),%ebx
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 279:	8b 7e 1c             	mov    0x1c(%esi),%edi
+      int sysc = p->nsyscall;
+ 27c:	89 45 bc             	mov    %eax,-0x44(%ebp)
+      int blkio = p->nblkread + p->nblkwrite;
+ 27f:	8b 46 30             	mov    0x30(%esi),%eax
+ 282:	03 46 2c             	add    0x2c(%esi),%eax
+      if(policy == 2) { // MLFQ - show MLFQ level
+ 285:	83 7d b8 02          	cmpl   $0x2,-0x48(%ebp)
+  return states[state];
+ 289:	8b 0c 8d 44 10 00 00 	mov    0x1044(,%ecx,4),%ecx
+      if(policy == 2) { // MLFQ - show MLFQ level
+ 290:	0f 85 3e ff ff ff    	jne    1d4 <main+0x1d4>
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	56                   	push   %esi
+ 29a:	50                   	push   %eax
+ 29b:	53                   	push   %ebx
+ 29c:	ff 75 bc             	push   -0x44(%ebp)
+ 29f:	ff 75 c0             	push   -0x40(%ebp)
+ 2a2:	57                   	push   %edi
+ 2a3:	ff 76 14             	push   0x14(%esi)
+ 2a6:	eb 18                	jmp    2c0 <main+0x2c0>
+ 2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	56                   	push   %esi
+ 2b4:	50                   	push   %eax
+ 2b5:	53                   	push   %ebx
+ 2b6:	ff 75 bc             	push   -0x44(%ebp)
+ 2b9:	ff 75 c0             	push   -0x40(%ebp)
+ 2bc:	57                   	push   %edi
+ 2bd:	ff 76 10             	push   0x10(%esi)
+ 2c0:	51                   	push   %ecx
+ 2c1:	52                   	push   %edx
+ 2c2:	68 ca 0e 00 00       	push   $0xeca
+ 2c7:	6a 01                	push   $0x1
+ 2c9:	e8 e2 05 00 00       	call   8b0 <printf>
+ 2ce:	83 c4 30             	add    $0x30,%esp
+ 2d1:	e9 26 ff ff ff       	jmp    1fc <main+0x1fc>
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printf(1, COLOR_GREEN);
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 c4 0e 00 00       	push   $0xec4
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 c1 05 00 00       	call   8b0 <printf>
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
+ 2ef:	8b 4e fc             	mov    -0x4(%esi),%ecx
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	e9 42 fe ff ff       	jmp    13c <main+0x13c>
+      printf(1, "PID\tSTATE\t\tPRI\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
+ 2fa:	83 ec 08             	sub    $0x8,%esp
+ 2fd:	68 7c 0f 00 00       	push   $0xf7c
+ 302:	6a 01                	push   $0x1
+ 304:	e8 a7 05 00 00       	call   8b0 <printf>
+ 309:	83 c4 10             	add    $0x10,%esp
+ 30c:	e9 eb fd ff ff       	jmp    fc <main+0xfc>
+      printf(1, "PID\tSTATE\t\tMLFQ\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
+ 311:	52                   	push   %edx
+ 312:	52                   	push   %edx
+ 313:	68 40 0f 00 00       	push   $0xf40
+ 318:	6a 01                	push   $0x1
+ 31a:	e8 91 05 00 00       	call   8b0 <printf>
+ 31f:	83 c4 10             	add    $0x10,%esp
+ 322:	e9 d5 fd ff ff       	jmp    fc <main+0xfc>
+    printf(2, "top: getcpustats failed\n");
+ 327:	56                   	push   %esi
+ 328:	56                   	push   %esi
+ 329:	68 20 0e 00 00       	push   $0xe20
+ 32e:	6a 02                	push   $0x2
+ 330:	e8 7b 05 00 00       	call   8b0 <printf>
+    exit();
+ 335:	e8 d9 02 00 00       	call   613 <exit>
+      printf(2, "top: getallprocinfo failed\n");
+ 33a:	51                   	push   %ecx
+ 33b:	51                   	push   %ecx
+ 33c:	68 41 0e 00 00       	push   $0xe41
+ 341:	6a 02                	push   $0x2
+ 343:	e8 68 05 00 00       	call   8b0 <printf>
+      break;
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	e9 17 ff ff ff       	jmp    267 <main+0x267>
+      printf(2, "top: getcpustats failed\n");
+ 350:	53                   	push   %ebx
+ 351:	53                   	push   %ebx
+ 352:	68 20 0e 00 00       	push   $0xe20
+ 357:	6a 02                	push   $0x2
+ 359:	e8 52 05 00 00       	call   8b0 <printf>
+      break;
+ 35e:	83 c4 10             	add    $0x10,%esp
+ 361:	e9 01 ff ff ff       	jmp    267 <main+0x267>
+ 366:	66 90                	xchg   %ax,%ax
+ 368:	66 90                	xchg   %ax,%ax
+ 36a:	66 90                	xchg   %ax,%ax
+ 36c:	66 90                	xchg   %ax,%ax
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <get_state_str_top>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+  return states[state];
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 376:	5d                   	pop    %ebp
+  return states[state];
+ 377:	8b 04 85 44 10 00 00 	mov    0x1044(,%eax,4),%eax
+}
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+
+00000380 <find_old>:
+  for(int i = 0; i < old_count; i++)
+ 380:	8b 0d e0 14 00 00    	mov    0x14e0,%ecx
+ 386:	85 c9                	test   %ecx,%ecx
+ 388:	7e 3d                	jle    3c7 <find_old+0x47>
+{
+ 38a:	55                   	push   %ebp
+  for(int i = 0; i < old_count; i++)
+ 38b:	31 d2                	xor    %edx,%edx
+{
+ 38d:	89 e5                	mov    %esp,%ebp
+ 38f:	53                   	push   %ebx
+    if(old_processes[i].pid == p->pid)
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	8b 18                	mov    (%eax),%ebx
+ 395:	eb 10                	jmp    3a7 <find_old+0x27>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+  for(int i = 0; i < old_count; i++)
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	39 ca                	cmp    %ecx,%edx
+ 3a5:	74 19                	je     3c0 <find_old+0x40>
+    if(old_processes[i].pid == p->pid)
+ 3a7:	6b c2 54             	imul   $0x54,%edx,%eax
+ 3aa:	39 98 00 15 00 00    	cmp    %ebx,0x1500(%eax)
+ 3b0:	75 ee                	jne    3a0 <find_old+0x20>
+}
+ 3b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return &old_processes[i];
+ 3b5:	05 00 15 00 00       	add    $0x1500,%eax
+}
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+ 3c3:	31 c0                	xor    %eax,%eax
+}
+ 3c5:	c9                   	leave
+ 3c6:	c3                   	ret
+  return 0;
+ 3c7:	31 c0                	xor    %eax,%eax
+}
+ 3c9:	c3                   	ret
+ 3ca:	66 90                	xchg   %ax,%ax
+ 3cc:	66 90                	xchg   %ax,%ax
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3d1:	31 c0                	xor    %eax,%eax
+{
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	53                   	push   %ebx
+ 3d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3e7:	83 c0 01             	add    $0x1,%eax
+ 3ea:	84 d2                	test   %dl,%dl
+ 3ec:	75 f2                	jne    3e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f1:	89 c8                	mov    %ecx,%eax
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+ 3f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+ 407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 40a:	0f b6 02             	movzbl (%edx),%eax
+ 40d:	84 c0                	test   %al,%al
+ 40f:	75 17                	jne    428 <strcmp+0x28>
+ 411:	eb 3a                	jmp    44d <strcmp+0x4d>
+ 413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 417:	90                   	nop
+ 418:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 41c:	83 c2 01             	add    $0x1,%edx
+ 41f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 422:	84 c0                	test   %al,%al
+ 424:	74 1a                	je     440 <strcmp+0x40>
+    p++, q++;
+ 426:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 428:	0f b6 19             	movzbl (%ecx),%ebx
+ 42b:	38 c3                	cmp    %al,%bl
+ 42d:	74 e9                	je     418 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 42f:	29 d8                	sub    %ebx,%eax
+}
+ 431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 434:	c9                   	leave
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 440:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 444:	31 c0                	xor    %eax,%eax
+ 446:	29 d8                	sub    %ebx,%eax
+}
+ 448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 44d:	0f b6 19             	movzbl (%ecx),%ebx
+ 450:	31 c0                	xor    %eax,%eax
+ 452:	eb db                	jmp    42f <strcmp+0x2f>
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 466:	80 3a 00             	cmpb   $0x0,(%edx)
+ 469:	74 15                	je     480 <strlen+0x20>
+ 46b:	31 c0                	xor    %eax,%eax
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+ 470:	83 c0 01             	add    $0x1,%eax
+ 473:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 477:	89 c1                	mov    %eax,%ecx
+ 479:	75 f5                	jne    470 <strlen+0x10>
+    ;
+  return n;
+}
+ 47b:	89 c8                	mov    %ecx,%eax
+ 47d:	5d                   	pop    %ebp
+ 47e:	c3                   	ret
+ 47f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 480:	31 c9                	xor    %ecx,%ecx
+}
+ 482:	5d                   	pop    %ebp
+ 483:	89 c8                	mov    %ecx,%eax
+ 485:	c3                   	ret
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000490 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 497:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	89 d7                	mov    %edx,%edi
+ 49f:	fc                   	cld
+ 4a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4a5:	89 d0                	mov    %edx,%eax
+ 4a7:	c9                   	leave
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ba:	0f b6 10             	movzbl (%eax),%edx
+ 4bd:	84 d2                	test   %dl,%dl
+ 4bf:	75 12                	jne    4d3 <strchr+0x23>
+ 4c1:	eb 1d                	jmp    4e0 <strchr+0x30>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4cc:	83 c0 01             	add    $0x1,%eax
+ 4cf:	84 d2                	test   %dl,%dl
+ 4d1:	74 0d                	je     4e0 <strchr+0x30>
+    if(*s == c)
+ 4d3:	38 d1                	cmp    %dl,%cl
+ 4d5:	75 f1                	jne    4c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4d7:	5d                   	pop    %ebp
+ 4d8:	c3                   	ret
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4e0:	31 c0                	xor    %eax,%eax
+}
+ 4e2:	5d                   	pop    %ebp
+ 4e3:	c3                   	ret
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4f9:	31 db                	xor    %ebx,%ebx
+{
+ 4fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4fe:	eb 27                	jmp    527 <gets+0x37>
+    cc = read(0, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	6a 01                	push   $0x1
+ 505:	56                   	push   %esi
+ 506:	6a 00                	push   $0x0
+ 508:	e8 1e 01 00 00       	call   62b <read>
+    if(cc < 1)
+ 50d:	83 c4 10             	add    $0x10,%esp
+ 510:	85 c0                	test   %eax,%eax
+ 512:	7e 1d                	jle    531 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 514:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 51f:	3c 0a                	cmp    $0xa,%al
+ 521:	74 10                	je     533 <gets+0x43>
+ 523:	3c 0d                	cmp    $0xd,%al
+ 525:	74 0c                	je     533 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 527:	89 df                	mov    %ebx,%edi
+ 529:	83 c3 01             	add    $0x1,%ebx
+ 52c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 52f:	7c cf                	jl     500 <gets+0x10>
+ 531:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 53a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53d:	5b                   	pop    %ebx
+ 53e:	5e                   	pop    %esi
+ 53f:	5f                   	pop    %edi
+ 540:	5d                   	pop    %ebp
+ 541:	c3                   	ret
+ 542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	56                   	push   %esi
+ 554:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 555:	83 ec 08             	sub    $0x8,%esp
+ 558:	6a 00                	push   $0x0
+ 55a:	ff 75 08             	push   0x8(%ebp)
+ 55d:	e8 f1 00 00 00       	call   653 <open>
+  if(fd < 0)
+ 562:	83 c4 10             	add    $0x10,%esp
+ 565:	85 c0                	test   %eax,%eax
+ 567:	78 27                	js     590 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 569:	83 ec 08             	sub    $0x8,%esp
+ 56c:	ff 75 0c             	push   0xc(%ebp)
+ 56f:	89 c3                	mov    %eax,%ebx
+ 571:	50                   	push   %eax
+ 572:	e8 f4 00 00 00       	call   66b <fstat>
+  close(fd);
+ 577:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 57a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 57c:	e8 ba 00 00 00       	call   63b <close>
+  return r;
+ 581:	83 c4 10             	add    $0x10,%esp
+}
+ 584:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 587:	89 f0                	mov    %esi,%eax
+ 589:	5b                   	pop    %ebx
+ 58a:	5e                   	pop    %esi
+ 58b:	5d                   	pop    %ebp
+ 58c:	c3                   	ret
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 590:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 595:	eb ed                	jmp    584 <stat+0x34>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	53                   	push   %ebx
+ 5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5a7:	0f be 02             	movsbl (%edx),%eax
+ 5aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5b5:	77 1e                	ja     5d5 <atoi+0x35>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5c0:	83 c2 01             	add    $0x1,%edx
+ 5c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ca:	0f be 02             	movsbl (%edx),%eax
+ 5cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5d0:	80 fb 09             	cmp    $0x9,%bl
+ 5d3:	76 eb                	jbe    5c0 <atoi+0x20>
+  return n;
+}
+ 5d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5d8:	89 c8                	mov    %ecx,%eax
+ 5da:	c9                   	leave
+ 5db:	c3                   	ret
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5ee:	85 c0                	test   %eax,%eax
+ 5f0:	7e 13                	jle    605 <memmove+0x25>
+ 5f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5f4:	89 d7                	mov    %edx,%edi
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 600:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 601:	39 f8                	cmp    %edi,%eax
+ 603:	75 fb                	jne    600 <memmove+0x20>
+  return vdst;
+}
+ 605:	5e                   	pop    %esi
+ 606:	89 d0                	mov    %edx,%eax
+ 608:	5f                   	pop    %edi
+ 609:	5d                   	pop    %ebp
+ 60a:	c3                   	ret
+
+0000060b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 60b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <exit>:
+SYSCALL(exit)
+ 613:	b8 02 00 00 00       	mov    $0x2,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <wait>:
+SYSCALL(wait)
+ 61b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <pipe>:
+SYSCALL(pipe)
+ 623:	b8 04 00 00 00       	mov    $0x4,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <read>:
+SYSCALL(read)
+ 62b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <write>:
+SYSCALL(write)
+ 633:	b8 10 00 00 00       	mov    $0x10,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <close>:
+SYSCALL(close)
+ 63b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <kill>:
+SYSCALL(kill)
+ 643:	b8 06 00 00 00       	mov    $0x6,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <exec>:
+SYSCALL(exec)
+ 64b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <open>:
+SYSCALL(open)
+ 653:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mknod>:
+SYSCALL(mknod)
+ 65b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <unlink>:
+SYSCALL(unlink)
+ 663:	b8 12 00 00 00       	mov    $0x12,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <fstat>:
+SYSCALL(fstat)
+ 66b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <link>:
+SYSCALL(link)
+ 673:	b8 13 00 00 00       	mov    $0x13,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <mkdir>:
+SYSCALL(mkdir)
+ 67b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <chdir>:
+SYSCALL(chdir)
+ 683:	b8 09 00 00 00       	mov    $0x9,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <dup>:
+SYSCALL(dup)
+ 68b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getpid>:
+SYSCALL(getpid)
+ 693:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <sbrk>:
+SYSCALL(sbrk)
+ 69b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <sleep>:
+SYSCALL(sleep)
+ 6a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <uptime>:
+SYSCALL(uptime)
+ 6ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 6b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 6bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 6c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 6cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 6d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 6db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 6e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <setpriority>:
+SYSCALL(setpriority)
+ 6eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 6f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <getcpustats>:
+SYSCALL(getcpustats)
+ 6fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <setscheduler>:
+SYSCALL(setscheduler)
+ 703:	b8 20 00 00 00       	mov    $0x20,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 70b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <getscheduler>:
+SYSCALL(getscheduler)
+ 713:	b8 22 00 00 00       	mov    $0x22,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <splice>:
+SYSCALL(splice)
+ 71b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <readv>:
+SYSCALL(readv)
+ 723:	b8 24 00 00 00       	mov    $0x24,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <writev>:
+SYSCALL(writev)
+ 72b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <pread>:
+SYSCALL(pread)
+ 733:	b8 26 00 00 00       	mov    $0x26,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <pwrite>:
+SYSCALL(pwrite)
+ 73b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <getlogstat>:
+SYSCALL(getlogstat)
+ 743:	b8 28 00 00 00       	mov    $0x28,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <mount>:
+SYSCALL(mount)
+ 74b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <umount>:
+SYSCALL(umount)
+ 753:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <mmap>:
+SYSCALL(mmap)
+ 75b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <munmap>:
+SYSCALL(munmap)
+ 763:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <membench>:
+SYSCALL(membench)
+ 76b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getlockstat>:
+SYSCALL(getlockstat)
+ 773:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <lockbench>:
+SYSCALL(lockbench)
+ 77b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <prof>:
+SYSCALL(prof)
+ 783:	b8 30 00 00 00       	mov    $0x30,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <tracectl>:
+SYSCALL(tracectl)
+ 78b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <traceread>:
+SYSCALL(traceread)
+ 793:	b8 32 00 00 00       	mov    $0x32,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <getsysstat>:
+SYSCALL(getsysstat)
+ 79b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 7a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <getschedwait>:
+SYSCALL(getschedwait)
+ 7ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 7b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <dllock>:
+SYSCALL(dllock)
+ 7bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 7c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 7cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <clone>:
+SYSCALL(clone)
+ 7d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <join>:
+SYSCALL(join)
+ 7db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <futex>:
+SYSCALL(futex)
+ 7e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <shmat>:
+SYSCALL(shmat)
+ 7eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <shmdt>:
+SYSCALL(shmdt)
+ 7f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <poll>:
+SYSCALL(poll)
+ 7fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+ 803:	66 90                	xchg   %ax,%ax
+ 805:	66 90                	xchg   %ax,%ax
+ 807:	66 90                	xchg   %ax,%ax
+ 809:	66 90                	xchg   %ax,%ax
+ 80b:	66 90                	xchg   %ax,%ax
+ 80d:	66 90                	xchg   %ax,%ax
+ 80f:	90                   	nop
+
+00000810 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 818:	89 d1                	mov    %edx,%ecx
+{
+ 81a:	83 ec 3c             	sub    $0x3c,%esp
+ 81d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 820:	85 d2                	test   %edx,%edx
+ 822:	0f 89 80 00 00 00    	jns    8a8 <printint+0x98>
+ 828:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 82c:	74 7a                	je     8a8 <printint+0x98>
+    x = -xx;
+ 82e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 830:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 835:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 838:	31 f6                	xor    %esi,%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 840:	89 c8                	mov    %ecx,%eax
+ 842:	31 d2                	xor    %edx,%edx
+ 844:	89 f7                	mov    %esi,%edi
+ 846:	f7 f3                	div    %ebx
+ 848:	8d 76 01             	lea    0x1(%esi),%esi
+ 84b:	0f b6 92 bc 10 00 00 	movzbl 0x10bc(%edx),%edx
+ 852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 856:	89 ca                	mov    %ecx,%edx
+ 858:	89 c1                	mov    %eax,%ecx
+ 85a:	39 da                	cmp    %ebx,%edx
+ 85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+ 85e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 861:	85 c0                	test   %eax,%eax
+ 863:	74 07                	je     86c <printint+0x5c>
+    buf[i++] = '-';
+ 865:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 86a:	89 f7                	mov    %esi,%edi
+ 86c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 86f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 872:	01 df                	add    %ebx,%edi
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 878:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 881:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 884:	6a 01                	push   $0x1
+ 886:	50                   	push   %eax
+ 887:	56                   	push   %esi
+ 888:	e8 a6 fd ff ff       	call   633 <write>
+  while(--i >= 0)
+ 88d:	89 f8                	mov    %edi,%eax
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	83 ef 01             	sub    $0x1,%edi
+ 895:	39 d8                	cmp    %ebx,%eax
+ 897:	75 df                	jne    878 <printint+0x68>
+}
+ 899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89c:	5b                   	pop    %ebx
+ 89d:	5e                   	pop    %esi
+ 89e:	5f                   	pop    %edi
+ 89f:	5d                   	pop    %ebp
+ 8a0:	c3                   	ret
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8a8:	31 c0                	xor    %eax,%eax
+ 8aa:	eb 89                	jmp    835 <printint+0x25>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c2:	83 c6 01             	add    $0x1,%esi
+ 8c5:	84 db                	test   %bl,%bl
+ 8c7:	74 67                	je     930 <printf+0x80>
+ 8c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8cc:	31 d2                	xor    %edx,%edx
+ 8ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8d1:	eb 34                	jmp    907 <printf+0x57>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8e0:	83 f8 25             	cmp    $0x25,%eax
+ 8e3:	74 18                	je     8fd <printf+0x4d>
+  write(fd, &c, 1);
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ee:	6a 01                	push   $0x1
+ 8f0:	50                   	push   %eax
+ 8f1:	57                   	push   %edi
+ 8f2:	e8 3c fd ff ff       	call   633 <write>
+ 8f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 900:	83 c6 01             	add    $0x1,%esi
+ 903:	84 db                	test   %bl,%bl
+ 905:	74 29                	je     930 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 907:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 90a:	85 d2                	test   %edx,%edx
+ 90c:	74 ca                	je     8d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 90e:	83 fa 25             	cmp    $0x25,%edx
+ 911:	75 ea                	jne    8fd <printf+0x4d>
+      if(c == 'd'){
+ 913:	83 f8 25             	cmp    $0x25,%eax
+ 916:	0f 84 24 01 00 00    	je     a40 <printf+0x190>
+ 91c:	83 e8 63             	sub    $0x63,%eax
+ 91f:	83 f8 15             	cmp    $0x15,%eax
+ 922:	77 1c                	ja     940 <printf+0x90>
+ 924:	ff 24 85 64 10 00 00 	jmp    *0x1064(,%eax,4)
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 933:	5b                   	pop    %ebx
+ 934:	5e                   	pop    %esi
+ 935:	5f                   	pop    %edi
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 946:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 94a:	6a 01                	push   $0x1
+ 94c:	52                   	push   %edx
+ 94d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 950:	57                   	push   %edi
+ 951:	e8 dd fc ff ff       	call   633 <write>
+ 956:	83 c4 0c             	add    $0xc,%esp
+ 959:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95c:	6a 01                	push   $0x1
+ 95e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 961:	52                   	push   %edx
+ 962:	57                   	push   %edi
+ 963:	e8 cb fc ff ff       	call   633 <write>
+        putc(fd, c);
+ 968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96b:	31 d2                	xor    %edx,%edx
+ 96d:	eb 8e                	jmp    8fd <printf+0x4d>
+ 96f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 00                	push   $0x0
+ 97f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 981:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 984:	e8 87 fe ff ff       	call   810 <printint>
+        ap++;
+ 989:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 67 ff ff ff       	jmp    8fd <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9ab:	85 db                	test   %ebx,%ebx
+ 9ad:	0f 84 9d 00 00 00    	je     a50 <printf+0x1a0>
+        while(*s != 0){
+ 9b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	0f 84 3d ff ff ff    	je     8fd <printf+0x4d>
+ 9c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	89 d3                	mov    %edx,%ebx
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9d9:	6a 01                	push   $0x1
+ 9db:	53                   	push   %ebx
+ 9dc:	57                   	push   %edi
+ 9dd:	e8 51 fc ff ff       	call   633 <write>
+        while(*s != 0){
+ 9e2:	0f b6 06             	movzbl (%esi),%eax
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	75 e4                	jne    9d0 <printf+0x120>
+      state = 0;
+ 9ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 07 ff ff ff       	jmp    8fd <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	e9 6b ff ff ff       	jmp    97f <printf+0xcf>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	52                   	push   %edx
+ a2c:	57                   	push   %edi
+ a2d:	e8 01 fc ff ff       	call   633 <write>
+        ap++;
+ a32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a38:	31 d2                	xor    %edx,%edx
+ a3a:	e9 be fe ff ff       	jmp    8fd <printf+0x4d>
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a49:	6a 01                	push   $0x1
+ a4b:	e9 11 ff ff ff       	jmp    961 <printf+0xb1>
+ a50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a55:	bb 5c 10 00 00       	mov    $0x105c,%ebx
+ a5a:	e9 61 ff ff ff       	jmp    9c0 <printf+0x110>
+ a5f:	90                   	nop
+
+00000a60 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a63:	a1 54 3f 00 00       	mov    0x3f54,%eax
+{
+ a68:	89 e5                	mov    %esp,%ebp
+ a6a:	56                   	push   %esi
+ a6b:	53                   	push   %ebx
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a70:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a72:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a74:	39 ca                	cmp    %ecx,%edx
+ a76:	73 30                	jae    aa8 <bigfree+0x48>
+ a78:	39 c1                	cmp    %eax,%ecx
+ a7a:	72 04                	jb     a80 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7c:	39 c2                	cmp    %eax,%edx
+ a7e:	72 f0                	jb     a70 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a80:	8b 59 04             	mov    0x4(%ecx),%ebx
+ a83:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ a86:	39 f0                	cmp    %esi,%eax
+ a88:	74 26                	je     ab0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a8a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a8c:	8b 42 04             	mov    0x4(%edx),%eax
+ a8f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a92:	39 d9                	cmp    %ebx,%ecx
+ a94:	74 30                	je     ac6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a96:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a98:	5b                   	pop    %ebx
+  freep = p;
+ a99:	89 15 54 3f 00 00    	mov    %edx,0x3f54
+}
+ a9f:	5e                   	pop    %esi
+ aa0:	5d                   	pop    %ebp
+ aa1:	c3                   	ret
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa8:	39 c1                	cmp    %eax,%ecx
+ aaa:	72 d0                	jb     a7c <bigfree+0x1c>
+ aac:	eb c2                	jmp    a70 <bigfree+0x10>
+ aae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ ab0:	03 58 04             	add    0x4(%eax),%ebx
+ ab3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab6:	8b 02                	mov    (%edx),%eax
+ ab8:	8b 00                	mov    (%eax),%eax
+ aba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ abc:	8b 42 04             	mov    0x4(%edx),%eax
+ abf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ ac2:	39 d9                	cmp    %ebx,%ecx
+ ac4:	75 d0                	jne    a96 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ ac6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ ac9:	89 15 54 3f 00 00    	mov    %edx,0x3f54
+    p->s.size += bp->s.size;
+ acf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ad2:	8b 09                	mov    (%ecx),%ecx
+ ad4:	89 0a                	mov    %ecx,(%edx)
+}
+ ad6:	5b                   	pop    %ebx
+ ad7:	5e                   	pop    %esi
+ ad8:	5d                   	pop    %ebp
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ae0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	89 c7                	mov    %eax,%edi
+ ae6:	56                   	push   %esi
+ ae7:	53                   	push   %ebx
+ ae8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ aeb:	a1 54 3f 00 00       	mov    0x3f54,%eax
+ af0:	85 c0                	test   %eax,%eax
+ af2:	0f 84 88 00 00 00    	je     b80 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ afa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ afd:	39 f9                	cmp    %edi,%ecx
+ aff:	73 5f                	jae    b60 <bigalloc+0x80>
+  if(nu < 4096)
+ b01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b06:	39 df                	cmp    %ebx,%edi
+ b08:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b0b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b12:	eb 0d                	jmp    b21 <bigalloc+0x41>
+ b14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b1d:	39 f9                	cmp    %edi,%ecx
+ b1f:	73 3f                	jae    b60 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b21:	89 d0                	mov    %edx,%eax
+ b23:	39 15 54 3f 00 00    	cmp    %edx,0x3f54
+ b29:	75 ed                	jne    b18 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b2b:	83 ec 0c             	sub    $0xc,%esp
+ b2e:	56                   	push   %esi
+ b2f:	e8 67 fb ff ff       	call   69b <sbrk>
+  if(p == (char*)-1)
+ b34:	83 c4 10             	add    $0x10,%esp
+ b37:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b3a:	74 11                	je     b4d <bigalloc+0x6d>
+  hp->s.size = nu;
+ b3c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ b3f:	e8 1c ff ff ff       	call   a60 <bigfree>
+  return freep;
+ b44:	a1 54 3f 00 00       	mov    0x3f54,%eax
+      if((p = morecore(nunits)) == 0)
+ b49:	85 c0                	test   %eax,%eax
+ b4b:	75 cb                	jne    b18 <bigalloc+0x38>
+        return 0;
+  }
+}
+ b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b50:	31 d2                	xor    %edx,%edx
+}
+ b52:	5b                   	pop    %ebx
+ b53:	89 d0                	mov    %edx,%eax
+ b55:	5e                   	pop    %esi
+ b56:	5f                   	pop    %edi
+ b57:	5d                   	pop    %ebp
+ b58:	c3                   	ret
+ b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b60:	39 cf                	cmp    %ecx,%edi
+ b62:	74 4c                	je     bb0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ b64:	29 f9                	sub    %edi,%ecx
+ b66:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b69:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b6c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b6f:	a3 54 3f 00 00       	mov    %eax,0x3f54
+}
+ b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b77:	89 d0                	mov    %edx,%eax
+ b79:	5b                   	pop    %ebx
+ b7a:	5e                   	pop    %esi
+ b7b:	5f                   	pop    %edi
+ b7c:	5d                   	pop    %ebp
+ b7d:	c3                   	ret
+ b7e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ b80:	c7 05 54 3f 00 00 58 	movl   $0x3f58,0x3f54
+ b87:	3f 00 00 
+    base.s.size = 0;
+ b8a:	ba 58 3f 00 00       	mov    $0x3f58,%edx
+    base.s.ptr = freep = prevp = &base;
+ b8f:	c7 05 58 3f 00 00 58 	movl   $0x3f58,0x3f58
+ b96:	3f 00 00 
+    base.s.size = 0;
+ b99:	c7 05 5c 3f 00 00 00 	movl   $0x0,0x3f5c
+ ba0:	00 00 00 
+    if(p->s.size >= nunits){
+ ba3:	e9 59 ff ff ff       	jmp    b01 <bigalloc+0x21>
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bb0:	8b 0a                	mov    (%edx),%ecx
+ bb2:	89 08                	mov    %ecx,(%eax)
+ bb4:	eb b9                	jmp    b6f <bigalloc+0x8f>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <free>:
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	53                   	push   %ebx
+ bc4:	83 ec 04             	sub    $0x4,%esp
+ bc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ bca:	85 c9                	test   %ecx,%ecx
+ bcc:	74 58                	je     c26 <free+0x66>
+  bp = (Header*)ap - 1;
+ bce:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ bd1:	ba 01 00 00 00       	mov    $0x1,%edx
+ bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+ be0:	89 d0                	mov    %edx,%eax
+ be2:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+  while(xchg(&locked, 1) != 0)
+ be9:	85 c0                	test   %eax,%eax
+ beb:	75 f3                	jne    be0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ bed:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ bf0:	83 fa 40             	cmp    $0x40,%edx
+ bf3:	77 3b                	ja     c30 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ bf5:	83 fa 02             	cmp    $0x2,%edx
+ bf8:	76 3f                	jbe    c39 <free+0x79>
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c00:	83 c0 01             	add    $0x1,%eax
+ c03:	39 14 85 e0 10 00 00 	cmp    %edx,0x10e0(,%eax,4)
+ c0a:	72 f4                	jb     c00 <free+0x40>
+    bp->s.ptr = classfree[c];
+ c0c:	8b 14 85 20 3f 00 00 	mov    0x3f20(,%eax,4),%edx
+    classfree[c] = bp;
+ c13:	89 1c 85 20 3f 00 00 	mov    %ebx,0x3f20(,%eax,4)
+    bp->s.ptr = classfree[c];
+ c1a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ c1d:	31 c0                	xor    %eax,%eax
+ c1f:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+}
+ c26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c29:	c9                   	leave
+ c2a:	c3                   	ret
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+    bigfree(bp);
+ c30:	89 d8                	mov    %ebx,%eax
+ c32:	e8 29 fe ff ff       	call   a60 <bigfree>
+ c37:	eb e4                	jmp    c1d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ c39:	31 c0                	xor    %eax,%eax
+ c3b:	eb cf                	jmp    c0c <free+0x4c>
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c40 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c40:	55                   	push   %ebp
+ c41:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c46:	89 e5                	mov    %esp,%ebp
+ c48:	57                   	push   %edi
+ c49:	56                   	push   %esi
+ c4a:	53                   	push   %ebx
+ c4b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c51:	8d 50 07             	lea    0x7(%eax),%edx
+ c54:	c1 ea 03             	shr    $0x3,%edx
+ c57:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c60:	89 c8                	mov    %ecx,%eax
+ c62:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+ c69:	85 c0                	test   %eax,%eax
+ c6b:	75 f3                	jne    c60 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ c6d:	89 c3                	mov    %eax,%ebx
+ c6f:	83 fa 40             	cmp    $0x40,%edx
+ c72:	77 4c                	ja     cc0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ c74:	be 02 00 00 00       	mov    $0x2,%esi
+ c79:	83 fa 02             	cmp    $0x2,%edx
+ c7c:	76 10                	jbe    c8e <malloc+0x4e>
+ c7e:	66 90                	xchg   %ax,%ax
+ c80:	83 c3 01             	add    $0x1,%ebx
+ c83:	8b 34 9d e0 10 00 00 	mov    0x10e0(,%ebx,4),%esi
+ c8a:	39 d6                	cmp    %edx,%esi
+ c8c:	72 f2                	jb     c80 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ c8e:	8b 14 9d 20 3f 00 00 	mov    0x3f20(,%ebx,4),%edx
+ c95:	85 d2                	test   %edx,%edx
+ c97:	74 47                	je     ce0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ c99:	8b 3a                	mov    (%edx),%edi
+ c9b:	89 3c 9d 20 3f 00 00 	mov    %edi,0x3f20(,%ebx,4)
+ ca2:	31 c0                	xor    %eax,%eax
+ ca4:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ cab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ cae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ cb1:	5b                   	pop    %ebx
+ cb2:	5e                   	pop    %esi
+ cb3:	5f                   	pop    %edi
+ cb4:	5d                   	pop    %ebp
+ cb5:	c3                   	ret
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ cc0:	89 d0                	mov    %edx,%eax
+ cc2:	e8 19 fe ff ff       	call   ae0 <bigalloc>
+ cc7:	89 c2                	mov    %eax,%edx
+ cc9:	89 d8                	mov    %ebx,%eax
+ ccb:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+  return p ? (void*)(p + 1) : 0;
+ cd2:	85 d2                	test   %edx,%edx
+ cd4:	75 d5                	jne    cab <malloc+0x6b>
+ cd6:	31 c0                	xor    %eax,%eax
+}
+ cd8:	83 c4 1c             	add    $0x1c,%esp
+ cdb:	5b                   	pop    %ebx
+ cdc:	5e                   	pop    %esi
+ cdd:	5f                   	pop    %edi
+ cde:	5d                   	pop    %ebp
+ cdf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ ce0:	b8 00 02 00 00       	mov    $0x200,%eax
+ ce5:	e8 f6 fd ff ff       	call   ae0 <bigalloc>
+ cea:	85 c0                	test   %eax,%eax
+ cec:	74 44                	je     d32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ cee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ cf5:	8b 14 9d 20 3f 00 00 	mov    0x3f20(,%ebx,4),%edx
+ cfc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ cff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ d02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ d08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ d0b:	39 cf                	cmp    %ecx,%edi
+ d0d:	72 8a                	jb     c99 <malloc+0x59>
+ d0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ d12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ d15:	8d 76 00             	lea    0x0(%esi),%esi
+ d18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ d1a:	89 70 04             	mov    %esi,0x4(%eax)
+ d1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ d21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ d23:	01 d8                	add    %ebx,%eax
+ d25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ d28:	73 ee                	jae    d18 <malloc+0xd8>
+ d2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ d2d:	e9 69 ff ff ff       	jmp    c9b <malloc+0x5b>
+ d32:	f0 87 05 00 3f 00 00 	lock xchg %eax,0x3f00
+  return p ? (void*)(p + 1) : 0;
+ d39:	31 c0                	xor    %eax,%eax
+ d3b:	eb 9b                	jmp    cd8 <malloc+0x98>
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	56                   	push   %esi
+ d44:	53                   	push   %ebx
+ d45:	8b 45 08             	mov    0x8(%ebp),%eax
+ d48:	f7 65 0c             	mull   0xc(%ebp)
+ d4b:	70 33                	jo     d80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ d4d:	83 ec 0c             	sub    $0xc,%esp
+ d50:	89 c3                	mov    %eax,%ebx
+ d52:	50                   	push   %eax
+ d53:	e8 e8 fe ff ff       	call   c40 <malloc>
+ d58:	83 c4 10             	add    $0x10,%esp
+ d5b:	89 c6                	mov    %eax,%esi
+ d5d:	85 c0                	test   %eax,%eax
+ d5f:	74 1f                	je     d80 <calloc+0x40>
+    memset(p, 0, n);
+ d61:	83 ec 04             	sub    $0x4,%esp
+ d64:	53                   	push   %ebx
+ d65:	6a 00                	push   $0x0
+ d67:	50                   	push   %eax
+ d68:	e8 23 f7 ff ff       	call   490 <memset>
+ d6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d73:	89 f0                	mov    %esi,%eax
+ d75:	5b                   	pop    %ebx
+ d76:	5e                   	pop    %esi
+ d77:	5d                   	pop    %ebp
+ d78:	c3                   	ret
+ d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ d83:	31 f6                	xor    %esi,%esi
+}
+ d85:	89 f0                	mov    %esi,%eax
+ d87:	5b                   	pop    %ebx
+ d88:	5e                   	pop    %esi
+ d89:	5d                   	pop    %ebp
+ d8a:	c3                   	ret
+ d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+
+00000d90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	57                   	push   %edi
+ d94:	56                   	push   %esi
+ d95:	53                   	push   %ebx
+ d96:	83 ec 0c             	sub    $0xc,%esp
+ d99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d9f:	85 db                	test   %ebx,%ebx
+ da1:	74 55                	je     df8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ da3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ da6:	89 de                	mov    %ebx,%esi
+ da8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ daf:	39 c7                	cmp    %eax,%edi
+ db1:	72 0d                	jb     dc0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ db6:	89 f0                	mov    %esi,%eax
+ db8:	5b                   	pop    %ebx
+ db9:	5e                   	pop    %esi
+ dba:	5f                   	pop    %edi
+ dbb:	5d                   	pop    %ebp
+ dbc:	c3                   	ret
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ dc0:	83 ec 0c             	sub    $0xc,%esp
+ dc3:	50                   	push   %eax
+ dc4:	e8 77 fe ff ff       	call   c40 <malloc>
+ dc9:	83 c4 10             	add    $0x10,%esp
+ dcc:	89 c6                	mov    %eax,%esi
+ dce:	85 c0                	test   %eax,%eax
+ dd0:	74 e1                	je     db3 <realloc+0x23>
+  memmove(p, ap, have);
+ dd2:	83 ec 04             	sub    $0x4,%esp
+ dd5:	57                   	push   %edi
+ dd6:	53                   	push   %ebx
+ dd7:	50                   	push   %eax
+ dd8:	e8 03 f8 ff ff       	call   5e0 <memmove>
+  free(ap);
+ ddd:	89 1c 24             	mov    %ebx,(%esp)
+ de0:	e8 db fd ff ff       	call   bc0 <free>
+  return p;
+ de5:	83 c4 10             	add    $0x10,%esp
+}
+ de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ deb:	89 f0                	mov    %esi,%eax
+ ded:	5b                   	pop    %ebx
+ dee:	5e                   	pop    %esi
+ def:	5f                   	pop    %edi
+ df0:	5d                   	pop    %ebp
+ df1:	c3                   	ret
+ df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ df8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dfe:	5b                   	pop    %ebx
+ dff:	5e                   	pop    %esi
+ e00:	5f                   	pop    %edi
+ e01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ e02:	e9 39 fe ff ff       	jmp    c40 <malloc>
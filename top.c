@@ -24,10 +24,24 @@ get_state_str_top(enum procstate state)
   return states[state];
 }
 
+// This refresh's and the last refresh's process tables.
+// Too big for the one-page user stack.
+struct procinfo processes[NPROC], old_processes[NPROC];
+int old_count;
+
+// Return p's entry in the last refresh's table, or 0 if p is new.
+struct procinfo*
+find_old(struct procinfo *p)
+{
+  for(int i = 0; i < old_count; i++)
+    if(old_processes[i].pid == p->pid)
+      return &old_processes[i];
+  return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
-  struct procinfo processes[NPROC];
   struct cpustats stats, old_stats;
   int iterations = 0;
   int max_iterations = 5; // Run for 20 iterations then exit
@@ -66,13 +80,13 @@ main(int argc, char *argv[])
     
     // Display appropriate column headers based on scheduler
     if(policy == 2) { // MLFQ
-      printf(1, "PID\tSTATE\t\tMLFQ\tCPU_TICKS\tUPTIME(s)\tNAME\n");
+      printf(1, "PID\tSTATE\t\tMLFQ\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
     } else if(policy == 1) { // PBS
-      printf(1, "PID\tSTATE\t\tPRI\tCPU_TICKS\tUPTIME(s)\tNAME\n");
+      printf(1, "PID\tSTATE\t\tPRI\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
     } else { // RR
-      printf(1, "PID\tSTATE\t\tCPU_TICKS\tUPTIME(s)\tNAME\n");
+      printf(1, "PID\tSTATE\t\tCPU_TICKS\tUPTIME(s)\tSYSC\tCSW\tBLKIO\tNAME\n");
     }
-    printf(1, "----------------------------------------------------------------\n");
+    printf(1, "----------------------------------------------------------------------------------------\n");
 
     // 5. Render Process List
     for(int i = 0; i < count; i++){
@@ -86,31 +100,46 @@ main(int argc, char *argv[])
       if(stats.total_ticks >= processes[i].start_time) {
         uptime_secs = (stats.total_ticks - processes[i].start_time) / 100;
       }
+
+      // System calls, context switches and disk blocks since
+      // the last refresh, to pick out the busy processes.
+      struct procinfo *p = &processes[i], *op = find_old(p);
+      int sysc = p->nsyscall;
+      int csw = p->nvcsw + p->nivcsw;
+      int blkio = p->nblkread + p->nblkwrite;
+      if(op) {
+        sysc -= op->nsyscall;
+        csw -= op->nvcsw + op->nivcsw;
+        blkio -= op->nblkread + op->nblkwrite;
+      }
       
       if(policy == 2) { // MLFQ - show MLFQ level
-        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%s\n",
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
           processes[i].pid,
           get_state_str_top(processes[i].state),
           processes[i].mlfq_level,
           processes[i].cpu_ticks,
           uptime_secs,
+          sysc, csw, blkio,
           processes[i].name
         );
       } else if(policy == 1) { // PBS - show priority
-        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%s\n",
+        printf(1, "%d\t%s\t%d\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
           processes[i].pid,
           get_state_str_top(processes[i].state),
           processes[i].priority,
           processes[i].cpu_ticks,
           uptime_secs,
+          sysc, csw, blkio,
           processes[i].name
         );
       } else { // RR - no priority or MLFQ
-        printf(1, "%d\t%s\t%d\t\t%d\t\t%s\n",
+        printf(1, "%d\t%s\t%d\t\t%d\t\t%d\t%d\t%d\t%s\n",
           processes[i].pid,
           get_state_str_top(processes[i].state),
           processes[i].cpu_ticks,
           uptime_secs,
+          sysc, csw, blkio,
           processes[i].name
         );
       }
@@ -120,6 +149,8 @@ main(int argc, char *argv[])
     
     // 6. Save current stats for next delta calculation
     old_stats = stats;
+    memmove(old_processes, processes, count * sizeof(processes[0]));
+    old_count = count;
 
     // 7. Sleep for 1 second (100 ticks in xv6)
     sleep(100);
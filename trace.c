@@ -0,0 +1,127 @@
+// Kernel event tracing.
+//
+// ktrace() records a typed, time-stamped event in the current
+// CPU's ring, if the event's class is enabled. Each ring has a
+// single writer, its CPU, which holds interrupts off while it
+// fills in an event, and a single reader, traceread(), which runs
+// under trace.lock; as in prof.c, the writer alone advances head
+// and the reader alone advances tail, so recording takes no lock.
+// Events that find the ring full are dropped and counted.
+//
+// With no class enabled, ktrace() costs a load and a test.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "trace.h"
+
+struct tracering {
+  struct traceevent e[NTRACE];
+  uint head;      // next slot to fill
+  uint tail;      // next slot to read
+  uint dropped;   // events lost because the ring was full
+} __attribute__((aligned(64)));
+
+static struct {
+  struct spinlock lock;
+  struct tracering ring[NCPU];
+} trace;
+
+// Enabled event classes.
+static int tracemask;
+
+static uchar tclass[NTRACETYPE] = {
+[TE_SWITCHIN]   TC_SCHED,
+[TE_SWITCHOUT]  TC_SCHED,
+[TE_WAKEUP]     TC_SCHED,
+[TE_SYSENTER]   TC_SYSCALL,
+[TE_SYSEXIT]    TC_SYSCALL,
+[TE_DISKSTART]  TC_DISK,
+[TE_DISKDONE]   TC_DISK,
+[TE_COMMIT]     TC_LOG,
+[TE_PGFAULT]    TC_FAULT,
+};
+
+void
+traceinit(void)
+{
+  initlock(&trace.lock, "trace");
+}
+
+// Record an event of the given type.
+void
+ktrace(int type, uint a0, uint a1)
+{
+  struct tracering *r;
+  struct traceevent *e;
+  struct proc *p;
+
+  if((tracemask & tclass[type]) == 0)
+    return;
+  pushcli();
+  r = &trace.ring[cpuid()];
+  if(r->head - r->tail == NTRACE){
+    r->dropped++;
+    popcli();
+    return;
+  }
+  e = &r->e[r->head % NTRACE];
+  p = myproc();
+  e->tsc = rdtsc();
+  e->type = type;
+  e->cpu = cpuid();
+  e->pid = p ? p->pid : 0;
+  e->a0 = a0;
+  e->a1 = a1;
+  // The event must be complete before the reader can see it.
+  __sync_synchronize();
+  r->head++;
+  popcli();
+}
+
+// Enable the event classes in mask, and disable the rest.
+// Turning tracing on from off discards old events.
+// Returns the number of events dropped since the last call.
+int
+tracectl(int mask)
+{
+  struct tracering *r;
+  int dropped;
+
+  acquire(&trace.lock);
+  dropped = 0;
+  for(r = trace.ring; r < &trace.ring[ncpu]; r++){
+    if(tracemask == 0)
+      r->tail = r->head;
+    dropped += r->dropped;
+    r->dropped = 0;
+  }
+  tracemask = mask;
+  release(&trace.lock);
+  return dropped;
+}
+
+// Copy up to n events, oldest first on each CPU, into dst.
+// Returns the number copied.
+int
+traceread(struct traceevent *dst, int n)
+{
+  struct tracering *r;
+  int i;
+
+  i = 0;
+  acquire(&trace.lock);
+  for(r = trace.ring; r < &trace.ring[ncpu]; r++){
+    while(i < n && r->tail != *(volatile uint*)&r->head){
+      dst[i++] = r->e[r->tail % NTRACE];
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  release(&trace.lock);
+  return i;
+}
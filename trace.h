@@ -0,0 +1,29 @@
+// Kernel trace events, read with traceread().
+// Both the kernel and user programs use this header file.
+
+struct traceevent {
+  uint64 tsc;     // Time stamp counter
+  ushort type;    // TE_ below
+  uchar cpu;      // CPU the event happened on
+  int pid;        // Process running, 0 if none
+  uint a0, a1;    // Arguments, depending on type
+};
+
+// Event types
+#define TE_SWITCHIN   1  // a0 = pid now running
+#define TE_SWITCHOUT  2  // a0 = state the process leaves in
+#define TE_WAKEUP     3  // a0 = pid made runnable
+#define TE_SYSENTER   4  // a0 = system call number
+#define TE_SYSEXIT    5  // a0 = system call number, a1 = return value
+#define TE_DISKSTART  6  // a0 = block number, a1 = 1 for a write
+#define TE_DISKDONE   7  // a0 = block number, a1 = 1 for a write
+#define TE_COMMIT     8  // a0 = blocks in the log transaction
+#define TE_PGFAULT    9  // a0 = faulting address, a1 = 1 for a write
+#define NTRACETYPE   10
+
+// Event classes, enabled with tracectl()
+#define TC_SCHED    0x01  // switches and wakeups
+#define TC_SYSCALL  0x02  // system call entry and exit
+#define TC_DISK     0x04  // disk requests
+#define TC_LOG      0x08  // log commits
+#define TC_FAULT    0x10  // page faults
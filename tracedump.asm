@@ -0,0 +1,2168 @@
+
+_tracedump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  14:	8b 41 04             	mov    0x4(%ecx),%eax
+  17:	8b 19                	mov    (%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct traceevent *ev, t;
+  int i, j, n, mask, dropped, pid;
+
+  mask = TC_SCHED|TC_SYSCALL|TC_DISK|TC_LOG|TC_FAULT;
+  i = 1;
+  if(i + 1 < argc && strcmp(argv[i], "-c") == 0){
+  1c:	83 fb 02             	cmp    $0x2,%ebx
+  1f:	7f 27                	jg     48 <main+0x48>
+  21:	31 c0                	xor    %eax,%eax
+  mask = TC_SCHED|TC_SYSCALL|TC_DISK|TC_LOG|TC_FAULT;
+  23:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  i = 1;
+  28:	be 01 00 00 00       	mov    $0x1,%esi
+    mask = classes(argv[i+1]);
+    i += 2;
+  }
+  if(i >= argc || mask <= 0){
+  2d:	39 de                	cmp    %ebx,%esi
+  2f:	7d 04                	jge    35 <main+0x35>
+  31:	84 c0                	test   %al,%al
+  33:	74 37                	je     6c <main+0x6c>
+    printf(2, "usage: tracedump [-c scdlf] command args...\n");
+  35:	56                   	push   %esi
+  36:	56                   	push   %esi
+  37:	68 e8 10 00 00       	push   $0x10e8
+  3c:	6a 02                	push   $0x2
+  3e:	e8 6d 09 00 00       	call   9b0 <printf>
+    exit();
+  43:	e8 cb 06 00 00       	call   713 <exit>
+  if(i + 1 < argc && strcmp(argv[i], "-c") == 0){
+  48:	57                   	push   %edi
+  49:	57                   	push   %edi
+  4a:	68 59 10 00 00       	push   $0x1059
+  4f:	ff 70 04             	push   0x4(%eax)
+  52:	e8 a9 04 00 00       	call   500 <strcmp>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	85 c0                	test   %eax,%eax
+  5c:	0f 84 ec 01 00 00    	je     24e <main+0x24e>
+  mask = TC_SCHED|TC_SYSCALL|TC_DISK|TC_LOG|TC_FAULT;
+  62:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  i = 1;
+  67:	be 01 00 00 00       	mov    $0x1,%esi
+  }
+  if((ev = malloc(MAXEV * sizeof(*ev))) == 0){
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  6f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  72:	68 00 00 03 00       	push   $0x30000
+  77:	e8 c4 0c 00 00       	call   d40 <malloc>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  82:	85 c0                	test   %eax,%eax
+  84:	89 c7                	mov    %eax,%edi
+  86:	0f 84 79 01 00 00    	je     205 <main+0x205>
+    printf(2, "tracedump: out of memory\n");
+    exit();
+  }
+
+  tracectl(mask);
+  8c:	83 ec 0c             	sub    $0xc,%esp
+  8f:	52                   	push   %edx
+  90:	e8 f6 07 00 00       	call   88b <tracectl>
+  pid = fork();
+  95:	e8 71 06 00 00       	call   70b <fork>
+  if(pid < 0)
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	85 c0                	test   %eax,%eax
+  9f:	0f 88 d3 01 00 00    	js     278 <main+0x278>
+    printf(2, "tracedump: fork failed\n");
+  else if(pid == 0){
+  a5:	0f 84 6d 01 00 00    	je     218 <main+0x218>
+    exec(argv[i], argv+i);
+    printf(2, "tracedump: exec %s failed\n", argv[i]);
+    exit();
+  } else
+    wait();
+  ab:	e8 6b 06 00 00       	call   71b <wait>
+  dropped = tracectl(0);
+  b0:	83 ec 0c             	sub    $0xc,%esp
+
+  for(n = 0; n < MAXEV && (j = traceread(ev + n, MAXEV - n)) > 0; n += j)
+  b3:	31 f6                	xor    %esi,%esi
+  b5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  dropped = tracectl(0);
+  ba:	6a 00                	push   $0x0
+  bc:	e8 ca 07 00 00       	call   88b <tracectl>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(n = 0; n < MAXEV && (j = traceread(ev + n, MAXEV - n)) > 0; n += j)
+  c7:	eb 15                	jmp    de <main+0xde>
+  c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  d0:	01 c6                	add    %eax,%esi
+  d2:	81 fe ff 1f 00 00    	cmp    $0x1fff,%esi
+  d8:	0f 8f 92 01 00 00    	jg     270 <main+0x270>
+  de:	89 d8                	mov    %ebx,%eax
+  e0:	83 ec 08             	sub    $0x8,%esp
+  e3:	29 f0                	sub    %esi,%eax
+  e5:	50                   	push   %eax
+  e6:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  e9:	8d 04 c7             	lea    (%edi,%eax,8),%eax
+  ec:	50                   	push   %eax
+  ed:	e8 a1 07 00 00       	call   893 <traceread>
+  f2:	83 c4 10             	add    $0x10,%esp
+  f5:	85 c0                	test   %eax,%eax
+  f7:	7f d7                	jg     d0 <main+0xd0>
+  f9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    ;
+
+  // Sort the CPUs' events into one time line.
+  for(i = 1; i < n; i++){
+  fc:	83 ee 01             	sub    $0x1,%esi
+  ff:	0f 8e 89 01 00 00    	jle    28e <main+0x28e>
+  for(n = 0; n < MAXEV && (j = traceread(ev + n, MAXEV - n)) > 0; n += j)
+ 105:	b8 01 00 00 00       	mov    $0x1,%eax
+ 10a:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+ 10d:	8d 77 18             	lea    0x18(%edi),%esi
+ 110:	89 c7                	mov    %eax,%edi
+ 112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    t = ev[i];
+ 118:	0f b7 46 08          	movzwl 0x8(%esi),%eax
+ 11c:	8b 1e                	mov    (%esi),%ebx
+ 11e:	89 75 c8             	mov    %esi,-0x38(%ebp)
+ 121:	8b 4e 04             	mov    0x4(%esi),%ecx
+ 124:	89 7d cc             	mov    %edi,-0x34(%ebp)
+ 127:	66 89 45 de          	mov    %ax,-0x22(%ebp)
+ 12b:	0f b6 46 0a          	movzbl 0xa(%esi),%eax
+ 12f:	88 45 e0             	mov    %al,-0x20(%ebp)
+ 132:	8b 46 0c             	mov    0xc(%esi),%eax
+ 135:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 138:	8b 46 10             	mov    0x10(%esi),%eax
+ 13b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 13e:	8b 46 14             	mov    0x14(%esi),%eax
+ 141:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 144:	89 f0                	mov    %esi,%eax
+ 146:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ 149:	eb 33                	jmp    17e <main+0x17e>
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+    for(j = i; j > 0 && ev[j-1].tsc > t.tsc; j--)
+      ev[j] = ev[j-1];
+ 150:	8b 78 e8             	mov    -0x18(%eax),%edi
+ 153:	89 38                	mov    %edi,(%eax)
+ 155:	8b 78 ec             	mov    -0x14(%eax),%edi
+ 158:	89 78 04             	mov    %edi,0x4(%eax)
+ 15b:	8b 78 f0             	mov    -0x10(%eax),%edi
+ 15e:	89 78 08             	mov    %edi,0x8(%eax)
+ 161:	8b 78 f4             	mov    -0xc(%eax),%edi
+ 164:	89 78 0c             	mov    %edi,0xc(%eax)
+ 167:	8b 78 f8             	mov    -0x8(%eax),%edi
+ 16a:	89 78 10             	mov    %edi,0x10(%eax)
+ 16d:	8b 78 fc             	mov    -0x4(%eax),%edi
+ 170:	89 78 14             	mov    %edi,0x14(%eax)
+    for(j = i; j > 0 && ev[j-1].tsc > t.tsc; j--)
+ 173:	8d 42 e8             	lea    -0x18(%edx),%eax
+ 176:	39 c6                	cmp    %eax,%esi
+ 178:	0f 84 c2 00 00 00    	je     240 <main+0x240>
+ 17e:	3b 58 e8             	cmp    -0x18(%eax),%ebx
+ 181:	89 cf                	mov    %ecx,%edi
+ 183:	1b 78 ec             	sbb    -0x14(%eax),%edi
+ 186:	89 c2                	mov    %eax,%edx
+ 188:	72 c6                	jb     150 <main+0x150>
+ 18a:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 18d:	8b 75 c8             	mov    -0x38(%ebp),%esi
+    ev[j] = t;
+ 190:	0f b7 45 de          	movzwl -0x22(%ebp),%eax
+  for(i = 1; i < n; i++){
+ 194:	83 c7 01             	add    $0x1,%edi
+    ev[j] = t;
+ 197:	89 1a                	mov    %ebx,(%edx)
+  for(i = 1; i < n; i++){
+ 199:	83 c6 18             	add    $0x18,%esi
+    ev[j] = t;
+ 19c:	89 4a 04             	mov    %ecx,0x4(%edx)
+ 19f:	66 89 42 08          	mov    %ax,0x8(%edx)
+ 1a3:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+ 1a7:	88 42 0a             	mov    %al,0xa(%edx)
+ 1aa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1ad:	89 42 0c             	mov    %eax,0xc(%edx)
+ 1b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 1b3:	89 42 10             	mov    %eax,0x10(%edx)
+ 1b6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1b9:	89 42 14             	mov    %eax,0x14(%edx)
+  for(i = 1; i < n; i++){
+ 1bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1bf:	39 c7                	cmp    %eax,%edi
+ 1c1:	0f 85 51 ff ff ff    	jne    118 <main+0x118>
+ 1c7:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 1ca:	89 fe                	mov    %edi,%esi
+  }
+
+  for(i = 0; i < n; i++)
+ 1cc:	31 db                	xor    %ebx,%ebx
+ 1ce:	66 90                	xchg   %ax,%ax
+    print(&ev[i], ev[0].tsc);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	ff 77 04             	push   0x4(%edi)
+  for(i = 0; i < n; i++)
+ 1d6:	83 c3 01             	add    $0x1,%ebx
+    print(&ev[i], ev[0].tsc);
+ 1d9:	ff 37                	push   (%edi)
+ 1db:	56                   	push   %esi
+  for(i = 0; i < n; i++)
+ 1dc:	83 c6 18             	add    $0x18,%esi
+    print(&ev[i], ev[0].tsc);
+ 1df:	e8 2c 01 00 00       	call   310 <print>
+  for(i = 0; i < n; i++)
+ 1e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1e7:	83 c4 10             	add    $0x10,%esp
+ 1ea:	39 c3                	cmp    %eax,%ebx
+ 1ec:	75 e2                	jne    1d0 <main+0x1d0>
+  printf(1, "%d events, %d dropped\n", n, dropped);
+ 1ee:	ff 75 c0             	push   -0x40(%ebp)
+ 1f1:	ff 75 e4             	push   -0x1c(%ebp)
+ 1f4:	68 a9 10 00 00       	push   $0x10a9
+ 1f9:	6a 01                	push   $0x1
+ 1fb:	e8 b0 07 00 00       	call   9b0 <printf>
+  exit();
+ 200:	e8 0e 05 00 00       	call   713 <exit>
+    printf(2, "tracedump: out of memory\n");
+ 205:	53                   	push   %ebx
+ 206:	53                   	push   %ebx
+ 207:	68 5c 10 00 00       	push   $0x105c
+ 20c:	6a 02                	push   $0x2
+ 20e:	e8 9d 07 00 00       	call   9b0 <printf>
+    exit();
+ 213:	e8 fb 04 00 00       	call   713 <exit>
+    exec(argv[i], argv+i);
+ 218:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 21b:	52                   	push   %edx
+ 21c:	52                   	push   %edx
+ 21d:	8d 1c b0             	lea    (%eax,%esi,4),%ebx
+ 220:	53                   	push   %ebx
+ 221:	ff 33                	push   (%ebx)
+ 223:	e8 23 05 00 00       	call   74b <exec>
+    printf(2, "tracedump: exec %s failed\n", argv[i]);
+ 228:	83 c4 0c             	add    $0xc,%esp
+ 22b:	ff 33                	push   (%ebx)
+ 22d:	68 8e 10 00 00       	push   $0x108e
+ 232:	6a 02                	push   $0x2
+ 234:	e8 77 07 00 00       	call   9b0 <printf>
+    exit();
+ 239:	e8 d5 04 00 00       	call   713 <exit>
+ 23e:	66 90                	xchg   %ax,%ax
+ 240:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 243:	8b 75 c8             	mov    -0x38(%ebp),%esi
+ 246:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 249:	e9 42 ff ff ff       	jmp    190 <main+0x190>
+    mask = classes(argv[i+1]);
+ 24e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 251:	83 ec 0c             	sub    $0xc,%esp
+    i += 2;
+ 254:	be 03 00 00 00       	mov    $0x3,%esi
+    mask = classes(argv[i+1]);
+ 259:	ff 70 08             	push   0x8(%eax)
+ 25c:	e8 3f 00 00 00       	call   2a0 <classes>
+ 261:	83 c4 10             	add    $0x10,%esp
+  if(i >= argc || mask <= 0){
+ 264:	85 c0                	test   %eax,%eax
+    mask = classes(argv[i+1]);
+ 266:	89 c2                	mov    %eax,%edx
+  if(i >= argc || mask <= 0){
+ 268:	0f 9e c0             	setle  %al
+ 26b:	e9 bd fd ff ff       	jmp    2d <main+0x2d>
+ 270:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 273:	e9 8d fe ff ff       	jmp    105 <main+0x105>
+    printf(2, "tracedump: fork failed\n");
+ 278:	51                   	push   %ecx
+ 279:	51                   	push   %ecx
+ 27a:	68 76 10 00 00       	push   $0x1076
+ 27f:	6a 02                	push   $0x2
+ 281:	e8 2a 07 00 00       	call   9b0 <printf>
+ 286:	83 c4 10             	add    $0x10,%esp
+ 289:	e9 22 fe ff ff       	jmp    b0 <main+0xb0>
+  for(i = 0; i < n; i++)
+ 28e:	0f 84 36 ff ff ff    	je     1ca <main+0x1ca>
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 299:	e9 50 ff ff ff       	jmp    1ee <main+0x1ee>
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <classes>:
+{
+ 2a0:	55                   	push   %ebp
+  for(mask = 0; *s; s++){
+ 2a1:	31 c9                	xor    %ecx,%ecx
+{
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(mask = 0; *s; s++){
+ 2a8:	0f b6 02             	movzbl (%edx),%eax
+ 2ab:	84 c0                	test   %al,%al
+ 2ad:	74 16                	je     2c5 <classes+0x25>
+    switch(*s){
+ 2af:	83 e8 63             	sub    $0x63,%eax
+ 2b2:	3c 10                	cmp    $0x10,%al
+ 2b4:	77 0a                	ja     2c0 <classes+0x20>
+ 2b6:	0f b6 c0             	movzbl %al,%eax
+ 2b9:	ff 24 85 20 0f 00 00 	jmp    *0xf20(,%eax,4)
+ 2c0:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+}
+ 2c5:	89 c8                	mov    %ecx,%eax
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    case 's': mask |= TC_SCHED; break;
+ 2d0:	83 c9 01             	or     $0x1,%ecx
+  for(mask = 0; *s; s++){
+ 2d3:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2d7:	83 c2 01             	add    $0x1,%edx
+ 2da:	84 c0                	test   %al,%al
+ 2dc:	75 d1                	jne    2af <classes+0xf>
+}
+ 2de:	89 c8                	mov    %ecx,%eax
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    case 'l': mask |= TC_LOG; break;
+ 2e8:	83 c9 08             	or     $0x8,%ecx
+ 2eb:	eb e6                	jmp    2d3 <classes+0x33>
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    case 'f': mask |= TC_FAULT; break;
+ 2f0:	83 c9 10             	or     $0x10,%ecx
+ 2f3:	eb de                	jmp    2d3 <classes+0x33>
+ 2f5:	8d 76 00             	lea    0x0(%esi),%esi
+    case 'd': mask |= TC_DISK; break;
+ 2f8:	83 c9 04             	or     $0x4,%ecx
+ 2fb:	eb d6                	jmp    2d3 <classes+0x33>
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    case 'c': mask |= TC_SYSCALL; break;
+ 300:	83 c9 02             	or     $0x2,%ecx
+ 303:	eb ce                	jmp    2d3 <classes+0x33>
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <print>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	83 ec 10             	sub    $0x10,%esp
+ 317:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf(1, "%d\tcpu%d\tpid %d\t", (uint)((e->tsc - t0) >> 10), e->cpu, e->pid);
+ 31a:	ff 73 0c             	push   0xc(%ebx)
+ 31d:	0f b6 43 0a          	movzbl 0xa(%ebx),%eax
+ 321:	50                   	push   %eax
+ 322:	8b 03                	mov    (%ebx),%eax
+ 324:	8b 53 04             	mov    0x4(%ebx),%edx
+ 327:	2b 45 0c             	sub    0xc(%ebp),%eax
+ 32a:	1b 55 10             	sbb    0x10(%ebp),%edx
+ 32d:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 331:	50                   	push   %eax
+ 332:	68 99 0f 00 00       	push   $0xf99
+ 337:	6a 01                	push   $0x1
+ 339:	e8 72 06 00 00       	call   9b0 <printf>
+  switch(e->type){
+ 33e:	0f b7 43 08          	movzwl 0x8(%ebx),%eax
+ 342:	83 c4 20             	add    $0x20,%esp
+ 345:	66 83 f8 09          	cmp    $0x9,%ax
+ 349:	0f 87 5e 01 00 00    	ja     4ad <print+0x19d>
+ 34f:	ff 24 85 64 0f 00 00 	jmp    *0xf64(,%eax,4)
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "page fault 0x%x %s\n", e->a0, e->a1 ? "write" : "read");
+ 360:	8b 43 14             	mov    0x14(%ebx),%eax
+ 363:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+ 368:	85 c0                	test   %eax,%eax
+ 36a:	b8 94 0f 00 00       	mov    $0xf94,%eax
+ 36f:	0f 45 c2             	cmovne %edx,%eax
+ 372:	50                   	push   %eax
+ 373:	ff 73 10             	push   0x10(%ebx)
+ 376:	68 3b 10 00 00       	push   $0x103b
+ 37b:	6a 01                	push   $0x1
+ 37d:	e8 2e 06 00 00       	call   9b0 <printf>
+}
+ 382:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    break;
+ 385:	83 c4 10             	add    $0x10,%esp
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "switch to pid %d\n", e->a0);
+ 390:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 393:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "switch to pid %d\n", e->a0);
+ 396:	c7 45 0c aa 0f 00 00 	movl   $0xfaa,0xc(%ebp)
+ 39d:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 3a4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 3a7:	c9                   	leave
+    printf(1, "switch to pid %d\n", e->a0);
+ 3a8:	e9 03 06 00 00       	jmp    9b0 <printf>
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "switch out (%s)\n", e->a0 < 6 ? statename[e->a0] : "?");
+ 3b0:	8b 53 10             	mov    0x10(%ebx),%edx
+ 3b3:	b8 8c 0f 00 00       	mov    $0xf8c,%eax
+ 3b8:	83 fa 05             	cmp    $0x5,%edx
+ 3bb:	77 07                	ja     3c4 <print+0xb4>
+ 3bd:	8b 04 95 e4 15 00 00 	mov    0x15e4(,%edx,4),%eax
+ 3c4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 3c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "switch out (%s)\n", e->a0 < 6 ? statename[e->a0] : "?");
+ 3ca:	c7 45 0c bc 0f 00 00 	movl   $0xfbc,0xc(%ebp)
+ 3d1:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 3d8:	c9                   	leave
+    printf(1, "switch out (%s)\n", e->a0 < 6 ? statename[e->a0] : "?");
+ 3d9:	e9 d2 05 00 00       	jmp    9b0 <printf>
+ 3de:	66 90                	xchg   %ax,%ax
+    printf(1, "wakeup pid %d\n", e->a0);
+ 3e0:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 3e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "wakeup pid %d\n", e->a0);
+ 3e6:	c7 45 0c cd 0f 00 00 	movl   $0xfcd,0xc(%ebp)
+ 3ed:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 3f4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 3f7:	c9                   	leave
+    printf(1, "wakeup pid %d\n", e->a0);
+ 3f8:	e9 b3 05 00 00       	jmp    9b0 <printf>
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "syscall %d\n", e->a0);
+ 400:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 403:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "syscall %d\n", e->a0);
+ 406:	c7 45 0c dc 0f 00 00 	movl   $0xfdc,0xc(%ebp)
+ 40d:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 414:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 417:	c9                   	leave
+    printf(1, "syscall %d\n", e->a0);
+ 418:	e9 93 05 00 00       	jmp    9b0 <printf>
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "syscall %d returns %d\n", e->a0, e->a1);
+ 420:	ff 73 14             	push   0x14(%ebx)
+ 423:	ff 73 10             	push   0x10(%ebx)
+ 426:	68 e8 0f 00 00       	push   $0xfe8
+ 42b:	6a 01                	push   $0x1
+ 42d:	e8 7e 05 00 00       	call   9b0 <printf>
+}
+ 432:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    break;
+ 435:	83 c4 10             	add    $0x10,%esp
+}
+ 438:	c9                   	leave
+ 439:	c3                   	ret
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "disk %s block %d\n", e->a1 ? "write" : "read", e->a0);
+ 440:	8b 53 14             	mov    0x14(%ebx),%edx
+ 443:	b8 94 0f 00 00       	mov    $0xf94,%eax
+ 448:	ff 73 10             	push   0x10(%ebx)
+ 44b:	85 d2                	test   %edx,%edx
+ 44d:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+ 452:	0f 45 c2             	cmovne %edx,%eax
+ 455:	50                   	push   %eax
+ 456:	68 ff 0f 00 00       	push   $0xfff
+ 45b:	6a 01                	push   $0x1
+ 45d:	e8 4e 05 00 00       	call   9b0 <printf>
+}
+ 462:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    break;
+ 465:	83 c4 10             	add    $0x10,%esp
+}
+ 468:	c9                   	leave
+ 469:	c3                   	ret
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "disk done block %d\n", e->a0);
+ 470:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 473:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "disk done block %d\n", e->a0);
+ 476:	c7 45 0c 11 10 00 00 	movl   $0x1011,0xc(%ebp)
+ 47d:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 484:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 487:	c9                   	leave
+    printf(1, "disk done block %d\n", e->a0);
+ 488:	e9 23 05 00 00       	jmp    9b0 <printf>
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "log commit %d blocks\n", e->a0);
+ 490:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "log commit %d blocks\n", e->a0);
+ 496:	c7 45 0c 25 10 00 00 	movl   $0x1025,0xc(%ebp)
+ 49d:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 4a4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 4a7:	c9                   	leave
+    printf(1, "log commit %d blocks\n", e->a0);
+ 4a8:	e9 03 05 00 00       	jmp    9b0 <printf>
+  switch(e->type){
+ 4ad:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 4b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "event %d\n", e->type);
+ 4b3:	c7 45 0c 4f 10 00 00 	movl   $0x104f,0xc(%ebp)
+ 4ba:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 4c1:	c9                   	leave
+    printf(1, "event %d\n", e->type);
+ 4c2:	e9 e9 04 00 00       	jmp    9b0 <printf>
+ 4c7:	66 90                	xchg   %ax,%ax
+ 4c9:	66 90                	xchg   %ax,%ax
+ 4cb:	66 90                	xchg   %ax,%ax
+ 4cd:	66 90                	xchg   %ax,%ax
+ 4cf:	90                   	nop
+
+000004d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 4d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 4d1:	31 c0                	xor    %eax,%eax
+{
+ 4d3:	89 e5                	mov    %esp,%ebp
+ 4d5:	53                   	push   %ebx
+ 4d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4e7:	83 c0 01             	add    $0x1,%eax
+ 4ea:	84 d2                	test   %dl,%dl
+ 4ec:	75 f2                	jne    4e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f1:	89 c8                	mov    %ecx,%eax
+ 4f3:	c9                   	leave
+ 4f4:	c3                   	ret
+ 4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+ 507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 50a:	0f b6 02             	movzbl (%edx),%eax
+ 50d:	84 c0                	test   %al,%al
+ 50f:	75 17                	jne    528 <strcmp+0x28>
+ 511:	eb 3a                	jmp    54d <strcmp+0x4d>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 51c:	83 c2 01             	add    $0x1,%edx
+ 51f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 522:	84 c0                	test   %al,%al
+ 524:	74 1a                	je     540 <strcmp+0x40>
+    p++, q++;
+ 526:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 528:	0f b6 19             	movzbl (%ecx),%ebx
+ 52b:	38 c3                	cmp    %al,%bl
+ 52d:	74 e9                	je     518 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 52f:	29 d8                	sub    %ebx,%eax
+}
+ 531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 534:	c9                   	leave
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 540:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 544:	31 c0                	xor    %eax,%eax
+ 546:	29 d8                	sub    %ebx,%eax
+}
+ 548:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 54b:	c9                   	leave
+ 54c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 54d:	0f b6 19             	movzbl (%ecx),%ebx
+ 550:	31 c0                	xor    %eax,%eax
+ 552:	eb db                	jmp    52f <strcmp+0x2f>
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 566:	80 3a 00             	cmpb   $0x0,(%edx)
+ 569:	74 15                	je     580 <strlen+0x20>
+ 56b:	31 c0                	xor    %eax,%eax
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+ 570:	83 c0 01             	add    $0x1,%eax
+ 573:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 577:	89 c1                	mov    %eax,%ecx
+ 579:	75 f5                	jne    570 <strlen+0x10>
+    ;
+  return n;
+}
+ 57b:	89 c8                	mov    %ecx,%eax
+ 57d:	5d                   	pop    %ebp
+ 57e:	c3                   	ret
+ 57f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 580:	31 c9                	xor    %ecx,%ecx
+}
+ 582:	5d                   	pop    %ebp
+ 583:	89 c8                	mov    %ecx,%eax
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 597:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	89 d7                	mov    %edx,%edi
+ 59f:	fc                   	cld
+ 5a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5a5:	89 d0                	mov    %edx,%eax
+ 5a7:	c9                   	leave
+ 5a8:	c3                   	ret
+ 5a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ba:	0f b6 10             	movzbl (%eax),%edx
+ 5bd:	84 d2                	test   %dl,%dl
+ 5bf:	75 12                	jne    5d3 <strchr+0x23>
+ 5c1:	eb 1d                	jmp    5e0 <strchr+0x30>
+ 5c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5c7:	90                   	nop
+ 5c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5cc:	83 c0 01             	add    $0x1,%eax
+ 5cf:	84 d2                	test   %dl,%dl
+ 5d1:	74 0d                	je     5e0 <strchr+0x30>
+    if(*s == c)
+ 5d3:	38 d1                	cmp    %dl,%cl
+ 5d5:	75 f1                	jne    5c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 5d7:	5d                   	pop    %ebp
+ 5d8:	c3                   	ret
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5e0:	31 c0                	xor    %eax,%eax
+}
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	c3                   	ret
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5f9:	31 db                	xor    %ebx,%ebx
+{
+ 5fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5fe:	eb 27                	jmp    627 <gets+0x37>
+    cc = read(0, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	6a 01                	push   $0x1
+ 605:	56                   	push   %esi
+ 606:	6a 00                	push   $0x0
+ 608:	e8 1e 01 00 00       	call   72b <read>
+    if(cc < 1)
+ 60d:	83 c4 10             	add    $0x10,%esp
+ 610:	85 c0                	test   %eax,%eax
+ 612:	7e 1d                	jle    631 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 614:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 618:	8b 55 08             	mov    0x8(%ebp),%edx
+ 61b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 61f:	3c 0a                	cmp    $0xa,%al
+ 621:	74 10                	je     633 <gets+0x43>
+ 623:	3c 0d                	cmp    $0xd,%al
+ 625:	74 0c                	je     633 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 627:	89 df                	mov    %ebx,%edi
+ 629:	83 c3 01             	add    $0x1,%ebx
+ 62c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 62f:	7c cf                	jl     600 <gets+0x10>
+ 631:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 63a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63d:	5b                   	pop    %ebx
+ 63e:	5e                   	pop    %esi
+ 63f:	5f                   	pop    %edi
+ 640:	5d                   	pop    %ebp
+ 641:	c3                   	ret
+ 642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	56                   	push   %esi
+ 654:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 655:	83 ec 08             	sub    $0x8,%esp
+ 658:	6a 00                	push   $0x0
+ 65a:	ff 75 08             	push   0x8(%ebp)
+ 65d:	e8 f1 00 00 00       	call   753 <open>
+  if(fd < 0)
+ 662:	83 c4 10             	add    $0x10,%esp
+ 665:	85 c0                	test   %eax,%eax
+ 667:	78 27                	js     690 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 669:	83 ec 08             	sub    $0x8,%esp
+ 66c:	ff 75 0c             	push   0xc(%ebp)
+ 66f:	89 c3                	mov    %eax,%ebx
+ 671:	50                   	push   %eax
+ 672:	e8 f4 00 00 00       	call   76b <fstat>
+  close(fd);
+ 677:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 67a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 67c:	e8 ba 00 00 00       	call   73b <close>
+  return r;
+ 681:	83 c4 10             	add    $0x10,%esp
+}
+ 684:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 687:	89 f0                	mov    %esi,%eax
+ 689:	5b                   	pop    %ebx
+ 68a:	5e                   	pop    %esi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 690:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 695:	eb ed                	jmp    684 <stat+0x34>
+ 697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	53                   	push   %ebx
+ 6a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6a7:	0f be 02             	movsbl (%edx),%eax
+ 6aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6b5:	77 1e                	ja     6d5 <atoi+0x35>
+ 6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6c0:	83 c2 01             	add    $0x1,%edx
+ 6c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6ca:	0f be 02             	movsbl (%edx),%eax
+ 6cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6d0:	80 fb 09             	cmp    $0x9,%bl
+ 6d3:	76 eb                	jbe    6c0 <atoi+0x20>
+  return n;
+}
+ 6d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6d8:	89 c8                	mov    %ecx,%eax
+ 6da:	c9                   	leave
+ 6db:	c3                   	ret
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6ee:	85 c0                	test   %eax,%eax
+ 6f0:	7e 13                	jle    705 <memmove+0x25>
+ 6f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6f4:	89 d7                	mov    %edx,%edi
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 700:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 701:	39 f8                	cmp    %edi,%eax
+ 703:	75 fb                	jne    700 <memmove+0x20>
+  return vdst;
+}
+ 705:	5e                   	pop    %esi
+ 706:	89 d0                	mov    %edx,%eax
+ 708:	5f                   	pop    %edi
+ 709:	5d                   	pop    %ebp
+ 70a:	c3                   	ret
+
+0000070b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 70b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <exit>:
+SYSCALL(exit)
+ 713:	b8 02 00 00 00       	mov    $0x2,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <wait>:
+SYSCALL(wait)
+ 71b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <pipe>:
+SYSCALL(pipe)
+ 723:	b8 04 00 00 00       	mov    $0x4,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <read>:
+SYSCALL(read)
+ 72b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <write>:
+SYSCALL(write)
+ 733:	b8 10 00 00 00       	mov    $0x10,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <close>:
+SYSCALL(close)
+ 73b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <kill>:
+SYSCALL(kill)
+ 743:	b8 06 00 00 00       	mov    $0x6,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <exec>:
+SYSCALL(exec)
+ 74b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <open>:
+SYSCALL(open)
+ 753:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <mknod>:
+SYSCALL(mknod)
+ 75b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <unlink>:
+SYSCALL(unlink)
+ 763:	b8 12 00 00 00       	mov    $0x12,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <fstat>:
+SYSCALL(fstat)
+ 76b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <link>:
+SYSCALL(link)
+ 773:	b8 13 00 00 00       	mov    $0x13,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <mkdir>:
+SYSCALL(mkdir)
+ 77b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <chdir>:
+SYSCALL(chdir)
+ 783:	b8 09 00 00 00       	mov    $0x9,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <dup>:
+SYSCALL(dup)
+ 78b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <getpid>:
+SYSCALL(getpid)
+ 793:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <sbrk>:
+SYSCALL(sbrk)
+ 79b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <sleep>:
+SYSCALL(sleep)
+ 7a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <uptime>:
+SYSCALL(uptime)
+ 7ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 7b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 7bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 7c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mlfqstart>:
+SYSCALL(mlfqstart)
+ 7cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 7d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 7db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 7e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <setpriority>:
+SYSCALL(setpriority)
+ 7eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 7f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <getcpustats>:
+SYSCALL(getcpustats)
+ 7fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <setscheduler>:
+SYSCALL(setscheduler)
+ 803:	b8 20 00 00 00       	mov    $0x20,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 80b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getscheduler>:
+SYSCALL(getscheduler)
+ 813:	b8 22 00 00 00       	mov    $0x22,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <splice>:
+SYSCALL(splice)
+ 81b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <readv>:
+SYSCALL(readv)
+ 823:	b8 24 00 00 00       	mov    $0x24,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <writev>:
+SYSCALL(writev)
+ 82b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <pread>:
+SYSCALL(pread)
+ 833:	b8 26 00 00 00       	mov    $0x26,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <pwrite>:
+SYSCALL(pwrite)
+ 83b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <getlogstat>:
+SYSCALL(getlogstat)
+ 843:	b8 28 00 00 00       	mov    $0x28,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <mount>:
+SYSCALL(mount)
+ 84b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <umount>:
+SYSCALL(umount)
+ 853:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <mmap>:
+SYSCALL(mmap)
+ 85b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <munmap>:
+SYSCALL(munmap)
+ 863:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <membench>:
+SYSCALL(membench)
+ 86b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <getlockstat>:
+SYSCALL(getlockstat)
+ 873:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <lockbench>:
+SYSCALL(lockbench)
+ 87b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <prof>:
+SYSCALL(prof)
+ 883:	b8 30 00 00 00       	mov    $0x30,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <tracectl>:
+SYSCALL(tracectl)
+ 88b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <traceread>:
+SYSCALL(traceread)
+ 893:	b8 32 00 00 00       	mov    $0x32,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <getsysstat>:
+SYSCALL(getsysstat)
+ 89b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 8a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <getschedwait>:
+SYSCALL(getschedwait)
+ 8ab:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <mlfqread>:
+SYSCALL(mlfqread)
+ 8b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <dllock>:
+SYSCALL(dllock)
+ 8bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 8c3:	b8 38 00 00 00       	mov    $0x38,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+000008cb <deadlocklog>:
+SYSCALL(deadlocklog)
+ 8cb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <clone>:
+SYSCALL(clone)
+ 8d3:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <join>:
+SYSCALL(join)
+ 8db:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+000008e3 <futex>:
+SYSCALL(futex)
+ 8e3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+000008eb <shmat>:
+SYSCALL(shmat)
+ 8eb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+000008f3 <shmdt>:
+SYSCALL(shmdt)
+ 8f3:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <poll>:
+SYSCALL(poll)
+ 8fb:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+ 903:	66 90                	xchg   %ax,%ax
+ 905:	66 90                	xchg   %ax,%ax
+ 907:	66 90                	xchg   %ax,%ax
+ 909:	66 90                	xchg   %ax,%ax
+ 90b:	66 90                	xchg   %ax,%ax
+ 90d:	66 90                	xchg   %ax,%ax
+ 90f:	90                   	nop
+
+00000910 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 918:	89 d1                	mov    %edx,%ecx
+{
+ 91a:	83 ec 3c             	sub    $0x3c,%esp
+ 91d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 920:	85 d2                	test   %edx,%edx
+ 922:	0f 89 80 00 00 00    	jns    9a8 <printint+0x98>
+ 928:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 92c:	74 7a                	je     9a8 <printint+0x98>
+    x = -xx;
+ 92e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 930:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 935:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 938:	31 f6                	xor    %esi,%esi
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 940:	89 c8                	mov    %ecx,%eax
+ 942:	31 d2                	xor    %edx,%edx
+ 944:	89 f7                	mov    %esi,%edi
+ 946:	f7 f3                	div    %ebx
+ 948:	8d 76 01             	lea    0x1(%esi),%esi
+ 94b:	0f b6 92 74 11 00 00 	movzbl 0x1174(%edx),%edx
+ 952:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 956:	89 ca                	mov    %ecx,%edx
+ 958:	89 c1                	mov    %eax,%ecx
+ 95a:	39 da                	cmp    %ebx,%edx
+ 95c:	73 e2                	jae    940 <printint+0x30>
+  if(neg)
+ 95e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 961:	85 c0                	test   %eax,%eax
+ 963:	74 07                	je     96c <printint+0x5c>
+    buf[i++] = '-';
+ 965:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 96a:	89 f7                	mov    %esi,%edi
+ 96c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 96f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 972:	01 df                	add    %ebx,%edi
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 978:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 981:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 984:	6a 01                	push   $0x1
+ 986:	50                   	push   %eax
+ 987:	56                   	push   %esi
+ 988:	e8 a6 fd ff ff       	call   733 <write>
+  while(--i >= 0)
+ 98d:	89 f8                	mov    %edi,%eax
+ 98f:	83 c4 10             	add    $0x10,%esp
+ 992:	83 ef 01             	sub    $0x1,%edi
+ 995:	39 d8                	cmp    %ebx,%eax
+ 997:	75 df                	jne    978 <printint+0x68>
+}
+ 999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 99c:	5b                   	pop    %ebx
+ 99d:	5e                   	pop    %esi
+ 99e:	5f                   	pop    %edi
+ 99f:	5d                   	pop    %ebp
+ 9a0:	c3                   	ret
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9a8:	31 c0                	xor    %eax,%eax
+ 9aa:	eb 89                	jmp    935 <printint+0x25>
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c2:	83 c6 01             	add    $0x1,%esi
+ 9c5:	84 db                	test   %bl,%bl
+ 9c7:	74 67                	je     a30 <printf+0x80>
+ 9c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9cc:	31 d2                	xor    %edx,%edx
+ 9ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9d1:	eb 34                	jmp    a07 <printf+0x57>
+ 9d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9d7:	90                   	nop
+ 9d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9e0:	83 f8 25             	cmp    $0x25,%eax
+ 9e3:	74 18                	je     9fd <printf+0x4d>
+  write(fd, &c, 1);
+ 9e5:	83 ec 04             	sub    $0x4,%esp
+ 9e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ee:	6a 01                	push   $0x1
+ 9f0:	50                   	push   %eax
+ 9f1:	57                   	push   %edi
+ 9f2:	e8 3c fd ff ff       	call   733 <write>
+ 9f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9fd:	0f b6 1e             	movzbl (%esi),%ebx
+ a00:	83 c6 01             	add    $0x1,%esi
+ a03:	84 db                	test   %bl,%bl
+ a05:	74 29                	je     a30 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a07:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a0a:	85 d2                	test   %edx,%edx
+ a0c:	74 ca                	je     9d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a0e:	83 fa 25             	cmp    $0x25,%edx
+ a11:	75 ea                	jne    9fd <printf+0x4d>
+      if(c == 'd'){
+ a13:	83 f8 25             	cmp    $0x25,%eax
+ a16:	0f 84 24 01 00 00    	je     b40 <printf+0x190>
+ a1c:	83 e8 63             	sub    $0x63,%eax
+ a1f:	83 f8 15             	cmp    $0x15,%eax
+ a22:	77 1c                	ja     a40 <printf+0x90>
+ a24:	ff 24 85 1c 11 00 00 	jmp    *0x111c(,%eax,4)
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a33:	5b                   	pop    %ebx
+ a34:	5e                   	pop    %esi
+ a35:	5f                   	pop    %edi
+ a36:	5d                   	pop    %ebp
+ a37:	c3                   	ret
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a46:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a4a:	6a 01                	push   $0x1
+ a4c:	52                   	push   %edx
+ a4d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a50:	57                   	push   %edi
+ a51:	e8 dd fc ff ff       	call   733 <write>
+ a56:	83 c4 0c             	add    $0xc,%esp
+ a59:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a5c:	6a 01                	push   $0x1
+ a5e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a61:	52                   	push   %edx
+ a62:	57                   	push   %edi
+ a63:	e8 cb fc ff ff       	call   733 <write>
+        putc(fd, c);
+ a68:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a6b:	31 d2                	xor    %edx,%edx
+ a6d:	eb 8e                	jmp    9fd <printf+0x4d>
+ a6f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 00                	push   $0x0
+ a7f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a81:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a84:	e8 87 fe ff ff       	call   910 <printint>
+        ap++;
+ a89:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a8c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a8f:	31 d2                	xor    %edx,%edx
+ a91:	e9 67 ff ff ff       	jmp    9fd <printf+0x4d>
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ aa0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ aa3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ aa5:	83 c0 04             	add    $0x4,%eax
+ aa8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ aab:	85 db                	test   %ebx,%ebx
+ aad:	0f 84 9d 00 00 00    	je     b50 <printf+0x1a0>
+        while(*s != 0){
+ ab3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ab6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ab8:	84 c0                	test   %al,%al
+ aba:	0f 84 3d ff ff ff    	je     9fd <printf+0x4d>
+ ac0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ac3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ ac6:	89 de                	mov    %ebx,%esi
+ ac8:	89 d3                	mov    %edx,%ebx
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ad0:	83 ec 04             	sub    $0x4,%esp
+ ad3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ad6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ad9:	6a 01                	push   $0x1
+ adb:	53                   	push   %ebx
+ adc:	57                   	push   %edi
+ add:	e8 51 fc ff ff       	call   733 <write>
+        while(*s != 0){
+ ae2:	0f b6 06             	movzbl (%esi),%eax
+ ae5:	83 c4 10             	add    $0x10,%esp
+ ae8:	84 c0                	test   %al,%al
+ aea:	75 e4                	jne    ad0 <printf+0x120>
+      state = 0;
+ aec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aef:	31 d2                	xor    %edx,%edx
+ af1:	e9 07 ff ff ff       	jmp    9fd <printf+0x4d>
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b0b:	8b 13                	mov    (%ebx),%edx
+ b0d:	6a 01                	push   $0x1
+ b0f:	e9 6b ff ff ff       	jmp    a7f <printf+0xcf>
+ b14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b1b:	83 ec 04             	sub    $0x4,%esp
+ b1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b29:	6a 01                	push   $0x1
+ b2b:	52                   	push   %edx
+ b2c:	57                   	push   %edi
+ b2d:	e8 01 fc ff ff       	call   733 <write>
+        ap++;
+ b32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b38:	31 d2                	xor    %edx,%edx
+ b3a:	e9 be fe ff ff       	jmp    9fd <printf+0x4d>
+ b3f:	90                   	nop
+  write(fd, &c, 1);
+ b40:	83 ec 04             	sub    $0x4,%esp
+ b43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b49:	6a 01                	push   $0x1
+ b4b:	e9 11 ff ff ff       	jmp    a61 <printf+0xb1>
+ b50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b55:	bb 15 11 00 00       	mov    $0x1115,%ebx
+ b5a:	e9 61 ff ff ff       	jmp    ac0 <printf+0x110>
+ b5f:	90                   	nop
+
+00000b60 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b63:	a1 54 16 00 00       	mov    0x1654,%eax
+{
+ b68:	89 e5                	mov    %esp,%ebp
+ b6a:	56                   	push   %esi
+ b6b:	53                   	push   %ebx
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b70:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b72:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b74:	39 ca                	cmp    %ecx,%edx
+ b76:	73 30                	jae    ba8 <bigfree+0x48>
+ b78:	39 c1                	cmp    %eax,%ecx
+ b7a:	72 04                	jb     b80 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b7c:	39 c2                	cmp    %eax,%edx
+ b7e:	72 f0                	jb     b70 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b80:	8b 59 04             	mov    0x4(%ecx),%ebx
+ b83:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ b86:	39 f0                	cmp    %esi,%eax
+ b88:	74 26                	je     bb0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b8a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b8c:	8b 42 04             	mov    0x4(%edx),%eax
+ b8f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ b92:	39 d9                	cmp    %ebx,%ecx
+ b94:	74 30                	je     bc6 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b96:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b98:	5b                   	pop    %ebx
+  freep = p;
+ b99:	89 15 54 16 00 00    	mov    %edx,0x1654
+}
+ b9f:	5e                   	pop    %esi
+ ba0:	5d                   	pop    %ebp
+ ba1:	c3                   	ret
+ ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba8:	39 c1                	cmp    %eax,%ecx
+ baa:	72 d0                	jb     b7c <bigfree+0x1c>
+ bac:	eb c2                	jmp    b70 <bigfree+0x10>
+ bae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ bb0:	03 58 04             	add    0x4(%eax),%ebx
+ bb3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb6:	8b 02                	mov    (%edx),%eax
+ bb8:	8b 00                	mov    (%eax),%eax
+ bba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ bbc:	8b 42 04             	mov    0x4(%edx),%eax
+ bbf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ bc2:	39 d9                	cmp    %ebx,%ecx
+ bc4:	75 d0                	jne    b96 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ bc6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ bc9:	89 15 54 16 00 00    	mov    %edx,0x1654
+    p->s.size += bp->s.size;
+ bcf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bd2:	8b 09                	mov    (%ecx),%ecx
+ bd4:	89 0a                	mov    %ecx,(%edx)
+}
+ bd6:	5b                   	pop    %ebx
+ bd7:	5e                   	pop    %esi
+ bd8:	5d                   	pop    %ebp
+ bd9:	c3                   	ret
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000be0 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	89 c7                	mov    %eax,%edi
+ be6:	56                   	push   %esi
+ be7:	53                   	push   %ebx
+ be8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ beb:	a1 54 16 00 00       	mov    0x1654,%eax
+ bf0:	85 c0                	test   %eax,%eax
+ bf2:	0f 84 88 00 00 00    	je     c80 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ bfa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ bfd:	39 f9                	cmp    %edi,%ecx
+ bff:	73 5f                	jae    c60 <bigalloc+0x80>
+  if(nu < 4096)
+ c01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c06:	39 df                	cmp    %ebx,%edi
+ c08:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c0b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c12:	eb 0d                	jmp    c21 <bigalloc+0x41>
+ c14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ c1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ c1d:	39 f9                	cmp    %edi,%ecx
+ c1f:	73 3f                	jae    c60 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ c21:	89 d0                	mov    %edx,%eax
+ c23:	39 15 54 16 00 00    	cmp    %edx,0x1654
+ c29:	75 ed                	jne    c18 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ c2b:	83 ec 0c             	sub    $0xc,%esp
+ c2e:	56                   	push   %esi
+ c2f:	e8 67 fb ff ff       	call   79b <sbrk>
+  if(p == (char*)-1)
+ c34:	83 c4 10             	add    $0x10,%esp
+ c37:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c3a:	74 11                	je     c4d <bigalloc+0x6d>
+  hp->s.size = nu;
+ c3c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ c3f:	e8 1c ff ff ff       	call   b60 <bigfree>
+  return freep;
+ c44:	a1 54 16 00 00       	mov    0x1654,%eax
+      if((p = morecore(nunits)) == 0)
+ c49:	85 c0                	test   %eax,%eax
+ c4b:	75 cb                	jne    c18 <bigalloc+0x38>
+        return 0;
+  }
+}
+ c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c50:	31 d2                	xor    %edx,%edx
+}
+ c52:	5b                   	pop    %ebx
+ c53:	89 d0                	mov    %edx,%eax
+ c55:	5e                   	pop    %esi
+ c56:	5f                   	pop    %edi
+ c57:	5d                   	pop    %ebp
+ c58:	c3                   	ret
+ c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ c60:	39 cf                	cmp    %ecx,%edi
+ c62:	74 4c                	je     cb0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ c64:	29 f9                	sub    %edi,%ecx
+ c66:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ c69:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ c6c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ c6f:	a3 54 16 00 00       	mov    %eax,0x1654
+}
+ c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c77:	89 d0                	mov    %edx,%eax
+ c79:	5b                   	pop    %ebx
+ c7a:	5e                   	pop    %esi
+ c7b:	5f                   	pop    %edi
+ c7c:	5d                   	pop    %ebp
+ c7d:	c3                   	ret
+ c7e:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ c80:	c7 05 54 16 00 00 58 	movl   $0x1658,0x1654
+ c87:	16 00 00 
+    base.s.size = 0;
+ c8a:	ba 58 16 00 00       	mov    $0x1658,%edx
+    base.s.ptr = freep = prevp = &base;
+ c8f:	c7 05 58 16 00 00 58 	movl   $0x1658,0x1658
+ c96:	16 00 00 
+    base.s.size = 0;
+ c99:	c7 05 5c 16 00 00 00 	movl   $0x0,0x165c
+ ca0:	00 00 00 
+    if(p->s.size >= nunits){
+ ca3:	e9 59 ff ff ff       	jmp    c01 <bigalloc+0x21>
+ ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ caf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ cb0:	8b 0a                	mov    (%edx),%ecx
+ cb2:	89 08                	mov    %ecx,(%eax)
+ cb4:	eb b9                	jmp    c6f <bigalloc+0x8f>
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cc0 <free>:
+{
+ cc0:	55                   	push   %ebp
+ cc1:	89 e5                	mov    %esp,%ebp
+ cc3:	53                   	push   %ebx
+ cc4:	83 ec 04             	sub    $0x4,%esp
+ cc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ cca:	85 c9                	test   %ecx,%ecx
+ ccc:	74 58                	je     d26 <free+0x66>
+  bp = (Header*)ap - 1;
+ cce:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ cd1:	ba 01 00 00 00       	mov    $0x1,%edx
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+ ce0:	89 d0                	mov    %edx,%eax
+ ce2:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+  while(xchg(&locked, 1) != 0)
+ ce9:	85 c0                	test   %eax,%eax
+ ceb:	75 f3                	jne    ce0 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ ced:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ cf0:	83 fa 40             	cmp    $0x40,%edx
+ cf3:	77 3b                	ja     d30 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ cf5:	83 fa 02             	cmp    $0x2,%edx
+ cf8:	76 3f                	jbe    d39 <free+0x79>
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d00:	83 c0 01             	add    $0x1,%eax
+ d03:	39 14 85 a0 11 00 00 	cmp    %edx,0x11a0(,%eax,4)
+ d0a:	72 f4                	jb     d00 <free+0x40>
+    bp->s.ptr = classfree[c];
+ d0c:	8b 14 85 20 16 00 00 	mov    0x1620(,%eax,4),%edx
+    classfree[c] = bp;
+ d13:	89 1c 85 20 16 00 00 	mov    %ebx,0x1620(,%eax,4)
+    bp->s.ptr = classfree[c];
+ d1a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ d1d:	31 c0                	xor    %eax,%eax
+ d1f:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+}
+ d26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d29:	c9                   	leave
+ d2a:	c3                   	ret
+ d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+    bigfree(bp);
+ d30:	89 d8                	mov    %ebx,%eax
+ d32:	e8 29 fe ff ff       	call   b60 <bigfree>
+ d37:	eb e4                	jmp    d1d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ d39:	31 c0                	xor    %eax,%eax
+ d3b:	eb cf                	jmp    d0c <free+0x4c>
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d40:	55                   	push   %ebp
+ d41:	b9 01 00 00 00       	mov    $0x1,%ecx
+ d46:	89 e5                	mov    %esp,%ebp
+ d48:	57                   	push   %edi
+ d49:	56                   	push   %esi
+ d4a:	53                   	push   %ebx
+ d4b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d51:	8d 50 07             	lea    0x7(%eax),%edx
+ d54:	c1 ea 03             	shr    $0x3,%edx
+ d57:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d60:	89 c8                	mov    %ecx,%eax
+ d62:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+ d69:	85 c0                	test   %eax,%eax
+ d6b:	75 f3                	jne    d60 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ d6d:	89 c3                	mov    %eax,%ebx
+ d6f:	83 fa 40             	cmp    $0x40,%edx
+ d72:	77 4c                	ja     dc0 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ d74:	be 02 00 00 00       	mov    $0x2,%esi
+ d79:	83 fa 02             	cmp    $0x2,%edx
+ d7c:	76 10                	jbe    d8e <malloc+0x4e>
+ d7e:	66 90                	xchg   %ax,%ax
+ d80:	83 c3 01             	add    $0x1,%ebx
+ d83:	8b 34 9d a0 11 00 00 	mov    0x11a0(,%ebx,4),%esi
+ d8a:	39 d6                	cmp    %edx,%esi
+ d8c:	72 f2                	jb     d80 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ d8e:	8b 14 9d 20 16 00 00 	mov    0x1620(,%ebx,4),%edx
+ d95:	85 d2                	test   %edx,%edx
+ d97:	74 47                	je     de0 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ d99:	8b 3a                	mov    (%edx),%edi
+ d9b:	89 3c 9d 20 16 00 00 	mov    %edi,0x1620(,%ebx,4)
+ da2:	31 c0                	xor    %eax,%eax
+ da4:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ dab:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ dae:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ db1:	5b                   	pop    %ebx
+ db2:	5e                   	pop    %esi
+ db3:	5f                   	pop    %edi
+ db4:	5d                   	pop    %ebp
+ db5:	c3                   	ret
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ dc0:	89 d0                	mov    %edx,%eax
+ dc2:	e8 19 fe ff ff       	call   be0 <bigalloc>
+ dc7:	89 c2                	mov    %eax,%edx
+ dc9:	89 d8                	mov    %ebx,%eax
+ dcb:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+  return p ? (void*)(p + 1) : 0;
+ dd2:	85 d2                	test   %edx,%edx
+ dd4:	75 d5                	jne    dab <malloc+0x6b>
+ dd6:	31 c0                	xor    %eax,%eax
+}
+ dd8:	83 c4 1c             	add    $0x1c,%esp
+ ddb:	5b                   	pop    %ebx
+ ddc:	5e                   	pop    %esi
+ ddd:	5f                   	pop    %edi
+ dde:	5d                   	pop    %ebp
+ ddf:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ de0:	b8 00 02 00 00       	mov    $0x200,%eax
+ de5:	e8 f6 fd ff ff       	call   be0 <bigalloc>
+ dea:	85 c0                	test   %eax,%eax
+ dec:	74 44                	je     e32 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ dee:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ df5:	8b 14 9d 20 16 00 00 	mov    0x1620(,%ebx,4),%edx
+ dfc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ dff:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ e02:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ e08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ e0b:	39 cf                	cmp    %ecx,%edi
+ e0d:	72 8a                	jb     d99 <malloc+0x59>
+ e0f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ e12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ e15:	8d 76 00             	lea    0x0(%esi),%esi
+ e18:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ e1a:	89 70 04             	mov    %esi,0x4(%eax)
+ e1d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e1f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ e21:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ e23:	01 d8                	add    %ebx,%eax
+ e25:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ e28:	73 ee                	jae    e18 <malloc+0xd8>
+ e2a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ e2d:	e9 69 ff ff ff       	jmp    d9b <malloc+0x5b>
+ e32:	f0 87 05 00 16 00 00 	lock xchg %eax,0x1600
+  return p ? (void*)(p + 1) : 0;
+ e39:	31 c0                	xor    %eax,%eax
+ e3b:	eb 9b                	jmp    dd8 <malloc+0x98>
+ e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	56                   	push   %esi
+ e44:	53                   	push   %ebx
+ e45:	8b 45 08             	mov    0x8(%ebp),%eax
+ e48:	f7 65 0c             	mull   0xc(%ebp)
+ e4b:	70 33                	jo     e80 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ e4d:	83 ec 0c             	sub    $0xc,%esp
+ e50:	89 c3                	mov    %eax,%ebx
+ e52:	50                   	push   %eax
+ e53:	e8 e8 fe ff ff       	call   d40 <malloc>
+ e58:	83 c4 10             	add    $0x10,%esp
+ e5b:	89 c6                	mov    %eax,%esi
+ e5d:	85 c0                	test   %eax,%eax
+ e5f:	74 1f                	je     e80 <calloc+0x40>
+    memset(p, 0, n);
+ e61:	83 ec 04             	sub    $0x4,%esp
+ e64:	53                   	push   %ebx
+ e65:	6a 00                	push   $0x0
+ e67:	50                   	push   %eax
+ e68:	e8 23 f7 ff ff       	call   590 <memset>
+ e6d:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ e70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e73:	89 f0                	mov    %esi,%eax
+ e75:	5b                   	pop    %ebx
+ e76:	5e                   	pop    %esi
+ e77:	5d                   	pop    %ebp
+ e78:	c3                   	ret
+ e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ e83:	31 f6                	xor    %esi,%esi
+}
+ e85:	89 f0                	mov    %esi,%eax
+ e87:	5b                   	pop    %ebx
+ e88:	5e                   	pop    %esi
+ e89:	5d                   	pop    %ebp
+ e8a:	c3                   	ret
+ e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e8f:	90                   	nop
+
+00000e90 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	57                   	push   %edi
+ e94:	56                   	push   %esi
+ e95:	53                   	push   %ebx
+ e96:	83 ec 0c             	sub    $0xc,%esp
+ e99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ e9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ e9f:	85 db                	test   %ebx,%ebx
+ ea1:	74 55                	je     ef8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ea3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ea6:	89 de                	mov    %ebx,%esi
+ ea8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ eaf:	39 c7                	cmp    %eax,%edi
+ eb1:	72 0d                	jb     ec0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ eb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eb6:	89 f0                	mov    %esi,%eax
+ eb8:	5b                   	pop    %ebx
+ eb9:	5e                   	pop    %esi
+ eba:	5f                   	pop    %edi
+ ebb:	5d                   	pop    %ebp
+ ebc:	c3                   	ret
+ ebd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ec0:	83 ec 0c             	sub    $0xc,%esp
+ ec3:	50                   	push   %eax
+ ec4:	e8 77 fe ff ff       	call   d40 <malloc>
+ ec9:	83 c4 10             	add    $0x10,%esp
+ ecc:	89 c6                	mov    %eax,%esi
+ ece:	85 c0                	test   %eax,%eax
+ ed0:	74 e1                	je     eb3 <realloc+0x23>
+  memmove(p, ap, have);
+ ed2:	83 ec 04             	sub    $0x4,%esp
+ ed5:	57                   	push   %edi
+ ed6:	53                   	push   %ebx
+ ed7:	50                   	push   %eax
+ ed8:	e8 03 f8 ff ff       	call   6e0 <memmove>
+  free(ap);
+ edd:	89 1c 24             	mov    %ebx,(%esp)
+ ee0:	e8 db fd ff ff       	call   cc0 <free>
+  return p;
+ ee5:	83 c4 10             	add    $0x10,%esp
+}
+ ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eeb:	89 f0                	mov    %esi,%eax
+ eed:	5b                   	pop    %ebx
+ eee:	5e                   	pop    %esi
+ eef:	5f                   	pop    %edi
+ ef0:	5d                   	pop    %ebp
+ ef1:	c3                   	ret
+ ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ef8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ efe:	5b                   	pop    %ebx
+ eff:	5e                   	pop    %esi
+ f00:	5f                   	pop    %edi
+ f01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ f02:	e9 39 fe ff ff       	jmp    d40 <malloc>
@@ -0,0 +1,119 @@
+// Trace a command and print the kernel events it caused.
+// usage: tracedump [-c classes] command args...
+// classes is any of s (scheduling), c (system calls), d (disk),
+// l (log commits) and f (page faults); the default is all.
+// Times are in units of 1024 cycles since the first event.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "trace.h"
+
+#define MAXEV 8192
+
+char *statename[] = { "unused", "embryo", "sleep", "runble", "run", "zombie" };
+
+int
+classes(char *s)
+{
+  int mask;
+
+  for(mask = 0; *s; s++){
+    switch(*s){
+    case 's': mask |= TC_SCHED; break;
+    case 'c': mask |= TC_SYSCALL; break;
+    case 'd': mask |= TC_DISK; break;
+    case 'l': mask |= TC_LOG; break;
+    case 'f': mask |= TC_FAULT; break;
+    default: return -1;
+    }
+  }
+  return mask;
+}
+
+void
+print(struct traceevent *e, uint64 t0)
+{
+  printf(1, "%d\tcpu%d\tpid %d\t", (uint)((e->tsc - t0) >> 10), e->cpu, e->pid);
+  switch(e->type){
+  case TE_SWITCHIN:
+    printf(1, "switch to pid %d\n", e->a0);
+    break;
+  case TE_SWITCHOUT:
+    printf(1, "switch out (%s)\n", e->a0 < 6 ? statename[e->a0] : "?");
+    break;
+  case TE_WAKEUP:
+    printf(1, "wakeup pid %d\n", e->a0);
+    break;
+  case TE_SYSENTER:
+    printf(1, "syscall %d\n", e->a0);
+    break;
+  case TE_SYSEXIT:
+    printf(1, "syscall %d returns %d\n", e->a0, e->a1);
+    break;
+  case TE_DISKSTART:
+    printf(1, "disk %s block %d\n", e->a1 ? "write" : "read", e->a0);
+    break;
+  case TE_DISKDONE:
+    printf(1, "disk done block %d\n", e->a0);
+    break;
+  case TE_COMMIT:
+    printf(1, "log commit %d blocks\n", e->a0);
+    break;
+  case TE_PGFAULT:
+    printf(1, "page fault 0x%x %s\n", e->a0, e->a1 ? "write" : "read");
+    break;
+  default:
+    printf(1, "event %d\n", e->type);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct traceevent *ev, t;
+  int i, j, n, mask, dropped, pid;
+
+  mask = TC_SCHED|TC_SYSCALL|TC_DISK|TC_LOG|TC_FAULT;
+  i = 1;
+  if(i + 1 < argc && strcmp(argv[i], "-c") == 0){
+    mask = classes(argv[i+1]);
+    i += 2;
+  }
+  if(i >= argc || mask <= 0){
+    printf(2, "usage: tracedump [-c scdlf] command args...\n");
+    exit();
+  }
+  if((ev = malloc(MAXEV * sizeof(*ev))) == 0){
+    printf(2, "tracedump: out of memory\n");
+    exit();
+  }
+
+  tracectl(mask);
+  pid = fork();
+  if(pid < 0)
+    printf(2, "tracedump: fork failed\n");
+  else if(pid == 0){
+    exec(argv[i], argv+i);
+    printf(2, "tracedump: exec %s failed\n", argv[i]);
+    exit();
+  } else
+    wait();
+  dropped = tracectl(0);
+
+  for(n = 0; n < MAXEV && (j = traceread(ev + n, MAXEV - n)) > 0; n += j)
+    ;
+
+  // Sort the CPUs' events into one time line.
+  for(i = 1; i < n; i++){
+    t = ev[i];
+    for(j = i; j > 0 && ev[j-1].tsc > t.tsc; j--)
+      ev[j] = ev[j-1];
+    ev[j] = t;
+  }
+
+  for(i = 0; i < n; i++)
+    print(&ev[i], ev[0].tsc);
+  printf(1, "%d events, %d dropped\n", n, dropped);
+  exit();
+}
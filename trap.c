@@ -7,10 +7,11 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "seqlock.h"
 
 // Define cpustats_kernel structure here since it's not in a header
 struct cpustats_kernel {
-  struct spinlock lock;
+  struct seqlock lock;
   uint total_ticks;
   uint idle_ticks;
 };
@@ -64,7 +65,9 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      polltimer();
     }
+    proftick(tf);
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -89,6 +92,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Pages of mmap()ed files are mapped on first use.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       vmfault(rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // Otherwise a bad access; fall through.
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -120,14 +130,14 @@ trap(struct trapframe *tf)
     struct proc *p = myproc();
     
     // 1. CPU Statistics
-    acquire(&cpu_stats.lock);
+    acquireseq(&cpu_stats.lock);
     cpu_stats.total_ticks++;
     
     // Increment process CPU ticks
     if(p && p->state == RUNNING)
       p->cpu_ticks++;
     
-    release(&cpu_stats.lock);
+    releaseseq(&cpu_stats.lock);
 
     // 2. MLFQ Demotion Logic
     if(current_scheduler_policy == 2 && p->state == RUNNING) { // SCHED_MLFQ = 2
@@ -142,8 +152,10 @@ trap(struct trapframe *tf)
       int current_slice = time_slices[p->mlfq_level];
       
       if(p->mlfq_ticks >= current_slice) {
-        if(p->mlfq_level < NQUEUE - 1) // Demote to next lower queue
+        if(p->mlfq_level < NQUEUE - 1) { // Demote to next lower queue
           p->mlfq_level++;
+          mlfqlog(p->pid, p->mlfq_level - 1, p->mlfq_level);
+        }
         p->mlfq_ticks = 0;
       }
     }
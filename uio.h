@@ -0,0 +1,9 @@
+// Scatter/gather I/O vectors for readv() and writev().
+// Both the kernel and user programs use this header file.
+
+#define IOV_MAX 16  // maximum buffers in one readv/writev call
+
+struct iovec {
+  void *iov_base;  // Start of buffer
+  uint iov_len;    // Length of buffer in bytes
+};
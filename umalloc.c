@@ -2,9 +2,25 @@
 #include "stat.h"
 #include "user.h"
 #include "param.h"
+#include "x86.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator.
+//
+// Small requests are served from segregated size classes: each
+// class has its own free list of equal-sized blocks, carved out
+// of SLABUNITS-unit slabs, so malloc and free of a small block
+// are a list push or pop. Blocks larger than the biggest class
+// come from the first-fit free list of Kernighan and Ritchie,
+// The C programming Language, 2nd ed.  Section 8.7, which also
+// supplies the slabs. Small blocks are never coalesced or given
+// back to the large list.
+//
+// Every block starts with a Header whose s.size is the block's
+// length in Header units, header included. A small block's size
+// is exactly its class size, and large blocks are always bigger
+// than the largest class, so free can tell them apart by size.
+//
+// malloc and free hold a spin lock, so threads may share the heap.
 
 typedef long Align;
 
@@ -21,12 +37,31 @@ typedef union header Header;
 static Header base;
 static Header *freep;
 
-void
-free(void *ap)
+// Block sizes of the small classes, in Header units.
+static uint classunits[] = { 2, 3, 4, 5, 6, 8, 10, 12, 16, 24, 32, 48, 64 };
+#define NCLASS (sizeof(classunits)/sizeof(classunits[0]))
+#define MAXSMALL 64
+#define SLABUNITS 512
+
+static Header *classfree[NCLASS];
+static volatile uint locked;
+
+// Return the smallest class whose blocks hold nunits.
+static int
+sizeclass(uint nunits)
 {
-  Header *bp, *p;
+  int c;
+
+  for(c = 0; classunits[c] < nunits; c++)
+    ;
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+  Header *p;
 
-  bp = (Header*)ap - 1;
   for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
     if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
       break;
@@ -43,6 +78,26 @@ free(void *ap)
   freep = p;
 }
 
+void
+free(void *ap)
+{
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    return;
+  bp = (Header*)ap - 1;
+  while(xchg(&locked, 1) != 0)
+    ;
+  if(bp->s.size <= MAXSMALL){
+    c = sizeclass(bp->s.size);
+    bp->s.ptr = classfree[c];
+    classfree[c] = bp;
+  } else
+    bigfree(bp);
+  xchg(&locked, 0);
+}
+
 static Header*
 morecore(uint nu)
 {
@@ -56,17 +111,16 @@ morecore(uint nu)
     return 0;
   hp = (Header*)p;
   hp->s.size = nu;
-  free((void*)(hp + 1));
+  bigfree(hp);
   return freep;
 }
 
-void*
-malloc(uint nbytes)
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
 {
   Header *p, *prevp;
-  uint nunits;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;
@@ -81,10 +135,89 @@ malloc(uint nbytes)
         p->s.size = nunits;
       }
       freep = prevp;
-      return (void*)(p + 1);
+      return p;
     }
     if(p == freep)
       if((p = morecore(nunits)) == 0)
         return 0;
   }
 }
+
+// Carve a new slab into blocks of class c.
+static int
+moreclass(int c)
+{
+  Header *slab, *bp;
+  uint n;
+
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    return -1;
+  n = classunits[c];
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    bp->s.size = n;
+    bp->s.ptr = classfree[c];
+    classfree[c] = bp;
+  }
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  while(xchg(&locked, 1) != 0)
+    ;
+  if(nunits > MAXSMALL)
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+
+void*
+calloc(uint nelem, uint elsize)
+{
+  void *p;
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    memset(p, 0, n);
+  return p;
+}
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+  if(nbytes <= have)
+    return ap;
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
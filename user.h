@@ -3,6 +3,17 @@ struct rtcdate;
 struct procinfo;
 struct cpustats;
 struct deadlockinfo;
+struct deadlogent;
+struct iovec;
+struct pollfd;
+struct logstat;
+struct lockstat;
+struct profsample;
+struct traceevent;
+struct sysstat;
+struct waitstat;
+struct mlfqrec;
+struct mlfqstat;
 
 // system calls
 int fork(void);
@@ -28,17 +39,46 @@ int sleep(int);
 int uptime(void);
 int getsysinfo(void *addr);
 int detect_deadlock(void);
-int mlfqstatus(void);
+int mlfqstatus(struct mlfqstat*);
 int mlfqstart(void);
 int mlfqstop(void);
-int mlfqvisual(void);
-int mlfqrealtime(void);
+int mlfqvisual(struct mlfqrec*, int, uint*);
+int mlfqrealtime(struct mlfqstat*);
 int setpriority(int priority);
 int getallprocinfo(struct procinfo*, int);
 int getcpustats(struct cpustats*);
 int setscheduler(int);
 int getdeadlockinfo(struct deadlockinfo*);
 int getscheduler(void);
+int splice(int, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int getlogstat(struct logstat*);
+int mount(const char*);
+int umount(const char*);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int membench(int, char*, int, int);
+int getlockstat(struct lockstat*, int, int);
+int lockbench(int, int);
+int prof(int, struct profsample*, int);
+int tracectl(int);
+int traceread(struct traceevent*, int);
+int getsysstat(struct sysstat*, int, int);
+int getwaitstat(int, struct waitstat*);
+int getschedwait(struct waitstat*, int, int);
+int mlfqread(struct mlfqrec*, int, uint*);
+int dllock(int, int);
+int watchdogctl(int, int);
+int deadlocklog(struct deadlogent*, int);
+int clone(void(*)(void*, void*), void*, void*, void*);
+int join(void**);
+int futex(volatile uint*, int, int);
+void* shmat(int, int);
+int shmdt(void*);
+int poll(struct pollfd*, int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -52,4 +92,24 @@ uint strlen(const char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
+void* calloc(uint, uint);
+void* realloc(void*, uint);
 int atoi(const char*);
+
+// uthread.c
+typedef struct { volatile uint locked; } lock_t;
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
+void lock_init(lock_t*);
+void lock_acquire(lock_t*);
+void lock_release(lock_t*);
+typedef struct { volatile uint state; } mutex_t;
+typedef struct { volatile uint seq, nwait; } cond_t;
+void mutex_init(mutex_t*);
+void mutex_lock(mutex_t*);
+int mutex_trylock(mutex_t*);
+void mutex_unlock(mutex_t*);
+void cond_init(cond_t*);
+void cond_wait(cond_t*, mutex_t*);
+void cond_signal(cond_t*);
+void cond_broadcast(cond_t*);
@@ -0,0 +1,7469 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 19 55 00 00       	push   $0x5519
+      16:	6a 01                	push   $0x1
+      18:	e8 d3 3e 00 00       	call   3ef0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 2d 55 00 00       	push   $0x552d
+      26:	e8 68 3c 00 00       	call   3c93 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 d8 5c 00 00       	push   $0x5cd8
+      39:	6a 01                	push   $0x1
+      3b:	e8 b0 3e 00 00       	call   3ef0 <printf>
+    exit();
+      40:	e8 0e 3c 00 00       	call   3c53 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 2d 55 00 00       	push   $0x552d
+      51:	e8 3d 3c 00 00       	call   3c93 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 1d 3c 00 00       	call   3c7b <close>
+
+  argptest();
+      5e:	e8 1d 39 00 00       	call   3980 <argptest>
+  createdelete();
+      63:	e8 c8 11 00 00       	call   1230 <createdelete>
+  linkunlink();
+      68:	e8 63 1a 00 00       	call   1ad0 <linkunlink>
+  concreate();
+      6d:	e8 5e 17 00 00       	call   17d0 <concreate>
+  fourfiles();
+      72:	e8 b9 0f 00 00       	call   1030 <fourfiles>
+  sharedfd();
+      77:	e8 f4 0d 00 00       	call   e70 <sharedfd>
+
+  bigargtest();
+      7c:	e8 1f 32 00 00       	call   32a0 <bigargtest>
+  bigwrite();
+      81:	e8 6a 23 00 00       	call   23f0 <bigwrite>
+  bigargtest();
+      86:	e8 15 32 00 00       	call   32a0 <bigargtest>
+  bsstest();
+      8b:	e8 a0 31 00 00       	call   3230 <bsstest>
+  sbrktest();
+      90:	e8 9b 2c 00 00       	call   2d30 <sbrktest>
+  validatetest();
+      95:	e8 e6 30 00 00       	call   3180 <validatetest>
+
+  opentest();
+      9a:	e8 61 03 00 00       	call   400 <opentest>
+  writetest();
+      9f:	e8 ec 03 00 00       	call   490 <writetest>
+  writetest1();
+      a4:	e8 c7 05 00 00       	call   670 <writetest1>
+  createtest();
+      a9:	e8 92 07 00 00       	call   840 <createtest>
+
+  openiputtest();
+      ae:	e8 4d 02 00 00       	call   300 <openiputtest>
+  exitiputtest();
+      b3:	e8 48 01 00 00       	call   200 <exitiputtest>
+  iputtest();
+      b8:	e8 63 00 00 00       	call   120 <iputtest>
+
+  mem();
+      bd:	e8 de 0c 00 00       	call   da0 <mem>
+  pipe1();
+      c2:	e8 59 09 00 00       	call   a20 <pipe1>
+  preempt();
+      c7:	e8 f4 0a 00 00       	call   bc0 <preempt>
+  exitwait();
+      cc:	e8 4f 0c 00 00       	call   d20 <exitwait>
+
+  rmdot();
+      d1:	e8 0a 27 00 00       	call   27e0 <rmdot>
+  fourteen();
+      d6:	e8 c5 25 00 00       	call   26a0 <fourteen>
+  bigfile();
+      db:	e8 f0 23 00 00       	call   24d0 <bigfile>
+  subdir();
+      e0:	e8 2b 1c 00 00       	call   1d10 <subdir>
+  linktest();
+      e5:	e8 d6 14 00 00       	call   15c0 <linktest>
+  unlinkread();
+      ea:	e8 41 13 00 00       	call   1430 <unlinkread>
+  dirfile();
+      ef:	e8 6c 28 00 00       	call   2960 <dirfile>
+  iref();
+      f4:	e8 67 2a 00 00       	call   2b60 <iref>
+  forktest();
+      f9:	e8 82 2b 00 00       	call   2c80 <forktest>
+  bigdir(); // slow
+      fe:	e8 dd 1a 00 00       	call   1be0 <bigdir>
+
+  splicetest();
+     103:	e8 68 34 00 00       	call   3570 <splicetest>
+
+  uio();
+     108:	e8 03 38 00 00       	call   3910 <uio>
+
+  exectest();
+     10d:	e8 be 08 00 00       	call   9d0 <exectest>
+
+  exit();
+     112:	e8 3c 3b 00 00       	call   3c53 <exit>
+     117:	66 90                	xchg   %ax,%ax
+     119:	66 90                	xchg   %ax,%ax
+     11b:	66 90                	xchg   %ax,%ax
+     11d:	66 90                	xchg   %ax,%ax
+     11f:	90                   	nop
+
+00000120 <iputtest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     126:	68 f4 44 00 00       	push   $0x44f4
+     12b:	ff 35 94 67 00 00    	push   0x6794
+     131:	e8 ba 3d 00 00       	call   3ef0 <printf>
+  if(mkdir("iputdir") < 0){
+     136:	c7 04 24 87 44 00 00 	movl   $0x4487,(%esp)
+     13d:	e8 79 3b 00 00       	call   3cbb <mkdir>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	78 58                	js     1a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     149:	83 ec 0c             	sub    $0xc,%esp
+     14c:	68 87 44 00 00       	push   $0x4487
+     151:	e8 6d 3b 00 00       	call   3cc3 <chdir>
+     156:	83 c4 10             	add    $0x10,%esp
+     159:	85 c0                	test   %eax,%eax
+     15b:	0f 88 85 00 00 00    	js     1e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     161:	83 ec 0c             	sub    $0xc,%esp
+     164:	68 84 44 00 00       	push   $0x4484
+     169:	e8 35 3b 00 00       	call   3ca3 <unlink>
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	78 5a                	js     1cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	68 a9 44 00 00       	push   $0x44a9
+     17d:	e8 41 3b 00 00       	call   3cc3 <chdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 2f                	js     1b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     189:	83 ec 08             	sub    $0x8,%esp
+     18c:	68 2c 45 00 00       	push   $0x452c
+     191:	ff 35 94 67 00 00    	push   0x6794
+     197:	e8 54 3d 00 00       	call   3ef0 <printf>
+}
+     19c:	83 c4 10             	add    $0x10,%esp
+     19f:	c9                   	leave
+     1a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1a1:	50                   	push   %eax
+     1a2:	50                   	push   %eax
+     1a3:	68 60 44 00 00       	push   $0x4460
+     1a8:	ff 35 94 67 00 00    	push   0x6794
+     1ae:	e8 3d 3d 00 00       	call   3ef0 <printf>
+    exit();
+     1b3:	e8 9b 3a 00 00       	call   3c53 <exit>
+    printf(stdout, "chdir / failed\n");
+     1b8:	50                   	push   %eax
+     1b9:	50                   	push   %eax
+     1ba:	68 ab 44 00 00       	push   $0x44ab
+     1bf:	ff 35 94 67 00 00    	push   0x6794
+     1c5:	e8 26 3d 00 00       	call   3ef0 <printf>
+    exit();
+     1ca:	e8 84 3a 00 00       	call   3c53 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1cf:	52                   	push   %edx
+     1d0:	52                   	push   %edx
+     1d1:	68 8f 44 00 00       	push   $0x448f
+     1d6:	ff 35 94 67 00 00    	push   0x6794
+     1dc:	e8 0f 3d 00 00       	call   3ef0 <printf>
+    exit();
+     1e1:	e8 6d 3a 00 00       	call   3c53 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1e6:	51                   	push   %ecx
+     1e7:	51                   	push   %ecx
+     1e8:	68 6e 44 00 00       	push   $0x446e
+     1ed:	ff 35 94 67 00 00    	push   0x6794
+     1f3:	e8 f8 3c 00 00       	call   3ef0 <printf>
+    exit();
+     1f8:	e8 56 3a 00 00       	call   3c53 <exit>
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <exitiputtest>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     206:	68 bb 44 00 00       	push   $0x44bb
+     20b:	ff 35 94 67 00 00    	push   0x6794
+     211:	e8 da 3c 00 00       	call   3ef0 <printf>
+  pid = fork();
+     216:	e8 30 3a 00 00       	call   3c4b <fork>
+  if(pid < 0){
+     21b:	83 c4 10             	add    $0x10,%esp
+     21e:	85 c0                	test   %eax,%eax
+     220:	0f 88 8a 00 00 00    	js     2b0 <exitiputtest+0xb0>
+  if(pid == 0){
+     226:	75 50                	jne    278 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     228:	83 ec 0c             	sub    $0xc,%esp
+     22b:	68 87 44 00 00       	push   $0x4487
+     230:	e8 86 3a 00 00       	call   3cbb <mkdir>
+     235:	83 c4 10             	add    $0x10,%esp
+     238:	85 c0                	test   %eax,%eax
+     23a:	0f 88 87 00 00 00    	js     2c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     240:	83 ec 0c             	sub    $0xc,%esp
+     243:	68 87 44 00 00       	push   $0x4487
+     248:	e8 76 3a 00 00       	call   3cc3 <chdir>
+     24d:	83 c4 10             	add    $0x10,%esp
+     250:	85 c0                	test   %eax,%eax
+     252:	0f 88 86 00 00 00    	js     2de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 84 44 00 00       	push   $0x4484
+     260:	e8 3e 3a 00 00       	call   3ca3 <unlink>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	78 2c                	js     298 <exitiputtest+0x98>
+    exit();
+     26c:	e8 e2 39 00 00       	call   3c53 <exit>
+     271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     278:	e8 de 39 00 00       	call   3c5b <wait>
+  printf(stdout, "exitiput test ok\n");
+     27d:	83 ec 08             	sub    $0x8,%esp
+     280:	68 de 44 00 00       	push   $0x44de
+     285:	ff 35 94 67 00 00    	push   0x6794
+     28b:	e8 60 3c 00 00       	call   3ef0 <printf>
+}
+     290:	83 c4 10             	add    $0x10,%esp
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     298:	83 ec 08             	sub    $0x8,%esp
+     29b:	68 8f 44 00 00       	push   $0x448f
+     2a0:	ff 35 94 67 00 00    	push   0x6794
+     2a6:	e8 45 3c 00 00       	call   3ef0 <printf>
+      exit();
+     2ab:	e8 a3 39 00 00       	call   3c53 <exit>
+    printf(stdout, "fork failed\n");
+     2b0:	51                   	push   %ecx
+     2b1:	51                   	push   %ecx
+     2b2:	68 a1 53 00 00       	push   $0x53a1
+     2b7:	ff 35 94 67 00 00    	push   0x6794
+     2bd:	e8 2e 3c 00 00       	call   3ef0 <printf>
+    exit();
+     2c2:	e8 8c 39 00 00       	call   3c53 <exit>
+      printf(stdout, "mkdir failed\n");
+     2c7:	52                   	push   %edx
+     2c8:	52                   	push   %edx
+     2c9:	68 60 44 00 00       	push   $0x4460
+     2ce:	ff 35 94 67 00 00    	push   0x6794
+     2d4:	e8 17 3c 00 00       	call   3ef0 <printf>
+      exit();
+     2d9:	e8 75 39 00 00       	call   3c53 <exit>
+      printf(stdout, "child chdir failed\n");
+     2de:	50                   	push   %eax
+     2df:	50                   	push   %eax
+     2e0:	68 ca 44 00 00       	push   $0x44ca
+     2e5:	ff 35 94 67 00 00    	push   0x6794
+     2eb:	e8 00 3c 00 00       	call   3ef0 <printf>
+      exit();
+     2f0:	e8 5e 39 00 00       	call   3c53 <exit>
+     2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <openiputtest>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     306:	68 f0 44 00 00       	push   $0x44f0
+     30b:	ff 35 94 67 00 00    	push   0x6794
+     311:	e8 da 3b 00 00       	call   3ef0 <printf>
+  if(mkdir("oidir") < 0){
+     316:	c7 04 24 ff 44 00 00 	movl   $0x44ff,(%esp)
+     31d:	e8 99 39 00 00       	call   3cbb <mkdir>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	0f 88 9f 00 00 00    	js     3cc <openiputtest+0xcc>
+  pid = fork();
+     32d:	e8 19 39 00 00       	call   3c4b <fork>
+  if(pid < 0){
+     332:	85 c0                	test   %eax,%eax
+     334:	78 7f                	js     3b5 <openiputtest+0xb5>
+  if(pid == 0){
+     336:	75 38                	jne    370 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	6a 02                	push   $0x2
+     33d:	68 ff 44 00 00       	push   $0x44ff
+     342:	e8 4c 39 00 00       	call   3c93 <open>
+    if(fd >= 0){
+     347:	83 c4 10             	add    $0x10,%esp
+     34a:	85 c0                	test   %eax,%eax
+     34c:	78 62                	js     3b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 4c 55 00 00       	push   $0x554c
+     356:	ff 35 94 67 00 00    	push   0x6794
+     35c:	e8 8f 3b 00 00       	call   3ef0 <printf>
+      exit();
+     361:	e8 ed 38 00 00       	call   3c53 <exit>
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     370:	83 ec 0c             	sub    $0xc,%esp
+     373:	6a 01                	push   $0x1
+     375:	e8 69 39 00 00       	call   3ce3 <sleep>
+  if(unlink("oidir") != 0){
+     37a:	c7 04 24 ff 44 00 00 	movl   $0x44ff,(%esp)
+     381:	e8 1d 39 00 00       	call   3ca3 <unlink>
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	85 c0                	test   %eax,%eax
+     38b:	75 56                	jne    3e3 <openiputtest+0xe3>
+  wait();
+     38d:	e8 c9 38 00 00       	call   3c5b <wait>
+  printf(stdout, "openiput test ok\n");
+     392:	83 ec 08             	sub    $0x8,%esp
+     395:	68 28 45 00 00       	push   $0x4528
+     39a:	ff 35 94 67 00 00    	push   0x6794
+     3a0:	e8 4b 3b 00 00       	call   3ef0 <printf>
+}
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	c9                   	leave
+     3a9:	c3                   	ret
+     3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3b0:	e8 9e 38 00 00       	call   3c53 <exit>
+    printf(stdout, "fork failed\n");
+     3b5:	52                   	push   %edx
+     3b6:	52                   	push   %edx
+     3b7:	68 a1 53 00 00       	push   $0x53a1
+     3bc:	ff 35 94 67 00 00    	push   0x6794
+     3c2:	e8 29 3b 00 00       	call   3ef0 <printf>
+    exit();
+     3c7:	e8 87 38 00 00       	call   3c53 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3cc:	51                   	push   %ecx
+     3cd:	51                   	push   %ecx
+     3ce:	68 05 45 00 00       	push   $0x4505
+     3d3:	ff 35 94 67 00 00    	push   0x6794
+     3d9:	e8 12 3b 00 00       	call   3ef0 <printf>
+    exit();
+     3de:	e8 70 38 00 00       	call   3c53 <exit>
+    printf(stdout, "unlink failed\n");
+     3e3:	50                   	push   %eax
+     3e4:	50                   	push   %eax
+     3e5:	68 19 45 00 00       	push   $0x4519
+     3ea:	ff 35 94 67 00 00    	push   0x6794
+     3f0:	e8 fb 3a 00 00       	call   3ef0 <printf>
+    exit();
+     3f5:	e8 59 38 00 00       	call   3c53 <exit>
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <opentest>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     406:	68 3a 45 00 00       	push   $0x453a
+     40b:	ff 35 94 67 00 00    	push   0x6794
+     411:	e8 da 3a 00 00       	call   3ef0 <printf>
+  fd = open("echo", 0);
+     416:	58                   	pop    %eax
+     417:	5a                   	pop    %edx
+     418:	6a 00                	push   $0x0
+     41a:	68 45 45 00 00       	push   $0x4545
+     41f:	e8 6f 38 00 00       	call   3c93 <open>
+  if(fd < 0){
+     424:	83 c4 10             	add    $0x10,%esp
+     427:	85 c0                	test   %eax,%eax
+     429:	78 36                	js     461 <opentest+0x61>
+  close(fd);
+     42b:	83 ec 0c             	sub    $0xc,%esp
+     42e:	50                   	push   %eax
+     42f:	e8 47 38 00 00       	call   3c7b <close>
+  fd = open("doesnotexist", 0);
+     434:	5a                   	pop    %edx
+     435:	59                   	pop    %ecx
+     436:	6a 00                	push   $0x0
+     438:	68 5d 45 00 00       	push   $0x455d
+     43d:	e8 51 38 00 00       	call   3c93 <open>
+  if(fd >= 0){
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	79 2f                	jns    478 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	68 88 45 00 00       	push   $0x4588
+     451:	ff 35 94 67 00 00    	push   0x6794
+     457:	e8 94 3a 00 00       	call   3ef0 <printf>
+}
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	c9                   	leave
+     460:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     461:	50                   	push   %eax
+     462:	50                   	push   %eax
+     463:	68 4a 45 00 00       	push   $0x454a
+     468:	ff 35 94 67 00 00    	push   0x6794
+     46e:	e8 7d 3a 00 00       	call   3ef0 <printf>
+    exit();
+     473:	e8 db 37 00 00       	call   3c53 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     478:	50                   	push   %eax
+     479:	50                   	push   %eax
+     47a:	68 6a 45 00 00       	push   $0x456a
+     47f:	ff 35 94 67 00 00    	push   0x6794
+     485:	e8 66 3a 00 00       	call   3ef0 <printf>
+    exit();
+     48a:	e8 c4 37 00 00       	call   3c53 <exit>
+     48f:	90                   	nop
+
+00000490 <writetest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	68 96 45 00 00       	push   $0x4596
+     49d:	ff 35 94 67 00 00    	push   0x6794
+     4a3:	e8 48 3a 00 00       	call   3ef0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4a8:	58                   	pop    %eax
+     4a9:	5a                   	pop    %edx
+     4aa:	68 02 02 00 00       	push   $0x202
+     4af:	68 a7 45 00 00       	push   $0x45a7
+     4b4:	e8 da 37 00 00       	call   3c93 <open>
+  if(fd >= 0){
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	85 c0                	test   %eax,%eax
+     4be:	0f 88 88 01 00 00    	js     64c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4c4:	83 ec 08             	sub    $0x8,%esp
+     4c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4cb:	68 ad 45 00 00       	push   $0x45ad
+     4d0:	ff 35 94 67 00 00    	push   0x6794
+     4d6:	e8 15 3a 00 00       	call   3ef0 <printf>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	6a 0a                	push   $0xa
+     4e5:	68 e4 45 00 00       	push   $0x45e4
+     4ea:	56                   	push   %esi
+     4eb:	e8 83 37 00 00       	call   3c73 <write>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	83 f8 0a             	cmp    $0xa,%eax
+     4f6:	0f 85 d9 00 00 00    	jne    5d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	6a 0a                	push   $0xa
+     501:	68 ef 45 00 00       	push   $0x45ef
+     506:	56                   	push   %esi
+     507:	e8 67 37 00 00       	call   3c73 <write>
+     50c:	83 c4 10             	add    $0x10,%esp
+     50f:	83 f8 0a             	cmp    $0xa,%eax
+     512:	0f 85 d6 00 00 00    	jne    5ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     518:	83 c3 01             	add    $0x1,%ebx
+     51b:	83 fb 64             	cmp    $0x64,%ebx
+     51e:	75 c0                	jne    4e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     520:	83 ec 08             	sub    $0x8,%esp
+     523:	68 fa 45 00 00       	push   $0x45fa
+     528:	ff 35 94 67 00 00    	push   0x6794
+     52e:	e8 bd 39 00 00       	call   3ef0 <printf>
+  close(fd);
+     533:	89 34 24             	mov    %esi,(%esp)
+     536:	e8 40 37 00 00       	call   3c7b <close>
+  fd = open("small", O_RDONLY);
+     53b:	5b                   	pop    %ebx
+     53c:	5e                   	pop    %esi
+     53d:	6a 00                	push   $0x0
+     53f:	68 a7 45 00 00       	push   $0x45a7
+     544:	e8 4a 37 00 00       	call   3c93 <open>
+  if(fd >= 0){
+     549:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     54c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     54e:	85 c0                	test   %eax,%eax
+     550:	0f 88 b1 00 00 00    	js     607 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     556:	83 ec 08             	sub    $0x8,%esp
+     559:	68 05 46 00 00       	push   $0x4605
+     55e:	ff 35 94 67 00 00    	push   0x6794
+     564:	e8 87 39 00 00       	call   3ef0 <printf>
+  i = read(fd, buf, 2000);
+     569:	83 c4 0c             	add    $0xc,%esp
+     56c:	68 d0 07 00 00       	push   $0x7d0
+     571:	68 e0 8e 00 00       	push   $0x8ee0
+     576:	53                   	push   %ebx
+     577:	e8 ef 36 00 00       	call   3c6b <read>
+  if(i == 2000){
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     584:	0f 85 94 00 00 00    	jne    61e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     58a:	83 ec 08             	sub    $0x8,%esp
+     58d:	68 39 46 00 00       	push   $0x4639
+     592:	ff 35 94 67 00 00    	push   0x6794
+     598:	e8 53 39 00 00       	call   3ef0 <printf>
+  close(fd);
+     59d:	89 1c 24             	mov    %ebx,(%esp)
+     5a0:	e8 d6 36 00 00       	call   3c7b <close>
+  if(unlink("small") < 0){
+     5a5:	c7 04 24 a7 45 00 00 	movl   $0x45a7,(%esp)
+     5ac:	e8 f2 36 00 00       	call   3ca3 <unlink>
+     5b1:	83 c4 10             	add    $0x10,%esp
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	78 7d                	js     635 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5b8:	83 ec 08             	sub    $0x8,%esp
+     5bb:	68 61 46 00 00       	push   $0x4661
+     5c0:	ff 35 94 67 00 00    	push   0x6794
+     5c6:	e8 25 39 00 00       	call   3ef0 <printf>
+}
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5d1:	5b                   	pop    %ebx
+     5d2:	5e                   	pop    %esi
+     5d3:	5d                   	pop    %ebp
+     5d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5d5:	83 ec 04             	sub    $0x4,%esp
+     5d8:	53                   	push   %ebx
+     5d9:	68 70 55 00 00       	push   $0x5570
+     5de:	ff 35 94 67 00 00    	push   0x6794
+     5e4:	e8 07 39 00 00       	call   3ef0 <printf>
+      exit();
+     5e9:	e8 65 36 00 00       	call   3c53 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5ee:	83 ec 04             	sub    $0x4,%esp
+     5f1:	53                   	push   %ebx
+     5f2:	68 94 55 00 00       	push   $0x5594
+     5f7:	ff 35 94 67 00 00    	push   0x6794
+     5fd:	e8 ee 38 00 00       	call   3ef0 <printf>
+      exit();
+     602:	e8 4c 36 00 00       	call   3c53 <exit>
+    printf(stdout, "error: open small failed!\n");
+     607:	51                   	push   %ecx
+     608:	51                   	push   %ecx
+     609:	68 1e 46 00 00       	push   $0x461e
+     60e:	ff 35 94 67 00 00    	push   0x6794
+     614:	e8 d7 38 00 00       	call   3ef0 <printf>
+    exit();
+     619:	e8 35 36 00 00       	call   3c53 <exit>
+    printf(stdout, "read failed\n");
+     61e:	52                   	push   %edx
+     61f:	52                   	push   %edx
+     620:	68 65 49 00 00       	push   $0x4965
+     625:	ff 35 94 67 00 00    	push   0x6794
+     62b:	e8 c0 38 00 00       	call   3ef0 <printf>
+    exit();
+     630:	e8 1e 36 00 00       	call   3c53 <exit>
+    printf(stdout, "unlink small failed\n");
+     635:	50                   	push   %eax
+     636:	50                   	push   %eax
+     637:	68 4c 46 00 00       	push   $0x464c
+     63c:	ff 35 94 67 00 00    	push   0x6794
+     642:	e8 a9 38 00 00       	call   3ef0 <printf>
+    exit();
+     647:	e8 07 36 00 00       	call   3c53 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     64c:	50                   	push   %eax
+     64d:	50                   	push   %eax
+     64e:	68 c8 45 00 00       	push   $0x45c8
+     653:	ff 35 94 67 00 00    	push   0x6794
+     659:	e8 92 38 00 00       	call   3ef0 <printf>
+    exit();
+     65e:	e8 f0 35 00 00       	call   3c53 <exit>
+     663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <writetest1>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     675:	83 ec 08             	sub    $0x8,%esp
+     678:	68 75 46 00 00       	push   $0x4675
+     67d:	ff 35 94 67 00 00    	push   0x6794
+     683:	e8 68 38 00 00       	call   3ef0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     688:	58                   	pop    %eax
+     689:	5a                   	pop    %edx
+     68a:	68 02 02 00 00       	push   $0x202
+     68f:	68 ef 46 00 00       	push   $0x46ef
+     694:	e8 fa 35 00 00       	call   3c93 <open>
+  if(fd < 0){
+     699:	83 c4 10             	add    $0x10,%esp
+     69c:	85 c0                	test   %eax,%eax
+     69e:	0f 88 61 01 00 00    	js     805 <writetest1+0x195>
+     6a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6a6:	31 db                	xor    %ebx,%ebx
+     6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6b3:	89 1d e0 8e 00 00    	mov    %ebx,0x8ee0
+    if(write(fd, buf, 512) != 512){
+     6b9:	68 00 02 00 00       	push   $0x200
+     6be:	68 e0 8e 00 00       	push   $0x8ee0
+     6c3:	56                   	push   %esi
+     6c4:	e8 aa 35 00 00       	call   3c73 <write>
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6d1:	0f 85 b3 00 00 00    	jne    78a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6d7:	83 c3 01             	add    $0x1,%ebx
+     6da:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     6e0:	75 ce                	jne    6b0 <writetest1+0x40>
+  close(fd);
+     6e2:	83 ec 0c             	sub    $0xc,%esp
+     6e5:	56                   	push   %esi
+     6e6:	e8 90 35 00 00       	call   3c7b <close>
+  fd = open("big", O_RDONLY);
+     6eb:	5b                   	pop    %ebx
+     6ec:	5e                   	pop    %esi
+     6ed:	6a 00                	push   $0x0
+     6ef:	68 ef 46 00 00       	push   $0x46ef
+     6f4:	e8 9a 35 00 00       	call   3c93 <open>
+  if(fd < 0){
+     6f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     6fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     6fe:	85 c0                	test   %eax,%eax
+     700:	0f 88 e8 00 00 00    	js     7ee <writetest1+0x17e>
+  n = 0;
+     706:	31 f6                	xor    %esi,%esi
+     708:	eb 1d                	jmp    727 <writetest1+0xb7>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     710:	3d 00 02 00 00       	cmp    $0x200,%eax
+     715:	0f 85 9f 00 00 00    	jne    7ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     71b:	a1 e0 8e 00 00       	mov    0x8ee0,%eax
+     720:	39 f0                	cmp    %esi,%eax
+     722:	75 7f                	jne    7a3 <writetest1+0x133>
+    n++;
+     724:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     727:	83 ec 04             	sub    $0x4,%esp
+     72a:	68 00 02 00 00       	push   $0x200
+     72f:	68 e0 8e 00 00       	push   $0x8ee0
+     734:	53                   	push   %ebx
+     735:	e8 31 35 00 00       	call   3c6b <read>
+    if(i == 0){
+     73a:	83 c4 10             	add    $0x10,%esp
+     73d:	85 c0                	test   %eax,%eax
+     73f:	75 cf                	jne    710 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     741:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     747:	0f 84 86 00 00 00    	je     7d3 <writetest1+0x163>
+  close(fd);
+     74d:	83 ec 0c             	sub    $0xc,%esp
+     750:	53                   	push   %ebx
+     751:	e8 25 35 00 00       	call   3c7b <close>
+  if(unlink("big") < 0){
+     756:	c7 04 24 ef 46 00 00 	movl   $0x46ef,(%esp)
+     75d:	e8 41 35 00 00       	call   3ca3 <unlink>
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	0f 88 af 00 00 00    	js     81c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     76d:	83 ec 08             	sub    $0x8,%esp
+     770:	68 16 47 00 00       	push   $0x4716
+     775:	ff 35 94 67 00 00    	push   0x6794
+     77b:	e8 70 37 00 00       	call   3ef0 <printf>
+}
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5d                   	pop    %ebp
+     789:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     78a:	83 ec 04             	sub    $0x4,%esp
+     78d:	53                   	push   %ebx
+     78e:	68 9f 46 00 00       	push   $0x469f
+     793:	ff 35 94 67 00 00    	push   0x6794
+     799:	e8 52 37 00 00       	call   3ef0 <printf>
+      exit();
+     79e:	e8 b0 34 00 00       	call   3c53 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7a3:	50                   	push   %eax
+     7a4:	56                   	push   %esi
+     7a5:	68 b8 55 00 00       	push   $0x55b8
+     7aa:	ff 35 94 67 00 00    	push   0x6794
+     7b0:	e8 3b 37 00 00       	call   3ef0 <printf>
+      exit();
+     7b5:	e8 99 34 00 00       	call   3c53 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	50                   	push   %eax
+     7be:	68 f3 46 00 00       	push   $0x46f3
+     7c3:	ff 35 94 67 00 00    	push   0x6794
+     7c9:	e8 22 37 00 00       	call   3ef0 <printf>
+      exit();
+     7ce:	e8 80 34 00 00       	call   3c53 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7d3:	52                   	push   %edx
+     7d4:	68 8b 00 00 00       	push   $0x8b
+     7d9:	68 d6 46 00 00       	push   $0x46d6
+     7de:	ff 35 94 67 00 00    	push   0x6794
+     7e4:	e8 07 37 00 00       	call   3ef0 <printf>
+        exit();
+     7e9:	e8 65 34 00 00       	call   3c53 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7ee:	51                   	push   %ecx
+     7ef:	51                   	push   %ecx
+     7f0:	68 bd 46 00 00       	push   $0x46bd
+     7f5:	ff 35 94 67 00 00    	push   0x6794
+     7fb:	e8 f0 36 00 00       	call   3ef0 <printf>
+    exit();
+     800:	e8 4e 34 00 00       	call   3c53 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     805:	50                   	push   %eax
+     806:	50                   	push   %eax
+     807:	68 85 46 00 00       	push   $0x4685
+     80c:	ff 35 94 67 00 00    	push   0x6794
+     812:	e8 d9 36 00 00       	call   3ef0 <printf>
+    exit();
+     817:	e8 37 34 00 00       	call   3c53 <exit>
+    printf(stdout, "unlink big failed\n");
+     81c:	50                   	push   %eax
+     81d:	50                   	push   %eax
+     81e:	68 03 47 00 00       	push   $0x4703
+     823:	ff 35 94 67 00 00    	push   0x6794
+     829:	e8 c2 36 00 00       	call   3ef0 <printf>
+    exit();
+     82e:	e8 20 34 00 00       	call   3c53 <exit>
+     833:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000840 <createtest>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+  name[2] = '\0';
+     844:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     849:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     84c:	68 d8 55 00 00       	push   $0x55d8
+     851:	ff 35 94 67 00 00    	push   0x6794
+     857:	e8 94 36 00 00       	call   3ef0 <printf>
+  name[0] = 'a';
+     85c:	c6 05 d0 8e 00 00 61 	movb   $0x61,0x8ed0
+  name[2] = '\0';
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	c6 05 d2 8e 00 00 00 	movb   $0x0,0x8ed2
+  for(i = 0; i < 52; i++){
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     870:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     873:	88 1d d1 8e 00 00    	mov    %bl,0x8ed1
+  for(i = 0; i < 52; i++){
+     879:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     87c:	68 02 02 00 00       	push   $0x202
+     881:	68 d0 8e 00 00       	push   $0x8ed0
+     886:	e8 08 34 00 00       	call   3c93 <open>
+    close(fd);
+     88b:	89 04 24             	mov    %eax,(%esp)
+     88e:	e8 e8 33 00 00       	call   3c7b <close>
+  for(i = 0; i < 52; i++){
+     893:	83 c4 10             	add    $0x10,%esp
+     896:	80 fb 64             	cmp    $0x64,%bl
+     899:	75 d5                	jne    870 <createtest+0x30>
+  name[0] = 'a';
+     89b:	c6 05 d0 8e 00 00 61 	movb   $0x61,0x8ed0
+  name[2] = '\0';
+     8a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8a7:	c6 05 d2 8e 00 00 00 	movb   $0x0,0x8ed2
+  for(i = 0; i < 52; i++){
+     8ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8b3:	88 1d d1 8e 00 00    	mov    %bl,0x8ed1
+  for(i = 0; i < 52; i++){
+     8b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8bc:	68 d0 8e 00 00       	push   $0x8ed0
+     8c1:	e8 dd 33 00 00       	call   3ca3 <unlink>
+  for(i = 0; i < 52; i++){
+     8c6:	83 c4 10             	add    $0x10,%esp
+     8c9:	80 fb 64             	cmp    $0x64,%bl
+     8cc:	75 e2                	jne    8b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ce:	83 ec 08             	sub    $0x8,%esp
+     8d1:	68 00 56 00 00       	push   $0x5600
+     8d6:	ff 35 94 67 00 00    	push   0x6794
+     8dc:	e8 0f 36 00 00       	call   3ef0 <printf>
+}
+     8e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	c9                   	leave
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <dirtest>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8f6:	68 24 47 00 00       	push   $0x4724
+     8fb:	ff 35 94 67 00 00    	push   0x6794
+     901:	e8 ea 35 00 00       	call   3ef0 <printf>
+  if(mkdir("dir0") < 0){
+     906:	c7 04 24 30 47 00 00 	movl   $0x4730,(%esp)
+     90d:	e8 a9 33 00 00       	call   3cbb <mkdir>
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	78 58                	js     971 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     919:	83 ec 0c             	sub    $0xc,%esp
+     91c:	68 30 47 00 00       	push   $0x4730
+     921:	e8 9d 33 00 00       	call   3cc3 <chdir>
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	85 c0                	test   %eax,%eax
+     92b:	0f 88 85 00 00 00    	js     9b6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     931:	83 ec 0c             	sub    $0xc,%esp
+     934:	68 d5 4c 00 00       	push   $0x4cd5
+     939:	e8 85 33 00 00       	call   3cc3 <chdir>
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	85 c0                	test   %eax,%eax
+     943:	78 5a                	js     99f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     945:	83 ec 0c             	sub    $0xc,%esp
+     948:	68 30 47 00 00       	push   $0x4730
+     94d:	e8 51 33 00 00       	call   3ca3 <unlink>
+     952:	83 c4 10             	add    $0x10,%esp
+     955:	85 c0                	test   %eax,%eax
+     957:	78 2f                	js     988 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     959:	83 ec 08             	sub    $0x8,%esp
+     95c:	68 6d 47 00 00       	push   $0x476d
+     961:	ff 35 94 67 00 00    	push   0x6794
+     967:	e8 84 35 00 00       	call   3ef0 <printf>
+}
+     96c:	83 c4 10             	add    $0x10,%esp
+     96f:	c9                   	leave
+     970:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     971:	50                   	push   %eax
+     972:	50                   	push   %eax
+     973:	68 60 44 00 00       	push   $0x4460
+     978:	ff 35 94 67 00 00    	push   0x6794
+     97e:	e8 6d 35 00 00       	call   3ef0 <printf>
+    exit();
+     983:	e8 cb 32 00 00       	call   3c53 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     988:	50                   	push   %eax
+     989:	50                   	push   %eax
+     98a:	68 59 47 00 00       	push   $0x4759
+     98f:	ff 35 94 67 00 00    	push   0x6794
+     995:	e8 56 35 00 00       	call   3ef0 <printf>
+    exit();
+     99a:	e8 b4 32 00 00       	call   3c53 <exit>
+    printf(stdout, "chdir .. failed\n");
+     99f:	52                   	push   %edx
+     9a0:	52                   	push   %edx
+     9a1:	68 48 47 00 00       	push   $0x4748
+     9a6:	ff 35 94 67 00 00    	push   0x6794
+     9ac:	e8 3f 35 00 00       	call   3ef0 <printf>
+    exit();
+     9b1:	e8 9d 32 00 00       	call   3c53 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9b6:	51                   	push   %ecx
+     9b7:	51                   	push   %ecx
+     9b8:	68 35 47 00 00       	push   $0x4735
+     9bd:	ff 35 94 67 00 00    	push   0x6794
+     9c3:	e8 28 35 00 00       	call   3ef0 <printf>
+    exit();
+     9c8:	e8 86 32 00 00       	call   3c53 <exit>
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <exectest>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9d6:	68 7c 47 00 00       	push   $0x477c
+     9db:	ff 35 94 67 00 00    	push   0x6794
+     9e1:	e8 0a 35 00 00       	call   3ef0 <printf>
+  if(exec("echo", echoargv) < 0){
+     9e6:	5a                   	pop    %edx
+     9e7:	59                   	pop    %ecx
+     9e8:	68 98 67 00 00       	push   $0x6798
+     9ed:	68 45 45 00 00       	push   $0x4545
+     9f2:	e8 94 32 00 00       	call   3c8b <exec>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	85 c0                	test   %eax,%eax
+     9fc:	78 02                	js     a00 <exectest+0x30>
+}
+     9fe:	c9                   	leave
+     9ff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a00:	50                   	push   %eax
+     a01:	50                   	push   %eax
+     a02:	68 87 47 00 00       	push   $0x4787
+     a07:	ff 35 94 67 00 00    	push   0x6794
+     a0d:	e8 de 34 00 00       	call   3ef0 <printf>
+    exit();
+     a12:	e8 3c 32 00 00       	call   3c53 <exit>
+     a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <pipe1>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a25:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a28:	53                   	push   %ebx
+     a29:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a2c:	50                   	push   %eax
+     a2d:	e8 31 32 00 00       	call   3c63 <pipe>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	85 c0                	test   %eax,%eax
+     a37:	0f 85 41 01 00 00    	jne    b7e <pipe1+0x15e>
+     a3d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a3f:	e8 07 32 00 00       	call   3c4b <fork>
+  if(pid == 0){
+     a44:	85 c0                	test   %eax,%eax
+     a46:	0f 84 92 00 00 00    	je     ade <pipe1+0xbe>
+  } else if(pid > 0){
+     a4c:	0f 8e 3f 01 00 00    	jle    b91 <pipe1+0x171>
+    close(fds[1]);
+     a52:	83 ec 0c             	sub    $0xc,%esp
+     a55:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a58:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a5f:	e8 17 32 00 00       	call   3c7b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a64:	83 c4 10             	add    $0x10,%esp
+     a67:	83 ec 04             	sub    $0x4,%esp
+     a6a:	57                   	push   %edi
+     a6b:	68 e0 8e 00 00       	push   $0x8ee0
+     a70:	ff 75 e0             	push   -0x20(%ebp)
+     a73:	e8 f3 31 00 00       	call   3c6b <read>
+     a78:	83 c4 10             	add    $0x10,%esp
+     a7b:	89 c1                	mov    %eax,%ecx
+     a7d:	85 c0                	test   %eax,%eax
+     a7f:	0f 8e b8 00 00 00    	jle    b3d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a85:	89 f0                	mov    %esi,%eax
+     a87:	32 05 e0 8e 00 00    	xor    0x8ee0,%al
+     a8d:	0f b6 c0             	movzbl %al,%eax
+     a90:	85 c0                	test   %eax,%eax
+     a92:	75 30                	jne    ac4 <pipe1+0xa4>
+     a94:	83 c6 01             	add    $0x1,%esi
+     a97:	eb 0f                	jmp    aa8 <pipe1+0x88>
+     a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aa0:	38 90 e0 8e 00 00    	cmp    %dl,0x8ee0(%eax)
+     aa6:	75 1c                	jne    ac4 <pipe1+0xa4>
+     aa8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     aab:	83 c0 01             	add    $0x1,%eax
+     aae:	39 c1                	cmp    %eax,%ecx
+     ab0:	75 ee                	jne    aa0 <pipe1+0x80>
+      cc = cc * 2;
+     ab2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ab4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ab9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     abb:	89 d6                	mov    %edx,%esi
+     abd:	39 c7                	cmp    %eax,%edi
+     abf:	0f 4f f8             	cmovg  %eax,%edi
+     ac2:	eb a3                	jmp    a67 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ac4:	83 ec 08             	sub    $0x8,%esp
+     ac7:	68 b6 47 00 00       	push   $0x47b6
+     acc:	6a 01                	push   $0x1
+     ace:	e8 1d 34 00 00       	call   3ef0 <printf>
+     ad3:	83 c4 10             	add    $0x10,%esp
+}
+     ad6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ad9:	5b                   	pop    %ebx
+     ada:	5e                   	pop    %esi
+     adb:	5f                   	pop    %edi
+     adc:	5d                   	pop    %ebp
+     add:	c3                   	ret
+    close(fds[0]);
+     ade:	83 ec 0c             	sub    $0xc,%esp
+     ae1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ae4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ae6:	e8 90 31 00 00       	call   3c7b <close>
+     aeb:	83 c4 10             	add    $0x10,%esp
+     aee:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     af0:	31 c0                	xor    %eax,%eax
+     af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     af8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     afb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     afe:	88 90 df 8e 00 00    	mov    %dl,0x8edf(%eax)
+      for(i = 0; i < 1033; i++)
+     b04:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b09:	75 ed                	jne    af8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b0b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b14:	68 09 04 00 00       	push   $0x409
+     b19:	68 e0 8e 00 00       	push   $0x8ee0
+     b1e:	ff 75 e4             	push   -0x1c(%ebp)
+     b21:	e8 4d 31 00 00       	call   3c73 <write>
+     b26:	83 c4 10             	add    $0x10,%esp
+     b29:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b2e:	75 74                	jne    ba4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b30:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b36:	75 b8                	jne    af0 <pipe1+0xd0>
+    exit();
+     b38:	e8 16 31 00 00       	call   3c53 <exit>
+    if(total != 5 * 1033){
+     b3d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b43:	75 26                	jne    b6b <pipe1+0x14b>
+    close(fds[0]);
+     b45:	83 ec 0c             	sub    $0xc,%esp
+     b48:	ff 75 e0             	push   -0x20(%ebp)
+     b4b:	e8 2b 31 00 00       	call   3c7b <close>
+    wait();
+     b50:	e8 06 31 00 00       	call   3c5b <wait>
+  printf(1, "pipe1 ok\n");
+     b55:	5a                   	pop    %edx
+     b56:	59                   	pop    %ecx
+     b57:	68 db 47 00 00       	push   $0x47db
+     b5c:	6a 01                	push   $0x1
+     b5e:	e8 8d 33 00 00       	call   3ef0 <printf>
+     b63:	83 c4 10             	add    $0x10,%esp
+     b66:	e9 6b ff ff ff       	jmp    ad6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b6b:	56                   	push   %esi
+     b6c:	53                   	push   %ebx
+     b6d:	68 c4 47 00 00       	push   $0x47c4
+     b72:	6a 01                	push   $0x1
+     b74:	e8 77 33 00 00       	call   3ef0 <printf>
+      exit();
+     b79:	e8 d5 30 00 00       	call   3c53 <exit>
+    printf(1, "pipe() failed\n");
+     b7e:	50                   	push   %eax
+     b7f:	50                   	push   %eax
+     b80:	68 99 47 00 00       	push   $0x4799
+     b85:	6a 01                	push   $0x1
+     b87:	e8 64 33 00 00       	call   3ef0 <printf>
+    exit();
+     b8c:	e8 c2 30 00 00       	call   3c53 <exit>
+    printf(1, "fork() failed\n");
+     b91:	50                   	push   %eax
+     b92:	50                   	push   %eax
+     b93:	68 e5 47 00 00       	push   $0x47e5
+     b98:	6a 01                	push   $0x1
+     b9a:	e8 51 33 00 00       	call   3ef0 <printf>
+    exit();
+     b9f:	e8 af 30 00 00       	call   3c53 <exit>
+        printf(1, "pipe1 oops 1\n");
+     ba4:	57                   	push   %edi
+     ba5:	57                   	push   %edi
+     ba6:	68 a8 47 00 00       	push   $0x47a8
+     bab:	6a 01                	push   $0x1
+     bad:	e8 3e 33 00 00       	call   3ef0 <printf>
+        exit();
+     bb2:	e8 9c 30 00 00       	call   3c53 <exit>
+     bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbe:	66 90                	xchg   %ax,%ax
+
+00000bc0 <preempt>:
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bc9:	68 f4 47 00 00       	push   $0x47f4
+     bce:	6a 01                	push   $0x1
+     bd0:	e8 1b 33 00 00       	call   3ef0 <printf>
+  pid1 = fork();
+     bd5:	e8 71 30 00 00       	call   3c4b <fork>
+  if(pid1 == 0)
+     bda:	83 c4 10             	add    $0x10,%esp
+     bdd:	85 c0                	test   %eax,%eax
+     bdf:	75 07                	jne    be8 <preempt+0x28>
+    for(;;)
+     be1:	eb fe                	jmp    be1 <preempt+0x21>
+     be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     be7:	90                   	nop
+     be8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bea:	e8 5c 30 00 00       	call   3c4b <fork>
+     bef:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     bf1:	85 c0                	test   %eax,%eax
+     bf3:	75 0b                	jne    c00 <preempt+0x40>
+    for(;;)
+     bf5:	eb fe                	jmp    bf5 <preempt+0x35>
+     bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfe:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c06:	50                   	push   %eax
+     c07:	e8 57 30 00 00       	call   3c63 <pipe>
+  pid3 = fork();
+     c0c:	e8 3a 30 00 00       	call   3c4b <fork>
+  if(pid3 == 0){
+     c11:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c14:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c16:	85 c0                	test   %eax,%eax
+     c18:	75 3e                	jne    c58 <preempt+0x98>
+    close(pfds[0]);
+     c1a:	83 ec 0c             	sub    $0xc,%esp
+     c1d:	ff 75 e0             	push   -0x20(%ebp)
+     c20:	e8 56 30 00 00       	call   3c7b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c25:	83 c4 0c             	add    $0xc,%esp
+     c28:	6a 01                	push   $0x1
+     c2a:	68 b9 4d 00 00       	push   $0x4db9
+     c2f:	ff 75 e4             	push   -0x1c(%ebp)
+     c32:	e8 3c 30 00 00       	call   3c73 <write>
+     c37:	83 c4 10             	add    $0x10,%esp
+     c3a:	83 f8 01             	cmp    $0x1,%eax
+     c3d:	0f 85 b8 00 00 00    	jne    cfb <preempt+0x13b>
+    close(pfds[1]);
+     c43:	83 ec 0c             	sub    $0xc,%esp
+     c46:	ff 75 e4             	push   -0x1c(%ebp)
+     c49:	e8 2d 30 00 00       	call   3c7b <close>
+     c4e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c51:	eb fe                	jmp    c51 <preempt+0x91>
+     c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c57:	90                   	nop
+  close(pfds[1]);
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	ff 75 e4             	push   -0x1c(%ebp)
+     c5e:	e8 18 30 00 00       	call   3c7b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c63:	83 c4 0c             	add    $0xc,%esp
+     c66:	68 00 20 00 00       	push   $0x2000
+     c6b:	68 e0 8e 00 00       	push   $0x8ee0
+     c70:	ff 75 e0             	push   -0x20(%ebp)
+     c73:	e8 f3 2f 00 00       	call   3c6b <read>
+     c78:	83 c4 10             	add    $0x10,%esp
+     c7b:	83 f8 01             	cmp    $0x1,%eax
+     c7e:	75 67                	jne    ce7 <preempt+0x127>
+  close(pfds[0]);
+     c80:	83 ec 0c             	sub    $0xc,%esp
+     c83:	ff 75 e0             	push   -0x20(%ebp)
+     c86:	e8 f0 2f 00 00       	call   3c7b <close>
+  printf(1, "kill... ");
+     c8b:	58                   	pop    %eax
+     c8c:	5a                   	pop    %edx
+     c8d:	68 25 48 00 00       	push   $0x4825
+     c92:	6a 01                	push   $0x1
+     c94:	e8 57 32 00 00       	call   3ef0 <printf>
+  kill(pid1);
+     c99:	89 1c 24             	mov    %ebx,(%esp)
+     c9c:	e8 e2 2f 00 00       	call   3c83 <kill>
+  kill(pid2);
+     ca1:	89 34 24             	mov    %esi,(%esp)
+     ca4:	e8 da 2f 00 00       	call   3c83 <kill>
+  kill(pid3);
+     ca9:	89 3c 24             	mov    %edi,(%esp)
+     cac:	e8 d2 2f 00 00       	call   3c83 <kill>
+  printf(1, "wait... ");
+     cb1:	59                   	pop    %ecx
+     cb2:	5b                   	pop    %ebx
+     cb3:	68 2e 48 00 00       	push   $0x482e
+     cb8:	6a 01                	push   $0x1
+     cba:	e8 31 32 00 00       	call   3ef0 <printf>
+  wait();
+     cbf:	e8 97 2f 00 00       	call   3c5b <wait>
+  wait();
+     cc4:	e8 92 2f 00 00       	call   3c5b <wait>
+  wait();
+     cc9:	e8 8d 2f 00 00       	call   3c5b <wait>
+  printf(1, "preempt ok\n");
+     cce:	5e                   	pop    %esi
+     ccf:	5f                   	pop    %edi
+     cd0:	68 37 48 00 00       	push   $0x4837
+     cd5:	6a 01                	push   $0x1
+     cd7:	e8 14 32 00 00       	call   3ef0 <printf>
+     cdc:	83 c4 10             	add    $0x10,%esp
+}
+     cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ce2:	5b                   	pop    %ebx
+     ce3:	5e                   	pop    %esi
+     ce4:	5f                   	pop    %edi
+     ce5:	5d                   	pop    %ebp
+     ce6:	c3                   	ret
+    printf(1, "preempt read error");
+     ce7:	83 ec 08             	sub    $0x8,%esp
+     cea:	68 12 48 00 00       	push   $0x4812
+     cef:	6a 01                	push   $0x1
+     cf1:	e8 fa 31 00 00       	call   3ef0 <printf>
+     cf6:	83 c4 10             	add    $0x10,%esp
+     cf9:	eb e4                	jmp    cdf <preempt+0x11f>
+      printf(1, "preempt write error");
+     cfb:	83 ec 08             	sub    $0x8,%esp
+     cfe:	68 fe 47 00 00       	push   $0x47fe
+     d03:	6a 01                	push   $0x1
+     d05:	e8 e6 31 00 00       	call   3ef0 <printf>
+     d0a:	83 c4 10             	add    $0x10,%esp
+     d0d:	e9 31 ff ff ff       	jmp    c43 <preempt+0x83>
+     d12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d20 <exitwait>:
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	56                   	push   %esi
+     d24:	be 64 00 00 00       	mov    $0x64,%esi
+     d29:	53                   	push   %ebx
+     d2a:	eb 14                	jmp    d40 <exitwait+0x20>
+     d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d30:	74 68                	je     d9a <exitwait+0x7a>
+      if(wait() != pid){
+     d32:	e8 24 2f 00 00       	call   3c5b <wait>
+     d37:	39 d8                	cmp    %ebx,%eax
+     d39:	75 2d                	jne    d68 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d3b:	83 ee 01             	sub    $0x1,%esi
+     d3e:	74 41                	je     d81 <exitwait+0x61>
+    pid = fork();
+     d40:	e8 06 2f 00 00       	call   3c4b <fork>
+     d45:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d47:	85 c0                	test   %eax,%eax
+     d49:	79 e5                	jns    d30 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d4b:	83 ec 08             	sub    $0x8,%esp
+     d4e:	68 a1 53 00 00       	push   $0x53a1
+     d53:	6a 01                	push   $0x1
+     d55:	e8 96 31 00 00       	call   3ef0 <printf>
+      return;
+     d5a:	83 c4 10             	add    $0x10,%esp
+}
+     d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d60:	5b                   	pop    %ebx
+     d61:	5e                   	pop    %esi
+     d62:	5d                   	pop    %ebp
+     d63:	c3                   	ret
+     d64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d68:	83 ec 08             	sub    $0x8,%esp
+     d6b:	68 43 48 00 00       	push   $0x4843
+     d70:	6a 01                	push   $0x1
+     d72:	e8 79 31 00 00       	call   3ef0 <printf>
+        return;
+     d77:	83 c4 10             	add    $0x10,%esp
+}
+     d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d7d:	5b                   	pop    %ebx
+     d7e:	5e                   	pop    %esi
+     d7f:	5d                   	pop    %ebp
+     d80:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d81:	83 ec 08             	sub    $0x8,%esp
+     d84:	68 53 48 00 00       	push   $0x4853
+     d89:	6a 01                	push   $0x1
+     d8b:	e8 60 31 00 00       	call   3ef0 <printf>
+     d90:	83 c4 10             	add    $0x10,%esp
+}
+     d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d96:	5b                   	pop    %ebx
+     d97:	5e                   	pop    %esi
+     d98:	5d                   	pop    %ebp
+     d99:	c3                   	ret
+      exit();
+     d9a:	e8 b4 2e 00 00       	call   3c53 <exit>
+     d9f:	90                   	nop
+
+00000da0 <mem>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	56                   	push   %esi
+     da4:	31 f6                	xor    %esi,%esi
+     da6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     da7:	83 ec 08             	sub    $0x8,%esp
+     daa:	68 60 48 00 00       	push   $0x4860
+     daf:	6a 01                	push   $0x1
+     db1:	e8 3a 31 00 00       	call   3ef0 <printf>
+  ppid = getpid();
+     db6:	e8 18 2f 00 00       	call   3cd3 <getpid>
+     dbb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     dbd:	e8 89 2e 00 00       	call   3c4b <fork>
+     dc2:	83 c4 10             	add    $0x10,%esp
+     dc5:	85 c0                	test   %eax,%eax
+     dc7:	74 0b                	je     dd4 <mem+0x34>
+     dc9:	e9 8a 00 00 00       	jmp    e58 <mem+0xb8>
+     dce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     dd0:	89 30                	mov    %esi,(%eax)
+     dd2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     dd4:	83 ec 0c             	sub    $0xc,%esp
+     dd7:	68 11 27 00 00       	push   $0x2711
+     ddc:	e8 9f 34 00 00       	call   4280 <malloc>
+     de1:	83 c4 10             	add    $0x10,%esp
+     de4:	85 c0                	test   %eax,%eax
+     de6:	75 e8                	jne    dd0 <mem+0x30>
+    while(m1){
+     de8:	85 f6                	test   %esi,%esi
+     dea:	74 18                	je     e04 <mem+0x64>
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     df0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     df2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     df5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     df7:	50                   	push   %eax
+     df8:	e8 03 34 00 00       	call   4200 <free>
+    while(m1){
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	85 f6                	test   %esi,%esi
+     e02:	75 ec                	jne    df0 <mem+0x50>
+    m1 = malloc(1024*20);
+     e04:	83 ec 0c             	sub    $0xc,%esp
+     e07:	68 00 50 00 00       	push   $0x5000
+     e0c:	e8 6f 34 00 00       	call   4280 <malloc>
+    if(m1 == 0){
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	85 c0                	test   %eax,%eax
+     e16:	74 20                	je     e38 <mem+0x98>
+    free(m1);
+     e18:	83 ec 0c             	sub    $0xc,%esp
+     e1b:	50                   	push   %eax
+     e1c:	e8 df 33 00 00       	call   4200 <free>
+    printf(1, "mem ok\n");
+     e21:	58                   	pop    %eax
+     e22:	5a                   	pop    %edx
+     e23:	68 84 48 00 00       	push   $0x4884
+     e28:	6a 01                	push   $0x1
+     e2a:	e8 c1 30 00 00       	call   3ef0 <printf>
+    exit();
+     e2f:	e8 1f 2e 00 00       	call   3c53 <exit>
+     e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e38:	83 ec 08             	sub    $0x8,%esp
+     e3b:	68 6a 48 00 00       	push   $0x486a
+     e40:	6a 01                	push   $0x1
+     e42:	e8 a9 30 00 00       	call   3ef0 <printf>
+      kill(ppid);
+     e47:	89 1c 24             	mov    %ebx,(%esp)
+     e4a:	e8 34 2e 00 00       	call   3c83 <kill>
+      exit();
+     e4f:	e8 ff 2d 00 00       	call   3c53 <exit>
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e5b:	5b                   	pop    %ebx
+     e5c:	5e                   	pop    %esi
+     e5d:	5d                   	pop    %ebp
+    wait();
+     e5e:	e9 f8 2d 00 00       	jmp    3c5b <wait>
+     e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e70 <sharedfd>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     e79:	68 8c 48 00 00       	push   $0x488c
+     e7e:	6a 01                	push   $0x1
+     e80:	e8 6b 30 00 00       	call   3ef0 <printf>
+  unlink("sharedfd");
+     e85:	c7 04 24 9b 48 00 00 	movl   $0x489b,(%esp)
+     e8c:	e8 12 2e 00 00       	call   3ca3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     e91:	5b                   	pop    %ebx
+     e92:	5e                   	pop    %esi
+     e93:	68 02 02 00 00       	push   $0x202
+     e98:	68 9b 48 00 00       	push   $0x489b
+     e9d:	e8 f1 2d 00 00       	call   3c93 <open>
+  if(fd < 0){
+     ea2:	83 c4 10             	add    $0x10,%esp
+     ea5:	85 c0                	test   %eax,%eax
+     ea7:	0f 88 2a 01 00 00    	js     fd7 <sharedfd+0x167>
+     ead:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eaf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     eb2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     eb7:	e8 8f 2d 00 00       	call   3c4b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ebc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     ebf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ec2:	19 c0                	sbb    %eax,%eax
+     ec4:	83 ec 04             	sub    $0x4,%esp
+     ec7:	83 e0 f3             	and    $0xfffffff3,%eax
+     eca:	6a 0a                	push   $0xa
+     ecc:	83 c0 70             	add    $0x70,%eax
+     ecf:	50                   	push   %eax
+     ed0:	56                   	push   %esi
+     ed1:	e8 fa 2b 00 00       	call   3ad0 <memset>
+     ed6:	83 c4 10             	add    $0x10,%esp
+     ed9:	eb 0a                	jmp    ee5 <sharedfd+0x75>
+     edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     ee0:	83 eb 01             	sub    $0x1,%ebx
+     ee3:	74 26                	je     f0b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	6a 0a                	push   $0xa
+     eea:	56                   	push   %esi
+     eeb:	57                   	push   %edi
+     eec:	e8 82 2d 00 00       	call   3c73 <write>
+     ef1:	83 c4 10             	add    $0x10,%esp
+     ef4:	83 f8 0a             	cmp    $0xa,%eax
+     ef7:	74 e7                	je     ee0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     ef9:	83 ec 08             	sub    $0x8,%esp
+     efc:	68 54 56 00 00       	push   $0x5654
+     f01:	6a 01                	push   $0x1
+     f03:	e8 e8 2f 00 00       	call   3ef0 <printf>
+      break;
+     f08:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f0b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f0e:	85 c9                	test   %ecx,%ecx
+     f10:	0f 84 f5 00 00 00    	je     100b <sharedfd+0x19b>
+    wait();
+     f16:	e8 40 2d 00 00       	call   3c5b <wait>
+  close(fd);
+     f1b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f1e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f20:	57                   	push   %edi
+     f21:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f24:	e8 52 2d 00 00       	call   3c7b <close>
+  fd = open("sharedfd", 0);
+     f29:	58                   	pop    %eax
+     f2a:	5a                   	pop    %edx
+     f2b:	6a 00                	push   $0x0
+     f2d:	68 9b 48 00 00       	push   $0x489b
+     f32:	e8 5c 2d 00 00       	call   3c93 <open>
+  if(fd < 0){
+     f37:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f3a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f3c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f3f:	85 c0                	test   %eax,%eax
+     f41:	0f 88 aa 00 00 00    	js     ff1 <sharedfd+0x181>
+     f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f50:	83 ec 04             	sub    $0x4,%esp
+     f53:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f56:	6a 0a                	push   $0xa
+     f58:	56                   	push   %esi
+     f59:	ff 75 d0             	push   -0x30(%ebp)
+     f5c:	e8 0a 2d 00 00       	call   3c6b <read>
+     f61:	83 c4 10             	add    $0x10,%esp
+     f64:	85 c0                	test   %eax,%eax
+     f66:	7e 28                	jle    f90 <sharedfd+0x120>
+     f68:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f6b:	89 f0                	mov    %esi,%eax
+     f6d:	eb 13                	jmp    f82 <sharedfd+0x112>
+     f6f:	90                   	nop
+        np++;
+     f70:	80 f9 70             	cmp    $0x70,%cl
+     f73:	0f 94 c1             	sete   %cl
+     f76:	0f b6 c9             	movzbl %cl,%ecx
+     f79:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     f7b:	83 c0 01             	add    $0x1,%eax
+     f7e:	39 f8                	cmp    %edi,%eax
+     f80:	74 ce                	je     f50 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     f82:	0f b6 08             	movzbl (%eax),%ecx
+     f85:	80 f9 63             	cmp    $0x63,%cl
+     f88:	75 e6                	jne    f70 <sharedfd+0x100>
+        nc++;
+     f8a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     f8d:	eb ec                	jmp    f7b <sharedfd+0x10b>
+     f8f:	90                   	nop
+  close(fd);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	ff 75 d0             	push   -0x30(%ebp)
+     f96:	e8 e0 2c 00 00       	call   3c7b <close>
+  unlink("sharedfd");
+     f9b:	c7 04 24 9b 48 00 00 	movl   $0x489b,(%esp)
+     fa2:	e8 fc 2c 00 00       	call   3ca3 <unlink>
+  if(nc == 10000 && np == 10000){
+     fa7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     faa:	83 c4 10             	add    $0x10,%esp
+     fad:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fb3:	75 5b                	jne    1010 <sharedfd+0x1a0>
+     fb5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     fbb:	75 53                	jne    1010 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fbd:	83 ec 08             	sub    $0x8,%esp
+     fc0:	68 a4 48 00 00       	push   $0x48a4
+     fc5:	6a 01                	push   $0x1
+     fc7:	e8 24 2f 00 00       	call   3ef0 <printf>
+     fcc:	83 c4 10             	add    $0x10,%esp
+}
+     fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fd2:	5b                   	pop    %ebx
+     fd3:	5e                   	pop    %esi
+     fd4:	5f                   	pop    %edi
+     fd5:	5d                   	pop    %ebp
+     fd6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     fd7:	83 ec 08             	sub    $0x8,%esp
+     fda:	68 28 56 00 00       	push   $0x5628
+     fdf:	6a 01                	push   $0x1
+     fe1:	e8 0a 2f 00 00       	call   3ef0 <printf>
+    return;
+     fe6:	83 c4 10             	add    $0x10,%esp
+}
+     fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fec:	5b                   	pop    %ebx
+     fed:	5e                   	pop    %esi
+     fee:	5f                   	pop    %edi
+     fef:	5d                   	pop    %ebp
+     ff0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     ff1:	83 ec 08             	sub    $0x8,%esp
+     ff4:	68 74 56 00 00       	push   $0x5674
+     ff9:	6a 01                	push   $0x1
+     ffb:	e8 f0 2e 00 00       	call   3ef0 <printf>
+    return;
+    1000:	83 c4 10             	add    $0x10,%esp
+}
+    1003:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1006:	5b                   	pop    %ebx
+    1007:	5e                   	pop    %esi
+    1008:	5f                   	pop    %edi
+    1009:	5d                   	pop    %ebp
+    100a:	c3                   	ret
+    exit();
+    100b:	e8 43 2c 00 00       	call   3c53 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1010:	53                   	push   %ebx
+    1011:	52                   	push   %edx
+    1012:	68 b1 48 00 00       	push   $0x48b1
+    1017:	6a 01                	push   $0x1
+    1019:	e8 d2 2e 00 00       	call   3ef0 <printf>
+    exit();
+    101e:	e8 30 2c 00 00       	call   3c53 <exit>
+    1023:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001030 <fourfiles>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1036:	31 db                	xor    %ebx,%ebx
+{
+    1038:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    103b:	c7 45 d8 c6 48 00 00 	movl   $0x48c6,-0x28(%ebp)
+    1042:	c7 45 dc 0f 4a 00 00 	movl   $0x4a0f,-0x24(%ebp)
+    1049:	c7 45 e0 13 4a 00 00 	movl   $0x4a13,-0x20(%ebp)
+    1050:	c7 45 e4 c9 48 00 00 	movl   $0x48c9,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1057:	68 cc 48 00 00       	push   $0x48cc
+    105c:	6a 01                	push   $0x1
+    105e:	e8 8d 2e 00 00       	call   3ef0 <printf>
+    1063:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1066:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    106a:	83 ec 0c             	sub    $0xc,%esp
+    106d:	56                   	push   %esi
+    106e:	e8 30 2c 00 00       	call   3ca3 <unlink>
+    pid = fork();
+    1073:	e8 d3 2b 00 00       	call   3c4b <fork>
+    if(pid < 0){
+    1078:	83 c4 10             	add    $0x10,%esp
+    107b:	85 c0                	test   %eax,%eax
+    107d:	0f 88 65 01 00 00    	js     11e8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1083:	0f 84 eb 00 00 00    	je     1174 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1089:	83 c3 01             	add    $0x1,%ebx
+    108c:	83 fb 04             	cmp    $0x4,%ebx
+    108f:	75 d5                	jne    1066 <fourfiles+0x36>
+    wait();
+    1091:	e8 c5 2b 00 00       	call   3c5b <wait>
+  for(i = 0; i < 2; i++){
+    1096:	31 f6                	xor    %esi,%esi
+    wait();
+    1098:	e8 be 2b 00 00       	call   3c5b <wait>
+    109d:	e8 b9 2b 00 00       	call   3c5b <wait>
+    10a2:	e8 b4 2b 00 00       	call   3c5b <wait>
+    fname = names[i];
+    10a7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    10ab:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    10ae:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10b0:	6a 00                	push   $0x0
+    10b2:	53                   	push   %ebx
+    10b3:	e8 db 2b 00 00       	call   3c93 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10b8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10bb:	83 c4 10             	add    $0x10,%esp
+    10be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c8:	83 ec 04             	sub    $0x4,%esp
+    10cb:	68 00 20 00 00       	push   $0x2000
+    10d0:	68 e0 8e 00 00       	push   $0x8ee0
+    10d5:	ff 75 d4             	push   -0x2c(%ebp)
+    10d8:	e8 8e 2b 00 00       	call   3c6b <read>
+    10dd:	83 c4 10             	add    $0x10,%esp
+    10e0:	89 c3                	mov    %eax,%ebx
+    10e2:	85 c0                	test   %eax,%eax
+    10e4:	7e 28                	jle    110e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    10e6:	31 c0                	xor    %eax,%eax
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+        if(buf[j] != '0'+i){
+    10f0:	83 fe 01             	cmp    $0x1,%esi
+    10f3:	0f be 88 e0 8e 00 00 	movsbl 0x8ee0(%eax),%ecx
+    10fa:	19 d2                	sbb    %edx,%edx
+    10fc:	83 c2 31             	add    $0x31,%edx
+    10ff:	39 d1                	cmp    %edx,%ecx
+    1101:	75 5d                	jne    1160 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1103:	83 c0 01             	add    $0x1,%eax
+    1106:	39 c3                	cmp    %eax,%ebx
+    1108:	75 e6                	jne    10f0 <fourfiles+0xc0>
+      total += n;
+    110a:	01 df                	add    %ebx,%edi
+    110c:	eb ba                	jmp    10c8 <fourfiles+0x98>
+    close(fd);
+    110e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1111:	83 ec 0c             	sub    $0xc,%esp
+    1114:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1117:	51                   	push   %ecx
+    1118:	e8 5e 2b 00 00       	call   3c7b <close>
+    if(total != 12*500){
+    111d:	83 c4 10             	add    $0x10,%esp
+    1120:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1126:	0f 85 d0 00 00 00    	jne    11fc <fourfiles+0x1cc>
+    unlink(fname);
+    112c:	83 ec 0c             	sub    $0xc,%esp
+    112f:	53                   	push   %ebx
+    1130:	e8 6e 2b 00 00       	call   3ca3 <unlink>
+  for(i = 0; i < 2; i++){
+    1135:	83 c4 10             	add    $0x10,%esp
+    1138:	85 f6                	test   %esi,%esi
+    113a:	75 0a                	jne    1146 <fourfiles+0x116>
+    113c:	be 01 00 00 00       	mov    $0x1,%esi
+    1141:	e9 61 ff ff ff       	jmp    10a7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1146:	83 ec 08             	sub    $0x8,%esp
+    1149:	68 0a 49 00 00       	push   $0x490a
+    114e:	6a 01                	push   $0x1
+    1150:	e8 9b 2d 00 00       	call   3ef0 <printf>
+}
+    1155:	83 c4 10             	add    $0x10,%esp
+    1158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    115b:	5b                   	pop    %ebx
+    115c:	5e                   	pop    %esi
+    115d:	5f                   	pop    %edi
+    115e:	5d                   	pop    %ebp
+    115f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1160:	83 ec 08             	sub    $0x8,%esp
+    1163:	68 ed 48 00 00       	push   $0x48ed
+    1168:	6a 01                	push   $0x1
+    116a:	e8 81 2d 00 00       	call   3ef0 <printf>
+          exit();
+    116f:	e8 df 2a 00 00       	call   3c53 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1174:	83 ec 08             	sub    $0x8,%esp
+    1177:	68 02 02 00 00       	push   $0x202
+    117c:	56                   	push   %esi
+    117d:	e8 11 2b 00 00       	call   3c93 <open>
+      if(fd < 0){
+    1182:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1185:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1187:	85 c0                	test   %eax,%eax
+    1189:	78 45                	js     11d0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    118b:	83 ec 04             	sub    $0x4,%esp
+    118e:	83 c3 30             	add    $0x30,%ebx
+    1191:	68 00 02 00 00       	push   $0x200
+    1196:	53                   	push   %ebx
+    1197:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    119c:	68 e0 8e 00 00       	push   $0x8ee0
+    11a1:	e8 2a 29 00 00       	call   3ad0 <memset>
+    11a6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    11a9:	83 ec 04             	sub    $0x4,%esp
+    11ac:	68 f4 01 00 00       	push   $0x1f4
+    11b1:	68 e0 8e 00 00       	push   $0x8ee0
+    11b6:	56                   	push   %esi
+    11b7:	e8 b7 2a 00 00       	call   3c73 <write>
+    11bc:	83 c4 10             	add    $0x10,%esp
+    11bf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11c4:	75 49                	jne    120f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11c6:	83 eb 01             	sub    $0x1,%ebx
+    11c9:	75 de                	jne    11a9 <fourfiles+0x179>
+      exit();
+    11cb:	e8 83 2a 00 00       	call   3c53 <exit>
+        printf(1, "create failed\n");
+    11d0:	51                   	push   %ecx
+    11d1:	51                   	push   %ecx
+    11d2:	68 2f 54 00 00       	push   $0x542f
+    11d7:	6a 01                	push   $0x1
+    11d9:	e8 12 2d 00 00       	call   3ef0 <printf>
+        exit();
+    11de:	e8 70 2a 00 00       	call   3c53 <exit>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+      printf(1, "fork failed\n");
+    11e8:	83 ec 08             	sub    $0x8,%esp
+    11eb:	68 a1 53 00 00       	push   $0x53a1
+    11f0:	6a 01                	push   $0x1
+    11f2:	e8 f9 2c 00 00       	call   3ef0 <printf>
+      exit();
+    11f7:	e8 57 2a 00 00       	call   3c53 <exit>
+      printf(1, "wrong length %d\n", total);
+    11fc:	50                   	push   %eax
+    11fd:	57                   	push   %edi
+    11fe:	68 f9 48 00 00       	push   $0x48f9
+    1203:	6a 01                	push   $0x1
+    1205:	e8 e6 2c 00 00       	call   3ef0 <printf>
+      exit();
+    120a:	e8 44 2a 00 00       	call   3c53 <exit>
+          printf(1, "write failed %d\n", n);
+    120f:	52                   	push   %edx
+    1210:	50                   	push   %eax
+    1211:	68 dc 48 00 00       	push   $0x48dc
+    1216:	6a 01                	push   $0x1
+    1218:	e8 d3 2c 00 00       	call   3ef0 <printf>
+          exit();
+    121d:	e8 31 2a 00 00       	call   3c53 <exit>
+    1222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001230 <createdelete>:
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1235:	31 f6                	xor    %esi,%esi
+{
+    1237:	53                   	push   %ebx
+    1238:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    123b:	68 18 49 00 00       	push   $0x4918
+    1240:	6a 01                	push   $0x1
+    1242:	e8 a9 2c 00 00       	call   3ef0 <printf>
+    1247:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    124a:	e8 fc 29 00 00       	call   3c4b <fork>
+    124f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1251:	85 c0                	test   %eax,%eax
+    1253:	0f 88 ac 01 00 00    	js     1405 <createdelete+0x1d5>
+    if(pid == 0){
+    1259:	0f 84 01 01 00 00    	je     1360 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    125f:	83 c6 01             	add    $0x1,%esi
+    1262:	83 fe 04             	cmp    $0x4,%esi
+    1265:	75 e3                	jne    124a <createdelete+0x1a>
+    wait();
+    1267:	e8 ef 29 00 00       	call   3c5b <wait>
+  for(i = 0; i < N; i++){
+    126c:	31 ff                	xor    %edi,%edi
+    126e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1271:	e8 e5 29 00 00       	call   3c5b <wait>
+    1276:	e8 e0 29 00 00       	call   3c5b <wait>
+    127b:	e8 db 29 00 00       	call   3c5b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1280:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1288:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    128a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    128d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1292:	0f 94 c2             	sete   %dl
+    1295:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1298:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    129b:	0f 9f c0             	setg   %al
+    129e:	09 c2                	or     %eax,%edx
+    12a0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    12a3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    12a7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    12aa:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    12ad:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12b0:	6a 00                	push   $0x0
+    12b2:	56                   	push   %esi
+    12b3:	e8 db 29 00 00       	call   3c93 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12b8:	83 c4 10             	add    $0x10,%esp
+    12bb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12bf:	74 7f                	je     1340 <createdelete+0x110>
+    12c1:	85 c0                	test   %eax,%eax
+    12c3:	0f 88 27 01 00 00    	js     13f0 <createdelete+0x1c0>
+        close(fd);
+    12c9:	83 ec 0c             	sub    $0xc,%esp
+    12cc:	50                   	push   %eax
+    12cd:	e8 a9 29 00 00       	call   3c7b <close>
+    12d2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    12d5:	83 c3 01             	add    $0x1,%ebx
+    12d8:	80 fb 74             	cmp    $0x74,%bl
+    12db:	75 c6                	jne    12a3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    12dd:	83 c7 01             	add    $0x1,%edi
+    12e0:	83 ff 14             	cmp    $0x14,%edi
+    12e3:	75 a3                	jne    1288 <createdelete+0x58>
+    12e5:	bf 70 00 00 00       	mov    $0x70,%edi
+    12ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    12f0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    12f3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    12f8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    12fb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    12fd:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1300:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1303:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1307:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    130a:	56                   	push   %esi
+    130b:	e8 93 29 00 00       	call   3ca3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1310:	83 c4 10             	add    $0x10,%esp
+    1313:	83 eb 01             	sub    $0x1,%ebx
+    1316:	75 e3                	jne    12fb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1318:	83 c7 01             	add    $0x1,%edi
+    131b:	89 f8                	mov    %edi,%eax
+    131d:	3c 84                	cmp    $0x84,%al
+    131f:	75 cf                	jne    12f0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1321:	83 ec 08             	sub    $0x8,%esp
+    1324:	68 2b 49 00 00       	push   $0x492b
+    1329:	6a 01                	push   $0x1
+    132b:	e8 c0 2b 00 00       	call   3ef0 <printf>
+}
+    1330:	83 c4 10             	add    $0x10,%esp
+    1333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1336:	5b                   	pop    %ebx
+    1337:	5e                   	pop    %esi
+    1338:	5f                   	pop    %edi
+    1339:	5d                   	pop    %ebp
+    133a:	c3                   	ret
+    133b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1340:	85 c0                	test   %eax,%eax
+    1342:	78 91                	js     12d5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1344:	50                   	push   %eax
+    1345:	56                   	push   %esi
+    1346:	68 c4 56 00 00       	push   $0x56c4
+    134b:	6a 01                	push   $0x1
+    134d:	e8 9e 2b 00 00       	call   3ef0 <printf>
+        exit();
+    1352:	e8 fc 28 00 00       	call   3c53 <exit>
+    1357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1360:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1363:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1367:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    136a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1370:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1373:	8d 43 30             	lea    0x30(%ebx),%eax
+    1376:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1379:	68 02 02 00 00       	push   $0x202
+    137e:	56                   	push   %esi
+    137f:	e8 0f 29 00 00       	call   3c93 <open>
+        if(fd < 0){
+    1384:	83 c4 10             	add    $0x10,%esp
+    1387:	85 c0                	test   %eax,%eax
+    1389:	0f 88 8a 00 00 00    	js     1419 <createdelete+0x1e9>
+        close(fd);
+    138f:	83 ec 0c             	sub    $0xc,%esp
+    1392:	50                   	push   %eax
+    1393:	e8 e3 28 00 00       	call   3c7b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1398:	83 c4 10             	add    $0x10,%esp
+    139b:	85 db                	test   %ebx,%ebx
+    139d:	74 19                	je     13b8 <createdelete+0x188>
+    139f:	f6 c3 01             	test   $0x1,%bl
+    13a2:	74 1b                	je     13bf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    13a4:	83 c3 01             	add    $0x1,%ebx
+    13a7:	83 fb 14             	cmp    $0x14,%ebx
+    13aa:	75 c4                	jne    1370 <createdelete+0x140>
+      exit();
+    13ac:	e8 a2 28 00 00       	call   3c53 <exit>
+    13b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13b8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13bd:	eb b1                	jmp    1370 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13bf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13c1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13c4:	d1 f8                	sar    %eax
+    13c6:	83 c0 30             	add    $0x30,%eax
+    13c9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13cc:	56                   	push   %esi
+    13cd:	e8 d1 28 00 00       	call   3ca3 <unlink>
+    13d2:	83 c4 10             	add    $0x10,%esp
+    13d5:	85 c0                	test   %eax,%eax
+    13d7:	79 cb                	jns    13a4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    13d9:	52                   	push   %edx
+    13da:	52                   	push   %edx
+    13db:	68 19 45 00 00       	push   $0x4519
+    13e0:	6a 01                	push   $0x1
+    13e2:	e8 09 2b 00 00       	call   3ef0 <printf>
+            exit();
+    13e7:	e8 67 28 00 00       	call   3c53 <exit>
+    13ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    13f0:	83 ec 04             	sub    $0x4,%esp
+    13f3:	56                   	push   %esi
+    13f4:	68 a0 56 00 00       	push   $0x56a0
+    13f9:	6a 01                	push   $0x1
+    13fb:	e8 f0 2a 00 00       	call   3ef0 <printf>
+        exit();
+    1400:	e8 4e 28 00 00       	call   3c53 <exit>
+      printf(1, "fork failed\n");
+    1405:	83 ec 08             	sub    $0x8,%esp
+    1408:	68 a1 53 00 00       	push   $0x53a1
+    140d:	6a 01                	push   $0x1
+    140f:	e8 dc 2a 00 00       	call   3ef0 <printf>
+      exit();
+    1414:	e8 3a 28 00 00       	call   3c53 <exit>
+          printf(1, "create failed\n");
+    1419:	83 ec 08             	sub    $0x8,%esp
+    141c:	68 2f 54 00 00       	push   $0x542f
+    1421:	6a 01                	push   $0x1
+    1423:	e8 c8 2a 00 00       	call   3ef0 <printf>
+          exit();
+    1428:	e8 26 28 00 00       	call   3c53 <exit>
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001430 <unlinkread>:
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	56                   	push   %esi
+    1434:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1435:	83 ec 08             	sub    $0x8,%esp
+    1438:	68 3c 49 00 00       	push   $0x493c
+    143d:	6a 01                	push   $0x1
+    143f:	e8 ac 2a 00 00       	call   3ef0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1444:	5b                   	pop    %ebx
+    1445:	5e                   	pop    %esi
+    1446:	68 02 02 00 00       	push   $0x202
+    144b:	68 4d 49 00 00       	push   $0x494d
+    1450:	e8 3e 28 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	85 c0                	test   %eax,%eax
+    145a:	0f 88 e6 00 00 00    	js     1546 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1460:	83 ec 04             	sub    $0x4,%esp
+    1463:	89 c3                	mov    %eax,%ebx
+    1465:	6a 05                	push   $0x5
+    1467:	68 72 49 00 00       	push   $0x4972
+    146c:	50                   	push   %eax
+    146d:	e8 01 28 00 00       	call   3c73 <write>
+  close(fd);
+    1472:	89 1c 24             	mov    %ebx,(%esp)
+    1475:	e8 01 28 00 00       	call   3c7b <close>
+  fd = open("unlinkread", O_RDWR);
+    147a:	58                   	pop    %eax
+    147b:	5a                   	pop    %edx
+    147c:	6a 02                	push   $0x2
+    147e:	68 4d 49 00 00       	push   $0x494d
+    1483:	e8 0b 28 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1488:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    148b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    148d:	85 c0                	test   %eax,%eax
+    148f:	0f 88 10 01 00 00    	js     15a5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1495:	83 ec 0c             	sub    $0xc,%esp
+    1498:	68 4d 49 00 00       	push   $0x494d
+    149d:	e8 01 28 00 00       	call   3ca3 <unlink>
+    14a2:	83 c4 10             	add    $0x10,%esp
+    14a5:	85 c0                	test   %eax,%eax
+    14a7:	0f 85 e5 00 00 00    	jne    1592 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14ad:	83 ec 08             	sub    $0x8,%esp
+    14b0:	68 02 02 00 00       	push   $0x202
+    14b5:	68 4d 49 00 00       	push   $0x494d
+    14ba:	e8 d4 27 00 00       	call   3c93 <open>
+  write(fd1, "yyy", 3);
+    14bf:	83 c4 0c             	add    $0xc,%esp
+    14c2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14c4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14c6:	68 aa 49 00 00       	push   $0x49aa
+    14cb:	50                   	push   %eax
+    14cc:	e8 a2 27 00 00       	call   3c73 <write>
+  close(fd1);
+    14d1:	89 34 24             	mov    %esi,(%esp)
+    14d4:	e8 a2 27 00 00       	call   3c7b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    14d9:	83 c4 0c             	add    $0xc,%esp
+    14dc:	68 00 20 00 00       	push   $0x2000
+    14e1:	68 e0 8e 00 00       	push   $0x8ee0
+    14e6:	53                   	push   %ebx
+    14e7:	e8 7f 27 00 00       	call   3c6b <read>
+    14ec:	83 c4 10             	add    $0x10,%esp
+    14ef:	83 f8 05             	cmp    $0x5,%eax
+    14f2:	0f 85 87 00 00 00    	jne    157f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    14f8:	80 3d e0 8e 00 00 68 	cmpb   $0x68,0x8ee0
+    14ff:	75 6b                	jne    156c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1501:	83 ec 04             	sub    $0x4,%esp
+    1504:	6a 0a                	push   $0xa
+    1506:	68 e0 8e 00 00       	push   $0x8ee0
+    150b:	53                   	push   %ebx
+    150c:	e8 62 27 00 00       	call   3c73 <write>
+    1511:	83 c4 10             	add    $0x10,%esp
+    1514:	83 f8 0a             	cmp    $0xa,%eax
+    1517:	75 40                	jne    1559 <unlinkread+0x129>
+  close(fd);
+    1519:	83 ec 0c             	sub    $0xc,%esp
+    151c:	53                   	push   %ebx
+    151d:	e8 59 27 00 00       	call   3c7b <close>
+  unlink("unlinkread");
+    1522:	c7 04 24 4d 49 00 00 	movl   $0x494d,(%esp)
+    1529:	e8 75 27 00 00       	call   3ca3 <unlink>
+  printf(1, "unlinkread ok\n");
+    152e:	58                   	pop    %eax
+    152f:	5a                   	pop    %edx
+    1530:	68 f5 49 00 00       	push   $0x49f5
+    1535:	6a 01                	push   $0x1
+    1537:	e8 b4 29 00 00       	call   3ef0 <printf>
+}
+    153c:	83 c4 10             	add    $0x10,%esp
+    153f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1542:	5b                   	pop    %ebx
+    1543:	5e                   	pop    %esi
+    1544:	5d                   	pop    %ebp
+    1545:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1546:	51                   	push   %ecx
+    1547:	51                   	push   %ecx
+    1548:	68 58 49 00 00       	push   $0x4958
+    154d:	6a 01                	push   $0x1
+    154f:	e8 9c 29 00 00       	call   3ef0 <printf>
+    exit();
+    1554:	e8 fa 26 00 00       	call   3c53 <exit>
+    printf(1, "unlinkread write failed\n");
+    1559:	51                   	push   %ecx
+    155a:	51                   	push   %ecx
+    155b:	68 dc 49 00 00       	push   $0x49dc
+    1560:	6a 01                	push   $0x1
+    1562:	e8 89 29 00 00       	call   3ef0 <printf>
+    exit();
+    1567:	e8 e7 26 00 00       	call   3c53 <exit>
+    printf(1, "unlinkread wrong data\n");
+    156c:	53                   	push   %ebx
+    156d:	53                   	push   %ebx
+    156e:	68 c5 49 00 00       	push   $0x49c5
+    1573:	6a 01                	push   $0x1
+    1575:	e8 76 29 00 00       	call   3ef0 <printf>
+    exit();
+    157a:	e8 d4 26 00 00       	call   3c53 <exit>
+    printf(1, "unlinkread read failed");
+    157f:	56                   	push   %esi
+    1580:	56                   	push   %esi
+    1581:	68 ae 49 00 00       	push   $0x49ae
+    1586:	6a 01                	push   $0x1
+    1588:	e8 63 29 00 00       	call   3ef0 <printf>
+    exit();
+    158d:	e8 c1 26 00 00       	call   3c53 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1592:	50                   	push   %eax
+    1593:	50                   	push   %eax
+    1594:	68 90 49 00 00       	push   $0x4990
+    1599:	6a 01                	push   $0x1
+    159b:	e8 50 29 00 00       	call   3ef0 <printf>
+    exit();
+    15a0:	e8 ae 26 00 00       	call   3c53 <exit>
+    printf(1, "open unlinkread failed\n");
+    15a5:	50                   	push   %eax
+    15a6:	50                   	push   %eax
+    15a7:	68 78 49 00 00       	push   $0x4978
+    15ac:	6a 01                	push   $0x1
+    15ae:	e8 3d 29 00 00       	call   3ef0 <printf>
+    exit();
+    15b3:	e8 9b 26 00 00       	call   3c53 <exit>
+    15b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+
+000015c0 <linktest>:
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	53                   	push   %ebx
+    15c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15c7:	68 04 4a 00 00       	push   $0x4a04
+    15cc:	6a 01                	push   $0x1
+    15ce:	e8 1d 29 00 00       	call   3ef0 <printf>
+  unlink("lf1");
+    15d3:	c7 04 24 0e 4a 00 00 	movl   $0x4a0e,(%esp)
+    15da:	e8 c4 26 00 00       	call   3ca3 <unlink>
+  unlink("lf2");
+    15df:	c7 04 24 12 4a 00 00 	movl   $0x4a12,(%esp)
+    15e6:	e8 b8 26 00 00       	call   3ca3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    15eb:	58                   	pop    %eax
+    15ec:	5a                   	pop    %edx
+    15ed:	68 02 02 00 00       	push   $0x202
+    15f2:	68 0e 4a 00 00       	push   $0x4a0e
+    15f7:	e8 97 26 00 00       	call   3c93 <open>
+  if(fd < 0){
+    15fc:	83 c4 10             	add    $0x10,%esp
+    15ff:	85 c0                	test   %eax,%eax
+    1601:	0f 88 1e 01 00 00    	js     1725 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1607:	83 ec 04             	sub    $0x4,%esp
+    160a:	89 c3                	mov    %eax,%ebx
+    160c:	6a 05                	push   $0x5
+    160e:	68 72 49 00 00       	push   $0x4972
+    1613:	50                   	push   %eax
+    1614:	e8 5a 26 00 00       	call   3c73 <write>
+    1619:	83 c4 10             	add    $0x10,%esp
+    161c:	83 f8 05             	cmp    $0x5,%eax
+    161f:	0f 85 98 01 00 00    	jne    17bd <linktest+0x1fd>
+  close(fd);
+    1625:	83 ec 0c             	sub    $0xc,%esp
+    1628:	53                   	push   %ebx
+    1629:	e8 4d 26 00 00       	call   3c7b <close>
+  if(link("lf1", "lf2") < 0){
+    162e:	5b                   	pop    %ebx
+    162f:	58                   	pop    %eax
+    1630:	68 12 4a 00 00       	push   $0x4a12
+    1635:	68 0e 4a 00 00       	push   $0x4a0e
+    163a:	e8 74 26 00 00       	call   3cb3 <link>
+    163f:	83 c4 10             	add    $0x10,%esp
+    1642:	85 c0                	test   %eax,%eax
+    1644:	0f 88 60 01 00 00    	js     17aa <linktest+0x1ea>
+  unlink("lf1");
+    164a:	83 ec 0c             	sub    $0xc,%esp
+    164d:	68 0e 4a 00 00       	push   $0x4a0e
+    1652:	e8 4c 26 00 00       	call   3ca3 <unlink>
+  if(open("lf1", 0) >= 0){
+    1657:	58                   	pop    %eax
+    1658:	5a                   	pop    %edx
+    1659:	6a 00                	push   $0x0
+    165b:	68 0e 4a 00 00       	push   $0x4a0e
+    1660:	e8 2e 26 00 00       	call   3c93 <open>
+    1665:	83 c4 10             	add    $0x10,%esp
+    1668:	85 c0                	test   %eax,%eax
+    166a:	0f 89 27 01 00 00    	jns    1797 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1670:	83 ec 08             	sub    $0x8,%esp
+    1673:	6a 00                	push   $0x0
+    1675:	68 12 4a 00 00       	push   $0x4a12
+    167a:	e8 14 26 00 00       	call   3c93 <open>
+  if(fd < 0){
+    167f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1682:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1684:	85 c0                	test   %eax,%eax
+    1686:	0f 88 f8 00 00 00    	js     1784 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    168c:	83 ec 04             	sub    $0x4,%esp
+    168f:	68 00 20 00 00       	push   $0x2000
+    1694:	68 e0 8e 00 00       	push   $0x8ee0
+    1699:	50                   	push   %eax
+    169a:	e8 cc 25 00 00       	call   3c6b <read>
+    169f:	83 c4 10             	add    $0x10,%esp
+    16a2:	83 f8 05             	cmp    $0x5,%eax
+    16a5:	0f 85 c6 00 00 00    	jne    1771 <linktest+0x1b1>
+  close(fd);
+    16ab:	83 ec 0c             	sub    $0xc,%esp
+    16ae:	53                   	push   %ebx
+    16af:	e8 c7 25 00 00       	call   3c7b <close>
+  if(link("lf2", "lf2") >= 0){
+    16b4:	58                   	pop    %eax
+    16b5:	5a                   	pop    %edx
+    16b6:	68 12 4a 00 00       	push   $0x4a12
+    16bb:	68 12 4a 00 00       	push   $0x4a12
+    16c0:	e8 ee 25 00 00       	call   3cb3 <link>
+    16c5:	83 c4 10             	add    $0x10,%esp
+    16c8:	85 c0                	test   %eax,%eax
+    16ca:	0f 89 8e 00 00 00    	jns    175e <linktest+0x19e>
+  unlink("lf2");
+    16d0:	83 ec 0c             	sub    $0xc,%esp
+    16d3:	68 12 4a 00 00       	push   $0x4a12
+    16d8:	e8 c6 25 00 00       	call   3ca3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    16dd:	59                   	pop    %ecx
+    16de:	5b                   	pop    %ebx
+    16df:	68 0e 4a 00 00       	push   $0x4a0e
+    16e4:	68 12 4a 00 00       	push   $0x4a12
+    16e9:	e8 c5 25 00 00       	call   3cb3 <link>
+    16ee:	83 c4 10             	add    $0x10,%esp
+    16f1:	85 c0                	test   %eax,%eax
+    16f3:	79 56                	jns    174b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    16f5:	83 ec 08             	sub    $0x8,%esp
+    16f8:	68 0e 4a 00 00       	push   $0x4a0e
+    16fd:	68 d6 4c 00 00       	push   $0x4cd6
+    1702:	e8 ac 25 00 00       	call   3cb3 <link>
+    1707:	83 c4 10             	add    $0x10,%esp
+    170a:	85 c0                	test   %eax,%eax
+    170c:	79 2a                	jns    1738 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    170e:	83 ec 08             	sub    $0x8,%esp
+    1711:	68 ac 4a 00 00       	push   $0x4aac
+    1716:	6a 01                	push   $0x1
+    1718:	e8 d3 27 00 00       	call   3ef0 <printf>
+}
+    171d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1720:	83 c4 10             	add    $0x10,%esp
+    1723:	c9                   	leave
+    1724:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1725:	50                   	push   %eax
+    1726:	50                   	push   %eax
+    1727:	68 16 4a 00 00       	push   $0x4a16
+    172c:	6a 01                	push   $0x1
+    172e:	e8 bd 27 00 00       	call   3ef0 <printf>
+    exit();
+    1733:	e8 1b 25 00 00       	call   3c53 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1738:	50                   	push   %eax
+    1739:	50                   	push   %eax
+    173a:	68 90 4a 00 00       	push   $0x4a90
+    173f:	6a 01                	push   $0x1
+    1741:	e8 aa 27 00 00       	call   3ef0 <printf>
+    exit();
+    1746:	e8 08 25 00 00       	call   3c53 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    174b:	52                   	push   %edx
+    174c:	52                   	push   %edx
+    174d:	68 0c 57 00 00       	push   $0x570c
+    1752:	6a 01                	push   $0x1
+    1754:	e8 97 27 00 00       	call   3ef0 <printf>
+    exit();
+    1759:	e8 f5 24 00 00       	call   3c53 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    175e:	50                   	push   %eax
+    175f:	50                   	push   %eax
+    1760:	68 72 4a 00 00       	push   $0x4a72
+    1765:	6a 01                	push   $0x1
+    1767:	e8 84 27 00 00       	call   3ef0 <printf>
+    exit();
+    176c:	e8 e2 24 00 00       	call   3c53 <exit>
+    printf(1, "read lf2 failed\n");
+    1771:	51                   	push   %ecx
+    1772:	51                   	push   %ecx
+    1773:	68 61 4a 00 00       	push   $0x4a61
+    1778:	6a 01                	push   $0x1
+    177a:	e8 71 27 00 00       	call   3ef0 <printf>
+    exit();
+    177f:	e8 cf 24 00 00       	call   3c53 <exit>
+    printf(1, "open lf2 failed\n");
+    1784:	53                   	push   %ebx
+    1785:	53                   	push   %ebx
+    1786:	68 50 4a 00 00       	push   $0x4a50
+    178b:	6a 01                	push   $0x1
+    178d:	e8 5e 27 00 00       	call   3ef0 <printf>
+    exit();
+    1792:	e8 bc 24 00 00       	call   3c53 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1797:	50                   	push   %eax
+    1798:	50                   	push   %eax
+    1799:	68 e4 56 00 00       	push   $0x56e4
+    179e:	6a 01                	push   $0x1
+    17a0:	e8 4b 27 00 00       	call   3ef0 <printf>
+    exit();
+    17a5:	e8 a9 24 00 00       	call   3c53 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    17aa:	51                   	push   %ecx
+    17ab:	51                   	push   %ecx
+    17ac:	68 3b 4a 00 00       	push   $0x4a3b
+    17b1:	6a 01                	push   $0x1
+    17b3:	e8 38 27 00 00       	call   3ef0 <printf>
+    exit();
+    17b8:	e8 96 24 00 00       	call   3c53 <exit>
+    printf(1, "write lf1 failed\n");
+    17bd:	50                   	push   %eax
+    17be:	50                   	push   %eax
+    17bf:	68 29 4a 00 00       	push   $0x4a29
+    17c4:	6a 01                	push   $0x1
+    17c6:	e8 25 27 00 00       	call   3ef0 <printf>
+    exit();
+    17cb:	e8 83 24 00 00       	call   3c53 <exit>
+
+000017d0 <concreate>:
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    17d5:	31 f6                	xor    %esi,%esi
+{
+    17d7:	53                   	push   %ebx
+    17d8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    17db:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    17de:	68 b9 4a 00 00       	push   $0x4ab9
+    17e3:	6a 01                	push   $0x1
+    17e5:	e8 06 27 00 00       	call   3ef0 <printf>
+  file[0] = 'C';
+    17ea:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    17ee:	83 c4 10             	add    $0x10,%esp
+    17f1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    17f5:	eb 4c                	jmp    1843 <concreate+0x73>
+    17f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fe:	66 90                	xchg   %ax,%ax
+    1800:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1806:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    180b:	0f 83 8f 00 00 00    	jae    18a0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1811:	83 ec 08             	sub    $0x8,%esp
+    1814:	68 02 02 00 00       	push   $0x202
+    1819:	53                   	push   %ebx
+    181a:	e8 74 24 00 00       	call   3c93 <open>
+      if(fd < 0){
+    181f:	83 c4 10             	add    $0x10,%esp
+    1822:	85 c0                	test   %eax,%eax
+    1824:	78 63                	js     1889 <concreate+0xb9>
+      close(fd);
+    1826:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1829:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    182c:	50                   	push   %eax
+    182d:	e8 49 24 00 00       	call   3c7b <close>
+    1832:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1835:	e8 21 24 00 00       	call   3c5b <wait>
+  for(i = 0; i < 40; i++){
+    183a:	83 fe 28             	cmp    $0x28,%esi
+    183d:	0f 84 7f 00 00 00    	je     18c2 <concreate+0xf2>
+    unlink(file);
+    1843:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1846:	8d 46 30             	lea    0x30(%esi),%eax
+    1849:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    184c:	53                   	push   %ebx
+    184d:	e8 51 24 00 00       	call   3ca3 <unlink>
+    pid = fork();
+    1852:	e8 f4 23 00 00       	call   3c4b <fork>
+    if(pid && (i % 3) == 1){
+    1857:	83 c4 10             	add    $0x10,%esp
+    185a:	85 c0                	test   %eax,%eax
+    185c:	75 a2                	jne    1800 <concreate+0x30>
+      link("C0", file);
+    185e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1864:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    186a:	0f 83 d0 00 00 00    	jae    1940 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1870:	83 ec 08             	sub    $0x8,%esp
+    1873:	68 02 02 00 00       	push   $0x202
+    1878:	53                   	push   %ebx
+    1879:	e8 15 24 00 00       	call   3c93 <open>
+      if(fd < 0){
+    187e:	83 c4 10             	add    $0x10,%esp
+    1881:	85 c0                	test   %eax,%eax
+    1883:	0f 89 ea 01 00 00    	jns    1a73 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1889:	83 ec 04             	sub    $0x4,%esp
+    188c:	53                   	push   %ebx
+    188d:	68 cc 4a 00 00       	push   $0x4acc
+    1892:	6a 01                	push   $0x1
+    1894:	e8 57 26 00 00       	call   3ef0 <printf>
+        exit();
+    1899:	e8 b5 23 00 00       	call   3c53 <exit>
+    189e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    18a0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    18a3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    18a6:	53                   	push   %ebx
+    18a7:	68 c9 4a 00 00       	push   $0x4ac9
+    18ac:	e8 02 24 00 00       	call   3cb3 <link>
+    18b1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18b4:	e8 a2 23 00 00       	call   3c5b <wait>
+  for(i = 0; i < 40; i++){
+    18b9:	83 fe 28             	cmp    $0x28,%esi
+    18bc:	0f 85 81 ff ff ff    	jne    1843 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18c2:	83 ec 04             	sub    $0x4,%esp
+    18c5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18c8:	6a 28                	push   $0x28
+    18ca:	6a 00                	push   $0x0
+    18cc:	50                   	push   %eax
+    18cd:	e8 fe 21 00 00       	call   3ad0 <memset>
+  fd = open(".", 0);
+    18d2:	5e                   	pop    %esi
+    18d3:	5f                   	pop    %edi
+    18d4:	6a 00                	push   $0x0
+    18d6:	68 d6 4c 00 00       	push   $0x4cd6
+    18db:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    18de:	e8 b0 23 00 00       	call   3c93 <open>
+  n = 0;
+    18e3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    18ea:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    18ed:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    18ef:	90                   	nop
+    18f0:	83 ec 04             	sub    $0x4,%esp
+    18f3:	6a 10                	push   $0x10
+    18f5:	57                   	push   %edi
+    18f6:	56                   	push   %esi
+    18f7:	e8 6f 23 00 00       	call   3c6b <read>
+    18fc:	83 c4 10             	add    $0x10,%esp
+    18ff:	85 c0                	test   %eax,%eax
+    1901:	7e 5d                	jle    1960 <concreate+0x190>
+    if(de.inum == 0)
+    1903:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1908:	74 e6                	je     18f0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    190a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    190e:	75 e0                	jne    18f0 <concreate+0x120>
+    1910:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1914:	75 da                	jne    18f0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1916:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    191a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    191d:	83 f8 27             	cmp    $0x27,%eax
+    1920:	0f 87 5e 01 00 00    	ja     1a84 <concreate+0x2b4>
+      if(fa[i]){
+    1926:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    192b:	0f 85 7e 01 00 00    	jne    1aaf <concreate+0x2df>
+      n++;
+    1931:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1935:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    193a:	eb b4                	jmp    18f0 <concreate+0x120>
+    193c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1940:	83 ec 08             	sub    $0x8,%esp
+    1943:	53                   	push   %ebx
+    1944:	68 c9 4a 00 00       	push   $0x4ac9
+    1949:	e8 65 23 00 00       	call   3cb3 <link>
+    194e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1951:	e8 fd 22 00 00       	call   3c53 <exit>
+    1956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1960:	83 ec 0c             	sub    $0xc,%esp
+    1963:	56                   	push   %esi
+    1964:	e8 12 23 00 00       	call   3c7b <close>
+  if(n != 40){
+    1969:	83 c4 10             	add    $0x10,%esp
+    196c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1970:	0f 85 26 01 00 00    	jne    1a9c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1976:	31 f6                	xor    %esi,%esi
+    1978:	eb 48                	jmp    19c2 <concreate+0x1f2>
+    197a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1980:	85 ff                	test   %edi,%edi
+    1982:	74 05                	je     1989 <concreate+0x1b9>
+    1984:	83 f8 01             	cmp    $0x1,%eax
+    1987:	74 68                	je     19f1 <concreate+0x221>
+      unlink(file);
+    1989:	83 ec 0c             	sub    $0xc,%esp
+    198c:	53                   	push   %ebx
+    198d:	e8 11 23 00 00       	call   3ca3 <unlink>
+      unlink(file);
+    1992:	89 1c 24             	mov    %ebx,(%esp)
+    1995:	e8 09 23 00 00       	call   3ca3 <unlink>
+      unlink(file);
+    199a:	89 1c 24             	mov    %ebx,(%esp)
+    199d:	e8 01 23 00 00       	call   3ca3 <unlink>
+      unlink(file);
+    19a2:	89 1c 24             	mov    %ebx,(%esp)
+    19a5:	e8 f9 22 00 00       	call   3ca3 <unlink>
+    19aa:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    19ad:	85 ff                	test   %edi,%edi
+    19af:	74 a0                	je     1951 <concreate+0x181>
+      wait();
+    19b1:	e8 a5 22 00 00       	call   3c5b <wait>
+  for(i = 0; i < 40; i++){
+    19b6:	83 c6 01             	add    $0x1,%esi
+    19b9:	83 fe 28             	cmp    $0x28,%esi
+    19bc:	0f 84 86 00 00 00    	je     1a48 <concreate+0x278>
+    file[1] = '0' + i;
+    19c2:	8d 46 30             	lea    0x30(%esi),%eax
+    19c5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19c8:	e8 7e 22 00 00       	call   3c4b <fork>
+    19cd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19cf:	85 c0                	test   %eax,%eax
+    19d1:	0f 88 88 00 00 00    	js     1a5f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    19d7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    19dc:	f7 e6                	mul    %esi
+    19de:	89 d0                	mov    %edx,%eax
+    19e0:	83 e2 fe             	and    $0xfffffffe,%edx
+    19e3:	d1 e8                	shr    %eax
+    19e5:	01 c2                	add    %eax,%edx
+    19e7:	89 f0                	mov    %esi,%eax
+    19e9:	29 d0                	sub    %edx,%eax
+    19eb:	89 c1                	mov    %eax,%ecx
+    19ed:	09 f9                	or     %edi,%ecx
+    19ef:	75 8f                	jne    1980 <concreate+0x1b0>
+      close(open(file, 0));
+    19f1:	83 ec 08             	sub    $0x8,%esp
+    19f4:	6a 00                	push   $0x0
+    19f6:	53                   	push   %ebx
+    19f7:	e8 97 22 00 00       	call   3c93 <open>
+    19fc:	89 04 24             	mov    %eax,(%esp)
+    19ff:	e8 77 22 00 00       	call   3c7b <close>
+      close(open(file, 0));
+    1a04:	58                   	pop    %eax
+    1a05:	5a                   	pop    %edx
+    1a06:	6a 00                	push   $0x0
+    1a08:	53                   	push   %ebx
+    1a09:	e8 85 22 00 00       	call   3c93 <open>
+    1a0e:	89 04 24             	mov    %eax,(%esp)
+    1a11:	e8 65 22 00 00       	call   3c7b <close>
+      close(open(file, 0));
+    1a16:	59                   	pop    %ecx
+    1a17:	58                   	pop    %eax
+    1a18:	6a 00                	push   $0x0
+    1a1a:	53                   	push   %ebx
+    1a1b:	e8 73 22 00 00       	call   3c93 <open>
+    1a20:	89 04 24             	mov    %eax,(%esp)
+    1a23:	e8 53 22 00 00       	call   3c7b <close>
+      close(open(file, 0));
+    1a28:	58                   	pop    %eax
+    1a29:	5a                   	pop    %edx
+    1a2a:	6a 00                	push   $0x0
+    1a2c:	53                   	push   %ebx
+    1a2d:	e8 61 22 00 00       	call   3c93 <open>
+    1a32:	89 04 24             	mov    %eax,(%esp)
+    1a35:	e8 41 22 00 00       	call   3c7b <close>
+    1a3a:	83 c4 10             	add    $0x10,%esp
+    1a3d:	e9 6b ff ff ff       	jmp    19ad <concreate+0x1dd>
+    1a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a48:	83 ec 08             	sub    $0x8,%esp
+    1a4b:	68 1e 4b 00 00       	push   $0x4b1e
+    1a50:	6a 01                	push   $0x1
+    1a52:	e8 99 24 00 00       	call   3ef0 <printf>
+}
+    1a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a5a:	5b                   	pop    %ebx
+    1a5b:	5e                   	pop    %esi
+    1a5c:	5f                   	pop    %edi
+    1a5d:	5d                   	pop    %ebp
+    1a5e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a5f:	83 ec 08             	sub    $0x8,%esp
+    1a62:	68 a1 53 00 00       	push   $0x53a1
+    1a67:	6a 01                	push   $0x1
+    1a69:	e8 82 24 00 00       	call   3ef0 <printf>
+      exit();
+    1a6e:	e8 e0 21 00 00       	call   3c53 <exit>
+      close(fd);
+    1a73:	83 ec 0c             	sub    $0xc,%esp
+    1a76:	50                   	push   %eax
+    1a77:	e8 ff 21 00 00       	call   3c7b <close>
+    1a7c:	83 c4 10             	add    $0x10,%esp
+    1a7f:	e9 cd fe ff ff       	jmp    1951 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1a84:	83 ec 04             	sub    $0x4,%esp
+    1a87:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1a8a:	50                   	push   %eax
+    1a8b:	68 e8 4a 00 00       	push   $0x4ae8
+    1a90:	6a 01                	push   $0x1
+    1a92:	e8 59 24 00 00       	call   3ef0 <printf>
+        exit();
+    1a97:	e8 b7 21 00 00       	call   3c53 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1a9c:	51                   	push   %ecx
+    1a9d:	51                   	push   %ecx
+    1a9e:	68 30 57 00 00       	push   $0x5730
+    1aa3:	6a 01                	push   $0x1
+    1aa5:	e8 46 24 00 00       	call   3ef0 <printf>
+    exit();
+    1aaa:	e8 a4 21 00 00       	call   3c53 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1aaf:	83 ec 04             	sub    $0x4,%esp
+    1ab2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ab5:	50                   	push   %eax
+    1ab6:	68 01 4b 00 00       	push   $0x4b01
+    1abb:	6a 01                	push   $0x1
+    1abd:	e8 2e 24 00 00       	call   3ef0 <printf>
+        exit();
+    1ac2:	e8 8c 21 00 00       	call   3c53 <exit>
+    1ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ace:	66 90                	xchg   %ax,%ax
+
+00001ad0 <linkunlink>:
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	57                   	push   %edi
+    1ad4:	56                   	push   %esi
+    1ad5:	53                   	push   %ebx
+    1ad6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1ad9:	68 2c 4b 00 00       	push   $0x4b2c
+    1ade:	6a 01                	push   $0x1
+    1ae0:	e8 0b 24 00 00       	call   3ef0 <printf>
+  unlink("x");
+    1ae5:	c7 04 24 b9 4d 00 00 	movl   $0x4db9,(%esp)
+    1aec:	e8 b2 21 00 00       	call   3ca3 <unlink>
+  pid = fork();
+    1af1:	e8 55 21 00 00       	call   3c4b <fork>
+  if(pid < 0){
+    1af6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1afc:	85 c0                	test   %eax,%eax
+    1afe:	0f 88 b6 00 00 00    	js     1bba <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b04:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b08:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b0d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b12:	19 ff                	sbb    %edi,%edi
+    1b14:	83 e7 60             	and    $0x60,%edi
+    1b17:	83 c7 01             	add    $0x1,%edi
+    1b1a:	eb 1e                	jmp    1b3a <linkunlink+0x6a>
+    1b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b20:	83 f8 01             	cmp    $0x1,%eax
+    1b23:	74 7b                	je     1ba0 <linkunlink+0xd0>
+      unlink("x");
+    1b25:	83 ec 0c             	sub    $0xc,%esp
+    1b28:	68 b9 4d 00 00       	push   $0x4db9
+    1b2d:	e8 71 21 00 00       	call   3ca3 <unlink>
+    1b32:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b35:	83 eb 01             	sub    $0x1,%ebx
+    1b38:	74 41                	je     1b7b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b3a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b40:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b46:	89 f8                	mov    %edi,%eax
+    1b48:	f7 e6                	mul    %esi
+    1b4a:	89 d0                	mov    %edx,%eax
+    1b4c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b4f:	d1 e8                	shr    %eax
+    1b51:	01 c2                	add    %eax,%edx
+    1b53:	89 f8                	mov    %edi,%eax
+    1b55:	29 d0                	sub    %edx,%eax
+    1b57:	75 c7                	jne    1b20 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b59:	83 ec 08             	sub    $0x8,%esp
+    1b5c:	68 02 02 00 00       	push   $0x202
+    1b61:	68 b9 4d 00 00       	push   $0x4db9
+    1b66:	e8 28 21 00 00       	call   3c93 <open>
+    1b6b:	89 04 24             	mov    %eax,(%esp)
+    1b6e:	e8 08 21 00 00       	call   3c7b <close>
+    1b73:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b76:	83 eb 01             	sub    $0x1,%ebx
+    1b79:	75 bf                	jne    1b3a <linkunlink+0x6a>
+  if(pid)
+    1b7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b7e:	85 c0                	test   %eax,%eax
+    1b80:	74 4b                	je     1bcd <linkunlink+0xfd>
+    wait();
+    1b82:	e8 d4 20 00 00       	call   3c5b <wait>
+  printf(1, "linkunlink ok\n");
+    1b87:	83 ec 08             	sub    $0x8,%esp
+    1b8a:	68 41 4b 00 00       	push   $0x4b41
+    1b8f:	6a 01                	push   $0x1
+    1b91:	e8 5a 23 00 00       	call   3ef0 <printf>
+}
+    1b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b99:	5b                   	pop    %ebx
+    1b9a:	5e                   	pop    %esi
+    1b9b:	5f                   	pop    %edi
+    1b9c:	5d                   	pop    %ebp
+    1b9d:	c3                   	ret
+    1b9e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1ba0:	83 ec 08             	sub    $0x8,%esp
+    1ba3:	68 b9 4d 00 00       	push   $0x4db9
+    1ba8:	68 3d 4b 00 00       	push   $0x4b3d
+    1bad:	e8 01 21 00 00       	call   3cb3 <link>
+    1bb2:	83 c4 10             	add    $0x10,%esp
+    1bb5:	e9 7b ff ff ff       	jmp    1b35 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1bba:	52                   	push   %edx
+    1bbb:	52                   	push   %edx
+    1bbc:	68 a1 53 00 00       	push   $0x53a1
+    1bc1:	6a 01                	push   $0x1
+    1bc3:	e8 28 23 00 00       	call   3ef0 <printf>
+    exit();
+    1bc8:	e8 86 20 00 00       	call   3c53 <exit>
+    exit();
+    1bcd:	e8 81 20 00 00       	call   3c53 <exit>
+    1bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001be0 <bigdir>:
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	57                   	push   %edi
+    1be4:	56                   	push   %esi
+    1be5:	53                   	push   %ebx
+    1be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1be9:	68 50 4b 00 00       	push   $0x4b50
+    1bee:	6a 01                	push   $0x1
+    1bf0:	e8 fb 22 00 00       	call   3ef0 <printf>
+  unlink("bd");
+    1bf5:	c7 04 24 5d 4b 00 00 	movl   $0x4b5d,(%esp)
+    1bfc:	e8 a2 20 00 00       	call   3ca3 <unlink>
+  fd = open("bd", O_CREATE);
+    1c01:	5a                   	pop    %edx
+    1c02:	59                   	pop    %ecx
+    1c03:	68 00 02 00 00       	push   $0x200
+    1c08:	68 5d 4b 00 00       	push   $0x4b5d
+    1c0d:	e8 81 20 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1c12:	83 c4 10             	add    $0x10,%esp
+    1c15:	85 c0                	test   %eax,%eax
+    1c17:	0f 88 de 00 00 00    	js     1cfb <bigdir+0x11b>
+  close(fd);
+    1c1d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c20:	31 f6                	xor    %esi,%esi
+    1c22:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c25:	50                   	push   %eax
+    1c26:	e8 50 20 00 00       	call   3c7b <close>
+    1c2b:	83 c4 10             	add    $0x10,%esp
+    1c2e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c30:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c32:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c35:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c39:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c3c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c40:	83 c0 30             	add    $0x30,%eax
+    1c43:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c46:	89 f0                	mov    %esi,%eax
+    1c48:	83 e0 3f             	and    $0x3f,%eax
+    1c4b:	83 c0 30             	add    $0x30,%eax
+    1c4e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c51:	57                   	push   %edi
+    1c52:	68 5d 4b 00 00       	push   $0x4b5d
+    1c57:	e8 57 20 00 00       	call   3cb3 <link>
+    1c5c:	83 c4 10             	add    $0x10,%esp
+    1c5f:	89 c3                	mov    %eax,%ebx
+    1c61:	85 c0                	test   %eax,%eax
+    1c63:	75 6e                	jne    1cd3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c65:	83 c6 01             	add    $0x1,%esi
+    1c68:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c6e:	75 c0                	jne    1c30 <bigdir+0x50>
+  unlink("bd");
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	68 5d 4b 00 00       	push   $0x4b5d
+    1c78:	e8 26 20 00 00       	call   3ca3 <unlink>
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1c80:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1c82:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1c85:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c89:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c8c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c90:	83 c0 30             	add    $0x30,%eax
+    1c93:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c96:	89 d8                	mov    %ebx,%eax
+    1c98:	83 e0 3f             	and    $0x3f,%eax
+    1c9b:	83 c0 30             	add    $0x30,%eax
+    1c9e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1ca1:	57                   	push   %edi
+    1ca2:	e8 fc 1f 00 00       	call   3ca3 <unlink>
+    1ca7:	83 c4 10             	add    $0x10,%esp
+    1caa:	85 c0                	test   %eax,%eax
+    1cac:	75 39                	jne    1ce7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1cae:	83 c3 01             	add    $0x1,%ebx
+    1cb1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1cb7:	75 c7                	jne    1c80 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1cb9:	83 ec 08             	sub    $0x8,%esp
+    1cbc:	68 9f 4b 00 00       	push   $0x4b9f
+    1cc1:	6a 01                	push   $0x1
+    1cc3:	e8 28 22 00 00       	call   3ef0 <printf>
+    1cc8:	83 c4 10             	add    $0x10,%esp
+}
+    1ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cce:	5b                   	pop    %ebx
+    1ccf:	5e                   	pop    %esi
+    1cd0:	5f                   	pop    %edi
+    1cd1:	5d                   	pop    %ebp
+    1cd2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1cd3:	83 ec 08             	sub    $0x8,%esp
+    1cd6:	68 76 4b 00 00       	push   $0x4b76
+    1cdb:	6a 01                	push   $0x1
+    1cdd:	e8 0e 22 00 00       	call   3ef0 <printf>
+      exit();
+    1ce2:	e8 6c 1f 00 00       	call   3c53 <exit>
+      printf(1, "bigdir unlink failed");
+    1ce7:	83 ec 08             	sub    $0x8,%esp
+    1cea:	68 8a 4b 00 00       	push   $0x4b8a
+    1cef:	6a 01                	push   $0x1
+    1cf1:	e8 fa 21 00 00       	call   3ef0 <printf>
+      exit();
+    1cf6:	e8 58 1f 00 00       	call   3c53 <exit>
+    printf(1, "bigdir create failed\n");
+    1cfb:	50                   	push   %eax
+    1cfc:	50                   	push   %eax
+    1cfd:	68 60 4b 00 00       	push   $0x4b60
+    1d02:	6a 01                	push   $0x1
+    1d04:	e8 e7 21 00 00       	call   3ef0 <printf>
+    exit();
+    1d09:	e8 45 1f 00 00       	call   3c53 <exit>
+    1d0e:	66 90                	xchg   %ax,%ax
+
+00001d10 <subdir>:
+{
+    1d10:	55                   	push   %ebp
+    1d11:	89 e5                	mov    %esp,%ebp
+    1d13:	53                   	push   %ebx
+    1d14:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1d17:	68 aa 4b 00 00       	push   $0x4baa
+    1d1c:	6a 01                	push   $0x1
+    1d1e:	e8 cd 21 00 00       	call   3ef0 <printf>
+  unlink("ff");
+    1d23:	c7 04 24 33 4c 00 00 	movl   $0x4c33,(%esp)
+    1d2a:	e8 74 1f 00 00       	call   3ca3 <unlink>
+  if(mkdir("dd") != 0){
+    1d2f:	c7 04 24 d0 4c 00 00 	movl   $0x4cd0,(%esp)
+    1d36:	e8 80 1f 00 00       	call   3cbb <mkdir>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	85 c0                	test   %eax,%eax
+    1d40:	0f 85 b3 05 00 00    	jne    22f9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d46:	83 ec 08             	sub    $0x8,%esp
+    1d49:	68 02 02 00 00       	push   $0x202
+    1d4e:	68 09 4c 00 00       	push   $0x4c09
+    1d53:	e8 3b 1f 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1d58:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d5b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d5d:	85 c0                	test   %eax,%eax
+    1d5f:	0f 88 81 05 00 00    	js     22e6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1d65:	83 ec 04             	sub    $0x4,%esp
+    1d68:	6a 02                	push   $0x2
+    1d6a:	68 33 4c 00 00       	push   $0x4c33
+    1d6f:	50                   	push   %eax
+    1d70:	e8 fe 1e 00 00       	call   3c73 <write>
+  close(fd);
+    1d75:	89 1c 24             	mov    %ebx,(%esp)
+    1d78:	e8 fe 1e 00 00       	call   3c7b <close>
+  if(unlink("dd") >= 0){
+    1d7d:	c7 04 24 d0 4c 00 00 	movl   $0x4cd0,(%esp)
+    1d84:	e8 1a 1f 00 00       	call   3ca3 <unlink>
+    1d89:	83 c4 10             	add    $0x10,%esp
+    1d8c:	85 c0                	test   %eax,%eax
+    1d8e:	0f 89 3f 05 00 00    	jns    22d3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1d94:	83 ec 0c             	sub    $0xc,%esp
+    1d97:	68 e4 4b 00 00       	push   $0x4be4
+    1d9c:	e8 1a 1f 00 00       	call   3cbb <mkdir>
+    1da1:	83 c4 10             	add    $0x10,%esp
+    1da4:	85 c0                	test   %eax,%eax
+    1da6:	0f 85 14 05 00 00    	jne    22c0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1dac:	83 ec 08             	sub    $0x8,%esp
+    1daf:	68 02 02 00 00       	push   $0x202
+    1db4:	68 06 4c 00 00       	push   $0x4c06
+    1db9:	e8 d5 1e 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1dbe:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1dc1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1dc3:	85 c0                	test   %eax,%eax
+    1dc5:	0f 88 24 04 00 00    	js     21ef <subdir+0x4df>
+  write(fd, "FF", 2);
+    1dcb:	83 ec 04             	sub    $0x4,%esp
+    1dce:	6a 02                	push   $0x2
+    1dd0:	68 27 4c 00 00       	push   $0x4c27
+    1dd5:	50                   	push   %eax
+    1dd6:	e8 98 1e 00 00       	call   3c73 <write>
+  close(fd);
+    1ddb:	89 1c 24             	mov    %ebx,(%esp)
+    1dde:	e8 98 1e 00 00       	call   3c7b <close>
+  fd = open("dd/dd/../ff", 0);
+    1de3:	58                   	pop    %eax
+    1de4:	5a                   	pop    %edx
+    1de5:	6a 00                	push   $0x0
+    1de7:	68 2a 4c 00 00       	push   $0x4c2a
+    1dec:	e8 a2 1e 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1df1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1df4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1df6:	85 c0                	test   %eax,%eax
+    1df8:	0f 88 de 03 00 00    	js     21dc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1dfe:	83 ec 04             	sub    $0x4,%esp
+    1e01:	68 00 20 00 00       	push   $0x2000
+    1e06:	68 e0 8e 00 00       	push   $0x8ee0
+    1e0b:	50                   	push   %eax
+    1e0c:	e8 5a 1e 00 00       	call   3c6b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1e11:	83 c4 10             	add    $0x10,%esp
+    1e14:	83 f8 02             	cmp    $0x2,%eax
+    1e17:	0f 85 3a 03 00 00    	jne    2157 <subdir+0x447>
+    1e1d:	80 3d e0 8e 00 00 66 	cmpb   $0x66,0x8ee0
+    1e24:	0f 85 2d 03 00 00    	jne    2157 <subdir+0x447>
+  close(fd);
+    1e2a:	83 ec 0c             	sub    $0xc,%esp
+    1e2d:	53                   	push   %ebx
+    1e2e:	e8 48 1e 00 00       	call   3c7b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1e33:	59                   	pop    %ecx
+    1e34:	5b                   	pop    %ebx
+    1e35:	68 6a 4c 00 00       	push   $0x4c6a
+    1e3a:	68 06 4c 00 00       	push   $0x4c06
+    1e3f:	e8 6f 1e 00 00       	call   3cb3 <link>
+    1e44:	83 c4 10             	add    $0x10,%esp
+    1e47:	85 c0                	test   %eax,%eax
+    1e49:	0f 85 c6 03 00 00    	jne    2215 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1e4f:	83 ec 0c             	sub    $0xc,%esp
+    1e52:	68 06 4c 00 00       	push   $0x4c06
+    1e57:	e8 47 1e 00 00       	call   3ca3 <unlink>
+    1e5c:	83 c4 10             	add    $0x10,%esp
+    1e5f:	85 c0                	test   %eax,%eax
+    1e61:	0f 85 16 03 00 00    	jne    217d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1e67:	83 ec 08             	sub    $0x8,%esp
+    1e6a:	6a 00                	push   $0x0
+    1e6c:	68 06 4c 00 00       	push   $0x4c06
+    1e71:	e8 1d 1e 00 00       	call   3c93 <open>
+    1e76:	83 c4 10             	add    $0x10,%esp
+    1e79:	85 c0                	test   %eax,%eax
+    1e7b:	0f 89 2c 04 00 00    	jns    22ad <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1e81:	83 ec 0c             	sub    $0xc,%esp
+    1e84:	68 d0 4c 00 00       	push   $0x4cd0
+    1e89:	e8 35 1e 00 00       	call   3cc3 <chdir>
+    1e8e:	83 c4 10             	add    $0x10,%esp
+    1e91:	85 c0                	test   %eax,%eax
+    1e93:	0f 85 01 04 00 00    	jne    229a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1e99:	83 ec 0c             	sub    $0xc,%esp
+    1e9c:	68 9e 4c 00 00       	push   $0x4c9e
+    1ea1:	e8 1d 1e 00 00       	call   3cc3 <chdir>
+    1ea6:	83 c4 10             	add    $0x10,%esp
+    1ea9:	85 c0                	test   %eax,%eax
+    1eab:	0f 85 b9 02 00 00    	jne    216a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1eb1:	83 ec 0c             	sub    $0xc,%esp
+    1eb4:	68 c4 4c 00 00       	push   $0x4cc4
+    1eb9:	e8 05 1e 00 00       	call   3cc3 <chdir>
+    1ebe:	83 c4 10             	add    $0x10,%esp
+    1ec1:	85 c0                	test   %eax,%eax
+    1ec3:	0f 85 a1 02 00 00    	jne    216a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1ec9:	83 ec 0c             	sub    $0xc,%esp
+    1ecc:	68 d3 4c 00 00       	push   $0x4cd3
+    1ed1:	e8 ed 1d 00 00       	call   3cc3 <chdir>
+    1ed6:	83 c4 10             	add    $0x10,%esp
+    1ed9:	85 c0                	test   %eax,%eax
+    1edb:	0f 85 21 03 00 00    	jne    2202 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1ee1:	83 ec 08             	sub    $0x8,%esp
+    1ee4:	6a 00                	push   $0x0
+    1ee6:	68 6a 4c 00 00       	push   $0x4c6a
+    1eeb:	e8 a3 1d 00 00       	call   3c93 <open>
+  if(fd < 0){
+    1ef0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1ef3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ef5:	85 c0                	test   %eax,%eax
+    1ef7:	0f 88 e0 04 00 00    	js     23dd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1efd:	83 ec 04             	sub    $0x4,%esp
+    1f00:	68 00 20 00 00       	push   $0x2000
+    1f05:	68 e0 8e 00 00       	push   $0x8ee0
+    1f0a:	50                   	push   %eax
+    1f0b:	e8 5b 1d 00 00       	call   3c6b <read>
+    1f10:	83 c4 10             	add    $0x10,%esp
+    1f13:	83 f8 02             	cmp    $0x2,%eax
+    1f16:	0f 85 ae 04 00 00    	jne    23ca <subdir+0x6ba>
+  close(fd);
+    1f1c:	83 ec 0c             	sub    $0xc,%esp
+    1f1f:	53                   	push   %ebx
+    1f20:	e8 56 1d 00 00       	call   3c7b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f25:	58                   	pop    %eax
+    1f26:	5a                   	pop    %edx
+    1f27:	6a 00                	push   $0x0
+    1f29:	68 06 4c 00 00       	push   $0x4c06
+    1f2e:	e8 60 1d 00 00       	call   3c93 <open>
+    1f33:	83 c4 10             	add    $0x10,%esp
+    1f36:	85 c0                	test   %eax,%eax
+    1f38:	0f 89 65 02 00 00    	jns    21a3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1f3e:	83 ec 08             	sub    $0x8,%esp
+    1f41:	68 02 02 00 00       	push   $0x202
+    1f46:	68 1e 4d 00 00       	push   $0x4d1e
+    1f4b:	e8 43 1d 00 00       	call   3c93 <open>
+    1f50:	83 c4 10             	add    $0x10,%esp
+    1f53:	85 c0                	test   %eax,%eax
+    1f55:	0f 89 35 02 00 00    	jns    2190 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1f5b:	83 ec 08             	sub    $0x8,%esp
+    1f5e:	68 02 02 00 00       	push   $0x202
+    1f63:	68 43 4d 00 00       	push   $0x4d43
+    1f68:	e8 26 1d 00 00       	call   3c93 <open>
+    1f6d:	83 c4 10             	add    $0x10,%esp
+    1f70:	85 c0                	test   %eax,%eax
+    1f72:	0f 89 0f 03 00 00    	jns    2287 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1f78:	83 ec 08             	sub    $0x8,%esp
+    1f7b:	68 00 02 00 00       	push   $0x200
+    1f80:	68 d0 4c 00 00       	push   $0x4cd0
+    1f85:	e8 09 1d 00 00       	call   3c93 <open>
+    1f8a:	83 c4 10             	add    $0x10,%esp
+    1f8d:	85 c0                	test   %eax,%eax
+    1f8f:	0f 89 df 02 00 00    	jns    2274 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1f95:	83 ec 08             	sub    $0x8,%esp
+    1f98:	6a 02                	push   $0x2
+    1f9a:	68 d0 4c 00 00       	push   $0x4cd0
+    1f9f:	e8 ef 1c 00 00       	call   3c93 <open>
+    1fa4:	83 c4 10             	add    $0x10,%esp
+    1fa7:	85 c0                	test   %eax,%eax
+    1fa9:	0f 89 b2 02 00 00    	jns    2261 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    1faf:	83 ec 08             	sub    $0x8,%esp
+    1fb2:	6a 01                	push   $0x1
+    1fb4:	68 d0 4c 00 00       	push   $0x4cd0
+    1fb9:	e8 d5 1c 00 00       	call   3c93 <open>
+    1fbe:	83 c4 10             	add    $0x10,%esp
+    1fc1:	85 c0                	test   %eax,%eax
+    1fc3:	0f 89 85 02 00 00    	jns    224e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1fc9:	83 ec 08             	sub    $0x8,%esp
+    1fcc:	68 b2 4d 00 00       	push   $0x4db2
+    1fd1:	68 1e 4d 00 00       	push   $0x4d1e
+    1fd6:	e8 d8 1c 00 00       	call   3cb3 <link>
+    1fdb:	83 c4 10             	add    $0x10,%esp
+    1fde:	85 c0                	test   %eax,%eax
+    1fe0:	0f 84 55 02 00 00    	je     223b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1fe6:	83 ec 08             	sub    $0x8,%esp
+    1fe9:	68 b2 4d 00 00       	push   $0x4db2
+    1fee:	68 43 4d 00 00       	push   $0x4d43
+    1ff3:	e8 bb 1c 00 00       	call   3cb3 <link>
+    1ff8:	83 c4 10             	add    $0x10,%esp
+    1ffb:	85 c0                	test   %eax,%eax
+    1ffd:	0f 84 25 02 00 00    	je     2228 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2003:	83 ec 08             	sub    $0x8,%esp
+    2006:	68 6a 4c 00 00       	push   $0x4c6a
+    200b:	68 09 4c 00 00       	push   $0x4c09
+    2010:	e8 9e 1c 00 00       	call   3cb3 <link>
+    2015:	83 c4 10             	add    $0x10,%esp
+    2018:	85 c0                	test   %eax,%eax
+    201a:	0f 84 a9 01 00 00    	je     21c9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2020:	83 ec 0c             	sub    $0xc,%esp
+    2023:	68 1e 4d 00 00       	push   $0x4d1e
+    2028:	e8 8e 1c 00 00       	call   3cbb <mkdir>
+    202d:	83 c4 10             	add    $0x10,%esp
+    2030:	85 c0                	test   %eax,%eax
+    2032:	0f 84 7e 01 00 00    	je     21b6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2038:	83 ec 0c             	sub    $0xc,%esp
+    203b:	68 43 4d 00 00       	push   $0x4d43
+    2040:	e8 76 1c 00 00       	call   3cbb <mkdir>
+    2045:	83 c4 10             	add    $0x10,%esp
+    2048:	85 c0                	test   %eax,%eax
+    204a:	0f 84 67 03 00 00    	je     23b7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2050:	83 ec 0c             	sub    $0xc,%esp
+    2053:	68 6a 4c 00 00       	push   $0x4c6a
+    2058:	e8 5e 1c 00 00       	call   3cbb <mkdir>
+    205d:	83 c4 10             	add    $0x10,%esp
+    2060:	85 c0                	test   %eax,%eax
+    2062:	0f 84 3c 03 00 00    	je     23a4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2068:	83 ec 0c             	sub    $0xc,%esp
+    206b:	68 43 4d 00 00       	push   $0x4d43
+    2070:	e8 2e 1c 00 00       	call   3ca3 <unlink>
+    2075:	83 c4 10             	add    $0x10,%esp
+    2078:	85 c0                	test   %eax,%eax
+    207a:	0f 84 11 03 00 00    	je     2391 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2080:	83 ec 0c             	sub    $0xc,%esp
+    2083:	68 1e 4d 00 00       	push   $0x4d1e
+    2088:	e8 16 1c 00 00       	call   3ca3 <unlink>
+    208d:	83 c4 10             	add    $0x10,%esp
+    2090:	85 c0                	test   %eax,%eax
+    2092:	0f 84 e6 02 00 00    	je     237e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2098:	83 ec 0c             	sub    $0xc,%esp
+    209b:	68 09 4c 00 00       	push   $0x4c09
+    20a0:	e8 1e 1c 00 00       	call   3cc3 <chdir>
+    20a5:	83 c4 10             	add    $0x10,%esp
+    20a8:	85 c0                	test   %eax,%eax
+    20aa:	0f 84 bb 02 00 00    	je     236b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	68 b5 4d 00 00       	push   $0x4db5
+    20b8:	e8 06 1c 00 00       	call   3cc3 <chdir>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	0f 84 90 02 00 00    	je     2358 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    20c8:	83 ec 0c             	sub    $0xc,%esp
+    20cb:	68 6a 4c 00 00       	push   $0x4c6a
+    20d0:	e8 ce 1b 00 00       	call   3ca3 <unlink>
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	85 c0                	test   %eax,%eax
+    20da:	0f 85 9d 00 00 00    	jne    217d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	68 09 4c 00 00       	push   $0x4c09
+    20e8:	e8 b6 1b 00 00       	call   3ca3 <unlink>
+    20ed:	83 c4 10             	add    $0x10,%esp
+    20f0:	85 c0                	test   %eax,%eax
+    20f2:	0f 85 4d 02 00 00    	jne    2345 <subdir+0x635>
+  if(unlink("dd") == 0){
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	68 d0 4c 00 00       	push   $0x4cd0
+    2100:	e8 9e 1b 00 00       	call   3ca3 <unlink>
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	85 c0                	test   %eax,%eax
+    210a:	0f 84 22 02 00 00    	je     2332 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2110:	83 ec 0c             	sub    $0xc,%esp
+    2113:	68 e5 4b 00 00       	push   $0x4be5
+    2118:	e8 86 1b 00 00       	call   3ca3 <unlink>
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	85 c0                	test   %eax,%eax
+    2122:	0f 88 f7 01 00 00    	js     231f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2128:	83 ec 0c             	sub    $0xc,%esp
+    212b:	68 d0 4c 00 00       	push   $0x4cd0
+    2130:	e8 6e 1b 00 00       	call   3ca3 <unlink>
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 88 cc 01 00 00    	js     230c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2140:	83 ec 08             	sub    $0x8,%esp
+    2143:	68 b2 4e 00 00       	push   $0x4eb2
+    2148:	6a 01                	push   $0x1
+    214a:	e8 a1 1d 00 00       	call   3ef0 <printf>
+}
+    214f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2152:	83 c4 10             	add    $0x10,%esp
+    2155:	c9                   	leave
+    2156:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2157:	50                   	push   %eax
+    2158:	50                   	push   %eax
+    2159:	68 4f 4c 00 00       	push   $0x4c4f
+    215e:	6a 01                	push   $0x1
+    2160:	e8 8b 1d 00 00       	call   3ef0 <printf>
+    exit();
+    2165:	e8 e9 1a 00 00       	call   3c53 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    216a:	50                   	push   %eax
+    216b:	50                   	push   %eax
+    216c:	68 aa 4c 00 00       	push   $0x4caa
+    2171:	6a 01                	push   $0x1
+    2173:	e8 78 1d 00 00       	call   3ef0 <printf>
+    exit();
+    2178:	e8 d6 1a 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    217d:	50                   	push   %eax
+    217e:	50                   	push   %eax
+    217f:	68 75 4c 00 00       	push   $0x4c75
+    2184:	6a 01                	push   $0x1
+    2186:	e8 65 1d 00 00       	call   3ef0 <printf>
+    exit();
+    218b:	e8 c3 1a 00 00       	call   3c53 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2190:	51                   	push   %ecx
+    2191:	51                   	push   %ecx
+    2192:	68 27 4d 00 00       	push   $0x4d27
+    2197:	6a 01                	push   $0x1
+    2199:	e8 52 1d 00 00       	call   3ef0 <printf>
+    exit();
+    219e:	e8 b0 1a 00 00       	call   3c53 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    21a3:	53                   	push   %ebx
+    21a4:	53                   	push   %ebx
+    21a5:	68 d4 57 00 00       	push   $0x57d4
+    21aa:	6a 01                	push   $0x1
+    21ac:	e8 3f 1d 00 00       	call   3ef0 <printf>
+    exit();
+    21b1:	e8 9d 1a 00 00       	call   3c53 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    21b6:	51                   	push   %ecx
+    21b7:	51                   	push   %ecx
+    21b8:	68 bb 4d 00 00       	push   $0x4dbb
+    21bd:	6a 01                	push   $0x1
+    21bf:	e8 2c 1d 00 00       	call   3ef0 <printf>
+    exit();
+    21c4:	e8 8a 1a 00 00       	call   3c53 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    21c9:	53                   	push   %ebx
+    21ca:	53                   	push   %ebx
+    21cb:	68 44 58 00 00       	push   $0x5844
+    21d0:	6a 01                	push   $0x1
+    21d2:	e8 19 1d 00 00       	call   3ef0 <printf>
+    exit();
+    21d7:	e8 77 1a 00 00       	call   3c53 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    21dc:	50                   	push   %eax
+    21dd:	50                   	push   %eax
+    21de:	68 36 4c 00 00       	push   $0x4c36
+    21e3:	6a 01                	push   $0x1
+    21e5:	e8 06 1d 00 00       	call   3ef0 <printf>
+    exit();
+    21ea:	e8 64 1a 00 00       	call   3c53 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    21ef:	51                   	push   %ecx
+    21f0:	51                   	push   %ecx
+    21f1:	68 0f 4c 00 00       	push   $0x4c0f
+    21f6:	6a 01                	push   $0x1
+    21f8:	e8 f3 1c 00 00       	call   3ef0 <printf>
+    exit();
+    21fd:	e8 51 1a 00 00       	call   3c53 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2202:	50                   	push   %eax
+    2203:	50                   	push   %eax
+    2204:	68 d8 4c 00 00       	push   $0x4cd8
+    2209:	6a 01                	push   $0x1
+    220b:	e8 e0 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2210:	e8 3e 1a 00 00       	call   3c53 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2215:	52                   	push   %edx
+    2216:	52                   	push   %edx
+    2217:	68 8c 57 00 00       	push   $0x578c
+    221c:	6a 01                	push   $0x1
+    221e:	e8 cd 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2223:	e8 2b 1a 00 00       	call   3c53 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2228:	50                   	push   %eax
+    2229:	50                   	push   %eax
+    222a:	68 20 58 00 00       	push   $0x5820
+    222f:	6a 01                	push   $0x1
+    2231:	e8 ba 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2236:	e8 18 1a 00 00       	call   3c53 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    223b:	50                   	push   %eax
+    223c:	50                   	push   %eax
+    223d:	68 fc 57 00 00       	push   $0x57fc
+    2242:	6a 01                	push   $0x1
+    2244:	e8 a7 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2249:	e8 05 1a 00 00       	call   3c53 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    224e:	50                   	push   %eax
+    224f:	50                   	push   %eax
+    2250:	68 97 4d 00 00       	push   $0x4d97
+    2255:	6a 01                	push   $0x1
+    2257:	e8 94 1c 00 00       	call   3ef0 <printf>
+    exit();
+    225c:	e8 f2 19 00 00       	call   3c53 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2261:	50                   	push   %eax
+    2262:	50                   	push   %eax
+    2263:	68 7e 4d 00 00       	push   $0x4d7e
+    2268:	6a 01                	push   $0x1
+    226a:	e8 81 1c 00 00       	call   3ef0 <printf>
+    exit();
+    226f:	e8 df 19 00 00       	call   3c53 <exit>
+    printf(1, "create dd succeeded!\n");
+    2274:	50                   	push   %eax
+    2275:	50                   	push   %eax
+    2276:	68 68 4d 00 00       	push   $0x4d68
+    227b:	6a 01                	push   $0x1
+    227d:	e8 6e 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2282:	e8 cc 19 00 00       	call   3c53 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2287:	52                   	push   %edx
+    2288:	52                   	push   %edx
+    2289:	68 4c 4d 00 00       	push   $0x4d4c
+    228e:	6a 01                	push   $0x1
+    2290:	e8 5b 1c 00 00       	call   3ef0 <printf>
+    exit();
+    2295:	e8 b9 19 00 00       	call   3c53 <exit>
+    printf(1, "chdir dd failed\n");
+    229a:	50                   	push   %eax
+    229b:	50                   	push   %eax
+    229c:	68 8d 4c 00 00       	push   $0x4c8d
+    22a1:	6a 01                	push   $0x1
+    22a3:	e8 48 1c 00 00       	call   3ef0 <printf>
+    exit();
+    22a8:	e8 a6 19 00 00       	call   3c53 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    22ad:	50                   	push   %eax
+    22ae:	50                   	push   %eax
+    22af:	68 b0 57 00 00       	push   $0x57b0
+    22b4:	6a 01                	push   $0x1
+    22b6:	e8 35 1c 00 00       	call   3ef0 <printf>
+    exit();
+    22bb:	e8 93 19 00 00       	call   3c53 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    22c0:	53                   	push   %ebx
+    22c1:	53                   	push   %ebx
+    22c2:	68 eb 4b 00 00       	push   $0x4beb
+    22c7:	6a 01                	push   $0x1
+    22c9:	e8 22 1c 00 00       	call   3ef0 <printf>
+    exit();
+    22ce:	e8 80 19 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    22d3:	50                   	push   %eax
+    22d4:	50                   	push   %eax
+    22d5:	68 64 57 00 00       	push   $0x5764
+    22da:	6a 01                	push   $0x1
+    22dc:	e8 0f 1c 00 00       	call   3ef0 <printf>
+    exit();
+    22e1:	e8 6d 19 00 00       	call   3c53 <exit>
+    printf(1, "create dd/ff failed\n");
+    22e6:	50                   	push   %eax
+    22e7:	50                   	push   %eax
+    22e8:	68 cf 4b 00 00       	push   $0x4bcf
+    22ed:	6a 01                	push   $0x1
+    22ef:	e8 fc 1b 00 00       	call   3ef0 <printf>
+    exit();
+    22f4:	e8 5a 19 00 00       	call   3c53 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    22f9:	50                   	push   %eax
+    22fa:	50                   	push   %eax
+    22fb:	68 b7 4b 00 00       	push   $0x4bb7
+    2300:	6a 01                	push   $0x1
+    2302:	e8 e9 1b 00 00       	call   3ef0 <printf>
+    exit();
+    2307:	e8 47 19 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd failed\n");
+    230c:	50                   	push   %eax
+    230d:	50                   	push   %eax
+    230e:	68 a0 4e 00 00       	push   $0x4ea0
+    2313:	6a 01                	push   $0x1
+    2315:	e8 d6 1b 00 00       	call   3ef0 <printf>
+    exit();
+    231a:	e8 34 19 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    231f:	52                   	push   %edx
+    2320:	52                   	push   %edx
+    2321:	68 8b 4e 00 00       	push   $0x4e8b
+    2326:	6a 01                	push   $0x1
+    2328:	e8 c3 1b 00 00       	call   3ef0 <printf>
+    exit();
+    232d:	e8 21 19 00 00       	call   3c53 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2332:	51                   	push   %ecx
+    2333:	51                   	push   %ecx
+    2334:	68 68 58 00 00       	push   $0x5868
+    2339:	6a 01                	push   $0x1
+    233b:	e8 b0 1b 00 00       	call   3ef0 <printf>
+    exit();
+    2340:	e8 0e 19 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2345:	53                   	push   %ebx
+    2346:	53                   	push   %ebx
+    2347:	68 76 4e 00 00       	push   $0x4e76
+    234c:	6a 01                	push   $0x1
+    234e:	e8 9d 1b 00 00       	call   3ef0 <printf>
+    exit();
+    2353:	e8 fb 18 00 00       	call   3c53 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2358:	50                   	push   %eax
+    2359:	50                   	push   %eax
+    235a:	68 5e 4e 00 00       	push   $0x4e5e
+    235f:	6a 01                	push   $0x1
+    2361:	e8 8a 1b 00 00       	call   3ef0 <printf>
+    exit();
+    2366:	e8 e8 18 00 00       	call   3c53 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    236b:	50                   	push   %eax
+    236c:	50                   	push   %eax
+    236d:	68 46 4e 00 00       	push   $0x4e46
+    2372:	6a 01                	push   $0x1
+    2374:	e8 77 1b 00 00       	call   3ef0 <printf>
+    exit();
+    2379:	e8 d5 18 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    237e:	50                   	push   %eax
+    237f:	50                   	push   %eax
+    2380:	68 2a 4e 00 00       	push   $0x4e2a
+    2385:	6a 01                	push   $0x1
+    2387:	e8 64 1b 00 00       	call   3ef0 <printf>
+    exit();
+    238c:	e8 c2 18 00 00       	call   3c53 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2391:	50                   	push   %eax
+    2392:	50                   	push   %eax
+    2393:	68 0e 4e 00 00       	push   $0x4e0e
+    2398:	6a 01                	push   $0x1
+    239a:	e8 51 1b 00 00       	call   3ef0 <printf>
+    exit();
+    239f:	e8 af 18 00 00       	call   3c53 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    23a4:	50                   	push   %eax
+    23a5:	50                   	push   %eax
+    23a6:	68 f1 4d 00 00       	push   $0x4df1
+    23ab:	6a 01                	push   $0x1
+    23ad:	e8 3e 1b 00 00       	call   3ef0 <printf>
+    exit();
+    23b2:	e8 9c 18 00 00       	call   3c53 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    23b7:	52                   	push   %edx
+    23b8:	52                   	push   %edx
+    23b9:	68 d6 4d 00 00       	push   $0x4dd6
+    23be:	6a 01                	push   $0x1
+    23c0:	e8 2b 1b 00 00       	call   3ef0 <printf>
+    exit();
+    23c5:	e8 89 18 00 00       	call   3c53 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    23ca:	51                   	push   %ecx
+    23cb:	51                   	push   %ecx
+    23cc:	68 03 4d 00 00       	push   $0x4d03
+    23d1:	6a 01                	push   $0x1
+    23d3:	e8 18 1b 00 00       	call   3ef0 <printf>
+    exit();
+    23d8:	e8 76 18 00 00       	call   3c53 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    23dd:	53                   	push   %ebx
+    23de:	53                   	push   %ebx
+    23df:	68 eb 4c 00 00       	push   $0x4ceb
+    23e4:	6a 01                	push   $0x1
+    23e6:	e8 05 1b 00 00       	call   3ef0 <printf>
+    exit();
+    23eb:	e8 63 18 00 00       	call   3c53 <exit>
+
+000023f0 <bigwrite>:
+{
+    23f0:	55                   	push   %ebp
+    23f1:	89 e5                	mov    %esp,%ebp
+    23f3:	56                   	push   %esi
+    23f4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    23f5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    23fa:	83 ec 08             	sub    $0x8,%esp
+    23fd:	68 bd 4e 00 00       	push   $0x4ebd
+    2402:	6a 01                	push   $0x1
+    2404:	e8 e7 1a 00 00       	call   3ef0 <printf>
+  unlink("bigwrite");
+    2409:	c7 04 24 cc 4e 00 00 	movl   $0x4ecc,(%esp)
+    2410:	e8 8e 18 00 00       	call   3ca3 <unlink>
+    2415:	83 c4 10             	add    $0x10,%esp
+    2418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    241f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2420:	83 ec 08             	sub    $0x8,%esp
+    2423:	68 02 02 00 00       	push   $0x202
+    2428:	68 cc 4e 00 00       	push   $0x4ecc
+    242d:	e8 61 18 00 00       	call   3c93 <open>
+    if(fd < 0){
+    2432:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2435:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2437:	85 c0                	test   %eax,%eax
+    2439:	78 7e                	js     24b9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    243b:	83 ec 04             	sub    $0x4,%esp
+    243e:	53                   	push   %ebx
+    243f:	68 e0 8e 00 00       	push   $0x8ee0
+    2444:	50                   	push   %eax
+    2445:	e8 29 18 00 00       	call   3c73 <write>
+      if(cc != sz){
+    244a:	83 c4 10             	add    $0x10,%esp
+    244d:	39 d8                	cmp    %ebx,%eax
+    244f:	75 55                	jne    24a6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2451:	83 ec 04             	sub    $0x4,%esp
+    2454:	53                   	push   %ebx
+    2455:	68 e0 8e 00 00       	push   $0x8ee0
+    245a:	56                   	push   %esi
+    245b:	e8 13 18 00 00       	call   3c73 <write>
+      if(cc != sz){
+    2460:	83 c4 10             	add    $0x10,%esp
+    2463:	39 c3                	cmp    %eax,%ebx
+    2465:	75 3f                	jne    24a6 <bigwrite+0xb6>
+    close(fd);
+    2467:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    246a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2470:	56                   	push   %esi
+    2471:	e8 05 18 00 00       	call   3c7b <close>
+    unlink("bigwrite");
+    2476:	c7 04 24 cc 4e 00 00 	movl   $0x4ecc,(%esp)
+    247d:	e8 21 18 00 00       	call   3ca3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2482:	83 c4 10             	add    $0x10,%esp
+    2485:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    248b:	75 93                	jne    2420 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    248d:	83 ec 08             	sub    $0x8,%esp
+    2490:	68 ff 4e 00 00       	push   $0x4eff
+    2495:	6a 01                	push   $0x1
+    2497:	e8 54 1a 00 00       	call   3ef0 <printf>
+}
+    249c:	83 c4 10             	add    $0x10,%esp
+    249f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24a2:	5b                   	pop    %ebx
+    24a3:	5e                   	pop    %esi
+    24a4:	5d                   	pop    %ebp
+    24a5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    24a6:	50                   	push   %eax
+    24a7:	53                   	push   %ebx
+    24a8:	68 ed 4e 00 00       	push   $0x4eed
+    24ad:	6a 01                	push   $0x1
+    24af:	e8 3c 1a 00 00       	call   3ef0 <printf>
+        exit();
+    24b4:	e8 9a 17 00 00       	call   3c53 <exit>
+      printf(1, "cannot create bigwrite\n");
+    24b9:	83 ec 08             	sub    $0x8,%esp
+    24bc:	68 d5 4e 00 00       	push   $0x4ed5
+    24c1:	6a 01                	push   $0x1
+    24c3:	e8 28 1a 00 00       	call   3ef0 <printf>
+      exit();
+    24c8:	e8 86 17 00 00       	call   3c53 <exit>
+    24cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024d0 <bigfile>:
+{
+    24d0:	55                   	push   %ebp
+    24d1:	89 e5                	mov    %esp,%ebp
+    24d3:	57                   	push   %edi
+    24d4:	56                   	push   %esi
+    24d5:	53                   	push   %ebx
+    24d6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    24d9:	68 0c 4f 00 00       	push   $0x4f0c
+    24de:	6a 01                	push   $0x1
+    24e0:	e8 0b 1a 00 00       	call   3ef0 <printf>
+  unlink("bigfile");
+    24e5:	c7 04 24 28 4f 00 00 	movl   $0x4f28,(%esp)
+    24ec:	e8 b2 17 00 00       	call   3ca3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    24f1:	58                   	pop    %eax
+    24f2:	5a                   	pop    %edx
+    24f3:	68 02 02 00 00       	push   $0x202
+    24f8:	68 28 4f 00 00       	push   $0x4f28
+    24fd:	e8 91 17 00 00       	call   3c93 <open>
+  if(fd < 0){
+    2502:	83 c4 10             	add    $0x10,%esp
+    2505:	85 c0                	test   %eax,%eax
+    2507:	0f 88 5e 01 00 00    	js     266b <bigfile+0x19b>
+    250d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    250f:	31 db                	xor    %ebx,%ebx
+    2511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2518:	83 ec 04             	sub    $0x4,%esp
+    251b:	68 58 02 00 00       	push   $0x258
+    2520:	53                   	push   %ebx
+    2521:	68 e0 8e 00 00       	push   $0x8ee0
+    2526:	e8 a5 15 00 00       	call   3ad0 <memset>
+    if(write(fd, buf, 600) != 600){
+    252b:	83 c4 0c             	add    $0xc,%esp
+    252e:	68 58 02 00 00       	push   $0x258
+    2533:	68 e0 8e 00 00       	push   $0x8ee0
+    2538:	56                   	push   %esi
+    2539:	e8 35 17 00 00       	call   3c73 <write>
+    253e:	83 c4 10             	add    $0x10,%esp
+    2541:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2546:	0f 85 f8 00 00 00    	jne    2644 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    254c:	83 c3 01             	add    $0x1,%ebx
+    254f:	83 fb 14             	cmp    $0x14,%ebx
+    2552:	75 c4                	jne    2518 <bigfile+0x48>
+  close(fd);
+    2554:	83 ec 0c             	sub    $0xc,%esp
+    2557:	56                   	push   %esi
+    2558:	e8 1e 17 00 00       	call   3c7b <close>
+  fd = open("bigfile", 0);
+    255d:	5e                   	pop    %esi
+    255e:	5f                   	pop    %edi
+    255f:	6a 00                	push   $0x0
+    2561:	68 28 4f 00 00       	push   $0x4f28
+    2566:	e8 28 17 00 00       	call   3c93 <open>
+  if(fd < 0){
+    256b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    256e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2570:	85 c0                	test   %eax,%eax
+    2572:	0f 88 e0 00 00 00    	js     2658 <bigfile+0x188>
+  total = 0;
+    2578:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    257a:	31 ff                	xor    %edi,%edi
+    257c:	eb 30                	jmp    25ae <bigfile+0xde>
+    257e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2580:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2585:	0f 85 91 00 00 00    	jne    261c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    258b:	89 fa                	mov    %edi,%edx
+    258d:	0f be 05 e0 8e 00 00 	movsbl 0x8ee0,%eax
+    2594:	d1 fa                	sar    %edx
+    2596:	39 d0                	cmp    %edx,%eax
+    2598:	75 6e                	jne    2608 <bigfile+0x138>
+    259a:	0f be 15 0b 90 00 00 	movsbl 0x900b,%edx
+    25a1:	39 d0                	cmp    %edx,%eax
+    25a3:	75 63                	jne    2608 <bigfile+0x138>
+    total += cc;
+    25a5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    25ab:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    25ae:	83 ec 04             	sub    $0x4,%esp
+    25b1:	68 2c 01 00 00       	push   $0x12c
+    25b6:	68 e0 8e 00 00       	push   $0x8ee0
+    25bb:	56                   	push   %esi
+    25bc:	e8 aa 16 00 00       	call   3c6b <read>
+    if(cc < 0){
+    25c1:	83 c4 10             	add    $0x10,%esp
+    25c4:	85 c0                	test   %eax,%eax
+    25c6:	78 68                	js     2630 <bigfile+0x160>
+    if(cc == 0)
+    25c8:	75 b6                	jne    2580 <bigfile+0xb0>
+  close(fd);
+    25ca:	83 ec 0c             	sub    $0xc,%esp
+    25cd:	56                   	push   %esi
+    25ce:	e8 a8 16 00 00       	call   3c7b <close>
+  if(total != 20*600){
+    25d3:	83 c4 10             	add    $0x10,%esp
+    25d6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    25dc:	0f 85 9c 00 00 00    	jne    267e <bigfile+0x1ae>
+  unlink("bigfile");
+    25e2:	83 ec 0c             	sub    $0xc,%esp
+    25e5:	68 28 4f 00 00       	push   $0x4f28
+    25ea:	e8 b4 16 00 00       	call   3ca3 <unlink>
+  printf(1, "bigfile test ok\n");
+    25ef:	58                   	pop    %eax
+    25f0:	5a                   	pop    %edx
+    25f1:	68 b7 4f 00 00       	push   $0x4fb7
+    25f6:	6a 01                	push   $0x1
+    25f8:	e8 f3 18 00 00       	call   3ef0 <printf>
+}
+    25fd:	83 c4 10             	add    $0x10,%esp
+    2600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2603:	5b                   	pop    %ebx
+    2604:	5e                   	pop    %esi
+    2605:	5f                   	pop    %edi
+    2606:	5d                   	pop    %ebp
+    2607:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2608:	83 ec 08             	sub    $0x8,%esp
+    260b:	68 84 4f 00 00       	push   $0x4f84
+    2610:	6a 01                	push   $0x1
+    2612:	e8 d9 18 00 00       	call   3ef0 <printf>
+      exit();
+    2617:	e8 37 16 00 00       	call   3c53 <exit>
+      printf(1, "short read bigfile\n");
+    261c:	83 ec 08             	sub    $0x8,%esp
+    261f:	68 70 4f 00 00       	push   $0x4f70
+    2624:	6a 01                	push   $0x1
+    2626:	e8 c5 18 00 00       	call   3ef0 <printf>
+      exit();
+    262b:	e8 23 16 00 00       	call   3c53 <exit>
+      printf(1, "read bigfile failed\n");
+    2630:	83 ec 08             	sub    $0x8,%esp
+    2633:	68 5b 4f 00 00       	push   $0x4f5b
+    2638:	6a 01                	push   $0x1
+    263a:	e8 b1 18 00 00       	call   3ef0 <printf>
+      exit();
+    263f:	e8 0f 16 00 00       	call   3c53 <exit>
+      printf(1, "write bigfile failed\n");
+    2644:	83 ec 08             	sub    $0x8,%esp
+    2647:	68 30 4f 00 00       	push   $0x4f30
+    264c:	6a 01                	push   $0x1
+    264e:	e8 9d 18 00 00       	call   3ef0 <printf>
+      exit();
+    2653:	e8 fb 15 00 00       	call   3c53 <exit>
+    printf(1, "cannot open bigfile\n");
+    2658:	53                   	push   %ebx
+    2659:	53                   	push   %ebx
+    265a:	68 46 4f 00 00       	push   $0x4f46
+    265f:	6a 01                	push   $0x1
+    2661:	e8 8a 18 00 00       	call   3ef0 <printf>
+    exit();
+    2666:	e8 e8 15 00 00       	call   3c53 <exit>
+    printf(1, "cannot create bigfile");
+    266b:	50                   	push   %eax
+    266c:	50                   	push   %eax
+    266d:	68 1a 4f 00 00       	push   $0x4f1a
+    2672:	6a 01                	push   $0x1
+    2674:	e8 77 18 00 00       	call   3ef0 <printf>
+    exit();
+    2679:	e8 d5 15 00 00       	call   3c53 <exit>
+    printf(1, "read bigfile wrong total\n");
+    267e:	51                   	push   %ecx
+    267f:	51                   	push   %ecx
+    2680:	68 9d 4f 00 00       	push   $0x4f9d
+    2685:	6a 01                	push   $0x1
+    2687:	e8 64 18 00 00       	call   3ef0 <printf>
+    exit();
+    268c:	e8 c2 15 00 00       	call   3c53 <exit>
+    2691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    269f:	90                   	nop
+
+000026a0 <fourteen>:
+{
+    26a0:	55                   	push   %ebp
+    26a1:	89 e5                	mov    %esp,%ebp
+    26a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    26a6:	68 c8 4f 00 00       	push   $0x4fc8
+    26ab:	6a 01                	push   $0x1
+    26ad:	e8 3e 18 00 00       	call   3ef0 <printf>
+  if(mkdir("12345678901234") != 0){
+    26b2:	c7 04 24 03 50 00 00 	movl   $0x5003,(%esp)
+    26b9:	e8 fd 15 00 00       	call   3cbb <mkdir>
+    26be:	83 c4 10             	add    $0x10,%esp
+    26c1:	85 c0                	test   %eax,%eax
+    26c3:	0f 85 97 00 00 00    	jne    2760 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    26c9:	83 ec 0c             	sub    $0xc,%esp
+    26cc:	68 88 58 00 00       	push   $0x5888
+    26d1:	e8 e5 15 00 00       	call   3cbb <mkdir>
+    26d6:	83 c4 10             	add    $0x10,%esp
+    26d9:	85 c0                	test   %eax,%eax
+    26db:	0f 85 de 00 00 00    	jne    27bf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    26e1:	83 ec 08             	sub    $0x8,%esp
+    26e4:	68 00 02 00 00       	push   $0x200
+    26e9:	68 d8 58 00 00       	push   $0x58d8
+    26ee:	e8 a0 15 00 00       	call   3c93 <open>
+  if(fd < 0){
+    26f3:	83 c4 10             	add    $0x10,%esp
+    26f6:	85 c0                	test   %eax,%eax
+    26f8:	0f 88 ae 00 00 00    	js     27ac <fourteen+0x10c>
+  close(fd);
+    26fe:	83 ec 0c             	sub    $0xc,%esp
+    2701:	50                   	push   %eax
+    2702:	e8 74 15 00 00       	call   3c7b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2707:	58                   	pop    %eax
+    2708:	5a                   	pop    %edx
+    2709:	6a 00                	push   $0x0
+    270b:	68 48 59 00 00       	push   $0x5948
+    2710:	e8 7e 15 00 00       	call   3c93 <open>
+  if(fd < 0){
+    2715:	83 c4 10             	add    $0x10,%esp
+    2718:	85 c0                	test   %eax,%eax
+    271a:	78 7d                	js     2799 <fourteen+0xf9>
+  close(fd);
+    271c:	83 ec 0c             	sub    $0xc,%esp
+    271f:	50                   	push   %eax
+    2720:	e8 56 15 00 00       	call   3c7b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2725:	c7 04 24 f4 4f 00 00 	movl   $0x4ff4,(%esp)
+    272c:	e8 8a 15 00 00       	call   3cbb <mkdir>
+    2731:	83 c4 10             	add    $0x10,%esp
+    2734:	85 c0                	test   %eax,%eax
+    2736:	74 4e                	je     2786 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2738:	83 ec 0c             	sub    $0xc,%esp
+    273b:	68 e4 59 00 00       	push   $0x59e4
+    2740:	e8 76 15 00 00       	call   3cbb <mkdir>
+    2745:	83 c4 10             	add    $0x10,%esp
+    2748:	85 c0                	test   %eax,%eax
+    274a:	74 27                	je     2773 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    274c:	83 ec 08             	sub    $0x8,%esp
+    274f:	68 12 50 00 00       	push   $0x5012
+    2754:	6a 01                	push   $0x1
+    2756:	e8 95 17 00 00       	call   3ef0 <printf>
+}
+    275b:	83 c4 10             	add    $0x10,%esp
+    275e:	c9                   	leave
+    275f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2760:	50                   	push   %eax
+    2761:	50                   	push   %eax
+    2762:	68 d7 4f 00 00       	push   $0x4fd7
+    2767:	6a 01                	push   $0x1
+    2769:	e8 82 17 00 00       	call   3ef0 <printf>
+    exit();
+    276e:	e8 e0 14 00 00       	call   3c53 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2773:	50                   	push   %eax
+    2774:	50                   	push   %eax
+    2775:	68 04 5a 00 00       	push   $0x5a04
+    277a:	6a 01                	push   $0x1
+    277c:	e8 6f 17 00 00       	call   3ef0 <printf>
+    exit();
+    2781:	e8 cd 14 00 00       	call   3c53 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2786:	52                   	push   %edx
+    2787:	52                   	push   %edx
+    2788:	68 b4 59 00 00       	push   $0x59b4
+    278d:	6a 01                	push   $0x1
+    278f:	e8 5c 17 00 00       	call   3ef0 <printf>
+    exit();
+    2794:	e8 ba 14 00 00       	call   3c53 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2799:	51                   	push   %ecx
+    279a:	51                   	push   %ecx
+    279b:	68 78 59 00 00       	push   $0x5978
+    27a0:	6a 01                	push   $0x1
+    27a2:	e8 49 17 00 00       	call   3ef0 <printf>
+    exit();
+    27a7:	e8 a7 14 00 00       	call   3c53 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    27ac:	51                   	push   %ecx
+    27ad:	51                   	push   %ecx
+    27ae:	68 08 59 00 00       	push   $0x5908
+    27b3:	6a 01                	push   $0x1
+    27b5:	e8 36 17 00 00       	call   3ef0 <printf>
+    exit();
+    27ba:	e8 94 14 00 00       	call   3c53 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    27bf:	50                   	push   %eax
+    27c0:	50                   	push   %eax
+    27c1:	68 a8 58 00 00       	push   $0x58a8
+    27c6:	6a 01                	push   $0x1
+    27c8:	e8 23 17 00 00       	call   3ef0 <printf>
+    exit();
+    27cd:	e8 81 14 00 00       	call   3c53 <exit>
+    27d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000027e0 <rmdot>:
+{
+    27e0:	55                   	push   %ebp
+    27e1:	89 e5                	mov    %esp,%ebp
+    27e3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    27e6:	68 1f 50 00 00       	push   $0x501f
+    27eb:	6a 01                	push   $0x1
+    27ed:	e8 fe 16 00 00       	call   3ef0 <printf>
+  if(mkdir("dots") != 0){
+    27f2:	c7 04 24 2b 50 00 00 	movl   $0x502b,(%esp)
+    27f9:	e8 bd 14 00 00       	call   3cbb <mkdir>
+    27fe:	83 c4 10             	add    $0x10,%esp
+    2801:	85 c0                	test   %eax,%eax
+    2803:	0f 85 b0 00 00 00    	jne    28b9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2809:	83 ec 0c             	sub    $0xc,%esp
+    280c:	68 2b 50 00 00       	push   $0x502b
+    2811:	e8 ad 14 00 00       	call   3cc3 <chdir>
+    2816:	83 c4 10             	add    $0x10,%esp
+    2819:	85 c0                	test   %eax,%eax
+    281b:	0f 85 1d 01 00 00    	jne    293e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2821:	83 ec 0c             	sub    $0xc,%esp
+    2824:	68 d6 4c 00 00       	push   $0x4cd6
+    2829:	e8 75 14 00 00       	call   3ca3 <unlink>
+    282e:	83 c4 10             	add    $0x10,%esp
+    2831:	85 c0                	test   %eax,%eax
+    2833:	0f 84 f2 00 00 00    	je     292b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2839:	83 ec 0c             	sub    $0xc,%esp
+    283c:	68 d5 4c 00 00       	push   $0x4cd5
+    2841:	e8 5d 14 00 00       	call   3ca3 <unlink>
+    2846:	83 c4 10             	add    $0x10,%esp
+    2849:	85 c0                	test   %eax,%eax
+    284b:	0f 84 c7 00 00 00    	je     2918 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2851:	83 ec 0c             	sub    $0xc,%esp
+    2854:	68 a9 44 00 00       	push   $0x44a9
+    2859:	e8 65 14 00 00       	call   3cc3 <chdir>
+    285e:	83 c4 10             	add    $0x10,%esp
+    2861:	85 c0                	test   %eax,%eax
+    2863:	0f 85 9c 00 00 00    	jne    2905 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2869:	83 ec 0c             	sub    $0xc,%esp
+    286c:	68 73 50 00 00       	push   $0x5073
+    2871:	e8 2d 14 00 00       	call   3ca3 <unlink>
+    2876:	83 c4 10             	add    $0x10,%esp
+    2879:	85 c0                	test   %eax,%eax
+    287b:	74 75                	je     28f2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    287d:	83 ec 0c             	sub    $0xc,%esp
+    2880:	68 91 50 00 00       	push   $0x5091
+    2885:	e8 19 14 00 00       	call   3ca3 <unlink>
+    288a:	83 c4 10             	add    $0x10,%esp
+    288d:	85 c0                	test   %eax,%eax
+    288f:	74 4e                	je     28df <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2891:	83 ec 0c             	sub    $0xc,%esp
+    2894:	68 2b 50 00 00       	push   $0x502b
+    2899:	e8 05 14 00 00       	call   3ca3 <unlink>
+    289e:	83 c4 10             	add    $0x10,%esp
+    28a1:	85 c0                	test   %eax,%eax
+    28a3:	75 27                	jne    28cc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    28a5:	83 ec 08             	sub    $0x8,%esp
+    28a8:	68 c6 50 00 00       	push   $0x50c6
+    28ad:	6a 01                	push   $0x1
+    28af:	e8 3c 16 00 00       	call   3ef0 <printf>
+}
+    28b4:	83 c4 10             	add    $0x10,%esp
+    28b7:	c9                   	leave
+    28b8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    28b9:	50                   	push   %eax
+    28ba:	50                   	push   %eax
+    28bb:	68 30 50 00 00       	push   $0x5030
+    28c0:	6a 01                	push   $0x1
+    28c2:	e8 29 16 00 00       	call   3ef0 <printf>
+    exit();
+    28c7:	e8 87 13 00 00       	call   3c53 <exit>
+    printf(1, "unlink dots failed!\n");
+    28cc:	50                   	push   %eax
+    28cd:	50                   	push   %eax
+    28ce:	68 b1 50 00 00       	push   $0x50b1
+    28d3:	6a 01                	push   $0x1
+    28d5:	e8 16 16 00 00       	call   3ef0 <printf>
+    exit();
+    28da:	e8 74 13 00 00       	call   3c53 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    28df:	52                   	push   %edx
+    28e0:	52                   	push   %edx
+    28e1:	68 99 50 00 00       	push   $0x5099
+    28e6:	6a 01                	push   $0x1
+    28e8:	e8 03 16 00 00       	call   3ef0 <printf>
+    exit();
+    28ed:	e8 61 13 00 00       	call   3c53 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    28f2:	51                   	push   %ecx
+    28f3:	51                   	push   %ecx
+    28f4:	68 7a 50 00 00       	push   $0x507a
+    28f9:	6a 01                	push   $0x1
+    28fb:	e8 f0 15 00 00       	call   3ef0 <printf>
+    exit();
+    2900:	e8 4e 13 00 00       	call   3c53 <exit>
+    printf(1, "chdir / failed\n");
+    2905:	50                   	push   %eax
+    2906:	50                   	push   %eax
+    2907:	68 ab 44 00 00       	push   $0x44ab
+    290c:	6a 01                	push   $0x1
+    290e:	e8 dd 15 00 00       	call   3ef0 <printf>
+    exit();
+    2913:	e8 3b 13 00 00       	call   3c53 <exit>
+    printf(1, "rm .. worked!\n");
+    2918:	50                   	push   %eax
+    2919:	50                   	push   %eax
+    291a:	68 64 50 00 00       	push   $0x5064
+    291f:	6a 01                	push   $0x1
+    2921:	e8 ca 15 00 00       	call   3ef0 <printf>
+    exit();
+    2926:	e8 28 13 00 00       	call   3c53 <exit>
+    printf(1, "rm . worked!\n");
+    292b:	50                   	push   %eax
+    292c:	50                   	push   %eax
+    292d:	68 56 50 00 00       	push   $0x5056
+    2932:	6a 01                	push   $0x1
+    2934:	e8 b7 15 00 00       	call   3ef0 <printf>
+    exit();
+    2939:	e8 15 13 00 00       	call   3c53 <exit>
+    printf(1, "chdir dots failed\n");
+    293e:	50                   	push   %eax
+    293f:	50                   	push   %eax
+    2940:	68 43 50 00 00       	push   $0x5043
+    2945:	6a 01                	push   $0x1
+    2947:	e8 a4 15 00 00       	call   3ef0 <printf>
+    exit();
+    294c:	e8 02 13 00 00       	call   3c53 <exit>
+    2951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    295f:	90                   	nop
+
+00002960 <dirfile>:
+{
+    2960:	55                   	push   %ebp
+    2961:	89 e5                	mov    %esp,%ebp
+    2963:	53                   	push   %ebx
+    2964:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2967:	68 d0 50 00 00       	push   $0x50d0
+    296c:	6a 01                	push   $0x1
+    296e:	e8 7d 15 00 00       	call   3ef0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2973:	5b                   	pop    %ebx
+    2974:	58                   	pop    %eax
+    2975:	68 00 02 00 00       	push   $0x200
+    297a:	68 dd 50 00 00       	push   $0x50dd
+    297f:	e8 0f 13 00 00       	call   3c93 <open>
+  if(fd < 0){
+    2984:	83 c4 10             	add    $0x10,%esp
+    2987:	85 c0                	test   %eax,%eax
+    2989:	0f 88 43 01 00 00    	js     2ad2 <dirfile+0x172>
+  close(fd);
+    298f:	83 ec 0c             	sub    $0xc,%esp
+    2992:	50                   	push   %eax
+    2993:	e8 e3 12 00 00       	call   3c7b <close>
+  if(chdir("dirfile") == 0){
+    2998:	c7 04 24 dd 50 00 00 	movl   $0x50dd,(%esp)
+    299f:	e8 1f 13 00 00       	call   3cc3 <chdir>
+    29a4:	83 c4 10             	add    $0x10,%esp
+    29a7:	85 c0                	test   %eax,%eax
+    29a9:	0f 84 10 01 00 00    	je     2abf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    29af:	83 ec 08             	sub    $0x8,%esp
+    29b2:	6a 00                	push   $0x0
+    29b4:	68 16 51 00 00       	push   $0x5116
+    29b9:	e8 d5 12 00 00       	call   3c93 <open>
+  if(fd >= 0){
+    29be:	83 c4 10             	add    $0x10,%esp
+    29c1:	85 c0                	test   %eax,%eax
+    29c3:	0f 89 e3 00 00 00    	jns    2aac <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    29c9:	83 ec 08             	sub    $0x8,%esp
+    29cc:	68 00 02 00 00       	push   $0x200
+    29d1:	68 16 51 00 00       	push   $0x5116
+    29d6:	e8 b8 12 00 00       	call   3c93 <open>
+  if(fd >= 0){
+    29db:	83 c4 10             	add    $0x10,%esp
+    29de:	85 c0                	test   %eax,%eax
+    29e0:	0f 89 c6 00 00 00    	jns    2aac <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    29e6:	83 ec 0c             	sub    $0xc,%esp
+    29e9:	68 16 51 00 00       	push   $0x5116
+    29ee:	e8 c8 12 00 00       	call   3cbb <mkdir>
+    29f3:	83 c4 10             	add    $0x10,%esp
+    29f6:	85 c0                	test   %eax,%eax
+    29f8:	0f 84 46 01 00 00    	je     2b44 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    29fe:	83 ec 0c             	sub    $0xc,%esp
+    2a01:	68 16 51 00 00       	push   $0x5116
+    2a06:	e8 98 12 00 00       	call   3ca3 <unlink>
+    2a0b:	83 c4 10             	add    $0x10,%esp
+    2a0e:	85 c0                	test   %eax,%eax
+    2a10:	0f 84 1b 01 00 00    	je     2b31 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2a16:	83 ec 08             	sub    $0x8,%esp
+    2a19:	68 16 51 00 00       	push   $0x5116
+    2a1e:	68 7a 51 00 00       	push   $0x517a
+    2a23:	e8 8b 12 00 00       	call   3cb3 <link>
+    2a28:	83 c4 10             	add    $0x10,%esp
+    2a2b:	85 c0                	test   %eax,%eax
+    2a2d:	0f 84 eb 00 00 00    	je     2b1e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2a33:	83 ec 0c             	sub    $0xc,%esp
+    2a36:	68 dd 50 00 00       	push   $0x50dd
+    2a3b:	e8 63 12 00 00       	call   3ca3 <unlink>
+    2a40:	83 c4 10             	add    $0x10,%esp
+    2a43:	85 c0                	test   %eax,%eax
+    2a45:	0f 85 c0 00 00 00    	jne    2b0b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2a4b:	83 ec 08             	sub    $0x8,%esp
+    2a4e:	6a 02                	push   $0x2
+    2a50:	68 d6 4c 00 00       	push   $0x4cd6
+    2a55:	e8 39 12 00 00       	call   3c93 <open>
+  if(fd >= 0){
+    2a5a:	83 c4 10             	add    $0x10,%esp
+    2a5d:	85 c0                	test   %eax,%eax
+    2a5f:	0f 89 93 00 00 00    	jns    2af8 <dirfile+0x198>
+  fd = open(".", 0);
+    2a65:	83 ec 08             	sub    $0x8,%esp
+    2a68:	6a 00                	push   $0x0
+    2a6a:	68 d6 4c 00 00       	push   $0x4cd6
+    2a6f:	e8 1f 12 00 00       	call   3c93 <open>
+  if(write(fd, "x", 1) > 0){
+    2a74:	83 c4 0c             	add    $0xc,%esp
+    2a77:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2a79:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2a7b:	68 b9 4d 00 00       	push   $0x4db9
+    2a80:	50                   	push   %eax
+    2a81:	e8 ed 11 00 00       	call   3c73 <write>
+    2a86:	83 c4 10             	add    $0x10,%esp
+    2a89:	85 c0                	test   %eax,%eax
+    2a8b:	7f 58                	jg     2ae5 <dirfile+0x185>
+  close(fd);
+    2a8d:	83 ec 0c             	sub    $0xc,%esp
+    2a90:	53                   	push   %ebx
+    2a91:	e8 e5 11 00 00       	call   3c7b <close>
+  printf(1, "dir vs file OK\n");
+    2a96:	58                   	pop    %eax
+    2a97:	5a                   	pop    %edx
+    2a98:	68 ad 51 00 00       	push   $0x51ad
+    2a9d:	6a 01                	push   $0x1
+    2a9f:	e8 4c 14 00 00       	call   3ef0 <printf>
+}
+    2aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2aa7:	83 c4 10             	add    $0x10,%esp
+    2aaa:	c9                   	leave
+    2aab:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2aac:	50                   	push   %eax
+    2aad:	50                   	push   %eax
+    2aae:	68 21 51 00 00       	push   $0x5121
+    2ab3:	6a 01                	push   $0x1
+    2ab5:	e8 36 14 00 00       	call   3ef0 <printf>
+    exit();
+    2aba:	e8 94 11 00 00       	call   3c53 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2abf:	52                   	push   %edx
+    2ac0:	52                   	push   %edx
+    2ac1:	68 fc 50 00 00       	push   $0x50fc
+    2ac6:	6a 01                	push   $0x1
+    2ac8:	e8 23 14 00 00       	call   3ef0 <printf>
+    exit();
+    2acd:	e8 81 11 00 00       	call   3c53 <exit>
+    printf(1, "create dirfile failed\n");
+    2ad2:	51                   	push   %ecx
+    2ad3:	51                   	push   %ecx
+    2ad4:	68 e5 50 00 00       	push   $0x50e5
+    2ad9:	6a 01                	push   $0x1
+    2adb:	e8 10 14 00 00       	call   3ef0 <printf>
+    exit();
+    2ae0:	e8 6e 11 00 00       	call   3c53 <exit>
+    printf(1, "write . succeeded!\n");
+    2ae5:	51                   	push   %ecx
+    2ae6:	51                   	push   %ecx
+    2ae7:	68 99 51 00 00       	push   $0x5199
+    2aec:	6a 01                	push   $0x1
+    2aee:	e8 fd 13 00 00       	call   3ef0 <printf>
+    exit();
+    2af3:	e8 5b 11 00 00       	call   3c53 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2af8:	53                   	push   %ebx
+    2af9:	53                   	push   %ebx
+    2afa:	68 58 5a 00 00       	push   $0x5a58
+    2aff:	6a 01                	push   $0x1
+    2b01:	e8 ea 13 00 00       	call   3ef0 <printf>
+    exit();
+    2b06:	e8 48 11 00 00       	call   3c53 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2b0b:	50                   	push   %eax
+    2b0c:	50                   	push   %eax
+    2b0d:	68 81 51 00 00       	push   $0x5181
+    2b12:	6a 01                	push   $0x1
+    2b14:	e8 d7 13 00 00       	call   3ef0 <printf>
+    exit();
+    2b19:	e8 35 11 00 00       	call   3c53 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2b1e:	50                   	push   %eax
+    2b1f:	50                   	push   %eax
+    2b20:	68 38 5a 00 00       	push   $0x5a38
+    2b25:	6a 01                	push   $0x1
+    2b27:	e8 c4 13 00 00       	call   3ef0 <printf>
+    exit();
+    2b2c:	e8 22 11 00 00       	call   3c53 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2b31:	50                   	push   %eax
+    2b32:	50                   	push   %eax
+    2b33:	68 5c 51 00 00       	push   $0x515c
+    2b38:	6a 01                	push   $0x1
+    2b3a:	e8 b1 13 00 00       	call   3ef0 <printf>
+    exit();
+    2b3f:	e8 0f 11 00 00       	call   3c53 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2b44:	50                   	push   %eax
+    2b45:	50                   	push   %eax
+    2b46:	68 3f 51 00 00       	push   $0x513f
+    2b4b:	6a 01                	push   $0x1
+    2b4d:	e8 9e 13 00 00       	call   3ef0 <printf>
+    exit();
+    2b52:	e8 fc 10 00 00       	call   3c53 <exit>
+    2b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b5e:	66 90                	xchg   %ax,%ax
+
+00002b60 <iref>:
+{
+    2b60:	55                   	push   %ebp
+    2b61:	89 e5                	mov    %esp,%ebp
+    2b63:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2b64:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2b69:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2b6c:	68 bd 51 00 00       	push   $0x51bd
+    2b71:	6a 01                	push   $0x1
+    2b73:	e8 78 13 00 00       	call   3ef0 <printf>
+    2b78:	83 c4 10             	add    $0x10,%esp
+    2b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2b7f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2b80:	83 ec 0c             	sub    $0xc,%esp
+    2b83:	68 ce 51 00 00       	push   $0x51ce
+    2b88:	e8 2e 11 00 00       	call   3cbb <mkdir>
+    2b8d:	83 c4 10             	add    $0x10,%esp
+    2b90:	85 c0                	test   %eax,%eax
+    2b92:	0f 85 bb 00 00 00    	jne    2c53 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2b98:	83 ec 0c             	sub    $0xc,%esp
+    2b9b:	68 ce 51 00 00       	push   $0x51ce
+    2ba0:	e8 1e 11 00 00       	call   3cc3 <chdir>
+    2ba5:	83 c4 10             	add    $0x10,%esp
+    2ba8:	85 c0                	test   %eax,%eax
+    2baa:	0f 85 b7 00 00 00    	jne    2c67 <iref+0x107>
+    mkdir("");
+    2bb0:	83 ec 0c             	sub    $0xc,%esp
+    2bb3:	68 83 48 00 00       	push   $0x4883
+    2bb8:	e8 fe 10 00 00       	call   3cbb <mkdir>
+    link("README", "");
+    2bbd:	59                   	pop    %ecx
+    2bbe:	58                   	pop    %eax
+    2bbf:	68 83 48 00 00       	push   $0x4883
+    2bc4:	68 7a 51 00 00       	push   $0x517a
+    2bc9:	e8 e5 10 00 00       	call   3cb3 <link>
+    fd = open("", O_CREATE);
+    2bce:	58                   	pop    %eax
+    2bcf:	5a                   	pop    %edx
+    2bd0:	68 00 02 00 00       	push   $0x200
+    2bd5:	68 83 48 00 00       	push   $0x4883
+    2bda:	e8 b4 10 00 00       	call   3c93 <open>
+    if(fd >= 0)
+    2bdf:	83 c4 10             	add    $0x10,%esp
+    2be2:	85 c0                	test   %eax,%eax
+    2be4:	78 0c                	js     2bf2 <iref+0x92>
+      close(fd);
+    2be6:	83 ec 0c             	sub    $0xc,%esp
+    2be9:	50                   	push   %eax
+    2bea:	e8 8c 10 00 00       	call   3c7b <close>
+    2bef:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2bf2:	83 ec 08             	sub    $0x8,%esp
+    2bf5:	68 00 02 00 00       	push   $0x200
+    2bfa:	68 b8 4d 00 00       	push   $0x4db8
+    2bff:	e8 8f 10 00 00       	call   3c93 <open>
+    if(fd >= 0)
+    2c04:	83 c4 10             	add    $0x10,%esp
+    2c07:	85 c0                	test   %eax,%eax
+    2c09:	78 0c                	js     2c17 <iref+0xb7>
+      close(fd);
+    2c0b:	83 ec 0c             	sub    $0xc,%esp
+    2c0e:	50                   	push   %eax
+    2c0f:	e8 67 10 00 00       	call   3c7b <close>
+    2c14:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2c17:	83 ec 0c             	sub    $0xc,%esp
+    2c1a:	68 b8 4d 00 00       	push   $0x4db8
+    2c1f:	e8 7f 10 00 00       	call   3ca3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2c24:	83 c4 10             	add    $0x10,%esp
+    2c27:	83 eb 01             	sub    $0x1,%ebx
+    2c2a:	0f 85 50 ff ff ff    	jne    2b80 <iref+0x20>
+  chdir("/");
+    2c30:	83 ec 0c             	sub    $0xc,%esp
+    2c33:	68 a9 44 00 00       	push   $0x44a9
+    2c38:	e8 86 10 00 00       	call   3cc3 <chdir>
+  printf(1, "empty file name OK\n");
+    2c3d:	58                   	pop    %eax
+    2c3e:	5a                   	pop    %edx
+    2c3f:	68 fc 51 00 00       	push   $0x51fc
+    2c44:	6a 01                	push   $0x1
+    2c46:	e8 a5 12 00 00       	call   3ef0 <printf>
+}
+    2c4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c4e:	83 c4 10             	add    $0x10,%esp
+    2c51:	c9                   	leave
+    2c52:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2c53:	83 ec 08             	sub    $0x8,%esp
+    2c56:	68 d4 51 00 00       	push   $0x51d4
+    2c5b:	6a 01                	push   $0x1
+    2c5d:	e8 8e 12 00 00       	call   3ef0 <printf>
+      exit();
+    2c62:	e8 ec 0f 00 00       	call   3c53 <exit>
+      printf(1, "chdir irefd failed\n");
+    2c67:	83 ec 08             	sub    $0x8,%esp
+    2c6a:	68 e8 51 00 00       	push   $0x51e8
+    2c6f:	6a 01                	push   $0x1
+    2c71:	e8 7a 12 00 00       	call   3ef0 <printf>
+      exit();
+    2c76:	e8 d8 0f 00 00       	call   3c53 <exit>
+    2c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c7f:	90                   	nop
+
+00002c80 <forktest>:
+{
+    2c80:	55                   	push   %ebp
+    2c81:	89 e5                	mov    %esp,%ebp
+    2c83:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2c84:	31 db                	xor    %ebx,%ebx
+{
+    2c86:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2c89:	68 10 52 00 00       	push   $0x5210
+    2c8e:	6a 01                	push   $0x1
+    2c90:	e8 5b 12 00 00       	call   3ef0 <printf>
+    2c95:	83 c4 10             	add    $0x10,%esp
+    2c98:	eb 13                	jmp    2cad <forktest+0x2d>
+    2c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2ca0:	74 4d                	je     2cef <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2ca2:	83 c3 01             	add    $0x1,%ebx
+    2ca5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2cab:	74 6e                	je     2d1b <forktest+0x9b>
+    pid = fork();
+    2cad:	e8 99 0f 00 00       	call   3c4b <fork>
+    if(pid < 0)
+    2cb2:	85 c0                	test   %eax,%eax
+    2cb4:	79 ea                	jns    2ca0 <forktest+0x20>
+  for(; n > 0; n--){
+    2cb6:	85 db                	test   %ebx,%ebx
+    2cb8:	74 14                	je     2cce <forktest+0x4e>
+    2cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2cc0:	e8 96 0f 00 00       	call   3c5b <wait>
+    2cc5:	85 c0                	test   %eax,%eax
+    2cc7:	78 2b                	js     2cf4 <forktest+0x74>
+  for(; n > 0; n--){
+    2cc9:	83 eb 01             	sub    $0x1,%ebx
+    2ccc:	75 f2                	jne    2cc0 <forktest+0x40>
+  if(wait() != -1){
+    2cce:	e8 88 0f 00 00       	call   3c5b <wait>
+    2cd3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2cd6:	75 30                	jne    2d08 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2cd8:	83 ec 08             	sub    $0x8,%esp
+    2cdb:	68 42 52 00 00       	push   $0x5242
+    2ce0:	6a 01                	push   $0x1
+    2ce2:	e8 09 12 00 00       	call   3ef0 <printf>
+}
+    2ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2cea:	83 c4 10             	add    $0x10,%esp
+    2ced:	c9                   	leave
+    2cee:	c3                   	ret
+      exit();
+    2cef:	e8 5f 0f 00 00       	call   3c53 <exit>
+      printf(1, "wait stopped early\n");
+    2cf4:	83 ec 08             	sub    $0x8,%esp
+    2cf7:	68 1b 52 00 00       	push   $0x521b
+    2cfc:	6a 01                	push   $0x1
+    2cfe:	e8 ed 11 00 00       	call   3ef0 <printf>
+      exit();
+    2d03:	e8 4b 0f 00 00       	call   3c53 <exit>
+    printf(1, "wait got too many\n");
+    2d08:	50                   	push   %eax
+    2d09:	50                   	push   %eax
+    2d0a:	68 2f 52 00 00       	push   $0x522f
+    2d0f:	6a 01                	push   $0x1
+    2d11:	e8 da 11 00 00       	call   3ef0 <printf>
+    exit();
+    2d16:	e8 38 0f 00 00       	call   3c53 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2d1b:	52                   	push   %edx
+    2d1c:	52                   	push   %edx
+    2d1d:	68 78 5a 00 00       	push   $0x5a78
+    2d22:	6a 01                	push   $0x1
+    2d24:	e8 c7 11 00 00       	call   3ef0 <printf>
+    exit();
+    2d29:	e8 25 0f 00 00       	call   3c53 <exit>
+    2d2e:	66 90                	xchg   %ax,%ax
+
+00002d30 <sbrktest>:
+{
+    2d30:	55                   	push   %ebp
+    2d31:	89 e5                	mov    %esp,%ebp
+    2d33:	57                   	push   %edi
+    2d34:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2d35:	31 f6                	xor    %esi,%esi
+{
+    2d37:	53                   	push   %ebx
+    2d38:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2d3b:	68 50 52 00 00       	push   $0x5250
+    2d40:	ff 35 94 67 00 00    	push   0x6794
+    2d46:	e8 a5 11 00 00       	call   3ef0 <printf>
+  oldbrk = sbrk(0);
+    2d4b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d52:	e8 84 0f 00 00       	call   3cdb <sbrk>
+    2d57:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2d5a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d61:	e8 75 0f 00 00       	call   3cdb <sbrk>
+    2d66:	83 c4 10             	add    $0x10,%esp
+    2d69:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2d6b:	eb 05                	jmp    2d72 <sbrktest+0x42>
+    2d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2d70:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2d72:	83 ec 0c             	sub    $0xc,%esp
+    2d75:	6a 01                	push   $0x1
+    2d77:	e8 5f 0f 00 00       	call   3cdb <sbrk>
+    if(b != a){
+    2d7c:	83 c4 10             	add    $0x10,%esp
+    2d7f:	39 d8                	cmp    %ebx,%eax
+    2d81:	0f 85 9c 02 00 00    	jne    3023 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    2d87:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    2d8a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2d8d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2d90:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2d96:	75 d8                	jne    2d70 <sbrktest+0x40>
+  pid = fork();
+    2d98:	e8 ae 0e 00 00       	call   3c4b <fork>
+    2d9d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2d9f:	85 c0                	test   %eax,%eax
+    2da1:	0f 88 02 03 00 00    	js     30a9 <sbrktest+0x379>
+  c = sbrk(1);
+    2da7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    2daa:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    2dad:	6a 01                	push   $0x1
+    2daf:	e8 27 0f 00 00       	call   3cdb <sbrk>
+  c = sbrk(1);
+    2db4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2dbb:	e8 1b 0f 00 00       	call   3cdb <sbrk>
+  if(c != a + 1){
+    2dc0:	83 c4 10             	add    $0x10,%esp
+    2dc3:	39 c3                	cmp    %eax,%ebx
+    2dc5:	0f 85 3b 03 00 00    	jne    3106 <sbrktest+0x3d6>
+  if(pid == 0)
+    2dcb:	85 f6                	test   %esi,%esi
+    2dcd:	0f 84 2e 03 00 00    	je     3101 <sbrktest+0x3d1>
+  wait();
+    2dd3:	e8 83 0e 00 00       	call   3c5b <wait>
+  a = sbrk(0);
+    2dd8:	83 ec 0c             	sub    $0xc,%esp
+    2ddb:	6a 00                	push   $0x0
+    2ddd:	e8 f9 0e 00 00       	call   3cdb <sbrk>
+    2de2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2de4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2de9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2deb:	89 04 24             	mov    %eax,(%esp)
+    2dee:	e8 e8 0e 00 00       	call   3cdb <sbrk>
+  if (p != a) {
+    2df3:	83 c4 10             	add    $0x10,%esp
+    2df6:	39 c3                	cmp    %eax,%ebx
+    2df8:	0f 85 94 02 00 00    	jne    3092 <sbrktest+0x362>
+  a = sbrk(0);
+    2dfe:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    2e01:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    2e08:	6a 00                	push   $0x0
+    2e0a:	e8 cc 0e 00 00       	call   3cdb <sbrk>
+  c = sbrk(-4096);
+    2e0f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    2e16:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2e18:	e8 be 0e 00 00       	call   3cdb <sbrk>
+  if(c == (char*)0xffffffff){
+    2e1d:	83 c4 10             	add    $0x10,%esp
+    2e20:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e23:	0f 84 22 03 00 00    	je     314b <sbrktest+0x41b>
+  c = sbrk(0);
+    2e29:	83 ec 0c             	sub    $0xc,%esp
+    2e2c:	6a 00                	push   $0x0
+    2e2e:	e8 a8 0e 00 00       	call   3cdb <sbrk>
+  if(c != a - 4096){
+    2e33:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2e39:	83 c4 10             	add    $0x10,%esp
+    2e3c:	39 d0                	cmp    %edx,%eax
+    2e3e:	0f 85 f0 02 00 00    	jne    3134 <sbrktest+0x404>
+  a = sbrk(0);
+    2e44:	83 ec 0c             	sub    $0xc,%esp
+    2e47:	6a 00                	push   $0x0
+    2e49:	e8 8d 0e 00 00       	call   3cdb <sbrk>
+  c = sbrk(4096);
+    2e4e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    2e55:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2e57:	e8 7f 0e 00 00       	call   3cdb <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    2e5c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    2e5f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2e61:	39 c3                	cmp    %eax,%ebx
+    2e63:	0f 85 b4 02 00 00    	jne    311d <sbrktest+0x3ed>
+    2e69:	83 ec 0c             	sub    $0xc,%esp
+    2e6c:	6a 00                	push   $0x0
+    2e6e:	e8 68 0e 00 00       	call   3cdb <sbrk>
+    2e73:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2e79:	83 c4 10             	add    $0x10,%esp
+    2e7c:	39 c2                	cmp    %eax,%edx
+    2e7e:	0f 85 99 02 00 00    	jne    311d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    2e84:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2e8b:	0f 84 2f 02 00 00    	je     30c0 <sbrktest+0x390>
+  a = sbrk(0);
+    2e91:	83 ec 0c             	sub    $0xc,%esp
+    2e94:	6a 00                	push   $0x0
+    2e96:	e8 40 0e 00 00       	call   3cdb <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2e9b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    2ea2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2ea4:	e8 32 0e 00 00       	call   3cdb <sbrk>
+    2ea9:	89 c2                	mov    %eax,%edx
+    2eab:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2eae:	29 d0                	sub    %edx,%eax
+    2eb0:	89 04 24             	mov    %eax,(%esp)
+    2eb3:	e8 23 0e 00 00       	call   3cdb <sbrk>
+  if(c != a){
+    2eb8:	83 c4 10             	add    $0x10,%esp
+    2ebb:	39 c3                	cmp    %eax,%ebx
+    2ebd:	0f 85 b8 01 00 00    	jne    307b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2ec3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ecf:	90                   	nop
+    ppid = getpid();
+    2ed0:	e8 fe 0d 00 00       	call   3cd3 <getpid>
+    2ed5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2ed7:	e8 6f 0d 00 00       	call   3c4b <fork>
+    if(pid < 0){
+    2edc:	85 c0                	test   %eax,%eax
+    2ede:	0f 88 5d 01 00 00    	js     3041 <sbrktest+0x311>
+    if(pid == 0){
+    2ee4:	0f 84 6f 01 00 00    	je     3059 <sbrktest+0x329>
+    wait();
+    2eea:	e8 6c 0d 00 00       	call   3c5b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2eef:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2ef5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2efb:	75 d3                	jne    2ed0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    2efd:	83 ec 0c             	sub    $0xc,%esp
+    2f00:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    2f03:	50                   	push   %eax
+    2f04:	e8 5a 0d 00 00       	call   3c63 <pipe>
+    2f09:	83 c4 10             	add    $0x10,%esp
+    2f0c:	85 c0                	test   %eax,%eax
+    2f0e:	0f 85 da 01 00 00    	jne    30ee <sbrktest+0x3be>
+    2f14:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    2f17:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    2f1a:	89 df                	mov    %ebx,%edi
+    2f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    2f20:	e8 26 0d 00 00       	call   3c4b <fork>
+    2f25:	89 07                	mov    %eax,(%edi)
+    2f27:	85 c0                	test   %eax,%eax
+    2f29:	0f 84 91 00 00 00    	je     2fc0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    2f2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f32:	74 14                	je     2f48 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    2f34:	83 ec 04             	sub    $0x4,%esp
+    2f37:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2f3a:	6a 01                	push   $0x1
+    2f3c:	50                   	push   %eax
+    2f3d:	ff 75 b8             	push   -0x48(%ebp)
+    2f40:	e8 26 0d 00 00       	call   3c6b <read>
+    2f45:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f48:	83 c7 04             	add    $0x4,%edi
+    2f4b:	39 f7                	cmp    %esi,%edi
+    2f4d:	75 d1                	jne    2f20 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    2f4f:	83 ec 0c             	sub    $0xc,%esp
+    2f52:	68 00 10 00 00       	push   $0x1000
+    2f57:	e8 7f 0d 00 00       	call   3cdb <sbrk>
+    2f5c:	83 c4 10             	add    $0x10,%esp
+    2f5f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    2f68:	8b 03                	mov    (%ebx),%eax
+    2f6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f6d:	74 11                	je     2f80 <sbrktest+0x250>
+    kill(pids[i]);
+    2f6f:	83 ec 0c             	sub    $0xc,%esp
+    2f72:	50                   	push   %eax
+    2f73:	e8 0b 0d 00 00       	call   3c83 <kill>
+    wait();
+    2f78:	e8 de 0c 00 00       	call   3c5b <wait>
+    2f7d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f80:	83 c3 04             	add    $0x4,%ebx
+    2f83:	39 f3                	cmp    %esi,%ebx
+    2f85:	75 e1                	jne    2f68 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    2f87:	83 ff ff             	cmp    $0xffffffff,%edi
+    2f8a:	0f 84 47 01 00 00    	je     30d7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    2f90:	83 ec 0c             	sub    $0xc,%esp
+    2f93:	6a 00                	push   $0x0
+    2f95:	e8 41 0d 00 00       	call   3cdb <sbrk>
+    2f9a:	83 c4 10             	add    $0x10,%esp
+    2f9d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    2fa0:	72 60                	jb     3002 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    2fa2:	83 ec 08             	sub    $0x8,%esp
+    2fa5:	68 f8 52 00 00       	push   $0x52f8
+    2faa:	ff 35 94 67 00 00    	push   0x6794
+    2fb0:	e8 3b 0f 00 00       	call   3ef0 <printf>
+}
+    2fb5:	83 c4 10             	add    $0x10,%esp
+    2fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2fbb:	5b                   	pop    %ebx
+    2fbc:	5e                   	pop    %esi
+    2fbd:	5f                   	pop    %edi
+    2fbe:	5d                   	pop    %ebp
+    2fbf:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    2fc0:	83 ec 0c             	sub    $0xc,%esp
+    2fc3:	6a 00                	push   $0x0
+    2fc5:	e8 11 0d 00 00       	call   3cdb <sbrk>
+    2fca:	89 c2                	mov    %eax,%edx
+    2fcc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2fd1:	29 d0                	sub    %edx,%eax
+    2fd3:	89 04 24             	mov    %eax,(%esp)
+    2fd6:	e8 00 0d 00 00       	call   3cdb <sbrk>
+      write(fds[1], "x", 1);
+    2fdb:	83 c4 0c             	add    $0xc,%esp
+    2fde:	6a 01                	push   $0x1
+    2fe0:	68 b9 4d 00 00       	push   $0x4db9
+    2fe5:	ff 75 bc             	push   -0x44(%ebp)
+    2fe8:	e8 86 0c 00 00       	call   3c73 <write>
+    2fed:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    2ff0:	83 ec 0c             	sub    $0xc,%esp
+    2ff3:	68 e8 03 00 00       	push   $0x3e8
+    2ff8:	e8 e6 0c 00 00       	call   3ce3 <sleep>
+    2ffd:	83 c4 10             	add    $0x10,%esp
+    3000:	eb ee                	jmp    2ff0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3002:	83 ec 0c             	sub    $0xc,%esp
+    3005:	6a 00                	push   $0x0
+    3007:	e8 cf 0c 00 00       	call   3cdb <sbrk>
+    300c:	89 c2                	mov    %eax,%edx
+    300e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3011:	29 d0                	sub    %edx,%eax
+    3013:	89 04 24             	mov    %eax,(%esp)
+    3016:	e8 c0 0c 00 00       	call   3cdb <sbrk>
+    301b:	83 c4 10             	add    $0x10,%esp
+    301e:	e9 7f ff ff ff       	jmp    2fa2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3023:	83 ec 0c             	sub    $0xc,%esp
+    3026:	50                   	push   %eax
+    3027:	53                   	push   %ebx
+    3028:	56                   	push   %esi
+    3029:	68 5b 52 00 00       	push   $0x525b
+    302e:	ff 35 94 67 00 00    	push   0x6794
+    3034:	e8 b7 0e 00 00       	call   3ef0 <printf>
+      exit();
+    3039:	83 c4 20             	add    $0x20,%esp
+    303c:	e8 12 0c 00 00       	call   3c53 <exit>
+      printf(stdout, "fork failed\n");
+    3041:	83 ec 08             	sub    $0x8,%esp
+    3044:	68 a1 53 00 00       	push   $0x53a1
+    3049:	ff 35 94 67 00 00    	push   0x6794
+    304f:	e8 9c 0e 00 00       	call   3ef0 <printf>
+      exit();
+    3054:	e8 fa 0b 00 00       	call   3c53 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3059:	0f be 03             	movsbl (%ebx),%eax
+    305c:	50                   	push   %eax
+    305d:	53                   	push   %ebx
+    305e:	68 c4 52 00 00       	push   $0x52c4
+    3063:	ff 35 94 67 00 00    	push   0x6794
+    3069:	e8 82 0e 00 00       	call   3ef0 <printf>
+      kill(ppid);
+    306e:	89 34 24             	mov    %esi,(%esp)
+    3071:	e8 0d 0c 00 00       	call   3c83 <kill>
+      exit();
+    3076:	e8 d8 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    307b:	50                   	push   %eax
+    307c:	53                   	push   %ebx
+    307d:	68 6c 5b 00 00       	push   $0x5b6c
+    3082:	ff 35 94 67 00 00    	push   0x6794
+    3088:	e8 63 0e 00 00       	call   3ef0 <printf>
+    exit();
+    308d:	e8 c1 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3092:	56                   	push   %esi
+    3093:	56                   	push   %esi
+    3094:	68 9c 5a 00 00       	push   $0x5a9c
+    3099:	ff 35 94 67 00 00    	push   0x6794
+    309f:	e8 4c 0e 00 00       	call   3ef0 <printf>
+    exit();
+    30a4:	e8 aa 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    30a9:	50                   	push   %eax
+    30aa:	50                   	push   %eax
+    30ab:	68 76 52 00 00       	push   $0x5276
+    30b0:	ff 35 94 67 00 00    	push   0x6794
+    30b6:	e8 35 0e 00 00       	call   3ef0 <printf>
+    exit();
+    30bb:	e8 93 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    30c0:	51                   	push   %ecx
+    30c1:	51                   	push   %ecx
+    30c2:	68 3c 5b 00 00       	push   $0x5b3c
+    30c7:	ff 35 94 67 00 00    	push   0x6794
+    30cd:	e8 1e 0e 00 00       	call   3ef0 <printf>
+    exit();
+    30d2:	e8 7c 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    30d7:	50                   	push   %eax
+    30d8:	50                   	push   %eax
+    30d9:	68 dd 52 00 00       	push   $0x52dd
+    30de:	ff 35 94 67 00 00    	push   0x6794
+    30e4:	e8 07 0e 00 00       	call   3ef0 <printf>
+    exit();
+    30e9:	e8 65 0b 00 00       	call   3c53 <exit>
+    printf(1, "pipe() failed\n");
+    30ee:	52                   	push   %edx
+    30ef:	52                   	push   %edx
+    30f0:	68 99 47 00 00       	push   $0x4799
+    30f5:	6a 01                	push   $0x1
+    30f7:	e8 f4 0d 00 00       	call   3ef0 <printf>
+    exit();
+    30fc:	e8 52 0b 00 00       	call   3c53 <exit>
+    exit();
+    3101:	e8 4d 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3106:	57                   	push   %edi
+    3107:	57                   	push   %edi
+    3108:	68 8d 52 00 00       	push   $0x528d
+    310d:	ff 35 94 67 00 00    	push   0x6794
+    3113:	e8 d8 0d 00 00       	call   3ef0 <printf>
+    exit();
+    3118:	e8 36 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    311d:	56                   	push   %esi
+    311e:	53                   	push   %ebx
+    311f:	68 14 5b 00 00       	push   $0x5b14
+    3124:	ff 35 94 67 00 00    	push   0x6794
+    312a:	e8 c1 0d 00 00       	call   3ef0 <printf>
+    exit();
+    312f:	e8 1f 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3134:	50                   	push   %eax
+    3135:	53                   	push   %ebx
+    3136:	68 dc 5a 00 00       	push   $0x5adc
+    313b:	ff 35 94 67 00 00    	push   0x6794
+    3141:	e8 aa 0d 00 00       	call   3ef0 <printf>
+    exit();
+    3146:	e8 08 0b 00 00       	call   3c53 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    314b:	53                   	push   %ebx
+    314c:	53                   	push   %ebx
+    314d:	68 a9 52 00 00       	push   $0x52a9
+    3152:	ff 35 94 67 00 00    	push   0x6794
+    3158:	e8 93 0d 00 00       	call   3ef0 <printf>
+    exit();
+    315d:	e8 f1 0a 00 00       	call   3c53 <exit>
+    3162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003170 <validateint>:
+}
+    3170:	c3                   	ret
+    3171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    317f:	90                   	nop
+
+00003180 <validatetest>:
+{
+    3180:	55                   	push   %ebp
+    3181:	89 e5                	mov    %esp,%ebp
+    3183:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3184:	31 f6                	xor    %esi,%esi
+{
+    3186:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3187:	83 ec 08             	sub    $0x8,%esp
+    318a:	68 06 53 00 00       	push   $0x5306
+    318f:	ff 35 94 67 00 00    	push   0x6794
+    3195:	e8 56 0d 00 00       	call   3ef0 <printf>
+    319a:	83 c4 10             	add    $0x10,%esp
+    319d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    31a0:	e8 a6 0a 00 00       	call   3c4b <fork>
+    31a5:	89 c3                	mov    %eax,%ebx
+    31a7:	85 c0                	test   %eax,%eax
+    31a9:	74 63                	je     320e <validatetest+0x8e>
+    sleep(0);
+    31ab:	83 ec 0c             	sub    $0xc,%esp
+    31ae:	6a 00                	push   $0x0
+    31b0:	e8 2e 0b 00 00       	call   3ce3 <sleep>
+    sleep(0);
+    31b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    31bc:	e8 22 0b 00 00       	call   3ce3 <sleep>
+    kill(pid);
+    31c1:	89 1c 24             	mov    %ebx,(%esp)
+    31c4:	e8 ba 0a 00 00       	call   3c83 <kill>
+    wait();
+    31c9:	e8 8d 0a 00 00       	call   3c5b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    31ce:	58                   	pop    %eax
+    31cf:	5a                   	pop    %edx
+    31d0:	56                   	push   %esi
+    31d1:	68 15 53 00 00       	push   $0x5315
+    31d6:	e8 d8 0a 00 00       	call   3cb3 <link>
+    31db:	83 c4 10             	add    $0x10,%esp
+    31de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31e1:	75 30                	jne    3213 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    31e3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    31e9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    31ef:	75 af                	jne    31a0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    31f1:	83 ec 08             	sub    $0x8,%esp
+    31f4:	68 39 53 00 00       	push   $0x5339
+    31f9:	ff 35 94 67 00 00    	push   0x6794
+    31ff:	e8 ec 0c 00 00       	call   3ef0 <printf>
+}
+    3204:	83 c4 10             	add    $0x10,%esp
+    3207:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    320a:	5b                   	pop    %ebx
+    320b:	5e                   	pop    %esi
+    320c:	5d                   	pop    %ebp
+    320d:	c3                   	ret
+      exit();
+    320e:	e8 40 0a 00 00       	call   3c53 <exit>
+      printf(stdout, "link should not succeed\n");
+    3213:	83 ec 08             	sub    $0x8,%esp
+    3216:	68 20 53 00 00       	push   $0x5320
+    321b:	ff 35 94 67 00 00    	push   0x6794
+    3221:	e8 ca 0c 00 00       	call   3ef0 <printf>
+      exit();
+    3226:	e8 28 0a 00 00       	call   3c53 <exit>
+    322b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    322f:	90                   	nop
+
+00003230 <bsstest>:
+{
+    3230:	55                   	push   %ebp
+    3231:	89 e5                	mov    %esp,%ebp
+    3233:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3236:	68 46 53 00 00       	push   $0x5346
+    323b:	ff 35 94 67 00 00    	push   0x6794
+    3241:	e8 aa 0c 00 00       	call   3ef0 <printf>
+    3246:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3249:	31 c0                	xor    %eax,%eax
+    324b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    324f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3250:	80 b8 c0 67 00 00 00 	cmpb   $0x0,0x67c0(%eax)
+    3257:	75 22                	jne    327b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3259:	83 c0 01             	add    $0x1,%eax
+    325c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3261:	75 ed                	jne    3250 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3263:	83 ec 08             	sub    $0x8,%esp
+    3266:	68 61 53 00 00       	push   $0x5361
+    326b:	ff 35 94 67 00 00    	push   0x6794
+    3271:	e8 7a 0c 00 00       	call   3ef0 <printf>
+}
+    3276:	83 c4 10             	add    $0x10,%esp
+    3279:	c9                   	leave
+    327a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    327b:	83 ec 08             	sub    $0x8,%esp
+    327e:	68 50 53 00 00       	push   $0x5350
+    3283:	ff 35 94 67 00 00    	push   0x6794
+    3289:	e8 62 0c 00 00       	call   3ef0 <printf>
+      exit();
+    328e:	e8 c0 09 00 00       	call   3c53 <exit>
+    3293:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    329a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000032a0 <bigargtest>:
+{
+    32a0:	55                   	push   %ebp
+    32a1:	89 e5                	mov    %esp,%ebp
+    32a3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    32a6:	68 6e 53 00 00       	push   $0x536e
+    32ab:	e8 f3 09 00 00       	call   3ca3 <unlink>
+  pid = fork();
+    32b0:	e8 96 09 00 00       	call   3c4b <fork>
+  if(pid == 0){
+    32b5:	83 c4 10             	add    $0x10,%esp
+    32b8:	85 c0                	test   %eax,%eax
+    32ba:	74 44                	je     3300 <bigargtest+0x60>
+  } else if(pid < 0){
+    32bc:	0f 88 c3 00 00 00    	js     3385 <bigargtest+0xe5>
+  wait();
+    32c2:	e8 94 09 00 00       	call   3c5b <wait>
+  fd = open("bigarg-ok", 0);
+    32c7:	83 ec 08             	sub    $0x8,%esp
+    32ca:	6a 00                	push   $0x0
+    32cc:	68 6e 53 00 00       	push   $0x536e
+    32d1:	e8 bd 09 00 00       	call   3c93 <open>
+  if(fd < 0){
+    32d6:	83 c4 10             	add    $0x10,%esp
+    32d9:	85 c0                	test   %eax,%eax
+    32db:	0f 88 8d 00 00 00    	js     336e <bigargtest+0xce>
+  close(fd);
+    32e1:	83 ec 0c             	sub    $0xc,%esp
+    32e4:	50                   	push   %eax
+    32e5:	e8 91 09 00 00       	call   3c7b <close>
+  unlink("bigarg-ok");
+    32ea:	c7 04 24 6e 53 00 00 	movl   $0x536e,(%esp)
+    32f1:	e8 ad 09 00 00       	call   3ca3 <unlink>
+}
+    32f6:	83 c4 10             	add    $0x10,%esp
+    32f9:	c9                   	leave
+    32fa:	c3                   	ret
+    32fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    32ff:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3300:	c7 04 85 e0 ae 00 00 	movl   $0x5b90,0xaee0(,%eax,4)
+    3307:	90 5b 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    330b:	83 c0 01             	add    $0x1,%eax
+    330e:	83 f8 1f             	cmp    $0x1f,%eax
+    3311:	75 ed                	jne    3300 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3313:	31 c9                	xor    %ecx,%ecx
+    3315:	89 0d 5c af 00 00    	mov    %ecx,0xaf5c
+    printf(stdout, "bigarg test\n");
+    331b:	50                   	push   %eax
+    331c:	50                   	push   %eax
+    331d:	68 78 53 00 00       	push   $0x5378
+    3322:	ff 35 94 67 00 00    	push   0x6794
+    3328:	e8 c3 0b 00 00       	call   3ef0 <printf>
+    exec("echo", args);
+    332d:	58                   	pop    %eax
+    332e:	5a                   	pop    %edx
+    332f:	68 e0 ae 00 00       	push   $0xaee0
+    3334:	68 45 45 00 00       	push   $0x4545
+    3339:	e8 4d 09 00 00       	call   3c8b <exec>
+    printf(stdout, "bigarg test ok\n");
+    333e:	59                   	pop    %ecx
+    333f:	58                   	pop    %eax
+    3340:	68 85 53 00 00       	push   $0x5385
+    3345:	ff 35 94 67 00 00    	push   0x6794
+    334b:	e8 a0 0b 00 00       	call   3ef0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3350:	58                   	pop    %eax
+    3351:	5a                   	pop    %edx
+    3352:	68 00 02 00 00       	push   $0x200
+    3357:	68 6e 53 00 00       	push   $0x536e
+    335c:	e8 32 09 00 00       	call   3c93 <open>
+    close(fd);
+    3361:	89 04 24             	mov    %eax,(%esp)
+    3364:	e8 12 09 00 00       	call   3c7b <close>
+    exit();
+    3369:	e8 e5 08 00 00       	call   3c53 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    336e:	50                   	push   %eax
+    336f:	50                   	push   %eax
+    3370:	68 ae 53 00 00       	push   $0x53ae
+    3375:	ff 35 94 67 00 00    	push   0x6794
+    337b:	e8 70 0b 00 00       	call   3ef0 <printf>
+    exit();
+    3380:	e8 ce 08 00 00       	call   3c53 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3385:	52                   	push   %edx
+    3386:	52                   	push   %edx
+    3387:	68 95 53 00 00       	push   $0x5395
+    338c:	ff 35 94 67 00 00    	push   0x6794
+    3392:	e8 59 0b 00 00       	call   3ef0 <printf>
+    exit();
+    3397:	e8 b7 08 00 00       	call   3c53 <exit>
+    339c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000033a0 <fsfull>:
+{
+    33a0:	55                   	push   %ebp
+    33a1:	89 e5                	mov    %esp,%ebp
+    33a3:	57                   	push   %edi
+    33a4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    33a5:	31 f6                	xor    %esi,%esi
+{
+    33a7:	53                   	push   %ebx
+    33a8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    33ab:	68 c3 53 00 00       	push   $0x53c3
+    33b0:	6a 01                	push   $0x1
+    33b2:	e8 39 0b 00 00       	call   3ef0 <printf>
+    33b7:	83 c4 10             	add    $0x10,%esp
+    33ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    33c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    33c5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    33ca:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    33cd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    33d1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    33d3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    33d7:	c1 ea 06             	shr    $0x6,%edx
+    33da:	8d 42 30             	lea    0x30(%edx),%eax
+    33dd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    33e0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    33e6:	89 f2                	mov    %esi,%edx
+    33e8:	29 c2                	sub    %eax,%edx
+    33ea:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    33ef:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    33f1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    33f6:	c1 ea 05             	shr    $0x5,%edx
+    33f9:	83 c2 30             	add    $0x30,%edx
+    33fc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    33ff:	f7 e6                	mul    %esi
+    3401:	c1 ea 05             	shr    $0x5,%edx
+    3404:	6b c2 64             	imul   $0x64,%edx,%eax
+    3407:	89 f2                	mov    %esi,%edx
+    3409:	29 c2                	sub    %eax,%edx
+    340b:	89 d0                	mov    %edx,%eax
+    340d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    340f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3411:	c1 ea 03             	shr    $0x3,%edx
+    3414:	83 c2 30             	add    $0x30,%edx
+    3417:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    341a:	f7 e1                	mul    %ecx
+    341c:	89 f0                	mov    %esi,%eax
+    341e:	c1 ea 03             	shr    $0x3,%edx
+    3421:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3424:	01 d2                	add    %edx,%edx
+    3426:	29 d0                	sub    %edx,%eax
+    3428:	83 c0 30             	add    $0x30,%eax
+    342b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    342e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3431:	50                   	push   %eax
+    3432:	68 d0 53 00 00       	push   $0x53d0
+    3437:	6a 01                	push   $0x1
+    3439:	e8 b2 0a 00 00       	call   3ef0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    343e:	58                   	pop    %eax
+    343f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3442:	5a                   	pop    %edx
+    3443:	68 02 02 00 00       	push   $0x202
+    3448:	50                   	push   %eax
+    3449:	e8 45 08 00 00       	call   3c93 <open>
+    if(fd < 0){
+    344e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3451:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3453:	85 c0                	test   %eax,%eax
+    3455:	78 4f                	js     34a6 <fsfull+0x106>
+    int total = 0;
+    3457:	31 db                	xor    %ebx,%ebx
+    3459:	eb 07                	jmp    3462 <fsfull+0xc2>
+    345b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    345f:	90                   	nop
+      total += cc;
+    3460:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3462:	83 ec 04             	sub    $0x4,%esp
+    3465:	68 00 02 00 00       	push   $0x200
+    346a:	68 e0 8e 00 00       	push   $0x8ee0
+    346f:	57                   	push   %edi
+    3470:	e8 fe 07 00 00       	call   3c73 <write>
+      if(cc < 512)
+    3475:	83 c4 10             	add    $0x10,%esp
+    3478:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    347d:	7f e1                	jg     3460 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    347f:	83 ec 04             	sub    $0x4,%esp
+    3482:	53                   	push   %ebx
+    3483:	68 ec 53 00 00       	push   $0x53ec
+    3488:	6a 01                	push   $0x1
+    348a:	e8 61 0a 00 00       	call   3ef0 <printf>
+    close(fd);
+    348f:	89 3c 24             	mov    %edi,(%esp)
+    3492:	e8 e4 07 00 00       	call   3c7b <close>
+    if(total == 0)
+    3497:	83 c4 10             	add    $0x10,%esp
+    349a:	85 db                	test   %ebx,%ebx
+    349c:	74 1e                	je     34bc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    349e:	83 c6 01             	add    $0x1,%esi
+    34a1:	e9 1a ff ff ff       	jmp    33c0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    34a6:	83 ec 04             	sub    $0x4,%esp
+    34a9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    34ac:	50                   	push   %eax
+    34ad:	68 dc 53 00 00       	push   $0x53dc
+    34b2:	6a 01                	push   $0x1
+    34b4:	e8 37 0a 00 00       	call   3ef0 <printf>
+      break;
+    34b9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    34bc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34c1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    34c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34cd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    34d0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    34d2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    34d5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34d9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    34db:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34df:	c1 ea 06             	shr    $0x6,%edx
+    34e2:	8d 42 30             	lea    0x30(%edx),%eax
+    34e5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34e8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    34ee:	89 f2                	mov    %esi,%edx
+    34f0:	29 c2                	sub    %eax,%edx
+    34f2:	89 d0                	mov    %edx,%eax
+    34f4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    34f6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34f8:	c1 ea 05             	shr    $0x5,%edx
+    34fb:	83 c2 30             	add    $0x30,%edx
+    34fe:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3501:	f7 e3                	mul    %ebx
+    3503:	c1 ea 05             	shr    $0x5,%edx
+    3506:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3509:	89 f2                	mov    %esi,%edx
+    350b:	29 ca                	sub    %ecx,%edx
+    350d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3512:	89 d0                	mov    %edx,%eax
+    3514:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3516:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3518:	c1 ea 03             	shr    $0x3,%edx
+    351b:	83 c2 30             	add    $0x30,%edx
+    351e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3521:	f7 e1                	mul    %ecx
+    3523:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3525:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3528:	c1 ea 03             	shr    $0x3,%edx
+    352b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    352e:	01 d2                	add    %edx,%edx
+    3530:	29 d0                	sub    %edx,%eax
+    3532:	83 c0 30             	add    $0x30,%eax
+    3535:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3538:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    353b:	50                   	push   %eax
+    353c:	e8 62 07 00 00       	call   3ca3 <unlink>
+  while(nfiles >= 0){
+    3541:	83 c4 10             	add    $0x10,%esp
+    3544:	83 fe ff             	cmp    $0xffffffff,%esi
+    3547:	75 87                	jne    34d0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3549:	83 ec 08             	sub    $0x8,%esp
+    354c:	68 fc 53 00 00       	push   $0x53fc
+    3551:	6a 01                	push   $0x1
+    3553:	e8 98 09 00 00       	call   3ef0 <printf>
+}
+    3558:	83 c4 10             	add    $0x10,%esp
+    355b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    355e:	5b                   	pop    %ebx
+    355f:	5e                   	pop    %esi
+    3560:	5f                   	pop    %edi
+    3561:	5d                   	pop    %ebp
+    3562:	c3                   	ret
+    3563:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    356a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003570 <splicetest>:
+{
+    3570:	55                   	push   %ebp
+    3571:	89 e5                	mov    %esp,%ebp
+    3573:	57                   	push   %edi
+    3574:	56                   	push   %esi
+    3575:	53                   	push   %ebx
+    3576:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "splice test\n");
+    3579:	68 12 54 00 00       	push   $0x5412
+    357e:	ff 35 94 67 00 00    	push   0x6794
+    3584:	e8 67 09 00 00       	call   3ef0 <printf>
+  fd = open("splice0", O_CREATE|O_RDWR);
+    3589:	5e                   	pop    %esi
+    358a:	5f                   	pop    %edi
+    358b:	68 02 02 00 00       	push   $0x202
+    3590:	68 1f 54 00 00       	push   $0x541f
+    3595:	e8 f9 06 00 00       	call   3c93 <open>
+  if(fd < 0){
+    359a:	83 c4 10             	add    $0x10,%esp
+    359d:	85 c0                	test   %eax,%eax
+    359f:	0f 88 5f 02 00 00    	js     3804 <splicetest+0x294>
+    35a5:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 3000; i++)
+    35a7:	31 c9                	xor    %ecx,%ecx
+    buf[i] = i % 251;
+    35a9:	bb bf bf 8c 82       	mov    $0x828cbfbf,%ebx
+    35ae:	66 90                	xchg   %ax,%ax
+    35b0:	89 c8                	mov    %ecx,%eax
+    35b2:	f7 e3                	mul    %ebx
+    35b4:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 3000; i++)
+    35b6:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = i % 251;
+    35b9:	c1 ea 07             	shr    $0x7,%edx
+    35bc:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    35c2:	29 d0                	sub    %edx,%eax
+    35c4:	88 81 df 8e 00 00    	mov    %al,0x8edf(%ecx)
+  for(i = 0; i < 3000; i++)
+    35ca:	81 f9 b8 0b 00 00    	cmp    $0xbb8,%ecx
+    35d0:	75 de                	jne    35b0 <splicetest+0x40>
+  if(write(fd, buf, 3000) != 3000){
+    35d2:	83 ec 04             	sub    $0x4,%esp
+    35d5:	68 b8 0b 00 00       	push   $0xbb8
+    35da:	68 e0 8e 00 00       	push   $0x8ee0
+    35df:	56                   	push   %esi
+    35e0:	e8 8e 06 00 00       	call   3c73 <write>
+    35e5:	83 c4 10             	add    $0x10,%esp
+    35e8:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    35ed:	0f 85 3f 02 00 00    	jne    3832 <splicetest+0x2c2>
+  close(fd);
+    35f3:	83 ec 0c             	sub    $0xc,%esp
+    35f6:	56                   	push   %esi
+    35f7:	e8 7f 06 00 00       	call   3c7b <close>
+  fd = open("splice0", O_RDONLY);
+    35fc:	5e                   	pop    %esi
+    35fd:	5f                   	pop    %edi
+    35fe:	6a 00                	push   $0x0
+    3600:	68 1f 54 00 00       	push   $0x541f
+    3605:	e8 89 06 00 00       	call   3c93 <open>
+    360a:	89 c7                	mov    %eax,%edi
+  fd1 = open("splice1", O_CREATE|O_RDWR);
+    360c:	58                   	pop    %eax
+    360d:	5a                   	pop    %edx
+    360e:	68 02 02 00 00       	push   $0x202
+    3613:	68 54 54 00 00       	push   $0x5454
+    3618:	e8 76 06 00 00       	call   3c93 <open>
+  if(fd < 0 || fd1 < 0){
+    361d:	83 c4 10             	add    $0x10,%esp
+  fd1 = open("splice1", O_CREATE|O_RDWR);
+    3620:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || fd1 < 0){
+    3622:	89 f8                	mov    %edi,%eax
+    3624:	09 f0                	or     %esi,%eax
+    3626:	0f 88 ef 01 00 00    	js     381b <splicetest+0x2ab>
+  tot = 0;
+    362c:	31 db                	xor    %ebx,%ebx
+    362e:	eb 02                	jmp    3632 <splicetest+0xc2>
+    tot += n;
+    3630:	01 c3                	add    %eax,%ebx
+  while((n = splice(fd, fd1, 1000)) > 0)
+    3632:	83 ec 04             	sub    $0x4,%esp
+    3635:	68 e8 03 00 00       	push   $0x3e8
+    363a:	56                   	push   %esi
+    363b:	57                   	push   %edi
+    363c:	e8 1a 07 00 00       	call   3d5b <splice>
+    3641:	83 c4 10             	add    $0x10,%esp
+    3644:	85 c0                	test   %eax,%eax
+    3646:	7f e8                	jg     3630 <splicetest+0xc0>
+  if(n < 0 || tot != 3000){
+    3648:	0f 88 a4 02 00 00    	js     38f2 <splicetest+0x382>
+    364e:	81 fb b8 0b 00 00    	cmp    $0xbb8,%ebx
+    3654:	0f 85 98 02 00 00    	jne    38f2 <splicetest+0x382>
+  close(fd);
+    365a:	83 ec 0c             	sub    $0xc,%esp
+    365d:	57                   	push   %edi
+    365e:	e8 18 06 00 00       	call   3c7b <close>
+  close(fd1);
+    3663:	89 34 24             	mov    %esi,(%esp)
+    3666:	e8 10 06 00 00       	call   3c7b <close>
+  fd = open("splice1", O_RDONLY);
+    366b:	58                   	pop    %eax
+    366c:	5a                   	pop    %edx
+    366d:	6a 00                	push   $0x0
+    366f:	68 54 54 00 00       	push   $0x5454
+    3674:	e8 1a 06 00 00       	call   3c93 <open>
+  memset(buf, 0, 3000);
+    3679:	83 c4 0c             	add    $0xc,%esp
+    367c:	68 b8 0b 00 00       	push   $0xbb8
+  fd = open("splice1", O_RDONLY);
+    3681:	89 c3                	mov    %eax,%ebx
+  memset(buf, 0, 3000);
+    3683:	6a 00                	push   $0x0
+    3685:	68 e0 8e 00 00       	push   $0x8ee0
+    368a:	e8 41 04 00 00       	call   3ad0 <memset>
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    368f:	83 c4 0c             	add    $0xc,%esp
+    3692:	68 00 20 00 00       	push   $0x2000
+    3697:	68 e0 8e 00 00       	push   $0x8ee0
+    369c:	53                   	push   %ebx
+    369d:	e8 c9 05 00 00       	call   3c6b <read>
+    36a2:	83 c4 10             	add    $0x10,%esp
+    36a5:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    36aa:	0f 85 2b 02 00 00    	jne    38db <splicetest+0x36b>
+  close(fd);
+    36b0:	83 ec 0c             	sub    $0xc,%esp
+    36b3:	53                   	push   %ebx
+    if(buf[i] != (char)(i % 251)){
+    36b4:	bb bf bf 8c 82       	mov    $0x828cbfbf,%ebx
+  close(fd);
+    36b9:	e8 bd 05 00 00       	call   3c7b <close>
+    36be:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 3000; i++){
+    36c1:	31 c9                	xor    %ecx,%ecx
+    36c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    36c7:	90                   	nop
+    if(buf[i] != (char)(i % 251)){
+    36c8:	89 c8                	mov    %ecx,%eax
+    36ca:	f7 e3                	mul    %ebx
+    36cc:	89 c8                	mov    %ecx,%eax
+    36ce:	c1 ea 07             	shr    $0x7,%edx
+    36d1:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    36d7:	29 d0                	sub    %edx,%eax
+    36d9:	38 81 e0 8e 00 00    	cmp    %al,0x8ee0(%ecx)
+    36df:	0f 85 ed 00 00 00    	jne    37d2 <splicetest+0x262>
+  for(i = 0; i < 3000; i++){
+    36e5:	83 c1 01             	add    $0x1,%ecx
+    36e8:	81 f9 b8 0b 00 00    	cmp    $0xbb8,%ecx
+    36ee:	75 d8                	jne    36c8 <splicetest+0x158>
+  if(pipe(fds) != 0){
+    36f0:	83 ec 0c             	sub    $0xc,%esp
+    36f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    36f6:	50                   	push   %eax
+    36f7:	e8 67 05 00 00       	call   3c63 <pipe>
+    36fc:	83 c4 10             	add    $0x10,%esp
+    36ff:	89 c3                	mov    %eax,%ebx
+    3701:	85 c0                	test   %eax,%eax
+    3703:	0f 85 8d 01 00 00    	jne    3896 <splicetest+0x326>
+  pid = fork();
+    3709:	e8 3d 05 00 00       	call   3c4b <fork>
+  if(pid == 0){
+    370e:	85 c0                	test   %eax,%eax
+    3710:	0f 84 33 01 00 00    	je     3849 <splicetest+0x2d9>
+  } else if(pid < 0){
+    3716:	0f 88 a8 01 00 00    	js     38c4 <splicetest+0x354>
+  close(fds[1]);
+    371c:	83 ec 0c             	sub    $0xc,%esp
+    371f:	ff 75 e4             	push   -0x1c(%ebp)
+  tot = 0;
+    3722:	31 f6                	xor    %esi,%esi
+  close(fds[1]);
+    3724:	e8 52 05 00 00       	call   3c7b <close>
+  while((n = read(fds[0], buf + tot, 512)) > 0)
+    3729:	83 c4 10             	add    $0x10,%esp
+    372c:	eb 04                	jmp    3732 <splicetest+0x1c2>
+    372e:	66 90                	xchg   %ax,%ax
+    tot += n;
+    3730:	01 c6                	add    %eax,%esi
+  while((n = read(fds[0], buf + tot, 512)) > 0)
+    3732:	83 ec 04             	sub    $0x4,%esp
+    3735:	8d 86 e0 8e 00 00    	lea    0x8ee0(%esi),%eax
+    373b:	68 00 02 00 00       	push   $0x200
+    3740:	50                   	push   %eax
+    3741:	ff 75 e0             	push   -0x20(%ebp)
+    3744:	e8 22 05 00 00       	call   3c6b <read>
+    3749:	83 c4 10             	add    $0x10,%esp
+    374c:	85 c0                	test   %eax,%eax
+    374e:	7f e0                	jg     3730 <splicetest+0x1c0>
+  close(fds[0]);
+    3750:	83 ec 0c             	sub    $0xc,%esp
+    3753:	ff 75 e0             	push   -0x20(%ebp)
+    3756:	e8 20 05 00 00       	call   3c7b <close>
+  wait();
+    375b:	e8 fb 04 00 00       	call   3c5b <wait>
+  if(tot != 3000){
+    3760:	83 c4 10             	add    $0x10,%esp
+    3763:	81 fe b8 0b 00 00    	cmp    $0xbb8,%esi
+    3769:	0f 85 3e 01 00 00    	jne    38ad <splicetest+0x33d>
+    if(buf[i] != (char)(i % 251)){
+    376f:	b9 bf bf 8c 82       	mov    $0x828cbfbf,%ecx
+    3774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3778:	89 d8                	mov    %ebx,%eax
+    377a:	f7 e1                	mul    %ecx
+    377c:	89 d8                	mov    %ebx,%eax
+    377e:	c1 ea 07             	shr    $0x7,%edx
+    3781:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    3787:	29 d0                	sub    %edx,%eax
+    3789:	38 83 e0 8e 00 00    	cmp    %al,0x8ee0(%ebx)
+    378f:	75 5a                	jne    37eb <splicetest+0x27b>
+  for(i = 0; i < 3000; i++){
+    3791:	83 c3 01             	add    $0x1,%ebx
+    3794:	81 fb b8 0b 00 00    	cmp    $0xbb8,%ebx
+    379a:	75 dc                	jne    3778 <splicetest+0x208>
+  unlink("splice0");
+    379c:	83 ec 0c             	sub    $0xc,%esp
+    379f:	68 1f 54 00 00       	push   $0x541f
+    37a4:	e8 fa 04 00 00       	call   3ca3 <unlink>
+  unlink("splice1");
+    37a9:	c7 04 24 54 54 00 00 	movl   $0x5454,(%esp)
+    37b0:	e8 ee 04 00 00       	call   3ca3 <unlink>
+  printf(stdout, "splice test ok\n");
+    37b5:	58                   	pop    %eax
+    37b6:	5a                   	pop    %edx
+    37b7:	68 da 54 00 00       	push   $0x54da
+    37bc:	ff 35 94 67 00 00    	push   0x6794
+    37c2:	e8 29 07 00 00       	call   3ef0 <printf>
+}
+    37c7:	83 c4 10             	add    $0x10,%esp
+    37ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37cd:	5b                   	pop    %ebx
+    37ce:	5e                   	pop    %esi
+    37cf:	5f                   	pop    %edi
+    37d0:	5d                   	pop    %ebp
+    37d1:	c3                   	ret
+      printf(stdout, "splice: copy differs at %d\n", i);
+    37d2:	83 ec 04             	sub    $0x4,%esp
+    37d5:	51                   	push   %ecx
+    37d6:	68 8e 54 00 00       	push   $0x548e
+    37db:	ff 35 94 67 00 00    	push   0x6794
+    37e1:	e8 0a 07 00 00       	call   3ef0 <printf>
+      exit();
+    37e6:	e8 68 04 00 00       	call   3c53 <exit>
+      printf(stdout, "splice: pipe data differs at %d\n", i);
+    37eb:	83 ec 04             	sub    $0x4,%esp
+    37ee:	53                   	push   %ebx
+    37ef:	68 90 5c 00 00       	push   $0x5c90
+    37f4:	ff 35 94 67 00 00    	push   0x6794
+    37fa:	e8 f1 06 00 00       	call   3ef0 <printf>
+      exit();
+    37ff:	e8 4f 04 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: create failed\n");
+    3804:	53                   	push   %ebx
+    3805:	53                   	push   %ebx
+    3806:	68 27 54 00 00       	push   $0x5427
+    380b:	ff 35 94 67 00 00    	push   0x6794
+    3811:	e8 da 06 00 00       	call   3ef0 <printf>
+    exit();
+    3816:	e8 38 04 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: open failed\n");
+    381b:	53                   	push   %ebx
+    381c:	53                   	push   %ebx
+    381d:	68 5c 54 00 00       	push   $0x545c
+    3822:	ff 35 94 67 00 00    	push   0x6794
+    3828:	e8 c3 06 00 00       	call   3ef0 <printf>
+    exit();
+    382d:	e8 21 04 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: write failed\n");
+    3832:	51                   	push   %ecx
+    3833:	51                   	push   %ecx
+    3834:	68 3e 54 00 00       	push   $0x543e
+    3839:	ff 35 94 67 00 00    	push   0x6794
+    383f:	e8 ac 06 00 00       	call   3ef0 <printf>
+    exit();
+    3844:	e8 0a 04 00 00       	call   3c53 <exit>
+    close(fds[0]);
+    3849:	83 ec 0c             	sub    $0xc,%esp
+    384c:	ff 75 e0             	push   -0x20(%ebp)
+    384f:	e8 27 04 00 00       	call   3c7b <close>
+    fd = open("splice0", O_RDONLY);
+    3854:	5f                   	pop    %edi
+    3855:	58                   	pop    %eax
+    3856:	6a 00                	push   $0x0
+    3858:	68 1f 54 00 00       	push   $0x541f
+    385d:	e8 31 04 00 00       	call   3c93 <open>
+    while(splice(fd, fds[1], 3000) > 0)
+    3862:	83 c4 10             	add    $0x10,%esp
+    fd = open("splice0", O_RDONLY);
+    3865:	89 c3                	mov    %eax,%ebx
+    while(splice(fd, fds[1], 3000) > 0)
+    3867:	83 ec 04             	sub    $0x4,%esp
+    386a:	68 b8 0b 00 00       	push   $0xbb8
+    386f:	ff 75 e4             	push   -0x1c(%ebp)
+    3872:	53                   	push   %ebx
+    3873:	e8 e3 04 00 00       	call   3d5b <splice>
+    3878:	83 c4 10             	add    $0x10,%esp
+    387b:	85 c0                	test   %eax,%eax
+    387d:	7f e8                	jg     3867 <splicetest+0x2f7>
+    close(fd);
+    387f:	83 ec 0c             	sub    $0xc,%esp
+    3882:	53                   	push   %ebx
+    3883:	e8 f3 03 00 00       	call   3c7b <close>
+    close(fds[1]);
+    3888:	5e                   	pop    %esi
+    3889:	ff 75 e4             	push   -0x1c(%ebp)
+    388c:	e8 ea 03 00 00       	call   3c7b <close>
+    exit();
+    3891:	e8 bd 03 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: pipe failed\n");
+    3896:	50                   	push   %eax
+    3897:	50                   	push   %eax
+    3898:	68 aa 54 00 00       	push   $0x54aa
+    389d:	ff 35 94 67 00 00    	push   0x6794
+    38a3:	e8 48 06 00 00       	call   3ef0 <printf>
+    exit();
+    38a8:	e8 a6 03 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: pipe got %d bytes\n", tot);
+    38ad:	51                   	push   %ecx
+    38ae:	56                   	push   %esi
+    38af:	68 bf 54 00 00       	push   $0x54bf
+    38b4:	ff 35 94 67 00 00    	push   0x6794
+    38ba:	e8 31 06 00 00       	call   3ef0 <printf>
+    exit();
+    38bf:	e8 8f 03 00 00       	call   3c53 <exit>
+    printf(stdout, "fork failed\n");
+    38c4:	53                   	push   %ebx
+    38c5:	53                   	push   %ebx
+    38c6:	68 a1 53 00 00       	push   $0x53a1
+    38cb:	ff 35 94 67 00 00    	push   0x6794
+    38d1:	e8 1a 06 00 00       	call   3ef0 <printf>
+    exit();
+    38d6:	e8 78 03 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: copy has wrong size\n");
+    38db:	50                   	push   %eax
+    38dc:	50                   	push   %eax
+    38dd:	68 71 54 00 00       	push   $0x5471
+    38e2:	ff 35 94 67 00 00    	push   0x6794
+    38e8:	e8 03 06 00 00       	call   3ef0 <printf>
+    exit();
+    38ed:	e8 61 03 00 00       	call   3c53 <exit>
+    printf(stdout, "splice: file to file moved %d\n", tot);
+    38f2:	51                   	push   %ecx
+    38f3:	53                   	push   %ebx
+    38f4:	68 70 5c 00 00       	push   $0x5c70
+    38f9:	ff 35 94 67 00 00    	push   0x6794
+    38ff:	e8 ec 05 00 00       	call   3ef0 <printf>
+    exit();
+    3904:	e8 4a 03 00 00       	call   3c53 <exit>
+    3909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003910 <uio>:
+{
+    3910:	55                   	push   %ebp
+    3911:	89 e5                	mov    %esp,%ebp
+    3913:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3916:	68 ea 54 00 00       	push   $0x54ea
+    391b:	6a 01                	push   $0x1
+    391d:	e8 ce 05 00 00       	call   3ef0 <printf>
+  pid = fork();
+    3922:	e8 24 03 00 00       	call   3c4b <fork>
+  if(pid == 0){
+    3927:	83 c4 10             	add    $0x10,%esp
+    392a:	85 c0                	test   %eax,%eax
+    392c:	74 1b                	je     3949 <uio+0x39>
+  } else if(pid < 0){
+    392e:	78 3d                	js     396d <uio+0x5d>
+  wait();
+    3930:	e8 26 03 00 00       	call   3c5b <wait>
+  printf(1, "uio test done\n");
+    3935:	83 ec 08             	sub    $0x8,%esp
+    3938:	68 f4 54 00 00       	push   $0x54f4
+    393d:	6a 01                	push   $0x1
+    393f:	e8 ac 05 00 00       	call   3ef0 <printf>
+}
+    3944:	83 c4 10             	add    $0x10,%esp
+    3947:	c9                   	leave
+    3948:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3949:	b8 09 00 00 00       	mov    $0x9,%eax
+    394e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3953:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3954:	ba 71 00 00 00       	mov    $0x71,%edx
+    3959:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    395a:	52                   	push   %edx
+    395b:	52                   	push   %edx
+    395c:	68 b4 5c 00 00       	push   $0x5cb4
+    3961:	6a 01                	push   $0x1
+    3963:	e8 88 05 00 00       	call   3ef0 <printf>
+    exit();
+    3968:	e8 e6 02 00 00       	call   3c53 <exit>
+    printf (1, "fork failed\n");
+    396d:	50                   	push   %eax
+    396e:	50                   	push   %eax
+    396f:	68 a1 53 00 00       	push   $0x53a1
+    3974:	6a 01                	push   $0x1
+    3976:	e8 75 05 00 00       	call   3ef0 <printf>
+    exit();
+    397b:	e8 d3 02 00 00       	call   3c53 <exit>
+
+00003980 <argptest>:
+{
+    3980:	55                   	push   %ebp
+    3981:	89 e5                	mov    %esp,%ebp
+    3983:	53                   	push   %ebx
+    3984:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3987:	6a 00                	push   $0x0
+    3989:	68 03 55 00 00       	push   $0x5503
+    398e:	e8 00 03 00 00       	call   3c93 <open>
+  if (fd < 0) {
+    3993:	83 c4 10             	add    $0x10,%esp
+    3996:	85 c0                	test   %eax,%eax
+    3998:	78 39                	js     39d3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    399a:	83 ec 0c             	sub    $0xc,%esp
+    399d:	89 c3                	mov    %eax,%ebx
+    399f:	6a 00                	push   $0x0
+    39a1:	e8 35 03 00 00       	call   3cdb <sbrk>
+    39a6:	83 c4 0c             	add    $0xc,%esp
+    39a9:	83 e8 01             	sub    $0x1,%eax
+    39ac:	6a ff                	push   $0xffffffff
+    39ae:	50                   	push   %eax
+    39af:	53                   	push   %ebx
+    39b0:	e8 b6 02 00 00       	call   3c6b <read>
+  close(fd);
+    39b5:	89 1c 24             	mov    %ebx,(%esp)
+    39b8:	e8 be 02 00 00       	call   3c7b <close>
+  printf(1, "arg test passed\n");
+    39bd:	58                   	pop    %eax
+    39be:	5a                   	pop    %edx
+    39bf:	68 08 55 00 00       	push   $0x5508
+    39c4:	6a 01                	push   $0x1
+    39c6:	e8 25 05 00 00       	call   3ef0 <printf>
+}
+    39cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    39ce:	83 c4 10             	add    $0x10,%esp
+    39d1:	c9                   	leave
+    39d2:	c3                   	ret
+    printf(2, "open failed\n");
+    39d3:	51                   	push   %ecx
+    39d4:	51                   	push   %ecx
+    39d5:	68 64 54 00 00       	push   $0x5464
+    39da:	6a 02                	push   $0x2
+    39dc:	e8 0f 05 00 00       	call   3ef0 <printf>
+    exit();
+    39e1:	e8 6d 02 00 00       	call   3c53 <exit>
+    39e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000039f0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    39f0:	69 05 90 67 00 00 0d 	imul   $0x19660d,0x6790,%eax
+    39f7:	66 19 00 
+    39fa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    39ff:	a3 90 67 00 00       	mov    %eax,0x6790
+}
+    3a04:	c3                   	ret
+    3a05:	66 90                	xchg   %ax,%ax
+    3a07:	66 90                	xchg   %ax,%ax
+    3a09:	66 90                	xchg   %ax,%ax
+    3a0b:	66 90                	xchg   %ax,%ax
+    3a0d:	66 90                	xchg   %ax,%ax
+    3a0f:	90                   	nop
+
+00003a10 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    3a10:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3a11:	31 c0                	xor    %eax,%eax
+{
+    3a13:	89 e5                	mov    %esp,%ebp
+    3a15:	53                   	push   %ebx
+    3a16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3a19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3a20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3a24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3a27:	83 c0 01             	add    $0x1,%eax
+    3a2a:	84 d2                	test   %dl,%dl
+    3a2c:	75 f2                	jne    3a20 <strcpy+0x10>
+    ;
+  return os;
+}
+    3a2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a31:	89 c8                	mov    %ecx,%eax
+    3a33:	c9                   	leave
+    3a34:	c3                   	ret
+    3a35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003a40 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3a40:	55                   	push   %ebp
+    3a41:	89 e5                	mov    %esp,%ebp
+    3a43:	53                   	push   %ebx
+    3a44:	8b 55 08             	mov    0x8(%ebp),%edx
+    3a47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3a4a:	0f b6 02             	movzbl (%edx),%eax
+    3a4d:	84 c0                	test   %al,%al
+    3a4f:	75 17                	jne    3a68 <strcmp+0x28>
+    3a51:	eb 3a                	jmp    3a8d <strcmp+0x4d>
+    3a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a57:	90                   	nop
+    3a58:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3a5c:	83 c2 01             	add    $0x1,%edx
+    3a5f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3a62:	84 c0                	test   %al,%al
+    3a64:	74 1a                	je     3a80 <strcmp+0x40>
+    p++, q++;
+    3a66:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3a68:	0f b6 19             	movzbl (%ecx),%ebx
+    3a6b:	38 c3                	cmp    %al,%bl
+    3a6d:	74 e9                	je     3a58 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3a6f:	29 d8                	sub    %ebx,%eax
+}
+    3a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a74:	c9                   	leave
+    3a75:	c3                   	ret
+    3a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a7d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3a80:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3a84:	31 c0                	xor    %eax,%eax
+    3a86:	29 d8                	sub    %ebx,%eax
+}
+    3a88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a8b:	c9                   	leave
+    3a8c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3a8d:	0f b6 19             	movzbl (%ecx),%ebx
+    3a90:	31 c0                	xor    %eax,%eax
+    3a92:	eb db                	jmp    3a6f <strcmp+0x2f>
+    3a94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a9f:	90                   	nop
+
+00003aa0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    3aa0:	55                   	push   %ebp
+    3aa1:	89 e5                	mov    %esp,%ebp
+    3aa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3aa6:	80 3a 00             	cmpb   $0x0,(%edx)
+    3aa9:	74 15                	je     3ac0 <strlen+0x20>
+    3aab:	31 c0                	xor    %eax,%eax
+    3aad:	8d 76 00             	lea    0x0(%esi),%esi
+    3ab0:	83 c0 01             	add    $0x1,%eax
+    3ab3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3ab7:	89 c1                	mov    %eax,%ecx
+    3ab9:	75 f5                	jne    3ab0 <strlen+0x10>
+    ;
+  return n;
+}
+    3abb:	89 c8                	mov    %ecx,%eax
+    3abd:	5d                   	pop    %ebp
+    3abe:	c3                   	ret
+    3abf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3ac0:	31 c9                	xor    %ecx,%ecx
+}
+    3ac2:	5d                   	pop    %ebp
+    3ac3:	89 c8                	mov    %ecx,%eax
+    3ac5:	c3                   	ret
+    3ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003ad0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3ad0:	55                   	push   %ebp
+    3ad1:	89 e5                	mov    %esp,%ebp
+    3ad3:	57                   	push   %edi
+    3ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3ad7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3add:	89 d7                	mov    %edx,%edi
+    3adf:	fc                   	cld
+    3ae0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3ae2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3ae5:	89 d0                	mov    %edx,%eax
+    3ae7:	c9                   	leave
+    3ae8:	c3                   	ret
+    3ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003af0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3af0:	55                   	push   %ebp
+    3af1:	89 e5                	mov    %esp,%ebp
+    3af3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3af6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3afa:	0f b6 10             	movzbl (%eax),%edx
+    3afd:	84 d2                	test   %dl,%dl
+    3aff:	75 12                	jne    3b13 <strchr+0x23>
+    3b01:	eb 1d                	jmp    3b20 <strchr+0x30>
+    3b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b07:	90                   	nop
+    3b08:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3b0c:	83 c0 01             	add    $0x1,%eax
+    3b0f:	84 d2                	test   %dl,%dl
+    3b11:	74 0d                	je     3b20 <strchr+0x30>
+    if(*s == c)
+    3b13:	38 d1                	cmp    %dl,%cl
+    3b15:	75 f1                	jne    3b08 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3b17:	5d                   	pop    %ebp
+    3b18:	c3                   	ret
+    3b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3b20:	31 c0                	xor    %eax,%eax
+}
+    3b22:	5d                   	pop    %ebp
+    3b23:	c3                   	ret
+    3b24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b2f:	90                   	nop
+
+00003b30 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3b30:	55                   	push   %ebp
+    3b31:	89 e5                	mov    %esp,%ebp
+    3b33:	57                   	push   %edi
+    3b34:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3b35:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3b38:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3b39:	31 db                	xor    %ebx,%ebx
+{
+    3b3b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    3b3e:	eb 27                	jmp    3b67 <gets+0x37>
+    cc = read(0, &c, 1);
+    3b40:	83 ec 04             	sub    $0x4,%esp
+    3b43:	6a 01                	push   $0x1
+    3b45:	56                   	push   %esi
+    3b46:	6a 00                	push   $0x0
+    3b48:	e8 1e 01 00 00       	call   3c6b <read>
+    if(cc < 1)
+    3b4d:	83 c4 10             	add    $0x10,%esp
+    3b50:	85 c0                	test   %eax,%eax
+    3b52:	7e 1d                	jle    3b71 <gets+0x41>
+      break;
+    buf[i++] = c;
+    3b54:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3b58:	8b 55 08             	mov    0x8(%ebp),%edx
+    3b5b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3b5f:	3c 0a                	cmp    $0xa,%al
+    3b61:	74 10                	je     3b73 <gets+0x43>
+    3b63:	3c 0d                	cmp    $0xd,%al
+    3b65:	74 0c                	je     3b73 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    3b67:	89 df                	mov    %ebx,%edi
+    3b69:	83 c3 01             	add    $0x1,%ebx
+    3b6c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3b6f:	7c cf                	jl     3b40 <gets+0x10>
+    3b71:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3b73:	8b 45 08             	mov    0x8(%ebp),%eax
+    3b76:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b7d:	5b                   	pop    %ebx
+    3b7e:	5e                   	pop    %esi
+    3b7f:	5f                   	pop    %edi
+    3b80:	5d                   	pop    %ebp
+    3b81:	c3                   	ret
+    3b82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003b90 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3b90:	55                   	push   %ebp
+    3b91:	89 e5                	mov    %esp,%ebp
+    3b93:	56                   	push   %esi
+    3b94:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3b95:	83 ec 08             	sub    $0x8,%esp
+    3b98:	6a 00                	push   $0x0
+    3b9a:	ff 75 08             	push   0x8(%ebp)
+    3b9d:	e8 f1 00 00 00       	call   3c93 <open>
+  if(fd < 0)
+    3ba2:	83 c4 10             	add    $0x10,%esp
+    3ba5:	85 c0                	test   %eax,%eax
+    3ba7:	78 27                	js     3bd0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3ba9:	83 ec 08             	sub    $0x8,%esp
+    3bac:	ff 75 0c             	push   0xc(%ebp)
+    3baf:	89 c3                	mov    %eax,%ebx
+    3bb1:	50                   	push   %eax
+    3bb2:	e8 f4 00 00 00       	call   3cab <fstat>
+  close(fd);
+    3bb7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3bba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3bbc:	e8 ba 00 00 00       	call   3c7b <close>
+  return r;
+    3bc1:	83 c4 10             	add    $0x10,%esp
+}
+    3bc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3bc7:	89 f0                	mov    %esi,%eax
+    3bc9:	5b                   	pop    %ebx
+    3bca:	5e                   	pop    %esi
+    3bcb:	5d                   	pop    %ebp
+    3bcc:	c3                   	ret
+    3bcd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3bd0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3bd5:	eb ed                	jmp    3bc4 <stat+0x34>
+    3bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bde:	66 90                	xchg   %ax,%ax
+
+00003be0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3be0:	55                   	push   %ebp
+    3be1:	89 e5                	mov    %esp,%ebp
+    3be3:	53                   	push   %ebx
+    3be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3be7:	0f be 02             	movsbl (%edx),%eax
+    3bea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3bed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3bf5:	77 1e                	ja     3c15 <atoi+0x35>
+    3bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bfe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3c00:	83 c2 01             	add    $0x1,%edx
+    3c03:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3c06:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3c0a:	0f be 02             	movsbl (%edx),%eax
+    3c0d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3c10:	80 fb 09             	cmp    $0x9,%bl
+    3c13:	76 eb                	jbe    3c00 <atoi+0x20>
+  return n;
+}
+    3c15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c18:	89 c8                	mov    %ecx,%eax
+    3c1a:	c9                   	leave
+    3c1b:	c3                   	ret
+    3c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003c20 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    3c20:	55                   	push   %ebp
+    3c21:	89 e5                	mov    %esp,%ebp
+    3c23:	57                   	push   %edi
+    3c24:	56                   	push   %esi
+    3c25:	8b 45 10             	mov    0x10(%ebp),%eax
+    3c28:	8b 55 08             	mov    0x8(%ebp),%edx
+    3c2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3c2e:	85 c0                	test   %eax,%eax
+    3c30:	7e 13                	jle    3c45 <memmove+0x25>
+    3c32:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3c34:	89 d7                	mov    %edx,%edi
+    3c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3c40:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3c41:	39 f8                	cmp    %edi,%eax
+    3c43:	75 fb                	jne    3c40 <memmove+0x20>
+  return vdst;
+}
+    3c45:	5e                   	pop    %esi
+    3c46:	89 d0                	mov    %edx,%eax
+    3c48:	5f                   	pop    %edi
+    3c49:	5d                   	pop    %ebp
+    3c4a:	c3                   	ret
+
+00003c4b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3c4b:	b8 01 00 00 00       	mov    $0x1,%eax
+    3c50:	cd 40                	int    $0x40
+    3c52:	c3                   	ret
+
+00003c53 <exit>:
+SYSCALL(exit)
+    3c53:	b8 02 00 00 00       	mov    $0x2,%eax
+    3c58:	cd 40                	int    $0x40
+    3c5a:	c3                   	ret
+
+00003c5b <wait>:
+SYSCALL(wait)
+    3c5b:	b8 03 00 00 00       	mov    $0x3,%eax
+    3c60:	cd 40                	int    $0x40
+    3c62:	c3                   	ret
+
+00003c63 <pipe>:
+SYSCALL(pipe)
+    3c63:	b8 04 00 00 00       	mov    $0x4,%eax
+    3c68:	cd 40                	int    $0x40
+    3c6a:	c3                   	ret
+
+00003c6b <read>:
+SYSCALL(read)
+    3c6b:	b8 05 00 00 00       	mov    $0x5,%eax
+    3c70:	cd 40                	int    $0x40
+    3c72:	c3                   	ret
+
+00003c73 <write>:
+SYSCALL(write)
+    3c73:	b8 10 00 00 00       	mov    $0x10,%eax
+    3c78:	cd 40                	int    $0x40
+    3c7a:	c3                   	ret
+
+00003c7b <close>:
+SYSCALL(close)
+    3c7b:	b8 15 00 00 00       	mov    $0x15,%eax
+    3c80:	cd 40                	int    $0x40
+    3c82:	c3                   	ret
+
+00003c83 <kill>:
+SYSCALL(kill)
+    3c83:	b8 06 00 00 00       	mov    $0x6,%eax
+    3c88:	cd 40                	int    $0x40
+    3c8a:	c3                   	ret
+
+00003c8b <exec>:
+SYSCALL(exec)
+    3c8b:	b8 07 00 00 00       	mov    $0x7,%eax
+    3c90:	cd 40                	int    $0x40
+    3c92:	c3                   	ret
+
+00003c93 <open>:
+SYSCALL(open)
+    3c93:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3c98:	cd 40                	int    $0x40
+    3c9a:	c3                   	ret
+
+00003c9b <mknod>:
+SYSCALL(mknod)
+    3c9b:	b8 11 00 00 00       	mov    $0x11,%eax
+    3ca0:	cd 40                	int    $0x40
+    3ca2:	c3                   	ret
+
+00003ca3 <unlink>:
+SYSCALL(unlink)
+    3ca3:	b8 12 00 00 00       	mov    $0x12,%eax
+    3ca8:	cd 40                	int    $0x40
+    3caa:	c3                   	ret
+
+00003cab <fstat>:
+SYSCALL(fstat)
+    3cab:	b8 08 00 00 00       	mov    $0x8,%eax
+    3cb0:	cd 40                	int    $0x40
+    3cb2:	c3                   	ret
+
+00003cb3 <link>:
+SYSCALL(link)
+    3cb3:	b8 13 00 00 00       	mov    $0x13,%eax
+    3cb8:	cd 40                	int    $0x40
+    3cba:	c3                   	ret
+
+00003cbb <mkdir>:
+SYSCALL(mkdir)
+    3cbb:	b8 14 00 00 00       	mov    $0x14,%eax
+    3cc0:	cd 40                	int    $0x40
+    3cc2:	c3                   	ret
+
+00003cc3 <chdir>:
+SYSCALL(chdir)
+    3cc3:	b8 09 00 00 00       	mov    $0x9,%eax
+    3cc8:	cd 40                	int    $0x40
+    3cca:	c3                   	ret
+
+00003ccb <dup>:
+SYSCALL(dup)
+    3ccb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3cd0:	cd 40                	int    $0x40
+    3cd2:	c3                   	ret
+
+00003cd3 <getpid>:
+SYSCALL(getpid)
+    3cd3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3cd8:	cd 40                	int    $0x40
+    3cda:	c3                   	ret
+
+00003cdb <sbrk>:
+SYSCALL(sbrk)
+    3cdb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3ce0:	cd 40                	int    $0x40
+    3ce2:	c3                   	ret
+
+00003ce3 <sleep>:
+SYSCALL(sleep)
+    3ce3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3ce8:	cd 40                	int    $0x40
+    3cea:	c3                   	ret
+
+00003ceb <uptime>:
+SYSCALL(uptime)
+    3ceb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3cf0:	cd 40                	int    $0x40
+    3cf2:	c3                   	ret
+
+00003cf3 <getsysinfo>:
+SYSCALL(getsysinfo)
+    3cf3:	b8 16 00 00 00       	mov    $0x16,%eax
+    3cf8:	cd 40                	int    $0x40
+    3cfa:	c3                   	ret
+
+00003cfb <detect_deadlock>:
+SYSCALL(detect_deadlock)
+    3cfb:	b8 17 00 00 00       	mov    $0x17,%eax
+    3d00:	cd 40                	int    $0x40
+    3d02:	c3                   	ret
+
+00003d03 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+    3d03:	b8 18 00 00 00       	mov    $0x18,%eax
+    3d08:	cd 40                	int    $0x40
+    3d0a:	c3                   	ret
+
+00003d0b <mlfqstart>:
+SYSCALL(mlfqstart)
+    3d0b:	b8 19 00 00 00       	mov    $0x19,%eax
+    3d10:	cd 40                	int    $0x40
+    3d12:	c3                   	ret
+
+00003d13 <mlfqstop>:
+SYSCALL(mlfqstop)
+    3d13:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3d18:	cd 40                	int    $0x40
+    3d1a:	c3                   	ret
+
+00003d1b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+    3d1b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3d20:	cd 40                	int    $0x40
+    3d22:	c3                   	ret
+
+00003d23 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+    3d23:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3d28:	cd 40                	int    $0x40
+    3d2a:	c3                   	ret
+
+00003d2b <setpriority>:
+SYSCALL(setpriority)
+    3d2b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3d30:	cd 40                	int    $0x40
+    3d32:	c3                   	ret
+
+00003d33 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+    3d33:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3d38:	cd 40                	int    $0x40
+    3d3a:	c3                   	ret
+
+00003d3b <getcpustats>:
+SYSCALL(getcpustats)
+    3d3b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3d40:	cd 40                	int    $0x40
+    3d42:	c3                   	ret
+
+00003d43 <setscheduler>:
+SYSCALL(setscheduler)
+    3d43:	b8 20 00 00 00       	mov    $0x20,%eax
+    3d48:	cd 40                	int    $0x40
+    3d4a:	c3                   	ret
+
+00003d4b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+    3d4b:	b8 21 00 00 00       	mov    $0x21,%eax
+    3d50:	cd 40                	int    $0x40
+    3d52:	c3                   	ret
+
+00003d53 <getscheduler>:
+SYSCALL(getscheduler)
+    3d53:	b8 22 00 00 00       	mov    $0x22,%eax
+    3d58:	cd 40                	int    $0x40
+    3d5a:	c3                   	ret
+
+00003d5b <splice>:
+SYSCALL(splice)
+    3d5b:	b8 23 00 00 00       	mov    $0x23,%eax
+    3d60:	cd 40                	int    $0x40
+    3d62:	c3                   	ret
+
+00003d63 <readv>:
+SYSCALL(readv)
+    3d63:	b8 24 00 00 00       	mov    $0x24,%eax
+    3d68:	cd 40                	int    $0x40
+    3d6a:	c3                   	ret
+
+00003d6b <writev>:
+SYSCALL(writev)
+    3d6b:	b8 25 00 00 00       	mov    $0x25,%eax
+    3d70:	cd 40                	int    $0x40
+    3d72:	c3                   	ret
+
+00003d73 <pread>:
+SYSCALL(pread)
+    3d73:	b8 26 00 00 00       	mov    $0x26,%eax
+    3d78:	cd 40                	int    $0x40
+    3d7a:	c3                   	ret
+
+00003d7b <pwrite>:
+SYSCALL(pwrite)
+    3d7b:	b8 27 00 00 00       	mov    $0x27,%eax
+    3d80:	cd 40                	int    $0x40
+    3d82:	c3                   	ret
+
+00003d83 <getlogstat>:
+SYSCALL(getlogstat)
+    3d83:	b8 28 00 00 00       	mov    $0x28,%eax
+    3d88:	cd 40                	int    $0x40
+    3d8a:	c3                   	ret
+
+00003d8b <mount>:
+SYSCALL(mount)
+    3d8b:	b8 29 00 00 00       	mov    $0x29,%eax
+    3d90:	cd 40                	int    $0x40
+    3d92:	c3                   	ret
+
+00003d93 <umount>:
+SYSCALL(umount)
+    3d93:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    3d98:	cd 40                	int    $0x40
+    3d9a:	c3                   	ret
+
+00003d9b <mmap>:
+SYSCALL(mmap)
+    3d9b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    3da0:	cd 40                	int    $0x40
+    3da2:	c3                   	ret
+
+00003da3 <munmap>:
+SYSCALL(munmap)
+    3da3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    3da8:	cd 40                	int    $0x40
+    3daa:	c3                   	ret
+
+00003dab <membench>:
+SYSCALL(membench)
+    3dab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    3db0:	cd 40                	int    $0x40
+    3db2:	c3                   	ret
+
+00003db3 <getlockstat>:
+SYSCALL(getlockstat)
+    3db3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    3db8:	cd 40                	int    $0x40
+    3dba:	c3                   	ret
+
+00003dbb <lockbench>:
+SYSCALL(lockbench)
+    3dbb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    3dc0:	cd 40                	int    $0x40
+    3dc2:	c3                   	ret
+
+00003dc3 <prof>:
+SYSCALL(prof)
+    3dc3:	b8 30 00 00 00       	mov    $0x30,%eax
+    3dc8:	cd 40                	int    $0x40
+    3dca:	c3                   	ret
+
+00003dcb <tracectl>:
+SYSCALL(tracectl)
+    3dcb:	b8 31 00 00 00       	mov    $0x31,%eax
+    3dd0:	cd 40                	int    $0x40
+    3dd2:	c3                   	ret
+
+00003dd3 <traceread>:
+SYSCALL(traceread)
+    3dd3:	b8 32 00 00 00       	mov    $0x32,%eax
+    3dd8:	cd 40                	int    $0x40
+    3dda:	c3                   	ret
+
+00003ddb <getsysstat>:
+SYSCALL(getsysstat)
+    3ddb:	b8 33 00 00 00       	mov    $0x33,%eax
+    3de0:	cd 40                	int    $0x40
+    3de2:	c3                   	ret
+
+00003de3 <getwaitstat>:
+SYSCALL(getwaitstat)
+    3de3:	b8 34 00 00 00       	mov    $0x34,%eax
+    3de8:	cd 40                	int    $0x40
+    3dea:	c3                   	ret
+
+00003deb <getschedwait>:
+SYSCALL(getschedwait)
+    3deb:	b8 35 00 00 00       	mov    $0x35,%eax
+    3df0:	cd 40                	int    $0x40
+    3df2:	c3                   	ret
+
+00003df3 <mlfqread>:
+SYSCALL(mlfqread)
+    3df3:	b8 36 00 00 00       	mov    $0x36,%eax
+    3df8:	cd 40                	int    $0x40
+    3dfa:	c3                   	ret
+
+00003dfb <dllock>:
+SYSCALL(dllock)
+    3dfb:	b8 37 00 00 00       	mov    $0x37,%eax
+    3e00:	cd 40                	int    $0x40
+    3e02:	c3                   	ret
+
+00003e03 <watchdogctl>:
+SYSCALL(watchdogctl)
+    3e03:	b8 38 00 00 00       	mov    $0x38,%eax
+    3e08:	cd 40                	int    $0x40
+    3e0a:	c3                   	ret
+
+00003e0b <deadlocklog>:
+SYSCALL(deadlocklog)
+    3e0b:	b8 39 00 00 00       	mov    $0x39,%eax
+    3e10:	cd 40                	int    $0x40
+    3e12:	c3                   	ret
+
+00003e13 <clone>:
+SYSCALL(clone)
+    3e13:	b8 3a 00 00 00       	mov    $0x3a,%eax
+    3e18:	cd 40                	int    $0x40
+    3e1a:	c3                   	ret
+
+00003e1b <join>:
+SYSCALL(join)
+    3e1b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+    3e20:	cd 40                	int    $0x40
+    3e22:	c3                   	ret
+
+00003e23 <futex>:
+SYSCALL(futex)
+    3e23:	b8 3c 00 00 00       	mov    $0x3c,%eax
+    3e28:	cd 40                	int    $0x40
+    3e2a:	c3                   	ret
+
+00003e2b <shmat>:
+SYSCALL(shmat)
+    3e2b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+    3e30:	cd 40                	int    $0x40
+    3e32:	c3                   	ret
+
+00003e33 <shmdt>:
+SYSCALL(shmdt)
+    3e33:	b8 3e 00 00 00       	mov    $0x3e,%eax
+    3e38:	cd 40                	int    $0x40
+    3e3a:	c3                   	ret
+
+00003e3b <poll>:
+SYSCALL(poll)
+    3e3b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+    3e40:	cd 40                	int    $0x40
+    3e42:	c3                   	ret
+    3e43:	66 90                	xchg   %ax,%ax
+    3e45:	66 90                	xchg   %ax,%ax
+    3e47:	66 90                	xchg   %ax,%ax
+    3e49:	66 90                	xchg   %ax,%ax
+    3e4b:	66 90                	xchg   %ax,%ax
+    3e4d:	66 90                	xchg   %ax,%ax
+    3e4f:	90                   	nop
+
+00003e50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3e50:	55                   	push   %ebp
+    3e51:	89 e5                	mov    %esp,%ebp
+    3e53:	57                   	push   %edi
+    3e54:	56                   	push   %esi
+    3e55:	53                   	push   %ebx
+    3e56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3e58:	89 d1                	mov    %edx,%ecx
+{
+    3e5a:	83 ec 3c             	sub    $0x3c,%esp
+    3e5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3e60:	85 d2                	test   %edx,%edx
+    3e62:	0f 89 80 00 00 00    	jns    3ee8 <printint+0x98>
+    3e68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3e6c:	74 7a                	je     3ee8 <printint+0x98>
+    x = -xx;
+    3e6e:	f7 d9                	neg    %ecx
+    neg = 1;
+    3e70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3e75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3e78:	31 f6                	xor    %esi,%esi
+    3e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3e80:	89 c8                	mov    %ecx,%eax
+    3e82:	31 d2                	xor    %edx,%edx
+    3e84:	89 f7                	mov    %esi,%edi
+    3e86:	f7 f3                	div    %ebx
+    3e88:	8d 76 01             	lea    0x1(%esi),%esi
+    3e8b:	0f b6 92 64 5d 00 00 	movzbl 0x5d64(%edx),%edx
+    3e92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3e96:	89 ca                	mov    %ecx,%edx
+    3e98:	89 c1                	mov    %eax,%ecx
+    3e9a:	39 da                	cmp    %ebx,%edx
+    3e9c:	73 e2                	jae    3e80 <printint+0x30>
+  if(neg)
+    3e9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3ea1:	85 c0                	test   %eax,%eax
+    3ea3:	74 07                	je     3eac <printint+0x5c>
+    buf[i++] = '-';
+    3ea5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3eaa:	89 f7                	mov    %esi,%edi
+    3eac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3eaf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3eb2:	01 df                	add    %ebx,%edi
+    3eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3eb8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3ebb:	83 ec 04             	sub    $0x4,%esp
+    3ebe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3ec1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3ec4:	6a 01                	push   $0x1
+    3ec6:	50                   	push   %eax
+    3ec7:	56                   	push   %esi
+    3ec8:	e8 a6 fd ff ff       	call   3c73 <write>
+  while(--i >= 0)
+    3ecd:	89 f8                	mov    %edi,%eax
+    3ecf:	83 c4 10             	add    $0x10,%esp
+    3ed2:	83 ef 01             	sub    $0x1,%edi
+    3ed5:	39 d8                	cmp    %ebx,%eax
+    3ed7:	75 df                	jne    3eb8 <printint+0x68>
+}
+    3ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3edc:	5b                   	pop    %ebx
+    3edd:	5e                   	pop    %esi
+    3ede:	5f                   	pop    %edi
+    3edf:	5d                   	pop    %ebp
+    3ee0:	c3                   	ret
+    3ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3ee8:	31 c0                	xor    %eax,%eax
+    3eea:	eb 89                	jmp    3e75 <printint+0x25>
+    3eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ef0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3ef0:	55                   	push   %ebp
+    3ef1:	89 e5                	mov    %esp,%ebp
+    3ef3:	57                   	push   %edi
+    3ef4:	56                   	push   %esi
+    3ef5:	53                   	push   %ebx
+    3ef6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3ef9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3efc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3eff:	0f b6 1e             	movzbl (%esi),%ebx
+    3f02:	83 c6 01             	add    $0x1,%esi
+    3f05:	84 db                	test   %bl,%bl
+    3f07:	74 67                	je     3f70 <printf+0x80>
+    3f09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3f0c:	31 d2                	xor    %edx,%edx
+    3f0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3f11:	eb 34                	jmp    3f47 <printf+0x57>
+    3f13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f17:	90                   	nop
+    3f18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3f1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3f20:	83 f8 25             	cmp    $0x25,%eax
+    3f23:	74 18                	je     3f3d <printf+0x4d>
+  write(fd, &c, 1);
+    3f25:	83 ec 04             	sub    $0x4,%esp
+    3f28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3f2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3f2e:	6a 01                	push   $0x1
+    3f30:	50                   	push   %eax
+    3f31:	57                   	push   %edi
+    3f32:	e8 3c fd ff ff       	call   3c73 <write>
+    3f37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3f3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3f3d:	0f b6 1e             	movzbl (%esi),%ebx
+    3f40:	83 c6 01             	add    $0x1,%esi
+    3f43:	84 db                	test   %bl,%bl
+    3f45:	74 29                	je     3f70 <printf+0x80>
+    c = fmt[i] & 0xff;
+    3f47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3f4a:	85 d2                	test   %edx,%edx
+    3f4c:	74 ca                	je     3f18 <printf+0x28>
+      }
+    } else if(state == '%'){
+    3f4e:	83 fa 25             	cmp    $0x25,%edx
+    3f51:	75 ea                	jne    3f3d <printf+0x4d>
+      if(c == 'd'){
+    3f53:	83 f8 25             	cmp    $0x25,%eax
+    3f56:	0f 84 24 01 00 00    	je     4080 <printf+0x190>
+    3f5c:	83 e8 63             	sub    $0x63,%eax
+    3f5f:	83 f8 15             	cmp    $0x15,%eax
+    3f62:	77 1c                	ja     3f80 <printf+0x90>
+    3f64:	ff 24 85 0c 5d 00 00 	jmp    *0x5d0c(,%eax,4)
+    3f6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    3f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f73:	5b                   	pop    %ebx
+    3f74:	5e                   	pop    %esi
+    3f75:	5f                   	pop    %edi
+    3f76:	5d                   	pop    %ebp
+    3f77:	c3                   	ret
+    3f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f7f:	90                   	nop
+  write(fd, &c, 1);
+    3f80:	83 ec 04             	sub    $0x4,%esp
+    3f83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3f86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    3f8a:	6a 01                	push   $0x1
+    3f8c:	52                   	push   %edx
+    3f8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3f90:	57                   	push   %edi
+    3f91:	e8 dd fc ff ff       	call   3c73 <write>
+    3f96:	83 c4 0c             	add    $0xc,%esp
+    3f99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3f9c:	6a 01                	push   $0x1
+    3f9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3fa1:	52                   	push   %edx
+    3fa2:	57                   	push   %edi
+    3fa3:	e8 cb fc ff ff       	call   3c73 <write>
+        putc(fd, c);
+    3fa8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3fab:	31 d2                	xor    %edx,%edx
+    3fad:	eb 8e                	jmp    3f3d <printf+0x4d>
+    3faf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    3fb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3fb3:	83 ec 0c             	sub    $0xc,%esp
+    3fb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3fbb:	8b 13                	mov    (%ebx),%edx
+    3fbd:	6a 00                	push   $0x0
+    3fbf:	89 f8                	mov    %edi,%eax
+        ap++;
+    3fc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    3fc4:	e8 87 fe ff ff       	call   3e50 <printint>
+        ap++;
+    3fc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3fcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3fcf:	31 d2                	xor    %edx,%edx
+    3fd1:	e9 67 ff ff ff       	jmp    3f3d <printf+0x4d>
+    3fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3fe0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3fe3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    3fe5:	83 c0 04             	add    $0x4,%eax
+    3fe8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    3feb:	85 db                	test   %ebx,%ebx
+    3fed:	0f 84 9d 00 00 00    	je     4090 <printf+0x1a0>
+        while(*s != 0){
+    3ff3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    3ff6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    3ff8:	84 c0                	test   %al,%al
+    3ffa:	0f 84 3d ff ff ff    	je     3f3d <printf+0x4d>
+    4000:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4003:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4006:	89 de                	mov    %ebx,%esi
+    4008:	89 d3                	mov    %edx,%ebx
+    400a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4010:	83 ec 04             	sub    $0x4,%esp
+    4013:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4016:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4019:	6a 01                	push   $0x1
+    401b:	53                   	push   %ebx
+    401c:	57                   	push   %edi
+    401d:	e8 51 fc ff ff       	call   3c73 <write>
+        while(*s != 0){
+    4022:	0f b6 06             	movzbl (%esi),%eax
+    4025:	83 c4 10             	add    $0x10,%esp
+    4028:	84 c0                	test   %al,%al
+    402a:	75 e4                	jne    4010 <printf+0x120>
+      state = 0;
+    402c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    402f:	31 d2                	xor    %edx,%edx
+    4031:	e9 07 ff ff ff       	jmp    3f3d <printf+0x4d>
+    4036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    403d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4040:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4043:	83 ec 0c             	sub    $0xc,%esp
+    4046:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    404b:	8b 13                	mov    (%ebx),%edx
+    404d:	6a 01                	push   $0x1
+    404f:	e9 6b ff ff ff       	jmp    3fbf <printf+0xcf>
+    4054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4058:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    405b:	83 ec 04             	sub    $0x4,%esp
+    405e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4061:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4063:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4066:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4069:	6a 01                	push   $0x1
+    406b:	52                   	push   %edx
+    406c:	57                   	push   %edi
+    406d:	e8 01 fc ff ff       	call   3c73 <write>
+        ap++;
+    4072:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4075:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4078:	31 d2                	xor    %edx,%edx
+    407a:	e9 be fe ff ff       	jmp    3f3d <printf+0x4d>
+    407f:	90                   	nop
+  write(fd, &c, 1);
+    4080:	83 ec 04             	sub    $0x4,%esp
+    4083:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4086:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4089:	6a 01                	push   $0x1
+    408b:	e9 11 ff ff ff       	jmp    3fa1 <printf+0xb1>
+    4090:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4095:	bb 02 5d 00 00       	mov    $0x5d02,%ebx
+    409a:	e9 61 ff ff ff       	jmp    4000 <printf+0x110>
+    409f:	90                   	nop
+
+000040a0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+    40a0:	55                   	push   %ebp
+    40a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    40a3:	a1 b4 af 00 00       	mov    0xafb4,%eax
+{
+    40a8:	89 e5                	mov    %esp,%ebp
+    40aa:	56                   	push   %esi
+    40ab:	53                   	push   %ebx
+    40ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    40b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    40b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    40b4:	39 ca                	cmp    %ecx,%edx
+    40b6:	73 30                	jae    40e8 <bigfree+0x48>
+    40b8:	39 c1                	cmp    %eax,%ecx
+    40ba:	72 04                	jb     40c0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    40bc:	39 c2                	cmp    %eax,%edx
+    40be:	72 f0                	jb     40b0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    40c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    40c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    40c6:	39 f0                	cmp    %esi,%eax
+    40c8:	74 26                	je     40f0 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    40ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    40cc:	8b 42 04             	mov    0x4(%edx),%eax
+    40cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    40d2:	39 d9                	cmp    %ebx,%ecx
+    40d4:	74 30                	je     4106 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    40d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    40d8:	5b                   	pop    %ebx
+  freep = p;
+    40d9:	89 15 b4 af 00 00    	mov    %edx,0xafb4
+}
+    40df:	5e                   	pop    %esi
+    40e0:	5d                   	pop    %ebp
+    40e1:	c3                   	ret
+    40e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    40e8:	39 c1                	cmp    %eax,%ecx
+    40ea:	72 d0                	jb     40bc <bigfree+0x1c>
+    40ec:	eb c2                	jmp    40b0 <bigfree+0x10>
+    40ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    40f0:	03 58 04             	add    0x4(%eax),%ebx
+    40f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    40f6:	8b 02                	mov    (%edx),%eax
+    40f8:	8b 00                	mov    (%eax),%eax
+    40fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    40fc:	8b 42 04             	mov    0x4(%edx),%eax
+    40ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    4102:	39 d9                	cmp    %ebx,%ecx
+    4104:	75 d0                	jne    40d6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+    4106:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    4109:	89 15 b4 af 00 00    	mov    %edx,0xafb4
+    p->s.size += bp->s.size;
+    410f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4112:	8b 09                	mov    (%ecx),%ecx
+    4114:	89 0a                	mov    %ecx,(%edx)
+}
+    4116:	5b                   	pop    %ebx
+    4117:	5e                   	pop    %esi
+    4118:	5d                   	pop    %ebp
+    4119:	c3                   	ret
+    411a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004120 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+    4120:	55                   	push   %ebp
+    4121:	89 e5                	mov    %esp,%ebp
+    4123:	57                   	push   %edi
+    4124:	89 c7                	mov    %eax,%edi
+    4126:	56                   	push   %esi
+    4127:	53                   	push   %ebx
+    4128:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    412b:	a1 b4 af 00 00       	mov    0xafb4,%eax
+    4130:	85 c0                	test   %eax,%eax
+    4132:	0f 84 88 00 00 00    	je     41c0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4138:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    413a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    413d:	39 f9                	cmp    %edi,%ecx
+    413f:	73 5f                	jae    41a0 <bigalloc+0x80>
+  if(nu < 4096)
+    4141:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4146:	39 df                	cmp    %ebx,%edi
+    4148:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    414b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4152:	eb 0d                	jmp    4161 <bigalloc+0x41>
+    4154:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4158:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    415a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    415d:	39 f9                	cmp    %edi,%ecx
+    415f:	73 3f                	jae    41a0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    4161:	89 d0                	mov    %edx,%eax
+    4163:	39 15 b4 af 00 00    	cmp    %edx,0xafb4
+    4169:	75 ed                	jne    4158 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    416b:	83 ec 0c             	sub    $0xc,%esp
+    416e:	56                   	push   %esi
+    416f:	e8 67 fb ff ff       	call   3cdb <sbrk>
+  if(p == (char*)-1)
+    4174:	83 c4 10             	add    $0x10,%esp
+    4177:	83 f8 ff             	cmp    $0xffffffff,%eax
+    417a:	74 11                	je     418d <bigalloc+0x6d>
+  hp->s.size = nu;
+    417c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+    417f:	e8 1c ff ff ff       	call   40a0 <bigfree>
+  return freep;
+    4184:	a1 b4 af 00 00       	mov    0xafb4,%eax
+      if((p = morecore(nunits)) == 0)
+    4189:	85 c0                	test   %eax,%eax
+    418b:	75 cb                	jne    4158 <bigalloc+0x38>
+        return 0;
+  }
+}
+    418d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4190:	31 d2                	xor    %edx,%edx
+}
+    4192:	5b                   	pop    %ebx
+    4193:	89 d0                	mov    %edx,%eax
+    4195:	5e                   	pop    %esi
+    4196:	5f                   	pop    %edi
+    4197:	5d                   	pop    %ebp
+    4198:	c3                   	ret
+    4199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    41a0:	39 cf                	cmp    %ecx,%edi
+    41a2:	74 4c                	je     41f0 <bigalloc+0xd0>
+        p->s.size -= nunits;
+    41a4:	29 f9                	sub    %edi,%ecx
+    41a6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    41a9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    41ac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    41af:	a3 b4 af 00 00       	mov    %eax,0xafb4
+}
+    41b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    41b7:	89 d0                	mov    %edx,%eax
+    41b9:	5b                   	pop    %ebx
+    41ba:	5e                   	pop    %esi
+    41bb:	5f                   	pop    %edi
+    41bc:	5d                   	pop    %ebp
+    41bd:	c3                   	ret
+    41be:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+    41c0:	c7 05 b4 af 00 00 b8 	movl   $0xafb8,0xafb4
+    41c7:	af 00 00 
+    base.s.size = 0;
+    41ca:	ba b8 af 00 00       	mov    $0xafb8,%edx
+    base.s.ptr = freep = prevp = &base;
+    41cf:	c7 05 b8 af 00 00 b8 	movl   $0xafb8,0xafb8
+    41d6:	af 00 00 
+    base.s.size = 0;
+    41d9:	c7 05 bc af 00 00 00 	movl   $0x0,0xafbc
+    41e0:	00 00 00 
+    if(p->s.size >= nunits){
+    41e3:	e9 59 ff ff ff       	jmp    4141 <bigalloc+0x21>
+    41e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    41f0:	8b 0a                	mov    (%edx),%ecx
+    41f2:	89 08                	mov    %ecx,(%eax)
+    41f4:	eb b9                	jmp    41af <bigalloc+0x8f>
+    41f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004200 <free>:
+{
+    4200:	55                   	push   %ebp
+    4201:	89 e5                	mov    %esp,%ebp
+    4203:	53                   	push   %ebx
+    4204:	83 ec 04             	sub    $0x4,%esp
+    4207:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+    420a:	85 c9                	test   %ecx,%ecx
+    420c:	74 58                	je     4266 <free+0x66>
+  bp = (Header*)ap - 1;
+    420e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    4211:	ba 01 00 00 00       	mov    $0x1,%edx
+    4216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    421d:	8d 76 00             	lea    0x0(%esi),%esi
+    4220:	89 d0                	mov    %edx,%eax
+    4222:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+  while(xchg(&locked, 1) != 0)
+    4229:	85 c0                	test   %eax,%eax
+    422b:	75 f3                	jne    4220 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+    422d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+    4230:	83 fa 40             	cmp    $0x40,%edx
+    4233:	77 3b                	ja     4270 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+    4235:	83 fa 02             	cmp    $0x2,%edx
+    4238:	76 3f                	jbe    4279 <free+0x79>
+    423a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    4240:	83 c0 01             	add    $0x1,%eax
+    4243:	39 14 85 80 5d 00 00 	cmp    %edx,0x5d80(,%eax,4)
+    424a:	72 f4                	jb     4240 <free+0x40>
+    bp->s.ptr = classfree[c];
+    424c:	8b 14 85 80 af 00 00 	mov    0xaf80(,%eax,4),%edx
+    classfree[c] = bp;
+    4253:	89 1c 85 80 af 00 00 	mov    %ebx,0xaf80(,%eax,4)
+    bp->s.ptr = classfree[c];
+    425a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+    425d:	31 c0                	xor    %eax,%eax
+    425f:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+}
+    4266:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4269:	c9                   	leave
+    426a:	c3                   	ret
+    426b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    426f:	90                   	nop
+    bigfree(bp);
+    4270:	89 d8                	mov    %ebx,%eax
+    4272:	e8 29 fe ff ff       	call   40a0 <bigfree>
+    4277:	eb e4                	jmp    425d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+    4279:	31 c0                	xor    %eax,%eax
+    427b:	eb cf                	jmp    424c <free+0x4c>
+    427d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004280 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4280:	55                   	push   %ebp
+    4281:	b9 01 00 00 00       	mov    $0x1,%ecx
+    4286:	89 e5                	mov    %esp,%ebp
+    4288:	57                   	push   %edi
+    4289:	56                   	push   %esi
+    428a:	53                   	push   %ebx
+    428b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    428e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4291:	8d 50 07             	lea    0x7(%eax),%edx
+    4294:	c1 ea 03             	shr    $0x3,%edx
+    4297:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+    429a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    42a0:	89 c8                	mov    %ecx,%eax
+    42a2:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+    42a9:	85 c0                	test   %eax,%eax
+    42ab:	75 f3                	jne    42a0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+    42ad:	89 c3                	mov    %eax,%ebx
+    42af:	83 fa 40             	cmp    $0x40,%edx
+    42b2:	77 4c                	ja     4300 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+    42b4:	be 02 00 00 00       	mov    $0x2,%esi
+    42b9:	83 fa 02             	cmp    $0x2,%edx
+    42bc:	76 10                	jbe    42ce <malloc+0x4e>
+    42be:	66 90                	xchg   %ax,%ax
+    42c0:	83 c3 01             	add    $0x1,%ebx
+    42c3:	8b 34 9d 80 5d 00 00 	mov    0x5d80(,%ebx,4),%esi
+    42ca:	39 d6                	cmp    %edx,%esi
+    42cc:	72 f2                	jb     42c0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+    42ce:	8b 14 9d 80 af 00 00 	mov    0xaf80(,%ebx,4),%edx
+    42d5:	85 d2                	test   %edx,%edx
+    42d7:	74 47                	je     4320 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+    42d9:	8b 3a                	mov    (%edx),%edi
+    42db:	89 3c 9d 80 af 00 00 	mov    %edi,0xaf80(,%ebx,4)
+    42e2:	31 c0                	xor    %eax,%eax
+    42e4:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+    42eb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+    42ee:	8d 42 08             	lea    0x8(%edx),%eax
+}
+    42f1:	5b                   	pop    %ebx
+    42f2:	5e                   	pop    %esi
+    42f3:	5f                   	pop    %edi
+    42f4:	5d                   	pop    %ebp
+    42f5:	c3                   	ret
+    42f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42fd:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+    4300:	89 d0                	mov    %edx,%eax
+    4302:	e8 19 fe ff ff       	call   4120 <bigalloc>
+    4307:	89 c2                	mov    %eax,%edx
+    4309:	89 d8                	mov    %ebx,%eax
+    430b:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+  return p ? (void*)(p + 1) : 0;
+    4312:	85 d2                	test   %edx,%edx
+    4314:	75 d5                	jne    42eb <malloc+0x6b>
+    4316:	31 c0                	xor    %eax,%eax
+}
+    4318:	83 c4 1c             	add    $0x1c,%esp
+    431b:	5b                   	pop    %ebx
+    431c:	5e                   	pop    %esi
+    431d:	5f                   	pop    %edi
+    431e:	5d                   	pop    %ebp
+    431f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+    4320:	b8 00 02 00 00       	mov    $0x200,%eax
+    4325:	e8 f6 fd ff ff       	call   4120 <bigalloc>
+    432a:	85 c0                	test   %eax,%eax
+    432c:	74 44                	je     4372 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    432e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    4335:	8b 14 9d 80 af 00 00 	mov    0xaf80(,%ebx,4),%edx
+    433c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    433f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    4342:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+    4348:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    434b:	39 cf                	cmp    %ecx,%edi
+    434d:	72 8a                	jb     42d9 <malloc+0x59>
+    434f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    4352:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    4355:	8d 76 00             	lea    0x0(%esi),%esi
+    4358:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+    435a:	89 70 04             	mov    %esi,0x4(%eax)
+    435d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    435f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+    4361:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+    4363:	01 d8                	add    %ebx,%eax
+    4365:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+    4368:	73 ee                	jae    4358 <malloc+0xd8>
+    436a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    436d:	e9 69 ff ff ff       	jmp    42db <malloc+0x5b>
+    4372:	f0 87 05 60 af 00 00 	lock xchg %eax,0xaf60
+  return p ? (void*)(p + 1) : 0;
+    4379:	31 c0                	xor    %eax,%eax
+    437b:	eb 9b                	jmp    4318 <malloc+0x98>
+    437d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004380 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+    4380:	55                   	push   %ebp
+    4381:	89 e5                	mov    %esp,%ebp
+    4383:	56                   	push   %esi
+    4384:	53                   	push   %ebx
+    4385:	8b 45 08             	mov    0x8(%ebp),%eax
+    4388:	f7 65 0c             	mull   0xc(%ebp)
+    438b:	70 33                	jo     43c0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+    438d:	83 ec 0c             	sub    $0xc,%esp
+    4390:	89 c3                	mov    %eax,%ebx
+    4392:	50                   	push   %eax
+    4393:	e8 e8 fe ff ff       	call   4280 <malloc>
+    4398:	83 c4 10             	add    $0x10,%esp
+    439b:	89 c6                	mov    %eax,%esi
+    439d:	85 c0                	test   %eax,%eax
+    439f:	74 1f                	je     43c0 <calloc+0x40>
+    memset(p, 0, n);
+    43a1:	83 ec 04             	sub    $0x4,%esp
+    43a4:	53                   	push   %ebx
+    43a5:	6a 00                	push   $0x0
+    43a7:	50                   	push   %eax
+    43a8:	e8 23 f7 ff ff       	call   3ad0 <memset>
+    43ad:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    43b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    43b3:	89 f0                	mov    %esi,%eax
+    43b5:	5b                   	pop    %ebx
+    43b6:	5e                   	pop    %esi
+    43b7:	5d                   	pop    %ebp
+    43b8:	c3                   	ret
+    43b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    43c3:	31 f6                	xor    %esi,%esi
+}
+    43c5:	89 f0                	mov    %esi,%eax
+    43c7:	5b                   	pop    %ebx
+    43c8:	5e                   	pop    %esi
+    43c9:	5d                   	pop    %ebp
+    43ca:	c3                   	ret
+    43cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43cf:	90                   	nop
+
+000043d0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+    43d0:	55                   	push   %ebp
+    43d1:	89 e5                	mov    %esp,%ebp
+    43d3:	57                   	push   %edi
+    43d4:	56                   	push   %esi
+    43d5:	53                   	push   %ebx
+    43d6:	83 ec 0c             	sub    $0xc,%esp
+    43d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    43dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    43df:	85 db                	test   %ebx,%ebx
+    43e1:	74 55                	je     4438 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    43e3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    43e6:	89 de                	mov    %ebx,%esi
+    43e8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    43ef:	39 c7                	cmp    %eax,%edi
+    43f1:	72 0d                	jb     4400 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    43f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    43f6:	89 f0                	mov    %esi,%eax
+    43f8:	5b                   	pop    %ebx
+    43f9:	5e                   	pop    %esi
+    43fa:	5f                   	pop    %edi
+    43fb:	5d                   	pop    %ebp
+    43fc:	c3                   	ret
+    43fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    4400:	83 ec 0c             	sub    $0xc,%esp
+    4403:	50                   	push   %eax
+    4404:	e8 77 fe ff ff       	call   4280 <malloc>
+    4409:	83 c4 10             	add    $0x10,%esp
+    440c:	89 c6                	mov    %eax,%esi
+    440e:	85 c0                	test   %eax,%eax
+    4410:	74 e1                	je     43f3 <realloc+0x23>
+  memmove(p, ap, have);
+    4412:	83 ec 04             	sub    $0x4,%esp
+    4415:	57                   	push   %edi
+    4416:	53                   	push   %ebx
+    4417:	50                   	push   %eax
+    4418:	e8 03 f8 ff ff       	call   3c20 <memmove>
+  free(ap);
+    441d:	89 1c 24             	mov    %ebx,(%esp)
+    4420:	e8 db fd ff ff       	call   4200 <free>
+  return p;
+    4425:	83 c4 10             	add    $0x10,%esp
+}
+    4428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    442b:	89 f0                	mov    %esi,%eax
+    442d:	5b                   	pop    %ebx
+    442e:	5e                   	pop    %esi
+    442f:	5f                   	pop    %edi
+    4430:	5d                   	pop    %ebp
+    4431:	c3                   	ret
+    4432:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    4438:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    443b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    443e:	5b                   	pop    %ebx
+    443f:	5e                   	pop    %esi
+    4440:	5f                   	pop    %edi
+    4441:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    4442:	e9 39 fe ff ff       	jmp    4280 <malloc>
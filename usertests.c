@@ -1695,6 +1695,97 @@ fsfull()
   printf(1, "fsfull test finished\n");
 }
 
+// splice() between a file and a pipe and between two files.
+void
+splicetest(void)
+{
+  int fd, fd1, fds[2], pid, i, n, tot;
+
+  printf(stdout, "splice test\n");
+
+  fd = open("splice0", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "splice: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++)
+    buf[i] = i % 251;
+  if(write(fd, buf, 3000) != 3000){
+    printf(stdout, "splice: write failed\n");
+    exit();
+  }
+  close(fd);
+
+  // file to file
+  fd = open("splice0", O_RDONLY);
+  fd1 = open("splice1", O_CREATE|O_RDWR);
+  if(fd < 0 || fd1 < 0){
+    printf(stdout, "splice: open failed\n");
+    exit();
+  }
+  tot = 0;
+  while((n = splice(fd, fd1, 1000)) > 0)
+    tot += n;
+  if(n < 0 || tot != 3000){
+    printf(stdout, "splice: file to file moved %d\n", tot);
+    exit();
+  }
+  close(fd);
+  close(fd1);
+  fd = open("splice1", O_RDONLY);
+  memset(buf, 0, 3000);
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(stdout, "splice: copy has wrong size\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < 3000; i++){
+    if(buf[i] != (char)(i % 251)){
+      printf(stdout, "splice: copy differs at %d\n", i);
+      exit();
+    }
+  }
+
+  // file to pipe, larger than the pipe buffer
+  if(pipe(fds) != 0){
+    printf(stdout, "splice: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splice0", O_RDONLY);
+    while(splice(fd, fds[1], 3000) > 0)
+      ;
+    close(fd);
+    close(fds[1]);
+    exit();
+  } else if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  close(fds[1]);
+  tot = 0;
+  while((n = read(fds[0], buf + tot, 512)) > 0)
+    tot += n;
+  close(fds[0]);
+  wait();
+  if(tot != 3000){
+    printf(stdout, "splice: pipe got %d bytes\n", tot);
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if(buf[i] != (char)(i % 251)){
+      printf(stdout, "splice: pipe data differs at %d\n", i);
+      exit();
+    }
+  }
+
+  unlink("splice0");
+  unlink("splice1");
+  printf(stdout, "splice test ok\n");
+}
+
 void
 uio()
 {
@@ -1795,6 +1886,8 @@ main(int argc, char *argv[])
   forktest();
   bigdir(); // slow
 
+  splicetest();
+
   uio();
 
   exectest();
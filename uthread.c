@@ -0,0 +1,153 @@
+// Threads, built on clone() and join(), and locks for them.
+//
+// thread_create gives each thread a one-page stack from malloc;
+// thread_join frees it again. A thread that returns from fn exits.
+
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+#include "param.h"
+#include "futex.h"
+
+#define STACKSIZE 4096  // clone() takes a one-page stack
+
+static void
+threadstart(void *fn, void *arg)
+{
+  ((void(*)(void*))fn)(arg);
+  exit();
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  void *stack;
+  int pid;
+
+  if((stack = malloc(STACKSIZE)) == 0)
+    return -1;
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    free(stack);
+  return pid;
+}
+
+// Wait for one of this process's threads to exit.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    free(stack);
+  return pid;
+}
+
+// Spin locks, for threads.
+
+void
+lock_init(lock_t *lk)
+{
+  lk->locked = 0;
+}
+
+void
+lock_acquire(lock_t *lk)
+{
+  while(xchg(&lk->locked, 1) != 0)
+    ;
+}
+
+void
+lock_release(lock_t *lk)
+{
+  xchg(&lk->locked, 0);
+}
+
+// Mutexes and condition variables, built on futex().
+//
+// A mutex's state is 0 when free, 1 when held, and 2 when held
+// with possible sleepers (after Drepper, "Futexes Are Tricky").
+// Taking a free mutex or releasing one no one waits for is a
+// single atomic instruction, with no system call.
+
+void
+mutex_init(mutex_t *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(mutex_t *m)
+{
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    return;
+  // Contended: mark it as having sleepers, then sleep
+  // until a release finds it free.
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex(&m->state, FUTEX_WAIT, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+// Take m if it is free. Returns 0 if it was taken, -1 if not.
+int
+mutex_trylock(mutex_t *m)
+{
+  return __sync_val_compare_and_swap(&m->state, 0, 1) == 0 ? 0 : -1;
+}
+
+void
+mutex_unlock(mutex_t *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+
+// A condition variable is a sequence number that every signal
+// bumps, so a waiter that read it before releasing the mutex
+// does not sleep through a signal sent in between. Signals
+// skip the system call when nwait says no one is waiting.
+
+void
+cond_init(cond_t *cv)
+{
+  cv->seq = 0;
+  cv->nwait = 0;
+}
+
+void
+cond_wait(cond_t *cv, mutex_t *m)
+{
+  uint seq;
+
+  __sync_fetch_and_add(&cv->nwait, 1);
+  seq = cv->seq;
+  mutex_unlock(m);
+  futex(&cv->seq, FUTEX_WAIT, seq);
+  __sync_fetch_and_sub(&cv->nwait, 1);
+  // Others may be sleeping on m too, so take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    futex(&m->state, FUTEX_WAIT, 2);
+}
+
+void
+cond_signal(cond_t *cv)
+{
+  __sync_fetch_and_add(&cv->seq, 1);
+  if(cv->nwait)
+    futex(&cv->seq, FUTEX_WAKE, 1);
+}
+
+void
+cond_broadcast(cond_t *cv)
+{
+  __sync_fetch_and_add(&cv->seq, 1);
+  if(cv->nwait)
+    futex(&cv->seq, FUTEX_WAKE, NPROC);
+}
@@ -6,9 +6,17 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "stat.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "mman.h"
+#include "trace.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+static struct spinlock vmalock;  // see "Memory-mapped files"
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -142,6 +150,7 @@ kvmalloc(void)
 {
   kpgdir = setupkvm();
   switchkvm();
+  initlock(&vmalock, "vma");
 }
 
 // Switch h/w page table register to the kernel-only page table,
@@ -160,8 +169,6 @@ switchuvm(struct proc *p)
     panic("switchuvm: no process");
   if(p->kstack == 0)
     panic("switchuvm: no kstack");
-  if(p->pgdir == 0)
-    panic("switchuvm: no pgdir");
 
   pushcli();
   mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
@@ -173,7 +180,8 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  // A kernel thread has no address space of its own.
+  lcr3(V2P(p->pgdir ? p->pgdir : kpgdir));
   popcli();
 }
 
@@ -224,7 +232,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  if(newsz >= KERNBASE)
+  if(newsz > MMAPBASE)
     return 0;
   if(newsz < oldsz)
     return oldsz;
@@ -267,6 +275,8 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
     else if((*pte & PTE_P) != 0){
+      if(*pte & (PTE_PC|PTE_SHM))
+        panic("deallocuvm: mapped page");
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -346,6 +356,8 @@ bad:
 
 //PAGEBREAK!
 // Map user virtual address to kernel address.
+// Read-only pages, such as shared pages of mmap()ed
+// files, have no kernel address to write through.
 char*
 uva2ka(pde_t *pgdir, char *uva)
 {
@@ -356,18 +368,33 @@ uva2ka(pde_t *pgdir, char *uva)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if((*pte & PTE_W) == 0)
+    return 0;
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
 // Copy len bytes from p to user address va in page table pgdir.
-// Most useful when pgdir is not the current page table.
-// uva2ka ensures this only works for PTE_U pages.
+// Most useful when pgdir is not the current page table,
+// but quicker when it is.
+// uva2ka ensures this only works for writable PTE_U pages.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
 
+  // The current page table maps va directly: check that every
+  // page is writable, then copy the whole range in one memmove.
+  if(len > 0 && myproc() && pgdir == myproc()->pgdir){
+    if(va + len < va)
+      return -1;
+    for(va0 = PGROUNDDOWN(va); va0 < va + len; va0 += PGSIZE)
+      if(uva2ka(pgdir, (char*)va0) == 0)
+        return -1;
+    memmove((char*)va, p, len);
+    return 0;
+  }
+
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
@@ -385,6 +412,504 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+// Add n, which may be negative, to the count of user pages
+// resident in p's address space. The count is kept by the
+// leader, since threads share it, and changed atomically, since
+// they may fault and grow at once under different locks.
+void
+addpages(struct proc *p, int n)
+{
+  __sync_fetch_and_add(&p->leader->npages, n);
+}
+
+//PAGEBREAK!
+// Memory-mapped files.
+//
+// mmap() only records a region above MMAPBASE in a free slot
+// of p->vmas[]; pages are mapped when the process first touches
+// them, by vmfault(). A read maps the page-cache page holding
+// that part of the file, read-only and marked PTE_PC so that
+// unmapping hands it back to the page cache instead of freeing
+// it. A write to a private mapping instead gives the process its
+// own copy of the page. Shared mappings are read-only. If every
+// page cache page is already mapped, the process is given its own
+// copy of the page read straight from the file instead.
+//
+// shmat() instead maps all the pages of a shared memory segment
+// (see shm.c) at once, writable and marked PTE_SHM; they belong
+// to the segment, which the region holds a reference to, and
+// are never faulted in, copied or freed here.
+//
+// Threads share their leader's vmas[] as well as its pgdir, so
+// vmalock guards every process's regions. It is a spinlock, so
+// files are read and closed only after letting go of it.
+
+// Return the region of p's address space containing va, or 0.
+// Caller must hold vmalock.
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  p = p->leader;
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if((v->f || v->shm) && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Return an unused slot in p->vmas[], or 0.
+// Caller must hold vmalock.
+static struct vma*
+freevma(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->f == 0 && v->shm == 0)
+      return v;
+  return 0;
+}
+
+// Return the lowest address above MMAPBASE with len free bytes
+// in p's address space, or 0 if there is no such gap.
+// Caller must hold vmalock.
+static uint
+findgap(struct proc *p, uint len)
+{
+  struct vma *v;
+  uint start;
+  int moved;
+
+  start = MMAPBASE;
+  do {
+    moved = 0;
+    for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+      if((v->f || v->shm) && start < v->end && start + len > v->start){
+        start = v->end;
+        moved = 1;
+      }
+    }
+  } while(moved);
+  if(start + len > KERNBASE)
+    return 0;
+  return start;
+}
+
+// Remove the pages of [start, end) from pgdir, handing
+// cached pages back to the page cache and freeing copies.
+// Shared memory pages are left to their segment.
+// Returns the number of copies freed.
+static int
+unmapvma(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+  char *v;
+  int n;
+
+  n = 0;
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) != 0){
+      v = P2V(PTE_ADDR(*pte));
+      if(*pte & PTE_PC)
+        pcacheput(v);
+      else if((*pte & PTE_SHM) == 0){
+        kfree(v);
+        n++;
+      }
+      *pte = 0;
+    }
+  }
+  return n;
+}
+
+// Map len bytes of file f, starting at offset off, into the
+// current process at an address of the kernel's choosing.
+// Returns that address, or -1.
+int
+mmap(struct file *f, uint off, uint len, int prot, int flags)
+{
+  struct proc *curproc = myproc()->leader;
+  struct vma *v;
+  uint start;
+
+  if(f->type != FD_INODE || f->ip->type != T_FILE || !f->readable)
+    return -1;
+  if(flags != MAP_SHARED && flags != MAP_PRIVATE)
+    return -1;
+  if(flags == MAP_SHARED && (prot & PROT_WRITE))
+    return -1;
+  if(len == 0 || len > KERNBASE - MMAPBASE || off % PGSIZE != 0)
+    return -1;
+  len = PGROUNDUP(len);
+
+  acquire(&vmalock);
+  if((v = freevma(curproc)) == 0 || (start = findgap(curproc, len)) == 0){
+    release(&vmalock);
+    return -1;
+  }
+  v->start = start;
+  v->end = start + len;
+  v->prot = prot;
+  v->flags = flags;
+  v->off = off;
+  v->f = filedup(f);
+  release(&vmalock);
+  return start;
+}
+
+// Map the first size bytes of the shared memory segment named
+// key, creating it if need be, into the current process at an
+// address of the kernel's choosing. Returns that address, or -1.
+int
+shmat(int key, uint size)
+{
+  struct proc *curproc = myproc()->leader;
+  struct shmseg *s;
+  struct vma *v;
+  uint a, start, len;
+
+  if(size == 0 || size > SHMMAXPAGES*PGSIZE)
+    return -1;
+  len = PGROUNDUP(size);
+  if((s = shmget(key, len / PGSIZE)) == 0)
+    return -1;
+
+  acquire(&vmalock);
+  if((v = freevma(curproc)) == 0 || (start = findgap(curproc, len)) == 0)
+    goto bad;
+  for(a = 0; a < len; a += PGSIZE){
+    if(mappages(curproc->pgdir, (char*)start + a, PGSIZE,
+                V2P(shmpage(s, a / PGSIZE)), PTE_W|PTE_U|PTE_SHM) < 0){
+      unmapvma(curproc->pgdir, start, start + a);
+      goto bad;
+    }
+  }
+  v->start = start;
+  v->end = start + len;
+  v->prot = PROT_READ|PROT_WRITE;
+  v->flags = MAP_SHARED;
+  v->off = 0;
+  v->shm = s;
+  release(&vmalock);
+  return start;
+
+bad:
+  release(&vmalock);
+  shmput(s);
+  return -1;
+}
+
+// Detach the shared memory region at addr from the current
+// process, as returned by shmat().
+int
+shmdt(uint addr)
+{
+  struct vma *v;
+  uint len;
+
+  acquire(&vmalock);
+  if((v = findvma(myproc(), addr)) == 0 || v->shm == 0 || v->start != addr){
+    release(&vmalock);
+    return -1;
+  }
+  len = v->end - v->start;
+  release(&vmalock);
+  return munmap(addr, len);
+}
+
+// Unmap [addr, addr+len) from the current process. The range
+// must be a whole region or trim one from either end.
+// Fails while the process has other threads: there is no TLB
+// shootdown, so they could go on using the freed pages.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  struct file *f;
+  struct shmseg *s;
+  uint end;
+
+  if(addr % PGSIZE != 0 || len == 0 || len > KERNBASE - MMAPBASE)
+    return -1;
+  if(threadcount(curproc) > 0)
+    return -1;
+  end = addr + PGROUNDUP(len);
+  acquire(&vmalock);
+  if((v = findvma(curproc, addr)) == 0 || end > v->end ||
+     (addr != v->start && end != v->end)){
+    release(&vmalock);
+    return -1;
+  }
+
+  addpages(curproc, -unmapvma(curproc->pgdir, addr, end));
+  lcr3(V2P(curproc->pgdir));
+  f = 0;
+  s = 0;
+  if(addr == v->start && end == v->end){
+    f = v->f;
+    s = v->shm;
+    v->f = 0;
+    v->shm = 0;
+  } else if(addr == v->start){
+    v->off += end - v->start;
+    v->start = end;
+  } else
+    v->end = addr;
+  release(&vmalock);
+  if(f)
+    fileclose(f);
+  if(s)
+    shmput(s);
+  return 0;
+}
+
+// Read page pgno of file ip into a new page of its own, for
+// when every page cache page is mapped. Returns 0 if out of memory.
+static char*
+readpage(struct inode *ip, uint pgno)
+{
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  memset(mem, 0, PGSIZE);
+  ilock(ip);
+  readi(ip, mem, pgno*PGSIZE, PGSIZE);
+  iunlock(ip);
+  return mem;
+}
+
+// Drop page pg got by vmfault(): a page cache page, or a page
+// from readpage() if priv is set.
+static void
+putpage(char *pg, int priv)
+{
+  if(pg == 0)
+    return;
+  if(priv)
+    kfree(pg);
+  else
+    pcacheput(pg);
+}
+
+// Handle a page fault at va in the current process: map the
+// file page there, or, if write is set, give the process its own
+// copy of it. If the page cache is full, the process gets its own
+// copy even for a read; for a shared mapping it then no longer
+// sees later writes to that page of the file.
+// Returns 0 on success, or -1 if va is not in a mapped region,
+// the region does not allow the access, or memory runs out.
+int
+vmfault(uint va, int write)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  struct file *f, *nf;
+  pte_t *pte;
+  char *pg, *mem;
+  uint a, pgno;
+  int r, priv;
+
+  ktrace(TE_PGFAULT, va, write);
+  a = PGROUNDDOWN(va);
+  f = 0;
+  pg = 0;
+  priv = 0;
+  pgno = 0;
+  r = -1;
+  acquire(&vmalock);
+  for(;;){
+    if((v = findvma(curproc, va)) == 0)
+      goto out;
+    if(write && (v->prot & PROT_WRITE) == 0)
+      goto out;
+    if((pte = walkpgdir(curproc->pgdir, (char*)a, 1)) == 0)
+      goto out;
+    if((*pte & PTE_P) && (!write || (*pte & PTE_W))){
+      r = 0;  // already mapped, maybe by another thread
+      goto out;
+    }
+    if(v->shm)
+      goto out;  // its pages were all mapped by shmat()
+    if(*pte & PTE_P){
+      if((*pte & PTE_PC) == 0){
+        // A read-only copy from readpage(), already the
+        // process's own; it can simply be made writable.
+        *pte |= PTE_W;
+        lcr3(V2P(curproc->pgdir));
+        r = 0;
+        goto out;
+      }
+      // The page-cache page mapped here; write needs a copy.
+      putpage(pg, priv);
+      pg = P2V(PTE_ADDR(*pte));
+      priv = 0;
+      break;
+    }
+    if(pg && v->f == f && (v->off + a - v->start) / PGSIZE == pgno)
+      break;  // the page read below is still the right one
+
+    // Read the page from the file without holding vmalock.
+    putpage(pg, priv);
+    nf = filedup(v->f);
+    pgno = (v->off + a - v->start) / PGSIZE;
+    release(&vmalock);
+    if(f)
+      fileclose(f);
+    f = nf;
+    priv = 0;
+    if((pg = pcacheget(f->ip, pgno)) == 0 &&
+       (pg = readpage(f->ip, pgno)) != 0)
+      priv = 1;
+    acquire(&vmalock);
+    if(pg == 0)
+      goto out;
+  }
+
+  if(priv){
+    // Already a copy; map it as it is.
+    *pte = V2P(pg) | PTE_P | PTE_U | (write ? PTE_W : 0);
+    addpages(curproc, 1);
+  } else if(write){
+    // Copy on write.
+    if((mem = kalloc()) == 0){
+      if((*pte & PTE_P) == 0)
+        pcacheput(pg);
+      pg = 0;
+      goto out;
+    }
+    memmove(mem, pg, PGSIZE);
+    pcacheput(pg);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    addpages(curproc, 1);
+  } else
+    *pte = V2P(pg) | PTE_P | PTE_U | PTE_PC;
+  pg = 0;
+  lcr3(V2P(curproc->pgdir));
+  r = 0;
+
+out:
+  putpage(pg, priv);
+  release(&vmalock);
+  if(f)
+    fileclose(f);
+  return r;
+}
+
+// Check that the kernel may read (or, if write is set, write)
+// [va, va+len) on behalf of the current process. Pages of mapped
+// files in the range are faulted in now, because the kernel
+// must not take a page fault on user memory.
+int
+uvmcheck(uint va, uint len, int write)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint a;
+
+  if(va < curproc->sz && va + len <= curproc->sz && va + len >= va)
+    return 0;
+  acquire(&vmalock);
+  v = findvma(curproc, va);
+  release(&vmalock);
+  if(v == 0 || va + len < va)
+    return -1;
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE)
+    if(vmfault(a, write) < 0)
+      return -1;
+  return 0;
+}
+
+// Give np a copy of p's mapped regions, for fork().
+// Page cache and shared memory pages are shared; private
+// copies are copied.
+// Returns 0 on success, -1 if out of memory, in which case
+// the caller cleans up with vmfree(np).
+int
+vmcopy(struct proc *np, struct proc *p)
+{
+  struct vma *v, *nv;
+  pte_t *pte;
+  uint a;
+  char *pg, *mem;
+  int r;
+
+  r = -1;
+  acquire(&vmalock);
+  for(v = p->leader->vmas, nv = np->vmas; v < &p->leader->vmas[NVMA]; v++, nv++){
+    if(v->f == 0 && v->shm == 0)
+      continue;
+    *nv = *v;
+    if(v->f)
+      filedup(v->f);
+    else
+      shmdup(v->shm);
+    for(a = v->start; a < v->end; a += PGSIZE){
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+      if(pte == 0 || (*pte & PTE_P) == 0)
+        continue;
+      pg = P2V(PTE_ADDR(*pte));
+      if(*pte & PTE_PC){
+        if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(pg), PTE_U|PTE_PC) < 0)
+          goto out;
+        pcachedup(pg);
+      } else if(*pte & PTE_SHM){
+        if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(pg), PTE_W|PTE_U|PTE_SHM) < 0)
+          goto out;
+      } else {
+        if((mem = kalloc()) == 0)
+          goto out;
+        memmove(mem, pg, PGSIZE);
+        if(mappages(np->pgdir, (char*)a, PGSIZE, V2P(mem), (*pte & PTE_W)|PTE_U) < 0){
+          kfree(mem);
+          goto out;
+        }
+        addpages(np, 1);
+      }
+    }
+  }
+  r = 0;
+out:
+  release(&vmalock);
+  return r;
+}
+
+// Unmap all of p's regions, for exit() and exec().
+// A thread's regions are its leader's, and stay.
+void
+vmfree(struct proc *p)
+{
+  struct vma *v;
+  struct file *f;
+  struct shmseg *s;
+
+  if(p->leader != p)
+    return;
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+    acquire(&vmalock);
+    f = v->f;
+    s = v->shm;
+    if(f || s){
+      addpages(p, -unmapvma(p->pgdir, v->start, v->end));
+      v->f = 0;
+      v->shm = 0;
+    }
+    release(&vmalock);
+    if(f)
+      fileclose(f);
+    if(s)
+      shmput(s);
+  }
+  if(p == myproc() && p->pgdir)
+    lcr3(V2P(p->pgdir));
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
@@ -0,0 +1,14 @@
+// Scheduling latency: how long processes wait between becoming
+// RUNNABLE and being picked to run. Returned per process by
+// getwaitstat() and per scheduling policy by getschedwait().
+// Both the kernel and user programs use this header file.
+
+#define NWAITHIST 32     // latency histogram buckets
+#define NSCHEDPOLICY 3   // SCHED_RR, SCHED_PBS, SCHED_MLFQ
+
+struct waitstat {
+  uint nwait;             // Times a RUNNABLE process was picked to run
+  uint cycles;            // Total wait, in units of 1024 cycles
+  uint maxwait;           // Longest wait, in cycles
+  uint hist[NWAITHIST];   // hist[i] counts waits of 2^i to 2^(i+1)-1 cycles
+};
@@ -0,0 +1,1890 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 df 00 00 00       	call   120 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 42 04 00 00       	call   48b <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 46 04 00 00       	call   4a3 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 83 0c 00 00       	push   $0xc83
+  6e:	6a 01                	push   $0x1
+  70:	e8 8b 06 00 00       	call   700 <printf>
+      exit();
+  75:	e8 e9 03 00 00       	call   463 <exit>
+  }
+  exit();
+  7a:	e8 e4 03 00 00       	call   463 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 75 0c 00 00       	push   $0xc75
+  86:	6a 00                	push   $0x0
+  88:	e8 93 00 00 00       	call   120 <wc>
+    exit();
+  8d:	e8 d1 03 00 00       	call   463 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <count>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	56                   	push   %esi
+  a4:	53                   	push   %ebx
+  a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  ab:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+  for(i=0; i<n; i++){
+  ae:	85 c0                	test   %eax,%eax
+  b0:	7f 17                	jg     c9 <count+0x29>
+  b2:	eb 63                	jmp    117 <count+0x77>
+  b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      inword = 0;
+  b8:	c7 05 20 11 00 00 00 	movl   $0x0,0x1120
+  bf:	00 00 00 
+  for(i=0; i<n; i++){
+  c2:	83 c6 01             	add    $0x1,%esi
+  c5:	39 de                	cmp    %ebx,%esi
+  c7:	74 4e                	je     117 <count+0x77>
+    c++;
+  c9:	83 05 24 11 00 00 01 	addl   $0x1,0x1124
+    if(p[i] == '\n')
+  d0:	0f be 06             	movsbl (%esi),%eax
+  d3:	3c 0a                	cmp    $0xa,%al
+  d5:	75 0a                	jne    e1 <count+0x41>
+      l++;
+  d7:	83 05 2c 11 00 00 01 	addl   $0x1,0x112c
+    if(strchr(" \r\t\n\v", p[i]))
+  de:	0f be 06             	movsbl (%esi),%eax
+  e1:	83 ec 08             	sub    $0x8,%esp
+  e4:	50                   	push   %eax
+  e5:	68 60 0c 00 00       	push   $0xc60
+  ea:	e8 11 02 00 00       	call   300 <strchr>
+  ef:	83 c4 10             	add    $0x10,%esp
+  f2:	85 c0                	test   %eax,%eax
+  f4:	75 c2                	jne    b8 <count+0x18>
+    else if(!inword){
+  f6:	a1 20 11 00 00       	mov    0x1120,%eax
+  fb:	85 c0                	test   %eax,%eax
+  fd:	75 c3                	jne    c2 <count+0x22>
+  for(i=0; i<n; i++){
+  ff:	83 c6 01             	add    $0x1,%esi
+      w++;
+ 102:	83 05 28 11 00 00 01 	addl   $0x1,0x1128
+      inword = 1;
+ 109:	c7 05 20 11 00 00 01 	movl   $0x1,0x1120
+ 110:	00 00 00 
+  for(i=0; i<n; i++){
+ 113:	39 de                	cmp    %ebx,%esi
+ 115:	75 b2                	jne    c9 <count+0x29>
+}
+ 117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 11a:	5b                   	pop    %ebx
+ 11b:	5e                   	pop    %esi
+ 11c:	5d                   	pop    %ebp
+ 11d:	c3                   	ret
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <wc>:
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	56                   	push   %esi
+ 124:	53                   	push   %ebx
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+ 125:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+ 128:	83 ec 28             	sub    $0x28,%esp
+ 12b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  l = w = c = 0;
+ 12e:	c7 05 24 11 00 00 00 	movl   $0x0,0x1124
+ 135:	00 00 00 
+ 138:	c7 05 28 11 00 00 00 	movl   $0x0,0x1128
+ 13f:	00 00 00 
+ 142:	c7 05 2c 11 00 00 00 	movl   $0x0,0x112c
+ 149:	00 00 00 
+  inword = 0;
+ 14c:	c7 05 20 11 00 00 00 	movl   $0x0,0x1120
+ 153:	00 00 00 
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+ 156:	50                   	push   %eax
+ 157:	53                   	push   %ebx
+ 158:	e8 5e 03 00 00       	call   4bb <fstat>
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	85 c0                	test   %eax,%eax
+ 162:	75 5d                	jne    1c1 <wc+0xa1>
+ 164:	66 83 7d e4 02       	cmpw   $0x2,-0x1c(%ebp)
+ 169:	75 56                	jne    1c1 <wc+0xa1>
+ 16b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16e:	85 c0                	test   %eax,%eax
+ 170:	74 4f                	je     1c1 <wc+0xa1>
+     (a = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != MAP_FAILED){
+ 172:	83 ec 08             	sub    $0x8,%esp
+ 175:	6a 00                	push   $0x0
+ 177:	53                   	push   %ebx
+ 178:	6a 01                	push   $0x1
+ 17a:	6a 01                	push   $0x1
+ 17c:	50                   	push   %eax
+ 17d:	6a 00                	push   $0x0
+ 17f:	e8 27 04 00 00       	call   5ab <mmap>
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+ 184:	83 c4 20             	add    $0x20,%esp
+     (a = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != MAP_FAILED){
+ 187:	89 c6                	mov    %eax,%esi
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+ 189:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 18c:	74 33                	je     1c1 <wc+0xa1>
+    count(a, st.size);
+ 18e:	83 ec 08             	sub    $0x8,%esp
+ 191:	ff 75 f4             	push   -0xc(%ebp)
+ 194:	50                   	push   %eax
+ 195:	e8 06 ff ff ff       	call   a0 <count>
+    munmap(a, st.size);
+ 19a:	5a                   	pop    %edx
+ 19b:	59                   	pop    %ecx
+ 19c:	ff 75 f4             	push   -0xc(%ebp)
+ 19f:	56                   	push   %esi
+ 1a0:	e8 0e 04 00 00       	call   5b3 <munmap>
+ 1a5:	83 c4 10             	add    $0x10,%esp
+ 1a8:	eb 33                	jmp    1dd <wc+0xbd>
+ 1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      count(buf, n);
+ 1b0:	83 ec 08             	sub    $0x8,%esp
+ 1b3:	50                   	push   %eax
+ 1b4:	68 40 11 00 00       	push   $0x1140
+ 1b9:	e8 e2 fe ff ff       	call   a0 <count>
+ 1be:	83 c4 10             	add    $0x10,%esp
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	68 00 02 00 00       	push   $0x200
+ 1c9:	68 40 11 00 00       	push   $0x1140
+ 1ce:	53                   	push   %ebx
+ 1cf:	e8 a7 02 00 00       	call   47b <read>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+ 1d7:	85 c0                	test   %eax,%eax
+ 1d9:	7f d5                	jg     1b0 <wc+0x90>
+    if(n < 0){
+ 1db:	75 2e                	jne    20b <wc+0xeb>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 1dd:	83 ec 08             	sub    $0x8,%esp
+ 1e0:	ff 75 0c             	push   0xc(%ebp)
+ 1e3:	ff 35 24 11 00 00    	push   0x1124
+ 1e9:	ff 35 28 11 00 00    	push   0x1128
+ 1ef:	ff 35 2c 11 00 00    	push   0x112c
+ 1f5:	68 76 0c 00 00       	push   $0xc76
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	e8 ff 04 00 00       	call   700 <printf>
+}
+ 201:	83 c4 20             	add    $0x20,%esp
+ 204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 207:	5b                   	pop    %ebx
+ 208:	5e                   	pop    %esi
+ 209:	5d                   	pop    %ebp
+ 20a:	c3                   	ret
+      printf(1, "wc: read error\n");
+ 20b:	50                   	push   %eax
+ 20c:	50                   	push   %eax
+ 20d:	68 66 0c 00 00       	push   $0xc66
+ 212:	6a 01                	push   $0x1
+ 214:	e8 e7 04 00 00       	call   700 <printf>
+      exit();
+ 219:	e8 45 02 00 00       	call   463 <exit>
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 221:	31 c0                	xor    %eax,%eax
+{
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 237:	83 c0 01             	add    $0x1,%eax
+ 23a:	84 d2                	test   %dl,%dl
+ 23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	89 c8                	mov    %ecx,%eax
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+ 245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 25a:	0f b6 02             	movzbl (%edx),%eax
+ 25d:	84 c0                	test   %al,%al
+ 25f:	75 17                	jne    278 <strcmp+0x28>
+ 261:	eb 3a                	jmp    29d <strcmp+0x4d>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 272:	84 c0                	test   %al,%al
+ 274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+ 276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 278:	0f b6 19             	movzbl (%ecx),%ebx
+ 27b:	38 c3                	cmp    %al,%bl
+ 27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 27f:	29 d8                	sub    %ebx,%eax
+}
+ 281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	29 d8                	sub    %ebx,%eax
+}
+ 298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 29d:	0f b6 19             	movzbl (%ecx),%ebx
+ 2a0:	31 c0                	xor    %eax,%eax
+ 2a2:	eb db                	jmp    27f <strcmp+0x2f>
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2b9:	74 15                	je     2d0 <strlen+0x20>
+ 2bb:	31 c0                	xor    %eax,%eax
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2c7:	89 c1                	mov    %eax,%ecx
+ 2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2cb:	89 c8                	mov    %ecx,%eax
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+ 2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2d0:	31 c9                	xor    %ecx,%ecx
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	89 c8                	mov    %ecx,%eax
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ed:	89 d7                	mov    %edx,%edi
+ 2ef:	fc                   	cld
+ 2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 30a:	0f b6 10             	movzbl (%eax),%edx
+ 30d:	84 d2                	test   %dl,%dl
+ 30f:	75 12                	jne    323 <strchr+0x23>
+ 311:	eb 1d                	jmp    330 <strchr+0x30>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+ 323:	38 d1                	cmp    %dl,%cl
+ 325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 330:	31 c0                	xor    %eax,%eax
+}
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 349:	31 db                	xor    %ebx,%ebx
+{
+ 34b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 34e:	eb 27                	jmp    377 <gets+0x37>
+    cc = read(0, &c, 1);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	6a 01                	push   $0x1
+ 355:	56                   	push   %esi
+ 356:	6a 00                	push   $0x0
+ 358:	e8 1e 01 00 00       	call   47b <read>
+    if(cc < 1)
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	7e 1d                	jle    381 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 36f:	3c 0a                	cmp    $0xa,%al
+ 371:	74 10                	je     383 <gets+0x43>
+ 373:	3c 0d                	cmp    $0xd,%al
+ 375:	74 0c                	je     383 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 377:	89 df                	mov    %ebx,%edi
+ 379:	83 c3 01             	add    $0x1,%ebx
+ 37c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 37f:	7c cf                	jl     350 <gets+0x10>
+ 381:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 38a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5f                   	pop    %edi
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+ 392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	6a 00                	push   $0x0
+ 3aa:	ff 75 08             	push   0x8(%ebp)
+ 3ad:	e8 f1 00 00 00       	call   4a3 <open>
+  if(fd < 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	78 27                	js     3e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	89 c3                	mov    %eax,%ebx
+ 3c1:	50                   	push   %eax
+ 3c2:	e8 f4 00 00 00       	call   4bb <fstat>
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3cc:	e8 ba 00 00 00       	call   48b <close>
+  return r;
+ 3d1:	83 c4 10             	add    $0x10,%esp
+}
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	89 f0                	mov    %esi,%eax
+ 3d9:	5b                   	pop    %ebx
+ 3da:	5e                   	pop    %esi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e5:	eb ed                	jmp    3d4 <stat+0x34>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3f7:	0f be 02             	movsbl (%edx),%eax
+ 3fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 405:	77 1e                	ja     425 <atoi+0x35>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 410:	83 c2 01             	add    $0x1,%edx
+ 413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 41a:	0f be 02             	movsbl (%edx),%eax
+ 41d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 420:	80 fb 09             	cmp    $0x9,%bl
+ 423:	76 eb                	jbe    410 <atoi+0x20>
+  return n;
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	89 c8                	mov    %ecx,%eax
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+
+0000045b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 45b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <exit>:
+SYSCALL(exit)
+ 463:	b8 02 00 00 00       	mov    $0x2,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <wait>:
+SYSCALL(wait)
+ 46b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <pipe>:
+SYSCALL(pipe)
+ 473:	b8 04 00 00 00       	mov    $0x4,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <read>:
+SYSCALL(read)
+ 47b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <write>:
+SYSCALL(write)
+ 483:	b8 10 00 00 00       	mov    $0x10,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <close>:
+SYSCALL(close)
+ 48b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <kill>:
+SYSCALL(kill)
+ 493:	b8 06 00 00 00       	mov    $0x6,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <exec>:
+SYSCALL(exec)
+ 49b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <open>:
+SYSCALL(open)
+ 4a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mknod>:
+SYSCALL(mknod)
+ 4ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <unlink>:
+SYSCALL(unlink)
+ 4b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <fstat>:
+SYSCALL(fstat)
+ 4bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <link>:
+SYSCALL(link)
+ 4c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mkdir>:
+SYSCALL(mkdir)
+ 4cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <chdir>:
+SYSCALL(chdir)
+ 4d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <dup>:
+SYSCALL(dup)
+ 4db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getpid>:
+SYSCALL(getpid)
+ 4e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <sbrk>:
+SYSCALL(sbrk)
+ 4eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sleep>:
+SYSCALL(sleep)
+ 4f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <uptime>:
+SYSCALL(uptime)
+ 4fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 503:	b8 16 00 00 00       	mov    $0x16,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 50b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 513:	b8 18 00 00 00       	mov    $0x18,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 51b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 523:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 52b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 533:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <setpriority>:
+SYSCALL(setpriority)
+ 53b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 543:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getcpustats>:
+SYSCALL(getcpustats)
+ 54b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <setscheduler>:
+SYSCALL(setscheduler)
+ 553:	b8 20 00 00 00       	mov    $0x20,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 55b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getscheduler>:
+SYSCALL(getscheduler)
+ 563:	b8 22 00 00 00       	mov    $0x22,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <splice>:
+SYSCALL(splice)
+ 56b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <readv>:
+SYSCALL(readv)
+ 573:	b8 24 00 00 00       	mov    $0x24,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <writev>:
+SYSCALL(writev)
+ 57b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <pread>:
+SYSCALL(pread)
+ 583:	b8 26 00 00 00       	mov    $0x26,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <pwrite>:
+SYSCALL(pwrite)
+ 58b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getlogstat>:
+SYSCALL(getlogstat)
+ 593:	b8 28 00 00 00       	mov    $0x28,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mount>:
+SYSCALL(mount)
+ 59b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <umount>:
+SYSCALL(umount)
+ 5a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <mmap>:
+SYSCALL(mmap)
+ 5ab:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <munmap>:
+SYSCALL(munmap)
+ 5b3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <membench>:
+SYSCALL(membench)
+ 5bb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getlockstat>:
+SYSCALL(getlockstat)
+ 5c3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <lockbench>:
+SYSCALL(lockbench)
+ 5cb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <prof>:
+SYSCALL(prof)
+ 5d3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <tracectl>:
+SYSCALL(tracectl)
+ 5db:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <traceread>:
+SYSCALL(traceread)
+ 5e3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <getsysstat>:
+SYSCALL(getsysstat)
+ 5eb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 5f3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getschedwait>:
+SYSCALL(getschedwait)
+ 5fb:	b8 35 00 00 00       	mov    $0x35,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <mlfqread>:
+SYSCALL(mlfqread)
+ 603:	b8 36 00 00 00       	mov    $0x36,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <dllock>:
+SYSCALL(dllock)
+ 60b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 613:	b8 38 00 00 00       	mov    $0x38,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 61b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <clone>:
+SYSCALL(clone)
+ 623:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <join>:
+SYSCALL(join)
+ 62b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <futex>:
+SYSCALL(futex)
+ 633:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <shmat>:
+SYSCALL(shmat)
+ 63b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <shmdt>:
+SYSCALL(shmdt)
+ 643:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <poll>:
+SYSCALL(poll)
+ 64b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+ 653:	66 90                	xchg   %ax,%ax
+ 655:	66 90                	xchg   %ax,%ax
+ 657:	66 90                	xchg   %ax,%ax
+ 659:	66 90                	xchg   %ax,%ax
+ 65b:	66 90                	xchg   %ax,%ax
+ 65d:	66 90                	xchg   %ax,%ax
+ 65f:	90                   	nop
+
+00000660 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 668:	89 d1                	mov    %edx,%ecx
+{
+ 66a:	83 ec 3c             	sub    $0x3c,%esp
+ 66d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 670:	85 d2                	test   %edx,%edx
+ 672:	0f 89 80 00 00 00    	jns    6f8 <printint+0x98>
+ 678:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 67c:	74 7a                	je     6f8 <printint+0x98>
+    x = -xx;
+ 67e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 680:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 685:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 688:	31 f6                	xor    %esi,%esi
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 690:	89 c8                	mov    %ecx,%eax
+ 692:	31 d2                	xor    %edx,%edx
+ 694:	89 f7                	mov    %esi,%edi
+ 696:	f7 f3                	div    %ebx
+ 698:	8d 76 01             	lea    0x1(%esi),%esi
+ 69b:	0f b6 92 f8 0c 00 00 	movzbl 0xcf8(%edx),%edx
+ 6a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6a6:	89 ca                	mov    %ecx,%edx
+ 6a8:	89 c1                	mov    %eax,%ecx
+ 6aa:	39 da                	cmp    %ebx,%edx
+ 6ac:	73 e2                	jae    690 <printint+0x30>
+  if(neg)
+ 6ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6b1:	85 c0                	test   %eax,%eax
+ 6b3:	74 07                	je     6bc <printint+0x5c>
+    buf[i++] = '-';
+ 6b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ba:	89 f7                	mov    %esi,%edi
+ 6bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6c2:	01 df                	add    %ebx,%edi
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6d4:	6a 01                	push   $0x1
+ 6d6:	50                   	push   %eax
+ 6d7:	56                   	push   %esi
+ 6d8:	e8 a6 fd ff ff       	call   483 <write>
+  while(--i >= 0)
+ 6dd:	89 f8                	mov    %edi,%eax
+ 6df:	83 c4 10             	add    $0x10,%esp
+ 6e2:	83 ef 01             	sub    $0x1,%edi
+ 6e5:	39 d8                	cmp    %ebx,%eax
+ 6e7:	75 df                	jne    6c8 <printint+0x68>
+}
+ 6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ec:	5b                   	pop    %ebx
+ 6ed:	5e                   	pop    %esi
+ 6ee:	5f                   	pop    %edi
+ 6ef:	5d                   	pop    %ebp
+ 6f0:	c3                   	ret
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6f8:	31 c0                	xor    %eax,%eax
+ 6fa:	eb 89                	jmp    685 <printint+0x25>
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 709:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 70c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 70f:	0f b6 1e             	movzbl (%esi),%ebx
+ 712:	83 c6 01             	add    $0x1,%esi
+ 715:	84 db                	test   %bl,%bl
+ 717:	74 67                	je     780 <printf+0x80>
+ 719:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 71c:	31 d2                	xor    %edx,%edx
+ 71e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 721:	eb 34                	jmp    757 <printf+0x57>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+ 728:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 72b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 730:	83 f8 25             	cmp    $0x25,%eax
+ 733:	74 18                	je     74d <printf+0x4d>
+  write(fd, &c, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 73b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73e:	6a 01                	push   $0x1
+ 740:	50                   	push   %eax
+ 741:	57                   	push   %edi
+ 742:	e8 3c fd ff ff       	call   483 <write>
+ 747:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 74a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 74d:	0f b6 1e             	movzbl (%esi),%ebx
+ 750:	83 c6 01             	add    $0x1,%esi
+ 753:	84 db                	test   %bl,%bl
+ 755:	74 29                	je     780 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 757:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 75a:	85 d2                	test   %edx,%edx
+ 75c:	74 ca                	je     728 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 75e:	83 fa 25             	cmp    $0x25,%edx
+ 761:	75 ea                	jne    74d <printf+0x4d>
+      if(c == 'd'){
+ 763:	83 f8 25             	cmp    $0x25,%eax
+ 766:	0f 84 24 01 00 00    	je     890 <printf+0x190>
+ 76c:	83 e8 63             	sub    $0x63,%eax
+ 76f:	83 f8 15             	cmp    $0x15,%eax
+ 772:	77 1c                	ja     790 <printf+0x90>
+ 774:	ff 24 85 a0 0c 00 00 	jmp    *0xca0(,%eax,4)
+ 77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 783:	5b                   	pop    %ebx
+ 784:	5e                   	pop    %esi
+ 785:	5f                   	pop    %edi
+ 786:	5d                   	pop    %ebp
+ 787:	c3                   	ret
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 796:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 79a:	6a 01                	push   $0x1
+ 79c:	52                   	push   %edx
+ 79d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7a0:	57                   	push   %edi
+ 7a1:	e8 dd fc ff ff       	call   483 <write>
+ 7a6:	83 c4 0c             	add    $0xc,%esp
+ 7a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ac:	6a 01                	push   $0x1
+ 7ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7b1:	52                   	push   %edx
+ 7b2:	57                   	push   %edi
+ 7b3:	e8 cb fc ff ff       	call   483 <write>
+        putc(fd, c);
+ 7b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bb:	31 d2                	xor    %edx,%edx
+ 7bd:	eb 8e                	jmp    74d <printf+0x4d>
+ 7bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 00                	push   $0x0
+ 7cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7d4:	e8 87 fe ff ff       	call   660 <printint>
+        ap++;
+ 7d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 67 ff ff ff       	jmp    74d <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7f5:	83 c0 04             	add    $0x4,%eax
+ 7f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7fb:	85 db                	test   %ebx,%ebx
+ 7fd:	0f 84 9d 00 00 00    	je     8a0 <printf+0x1a0>
+        while(*s != 0){
+ 803:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 806:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 808:	84 c0                	test   %al,%al
+ 80a:	0f 84 3d ff ff ff    	je     74d <printf+0x4d>
+ 810:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 813:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 816:	89 de                	mov    %ebx,%esi
+ 818:	89 d3                	mov    %edx,%ebx
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 826:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	53                   	push   %ebx
+ 82c:	57                   	push   %edi
+ 82d:	e8 51 fc ff ff       	call   483 <write>
+        while(*s != 0){
+ 832:	0f b6 06             	movzbl (%esi),%eax
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	84 c0                	test   %al,%al
+ 83a:	75 e4                	jne    820 <printf+0x120>
+      state = 0;
+ 83c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 07 ff ff ff       	jmp    74d <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 01                	push   $0x1
+ 85f:	e9 6b ff ff ff       	jmp    7cf <printf+0xcf>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 868:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 871:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 873:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 876:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	52                   	push   %edx
+ 87c:	57                   	push   %edi
+ 87d:	e8 01 fc ff ff       	call   483 <write>
+        ap++;
+ 882:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 885:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 888:	31 d2                	xor    %edx,%edx
+ 88a:	e9 be fe ff ff       	jmp    74d <printf+0x4d>
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 896:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 899:	6a 01                	push   $0x1
+ 89b:	e9 11 ff ff ff       	jmp    7b1 <printf+0xb1>
+ 8a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8a5:	bb 97 0c 00 00       	mov    $0xc97,%ebx
+ 8aa:	e9 61 ff ff ff       	jmp    810 <printf+0x110>
+ 8af:	90                   	nop
+
+000008b0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b3:	a1 94 13 00 00       	mov    0x1394,%eax
+{
+ 8b8:	89 e5                	mov    %esp,%ebp
+ 8ba:	56                   	push   %esi
+ 8bb:	53                   	push   %ebx
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c4:	39 ca                	cmp    %ecx,%edx
+ 8c6:	73 30                	jae    8f8 <bigfree+0x48>
+ 8c8:	39 c1                	cmp    %eax,%ecx
+ 8ca:	72 04                	jb     8d0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8cc:	39 c2                	cmp    %eax,%edx
+ 8ce:	72 f0                	jb     8c0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 8d3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 8d6:	39 f0                	cmp    %esi,%eax
+ 8d8:	74 26                	je     900 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8da:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8dc:	8b 42 04             	mov    0x4(%edx),%eax
+ 8df:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8e2:	39 d9                	cmp    %ebx,%ecx
+ 8e4:	74 30                	je     916 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8e6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8e8:	5b                   	pop    %ebx
+  freep = p;
+ 8e9:	89 15 94 13 00 00    	mov    %edx,0x1394
+}
+ 8ef:	5e                   	pop    %esi
+ 8f0:	5d                   	pop    %ebp
+ 8f1:	c3                   	ret
+ 8f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f8:	39 c1                	cmp    %eax,%ecx
+ 8fa:	72 d0                	jb     8cc <bigfree+0x1c>
+ 8fc:	eb c2                	jmp    8c0 <bigfree+0x10>
+ 8fe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 900:	03 58 04             	add    0x4(%eax),%ebx
+ 903:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 906:	8b 02                	mov    (%edx),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 90c:	8b 42 04             	mov    0x4(%edx),%eax
+ 90f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 912:	39 d9                	cmp    %ebx,%ecx
+ 914:	75 d0                	jne    8e6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 916:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 919:	89 15 94 13 00 00    	mov    %edx,0x1394
+    p->s.size += bp->s.size;
+ 91f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 922:	8b 09                	mov    (%ecx),%ecx
+ 924:	89 0a                	mov    %ecx,(%edx)
+}
+ 926:	5b                   	pop    %ebx
+ 927:	5e                   	pop    %esi
+ 928:	5d                   	pop    %ebp
+ 929:	c3                   	ret
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000930 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	89 c7                	mov    %eax,%edi
+ 936:	56                   	push   %esi
+ 937:	53                   	push   %ebx
+ 938:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 93b:	a1 94 13 00 00       	mov    0x1394,%eax
+ 940:	85 c0                	test   %eax,%eax
+ 942:	0f 84 88 00 00 00    	je     9d0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 948:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 94a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 94d:	39 f9                	cmp    %edi,%ecx
+ 94f:	73 5f                	jae    9b0 <bigalloc+0x80>
+  if(nu < 4096)
+ 951:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 956:	39 df                	cmp    %ebx,%edi
+ 958:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 95b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 962:	eb 0d                	jmp    971 <bigalloc+0x41>
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 968:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 96a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 96d:	39 f9                	cmp    %edi,%ecx
+ 96f:	73 3f                	jae    9b0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 971:	89 d0                	mov    %edx,%eax
+ 973:	39 15 94 13 00 00    	cmp    %edx,0x1394
+ 979:	75 ed                	jne    968 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 97b:	83 ec 0c             	sub    $0xc,%esp
+ 97e:	56                   	push   %esi
+ 97f:	e8 67 fb ff ff       	call   4eb <sbrk>
+  if(p == (char*)-1)
+ 984:	83 c4 10             	add    $0x10,%esp
+ 987:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 98a:	74 11                	je     99d <bigalloc+0x6d>
+  hp->s.size = nu;
+ 98c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 98f:	e8 1c ff ff ff       	call   8b0 <bigfree>
+  return freep;
+ 994:	a1 94 13 00 00       	mov    0x1394,%eax
+      if((p = morecore(nunits)) == 0)
+ 999:	85 c0                	test   %eax,%eax
+ 99b:	75 cb                	jne    968 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 99d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9a0:	31 d2                	xor    %edx,%edx
+}
+ 9a2:	5b                   	pop    %ebx
+ 9a3:	89 d0                	mov    %edx,%eax
+ 9a5:	5e                   	pop    %esi
+ 9a6:	5f                   	pop    %edi
+ 9a7:	5d                   	pop    %ebp
+ 9a8:	c3                   	ret
+ 9a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 9b0:	39 cf                	cmp    %ecx,%edi
+ 9b2:	74 4c                	je     a00 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 9b4:	29 f9                	sub    %edi,%ecx
+ 9b6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 9b9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 9bc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 9bf:	a3 94 13 00 00       	mov    %eax,0x1394
+}
+ 9c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9c7:	89 d0                	mov    %edx,%eax
+ 9c9:	5b                   	pop    %ebx
+ 9ca:	5e                   	pop    %esi
+ 9cb:	5f                   	pop    %edi
+ 9cc:	5d                   	pop    %ebp
+ 9cd:	c3                   	ret
+ 9ce:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 9d0:	c7 05 94 13 00 00 98 	movl   $0x1398,0x1394
+ 9d7:	13 00 00 
+    base.s.size = 0;
+ 9da:	ba 98 13 00 00       	mov    $0x1398,%edx
+    base.s.ptr = freep = prevp = &base;
+ 9df:	c7 05 98 13 00 00 98 	movl   $0x1398,0x1398
+ 9e6:	13 00 00 
+    base.s.size = 0;
+ 9e9:	c7 05 9c 13 00 00 00 	movl   $0x0,0x139c
+ 9f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9f3:	e9 59 ff ff ff       	jmp    951 <bigalloc+0x21>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a00:	8b 0a                	mov    (%edx),%ecx
+ a02:	89 08                	mov    %ecx,(%eax)
+ a04:	eb b9                	jmp    9bf <bigalloc+0x8f>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a10 <free>:
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	53                   	push   %ebx
+ a14:	83 ec 04             	sub    $0x4,%esp
+ a17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ a1a:	85 c9                	test   %ecx,%ecx
+ a1c:	74 58                	je     a76 <free+0x66>
+  bp = (Header*)ap - 1;
+ a1e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ a21:	ba 01 00 00 00       	mov    $0x1,%edx
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+ a30:	89 d0                	mov    %edx,%eax
+ a32:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+  while(xchg(&locked, 1) != 0)
+ a39:	85 c0                	test   %eax,%eax
+ a3b:	75 f3                	jne    a30 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ a3d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ a40:	83 fa 40             	cmp    $0x40,%edx
+ a43:	77 3b                	ja     a80 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ a45:	83 fa 02             	cmp    $0x2,%edx
+ a48:	76 3f                	jbe    a89 <free+0x79>
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a50:	83 c0 01             	add    $0x1,%eax
+ a53:	39 14 85 20 0d 00 00 	cmp    %edx,0xd20(,%eax,4)
+ a5a:	72 f4                	jb     a50 <free+0x40>
+    bp->s.ptr = classfree[c];
+ a5c:	8b 14 85 60 13 00 00 	mov    0x1360(,%eax,4),%edx
+    classfree[c] = bp;
+ a63:	89 1c 85 60 13 00 00 	mov    %ebx,0x1360(,%eax,4)
+    bp->s.ptr = classfree[c];
+ a6a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ a6d:	31 c0                	xor    %eax,%eax
+ a6f:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+}
+ a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a79:	c9                   	leave
+ a7a:	c3                   	ret
+ a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a7f:	90                   	nop
+    bigfree(bp);
+ a80:	89 d8                	mov    %ebx,%eax
+ a82:	e8 29 fe ff ff       	call   8b0 <bigfree>
+ a87:	eb e4                	jmp    a6d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ a89:	31 c0                	xor    %eax,%eax
+ a8b:	eb cf                	jmp    a5c <free+0x4c>
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a96:	89 e5                	mov    %esp,%ebp
+ a98:	57                   	push   %edi
+ a99:	56                   	push   %esi
+ a9a:	53                   	push   %ebx
+ a9b:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa1:	8d 50 07             	lea    0x7(%eax),%edx
+ aa4:	c1 ea 03             	shr    $0x3,%edx
+ aa7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ ab0:	89 c8                	mov    %ecx,%eax
+ ab2:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+ ab9:	85 c0                	test   %eax,%eax
+ abb:	75 f3                	jne    ab0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ abd:	89 c3                	mov    %eax,%ebx
+ abf:	83 fa 40             	cmp    $0x40,%edx
+ ac2:	77 4c                	ja     b10 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ ac4:	be 02 00 00 00       	mov    $0x2,%esi
+ ac9:	83 fa 02             	cmp    $0x2,%edx
+ acc:	76 10                	jbe    ade <malloc+0x4e>
+ ace:	66 90                	xchg   %ax,%ax
+ ad0:	83 c3 01             	add    $0x1,%ebx
+ ad3:	8b 34 9d 20 0d 00 00 	mov    0xd20(,%ebx,4),%esi
+ ada:	39 d6                	cmp    %edx,%esi
+ adc:	72 f2                	jb     ad0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ ade:	8b 14 9d 60 13 00 00 	mov    0x1360(,%ebx,4),%edx
+ ae5:	85 d2                	test   %edx,%edx
+ ae7:	74 47                	je     b30 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ ae9:	8b 3a                	mov    (%edx),%edi
+ aeb:	89 3c 9d 60 13 00 00 	mov    %edi,0x1360(,%ebx,4)
+ af2:	31 c0                	xor    %eax,%eax
+ af4:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ afb:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ afe:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ b01:	5b                   	pop    %ebx
+ b02:	5e                   	pop    %esi
+ b03:	5f                   	pop    %edi
+ b04:	5d                   	pop    %ebp
+ b05:	c3                   	ret
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ b10:	89 d0                	mov    %edx,%eax
+ b12:	e8 19 fe ff ff       	call   930 <bigalloc>
+ b17:	89 c2                	mov    %eax,%edx
+ b19:	89 d8                	mov    %ebx,%eax
+ b1b:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+  return p ? (void*)(p + 1) : 0;
+ b22:	85 d2                	test   %edx,%edx
+ b24:	75 d5                	jne    afb <malloc+0x6b>
+ b26:	31 c0                	xor    %eax,%eax
+}
+ b28:	83 c4 1c             	add    $0x1c,%esp
+ b2b:	5b                   	pop    %ebx
+ b2c:	5e                   	pop    %esi
+ b2d:	5f                   	pop    %edi
+ b2e:	5d                   	pop    %ebp
+ b2f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ b30:	b8 00 02 00 00       	mov    $0x200,%eax
+ b35:	e8 f6 fd ff ff       	call   930 <bigalloc>
+ b3a:	85 c0                	test   %eax,%eax
+ b3c:	74 44                	je     b82 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b3e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ b45:	8b 14 9d 60 13 00 00 	mov    0x1360(,%ebx,4),%edx
+ b4c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ b4f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ b52:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ b58:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ b5b:	39 cf                	cmp    %ecx,%edi
+ b5d:	72 8a                	jb     ae9 <malloc+0x59>
+ b5f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ b62:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ b65:	8d 76 00             	lea    0x0(%esi),%esi
+ b68:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ b6a:	89 70 04             	mov    %esi,0x4(%eax)
+ b6d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b6f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ b71:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ b73:	01 d8                	add    %ebx,%eax
+ b75:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ b78:	73 ee                	jae    b68 <malloc+0xd8>
+ b7a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ b7d:	e9 69 ff ff ff       	jmp    aeb <malloc+0x5b>
+ b82:	f0 87 05 40 13 00 00 	lock xchg %eax,0x1340
+  return p ? (void*)(p + 1) : 0;
+ b89:	31 c0                	xor    %eax,%eax
+ b8b:	eb 9b                	jmp    b28 <malloc+0x98>
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b90 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	56                   	push   %esi
+ b94:	53                   	push   %ebx
+ b95:	8b 45 08             	mov    0x8(%ebp),%eax
+ b98:	f7 65 0c             	mull   0xc(%ebp)
+ b9b:	70 33                	jo     bd0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ b9d:	83 ec 0c             	sub    $0xc,%esp
+ ba0:	89 c3                	mov    %eax,%ebx
+ ba2:	50                   	push   %eax
+ ba3:	e8 e8 fe ff ff       	call   a90 <malloc>
+ ba8:	83 c4 10             	add    $0x10,%esp
+ bab:	89 c6                	mov    %eax,%esi
+ bad:	85 c0                	test   %eax,%eax
+ baf:	74 1f                	je     bd0 <calloc+0x40>
+    memset(p, 0, n);
+ bb1:	83 ec 04             	sub    $0x4,%esp
+ bb4:	53                   	push   %ebx
+ bb5:	6a 00                	push   $0x0
+ bb7:	50                   	push   %eax
+ bb8:	e8 23 f7 ff ff       	call   2e0 <memset>
+ bbd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ bc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bc3:	89 f0                	mov    %esi,%eax
+ bc5:	5b                   	pop    %ebx
+ bc6:	5e                   	pop    %esi
+ bc7:	5d                   	pop    %ebp
+ bc8:	c3                   	ret
+ bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ bd3:	31 f6                	xor    %esi,%esi
+}
+ bd5:	89 f0                	mov    %esi,%eax
+ bd7:	5b                   	pop    %ebx
+ bd8:	5e                   	pop    %esi
+ bd9:	5d                   	pop    %ebp
+ bda:	c3                   	ret
+ bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+
+00000be0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+ be9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ bef:	85 db                	test   %ebx,%ebx
+ bf1:	74 55                	je     c48 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ bf3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ bf6:	89 de                	mov    %ebx,%esi
+ bf8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ bff:	39 c7                	cmp    %eax,%edi
+ c01:	72 0d                	jb     c10 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c06:	89 f0                	mov    %esi,%eax
+ c08:	5b                   	pop    %ebx
+ c09:	5e                   	pop    %esi
+ c0a:	5f                   	pop    %edi
+ c0b:	5d                   	pop    %ebp
+ c0c:	c3                   	ret
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ c10:	83 ec 0c             	sub    $0xc,%esp
+ c13:	50                   	push   %eax
+ c14:	e8 77 fe ff ff       	call   a90 <malloc>
+ c19:	83 c4 10             	add    $0x10,%esp
+ c1c:	89 c6                	mov    %eax,%esi
+ c1e:	85 c0                	test   %eax,%eax
+ c20:	74 e1                	je     c03 <realloc+0x23>
+  memmove(p, ap, have);
+ c22:	83 ec 04             	sub    $0x4,%esp
+ c25:	57                   	push   %edi
+ c26:	53                   	push   %ebx
+ c27:	50                   	push   %eax
+ c28:	e8 03 f8 ff ff       	call   430 <memmove>
+  free(ap);
+ c2d:	89 1c 24             	mov    %ebx,(%esp)
+ c30:	e8 db fd ff ff       	call   a10 <free>
+  return p;
+ c35:	83 c4 10             	add    $0x10,%esp
+}
+ c38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c3b:	89 f0                	mov    %esi,%eax
+ c3d:	5b                   	pop    %ebx
+ c3e:	5e                   	pop    %esi
+ c3f:	5f                   	pop    %edi
+ c40:	5d                   	pop    %ebp
+ c41:	c3                   	ret
+ c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ c48:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c4e:	5b                   	pop    %ebx
+ c4f:	5e                   	pop    %esi
+ c50:	5f                   	pop    %edi
+ c51:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c52:	e9 39 fe ff ff       	jmp    a90 <malloc>
@@ -57,6 +57,15 @@ stosl(void *addr, int data, int cnt)
                "memory", "cc");
 }
 
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+
 struct segdesc;
 
 static inline void
@@ -105,6 +114,13 @@ loadgs(ushort v)
   asm volatile("movw %0, %%gs" : : "r" (v));
 }
 
+// Tell the CPU that this is a spin-wait loop.
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+}
+
 static inline void
 cli(void)
 {
@@ -144,6 +160,55 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr4(void)
+{
+  uint val;
+  asm volatile("movl %%cr4,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr4(uint val)
+{
+  asm volatile("movl %0,%%cr4" : : "r" (val));
+}
+
+// Feature flags that CPUID leaf 1 returns in %edx.
+static inline uint
+cpufeatures(void)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+               "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+               "a" (1));
+  return edx;
+}
+
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+  return val;
+}
+
+// Save and restore the FPU and SSE registers.
+// area must be 512 bytes, 16-byte aligned.
+static inline void
+fxsave(void *area)
+{
+  asm volatile("fxsave (%0)" : : "r" (area) : "memory");
+}
+
+static inline void
+fxrstor(void *area)
+{
+  asm volatile("fxrstor (%0)" : : "r" (area) : "memory");
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
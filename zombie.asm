@@ -0,0 +1,1665 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 55 02 00 00       	call   26b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 df 02 00 00       	call   303 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 47 02 00 00       	call   273 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 1e 01 00 00       	call   28b <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 f1 00 00 00       	call   2b3 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 f4 00 00 00       	call   2cb <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 ba 00 00 00       	call   29b <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <exit>:
+SYSCALL(exit)
+ 273:	b8 02 00 00 00       	mov    $0x2,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <wait>:
+SYSCALL(wait)
+ 27b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <pipe>:
+SYSCALL(pipe)
+ 283:	b8 04 00 00 00       	mov    $0x4,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <read>:
+SYSCALL(read)
+ 28b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <write>:
+SYSCALL(write)
+ 293:	b8 10 00 00 00       	mov    $0x10,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <close>:
+SYSCALL(close)
+ 29b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <kill>:
+SYSCALL(kill)
+ 2a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <exec>:
+SYSCALL(exec)
+ 2ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <open>:
+SYSCALL(open)
+ 2b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mknod>:
+SYSCALL(mknod)
+ 2bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <unlink>:
+SYSCALL(unlink)
+ 2c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <fstat>:
+SYSCALL(fstat)
+ 2cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <link>:
+SYSCALL(link)
+ 2d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mkdir>:
+SYSCALL(mkdir)
+ 2db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <chdir>:
+SYSCALL(chdir)
+ 2e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <dup>:
+SYSCALL(dup)
+ 2eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getpid>:
+SYSCALL(getpid)
+ 2f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <sbrk>:
+SYSCALL(sbrk)
+ 2fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <sleep>:
+SYSCALL(sleep)
+ 303:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <uptime>:
+SYSCALL(uptime)
+ 30b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <getsysinfo>:
+SYSCALL(getsysinfo)
+ 313:	b8 16 00 00 00       	mov    $0x16,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <detect_deadlock>:
+SYSCALL(detect_deadlock)
+ 31b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <mlfqstatus>:
+SYSCALL(mlfqstatus)
+ 323:	b8 18 00 00 00       	mov    $0x18,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mlfqstart>:
+SYSCALL(mlfqstart)
+ 32b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <mlfqstop>:
+SYSCALL(mlfqstop)
+ 333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mlfqvisual>:
+SYSCALL(mlfqvisual)
+ 33b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <mlfqrealtime>:
+SYSCALL(mlfqrealtime)
+ 343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <setpriority>:
+SYSCALL(setpriority)
+ 34b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getallprocinfo>:
+SYSCALL(getallprocinfo)
+ 353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <getcpustats>:
+SYSCALL(getcpustats)
+ 35b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <setscheduler>:
+SYSCALL(setscheduler)
+ 363:	b8 20 00 00 00       	mov    $0x20,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <getdeadlockinfo>:
+SYSCALL(getdeadlockinfo)
+ 36b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getscheduler>:
+SYSCALL(getscheduler)
+ 373:	b8 22 00 00 00       	mov    $0x22,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <splice>:
+SYSCALL(splice)
+ 37b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <readv>:
+SYSCALL(readv)
+ 383:	b8 24 00 00 00       	mov    $0x24,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <writev>:
+SYSCALL(writev)
+ 38b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pread>:
+SYSCALL(pread)
+ 393:	b8 26 00 00 00       	mov    $0x26,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <pwrite>:
+SYSCALL(pwrite)
+ 39b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getlogstat>:
+SYSCALL(getlogstat)
+ 3a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mount>:
+SYSCALL(mount)
+ 3ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <umount>:
+SYSCALL(umount)
+ 3b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mmap>:
+SYSCALL(mmap)
+ 3bb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <munmap>:
+SYSCALL(munmap)
+ 3c3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <membench>:
+SYSCALL(membench)
+ 3cb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getlockstat>:
+SYSCALL(getlockstat)
+ 3d3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <lockbench>:
+SYSCALL(lockbench)
+ 3db:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <prof>:
+SYSCALL(prof)
+ 3e3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <tracectl>:
+SYSCALL(tracectl)
+ 3eb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <traceread>:
+SYSCALL(traceread)
+ 3f3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <getsysstat>:
+SYSCALL(getsysstat)
+ 3fb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getwaitstat>:
+SYSCALL(getwaitstat)
+ 403:	b8 34 00 00 00       	mov    $0x34,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getschedwait>:
+SYSCALL(getschedwait)
+ 40b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <mlfqread>:
+SYSCALL(mlfqread)
+ 413:	b8 36 00 00 00       	mov    $0x36,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <dllock>:
+SYSCALL(dllock)
+ 41b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <watchdogctl>:
+SYSCALL(watchdogctl)
+ 423:	b8 38 00 00 00       	mov    $0x38,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <deadlocklog>:
+SYSCALL(deadlocklog)
+ 42b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <clone>:
+SYSCALL(clone)
+ 433:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <join>:
+SYSCALL(join)
+ 43b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <futex>:
+SYSCALL(futex)
+ 443:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <shmat>:
+SYSCALL(shmat)
+ 44b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <shmdt>:
+SYSCALL(shmdt)
+ 453:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <poll>:
+SYSCALL(poll)
+ 45b:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+ 463:	66 90                	xchg   %ax,%ax
+ 465:	66 90                	xchg   %ax,%ax
+ 467:	66 90                	xchg   %ax,%ax
+ 469:	66 90                	xchg   %ax,%ax
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 478:	89 d1                	mov    %edx,%ecx
+{
+ 47a:	83 ec 3c             	sub    $0x3c,%esp
+ 47d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 480:	85 d2                	test   %edx,%edx
+ 482:	0f 89 80 00 00 00    	jns    508 <printint+0x98>
+ 488:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 48c:	74 7a                	je     508 <printint+0x98>
+    x = -xx;
+ 48e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 490:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 495:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 498:	31 f6                	xor    %esi,%esi
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4a0:	89 c8                	mov    %ecx,%eax
+ 4a2:	31 d2                	xor    %edx,%edx
+ 4a4:	89 f7                	mov    %esi,%edi
+ 4a6:	f7 f3                	div    %ebx
+ 4a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4ab:	0f b6 92 e0 0a 00 00 	movzbl 0xae0(%edx),%edx
+ 4b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4b6:	89 ca                	mov    %ecx,%edx
+ 4b8:	89 c1                	mov    %eax,%ecx
+ 4ba:	39 da                	cmp    %ebx,%edx
+ 4bc:	73 e2                	jae    4a0 <printint+0x30>
+  if(neg)
+ 4be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	74 07                	je     4cc <printint+0x5c>
+    buf[i++] = '-';
+ 4c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ca:	89 f7                	mov    %esi,%edi
+ 4cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4d2:	01 df                	add    %ebx,%edi
+ 4d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	50                   	push   %eax
+ 4e7:	56                   	push   %esi
+ 4e8:	e8 a6 fd ff ff       	call   293 <write>
+  while(--i >= 0)
+ 4ed:	89 f8                	mov    %edi,%eax
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	83 ef 01             	sub    $0x1,%edi
+ 4f5:	39 d8                	cmp    %ebx,%eax
+ 4f7:	75 df                	jne    4d8 <printint+0x68>
+}
+ 4f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4fc:	5b                   	pop    %ebx
+ 4fd:	5e                   	pop    %esi
+ 4fe:	5f                   	pop    %edi
+ 4ff:	5d                   	pop    %ebp
+ 500:	c3                   	ret
+ 501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 508:	31 c0                	xor    %eax,%eax
+ 50a:	eb 89                	jmp    495 <printint+0x25>
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 519:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 51c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 51f:	0f b6 1e             	movzbl (%esi),%ebx
+ 522:	83 c6 01             	add    $0x1,%esi
+ 525:	84 db                	test   %bl,%bl
+ 527:	74 67                	je     590 <printf+0x80>
+ 529:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 52c:	31 d2                	xor    %edx,%edx
+ 52e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 531:	eb 34                	jmp    567 <printf+0x57>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 53b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 540:	83 f8 25             	cmp    $0x25,%eax
+ 543:	74 18                	je     55d <printf+0x4d>
+  write(fd, &c, 1);
+ 545:	83 ec 04             	sub    $0x4,%esp
+ 548:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54e:	6a 01                	push   $0x1
+ 550:	50                   	push   %eax
+ 551:	57                   	push   %edi
+ 552:	e8 3c fd ff ff       	call   293 <write>
+ 557:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 55a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 55d:	0f b6 1e             	movzbl (%esi),%ebx
+ 560:	83 c6 01             	add    $0x1,%esi
+ 563:	84 db                	test   %bl,%bl
+ 565:	74 29                	je     590 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 567:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 56a:	85 d2                	test   %edx,%edx
+ 56c:	74 ca                	je     538 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 56e:	83 fa 25             	cmp    $0x25,%edx
+ 571:	75 ea                	jne    55d <printf+0x4d>
+      if(c == 'd'){
+ 573:	83 f8 25             	cmp    $0x25,%eax
+ 576:	0f 84 24 01 00 00    	je     6a0 <printf+0x190>
+ 57c:	83 e8 63             	sub    $0x63,%eax
+ 57f:	83 f8 15             	cmp    $0x15,%eax
+ 582:	77 1c                	ja     5a0 <printf+0x90>
+ 584:	ff 24 85 88 0a 00 00 	jmp    *0xa88(,%eax,4)
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5f                   	pop    %edi
+ 596:	5d                   	pop    %ebp
+ 597:	c3                   	ret
+ 598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5aa:	6a 01                	push   $0x1
+ 5ac:	52                   	push   %edx
+ 5ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5b0:	57                   	push   %edi
+ 5b1:	e8 dd fc ff ff       	call   293 <write>
+ 5b6:	83 c4 0c             	add    $0xc,%esp
+ 5b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5bc:	6a 01                	push   $0x1
+ 5be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5c1:	52                   	push   %edx
+ 5c2:	57                   	push   %edi
+ 5c3:	e8 cb fc ff ff       	call   293 <write>
+        putc(fd, c);
+ 5c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cb:	31 d2                	xor    %edx,%edx
+ 5cd:	eb 8e                	jmp    55d <printf+0x4d>
+ 5cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 00                	push   $0x0
+ 5df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5e4:	e8 87 fe ff ff       	call   470 <printint>
+        ap++;
+ 5e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 67 ff ff ff       	jmp    55d <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 600:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 603:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 605:	83 c0 04             	add    $0x4,%eax
+ 608:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 60b:	85 db                	test   %ebx,%ebx
+ 60d:	0f 84 9d 00 00 00    	je     6b0 <printf+0x1a0>
+        while(*s != 0){
+ 613:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 616:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 618:	84 c0                	test   %al,%al
+ 61a:	0f 84 3d ff ff ff    	je     55d <printf+0x4d>
+ 620:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 626:	89 de                	mov    %ebx,%esi
+ 628:	89 d3                	mov    %edx,%ebx
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 636:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 639:	6a 01                	push   $0x1
+ 63b:	53                   	push   %ebx
+ 63c:	57                   	push   %edi
+ 63d:	e8 51 fc ff ff       	call   293 <write>
+        while(*s != 0){
+ 642:	0f b6 06             	movzbl (%esi),%eax
+ 645:	83 c4 10             	add    $0x10,%esp
+ 648:	84 c0                	test   %al,%al
+ 64a:	75 e4                	jne    630 <printf+0x120>
+      state = 0;
+ 64c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 07 ff ff ff       	jmp    55d <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 660:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 663:	83 ec 0c             	sub    $0xc,%esp
+ 666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 66b:	8b 13                	mov    (%ebx),%edx
+ 66d:	6a 01                	push   $0x1
+ 66f:	e9 6b ff ff ff       	jmp    5df <printf+0xcf>
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 678:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 681:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 683:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 686:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	52                   	push   %edx
+ 68c:	57                   	push   %edi
+ 68d:	e8 01 fc ff ff       	call   293 <write>
+        ap++;
+ 692:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 695:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 698:	31 d2                	xor    %edx,%edx
+ 69a:	e9 be fe ff ff       	jmp    55d <printf+0x4d>
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	e9 11 ff ff ff       	jmp    5c1 <printf+0xb1>
+ 6b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6b5:	bb 80 0a 00 00       	mov    $0xa80,%ebx
+ 6ba:	e9 61 ff ff ff       	jmp    620 <printf+0x110>
+ 6bf:	90                   	nop
+
+000006c0 <bigfree>:
+  return c;
+}
+
+static void
+bigfree(Header *bp)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c3:	a1 f4 0e 00 00       	mov    0xef4,%eax
+{
+ 6c8:	89 e5                	mov    %esp,%ebp
+ 6ca:	56                   	push   %esi
+ 6cb:	53                   	push   %ebx
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d4:	39 ca                	cmp    %ecx,%edx
+ 6d6:	73 30                	jae    708 <bigfree+0x48>
+ 6d8:	39 c1                	cmp    %eax,%ecx
+ 6da:	72 04                	jb     6e0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6dc:	39 c2                	cmp    %eax,%edx
+ 6de:	72 f0                	jb     6d0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 6e3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 6e6:	39 f0                	cmp    %esi,%eax
+ 6e8:	74 26                	je     710 <bigfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ea:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6ec:	8b 42 04             	mov    0x4(%edx),%eax
+ 6ef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6f2:	39 d9                	cmp    %ebx,%ecx
+ 6f4:	74 30                	je     726 <bigfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6f6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6f8:	5b                   	pop    %ebx
+  freep = p;
+ 6f9:	89 15 f4 0e 00 00    	mov    %edx,0xef4
+}
+ 6ff:	5e                   	pop    %esi
+ 700:	5d                   	pop    %ebp
+ 701:	c3                   	ret
+ 702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 708:	39 c1                	cmp    %eax,%ecx
+ 70a:	72 d0                	jb     6dc <bigfree+0x1c>
+ 70c:	eb c2                	jmp    6d0 <bigfree+0x10>
+ 70e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 710:	03 58 04             	add    0x4(%eax),%ebx
+ 713:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 02                	mov    (%edx),%eax
+ 718:	8b 00                	mov    (%eax),%eax
+ 71a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 71c:	8b 42 04             	mov    0x4(%edx),%eax
+ 71f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 722:	39 d9                	cmp    %ebx,%ecx
+ 724:	75 d0                	jne    6f6 <bigfree+0x36>
+    p->s.size += bp->s.size;
+ 726:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 729:	89 15 f4 0e 00 00    	mov    %edx,0xef4
+    p->s.size += bp->s.size;
+ 72f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 732:	8b 09                	mov    (%ecx),%ecx
+ 734:	89 0a                	mov    %ecx,(%edx)
+}
+ 736:	5b                   	pop    %ebx
+ 737:	5e                   	pop    %esi
+ 738:	5d                   	pop    %ebp
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000740 <bigalloc>:
+}
+
+// Allocate a block of nunits units from the large free list.
+static Header*
+bigalloc(uint nunits)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	89 c7                	mov    %eax,%edi
+ 746:	56                   	push   %esi
+ 747:	53                   	push   %ebx
+ 748:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 74b:	a1 f4 0e 00 00       	mov    0xef4,%eax
+ 750:	85 c0                	test   %eax,%eax
+ 752:	0f 84 88 00 00 00    	je     7e0 <bigalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 758:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 75a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 75d:	39 f9                	cmp    %edi,%ecx
+ 75f:	73 5f                	jae    7c0 <bigalloc+0x80>
+  if(nu < 4096)
+ 761:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 766:	39 df                	cmp    %ebx,%edi
+ 768:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 76b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 772:	eb 0d                	jmp    781 <bigalloc+0x41>
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 778:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 77a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 77d:	39 f9                	cmp    %edi,%ecx
+ 77f:	73 3f                	jae    7c0 <bigalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 781:	89 d0                	mov    %edx,%eax
+ 783:	39 15 f4 0e 00 00    	cmp    %edx,0xef4
+ 789:	75 ed                	jne    778 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 78b:	83 ec 0c             	sub    $0xc,%esp
+ 78e:	56                   	push   %esi
+ 78f:	e8 67 fb ff ff       	call   2fb <sbrk>
+  if(p == (char*)-1)
+ 794:	83 c4 10             	add    $0x10,%esp
+ 797:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 79a:	74 11                	je     7ad <bigalloc+0x6d>
+  hp->s.size = nu;
+ 79c:	89 58 04             	mov    %ebx,0x4(%eax)
+  bigfree(hp);
+ 79f:	e8 1c ff ff ff       	call   6c0 <bigfree>
+  return freep;
+ 7a4:	a1 f4 0e 00 00       	mov    0xef4,%eax
+      if((p = morecore(nunits)) == 0)
+ 7a9:	85 c0                	test   %eax,%eax
+ 7ab:	75 cb                	jne    778 <bigalloc+0x38>
+        return 0;
+  }
+}
+ 7ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7b0:	31 d2                	xor    %edx,%edx
+}
+ 7b2:	5b                   	pop    %ebx
+ 7b3:	89 d0                	mov    %edx,%eax
+ 7b5:	5e                   	pop    %esi
+ 7b6:	5f                   	pop    %edi
+ 7b7:	5d                   	pop    %ebp
+ 7b8:	c3                   	ret
+ 7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7c0:	39 cf                	cmp    %ecx,%edi
+ 7c2:	74 4c                	je     810 <bigalloc+0xd0>
+        p->s.size -= nunits;
+ 7c4:	29 f9                	sub    %edi,%ecx
+ 7c6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7c9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7cc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7cf:	a3 f4 0e 00 00       	mov    %eax,0xef4
+}
+ 7d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d7:	89 d0                	mov    %edx,%eax
+ 7d9:	5b                   	pop    %ebx
+ 7da:	5e                   	pop    %esi
+ 7db:	5f                   	pop    %edi
+ 7dc:	5d                   	pop    %ebp
+ 7dd:	c3                   	ret
+ 7de:	66 90                	xchg   %ax,%ax
+    base.s.ptr = freep = prevp = &base;
+ 7e0:	c7 05 f4 0e 00 00 f8 	movl   $0xef8,0xef4
+ 7e7:	0e 00 00 
+    base.s.size = 0;
+ 7ea:	ba f8 0e 00 00       	mov    $0xef8,%edx
+    base.s.ptr = freep = prevp = &base;
+ 7ef:	c7 05 f8 0e 00 00 f8 	movl   $0xef8,0xef8
+ 7f6:	0e 00 00 
+    base.s.size = 0;
+ 7f9:	c7 05 fc 0e 00 00 00 	movl   $0x0,0xefc
+ 800:	00 00 00 
+    if(p->s.size >= nunits){
+ 803:	e9 59 ff ff ff       	jmp    761 <bigalloc+0x21>
+ 808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 810:	8b 0a                	mov    (%edx),%ecx
+ 812:	89 08                	mov    %ecx,(%eax)
+ 814:	eb b9                	jmp    7cf <bigalloc+0x8f>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <free>:
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	53                   	push   %ebx
+ 824:	83 ec 04             	sub    $0x4,%esp
+ 827:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if(ap == 0)
+ 82a:	85 c9                	test   %ecx,%ecx
+ 82c:	74 58                	je     886 <free+0x66>
+  bp = (Header*)ap - 1;
+ 82e:	8d 59 f8             	lea    -0x8(%ecx),%ebx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 831:	ba 01 00 00 00       	mov    $0x1,%edx
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+ 840:	89 d0                	mov    %edx,%eax
+ 842:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+  while(xchg(&locked, 1) != 0)
+ 849:	85 c0                	test   %eax,%eax
+ 84b:	75 f3                	jne    840 <free+0x20>
+  if(bp->s.size <= MAXSMALL){
+ 84d:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 850:	83 fa 40             	cmp    $0x40,%edx
+ 853:	77 3b                	ja     890 <free+0x70>
+  for(c = 0; classunits[c] < nunits; c++)
+ 855:	83 fa 02             	cmp    $0x2,%edx
+ 858:	76 3f                	jbe    899 <free+0x79>
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 860:	83 c0 01             	add    $0x1,%eax
+ 863:	39 14 85 00 0b 00 00 	cmp    %edx,0xb00(,%eax,4)
+ 86a:	72 f4                	jb     860 <free+0x40>
+    bp->s.ptr = classfree[c];
+ 86c:	8b 14 85 c0 0e 00 00 	mov    0xec0(,%eax,4),%edx
+    classfree[c] = bp;
+ 873:	89 1c 85 c0 0e 00 00 	mov    %ebx,0xec0(,%eax,4)
+    bp->s.ptr = classfree[c];
+ 87a:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 87d:	31 c0                	xor    %eax,%eax
+ 87f:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+}
+ 886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 889:	c9                   	leave
+ 88a:	c3                   	ret
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+    bigfree(bp);
+ 890:	89 d8                	mov    %ebx,%eax
+ 892:	e8 29 fe ff ff       	call   6c0 <bigfree>
+ 897:	eb e4                	jmp    87d <free+0x5d>
+  for(c = 0; classunits[c] < nunits; c++)
+ 899:	31 c0                	xor    %eax,%eax
+ 89b:	eb cf                	jmp    86c <free+0x4c>
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <malloc>:
+  return 0;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8a6:	89 e5                	mov    %esp,%ebp
+ 8a8:	57                   	push   %edi
+ 8a9:	56                   	push   %esi
+ 8aa:	53                   	push   %ebx
+ 8ab:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b1:	8d 50 07             	lea    0x7(%eax),%edx
+ 8b4:	c1 ea 03             	shr    $0x3,%edx
+ 8b7:	83 c2 01             	add    $0x1,%edx
+  while(xchg(&locked, 1) != 0)
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8c0:	89 c8                	mov    %ecx,%eax
+ 8c2:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+ 8c9:	85 c0                	test   %eax,%eax
+ 8cb:	75 f3                	jne    8c0 <malloc+0x20>
+    ;
+  if(nunits > MAXSMALL)
+ 8cd:	89 c3                	mov    %eax,%ebx
+ 8cf:	83 fa 40             	cmp    $0x40,%edx
+ 8d2:	77 4c                	ja     920 <malloc+0x80>
+  for(c = 0; classunits[c] < nunits; c++)
+ 8d4:	be 02 00 00 00       	mov    $0x2,%esi
+ 8d9:	83 fa 02             	cmp    $0x2,%edx
+ 8dc:	76 10                	jbe    8ee <malloc+0x4e>
+ 8de:	66 90                	xchg   %ax,%ax
+ 8e0:	83 c3 01             	add    $0x1,%ebx
+ 8e3:	8b 34 9d 00 0b 00 00 	mov    0xb00(,%ebx,4),%esi
+ 8ea:	39 d6                	cmp    %edx,%esi
+ 8ec:	72 f2                	jb     8e0 <malloc+0x40>
+    p = bigalloc(nunits);
+  else {
+    c = sizeclass(nunits);
+    if(classfree[c] == 0 && moreclass(c) < 0)
+ 8ee:	8b 14 9d c0 0e 00 00 	mov    0xec0(,%ebx,4),%edx
+ 8f5:	85 d2                	test   %edx,%edx
+ 8f7:	74 47                	je     940 <malloc+0xa0>
+      p = 0;
+    else {
+      p = classfree[c];
+      classfree[c] = p->s.ptr;
+ 8f9:	8b 3a                	mov    (%edx),%edi
+ 8fb:	89 3c 9d c0 0e 00 00 	mov    %edi,0xec0(,%ebx,4)
+ 902:	31 c0                	xor    %eax,%eax
+ 904:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+    }
+  }
+  xchg(&locked, 0);
+  return p ? (void*)(p + 1) : 0;
+}
+ 90b:	83 c4 1c             	add    $0x1c,%esp
+  return p ? (void*)(p + 1) : 0;
+ 90e:	8d 42 08             	lea    0x8(%edx),%eax
+}
+ 911:	5b                   	pop    %ebx
+ 912:	5e                   	pop    %esi
+ 913:	5f                   	pop    %edi
+ 914:	5d                   	pop    %ebp
+ 915:	c3                   	ret
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = bigalloc(nunits);
+ 920:	89 d0                	mov    %edx,%eax
+ 922:	e8 19 fe ff ff       	call   740 <bigalloc>
+ 927:	89 c2                	mov    %eax,%edx
+ 929:	89 d8                	mov    %ebx,%eax
+ 92b:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+  return p ? (void*)(p + 1) : 0;
+ 932:	85 d2                	test   %edx,%edx
+ 934:	75 d5                	jne    90b <malloc+0x6b>
+ 936:	31 c0                	xor    %eax,%eax
+}
+ 938:	83 c4 1c             	add    $0x1c,%esp
+ 93b:	5b                   	pop    %ebx
+ 93c:	5e                   	pop    %esi
+ 93d:	5f                   	pop    %edi
+ 93e:	5d                   	pop    %ebp
+ 93f:	c3                   	ret
+  if((slab = bigalloc(SLABUNITS)) == 0)
+ 940:	b8 00 02 00 00       	mov    $0x200,%eax
+ 945:	e8 f6 fd ff ff       	call   740 <bigalloc>
+ 94a:	85 c0                	test   %eax,%eax
+ 94c:	74 44                	je     992 <malloc+0xf2>
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 94e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 955:	8b 14 9d c0 0e 00 00 	mov    0xec0(,%ebx,4),%edx
+ 95c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 95f:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ 962:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+ 968:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 96b:	39 cf                	cmp    %ecx,%edi
+ 96d:	72 8a                	jb     8f9 <malloc+0x59>
+ 96f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ 972:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 975:	8d 76 00             	lea    0x0(%esi),%esi
+ 978:	89 d7                	mov    %edx,%edi
+    bp->s.size = n;
+ 97a:	89 70 04             	mov    %esi,0x4(%eax)
+ 97d:	89 c2                	mov    %eax,%edx
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 97f:	01 d9                	add    %ebx,%ecx
+    bp->s.ptr = classfree[c];
+ 981:	89 38                	mov    %edi,(%eax)
+  for(bp = slab; bp + n <= slab + SLABUNITS; bp += n){
+ 983:	01 d8                	add    %ebx,%eax
+ 985:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+ 988:	73 ee                	jae    978 <malloc+0xd8>
+ 98a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 98d:	e9 69 ff ff ff       	jmp    8fb <malloc+0x5b>
+ 992:	f0 87 05 a0 0e 00 00 	lock xchg %eax,0xea0
+  return p ? (void*)(p + 1) : 0;
+ 999:	31 c0                	xor    %eax,%eax
+ 99b:	eb 9b                	jmp    938 <malloc+0x98>
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009a0 <calloc>:
+
+void*
+calloc(uint nelem, uint elsize)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	56                   	push   %esi
+ 9a4:	53                   	push   %ebx
+ 9a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a8:	f7 65 0c             	mull   0xc(%ebp)
+ 9ab:	70 33                	jo     9e0 <calloc+0x40>
+  uint n;
+
+  n = nelem * elsize;
+  if(elsize != 0 && n / elsize != nelem)
+    return 0;
+  if((p = malloc(n)) != 0)
+ 9ad:	83 ec 0c             	sub    $0xc,%esp
+ 9b0:	89 c3                	mov    %eax,%ebx
+ 9b2:	50                   	push   %eax
+ 9b3:	e8 e8 fe ff ff       	call   8a0 <malloc>
+ 9b8:	83 c4 10             	add    $0x10,%esp
+ 9bb:	89 c6                	mov    %eax,%esi
+ 9bd:	85 c0                	test   %eax,%eax
+ 9bf:	74 1f                	je     9e0 <calloc+0x40>
+    memset(p, 0, n);
+ 9c1:	83 ec 04             	sub    $0x4,%esp
+ 9c4:	53                   	push   %ebx
+ 9c5:	6a 00                	push   $0x0
+ 9c7:	50                   	push   %eax
+ 9c8:	e8 23 f7 ff ff       	call   f0 <memset>
+ 9cd:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9d3:	89 f0                	mov    %esi,%eax
+ 9d5:	5b                   	pop    %ebx
+ 9d6:	5e                   	pop    %esi
+ 9d7:	5d                   	pop    %ebp
+ 9d8:	c3                   	ret
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 9e3:	31 f6                	xor    %esi,%esi
+}
+ 9e5:	89 f0                	mov    %esi,%eax
+ 9e7:	5b                   	pop    %ebx
+ 9e8:	5e                   	pop    %esi
+ 9e9:	5d                   	pop    %ebp
+ 9ea:	c3                   	ret
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+
+000009f0 <realloc>:
+
+// Resize the block at ap to nbytes, moving it if it does
+// not fit. realloc(0, n) is malloc(n).
+void*
+realloc(void *ap, uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+ 9f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ 9ff:	85 db                	test   %ebx,%ebx
+ a01:	74 55                	je     a58 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a03:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a06:	89 de                	mov    %ebx,%esi
+ a08:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a0f:	39 c7                	cmp    %eax,%edi
+ a11:	72 0d                	jb     a20 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a16:	89 f0                	mov    %esi,%eax
+ a18:	5b                   	pop    %ebx
+ a19:	5e                   	pop    %esi
+ a1a:	5f                   	pop    %edi
+ a1b:	5d                   	pop    %ebp
+ a1c:	c3                   	ret
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a20:	83 ec 0c             	sub    $0xc,%esp
+ a23:	50                   	push   %eax
+ a24:	e8 77 fe ff ff       	call   8a0 <malloc>
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	89 c6                	mov    %eax,%esi
+ a2e:	85 c0                	test   %eax,%eax
+ a30:	74 e1                	je     a13 <realloc+0x23>
+  memmove(p, ap, have);
+ a32:	83 ec 04             	sub    $0x4,%esp
+ a35:	57                   	push   %edi
+ a36:	53                   	push   %ebx
+ a37:	50                   	push   %eax
+ a38:	e8 03 f8 ff ff       	call   240 <memmove>
+  free(ap);
+ a3d:	89 1c 24             	mov    %ebx,(%esp)
+ a40:	e8 db fd ff ff       	call   820 <free>
+  return p;
+ a45:	83 c4 10             	add    $0x10,%esp
+}
+ a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4b:	89 f0                	mov    %esi,%eax
+ a4d:	5b                   	pop    %ebx
+ a4e:	5e                   	pop    %esi
+ a4f:	5f                   	pop    %edi
+ a50:	5d                   	pop    %ebp
+ a51:	c3                   	ret
+ a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a58:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a5e:	5b                   	pop    %ebx
+ a5f:	5e                   	pop    %esi
+ a60:	5f                   	pop    %edi
+ a61:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a62:	e9 39 fe ff ff       	jmp    8a0 <malloc>